@@ -0,0 +1,400 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+#include "amp_message_buffer.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include AMP message channels. This #if is closed at the very bottom of
+ * this file. If you want to include AMP message channels then ensure
+ * configUSE_AMP_MESSAGE_BUFFERS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_AMP_MESSAGE_BUFFERS == 1 )
+
+/* The message buffer at index 0 of the shared region carries messages from the
+ * primary processor to the other processor, the one at index 1 messages from
+ * the other processor to the primary. */
+    #define ampmbFROM_PRIMARY    0
+    #define ampmbTO_PRIMARY      1
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Ring the doorbell now if the calling task is not within a batch, otherwise
+ * remember to ring it when the batch ends.
+ */
+    static void prvRequestDoorbell( AMPMessageChannel_t * pxChannel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Ring any doorbell held back by a batch.  Called before the calling task
+ * blocks, as the other processor may be waiting for that doorbell before it can
+ * send or receive the message that would unblock the task.
+ */
+    static void prvFlushDoorbell( AMPMessageChannel_t * pxChannel ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xAMPMessageChannelCreate( AMPMessageChannel_t * pxChannel,
+                                         void * pvSharedRegion,
+                                         size_t xStorageBytes,
+                                         BaseType_t xIsPrimary,
+                                         AMPDoorbellFunction_t pxRingDoorbell,
+                                         void * pvDoorbellContext )
+    {
+        AMPSharedRegion_t * const pxRegion = ( AMPSharedRegion_t * ) pvSharedRegion;
+        uint8_t * const pucStorage = &( ( ( uint8_t * ) pvSharedRegion )[ ampmbSTORAGE_OFFSET ] );
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xAMPMessageChannelCreate( pxChannel, pvSharedRegion, xStorageBytes, xIsPrimary, pxRingDoorbell, pvDoorbellContext );
+
+        configASSERT( pxChannel );
+        configASSERT( pvSharedRegion );
+        configASSERT( pxRingDoorbell );
+        configASSERT( ( ( portPOINTER_SIZE_TYPE ) pvSharedRegion & ( portPOINTER_SIZE_TYPE ) ( configSTREAM_BUFFER_STORAGE_ALIGNMENT - 1 ) ) == 0U );
+        configASSERT( ( xStorageBytes & ( ( size_t ) configSTREAM_BUFFER_STORAGE_ALIGNMENT - 1U ) ) == ( size_t ) 0U );
+
+        if( xIsPrimary != pdFALSE )
+        {
+            /* The other processor must not attach while the message buffers
+             * are being created. */
+            pxRegion->ulReady = 0U;
+            configAMP_MEMORY_BARRIER();
+
+            ( void ) memset( pucStorage, 0x00, ( size_t ) 2U * xStorageBytes );
+            ( void ) xStreamBufferGenericCreateStatic( xStorageBytes, 0, sbTYPE_MESSAGE_BUFFER | sbTYPE_INTERPROCESSOR,
+                                                       pucStorage, &( pxRegion->xRings[ ampmbFROM_PRIMARY ] ), NULL, NULL );
+            ( void ) xStreamBufferGenericCreateStatic( xStorageBytes, 0, sbTYPE_MESSAGE_BUFFER | sbTYPE_INTERPROCESSOR,
+                                                       &( pucStorage[ xStorageBytes ] ), &( pxRegion->xRings[ ampmbTO_PRIMARY ] ), NULL, NULL );
+
+            pxRegion->ulControlBlockBytes = ( uint32_t ) sizeof( StaticMessageBuffer_t );
+            pxRegion->ulStorageBytes = ( uint32_t ) xStorageBytes;
+
+            /* Publish the region only once everything above is visible to
+             * the other processor. */
+            configAMP_MEMORY_BARRIER();
+            pxRegion->ulReady = ampmbREGION_READY;
+
+            pxChannel->xTxRing = ( MessageBufferHandle_t ) &( pxRegion->xRings[ ampmbFROM_PRIMARY ] );
+            pxChannel->xRxRing = ( MessageBufferHandle_t ) &( pxRegion->xRings[ ampmbTO_PRIMARY ] );
+            xReturn = pdPASS;
+        }
+        else if( pxRegion->ulReady == ampmbREGION_READY )
+        {
+            configAMP_MEMORY_BARRIER();
+
+            /* Both processors must be built with the same stream buffer
+             * options, and must agree on the size of the storage areas. */
+            configASSERT( pxRegion->ulControlBlockBytes == ( uint32_t ) sizeof( StaticMessageBuffer_t ) );
+            configASSERT( pxRegion->ulStorageBytes == ( uint32_t ) xStorageBytes );
+
+            if( ( pxRegion->ulControlBlockBytes == ( uint32_t ) sizeof( StaticMessageBuffer_t ) ) &&
+                ( pxRegion->ulStorageBytes == ( uint32_t ) xStorageBytes ) )
+            {
+                pxChannel->xTxRing = ( MessageBufferHandle_t ) &( pxRegion->xRings[ ampmbTO_PRIMARY ] );
+                pxChannel->xRxRing = ( MessageBufferHandle_t ) &( pxRegion->xRings[ ampmbFROM_PRIMARY ] );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            /* The primary processor has not initialised the region yet. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn == pdPASS )
+        {
+            pxChannel->pxRingDoorbell = pxRingDoorbell;
+            pxChannel->pvDoorbellContext = pvDoorbellContext;
+            pxChannel->uxBatchNesting = ( UBaseType_t ) 0U;
+            pxChannel->xDoorbellPending = pdFALSE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xAMPMessageChannelCreate( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xAMPMessageChannelSend( AMPMessageChannel_t * pxChannel,
+                                   const void * pvTxData,
+                                   size_t xDataLengthBytes,
+                                   TickType_t xTicksToWait )
+    {
+        size_t xReturn;
+
+        traceENTER_xAMPMessageChannelSend( pxChannel, pvTxData, xDataLengthBytes, xTicksToWait );
+
+        configASSERT( pxChannel );
+
+        xReturn = xMessageBufferSend( pxChannel->xTxRing, pvTxData, xDataLengthBytes, 0 );
+
+        if( ( xReturn == ( size_t ) 0 ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+        {
+            prvFlushDoorbell( pxChannel );
+            xReturn = xMessageBufferSend( pxChannel->xTxRing, pvTxData, xDataLengthBytes, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn != ( size_t ) 0 )
+        {
+            prvRequestDoorbell( pxChannel );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xAMPMessageChannelSend( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xAMPMessageChannelSendFromISR( AMPMessageChannel_t * pxChannel,
+                                          const void * pvTxData,
+                                          size_t xDataLengthBytes )
+    {
+        size_t xReturn;
+
+        traceENTER_xAMPMessageChannelSendFromISR( pxChannel, pvTxData, xDataLengthBytes );
+
+        configASSERT( pxChannel );
+
+        /* No task on this processor is unblocked by writing to the message
+         * buffer, so there is no need for a higher priority task woken
+         * parameter. */
+        xReturn = xMessageBufferSendFromISR( pxChannel->xTxRing, pvTxData, xDataLengthBytes, NULL );
+
+        if( xReturn != ( size_t ) 0 )
+        {
+            traceAMP_MESSAGE_CHANNEL_DOORBELL( pxChannel );
+            pxChannel->pxRingDoorbell( pxChannel->pvDoorbellContext );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xAMPMessageChannelSendFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xAMPMessageChannelReceive( AMPMessageChannel_t * pxChannel,
+                                      void * pvRxData,
+                                      size_t xBufferLengthBytes,
+                                      TickType_t xTicksToWait )
+    {
+        size_t xReturn;
+
+        traceENTER_xAMPMessageChannelReceive( pxChannel, pvRxData, xBufferLengthBytes, xTicksToWait );
+
+        configASSERT( pxChannel );
+
+        xReturn = xMessageBufferReceive( pxChannel->xRxRing, pvRxData, xBufferLengthBytes, 0 );
+
+        if( ( xReturn == ( size_t ) 0 ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+        {
+            prvFlushDoorbell( pxChannel );
+            xReturn = xMessageBufferReceive( pxChannel->xRxRing, pvRxData, xBufferLengthBytes, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn != ( size_t ) 0 )
+        {
+            prvRequestDoorbell( pxChannel );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xAMPMessageChannelReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vAMPMessageChannelBeginBatch( AMPMessageChannel_t * pxChannel )
+    {
+        traceENTER_vAMPMessageChannelBeginBatch( pxChannel );
+
+        configASSERT( pxChannel );
+
+        taskENTER_CRITICAL();
+        {
+            ( pxChannel->uxBatchNesting )++;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vAMPMessageChannelBeginBatch();
+    }
+/*-----------------------------------------------------------*/
+
+    void vAMPMessageChannelEndBatch( AMPMessageChannel_t * pxChannel )
+    {
+        UBaseType_t uxBatchNesting;
+
+        traceENTER_vAMPMessageChannelEndBatch( pxChannel );
+
+        configASSERT( pxChannel );
+        configASSERT( pxChannel->uxBatchNesting > ( UBaseType_t ) 0U );
+
+        taskENTER_CRITICAL();
+        {
+            ( pxChannel->uxBatchNesting )--;
+            uxBatchNesting = pxChannel->uxBatchNesting;
+        }
+        taskEXIT_CRITICAL();
+
+        if( uxBatchNesting == ( UBaseType_t ) 0U )
+        {
+            prvFlushDoorbell( pxChannel );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vAMPMessageChannelEndBatch();
+    }
+/*-----------------------------------------------------------*/
+
+    void vAMPMessageChannelDoorbellFromISR( AMPMessageChannel_t * pxChannel,
+                                            BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        traceENTER_vAMPMessageChannelDoorbellFromISR( pxChannel, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxChannel );
+
+        /* The other processor either sent a message, which may unblock a task
+         * waiting to receive, or received one, which may unblock a task
+         * waiting for space.  The waiting tasks are held in the shared message
+         * buffers but were blocked by this processor, so only this processor
+         * can unblock them. */
+        ( void ) xMessageBufferSendCompletedFromISR( pxChannel->xRxRing, pxHigherPriorityTaskWoken );
+        ( void ) xMessageBufferReceiveCompletedFromISR( pxChannel->xTxRing, pxHigherPriorityTaskWoken );
+
+        traceRETURN_vAMPMessageChannelDoorbellFromISR();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRequestDoorbell( AMPMessageChannel_t * pxChannel )
+    {
+        BaseType_t xRingDoorbell = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            if( pxChannel->uxBatchNesting == ( UBaseType_t ) 0U )
+            {
+                xRingDoorbell = pdTRUE;
+            }
+            else
+            {
+                pxChannel->xDoorbellPending = pdTRUE;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xRingDoorbell != pdFALSE )
+        {
+            traceAMP_MESSAGE_CHANNEL_DOORBELL( pxChannel );
+            pxChannel->pxRingDoorbell( pxChannel->pvDoorbellContext );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvFlushDoorbell( AMPMessageChannel_t * pxChannel )
+    {
+        BaseType_t xRingDoorbell = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            if( pxChannel->xDoorbellPending != pdFALSE )
+            {
+                pxChannel->xDoorbellPending = pdFALSE;
+                xRingDoorbell = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xRingDoorbell != pdFALSE )
+        {
+            traceAMP_MESSAGE_CHANNEL_DOORBELL( pxChannel );
+            pxChannel->pxRingDoorbell( pxChannel->pvDoorbellContext );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include AMP message channels. If you want to include AMP message channels
+ * then ensure configUSE_AMP_MESSAGE_BUFFERS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_AMP_MESSAGE_BUFFERS == 1 */
@@ -0,0 +1,236 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "async_task.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include async task functionality. This #if is closed at the very bottom
+ * of this file. If you want to include async tasks then ensure
+ * configUSE_ASYNC_TASKS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_ASYNC_TASKS == 1 )
+
+/*
+ * The event handler function of every async task.  Calls the async task
+ * function, which carries on from where it last waited.
+ */
+    static void prvResumeAsyncTask( void * pvParameter ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xAsyncTaskInit( AsyncTask_t * pxTask,
+                               AsyncTaskFunction_t pxFunction,
+                               void * pvParameter,
+                               UBaseType_t uxPriority )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xAsyncTaskInit( pxTask, pxFunction, pvParameter, uxPriority );
+
+        configASSERT( pxTask );
+        configASSERT( pxFunction );
+
+        pxTask->pxFunction = pxFunction;
+        pxTask->pvParameter = pvParameter;
+        pxTask->uxState = ( UBaseType_t ) 0U;
+        pxTask->xTicksToWait = ( TickType_t ) 0;
+        pxTask->uxNotifyCount = ( UBaseType_t ) 0U;
+
+        xReturn = xEventHandlerInit( &( pxTask->xHandler ), prvResumeAsyncTask, ( void * ) pxTask, uxPriority );
+
+        if( xReturn == pdPASS )
+        {
+            /* Run the async task function for the first time. */
+            ( void ) xEventHandlerPost( &( pxTask->xHandler ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xAsyncTaskInit( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vAsyncTaskNotifyGive( AsyncTask_t * pxTask )
+    {
+        traceENTER_vAsyncTaskNotifyGive( pxTask );
+
+        configASSERT( pxTask );
+
+        taskENTER_CRITICAL();
+        {
+            ( pxTask->uxNotifyCount )++;
+        }
+        taskEXIT_CRITICAL();
+
+        /* Resume the async task so it sees the notification.  Posting fails
+         * harmlessly if the async task is already waiting to run. */
+        ( void ) xEventHandlerPost( &( pxTask->xHandler ) );
+
+        traceRETURN_vAsyncTaskNotifyGive();
+    }
+/*-----------------------------------------------------------*/
+
+    void vAsyncTaskNotifyGiveFromISR( AsyncTask_t * pxTask,
+                                      BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_vAsyncTaskNotifyGiveFromISR( pxTask, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxTask );
+
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            ( pxTask->uxNotifyCount )++;
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        ( void ) xEventHandlerPostFromISR( &( pxTask->xHandler ), pxHigherPriorityTaskWoken );
+
+        traceRETURN_vAsyncTaskNotifyGiveFromISR();
+    }
+/*-----------------------------------------------------------*/
+
+    void vAsyncTaskInternalStartWait( AsyncTask_t * pxTask,
+                                      TickType_t xTicksToWait )
+    {
+        vTaskSetTimeOutState( &( pxTask->xTimeOut ) );
+        pxTask->xTicksToWait = xTicksToWait;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xAsyncTaskInternalContinueWait( AsyncTask_t * pxTask,
+                                               BaseType_t xRetryEveryTick )
+    {
+        BaseType_t xReturn = pdFALSE;
+        TickType_t xTicksToDelay;
+
+        if( xTaskCheckForTimeOut( &( pxTask->xTimeOut ), &( pxTask->xTicksToWait ) ) == pdFALSE )
+        {
+            /* Resume the async task when the wait times out, or on the next
+             * tick if whatever it is waiting for has to be tried again. */
+            if( xRetryEveryTick != pdFALSE )
+            {
+                xTicksToDelay = ( TickType_t ) 1;
+            }
+            else
+            {
+                xTicksToDelay = pxTask->xTicksToWait;
+            }
+
+            #if ( INCLUDE_vTaskSuspend == 1 )
+            {
+                if( xTicksToDelay == portMAX_DELAY )
+                {
+                    /* Waiting indefinitely, so only a notification resumes the
+                     * async task.  The async task is left out of the
+                     * dispatcher's lists. */
+                    xTicksToDelay = ( TickType_t ) 0;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* INCLUDE_vTaskSuspend */
+
+            if( xTicksToDelay != ( TickType_t ) 0 )
+            {
+                ( void ) xEventHandlerPostDelayed( &( pxTask->xHandler ), xTicksToDelay );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xAsyncTaskInternalNotifyTake( AsyncTask_t * pxTask )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            if( pxTask->uxNotifyCount > ( UBaseType_t ) 0U )
+            {
+                ( pxTask->uxNotifyCount )--;
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvResumeAsyncTask( void * pvParameter )
+    {
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        AsyncTask_t * const pxTask = ( AsyncTask_t * ) pvParameter;
+
+        traceASYNC_TASK_RESUME( pxTask );
+
+        pxTask->pxFunction( pxTask, pxTask->pvParameter );
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include async task functionality. If you want to include async tasks then
+ * ensure configUSE_ASYNC_TASKS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_ASYNC_TASKS == 1 */
@@ -0,0 +1,329 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "barrier.h"
+
+#if ( configUSE_BARRIERS == 1 )
+    #include "atomic.h"
+#endif
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include barrier functionality. This #if is closed at the very bottom of
+ * this file. If you want to include barriers then ensure configUSE_BARRIERS is
+ * set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_BARRIERS == 1 )
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define barrierYIELD_IF_USING_PREEMPTION()
+    #else
+        #if ( configNUMBER_OF_CORES == 1 )
+            #define barrierYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+        #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            #define barrierYIELD_IF_USING_PREEMPTION()    vTaskYieldWithinAPI()
+        #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+    #endif
+
+/* The barrier state holds the phase number in its upper 16 bits and the number
+ * of tasks that have arrived in the phase in its lower 16 bits, so a task
+ * arriving updates both with one compare and swap. */
+    #define barrierPHASE_SHIFT                    16U
+    #define barrierARRIVED_MASK                   ( ( uint32_t ) 0xffffU )
+    #define barrierGET_PHASE( ulState )           ( ( ulState ) >> barrierPHASE_SHIFT )
+    #define barrierGET_ARRIVED( ulState )         ( ( ulState ) & barrierARRIVED_MASK )
+
+/* Evaluates to a non-zero value if *pulDestination held ulComparand and was
+ * atomically set to ulExchange. */
+    #ifdef portATOMIC_COMPARE_AND_SWAP_U32
+        #define barrierCOMPARE_AND_SWAP( pulDestination, ulExchange, ulComparand )    portATOMIC_COMPARE_AND_SWAP_U32( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
+    #else
+        #define barrierCOMPARE_AND_SWAP( pulDestination, ulExchange, ulComparand )    Atomic_CompareAndSwap_u32( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by a task that has arrived at the barrier in phase ulPhase, but did
+ * not release it, to wait for the barrier to leave that phase.  The task's
+ * arrival is withdrawn if xTicksToWait expires first.
+ */
+    static BaseType_t prvBarrierWaitForRelease( Barrier_t * const pxBarrier,
+                                                const uint32_t ulPhase,
+                                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks every task waiting at the barrier.  Returns pdTRUE if any of them
+ * has a priority higher than the calling task.  Must be called from a
+ * critical section.
+ */
+    static BaseType_t prvUnblockAllWaiting( Barrier_t * const pxBarrier ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    void vBarrierInit( Barrier_t * pxBarrier,
+                       UBaseType_t uxParticipants )
+    {
+        traceENTER_vBarrierInit( pxBarrier, uxParticipants );
+
+        configASSERT( pxBarrier );
+        configASSERT( uxParticipants > ( UBaseType_t ) 0U );
+        configASSERT( ( ( uint32_t ) uxParticipants & ~barrierARRIVED_MASK ) == 0U );
+
+        pxBarrier->ulState = 0U;
+        pxBarrier->ulParticipants = ( uint32_t ) uxParticipants;
+        vListInitialise( &( pxBarrier->xTasksWaiting ) );
+
+        traceRETURN_vBarrierInit();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xBarrierWait( Barrier_t * pxBarrier,
+                             TickType_t xTicksToWait )
+    {
+        uint32_t ulState;
+        uint32_t ulNewState;
+        BaseType_t xReturn;
+
+        traceENTER_xBarrierWait( pxBarrier, xTicksToWait );
+
+        configASSERT( pxBarrier );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0U ) ) );
+        }
+        #endif
+
+        /* Arrive.  The last task to arrive moves the barrier to the next phase
+         * with no tasks arrived, which releases it. */
+        do
+        {
+            ulState = pxBarrier->ulState;
+
+            if( ( barrierGET_ARRIVED( ulState ) + 1U ) == pxBarrier->ulParticipants )
+            {
+                ulNewState = ( barrierGET_PHASE( ulState ) + 1U ) << barrierPHASE_SHIFT;
+            }
+            else
+            {
+                ulNewState = ulState + 1U;
+            }
+        } while( barrierCOMPARE_AND_SWAP( &( pxBarrier->ulState ), ulNewState, ulState ) == 0U );
+
+        if( barrierGET_ARRIVED( ulNewState ) == 0U )
+        {
+            traceBARRIER_RELEASE( pxBarrier );
+
+            /* Tasks that arrived earlier in the phase see the new phase
+             * number before blocking, or are on the list of waiting tasks. */
+            taskENTER_CRITICAL();
+            {
+                if( prvUnblockAllWaiting( pxBarrier ) != pdFALSE )
+                {
+                    barrierYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            xReturn = barrierLAST_ARRIVAL;
+        }
+        else
+        {
+            xReturn = prvBarrierWaitForRelease( pxBarrier, barrierGET_PHASE( ulState ), xTicksToWait );
+        }
+
+        traceRETURN_xBarrierWait( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxBarrierGetPhase( const Barrier_t * pxBarrier )
+    {
+        UBaseType_t uxReturn;
+
+        traceENTER_uxBarrierGetPhase( pxBarrier );
+
+        configASSERT( pxBarrier );
+
+        uxReturn = ( UBaseType_t ) barrierGET_PHASE( pxBarrier->ulState );
+
+        traceRETURN_uxBarrierGetPhase( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvBarrierWaitForRelease( Barrier_t * const pxBarrier,
+                                                const uint32_t ulPhase,
+                                                TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xWaitComplete = pdFALSE;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+        uint32_t ulState;
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                ulState = pxBarrier->ulState;
+
+                if( barrierGET_PHASE( ulState ) != ulPhase )
+                {
+                    /* The barrier has been released. */
+                    xReturn = pdPASS;
+                    xWaitComplete = pdTRUE;
+                }
+                else if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* Withdraw this task's arrival, unless the last task
+                     * arrives first, as other tasks can arrive without
+                     * entering a critical section. */
+                    while( barrierCOMPARE_AND_SWAP( &( pxBarrier->ulState ), ulState - 1U, ulState ) == 0U )
+                    {
+                        ulState = pxBarrier->ulState;
+
+                        if( barrierGET_PHASE( ulState ) != ulPhase )
+                        {
+                            xReturn = pdPASS;
+                            break;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+
+                    xWaitComplete = pdTRUE;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xWaitComplete != pdFALSE )
+            {
+                break;
+            }
+
+            vTaskSuspendAll();
+
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                /* The phase is checked again in the same critical section the
+                 * task is placed on the list of waiting tasks, as the last task
+                 * to arrive can be running on another core. */
+                taskENTER_CRITICAL();
+                {
+                    if( barrierGET_PHASE( pxBarrier->ulState ) == ulPhase )
+                    {
+                        traceBLOCKING_ON_BARRIER( pxBarrier );
+                        vTaskPlaceOnEventList( &( pxBarrier->xTasksWaiting ), xTicksToWait );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Timed out.  Return to check the phase one last time with
+                 * xTicksToWait now 0. */
+                ( void ) xTaskResumeAll();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvUnblockAllWaiting( Barrier_t * const pxBarrier )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        while( listLIST_IS_EMPTY( &( pxBarrier->xTasksWaiting ) ) == pdFALSE )
+        {
+            if( xTaskRemoveFromEventList( &( pxBarrier->xTasksWaiting ) ) != pdFALSE )
+            {
+                xHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xHigherPriorityTaskWoken;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include barrier functionality. If you want to include barriers then
+ * ensure configUSE_BARRIERS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_BARRIERS == 1 */
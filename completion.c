@@ -0,0 +1,230 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "completion.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include completion functionality. This #if is closed at the very bottom
+ * of this file. If you want to include completions then ensure
+ * configUSE_COMPLETIONS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_COMPLETIONS == 1 )
+
+    void vCompletionInit( Completion_t * pxCompletion )
+    {
+        traceENTER_vCompletionInit( pxCompletion );
+
+        configASSERT( pxCompletion );
+
+        pxCompletion->xTaskToNotify = NULL;
+        pxCompletion->ulStatus = 0U;
+        pxCompletion->xSignalled = pdFALSE;
+
+        traceRETURN_vCompletionInit();
+    }
+/*-----------------------------------------------------------*/
+
+    void vCompletionArm( Completion_t * pxCompletion )
+    {
+        TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+
+        traceENTER_vCompletionArm( pxCompletion );
+
+        configASSERT( pxCompletion );
+
+        /* Any notification left pending at configCOMPLETION_NOTIFY_INDEX is
+         * not cleared, as xCompletionWait() checks xSignalled each time it is
+         * unblocked. */
+        taskENTER_CRITICAL();
+        {
+            pxCompletion->ulStatus = 0U;
+            pxCompletion->xSignalled = pdFALSE;
+            pxCompletion->xTaskToNotify = xCurrentTask;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vCompletionArm();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCompletionWait( Completion_t * pxCompletion,
+                                uint32_t * pulStatus,
+                                TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+        TimeOut_t xTimeOut;
+
+        traceENTER_xCompletionWait( pxCompletion, pulStatus, xTicksToWait );
+
+        configASSERT( pxCompletion );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0U ) ) );
+        }
+        #endif
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            if( pxCompletion->xSignalled != pdFALSE )
+            {
+                xReturn = pdPASS;
+                break;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                /* Disarm the completion, unless it is signalled first. */
+                taskENTER_CRITICAL();
+                {
+                    if( pxCompletion->xSignalled != pdFALSE )
+                    {
+                        xReturn = pdPASS;
+                    }
+                    else
+                    {
+                        pxCompletion->xTaskToNotify = NULL;
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                break;
+            }
+            else
+            {
+                /* A signal that arrives after xSignalled was checked leaves
+                 * the notification pending, so the task does not block. */
+                traceBLOCKING_ON_COMPLETION( pxCompletion );
+                ( void ) ulTaskNotifyTakeIndexed( configCOMPLETION_NOTIFY_INDEX, pdTRUE, xTicksToWait );
+            }
+        }
+
+        if( ( xReturn == pdPASS ) && ( pulStatus != NULL ) )
+        {
+            *pulStatus = pxCompletion->ulStatus;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xCompletionWait( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vCompletionSignal( Completion_t * pxCompletion,
+                            uint32_t ulStatus )
+    {
+        TaskHandle_t xTaskToNotify;
+
+        traceENTER_vCompletionSignal( pxCompletion, ulStatus );
+
+        configASSERT( pxCompletion );
+
+        taskENTER_CRITICAL();
+        {
+            xTaskToNotify = pxCompletion->xTaskToNotify;
+
+            /* The completion is disarmed as it is signalled, so the waiting
+             * task is notified once per operation. */
+            pxCompletion->ulStatus = ulStatus;
+            pxCompletion->xSignalled = pdTRUE;
+            pxCompletion->xTaskToNotify = NULL;
+
+            traceCOMPLETION_SIGNAL( pxCompletion, ulStatus );
+
+            if( xTaskToNotify != NULL )
+            {
+                ( void ) xTaskNotifyGiveIndexed( xTaskToNotify, configCOMPLETION_NOTIFY_INDEX );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vCompletionSignal();
+    }
+/*-----------------------------------------------------------*/
+
+    void vCompletionSignalFromISR( Completion_t * pxCompletion,
+                                   uint32_t ulStatus,
+                                   BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        TaskHandle_t xTaskToNotify;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_vCompletionSignalFromISR( pxCompletion, ulStatus, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxCompletion );
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            xTaskToNotify = pxCompletion->xTaskToNotify;
+
+            pxCompletion->ulStatus = ulStatus;
+            pxCompletion->xSignalled = pdTRUE;
+            pxCompletion->xTaskToNotify = NULL;
+
+            traceCOMPLETION_SIGNAL_FROM_ISR( pxCompletion, ulStatus );
+
+            if( xTaskToNotify != NULL )
+            {
+                vTaskNotifyGiveIndexedFromISR( xTaskToNotify, configCOMPLETION_NOTIFY_INDEX, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_vCompletionSignalFromISR();
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include completion functionality. If you want to include completions then
+ * ensure configUSE_COMPLETIONS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_COMPLETIONS == 1 */
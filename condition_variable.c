@@ -0,0 +1,251 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "condition_variable.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include condition variable functionality. This #if is closed at the very
+ * bottom of this file. If you want to include condition variables then ensure
+ * configUSE_CONDITION_VARIABLES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_CONDITION_VARIABLES == 1 )
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define condYIELD_IF_USING_PREEMPTION()
+    #else
+        #if ( configNUMBER_OF_CORES == 1 )
+            #define condYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+        #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            #define condYIELD_IF_USING_PREEMPTION()    vTaskYieldWithinAPI()
+        #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+    #endif
+
+/*-----------------------------------------------------------*/
+
+    void vCondInit( CondVar_t * pxCond )
+    {
+        traceENTER_vCondInit( pxCond );
+
+        configASSERT( pxCond );
+
+        pxCond->xMutex = NULL;
+        vListInitialise( &( pxCond->xTasksWaiting ) );
+
+        traceRETURN_vCondInit();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCondWait( CondVar_t * pxCond,
+                          SemaphoreHandle_t xMutex,
+                          TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+        TimeOut_t xTimeOut;
+
+        traceENTER_xCondWait( pxCond, xMutex, xTicksToWait );
+
+        configASSERT( pxCond );
+        configASSERT( xMutex );
+
+        /* All the tasks waiting on a condition variable must use the same
+         * mutex, as vCondBroadcast() moves them to its list of waiting
+         * tasks. */
+        configASSERT( ( pxCond->xMutex == NULL ) || ( pxCond->xMutex == xMutex ) );
+
+        #if ( INCLUDE_xSemaphoreGetMutexHolder == 1 )
+        {
+            configASSERT( xSemaphoreGetMutexHolder( xMutex ) == xTaskGetCurrentTaskHandle() );
+        }
+        #endif
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( xTaskGetSchedulerState() != taskSCHEDULER_SUSPENDED );
+        }
+        #endif
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+
+            /* Give the mutex and block in one critical section with the
+             * scheduler suspended, so no other task can take the mutex and
+             * signal the condition variable before this task is on its list of
+             * waiting tasks.  Giving the mutex first lets any inherited
+             * priority be disinherited while the task is still in the Ready
+             * state. */
+            vTaskSuspendAll();
+            taskENTER_CRITICAL();
+            {
+                pxCond->xMutex = xMutex;
+                ( void ) xSemaphoreGive( xMutex );
+
+                traceBLOCKING_ON_COND( pxCond );
+                vTaskPlaceOnEventList( &( pxCond->xTasksWaiting ), xTicksToWait );
+            }
+            taskEXIT_CRITICAL();
+
+            if( xTaskResumeAll() == pdFALSE )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The task is unblocked by a signal, by the mutex being given after
+             * a broadcast moved the task to the mutex's list, or by its block
+             * time expiring. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            while( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdFALSE )
+            {
+                /* Only reached if INCLUDE_vTaskSuspend is 0, in which case
+                 * portMAX_DELAY is not an indefinite block time. */
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xCondWait( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vCondSignal( CondVar_t * pxCond )
+    {
+        traceENTER_vCondSignal( pxCond );
+
+        configASSERT( pxCond );
+
+        taskENTER_CRITICAL();
+        {
+            if( listLIST_IS_EMPTY( &( pxCond->xTasksWaiting ) ) == pdFALSE )
+            {
+                traceCOND_SIGNAL( pxCond );
+
+                if( xTaskRemoveFromEventList( &( pxCond->xTasksWaiting ) ) != pdFALSE )
+                {
+                    condYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vCondSignal();
+    }
+/*-----------------------------------------------------------*/
+
+    void vCondBroadcast( CondVar_t * pxCond )
+    {
+        BaseType_t xHigherPriorityTaskWoken;
+
+        traceENTER_vCondBroadcast( pxCond );
+
+        configASSERT( pxCond );
+
+        taskENTER_CRITICAL();
+        {
+            if( listLIST_IS_EMPTY( &( pxCond->xTasksWaiting ) ) == pdFALSE )
+            {
+                traceCOND_BROADCAST( pxCond );
+
+                /* Only the highest priority task is unblocked.  It takes the
+                 * mutex and, when it gives the mutex back, unblocks the next of
+                 * the tasks moved to the mutex's list, so the mutex is always
+                 * given while they wait for it. */
+                xHigherPriorityTaskWoken = xTaskRemoveFromEventList( &( pxCond->xTasksWaiting ) );
+
+                if( listLIST_IS_EMPTY( &( pxCond->xTasksWaiting ) ) == pdFALSE )
+                {
+                    vQueueMoveWaitingTasksToMutex( pxCond->xMutex, &( pxCond->xTasksWaiting ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xHigherPriorityTaskWoken != pdFALSE )
+                {
+                    condYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vCondBroadcast();
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include condition variable functionality. If you want to include
+ * condition variables then ensure configUSE_CONDITION_VARIABLES is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_CONDITION_VARIABLES == 1 */
@@ -42,45 +42,77 @@
     #endif
 
 
-/* Lists for ready and blocked co-routines. --------------------*/
-    static List_t pxReadyCoRoutineLists[ configMAX_CO_ROUTINE_PRIORITIES ]; /**< Prioritised ready co-routines. */
-    static List_t xDelayedCoRoutineList1;                                   /**< Delayed co-routines. */
-    static List_t xDelayedCoRoutineList2;                                   /**< Delayed co-routines (two lists are used - one for delays that have overflowed the current tick count. */
-    static List_t * pxDelayedCoRoutineList = NULL;                          /**< Points to the delayed co-routine list currently being used. */
-    static List_t * pxOverflowDelayedCoRoutineList = NULL;                  /**< Points to the delayed co-routine list currently being used to hold co-routines that have overflowed the current tick count. */
-    static List_t xPendingReadyCoRoutineList;                               /**< Holds co-routines that have been readied by an external event.  They cannot be added directly to the ready lists as the ready lists cannot be accessed by interrupts. */
-
-/* Other file private variables. --------------------------------*/
-    CRCB_t * pxCurrentCoRoutine = NULL;
-    static UBaseType_t uxTopCoRoutineReadyPriority = ( UBaseType_t ) 0U;
-    static TickType_t xCoRoutineTickCount = ( TickType_t ) 0U;
-    static TickType_t xLastTickCount = ( TickType_t ) 0U;
-    static TickType_t xPassedTicks = ( TickType_t ) 0U;
+/* The number of co-routine schedulers.  With configUSE_PER_CORE_CO_ROUTINES
+ * each core has its own scheduler, which is only ever accessed from that core,
+ * so the schedulers need no more protection than a single scheduler does. */
+    #if ( configUSE_PER_CORE_CO_ROUTINES == 1 )
+        #define corNUMBER_OF_SCHEDULERS           ( configNUMBER_OF_CORES )
+        #define corGET_SCHEDULER()                ( &( xCoRoutineSchedulers[ portGET_CORE_ID() ] ) )
+        #define corSCHEDULER_OF( pxCRCB )         ( &( xCoRoutineSchedulers[ ( pxCRCB )->xCoreID ] ) )
+    #else
+        #define corNUMBER_OF_SCHEDULERS           ( 1 )
+        #define corGET_SCHEDULER()                ( &( xCoRoutineSchedulers[ 0 ] ) )
+        #define corSCHEDULER_OF( pxCRCB )         ( &( xCoRoutineSchedulers[ 0 ] ) )
+    #endif
+
+/* uxReadyPriorities[] holds one bit per co-routine priority.  A bit is set
+ * while the ready list for that priority is not empty, so the highest priority
+ * ready co-routine is found without walking down every priority level. */
+    #define corBITS_PER_BYTE                      ( ( UBaseType_t ) 8U )
+    #define corREADY_BITMAP_BITS_PER_WORD         ( ( UBaseType_t ) ( sizeof( UBaseType_t ) * corBITS_PER_BYTE ) )
+    #define corREADY_BITMAP_WORDS                 ( ( ( UBaseType_t ) configMAX_CO_ROUTINE_PRIORITIES + corREADY_BITMAP_BITS_PER_WORD - 1U ) / corREADY_BITMAP_BITS_PER_WORD )
+    #define corREADY_BITMAP_WORD( uxPriority )    ( ( UBaseType_t ) ( uxPriority ) / corREADY_BITMAP_BITS_PER_WORD )
+    #define corREADY_BITMAP_MASK( uxPriority )    ( ( UBaseType_t ) 1U << ( ( UBaseType_t ) ( uxPriority ) % corREADY_BITMAP_BITS_PER_WORD ) )
+
+/* The state of one co-routine scheduler. */
+    typedef struct corCoRoutineScheduler
+    {
+        List_t xReadyCoRoutineLists[ configMAX_CO_ROUTINE_PRIORITIES ]; /**< Prioritised ready co-routines. */
+        List_t xDelayedCoRoutineList1;                                  /**< Delayed co-routines. */
+        List_t xDelayedCoRoutineList2;                                  /**< Delayed co-routines (two lists are used - one for delays that have overflowed the current tick count. */
+        List_t * pxDelayedCoRoutineList;                                /**< Points to the delayed co-routine list currently being used. */
+        List_t * pxOverflowDelayedCoRoutineList;                        /**< Points to the delayed co-routine list currently being used to hold co-routines that have overflowed the current tick count. */
+        List_t xPendingReadyCoRoutineList;                              /**< Holds co-routines that have been readied by an external event.  They cannot be added directly to the ready lists as the ready lists cannot be accessed by interrupts. */
+        CRCB_t * pxCurrentCoRoutine;                                    /**< The co-routine that is running, or was run last. */
+        UBaseType_t uxReadyPriorities[ corREADY_BITMAP_WORDS ];         /**< One bit per priority, set if the ready list for that priority is not empty. */
+        TickType_t xCoRoutineTickCount;
+        TickType_t xLastTickCount;
+        TickType_t xPassedTicks;
+    } CoRoutineScheduler_t;
+
+/* The co-routine schedulers. */
+    static CoRoutineScheduler_t xCoRoutineSchedulers[ corNUMBER_OF_SCHEDULERS ];
 
 /* The initial state of the co-routine when it is created. */
     #define corINITIAL_STATE    ( 0 )
 
 /*
  * Place the co-routine represented by pxCRCB into the appropriate ready queue
- * for the priority.  It is inserted at the end of the list.
+ * of pxScheduler for the priority.  It is inserted at the end of the list.
  *
  * This macro accesses the co-routine ready lists and therefore must not be
  * used from within an ISR.
  */
-    #define prvAddCoRoutineToReadyQueue( pxCRCB )                                                                               \
-    do {                                                                                                                        \
-        if( ( pxCRCB )->uxPriority > uxTopCoRoutineReadyPriority )                                                              \
-        {                                                                                                                       \
-            uxTopCoRoutineReadyPriority = ( pxCRCB )->uxPriority;                                                               \
-        }                                                                                                                       \
-        vListInsertEnd( ( List_t * ) &( pxReadyCoRoutineLists[ ( pxCRCB )->uxPriority ] ), &( ( pxCRCB )->xGenericListItem ) ); \
+    #define prvAddCoRoutineToReadyQueue( pxScheduler, pxCRCB )                                                                               \
+    do {                                                                                                                                     \
+        ( pxScheduler )->uxReadyPriorities[ corREADY_BITMAP_WORD( ( pxCRCB )->uxPriority ) ] |= corREADY_BITMAP_MASK( ( pxCRCB )->uxPriority ); \
+        vListInsertEnd( &( ( pxScheduler )->xReadyCoRoutineLists[ ( pxCRCB )->uxPriority ] ), &( ( pxCRCB )->xGenericListItem ) );           \
     } while( 0 )
 
 /*
- * Utility to ready all the lists used by the scheduler.  This is called
- * automatically upon the creation of the first co-routine.
+ * Utility to ready all the lists used by a scheduler.  This is called
+ * automatically upon the creation of the first co-routine of the scheduler.
+ */
+    static void prvInitialiseCoRoutineLists( CoRoutineScheduler_t * const pxScheduler );
+
+/*
+ * Create a co-routine and add it to the ready lists of pxScheduler.
  */
-    static void prvInitialiseCoRoutineLists( void );
+    static BaseType_t prvCreateCoRoutine( CoRoutineScheduler_t * const pxScheduler,
+                                          crCOROUTINE_CODE pxCoRoutineCode,
+                                          UBaseType_t uxPriority,
+                                          UBaseType_t uxIndex,
+                                          BaseType_t xCoreID );
 
 /*
  * Co-routines that are readied by an interrupt cannot be placed directly into
@@ -88,7 +120,7 @@
  * in the pending ready list in order that they can later be moved to the ready
  * list by the co-routine scheduler.
  */
-    static void prvCheckPendingReadyList( void );
+    static void prvCheckPendingReadyList( CoRoutineScheduler_t * const pxScheduler );
 
 /*
  * Macro that looks at the list of co-routines that are currently delayed to
@@ -98,19 +130,26 @@
  * meaning once one co-routine has been found whose timer has not expired
  * we need not look any further down the list.
  */
-    static void prvCheckDelayedList( void );
+    static void prvCheckDelayedList( CoRoutineScheduler_t * const pxScheduler );
+
+/*
+ * Find the highest priority that has ready co-routines from the ready bitmap
+ * of pxScheduler.  Returns pdFALSE if no co-routine is ready.
+ */
+    static BaseType_t prvGetHighestReadyPriority( const CoRoutineScheduler_t * const pxScheduler,
+                                                  UBaseType_t * const puxPriority );
 
 /*-----------------------------------------------------------*/
 
-    BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode,
-                                 UBaseType_t uxPriority,
-                                 UBaseType_t uxIndex )
+    static BaseType_t prvCreateCoRoutine( CoRoutineScheduler_t * const pxScheduler,
+                                          crCOROUTINE_CODE pxCoRoutineCode,
+                                          UBaseType_t uxPriority,
+                                          UBaseType_t uxIndex,
+                                          BaseType_t xCoreID )
     {
         BaseType_t xReturn;
         CRCB_t * pxCoRoutine;
 
-        traceENTER_xCoRoutineCreate( pxCoRoutineCode, uxPriority, uxIndex );
-
         /* Allocate the memory that will store the co-routine control block. */
         /* MISRA Ref 11.5.1 [Malloc memory assignment] */
         /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
@@ -119,12 +158,13 @@
 
         if( pxCoRoutine )
         {
-            /* If pxCurrentCoRoutine is NULL then this is the first co-routine to
-            * be created and the co-routine data structures need initialising. */
-            if( pxCurrentCoRoutine == NULL )
+            /* If pxCurrentCoRoutine is NULL then this is the first co-routine of
+             * the scheduler to be created and the scheduler's data structures
+             * need initialising. */
+            if( pxScheduler->pxCurrentCoRoutine == NULL )
             {
-                pxCurrentCoRoutine = pxCoRoutine;
-                prvInitialiseCoRoutineLists();
+                pxScheduler->pxCurrentCoRoutine = pxCoRoutine;
+                prvInitialiseCoRoutineLists( pxScheduler );
             }
 
             /* Check the priority is within limits. */
@@ -139,6 +179,16 @@
             pxCoRoutine->uxIndex = uxIndex;
             pxCoRoutine->pxCoRoutineFunction = pxCoRoutineCode;
 
+            #if ( configUSE_PER_CORE_CO_ROUTINES == 1 )
+            {
+                pxCoRoutine->xCoreID = xCoreID;
+            }
+            #else
+            {
+                ( void ) xCoreID;
+            }
+            #endif
+
             /* Initialise all the other co-routine control block parameters. */
             vListInitialiseItem( &( pxCoRoutine->xGenericListItem ) );
             vListInitialiseItem( &( pxCoRoutine->xEventListItem ) );
@@ -154,7 +204,7 @@
 
             /* Now the co-routine has been initialised it can be added to the ready
              * list at the correct priority. */
-            prvAddCoRoutineToReadyQueue( pxCoRoutine );
+            prvAddCoRoutineToReadyQueue( pxScheduler, pxCoRoutine );
 
             xReturn = pdPASS;
         }
@@ -163,42 +213,98 @@
             xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
         }
 
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode,
+                                 UBaseType_t uxPriority,
+                                 UBaseType_t uxIndex )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xCoRoutineCreate( pxCoRoutineCode, uxPriority, uxIndex );
+
+        #if ( configUSE_PER_CORE_CO_ROUTINES == 1 )
+        {
+            /* The co-routine is run by the scheduler of the calling core. */
+            xReturn = xCoRoutineCreateOnCore( pxCoRoutineCode, uxPriority, uxIndex, ( BaseType_t ) portGET_CORE_ID() );
+        }
+        #else
+        {
+            xReturn = prvCreateCoRoutine( corGET_SCHEDULER(), pxCoRoutineCode, uxPriority, uxIndex, 0 );
+        }
+        #endif
+
         traceRETURN_xCoRoutineCreate( xReturn );
 
         return xReturn;
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_PER_CORE_CO_ROUTINES == 1 )
+
+        BaseType_t xCoRoutineCreateOnCore( crCOROUTINE_CODE pxCoRoutineCode,
+                                           UBaseType_t uxPriority,
+                                           UBaseType_t uxIndex,
+                                           BaseType_t xCoreID )
+        {
+            BaseType_t xReturn;
+
+            traceENTER_xCoRoutineCreateOnCore( pxCoRoutineCode, uxPriority, uxIndex, xCoreID );
+
+            configASSERT( taskVALID_CORE_ID( xCoreID ) == pdTRUE );
+
+            xReturn = prvCreateCoRoutine( &( xCoRoutineSchedulers[ xCoreID ] ), pxCoRoutineCode, uxPriority, uxIndex, xCoreID );
+
+            traceRETURN_xCoRoutineCreateOnCore( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_PER_CORE_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
     void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay,
                                      List_t * pxEventList )
     {
+        CoRoutineScheduler_t * const pxScheduler = corGET_SCHEDULER();
+        CRCB_t * const pxCurrentCoRoutine = pxScheduler->pxCurrentCoRoutine;
         TickType_t xTimeToWake;
 
         traceENTER_vCoRoutineAddToDelayedList( xTicksToDelay, pxEventList );
 
         /* Calculate the time to wake - this may overflow but this is
          * not a problem. */
-        xTimeToWake = xCoRoutineTickCount + xTicksToDelay;
+        xTimeToWake = pxScheduler->xCoRoutineTickCount + xTicksToDelay;
 
         /* We must remove ourselves from the ready list before adding
          * ourselves to the blocked list as the same list item is used for
          * both lists. */
-        ( void ) uxListRemove( ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+        if( uxListRemove( ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+        {
+            /* The ready list for the co-routine's priority is now empty. */
+            pxScheduler->uxReadyPriorities[ corREADY_BITMAP_WORD( pxCurrentCoRoutine->uxPriority ) ] &= ~corREADY_BITMAP_MASK( pxCurrentCoRoutine->uxPriority );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
         /* The list item will be inserted in wake time order. */
         listSET_LIST_ITEM_VALUE( &( pxCurrentCoRoutine->xGenericListItem ), xTimeToWake );
 
-        if( xTimeToWake < xCoRoutineTickCount )
+        if( xTimeToWake < pxScheduler->xCoRoutineTickCount )
         {
             /* Wake time has overflowed.  Place this item in the
              * overflow list. */
-            vListInsert( ( List_t * ) pxOverflowDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+            vListInsert( ( List_t * ) pxScheduler->pxOverflowDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
         }
         else
         {
             /* The wake time has not overflowed, so we can use the
              * current block list. */
-            vListInsert( ( List_t * ) pxDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
+            vListInsert( ( List_t * ) pxScheduler->pxDelayedCoRoutineList, ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
         }
 
         if( pxEventList )
@@ -212,58 +318,58 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvCheckPendingReadyList( void )
+    static void prvCheckPendingReadyList( CoRoutineScheduler_t * const pxScheduler )
     {
         /* Are there any co-routines waiting to get moved to the ready list?  These
          * are co-routines that have been readied by an ISR.  The ISR cannot access
          * the ready lists itself. */
-        while( listLIST_IS_EMPTY( &xPendingReadyCoRoutineList ) == pdFALSE )
+        while( listLIST_IS_EMPTY( &( pxScheduler->xPendingReadyCoRoutineList ) ) == pdFALSE )
         {
             CRCB_t * pxUnblockedCRCB;
 
             /* The pending ready list can be accessed by an ISR. */
             portDISABLE_INTERRUPTS();
             {
-                pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyCoRoutineList ) );
+                pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &( pxScheduler->xPendingReadyCoRoutineList ) ) );
                 ( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
             }
             portENABLE_INTERRUPTS();
 
             ( void ) uxListRemove( &( pxUnblockedCRCB->xGenericListItem ) );
-            prvAddCoRoutineToReadyQueue( pxUnblockedCRCB );
+            prvAddCoRoutineToReadyQueue( pxScheduler, pxUnblockedCRCB );
         }
     }
 /*-----------------------------------------------------------*/
 
-    static void prvCheckDelayedList( void )
+    static void prvCheckDelayedList( CoRoutineScheduler_t * const pxScheduler )
     {
         CRCB_t * pxCRCB;
 
-        xPassedTicks = xTaskGetTickCount() - xLastTickCount;
+        pxScheduler->xPassedTicks = xTaskGetTickCount() - pxScheduler->xLastTickCount;
 
-        while( xPassedTicks )
+        while( pxScheduler->xPassedTicks )
         {
-            xCoRoutineTickCount++;
-            xPassedTicks--;
+            pxScheduler->xCoRoutineTickCount++;
+            pxScheduler->xPassedTicks--;
 
             /* If the tick count has overflowed we need to swap the ready lists. */
-            if( xCoRoutineTickCount == 0 )
+            if( pxScheduler->xCoRoutineTickCount == 0 )
             {
                 List_t * pxTemp;
 
                 /* Tick count has overflowed so we need to swap the delay lists.  If there are
                  * any items in pxDelayedCoRoutineList here then there is an error! */
-                pxTemp = pxDelayedCoRoutineList;
-                pxDelayedCoRoutineList = pxOverflowDelayedCoRoutineList;
-                pxOverflowDelayedCoRoutineList = pxTemp;
+                pxTemp = pxScheduler->pxDelayedCoRoutineList;
+                pxScheduler->pxDelayedCoRoutineList = pxScheduler->pxOverflowDelayedCoRoutineList;
+                pxScheduler->pxOverflowDelayedCoRoutineList = pxTemp;
             }
 
             /* See if this tick has made a timeout expire. */
-            while( listLIST_IS_EMPTY( pxDelayedCoRoutineList ) == pdFALSE )
+            while( listLIST_IS_EMPTY( pxScheduler->pxDelayedCoRoutineList ) == pdFALSE )
             {
-                pxCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedCoRoutineList );
+                pxCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxScheduler->pxDelayedCoRoutineList );
 
-                if( xCoRoutineTickCount < listGET_LIST_ITEM_VALUE( &( pxCRCB->xGenericListItem ) ) )
+                if( pxScheduler->xCoRoutineTickCount < listGET_LIST_ITEM_VALUE( &( pxCRCB->xGenericListItem ) ) )
                 {
                     /* Timeout not yet expired. */
                     break;
@@ -286,76 +392,128 @@
                 }
                 portENABLE_INTERRUPTS();
 
-                prvAddCoRoutineToReadyQueue( pxCRCB );
+                prvAddCoRoutineToReadyQueue( pxScheduler, pxCRCB );
             }
         }
 
-        xLastTickCount = xCoRoutineTickCount;
+        pxScheduler->xLastTickCount = pxScheduler->xCoRoutineTickCount;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvGetHighestReadyPriority( const CoRoutineScheduler_t * const pxScheduler,
+                                                  UBaseType_t * const puxPriority )
+    {
+        UBaseType_t uxWordIndex = corREADY_BITMAP_WORDS;
+        UBaseType_t uxWord = 0U;
+        UBaseType_t uxShift;
+        UBaseType_t uxHighestBit;
+        BaseType_t xReturn = pdFALSE;
+
+        /* Find the highest non-zero word of the bitmap. */
+        while( ( uxWord == 0U ) && ( uxWordIndex > 0U ) )
+        {
+            uxWordIndex--;
+            uxWord = pxScheduler->uxReadyPriorities[ uxWordIndex ];
+        }
+
+        if( uxWord != 0U )
+        {
+            /* Binary search for the most significant set bit - this takes a
+             * fixed number of steps for a given UBaseType_t width. */
+            uxHighestBit = 0U;
+
+            for( uxShift = corREADY_BITMAP_BITS_PER_WORD / 2U; uxShift > 0U; uxShift /= 2U )
+            {
+                if( ( uxWord >> ( uxHighestBit + uxShift ) ) != 0U )
+                {
+                    uxHighestBit += uxShift;
+                }
+            }
+
+            *puxPriority = ( uxWordIndex * corREADY_BITMAP_BITS_PER_WORD ) + uxHighestBit;
+            configASSERT( listLIST_IS_EMPTY( &( pxScheduler->xReadyCoRoutineLists[ *puxPriority ] ) ) == pdFALSE );
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
     }
 /*-----------------------------------------------------------*/
 
     void vCoRoutineSchedule( void )
     {
+        CoRoutineScheduler_t * pxScheduler;
+        UBaseType_t uxTopPriority;
+
         traceENTER_vCoRoutineSchedule();
 
+        #if ( configUSE_PER_CORE_CO_ROUTINES == 1 )
+        {
+            /* The calling task must not move to another core while it runs
+             * the co-routines of this one. */
+            configASSERT( vTaskCoreAffinityGet( NULL ) == ( ( UBaseType_t ) 1U << ( UBaseType_t ) portGET_CORE_ID() ) );
+        }
+        #endif
+
+        pxScheduler = corGET_SCHEDULER();
+
         /* Only run a co-routine after prvInitialiseCoRoutineLists() has been
          * called.  prvInitialiseCoRoutineLists() is called automatically when a
          * co-routine is created. */
-        if( pxDelayedCoRoutineList != NULL )
+        if( pxScheduler->pxDelayedCoRoutineList != NULL )
         {
             /* See if any co-routines readied by events need moving to the ready lists. */
-            prvCheckPendingReadyList();
+            prvCheckPendingReadyList( pxScheduler );
 
             /* See if any delayed co-routines have timed out. */
-            prvCheckDelayedList();
+            prvCheckDelayedList( pxScheduler );
 
             /* Find the highest priority queue that contains ready co-routines. */
-            while( listLIST_IS_EMPTY( &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) ) )
+            if( prvGetHighestReadyPriority( pxScheduler, &uxTopPriority ) == pdFALSE )
             {
-                if( uxTopCoRoutineReadyPriority == 0 )
-                {
-                    /* No more co-routines to check. */
-                    return;
-                }
-
-                --uxTopCoRoutineReadyPriority;
+                /* No more co-routines to check. */
+                return;
             }
 
             /* listGET_OWNER_OF_NEXT_ENTRY walks through the list, so the co-routines
              * of the same priority get an equal share of the processor time. */
-            listGET_OWNER_OF_NEXT_ENTRY( pxCurrentCoRoutine, &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) );
+            listGET_OWNER_OF_NEXT_ENTRY( pxScheduler->pxCurrentCoRoutine, &( pxScheduler->xReadyCoRoutineLists[ uxTopPriority ] ) );
 
             /* Call the co-routine. */
-            ( pxCurrentCoRoutine->pxCoRoutineFunction )( pxCurrentCoRoutine, pxCurrentCoRoutine->uxIndex );
+            ( pxScheduler->pxCurrentCoRoutine->pxCoRoutineFunction )( pxScheduler->pxCurrentCoRoutine, pxScheduler->pxCurrentCoRoutine->uxIndex );
         }
 
         traceRETURN_vCoRoutineSchedule();
     }
 /*-----------------------------------------------------------*/
 
-    static void prvInitialiseCoRoutineLists( void )
+    static void prvInitialiseCoRoutineLists( CoRoutineScheduler_t * const pxScheduler )
     {
         UBaseType_t uxPriority;
 
         for( uxPriority = 0; uxPriority < configMAX_CO_ROUTINE_PRIORITIES; uxPriority++ )
         {
-            vListInitialise( ( List_t * ) &( pxReadyCoRoutineLists[ uxPriority ] ) );
+            vListInitialise( ( List_t * ) &( pxScheduler->xReadyCoRoutineLists[ uxPriority ] ) );
         }
 
-        vListInitialise( ( List_t * ) &xDelayedCoRoutineList1 );
-        vListInitialise( ( List_t * ) &xDelayedCoRoutineList2 );
-        vListInitialise( ( List_t * ) &xPendingReadyCoRoutineList );
+        vListInitialise( ( List_t * ) &( pxScheduler->xDelayedCoRoutineList1 ) );
+        vListInitialise( ( List_t * ) &( pxScheduler->xDelayedCoRoutineList2 ) );
+        vListInitialise( ( List_t * ) &( pxScheduler->xPendingReadyCoRoutineList ) );
 
         /* Start with pxDelayedCoRoutineList using list1 and the
          * pxOverflowDelayedCoRoutineList using list2. */
-        pxDelayedCoRoutineList = &xDelayedCoRoutineList1;
-        pxOverflowDelayedCoRoutineList = &xDelayedCoRoutineList2;
+        pxScheduler->pxDelayedCoRoutineList = &( pxScheduler->xDelayedCoRoutineList1 );
+        pxScheduler->pxOverflowDelayedCoRoutineList = &( pxScheduler->xDelayedCoRoutineList2 );
     }
 /*-----------------------------------------------------------*/
 
     BaseType_t xCoRoutineRemoveFromEventList( const List_t * pxEventList )
     {
         CRCB_t * pxUnblockedCRCB;
+        CoRoutineScheduler_t * pxScheduler;
         BaseType_t xReturn;
 
         traceENTER_xCoRoutineRemoveFromEventList( pxEventList );
@@ -364,10 +522,19 @@
          * event lists and the pending ready list.  This function assumes that a
          * check has already been made to ensure pxEventList is not empty. */
         pxUnblockedCRCB = ( CRCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList );
+        pxScheduler = corSCHEDULER_OF( pxUnblockedCRCB );
+
+        #if ( configUSE_PER_CORE_CO_ROUTINES == 1 )
+        {
+            /* The pending ready list of another core cannot be accessed safely. */
+            configASSERT( pxUnblockedCRCB->xCoreID == ( BaseType_t ) portGET_CORE_ID() );
+        }
+        #endif
+
         ( void ) uxListRemove( &( pxUnblockedCRCB->xEventListItem ) );
-        vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxUnblockedCRCB->xEventListItem ) );
+        vListInsertEnd( ( List_t * ) &( pxScheduler->xPendingReadyCoRoutineList ), &( pxUnblockedCRCB->xEventListItem ) );
 
-        if( pxUnblockedCRCB->uxPriority >= pxCurrentCoRoutine->uxPriority )
+        if( pxUnblockedCRCB->uxPriority >= pxScheduler->pxCurrentCoRoutine->uxPriority )
         {
             xReturn = pdTRUE;
         }
@@ -389,16 +556,28 @@
  */
     void vCoRoutineResetState( void )
     {
-        /* Lists for ready and blocked co-routines. */
-        pxDelayedCoRoutineList = NULL;
-        pxOverflowDelayedCoRoutineList = NULL;
-
-        /* Other file private variables. */
-        pxCurrentCoRoutine = NULL;
-        uxTopCoRoutineReadyPriority = ( UBaseType_t ) 0U;
-        xCoRoutineTickCount = ( TickType_t ) 0U;
-        xLastTickCount = ( TickType_t ) 0U;
-        xPassedTicks = ( TickType_t ) 0U;
+        BaseType_t xScheduler;
+        UBaseType_t uxWord;
+
+        for( xScheduler = 0; xScheduler < ( BaseType_t ) corNUMBER_OF_SCHEDULERS; xScheduler++ )
+        {
+            CoRoutineScheduler_t * const pxScheduler = &( xCoRoutineSchedulers[ xScheduler ] );
+
+            /* Lists for ready and blocked co-routines. */
+            pxScheduler->pxDelayedCoRoutineList = NULL;
+            pxScheduler->pxOverflowDelayedCoRoutineList = NULL;
+
+            /* Other scheduler variables. */
+            pxScheduler->pxCurrentCoRoutine = NULL;
+            pxScheduler->xCoRoutineTickCount = ( TickType_t ) 0U;
+            pxScheduler->xLastTickCount = ( TickType_t ) 0U;
+            pxScheduler->xPassedTicks = ( TickType_t ) 0U;
+
+            for( uxWord = 0U; uxWord < corREADY_BITMAP_WORDS; uxWord++ )
+            {
+                pxScheduler->uxReadyPriorities[ uxWord ] = ( UBaseType_t ) 0U;
+            }
+        }
     }
 /*-----------------------------------------------------------*/
 
@@ -0,0 +1,293 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "deferred_log.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the deferred log. This #if is closed at the very bottom of this
+ * file. If you want to include the deferred log then ensure
+ * configUSE_DEFERRED_LOG is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_DEFERRED_LOG == 1 )
+
+/* Only the arguments that were passed are written to the stream buffer, so a
+ * message occupies the fixed part of the record plus four bytes for each
+ * argument. */
+    #define deferredlogHEADER_BYTES                     ( offsetof( DeferredLogRecord_t, ulArguments ) )
+    #define deferredlogRECORD_BYTES( uxArgumentCount )  ( deferredlogHEADER_BYTES + ( ( size_t ) ( uxArgumentCount ) * sizeof( uint32_t ) ) )
+
+/* The number of arguments xDeferredLogFormat() passes to snprintf(), which
+ * limits configDEFERRED_LOG_MAX_ARGUMENTS. */
+    #define deferredlogFORMAT_ARGUMENTS                 6
+
+/* The log state of one core.  Only the core itself writes to its stream
+ * buffer, and only the task reading the log reads from it, so the stream
+ * buffer is used without a lock. */
+    typedef struct xDEFERRED_LOG_CORE
+    {
+        StreamBufferHandle_t xStreamBuffer;
+        uint32_t ulDropped;
+        StaticStreamBuffer_t xStaticStreamBuffer;
+        uint8_t ucStorage[ configDEFERRED_LOG_BUFFER_SIZE ];
+    } DeferredLogCore_t;
+
+/*-----------------------------------------------------------*/
+
+    PRIVILEGED_DATA static DeferredLogCore_t xDeferredLogCores[ configNUMBER_OF_CORES ];
+
+/* The core whose stream buffer xDeferredLogReceive() reads first. */
+    PRIVILEGED_DATA static UBaseType_t uxNextCoreToRead = 0U;
+
+/*-----------------------------------------------------------*/
+
+    void vDeferredLogInit( void )
+    {
+        UBaseType_t uxCore;
+        DeferredLogCore_t * pxCore;
+
+        traceENTER_vDeferredLogInit();
+
+        for( uxCore = 0U; uxCore < ( UBaseType_t ) configNUMBER_OF_CORES; uxCore++ )
+        {
+            pxCore = &( xDeferredLogCores[ uxCore ] );
+
+            /* A trigger level of the whole buffer means a write only tries to
+             * unblock a reader when it fills the buffer, and the reader never
+             * blocks, so a write does not normally touch the scheduler. */
+            pxCore->ulDropped = 0U;
+            pxCore->xStreamBuffer = xStreamBufferCreateStatic( sizeof( pxCore->ucStorage ),
+                                                               sizeof( pxCore->ucStorage ),
+                                                               pxCore->ucStorage,
+                                                               &( pxCore->xStaticStreamBuffer ) );
+            configASSERT( pxCore->xStreamBuffer );
+        }
+
+        uxNextCoreToRead = 0U;
+
+        traceRETURN_vDeferredLogInit();
+    }
+/*-----------------------------------------------------------*/
+
+    void vDeferredLogWrite( const char * pcFormat,
+                            const uint32_t * pulArguments,
+                            UBaseType_t uxArgumentCount )
+    {
+        DeferredLogRecord_t xRecord;
+        DeferredLogCore_t * pxCore;
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xCoreID;
+        const size_t xRecordBytes = deferredlogRECORD_BYTES( uxArgumentCount );
+
+        traceENTER_vDeferredLogWrite( pcFormat, pulArguments, uxArgumentCount );
+
+        configASSERT( pcFormat );
+        configASSERT( uxArgumentCount <= ( UBaseType_t ) configDEFERRED_LOG_MAX_ARGUMENTS );
+        configASSERT( ( pulArguments != NULL ) || ( uxArgumentCount == ( UBaseType_t ) 0U ) );
+
+        xRecord.pcFormat = pcFormat;
+        xRecord.ucArgumentCount = ( uint8_t ) uxArgumentCount;
+
+        if( uxArgumentCount > ( UBaseType_t ) 0U )
+        {
+            ( void ) memcpy( xRecord.ulArguments, pulArguments, ( size_t ) uxArgumentCount * sizeof( uint32_t ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Each core only writes to its own stream buffer, so masking interrupts
+         * on the calling core is enough to stop two writes interleaving.  The
+         * space is checked first as a stream buffer accepts a partial write. */
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xCoreID = ( BaseType_t ) portGET_CORE_ID();
+            pxCore = &( xDeferredLogCores[ xCoreID ] );
+
+            xRecord.ucCore = ( uint8_t ) xCoreID;
+            xRecord.ulTimestamp = ( uint32_t ) configDEFERRED_LOG_TIMESTAMP();
+
+            if( ( pxCore->xStreamBuffer != NULL ) &&
+                ( xStreamBufferSpacesAvailable( pxCore->xStreamBuffer ) >= xRecordBytes ) )
+            {
+                ( void ) xStreamBufferSendFromISR( pxCore->xStreamBuffer, &xRecord, xRecordBytes, NULL );
+            }
+            else
+            {
+                pxCore->ulDropped++;
+                traceDEFERRED_LOG_DROPPED( pcFormat );
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_vDeferredLogWrite();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xDeferredLogReceive( DeferredLogRecord_t * pxRecord )
+    {
+        BaseType_t xReturn = pdFAIL;
+        UBaseType_t uxCount;
+        UBaseType_t uxCore = uxNextCoreToRead;
+        StreamBufferHandle_t xStreamBuffer;
+
+        traceENTER_xDeferredLogReceive( pxRecord );
+
+        configASSERT( pxRecord );
+
+        for( uxCount = 0U; ( uxCount < ( UBaseType_t ) configNUMBER_OF_CORES ) && ( xReturn == pdFAIL ); uxCount++ )
+        {
+            xStreamBuffer = xDeferredLogCores[ uxCore ].xStreamBuffer;
+
+            /* Records are written whole, so a stream buffer that holds any
+             * bytes holds at least one complete record. */
+            if( ( xStreamBuffer != NULL ) &&
+                ( xStreamBufferReceive( xStreamBuffer, pxRecord, deferredlogHEADER_BYTES, 0U ) == deferredlogHEADER_BYTES ) )
+            {
+                configASSERT( pxRecord->ucArgumentCount <= ( uint8_t ) configDEFERRED_LOG_MAX_ARGUMENTS );
+
+                if( pxRecord->ucArgumentCount > 0U )
+                {
+                    ( void ) xStreamBufferReceive( xStreamBuffer, pxRecord->ulArguments, ( size_t ) pxRecord->ucArgumentCount * sizeof( uint32_t ), 0U );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            uxCore++;
+
+            if( uxCore >= ( UBaseType_t ) configNUMBER_OF_CORES )
+            {
+                uxCore = 0U;
+            }
+        }
+
+        uxNextCoreToRead = uxCore;
+
+        traceRETURN_xDeferredLogReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    size_t xDeferredLogFormat( const DeferredLogRecord_t * pxRecord,
+                               char * pcBuffer,
+                               size_t xBufferLength )
+    {
+        uint32_t ulArguments[ deferredlogFORMAT_ARGUMENTS ] = { 0U };
+        int iSnprintfReturnValue;
+        size_t xReturn = 0U;
+
+        traceENTER_xDeferredLogFormat( pxRecord, pcBuffer, xBufferLength );
+
+        configASSERT( pxRecord );
+        configASSERT( pcBuffer );
+
+        if( xBufferLength > 0U )
+        {
+            ( void ) memcpy( ulArguments, pxRecord->ulArguments, ( size_t ) pxRecord->ucArgumentCount * sizeof( uint32_t ) );
+
+            /* Every argument slot is passed.  Those the format string does not
+             * use are ignored by snprintf(). */
+            iSnprintfReturnValue = snprintf( pcBuffer, xBufferLength, pxRecord->pcFormat,
+                                             ulArguments[ 0 ], ulArguments[ 1 ], ulArguments[ 2 ],
+                                             ulArguments[ 3 ], ulArguments[ 4 ], ulArguments[ 5 ] );
+
+            if( iSnprintfReturnValue < 0 )
+            {
+                pcBuffer[ 0 ] = '\0';
+            }
+            else if( ( size_t ) iSnprintfReturnValue >= xBufferLength )
+            {
+                /* The message was truncated. */
+                xReturn = xBufferLength - 1U;
+            }
+            else
+            {
+                xReturn = ( size_t ) iSnprintfReturnValue;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xDeferredLogFormat( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulDeferredLogGetDroppedCount( void )
+    {
+        uint32_t ulReturn = 0U;
+        UBaseType_t uxCore;
+
+        traceENTER_ulDeferredLogGetDroppedCount();
+
+        for( uxCore = 0U; uxCore < ( UBaseType_t ) configNUMBER_OF_CORES; uxCore++ )
+        {
+            ulReturn += xDeferredLogCores[ uxCore ].ulDropped;
+        }
+
+        traceRETURN_ulDeferredLogGetDroppedCount( ulReturn );
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the deferred log. If you want to include the deferred log then
+ * ensure configUSE_DEFERRED_LOG is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_DEFERRED_LOG == 1 */
@@ -28,6 +28,7 @@
 
 /* Standard includes. */
 #include <stdlib.h>
+#include <string.h>
 
 /* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
  * all the API functions to use the MPU wrappers. That should only be done when
@@ -40,11 +41,19 @@
 #include "timers.h"
 #include "event_groups.h"
 
+#if ( configKERNEL_OBJECT_POOLS == 1 )
+    #include "object_pool.h"
+#endif
+
 /* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
  * correct privileged Vs unprivileged linkage and placement. */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if ( ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 ) && ( ( INCLUDE_xTimerPendFunctionCall != 1 ) || ( configUSE_TIMERS != 1 ) ) )
+    #error configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR requires INCLUDE_xTimerPendFunctionCall and configUSE_TIMERS to be set to 1.
+#endif
+
 /* This entire source file will be skipped if the application is not configured
  * to include event groups functionality. This #if is closed at the very bottom
  * of this file. If you want to include event groups then ensure
@@ -63,10 +72,116 @@
         #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
             uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the event group is statically allocated to ensure no attempt is made to free the memory. */
         #endif
+
+        #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+            EventBits_t uxBitsOfWaitingTasks; /**< Includes every bit a task in xTasksWaitingForBits is waiting for, so setting other bits does not search the list.  May also include bits no task is waiting for any more. */
+        #endif
+
+        #if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+            volatile UBaseType_t uxWaitingTasksLocked; /**< Non-zero while a task is accessing xTasksWaitingForBits with the scheduler suspended, so an interrupt must not access it. */
+        #endif
+
+        #if ( configUSE_IPC_STATISTICS == 1 )
+            IPCStatistics_t xStatistics; /**< The statistics returned by vEventGroupGetStatistics().  Protected in the same way as uxEventBits. */
+        #endif
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+            portSPINLOCK_TYPE xEventGroupLock; /**< Protects uxEventBits in place of the kernel critical section when configUSE_GRANULAR_LOCKS is 1. */
+        #endif
     } EventGroup_t;
 
 /*-----------------------------------------------------------*/
 
+/*
+ * Macros to mark the start and end of a critical section that accesses the
+ * event bits of an event group.
+ */
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        #define egENTER_CRITICAL( pxEventBits )                            taskDATA_GROUP_ENTER_CRITICAL( ( portSPINLOCK_TYPE * ) &( ( pxEventBits )->xEventGroupLock ) )
+        #define egEXIT_CRITICAL( pxEventBits )                             taskDATA_GROUP_EXIT_CRITICAL( ( portSPINLOCK_TYPE * ) &( ( pxEventBits )->xEventGroupLock ) )
+        #define egENTER_CRITICAL_FROM_ISR( pxEventBits )                   taskDATA_GROUP_ENTER_CRITICAL_FROM_ISR( ( portSPINLOCK_TYPE * ) &( ( pxEventBits )->xEventGroupLock ) )
+        #define egEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxEventBits ) \
+    taskDATA_GROUP_EXIT_CRITICAL_FROM_ISR( ( uxSavedInterruptStatus ), ( portSPINLOCK_TYPE * ) &( ( pxEventBits )->xEventGroupLock ) )
+
+/* The event bits are also accessed with the scheduler suspended, which only
+ * excludes other tasks that suspend the scheduler.  The event group lock must
+ * be held there too. */
+        #define egLOCK_BITS( pxEventBits )                                 egENTER_CRITICAL( pxEventBits )
+        #define egUNLOCK_BITS( pxEventBits )                               egEXIT_CRITICAL( pxEventBits )
+    #else
+        #define egENTER_CRITICAL( pxEventBits )                            taskENTER_CRITICAL()
+        #define egEXIT_CRITICAL( pxEventBits )                             taskEXIT_CRITICAL()
+        #define egENTER_CRITICAL_FROM_ISR( pxEventBits )                   taskENTER_CRITICAL_FROM_ISR()
+        #define egEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxEventBits ) \
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus )
+
+/* Suspending the scheduler already excludes every other access to the event
+ * bits. */
+        #define egLOCK_BITS( pxEventBits )
+        #define egUNLOCK_BITS( pxEventBits )
+    #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+/*
+ * Called with the event bits locked when a task blocks on an event group, to
+ * note the bits the task is waiting for.
+ */
+    #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+        #define egRECORD_BITS_WAITED_FOR( pxEventBits, uxBitsToWaitFor )    ( ( pxEventBits )->uxBitsOfWaitingTasks |= ( uxBitsToWaitFor ) )
+    #else
+        #define egRECORD_BITS_WAITED_FOR( pxEventBits, uxBitsToWaitFor )
+    #endif
+
+/*
+ * Check that bits passed to the timer task, which receives them as a uint32_t,
+ * are not truncated.
+ */
+    #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+        #define egASSERT_BITS_CAN_BE_PENDED( uxBits )    configASSERT( ( ( uxBits ) >> 32 ) == ( EventBits_t ) 0 )
+    #else
+        #define egASSERT_BITS_CAN_BE_PENDED( uxBits )
+    #endif
+
+/*
+ * Allocate and free the memory of dynamically allocated event groups.
+ */
+    #if ( configKERNEL_OBJECT_POOLS == 1 )
+
+/* The pool dynamically allocated event groups are drawn from.  It is created
+ * when the first such event group is created. */
+        PRIVILEGED_DATA static PoolHandle_t xEventGroupPool = NULL;
+
+        #define egALLOCATE_EVENT_GROUP()              pvPoolAllocateKernelObject( &xEventGroupPool, sizeof( EventGroup_t ), configKERNEL_EVENT_GROUP_POOL_LENGTH )
+        #define egFREE_EVENT_GROUP( pxEventBits )    vPoolFreeKernelObject( xEventGroupPool, ( pxEventBits ) )
+    #else
+        #define egALLOCATE_EVENT_GROUP()              pvPortMalloc( sizeof( EventGroup_t ) )
+        #define egFREE_EVENT_GROUP( pxEventBits )    vPortFree( pxEventBits )
+    #endif
+
+/*
+ * Called with the scheduler suspended around each access a task makes to the
+ * list of waiting tasks, so xEventGroupSetBitsFromISR() knows when it can
+ * access the list itself.
+ */
+    #if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+        #define egLOCK_WAITING_TASKS( pxEventBits )                          \
+    do {                                                                     \
+        egENTER_CRITICAL( pxEventBits );                                     \
+        ( ( pxEventBits )->uxWaitingTasksLocked )++;                         \
+        egEXIT_CRITICAL( pxEventBits );                                      \
+    } while( 0 )
+        #define egUNLOCK_WAITING_TASKS( pxEventBits )                        \
+    do {                                                                     \
+        egENTER_CRITICAL( pxEventBits );                                     \
+        ( ( pxEventBits )->uxWaitingTasksLocked )--;                         \
+        egEXIT_CRITICAL( pxEventBits );                                      \
+    } while( 0 )
+    #else
+        #define egLOCK_WAITING_TASKS( pxEventBits )
+        #define egUNLOCK_WAITING_TASKS( pxEventBits )
+    #endif
+
+/*-----------------------------------------------------------*/
+
 /*
  * Test the bits set in uxCurrentEventBits to see if the wait condition is met.
  * The wait condition is defined by xWaitForAllBits.  If xWaitForAllBits is
@@ -79,6 +194,72 @@
                                             const EventBits_t uxBitsToWaitFor,
                                             const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Place the calling task on the list of tasks waiting for bits to be set in
+ * pxEventBits.  The bits the task waits for are stored with its event list
+ * item value, which also holds the control bits uxControlBits, or in its TCB if
+ * configUSE_64_BIT_EVENT_GROUPS is 1 and the event bits are too wide for it.
+ */
+    static void prvPlaceOnWaitingList( EventGroup_t * const pxEventBits,
+                                       const EventBits_t uxBitsToWaitFor,
+                                       const EventBits_t uxControlBits,
+                                       const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the bits the task that owns pxListItem is waiting for, and set
+ * *puxControlBits to the control bits stored by prvPlaceOnWaitingList().
+ */
+    static EventBits_t prvGetBitsWaitedFor( const ListItem_t * pxListItem,
+                                            EventBits_t * puxControlBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Store uxEventBits as the event bits returned to the task that owns
+ * pxListItem, and return the value to unblock it with.
+ */
+    static TickType_t prvGetUnblockedItemValue( const ListItem_t * pxListItem,
+                                                const EventBits_t uxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by a task that blocked on an event group once it runs again.  Returns
+ * pdTRUE, and sets *puxEventBits to the event bits stored when it was
+ * unblocked, if the task was unblocked by its wait condition being met or the
+ * event group being deleted, or pdFALSE if it timed out.
+ */
+    static BaseType_t prvGetUnblockingBits( EventBits_t * puxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets uxBitsToSet in the event group then unblocks the tasks whose wait
+ * condition is now met, and returns the resulting event bits.  If xWakeOne is
+ * pdTRUE then each bit set unblocks no more than one task.  If xSetBits is
+ * pdFALSE then uxBitsToSet has already been set, and only the waiting tasks
+ * are tested.
+ */
+    static EventBits_t prvSetBitsAndUnblockTasks( EventGroup_t * const pxEventBits,
+                                                  const EventBits_t uxBitsToSet,
+                                                  const BaseType_t xWakeOne,
+                                                  const BaseType_t xSetBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called at the end of xEventGroupSync() and xEventGroupWaitBits() to count
+ * a satisfied wait or a timeout, and to add the time spent blocked if the
+ * calling task blocked.
+ */
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        static void prvRecordWaitStatistics( EventGroup_t * const pxEventBits,
+                                             const TickType_t xBlockStartTime,
+                                             const BaseType_t xBlocked,
+                                             const BaseType_t xTimeoutOccurred ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*
+ * Pended by xEventGroupSetBitsFromISR() to test the waiting tasks it did not
+ * have time to test from the interrupt.
+ */
+    #if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+        static void prvUnblockWaitingTasksCallback( void * pvEventGroup,
+                                                    uint32_t ulBitsSet ) PRIVILEGED_FUNCTION;
+    #endif
+
 /*-----------------------------------------------------------*/
 
     #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -113,6 +294,30 @@
                 pxEventBits->uxEventBits = 0;
                 vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+                #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+                {
+                    pxEventBits->uxBitsOfWaitingTasks = 0;
+                }
+                #endif
+
+                #if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+                {
+                    pxEventBits->uxWaitingTasksLocked = 0;
+                }
+                #endif
+
+                #if ( configUSE_IPC_STATISTICS == 1 )
+                {
+                    ( void ) memset( &( pxEventBits->xStatistics ), 0x00, sizeof( pxEventBits->xStatistics ) );
+                }
+                #endif
+
+                #if ( configUSE_GRANULAR_LOCKS == 1 )
+                {
+                    portINIT_SPINLOCK( &( pxEventBits->xEventGroupLock ) );
+                }
+                #endif
+
                 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                 {
                     /* Both static and dynamic allocation can be used, so note that
@@ -151,13 +356,37 @@
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) );
+            pxEventBits = ( EventGroup_t * ) egALLOCATE_EVENT_GROUP();
 
             if( pxEventBits != NULL )
             {
                 pxEventBits->uxEventBits = 0;
                 vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+                #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+                {
+                    pxEventBits->uxBitsOfWaitingTasks = 0;
+                }
+                #endif
+
+                #if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+                {
+                    pxEventBits->uxWaitingTasksLocked = 0;
+                }
+                #endif
+
+                #if ( configUSE_IPC_STATISTICS == 1 )
+                {
+                    ( void ) memset( &( pxEventBits->xStatistics ), 0x00, sizeof( pxEventBits->xStatistics ) );
+                }
+                #endif
+
+                #if ( configUSE_GRANULAR_LOCKS == 1 )
+                {
+                    portINIT_SPINLOCK( &( pxEventBits->xEventGroupLock ) );
+                }
+                #endif
+
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
                     /* Both static and dynamic allocation can be used, so note this
@@ -192,9 +421,13 @@
         BaseType_t xAlreadyYielded;
         BaseType_t xTimeoutOccurred = pdFALSE;
 
+        #if ( configUSE_IPC_STATISTICS == 1 )
+            TickType_t xBlockStartTime = 0U;
+        #endif
+
         traceENTER_xEventGroupSync( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTicksToWait );
 
-        configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+        configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_RESERVED ) == 0 );
         configASSERT( uxBitsToWaitFor != 0 );
         #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
@@ -204,10 +437,17 @@
 
         vTaskSuspendAll();
         {
-            uxOriginalBitValue = pxEventBits->uxEventBits;
+            egLOCK_WAITING_TASKS( pxEventBits );
+            egLOCK_BITS( pxEventBits );
+            {
+                uxOriginalBitValue = pxEventBits->uxEventBits;
+            }
+            egUNLOCK_BITS( pxEventBits );
 
             ( void ) xEventGroupSetBits( xEventGroup, uxBitsToSet );
 
+            egLOCK_BITS( pxEventBits );
+
             if( ( ( uxOriginalBitValue | uxBitsToSet ) & uxBitsToWaitFor ) == uxBitsToWaitFor )
             {
                 /* All the rendezvous bits are now set - no need to block. */
@@ -225,10 +465,18 @@
                 {
                     traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor );
 
+                    #if ( configUSE_IPC_STATISTICS == 1 )
+                    {
+                        pxEventBits->xStatistics.ulBlocks++;
+                        xBlockStartTime = xTaskGetTickCount();
+                    }
+                    #endif
+
                     /* Store the bits that the calling task is waiting for in the
                      * task's event list item so the kernel knows when a match is
                      * found.  Then enter the blocked state. */
-                    vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                    prvPlaceOnWaitingList( pxEventBits, uxBitsToWaitFor, ( EventBits_t ) ( eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                    egRECORD_BITS_WAITED_FOR( pxEventBits, uxBitsToWaitFor );
 
                     /* This assignment is obsolete as uxReturn will get set after
                      * the task unblocks, but some compilers mistakenly generate a
@@ -244,6 +492,9 @@
                     xTimeoutOccurred = pdTRUE;
                 }
             }
+
+            egUNLOCK_BITS( pxEventBits );
+            egUNLOCK_WAITING_TASKS( pxEventBits );
         }
         xAlreadyYielded = xTaskResumeAll();
 
@@ -262,12 +513,10 @@
              * point either the required bits were set or the block time expired.  If
              * the required bits were set they will have been stored in the task's
              * event list item, and they should now be retrieved then cleared. */
-            uxReturn = uxTaskResetEventItemValue();
-
-            if( ( uxReturn & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
+            if( prvGetUnblockingBits( &uxReturn ) == pdFALSE )
             {
                 /* The task timed out, just return the current event bit value. */
-                taskENTER_CRITICAL();
+                egENTER_CRITICAL( pxEventBits );
                 {
                     uxReturn = pxEventBits->uxEventBits;
 
@@ -284,7 +533,7 @@
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
-                taskEXIT_CRITICAL();
+                egEXIT_CRITICAL( pxEventBits );
 
                 xTimeoutOccurred = pdTRUE;
             }
@@ -292,11 +541,13 @@
             {
                 /* The task unblocked because the bits were set. */
             }
+        }
 
-            /* Control bits might be set as the task had blocked should not be
-             * returned. */
-            uxReturn &= ~eventEVENT_BITS_CONTROL_BYTES;
+        #if ( configUSE_IPC_STATISTICS == 1 )
+        {
+            prvRecordWaitStatistics( pxEventBits, xBlockStartTime, ( xTicksToWait != ( TickType_t ) 0 ) ? pdTRUE : pdFALSE, xTimeoutOccurred );
         }
+        #endif
 
         traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred );
 
@@ -320,12 +571,16 @@
         BaseType_t xWaitConditionMet, xAlreadyYielded;
         BaseType_t xTimeoutOccurred = pdFALSE;
 
+        #if ( configUSE_IPC_STATISTICS == 1 )
+            TickType_t xBlockStartTime = 0U;
+        #endif
+
         traceENTER_xEventGroupWaitBits( xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait );
 
         /* Check the user is not attempting to wait on the bits used by the kernel
          * itself, and that at least one bit is being requested. */
         configASSERT( xEventGroup );
-        configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+        configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_RESERVED ) == 0 );
         configASSERT( uxBitsToWaitFor != 0 );
         #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
@@ -334,6 +589,8 @@
         #endif
 
         vTaskSuspendAll();
+        egLOCK_WAITING_TASKS( pxEventBits );
+        egLOCK_BITS( pxEventBits );
         {
             const EventBits_t uxCurrentEventBits = pxEventBits->uxEventBits;
 
@@ -391,7 +648,8 @@
                 /* Store the bits that the calling task is waiting for in the
                  * task's event list item so the kernel knows when a match is
                  * found.  Then enter the blocked state. */
-                vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+                prvPlaceOnWaitingList( pxEventBits, uxBitsToWaitFor, uxControlBits, xTicksToWait );
+                egRECORD_BITS_WAITED_FOR( pxEventBits, uxBitsToWaitFor );
 
                 /* This is obsolete as it will get set after the task unblocks, but
                  * some compilers mistakenly generate a warning about the variable
@@ -399,8 +657,17 @@
                 uxReturn = 0;
 
                 traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor );
+
+                #if ( configUSE_IPC_STATISTICS == 1 )
+                {
+                    pxEventBits->xStatistics.ulBlocks++;
+                    xBlockStartTime = xTaskGetTickCount();
+                }
+                #endif
             }
         }
+        egUNLOCK_BITS( pxEventBits );
+        egUNLOCK_WAITING_TASKS( pxEventBits );
         xAlreadyYielded = xTaskResumeAll();
 
         if( xTicksToWait != ( TickType_t ) 0 )
@@ -418,11 +685,9 @@
              * point either the required bits were set or the block time expired.  If
              * the required bits were set they will have been stored in the task's
              * event list item, and they should now be retrieved then cleared. */
-            uxReturn = uxTaskResetEventItemValue();
-
-            if( ( uxReturn & eventUNBLOCKED_DUE_TO_BIT_SET ) == ( EventBits_t ) 0 )
+            if( prvGetUnblockingBits( &uxReturn ) == pdFALSE )
             {
-                taskENTER_CRITICAL();
+                egENTER_CRITICAL( pxEventBits );
                 {
                     /* The task timed out, just return the current event bit value. */
                     uxReturn = pxEventBits->uxEventBits;
@@ -447,16 +712,19 @@
 
                     xTimeoutOccurred = pdTRUE;
                 }
-                taskEXIT_CRITICAL();
+                egEXIT_CRITICAL( pxEventBits );
             }
             else
             {
                 /* The task unblocked because the bits were set. */
             }
+        }
 
-            /* The task blocked so control bits may have been set. */
-            uxReturn &= ~eventEVENT_BITS_CONTROL_BYTES;
+        #if ( configUSE_IPC_STATISTICS == 1 )
+        {
+            prvRecordWaitStatistics( pxEventBits, xBlockStartTime, ( xTicksToWait != ( TickType_t ) 0 ) ? pdTRUE : pdFALSE, xTimeoutOccurred );
         }
+        #endif
 
         traceEVENT_GROUP_WAIT_BITS_END( xEventGroup, uxBitsToWaitFor, xTimeoutOccurred );
 
@@ -480,9 +748,9 @@
         /* Check the user is not attempting to clear the bits used by the kernel
          * itself. */
         configASSERT( xEventGroup );
-        configASSERT( ( uxBitsToClear & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+        configASSERT( ( uxBitsToClear & eventEVENT_BITS_RESERVED ) == 0 );
 
-        taskENTER_CRITICAL();
+        egENTER_CRITICAL( pxEventBits );
         {
             traceEVENT_GROUP_CLEAR_BITS( xEventGroup, uxBitsToClear );
 
@@ -493,7 +761,7 @@
             /* Clear the bits. */
             pxEventBits->uxEventBits &= ~uxBitsToClear;
         }
-        taskEXIT_CRITICAL();
+        egEXIT_CRITICAL( pxEventBits );
 
         traceRETURN_xEventGroupClearBits( uxReturn );
 
@@ -511,6 +779,7 @@
             traceENTER_xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear );
 
             traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear );
+            egASSERT_BITS_CAN_BE_PENDED( uxBitsToClear );
             xReturn = xTimerPendFunctionCallFromISR( vEventGroupClearBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToClear, NULL );
 
             traceRETURN_xEventGroupClearBitsFromISR( xReturn );
@@ -532,11 +801,11 @@
         /* MISRA Ref 4.7.1 [Return value shall be checked] */
         /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
         /* coverity[misra_c_2012_directive_4_7_violation] */
-        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        uxSavedInterruptStatus = egENTER_CRITICAL_FROM_ISR( pxEventBits );
         {
             uxReturn = pxEventBits->uxEventBits;
         }
-        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        egEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxEventBits );
 
         traceRETURN_xEventGroupGetBitsFromISR( uxReturn );
 
@@ -547,104 +816,45 @@
     EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
                                     const EventBits_t uxBitsToSet )
     {
-        ListItem_t * pxListItem;
-        ListItem_t * pxNext;
-        ListItem_t const * pxListEnd;
-        List_t const * pxList;
-        EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits, uxReturnBits;
-        EventGroup_t * pxEventBits = xEventGroup;
-        BaseType_t xMatchFound = pdFALSE;
+        EventBits_t uxReturnBits;
 
         traceENTER_xEventGroupSetBits( xEventGroup, uxBitsToSet );
 
         /* Check the user is not attempting to set the bits used by the kernel
          * itself. */
         configASSERT( xEventGroup );
-        configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+        configASSERT( ( uxBitsToSet & eventEVENT_BITS_RESERVED ) == 0 );
 
-        pxList = &( pxEventBits->xTasksWaitingForBits );
-        pxListEnd = listGET_END_MARKER( pxList );
-        vTaskSuspendAll();
-        {
-            traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
-
-            pxListItem = listGET_HEAD_ENTRY( pxList );
+        uxReturnBits = prvSetBitsAndUnblockTasks( xEventGroup, uxBitsToSet, pdFALSE, pdTRUE );
 
-            /* Set the bits. */
-            pxEventBits->uxEventBits |= uxBitsToSet;
+        traceRETURN_xEventGroupSetBits( uxReturnBits );
 
-            /* See if the new bit value should unblock any tasks. */
-            while( pxListItem != pxListEnd )
-            {
-                pxNext = listGET_NEXT( pxListItem );
-                uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-                xMatchFound = pdFALSE;
+        return uxReturnBits;
+    }
+/*-----------------------------------------------------------*/
 
-                /* Split the bits waited for from the control bits. */
-                uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-                uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+    #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
 
-                if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
-                {
-                    /* Just looking for single bit being set. */
-                    if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
-                    {
-                        xMatchFound = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-                }
-                else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
-                {
-                    /* All bits are set. */
-                    xMatchFound = pdTRUE;
-                }
-                else
-                {
-                    /* Need all bits to be set, but not all the bits were set. */
-                }
+        EventBits_t xEventGroupSetBitsWakeOne( EventGroupHandle_t xEventGroup,
+                                               const EventBits_t uxBitsToSet )
+        {
+            EventBits_t uxReturnBits;
 
-                if( xMatchFound != pdFALSE )
-                {
-                    /* The bits match.  Should the bits be cleared on exit? */
-                    if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-                    {
-                        uxBitsToClear |= uxBitsWaitedFor;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+            traceENTER_xEventGroupSetBitsWakeOne( xEventGroup, uxBitsToSet );
 
-                    /* Store the actual event flag value in the task's event list
-                     * item before removing the task from the event list.  The
-                     * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-                     * that is was unblocked due to its required bits matching, rather
-                     * than because it timed out. */
-                    vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
-                }
+            /* Check the user is not attempting to set the bits used by the
+             * kernel itself. */
+            configASSERT( xEventGroup );
+            configASSERT( ( uxBitsToSet & eventEVENT_BITS_RESERVED ) == 0 );
 
-                /* Move onto the next list item.  Note pxListItem->pxNext is not
-                 * used here as the list item may have been removed from the event list
-                 * and inserted into the ready/pending reading list. */
-                pxListItem = pxNext;
-            }
+            uxReturnBits = prvSetBitsAndUnblockTasks( xEventGroup, uxBitsToSet, pdTRUE, pdTRUE );
 
-            /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
-             * bit was set in the control word. */
-            pxEventBits->uxEventBits &= ~uxBitsToClear;
+            traceRETURN_xEventGroupSetBitsWakeOne( uxReturnBits );
 
-            /* Snapshot resulting bits. */
-            uxReturnBits = pxEventBits->uxEventBits;
+            return uxReturnBits;
         }
-        ( void ) xTaskResumeAll();
 
-        traceRETURN_xEventGroupSetBits( uxReturnBits );
-
-        return uxReturnBits;
-    }
+    #endif /* configUSE_EVENT_GROUP_WAKE_ONE */
 /*-----------------------------------------------------------*/
 
     void vEventGroupDelete( EventGroupHandle_t xEventGroup )
@@ -660,6 +870,8 @@
 
         vTaskSuspendAll();
         {
+            egLOCK_WAITING_TASKS( pxEventBits );
+
             traceEVENT_GROUP_DELETE( xEventGroup );
 
             while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
@@ -667,8 +879,10 @@
                 /* Unblock the task, returning 0 as the event list is being deleted
                  * and cannot therefore have any bits set. */
                 configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-                vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+                vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, prvGetUnblockedItemValue( pxTasksWaitingForBits->xListEnd.pxNext, ( EventBits_t ) 0 ) );
             }
+
+            egUNLOCK_WAITING_TASKS( pxEventBits );
         }
         ( void ) xTaskResumeAll();
 
@@ -676,7 +890,7 @@
         {
             /* The event group can only have been allocated dynamically - free
              * it again. */
-            vPortFree( pxEventBits );
+            egFREE_EVENT_GROUP( pxEventBits );
         }
         #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
         {
@@ -684,7 +898,7 @@
              * dynamically, so check before attempting to free the memory. */
             if( pxEventBits->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
             {
-                vPortFree( pxEventBits );
+                egFREE_EVENT_GROUP( pxEventBits );
             }
             else
             {
@@ -812,7 +1026,299 @@
     }
 /*-----------------------------------------------------------*/
 
-    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
+    static void prvPlaceOnWaitingList( EventGroup_t * const pxEventBits,
+                                       const EventBits_t uxBitsToWaitFor,
+                                       const EventBits_t uxControlBits,
+                                       const TickType_t xTicksToWait )
+    {
+        #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+        {
+            /* The task is not on the list yet, so nothing else accesses the
+             * bits in its TCB. */
+            vTaskSetEventGroupBits( NULL, ( uint64_t ) uxBitsToWaitFor );
+            vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( TickType_t ) uxControlBits, xTicksToWait );
+        }
+        #else
+        {
+            vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+        }
+        #endif
+    }
+/*-----------------------------------------------------------*/
+
+    static EventBits_t prvGetBitsWaitedFor( const ListItem_t * pxListItem,
+                                            EventBits_t * puxControlBits )
+    {
+        EventBits_t uxBitsWaitedFor;
+
+        #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+        {
+            *puxControlBits = ( EventBits_t ) listGET_LIST_ITEM_VALUE( pxListItem );
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            uxBitsWaitedFor = ( EventBits_t ) ullTaskGetEventGroupBits( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxListItem ) );
+        }
+        #else
+        {
+            /* Split the bits waited for from the control bits. */
+            uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+            *puxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+            uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+        }
+        #endif
+
+        return uxBitsWaitedFor;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvGetUnblockedItemValue( const ListItem_t * pxListItem,
+                                                const EventBits_t uxEventBits )
+    {
+        TickType_t xItemValue;
+
+        /* The eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows that
+         * it was unblocked due to its required bits matching, rather than
+         * because it timed out. */
+        #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            vTaskSetEventGroupBits( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxListItem ), ( uint64_t ) uxEventBits );
+            xItemValue = eventUNBLOCKED_DUE_TO_BIT_SET;
+        }
+        #else
+        {
+            ( void ) pxListItem;
+            xItemValue = uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET;
+        }
+        #endif
+
+        return xItemValue;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvGetUnblockingBits( EventBits_t * puxEventBits )
+    {
+        const TickType_t xItemValue = uxTaskResetEventItemValue();
+        BaseType_t xReturn = pdFALSE;
+
+        if( ( xItemValue & eventUNBLOCKED_DUE_TO_BIT_SET ) != ( TickType_t ) 0 )
+        {
+            #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+            {
+                *puxEventBits = ( EventBits_t ) ullTaskGetEventGroupBits( NULL );
+            }
+            #else
+            {
+                /* Control bits were set as the task had blocked, and should not
+                 * be returned. */
+                *puxEventBits = xItemValue & ~eventEVENT_BITS_CONTROL_BYTES;
+            }
+            #endif
+
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static EventBits_t prvSetBitsAndUnblockTasks( EventGroup_t * const pxEventBits,
+                                                  const EventBits_t uxBitsToSet,
+                                                  const BaseType_t xWakeOne,
+                                                  const BaseType_t xSetBits )
+    {
+        ListItem_t * pxListItem;
+        ListItem_t * pxNext;
+        ListItem_t const * pxListEnd;
+        List_t const * pxList;
+        EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits, uxReturnBits;
+        BaseType_t xMatchFound = pdFALSE;
+        BaseType_t xTestWaitingTasks = pdTRUE;
+
+        #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+            EventBits_t uxBitsToWake = uxBitsToSet, uxBitsStillWaitedFor = 0;
+        #endif
+
+        pxList = &( pxEventBits->xTasksWaitingForBits );
+        pxListEnd = listGET_END_MARKER( pxList );
+        vTaskSuspendAll();
+        egLOCK_WAITING_TASKS( pxEventBits );
+        egLOCK_BITS( pxEventBits );
+        {
+            traceEVENT_GROUP_SET_BITS( pxEventBits, uxBitsToSet );
+
+            pxListItem = listGET_HEAD_ENTRY( pxList );
+
+            /* Set the bits, unless they were set by an interrupt that left
+             * the waiting tasks to be tested here. */
+            if( xSetBits != pdFALSE )
+            {
+                pxEventBits->uxEventBits |= uxBitsToSet;
+
+                #if ( configUSE_IPC_STATISTICS == 1 )
+                {
+                    pxEventBits->xStatistics.ulSends++;
+                }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+            {
+                /* A task's wait condition can only become met when a bit it
+                 * is waiting for is set. */
+                if( ( uxBitsToSet & pxEventBits->uxBitsOfWaitingTasks ) == ( EventBits_t ) 0 )
+                {
+                    xTestWaitingTasks = pdFALSE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            /* See if the new bit value should unblock any tasks. */
+            while( ( pxListItem != pxListEnd ) && ( xTestWaitingTasks != pdFALSE ) )
+            {
+                pxNext = listGET_NEXT( pxListItem );
+                uxBitsWaitedFor = prvGetBitsWaitedFor( pxListItem, &uxControlBits );
+                xMatchFound = pdFALSE;
+
+                if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+                {
+                    /* Just looking for single bit being set. */
+                    if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+                    {
+                        xMatchFound = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+                {
+                    /* All bits are set. */
+                    xMatchFound = pdTRUE;
+                }
+                else
+                {
+                    /* Need all bits to be set, but not all the bits were set. */
+                }
+
+                #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+                {
+                    if( ( xWakeOne != pdFALSE ) && ( ( uxBitsWaitedFor & uxBitsToWake ) == ( EventBits_t ) 0 ) )
+                    {
+                        /* Every bit set that this task is waiting for has
+                         * already unblocked another task. */
+                        xMatchFound = pdFALSE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( xMatchFound == pdFALSE )
+                    {
+                        uxBitsStillWaitedFor |= uxBitsWaitedFor;
+                    }
+                    else if( xWakeOne != pdFALSE )
+                    {
+                        /* The tasks after this one cannot be unblocked once
+                         * each bit set has unblocked a task. */
+                        uxBitsToWake &= ~uxBitsWaitedFor;
+
+                        if( uxBitsToWake == ( EventBits_t ) 0 )
+                        {
+                            xTestWaitingTasks = pdFALSE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 ) */
+
+                if( xMatchFound != pdFALSE )
+                {
+                    /* The bits match.  Should the bits be cleared on exit? */
+                    if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+                    {
+                        uxBitsToClear |= uxBitsWaitedFor;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Store the actual event flag value in the task's event list
+                     * item before removing the task from the event list.  The
+                     * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+                     * that is was unblocked due to its required bits matching, rather
+                     * than because it timed out. */
+                    vTaskRemoveFromUnorderedEventList( pxListItem, prvGetUnblockedItemValue( pxListItem, pxEventBits->uxEventBits ) );
+                }
+
+                /* Move onto the next list item.  Note pxListItem->pxNext is not
+                 * used here as the list item may have been removed from the event list
+                 * and inserted into the ready/pending reading list. */
+                pxListItem = pxNext;
+            }
+
+            #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+            {
+                /* The bits waited for can be recalculated once every waiting
+                 * task has been tested. */
+                if( pxListItem == pxListEnd )
+                {
+                    pxEventBits->uxBitsOfWaitingTasks = uxBitsStillWaitedFor;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
+             * bit was set in the control word. */
+            pxEventBits->uxEventBits &= ~uxBitsToClear;
+
+            /* Snapshot resulting bits. */
+            uxReturnBits = pxEventBits->uxEventBits;
+        }
+        egUNLOCK_BITS( pxEventBits );
+        egUNLOCK_WAITING_TASKS( pxEventBits );
+        ( void ) xTaskResumeAll();
+
+        #if ( configUSE_EVENT_GROUP_WAKE_ONE == 0 )
+        {
+            ( void ) xWakeOne;
+        }
+        #endif
+
+        return uxReturnBits;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 0 ) )
 
         BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                               const EventBits_t uxBitsToSet,
@@ -823,6 +1329,7 @@
             traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken );
 
             traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+            egASSERT_BITS_CAN_BE_PENDED( uxBitsToSet );
             xReturn = xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
 
             traceRETURN_xEventGroupSetBitsFromISR( xReturn );
@@ -830,7 +1337,224 @@
             return xReturn;
         }
 
-    #endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) ) */
+    #endif /* if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) && ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 0 ) ) */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+
+        BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
+                                              const EventBits_t uxBitsToSet,
+                                              BaseType_t * pxHigherPriorityTaskWoken )
+        {
+            EventGroup_t * const pxEventBits = xEventGroup;
+            List_t const * const pxList = &( pxEventBits->xTasksWaitingForBits );
+            ListItem_t const * const pxListEnd = listGET_END_MARKER( pxList );
+            ListItem_t * pxListItem;
+            ListItem_t * pxNext;
+            EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+            UBaseType_t uxSavedInterruptStatus;
+            UBaseType_t uxTestsRemaining = ( UBaseType_t ) configEVENT_GROUP_SET_BITS_FROM_ISR_MAX_TESTS;
+            PendedFunction_t xFunctionToPend = NULL;
+            BaseType_t xTestWaitingTasks = pdTRUE;
+            BaseType_t xReturn = pdPASS;
+
+            traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken );
+
+            configASSERT( xEventGroup );
+            configASSERT( ( uxBitsToSet & eventEVENT_BITS_RESERVED ) == 0 );
+
+            traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet );
+
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            uxSavedInterruptStatus = egENTER_CRITICAL_FROM_ISR( pxEventBits );
+            {
+                if( pxEventBits->uxWaitingTasksLocked != ( UBaseType_t ) 0 )
+                {
+                    /* The interrupted code, or a task on another core, is
+                     * accessing the list of waiting tasks, so leave setting the
+                     * bits to the timer task. */
+                    xFunctionToPend = vEventGroupSetBitsCallback;
+                }
+                else
+                {
+                    pxEventBits->uxEventBits |= uxBitsToSet;
+
+                    #if ( configUSE_IPC_STATISTICS == 1 )
+                    {
+                        pxEventBits->xStatistics.ulSends++;
+                    }
+                    #endif
+
+                    #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+                    {
+                        if( ( uxBitsToSet & pxEventBits->uxBitsOfWaitingTasks ) == ( EventBits_t ) 0 )
+                        {
+                            xTestWaitingTasks = pdFALSE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    #endif
+
+                    pxListItem = listGET_HEAD_ENTRY( pxList );
+
+                    while( ( pxListItem != pxListEnd ) && ( xTestWaitingTasks != pdFALSE ) )
+                    {
+                        if( uxTestsRemaining == ( UBaseType_t ) 0 )
+                        {
+                            /* Bound the time spent in the interrupt by leaving
+                             * the remaining waiting tasks to the timer task. */
+                            xFunctionToPend = prvUnblockWaitingTasksCallback;
+                            break;
+                        }
+
+                        uxTestsRemaining--;
+
+                        pxNext = listGET_NEXT( pxListItem );
+                        uxBitsWaitedFor = prvGetBitsWaitedFor( pxListItem, &uxControlBits );
+
+                        if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, ( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE ) != pdFALSE )
+                        {
+                            if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+                            {
+                                uxBitsToClear |= uxBitsWaitedFor;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            if( xTaskRemoveFromUnorderedEventListFromISR( pxListItem, prvGetUnblockedItemValue( pxListItem, pxEventBits->uxEventBits ) ) != pdFALSE )
+                            {
+                                if( pxHigherPriorityTaskWoken != NULL )
+                                {
+                                    *pxHigherPriorityTaskWoken = pdTRUE;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        pxListItem = pxNext;
+                    }
+
+                    /* Clear any bits that matched when the
+                     * eventCLEAR_EVENTS_ON_EXIT_BIT bit was set in the control
+                     * word. */
+                    pxEventBits->uxEventBits &= ~uxBitsToClear;
+                }
+            }
+            egEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxEventBits );
+
+            if( xFunctionToPend != NULL )
+            {
+                egASSERT_BITS_CAN_BE_PENDED( uxBitsToSet );
+                xReturn = xTimerPendFunctionCallFromISR( xFunctionToPend, ( void * ) xEventGroup, ( uint32_t ) uxBitsToSet, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_xEventGroupSetBitsFromISR( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+
+        static void prvUnblockWaitingTasksCallback( void * pvEventGroup,
+                                                    uint32_t ulBitsSet )
+        {
+            /* MISRA Ref 11.5.4 [Callback function parameter] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            ( void ) prvSetBitsAndUnblockTasks( pvEventGroup, ( EventBits_t ) ulBitsSet, pdFALSE, pdFALSE );
+        }
+
+    #endif /* configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+
+        static void prvRecordWaitStatistics( EventGroup_t * const pxEventBits,
+                                             const TickType_t xBlockStartTime,
+                                             const BaseType_t xBlocked,
+                                             const BaseType_t xTimeoutOccurred )
+        {
+            TickType_t xBlockedTime = 0U;
+
+            if( xBlocked != pdFALSE )
+            {
+                xBlockedTime = xTaskGetTickCount() - xBlockStartTime;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            egENTER_CRITICAL( pxEventBits );
+            {
+                pxEventBits->xStatistics.xTotalBlockedTime += xBlockedTime;
+
+                if( xTimeoutOccurred == pdFALSE )
+                {
+                    pxEventBits->xStatistics.ulReceives++;
+                }
+                else if( xBlocked != pdFALSE )
+                {
+                    pxEventBits->xStatistics.ulTimeouts++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            egEXIT_CRITICAL( pxEventBits );
+        }
+
+    #endif /* configUSE_IPC_STATISTICS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+
+        void vEventGroupGetStatistics( EventGroupHandle_t xEventGroup,
+                                       IPCStatistics_t * pxStatistics )
+        {
+            EventGroup_t * const pxEventBits = xEventGroup;
+
+            traceENTER_vEventGroupGetStatistics( xEventGroup, pxStatistics );
+
+            configASSERT( pxEventBits );
+            configASSERT( pxStatistics );
+
+            egENTER_CRITICAL( pxEventBits );
+            {
+                *pxStatistics = pxEventBits->xStatistics;
+            }
+            egEXIT_CRITICAL( pxEventBits );
+
+            traceRETURN_vEventGroupGetStatistics();
+        }
+
+    #endif /* configUSE_IPC_STATISTICS */
 /*-----------------------------------------------------------*/
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -0,0 +1,546 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_handler.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include event handler functionality. This #if is closed at the very bottom
+ * of this file. If you want to include event handlers then ensure
+ * configUSE_EVENT_HANDLERS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_EVENT_HANDLERS == 1 )
+
+/* The name given to each dispatcher task. */
+    #define eventhandlerDISPATCHER_TASK_NAME    "EvtH"
+
+/* The task, and the lists of posted handlers, that run the handlers of one
+ * priority.  Handlers posted with a delay wait in a list ordered by the tick
+ * count at which they are due, with a second list for those due after the tick
+ * count next overflows, in the same way as delayed tasks. */
+    typedef struct EventHandlerDispatcherDef_t
+    {
+        List_t xPendingHandlers;
+        List_t xDelayedHandlers[ 2 ];
+        List_t * pxDelayedHandlers;
+        List_t * pxOverflowDelayedHandlers;
+        TickType_t xLastTickCount;
+        TaskHandle_t xTask;
+    } EventHandlerDispatcher_t;
+
+/*-----------------------------------------------------------*/
+
+/* The dispatcher of each priority, or NULL if no handler of that priority has
+ * been initialised. */
+    PRIVILEGED_DATA static EventHandlerDispatcher_t * volatile pxDispatchers[ configMAX_PRIORITIES ] = { NULL };
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The dispatcher task.  Runs the handlers posted to its priority to
+ * completion, one at a time, then waits for more to be posted.
+ */
+    static portTASK_FUNCTION_PROTO( prvDispatcherTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Creates the dispatcher for uxPriority if it does not exist yet.  Returns
+ * pdPASS if the dispatcher exists on return.
+ */
+    static BaseType_t prvCreateDispatcher( UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds a handler to the end of the list of handlers waiting to run, taking it
+ * out of the delayed lists first if it is in one.  Returns pdFAIL if the
+ * handler was already waiting to run.  Must be called from a critical
+ * section.
+ */
+    static BaseType_t prvAddToPendingList( EventHandlerDispatcher_t * const pxDispatcher,
+                                           EventHandler_t * const pxHandler ) PRIVILEGED_FUNCTION;
+
+/*
+ * Swaps the delayed lists if the tick count has overflowed since it was last
+ * checked, moving the handlers left in the current list, which are all due, to
+ * the list of handlers waiting to run.  Must be called from a critical
+ * section.
+ */
+    static void prvSwitchDelayedListsIfOverflowed( EventHandlerDispatcher_t * const pxDispatcher,
+                                                   const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves the delayed handlers that are due to the list of handlers waiting to
+ * run.  Returns 0 if any were moved, otherwise the number of ticks until the
+ * next delayed handler is due, or portMAX_DELAY if there are none.
+ */
+    static TickType_t prvProcessDelayedHandlers( EventHandlerDispatcher_t * const pxDispatcher ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xEventHandlerInit( EventHandler_t * pxHandler,
+                                  EventHandlerFunction_t pxFunction,
+                                  void * pvParameter,
+                                  UBaseType_t uxPriority )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xEventHandlerInit( pxHandler, pxFunction, pvParameter, uxPriority );
+
+        configASSERT( pxHandler );
+        configASSERT( pxFunction );
+        configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        if( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES )
+        {
+            pxHandler->pxFunction = pxFunction;
+            pxHandler->pvParameter = pvParameter;
+            pxHandler->uxPriority = uxPriority;
+            vListInitialiseItem( &( pxHandler->xPendingListItem ) );
+            listSET_LIST_ITEM_OWNER( &( pxHandler->xPendingListItem ), pxHandler );
+
+            xReturn = prvCreateDispatcher( uxPriority );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xEventHandlerInit( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xEventHandlerPost( EventHandler_t * pxHandler )
+    {
+        BaseType_t xReturn = pdFAIL;
+        EventHandlerDispatcher_t * pxDispatcher;
+
+        traceENTER_xEventHandlerPost( pxHandler );
+
+        configASSERT( pxHandler );
+
+        pxDispatcher = pxDispatchers[ pxHandler->uxPriority ];
+        configASSERT( pxDispatcher );
+
+        taskENTER_CRITICAL();
+        {
+            xReturn = prvAddToPendingList( pxDispatcher, pxHandler );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xReturn == pdPASS )
+        {
+            ( void ) xTaskNotifyGive( pxDispatcher->xTask );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xEventHandlerPost( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xEventHandlerPostFromISR( EventHandler_t * pxHandler,
+                                         BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        BaseType_t xReturn = pdFAIL;
+        EventHandlerDispatcher_t * pxDispatcher;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_xEventHandlerPostFromISR( pxHandler, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxHandler );
+
+        pxDispatcher = pxDispatchers[ pxHandler->uxPriority ];
+        configASSERT( pxDispatcher );
+
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            xReturn = prvAddToPendingList( pxDispatcher, pxHandler );
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        if( xReturn == pdPASS )
+        {
+            vTaskNotifyGiveFromISR( pxDispatcher->xTask, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xEventHandlerPostFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xEventHandlerPostDelayed( EventHandler_t * pxHandler,
+                                         TickType_t xTicksToDelay )
+    {
+        BaseType_t xReturn = pdFAIL;
+        EventHandlerDispatcher_t * pxDispatcher;
+        TickType_t xTimeNow;
+        TickType_t xTimeToRun;
+
+        traceENTER_xEventHandlerPostDelayed( pxHandler, xTicksToDelay );
+
+        configASSERT( pxHandler );
+
+        pxDispatcher = pxDispatchers[ pxHandler->uxPriority ];
+        configASSERT( pxDispatcher );
+
+        if( xTicksToDelay == ( TickType_t ) 0 )
+        {
+            xReturn = xEventHandlerPost( pxHandler );
+        }
+        else
+        {
+            taskENTER_CRITICAL();
+            {
+                /* A handler that is already waiting to run is left as it is,
+                 * but a handler that is already delayed has its delay
+                 * restarted. */
+                if( listLIST_ITEM_CONTAINER( &( pxHandler->xPendingListItem ) ) != &( pxDispatcher->xPendingHandlers ) )
+                {
+                    if( listLIST_ITEM_CONTAINER( &( pxHandler->xPendingListItem ) ) != NULL )
+                    {
+                        ( void ) uxListRemove( &( pxHandler->xPendingListItem ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xTimeNow = xTaskGetTickCount();
+                    prvSwitchDelayedListsIfOverflowed( pxDispatcher, xTimeNow );
+
+                    xTimeToRun = xTimeNow + xTicksToDelay;
+                    listSET_LIST_ITEM_VALUE( &( pxHandler->xPendingListItem ), xTimeToRun );
+
+                    if( xTimeToRun < xTimeNow )
+                    {
+                        /* Wake time has overflowed. */
+                        vListInsert( pxDispatcher->pxOverflowDelayedHandlers, &( pxHandler->xPendingListItem ) );
+                    }
+                    else
+                    {
+                        vListInsert( pxDispatcher->pxDelayedHandlers, &( pxHandler->xPendingListItem ) );
+                    }
+
+                    xReturn = pdPASS;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xReturn == pdPASS )
+            {
+                /* Wake the dispatcher so it recalculates how long it can
+                 * wait for. */
+                ( void ) xTaskNotifyGive( pxDispatcher->xTask );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_xEventHandlerPostDelayed( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCreateDispatcher( UBaseType_t uxPriority )
+    {
+        BaseType_t xReturn = pdPASS;
+        EventHandlerDispatcher_t * pxDispatcher;
+
+        /* Stop two tasks creating the dispatcher of the same priority at the
+         * same time.  The dispatcher does not run until the scheduler is
+         * resumed, even if its priority is above that of the calling task. */
+        vTaskSuspendAll();
+        {
+            if( pxDispatchers[ uxPriority ] == NULL )
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxDispatcher = ( EventHandlerDispatcher_t * ) pvPortMalloc( sizeof( EventHandlerDispatcher_t ) );
+
+                if( pxDispatcher != NULL )
+                {
+                    vListInitialise( &( pxDispatcher->xPendingHandlers ) );
+                    vListInitialise( &( pxDispatcher->xDelayedHandlers[ 0 ] ) );
+                    vListInitialise( &( pxDispatcher->xDelayedHandlers[ 1 ] ) );
+                    pxDispatcher->pxDelayedHandlers = &( pxDispatcher->xDelayedHandlers[ 0 ] );
+                    pxDispatcher->pxOverflowDelayedHandlers = &( pxDispatcher->xDelayedHandlers[ 1 ] );
+                    pxDispatcher->xLastTickCount = xTaskGetTickCount();
+
+                    if( xTaskCreate( prvDispatcherTask,
+                                     eventhandlerDISPATCHER_TASK_NAME,
+                                     configEVENT_HANDLER_STACK_DEPTH,
+                                     ( void * ) pxDispatcher,
+                                     uxPriority,
+                                     &( pxDispatcher->xTask ) ) == pdPASS )
+                    {
+                        pxDispatchers[ uxPriority ] = pxDispatcher;
+                    }
+                    else
+                    {
+                        vPortFree( pxDispatcher );
+                        xReturn = pdFAIL;
+                    }
+                }
+                else
+                {
+                    xReturn = pdFAIL;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvDispatcherTask, pvParameters )
+    {
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        EventHandlerDispatcher_t * const pxDispatcher = ( EventHandlerDispatcher_t * ) pvParameters;
+        EventHandler_t * pxHandler;
+        TickType_t xTicksToWait;
+
+        for( ; ; )
+        {
+            /* Wait for a handler to be posted, or for the next delayed handler
+             * to be due, unless a delayed handler has just been made ready to
+             * run. */
+            xTicksToWait = prvProcessDelayedHandlers( pxDispatcher );
+
+            if( xTicksToWait != ( TickType_t ) 0 )
+            {
+                ( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Run every handler that has been posted, in the order they were
+             * posted.  A handler is taken out of the list before it runs, so
+             * it can be posted again, by itself or anything else, while it
+             * runs. */
+            for( ; ; )
+            {
+                taskENTER_CRITICAL();
+                {
+                    if( listLIST_IS_EMPTY( &( pxDispatcher->xPendingHandlers ) ) == pdFALSE )
+                    {
+                        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                        /* coverity[misra_c_2012_rule_11_5_violation] */
+                        pxHandler = ( EventHandler_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxDispatcher->xPendingHandlers ) );
+                        ( void ) uxListRemove( &( pxHandler->xPendingListItem ) );
+                    }
+                    else
+                    {
+                        pxHandler = NULL;
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( pxHandler == NULL )
+                {
+                    break;
+                }
+
+                traceEVENT_HANDLER_RUN( pxHandler );
+
+                pxHandler->pxFunction( pxHandler->pvParameter );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvAddToPendingList( EventHandlerDispatcher_t * const pxDispatcher,
+                                           EventHandler_t * const pxHandler )
+    {
+        BaseType_t xReturn = pdFAIL;
+        const List_t * const pxContainer = listLIST_ITEM_CONTAINER( &( pxHandler->xPendingListItem ) );
+
+        /* A handler that is already waiting to run is not added twice. */
+        if( pxContainer != &( pxDispatcher->xPendingHandlers ) )
+        {
+            if( pxContainer != NULL )
+            {
+                /* The handler was posted with a delay that has not yet
+                 * expired. */
+                ( void ) uxListRemove( &( pxHandler->xPendingListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            vListInsertEnd( &( pxDispatcher->xPendingHandlers ), &( pxHandler->xPendingListItem ) );
+            xReturn = pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSwitchDelayedListsIfOverflowed( EventHandlerDispatcher_t * const pxDispatcher,
+                                                   const TickType_t xTimeNow )
+    {
+        List_t * pxTemp;
+        EventHandler_t * pxHandler;
+
+        if( xTimeNow < pxDispatcher->xLastTickCount )
+        {
+            /* The tick count has overflowed, so every handler still in the
+             * current list is due. */
+            while( listLIST_IS_EMPTY( pxDispatcher->pxDelayedHandlers ) == pdFALSE )
+            {
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxHandler = ( EventHandler_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDispatcher->pxDelayedHandlers );
+                ( void ) uxListRemove( &( pxHandler->xPendingListItem ) );
+                vListInsertEnd( &( pxDispatcher->xPendingHandlers ), &( pxHandler->xPendingListItem ) );
+            }
+
+            pxTemp = pxDispatcher->pxDelayedHandlers;
+            pxDispatcher->pxDelayedHandlers = pxDispatcher->pxOverflowDelayedHandlers;
+            pxDispatcher->pxOverflowDelayedHandlers = pxTemp;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxDispatcher->xLastTickCount = xTimeNow;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvProcessDelayedHandlers( EventHandlerDispatcher_t * const pxDispatcher )
+    {
+        TickType_t xTicksToWait = portMAX_DELAY;
+        TickType_t xTimeNow;
+        EventHandler_t * pxHandler;
+        BaseType_t xHandlerMoved = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            xTimeNow = xTaskGetTickCount();
+            prvSwitchDelayedListsIfOverflowed( pxDispatcher, xTimeNow );
+
+            /* The delayed list is in time order, so only the handlers at the
+             * head of the list need to be checked. */
+            while( listLIST_IS_EMPTY( pxDispatcher->pxDelayedHandlers ) == pdFALSE )
+            {
+                if( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDispatcher->pxDelayedHandlers ) > xTimeNow )
+                {
+                    break;
+                }
+
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxHandler = ( EventHandler_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDispatcher->pxDelayedHandlers );
+                ( void ) uxListRemove( &( pxHandler->xPendingListItem ) );
+                vListInsertEnd( &( pxDispatcher->xPendingHandlers ), &( pxHandler->xPendingListItem ) );
+            }
+
+            if( listLIST_IS_EMPTY( &( pxDispatcher->xPendingHandlers ) ) == pdFALSE )
+            {
+                xHandlerMoved = pdTRUE;
+            }
+            else if( listLIST_IS_EMPTY( pxDispatcher->pxDelayedHandlers ) == pdFALSE )
+            {
+                xTicksToWait = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDispatcher->pxDelayedHandlers ) - xTimeNow;
+            }
+            else if( listLIST_IS_EMPTY( pxDispatcher->pxOverflowDelayedHandlers ) == pdFALSE )
+            {
+                /* The next handler is due after the tick count overflows, so
+                 * the subtraction wraps to the right number of ticks. */
+                xTicksToWait = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDispatcher->pxOverflowDelayedHandlers ) - xTimeNow;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xHandlerMoved != pdFALSE )
+        {
+            xTicksToWait = ( TickType_t ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xTicksToWait;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include event handler functionality. If you want to include event
+ * handlers then ensure configUSE_EVENT_HANDLERS is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_EVENT_HANDLERS == 1 */
@@ -0,0 +1,128 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/* FreeRTOSConfig.h for running the kernel benchmarks on the GCC_POSIX port.
+ * To run them on another port, point BENCH_CONFIG_DIRECTORY at a
+ * FreeRTOSConfig.h for that target, which should also define
+ * benchGET_TIMESTAMP() and benchTIMESTAMP_UNIT (see main.c). */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/******************************************************************************/
+/* Scheduling behaviour related definitions. **********************************/
+/******************************************************************************/
+
+#define configTICK_RATE_HZ                         ( 1000U )
+#define configUSE_PREEMPTION                       1
+#define configUSE_TIME_SLICING                     1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#define configUSE_TICKLESS_IDLE                    0
+#define configMAX_PRIORITIES                       8U
+#define configMINIMAL_STACK_SIZE                   ( ( unsigned short ) PTHREAD_STACK_MIN )
+#define configMAX_TASK_NAME_LEN                    12U
+#define configTICK_TYPE_WIDTH_IN_BITS              TICK_TYPE_WIDTH_32_BITS
+#define configIDLE_SHOULD_YIELD                    1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES      1U
+#define configQUEUE_REGISTRY_SIZE                  0U
+
+/******************************************************************************/
+/* Software timer related definitions. ****************************************/
+/******************************************************************************/
+
+#define configUSE_TIMERS                1
+#define configTIMER_TASK_PRIORITY       ( configMAX_PRIORITIES - 1U )
+#define configTIMER_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#define configTIMER_QUEUE_LENGTH        10U
+
+/******************************************************************************/
+/* Memory allocation related definitions. *************************************/
+/******************************************************************************/
+
+#define configSUPPORT_STATIC_ALLOCATION     0
+#define configSUPPORT_DYNAMIC_ALLOCATION    1
+#define configTOTAL_HEAP_SIZE               ( ( size_t ) ( 192U * 1024U * 1024U ) )
+
+/******************************************************************************/
+/* Hook and callback function related definitions. ****************************/
+/******************************************************************************/
+
+#define configUSE_IDLE_HOOK             0
+#define configUSE_TICK_HOOK             0
+#define configUSE_MALLOC_FAILED_HOOK    1
+#define configCHECK_FOR_STACK_OVERFLOW  0
+
+/******************************************************************************/
+/* Definitions that include or exclude functionality. *************************/
+/******************************************************************************/
+
+#define configUSE_TASK_NOTIFICATIONS    1
+#define configUSE_MUTEXES               1
+#define configUSE_COUNTING_SEMAPHORES   1
+#define INCLUDE_vTaskDelete             1
+#define INCLUDE_vTaskSuspend            1
+#define INCLUDE_vTaskDelay              1
+
+/******************************************************************************/
+/* Benchmark trace hooks. *****************************************************/
+/******************************************************************************/
+
+/* Time the tick and context switch processing, and the insertion of a task
+ * into the delayed list, for the scaling benchmarks (see main.c). */
+#define benchTRACE_HOOKS     1
+#define benchTRACE_TICK      0U
+#define benchTRACE_SWITCH    1U
+#define benchTRACE_DELAY     2U
+
+void vBenchTraceEnter( unsigned int uxPoint );
+void vBenchTraceExit( unsigned int uxPoint );
+
+#define traceENTER_xTaskIncrementTick()                       vBenchTraceEnter( benchTRACE_TICK )
+#define traceRETURN_xTaskIncrementTick( xSwitchRequired )     vBenchTraceExit( benchTRACE_TICK )
+#define traceENTER_vTaskSwitchContext()                       vBenchTraceEnter( benchTRACE_SWITCH )
+#define traceRETURN_vTaskSwitchContext()                      vBenchTraceExit( benchTRACE_SWITCH )
+#define traceENTER_vTaskDelay( xTicksToDelay )                vBenchTraceEnter( benchTRACE_DELAY )
+#define traceMOVED_TASK_TO_DELAYED_LIST()                     vBenchTraceExit( benchTRACE_DELAY )
+#define traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST()            vBenchTraceExit( benchTRACE_DELAY )
+
+/******************************************************************************/
+/* Debugging assistance. ******************************************************/
+/******************************************************************************/
+
+#define configASSERT( x )                                             \
+    if( ( x ) == 0 )                                                  \
+    {                                                                 \
+        ( void ) fprintf( stderr, "%s:%d: assert\n", __FILE__, __LINE__ ); \
+        abort();                                                      \
+    }
+
+#endif /* FREERTOS_CONFIG_H */
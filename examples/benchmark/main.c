@@ -0,0 +1,906 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Kernel micro-benchmarks.
+ *
+ * A single benchmark task runs each measurement in turn, creating the helper
+ * tasks it needs, and prints one JSON object per line to stdout:
+ *
+ * {"benchmark":"queue_round_trip","unit":"ns","samples":1000,"min":...,
+ *  "p50":...,"p90":...,"p99":...,"max":...}
+ *
+ * Stream buffer results also give the chunk size, the number of bytes moved
+ * and the total elapsed time, from which the throughput follows.
+ *
+ * The scaling benchmarks then repeat the operations whose cost grows with
+ * the number of kernel objects for each count in benchSCALING_COUNTS, with the
+ * count appended to the benchmark name, for example scaling_timer_start_100.
+ * When FreeRTOSConfig.h sets benchTRACE_HOOKS to 1 the longest tick and
+ * context switch processing seen during each delayed task sweep is also
+ * printed:
+ *
+ * {"benchmark":"scaling_critical_section","unit":"ns","tasks":100,
+ *  "tick_max":...,"switch_max":...}
+ *
+ * The last line is {"benchmark":"end"}.
+ *
+ * Timestamps come from benchGET_TIMESTAMP(), which returns a free running
+ * uint32_t count in units named by benchTIMESTAMP_UNIT.  Both default to
+ * CLOCK_MONOTONIC nanoseconds on POSIX hosts.  Define them in FreeRTOSConfig.h
+ * to read a cycle counter on other ports.
+ */
+
+/* FreeRTOS includes. */
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <semphr.h>
+#include <timers.h>
+#include <event_groups.h>
+#include <stream_buffer.h>
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef benchGET_TIMESTAMP
+    #if defined( __unix__ ) || defined( __APPLE__ )
+        #include <time.h>
+
+        static uint32_t prvGetTimestamp( void )
+        {
+            struct timespec xNow;
+
+            ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+            return ( uint32_t ) ( ( uint64_t ) xNow.tv_sec * 1000000000ULL + ( uint64_t ) xNow.tv_nsec );
+        }
+
+        #define benchGET_TIMESTAMP()    prvGetTimestamp()
+        #define benchTIMESTAMP_UNIT     "ns"
+    #else
+        #error Define benchGET_TIMESTAMP() and benchTIMESTAMP_UNIT in FreeRTOSConfig.h for this port.
+    #endif
+#endif /* benchGET_TIMESTAMP */
+
+#ifndef benchTIMESTAMP_UNIT
+    #define benchTIMESTAMP_UNIT    "cycles"
+#endif
+
+/* Called once from main() before any kernel object is created, to set up
+ * the clocks, the timestamp counter and stdout on real hardware. */
+#ifndef benchPLATFORM_INIT
+    #define benchPLATFORM_INIT()
+#endif
+
+/* Called once all the results have been printed. */
+#ifndef benchEXIT
+    #if defined( __unix__ ) || defined( __APPLE__ )
+        #define benchEXIT()    exit( 0 )
+    #else
+        #define benchEXIT()    vTaskSuspend( NULL )
+    #endif
+#endif
+
+/* The number of samples taken by each benchmark. */
+#ifndef benchSAMPLES
+    #define benchSAMPLES    1000U
+#endif
+
+/* The object counts swept by the scaling benchmarks. */
+#ifndef benchSCALING_COUNTS
+    #define benchSCALING_COUNTS    10U, 100U, 1000U
+#endif
+
+/* Set to 1 in FreeRTOSConfig.h, with the trace macros calling
+ * vBenchTraceEnter() and vBenchTraceExit(), to time the kernel's critical
+ * sections. */
+#ifndef benchTRACE_HOOKS
+    #define benchTRACE_HOOKS    0
+#endif
+
+#define benchSTACK_SIZE             ( configMINIMAL_STACK_SIZE * 4U )
+
+/* Long enough for the longest result name followed by a 64-bit count. */
+#define benchNAME_LENGTH            64U
+
+/* The benchmark task runs below the timer task so timer commands are
+ * processed before the timer API returns.  Helper tasks run below it. */
+#define benchMAIN_PRIORITY          ( configMAX_PRIORITIES - 2U )
+#define benchHELPER_PRIORITY        ( configMAX_PRIORITIES - 3U )
+
+#define benchSTREAM_BUFFER_SIZE     1024U
+#define benchSTREAM_BUFFER_BYTES    65536U
+#define benchMALLOC_BATCH           16U
+
+/* The scaling benchmarks create many tasks, so give them the smallest
+ * stack. */
+#define benchSCALING_STACK_SIZE     configMINIMAL_STACK_SIZE
+#define benchSCALING_MAX_DELAY      16U
+#define benchSCALING_WAIT_BIT       ( ( EventBits_t ) 0x01U )
+#define benchSCALING_SET_BIT        ( ( EventBits_t ) 0x02U )
+#define benchSCALING_LARGE_BLOCK    1024U
+
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void * pvParameters );
+
+static void prvReportSamples( const char * pcName,
+                              UBaseType_t uxSamples );
+static int prvCompareSamples( const void * pvA,
+                              const void * pvB );
+
+static void prvContextSwitch( void );
+static void prvQueueRoundTrip( void );
+static void prvSemaphoreGiveTake( void );
+static void prvNotifyRoundTrip( void );
+static void prvStreamBuffer( size_t xChunkSize );
+static void prvTimerStartReset( void );
+static void prvMallocFree( void );
+static void prvScalingDelayedTasks( UBaseType_t uxTasks );
+static void prvScalingEventGroupWaiters( UBaseType_t uxWaiters );
+static void prvScalingTimers( UBaseType_t uxTimers );
+static void prvScalingHeap( UBaseType_t uxBlocks );
+
+/*-----------------------------------------------------------*/
+
+static uint32_t ulSamples[ benchSAMPLES ];
+static volatile UBaseType_t uxSampleCount;
+static TaskHandle_t xBenchmarkTask;
+
+/* Shared between the helper tasks of each benchmark. */
+static volatile uint32_t ulSwitchStart;
+static QueueHandle_t xPingQueue;
+static QueueHandle_t xPongQueue;
+static StreamBufferHandle_t xStreamBuffer;
+static size_t xStreamChunkSize;
+static EventGroupHandle_t xEventGroup;
+static TaskHandle_t * pxScalingTasks;
+
+#if ( benchTRACE_HOOKS == 1 )
+    static volatile uint32_t ulTraceStart[ 3 ];
+    static volatile uint32_t ulTraceMax[ 3 ];
+    static volatile BaseType_t xTraceActive[ 3 ];
+    static volatile BaseType_t xCollectDelaySamples = pdFALSE;
+#endif
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    benchPLATFORM_INIT();
+
+    ( void ) xTaskCreate( prvBenchmarkTask,
+                          "bench",
+                          benchSTACK_SIZE,
+                          NULL,
+                          benchMAIN_PRIORITY,
+                          &xBenchmarkTask );
+
+    /* Start the scheduler. */
+    vTaskStartScheduler();
+
+    for( ; ; )
+    {
+        /* Should not reach here. */
+    }
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void * pvParameters )
+{
+    static const size_t xChunkSizes[] = { 1U, 16U, 64U, 256U };
+    static const UBaseType_t uxScalingCounts[] = { benchSCALING_COUNTS };
+    UBaseType_t uxChunk;
+    UBaseType_t uxCount;
+
+    ( void ) pvParameters;
+
+    prvContextSwitch();
+    prvQueueRoundTrip();
+    prvSemaphoreGiveTake();
+    prvNotifyRoundTrip();
+
+    for( uxChunk = 0U; uxChunk < ( sizeof( xChunkSizes ) / sizeof( xChunkSizes[ 0 ] ) ); uxChunk++ )
+    {
+        prvStreamBuffer( xChunkSizes[ uxChunk ] );
+    }
+
+    prvTimerStartReset();
+    prvMallocFree();
+
+    for( uxCount = 0U; uxCount < ( sizeof( uxScalingCounts ) / sizeof( uxScalingCounts[ 0 ] ) ); uxCount++ )
+    {
+        prvScalingDelayedTasks( uxScalingCounts[ uxCount ] );
+        prvScalingEventGroupWaiters( uxScalingCounts[ uxCount ] );
+        prvScalingTimers( uxScalingCounts[ uxCount ] );
+        prvScalingHeap( uxScalingCounts[ uxCount ] );
+    }
+
+    ( void ) printf( "{\"benchmark\":\"end\"}\n" );
+    ( void ) fflush( stdout );
+
+    benchEXIT();
+
+    for( ; ; )
+    {
+        vTaskSuspend( NULL );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareSamples( const void * pvA,
+                              const void * pvB )
+{
+    const uint32_t ulA = *( ( const uint32_t * ) pvA );
+    const uint32_t ulB = *( ( const uint32_t * ) pvB );
+
+    return ( ulA > ulB ) - ( ulA < ulB );
+}
+/*-----------------------------------------------------------*/
+
+static void prvReportSamples( const char * pcName,
+                              UBaseType_t uxSamples )
+{
+    configASSERT( ( uxSamples > 0U ) && ( uxSamples <= benchSAMPLES ) );
+
+    qsort( ulSamples, ( size_t ) uxSamples, sizeof( ulSamples[ 0 ] ), prvCompareSamples );
+
+    ( void ) printf( "{\"benchmark\":\"%s\",\"unit\":\"%s\",\"samples\":%lu,"
+                     "\"min\":%lu,\"p50\":%lu,\"p90\":%lu,\"p99\":%lu,\"max\":%lu}\n",
+                     pcName,
+                     benchTIMESTAMP_UNIT,
+                     ( unsigned long ) uxSamples,
+                     ( unsigned long ) ulSamples[ 0 ],
+                     ( unsigned long ) ulSamples[ ( uxSamples * 50U ) / 100U ],
+                     ( unsigned long ) ulSamples[ ( uxSamples * 90U ) / 100U ],
+                     ( unsigned long ) ulSamples[ ( uxSamples * 99U ) / 100U ],
+                     ( unsigned long ) ulSamples[ uxSamples - 1U ] );
+    ( void ) fflush( stdout );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Two tasks of equal priority yield to each other.  Each records the time
+ * from the other task's yield to its own resumption.
+ */
+static void prvYieldTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        const uint32_t ulNow = benchGET_TIMESTAMP();
+
+        if( uxSampleCount < benchSAMPLES )
+        {
+            if( ulSwitchStart != 0U )
+            {
+                ulSamples[ uxSampleCount ] = ulNow - ulSwitchStart;
+                uxSampleCount++;
+            }
+
+            ulSwitchStart = benchGET_TIMESTAMP();
+            taskYIELD();
+        }
+        else
+        {
+            xTaskNotifyGive( xBenchmarkTask );
+            vTaskSuspend( NULL );
+        }
+    }
+}
+
+static void prvContextSwitch( void )
+{
+    TaskHandle_t xTaskA;
+    TaskHandle_t xTaskB;
+
+    uxSampleCount = 0U;
+    ulSwitchStart = 0U;
+
+    ( void ) xTaskCreate( prvYieldTask, "yldA", benchSTACK_SIZE, NULL, benchHELPER_PRIORITY, &xTaskA );
+    ( void ) xTaskCreate( prvYieldTask, "yldB", benchSTACK_SIZE, NULL, benchHELPER_PRIORITY, &xTaskB );
+
+    ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+    vTaskDelete( xTaskA );
+    vTaskDelete( xTaskB );
+
+    prvReportSamples( "context_switch", benchSAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueEchoTask( void * pvParameters )
+{
+    uint32_t ulValue;
+
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        ( void ) xQueueReceive( xPingQueue, &ulValue, portMAX_DELAY );
+        ( void ) xQueueSend( xPongQueue, &ulValue, portMAX_DELAY );
+    }
+}
+
+static void prvQueueRoundTrip( void )
+{
+    TaskHandle_t xEchoTask;
+    UBaseType_t uxSample;
+    uint32_t ulValue;
+    uint32_t ulStart;
+
+    xPingQueue = xQueueCreate( 1U, sizeof( uint32_t ) );
+    xPongQueue = xQueueCreate( 1U, sizeof( uint32_t ) );
+    configASSERT( ( xPingQueue != NULL ) && ( xPongQueue != NULL ) );
+
+    ( void ) xTaskCreate( prvQueueEchoTask, "qecho", benchSTACK_SIZE, NULL, benchHELPER_PRIORITY, &xEchoTask );
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulValue = ( uint32_t ) uxSample;
+
+        ulStart = benchGET_TIMESTAMP();
+        ( void ) xQueueSend( xPingQueue, &ulValue, portMAX_DELAY );
+        ( void ) xQueueReceive( xPongQueue, &ulValue, portMAX_DELAY );
+        ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+    }
+
+    vTaskDelete( xEchoTask );
+    vQueueDelete( xPingQueue );
+    vQueueDelete( xPongQueue );
+
+    prvReportSamples( "queue_round_trip", benchSAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSemaphoreGiveTake( void )
+{
+    SemaphoreHandle_t xSemaphore;
+    UBaseType_t uxSample;
+    uint32_t ulStart;
+
+    xSemaphore = xSemaphoreCreateBinary();
+    configASSERT( xSemaphore != NULL );
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulStart = benchGET_TIMESTAMP();
+        ( void ) xSemaphoreGive( xSemaphore );
+        ( void ) xSemaphoreTake( xSemaphore, 0U );
+        ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+    }
+
+    vSemaphoreDelete( xSemaphore );
+
+    prvReportSamples( "semaphore_give_take", benchSAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyEchoTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        xTaskNotifyGive( xBenchmarkTask );
+    }
+}
+
+static void prvNotifyRoundTrip( void )
+{
+    TaskHandle_t xEchoTask;
+    UBaseType_t uxSample;
+    uint32_t ulStart;
+
+    ( void ) xTaskCreate( prvNotifyEchoTask, "necho", benchSTACK_SIZE, NULL, benchHELPER_PRIORITY, &xEchoTask );
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulStart = benchGET_TIMESTAMP();
+        xTaskNotifyGive( xEchoTask );
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+    }
+
+    vTaskDelete( xEchoTask );
+
+    prvReportSamples( "notify_round_trip", benchSAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamReceiveTask( void * pvParameters )
+{
+    uint8_t ucBuffer[ 256 ];
+    size_t xReceived = 0U;
+
+    ( void ) pvParameters;
+
+    while( xReceived < benchSTREAM_BUFFER_BYTES )
+    {
+        xReceived += xStreamBufferReceive( xStreamBuffer, ucBuffer, xStreamChunkSize, portMAX_DELAY );
+    }
+
+    xTaskNotifyGive( xBenchmarkTask );
+    vTaskSuspend( NULL );
+}
+
+static void prvStreamBuffer( size_t xChunkSize )
+{
+    static const uint8_t ucChunk[ 256 ] = { 0 };
+    TaskHandle_t xReceiveTask;
+    UBaseType_t uxSample = 0U;
+    size_t xSent;
+    uint32_t ulStart;
+    uint32_t ulBegin;
+    uint32_t ulElapsed;
+    char cName[ benchNAME_LENGTH ];
+
+    configASSERT( xChunkSize <= sizeof( ucChunk ) );
+
+    xStreamBuffer = xStreamBufferCreate( benchSTREAM_BUFFER_SIZE, 1U );
+    configASSERT( xStreamBuffer != NULL );
+    xStreamChunkSize = xChunkSize;
+
+    ( void ) xTaskCreate( prvStreamReceiveTask, "srecv", benchSTACK_SIZE, NULL, benchHELPER_PRIORITY, &xReceiveTask );
+
+    ulBegin = benchGET_TIMESTAMP();
+
+    for( xSent = 0U; xSent < benchSTREAM_BUFFER_BYTES; xSent += xChunkSize )
+    {
+        ulStart = benchGET_TIMESTAMP();
+        ( void ) xStreamBufferSend( xStreamBuffer, ucChunk, xChunkSize, portMAX_DELAY );
+
+        /* Keep the samples of the first benchSAMPLES sends. */
+        if( uxSample < benchSAMPLES )
+        {
+            ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+            uxSample++;
+        }
+    }
+
+    ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+    ulElapsed = benchGET_TIMESTAMP() - ulBegin;
+
+    vTaskDelete( xReceiveTask );
+    vStreamBufferDelete( xStreamBuffer );
+
+    ( void ) printf( "{\"benchmark\":\"stream_buffer_throughput\",\"unit\":\"%s\",\"chunk\":%lu,\"bytes\":%lu,\"elapsed\":%lu}\n",
+                     benchTIMESTAMP_UNIT,
+                     ( unsigned long ) xChunkSize,
+                     ( unsigned long ) benchSTREAM_BUFFER_BYTES,
+                     ( unsigned long ) ulElapsed );
+
+    ( void ) snprintf( cName, sizeof( cName ), "stream_buffer_send_%lu", ( unsigned long ) xChunkSize );
+    prvReportSamples( cName, uxSample );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+}
+
+static void prvTimerStartReset( void )
+{
+    TimerHandle_t xTimer;
+    UBaseType_t uxSample;
+    uint32_t ulStart;
+
+    /* The period is long enough that the timer never expires. */
+    xTimer = xTimerCreate( "bench", portMAX_DELAY / 2U, pdFALSE, NULL, prvTimerCallback );
+    configASSERT( xTimer != NULL );
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulStart = benchGET_TIMESTAMP();
+        ( void ) xTimerStart( xTimer, portMAX_DELAY );
+        ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+        ( void ) xTimerStop( xTimer, portMAX_DELAY );
+    }
+
+    prvReportSamples( "timer_start", benchSAMPLES );
+
+    ( void ) xTimerStart( xTimer, portMAX_DELAY );
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulStart = benchGET_TIMESTAMP();
+        ( void ) xTimerReset( xTimer, portMAX_DELAY );
+        ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+    }
+
+    ( void ) xTimerDelete( xTimer, portMAX_DELAY );
+
+    prvReportSamples( "timer_reset", benchSAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMallocFree( void )
+{
+    static uint32_t ulFreeSamples[ benchSAMPLES ];
+    void * pvBlocks[ benchMALLOC_BATCH ];
+    UBaseType_t uxSample = 0U;
+    UBaseType_t uxBlock;
+    uint32_t ulRandom = 0x12345678U;
+    uint32_t ulStart;
+
+    while( ( uxSample + benchMALLOC_BATCH ) <= benchSAMPLES )
+    {
+        /* Allocate a batch of blocks of pseudo random sizes, then free every
+         * other one before the rest so the heap fragments a little. */
+        for( uxBlock = 0U; uxBlock < benchMALLOC_BATCH; uxBlock++ )
+        {
+            ulRandom = ( ulRandom * 1103515245U ) + 12345U;
+
+            ulStart = benchGET_TIMESTAMP();
+            pvBlocks[ uxBlock ] = pvPortMalloc( ( size_t ) 8U + ( size_t ) ( ( ulRandom >> 16 ) % 505U ) );
+            ulSamples[ uxSample + uxBlock ] = benchGET_TIMESTAMP() - ulStart;
+            configASSERT( pvBlocks[ uxBlock ] != NULL );
+        }
+
+        for( uxBlock = 0U; uxBlock < benchMALLOC_BATCH; uxBlock++ )
+        {
+            const UBaseType_t uxIndex = ( uxBlock < ( benchMALLOC_BATCH / 2U ) ) ? ( uxBlock * 2U ) : ( ( ( uxBlock - ( benchMALLOC_BATCH / 2U ) ) * 2U ) + 1U );
+
+            ulStart = benchGET_TIMESTAMP();
+            vPortFree( pvBlocks[ uxIndex ] );
+            ulFreeSamples[ uxSample + uxBlock ] = benchGET_TIMESTAMP() - ulStart;
+        }
+
+        uxSample += benchMALLOC_BATCH;
+    }
+
+    prvReportSamples( "malloc", uxSample );
+
+    for( uxBlock = 0U; uxBlock < uxSample; uxBlock++ )
+    {
+        ulSamples[ uxBlock ] = ulFreeSamples[ uxBlock ];
+    }
+
+    prvReportSamples( "free", uxSample );
+}
+/*-----------------------------------------------------------*/
+
+#if ( benchTRACE_HOOKS == 1 )
+
+    void vBenchTraceEnter( unsigned int uxPoint )
+    {
+        ulTraceStart[ uxPoint ] = benchGET_TIMESTAMP();
+        xTraceActive[ uxPoint ] = pdTRUE;
+    }
+
+    void vBenchTraceExit( unsigned int uxPoint )
+    {
+        uint32_t ulElapsed;
+
+        /* The delayed list is also entered from the blocking APIs, which do
+         * not open a measurement. */
+        if( xTraceActive[ uxPoint ] != pdFALSE )
+        {
+            ulElapsed = benchGET_TIMESTAMP() - ulTraceStart[ uxPoint ];
+            xTraceActive[ uxPoint ] = pdFALSE;
+
+            if( ulElapsed > ulTraceMax[ uxPoint ] )
+            {
+                ulTraceMax[ uxPoint ] = ulElapsed;
+            }
+
+            if( ( uxPoint == benchTRACE_DELAY ) &&
+                ( xCollectDelaySamples != pdFALSE ) &&
+                ( uxSampleCount < benchSAMPLES ) )
+            {
+                ulSamples[ uxSampleCount ] = ulElapsed;
+                uxSampleCount++;
+            }
+        }
+    }
+
+#endif /* #if ( benchTRACE_HOOKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+static void prvCreateScalingTasks( TaskFunction_t pxTaskCode,
+                                   UBaseType_t uxTasks )
+{
+    UBaseType_t uxTask;
+    BaseType_t xCreated;
+
+    pxScalingTasks = pvPortMalloc( sizeof( TaskHandle_t ) * ( size_t ) uxTasks );
+    configASSERT( pxScalingTasks != NULL );
+
+    for( uxTask = 0U; uxTask < uxTasks; uxTask++ )
+    {
+        xCreated = xTaskCreate( pxTaskCode,
+                                "scale",
+                                benchSCALING_STACK_SIZE,
+                                ( void * ) ( uintptr_t ) uxTask,
+                                benchHELPER_PRIORITY,
+                                &( pxScalingTasks[ uxTask ] ) );
+        configASSERT( xCreated == pdPASS );
+    }
+}
+
+static void prvDeleteScalingTasks( UBaseType_t uxTasks )
+{
+    UBaseType_t uxTask;
+
+    for( uxTask = 0U; uxTask < uxTasks; uxTask++ )
+    {
+        vTaskDelete( pxScalingTasks[ uxTask ] );
+    }
+
+    vPortFree( pxScalingTasks );
+    pxScalingTasks = NULL;
+
+    /* Let the idle task free the deleted tasks before the next benchmark. */
+    vTaskDelay( 2U );
+}
+/*-----------------------------------------------------------*/
+
+#if ( benchTRACE_HOOKS == 1 )
+
+/*
+ * Each task delays for a pseudo random number of ticks in a loop, so the
+ * delayed list holds up to one entry per task and the tick interrupt moves
+ * tasks back to the ready list every tick.  The trace hooks time each
+ * insertion into the delayed list, and the longest tick and context switch
+ * processing.
+ */
+    static void prvDelayTask( void * pvParameters )
+    {
+        uint32_t ulRandom = 0x12345678U + ( uint32_t ) ( uintptr_t ) pvParameters;
+
+        for( ; ; )
+        {
+            ulRandom = ( ulRandom * 1103515245U ) + 12345U;
+            vTaskDelay( ( TickType_t ) ( 1U + ( ( ulRandom >> 16 ) % benchSCALING_MAX_DELAY ) ) );
+
+            if( uxSampleCount >= benchSAMPLES )
+            {
+                xTaskNotifyGive( xBenchmarkTask );
+            }
+        }
+    }
+
+    static void prvScalingDelayedTasks( UBaseType_t uxTasks )
+    {
+        char cName[ benchNAME_LENGTH ];
+
+        uxSampleCount = 0U;
+
+        prvCreateScalingTasks( prvDelayTask, uxTasks );
+
+        taskENTER_CRITICAL();
+        {
+            ulTraceMax[ benchTRACE_TICK ] = 0U;
+            ulTraceMax[ benchTRACE_SWITCH ] = 0U;
+            xCollectDelaySamples = pdTRUE;
+        }
+        taskEXIT_CRITICAL();
+
+        ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+        taskENTER_CRITICAL();
+        {
+            xCollectDelaySamples = pdFALSE;
+        }
+        taskEXIT_CRITICAL();
+
+        ( void ) printf( "{\"benchmark\":\"scaling_critical_section\",\"unit\":\"%s\",\"tasks\":%lu,\"tick_max\":%lu,\"switch_max\":%lu}\n",
+                         benchTIMESTAMP_UNIT,
+                         ( unsigned long ) uxTasks,
+                         ( unsigned long ) ulTraceMax[ benchTRACE_TICK ],
+                         ( unsigned long ) ulTraceMax[ benchTRACE_SWITCH ] );
+
+        prvDeleteScalingTasks( uxTasks );
+
+        ( void ) snprintf( cName, sizeof( cName ), "scaling_delay_insert_%lu", ( unsigned long ) uxTasks );
+        prvReportSamples( cName, benchSAMPLES );
+    }
+
+#else /* if ( benchTRACE_HOOKS == 1 ) */
+
+    static void prvScalingDelayedTasks( UBaseType_t uxTasks )
+    {
+        /* Nothing to time without the trace hooks. */
+        ( void ) uxTasks;
+    }
+
+#endif /* if ( benchTRACE_HOOKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+/*
+ * Every task waits on a bit that is never set, so setting another bit scans
+ * all the waiters without unblocking any of them.
+ */
+static void prvEventGroupWaitTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        ( void ) xEventGroupWaitBits( xEventGroup, benchSCALING_WAIT_BIT, pdTRUE, pdFALSE, portMAX_DELAY );
+    }
+}
+
+static void prvScalingEventGroupWaiters( UBaseType_t uxWaiters )
+{
+    UBaseType_t uxSample;
+    uint32_t ulStart;
+    char cName[ benchNAME_LENGTH ];
+
+    xEventGroup = xEventGroupCreate();
+    configASSERT( xEventGroup != NULL );
+
+    prvCreateScalingTasks( prvEventGroupWaitTask, uxWaiters );
+
+    /* Let every waiter block. */
+    vTaskDelay( 2U );
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulStart = benchGET_TIMESTAMP();
+        ( void ) xEventGroupSetBits( xEventGroup, benchSCALING_SET_BIT );
+        ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+        ( void ) xEventGroupClearBits( xEventGroup, benchSCALING_SET_BIT );
+    }
+
+    prvDeleteScalingTasks( uxWaiters );
+    vEventGroupDelete( xEventGroup );
+
+    ( void ) snprintf( cName, sizeof( cName ), "scaling_event_group_set_bits_%lu", ( unsigned long ) uxWaiters );
+    prvReportSamples( cName, benchSAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Start one timer with a later expiry time than uxTimers active timers, so
+ * the timer task walks the whole active timer list to insert it.
+ */
+static void prvScalingTimers( UBaseType_t uxTimers )
+{
+    TimerHandle_t * pxTimers;
+    TimerHandle_t xTimer;
+    UBaseType_t uxTimer;
+    UBaseType_t uxSample;
+    uint32_t ulStart;
+    char cName[ benchNAME_LENGTH ];
+
+    pxTimers = pvPortMalloc( sizeof( TimerHandle_t ) * ( size_t ) uxTimers );
+    configASSERT( pxTimers != NULL );
+
+    for( uxTimer = 0U; uxTimer < uxTimers; uxTimer++ )
+    {
+        pxTimers[ uxTimer ] = xTimerCreate( "scale", ( portMAX_DELAY / 4U ) + ( TickType_t ) uxTimer, pdFALSE, NULL, prvTimerCallback );
+        configASSERT( pxTimers[ uxTimer ] != NULL );
+        ( void ) xTimerStart( pxTimers[ uxTimer ], portMAX_DELAY );
+    }
+
+    xTimer = xTimerCreate( "bench", portMAX_DELAY / 2U, pdFALSE, NULL, prvTimerCallback );
+    configASSERT( xTimer != NULL );
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulStart = benchGET_TIMESTAMP();
+        ( void ) xTimerStart( xTimer, portMAX_DELAY );
+        ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+        ( void ) xTimerStop( xTimer, portMAX_DELAY );
+    }
+
+    ( void ) xTimerDelete( xTimer, portMAX_DELAY );
+
+    for( uxTimer = 0U; uxTimer < uxTimers; uxTimer++ )
+    {
+        ( void ) xTimerDelete( pxTimers[ uxTimer ], portMAX_DELAY );
+    }
+
+    vPortFree( pxTimers );
+
+    ( void ) snprintf( cName, sizeof( cName ), "scaling_timer_start_%lu", ( unsigned long ) uxTimers );
+    prvReportSamples( cName, benchSAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Leave uxBlocks / 2 small free blocks in the heap, then allocate and free a
+ * block larger than any of them.  A first fit allocator walks every free
+ * block to find space for it, and freeing it walks them again to insert it.
+ */
+static void prvScalingHeap( UBaseType_t uxBlocks )
+{
+    static uint32_t ulFreeSamples[ benchSAMPLES ];
+    void ** ppvBlocks;
+    void * pvLarge;
+    UBaseType_t uxBlock;
+    UBaseType_t uxSample;
+    uint32_t ulRandom = 0x12345678U;
+    uint32_t ulStart;
+    char cName[ benchNAME_LENGTH ];
+
+    ppvBlocks = pvPortMalloc( sizeof( void * ) * ( size_t ) uxBlocks );
+    configASSERT( ppvBlocks != NULL );
+
+    for( uxBlock = 0U; uxBlock < uxBlocks; uxBlock++ )
+    {
+        ulRandom = ( ulRandom * 1103515245U ) + 12345U;
+        ppvBlocks[ uxBlock ] = pvPortMalloc( ( size_t ) 8U + ( size_t ) ( ( ulRandom >> 16 ) % 505U ) );
+        configASSERT( ppvBlocks[ uxBlock ] != NULL );
+    }
+
+    for( uxBlock = 0U; uxBlock < uxBlocks; uxBlock += 2U )
+    {
+        vPortFree( ppvBlocks[ uxBlock ] );
+        ppvBlocks[ uxBlock ] = NULL;
+    }
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulStart = benchGET_TIMESTAMP();
+        pvLarge = pvPortMalloc( benchSCALING_LARGE_BLOCK );
+        ulSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+        configASSERT( pvLarge != NULL );
+
+        ulStart = benchGET_TIMESTAMP();
+        vPortFree( pvLarge );
+        ulFreeSamples[ uxSample ] = benchGET_TIMESTAMP() - ulStart;
+    }
+
+    for( uxBlock = 0U; uxBlock < uxBlocks; uxBlock++ )
+    {
+        vPortFree( ppvBlocks[ uxBlock ] );
+    }
+
+    vPortFree( ppvBlocks );
+
+    ( void ) snprintf( cName, sizeof( cName ), "scaling_malloc_%lu", ( unsigned long ) uxBlocks );
+    prvReportSamples( cName, benchSAMPLES );
+
+    for( uxSample = 0U; uxSample < benchSAMPLES; uxSample++ )
+    {
+        ulSamples[ uxSample ] = ulFreeSamples[ uxSample ];
+    }
+
+    ( void ) snprintf( cName, sizeof( cName ), "scaling_free_%lu", ( unsigned long ) uxBlocks );
+    prvReportSamples( cName, benchSAMPLES );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+
+    void vApplicationMallocFailedHook( void )
+    {
+        configASSERT( pdFALSE );
+    }
+
+#endif /* #if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+/*-----------------------------------------------------------*/
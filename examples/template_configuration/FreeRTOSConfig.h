@@ -106,6 +106,74 @@
  * undefined. */
 #define configUSE_TICKLESS_IDLE                    0
 
+/* Set configUSE_TICKLESS_KERNEL to 1 to replace the periodic tick interrupt with
+ * a one-shot timer that the kernel programs to fire at the next time it has
+ * work to do - the next time a task unblocks or, if time slicing is in use and
+ * another task shares the running task's priority, the end of the time slice.
+ * The port must provide portSET_NEXT_TICK_INTERRUPT() and
+ * portGET_TICKS_SINCE_LAST_EVENT(), and its timer interrupt must call
+ * xTaskProcessElapsedTicks().  Cannot be used with configUSE_TICKLESS_IDLE,
+ * configUSE_HARD_TIMERS or on more than one core.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_TICKLESS_KERNEL                  0
+
+/* Set configUSE_HR_TIMEOUTS to 1 to include vTaskDelayUs() and
+ * xQueueReceiveUs(), which take their block times in microseconds and time
+ * them with a high resolution timer instead of the tick.  The port must provide
+ * portGET_HR_TIME() and portSET_HR_ALARM(), and its alarm interrupt must call
+ * xTaskProcessHrAlarmFromISR().  Requires INCLUDE_xTaskAbortDelay to be 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_HR_TIMEOUTS                      0
+
+/* Set configUSE_EDF_SCHEDULING to 1 to include xTaskCreateDeadline(), which
+ * creates periodic tasks that run at priority configEDF_PRIORITY in earliest
+ * deadline first order instead of round robin.  Tasks at other priorities are
+ * scheduled as usual.  Each period is released through the delayed list when
+ * the task calls xTaskWaitForNextPeriod(), and a task that overruns its
+ * per-period budget has its deadline moved back a period.  Only supported
+ * when configNUMBER_OF_CORES is 1, and cannot be used with
+ * configUSE_TICKLESS_KERNEL.  configUSE_EDF_SCHEDULING defaults to 0 and
+ * configEDF_PRIORITY to ( configMAX_PRIORITIES - 1 ) if left undefined. */
+#define configUSE_EDF_SCHEDULING                   0
+#define configEDF_PRIORITY                         ( configMAX_PRIORITIES - 1 )
+
+/* Set configUSE_PERIODIC_TASKS to 1 to include xTaskCreatePeriodic() and
+ * xTaskSetPeriodic(), which release a task every period at a fixed phase.
+ * Tasks waiting for their release are kept in one unsorted list that the tick
+ * only walks when the earliest release is due, instead of being inserted into
+ * the delayed list each period.  The release jitter, overruns and, with
+ * configGENERATE_RUN_TIME_STATS, the execution time of each period are
+ * reported by vTaskGetPeriodicStats().  Defaults to 0 if left undefined. */
+#define configUSE_PERIODIC_TASKS                   0
+
+/* Set configUSE_TASK_BUDGETS to 1 to include vTaskSetBudget(), which limits a
+ * task to a number of ticks of processor time in each period.  The running
+ * task is charged each tick, and a task that uses up its budget is held in the
+ * Blocked state until its next period starts, so a runaway task cannot starve
+ * the tasks below it.  TaskStatus_t then reports how many times each task
+ * overran its budget.  Requires configUSE_PREEMPTION to be 1.  Defaults to 0
+ * if left undefined. */
+#define configUSE_TASK_BUDGETS                     0
+
+/* Set configUSE_TASK_TIME_SLICES to 1 to include vTaskSetTimeSlice(), which
+ * sets how many ticks a task runs for before the next ready task of the same
+ * priority is given the processor.  Tasks start with a time slice of
+ * configDEFAULT_TIME_SLICE_TICKS ticks.  Requires configUSE_PREEMPTION and
+ * configUSE_TIME_SLICING to be 1.  configUSE_TASK_TIME_SLICES defaults to 0
+ * and configDEFAULT_TIME_SLICE_TICKS to 1 if left undefined. */
+#define configUSE_TASK_TIME_SLICES                 0
+#define configDEFAULT_TIME_SLICE_TICKS             1
+
+/* Set configUSE_SLEEP_STATES to 1 to have the idle task choose between the sleep
+ * states registered with vLowPowerRegisterSleepStates() each time it suppresses
+ * the tick.  The idle period is predicted from both the time the next task
+ * unblocks and how early interrupts ended the last
+ * configSLEEP_STATE_HISTORY_LENGTH idle periods, and the deepest state whose
+ * latencies and target residency fit within the prediction is entered.
+ * Requires configUSE_TICKLESS_IDLE to be other than 0.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_SLEEP_STATES                     0
+
 /* configMAX_PRIORITIES Sets the number of available task priorities.  Tasks can
  * be assigned priorities of 0 to (configMAX_PRIORITIES - 1).  Zero is the
  * lowest priority. */
@@ -138,23 +206,122 @@
  * TickType_t to be defined (typedef'ed) as an unsigned 64-bit type. */
 #define configTICK_TYPE_WIDTH_IN_BITS              TICK_TYPE_WIDTH_64_BITS
 
+/* Set configUSE_NON_WRAPPING_TICK_COUNT to 1 to treat the tick count as never
+ * wrapping, which a 64-bit tick count does not do within the life of any
+ * system.  The kernel then no longer checks for the tick count wrapping in
+ * the tick interrupt, never switches the delayed task lists, and clamps wake
+ * times that would be beyond the range of the tick count to portMAX_DELAY.
+ * Requires configTICK_TYPE_WIDTH_IN_BITS to be TICK_TYPE_WIDTH_64_BITS.
+ * Defaults to 0 if left undefined. */
+#define configUSE_NON_WRAPPING_TICK_COUNT          0
+
+/* Set configUSE_TICK_COUNT_SEQLOCK to 1 to have xTaskGetTickCount() read the
+ * tick count without a critical section when the tick count cannot be read
+ * atomically, such as a 64-bit tick count on a 32-bit processor.  Writes to the
+ * tick count are bracketed by a sequence counter, and xTaskGetTickCount()
+ * reads again if the counter shows a write happened during the read.  On
+ * multi-core ports that reorder memory accesses portMEMORY_BARRIER() must be
+ * defined.  Defaults to 0 if left undefined. */
+#define configUSE_TICK_COUNT_SEQLOCK               0
+
+/* configDELAYED_LIST_IMPLEMENTATION selects how Blocked state tasks that are
+ * waiting for a timeout are held:
+ *
+ * Defining configDELAYED_LIST_IMPLEMENTATION as DELAYED_LIST_SORTED holds them
+ * in a list sorted by wake time, which costs O(n) per insertion.
+ *
+ * Defining configDELAYED_LIST_IMPLEMENTATION as DELAYED_LIST_TIMING_WHEEL
+ * holds them in a two level timing wheel of configDELAYED_WHEEL_SLOTS slots
+ * per level, giving O(1) insertion for timeouts shorter than
+ * configDELAYED_WHEEL_SLOTS squared ticks at the cost of
+ * ( 2 * configDELAYED_WHEEL_SLOTS ) extra lists.  Longer timeouts fall back to
+ * the sorted list.  configDELAYED_WHEEL_SLOTS must be a power of two.
+ *
+ * Defining configDELAYED_LIST_IMPLEMENTATION as DELAYED_LIST_SKIP_LIST keeps
+ * the sorted list but also makes it a skip list (see configUSE_SKIP_LISTS),
+ * giving O(log n) insertion for any timeout.
+ *
+ * Defaults to DELAYED_LIST_SORTED if left undefined. */
+#define configDELAYED_LIST_IMPLEMENTATION          DELAYED_LIST_SORTED
+#define configDELAYED_WHEEL_SLOTS                  64
+
 /* Set configIDLE_SHOULD_YIELD to 1 to have the Idle task yield to an
  * application task if there is an Idle priority (priority 0) application task
  * that can run.  Set to 0 to have the Idle task use all of its timeslice.
  * Default to 1 if left undefined. */
 #define configIDLE_SHOULD_YIELD                    1
 
+/* Tasks that delete themselves, or are deleted while running on another core,
+ * are freed later by the Idle task.  Set configIDLE_TASK_CLEANUP_BUDGET to the
+ * most such tasks the Idle task frees on each pass through its loop, so that
+ * freeing a burst of deleted tasks is spread out, with the Idle task yielding
+ * and running its hook in between.  Set to 0 to free all of them at once.
+ * Defaults to 0 if left undefined. */
+#define configIDLE_TASK_CLEANUP_BUDGET             0
+
+/* Set configUSE_IDLE_WORK_QUEUE to 1 to include xIdleWorkSubmit(), which
+ * queues a function call for the Idle task to make when the core has nothing
+ * else to do, before it considers entering a low power mode.  Each core has its
+ * own queue of configIDLE_WORK_QUEUE_LENGTH calls.  Not supported by the MPU
+ * ports.  configUSE_IDLE_WORK_QUEUE defaults to 0, and
+ * configIDLE_WORK_QUEUE_LENGTH to 8, if left undefined. */
+#define configUSE_IDLE_WORK_QUEUE                  0
+#define configIDLE_WORK_QUEUE_LENGTH               8
+
 /* Each task has an array of task notifications.
  * configTASK_NOTIFICATION_ARRAY_ENTRIES sets the number of indexes in the
  * array. See https://www.freertos.org/RTOS-task-notifications.html  Defaults to
  * 1 if left undefined. */
 #define configTASK_NOTIFICATION_ARRAY_ENTRIES      1
 
+/* Set configUSE_PER_TASK_NOTIFICATION_ENTRIES to 1 to include
+ * xTaskCreateWithNotificationEntries(), which creates a task with more
+ * notification indexes than configTASK_NOTIFICATION_ARRAY_ENTRIES.  The extra
+ * indexes are allocated outside of the task's TCB, so
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES can be left at the number most tasks
+ * need.  Not supported by the MPU ports.  Defaults to 0 if left undefined. */
+#define configUSE_PER_TASK_NOTIFICATION_ENTRIES    0
+
+/* Set configTASK_NOTIFY_MAILBOX_DEPTH to a non-zero value to give each task a
+ * mailbox of that many pointer sized messages, sent with
+ * xTaskNotifySendMessage() and received with xTaskNotifyReceiveMessage().  The
+ * messages are counted by the task notification at index
+ * configTASK_NOTIFY_MAILBOX_INDEX, which defaults to the last index and must
+ * not be used for other notifications.  Not supported by the MPU ports.
+ * Defaults to 0 if left undefined. */
+#define configTASK_NOTIFY_MAILBOX_DEPTH            0
+
+/* Set configUSE_TASK_GROUPS to 1 to include task groups, which let
+ * xTaskGroupNotify() send the same notification to every task in a group in a
+ * single critical section, with one decision on whether to yield.  Not
+ * supported by the MPU ports.  Defaults to 0 if left undefined. */
+#define configUSE_TASK_GROUPS                      0
+
 /* configQUEUE_REGISTRY_SIZE sets the maximum number of queues and semaphores
  * that can be referenced from the queue registry.  Only required when using a
  * kernel aware debugger.  Defaults to 0 if left undefined. */
 #define configQUEUE_REGISTRY_SIZE                  0
 
+/* Set configUSE_QUEUE_REGISTRY_INDEX to 1 to hash the queue registry by handle
+ * and by name, so looking a queue up with pcQueueGetName() or
+ * xQueueGetHandleByName() does not search the whole registry.
+ * configQUEUE_REGISTRY_INDEX_BUCKETS sets the number of hash buckets, and
+ * defaults to configQUEUE_REGISTRY_SIZE.  Requires configQUEUE_REGISTRY_SIZE to
+ * be greater than 0.  Defaults to 0 if left undefined. */
+#define configUSE_QUEUE_REGISTRY_INDEX             0
+#define configQUEUE_REGISTRY_INDEX_BUCKETS         configQUEUE_REGISTRY_SIZE
+
+/* Set configUSE_TASK_NAME_INDEX to 1 to hash the tasks by name, so
+ * xTaskGetHandle() compares only the tasks whose names share a hash bucket,
+ * in a short critical section, rather than searching every task list with the
+ * scheduler suspended.  Tasks are removed from the index when they are
+ * deleted, so xTaskGetHandle() no longer finds a deleted task whose memory has
+ * not yet been freed.  configTASK_NAME_INDEX_BUCKETS sets the number of hash
+ * buckets, and defaults to 16.  Requires INCLUDE_xTaskGetHandle to be 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_TASK_NAME_INDEX                  0
+#define configTASK_NAME_INDEX_BUCKETS              16
+
 /* Set configENABLE_BACKWARD_COMPATIBILITY to 1 to map function names and
  * datatypes from old version of FreeRTOS to their latest equivalent.  Defaults
  * to 1 if left undefined. */
@@ -174,6 +341,31 @@
  * optimization. Defaults to 1 if left undefined. */
 #define configUSE_MINI_LIST_ITEM                   1
 
+/* configEVENT_LIST_IMPLEMENTATION selects how queues, semaphores and mutexes
+ * hold the tasks blocked on them, which are kept in priority order.  Defining
+ * it as EVENT_LIST_SORTED uses a sorted list.  Defining it as
+ * EVENT_LIST_SKIP_LIST makes those lists skip lists (see configUSE_SKIP_LISTS),
+ * which only pays off when many tasks of different priorities block on the
+ * same object.  Defaults to EVENT_LIST_SORTED if left undefined. */
+#define configEVENT_LIST_IMPLEMENTATION            EVENT_LIST_SORTED
+
+/* A skip list is a sorted list in which some of the items are also linked
+ * into up to configSKIP_LIST_LANES sparser sorted lists, or lanes, that let an
+ * insertion skip over most of the items, so vListInsert() takes O(log n) rather
+ * than O(n) steps.  The lists themselves are unchanged, so everything else
+ * about them costs the same.  Setting configUSE_SKIP_LISTS to 1 adds
+ * ( 2 * configSKIP_LIST_LANES ) + 1 words to every ListItem_t and
+ * configSKIP_LIST_LANES + 2 words to every List_t, and makes
+ * vListInitialiseSkipList() available.  Each lane holds about a quarter of the
+ * items of the lane below it, so 4 lanes suit lists of up to around a thousand
+ * items.  configUSE_SKIP_LISTS defaults to 1 if any of
+ * configDELAYED_LIST_IMPLEMENTATION, configTIMER_LIST_IMPLEMENTATION or
+ * configEVENT_LIST_IMPLEMENTATION selects a skip list, and to 0 otherwise.
+ * configSKIP_LIST_LANES must be between 1 and 8, and defaults to 4 if left
+ * undefined. */
+#define configUSE_SKIP_LISTS                       0
+#define configSKIP_LIST_LANES                      4
+
 /* Sets the type used by the parameter to xTaskCreate() that specifies the stack
  * size of the task being created.  The same type is used to return information
  * about stack usage in various other API calls.  Defaults to size_t if left
@@ -187,6 +379,28 @@
  * uint8_t. */
 #define configMESSAGE_BUFFER_LENGTH_TYPE           size_t
 
+/* Set configUSE_MESSAGE_BUFFER_VARINT_LENGTHS to 1 to store the length of each
+ * message written to a message buffer as a varint, so a message of up to 127
+ * bytes costs one byte of length, one of up to 16383 bytes costs two, and so
+ * on up to the largest size_t.  configMESSAGE_BUFFER_LENGTH_TYPE is then not
+ * used.  Defaults to 0 if left undefined. */
+#define configUSE_MESSAGE_BUFFER_VARINT_LENGTHS    0
+
+/* Set configUSE_MESSAGE_BUFFER_BATCH_RECEIVE to 1 to include
+ * xMessageBufferReceiveBatch(), which reads as many whole messages as fit in
+ * the caller's buffer and notifies a waiting writer once for the whole batch.
+ * Defaults to 0 if left undefined. */
+#define configUSE_MESSAGE_BUFFER_BATCH_RECEIVE    0
+
+/* Set configUSE_MULTI_PRODUCER_STREAM_BUFFERS to 1 to include
+ * xStreamBufferCreateMultiProducer() and xMessageBufferCreateMultiProducer(),
+ * which create buffers that several tasks and interrupts can write to at once
+ * without masking interrupts.  Writers reserve space with a compare and swap,
+ * so the port must define portATOMIC_COMPARE_AND_SWAP_U32, or
+ * configUSE_COMPILER_ATOMICS must be set to 1.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_MULTI_PRODUCER_STREAM_BUFFERS    0
+
 /* If configHEAP_CLEAR_MEMORY_ON_FREE is set to 1, then blocks of memory
  * allocated using pvPortMalloc() will be cleared (i.e. set to zero) when freed
  * using vPortFree(). Defaults to 0 if left undefined. */
@@ -220,27 +434,95 @@
  * FreeRTOS/source/timers.c source file must be included in the build if
  * configUSE_TIMERS is set to 1.  Default to 0 if left undefined.  See
  * https://www.freertos.org/RTOS-software-timer.html. */
-#define configUSE_TIMERS                1
+#define configUSE_TIMERS                   1
+
+/* configTIMER_LIST_IMPLEMENTATION selects how the timer task holds active
+ * timers:
+ *
+ * Defining configTIMER_LIST_IMPLEMENTATION as TIMER_LIST_SORTED holds them in
+ * a list sorted by expiry time, which costs O(n) each time a timer is started
+ * or reset.
+ *
+ * Defining configTIMER_LIST_IMPLEMENTATION as TIMER_LIST_TIMING_WHEEL hashes
+ * them by expiry time into configTIMER_WHEEL_SLOTS lists, so starting or
+ * resetting a timer only walks the timers that share its list.
+ * configTIMER_WHEEL_SLOTS must be a power of two.
+ *
+ * Defining configTIMER_LIST_IMPLEMENTATION as TIMER_LIST_SKIP_LIST keeps the
+ * sorted list but also makes it a skip list (see configUSE_SKIP_LISTS), so
+ * starting or resetting a timer costs O(log n).
+ *
+ * Defaults to TIMER_LIST_SORTED if left undefined. */
+#define configTIMER_LIST_IMPLEMENTATION    TIMER_LIST_SORTED
+#define configTIMER_WHEEL_SLOTS            64
+
+/* Set configUSE_TIMER_DIRECT_RESET to 1 to include xTimerResetDirect(), which
+ * resets an already active timer without sending a command to the timer task.
+ * Defaults to 0 if left undefined. */
+#define configUSE_TIMER_DIRECT_RESET       0
+
+/* Set configUSE_TIMER_GROUPS to 1 to include xTimerGroupStart(),
+ * xTimerGroupReset(), xTimerGroupStop() and xTimerGroupChangePeriod(), which
+ * act on a group of timers with a single command to the timer task.  Defaults
+ * to 0 if left undefined. */
+#define configUSE_TIMER_GROUPS             0
+
+/* Set configUSE_TIMER_SLACK to 1 to include vTimerSetSlack(), which lets a
+ * timer expire up to the given number of ticks late so the timer task can
+ * process it in the same batch as other timers.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_TIMER_SLACK              0
 
 /* configTIMER_TASK_PRIORITY sets the priority used by the timer task.  Only
  * used if configUSE_TIMERS is set to 1.  The timer task is a standard FreeRTOS
  * task, so its priority is set like any other task.  See
  * https://www.freertos.org/RTOS-software-timer-service-daemon-task.html  Only
  * used if configUSE_TIMERS is set to 1. */
-#define configTIMER_TASK_PRIORITY       ( configMAX_PRIORITIES - 1 )
+#define configTIMER_TASK_PRIORITY          ( configMAX_PRIORITIES - 1 )
 
 /* configTIMER_TASK_STACK_DEPTH sets the size of the stack allocated to the
  * timer task (in words, not in bytes!).  The timer task is a standard FreeRTOS
  * task.  See
  * https://www.freertos.org/RTOS-software-timer-service-daemon-task.html Only
  * used if configUSE_TIMERS is set to 1. */
-#define configTIMER_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#define configTIMER_TASK_STACK_DEPTH       configMINIMAL_STACK_SIZE
 
 /* configTIMER_QUEUE_LENGTH sets the length of the queue (the number of discrete
  * items the queue can hold) used to send commands to the timer task.  See
  * https://www.freertos.org/RTOS-software-timer-service-daemon-task.html  Only
  * used if configUSE_TIMERS is set to 1. */
-#define configTIMER_QUEUE_LENGTH        10
+#define configTIMER_QUEUE_LENGTH           10
+
+/* configTIMER_SERVICE_TASKS sets the number of timer service tasks.  Each has
+ * its own command queue of configTIMER_QUEUE_LENGTH items and calls the
+ * callbacks of the timers assigned to it with vTimerSetServiceTask(), so a slow
+ * callback only delays the timers that share its service task.
+ * xTimerPendFunctionCall() pends functions to service task 0, while
+ * xTimerPendFunctionCallToServiceTask() selects the service task, and so the
+ * priority at which the function executes.  Defaults to 1 if left undefined.
+ *
+ * configTIMER_SERVICE_TASK_PRIORITIES can be defined as an array initialiser
+ * holding the priority of each service task, for example { 2, 5 }.  All the
+ * service tasks use configTIMER_TASK_PRIORITY if it is left undefined.
+ *
+ * When using SMP with core affinity, configTIMER_SERVICE_TASK_CORE_AFFINITIES
+ * can likewise be defined as an array initialiser holding the core affinity
+ * mask of each service task.
+ *
+ * Set configTIMER_SERVICE_TASK_PER_CORE to 1 to assign new timers to the
+ * service task whose index is the number of the core creating them, modulo
+ * configTIMER_SERVICE_TASKS.  Unless configTIMER_SERVICE_TASK_CORE_AFFINITIES
+ * is defined, service task n is then also pinned to core n modulo
+ * configNUMBER_OF_CORES.  Defaults to 0 if left undefined. */
+#define configTIMER_SERVICE_TASKS            1
+#define configTIMER_SERVICE_TASK_PER_CORE    0
+
+/* Set configUSE_HARD_TIMERS to 1 to include vTimerSetHardMode(), which makes a
+ * timer a hard timer.  The callbacks of hard timers are called from the tick
+ * interrupt, so can only use the "FromISR" API functions, but run on the tick
+ * the timer expires without waiting for the timer service task.  Defaults to
+ * 0 if left undefined. */
+#define configUSE_HARD_TIMERS                0
 
 /******************************************************************************/
 /* Event Group related definitions. *******************************************/
@@ -253,6 +535,30 @@
 
 #define configUSE_EVENT_GROUPS    1
 
+/* Set configUSE_EVENT_GROUP_WAKE_ONE to 1 to include
+ * xEventGroupSetBitsWakeOne(), which unblocks no more than one waiting task for
+ * each bit set.  It also lets setting bits that no task is waiting for skip the
+ * search of the waiting tasks.  Defaults to 0 if left undefined. */
+#define configUSE_EVENT_GROUP_WAKE_ONE    0
+
+/* Set configUSE_64_BIT_EVENT_GROUPS to 1 to make EventBits_t 64 bits wide,
+ * whatever the width of TickType_t, with all 64 bits available to the
+ * application.  The bits a blocked task is waiting for are then held in its
+ * TCB rather than its event list item, which holds only the control bits.
+ * Setting or clearing bits from an interrupt through the timer daemon task is
+ * limited to bits 0 to 31.  Not supported with the MPU wrappers.  Defaults to
+ * 0 if left undefined. */
+#define configUSE_64_BIT_EVENT_GROUPS     0
+
+/* Set configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR to 1 to have
+ * xEventGroupSetBitsFromISR() set the bits and unblock waiting tasks directly
+ * from the interrupt, instead of always deferring to the timer daemon task.
+ * configEVENT_GROUP_SET_BITS_FROM_ISR_MAX_TESTS limits the number of waiting
+ * tasks tested in the interrupt, with the rest left to the timer daemon task.
+ * Defaults to 0 if left undefined. */
+#define configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR        0
+#define configEVENT_GROUP_SET_BITS_FROM_ISR_MAX_TESTS    4
+
 /******************************************************************************/
 /* Stream Buffer related definitions. *****************************************/
 /******************************************************************************/
@@ -262,7 +568,82 @@
  * FreeRTOS/source/stream_buffer.c source file must be included in the build if
  * configUSE_STREAM_BUFFERS is set to 1. Defaults to 1 if left undefined. */
 
-#define configUSE_STREAM_BUFFERS    1
+#define configUSE_STREAM_BUFFERS              1
+
+/* Set configUSE_ZERO_COPY_STREAM_BUFFERS to 1 to include
+ * xStreamBufferGetWriteRegion(), xStreamBufferCommitWrite(),
+ * xStreamBufferGetReadRegion() and xStreamBufferConsume(), which let a stream
+ * buffer's writer and reader, such as a DMA engine, access its storage area in
+ * place.  Defaults to 0 if left undefined. */
+#define configUSE_ZERO_COPY_STREAM_BUFFERS    0
+
+/* Set configUSE_STREAM_BUFFER_SEGMENTS to 1 to include xStreamBufferSendV(),
+ * xStreamBufferReceiveV(), xMessageBufferSendV(), xMessageBufferReceiveV() and
+ * their FromISR versions, which send from, or receive into, a list of separate
+ * buffers.  Defaults to 0 if left undefined. */
+#define configUSE_STREAM_BUFFER_SEGMENTS      0
+
+/* Set configUSE_BROADCAST_STREAM_BUFFERS to 1 to include
+ * xStreamBufferCreateBroadcast() and xStreamBufferReceiveBroadcast(), which
+ * create and read a stream buffer that has several readers, each with its own
+ * read position, so the same data can be read by every reader without being
+ * copied into a buffer per reader.  Defaults to 0 if left undefined. */
+#define configUSE_BROADCAST_STREAM_BUFFERS    0
+
+/* Set configUSE_STREAM_BUFFER_PIPELINES to 1 to include
+ * xStreamBufferCreatePipeline(), xStreamBufferGetStageRegion() and
+ * xStreamBufferCommitStage(), which let a chain of processing stages work on
+ * the data in a stream buffer in place, each handing its output to the next
+ * stage and finally to the reader, instead of copying it through a stream
+ * buffer per stage.  Defaults to 0 if left undefined. */
+#define configUSE_STREAM_BUFFER_PIPELINES     0
+
+/* Set configUSE_ALIGNED_STREAM_BUFFERS to 1 to include
+ * xStreamBufferCreateAligned() and xMessageBufferCreateAligned(), which create
+ * stream and message buffers whose storage area is aligned to, and a multiple
+ * of, configSTREAM_BUFFER_STORAGE_ALIGNMENT bytes.  Set
+ * configSTREAM_BUFFER_STORAGE_ALIGNMENT to the data cache line size, for
+ * example 32 on a Cortex-M7 or 64 on most AArch64 parts, to use the storage
+ * area as a DMA buffer.  configSTREAM_BUFFER_STORAGE_ALIGNMENT must be a power
+ * of two and a multiple of portBYTE_ALIGNMENT, and defaults to
+ * portBYTE_ALIGNMENT.  configUSE_ALIGNED_STREAM_BUFFERS defaults to 0 if left
+ * undefined. */
+#define configUSE_ALIGNED_STREAM_BUFFERS         0
+#define configSTREAM_BUFFER_STORAGE_ALIGNMENT    32
+
+/* Set configUSE_STREAM_BUFFER_CACHE_MAINTENANCE to 1 to have stream and message
+ * buffers clean the data cache lines holding the bytes they copy into the
+ * storage area, and invalidate those holding the bytes they copy out, so the
+ * storage area can be shared with a DMA controller or another core.  Only the
+ * bytes copied are maintained, not the whole buffer.  The port must define
+ * portCLEAN_DCACHE_RANGE() and portINVALIDATE_DCACHE_RANGE() - the GCC
+ * Cortex-M7 port does.  Use with configUSE_ALIGNED_STREAM_BUFFERS so the
+ * storage area does not share a cache line with other data.  Defaults to 0 if
+ * left undefined. */
+#define configUSE_STREAM_BUFFER_CACHE_MAINTENANCE    0
+
+/* Set configUSE_STREAM_BUFFER_MAX_LATENCY to 1 to include
+ * xStreamBufferSetMaxLatency(), which unblocks a reader waiting for a stream
+ * buffer's trigger level once the first byte written has waited a set number
+ * of ticks.  Defaults to 0 if left undefined. */
+#define configUSE_STREAM_BUFFER_MAX_LATENCY     0
+
+/* Set configUSE_STREAM_BUFFER_WATERMARKS to 1 to include
+ * xStreamBufferSetWatermarks(), which calls a function when the number of bytes
+ * held in a stream or message buffer rises to a high watermark and again when
+ * it falls back to a low watermark, so a driver can assert and release
+ * hardware flow control before the buffer is full.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_STREAM_BUFFER_WATERMARKS     0
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configSTREAM_BUFFER_SPIN_ITERATIONS to a non-zero value to have a task that
+ * would block in xStreamBufferSend() or xStreamBufferReceive() poll the stream
+ * buffer up to that many times first.  When the other end of the stream buffer
+ * runs on another core this often finds the space or data without blocking,
+ * avoiding the notification and the context switches.  Defaults to 0, which
+ * always blocks straight away, if left undefined. */
+#define configSTREAM_BUFFER_SPIN_ITERATIONS    0
 
 /******************************************************************************/
 /* Memory allocation related definitions. *************************************/
@@ -303,10 +684,364 @@
 #define configSTACK_ALLOCATION_FROM_SEPARATE_HEAP    0
 
 /* Set configENABLE_HEAP_PROTECTOR to 1 to enable bounds checking and
- * obfuscation to internal heap block pointers in heap_4.c and heap_5.c to help
- * catch pointer corruptions. Defaults to 0 if left undefined. */
+ * obfuscation to internal heap block pointers in heap_4.c, heap_5.c and
+ * heap_6.c to help catch pointer corruptions. Defaults to 0 if left
+ * undefined. */
 #define configENABLE_HEAP_PROTECTOR                  0
 
+/* Set configUSE_PER_CORE_HEAP_ARENAS to 1 to have heap_5.c give each core its
+ * own arena, so cores allocate in parallel instead of suspending the scheduler.
+ * The first heap region belongs to core 0, the second to core 1, and so on,
+ * with any remaining regions added to the last core's arena.  A core that
+ * frees a block from another core's arena hands it back by compare and swap,
+ * and the owning arena reclaims it on its next allocation.  Requires
+ * configNUMBER_OF_CORES greater than 1, configUSE_GRANULAR_LOCKS and
+ * portATOMIC_COMPARE_AND_SWAP_U32.  Defaults to 0 if left undefined. */
+#define configUSE_PER_CORE_HEAP_ARENAS               0
+
+/* Set configUSE_TASK_ALLOCATION_CACHE to 1 to have heap_4.c hold blocks of up
+ * to 128 bytes that a task frees in a cache in the task's TCB, from which the
+ * task's next allocations of the same size class are taken without suspending
+ * the scheduler.  Requests are rounded up to 16, 32, 64 or 128 bytes, and up to
+ * configTASK_ALLOCATION_CACHE_DEPTH blocks of each size are cached per task
+ * until the task is deleted.  Cached blocks are reported as allocated by
+ * xPortGetFreeHeapSize().  Only heap_4.c provides the cache.
+ * configUSE_TASK_ALLOCATION_CACHE defaults to 0 and
+ * configTASK_ALLOCATION_CACHE_DEPTH to 4 if left undefined. */
+#define configUSE_TASK_ALLOCATION_CACHE              0
+#define configTASK_ALLOCATION_CACHE_DEPTH            4
+
+/* Set configUSE_HEAP_PROFILER to 1 to have heap_4.c record the task that
+ * allocated each block and the call site it was allocated from.
+ * uxPortGetHeapTaskUsage() then reports the current and peak bytes held by up to
+ * configHEAP_PROFILER_MAX_TASKS tasks, with any further tasks and the
+ * allocations made before the scheduler started sharing one more entry, and
+ * uxPortGetHeapBlockMap() reports every free and allocated block in address
+ * order.  Each block header grows by two words while the profiler is used.
+ * Define configHEAP_PROFILER_CALLER_ADDRESS() to return the caller of
+ * pvPortMalloc(), for example __builtin_return_address( 0 ) on GCC, to record
+ * call sites.  Only heap_4.c provides the profiler.  configUSE_HEAP_PROFILER
+ * defaults to 0, configHEAP_PROFILER_MAX_TASKS to 8 and
+ * configHEAP_PROFILER_CALLER_ADDRESS() to NULL if left undefined. */
+#define configUSE_HEAP_PROFILER                      0
+#define configHEAP_PROFILER_MAX_TASKS                8
+
+/* Set configUSE_TASK_HEAP_QUOTAS to 1 to have heap_4.c charge each block it
+ * allocates once the scheduler has started to the task that allocated it, until
+ * the block is freed.  vTaskSetHeapQuota() then limits the heap a task can hold,
+ * so one task cannot exhaust the heap the others need, and xTaskGetHeapUsage()
+ * reports what a task holds.  An allocation that would take a task over its
+ * quota fails, and calls vApplicationHeapQuotaExceededHook() if
+ * configUSE_HEAP_QUOTA_EXCEEDED_HOOK is 1.  Each block header grows by one word.
+ * Only heap_4.c provides quotas.  Both default to 0 if left undefined. */
+#define configUSE_TASK_HEAP_QUOTAS                   0
+#define configUSE_HEAP_QUOTA_EXCEEDED_HOOK           0
+
+/* configHEAP_ALLOCATION_POLICY selects how heap_4.c and heap_5.c choose a free
+ * block:
+ *
+ * HEAP_POLICY_FIRST_FIT: Take the lowest addressed block that is large enough.
+ * HEAP_POLICY_BEST_FIT:  Take the smallest block that is large enough, which
+ *                        searches the whole list of free blocks unless one fits
+ *                        exactly but leaves large blocks intact for longer.
+ * HEAP_POLICY_NEXT_FIT:  Take the first block that is large enough after the
+ *                        block from which the last allocation was made,
+ *                        wrapping around to the lowest address.
+ *
+ * vPortGetHeapStats() reports the largest free block and the number of free
+ * blocks with which the policies can be compared.  Defaults to
+ * HEAP_POLICY_FIRST_FIT if left undefined. */
+#define configHEAP_ALLOCATION_POLICY                 HEAP_POLICY_FIRST_FIT
+
+/* Set configHEAP_2_USE_SIZE_BINS to 1 to have heap_2.c hold free blocks smaller
+ * than configHEAP_2_SIZE_BINS * portBYTE_ALIGNMENT bytes in one bin per size,
+ * with a bitmap of the bins that hold blocks, instead of in its list of free
+ * blocks sorted by size.  Freeing such a block, and allocating one when a block
+ * of exactly the rounded up size is free, then take constant time, which
+ * suits applications that repeatedly allocate and free blocks of a few fixed
+ * sizes.  Adjacent free blocks are still never combined.  Defaults to 0, and
+ * configHEAP_2_SIZE_BINS to 32, if left undefined. */
+#define configHEAP_2_USE_SIZE_BINS                   0
+#define configHEAP_2_SIZE_BINS                       32
+
+/* Set configSUPPORT_HEAP_REALLOC to 1 to include pvPortRealloc(), which resizes
+ * a block in place when it is shrunk or when the block after it is free, and
+ * otherwise moves it.  Set configSUPPORT_HEAP_ALIGNED_ALLOCATION to 1 to include
+ * pvPortMallocAligned(), which returns the memory in front of the aligned
+ * address to the heap as a free block.  Only heap_4.c and heap_5.c provide
+ * these functions.  Both default to 0 if left undefined. */
+#define configSUPPORT_HEAP_REALLOC                   0
+#define configSUPPORT_HEAP_ALIGNED_ALLOCATION        0
+
+/* heap_3.c normally suspends the scheduler around each call to malloc() and
+ * free().  When the C library already serialises its allocator through
+ * __malloc_lock() and __malloc_unlock(), as newlib does, set
+ * configHEAP_3_USE_LIBC_MALLOC_LOCK to 1 to have heap_3.c implement those
+ * hooks with a recursive light mutex and stop suspending the scheduler, so
+ * tasks that do not use the heap keep being scheduled while another task
+ * allocates.  Requires configUSE_LIGHT_MUTEXES and configUSE_RECURSIVE_MUTEXES
+ * to be 1 and light_mutex.c to be built.  The allocator must then not be used
+ * by a task while the scheduler is suspended if another task could be part way
+ * through an allocation.  Defaults to 0 if left undefined. */
+#define configHEAP_3_USE_LIBC_MALLOC_LOCK            0
+
+/* Set configUSE_HEAP_COMPACTION to 1 to include xPortMallocMovable(), which
+ * returns a handle to a block that heap_4.c may move.  The block's address is
+ * obtained with pvPortLockMovable(), which stops it moving until
+ * vPortUnlockMovable() is called.  The idle task moves up to
+ * configHEAP_COMPACTION_IDLE_BYTES bytes of unlocked movable blocks towards the
+ * start of the heap on each pass of its loop, so free space between them
+ * merges into larger blocks and large allocations keep succeeding in a long
+ * running system.  Set configHEAP_COMPACTION_IDLE_BYTES to 0 to call
+ * xPortCompactHeap() from the application instead.  configHEAP_MOVABLE_BLOCKS
+ * sets how many movable blocks can exist at once.  Only heap_4.c supports
+ * movable blocks.  configUSE_HEAP_COMPACTION defaults to 0,
+ * configHEAP_MOVABLE_BLOCKS to 8 and configHEAP_COMPACTION_IDLE_BYTES to 256
+ * if left undefined. */
+#define configUSE_HEAP_COMPACTION                    0
+#define configHEAP_MOVABLE_BLOCKS                    8
+#define configHEAP_COMPACTION_IDLE_BYTES             256
+
+/* Set configUSE_HEAP_REGION_CAPABILITIES to 1 to give each HeapRegion_t passed
+ * to vPortDefineHeapRegions() an ulCapabilities member holding portHEAP_CAPS_*
+ * bits, such as portHEAP_CAPS_FAST for tightly coupled memory or
+ * portHEAP_CAPS_DMA for memory DMA controllers can reach.  pvPortMallocCaps()
+ * then only allocates from regions that have all the requested capabilities,
+ * and task stacks and TCBs are allocated from regions with
+ * configTASK_STACK_HEAP_CAPABILITIES and configTASK_TCB_HEAP_CAPABILITIES
+ * respectively.  The capabilities of up to configHEAP_MAX_REGIONS regions are
+ * recorded.  Only heap_5.c supports region capabilities.
+ * configUSE_HEAP_REGION_CAPABILITIES defaults to 0, configHEAP_MAX_REGIONS to 8,
+ * and the task capabilities to portHEAP_CAPS_NONE, which allows any region, if
+ * left undefined. */
+#define configUSE_HEAP_REGION_CAPABILITIES           0
+#define configHEAP_MAX_REGIONS                       8
+#define configTASK_STACK_HEAP_CAPABILITIES           portHEAP_CAPS_NONE
+#define configTASK_TCB_HEAP_CAPABILITIES             portHEAP_CAPS_NONE
+
+/* Set configUSE_HEAP_STARTUP_MODE to 1 to have heap_4.c and heap_5.c skip
+ * suspending the scheduler for allocations and frees made before the scheduler
+ * starts, when nothing can preempt them, which shortens system start up when
+ * many objects are created.  heap_5.c only does so when
+ * configUSE_PER_CORE_HEAP_ARENAS is 0.  heap_1.c always protects its
+ * allocations with a short critical section instead of suspending the
+ * scheduler.  Defaults to 0 if left undefined. */
+#define configUSE_HEAP_STARTUP_MODE                  0
+
+/* Set configUSE_OBJECT_POOLS to 1 to include the fixed size object pool
+ * functionality in the build, which allocates and frees equally sized items in
+ * constant time.  Set configKERNEL_OBJECT_POOLS to 1 as well to have
+ * dynamically created tasks, timers, event groups and queues without a storage
+ * area (semaphores and mutexes) allocated from object pools that hold the
+ * number of objects set by configKERNEL_TASK_POOL_LENGTH,
+ * configKERNEL_TIMER_POOL_LENGTH, configKERNEL_EVENT_GROUP_POOL_LENGTH and
+ * configKERNEL_QUEUE_POOL_LENGTH respectively, falling back to the heap once
+ * a pool is exhausted.  Both default to 0 if left undefined. */
+#define configUSE_OBJECT_POOLS                       0
+#define configKERNEL_OBJECT_POOLS                    0
+#define configKERNEL_TASK_POOL_LENGTH                8
+#define configKERNEL_QUEUE_POOL_LENGTH               8
+#define configKERNEL_TIMER_POOL_LENGTH               8
+#define configKERNEL_EVENT_GROUP_POOL_LENGTH         8
+
+/* Set configUSE_LOCK_FREE_POOLS to 1 to have object pools allocate and free
+ * items with compare and swap operations instead of critical sections, so
+ * allocating from an interrupt never masks interrupts.  A lock free pool holds
+ * at most 65534 items.  Requires configUSE_OBJECT_POOLS to be 1, and the port
+ * to define portATOMIC_COMPARE_AND_SWAP_U32 if configNUMBER_OF_CORES is
+ * greater than 1.  Defaults to 0 if left undefined. */
+#define configUSE_LOCK_FREE_POOLS                    0
+
+/* Set configUSE_ISR_HEAP to 1 to include pvPortMallocFromISR() and
+ * vPortFreeFromISR(), which allocate variable sized blocks from interrupts by
+ * taking an item from the smallest of up to configISR_HEAP_MAX_POOLS object
+ * pools, added with xPortISRHeapAddPool(), whose items are large enough.
+ * Requires configUSE_OBJECT_POOLS to be 1.  configUSE_ISR_HEAP defaults to 0
+ * and configISR_HEAP_MAX_POOLS to 4 if left undefined. */
+#define configUSE_ISR_HEAP                           0
+#define configISR_HEAP_MAX_POOLS                     4
+
+/* Set configUSE_LIGHT_MUTEXES to 1 to include the light mutex functionality in
+ * the build.  A light mutex is a few words of application provided memory
+ * that supports priority inheritance, and is taken and given with a single
+ * short critical section when no other task is waiting for it.  When
+ * configUSE_RECURSIVE_MUTEXES is also 1, xLightMutexTakeRecursive() lets the
+ * holder take the mutex again without a critical section.  Requires
+ * configUSE_MUTEXES to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_LIGHT_MUTEXES                      0
+
+/* Set configUSE_RW_LOCKS to 1 to include the reader-writer lock functionality
+ * in the build.  A reader-writer lock can be held by many readers at once or
+ * by one writer, prefers writers over readers, and gives the writer priority
+ * inheritance.  Requires configUSE_MUTEXES to be 1.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_RW_LOCKS                           0
+
+/* Set configUSE_BARRIERS to 1 to include the barrier functionality in the
+ * build.  A barrier releases a fixed number of tasks together once all of them
+ * have arrived at it, and can be reused for any number of phases.  Arriving is
+ * a single compare and swap, and only the last task to arrive enters the
+ * kernel to release the others.  Defaults to 0 if left undefined. */
+#define configUSE_BARRIERS                           0
+
+/* Set configUSE_CONDITION_VARIABLES to 1 to include the condition variable
+ * functionality in the build.  xCondWait() gives a mutex and blocks on the
+ * condition variable in one step, and vCondBroadcast() moves all but one of
+ * the waiting tasks straight to the mutex's list of waiting tasks, so they are
+ * unblocked one at a time as the mutex is given.  Requires configUSE_MUTEXES
+ * to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_CONDITION_VARIABLES                0
+
+/* Set configUSE_TRANSITIVE_PRIORITY_INHERITANCE to 1 to pass an inherited
+ * priority along chains of blocked mutex holders - so if the holder of a mutex
+ * is itself blocked on a mutex held by a lower priority task, that task also
+ * inherits the priority.  Applies to mutexes created with
+ * xSemaphoreCreateMutex() and to light mutexes.  Cannot be used with
+ * configUSE_GRANULAR_LOCKS.  Defaults to 0 if left undefined. */
+#define configUSE_TRANSITIVE_PRIORITY_INHERITANCE    0
+
+/* Set configUSE_MUTEX_PRIORITY_CEILING to 1 to include
+ * xSemaphoreCreateMutexWithCeiling(), which creates a mutex that raises the
+ * priority of the task taking it to a fixed ceiling priority in place of using
+ * priority inheritance.  Requires configUSE_MUTEXES to be 1.  Defaults to 0 if
+ * left undefined. */
+#define configUSE_MUTEX_PRIORITY_CEILING             0
+
+/* Set configUSE_TASK_WAIT_ON_ADDRESS to 1 to include xTaskWaitOnAddress() and
+ * xTaskWakeAddress(), which block a task on, and wake tasks blocked on, a
+ * 32-bit word in application memory.  Cannot be used with
+ * configUSE_GRANULAR_LOCKS.  Defaults to 0 if left undefined. */
+#define configUSE_TASK_WAIT_ON_ADDRESS               0
+
+/* configTASK_WAIT_ADDRESS_LISTS sets the number of lists the tasks blocked in
+ * xTaskWaitOnAddress() are hashed into by address.  More lists make waking
+ * faster when many tasks wait on different addresses, at the cost of RAM.
+ * Defaults to 8 if left undefined. */
+#define configTASK_WAIT_ADDRESS_LISTS                8
+
+/* Set configUSE_EVENT_HANDLERS to 1 to include the event handler functionality
+ * in the build.  An event handler is a function that runs to completion each
+ * time it is posted.  All the handlers of one priority share one dispatcher
+ * task, and so one stack, which is created the first time a handler of that
+ * priority is initialised.  Requires configSUPPORT_DYNAMIC_ALLOCATION and
+ * configUSE_TASK_NOTIFICATIONS to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_EVENT_HANDLERS                     0
+
+/* configEVENT_HANDLER_STACK_DEPTH sets the size of the stack, in words, of each
+ * event handler dispatcher task.  Defaults to configMINIMAL_STACK_SIZE if left
+ * undefined. */
+#define configEVENT_HANDLER_STACK_DEPTH              configMINIMAL_STACK_SIZE
+
+/* Set configUSE_SOFTIRQS to 1 to include the softirq functionality in the
+ * build.  A softirq is a numbered handler that an interrupt raises to have
+ * work done as soon as it returns, by a task of configSOFTIRQ_TASK_PRIORITY on
+ * each core, without sending a message to a queue.  configSOFTIRQ_COUNT (at
+ * most 32) sets how many softirqs there are, and
+ * configSOFTIRQ_TASK_STACK_DEPTH the stack size, in words, of the softirq
+ * tasks.  Requires configSUPPORT_DYNAMIC_ALLOCATION and
+ * configUSE_TASK_NOTIFICATIONS to be 1.  Default to 0, 8,
+ * configMAX_PRIORITIES - 1 and configMINIMAL_STACK_SIZE if left undefined. */
+#define configUSE_SOFTIRQS                           0
+#define configSOFTIRQ_COUNT                          8
+#define configSOFTIRQ_TASK_PRIORITY                  ( configMAX_PRIORITIES - 1 )
+#define configSOFTIRQ_TASK_STACK_DEPTH               configMINIMAL_STACK_SIZE
+
+/* Set configUSE_COMPLETIONS to 1 to include the completion functionality in the
+ * build.  A completion lets a task block until an interrupt, such as a DMA
+ * transfer complete interrupt, signals it, and carries a status word back from
+ * the interrupt.  The task is unblocked with a direct to task notification at
+ * index configCOMPLETION_NOTIFY_INDEX, which should be reserved for
+ * completions by the tasks that use them.  configCOMPLETION_NOTIFY_INDEX
+ * defaults to the last notification index.  Requires
+ * configUSE_TASK_NOTIFICATIONS to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_COMPLETIONS                        0
+#define configCOMPLETION_NOTIFY_INDEX                ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+
+/* Set configUSE_DEFERRED_LOG to 1 to include the deferred log in the build.
+ * Logging a message with deferredLOG0() to deferredLOG4() only writes the
+ * address of the format string and the raw arguments to a stream buffer of the
+ * calling core, and a low priority task formats the messages later.
+ * configDEFERRED_LOG_BUFFER_SIZE sets the size in bytes of each core's stream
+ * buffer, configDEFERRED_LOG_MAX_ARGUMENTS (1 to 6) the number of arguments a
+ * message can have, and configDEFERRED_LOG_TIMESTAMP() the timestamp recorded
+ * with each message.  Requires configSUPPORT_STATIC_ALLOCATION and
+ * configUSE_STREAM_BUFFERS to be 1.  Default to 0, 1024, 4 and
+ * xTaskGetTickCountFromISR() if left undefined. */
+#define configUSE_DEFERRED_LOG                       0
+#define configDEFERRED_LOG_BUFFER_SIZE               1024
+#define configDEFERRED_LOG_MAX_ARGUMENTS             4
+
+/* Set configUSE_AMP_MESSAGE_BUFFERS to 1 to include AMP message channels in
+ * the build.  A channel passes messages between two processors that each run
+ * their own instance of the kernel, through a pair of message buffers in
+ * shared memory, and raises a doorbell interrupt on the other processor to
+ * unblock its tasks.  configAMP_MEMORY_BARRIER() must order memory accesses as
+ * seen by the other processor, for example by executing a DMB instruction on
+ * Cortex-M.  Requires configSUPPORT_STATIC_ALLOCATION and
+ * configUSE_STREAM_BUFFERS to be 1.  Default to 0 and portMEMORY_BARRIER() if
+ * left undefined. */
+#define configUSE_AMP_MESSAGE_BUFFERS                0
+#define configAMP_MEMORY_BARRIER()                   portMEMORY_BARRIER()
+
+/* Set configUSE_ASYNC_TASKS to 1 to include the async task functionality in
+ * the build.  An async task is a stackless task, written in the same style as
+ * a co-routine, that can wait for delays, notifications, queues and stream
+ * buffers.  Async tasks are run by the event handler dispatcher tasks, so
+ * require configUSE_EVENT_HANDLERS to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_ASYNC_TASKS                        0
+
+/* Set configUSE_TASK_POOLS to 1 to include the task pool functionality in the
+ * build.  A task pool is a set of worker tasks that run jobs submitted with
+ * xTaskPoolSubmit(), waking an idle worker with a direct to task notification.
+ * Requires configSUPPORT_DYNAMIC_ALLOCATION and configUSE_TASK_NOTIFICATIONS to
+ * be 1.  Defaults to 0 if left undefined. */
+#define configUSE_TASK_POOLS                         0
+
+/* Set configUSE_PARALLEL_FOR to 1 to include vTaskParallelFor(), which splits a
+ * loop into chunks processed by the calling task and one helper task per
+ * additional core.  Requires configUSE_TASK_POOLS and configUSE_MUTEXES to be 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_PARALLEL_FOR                       0
+
+/* Set configUSE_TASK_TEMPLATES to 1 to include vTaskTemplateInit() and
+ * xTaskCreateFromTemplate(), which create short lived tasks from a fixed set of
+ * statically allocated TCB and stack pairs that are prepared once and reused.
+ * Requires configSUPPORT_STATIC_ALLOCATION and INCLUDE_vTaskDelete to be 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_TASK_TEMPLATES                     0
+
+/* Set configUSE_SHARED_STACKS to 1 to include vTaskSharedStackInit() and
+ * xTaskCreateWithSharedStack(), which let a group of tasks run on one stack.
+ * Only one task of a group runs on the stack at a time, and a task only gives
+ * the stack to the others when it blocks where it has allowed it with
+ * vTaskSharedStackRelease().  Requires configSUPPORT_STATIC_ALLOCATION to be 1
+ * and configNUMBER_OF_CORES to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_SHARED_STACKS                      0
+
+/* Set configUSE_STATIC_OBJECTS to 1 to include xStaticObjectsCreate(), which
+ * creates the tasks, queues, stream buffers and timers declared at compile
+ * time with the macros in static_objects.h, in buffers those macros allocate
+ * statically.  Requires configSUPPORT_STATIC_ALLOCATION to be 1.  Defaults to
+ * 0 if left undefined. */
+#define configUSE_STATIC_OBJECTS                     0
+
+/* Set configUSE_WARM_BOOT to 1 to include xTaskSaveWarmBootState() and
+ * xTaskRestoreWarmBootState(), which let a device that wakes from a sleep mode
+ * with a reset, but with its RAM retained, resume its tasks rather than create
+ * them again.  All kernel objects must be statically allocated in retained
+ * RAM.  Requires configSUPPORT_STATIC_ALLOCATION and
+ * configRECORD_STACK_HIGH_ADDRESS to be 1 and configNUMBER_OF_CORES to be 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_WARM_BOOT                          0
+
+/* Set configUSE_INLINE_GETTERS to 1 to make the inline versions of
+ * xTaskGetTickCount(), xTaskGetCurrentTaskHandle(), xTaskGetSchedulerState()
+ * and uxQueueMessagesWaiting() in inline_getters.h available.  They read the
+ * kernel's variables directly, without calling the trace macros, so are
+ * intended for loops that poll the kernel's state at a high rate.  Defaults to
+ * 0 if left undefined. */
+#define configUSE_INLINE_GETTERS                     0
+
 /******************************************************************************/
 /* Interrupt nesting behaviour configuration. *********************************/
 /******************************************************************************/
@@ -329,6 +1064,14 @@
  * on the FreeRTOS port. */
 #define configMAX_API_CALL_INTERRUPT_PRIORITY    0
 
+/* Set configUSE_DIRECT_ISR_YIELD to 1 in the GCC ARM_CM3, ARM_CM4F and
+ * ARM_CM7/r0p1 ports to include portDIRECT_YIELD_ISR(), which defines an
+ * interrupt handler that switches to the task it unblocked before the
+ * interrupt returns, instead of pending PendSV and switching in a second
+ * exception.  Intended for high rate interrupts that wake a single task.
+ * Defaults to 0 if left undefined. */
+#define configUSE_DIRECT_ISR_YIELD               0
+
 /******************************************************************************/
 /* Hook and callback function related definitions. ****************************/
 /******************************************************************************/
@@ -342,6 +1085,12 @@
 #define configUSE_MALLOC_FAILED_HOOK          0
 #define configUSE_DAEMON_TASK_STARTUP_HOOK    0
 
+/* Set configUSE_DEADLINE_MISSED_HOOK to 1 to have
+ * vApplicationDeadlineMissedHook() called when a task created with
+ * xTaskCreateDeadline() misses a deadline.  Requires configUSE_EDF_SCHEDULING
+ * to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_DEADLINE_MISSED_HOOK        0
+
 /* Set configUSE_SB_COMPLETED_CALLBACK to 1 to have send and receive completed
  * callbacks for each instance of a stream buffer or message buffer. When the
  * option is set to 1, APIs xStreamBufferCreateWithCallback() and
@@ -364,6 +1113,37 @@
  * 0 if left undefined. */
 #define configCHECK_FOR_STACK_OVERFLOW        2
 
+/* Set configUSE_LIST_LINK_CHECKS to 1 or 2 to check the links of the kernel's
+ * task lists for corruption without adding anything to the list structures,
+ * unlike configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES.  If it is 1 then the
+ * neighbours of the running task's list item, and of the end markers of its
+ * ready list and of the delayed list, are checked to point back to them on
+ * each tick and context switch.  If it is 2 then, in addition, the idle task
+ * walks one task list on each pass of its loop, checking every link, so
+ * corruption anywhere in the lists is found within a few passes.  The
+ * application writer must provide vApplicationListCorruptedHook() when
+ * configUSE_LIST_LINK_CHECKS is not 0.  Defaults to 0 if left undefined. */
+#define configUSE_LIST_LINK_CHECKS            0
+
+/* Set configUSE_LAZY_STACK_PAINTING to 1 to have only the last
+ * configSTACK_PAINT_GUARD_SIZE bytes of a task's stack filled with a known
+ * value when the task is created, and the rest filled by the idle task,
+ * configSTACK_PAINT_CHUNK_SIZE bytes at a time, while the task is not running.
+ * This removes the fill of the whole stack from the task creation path.  Only
+ * stack the task is not using is filled, so until the fill completes
+ * uxTaskGetStackHighWaterMark() may report less free stack than is available.
+ * Has no effect if stacks are not filled.  Defaults to 0 if left undefined. */
+#define configUSE_LAZY_STACK_PAINTING         0
+
+/* Set configUSE_STACK_PEAK_PROFILING to 1 to record the deepest stack pointer
+ * sampled for each task, and the program counter saved with it, each time the
+ * task is switched out and whenever vTaskSampleStackPeakFromISR() is called
+ * (for example from the tick hook).  Read the peaks with uxTaskGetStackPeak()
+ * or vTaskListStackPeaks() to find which function uses the most stack.  The
+ * program counter is only recorded on ports that define
+ * portSTACK_PEAK_PROGRAM_COUNTER().  Defaults to 0 if left undefined. */
+#define configUSE_STACK_PEAK_PROFILING        0
+
 /******************************************************************************/
 /* Run time and task stats gathering related definitions. *********************/
 /******************************************************************************/
@@ -375,6 +1155,151 @@
  */
 #define configGENERATE_RUN_TIME_STATS           0
 
+/* Set configUSE_CYCLE_COUNTER_RUN_TIME_STATS to 1 in the ARMv7-M (Cortex-M3,
+ * M4F and M7) and ARMv8-M Mainline (Cortex-M33, M35P, M55 and M85) GCC and IAR
+ * ports to have the port provide the run time stats clock from the DWT cycle
+ * counter, so portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() and
+ * portGET_RUN_TIME_COUNTER_VALUE() must not be defined.  The port extends the
+ * 32-bit counter to 64 bits, so also define configRUN_TIME_COUNTER_TYPE as
+ * uint64_t to keep the extra range.  The counter stops while the core sleeps.
+ * Defaults to 0 if left undefined. */
+#define configUSE_CYCLE_COUNTER_RUN_TIME_STATS  0
+
+/* Set configUSE_SCHEDULING_LATENCY_STATS to 1 to have FreeRTOS measure, in run
+ * time stats clock counts, how long each task waits to run after becoming
+ * ready, and keep a histogram of the waits with configSCHEDULING_LATENCY_BUCKETS
+ * power of 2 sized buckets that is returned by vTaskGetInfo() and
+ * uxTaskGetSystemState().  Requires configGENERATE_RUN_TIME_STATS to be 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_SCHEDULING_LATENCY_STATS      0
+
+/* Set configUSE_IPC_STATISTICS to 1 to count the sends, receives, blocks and
+ * timeouts, the maximum depth and the total time tasks spent blocked for each
+ * queue, semaphore, stream buffer, message buffer and event group, plus the
+ * held time and priority inheritances of each mutex.  Read them with
+ * vQueueGetStatistics(), vStreamBufferGetStatistics() and
+ * vEventGroupGetStatistics(), or list the registered queues with
+ * vQueueListStatistics().  Not supported with the MPU wrappers.  Defaults to 0
+ * if left undefined. */
+#define configUSE_IPC_STATISTICS                0
+
+/* Set configUSE_IPC_LATENCY_TRACING to 1 to have each message sent through a
+ * queue, message buffer or task notification carry a hidden tag holding a
+ * correlation ID and the time, in run time stats clock counts, at which the
+ * chain of messages it belongs to started.  A task that receives a tagged
+ * message passes the tag on with the messages it sends, so the latency recorded
+ * when a message is received is measured from the original event, however many
+ * hops it took.  The latencies are kept in histograms of
+ * configIPC_LATENCY_BUCKETS power of 2 sized buckets, read with
+ * vQueueGetLatencyHistogram(), vMessageBufferGetLatencyHistogram() and
+ * vTaskGetNotifyLatencyHistogram().  A message buffer holds tags for up to
+ * configIPC_LATENCY_MESSAGE_BUFFER_TAGS unread messages.  Requires
+ * configGENERATE_RUN_TIME_STATS to be 1.  Not supported with the MPU wrappers.
+ * Defaults to 0 if left undefined. */
+#define configUSE_IPC_LATENCY_TRACING           0
+
+/* Set configUSE_RUN_TIME_SNAPSHOT to 1 to have the kernel keep a binary record
+ * of each task's run time, updated when the task is switched out, that
+ * uxTaskGetRunTimeSnapshot() copies without suspending the scheduler.  Up to
+ * configRUN_TIME_SNAPSHOT_SLOTS tasks are recorded.  Requires
+ * configGENERATE_RUN_TIME_STATS to be 1, and is not supported with the MPU
+ * wrappers.  Defaults to 0 if left undefined. */
+#define configUSE_RUN_TIME_SNAPSHOT             0
+#define configRUN_TIME_SNAPSHOT_SLOTS           16
+
+/* Set configUSE_ENERGY_ACCOUNTING to 1 to charge each task, in the ullEnergy
+ * member of TaskStatus_t, for its run time multiplied by
+ * configENERGY_ACTIVE_POWER(), plus configENERGY_WAKE_UP_COST each time a
+ * tickless idle sleep ends because the task's delay or block time expired.
+ * The ulWakeUps member counts those wake-ups.  configENERGY_ACTIVE_POWER() is
+ * evaluated when a task is switched out, and may return the power of the
+ * current DVFS level, in any units.  configENERGY_COUNTER_TYPE must be wide
+ * enough for the result.  The idle task is charged for the time spent asleep
+ * if the run time clock runs during sleep.  Requires
+ * configGENERATE_RUN_TIME_STATS to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_ENERGY_ACCOUNTING             0
+#define configENERGY_COUNTER_TYPE               uint64_t
+#define configENERGY_ACTIVE_POWER()             ( 1U )
+#define configENERGY_WAKE_UP_COST               0
+
+/* Set configUSE_PC_SAMPLING to 1 to have vTaskRecordPCSampleFromISR() record
+ * the program counter and handle of the interrupted task in a ring buffer of
+ * configPC_SAMPLE_BUFFER_LENGTH samples, which uxTaskGetPCSamples() drains and
+ * tools/profiler/freertos_profile.py symbolises on the host.  When
+ * configPC_SAMPLE_FROM_TICK is 1 the GCC Cortex-M0, M3, M4F and M7 ports take
+ * a sample on every tick; set it to 0 to sample from an application timer
+ * interrupt instead.  Not supported with the MPU wrappers.  Defaults to 0 if
+ * left undefined. */
+#define configUSE_PC_SAMPLING                   0
+#define configPC_SAMPLE_BUFFER_LENGTH           128
+#define configPC_SAMPLE_FROM_TICK               1
+
+/* Set configUSE_ISR_RUN_TIME_STATS to 1 to have traceISR_ENTER() and
+ * traceISR_EXIT() account the time spent in interrupts to the interrupts rather
+ * than to the tasks they interrupted.  The time is kept per interrupt number,
+ * as returned by portGET_INTERRUPT_NUMBER(), for the first
+ * configISR_RUN_TIME_STATS_VECTORS interrupts, and the longest time from an
+ * interrupt requesting a context switch to the switch is recorded.  Up to
+ * configISR_RUN_TIME_STATS_MAX_NESTING nested interrupts are measured
+ * separately.  The Cortex-M ports call the hooks from the tick interrupt;
+ * application interrupt handlers call traceISR_ENTER() on entry and
+ * portYIELD_FROM_ISR() or traceISR_EXIT() on exit.  The RISC-V port calls the
+ * hooks when portASM.S is built with portasmCALL_ISR_TRACE_HOOKS set to 1.
+ * Requires configGENERATE_RUN_TIME_STATS to be 1, and is not supported with the
+ * MPU wrappers.  Defaults to 0 if left undefined. */
+#define configUSE_ISR_RUN_TIME_STATS            0
+#define configISR_RUN_TIME_STATS_VECTORS        64
+#define configISR_RUN_TIME_STATS_MAX_NESTING    8
+
+/* Set configUSE_CRITICAL_SECTION_STATS to 1 to have taskENTER_CRITICAL(),
+ * taskEXIT_CRITICAL() and their FROM_ISR versions time each outermost critical
+ * section with the run time stats clock, and vTaskSuspendAll() and
+ * xTaskResumeAll() time each scheduler suspension.  The longest of each, with
+ * the source file and line that entered the critical section and the task that
+ * suspended the scheduler, is returned by vTaskGetCriticalSectionStats().
+ * Requires configGENERATE_RUN_TIME_STATS to be 1, and is not supported with the
+ * MPU wrappers or with configUSE_GRANULAR_LOCKS.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_CRITICAL_SECTION_STATS        0
+
+/* Set configUSE_SWITCH_REASON_STATS to 1 to have vTaskSwitchContext() count
+ * each context switch by the reason the task switched out left the Running
+ * state - a time slice, taskYIELD(), blocking, readying a higher priority
+ * task, an interrupt readying a higher priority task, or a priority change.
+ * The counts are kept for the system, read with vTaskGetSwitchReasonCounts(),
+ * and for each task, in the ulSwitchReasonCounts member of TaskStatus_t.  Not
+ * supported with the MPU wrappers.  Defaults to 0 if left undefined. */
+#define configUSE_SWITCH_REASON_STATS           0
+
+/* Set configUSE_CORE_LOAD_STATS to 1 to have the kernel keep the time the idle
+ * tasks, active and passive, run on each core, so xTaskGetCoreLoad() can
+ * return each core's load over a sliding window of configCORE_LOAD_WINDOW run
+ * time stats clock counts, and ulTaskGetCoreIdleRunTimeCounter() its total
+ * idle time.  Requires configGENERATE_RUN_TIME_STATS to be 1, and is not
+ * supported with the MPU wrappers.  Defaults to 0 if left undefined. */
+#define configUSE_CORE_LOAD_STATS               0
+#define configCORE_LOAD_WINDOW                  100000
+
+/* Set configUSE_WAKE_SOURCE_STATS to 1 to record, for each tickless sleep, the
+ * time it was expected to last, the time it lasted and the interrupt that
+ * ended it, and count the sleeps each interrupt ended in a histogram of up to
+ * configWAKE_SOURCE_HISTOGRAM_LENGTH sources.  The results are returned by
+ * vTaskGetTicklessIdleStats() and uxTaskGetWakeSourceHistogram().  Requires
+ * configUSE_TICKLESS_IDLE to be other than 0 and a port that reports its
+ * sleeps, such as the GCC Cortex-M ports.  Defaults to 0 if left undefined. */
+#define configUSE_WAKE_SOURCE_STATS             0
+#define configWAKE_SOURCE_HISTOGRAM_LENGTH      8
+
+/* Set configUSE_DVFS_GOVERNOR to 1 to have the tick interrupt pass the load of
+ * each core to uxApplicationDVFSGovernorHook() every configDVFS_GOVERNOR_PERIOD
+ * ticks, and call vApplicationDVFSSetLevel() when the hook returns a new
+ * performance level.  The port then recalculates its tick timer reload value,
+ * so configCPU_CLOCK_HZ must evaluate to the current clock frequency.
+ * Requires configUSE_CORE_LOAD_STATS to be 1.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_DVFS_GOVERNOR                 0
+#define configDVFS_GOVERNOR_PERIOD              10
+
 /* Set configUSE_TRACE_FACILITY to include additional task structure members
  * are used by trace and visualisation functions and tools.  Set to 0 to exclude
  * the additional information from the structures. Defaults to 0 if left
@@ -384,10 +1309,32 @@
 /* Set to 1 to include the vTaskList() and vTaskGetRunTimeStats() functions in
  * the build.  Set to 0 to exclude these functions from the build.  These two
  * functions introduce a dependency on string formatting functions that would
- * otherwise not exist - hence they are kept separate.  Defaults to 0 if left
- * undefined. */
+ * otherwise not exist - hence they are kept separate.  The
+ * vTaskListTasksStream() and vTaskGetRunTimeStatisticsStream() variants, which
+ * pass each formatted line to a writer callback and need neither the heap nor
+ * snprintf(), are included too, and are the only ones available when
+ * configSUPPORT_DYNAMIC_ALLOCATION is 0.  Defaults to 0 if left undefined. */
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* Set configUSE_TRACE_RECORDER to 1 to record kernel events - context switches,
+ * tasks becoming ready, queue operations, interrupts and so on - as 8 byte
+ * binary records in a ring buffer per core, from which
+ * tools/trace/freertos_trace_decode.py produces a trace that can be opened in
+ * Perfetto or chrome://tracing.  configTRACE_RECORDER_TIMESTAMP() must read a
+ * free running timer that counts at configTRACE_RECORDER_TIMESTAMP_HZ.  Set
+ * configTRACE_RECORDER_STREAMING to 1 to instead send each event to
+ * configTRACE_RECORDER_WRITE() as it occurs.  Requires configUSE_TRACE_FACILITY
+ * to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_TRACE_RECORDER                0
+
+/* Set configUSE_TELEMETRY to 1 to include the telemetry serialiser in
+ * telemetry.c, which packs task, heap, queue and stream buffer statistics into
+ * a compact, versioned binary snapshot for sending to a host, where
+ * tools/telemetry/freertos_telemetry_decode.py decodes it.  See telemetry.h.
+ * Requires configUSE_TRACE_FACILITY to be 1.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_TELEMETRY                     0
+
 /******************************************************************************/
 /* Co-routine related definitions. ********************************************/
 /******************************************************************************/
@@ -403,6 +1350,15 @@
  * priority. Defaults to 0 if left undefined. */
 #define configMAX_CO_ROUTINE_PRIORITIES    1
 
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_PER_CORE_CO_ROUTINES to 1 to give each core its own co-routine
+ * scheduler.  A co-routine belongs to the core it was created on, or the core
+ * passed to xCoRoutineCreateOnCore(), and is only run by a task that calls
+ * vCoRoutineSchedule() on that core, so one host task pinned to each core can
+ * run a separate set of co-routines.  Requires configUSE_CORE_AFFINITY.
+ * Defaults to 0 if left undefined. */
+#define configUSE_PER_CORE_CO_ROUTINES     0
+
 /******************************************************************************/
 /* Debugging assistance. ******************************************************/
 /******************************************************************************/
@@ -441,6 +1397,20 @@
  * undefined. */
 #define configTOTAL_MPU_REGIONS                                   8
 
+/* Set configUSE_MPU_SETTINGS_CACHE to 1 to have the context switch skip
+ * reprogramming the MPU when it already holds the regions of the task being
+ * switched in.  Only used by the GCC ARM_CM4_MPU and ARMv8-M Mainline
+ * (Cortex-M33, M35P, M55 and M85) ports.  Defaults to 0 if left undefined. */
+#define configUSE_MPU_SETTINGS_CACHE                              0
+
+/* Set configUSE_SHARED_MPU_REGIONS to 1 to reserve the last 4 MPU regions for
+ * regions shared by all the tasks, such as common peripherals or a shared
+ * heap.  Define the regions by calling vPortSetSharedMPURegions() before the
+ * scheduler is started.  They are programmed once and do not use any per task
+ * regions.  Requires configTOTAL_MPU_REGIONS to be 16.  Only used by the GCC
+ * ARMv8-M Mainline ports.  Defaults to 0 if left undefined. */
+#define configUSE_SHARED_MPU_REGIONS                              0
+
 /* configTEX_S_C_B_FLASH allows application writers to override the default
  * values for the for TEX, Shareable (S), Cacheable (C) and Bufferable (B) bits
  * for the MPU region covering Flash.  Defaults to 0x07UL (which means TEX=000,
@@ -519,6 +1489,130 @@
  * priority task may run on different cores at the same time. */
 #define configRUN_MULTIPLE_PRIORITIES             0
 
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_SMP_READY_PRIORITY_BITMAP to 1 to have the scheduler keep a bitmap
+ * of the priorities that have ready tasks.  Selecting the next task to run then
+ * skips directly over empty priority levels, so the time taken to select a task
+ * no longer grows with the number of priorities.  Ready lists only ever hold at
+ * most configNUMBER_OF_CORES running tasks ahead of a runnable one, so the search
+ * is bounded unless core affinity excludes tasks.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_SMP_READY_PRIORITY_BITMAP       0
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_PER_CORE_READY_LISTS to 1 to give each core its own set of ready
+ * lists.  A ready task stays in the lists of the core it last ran on, and a core
+ * only steals from the busiest other core when it has nothing else to run at
+ * the highest ready priority.  Core affinity and priority ordering are
+ * unchanged.  Defaults to 0 if left undefined. */
+#define configUSE_PER_CORE_READY_LISTS            0
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_SOFT_AFFINITY to 1 to have the scheduler remember the core each task
+ * last ran on.  When a core selects between tasks of the same priority it
+ * prefers those that last ran on it, leaving tasks that last ran on another
+ * core for that core, and a task that becomes ready preempts the core it last
+ * ran on in preference to other equally suitable cores.  A task is only
+ * migrated when nothing else at its priority can run, or once more than
+ * configSOFT_AFFINITY_MIGRATION_THRESHOLD such tasks have been passed over.
+ * Priority ordering and core affinity are unchanged.  configUSE_SOFT_AFFINITY
+ * defaults to 0 and configSOFT_AFFINITY_MIGRATION_THRESHOLD to 2 if left
+ * undefined. */
+#define configUSE_SOFT_AFFINITY                   0
+#define configSOFT_AFFINITY_MIGRATION_THRESHOLD   2
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_DEFERRED_CORE_YIELDS to 1 to hold back the interrupts that ask other
+ * cores to yield until the requesting core leaves its outermost critical
+ * section or interrupt.  Each core is then interrupted at most once per burst
+ * of wake ups, and only after the kernel locks have been released, rather than
+ * immediately spinning on them.  Defaults to 0 if left undefined. */
+#define configUSE_DEFERRED_CORE_YIELDS            0
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_TASK_GANGS to 1 to allow tasks to be grouped into gangs with
+ * vTaskGangSet().  While one member of a gang runs, the other cores prefer the
+ * ready members of the same gang over other tasks of the same priority, cores
+ * running other tasks of the same or lower priority are asked to yield to make
+ * room for the rest of the gang, and when the time slice of one member ends the
+ * whole gang is switched out together.  Most useful with
+ * configRUN_MULTIPLE_PRIORITIES set to 0.  Defaults to 0 if left undefined. */
+#define configUSE_TASK_GANGS                      0
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_CORE_LOCAL_SUSPEND to 1 to build vTaskSuspendCore() and
+ * xTaskResumeCore(), which stop context switches on the calling core only and
+ * do not take the kernel locks, so the other cores keep scheduling.  heap_4.c
+ * then uses them, together with its own compare and swap lock, in place of
+ * vTaskSuspendAll() and xTaskResumeAll(), so the port must provide
+ * portATOMIC_COMPARE_AND_SWAP_U32.  Defaults to 0 if left undefined. */
+#define configUSE_CORE_LOCAL_SUSPEND              0
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_CORE_TOPOLOGY to 1 to describe clustered or heterogeneous cores
+ * (for example big.LITTLE) to the scheduler.  configCORE_CLUSTERS and
+ * configCORE_CAPACITIES must then be defined as initialisers with one entry per
+ * core, giving the cluster each core belongs to and its relative capacity.
+ * When a core selects between tasks of the same priority it prefers those that
+ * last ran in its own cluster, and those whose capacity hint, set with
+ * vTaskCapacityHintSet(), is best met by its own capacity.  Other tasks only
+ * run on it when nothing else at their priority can.  Priority ordering and
+ * core affinity are unchanged.  Defaults to 0 if left undefined. */
+#define configUSE_CORE_TOPOLOGY                   0
+
+/* Two big cores in cluster 0 followed by two little cores in cluster 1:
+ * #define configCORE_CLUSTERS                    { 0, 0, 1, 1 }
+ * #define configCORE_CAPACITIES                  { 100, 100, 40, 40 }
+ */
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_GRANULAR_LOCKS to 1 to protect queues, stream buffers, event groups
+ * and the timer lists with their own spinlocks instead of the kernel-wide
+ * TASK and ISR locks, so that operations on unrelated objects can proceed on
+ * different cores at the same time.  Operations that block still suspend the
+ * scheduler.  The port must provide portSPINLOCK_TYPE, portINIT_SPINLOCK,
+ * portGET_SPINLOCK and portRELEASE_SPINLOCK.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_GRANULAR_LOCKS                  0
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configUSE_CACHE_LINE_PADDING to 1 to lay out the scheduler's data so that
+ * data written by different cores does not share a data cache line:
+ *
+ * - The per core scheduler state (yield pending flags, run time stats and data
+ *   group critical nesting counts) is gathered into one block per core padded
+ *   to a whole number of configCACHE_LINE_SIZE byte lines.
+ * - pxCurrentTCBs[], the ready lists, the tick count, the top ready priority
+ *   and the scheduler suspended count each start a new cache line, provided
+ *   the port defines portCACHE_LINE_ALIGNED (the GCC AArch64, RISC-V, RP2040
+ *   and POSIX ports do).  pxCurrentTCBs[] itself is not padded as ports
+ *   index it directly.
+ * - The fields of the TCB used when switching context are grouped at its
+ *   start, with the task name moved after them.  Kernel aware debuggers that
+ *   assume the default TCB layout will not find the task name.
+ *
+ * configCACHE_LINE_SIZE must be a power of two.  configUSE_CACHE_LINE_PADDING
+ * defaults to 0 and configCACHE_LINE_SIZE to 64 if left undefined. */
+#define configUSE_CACHE_LINE_PADDING              0
+#define configCACHE_LINE_SIZE                     64
+
+/* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
+ * configMUTEX_SPIN_ITERATIONS to a non-zero value to have a task that finds a
+ * mutex or light mutex held by a task running on another core poll the mutex
+ * up to that many times before blocking, which avoids two context switches
+ * when the mutex is only held briefly.  The task blocks straight away if the
+ * holder is not running.  Defaults to 0, which always blocks straight away,
+ * if left undefined. */
+#define configMUTEX_SPIN_ITERATIONS               0
+
+/* Set configUSE_MUTEX_HANDOFF to 1 to have xSemaphoreGive() pass a mutex that
+ * tasks are waiting for straight to the highest priority waiting task, instead
+ * of leaving it free for whichever task next tries to take it.  That stops a
+ * running task repeatedly retaking a contended mutex before the woken waiter
+ * runs, at the cost of the woken task holding the mutex until it is scheduled.
+ * Defaults to 0 if left undefined. */
+#define configUSE_MUTEX_HANDOFF                   0
+
 /* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
  * configUSE_CORE_AFFINITY to 1 to enable core affinity feature. When core
  * affinity feature is enabled, the vTaskCoreAffinitySet and
@@ -543,6 +1637,13 @@
  * vTaskPreemptionEnable APIs. */
 #define configUSE_TASK_PREEMPTION_DISABLE         0
 
+/* Set configUSE_PREEMPTION_THRESHOLDS to 1 to include
+ * vTaskPreemptionThresholdSet(), which sets a priority a task must be above to
+ * preempt a task while it runs.  This reduces the context switches between
+ * closely related tasks without delaying tasks of a higher priority.  Requires
+ * configUSE_PREEMPTION to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_PREEMPTION_THRESHOLDS           0
+
 /* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), set
  * configUSE_PASSIVE_IDLE_HOOK to 1 to allow the application writer to use
  * the passive idle task hook to add background functionality without the
@@ -582,6 +1683,18 @@
  * exported from secure side. */
 #define configENABLE_TRUSTZONE            1
 
+/* Set configUSE_LAZY_SECURE_CONTEXT_SWITCH to 1 to have the GCC ARMv8-M
+ * Mainline (Cortex-M33, M35P, M55 and M85) TrustZone ports leave the secure
+ * context of a task that is switched out while executing non-secure code
+ * loaded.  The secure context is then only saved when a different task needs
+ * the secure side, and is not reloaded when the same task runs again.  Not
+ * supported when configENABLE_MPU is 1.  Defaults to 0 if left undefined.
+ *
+ * The secure side build can also define secureconfigSTATIC_SECURE_STACK_SIZE
+ * to take the secure context stacks from a fixed pool instead of the secure
+ * heap. */
+#define configUSE_LAZY_SECURE_CONTEXT_SWITCH    0
+
 /* If the application writer does not want to use TrustZone, but the hardware
  * does not support disabling TrustZone then the entire application (including
  * the FreeRTOS scheduler) can run on the secure side without ever branching to
@@ -605,6 +1718,16 @@
  * ports. */
 #define configENABLE_MVE                  1
 
+/* Set configUSE_TASK_VECTOR_UNIT_FLAG to 1 so that only tasks that declare
+ * their use of the FPU or MVE, by calling vTaskSetUsesVectorUnit(), have their
+ * floating point and vector state (s0-s31, FPSCR and VPR) preserved.  Other
+ * tasks always use the smaller standard exception stack frame, so they must not
+ * execute floating point or MVE instructions - including any generated by the
+ * compiler - and neither must interrupts that preempt them.  Requires
+ * configENABLE_FPU to be 1 and is not supported with the MPU wrappers.
+ * Defaults to 0 if left undefined. */
+#define configUSE_TASK_VECTOR_UNIT_FLAG   0
+
 /******************************************************************************/
 /* ARMv7-M and ARMv8-M port Specific Configuration definitions. ***************/
 /******************************************************************************/
@@ -626,6 +1749,36 @@
  * Defaults to 1 if left undefined. */
 #define configCHECK_HANDLER_INSTALLATION    1
 
+/******************************************************************************/
+/* Posix port Specific Configuration definitions. *****************************/
+/******************************************************************************/
+
+/* Set configUSE_POSIX_VIRTUAL_TIME to 1 to have the Posix (Linux simulator)
+ * port advance the tick count straight to the time at which the next task
+ * unblocks whenever every task is blocked, so simulations run faster than real
+ * time.  Requires configUSE_TICKLESS_IDLE to be 1 and configNUMBER_OF_CORES to
+ * be 1.  Defaults to 0 if left undefined. */
+#define configUSE_POSIX_VIRTUAL_TIME                    0
+
+/* Set configUSE_POSIX_SIMULATED_TIME to 1 to make Posix port runs repeatable.
+ * The tick is then driven by simulated cycles rather than the host clock.
+ * Tasks consume cycles by calling vPortSimulationConsumeCycles(), for example
+ * from the traceENTER_xxx() macros of the kernel APIs to model their cost, and
+ * xPortSimulationScheduleInterrupt() raises a simulated interrupt at a given
+ * cycle.  When every task is blocked time jumps to the next tick or interrupt.
+ * ulPortSimulationGetContextSwitches() and ullPortSimulationGetCycles() report
+ * the results.  Requires configNUMBER_OF_CORES to be 1 and
+ * INCLUDE_xTaskGetIdleTaskHandle to be 1.  Defaults to 0 if left undefined. */
+#define configUSE_POSIX_SIMULATED_TIME                  0
+
+/* The number of simulated cycles per tick when configUSE_POSIX_SIMULATED_TIME
+ * is 1.  Defaults to 1000 if left undefined. */
+#define configPOSIX_SIMULATED_CYCLES_PER_TICK           1000U
+
+/* The number of simulated interrupts that can be scheduled at once when
+ * configUSE_POSIX_SIMULATED_TIME is 1.  Defaults to 8 if left undefined. */
+#define configPOSIX_SIMULATED_INTERRUPT_QUEUE_LENGTH    8
+
 /******************************************************************************/
 /* Definitions that include or exclude functionality. *************************/
 /******************************************************************************/
@@ -639,6 +1792,91 @@
 #define configUSE_QUEUE_SETS                   0
 #define configUSE_APPLICATION_TASK_TAG         0
 
+/* Set configUSE_QUEUE_SET_READY_BITMAP to 1 to have a queue set record which
+ * of its members contain data in a bitmap, instead of posting a member's
+ * handle to the set each time an item is sent to the member.  The length
+ * passed to xQueueCreateSet() is then the maximum number of members, which
+ * cannot exceed the number of bits in a UBaseType_t, and
+ * xQueueSelectFromSet() returns the ready member that was added to the set
+ * first.  Requires configUSE_QUEUE_SETS.  Defaults to 0 if left undefined. */
+#define configUSE_QUEUE_SET_READY_BITMAP       0
+
+/* Set configUSE_SPSC_QUEUES to 1 to include xQueueCreateSPSC(), which creates
+ * a queue with a single writer and a single reader that is accessed without
+ * entering a critical section.  Defaults to 0 if left undefined. */
+#define configUSE_SPSC_QUEUES                  0
+
+/* Set configUSE_COMPILER_ATOMICS to 1 to implement the functions in atomic.h,
+ * and the compare and swap used by the kernel's lock-free features when the
+ * port does not define portATOMIC_COMPARE_AND_SWAP_U32, with the compiler's
+ * __atomic builtins instead of by disabling interrupts.  Requires GCC or
+ * Clang.  Widths the target cannot access atomically without a lock still
+ * disable interrupts.  Defaults to 0 if left undefined. */
+#define configUSE_COMPILER_ATOMICS             0
+
+/* Set configUSE_MPMC_QUEUES to 1 to include xQueueCreateMPMC(), which creates
+ * a queue that any number of writers and readers access by compare and swap
+ * instead of a critical section.  SMP ports must define
+ * portATOMIC_COMPARE_AND_SWAP_U32.  Defaults to 0 if left undefined. */
+#define configUSE_MPMC_QUEUES                  0
+
+/* Set configUSE_ATOMIC_SEMAPHORES to 1 to include
+ * xSemaphoreCreateCountingAtomic(), which creates a counting semaphore whose
+ * count is changed by compare and swap, so giving and taking only enter the
+ * kernel to block or to wake a blocked task.  SMP ports must define
+ * portATOMIC_COMPARE_AND_SWAP_U32.  Defaults to 0 if left undefined. */
+#define configUSE_ATOMIC_SEMAPHORES            0
+
+/* Set configUSE_RING_QUEUES to 1 to include xQueueCreateRing(), which creates
+ * a queue that discards its oldest item when an item is sent to it while it is
+ * full, so sending to it never blocks or fails.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_RING_QUEUES                  0
+
+/* Set configUSE_PRIORITY_QUEUES to 1 to include xQueueCreatePriority(), which
+ * creates a queue from which items are received highest key first, where the
+ * key is a uint32_t at the start of each item.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_PRIORITY_QUEUES              0
+
+/* Set configUSE_RPC_QUEUES to 1 to include xQueueCreateRPC(), xQueueCall() and
+ * xQueueReply().  A task that sends a request with xQueueCall() blocks until
+ * the server task that receives it calls xQueueReply(), and lends its priority
+ * to the server until then, so a low priority server cannot delay a high
+ * priority client.  Requires configUSE_MUTEXES and INCLUDE_uxTaskPriorityGet to
+ * be set to 1.  Defaults to 0 if left undefined. */
+#define configUSE_RPC_QUEUES                   0
+
+/* Set configUSE_QUEUE_MULTIPLE_ITEMS to 1 to include xQueueSendMultiple() and
+ * uxQueueReceiveMultiple(), which move a batch of items to or from a queue in
+ * one operation.  Defaults to 0 if left undefined. */
+#define configUSE_QUEUE_MULTIPLE_ITEMS         0
+
+/* Set configUSE_ZERO_COPY_QUEUES to 1 to include xQueueReserveSend(),
+ * xQueueCommitSend(), xQueueAcquireReceive() and xQueueReleaseReceive(), which
+ * let tasks write and read queue items in place instead of copying them.
+ * Defaults to 0 if left undefined. */
+#define configUSE_ZERO_COPY_QUEUES             0
+
+/* Set configUSE_QUEUE_WAIT_FOR_ANY to 1 to include xQueueWaitForAny(), which
+ * blocks a task on a set of queues and semaphores until one of them contains
+ * data without posting each queue handle to a queue set.  The task blocks on
+ * task notification index configQUEUE_WAIT_FOR_ANY_NOTIFICATION_INDEX, which
+ * defaults to the last index.  Defaults to 0 if left undefined. */
+#define configUSE_QUEUE_WAIT_FOR_ANY           0
+
+/* Set configQUEUE_SEND_TO_FRONT_USED to 0 if the application never calls
+ * xQueueSendToFront() or xQueueSendToFrontFromISR(), and
+ * configQUEUE_OVERWRITE_USED to 0 if it never calls xQueueOverwrite() or
+ * xQueueOverwriteFromISR(), to remove the handling of those cases from the
+ * queue send functions.  The macros for the excluded functions are then not
+ * defined.  Both default to 1 if left undefined.  They are left undefined here
+ * as the CMake build defines both when FREERTOS_QUEUE_COPY_POSITIONS is set,
+ * e.g.:
+ * #define configQUEUE_SEND_TO_FRONT_USED         0
+ * #define configQUEUE_OVERWRITE_USED             0
+ */
+
 /* USE_POSIX_ERRNO enables the task global FreeRTOS_errno variable which will
  * contain the most recent error for that task. */
 #define configUSE_POSIX_ERRNO                  0
@@ -655,10 +1893,24 @@
 #define INCLUDE_xTaskGetSchedulerState         1
 #define INCLUDE_xTaskGetCurrentTaskHandle      1
 #define INCLUDE_uxTaskGetStackHighWaterMark    0
+
+/* Set INCLUDE_uxTaskGetISRStackHighWaterMark to 1 to include
+ * uxTaskGetISRStackHighWaterMark(), which reports how close each core's
+ * interrupt stack has come to overflowing.  Requires a port with a dedicated
+ * interrupt stack per core that defines portISR_STACK_FILL_BYTE, such as the
+ * GCC RISC-V port with configISR_STACK_SIZE_WORDS defined.  Defaults to 0 if
+ * left undefined. */
+#define INCLUDE_uxTaskGetISRStackHighWaterMark    0
 #define INCLUDE_xTaskGetIdleTaskHandle         0
 #define INCLUDE_eTaskGetState                  0
 #define INCLUDE_xTimerPendFunctionCall         0
 #define INCLUDE_xTaskAbortDelay                0
+
+/* Set INCLUDE_xTaskYieldIfHigherReady to 1 to include
+ * xTaskYieldIfHigherReady(), which yields only if another task would run as a
+ * result, so a cooperative task can offer to yield often without paying for a
+ * context switch interrupt each time.  Defaults to 0 if left undefined. */
+#define INCLUDE_xTaskYieldIfHigherReady        0
 #define INCLUDE_xTaskGetHandle                 0
 #define INCLUDE_xTaskResumeFromISR             1
 
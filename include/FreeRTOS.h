@@ -54,6 +54,25 @@
 #define TICK_TYPE_WIDTH_32_BITS    1
 #define TICK_TYPE_WIDTH_64_BITS    2
 
+/* Acceptable values for configDELAYED_LIST_IMPLEMENTATION. */
+#define DELAYED_LIST_SORTED          0
+#define DELAYED_LIST_TIMING_WHEEL    1
+#define DELAYED_LIST_SKIP_LIST       2
+
+/* Acceptable values for configHEAP_ALLOCATION_POLICY. */
+#define HEAP_POLICY_FIRST_FIT    0
+#define HEAP_POLICY_BEST_FIT     1
+#define HEAP_POLICY_NEXT_FIT     2
+
+/* Acceptable values for configTIMER_LIST_IMPLEMENTATION. */
+#define TIMER_LIST_SORTED          0
+#define TIMER_LIST_TIMING_WHEEL    1
+#define TIMER_LIST_SKIP_LIST       2
+
+/* Acceptable values for configEVENT_LIST_IMPLEMENTATION. */
+#define EVENT_LIST_SORTED       0
+#define EVENT_LIST_SKIP_LIST    1
+
 /* Application specific configuration options. */
 #include "FreeRTOSConfig.h"
 
@@ -201,6 +220,105 @@
     #error Macro configTICK_TYPE_WIDTH_IN_BITS is defined to incorrect value.  See the Configuration section of the FreeRTOS API documentation for details.
 #endif
 
+#ifndef configUSE_NON_WRAPPING_TICK_COUNT
+    #define configUSE_NON_WRAPPING_TICK_COUNT    0
+#endif
+
+#if ( ( configUSE_NON_WRAPPING_TICK_COUNT == 1 ) && ( configTICK_TYPE_WIDTH_IN_BITS != TICK_TYPE_WIDTH_64_BITS ) )
+    #error configUSE_NON_WRAPPING_TICK_COUNT requires configTICK_TYPE_WIDTH_IN_BITS to be set to TICK_TYPE_WIDTH_64_BITS.
+#endif
+
+#ifndef configUSE_TICK_COUNT_SEQLOCK
+    #define configUSE_TICK_COUNT_SEQLOCK    0
+#endif
+
+#ifndef configDELAYED_LIST_IMPLEMENTATION
+    #define configDELAYED_LIST_IMPLEMENTATION    DELAYED_LIST_SORTED
+#endif
+
+#if ( ( configDELAYED_LIST_IMPLEMENTATION != DELAYED_LIST_SORTED ) &&       \
+    ( configDELAYED_LIST_IMPLEMENTATION != DELAYED_LIST_TIMING_WHEEL ) && \
+    ( configDELAYED_LIST_IMPLEMENTATION != DELAYED_LIST_SKIP_LIST ) )
+    #error Macro configDELAYED_LIST_IMPLEMENTATION is defined to incorrect value.  See the Configuration section of the FreeRTOS API documentation for details.
+#endif
+
+#ifndef configDELAYED_WHEEL_SLOTS
+    #define configDELAYED_WHEEL_SLOTS    64
+#endif
+
+#if ( configDELAYED_LIST_IMPLEMENTATION == DELAYED_LIST_TIMING_WHEEL )
+    #if ( ( configDELAYED_WHEEL_SLOTS < 2 ) || ( ( configDELAYED_WHEEL_SLOTS & ( configDELAYED_WHEEL_SLOTS - 1 ) ) != 0 ) )
+        #error configDELAYED_WHEEL_SLOTS must be a power of two and at least 2.
+    #endif
+
+    #if ( ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS ) && ( configDELAYED_WHEEL_SLOTS > 256 ) )
+        #error configDELAYED_WHEEL_SLOTS must not exceed 256 when TickType_t is 16 bits.
+    #endif
+#endif
+
+#ifndef configTIMER_LIST_IMPLEMENTATION
+    #define configTIMER_LIST_IMPLEMENTATION    TIMER_LIST_SORTED
+#endif
+
+#if ( ( configTIMER_LIST_IMPLEMENTATION != TIMER_LIST_SORTED ) &&       \
+    ( configTIMER_LIST_IMPLEMENTATION != TIMER_LIST_TIMING_WHEEL ) && \
+    ( configTIMER_LIST_IMPLEMENTATION != TIMER_LIST_SKIP_LIST ) )
+    #error Macro configTIMER_LIST_IMPLEMENTATION is defined to incorrect value.  See the Configuration section of the FreeRTOS API documentation for details.
+#endif
+
+#ifndef configTIMER_WHEEL_SLOTS
+    #define configTIMER_WHEEL_SLOTS    64
+#endif
+
+#if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+    #if ( ( configTIMER_WHEEL_SLOTS < 2 ) || ( ( configTIMER_WHEEL_SLOTS & ( configTIMER_WHEEL_SLOTS - 1 ) ) != 0 ) )
+        #error configTIMER_WHEEL_SLOTS must be a power of two and at least 2.
+    #endif
+#endif
+
+#ifndef configEVENT_LIST_IMPLEMENTATION
+    #define configEVENT_LIST_IMPLEMENTATION    EVENT_LIST_SORTED
+#endif
+
+#if ( ( configEVENT_LIST_IMPLEMENTATION != EVENT_LIST_SORTED ) && \
+    ( configEVENT_LIST_IMPLEMENTATION != EVENT_LIST_SKIP_LIST ) )
+    #error Macro configEVENT_LIST_IMPLEMENTATION is defined to incorrect value.  See the Configuration section of the FreeRTOS API documentation for details.
+#endif
+
+#ifndef configUSE_SKIP_LISTS
+    #if ( ( configDELAYED_LIST_IMPLEMENTATION == DELAYED_LIST_SKIP_LIST ) || \
+    ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_SKIP_LIST ) ||           \
+    ( configEVENT_LIST_IMPLEMENTATION == EVENT_LIST_SKIP_LIST ) )
+        #define configUSE_SKIP_LISTS    1
+    #else
+        #define configUSE_SKIP_LISTS    0
+    #endif
+#endif
+
+#ifndef configSKIP_LIST_LANES
+    #define configSKIP_LIST_LANES    4
+#endif
+
+#if ( configUSE_SKIP_LISTS == 0 )
+    #if ( ( configDELAYED_LIST_IMPLEMENTATION == DELAYED_LIST_SKIP_LIST ) || \
+    ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_SKIP_LIST ) ||           \
+    ( configEVENT_LIST_IMPLEMENTATION == EVENT_LIST_SKIP_LIST ) )
+        #error configUSE_SKIP_LISTS must be 1 when a list implementation is set to a skip list.
+    #endif
+#else
+    #if ( ( configSKIP_LIST_LANES < 1 ) || ( configSKIP_LIST_LANES > 8 ) )
+        #error configSKIP_LIST_LANES must be between 1 and 8.
+    #endif
+#endif
+
+#ifndef configUSE_LIST_LINK_CHECKS
+    #define configUSE_LIST_LINK_CHECKS    0
+#endif
+
+#if ( ( configUSE_LIST_LINK_CHECKS < 0 ) || ( configUSE_LIST_LINK_CHECKS > 2 ) )
+    #error configUSE_LIST_LINK_CHECKS must be 0, 1 or 2.
+#endif
+
 #ifndef configUSE_CO_ROUTINES
     #define configUSE_CO_ROUTINES    0
 #endif
@@ -259,6 +377,10 @@
     #define INCLUDE_xTaskAbortDelay    0
 #endif
 
+#ifndef INCLUDE_xTaskYieldIfHigherReady
+    #define INCLUDE_xTaskYieldIfHigherReady    0
+#endif
+
 #ifndef INCLUDE_xQueueGetMutexHolder
     #define INCLUDE_xQueueGetMutexHolder    0
 #endif
@@ -279,6 +401,16 @@
     #define INCLUDE_uxTaskGetStackHighWaterMark2    0
 #endif
 
+#ifndef INCLUDE_uxTaskGetISRStackHighWaterMark
+    #define INCLUDE_uxTaskGetISRStackHighWaterMark    0
+#endif
+
+/* The port reports where each core's interrupt stack is by implementing
+ * vPortGetISRStack(), and paints the stacks with portISR_STACK_FILL_BYTE. */
+#if ( ( INCLUDE_uxTaskGetISRStackHighWaterMark == 1 ) && !defined( portISR_STACK_FILL_BYTE ) )
+    #error INCLUDE_uxTaskGetISRStackHighWaterMark requires a port that uses a dedicated interrupt stack on each core and defines portISR_STACK_FILL_BYTE.
+#endif
+
 #ifndef INCLUDE_eTaskGetState
     #define INCLUDE_eTaskGetState    0
 #endif
@@ -305,6 +437,10 @@
     #endif
 #endif
 
+#ifndef configUSE_PER_CORE_CO_ROUTINES
+    #define configUSE_PER_CORE_CO_ROUTINES    0
+#endif
+
 #ifndef configUSE_APPLICATION_TASK_TAG
     #define configUSE_APPLICATION_TASK_TAG    0
 #endif
@@ -321,6 +457,19 @@
     #define configUSE_MUTEXES    0
 #endif
 
+/* The number of times a task polls a mutex held by a task running on another
+ * core before blocking on the mutex.  Only used when configNUMBER_OF_CORES is
+ * greater than 1.  0 means always block straight away. */
+#ifndef configMUTEX_SPIN_ITERATIONS
+    #define configMUTEX_SPIN_ITERATIONS    0
+#endif
+
+/* Set to 1 to have a mutex that is given while tasks are waiting for it pass
+ * straight to the highest priority waiting task. */
+#ifndef configUSE_MUTEX_HANDOFF
+    #define configUSE_MUTEX_HANDOFF    0
+#endif
+
 #ifndef configUSE_TIMERS
     #define configUSE_TIMERS    0
 #endif
@@ -351,6 +500,10 @@
     #define configUSE_TASK_PREEMPTION_DISABLE    0
 #endif
 
+#ifndef configUSE_PREEMPTION_THRESHOLDS
+    #define configUSE_PREEMPTION_THRESHOLDS    0
+#endif
+
 #ifndef configUSE_ALTERNATIVE_API
     #define configUSE_ALTERNATIVE_API    0
 #endif
@@ -367,6 +520,31 @@
     #define configIDLE_SHOULD_YIELD    1
 #endif
 
+/* The most deleted tasks the idle task frees on each pass through its loop, or
+ * 0 to free all of them at once. */
+#ifndef configIDLE_TASK_CLEANUP_BUDGET
+    #define configIDLE_TASK_CLEANUP_BUDGET    0
+#endif
+
+#ifndef configUSE_IDLE_WORK_QUEUE
+    #define configUSE_IDLE_WORK_QUEUE    0
+#endif
+
+/* The number of calls each core's idle work queue holds. */
+#ifndef configIDLE_WORK_QUEUE_LENGTH
+    #define configIDLE_WORK_QUEUE_LENGTH    8U
+#endif
+
+#if ( configUSE_IDLE_WORK_QUEUE == 1 )
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_IDLE_WORK_QUEUE is not supported when portUSING_MPU_WRAPPERS is 1.
+    #endif
+
+    #if ( configIDLE_WORK_QUEUE_LENGTH < 1 )
+        #error configIDLE_WORK_QUEUE_LENGTH must be at least 1.
+    #endif
+#endif
+
 #if configMAX_TASK_NAME_LEN < 1
     #error configMAX_TASK_NAME_LEN must be set to a minimum of 1 in FreeRTOSConfig.h
 #endif
@@ -406,6 +584,50 @@
     #define configRUN_MULTIPLE_PRIORITIES    0
 #endif
 
+#ifndef configUSE_SMP_READY_PRIORITY_BITMAP
+    #define configUSE_SMP_READY_PRIORITY_BITMAP    0
+#endif
+
+#ifndef configUSE_PER_CORE_READY_LISTS
+    #define configUSE_PER_CORE_READY_LISTS    0
+#endif
+
+#ifndef configUSE_SOFT_AFFINITY
+    #define configUSE_SOFT_AFFINITY    0
+#endif
+
+#ifndef configUSE_DEFERRED_CORE_YIELDS
+    #define configUSE_DEFERRED_CORE_YIELDS    0
+#endif
+
+#ifndef configUSE_TASK_GANGS
+    #define configUSE_TASK_GANGS    0
+#endif
+
+#ifndef configUSE_CORE_LOCAL_SUSPEND
+    #define configUSE_CORE_LOCAL_SUSPEND    0
+#endif
+
+#ifndef configUSE_CORE_TOPOLOGY
+    #define configUSE_CORE_TOPOLOGY    0
+#endif
+
+#ifndef configUSE_CACHE_LINE_PADDING
+    #define configUSE_CACHE_LINE_PADDING    0
+#endif
+
+#ifndef configCACHE_LINE_SIZE
+    #define configCACHE_LINE_SIZE    64
+#endif
+
+#ifndef configSOFT_AFFINITY_MIGRATION_THRESHOLD
+    #define configSOFT_AFFINITY_MIGRATION_THRESHOLD    2U
+#endif
+
+#ifndef configUSE_GRANULAR_LOCKS
+    #define configUSE_GRANULAR_LOCKS    0
+#endif
+
 #ifndef portGET_CORE_ID
 
     #if ( configNUMBER_OF_CORES == 1 )
@@ -482,6 +704,26 @@
 
 #endif /* portGET_ISR_LOCK */
 
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+    #ifndef portSPINLOCK_TYPE
+        #error portSPINLOCK_TYPE is required when configUSE_GRANULAR_LOCKS is 1
+    #endif
+
+    #ifndef portINIT_SPINLOCK
+        #error portINIT_SPINLOCK is required when configUSE_GRANULAR_LOCKS is 1
+    #endif
+
+    #ifndef portGET_SPINLOCK
+        #error portGET_SPINLOCK is required when configUSE_GRANULAR_LOCKS is 1
+    #endif
+
+    #ifndef portRELEASE_SPINLOCK
+        #error portRELEASE_SPINLOCK is required when configUSE_GRANULAR_LOCKS is 1
+    #endif
+
+#endif /* configUSE_GRANULAR_LOCKS */
+
 #ifndef portENTER_CRITICAL_FROM_ISR
 
     #if ( configNUMBER_OF_CORES > 1 )
@@ -533,2330 +775,5799 @@
 
 #endif /* configUSE_TIMERS */
 
-#ifndef portHAS_NESTED_INTERRUPTS
-    #if defined( portSET_INTERRUPT_MASK_FROM_ISR ) && defined( portCLEAR_INTERRUPT_MASK_FROM_ISR )
-        #define portHAS_NESTED_INTERRUPTS    1
-    #else
-        #define portHAS_NESTED_INTERRUPTS    0
-    #endif
+#ifndef configUSE_TIMER_DIRECT_RESET
+    #define configUSE_TIMER_DIRECT_RESET    0
 #endif
 
-#ifndef portSET_INTERRUPT_MASK_FROM_ISR
-    #if ( portHAS_NESTED_INTERRUPTS == 1 )
-        #error portSET_INTERRUPT_MASK_FROM_ISR must be defined for ports that support nested interrupts (i.e. portHAS_NESTED_INTERRUPTS is set to 1)
-    #else
-        #define portSET_INTERRUPT_MASK_FROM_ISR()    0
-    #endif
-#else
-    #if ( portHAS_NESTED_INTERRUPTS == 0 )
-        #error portSET_INTERRUPT_MASK_FROM_ISR must not be defined for ports that do not support nested interrupts (i.e. portHAS_NESTED_INTERRUPTS is set to 0)
-    #endif
+#if ( ( configUSE_TIMER_DIRECT_RESET == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_TIMER_DIRECT_RESET is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef portCLEAR_INTERRUPT_MASK_FROM_ISR
-    #if ( portHAS_NESTED_INTERRUPTS == 1 )
-        #error portCLEAR_INTERRUPT_MASK_FROM_ISR must be defined for ports that support nested interrupts  (i.e. portHAS_NESTED_INTERRUPTS is set to 1)
-    #else
-        #define portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedStatusValue )    ( void ) ( uxSavedStatusValue )
-    #endif
-#else
-    #if ( portHAS_NESTED_INTERRUPTS == 0 )
-        #error portCLEAR_INTERRUPT_MASK_FROM_ISR must not be defined for ports that do not support nested interrupts (i.e. portHAS_NESTED_INTERRUPTS is set to 0)
-    #endif
+#ifndef configUSE_TIMER_GROUPS
+    #define configUSE_TIMER_GROUPS    0
 #endif
 
-#ifndef portCLEAN_UP_TCB
-    #define portCLEAN_UP_TCB( pxTCB )    ( void ) ( pxTCB )
+#if ( ( configUSE_TIMER_GROUPS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_TIMER_GROUPS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef portPRE_TASK_DELETE_HOOK
-    #define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxYieldPending )
+#ifndef configUSE_TIMER_SLACK
+    #define configUSE_TIMER_SLACK    0
 #endif
 
-#ifndef portSETUP_TCB
-    #define portSETUP_TCB( pxTCB )    ( void ) ( pxTCB )
+#if ( ( configUSE_TIMER_SLACK == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_TIMER_SLACK is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef portTASK_SWITCH_HOOK
-    #define portTASK_SWITCH_HOOK( pxTCB )    ( void ) ( pxTCB )
+#ifndef configTIMER_SERVICE_TASKS
+    #define configTIMER_SERVICE_TASKS    1
 #endif
 
-#ifndef configQUEUE_REGISTRY_SIZE
-    #define configQUEUE_REGISTRY_SIZE    0U
+#if ( configTIMER_SERVICE_TASKS < 1 )
+    #error configTIMER_SERVICE_TASKS must be at least 1.
 #endif
 
-#if ( configQUEUE_REGISTRY_SIZE < 1 )
-    #define vQueueAddToRegistry( xQueue, pcName )
-    #define vQueueUnregisterQueue( xQueue )
-    #define pcQueueGetName( xQueue )
+#if ( ( configTIMER_SERVICE_TASKS > 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configTIMER_SERVICE_TASKS must be 1 when the MPU wrappers are used.
 #endif
 
-#ifndef configUSE_MINI_LIST_ITEM
-    #define configUSE_MINI_LIST_ITEM    1
+#ifndef configTIMER_SERVICE_TASK_PER_CORE
+    #define configTIMER_SERVICE_TASK_PER_CORE    0
 #endif
 
-#ifndef portPOINTER_SIZE_TYPE
-    #define portPOINTER_SIZE_TYPE    uint32_t
+#ifndef configUSE_HARD_TIMERS
+    #define configUSE_HARD_TIMERS    0
 #endif
 
-/* Remove any unused trace macros. */
-#ifndef traceSTART
+#if ( configUSE_HARD_TIMERS == 1 )
+    #if ( configUSE_TIMERS != 1 )
+        #error configUSE_HARD_TIMERS requires configUSE_TIMERS to be set to 1.
+    #endif
 
-/* Used to perform any necessary initialisation - for example, open a file
- * into which trace is to be written. */
-    #define traceSTART()
-#endif
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_HARD_TIMERS is not supported when the MPU wrappers are used.
+    #endif
 
-#ifndef traceEND
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        #error configUSE_HARD_TIMERS is not supported when configUSE_GRANULAR_LOCKS is set to 1.
+    #endif
+#endif /* configUSE_HARD_TIMERS */
 
-/* Use to close a trace, for example close a file into which trace has been
- * written. */
-    #define traceEND()
+#ifndef configUSE_SPSC_QUEUES
+    #define configUSE_SPSC_QUEUES    0
 #endif
 
-#ifndef traceTASK_SWITCHED_IN
+#if ( ( configUSE_SPSC_QUEUES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_SPSC_QUEUES is not supported when the MPU wrappers are used.
+#endif
 
-/* Called after a task has been selected to run.  pxCurrentTCB holds a pointer
- * to the task control block of the selected task. */
-    #define traceTASK_SWITCHED_IN()
+#ifndef configUSE_RING_QUEUES
+    #define configUSE_RING_QUEUES    0
 #endif
 
-#ifndef traceSTARTING_SCHEDULER
+#if ( ( configUSE_RING_QUEUES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_RING_QUEUES is not supported when the MPU wrappers are used.
+#endif
 
-/* Called after all idle tasks and timer task (if enabled) have been created
- * successfully, just before the scheduler is started. */
-    #define traceSTARTING_SCHEDULER( xIdleTaskHandles )
+#ifndef configUSE_PRIORITY_QUEUES
+    #define configUSE_PRIORITY_QUEUES    0
 #endif
 
-#ifndef traceINCREASE_TICK_COUNT
+#if ( ( configUSE_PRIORITY_QUEUES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_PRIORITY_QUEUES is not supported when the MPU wrappers are used.
+#endif
 
-/* Called before stepping the tick count after waking from tickless idle
- * sleep. */
-    #define traceINCREASE_TICK_COUNT( x )
+#ifndef configUSE_RPC_QUEUES
+    #define configUSE_RPC_QUEUES    0
 #endif
 
-#ifndef traceLOW_POWER_IDLE_BEGIN
-    /* Called immediately before entering tickless idle. */
-    #define traceLOW_POWER_IDLE_BEGIN()
+#if ( ( configUSE_RPC_QUEUES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_RPC_QUEUES requires configUSE_MUTEXES to be set to 1.
 #endif
 
-#ifndef traceLOW_POWER_IDLE_END
-    /* Called when returning to the Idle task after a tickless idle. */
-    #define traceLOW_POWER_IDLE_END()
+#if ( ( configUSE_RPC_QUEUES == 1 ) && ( INCLUDE_uxTaskPriorityGet != 1 ) )
+    #error configUSE_RPC_QUEUES requires INCLUDE_uxTaskPriorityGet to be set to 1.
 #endif
 
-#ifndef traceTASK_SWITCHED_OUT
+#if ( ( configUSE_RPC_QUEUES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_RPC_QUEUES is not supported when the MPU wrappers are used.
+#endif
 
-/* Called before a task has been selected to run.  pxCurrentTCB holds a pointer
- * to the task control block of the task being switched out. */
-    #define traceTASK_SWITCHED_OUT()
+#if ( ( configUSE_RPC_QUEUES == 1 ) && ( configUSE_GRANULAR_LOCKS == 1 ) )
+    #error configUSE_RPC_QUEUES cannot be used with configUSE_GRANULAR_LOCKS as the lists of tasks waiting for replies are only protected by suspending the scheduler.
 #endif
 
-#ifndef traceTASK_PRIORITY_INHERIT
+#ifndef configUSE_STREAM_BUFFER_SEGMENTS
+    #define configUSE_STREAM_BUFFER_SEGMENTS    0
+#endif
 
-/* Called when a task attempts to take a mutex that is already held by a
- * lower priority task.  pxTCBOfMutexHolder is a pointer to the TCB of the task
- * that holds the mutex.  uxInheritedPriority is the priority the mutex holder
- * will inherit (the priority of the task that is attempting to obtain the
- * muted. */
-    #define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority )
+#if ( ( configUSE_STREAM_BUFFER_SEGMENTS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_STREAM_BUFFER_SEGMENTS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceTASK_PRIORITY_DISINHERIT
+#ifndef configUSE_ZERO_COPY_STREAM_BUFFERS
+    #define configUSE_ZERO_COPY_STREAM_BUFFERS    0
+#endif
 
-/* Called when a task releases a mutex, the holding of which had resulted in
- * the task inheriting the priority of a higher priority task.
- * pxTCBOfMutexHolder is a pointer to the TCB of the task that is releasing the
- * mutex.  uxOriginalPriority is the task's configured (base) priority. */
-    #define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority )
+#if ( ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_ZERO_COPY_STREAM_BUFFERS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceBLOCKING_ON_QUEUE_RECEIVE
+#ifndef configUSE_BROADCAST_STREAM_BUFFERS
+    #define configUSE_BROADCAST_STREAM_BUFFERS    0
+#endif
 
-/* Task is about to block because it cannot read from a
- * queue/mutex/semaphore.  pxQueue is a pointer to the queue/mutex/semaphore
- * upon which the read was attempted.  pxCurrentTCB points to the TCB of the
- * task that attempted the read. */
-    #define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )
+#if ( ( configUSE_BROADCAST_STREAM_BUFFERS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_BROADCAST_STREAM_BUFFERS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceBLOCKING_ON_QUEUE_PEEK
+#ifndef configUSE_STREAM_BUFFER_PIPELINES
+    #define configUSE_STREAM_BUFFER_PIPELINES    0
+#endif
 
-/* Task is about to block because it cannot read from a
- * queue/mutex/semaphore.  pxQueue is a pointer to the queue/mutex/semaphore
- * upon which the read was attempted.  pxCurrentTCB points to the TCB of the
- * task that attempted the read. */
-    #define traceBLOCKING_ON_QUEUE_PEEK( pxQueue )
+#if ( ( configUSE_STREAM_BUFFER_PIPELINES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_STREAM_BUFFER_PIPELINES is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceBLOCKING_ON_QUEUE_SEND
+#ifndef configUSE_ALIGNED_STREAM_BUFFERS
+    #define configUSE_ALIGNED_STREAM_BUFFERS    0
+#endif
 
-/* Task is about to block because it cannot write to a
- * queue/mutex/semaphore.  pxQueue is a pointer to the queue/mutex/semaphore
- * upon which the write was attempted.  pxCurrentTCB points to the TCB of the
- * task that attempted the write. */
-    #define traceBLOCKING_ON_QUEUE_SEND( pxQueue )
+#ifndef configSTREAM_BUFFER_STORAGE_ALIGNMENT
+    #define configSTREAM_BUFFER_STORAGE_ALIGNMENT    portBYTE_ALIGNMENT
 #endif
 
-#ifndef configCHECK_FOR_STACK_OVERFLOW
-    #define configCHECK_FOR_STACK_OVERFLOW    0
+#ifndef configUSE_STREAM_BUFFER_CACHE_MAINTENANCE
+    #define configUSE_STREAM_BUFFER_CACHE_MAINTENANCE    0
 #endif
 
-#ifndef configRECORD_STACK_HIGH_ADDRESS
-    #define configRECORD_STACK_HIGH_ADDRESS    0
+#if ( configUSE_STREAM_BUFFER_CACHE_MAINTENANCE == 1 )
+    #if !defined( portCLEAN_DCACHE_RANGE ) || !defined( portINVALIDATE_DCACHE_RANGE )
+        #error configUSE_STREAM_BUFFER_CACHE_MAINTENANCE is 1 but the port does not define portCLEAN_DCACHE_RANGE and portINVALIDATE_DCACHE_RANGE.
+    #endif
 #endif
 
-#ifndef configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H
-    #define configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H    0
+#ifndef configUSE_STREAM_BUFFER_MAX_LATENCY
+    #define configUSE_STREAM_BUFFER_MAX_LATENCY    0
 #endif
 
-/* The following event macros are embedded in the kernel API calls. */
+#if ( ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_STREAM_BUFFER_MAX_LATENCY is not supported when the MPU wrappers are used.
+#endif
 
-#ifndef traceMOVED_TASK_TO_READY_STATE
-    #define traceMOVED_TASK_TO_READY_STATE( pxTCB )
+#ifndef configUSE_STREAM_BUFFER_WATERMARKS
+    #define configUSE_STREAM_BUFFER_WATERMARKS    0
 #endif
 
-#ifndef tracePOST_MOVED_TASK_TO_READY_STATE
-    #define tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#if ( ( configUSE_STREAM_BUFFER_WATERMARKS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_STREAM_BUFFER_WATERMARKS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceMOVED_TASK_TO_DELAYED_LIST
-    #define traceMOVED_TASK_TO_DELAYED_LIST()
+/* The number of times a task polls a stream buffer for data or space before
+ * blocking on it.  Only used when configNUMBER_OF_CORES is greater than 1.  0
+ * means always block straight away. */
+#ifndef configSTREAM_BUFFER_SPIN_ITERATIONS
+    #define configSTREAM_BUFFER_SPIN_ITERATIONS    0
 #endif
 
-#ifndef traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST
-    #define traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST()
+#ifndef configUSE_COMPILER_ATOMICS
+    #define configUSE_COMPILER_ATOMICS    0
 #endif
 
-#ifndef traceQUEUE_CREATE
-    #define traceQUEUE_CREATE( pxNewQueue )
+/* When compiler atomics are used, and the port does not provide its own, the
+ * compare and swap used by the kernel's lock-free features is the compiler's
+ * native 32-bit compare and swap. */
+#if ( ( configUSE_COMPILER_ATOMICS == 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) && defined( __GCC_ATOMIC_INT_LOCK_FREE ) )
+    #if ( __GCC_ATOMIC_INT_LOCK_FREE == 2 )
+        #define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand )    ( ( uint32_t ) __sync_bool_compare_and_swap( ( pulDestination ), ( ulComparand ), ( ulExchange ) ) )
+    #endif
 #endif
 
-#ifndef traceQUEUE_CREATE_FAILED
-    #define traceQUEUE_CREATE_FAILED( ucQueueType )
+#ifndef configUSE_MPMC_QUEUES
+    #define configUSE_MPMC_QUEUES    0
 #endif
 
-#ifndef traceCREATE_MUTEX
-    #define traceCREATE_MUTEX( pxNewQueue )
+#if ( ( configUSE_MPMC_QUEUES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_MPMC_QUEUES is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceCREATE_MUTEX_FAILED
-    #define traceCREATE_MUTEX_FAILED()
+/* The compare and swap MPMC queues use when the port does not provide one only
+ * masks interrupts on the calling core, so SMP ports must provide their own. */
+#if ( ( configUSE_MPMC_QUEUES == 1 ) && ( configNUMBER_OF_CORES > 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) )
+    #error configUSE_MPMC_QUEUES requires the port to define portATOMIC_COMPARE_AND_SWAP_U32 when configNUMBER_OF_CORES is greater than 1.
 #endif
 
-#ifndef traceGIVE_MUTEX_RECURSIVE
-    #define traceGIVE_MUTEX_RECURSIVE( pxMutex )
+#ifndef configUSE_ATOMIC_SEMAPHORES
+    #define configUSE_ATOMIC_SEMAPHORES    0
 #endif
 
-#ifndef traceGIVE_MUTEX_RECURSIVE_FAILED
+#if ( ( configUSE_ATOMIC_SEMAPHORES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_ATOMIC_SEMAPHORES is not supported when the MPU wrappers are used.
+#endif
+
+#if ( ( configUSE_ATOMIC_SEMAPHORES == 1 ) && ( configNUMBER_OF_CORES > 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) )
+    #error configUSE_ATOMIC_SEMAPHORES requires the port to define portATOMIC_COMPARE_AND_SWAP_U32 when configNUMBER_OF_CORES is greater than 1.
+#endif
+
+#ifndef configUSE_QUEUE_MULTIPLE_ITEMS
+    #define configUSE_QUEUE_MULTIPLE_ITEMS    0
+#endif
+
+#if ( ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_QUEUE_MULTIPLE_ITEMS is not supported when the MPU wrappers are used.
+#endif
+
+#ifndef configUSE_ZERO_COPY_QUEUES
+    #define configUSE_ZERO_COPY_QUEUES    0
+#endif
+
+#if ( ( configUSE_ZERO_COPY_QUEUES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_ZERO_COPY_QUEUES is not supported when the MPU wrappers are used.
+#endif
+
+/* Set to 0 if the application never sends to the front of a queue, or never
+ * overwrites an item in a queue, so the kernel is built without handling
+ * those cases.  The CMake build sets both from FREERTOS_QUEUE_COPY_POSITIONS
+ * when that is defined. */
+#ifndef configQUEUE_SEND_TO_FRONT_USED
+    #define configQUEUE_SEND_TO_FRONT_USED    1
+#endif
+
+#ifndef configQUEUE_OVERWRITE_USED
+    #define configQUEUE_OVERWRITE_USED    1
+#endif
+
+#ifndef configUSE_QUEUE_WAIT_FOR_ANY
+    #define configUSE_QUEUE_WAIT_FOR_ANY    0
+#endif
+
+#if ( ( configUSE_QUEUE_WAIT_FOR_ANY == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_QUEUE_WAIT_FOR_ANY is not supported when the MPU wrappers are used.
+#endif
+
+#ifndef configUSE_QUEUE_SET_READY_BITMAP
+    #define configUSE_QUEUE_SET_READY_BITMAP    0
+#endif
+
+/* The task notification xQueueWaitForAny() blocks on.  The last index is used
+ * by default, so an application that uses the default index for its own
+ * notifications can set configTASK_NOTIFICATION_ARRAY_ENTRIES to 2. */
+#ifndef configQUEUE_WAIT_FOR_ANY_NOTIFICATION_INDEX
+    #define configQUEUE_WAIT_FOR_ANY_NOTIFICATION_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+#endif
+
+#ifndef configUSE_EVENT_GROUP_WAKE_ONE
+    #define configUSE_EVENT_GROUP_WAKE_ONE    0
+#endif
+
+#if ( ( configUSE_EVENT_GROUP_WAKE_ONE == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_EVENT_GROUP_WAKE_ONE is not supported when the MPU wrappers are used.
+#endif
+
+#ifndef configUSE_64_BIT_EVENT_GROUPS
+    #define configUSE_64_BIT_EVENT_GROUPS    0
+#endif
+
+#if ( ( configUSE_64_BIT_EVENT_GROUPS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_64_BIT_EVENT_GROUPS is not supported when the MPU wrappers are used.
+#endif
+
+#ifndef configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR
+    #define configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR    0
+#endif
+
+#if ( ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR is not supported when the MPU wrappers are used.
+#endif
+
+/* The most waiting tasks xEventGroupSetBitsFromISR() tests before it leaves
+ * the rest to the timer task. */
+#ifndef configEVENT_GROUP_SET_BITS_FROM_ISR_MAX_TESTS
+    #define configEVENT_GROUP_SET_BITS_FROM_ISR_MAX_TESTS    4
+#endif
+
+#ifndef portHAS_NESTED_INTERRUPTS
+    #if defined( portSET_INTERRUPT_MASK_FROM_ISR ) && defined( portCLEAR_INTERRUPT_MASK_FROM_ISR )
+        #define portHAS_NESTED_INTERRUPTS    1
+    #else
+        #define portHAS_NESTED_INTERRUPTS    0
+    #endif
+#endif
+
+#ifndef portSET_INTERRUPT_MASK_FROM_ISR
+    #if ( portHAS_NESTED_INTERRUPTS == 1 )
+        #error portSET_INTERRUPT_MASK_FROM_ISR must be defined for ports that support nested interrupts (i.e. portHAS_NESTED_INTERRUPTS is set to 1)
+    #else
+        #define portSET_INTERRUPT_MASK_FROM_ISR()    0
+    #endif
+#else
+    #if ( portHAS_NESTED_INTERRUPTS == 0 )
+        #error portSET_INTERRUPT_MASK_FROM_ISR must not be defined for ports that do not support nested interrupts (i.e. portHAS_NESTED_INTERRUPTS is set to 0)
+    #endif
+#endif
+
+#ifndef portCLEAR_INTERRUPT_MASK_FROM_ISR
+    #if ( portHAS_NESTED_INTERRUPTS == 1 )
+        #error portCLEAR_INTERRUPT_MASK_FROM_ISR must be defined for ports that support nested interrupts  (i.e. portHAS_NESTED_INTERRUPTS is set to 1)
+    #else
+        #define portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedStatusValue )    ( void ) ( uxSavedStatusValue )
+    #endif
+#else
+    #if ( portHAS_NESTED_INTERRUPTS == 0 )
+        #error portCLEAR_INTERRUPT_MASK_FROM_ISR must not be defined for ports that do not support nested interrupts (i.e. portHAS_NESTED_INTERRUPTS is set to 0)
+    #endif
+#endif
+
+#ifndef portCLEAN_UP_TCB
+    #define portCLEAN_UP_TCB( pxTCB )    ( void ) ( pxTCB )
+#endif
+
+#ifndef portPRE_TASK_DELETE_HOOK
+    #define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxYieldPending )
+#endif
+
+#ifndef portSETUP_TCB
+    #define portSETUP_TCB( pxTCB )    ( void ) ( pxTCB )
+#endif
+
+/* Called with the limit of the stack of the task about to run - the lowest
+ * address of the stack if it grows down - so ports with a hardware stack guard
+ * can move the guard to it. */
+#ifndef portSET_STACK_GUARD
+    #define portSET_STACK_GUARD( pxStackLimit )
+#endif
+
+#ifndef portTASK_SWITCH_HOOK
+    #define portTASK_SWITCH_HOOK( pxTCB )    ( void ) ( pxTCB )
+#endif
+
+#ifndef configUSE_TASK_VECTOR_UNIT_FLAG
+    #define configUSE_TASK_VECTOR_UNIT_FLAG    0
+#endif
+
+#if ( configUSE_TASK_VECTOR_UNIT_FLAG == 1 )
+    #ifndef portSET_VECTOR_UNIT_STATE
+        #error configUSE_TASK_VECTOR_UNIT_FLAG is 1 but the port does not define portSET_VECTOR_UNIT_STATE.
+    #endif
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_TASK_VECTOR_UNIT_FLAG is not supported when portUSING_MPU_WRAPPERS is 1.
+    #endif
+#endif
+
+#ifndef configQUEUE_REGISTRY_SIZE
+    #define configQUEUE_REGISTRY_SIZE    0U
+#endif
+
+#if ( configQUEUE_REGISTRY_SIZE < 1 )
+    #define vQueueAddToRegistry( xQueue, pcName )
+    #define vQueueUnregisterQueue( xQueue )
+    #define pcQueueGetName( xQueue )
+#endif
+
+#ifndef configUSE_QUEUE_REGISTRY_INDEX
+    #define configUSE_QUEUE_REGISTRY_INDEX    0
+#endif
+
+#ifndef configQUEUE_REGISTRY_INDEX_BUCKETS
+    #define configQUEUE_REGISTRY_INDEX_BUCKETS    configQUEUE_REGISTRY_SIZE
+#endif
+
+#if ( configUSE_QUEUE_REGISTRY_INDEX == 1 )
+    #if ( configQUEUE_REGISTRY_SIZE < 1 )
+        #error configQUEUE_REGISTRY_SIZE must be greater than 0 to use configUSE_QUEUE_REGISTRY_INDEX
+    #endif
+
+    #if ( configQUEUE_REGISTRY_INDEX_BUCKETS < 1 )
+        #error configQUEUE_REGISTRY_INDEX_BUCKETS must be at least 1
+    #endif
+#endif
+
+#ifndef configUSE_TASK_NAME_INDEX
+    #define configUSE_TASK_NAME_INDEX    0
+#endif
+
+#ifndef configTASK_NAME_INDEX_BUCKETS
+    #define configTASK_NAME_INDEX_BUCKETS    16
+#endif
+
+#if ( configUSE_TASK_NAME_INDEX == 1 )
+    #if ( INCLUDE_xTaskGetHandle != 1 )
+        #error INCLUDE_xTaskGetHandle must be set to 1 to use configUSE_TASK_NAME_INDEX
+    #endif
+
+    #if ( configTASK_NAME_INDEX_BUCKETS < 1 )
+        #error configTASK_NAME_INDEX_BUCKETS must be at least 1
+    #endif
+#endif
+
+#ifndef configUSE_MINI_LIST_ITEM
+    #define configUSE_MINI_LIST_ITEM    1
+#endif
+
+#ifndef portPOINTER_SIZE_TYPE
+    #define portPOINTER_SIZE_TYPE    uint32_t
+#endif
+
+#ifndef configUSE_ISR_RUN_TIME_STATS
+    #define configUSE_ISR_RUN_TIME_STATS    0
+#endif
+
+/* The number of interrupt numbers, counting from 0, for which the time spent
+ * in interrupts is also kept per interrupt number. */
+#ifndef configISR_RUN_TIME_STATS_VECTORS
+    #define configISR_RUN_TIME_STATS_VECTORS    64U
+#endif
+
+/* The number of nested interrupts that are measured separately.  Interrupts
+ * nested deeper are measured as part of the interrupt they interrupted. */
+#ifndef configISR_RUN_TIME_STATS_MAX_NESTING
+    #define configISR_RUN_TIME_STATS_MAX_NESTING    8U
+#endif
+
+#ifndef configUSE_CRITICAL_SECTION_STATS
+    #define configUSE_CRITICAL_SECTION_STATS    0
+#endif
+
+#ifndef configUSE_SWITCH_REASON_STATS
+    #define configUSE_SWITCH_REASON_STATS    0
+#endif
+
+#ifndef configUSE_CORE_LOAD_STATS
+    #define configUSE_CORE_LOAD_STATS    0
+#endif
+
+#ifndef configUSE_WAKE_SOURCE_STATS
+    #define configUSE_WAKE_SOURCE_STATS    0
+#endif
+
+/* The number of distinct wake sources the tickless idle wake source histogram
+ * can hold. */
+#ifndef configWAKE_SOURCE_HISTOGRAM_LENGTH
+    #define configWAKE_SOURCE_HISTOGRAM_LENGTH    8
+#endif
+
+/* The wake source a port reports to vTaskRecordTicklessSleep() for sleeps the
+ * tick interrupt ended. */
+#ifndef portTICK_WAKE_SOURCE
+    #define portTICK_WAKE_SOURCE    ( ( uint32_t ) 0xffffffffUL )
+#endif
+
+/* The length, in run time stats clock counts, of the sliding window over
+ * which xTaskGetCoreLoad() calculates the load of a core. */
+#ifndef configCORE_LOAD_WINDOW
+    #define configCORE_LOAD_WINDOW    100000U
+#endif
+
+#ifndef configUSE_DVFS_GOVERNOR
+    #define configUSE_DVFS_GOVERNOR    0
+#endif
+
+/* The number of ticks between calls to the application's DVFS governor. */
+#ifndef configDVFS_GOVERNOR_PERIOD
+    #define configDVFS_GOVERNOR_PERIOD    10
+#endif
+
+#ifndef configUSE_TRACE_RECORDER
+    #define configUSE_TRACE_RECORDER    0
+#endif
+
+/* Set to 1 to pass trace events to configTRACE_RECORDER_WRITE() as they occur
+ * instead of recording them in the trace recorder's ring buffers. */
+#ifndef configTRACE_RECORDER_STREAMING
+    #define configTRACE_RECORDER_STREAMING    0
+#endif
+
+/* The number of events each core's ring buffer holds.  Must be a power of 2. */
+#ifndef configTRACE_RECORDER_BUFFER_LENGTH
+    #define configTRACE_RECORDER_BUFFER_LENGTH    256U
+#endif
+
+/* The number of task and queue names the trace recorder holds. */
+#ifndef configTRACE_RECORDER_NAME_TABLE_LENGTH
+    #define configTRACE_RECORDER_NAME_TABLE_LENGTH    16U
+#endif
+
+/* The number of characters of each task and queue name the trace recorder
+ * holds.  Must be a multiple of 4. */
+#ifndef configTRACE_RECORDER_NAME_LENGTH
+    #define configTRACE_RECORDER_NAME_LENGTH    16U
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+    #if ( configUSE_TRACE_FACILITY != 1 )
+        #error configUSE_TRACE_RECORDER requires configUSE_TRACE_FACILITY to be set to 1.
+    #endif
+
+/* Read the free running timer the trace recorder timestamps events with, which
+ * must count at configTRACE_RECORDER_TIMESTAMP_HZ and be shared by all cores. */
+    #ifndef configTRACE_RECORDER_TIMESTAMP
+        #error configUSE_TRACE_RECORDER requires configTRACE_RECORDER_TIMESTAMP() to be defined.
+    #endif
+
+    #ifndef configTRACE_RECORDER_TIMESTAMP_HZ
+        #error configUSE_TRACE_RECORDER requires configTRACE_RECORDER_TIMESTAMP_HZ to be defined.
+    #endif
+
+/* Send uxLength bytes from pvData over the application's trace transport.
+ * Called with interrupts masked, from tasks and interrupts, and from more than
+ * one core at a time, so must not block. */
+    #if ( ( configTRACE_RECORDER_STREAMING == 1 ) && !defined( configTRACE_RECORDER_WRITE ) )
+        #error configTRACE_RECORDER_STREAMING requires configTRACE_RECORDER_WRITE( pvData, uxLength ) to be defined.
+    #endif
+
+    #if ( ( configTRACE_RECORDER_BUFFER_LENGTH & ( configTRACE_RECORDER_BUFFER_LENGTH - 1U ) ) != 0U )
+        #error configTRACE_RECORDER_BUFFER_LENGTH must be a power of 2.
+    #endif
+
+    #if ( ( configTRACE_RECORDER_NAME_LENGTH % 4U ) != 0U )
+        #error configTRACE_RECORDER_NAME_LENGTH must be a multiple of 4.
+    #endif
+
+/* The trace recorder defines the trace macros it uses, so must be included
+ * before the unused trace macros are removed below. */
+    #include "trace_recorder.h"
+#endif /* configUSE_TRACE_RECORDER */
+
+#ifndef configUSE_TELEMETRY
+    #define configUSE_TELEMETRY    0
+#endif
+
+#if ( ( configUSE_TELEMETRY == 1 ) && ( configUSE_TRACE_FACILITY != 1 ) )
+    #error configUSE_TELEMETRY requires configUSE_TRACE_FACILITY to be set to 1.
+#endif
+
+/* The interrupt run time stats are collected by the ISR trace macros, which the
+ * ports call on entry to and exit from their interrupt handlers.  If
+ * FreeRTOSConfig.h defines these macros itself then they must call
+ * vTaskISREnter() and vTaskISRExit() in the same way. */
+#if ( configUSE_ISR_RUN_TIME_STATS == 1 )
+    #ifndef traceISR_ENTER
+        #define traceISR_ENTER()    vTaskISREnter( portGET_INTERRUPT_NUMBER() )
+    #endif
+
+    #ifndef traceISR_EXIT
+        #define traceISR_EXIT()    vTaskISRExit( portGET_INTERRUPT_NUMBER(), pdFALSE )
+    #endif
+
+    #ifndef traceISR_EXIT_TO_SCHEDULER
+        #define traceISR_EXIT_TO_SCHEDULER()    vTaskISRExit( portGET_INTERRUPT_NUMBER(), pdTRUE )
+    #endif
+#endif /* configUSE_ISR_RUN_TIME_STATS */
+
+/* Remove any unused trace macros. */
+#ifndef traceSTART
+
+/* Used to perform any necessary initialisation - for example, open a file
+ * into which trace is to be written. */
+    #define traceSTART()
+#endif
+
+#ifndef traceEND
+
+/* Use to close a trace, for example close a file into which trace has been
+ * written. */
+    #define traceEND()
+#endif
+
+#ifndef traceTASK_SWITCHED_IN
+
+/* Called after a task has been selected to run.  pxCurrentTCB holds a pointer
+ * to the task control block of the selected task. */
+    #define traceTASK_SWITCHED_IN()
+#endif
+
+#ifndef traceSTARTING_SCHEDULER
+
+/* Called after all idle tasks and timer task (if enabled) have been created
+ * successfully, just before the scheduler is started. */
+    #define traceSTARTING_SCHEDULER( xIdleTaskHandles )
+#endif
+
+#ifndef traceINCREASE_TICK_COUNT
+
+/* Called before stepping the tick count after waking from tickless idle
+ * sleep. */
+    #define traceINCREASE_TICK_COUNT( x )
+#endif
+
+#ifndef traceLOW_POWER_IDLE_BEGIN
+    /* Called immediately before entering tickless idle. */
+    #define traceLOW_POWER_IDLE_BEGIN()
+#endif
+
+#ifndef traceLOW_POWER_IDLE_END
+    /* Called when returning to the Idle task after a tickless idle. */
+    #define traceLOW_POWER_IDLE_END()
+#endif
+
+#ifndef traceTASK_SWITCHED_OUT
+
+/* Called before a task has been selected to run.  pxCurrentTCB holds a pointer
+ * to the task control block of the task being switched out. */
+    #define traceTASK_SWITCHED_OUT()
+#endif
+
+#ifndef traceTASK_PRIORITY_INHERIT
+
+/* Called when a task attempts to take a mutex that is already held by a
+ * lower priority task.  pxTCBOfMutexHolder is a pointer to the TCB of the task
+ * that holds the mutex.  uxInheritedPriority is the priority the mutex holder
+ * will inherit (the priority of the task that is attempting to obtain the
+ * muted. */
+    #define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority )
+#endif
+
+#ifndef traceTASK_PRIORITY_DISINHERIT
+
+/* Called when a task releases a mutex, the holding of which had resulted in
+ * the task inheriting the priority of a higher priority task.
+ * pxTCBOfMutexHolder is a pointer to the TCB of the task that is releasing the
+ * mutex.  uxOriginalPriority is the task's configured (base) priority. */
+    #define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_RECEIVE
+
+/* Task is about to block because it cannot read from a
+ * queue/mutex/semaphore.  pxQueue is a pointer to the queue/mutex/semaphore
+ * upon which the read was attempted.  pxCurrentTCB points to the TCB of the
+ * task that attempted the read. */
+    #define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_WAIT_FOR_ANY
+
+/* Task is about to block in xQueueWaitForAny() because none of the
+ * uxQueueCount queues in pxQueues contain data. */
+    #define traceBLOCKING_ON_QUEUE_WAIT_FOR_ANY( pxQueues, uxQueueCount )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_PEEK
+
+/* Task is about to block because it cannot read from a
+ * queue/mutex/semaphore.  pxQueue is a pointer to the queue/mutex/semaphore
+ * upon which the read was attempted.  pxCurrentTCB points to the TCB of the
+ * task that attempted the read. */
+    #define traceBLOCKING_ON_QUEUE_PEEK( pxQueue )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_SEND
+
+/* Task is about to block because it cannot write to a
+ * queue/mutex/semaphore.  pxQueue is a pointer to the queue/mutex/semaphore
+ * upon which the write was attempted.  pxCurrentTCB points to the TCB of the
+ * task that attempted the write. */
+    #define traceBLOCKING_ON_QUEUE_SEND( pxQueue )
+#endif
+
+#ifndef configCHECK_FOR_STACK_OVERFLOW
+    #define configCHECK_FOR_STACK_OVERFLOW    0
+#endif
+
+#if ( ( portHAS_STACK_GUARD == 1 ) && ( configCHECK_FOR_STACK_OVERFLOW == 0 ) )
+    #error A port with a hardware stack guard reports overflows to vApplicationStackOverflowHook(), so configCHECK_FOR_STACK_OVERFLOW must be greater than 0.
+#endif
+
+#ifndef configRECORD_STACK_HIGH_ADDRESS
+    #define configRECORD_STACK_HIGH_ADDRESS    0
+#endif
+
+#ifndef configUSE_LAZY_STACK_PAINTING
+    #define configUSE_LAZY_STACK_PAINTING    0
+#endif
+
+/* The number of bytes at the limit of a task's stack that are filled when the
+ * task is created when configUSE_LAZY_STACK_PAINTING is 1.  Must cover the 20
+ * bytes checked when configCHECK_FOR_STACK_OVERFLOW is 2. */
+#ifndef configSTACK_PAINT_GUARD_SIZE
+    #define configSTACK_PAINT_GUARD_SIZE    64U
+#endif
+
+/* The most bytes of a task's stack the idle task fills each time it runs when
+ * configUSE_LAZY_STACK_PAINTING is 1.  The fill is done in a critical section. */
+#ifndef configSTACK_PAINT_CHUNK_SIZE
+    #define configSTACK_PAINT_CHUNK_SIZE    256U
+#endif
+
+#if ( ( configUSE_LAZY_STACK_PAINTING == 1 ) && ( configSTACK_PAINT_GUARD_SIZE < 20U ) )
+    #error configSTACK_PAINT_GUARD_SIZE must be at least 20 so the whole region checked for a stack overflow is filled.
+#endif
+
+#ifndef configUSE_STACK_PEAK_PROFILING
+    #define configUSE_STACK_PEAK_PROFILING    0
+#endif
+
+/* Returns the program counter saved in the context at pxTopOfStack, so the
+ * deepest stack sample can be attributed to the function that was running.
+ * Ports that cannot locate the saved program counter leave it undefined and
+ * peaks are recorded without one. */
+#ifndef portSTACK_PEAK_PROGRAM_COUNTER
+    #define portSTACK_PEAK_PROGRAM_COUNTER( pxTopOfStack )    ( NULL )
+#endif
+
+#ifndef configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H
+    #define configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H    0
+#endif
+
+/* The following event macros are embedded in the kernel API calls. */
+
+#ifndef traceMOVED_TASK_TO_READY_STATE
+    #define traceMOVED_TASK_TO_READY_STATE( pxTCB )
+#endif
+
+#ifndef tracePOST_MOVED_TASK_TO_READY_STATE
+    #define tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+#endif
+
+#ifndef traceMOVED_TASK_TO_DELAYED_LIST
+    #define traceMOVED_TASK_TO_DELAYED_LIST()
+#endif
+
+#ifndef traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST
+    #define traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST()
+#endif
+
+#ifndef traceQUEUE_CREATE
+    #define traceQUEUE_CREATE( pxNewQueue )
+#endif
+
+#ifndef traceQUEUE_CREATE_FAILED
+    #define traceQUEUE_CREATE_FAILED( ucQueueType )
+#endif
+
+#ifndef traceCREATE_MUTEX
+    #define traceCREATE_MUTEX( pxNewQueue )
+#endif
+
+#ifndef traceCREATE_MUTEX_FAILED
+    #define traceCREATE_MUTEX_FAILED()
+#endif
+
+#ifndef traceGIVE_MUTEX_RECURSIVE
+    #define traceGIVE_MUTEX_RECURSIVE( pxMutex )
+#endif
+
+#ifndef traceGIVE_MUTEX_RECURSIVE_FAILED
     #define traceGIVE_MUTEX_RECURSIVE_FAILED( pxMutex )
 #endif
 
-#ifndef traceTAKE_MUTEX_RECURSIVE
-    #define traceTAKE_MUTEX_RECURSIVE( pxMutex )
+#ifndef traceTAKE_MUTEX_RECURSIVE
+    #define traceTAKE_MUTEX_RECURSIVE( pxMutex )
+#endif
+
+#ifndef traceTAKE_MUTEX_RECURSIVE_FAILED
+    #define traceTAKE_MUTEX_RECURSIVE_FAILED( pxMutex )
+#endif
+
+#ifndef traceCREATE_COUNTING_SEMAPHORE
+    #define traceCREATE_COUNTING_SEMAPHORE()
+#endif
+
+#ifndef traceCREATE_COUNTING_SEMAPHORE_FAILED
+    #define traceCREATE_COUNTING_SEMAPHORE_FAILED()
+#endif
+
+#ifndef traceQUEUE_SET_SEND
+    #define traceQUEUE_SET_SEND    traceQUEUE_SEND
+#endif
+
+#ifndef traceQUEUE_SEND
+    #define traceQUEUE_SEND( pxQueue )
+#endif
+
+#ifndef traceQUEUE_SEND_FAILED
+    #define traceQUEUE_SEND_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_RESERVE_SEND
+    #define traceQUEUE_RESERVE_SEND( pxQueue )
+#endif
+
+#ifndef traceQUEUE_RECEIVE
+    #define traceQUEUE_RECEIVE( pxQueue )
+#endif
+
+#ifndef traceQUEUE_RELEASE_RECEIVE
+    #define traceQUEUE_RELEASE_RECEIVE( pxQueue )
+#endif
+
+#ifndef traceQUEUE_PEEK
+    #define traceQUEUE_PEEK( pxQueue )
+#endif
+
+#ifndef traceQUEUE_PEEK_FAILED
+    #define traceQUEUE_PEEK_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_PEEK_FROM_ISR
+    #define traceQUEUE_PEEK_FROM_ISR( pxQueue )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FAILED
+    #define traceQUEUE_RECEIVE_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_SEND_FROM_ISR
+    #define traceQUEUE_SEND_FROM_ISR( pxQueue )
+#endif
+
+#ifndef traceQUEUE_SEND_FROM_ISR_FAILED
+    #define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_MUTEX_HANDOFF
+
+/* Called when a given mutex passes directly to the task waiting for it. */
+    #define traceQUEUE_MUTEX_HANDOFF( pxQueue, xNewHolder )
+#endif
+
+#ifndef traceQUEUE_RING_DISCARD
+
+/* Called when sending to a full ring queue discards the oldest item. */
+    #define traceQUEUE_RING_DISCARD( pxQueue )
+#endif
+
+#ifndef traceMESSAGE_TAG_RECEIVED
+
+/* Called when a message carrying a latency tag is received.  ulCorrelationID
+ * identifies the chain of messages the message belongs to, and ulLatency is the
+ * time, in run time counts, since the first message of the chain was sent. */
+    #define traceMESSAGE_TAG_RECEIVED( ulCorrelationID, ulLatency )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FROM_ISR
+    #define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FROM_ISR_FAILED
+    #define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_PEEK_FROM_ISR_FAILED
+    #define traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue )
+#endif
+
+#ifndef traceQUEUE_DELETE
+    #define traceQUEUE_DELETE( pxQueue )
+#endif
+
+#ifndef traceTASK_CREATE
+    #define traceTASK_CREATE( pxNewTCB )
+#endif
+
+#ifndef traceTASK_CREATE_FAILED
+    #define traceTASK_CREATE_FAILED()
+#endif
+
+#ifndef traceTASK_DELETE
+    #define traceTASK_DELETE( pxTaskToDelete )
+#endif
+
+#ifndef traceTASK_DELAY_UNTIL
+    #define traceTASK_DELAY_UNTIL( x )
+#endif
+
+#ifndef traceTASK_DEADLINE_MISSED
+    #define traceTASK_DEADLINE_MISSED( pxTCB )
+#endif
+
+#ifndef traceTASK_PERIODIC_RELEASE
+    #define traceTASK_PERIODIC_RELEASE( pxTCB )
+#endif
+
+#ifndef traceTASK_PERIODIC_OVERRUN
+    #define traceTASK_PERIODIC_OVERRUN( pxTCB )
+#endif
+
+#ifndef traceTASK_BUDGET_EXHAUSTED
+    #define traceTASK_BUDGET_EXHAUSTED( pxTCB )
+#endif
+
+#ifndef traceTASK_BUDGET_OVERRUN
+    #define traceTASK_BUDGET_OVERRUN( pxTCB )
+#endif
+
+#ifndef traceTASK_BUDGET_THROTTLED
+    #define traceTASK_BUDGET_THROTTLED( pxTCB )
+#endif
+
+#ifndef traceTASK_HEAP_QUOTA_EXCEEDED
+    #define traceTASK_HEAP_QUOTA_EXCEEDED( pxTCB, xWantedSize )
+#endif
+
+#ifndef traceTASK_DELAY
+    #define traceTASK_DELAY()
+#endif
+
+#ifndef traceTASK_PRIORITY_SET
+    #define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
+#endif
+
+#ifndef traceTASK_SUSPEND
+    #define traceTASK_SUSPEND( pxTaskToSuspend )
+#endif
+
+#ifndef traceTASK_RESUME
+    #define traceTASK_RESUME( pxTaskToResume )
+#endif
+
+#ifndef traceTASK_RESUME_FROM_ISR
+    #define traceTASK_RESUME_FROM_ISR( pxTaskToResume )
+#endif
+
+#ifndef traceTASK_INCREMENT_TICK
+    #define traceTASK_INCREMENT_TICK( xTickCount )
+#endif
+
+#ifndef traceDVFS_LEVEL_CHANGE
+    #define traceDVFS_LEVEL_CHANGE( uxOldLevel, uxNewLevel )
+#endif
+
+#ifndef traceTIMER_CREATE
+    #define traceTIMER_CREATE( pxNewTimer )
+#endif
+
+#ifndef traceTIMER_CREATE_FAILED
+    #define traceTIMER_CREATE_FAILED()
+#endif
+
+#ifndef traceTIMER_COMMAND_SEND
+    #define traceTIMER_COMMAND_SEND( xTimer, xMessageID, xMessageValueValue, xReturn )
+#endif
+
+#ifndef traceTIMER_EXPIRED
+    #define traceTIMER_EXPIRED( pxTimer )
+#endif
+
+#ifndef traceTIMER_COMMAND_RECEIVED
+    #define traceTIMER_COMMAND_RECEIVED( pxTimer, xMessageID, xMessageValue )
+#endif
+
+#ifndef traceMALLOC
+    #define traceMALLOC( pvAddress, uiSize )
+#endif
+
+#ifndef traceFREE
+    #define traceFREE( pvAddress, uiSize )
+#endif
+
+#ifndef traceEVENT_GROUP_CREATE
+    #define traceEVENT_GROUP_CREATE( xEventGroup )
+#endif
+
+#ifndef traceEVENT_GROUP_CREATE_FAILED
+    #define traceEVENT_GROUP_CREATE_FAILED()
+#endif
+
+#ifndef traceEVENT_GROUP_SYNC_BLOCK
+    #define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor )
+#endif
+
+#ifndef traceEVENT_GROUP_SYNC_END
+    #define traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred )    ( void ) ( xTimeoutOccurred )
+#endif
+
+#ifndef traceEVENT_GROUP_WAIT_BITS_BLOCK
+    #define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )
+#endif
+
+#ifndef traceEVENT_GROUP_WAIT_BITS_END
+    #define traceEVENT_GROUP_WAIT_BITS_END( xEventGroup, uxBitsToWaitFor, xTimeoutOccurred )    ( void ) ( xTimeoutOccurred )
+#endif
+
+#ifndef traceEVENT_GROUP_CLEAR_BITS
+    #define traceEVENT_GROUP_CLEAR_BITS( xEventGroup, uxBitsToClear )
+#endif
+
+#ifndef traceEVENT_GROUP_CLEAR_BITS_FROM_ISR
+    #define traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear )
+#endif
+
+#ifndef traceEVENT_GROUP_SET_BITS
+    #define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )
+#endif
+
+#ifndef traceEVENT_GROUP_SET_BITS_FROM_ISR
+    #define traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet )
+#endif
+
+#ifndef traceEVENT_GROUP_DELETE
+    #define traceEVENT_GROUP_DELETE( xEventGroup )
+#endif
+
+#ifndef tracePOOL_CREATE
+    #define tracePOOL_CREATE( xPool )
+#endif
+
+#ifndef tracePOOL_CREATE_FAILED
+    #define tracePOOL_CREATE_FAILED( xItemSize, uxItemCount )
+#endif
+
+#ifndef tracePOOL_DELETE
+    #define tracePOOL_DELETE( xPool )
+#endif
+
+#ifndef tracePEND_FUNC_CALL
+    #define tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, ret )
+#endif
+
+#ifndef tracePEND_FUNC_CALL_FROM_ISR
+    #define tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, ret )
+#endif
+
+#ifndef traceQUEUE_REGISTRY_ADD
+    #define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE_BLOCK
+    #define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE
+    #define traceTASK_NOTIFY_TAKE( uxIndexToWait )
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT_BLOCK
+    #define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT
+    #define traceTASK_NOTIFY_WAIT( uxIndexToWait )
+#endif
+
+#ifndef traceTASK_NOTIFY
+    #define traceTASK_NOTIFY( uxIndexToNotify )
+#endif
+
+#ifndef traceTASK_NOTIFY_FROM_ISR
+    #define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )
+#endif
+
+#ifndef traceTASK_NOTIFY_GIVE_FROM_ISR
+    #define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify )
+#endif
+
+#ifndef traceISR_EXIT_TO_SCHEDULER
+    #define traceISR_EXIT_TO_SCHEDULER()
+#endif
+
+#ifndef traceISR_EXIT
+    #define traceISR_EXIT()
+#endif
+
+#ifndef traceISR_ENTER
+    #define traceISR_ENTER()
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE_FAILED
+    #define traceSTREAM_BUFFER_CREATE_FAILED( xStreamBufferType )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE_STATIC_FAILED
+    #define traceSTREAM_BUFFER_CREATE_STATIC_FAILED( xReturn, xStreamBufferType )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE
+    #define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xStreamBufferType )
+#endif
+
+#ifndef traceSTREAM_BUFFER_DELETE
+    #define traceSTREAM_BUFFER_DELETE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RESET
+    #define traceSTREAM_BUFFER_RESET( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RESET_FROM_ISR
+    #define traceSTREAM_BUFFER_RESET_FROM_ISR( xStreamBuffer )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_SEND
+    #define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND
+    #define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FAILED
+    #define traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FROM_ISR
+    #define traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_RECEIVE
+    #define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE
+    #define traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FAILED
+    #define traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FROM_ISR
+    #define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
+#endif
+
+#ifndef traceENTER_xEventGroupCreateStatic
+    #define traceENTER_xEventGroupCreateStatic( pxEventGroupBuffer )
+#endif
+
+#ifndef traceRETURN_xEventGroupCreateStatic
+    #define traceRETURN_xEventGroupCreateStatic( pxEventBits )
+#endif
+
+#ifndef traceENTER_xEventGroupCreate
+    #define traceENTER_xEventGroupCreate()
+#endif
+
+#ifndef traceRETURN_xEventGroupCreate
+    #define traceRETURN_xEventGroupCreate( pxEventBits )
+#endif
+
+#ifndef traceENTER_xEventGroupSync
+    #define traceENTER_xEventGroupSync( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xEventGroupSync
+    #define traceRETURN_xEventGroupSync( uxReturn )
+#endif
+
+#ifndef traceENTER_xEventGroupWaitBits
+    #define traceENTER_xEventGroupWaitBits( xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xEventGroupWaitBits
+    #define traceRETURN_xEventGroupWaitBits( uxReturn )
+#endif
+
+#ifndef traceENTER_xEventGroupClearBits
+    #define traceENTER_xEventGroupClearBits( xEventGroup, uxBitsToClear )
+#endif
+
+#ifndef traceRETURN_xEventGroupClearBits
+    #define traceRETURN_xEventGroupClearBits( uxReturn )
+#endif
+
+#ifndef traceENTER_xEventGroupClearBitsFromISR
+    #define traceENTER_xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear )
+#endif
+
+#ifndef traceRETURN_xEventGroupClearBitsFromISR
+    #define traceRETURN_xEventGroupClearBitsFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xEventGroupGetBitsFromISR
+    #define traceENTER_xEventGroupGetBitsFromISR( xEventGroup )
+#endif
+
+#ifndef traceRETURN_xEventGroupGetBitsFromISR
+    #define traceRETURN_xEventGroupGetBitsFromISR( uxReturn )
+#endif
+
+#ifndef traceENTER_xEventGroupSetBits
+    #define traceENTER_xEventGroupSetBits( xEventGroup, uxBitsToSet )
+#endif
+
+#ifndef traceRETURN_xEventGroupSetBits
+    #define traceRETURN_xEventGroupSetBits( uxEventBits )
+#endif
+
+#ifndef traceENTER_xEventGroupSetBitsWakeOne
+    #define traceENTER_xEventGroupSetBitsWakeOne( xEventGroup, uxBitsToSet )
+#endif
+
+#ifndef traceRETURN_xEventGroupSetBitsWakeOne
+    #define traceRETURN_xEventGroupSetBitsWakeOne( uxEventBits )
+#endif
+
+#ifndef traceENTER_vEventGroupDelete
+    #define traceENTER_vEventGroupDelete( xEventGroup )
+#endif
+
+#ifndef traceRETURN_vEventGroupDelete
+    #define traceRETURN_vEventGroupDelete()
+#endif
+
+#ifndef traceENTER_xEventGroupGetStaticBuffer
+    #define traceENTER_xEventGroupGetStaticBuffer( xEventGroup, ppxEventGroupBuffer )
+#endif
+
+#ifndef traceRETURN_xEventGroupGetStaticBuffer
+    #define traceRETURN_xEventGroupGetStaticBuffer( xReturn )
+#endif
+
+#ifndef traceENTER_vEventGroupSetBitsCallback
+    #define traceENTER_vEventGroupSetBitsCallback( pvEventGroup, ulBitsToSet )
+#endif
+
+#ifndef traceRETURN_vEventGroupSetBitsCallback
+    #define traceRETURN_vEventGroupSetBitsCallback()
+#endif
+
+#ifndef traceENTER_vEventGroupClearBitsCallback
+    #define traceENTER_vEventGroupClearBitsCallback( pvEventGroup, ulBitsToClear )
+#endif
+
+#ifndef traceRETURN_vEventGroupClearBitsCallback
+    #define traceRETURN_vEventGroupClearBitsCallback()
+#endif
+
+#ifndef traceENTER_xEventGroupSetBitsFromISR
+    #define traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xEventGroupSetBitsFromISR
+    #define traceRETURN_xEventGroupSetBitsFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_uxEventGroupGetNumber
+    #define traceENTER_uxEventGroupGetNumber( xEventGroup )
+#endif
+
+#ifndef traceRETURN_uxEventGroupGetNumber
+    #define traceRETURN_uxEventGroupGetNumber( xReturn )
+#endif
+
+#ifndef traceENTER_vEventGroupSetNumber
+    #define traceENTER_vEventGroupSetNumber( xEventGroup, uxEventGroupNumber )
+#endif
+
+#ifndef traceRETURN_vEventGroupSetNumber
+    #define traceRETURN_vEventGroupSetNumber()
+#endif
+
+#ifndef traceENTER_vEventGroupGetStatistics
+    #define traceENTER_vEventGroupGetStatistics( xEventGroup, pxStatistics )
+#endif
+
+#ifndef traceRETURN_vEventGroupGetStatistics
+    #define traceRETURN_vEventGroupGetStatistics()
+#endif
+
+#ifndef traceENTER_xQueueGenericReset
+    #define traceENTER_xQueueGenericReset( xQueue, xNewQueue )
+#endif
+
+#ifndef traceRETURN_xQueueGenericReset
+    #define traceRETURN_xQueueGenericReset( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueGenericCreateStatic
+    #define traceENTER_xQueueGenericCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxStaticQueue, ucQueueType )
+#endif
+
+#ifndef traceRETURN_xQueueGenericCreateStatic
+    #define traceRETURN_xQueueGenericCreateStatic( pxNewQueue )
+#endif
+
+#ifndef traceENTER_xQueueGenericGetStaticBuffers
+    #define traceENTER_xQueueGenericGetStaticBuffers( xQueue, ppucQueueStorage, ppxStaticQueue )
+#endif
+
+#ifndef traceRETURN_xQueueGenericGetStaticBuffers
+    #define traceRETURN_xQueueGenericGetStaticBuffers( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueGenericCreate
+    #define traceENTER_xQueueGenericCreate( uxQueueLength, uxItemSize, ucQueueType )
+#endif
+
+#ifndef traceRETURN_xQueueGenericCreate
+    #define traceRETURN_xQueueGenericCreate( pxNewQueue )
+#endif
+
+#ifndef traceENTER_xQueueCreateMutex
+    #define traceENTER_xQueueCreateMutex( ucQueueType )
+#endif
+
+#ifndef traceRETURN_xQueueCreateMutex
+    #define traceRETURN_xQueueCreateMutex( xNewQueue )
+#endif
+
+#ifndef traceENTER_xQueueCreateMutexStatic
+    #define traceENTER_xQueueCreateMutexStatic( ucQueueType, pxStaticQueue )
+#endif
+
+#ifndef traceRETURN_xQueueCreateMutexStatic
+    #define traceRETURN_xQueueCreateMutexStatic( xNewQueue )
+#endif
+
+#ifndef traceENTER_xQueueCreateMutexWithCeiling
+    #define traceENTER_xQueueCreateMutexWithCeiling( ucQueueType, uxCeilingPriority )
+#endif
+
+#ifndef traceRETURN_xQueueCreateMutexWithCeiling
+    #define traceRETURN_xQueueCreateMutexWithCeiling( xNewQueue )
+#endif
+
+#ifndef traceENTER_xQueueCreateMutexWithCeilingStatic
+    #define traceENTER_xQueueCreateMutexWithCeilingStatic( ucQueueType, uxCeilingPriority, pxStaticQueue )
+#endif
+
+#ifndef traceRETURN_xQueueCreateMutexWithCeilingStatic
+    #define traceRETURN_xQueueCreateMutexWithCeilingStatic( xNewQueue )
+#endif
+
+#ifndef traceENTER_xQueueGetMutexHolder
+    #define traceENTER_xQueueGetMutexHolder( xSemaphore )
+#endif
+
+#ifndef traceRETURN_xQueueGetMutexHolder
+    #define traceRETURN_xQueueGetMutexHolder( pxReturn )
+#endif
+
+#ifndef traceENTER_xQueueGetMutexHolderFromISR
+    #define traceENTER_xQueueGetMutexHolderFromISR( xSemaphore )
+#endif
+
+#ifndef traceRETURN_xQueueGetMutexHolderFromISR
+    #define traceRETURN_xQueueGetMutexHolderFromISR( pxReturn )
+#endif
+
+#ifndef traceENTER_xQueueGiveMutexRecursive
+    #define traceENTER_xQueueGiveMutexRecursive( xMutex )
+#endif
+
+#ifndef traceRETURN_xQueueGiveMutexRecursive
+    #define traceRETURN_xQueueGiveMutexRecursive( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueTakeMutexRecursive
+    #define traceENTER_xQueueTakeMutexRecursive( xMutex, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueTakeMutexRecursive
+    #define traceRETURN_xQueueTakeMutexRecursive( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueCreateCountingSemaphoreStatic
+    #define traceENTER_xQueueCreateCountingSemaphoreStatic( uxMaxCount, uxInitialCount, pxStaticQueue )
+#endif
+
+#ifndef traceRETURN_xQueueCreateCountingSemaphoreStatic
+    #define traceRETURN_xQueueCreateCountingSemaphoreStatic( xHandle )
+#endif
+
+#ifndef traceENTER_xQueueCreateCountingSemaphore
+    #define traceENTER_xQueueCreateCountingSemaphore( uxMaxCount, uxInitialCount )
+#endif
+
+#ifndef traceENTER_xQueueCreateAtomicSemaphoreStatic
+    #define traceENTER_xQueueCreateAtomicSemaphoreStatic( uxMaxCount, uxInitialCount, pxStaticQueue )
+#endif
+
+#ifndef traceRETURN_xQueueCreateAtomicSemaphoreStatic
+    #define traceRETURN_xQueueCreateAtomicSemaphoreStatic( xHandle )
+#endif
+
+#ifndef traceENTER_xQueueCreateAtomicSemaphore
+    #define traceENTER_xQueueCreateAtomicSemaphore( uxMaxCount, uxInitialCount )
+#endif
+
+#ifndef traceRETURN_xQueueCreateAtomicSemaphore
+    #define traceRETURN_xQueueCreateAtomicSemaphore( xHandle )
+#endif
+
+#ifndef traceRETURN_xQueueCreateCountingSemaphore
+    #define traceRETURN_xQueueCreateCountingSemaphore( xHandle )
+#endif
+
+#ifndef traceENTER_xQueueGenericSend
+    #define traceENTER_xQueueGenericSend( xQueue, pvItemToQueue, xTicksToWait, xCopyPosition )
+#endif
+
+#ifndef traceRETURN_xQueueGenericSend
+    #define traceRETURN_xQueueGenericSend( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueSendMultiple
+    #define traceENTER_xQueueSendMultiple( xQueue, pvItems, uxCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueSendMultiple
+    #define traceRETURN_xQueueSendMultiple( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueGenericSendFromISR
+    #define traceENTER_xQueueGenericSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken, xCopyPosition )
+#endif
+
+#ifndef traceRETURN_xQueueGenericSendFromISR
+    #define traceRETURN_xQueueGenericSendFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueGiveFromISR
+    #define traceENTER_xQueueGiveFromISR( xQueue, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xQueueGiveFromISR
+    #define traceRETURN_xQueueGiveFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueReceive
+    #define traceENTER_xQueueReceive( xQueue, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueReceive
+    #define traceRETURN_xQueueReceive( xReturn )
+#endif
+
+#ifndef traceENTER_uxQueueReceiveMultiple
+    #define traceENTER_uxQueueReceiveMultiple( xQueue, pvBuffer, uxMaxCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_uxQueueReceiveMultiple
+    #define traceRETURN_uxQueueReceiveMultiple( uxReturn )
+#endif
+
+#ifndef traceENTER_xQueueReserveSend
+    #define traceENTER_xQueueReserveSend( xQueue, ppvSlot, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueReserveSend
+    #define traceRETURN_xQueueReserveSend( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueCommitSend
+    #define traceENTER_xQueueCommitSend( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueCommitSend
+    #define traceRETURN_xQueueCommitSend( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueAcquireReceive
+    #define traceENTER_xQueueAcquireReceive( xQueue, ppvSlot, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueAcquireReceive
+    #define traceRETURN_xQueueAcquireReceive( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueReleaseReceive
+    #define traceENTER_xQueueReleaseReceive( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueReleaseReceive
+    #define traceRETURN_xQueueReleaseReceive( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueSemaphoreTake
+    #define traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueSemaphoreTake
+    #define traceRETURN_xQueueSemaphoreTake( xReturn )
+#endif
+
+#ifndef traceENTER_xQueuePeek
+    #define traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueuePeek
+    #define traceRETURN_xQueuePeek( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueReceiveFromISR
+    #define traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xQueueReceiveFromISR
+    #define traceRETURN_xQueueReceiveFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xQueuePeekFromISR
+    #define traceENTER_xQueuePeekFromISR( xQueue, pvBuffer )
+#endif
+
+#ifndef traceRETURN_xQueuePeekFromISR
+    #define traceRETURN_xQueuePeekFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_uxQueueMessagesWaiting
+    #define traceENTER_uxQueueMessagesWaiting( xQueue )
+#endif
+
+#ifndef traceRETURN_uxQueueMessagesWaiting
+    #define traceRETURN_uxQueueMessagesWaiting( uxReturn )
+#endif
+
+#ifndef traceENTER_uxQueueSpacesAvailable
+    #define traceENTER_uxQueueSpacesAvailable( xQueue )
+#endif
+
+#ifndef traceRETURN_uxQueueSpacesAvailable
+    #define traceRETURN_uxQueueSpacesAvailable( uxReturn )
+#endif
+
+#ifndef traceENTER_uxQueueGetRingItemsDropped
+    #define traceENTER_uxQueueGetRingItemsDropped( xQueue )
+#endif
+
+#ifndef traceRETURN_uxQueueGetRingItemsDropped
+    #define traceRETURN_uxQueueGetRingItemsDropped( uxReturn )
+#endif
+
+#ifndef traceENTER_xQueueCall
+    #define traceENTER_xQueueCall( xQueue, pvRequest, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueCall
+    #define traceRETURN_xQueueCall( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueReply
+    #define traceENTER_xQueueReply( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueReply
+    #define traceRETURN_xQueueReply( xReturn )
+#endif
+
+#ifndef traceENTER_uxQueueMessagesWaitingFromISR
+    #define traceENTER_uxQueueMessagesWaitingFromISR( xQueue )
+#endif
+
+#ifndef traceRETURN_uxQueueMessagesWaitingFromISR
+    #define traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn )
+#endif
+
+#ifndef traceENTER_vQueueDelete
+    #define traceENTER_vQueueDelete( xQueue )
+#endif
+
+#ifndef traceRETURN_vQueueDelete
+    #define traceRETURN_vQueueDelete()
+#endif
+
+#ifndef traceENTER_uxQueueGetQueueNumber
+    #define traceENTER_uxQueueGetQueueNumber( xQueue )
+#endif
+
+#ifndef traceRETURN_uxQueueGetQueueNumber
+    #define traceRETURN_uxQueueGetQueueNumber( uxQueueNumber )
+#endif
+
+#ifndef traceENTER_vQueueSetQueueNumber
+    #define traceENTER_vQueueSetQueueNumber( xQueue, uxQueueNumber )
+#endif
+
+#ifndef traceRETURN_vQueueSetQueueNumber
+    #define traceRETURN_vQueueSetQueueNumber()
+#endif
+
+#ifndef traceENTER_ucQueueGetQueueType
+    #define traceENTER_ucQueueGetQueueType( xQueue )
+#endif
+
+#ifndef traceRETURN_ucQueueGetQueueType
+    #define traceRETURN_ucQueueGetQueueType( ucQueueType )
+#endif
+
+#ifndef traceENTER_vQueueGetStatistics
+    #define traceENTER_vQueueGetStatistics( xQueue, pxStatistics )
+#endif
+
+#ifndef traceRETURN_vQueueGetStatistics
+    #define traceRETURN_vQueueGetStatistics()
+#endif
+
+#ifndef traceENTER_vQueueGetLatencyHistogram
+    #define traceENTER_vQueueGetLatencyHistogram( xQueue, pxHistogram )
+#endif
+
+#ifndef traceRETURN_vQueueGetLatencyHistogram
+    #define traceRETURN_vQueueGetLatencyHistogram()
+#endif
+
+#ifndef traceENTER_uxQueueGetQueueItemSize
+    #define traceENTER_uxQueueGetQueueItemSize( xQueue )
+#endif
+
+#ifndef traceRETURN_uxQueueGetQueueItemSize
+    #define traceRETURN_uxQueueGetQueueItemSize( uxItemSize )
+#endif
+
+#ifndef traceENTER_uxQueueGetQueueLength
+    #define traceENTER_uxQueueGetQueueLength( xQueue )
+#endif
+
+#ifndef traceRETURN_uxQueueGetQueueLength
+    #define traceRETURN_uxQueueGetQueueLength( uxLength )
+#endif
+
+#ifndef traceENTER_xQueueIsQueueEmptyFromISR
+    #define traceENTER_xQueueIsQueueEmptyFromISR( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueIsQueueEmptyFromISR
+    #define traceRETURN_xQueueIsQueueEmptyFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueIsQueueFullFromISR
+    #define traceENTER_xQueueIsQueueFullFromISR( xQueue )
+#endif
+
+#ifndef traceRETURN_xQueueIsQueueFullFromISR
+    #define traceRETURN_xQueueIsQueueFullFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueCRSend
+    #define traceENTER_xQueueCRSend( xQueue, pvItemToQueue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueCRSend
+    #define traceRETURN_xQueueCRSend( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueCRReceive
+    #define traceENTER_xQueueCRReceive( xQueue, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueCRReceive
+    #define traceRETURN_xQueueCRReceive( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueCRSendFromISR
+    #define traceENTER_xQueueCRSendFromISR( xQueue, pvItemToQueue, xCoRoutinePreviouslyWoken )
+#endif
+
+#ifndef traceRETURN_xQueueCRSendFromISR
+    #define traceRETURN_xQueueCRSendFromISR( xCoRoutinePreviouslyWoken )
+#endif
+
+#ifndef traceENTER_xQueueCRReceiveFromISR
+    #define traceENTER_xQueueCRReceiveFromISR( xQueue, pvBuffer, pxCoRoutineWoken )
+#endif
+
+#ifndef traceRETURN_xQueueCRReceiveFromISR
+    #define traceRETURN_xQueueCRReceiveFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_vQueueAddToRegistry
+    #define traceENTER_vQueueAddToRegistry( xQueue, pcQueueName )
+#endif
+
+#ifndef traceRETURN_vQueueAddToRegistry
+    #define traceRETURN_vQueueAddToRegistry()
+#endif
+
+#ifndef traceENTER_pcQueueGetName
+    #define traceENTER_pcQueueGetName( xQueue )
+#endif
+
+#ifndef traceRETURN_pcQueueGetName
+    #define traceRETURN_pcQueueGetName( pcReturn )
+#endif
+
+#ifndef traceENTER_vQueueUnregisterQueue
+    #define traceENTER_vQueueUnregisterQueue( xQueue )
+#endif
+
+#ifndef traceRETURN_vQueueUnregisterQueue
+    #define traceRETURN_vQueueUnregisterQueue()
+#endif
+
+#ifndef traceENTER_xQueueGetHandleByName
+    #define traceENTER_xQueueGetHandleByName( pcQueueName )
+#endif
+
+#ifndef traceRETURN_xQueueGetHandleByName
+    #define traceRETURN_xQueueGetHandleByName( xReturn )
+#endif
+
+#ifndef traceENTER_vQueueListStatistics
+    #define traceENTER_vQueueListStatistics( pcWriteBuffer, uxBufferLength )
+#endif
+
+#ifndef traceRETURN_vQueueListStatistics
+    #define traceRETURN_vQueueListStatistics()
+#endif
+
+#ifndef traceENTER_vQueueWaitForMessageRestricted
+    #define traceENTER_vQueueWaitForMessageRestricted( xQueue, xTicksToWait, xWaitIndefinitely )
+#endif
+
+#ifndef traceRETURN_vQueueWaitForMessageRestricted
+    #define traceRETURN_vQueueWaitForMessageRestricted()
+#endif
+
+#ifndef traceENTER_xQueueCreateSet
+    #define traceENTER_xQueueCreateSet( uxEventQueueLength )
+#endif
+
+#ifndef traceRETURN_xQueueCreateSet
+    #define traceRETURN_xQueueCreateSet( pxQueue )
+#endif
+
+#ifndef traceENTER_xQueueAddToSet
+    #define traceENTER_xQueueAddToSet( xQueueOrSemaphore, xQueueSet )
+#endif
+
+#ifndef traceRETURN_xQueueAddToSet
+    #define traceRETURN_xQueueAddToSet( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueRemoveFromSet
+    #define traceENTER_xQueueRemoveFromSet( xQueueOrSemaphore, xQueueSet )
+#endif
+
+#ifndef traceRETURN_xQueueRemoveFromSet
+    #define traceRETURN_xQueueRemoveFromSet( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueSelectFromSet
+    #define traceENTER_xQueueSelectFromSet( xQueueSet, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueSelectFromSet
+    #define traceRETURN_xQueueSelectFromSet( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueSelectFromSetFromISR
+    #define traceENTER_xQueueSelectFromSetFromISR( xQueueSet )
+#endif
+
+#ifndef traceRETURN_xQueueSelectFromSetFromISR
+    #define traceRETURN_xQueueSelectFromSetFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xQueueWaitForAny
+    #define traceENTER_xQueueWaitForAny( pxQueues, uxQueueCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xQueueWaitForAny
+    #define traceRETURN_xQueueWaitForAny( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerCreateTimerTask
+    #define traceENTER_xTimerCreateTimerTask()
+#endif
+
+#ifndef traceRETURN_xTimerCreateTimerTask
+    #define traceRETURN_xTimerCreateTimerTask( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerCreate
+    #define traceENTER_xTimerCreate( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction )
+#endif
+
+#ifndef traceRETURN_xTimerCreate
+    #define traceRETURN_xTimerCreate( pxNewTimer )
+#endif
+
+#ifndef traceENTER_xTimerCreateStatic
+    #define traceENTER_xTimerCreateStatic( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer )
+#endif
+
+#ifndef traceRETURN_xTimerCreateStatic
+    #define traceRETURN_xTimerCreateStatic( pxNewTimer )
+#endif
+
+#ifndef traceENTER_xTimerGenericCommandFromTask
+    #define traceENTER_xTimerGenericCommandFromTask( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTimerGenericCommandFromTask
+    #define traceRETURN_xTimerGenericCommandFromTask( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerGenericCommandFromISR
+    #define traceENTER_xTimerGenericCommandFromISR( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTimerGenericCommandFromISR
+    #define traceRETURN_xTimerGenericCommandFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerGroupGenericCommand
+    #define traceENTER_xTimerGroupGenericCommand( pxGroup, xCommandID, xOptionalValue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTimerGroupGenericCommand
+    #define traceRETURN_xTimerGroupGenericCommand( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerResetDirect
+    #define traceENTER_xTimerResetDirect( xTimer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTimerResetDirect
+    #define traceRETURN_xTimerResetDirect( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerGetTimerDaemonTaskHandle
+    #define traceENTER_xTimerGetTimerDaemonTaskHandle()
+#endif
+
+#ifndef traceRETURN_xTimerGetTimerDaemonTaskHandle
+    #define traceRETURN_xTimerGetTimerDaemonTaskHandle( xTimerTaskHandle )
+#endif
+
+#ifndef traceENTER_xTimerGetPeriod
+    #define traceENTER_xTimerGetPeriod( xTimer )
+#endif
+
+#ifndef traceRETURN_xTimerGetPeriod
+    #define traceRETURN_xTimerGetPeriod( xTimerPeriodInTicks )
+#endif
+
+#ifndef traceENTER_vTimerSetReloadMode
+    #define traceENTER_vTimerSetReloadMode( xTimer, xAutoReload )
+#endif
+
+#ifndef traceRETURN_vTimerSetReloadMode
+    #define traceRETURN_vTimerSetReloadMode()
+#endif
+
+#ifndef traceENTER_xTimerGetReloadMode
+    #define traceENTER_xTimerGetReloadMode( xTimer )
+#endif
+
+#ifndef traceRETURN_xTimerGetReloadMode
+    #define traceRETURN_xTimerGetReloadMode( xReturn )
+#endif
+
+#ifndef traceENTER_uxTimerGetReloadMode
+    #define traceENTER_uxTimerGetReloadMode( xTimer )
+#endif
+
+#ifndef traceRETURN_uxTimerGetReloadMode
+    #define traceRETURN_uxTimerGetReloadMode( uxReturn )
+#endif
+
+#ifndef traceENTER_xTimerGetExpiryTime
+    #define traceENTER_xTimerGetExpiryTime( xTimer )
+#endif
+
+#ifndef traceRETURN_xTimerGetExpiryTime
+    #define traceRETURN_xTimerGetExpiryTime( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerGetStaticBuffer
+    #define traceENTER_xTimerGetStaticBuffer( xTimer, ppxTimerBuffer )
+#endif
+
+#ifndef traceRETURN_xTimerGetStaticBuffer
+    #define traceRETURN_xTimerGetStaticBuffer( xReturn )
+#endif
+
+#ifndef traceENTER_pcTimerGetName
+    #define traceENTER_pcTimerGetName( xTimer )
+#endif
+
+#ifndef traceRETURN_pcTimerGetName
+    #define traceRETURN_pcTimerGetName( pcTimerName )
+#endif
+
+#ifndef traceENTER_xTimerIsTimerActive
+    #define traceENTER_xTimerIsTimerActive( xTimer )
+#endif
+
+#ifndef traceRETURN_xTimerIsTimerActive
+    #define traceRETURN_xTimerIsTimerActive( xReturn )
+#endif
+
+#ifndef traceENTER_pvTimerGetTimerID
+    #define traceENTER_pvTimerGetTimerID( xTimer )
+#endif
+
+#ifndef traceRETURN_pvTimerGetTimerID
+    #define traceRETURN_pvTimerGetTimerID( pvReturn )
+#endif
+
+#ifndef traceENTER_vTimerSetTimerID
+    #define traceENTER_vTimerSetTimerID( xTimer, pvNewID )
+#endif
+
+#ifndef traceRETURN_vTimerSetTimerID
+    #define traceRETURN_vTimerSetTimerID()
+#endif
+
+#ifndef traceENTER_vTimerSetSlack
+    #define traceENTER_vTimerSetSlack( xTimer, xSlackInTicks )
+#endif
+
+#ifndef traceRETURN_vTimerSetSlack
+    #define traceRETURN_vTimerSetSlack()
+#endif
+
+#ifndef traceENTER_xTimerGetSlack
+    #define traceENTER_xTimerGetSlack( xTimer )
+#endif
+
+#ifndef traceRETURN_xTimerGetSlack
+    #define traceRETURN_xTimerGetSlack( xSlackInTicks )
+#endif
+
+#ifndef traceENTER_vTimerSetHardMode
+    #define traceENTER_vTimerSetHardMode( xTimer, xHard )
+#endif
+
+#ifndef traceRETURN_vTimerSetHardMode
+    #define traceRETURN_vTimerSetHardMode()
+#endif
+
+#ifndef traceENTER_xTimerGetHardMode
+    #define traceENTER_xTimerGetHardMode( xTimer )
+#endif
+
+#ifndef traceRETURN_xTimerGetHardMode
+    #define traceRETURN_xTimerGetHardMode( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerGetServiceTaskHandle
+    #define traceENTER_xTimerGetServiceTaskHandle( uxServiceTask )
+#endif
+
+#ifndef traceRETURN_xTimerGetServiceTaskHandle
+    #define traceRETURN_xTimerGetServiceTaskHandle( xTimerTaskHandle )
+#endif
+
+#ifndef traceENTER_vTimerSetServiceTask
+    #define traceENTER_vTimerSetServiceTask( xTimer, uxServiceTask )
+#endif
+
+#ifndef traceRETURN_vTimerSetServiceTask
+    #define traceRETURN_vTimerSetServiceTask()
+#endif
+
+#ifndef traceENTER_uxTimerGetServiceTask
+    #define traceENTER_uxTimerGetServiceTask( xTimer )
+#endif
+
+#ifndef traceRETURN_uxTimerGetServiceTask
+    #define traceRETURN_uxTimerGetServiceTask( uxServiceTask )
+#endif
+
+#ifndef traceENTER_xTimerPendFunctionCallFromISR
+    #define traceENTER_xTimerPendFunctionCallFromISR( xFunctionToPend, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xTimerPendFunctionCallFromISR
+    #define traceRETURN_xTimerPendFunctionCallFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerPendFunctionCall
+    #define traceENTER_xTimerPendFunctionCall( xFunctionToPend, pvParameter1, ulParameter2, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTimerPendFunctionCall
+    #define traceRETURN_xTimerPendFunctionCall( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerPendFunctionCallToServiceTaskFromISR
+    #define traceENTER_xTimerPendFunctionCallToServiceTaskFromISR( uxServiceTask, xFunctionToPend, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xTimerPendFunctionCallToServiceTaskFromISR
+    #define traceRETURN_xTimerPendFunctionCallToServiceTaskFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xTimerPendFunctionCallToServiceTask
+    #define traceENTER_xTimerPendFunctionCallToServiceTask( uxServiceTask, xFunctionToPend, pvParameter1, ulParameter2, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTimerPendFunctionCallToServiceTask
+    #define traceRETURN_xTimerPendFunctionCallToServiceTask( xReturn )
+#endif
+
+#ifndef traceENTER_uxTimerGetTimerNumber
+    #define traceENTER_uxTimerGetTimerNumber( xTimer )
+#endif
+
+#ifndef traceRETURN_uxTimerGetTimerNumber
+    #define traceRETURN_uxTimerGetTimerNumber( uxTimerNumber )
+#endif
+
+#ifndef traceENTER_vTimerSetTimerNumber
+    #define traceENTER_vTimerSetTimerNumber( xTimer, uxTimerNumber )
+#endif
+
+#ifndef traceRETURN_vTimerSetTimerNumber
+    #define traceRETURN_vTimerSetTimerNumber()
+#endif
+
+#ifndef traceENTER_xTaskCreateStatic
+    #define traceENTER_xTaskCreateStatic( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, puxStackBuffer, pxTaskBuffer )
+#endif
+
+#ifndef traceRETURN_xTaskCreateStatic
+    #define traceRETURN_xTaskCreateStatic( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCreateStaticAffinitySet
+    #define traceENTER_xTaskCreateStaticAffinitySet( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, puxStackBuffer, pxTaskBuffer, uxCoreAffinityMask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateStaticAffinitySet
+    #define traceRETURN_xTaskCreateStaticAffinitySet( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCreateRestrictedStatic
+    #define traceENTER_xTaskCreateRestrictedStatic( pxTaskDefinition, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateRestrictedStatic
+    #define traceRETURN_xTaskCreateRestrictedStatic( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCreateRestrictedStaticAffinitySet
+    #define traceENTER_xTaskCreateRestrictedStaticAffinitySet( pxTaskDefinition, uxCoreAffinityMask, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateRestrictedStaticAffinitySet
+    #define traceRETURN_xTaskCreateRestrictedStaticAffinitySet( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCreateRestricted
+    #define traceENTER_xTaskCreateRestricted( pxTaskDefinition, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateRestricted
+    #define traceRETURN_xTaskCreateRestricted( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCreateRestrictedAffinitySet
+    #define traceENTER_xTaskCreateRestrictedAffinitySet( pxTaskDefinition, uxCoreAffinityMask, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateRestrictedAffinitySet
+    #define traceRETURN_xTaskCreateRestrictedAffinitySet( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCreate
+    #define traceENTER_xTaskCreate( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreate
+    #define traceRETURN_xTaskCreate( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCreateAffinitySet
+    #define traceENTER_xTaskCreateAffinitySet( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, uxCoreAffinityMask, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateAffinitySet
+    #define traceRETURN_xTaskCreateAffinitySet( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCreateWithNotificationEntries
+    #define traceENTER_xTaskCreateWithNotificationEntries( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, uxNotificationEntries, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateWithNotificationEntries
+    #define traceRETURN_xTaskCreateWithNotificationEntries( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskDelete
+    #define traceENTER_vTaskDelete( xTaskToDelete )
+#endif
+
+#ifndef traceRETURN_vTaskDelete
+    #define traceRETURN_vTaskDelete()
+#endif
+
+#ifndef traceENTER_xTaskDelayUntil
+    #define traceENTER_xTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement )
+#endif
+
+#ifndef traceRETURN_xTaskDelayUntil
+    #define traceRETURN_xTaskDelayUntil( xShouldDelay )
+#endif
+
+#ifndef traceENTER_xTaskCreateDeadline
+    #define traceENTER_xTaskCreateDeadline( pxTaskCode, pcName, uxStackDepth, pvParameters, xPeriod, xRelativeDeadline, xBudget, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreateDeadline
+    #define traceRETURN_xTaskCreateDeadline( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskWaitForNextPeriod
+    #define traceENTER_xTaskWaitForNextPeriod()
+#endif
+
+#ifndef traceRETURN_xTaskWaitForNextPeriod
+    #define traceRETURN_xTaskWaitForNextPeriod( xDeadlineMet )
+#endif
+
+#ifndef traceENTER_xTaskGetDeadline
+    #define traceENTER_xTaskGetDeadline( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGetDeadline
+    #define traceRETURN_xTaskGetDeadline( xDeadline )
+#endif
+
+#ifndef traceENTER_xTaskCreatePeriodic
+    #define traceENTER_xTaskCreatePeriodic( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, xPeriod, xPhase, pxCreatedTask )
+#endif
+
+#ifndef traceRETURN_xTaskCreatePeriodic
+    #define traceRETURN_xTaskCreatePeriodic( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskSetPeriodic
+    #define traceENTER_xTaskSetPeriodic( xTask, xPeriod, xPhase )
+#endif
+
+#ifndef traceRETURN_xTaskSetPeriodic
+    #define traceRETURN_xTaskSetPeriodic( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskWaitForNextRelease
+    #define traceENTER_xTaskWaitForNextRelease()
+#endif
+
+#ifndef traceRETURN_xTaskWaitForNextRelease
+    #define traceRETURN_xTaskWaitForNextRelease( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskGetPeriodicStats
+    #define traceENTER_vTaskGetPeriodicStats( xTask, pxStats )
+#endif
+
+#ifndef traceRETURN_vTaskGetPeriodicStats
+    #define traceRETURN_vTaskGetPeriodicStats()
+#endif
+
+#ifndef traceENTER_vTaskSetBudget
+    #define traceENTER_vTaskSetBudget( xTask, xBudget, xPeriod )
+#endif
+
+#ifndef traceRETURN_vTaskSetBudget
+    #define traceRETURN_vTaskSetBudget()
+#endif
+
+#ifndef traceENTER_vTaskSetTimeSlice
+    #define traceENTER_vTaskSetTimeSlice( xTask, xTicks )
+#endif
+
+#ifndef traceRETURN_vTaskSetTimeSlice
+    #define traceRETURN_vTaskSetTimeSlice()
+#endif
+
+#ifndef traceENTER_vTaskSetHeapQuota
+    #define traceENTER_vTaskSetHeapQuota( xTask, xQuota )
+#endif
+
+#ifndef traceRETURN_vTaskSetHeapQuota
+    #define traceRETURN_vTaskSetHeapQuota()
+#endif
+
+#ifndef traceENTER_xTaskGetHeapUsage
+    #define traceENTER_xTaskGetHeapUsage( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGetHeapUsage
+    #define traceRETURN_xTaskGetHeapUsage( xHeapUsage )
+#endif
+
+#ifndef traceENTER_vTaskDelay
+    #define traceENTER_vTaskDelay( xTicksToDelay )
+#endif
+
+#ifndef traceRETURN_vTaskDelay
+    #define traceRETURN_vTaskDelay()
+#endif
+
+#ifndef traceENTER_eTaskGetState
+    #define traceENTER_eTaskGetState( xTask )
+#endif
+
+#ifndef traceRETURN_eTaskGetState
+    #define traceRETURN_eTaskGetState( eReturn )
+#endif
+
+#ifndef traceENTER_uxTaskPriorityGet
+    #define traceENTER_uxTaskPriorityGet( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskPriorityGet
+    #define traceRETURN_uxTaskPriorityGet( uxReturn )
+#endif
+
+#ifndef traceENTER_uxTaskPriorityGetFromISR
+    #define traceENTER_uxTaskPriorityGetFromISR( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskPriorityGetFromISR
+    #define traceRETURN_uxTaskPriorityGetFromISR( uxReturn )
+#endif
+
+#ifndef traceENTER_uxTaskBasePriorityGet
+    #define traceENTER_uxTaskBasePriorityGet( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskBasePriorityGet
+    #define traceRETURN_uxTaskBasePriorityGet( uxReturn )
+#endif
+
+#ifndef traceENTER_uxTaskBasePriorityGetFromISR
+    #define traceENTER_uxTaskBasePriorityGetFromISR( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskBasePriorityGetFromISR
+    #define traceRETURN_uxTaskBasePriorityGetFromISR( uxReturn )
+#endif
+
+#ifndef traceENTER_vTaskPrioritySet
+    #define traceENTER_vTaskPrioritySet( xTask, uxNewPriority )
+#endif
+
+#ifndef traceRETURN_vTaskPrioritySet
+    #define traceRETURN_vTaskPrioritySet()
+#endif
+
+#ifndef traceENTER_vTaskCoreAffinitySet
+    #define traceENTER_vTaskCoreAffinitySet( xTask, uxCoreAffinityMask )
+#endif
+
+#ifndef traceRETURN_vTaskCoreAffinitySet
+    #define traceRETURN_vTaskCoreAffinitySet()
+#endif
+
+#ifndef traceENTER_vTaskCoreAffinityGet
+    #define traceENTER_vTaskCoreAffinityGet( xTask )
+#endif
+
+#ifndef traceRETURN_vTaskCoreAffinityGet
+    #define traceRETURN_vTaskCoreAffinityGet( uxCoreAffinityMask )
+#endif
+
+#ifndef traceENTER_vTaskGangSet
+    #define traceENTER_vTaskGangSet( xTask, uxGang )
+#endif
+
+#ifndef traceRETURN_vTaskGangSet
+    #define traceRETURN_vTaskGangSet()
+#endif
+
+#ifndef traceENTER_uxTaskGangGet
+    #define traceENTER_uxTaskGangGet( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskGangGet
+    #define traceRETURN_uxTaskGangGet( uxGang )
+#endif
+
+#ifndef traceENTER_vTaskCapacityHintSet
+    #define traceENTER_vTaskCapacityHintSet( xTask, uxCapacity )
+#endif
+
+#ifndef traceRETURN_vTaskCapacityHintSet
+    #define traceRETURN_vTaskCapacityHintSet()
+#endif
+
+#ifndef traceENTER_uxTaskCapacityHintGet
+    #define traceENTER_uxTaskCapacityHintGet( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskCapacityHintGet
+    #define traceRETURN_uxTaskCapacityHintGet( uxCapacity )
+#endif
+
+#ifndef traceENTER_vTaskPreemptionDisable
+    #define traceENTER_vTaskPreemptionDisable( xTask )
+#endif
+
+#ifndef traceRETURN_vTaskPreemptionDisable
+    #define traceRETURN_vTaskPreemptionDisable()
+#endif
+
+#ifndef traceENTER_vTaskPreemptionEnable
+    #define traceENTER_vTaskPreemptionEnable( xTask )
+#endif
+
+#ifndef traceRETURN_vTaskPreemptionEnable
+    #define traceRETURN_vTaskPreemptionEnable()
+#endif
+
+#ifndef traceENTER_vTaskPreemptionThresholdSet
+    #define traceENTER_vTaskPreemptionThresholdSet( xTask, uxThreshold )
+#endif
+
+#ifndef traceRETURN_vTaskPreemptionThresholdSet
+    #define traceRETURN_vTaskPreemptionThresholdSet()
+#endif
+
+#ifndef traceENTER_uxTaskPreemptionThresholdGet
+    #define traceENTER_uxTaskPreemptionThresholdGet( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskPreemptionThresholdGet
+    #define traceRETURN_uxTaskPreemptionThresholdGet( uxThreshold )
+#endif
+
+#ifndef traceENTER_vTaskGroupInit
+    #define traceENTER_vTaskGroupInit( pxGroup )
+#endif
+
+#ifndef traceRETURN_vTaskGroupInit
+    #define traceRETURN_vTaskGroupInit()
+#endif
+
+#ifndef traceENTER_xTaskGroupAddTask
+    #define traceENTER_xTaskGroupAddTask( pxGroup, xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGroupAddTask
+    #define traceRETURN_xTaskGroupAddTask( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskGroupRemoveTask
+    #define traceENTER_vTaskGroupRemoveTask( xTask )
+#endif
+
+#ifndef traceRETURN_vTaskGroupRemoveTask
+    #define traceRETURN_vTaskGroupRemoveTask()
+#endif
+
+#ifndef traceENTER_xTaskGroupGenericNotify
+    #define traceENTER_xTaskGroupGenericNotify( pxGroup, uxIndexToNotify, ulValue, eAction )
+#endif
+
+#ifndef traceRETURN_xTaskGroupGenericNotify
+    #define traceRETURN_xTaskGroupGenericNotify( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskSuspend
+    #define traceENTER_vTaskSuspend( xTaskToSuspend )
+#endif
+
+#ifndef traceRETURN_vTaskSuspend
+    #define traceRETURN_vTaskSuspend()
+#endif
+
+#ifndef traceENTER_vTaskResume
+    #define traceENTER_vTaskResume( xTaskToResume )
+#endif
+
+#ifndef traceRETURN_vTaskResume
+    #define traceRETURN_vTaskResume()
+#endif
+
+#ifndef traceENTER_xTaskResumeFromISR
+    #define traceENTER_xTaskResumeFromISR( xTaskToResume )
+#endif
+
+#ifndef traceRETURN_xTaskResumeFromISR
+    #define traceRETURN_xTaskResumeFromISR( xYieldRequired )
+#endif
+
+#ifndef traceENTER_vTaskStartScheduler
+    #define traceENTER_vTaskStartScheduler()
+#endif
+
+#ifndef traceRETURN_vTaskStartScheduler
+    #define traceRETURN_vTaskStartScheduler()
+#endif
+
+#ifndef traceENTER_vTaskEndScheduler
+    #define traceENTER_vTaskEndScheduler()
+#endif
+
+#ifndef traceRETURN_vTaskEndScheduler
+    #define traceRETURN_vTaskEndScheduler()
+#endif
+
+#ifndef traceENTER_vTaskSuspendAll
+    #define traceENTER_vTaskSuspendAll()
+#endif
+
+#ifndef traceRETURN_vTaskSuspendAll
+    #define traceRETURN_vTaskSuspendAll()
+#endif
+
+#ifndef traceENTER_xTaskResumeAll
+    #define traceENTER_xTaskResumeAll()
+#endif
+
+#ifndef traceRETURN_xTaskResumeAll
+    #define traceRETURN_xTaskResumeAll( xAlreadyYielded )
+#endif
+
+#ifndef traceENTER_vTaskSuspendCore
+    #define traceENTER_vTaskSuspendCore()
+#endif
+
+#ifndef traceRETURN_vTaskSuspendCore
+    #define traceRETURN_vTaskSuspendCore()
+#endif
+
+#ifndef traceENTER_xTaskResumeCore
+    #define traceENTER_xTaskResumeCore()
+#endif
+
+#ifndef traceRETURN_xTaskResumeCore
+    #define traceRETURN_xTaskResumeCore( xAlreadyYielded )
+#endif
+
+#ifndef traceENTER_xTaskGetTickCount
+    #define traceENTER_xTaskGetTickCount()
+#endif
+
+#ifndef traceRETURN_xTaskGetTickCount
+    #define traceRETURN_xTaskGetTickCount( xTicks )
+#endif
+
+#ifndef traceENTER_xTaskGetTickCountFromISR
+    #define traceENTER_xTaskGetTickCountFromISR()
+#endif
+
+#ifndef traceRETURN_xTaskGetTickCountFromISR
+    #define traceRETURN_xTaskGetTickCountFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_uxTaskGetNumberOfTasks
+    #define traceENTER_uxTaskGetNumberOfTasks()
+#endif
+
+#ifndef traceRETURN_uxTaskGetNumberOfTasks
+    #define traceRETURN_uxTaskGetNumberOfTasks( uxCurrentNumberOfTasks )
+#endif
+
+#ifndef traceENTER_pcTaskGetName
+    #define traceENTER_pcTaskGetName( xTaskToQuery )
+#endif
+
+#ifndef traceRETURN_pcTaskGetName
+    #define traceRETURN_pcTaskGetName( pcTaskName )
+#endif
+
+#ifndef traceENTER_xTaskGetHandle
+    #define traceENTER_xTaskGetHandle( pcNameToQuery )
+#endif
+
+#ifndef traceRETURN_xTaskGetHandle
+    #define traceRETURN_xTaskGetHandle( pxTCB )
+#endif
+
+#ifndef traceENTER_xTaskGetStaticBuffers
+    #define traceENTER_xTaskGetStaticBuffers( xTask, ppuxStackBuffer, ppxTaskBuffer )
+#endif
+
+#ifndef traceRETURN_xTaskGetStaticBuffers
+    #define traceRETURN_xTaskGetStaticBuffers( xReturn )
+#endif
+
+#ifndef traceENTER_uxTaskGetSystemState
+    #define traceENTER_uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, pulTotalRunTime )
+#endif
+
+#ifndef traceRETURN_uxTaskGetSystemState
+    #define traceRETURN_uxTaskGetSystemState( uxTask )
+#endif
+
+#ifndef traceENTER_uxTaskGetRunTimeSnapshot
+    #define traceENTER_uxTaskGetRunTimeSnapshot( pxSnapshotArray, uxArraySize, pulTotalRunTime )
+#endif
+
+#ifndef traceRETURN_uxTaskGetRunTimeSnapshot
+    #define traceRETURN_uxTaskGetRunTimeSnapshot( uxTask )
+#endif
+
+#if ( configNUMBER_OF_CORES == 1 )
+    #ifndef traceENTER_xTaskGetIdleTaskHandle
+        #define traceENTER_xTaskGetIdleTaskHandle()
+    #endif
+#endif
+
+#if ( configNUMBER_OF_CORES == 1 )
+    #ifndef traceRETURN_xTaskGetIdleTaskHandle
+        #define traceRETURN_xTaskGetIdleTaskHandle( xIdleTaskHandle )
+    #endif
+#endif
+
+#ifndef traceENTER_xTaskGetIdleTaskHandleForCore
+    #define traceENTER_xTaskGetIdleTaskHandleForCore( xCoreID )
+#endif
+
+#ifndef traceRETURN_xTaskGetIdleTaskHandleForCore
+    #define traceRETURN_xTaskGetIdleTaskHandleForCore( xIdleTaskHandle )
+#endif
+
+#ifndef traceENTER_vTaskStepTick
+    #define traceENTER_vTaskStepTick( xTicksToJump )
+#endif
+
+#ifndef traceRETURN_vTaskStepTick
+    #define traceRETURN_vTaskStepTick()
+#endif
+
+#ifndef traceENTER_xTaskCatchUpTicks
+    #define traceENTER_xTaskCatchUpTicks( xTicksToCatchUp )
+#endif
+
+#ifndef traceRETURN_xTaskCatchUpTicks
+    #define traceRETURN_xTaskCatchUpTicks( xYieldOccurred )
+#endif
+
+#ifndef traceENTER_xTaskProcessElapsedTicks
+    #define traceENTER_xTaskProcessElapsedTicks( xElapsedTicks )
+#endif
+
+#ifndef traceRETURN_xTaskProcessElapsedTicks
+    #define traceRETURN_xTaskProcessElapsedTicks( xSwitchRequired )
+#endif
+
+#ifndef traceENTER_vTaskDelayUs
+    #define traceENTER_vTaskDelayUs( ulMicroseconds )
+#endif
+
+#ifndef traceRETURN_vTaskDelayUs
+    #define traceRETURN_vTaskDelayUs()
+#endif
+
+#ifndef traceENTER_xTaskProcessHrAlarmFromISR
+    #define traceENTER_xTaskProcessHrAlarmFromISR()
+#endif
+
+#ifndef traceRETURN_xTaskProcessHrAlarmFromISR
+    #define traceRETURN_xTaskProcessHrAlarmFromISR( xSwitchRequired )
+#endif
+
+#ifndef traceENTER_xQueueReceiveUs
+    #define traceENTER_xQueueReceiveUs( xQueue, pvBuffer, ulMicroseconds )
+#endif
+
+#ifndef traceRETURN_xQueueReceiveUs
+    #define traceRETURN_xQueueReceiveUs( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskAbortDelay
+    #define traceENTER_xTaskAbortDelay( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskAbortDelay
+    #define traceRETURN_xTaskAbortDelay( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskYieldIfHigherReady
+    #define traceENTER_xTaskYieldIfHigherReady( puxTasksAtSamePriority )
+#endif
+
+#ifndef traceRETURN_xTaskYieldIfHigherReady
+    #define traceRETURN_xTaskYieldIfHigherReady( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskIncrementTick
+    #define traceENTER_xTaskIncrementTick()
+#endif
+
+#ifndef traceRETURN_xTaskIncrementTick
+    #define traceRETURN_xTaskIncrementTick( xSwitchRequired )
+#endif
+
+#ifndef traceENTER_vTaskSetApplicationTaskTag
+    #define traceENTER_vTaskSetApplicationTaskTag( xTask, pxHookFunction )
+#endif
+
+#ifndef traceRETURN_vTaskSetApplicationTaskTag
+    #define traceRETURN_vTaskSetApplicationTaskTag()
+#endif
+
+#ifndef traceENTER_xTaskGetApplicationTaskTag
+    #define traceENTER_xTaskGetApplicationTaskTag( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGetApplicationTaskTag
+    #define traceRETURN_xTaskGetApplicationTaskTag( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetUsesVectorUnit
+    #define traceENTER_vTaskSetUsesVectorUnit( xTask, xUsesVectorUnit )
+#endif
+
+#ifndef traceRETURN_vTaskSetUsesVectorUnit
+    #define traceRETURN_vTaskSetUsesVectorUnit()
+#endif
+
+#ifndef traceENTER_xTaskGetUsesVectorUnit
+    #define traceENTER_xTaskGetUsesVectorUnit( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGetUsesVectorUnit
+    #define traceRETURN_xTaskGetUsesVectorUnit( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskGetApplicationTaskTagFromISR
+    #define traceENTER_xTaskGetApplicationTaskTagFromISR( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGetApplicationTaskTagFromISR
+    #define traceRETURN_xTaskGetApplicationTaskTagFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskCallApplicationTaskHook
+    #define traceENTER_xTaskCallApplicationTaskHook( xTask, pvParameter )
+#endif
+
+#ifndef traceRETURN_xTaskCallApplicationTaskHook
+    #define traceRETURN_xTaskCallApplicationTaskHook( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskSwitchContext
+    #define traceENTER_vTaskSwitchContext()
+#endif
+
+#ifndef traceRETURN_vTaskSwitchContext
+    #define traceRETURN_vTaskSwitchContext()
+#endif
+
+#ifndef traceENTER_vTaskPlaceOnEventList
+    #define traceENTER_vTaskPlaceOnEventList( pxEventList, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_vTaskPlaceOnEventList
+    #define traceRETURN_vTaskPlaceOnEventList()
+#endif
+
+#ifndef traceENTER_vTaskPlaceOnUnorderedEventList
+    #define traceENTER_vTaskPlaceOnUnorderedEventList( pxEventList, xItemValue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_vTaskPlaceOnUnorderedEventList
+    #define traceRETURN_vTaskPlaceOnUnorderedEventList()
+#endif
+
+#ifndef traceENTER_vTaskPlaceOnEventListRestricted
+    #define traceENTER_vTaskPlaceOnEventListRestricted( pxEventList, xTicksToWait, xWaitIndefinitely )
+#endif
+
+#ifndef traceRETURN_vTaskPlaceOnEventListRestricted
+    #define traceRETURN_vTaskPlaceOnEventListRestricted()
+#endif
+
+#ifndef traceENTER_xTaskRemoveFromEventList
+    #define traceENTER_xTaskRemoveFromEventList( pxEventList )
+#endif
+
+#ifndef traceRETURN_xTaskRemoveFromEventList
+    #define traceRETURN_xTaskRemoveFromEventList( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskRemoveFromUnorderedEventList
+    #define traceENTER_vTaskRemoveFromUnorderedEventList( pxEventListItem, xItemValue )
+#endif
+
+#ifndef traceRETURN_vTaskRemoveFromUnorderedEventList
+    #define traceRETURN_vTaskRemoveFromUnorderedEventList()
+#endif
+
+#ifndef traceENTER_xTaskRemoveFromUnorderedEventListFromISR
+    #define traceENTER_xTaskRemoveFromUnorderedEventListFromISR( pxEventListItem, xItemValue )
+#endif
+
+#ifndef traceRETURN_xTaskRemoveFromUnorderedEventListFromISR
+    #define traceRETURN_xTaskRemoveFromUnorderedEventListFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_pvTaskTakeCachedAllocation
+    #define traceENTER_pvTaskTakeCachedAllocation( uxSizeClass )
+#endif
+
+#ifndef traceRETURN_pvTaskTakeCachedAllocation
+    #define traceRETURN_pvTaskTakeCachedAllocation( pvReturn )
+#endif
+
+#ifndef traceENTER_xTaskCacheAllocation
+    #define traceENTER_xTaskCacheAllocation( uxSizeClass, pv )
+#endif
+
+#ifndef traceRETURN_xTaskCacheAllocation
+    #define traceRETURN_xTaskCacheAllocation( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetTimeOutState
+    #define traceENTER_vTaskSetTimeOutState( pxTimeOut )
+#endif
+
+#ifndef traceRETURN_vTaskSetTimeOutState
+    #define traceRETURN_vTaskSetTimeOutState()
+#endif
+
+#ifndef traceENTER_vTaskInternalSetTimeOutState
+    #define traceENTER_vTaskInternalSetTimeOutState( pxTimeOut )
+#endif
+
+#ifndef traceRETURN_vTaskInternalSetTimeOutState
+    #define traceRETURN_vTaskInternalSetTimeOutState()
+#endif
+
+#ifndef traceENTER_xTaskCheckForTimeOut
+    #define traceENTER_xTaskCheckForTimeOut( pxTimeOut, pxTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTaskCheckForTimeOut
+    #define traceRETURN_xTaskCheckForTimeOut( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskMissedYield
+    #define traceENTER_vTaskMissedYield()
+#endif
+
+#ifndef traceRETURN_vTaskMissedYield
+    #define traceRETURN_vTaskMissedYield()
+#endif
+
+#ifndef traceENTER_uxTaskGetTaskNumber
+    #define traceENTER_uxTaskGetTaskNumber( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskGetTaskNumber
+    #define traceRETURN_uxTaskGetTaskNumber( uxReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetTaskNumber
+    #define traceENTER_vTaskSetTaskNumber( xTask, uxHandle )
+#endif
+
+#ifndef traceRETURN_vTaskSetTaskNumber
+    #define traceRETURN_vTaskSetTaskNumber()
+#endif
+
+#ifndef traceENTER_eTaskConfirmSleepModeStatus
+    #define traceENTER_eTaskConfirmSleepModeStatus()
+#endif
+
+#ifndef traceRETURN_eTaskConfirmSleepModeStatus
+    #define traceRETURN_eTaskConfirmSleepModeStatus( eReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetThreadLocalStoragePointer
+    #define traceENTER_vTaskSetThreadLocalStoragePointer( xTaskToSet, xIndex, pvValue )
+#endif
+
+#ifndef traceRETURN_vTaskSetThreadLocalStoragePointer
+    #define traceRETURN_vTaskSetThreadLocalStoragePointer()
+#endif
+
+#ifndef traceENTER_pvTaskGetThreadLocalStoragePointer
+    #define traceENTER_pvTaskGetThreadLocalStoragePointer( xTaskToQuery, xIndex )
+#endif
+
+#ifndef traceRETURN_pvTaskGetThreadLocalStoragePointer
+    #define traceRETURN_pvTaskGetThreadLocalStoragePointer( pvReturn )
+#endif
+
+#ifndef traceENTER_vTaskAllocateMPURegions
+    #define traceENTER_vTaskAllocateMPURegions( xTaskToModify, pxRegions )
+#endif
+
+#ifndef traceRETURN_vTaskAllocateMPURegions
+    #define traceRETURN_vTaskAllocateMPURegions()
+#endif
+
+#ifndef traceENTER_vTaskGetInfo
+    #define traceENTER_vTaskGetInfo( xTask, pxTaskStatus, xGetFreeStackSpace, eState )
+#endif
+
+#ifndef traceRETURN_vTaskGetInfo
+    #define traceRETURN_vTaskGetInfo()
+#endif
+
+#ifndef traceENTER_uxTaskGetStackHighWaterMark2
+    #define traceENTER_uxTaskGetStackHighWaterMark2( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskGetStackHighWaterMark2
+    #define traceRETURN_uxTaskGetStackHighWaterMark2( uxReturn )
+#endif
+
+#ifndef traceENTER_uxTaskGetStackPeak
+    #define traceENTER_uxTaskGetStackPeak( xTask, ppvProgramCounter )
+#endif
+
+#ifndef traceRETURN_uxTaskGetStackPeak
+    #define traceRETURN_uxTaskGetStackPeak( uxReturn )
+#endif
+
+#ifndef traceENTER_vTaskResetStackPeak
+    #define traceENTER_vTaskResetStackPeak( xTask )
+#endif
+
+#ifndef traceRETURN_vTaskResetStackPeak
+    #define traceRETURN_vTaskResetStackPeak()
+#endif
+
+#ifndef traceENTER_vTaskSampleStackPeakFromISR
+    #define traceENTER_vTaskSampleStackPeakFromISR( pxStackPointer, pvProgramCounter )
+#endif
+
+#ifndef traceRETURN_vTaskSampleStackPeakFromISR
+    #define traceRETURN_vTaskSampleStackPeakFromISR()
+#endif
+
+#ifndef traceENTER_vTaskRecordPCSampleFromISR
+    #define traceENTER_vTaskRecordPCSampleFromISR( pvProgramCounter )
+#endif
+
+#ifndef traceRETURN_vTaskRecordPCSampleFromISR
+    #define traceRETURN_vTaskRecordPCSampleFromISR()
+#endif
+
+#ifndef traceENTER_uxTaskGetPCSamples
+    #define traceENTER_uxTaskGetPCSamples( pxSampleArray, uxArraySize )
+#endif
+
+#ifndef traceRETURN_uxTaskGetPCSamples
+    #define traceRETURN_uxTaskGetPCSamples( uxCount )
+#endif
+
+#ifndef traceENTER_vTaskListStackPeaks
+    #define traceENTER_vTaskListStackPeaks( pcWriteBuffer, uxBufferLength )
+#endif
+
+#ifndef traceRETURN_vTaskListStackPeaks
+    #define traceRETURN_vTaskListStackPeaks()
+#endif
+
+#ifndef traceENTER_uxTaskGetISRStackHighWaterMark
+    #define traceENTER_uxTaskGetISRStackHighWaterMark( xCoreID )
+#endif
+
+#ifndef traceRETURN_uxTaskGetISRStackHighWaterMark
+    #define traceRETURN_uxTaskGetISRStackHighWaterMark( uxReturn )
+#endif
+
+#ifndef traceENTER_uxTaskGetStackHighWaterMark
+    #define traceENTER_uxTaskGetStackHighWaterMark( xTask )
+#endif
+
+#ifndef traceRETURN_uxTaskGetStackHighWaterMark
+    #define traceRETURN_uxTaskGetStackHighWaterMark( uxReturn )
+#endif
+
+#ifndef traceENTER_xTaskGetCurrentTaskHandle
+    #define traceENTER_xTaskGetCurrentTaskHandle()
+#endif
+
+#ifndef traceRETURN_xTaskGetCurrentTaskHandle
+    #define traceRETURN_xTaskGetCurrentTaskHandle( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskGetCurrentTaskHandleForCore
+    #define traceENTER_xTaskGetCurrentTaskHandleForCore( xCoreID )
+#endif
+
+#ifndef traceRETURN_xTaskGetCurrentTaskHandleForCore
+    #define traceRETURN_xTaskGetCurrentTaskHandleForCore( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskGetSchedulerState
+    #define traceENTER_xTaskGetSchedulerState()
+#endif
+
+#ifndef traceRETURN_xTaskGetSchedulerState
+    #define traceRETURN_xTaskGetSchedulerState( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskPriorityInherit
+    #define traceENTER_xTaskPriorityInherit( pxMutexHolder )
+#endif
+
+#ifndef traceRETURN_xTaskPriorityInherit
+    #define traceRETURN_xTaskPriorityInherit( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskPriorityDisinherit
+    #define traceENTER_xTaskPriorityDisinherit( pxMutexHolder )
+#endif
+
+#ifndef traceRETURN_xTaskPriorityDisinherit
+    #define traceRETURN_xTaskPriorityDisinherit( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskPriorityDisinheritAfterTimeout
+    #define traceENTER_vTaskPriorityDisinheritAfterTimeout( pxMutexHolder, uxHighestPriorityWaitingTask )
+#endif
+
+#ifndef traceRETURN_vTaskPriorityDisinheritAfterTimeout
+    #define traceRETURN_vTaskPriorityDisinheritAfterTimeout()
+#endif
+
+#ifndef traceENTER_vTaskPriorityRaiseToCeiling
+    #define traceENTER_vTaskPriorityRaiseToCeiling( uxCeilingPriority )
+#endif
+
+#ifndef traceRETURN_vTaskPriorityRaiseToCeiling
+    #define traceRETURN_vTaskPriorityRaiseToCeiling()
+#endif
+
+#ifndef traceENTER_vTaskInternalSetBlockedOnMutex
+    #define traceENTER_vTaskInternalSetBlockedOnMutex( pxMutexHolder )
+#endif
+
+#ifndef traceRETURN_vTaskInternalSetBlockedOnMutex
+    #define traceRETURN_vTaskInternalSetBlockedOnMutex()
+#endif
+
+#ifndef traceENTER_vTaskYieldWithinAPI
+    #define traceENTER_vTaskYieldWithinAPI()
+#endif
+
+#ifndef traceRETURN_vTaskYieldWithinAPI
+    #define traceRETURN_vTaskYieldWithinAPI()
+#endif
+
+#ifndef traceENTER_vTaskEnterCritical
+    #define traceENTER_vTaskEnterCritical()
+#endif
+
+#ifndef traceRETURN_vTaskEnterCritical
+    #define traceRETURN_vTaskEnterCritical()
+#endif
+
+#ifndef traceENTER_vTaskEnterCriticalFromISR
+    #define traceENTER_vTaskEnterCriticalFromISR()
+#endif
+
+#ifndef traceRETURN_vTaskEnterCriticalFromISR
+    #define traceRETURN_vTaskEnterCriticalFromISR( uxSavedInterruptStatus )
+#endif
+
+#ifndef traceENTER_vTaskExitCritical
+    #define traceENTER_vTaskExitCritical()
+#endif
+
+#ifndef traceRETURN_vTaskExitCritical
+    #define traceRETURN_vTaskExitCritical()
+#endif
+
+#ifndef traceENTER_vTaskExitCriticalFromISR
+    #define traceENTER_vTaskExitCriticalFromISR( uxSavedInterruptStatus )
+#endif
+
+#ifndef traceRETURN_vTaskExitCriticalFromISR
+    #define traceRETURN_vTaskExitCriticalFromISR()
+#endif
+
+#ifndef traceENTER_vTaskDataGroupEnterCritical
+    #define traceENTER_vTaskDataGroupEnterCritical( pxSpinlock )
+#endif
+
+#ifndef traceRETURN_vTaskDataGroupEnterCritical
+    #define traceRETURN_vTaskDataGroupEnterCritical()
+#endif
+
+#ifndef traceENTER_vTaskDataGroupExitCritical
+    #define traceENTER_vTaskDataGroupExitCritical( pxSpinlock )
+#endif
+
+#ifndef traceRETURN_vTaskDataGroupExitCritical
+    #define traceRETURN_vTaskDataGroupExitCritical()
+#endif
+
+#ifndef traceENTER_uxTaskDataGroupEnterCriticalFromISR
+    #define traceENTER_uxTaskDataGroupEnterCriticalFromISR( pxSpinlock )
+#endif
+
+#ifndef traceRETURN_uxTaskDataGroupEnterCriticalFromISR
+    #define traceRETURN_uxTaskDataGroupEnterCriticalFromISR( uxSavedInterruptStatus )
+#endif
+
+#ifndef traceENTER_vTaskDataGroupExitCriticalFromISR
+    #define traceENTER_vTaskDataGroupExitCriticalFromISR( uxSavedInterruptStatus, pxSpinlock )
+#endif
+
+#ifndef traceRETURN_vTaskDataGroupExitCriticalFromISR
+    #define traceRETURN_vTaskDataGroupExitCriticalFromISR()
+#endif
+
+#ifndef traceENTER_vTaskListTasks
+    #define traceENTER_vTaskListTasks( pcWriteBuffer, uxBufferLength )
+#endif
+
+#ifndef traceRETURN_vTaskListTasks
+    #define traceRETURN_vTaskListTasks()
+#endif
+
+#ifndef traceENTER_vTaskGetRunTimeStatistics
+    #define traceENTER_vTaskGetRunTimeStatistics( pcWriteBuffer, uxBufferLength )
+#endif
+
+#ifndef traceRETURN_vTaskGetRunTimeStatistics
+    #define traceRETURN_vTaskGetRunTimeStatistics()
+#endif
+
+#ifndef traceENTER_xIdleWorkSubmit
+    #define traceENTER_xIdleWorkSubmit( pxFunction, pvParameter )
+#endif
+
+#ifndef traceRETURN_xIdleWorkSubmit
+    #define traceRETURN_xIdleWorkSubmit( xReturn )
+#endif
+
+#ifndef traceENTER_xIdleWorkSubmitFromISR
+    #define traceENTER_xIdleWorkSubmitFromISR( pxFunction, pvParameter )
+#endif
+
+#ifndef traceRETURN_xIdleWorkSubmitFromISR
+    #define traceRETURN_xIdleWorkSubmitFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xIdleWorkSubmitToCore
+    #define traceENTER_xIdleWorkSubmitToCore( pxFunction, pvParameter, xCoreID )
+#endif
+
+#ifndef traceRETURN_xIdleWorkSubmitToCore
+    #define traceRETURN_xIdleWorkSubmitToCore( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskListTasksStream
+    #define traceENTER_vTaskListTasksStream( pxWriter, pvContext )
+#endif
+
+#ifndef traceRETURN_vTaskListTasksStream
+    #define traceRETURN_vTaskListTasksStream()
+#endif
+
+#ifndef traceENTER_vTaskGetRunTimeStatisticsStream
+    #define traceENTER_vTaskGetRunTimeStatisticsStream( pxWriter, pvContext )
+#endif
+
+#ifndef traceRETURN_vTaskGetRunTimeStatisticsStream
+    #define traceRETURN_vTaskGetRunTimeStatisticsStream()
+#endif
+
+#ifndef traceENTER_uxTaskResetEventItemValue
+    #define traceENTER_uxTaskResetEventItemValue()
+#endif
+
+#ifndef traceRETURN_uxTaskResetEventItemValue
+    #define traceRETURN_uxTaskResetEventItemValue( uxReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetEventGroupBits
+    #define traceENTER_vTaskSetEventGroupBits( xTask, ullBits )
+#endif
+
+#ifndef traceRETURN_vTaskSetEventGroupBits
+    #define traceRETURN_vTaskSetEventGroupBits()
+#endif
+
+#ifndef traceENTER_ullTaskGetEventGroupBits
+    #define traceENTER_ullTaskGetEventGroupBits( xTask )
+#endif
+
+#ifndef traceRETURN_ullTaskGetEventGroupBits
+    #define traceRETURN_ullTaskGetEventGroupBits( ullReturn )
+#endif
+
+#ifndef traceENTER_pvTaskIncrementMutexHeldCount
+    #define traceENTER_pvTaskIncrementMutexHeldCount()
+#endif
+
+#ifndef traceRETURN_pvTaskIncrementMutexHeldCount
+    #define traceRETURN_pvTaskIncrementMutexHeldCount( pxTCB )
+#endif
+
+#ifndef traceENTER_ulTaskGenericNotifyTake
+    #define traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_ulTaskGenericNotifyTake
+    #define traceRETURN_ulTaskGenericNotifyTake( ulReturn )
+#endif
+
+#ifndef traceENTER_xTaskGenericNotifyWait
+    #define traceENTER_xTaskGenericNotifyWait( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTaskGenericNotifyWait
+    #define traceRETURN_xTaskGenericNotifyWait( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskNotifyWaitAnyIndexed
+    #define traceENTER_xTaskNotifyWaitAnyIndexed( uxIndexMask, ulBitsToClearOnEntry, ulBitsToClearOnExit, puxIndexNotified, pulNotificationValue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTaskNotifyWaitAnyIndexed
+    #define traceRETURN_xTaskNotifyWaitAnyIndexed( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskNotifySendMessage
+    #define traceENTER_xTaskNotifySendMessage( xTaskToNotify, pvMessage )
+#endif
+
+#ifndef traceRETURN_xTaskNotifySendMessage
+    #define traceRETURN_xTaskNotifySendMessage( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskNotifySendMessageFromISR
+    #define traceENTER_xTaskNotifySendMessageFromISR( xTaskToNotify, pvMessage, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xTaskNotifySendMessageFromISR
+    #define traceRETURN_xTaskNotifySendMessageFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskNotifyReceiveMessage
+    #define traceENTER_xTaskNotifyReceiveMessage( ppvMessage, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTaskNotifyReceiveMessage
+    #define traceRETURN_xTaskNotifyReceiveMessage( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskGenericNotify
+    #define traceENTER_xTaskGenericNotify( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue )
+#endif
+
+#ifndef traceRETURN_xTaskGenericNotify
+    #define traceRETURN_xTaskGenericNotify( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskGenericNotifyFromISR
+    #define traceENTER_xTaskGenericNotifyFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xTaskGenericNotifyFromISR
+    #define traceRETURN_xTaskGenericNotifyFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskGenericNotifyGiveFromISR
+    #define traceENTER_vTaskGenericNotifyGiveFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_vTaskGenericNotifyGiveFromISR
+    #define traceRETURN_vTaskGenericNotifyGiveFromISR()
+#endif
+
+#ifndef traceENTER_xTaskGenericNotifyStateClear
+    #define traceENTER_xTaskGenericNotifyStateClear( xTask, uxIndexToClear )
+#endif
+
+#ifndef traceRETURN_xTaskGenericNotifyStateClear
+    #define traceRETURN_xTaskGenericNotifyStateClear( xReturn )
+#endif
+
+#ifndef traceENTER_ulTaskGenericNotifyValueClear
+    #define traceENTER_ulTaskGenericNotifyValueClear( xTask, uxIndexToClear, ulBitsToClear )
+#endif
+
+#ifndef traceRETURN_ulTaskGenericNotifyValueClear
+    #define traceRETURN_ulTaskGenericNotifyValueClear( ulReturn )
+#endif
+
+#ifndef traceENTER_xTaskWaitOnAddress
+    #define traceENTER_xTaskWaitOnAddress( pulAddress, ulExpectedValue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xTaskWaitOnAddress
+    #define traceRETURN_xTaskWaitOnAddress( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskWakeAddress
+    #define traceENTER_xTaskWakeAddress( pulAddress, uxTasksToWake )
+#endif
+
+#ifndef traceRETURN_xTaskWakeAddress
+    #define traceRETURN_xTaskWakeAddress( xTasksWoken )
+#endif
+
+#ifndef traceENTER_ulTaskGetRunTimeCounter
+    #define traceENTER_ulTaskGetRunTimeCounter( xTask )
+#endif
+
+#ifndef traceRETURN_ulTaskGetRunTimeCounter
+    #define traceRETURN_ulTaskGetRunTimeCounter( ulRunTimeCounter )
+#endif
+
+#ifndef traceENTER_ulTaskGetRunTimePercent
+    #define traceENTER_ulTaskGetRunTimePercent( xTask )
+#endif
+
+#ifndef traceRETURN_ulTaskGetRunTimePercent
+    #define traceRETURN_ulTaskGetRunTimePercent( ulReturn )
+#endif
+
+#ifndef traceENTER_ulTaskGetIdleRunTimeCounter
+    #define traceENTER_ulTaskGetIdleRunTimeCounter()
+#endif
+
+#ifndef traceRETURN_ulTaskGetIdleRunTimeCounter
+    #define traceRETURN_ulTaskGetIdleRunTimeCounter( ulReturn )
+#endif
+
+#ifndef traceENTER_ulTaskGetIdleRunTimePercent
+    #define traceENTER_ulTaskGetIdleRunTimePercent()
+#endif
+
+#ifndef traceRETURN_ulTaskGetIdleRunTimePercent
+    #define traceRETURN_ulTaskGetIdleRunTimePercent( ulReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetSwitchReason
+    #define traceENTER_vTaskSetSwitchReason( eReason )
+#endif
+
+#ifndef traceRETURN_vTaskSetSwitchReason
+    #define traceRETURN_vTaskSetSwitchReason()
+#endif
+
+#ifndef traceENTER_vTaskGetSwitchReasonCounts
+    #define traceENTER_vTaskGetSwitchReasonCounts( pulCounts )
+#endif
+
+#ifndef traceRETURN_vTaskGetSwitchReasonCounts
+    #define traceRETURN_vTaskGetSwitchReasonCounts()
+#endif
+
+#ifndef traceENTER_vTaskResetSwitchReasonCounts
+    #define traceENTER_vTaskResetSwitchReasonCounts()
+#endif
+
+#ifndef traceRETURN_vTaskResetSwitchReasonCounts
+    #define traceRETURN_vTaskResetSwitchReasonCounts()
+#endif
+
+#ifndef traceENTER_vTaskGetCriticalSectionStats
+    #define traceENTER_vTaskGetCriticalSectionStats( pxStats )
+#endif
+
+#ifndef traceRETURN_vTaskGetCriticalSectionStats
+    #define traceRETURN_vTaskGetCriticalSectionStats()
+#endif
+
+#ifndef traceENTER_vTaskResetCriticalSectionStats
+    #define traceENTER_vTaskResetCriticalSectionStats()
+#endif
+
+#ifndef traceRETURN_vTaskResetCriticalSectionStats
+    #define traceRETURN_vTaskResetCriticalSectionStats()
+#endif
+
+#ifndef traceENTER_vTaskGetTicklessIdleStats
+    #define traceENTER_vTaskGetTicklessIdleStats( pxStats )
+#endif
+
+#ifndef traceRETURN_vTaskGetTicklessIdleStats
+    #define traceRETURN_vTaskGetTicklessIdleStats()
+#endif
+
+#ifndef traceENTER_uxTaskGetWakeSourceHistogram
+    #define traceENTER_uxTaskGetWakeSourceHistogram( pxHistogram, uxArraySize )
+#endif
+
+#ifndef traceRETURN_uxTaskGetWakeSourceHistogram
+    #define traceRETURN_uxTaskGetWakeSourceHistogram( uxEntries )
+#endif
+
+#ifndef traceENTER_vTaskResetTicklessIdleStats
+    #define traceENTER_vTaskResetTicklessIdleStats()
+#endif
+
+#ifndef traceRETURN_vTaskResetTicklessIdleStats
+    #define traceRETURN_vTaskResetTicklessIdleStats()
+#endif
+
+#ifndef traceTICKLESS_SLEEP_END
+    #define traceTICKLESS_SLEEP_END( xExpectedIdleTime, xTicksSlept, ulWakeSource )
+#endif
+
+#ifndef traceENTER_xTaskGetCoreLoad
+    #define traceENTER_xTaskGetCoreLoad( xCoreID, puxLoad )
+#endif
+
+#ifndef traceRETURN_xTaskGetCoreLoad
+    #define traceRETURN_xTaskGetCoreLoad( xReturn )
+#endif
+
+#ifndef traceENTER_ulTaskGetCoreIdleRunTimeCounter
+    #define traceENTER_ulTaskGetCoreIdleRunTimeCounter( xCoreID )
+#endif
+
+#ifndef traceRETURN_ulTaskGetCoreIdleRunTimeCounter
+    #define traceRETURN_ulTaskGetCoreIdleRunTimeCounter( ulReturn )
+#endif
+
+#ifndef traceENTER_uxTaskGetDVFSLevel
+    #define traceENTER_uxTaskGetDVFSLevel()
+#endif
+
+#ifndef traceRETURN_uxTaskGetDVFSLevel
+    #define traceRETURN_uxTaskGetDVFSLevel( uxReturn )
+#endif
+
+#ifndef traceENTER_ulTaskGetISRRunTimeCounter
+    #define traceENTER_ulTaskGetISRRunTimeCounter()
+#endif
+
+#ifndef traceRETURN_ulTaskGetISRRunTimeCounter
+    #define traceRETURN_ulTaskGetISRRunTimeCounter( ulReturn )
+#endif
+
+#ifndef traceENTER_ulTaskGetInterruptRunTimeCounter
+    #define traceENTER_ulTaskGetInterruptRunTimeCounter( uxInterruptNumber, pulEntries )
+#endif
+
+#ifndef traceRETURN_ulTaskGetInterruptRunTimeCounter
+    #define traceRETURN_ulTaskGetInterruptRunTimeCounter( ulReturn )
+#endif
+
+#ifndef traceENTER_ulTaskGetMaxISRToTaskLatency
+    #define traceENTER_ulTaskGetMaxISRToTaskLatency()
+#endif
+
+#ifndef traceRETURN_ulTaskGetMaxISRToTaskLatency
+    #define traceRETURN_ulTaskGetMaxISRToTaskLatency( ulReturn )
+#endif
+
+#ifndef traceENTER_xTaskGetMessageTag
+    #define traceENTER_xTaskGetMessageTag( pxTag )
+#endif
+
+#ifndef traceRETURN_xTaskGetMessageTag
+    #define traceRETURN_xTaskGetMessageTag( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskClearMessageTag
+    #define traceENTER_vTaskClearMessageTag()
+#endif
+
+#ifndef traceRETURN_vTaskClearMessageTag
+    #define traceRETURN_vTaskClearMessageTag()
+#endif
+
+#ifndef traceENTER_vTaskGetNotifyLatencyHistogram
+    #define traceENTER_vTaskGetNotifyLatencyHistogram( xTask, pxHistogram )
+#endif
+
+#ifndef traceRETURN_vTaskGetNotifyLatencyHistogram
+    #define traceRETURN_vTaskGetNotifyLatencyHistogram()
+#endif
+
+#ifndef traceENTER_xTaskGetMPUSettings
+    #define traceENTER_xTaskGetMPUSettings( xTask )
+#endif
+
+#ifndef traceRETURN_xTaskGetMPUSettings
+    #define traceRETURN_xTaskGetMPUSettings( xMPUSettings )
+#endif
+
+#ifndef traceENTER_xStreamBufferGenericCreate
+    #define traceENTER_xStreamBufferGenericCreate( xBufferSizeBytes, xTriggerLevelBytes, xStreamBufferType, pxSendCompletedCallback, pxReceiveCompletedCallback )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGenericCreate
+    #define traceRETURN_xStreamBufferGenericCreate( pvAllocatedMemory )
+#endif
+
+#ifndef traceENTER_xStreamBufferGenericCreateStatic
+    #define traceENTER_xStreamBufferGenericCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, xStreamBufferType, pucStreamBufferStorageArea, pxStaticStreamBuffer, pxSendCompletedCallback, pxReceiveCompletedCallback )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGenericCreateStatic
+    #define traceRETURN_xStreamBufferGenericCreateStatic( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferGetStaticBuffers
+    #define traceENTER_xStreamBufferGetStaticBuffers( xStreamBuffer, ppucStreamBufferStorageArea, ppxStaticStreamBuffer )
+#endif
+
+#ifndef traceRETURN_xStreamBufferGetStaticBuffers
+    #define traceRETURN_xStreamBufferGetStaticBuffers( xReturn )
+#endif
+
+#ifndef traceENTER_vStreamBufferDelete
+    #define traceENTER_vStreamBufferDelete( xStreamBuffer )
+#endif
+
+#ifndef traceRETURN_vStreamBufferDelete
+    #define traceRETURN_vStreamBufferDelete()
+#endif
+
+#ifndef traceENTER_xStreamBufferReset
+    #define traceENTER_xStreamBufferReset( xStreamBuffer )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReset
+    #define traceRETURN_xStreamBufferReset( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferResetFromISR
+    #define traceENTER_xStreamBufferResetFromISR( xStreamBuffer )
 #endif
 
-#ifndef traceTAKE_MUTEX_RECURSIVE_FAILED
-    #define traceTAKE_MUTEX_RECURSIVE_FAILED( pxMutex )
+#ifndef traceRETURN_xStreamBufferResetFromISR
+    #define traceRETURN_xStreamBufferResetFromISR( xReturn )
 #endif
 
-#ifndef traceCREATE_COUNTING_SEMAPHORE
-    #define traceCREATE_COUNTING_SEMAPHORE()
+#ifndef traceENTER_xStreamBufferSetTriggerLevel
+    #define traceENTER_xStreamBufferSetTriggerLevel( xStreamBuffer, xTriggerLevel )
 #endif
 
-#ifndef traceCREATE_COUNTING_SEMAPHORE_FAILED
-    #define traceCREATE_COUNTING_SEMAPHORE_FAILED()
+#ifndef traceRETURN_xStreamBufferSetTriggerLevel
+    #define traceRETURN_xStreamBufferSetTriggerLevel( xReturn )
 #endif
 
-#ifndef traceQUEUE_SET_SEND
-    #define traceQUEUE_SET_SEND    traceQUEUE_SEND
+#ifndef traceENTER_xStreamBufferSetWatermarks
+    #define traceENTER_xStreamBufferSetWatermarks( xStreamBuffer, xHighWatermarkBytes, xLowWatermarkBytes, pxWatermarkCallback )
 #endif
 
-#ifndef traceQUEUE_SEND
-    #define traceQUEUE_SEND( pxQueue )
+#ifndef traceRETURN_xStreamBufferSetWatermarks
+    #define traceRETURN_xStreamBufferSetWatermarks( xReturn )
 #endif
 
-#ifndef traceQUEUE_SEND_FAILED
-    #define traceQUEUE_SEND_FAILED( pxQueue )
+#ifndef traceENTER_xStreamBufferSpacesAvailable
+    #define traceENTER_xStreamBufferSpacesAvailable( xStreamBuffer )
 #endif
 
-#ifndef traceQUEUE_RECEIVE
-    #define traceQUEUE_RECEIVE( pxQueue )
+#ifndef traceRETURN_xStreamBufferSpacesAvailable
+    #define traceRETURN_xStreamBufferSpacesAvailable( xSpace )
 #endif
 
-#ifndef traceQUEUE_PEEK
-    #define traceQUEUE_PEEK( pxQueue )
+#ifndef traceENTER_xStreamBufferBytesAvailable
+    #define traceENTER_xStreamBufferBytesAvailable( xStreamBuffer )
 #endif
 
-#ifndef traceQUEUE_PEEK_FAILED
-    #define traceQUEUE_PEEK_FAILED( pxQueue )
+#ifndef traceRETURN_xStreamBufferBytesAvailable
+    #define traceRETURN_xStreamBufferBytesAvailable( xReturn )
 #endif
 
-#ifndef traceQUEUE_PEEK_FROM_ISR
-    #define traceQUEUE_PEEK_FROM_ISR( pxQueue )
+#ifndef traceENTER_xStreamBufferSend
+    #define traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait )
 #endif
 
-#ifndef traceQUEUE_RECEIVE_FAILED
-    #define traceQUEUE_RECEIVE_FAILED( pxQueue )
+#ifndef traceRETURN_xStreamBufferSend
+    #define traceRETURN_xStreamBufferSend( xReturn )
 #endif
 
-#ifndef traceQUEUE_SEND_FROM_ISR
-    #define traceQUEUE_SEND_FROM_ISR( pxQueue )
+#ifndef traceENTER_xStreamBufferSendFromISR
+    #define traceENTER_xStreamBufferSendFromISR( xStreamBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceQUEUE_SEND_FROM_ISR_FAILED
-    #define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue )
+#ifndef traceRETURN_xStreamBufferSendFromISR
+    #define traceRETURN_xStreamBufferSendFromISR( xReturn )
 #endif
 
-#ifndef traceQUEUE_RECEIVE_FROM_ISR
-    #define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )
+#ifndef traceENTER_xStreamBufferReceive
+    #define traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait )
 #endif
 
-#ifndef traceQUEUE_RECEIVE_FROM_ISR_FAILED
-    #define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue )
+#ifndef traceRETURN_xStreamBufferReceive
+    #define traceRETURN_xStreamBufferReceive( xReceivedLength )
 #endif
 
-#ifndef traceQUEUE_PEEK_FROM_ISR_FAILED
-    #define traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue )
+#ifndef traceENTER_xStreamBufferNextMessageLengthBytes
+    #define traceENTER_xStreamBufferNextMessageLengthBytes( xStreamBuffer )
 #endif
 
-#ifndef traceQUEUE_DELETE
-    #define traceQUEUE_DELETE( pxQueue )
+#ifndef traceRETURN_xStreamBufferNextMessageLengthBytes
+    #define traceRETURN_xStreamBufferNextMessageLengthBytes( xReturn )
 #endif
 
-#ifndef traceTASK_CREATE
-    #define traceTASK_CREATE( pxNewTCB )
+#ifndef traceENTER_xStreamBufferReceiveFromISR
+    #define traceENTER_xStreamBufferReceiveFromISR( xStreamBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceTASK_CREATE_FAILED
-    #define traceTASK_CREATE_FAILED()
+#ifndef traceRETURN_xStreamBufferReceiveFromISR
+    #define traceRETURN_xStreamBufferReceiveFromISR( xReceivedLength )
 #endif
 
-#ifndef traceTASK_DELETE
-    #define traceTASK_DELETE( pxTaskToDelete )
+#ifndef traceENTER_xStreamBufferIsEmpty
+    #define traceENTER_xStreamBufferIsEmpty( xStreamBuffer )
 #endif
 
-#ifndef traceTASK_DELAY_UNTIL
-    #define traceTASK_DELAY_UNTIL( x )
+#ifndef traceRETURN_xStreamBufferIsEmpty
+    #define traceRETURN_xStreamBufferIsEmpty( xReturn )
 #endif
 
-#ifndef traceTASK_DELAY
-    #define traceTASK_DELAY()
+#ifndef traceENTER_xStreamBufferIsFull
+    #define traceENTER_xStreamBufferIsFull( xStreamBuffer )
 #endif
 
-#ifndef traceTASK_PRIORITY_SET
-    #define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
+#ifndef traceRETURN_xStreamBufferIsFull
+    #define traceRETURN_xStreamBufferIsFull( xReturn )
 #endif
 
-#ifndef traceTASK_SUSPEND
-    #define traceTASK_SUSPEND( pxTaskToSuspend )
+#ifndef traceENTER_xStreamBufferSendCompletedFromISR
+    #define traceENTER_xStreamBufferSendCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceTASK_RESUME
-    #define traceTASK_RESUME( pxTaskToResume )
+#ifndef traceRETURN_xStreamBufferSendCompletedFromISR
+    #define traceRETURN_xStreamBufferSendCompletedFromISR( xReturn )
 #endif
 
-#ifndef traceTASK_RESUME_FROM_ISR
-    #define traceTASK_RESUME_FROM_ISR( pxTaskToResume )
+#ifndef traceENTER_xStreamBufferReceiveCompletedFromISR
+    #define traceENTER_xStreamBufferReceiveCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceTASK_INCREMENT_TICK
-    #define traceTASK_INCREMENT_TICK( xTickCount )
+#ifndef traceRETURN_xStreamBufferReceiveCompletedFromISR
+    #define traceRETURN_xStreamBufferReceiveCompletedFromISR( xReturn )
 #endif
 
-#ifndef traceTIMER_CREATE
-    #define traceTIMER_CREATE( pxNewTimer )
+#ifndef traceENTER_xStreamBufferSendV
+    #define traceENTER_xStreamBufferSendV( xStreamBuffer, pxSegments, uxSegmentCount, xTicksToWait )
 #endif
 
-#ifndef traceTIMER_CREATE_FAILED
-    #define traceTIMER_CREATE_FAILED()
+#ifndef traceRETURN_xStreamBufferSendV
+    #define traceRETURN_xStreamBufferSendV( xReturn )
 #endif
 
-#ifndef traceTIMER_COMMAND_SEND
-    #define traceTIMER_COMMAND_SEND( xTimer, xMessageID, xMessageValueValue, xReturn )
+#ifndef traceENTER_xStreamBufferSendVFromISR
+    #define traceENTER_xStreamBufferSendVFromISR( xStreamBuffer, pxSegments, uxSegmentCount, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceTIMER_EXPIRED
-    #define traceTIMER_EXPIRED( pxTimer )
+#ifndef traceRETURN_xStreamBufferSendVFromISR
+    #define traceRETURN_xStreamBufferSendVFromISR( xReturn )
 #endif
 
-#ifndef traceTIMER_COMMAND_RECEIVED
-    #define traceTIMER_COMMAND_RECEIVED( pxTimer, xMessageID, xMessageValue )
+#ifndef traceENTER_xStreamBufferReceiveV
+    #define traceENTER_xStreamBufferReceiveV( xStreamBuffer, pxSegments, uxSegmentCount, xTicksToWait )
 #endif
 
-#ifndef traceMALLOC
-    #define traceMALLOC( pvAddress, uiSize )
+#ifndef traceRETURN_xStreamBufferReceiveV
+    #define traceRETURN_xStreamBufferReceiveV( xReturn )
 #endif
 
-#ifndef traceFREE
-    #define traceFREE( pvAddress, uiSize )
+#ifndef traceENTER_xStreamBufferReceiveVFromISR
+    #define traceENTER_xStreamBufferReceiveVFromISR( xStreamBuffer, pxSegments, uxSegmentCount, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceEVENT_GROUP_CREATE
-    #define traceEVENT_GROUP_CREATE( xEventGroup )
+#ifndef traceRETURN_xStreamBufferReceiveVFromISR
+    #define traceRETURN_xStreamBufferReceiveVFromISR( xReturn )
 #endif
 
-#ifndef traceEVENT_GROUP_CREATE_FAILED
-    #define traceEVENT_GROUP_CREATE_FAILED()
+#ifndef traceENTER_xStreamBufferReceiveBatch
+    #define traceENTER_xStreamBufferReceiveBatch( xStreamBuffer, pvRxData, xBufferLengthBytes, pxMessageOffsets, xMaxMessages, pxMessageCount, xTicksToWait )
 #endif
 
-#ifndef traceEVENT_GROUP_SYNC_BLOCK
-    #define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor )
+#ifndef traceRETURN_xStreamBufferReceiveBatch
+    #define traceRETURN_xStreamBufferReceiveBatch( xReturn )
 #endif
 
-#ifndef traceEVENT_GROUP_SYNC_END
-    #define traceEVENT_GROUP_SYNC_END( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTimeoutOccurred )    ( void ) ( xTimeoutOccurred )
+#ifndef traceENTER_xStreamBufferGetWriteRegion
+    #define traceENTER_xStreamBufferGetWriteRegion( xStreamBuffer, ppucRegion, xTicksToWait )
 #endif
 
-#ifndef traceEVENT_GROUP_WAIT_BITS_BLOCK
-    #define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )
+#ifndef traceRETURN_xStreamBufferGetWriteRegion
+    #define traceRETURN_xStreamBufferGetWriteRegion( xReturn )
 #endif
 
-#ifndef traceEVENT_GROUP_WAIT_BITS_END
-    #define traceEVENT_GROUP_WAIT_BITS_END( xEventGroup, uxBitsToWaitFor, xTimeoutOccurred )    ( void ) ( xTimeoutOccurred )
+#ifndef traceENTER_xStreamBufferCommitWrite
+    #define traceENTER_xStreamBufferCommitWrite( xStreamBuffer, xBytesWritten )
 #endif
 
-#ifndef traceEVENT_GROUP_CLEAR_BITS
-    #define traceEVENT_GROUP_CLEAR_BITS( xEventGroup, uxBitsToClear )
+#ifndef traceRETURN_xStreamBufferCommitWrite
+    #define traceRETURN_xStreamBufferCommitWrite( xReturn )
 #endif
 
-#ifndef traceEVENT_GROUP_CLEAR_BITS_FROM_ISR
-    #define traceEVENT_GROUP_CLEAR_BITS_FROM_ISR( xEventGroup, uxBitsToClear )
+#ifndef traceENTER_xStreamBufferCommitWriteFromISR
+    #define traceENTER_xStreamBufferCommitWriteFromISR( xStreamBuffer, xBytesWritten, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceEVENT_GROUP_SET_BITS
-    #define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )
+#ifndef traceRETURN_xStreamBufferCommitWriteFromISR
+    #define traceRETURN_xStreamBufferCommitWriteFromISR( xReturn )
 #endif
 
-#ifndef traceEVENT_GROUP_SET_BITS_FROM_ISR
-    #define traceEVENT_GROUP_SET_BITS_FROM_ISR( xEventGroup, uxBitsToSet )
+#ifndef traceENTER_xStreamBufferGetReadRegion
+    #define traceENTER_xStreamBufferGetReadRegion( xStreamBuffer, ppucRegion, xTicksToWait )
 #endif
 
-#ifndef traceEVENT_GROUP_DELETE
-    #define traceEVENT_GROUP_DELETE( xEventGroup )
+#ifndef traceRETURN_xStreamBufferGetReadRegion
+    #define traceRETURN_xStreamBufferGetReadRegion( xReturn )
 #endif
 
-#ifndef tracePEND_FUNC_CALL
-    #define tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, ret )
+#ifndef traceENTER_xStreamBufferConsume
+    #define traceENTER_xStreamBufferConsume( xStreamBuffer, xBytesRead )
 #endif
 
-#ifndef tracePEND_FUNC_CALL_FROM_ISR
-    #define tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, ret )
+#ifndef traceRETURN_xStreamBufferConsume
+    #define traceRETURN_xStreamBufferConsume( xReturn )
 #endif
 
-#ifndef traceQUEUE_REGISTRY_ADD
-    #define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )
+#ifndef traceENTER_xStreamBufferConsumeFromISR
+    #define traceENTER_xStreamBufferConsumeFromISR( xStreamBuffer, xBytesRead, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceTASK_NOTIFY_TAKE_BLOCK
-    #define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )
+#ifndef traceRETURN_xStreamBufferConsumeFromISR
+    #define traceRETURN_xStreamBufferConsumeFromISR( xReturn )
 #endif
 
-#ifndef traceTASK_NOTIFY_TAKE
-    #define traceTASK_NOTIFY_TAKE( uxIndexToWait )
+#ifndef traceENTER_xStreamBufferGenericCreateBroadcast
+    #define traceENTER_xStreamBufferGenericCreateBroadcast( xBufferSizeBytes, xTriggerLevelBytes, uxReaderCount, pxSendCompletedCallback, pxReceiveCompletedCallback )
 #endif
 
-#ifndef traceTASK_NOTIFY_WAIT_BLOCK
-    #define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )
+#ifndef traceRETURN_xStreamBufferGenericCreateBroadcast
+    #define traceRETURN_xStreamBufferGenericCreateBroadcast( xReturn )
 #endif
 
-#ifndef traceTASK_NOTIFY_WAIT
-    #define traceTASK_NOTIFY_WAIT( uxIndexToWait )
+#ifndef traceENTER_xStreamBufferReceiveBroadcast
+    #define traceENTER_xStreamBufferReceiveBroadcast( xStreamBuffer, uxReader, pvRxData, xBufferLengthBytes, xTicksToWait )
 #endif
 
-#ifndef traceTASK_NOTIFY
-    #define traceTASK_NOTIFY( uxIndexToNotify )
+#ifndef traceRETURN_xStreamBufferReceiveBroadcast
+    #define traceRETURN_xStreamBufferReceiveBroadcast( xReceivedLength )
 #endif
 
-#ifndef traceTASK_NOTIFY_FROM_ISR
-    #define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )
+#ifndef traceENTER_xStreamBufferReceiveBroadcastFromISR
+    #define traceENTER_xStreamBufferReceiveBroadcastFromISR( xStreamBuffer, uxReader, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceTASK_NOTIFY_GIVE_FROM_ISR
-    #define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify )
+#ifndef traceRETURN_xStreamBufferReceiveBroadcastFromISR
+    #define traceRETURN_xStreamBufferReceiveBroadcastFromISR( xReceivedLength )
 #endif
 
-#ifndef traceISR_EXIT_TO_SCHEDULER
-    #define traceISR_EXIT_TO_SCHEDULER()
+#ifndef traceENTER_xStreamBufferBroadcastBytesAvailable
+    #define traceENTER_xStreamBufferBroadcastBytesAvailable( xStreamBuffer, uxReader )
 #endif
 
-#ifndef traceISR_EXIT
-    #define traceISR_EXIT()
+#ifndef traceRETURN_xStreamBufferBroadcastBytesAvailable
+    #define traceRETURN_xStreamBufferBroadcastBytesAvailable( xReturn )
 #endif
 
-#ifndef traceISR_ENTER
-    #define traceISR_ENTER()
+#ifndef traceENTER_xStreamBufferGenericCreatePipeline
+    #define traceENTER_xStreamBufferGenericCreatePipeline( xBufferSizeBytes, xTriggerLevelBytes, uxStageCount, pxSendCompletedCallback, pxReceiveCompletedCallback )
 #endif
 
-#ifndef traceSTREAM_BUFFER_CREATE_FAILED
-    #define traceSTREAM_BUFFER_CREATE_FAILED( xStreamBufferType )
+#ifndef traceRETURN_xStreamBufferGenericCreatePipeline
+    #define traceRETURN_xStreamBufferGenericCreatePipeline( xReturn )
 #endif
 
-#ifndef traceSTREAM_BUFFER_CREATE_STATIC_FAILED
-    #define traceSTREAM_BUFFER_CREATE_STATIC_FAILED( xReturn, xStreamBufferType )
+#ifndef traceENTER_xStreamBufferGetStageRegion
+    #define traceENTER_xStreamBufferGetStageRegion( xStreamBuffer, uxStage, ppucRegion, xTicksToWait )
 #endif
 
-#ifndef traceSTREAM_BUFFER_CREATE
-    #define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xStreamBufferType )
+#ifndef traceRETURN_xStreamBufferGetStageRegion
+    #define traceRETURN_xStreamBufferGetStageRegion( xReturn )
 #endif
 
-#ifndef traceSTREAM_BUFFER_DELETE
-    #define traceSTREAM_BUFFER_DELETE( xStreamBuffer )
+#ifndef traceENTER_xStreamBufferCommitStage
+    #define traceENTER_xStreamBufferCommitStage( xStreamBuffer, uxStage, xBytesProcessed )
 #endif
 
-#ifndef traceSTREAM_BUFFER_RESET
-    #define traceSTREAM_BUFFER_RESET( xStreamBuffer )
+#ifndef traceRETURN_xStreamBufferCommitStage
+    #define traceRETURN_xStreamBufferCommitStage( xReturn )
 #endif
 
-#ifndef traceSTREAM_BUFFER_RESET_FROM_ISR
-    #define traceSTREAM_BUFFER_RESET_FROM_ISR( xStreamBuffer )
+#ifndef traceENTER_xStreamBufferCommitStageFromISR
+    #define traceENTER_xStreamBufferCommitStageFromISR( xStreamBuffer, uxStage, xBytesProcessed, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceBLOCKING_ON_STREAM_BUFFER_SEND
-    #define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )
+#ifndef traceRETURN_xStreamBufferCommitStageFromISR
+    #define traceRETURN_xStreamBufferCommitStageFromISR( xReturn )
 #endif
 
-#ifndef traceSTREAM_BUFFER_SEND
-    #define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )
+#ifndef traceENTER_xStreamBufferSetStageTriggerLevel
+    #define traceENTER_xStreamBufferSetStageTriggerLevel( xStreamBuffer, uxStage, xTriggerLevel )
 #endif
 
-#ifndef traceSTREAM_BUFFER_SEND_FAILED
-    #define traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer )
+#ifndef traceRETURN_xStreamBufferSetStageTriggerLevel
+    #define traceRETURN_xStreamBufferSetStageTriggerLevel( xReturn )
 #endif
 
-#ifndef traceSTREAM_BUFFER_SEND_FROM_ISR
-    #define traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesSent )
+#ifndef traceENTER_xStreamBufferSetMaxLatency
+    #define traceENTER_xStreamBufferSetMaxLatency( xStreamBuffer, xMaxLatencyTicks )
 #endif
 
-#ifndef traceBLOCKING_ON_STREAM_BUFFER_RECEIVE
-    #define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )
+#ifndef traceRETURN_xStreamBufferSetMaxLatency
+    #define traceRETURN_xStreamBufferSetMaxLatency( xReturn )
 #endif
 
-#ifndef traceSTREAM_BUFFER_RECEIVE
-    #define traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength )
+#ifndef traceENTER_uxStreamBufferGetStreamBufferNotificationIndex
+    #define traceENTER_uxStreamBufferGetStreamBufferNotificationIndex( xStreamBuffer )
 #endif
 
-#ifndef traceSTREAM_BUFFER_RECEIVE_FAILED
-    #define traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer )
+#ifndef traceRETURN_uxStreamBufferGetStreamBufferNotificationIndex
+    #define traceRETURN_uxStreamBufferGetStreamBufferNotificationIndex( uxNotificationIndex )
 #endif
 
-#ifndef traceSTREAM_BUFFER_RECEIVE_FROM_ISR
-    #define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
+#ifndef traceENTER_vStreamBufferSetStreamBufferNotificationIndex
+    #define traceENTER_vStreamBufferSetStreamBufferNotificationIndex( xStreamBuffer, uxNotificationIndex )
 #endif
 
-#ifndef traceENTER_xEventGroupCreateStatic
-    #define traceENTER_xEventGroupCreateStatic( pxEventGroupBuffer )
+#ifndef traceRETURN_vStreamBufferSetStreamBufferNotificationIndex
+    #define traceRETURN_vStreamBufferSetStreamBufferNotificationIndex()
 #endif
 
-#ifndef traceRETURN_xEventGroupCreateStatic
-    #define traceRETURN_xEventGroupCreateStatic( pxEventBits )
+#ifndef traceENTER_uxStreamBufferGetStreamBufferNumber
+    #define traceENTER_uxStreamBufferGetStreamBufferNumber( xStreamBuffer )
+#endif
+
+#ifndef traceRETURN_uxStreamBufferGetStreamBufferNumber
+    #define traceRETURN_uxStreamBufferGetStreamBufferNumber( uxStreamBufferNumber )
+#endif
+
+#ifndef traceENTER_vStreamBufferSetStreamBufferNumber
+    #define traceENTER_vStreamBufferSetStreamBufferNumber( xStreamBuffer, uxStreamBufferNumber )
+#endif
+
+#ifndef traceRETURN_vStreamBufferSetStreamBufferNumber
+    #define traceRETURN_vStreamBufferSetStreamBufferNumber()
+#endif
+
+#ifndef traceENTER_ucStreamBufferGetStreamBufferType
+    #define traceENTER_ucStreamBufferGetStreamBufferType( xStreamBuffer )
+#endif
+
+#ifndef traceRETURN_ucStreamBufferGetStreamBufferType
+    #define traceRETURN_ucStreamBufferGetStreamBufferType( ucStreamBufferType )
+#endif
+
+#ifndef traceENTER_vStreamBufferGetStatistics
+    #define traceENTER_vStreamBufferGetStatistics( xStreamBuffer, pxStatistics )
+#endif
+
+#ifndef traceRETURN_vStreamBufferGetStatistics
+    #define traceRETURN_vStreamBufferGetStatistics()
+#endif
+
+#ifndef traceENTER_vStreamBufferGetLatencyHistogram
+    #define traceENTER_vStreamBufferGetLatencyHistogram( xStreamBuffer, pxHistogram )
+#endif
+
+#ifndef traceRETURN_vStreamBufferGetLatencyHistogram
+    #define traceRETURN_vStreamBufferGetLatencyHistogram()
+#endif
+
+#ifndef traceENTER_vListInitialise
+    #define traceENTER_vListInitialise( pxList )
+#endif
+
+#ifndef traceRETURN_vListInitialise
+    #define traceRETURN_vListInitialise()
+#endif
+
+#ifndef traceENTER_vListInitialiseSkipList
+    #define traceENTER_vListInitialiseSkipList( pxList )
+#endif
+
+#ifndef traceRETURN_vListInitialiseSkipList
+    #define traceRETURN_vListInitialiseSkipList()
+#endif
+
+#ifndef traceENTER_vListInitialiseItem
+    #define traceENTER_vListInitialiseItem( pxItem )
 #endif
 
-#ifndef traceENTER_xEventGroupCreate
-    #define traceENTER_xEventGroupCreate()
+#ifndef traceRETURN_vListInitialiseItem
+    #define traceRETURN_vListInitialiseItem()
 #endif
 
-#ifndef traceRETURN_xEventGroupCreate
-    #define traceRETURN_xEventGroupCreate( pxEventBits )
+#ifndef traceENTER_vListInsertEnd
+    #define traceENTER_vListInsertEnd( pxList, pxNewListItem )
 #endif
 
-#ifndef traceENTER_xEventGroupSync
-    #define traceENTER_xEventGroupSync( xEventGroup, uxBitsToSet, uxBitsToWaitFor, xTicksToWait )
+#ifndef traceRETURN_vListInsertEnd
+    #define traceRETURN_vListInsertEnd()
 #endif
 
-#ifndef traceRETURN_xEventGroupSync
-    #define traceRETURN_xEventGroupSync( uxReturn )
+#ifndef traceENTER_vListInsert
+    #define traceENTER_vListInsert( pxList, pxNewListItem )
 #endif
 
-#ifndef traceENTER_xEventGroupWaitBits
-    #define traceENTER_xEventGroupWaitBits( xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait )
+#ifndef traceRETURN_vListInsert
+    #define traceRETURN_vListInsert()
 #endif
 
-#ifndef traceRETURN_xEventGroupWaitBits
-    #define traceRETURN_xEventGroupWaitBits( uxReturn )
+#ifndef traceENTER_vListMerge
+    #define traceENTER_vListMerge( pxList, pxSortedList )
 #endif
 
-#ifndef traceENTER_xEventGroupClearBits
-    #define traceENTER_xEventGroupClearBits( xEventGroup, uxBitsToClear )
+#ifndef traceRETURN_vListMerge
+    #define traceRETURN_vListMerge()
 #endif
 
-#ifndef traceRETURN_xEventGroupClearBits
-    #define traceRETURN_xEventGroupClearBits( uxReturn )
+#ifndef traceENTER_uxListRemove
+    #define traceENTER_uxListRemove( pxItemToRemove )
 #endif
 
-#ifndef traceENTER_xEventGroupClearBitsFromISR
-    #define traceENTER_xEventGroupClearBitsFromISR( xEventGroup, uxBitsToClear )
+#ifndef traceRETURN_uxListRemove
+    #define traceRETURN_uxListRemove( uxNumberOfItems )
 #endif
 
-#ifndef traceRETURN_xEventGroupClearBitsFromISR
-    #define traceRETURN_xEventGroupClearBitsFromISR( xReturn )
+#ifndef traceENTER_xListCheckLinks
+    #define traceENTER_xListCheckLinks( pxList )
 #endif
 
-#ifndef traceENTER_xEventGroupGetBitsFromISR
-    #define traceENTER_xEventGroupGetBitsFromISR( xEventGroup )
+#ifndef traceRETURN_xListCheckLinks
+    #define traceRETURN_xListCheckLinks( xReturn )
 #endif
 
-#ifndef traceRETURN_xEventGroupGetBitsFromISR
-    #define traceRETURN_xEventGroupGetBitsFromISR( uxReturn )
+#ifndef traceENTER_xCoRoutineCreate
+    #define traceENTER_xCoRoutineCreate( pxCoRoutineCode, uxPriority, uxIndex )
 #endif
 
-#ifndef traceENTER_xEventGroupSetBits
-    #define traceENTER_xEventGroupSetBits( xEventGroup, uxBitsToSet )
+#ifndef traceRETURN_xCoRoutineCreate
+    #define traceRETURN_xCoRoutineCreate( xReturn )
 #endif
 
-#ifndef traceRETURN_xEventGroupSetBits
-    #define traceRETURN_xEventGroupSetBits( uxEventBits )
+#ifndef traceENTER_vCoRoutineAddToDelayedList
+    #define traceENTER_vCoRoutineAddToDelayedList( xTicksToDelay, pxEventList )
 #endif
 
-#ifndef traceENTER_vEventGroupDelete
-    #define traceENTER_vEventGroupDelete( xEventGroup )
+#ifndef traceRETURN_vCoRoutineAddToDelayedList
+    #define traceRETURN_vCoRoutineAddToDelayedList()
 #endif
 
-#ifndef traceRETURN_vEventGroupDelete
-    #define traceRETURN_vEventGroupDelete()
+#ifndef traceENTER_vCoRoutineSchedule
+    #define traceENTER_vCoRoutineSchedule()
 #endif
 
-#ifndef traceENTER_xEventGroupGetStaticBuffer
-    #define traceENTER_xEventGroupGetStaticBuffer( xEventGroup, ppxEventGroupBuffer )
+#ifndef traceRETURN_vCoRoutineSchedule
+    #define traceRETURN_vCoRoutineSchedule()
 #endif
 
-#ifndef traceRETURN_xEventGroupGetStaticBuffer
-    #define traceRETURN_xEventGroupGetStaticBuffer( xReturn )
+#ifndef traceENTER_xCoRoutineRemoveFromEventList
+    #define traceENTER_xCoRoutineRemoveFromEventList( pxEventList )
 #endif
 
-#ifndef traceENTER_vEventGroupSetBitsCallback
-    #define traceENTER_vEventGroupSetBitsCallback( pvEventGroup, ulBitsToSet )
+#ifndef traceRETURN_xCoRoutineRemoveFromEventList
+    #define traceRETURN_xCoRoutineRemoveFromEventList( xReturn )
 #endif
 
-#ifndef traceRETURN_vEventGroupSetBitsCallback
-    #define traceRETURN_vEventGroupSetBitsCallback()
+#ifndef traceENTER_xCoRoutineCreateOnCore
+    #define traceENTER_xCoRoutineCreateOnCore( pxCoRoutineCode, uxPriority, uxIndex, xCoreID )
 #endif
 
-#ifndef traceENTER_vEventGroupClearBitsCallback
-    #define traceENTER_vEventGroupClearBitsCallback( pvEventGroup, ulBitsToClear )
+#ifndef traceRETURN_xCoRoutineCreateOnCore
+    #define traceRETURN_xCoRoutineCreateOnCore( xReturn )
 #endif
 
-#ifndef traceRETURN_vEventGroupClearBitsCallback
-    #define traceRETURN_vEventGroupClearBitsCallback()
+#ifndef traceENTER_vTelemetryBegin
+    #define traceENTER_vTelemetryBegin( pxTelemetry, pucBuffer, xBufferLength )
 #endif
 
-#ifndef traceENTER_xEventGroupSetBitsFromISR
-    #define traceENTER_xEventGroupSetBitsFromISR( xEventGroup, uxBitsToSet, pxHigherPriorityTaskWoken )
+#ifndef traceRETURN_vTelemetryBegin
+    #define traceRETURN_vTelemetryBegin()
 #endif
 
-#ifndef traceRETURN_xEventGroupSetBitsFromISR
-    #define traceRETURN_xEventGroupSetBitsFromISR( xReturn )
+#ifndef traceENTER_xTelemetryAddTask
+    #define traceENTER_xTelemetryAddTask( pxTelemetry, pxTaskStatus )
 #endif
 
-#ifndef traceENTER_uxEventGroupGetNumber
-    #define traceENTER_uxEventGroupGetNumber( xEventGroup )
+#ifndef traceRETURN_xTelemetryAddTask
+    #define traceRETURN_xTelemetryAddTask( xReturn )
 #endif
 
-#ifndef traceRETURN_uxEventGroupGetNumber
-    #define traceRETURN_uxEventGroupGetNumber( xReturn )
+#ifndef traceENTER_uxTelemetryAddSystemState
+    #define traceENTER_uxTelemetryAddSystemState( pxTelemetry, pxTaskStatusArray, uxArraySize )
 #endif
 
-#ifndef traceENTER_vEventGroupSetNumber
-    #define traceENTER_vEventGroupSetNumber( xEventGroup, uxEventGroupNumber )
+#ifndef traceRETURN_uxTelemetryAddSystemState
+    #define traceRETURN_uxTelemetryAddSystemState( uxTasksAdded )
 #endif
 
-#ifndef traceRETURN_vEventGroupSetNumber
-    #define traceRETURN_vEventGroupSetNumber()
+#ifndef traceENTER_xTelemetryAddHeapStats
+    #define traceENTER_xTelemetryAddHeapStats( pxTelemetry, pxHeapStats )
 #endif
 
-#ifndef traceENTER_xQueueGenericReset
-    #define traceENTER_xQueueGenericReset( xQueue, xNewQueue )
+#ifndef traceRETURN_xTelemetryAddHeapStats
+    #define traceRETURN_xTelemetryAddHeapStats( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueGenericReset
-    #define traceRETURN_xQueueGenericReset( xReturn )
+#ifndef traceENTER_xTelemetryAddQueue
+    #define traceENTER_xTelemetryAddQueue( pxTelemetry, xQueue )
 #endif
 
-#ifndef traceENTER_xQueueGenericCreateStatic
-    #define traceENTER_xQueueGenericCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxStaticQueue, ucQueueType )
+#ifndef traceRETURN_xTelemetryAddQueue
+    #define traceRETURN_xTelemetryAddQueue( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueGenericCreateStatic
-    #define traceRETURN_xQueueGenericCreateStatic( pxNewQueue )
+#ifndef traceENTER_xTelemetryAddStreamBuffer
+    #define traceENTER_xTelemetryAddStreamBuffer( pxTelemetry, xStreamBuffer )
 #endif
 
-#ifndef traceENTER_xQueueGenericGetStaticBuffers
-    #define traceENTER_xQueueGenericGetStaticBuffers( xQueue, ppucQueueStorage, ppxStaticQueue )
+#ifndef traceRETURN_xTelemetryAddStreamBuffer
+    #define traceRETURN_xTelemetryAddStreamBuffer( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueGenericGetStaticBuffers
-    #define traceRETURN_xQueueGenericGetStaticBuffers( xReturn )
+#ifndef traceENTER_xTelemetryEnd
+    #define traceENTER_xTelemetryEnd( pxTelemetry )
 #endif
 
-#ifndef traceENTER_xQueueGenericCreate
-    #define traceENTER_xQueueGenericCreate( uxQueueLength, uxItemSize, ucQueueType )
+#ifndef traceRETURN_xTelemetryEnd
+    #define traceRETURN_xTelemetryEnd( xBytesWritten )
 #endif
 
-#ifndef traceRETURN_xQueueGenericCreate
-    #define traceRETURN_xQueueGenericCreate( pxNewQueue )
+#ifndef traceENTER_xPoolCreate
+    #define traceENTER_xPoolCreate( xItemSize, uxItemCount )
 #endif
 
-#ifndef traceENTER_xQueueCreateMutex
-    #define traceENTER_xQueueCreateMutex( ucQueueType )
+#ifndef traceRETURN_xPoolCreate
+    #define traceRETURN_xPoolCreate( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueCreateMutex
-    #define traceRETURN_xQueueCreateMutex( xNewQueue )
+#ifndef traceENTER_xPoolCreateStatic
+    #define traceENTER_xPoolCreateStatic( xItemSize, uxItemCount, pucPoolStorageBuffer, pxStaticPool )
 #endif
 
-#ifndef traceENTER_xQueueCreateMutexStatic
-    #define traceENTER_xQueueCreateMutexStatic( ucQueueType, pxStaticQueue )
+#ifndef traceRETURN_xPoolCreateStatic
+    #define traceRETURN_xPoolCreateStatic( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueCreateMutexStatic
-    #define traceRETURN_xQueueCreateMutexStatic( xNewQueue )
+#ifndef traceENTER_pvPoolAllocate
+    #define traceENTER_pvPoolAllocate( xPool )
 #endif
 
-#ifndef traceENTER_xQueueGetMutexHolder
-    #define traceENTER_xQueueGetMutexHolder( xSemaphore )
+#ifndef traceRETURN_pvPoolAllocate
+    #define traceRETURN_pvPoolAllocate( pvReturn )
 #endif
 
-#ifndef traceRETURN_xQueueGetMutexHolder
-    #define traceRETURN_xQueueGetMutexHolder( pxReturn )
+#ifndef traceENTER_pvPoolAllocateFromISR
+    #define traceENTER_pvPoolAllocateFromISR( xPool )
 #endif
 
-#ifndef traceENTER_xQueueGetMutexHolderFromISR
-    #define traceENTER_xQueueGetMutexHolderFromISR( xSemaphore )
+#ifndef traceRETURN_pvPoolAllocateFromISR
+    #define traceRETURN_pvPoolAllocateFromISR( pvReturn )
 #endif
 
-#ifndef traceRETURN_xQueueGetMutexHolderFromISR
-    #define traceRETURN_xQueueGetMutexHolderFromISR( pxReturn )
+#ifndef traceENTER_vPoolFree
+    #define traceENTER_vPoolFree( xPool, pvItem )
 #endif
 
-#ifndef traceENTER_xQueueGiveMutexRecursive
-    #define traceENTER_xQueueGiveMutexRecursive( xMutex )
+#ifndef traceRETURN_vPoolFree
+    #define traceRETURN_vPoolFree()
 #endif
 
-#ifndef traceRETURN_xQueueGiveMutexRecursive
-    #define traceRETURN_xQueueGiveMutexRecursive( xReturn )
+#ifndef traceENTER_vPoolFreeFromISR
+    #define traceENTER_vPoolFreeFromISR( xPool, pvItem )
 #endif
 
-#ifndef traceENTER_xQueueTakeMutexRecursive
-    #define traceENTER_xQueueTakeMutexRecursive( xMutex, xTicksToWait )
+#ifndef traceRETURN_vPoolFreeFromISR
+    #define traceRETURN_vPoolFreeFromISR()
 #endif
 
-#ifndef traceRETURN_xQueueTakeMutexRecursive
-    #define traceRETURN_xQueueTakeMutexRecursive( xReturn )
+#ifndef traceENTER_xPoolIsItemFromPool
+    #define traceENTER_xPoolIsItemFromPool( xPool, pvItem )
 #endif
 
-#ifndef traceENTER_xQueueCreateCountingSemaphoreStatic
-    #define traceENTER_xQueueCreateCountingSemaphoreStatic( uxMaxCount, uxInitialCount, pxStaticQueue )
+#ifndef traceRETURN_xPoolIsItemFromPool
+    #define traceRETURN_xPoolIsItemFromPool( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueCreateCountingSemaphoreStatic
-    #define traceRETURN_xQueueCreateCountingSemaphoreStatic( xHandle )
+#ifndef traceENTER_uxPoolGetFreeItemCount
+    #define traceENTER_uxPoolGetFreeItemCount( xPool )
 #endif
 
-#ifndef traceENTER_xQueueCreateCountingSemaphore
-    #define traceENTER_xQueueCreateCountingSemaphore( uxMaxCount, uxInitialCount )
+#ifndef traceRETURN_uxPoolGetFreeItemCount
+    #define traceRETURN_uxPoolGetFreeItemCount( uxReturn )
 #endif
 
-#ifndef traceRETURN_xQueueCreateCountingSemaphore
-    #define traceRETURN_xQueueCreateCountingSemaphore( xHandle )
+#ifndef traceENTER_vPoolDelete
+    #define traceENTER_vPoolDelete( xPool )
 #endif
 
-#ifndef traceENTER_xQueueGenericSend
-    #define traceENTER_xQueueGenericSend( xQueue, pvItemToQueue, xTicksToWait, xCopyPosition )
+#ifndef traceRETURN_vPoolDelete
+    #define traceRETURN_vPoolDelete()
 #endif
 
-#ifndef traceRETURN_xQueueGenericSend
-    #define traceRETURN_xQueueGenericSend( xReturn )
+#ifndef traceENTER_xPortISRHeapAddPool
+    #define traceENTER_xPortISRHeapAddPool( xPool )
 #endif
 
-#ifndef traceENTER_xQueueGenericSendFromISR
-    #define traceENTER_xQueueGenericSendFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken, xCopyPosition )
+#ifndef traceRETURN_xPortISRHeapAddPool
+    #define traceRETURN_xPortISRHeapAddPool( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueGenericSendFromISR
-    #define traceRETURN_xQueueGenericSendFromISR( xReturn )
+#ifndef traceENTER_pvPortMallocFromISR
+    #define traceENTER_pvPortMallocFromISR( xWantedSize )
 #endif
 
-#ifndef traceENTER_xQueueGiveFromISR
-    #define traceENTER_xQueueGiveFromISR( xQueue, pxHigherPriorityTaskWoken )
+#ifndef traceRETURN_pvPortMallocFromISR
+    #define traceRETURN_pvPortMallocFromISR( pvReturn )
 #endif
 
-#ifndef traceRETURN_xQueueGiveFromISR
-    #define traceRETURN_xQueueGiveFromISR( xReturn )
+#ifndef traceENTER_vPortFreeFromISR
+    #define traceENTER_vPortFreeFromISR( pv )
 #endif
 
-#ifndef traceENTER_xQueueReceive
-    #define traceENTER_xQueueReceive( xQueue, pvBuffer, xTicksToWait )
+#ifndef traceRETURN_vPortFreeFromISR
+    #define traceRETURN_vPortFreeFromISR()
 #endif
 
-#ifndef traceRETURN_xQueueReceive
-    #define traceRETURN_xQueueReceive( xReturn )
+#ifndef traceENTER_vLightMutexInit
+    #define traceENTER_vLightMutexInit( pxMutex )
 #endif
 
-#ifndef traceENTER_xQueueSemaphoreTake
-    #define traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait )
+#ifndef traceRETURN_vLightMutexInit
+    #define traceRETURN_vLightMutexInit()
 #endif
 
-#ifndef traceRETURN_xQueueSemaphoreTake
-    #define traceRETURN_xQueueSemaphoreTake( xReturn )
+#ifndef traceENTER_xLightMutexTake
+    #define traceENTER_xLightMutexTake( pxMutex, xTicksToWait )
 #endif
 
-#ifndef traceENTER_xQueuePeek
-    #define traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait )
+#ifndef traceRETURN_xLightMutexTake
+    #define traceRETURN_xLightMutexTake( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueuePeek
-    #define traceRETURN_xQueuePeek( xReturn )
+#ifndef traceENTER_xLightMutexGive
+    #define traceENTER_xLightMutexGive( pxMutex )
 #endif
 
-#ifndef traceENTER_xQueueReceiveFromISR
-    #define traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken )
+#ifndef traceRETURN_xLightMutexGive
+    #define traceRETURN_xLightMutexGive( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueReceiveFromISR
-    #define traceRETURN_xQueueReceiveFromISR( xReturn )
+#ifndef traceENTER_xLightMutexTakeRecursive
+    #define traceENTER_xLightMutexTakeRecursive( pxMutex, xTicksToWait )
 #endif
 
-#ifndef traceENTER_xQueuePeekFromISR
-    #define traceENTER_xQueuePeekFromISR( xQueue, pvBuffer )
+#ifndef traceRETURN_xLightMutexTakeRecursive
+    #define traceRETURN_xLightMutexTakeRecursive( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueuePeekFromISR
-    #define traceRETURN_xQueuePeekFromISR( xReturn )
+#ifndef traceENTER_xLightMutexGiveRecursive
+    #define traceENTER_xLightMutexGiveRecursive( pxMutex )
 #endif
 
-#ifndef traceENTER_uxQueueMessagesWaiting
-    #define traceENTER_uxQueueMessagesWaiting( xQueue )
+#ifndef traceRETURN_xLightMutexGiveRecursive
+    #define traceRETURN_xLightMutexGiveRecursive( xReturn )
 #endif
 
-#ifndef traceRETURN_uxQueueMessagesWaiting
-    #define traceRETURN_uxQueueMessagesWaiting( uxReturn )
+#ifndef traceENTER_xLightMutexGetHolder
+    #define traceENTER_xLightMutexGetHolder( pxMutex )
 #endif
 
-#ifndef traceENTER_uxQueueSpacesAvailable
-    #define traceENTER_uxQueueSpacesAvailable( xQueue )
+#ifndef traceRETURN_xLightMutexGetHolder
+    #define traceRETURN_xLightMutexGetHolder( xReturn )
 #endif
 
-#ifndef traceRETURN_uxQueueSpacesAvailable
-    #define traceRETURN_uxQueueSpacesAvailable( uxReturn )
+#ifndef traceBLOCKING_ON_LIGHT_MUTEX_TAKE
+    #define traceBLOCKING_ON_LIGHT_MUTEX_TAKE( pxMutex )
 #endif
 
-#ifndef traceENTER_uxQueueMessagesWaitingFromISR
-    #define traceENTER_uxQueueMessagesWaitingFromISR( xQueue )
+#ifndef traceLIGHT_MUTEX_TAKE_RECURSIVE_FAILED
+    #define traceLIGHT_MUTEX_TAKE_RECURSIVE_FAILED( pxMutex )
 #endif
 
-#ifndef traceRETURN_uxQueueMessagesWaitingFromISR
-    #define traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn )
+#ifndef traceENTER_vRWLockInit
+    #define traceENTER_vRWLockInit( pxLock )
 #endif
 
-#ifndef traceENTER_vQueueDelete
-    #define traceENTER_vQueueDelete( xQueue )
+#ifndef traceRETURN_vRWLockInit
+    #define traceRETURN_vRWLockInit()
 #endif
 
-#ifndef traceRETURN_vQueueDelete
-    #define traceRETURN_vQueueDelete()
+#ifndef traceENTER_xRWLockReadTake
+    #define traceENTER_xRWLockReadTake( pxLock, xTicksToWait )
 #endif
 
-#ifndef traceENTER_uxQueueGetQueueNumber
-    #define traceENTER_uxQueueGetQueueNumber( xQueue )
+#ifndef traceRETURN_xRWLockReadTake
+    #define traceRETURN_xRWLockReadTake( xReturn )
 #endif
 
-#ifndef traceRETURN_uxQueueGetQueueNumber
-    #define traceRETURN_uxQueueGetQueueNumber( uxQueueNumber )
+#ifndef traceENTER_xRWLockReadGive
+    #define traceENTER_xRWLockReadGive( pxLock )
 #endif
 
-#ifndef traceENTER_vQueueSetQueueNumber
-    #define traceENTER_vQueueSetQueueNumber( xQueue, uxQueueNumber )
+#ifndef traceRETURN_xRWLockReadGive
+    #define traceRETURN_xRWLockReadGive( xReturn )
 #endif
 
-#ifndef traceRETURN_vQueueSetQueueNumber
-    #define traceRETURN_vQueueSetQueueNumber()
+#ifndef traceENTER_xRWLockWriteTake
+    #define traceENTER_xRWLockWriteTake( pxLock, xTicksToWait )
 #endif
 
-#ifndef traceENTER_ucQueueGetQueueType
-    #define traceENTER_ucQueueGetQueueType( xQueue )
+#ifndef traceRETURN_xRWLockWriteTake
+    #define traceRETURN_xRWLockWriteTake( xReturn )
 #endif
 
-#ifndef traceRETURN_ucQueueGetQueueType
-    #define traceRETURN_ucQueueGetQueueType( ucQueueType )
+#ifndef traceENTER_xRWLockWriteGive
+    #define traceENTER_xRWLockWriteGive( pxLock )
 #endif
 
-#ifndef traceENTER_uxQueueGetQueueItemSize
-    #define traceENTER_uxQueueGetQueueItemSize( xQueue )
+#ifndef traceRETURN_xRWLockWriteGive
+    #define traceRETURN_xRWLockWriteGive( xReturn )
 #endif
 
-#ifndef traceRETURN_uxQueueGetQueueItemSize
-    #define traceRETURN_uxQueueGetQueueItemSize( uxItemSize )
+#ifndef traceBLOCKING_ON_RW_LOCK_TAKE
+    #define traceBLOCKING_ON_RW_LOCK_TAKE( pxLock, xForWriting )
 #endif
 
-#ifndef traceENTER_uxQueueGetQueueLength
-    #define traceENTER_uxQueueGetQueueLength( xQueue )
+#ifndef traceENTER_vBarrierInit
+    #define traceENTER_vBarrierInit( pxBarrier, uxParticipants )
 #endif
 
-#ifndef traceRETURN_uxQueueGetQueueLength
-    #define traceRETURN_uxQueueGetQueueLength( uxLength )
+#ifndef traceRETURN_vBarrierInit
+    #define traceRETURN_vBarrierInit()
 #endif
 
-#ifndef traceENTER_xQueueIsQueueEmptyFromISR
-    #define traceENTER_xQueueIsQueueEmptyFromISR( xQueue )
+#ifndef traceENTER_xBarrierWait
+    #define traceENTER_xBarrierWait( pxBarrier, xTicksToWait )
 #endif
 
-#ifndef traceRETURN_xQueueIsQueueEmptyFromISR
-    #define traceRETURN_xQueueIsQueueEmptyFromISR( xReturn )
+#ifndef traceRETURN_xBarrierWait
+    #define traceRETURN_xBarrierWait( xReturn )
 #endif
 
-#ifndef traceENTER_xQueueIsQueueFullFromISR
-    #define traceENTER_xQueueIsQueueFullFromISR( xQueue )
+#ifndef traceENTER_uxBarrierGetPhase
+    #define traceENTER_uxBarrierGetPhase( pxBarrier )
 #endif
 
-#ifndef traceRETURN_xQueueIsQueueFullFromISR
-    #define traceRETURN_xQueueIsQueueFullFromISR( xReturn )
+#ifndef traceRETURN_uxBarrierGetPhase
+    #define traceRETURN_uxBarrierGetPhase( uxReturn )
 #endif
 
-#ifndef traceENTER_xQueueCRSend
-    #define traceENTER_xQueueCRSend( xQueue, pvItemToQueue, xTicksToWait )
+#ifndef traceBLOCKING_ON_BARRIER
+    #define traceBLOCKING_ON_BARRIER( pxBarrier )
 #endif
 
-#ifndef traceRETURN_xQueueCRSend
-    #define traceRETURN_xQueueCRSend( xReturn )
+#ifndef traceBARRIER_RELEASE
+    #define traceBARRIER_RELEASE( pxBarrier )
 #endif
 
-#ifndef traceENTER_xQueueCRReceive
-    #define traceENTER_xQueueCRReceive( xQueue, pvBuffer, xTicksToWait )
+#ifndef traceENTER_vCondInit
+    #define traceENTER_vCondInit( pxCond )
 #endif
 
-#ifndef traceRETURN_xQueueCRReceive
-    #define traceRETURN_xQueueCRReceive( xReturn )
+#ifndef traceRETURN_vCondInit
+    #define traceRETURN_vCondInit()
 #endif
 
-#ifndef traceENTER_xQueueCRSendFromISR
-    #define traceENTER_xQueueCRSendFromISR( xQueue, pvItemToQueue, xCoRoutinePreviouslyWoken )
+#ifndef traceENTER_xCondWait
+    #define traceENTER_xCondWait( pxCond, xMutex, xTicksToWait )
 #endif
 
-#ifndef traceRETURN_xQueueCRSendFromISR
-    #define traceRETURN_xQueueCRSendFromISR( xCoRoutinePreviouslyWoken )
+#ifndef traceRETURN_xCondWait
+    #define traceRETURN_xCondWait( xReturn )
 #endif
 
-#ifndef traceENTER_xQueueCRReceiveFromISR
-    #define traceENTER_xQueueCRReceiveFromISR( xQueue, pvBuffer, pxCoRoutineWoken )
+#ifndef traceENTER_vCondSignal
+    #define traceENTER_vCondSignal( pxCond )
 #endif
 
-#ifndef traceRETURN_xQueueCRReceiveFromISR
-    #define traceRETURN_xQueueCRReceiveFromISR( xReturn )
+#ifndef traceRETURN_vCondSignal
+    #define traceRETURN_vCondSignal()
 #endif
 
-#ifndef traceENTER_vQueueAddToRegistry
-    #define traceENTER_vQueueAddToRegistry( xQueue, pcQueueName )
+#ifndef traceENTER_vCondBroadcast
+    #define traceENTER_vCondBroadcast( pxCond )
 #endif
 
-#ifndef traceRETURN_vQueueAddToRegistry
-    #define traceRETURN_vQueueAddToRegistry()
+#ifndef traceRETURN_vCondBroadcast
+    #define traceRETURN_vCondBroadcast()
 #endif
 
-#ifndef traceENTER_pcQueueGetName
-    #define traceENTER_pcQueueGetName( xQueue )
+#ifndef traceENTER_vQueueMoveWaitingTasksToMutex
+    #define traceENTER_vQueueMoveWaitingTasksToMutex( xMutex, pxEventList )
 #endif
 
-#ifndef traceRETURN_pcQueueGetName
-    #define traceRETURN_pcQueueGetName( pcReturn )
+#ifndef traceRETURN_vQueueMoveWaitingTasksToMutex
+    #define traceRETURN_vQueueMoveWaitingTasksToMutex()
 #endif
 
-#ifndef traceENTER_vQueueUnregisterQueue
-    #define traceENTER_vQueueUnregisterQueue( xQueue )
+#ifndef traceBLOCKING_ON_COND
+    #define traceBLOCKING_ON_COND( pxCond )
 #endif
 
-#ifndef traceRETURN_vQueueUnregisterQueue
-    #define traceRETURN_vQueueUnregisterQueue()
+#ifndef traceCOND_SIGNAL
+    #define traceCOND_SIGNAL( pxCond )
 #endif
 
-#ifndef traceENTER_vQueueWaitForMessageRestricted
-    #define traceENTER_vQueueWaitForMessageRestricted( xQueue, xTicksToWait, xWaitIndefinitely )
+#ifndef traceCOND_BROADCAST
+    #define traceCOND_BROADCAST( pxCond )
 #endif
 
-#ifndef traceRETURN_vQueueWaitForMessageRestricted
-    #define traceRETURN_vQueueWaitForMessageRestricted()
+#ifndef traceENTER_xEventHandlerInit
+    #define traceENTER_xEventHandlerInit( pxHandler, pxFunction, pvParameter, uxPriority )
 #endif
 
-#ifndef traceENTER_xQueueCreateSet
-    #define traceENTER_xQueueCreateSet( uxEventQueueLength )
+#ifndef traceRETURN_xEventHandlerInit
+    #define traceRETURN_xEventHandlerInit( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueCreateSet
-    #define traceRETURN_xQueueCreateSet( pxQueue )
+#ifndef traceENTER_xEventHandlerPost
+    #define traceENTER_xEventHandlerPost( pxHandler )
 #endif
 
-#ifndef traceENTER_xQueueAddToSet
-    #define traceENTER_xQueueAddToSet( xQueueOrSemaphore, xQueueSet )
+#ifndef traceRETURN_xEventHandlerPost
+    #define traceRETURN_xEventHandlerPost( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueAddToSet
-    #define traceRETURN_xQueueAddToSet( xReturn )
+#ifndef traceENTER_xEventHandlerPostFromISR
+    #define traceENTER_xEventHandlerPostFromISR( pxHandler, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceENTER_xQueueRemoveFromSet
-    #define traceENTER_xQueueRemoveFromSet( xQueueOrSemaphore, xQueueSet )
+#ifndef traceRETURN_xEventHandlerPostFromISR
+    #define traceRETURN_xEventHandlerPostFromISR( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueRemoveFromSet
-    #define traceRETURN_xQueueRemoveFromSet( xReturn )
+#ifndef traceENTER_xEventHandlerPostDelayed
+    #define traceENTER_xEventHandlerPostDelayed( pxHandler, xTicksToDelay )
 #endif
 
-#ifndef traceENTER_xQueueSelectFromSet
-    #define traceENTER_xQueueSelectFromSet( xQueueSet, xTicksToWait )
+#ifndef traceRETURN_xEventHandlerPostDelayed
+    #define traceRETURN_xEventHandlerPostDelayed( xReturn )
 #endif
 
-#ifndef traceRETURN_xQueueSelectFromSet
-    #define traceRETURN_xQueueSelectFromSet( xReturn )
+#ifndef traceEVENT_HANDLER_RUN
+    #define traceEVENT_HANDLER_RUN( pxHandler )
 #endif
 
-#ifndef traceENTER_xQueueSelectFromSetFromISR
-    #define traceENTER_xQueueSelectFromSetFromISR( xQueueSet )
+#ifndef traceENTER_xSoftIRQRegister
+    #define traceENTER_xSoftIRQRegister( uxSoftIRQ, pxFunction, pvParameter )
 #endif
 
-#ifndef traceRETURN_xQueueSelectFromSetFromISR
-    #define traceRETURN_xQueueSelectFromSetFromISR( xReturn )
+#ifndef traceRETURN_xSoftIRQRegister
+    #define traceRETURN_xSoftIRQRegister( xReturn )
 #endif
 
-#ifndef traceENTER_xTimerCreateTimerTask
-    #define traceENTER_xTimerCreateTimerTask()
+#ifndef traceENTER_vSoftIRQRaise
+    #define traceENTER_vSoftIRQRaise( uxSoftIRQ )
 #endif
 
-#ifndef traceRETURN_xTimerCreateTimerTask
-    #define traceRETURN_xTimerCreateTimerTask( xReturn )
+#ifndef traceRETURN_vSoftIRQRaise
+    #define traceRETURN_vSoftIRQRaise()
 #endif
 
-#ifndef traceENTER_xTimerCreate
-    #define traceENTER_xTimerCreate( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction )
+#ifndef traceENTER_vSoftIRQRaiseFromISR
+    #define traceENTER_vSoftIRQRaiseFromISR( uxSoftIRQ, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceRETURN_xTimerCreate
-    #define traceRETURN_xTimerCreate( pxNewTimer )
+#ifndef traceRETURN_vSoftIRQRaiseFromISR
+    #define traceRETURN_vSoftIRQRaiseFromISR()
 #endif
 
-#ifndef traceENTER_xTimerCreateStatic
-    #define traceENTER_xTimerCreateStatic( pcTimerName, xTimerPeriodInTicks, xAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer )
+#ifndef traceSOFTIRQ_RAISE
+    #define traceSOFTIRQ_RAISE( uxSoftIRQ, xCoreID )
 #endif
 
-#ifndef traceRETURN_xTimerCreateStatic
-    #define traceRETURN_xTimerCreateStatic( pxNewTimer )
+#ifndef traceSOFTIRQ_RUN
+    #define traceSOFTIRQ_RUN( uxSoftIRQ )
 #endif
 
-#ifndef traceENTER_xTimerGenericCommandFromTask
-    #define traceENTER_xTimerGenericCommandFromTask( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait )
+#ifndef traceENTER_vCompletionInit
+    #define traceENTER_vCompletionInit( pxCompletion )
 #endif
 
-#ifndef traceRETURN_xTimerGenericCommandFromTask
-    #define traceRETURN_xTimerGenericCommandFromTask( xReturn )
+#ifndef traceRETURN_vCompletionInit
+    #define traceRETURN_vCompletionInit()
 #endif
 
-#ifndef traceENTER_xTimerGenericCommandFromISR
-    #define traceENTER_xTimerGenericCommandFromISR( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait )
+#ifndef traceENTER_vCompletionArm
+    #define traceENTER_vCompletionArm( pxCompletion )
 #endif
 
-#ifndef traceRETURN_xTimerGenericCommandFromISR
-    #define traceRETURN_xTimerGenericCommandFromISR( xReturn )
+#ifndef traceRETURN_vCompletionArm
+    #define traceRETURN_vCompletionArm()
 #endif
 
-#ifndef traceENTER_xTimerGetTimerDaemonTaskHandle
-    #define traceENTER_xTimerGetTimerDaemonTaskHandle()
+#ifndef traceENTER_xCompletionWait
+    #define traceENTER_xCompletionWait( pxCompletion, pulStatus, xTicksToWait )
 #endif
 
-#ifndef traceRETURN_xTimerGetTimerDaemonTaskHandle
-    #define traceRETURN_xTimerGetTimerDaemonTaskHandle( xTimerTaskHandle )
+#ifndef traceRETURN_xCompletionWait
+    #define traceRETURN_xCompletionWait( xReturn )
 #endif
 
-#ifndef traceENTER_xTimerGetPeriod
-    #define traceENTER_xTimerGetPeriod( xTimer )
+#ifndef traceENTER_vCompletionSignal
+    #define traceENTER_vCompletionSignal( pxCompletion, ulStatus )
 #endif
 
-#ifndef traceRETURN_xTimerGetPeriod
-    #define traceRETURN_xTimerGetPeriod( xTimerPeriodInTicks )
+#ifndef traceRETURN_vCompletionSignal
+    #define traceRETURN_vCompletionSignal()
 #endif
 
-#ifndef traceENTER_vTimerSetReloadMode
-    #define traceENTER_vTimerSetReloadMode( xTimer, xAutoReload )
+#ifndef traceENTER_vCompletionSignalFromISR
+    #define traceENTER_vCompletionSignalFromISR( pxCompletion, ulStatus, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceRETURN_vTimerSetReloadMode
-    #define traceRETURN_vTimerSetReloadMode()
+#ifndef traceRETURN_vCompletionSignalFromISR
+    #define traceRETURN_vCompletionSignalFromISR()
 #endif
 
-#ifndef traceENTER_xTimerGetReloadMode
-    #define traceENTER_xTimerGetReloadMode( xTimer )
+#ifndef traceBLOCKING_ON_COMPLETION
+    #define traceBLOCKING_ON_COMPLETION( pxCompletion )
 #endif
 
-#ifndef traceRETURN_xTimerGetReloadMode
-    #define traceRETURN_xTimerGetReloadMode( xReturn )
+#ifndef traceCOMPLETION_SIGNAL
+    #define traceCOMPLETION_SIGNAL( pxCompletion, ulStatus )
 #endif
 
-#ifndef traceENTER_uxTimerGetReloadMode
-    #define traceENTER_uxTimerGetReloadMode( xTimer )
+#ifndef traceCOMPLETION_SIGNAL_FROM_ISR
+    #define traceCOMPLETION_SIGNAL_FROM_ISR( pxCompletion, ulStatus )
 #endif
 
-#ifndef traceRETURN_uxTimerGetReloadMode
-    #define traceRETURN_uxTimerGetReloadMode( uxReturn )
+#ifndef traceENTER_vDeferredLogInit
+    #define traceENTER_vDeferredLogInit()
 #endif
 
-#ifndef traceENTER_xTimerGetExpiryTime
-    #define traceENTER_xTimerGetExpiryTime( xTimer )
+#ifndef traceRETURN_vDeferredLogInit
+    #define traceRETURN_vDeferredLogInit()
 #endif
 
-#ifndef traceRETURN_xTimerGetExpiryTime
-    #define traceRETURN_xTimerGetExpiryTime( xReturn )
+#ifndef traceENTER_vDeferredLogWrite
+    #define traceENTER_vDeferredLogWrite( pcFormat, pulArguments, uxArgumentCount )
 #endif
 
-#ifndef traceENTER_xTimerGetStaticBuffer
-    #define traceENTER_xTimerGetStaticBuffer( xTimer, ppxTimerBuffer )
+#ifndef traceRETURN_vDeferredLogWrite
+    #define traceRETURN_vDeferredLogWrite()
 #endif
 
-#ifndef traceRETURN_xTimerGetStaticBuffer
-    #define traceRETURN_xTimerGetStaticBuffer( xReturn )
+#ifndef traceENTER_xDeferredLogReceive
+    #define traceENTER_xDeferredLogReceive( pxRecord )
 #endif
 
-#ifndef traceENTER_pcTimerGetName
-    #define traceENTER_pcTimerGetName( xTimer )
+#ifndef traceRETURN_xDeferredLogReceive
+    #define traceRETURN_xDeferredLogReceive( xReturn )
 #endif
 
-#ifndef traceRETURN_pcTimerGetName
-    #define traceRETURN_pcTimerGetName( pcTimerName )
+#ifndef traceENTER_xDeferredLogFormat
+    #define traceENTER_xDeferredLogFormat( pxRecord, pcBuffer, xBufferLength )
 #endif
 
-#ifndef traceENTER_xTimerIsTimerActive
-    #define traceENTER_xTimerIsTimerActive( xTimer )
+#ifndef traceRETURN_xDeferredLogFormat
+    #define traceRETURN_xDeferredLogFormat( xReturn )
 #endif
 
-#ifndef traceRETURN_xTimerIsTimerActive
-    #define traceRETURN_xTimerIsTimerActive( xReturn )
+#ifndef traceENTER_ulDeferredLogGetDroppedCount
+    #define traceENTER_ulDeferredLogGetDroppedCount()
 #endif
 
-#ifndef traceENTER_pvTimerGetTimerID
-    #define traceENTER_pvTimerGetTimerID( xTimer )
+#ifndef traceRETURN_ulDeferredLogGetDroppedCount
+    #define traceRETURN_ulDeferredLogGetDroppedCount( ulReturn )
 #endif
 
-#ifndef traceRETURN_pvTimerGetTimerID
-    #define traceRETURN_pvTimerGetTimerID( pvReturn )
+#ifndef traceDEFERRED_LOG_DROPPED
+    #define traceDEFERRED_LOG_DROPPED( pcFormat )
 #endif
 
-#ifndef traceENTER_vTimerSetTimerID
-    #define traceENTER_vTimerSetTimerID( xTimer, pvNewID )
+#ifndef traceENTER_xAMPMessageChannelCreate
+    #define traceENTER_xAMPMessageChannelCreate( pxChannel, pvSharedRegion, xStorageBytes, xIsPrimary, pxRingDoorbell, pvDoorbellContext )
 #endif
 
-#ifndef traceRETURN_vTimerSetTimerID
-    #define traceRETURN_vTimerSetTimerID()
+#ifndef traceRETURN_xAMPMessageChannelCreate
+    #define traceRETURN_xAMPMessageChannelCreate( xReturn )
 #endif
 
-#ifndef traceENTER_xTimerPendFunctionCallFromISR
-    #define traceENTER_xTimerPendFunctionCallFromISR( xFunctionToPend, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken )
+#ifndef traceENTER_xAMPMessageChannelSend
+    #define traceENTER_xAMPMessageChannelSend( pxChannel, pvTxData, xDataLengthBytes, xTicksToWait )
 #endif
 
-#ifndef traceRETURN_xTimerPendFunctionCallFromISR
-    #define traceRETURN_xTimerPendFunctionCallFromISR( xReturn )
+#ifndef traceRETURN_xAMPMessageChannelSend
+    #define traceRETURN_xAMPMessageChannelSend( xReturn )
 #endif
 
-#ifndef traceENTER_xTimerPendFunctionCall
-    #define traceENTER_xTimerPendFunctionCall( xFunctionToPend, pvParameter1, ulParameter2, xTicksToWait )
+#ifndef traceENTER_xAMPMessageChannelSendFromISR
+    #define traceENTER_xAMPMessageChannelSendFromISR( pxChannel, pvTxData, xDataLengthBytes )
 #endif
 
-#ifndef traceRETURN_xTimerPendFunctionCall
-    #define traceRETURN_xTimerPendFunctionCall( xReturn )
+#ifndef traceRETURN_xAMPMessageChannelSendFromISR
+    #define traceRETURN_xAMPMessageChannelSendFromISR( xReturn )
 #endif
 
-#ifndef traceENTER_uxTimerGetTimerNumber
-    #define traceENTER_uxTimerGetTimerNumber( xTimer )
+#ifndef traceENTER_xAMPMessageChannelReceive
+    #define traceENTER_xAMPMessageChannelReceive( pxChannel, pvRxData, xBufferLengthBytes, xTicksToWait )
 #endif
 
-#ifndef traceRETURN_uxTimerGetTimerNumber
-    #define traceRETURN_uxTimerGetTimerNumber( uxTimerNumber )
+#ifndef traceRETURN_xAMPMessageChannelReceive
+    #define traceRETURN_xAMPMessageChannelReceive( xReturn )
 #endif
 
-#ifndef traceENTER_vTimerSetTimerNumber
-    #define traceENTER_vTimerSetTimerNumber( xTimer, uxTimerNumber )
+#ifndef traceENTER_vAMPMessageChannelBeginBatch
+    #define traceENTER_vAMPMessageChannelBeginBatch( pxChannel )
 #endif
 
-#ifndef traceRETURN_vTimerSetTimerNumber
-    #define traceRETURN_vTimerSetTimerNumber()
+#ifndef traceRETURN_vAMPMessageChannelBeginBatch
+    #define traceRETURN_vAMPMessageChannelBeginBatch()
 #endif
 
-#ifndef traceENTER_xTaskCreateStatic
-    #define traceENTER_xTaskCreateStatic( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, puxStackBuffer, pxTaskBuffer )
+#ifndef traceENTER_vAMPMessageChannelEndBatch
+    #define traceENTER_vAMPMessageChannelEndBatch( pxChannel )
 #endif
 
-#ifndef traceRETURN_xTaskCreateStatic
-    #define traceRETURN_xTaskCreateStatic( xReturn )
+#ifndef traceRETURN_vAMPMessageChannelEndBatch
+    #define traceRETURN_vAMPMessageChannelEndBatch()
 #endif
 
-#ifndef traceENTER_xTaskCreateStaticAffinitySet
-    #define traceENTER_xTaskCreateStaticAffinitySet( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, puxStackBuffer, pxTaskBuffer, uxCoreAffinityMask )
+#ifndef traceENTER_vAMPMessageChannelDoorbellFromISR
+    #define traceENTER_vAMPMessageChannelDoorbellFromISR( pxChannel, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceRETURN_xTaskCreateStaticAffinitySet
-    #define traceRETURN_xTaskCreateStaticAffinitySet( xReturn )
+#ifndef traceRETURN_vAMPMessageChannelDoorbellFromISR
+    #define traceRETURN_vAMPMessageChannelDoorbellFromISR()
 #endif
 
-#ifndef traceENTER_xTaskCreateRestrictedStatic
-    #define traceENTER_xTaskCreateRestrictedStatic( pxTaskDefinition, pxCreatedTask )
+#ifndef traceAMP_MESSAGE_CHANNEL_DOORBELL
+    #define traceAMP_MESSAGE_CHANNEL_DOORBELL( pxChannel )
 #endif
 
-#ifndef traceRETURN_xTaskCreateRestrictedStatic
-    #define traceRETURN_xTaskCreateRestrictedStatic( xReturn )
+#ifndef traceENTER_xAsyncTaskInit
+    #define traceENTER_xAsyncTaskInit( pxTask, pxFunction, pvParameter, uxPriority )
 #endif
 
-#ifndef traceENTER_xTaskCreateRestrictedStaticAffinitySet
-    #define traceENTER_xTaskCreateRestrictedStaticAffinitySet( pxTaskDefinition, uxCoreAffinityMask, pxCreatedTask )
+#ifndef traceRETURN_xAsyncTaskInit
+    #define traceRETURN_xAsyncTaskInit( xReturn )
 #endif
 
-#ifndef traceRETURN_xTaskCreateRestrictedStaticAffinitySet
-    #define traceRETURN_xTaskCreateRestrictedStaticAffinitySet( xReturn )
+#ifndef traceENTER_vAsyncTaskNotifyGive
+    #define traceENTER_vAsyncTaskNotifyGive( pxTask )
 #endif
 
-#ifndef traceENTER_xTaskCreateRestricted
-    #define traceENTER_xTaskCreateRestricted( pxTaskDefinition, pxCreatedTask )
+#ifndef traceRETURN_vAsyncTaskNotifyGive
+    #define traceRETURN_vAsyncTaskNotifyGive()
 #endif
 
-#ifndef traceRETURN_xTaskCreateRestricted
-    #define traceRETURN_xTaskCreateRestricted( xReturn )
+#ifndef traceENTER_vAsyncTaskNotifyGiveFromISR
+    #define traceENTER_vAsyncTaskNotifyGiveFromISR( pxTask, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceENTER_xTaskCreateRestrictedAffinitySet
-    #define traceENTER_xTaskCreateRestrictedAffinitySet( pxTaskDefinition, uxCoreAffinityMask, pxCreatedTask )
+#ifndef traceRETURN_vAsyncTaskNotifyGiveFromISR
+    #define traceRETURN_vAsyncTaskNotifyGiveFromISR()
 #endif
 
-#ifndef traceRETURN_xTaskCreateRestrictedAffinitySet
-    #define traceRETURN_xTaskCreateRestrictedAffinitySet( xReturn )
+#ifndef traceASYNC_TASK_RESUME
+    #define traceASYNC_TASK_RESUME( pxTask )
 #endif
 
-#ifndef traceENTER_xTaskCreate
-    #define traceENTER_xTaskCreate( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, pxCreatedTask )
+#ifndef traceENTER_xTaskPoolCreate
+    #define traceENTER_xTaskPoolCreate( pcName, uxWorkerCount, uxMaxPendingJobs, uxStackDepth, uxPriority )
 #endif
 
-#ifndef traceRETURN_xTaskCreate
-    #define traceRETURN_xTaskCreate( xReturn )
+#ifndef traceRETURN_xTaskPoolCreate
+    #define traceRETURN_xTaskPoolCreate( xReturn )
 #endif
 
-#ifndef traceENTER_xTaskCreateAffinitySet
-    #define traceENTER_xTaskCreateAffinitySet( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, uxCoreAffinityMask, pxCreatedTask )
+#ifndef traceENTER_xTaskPoolSubmit
+    #define traceENTER_xTaskPoolSubmit( xPool, pxFunction, pvParameter )
 #endif
 
-#ifndef traceRETURN_xTaskCreateAffinitySet
-    #define traceRETURN_xTaskCreateAffinitySet( xReturn )
+#ifndef traceRETURN_xTaskPoolSubmit
+    #define traceRETURN_xTaskPoolSubmit( xReturn )
 #endif
 
-#ifndef traceENTER_vTaskDelete
-    #define traceENTER_vTaskDelete( xTaskToDelete )
+#ifndef traceENTER_xTaskPoolSubmitFromISR
+    #define traceENTER_xTaskPoolSubmitFromISR( xPool, pxFunction, pvParameter, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef traceRETURN_vTaskDelete
-    #define traceRETURN_vTaskDelete()
+#ifndef traceRETURN_xTaskPoolSubmitFromISR
+    #define traceRETURN_xTaskPoolSubmitFromISR( xReturn )
 #endif
 
-#ifndef traceENTER_xTaskDelayUntil
-    #define traceENTER_xTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement )
+#ifndef traceENTER_vTaskPoolGetStats
+    #define traceENTER_vTaskPoolGetStats( xPool, pxStats )
 #endif
 
-#ifndef traceRETURN_xTaskDelayUntil
-    #define traceRETURN_xTaskDelayUntil( xShouldDelay )
+#ifndef traceRETURN_vTaskPoolGetStats
+    #define traceRETURN_vTaskPoolGetStats()
 #endif
 
-#ifndef traceENTER_vTaskDelay
-    #define traceENTER_vTaskDelay( xTicksToDelay )
+#ifndef traceENTER_vTaskPoolCoreAffinitySet
+    #define traceENTER_vTaskPoolCoreAffinitySet( xPool, uxCoreAffinityMask )
 #endif
 
-#ifndef traceRETURN_vTaskDelay
-    #define traceRETURN_vTaskDelay()
+#ifndef traceRETURN_vTaskPoolCoreAffinitySet
+    #define traceRETURN_vTaskPoolCoreAffinitySet()
 #endif
 
-#ifndef traceENTER_eTaskGetState
-    #define traceENTER_eTaskGetState( xTask )
+#ifndef traceTASK_POOL_JOB_START
+    #define traceTASK_POOL_JOB_START( xPool, pxFunction )
 #endif
 
-#ifndef traceRETURN_eTaskGetState
-    #define traceRETURN_eTaskGetState( eReturn )
+#ifndef traceENTER_xTaskParallelForInit
+    #define traceENTER_xTaskParallelForInit( uxStackDepth, uxPriority )
 #endif
 
-#ifndef traceENTER_uxTaskPriorityGet
-    #define traceENTER_uxTaskPriorityGet( xTask )
+#ifndef traceRETURN_xTaskParallelForInit
+    #define traceRETURN_xTaskParallelForInit( xReturn )
 #endif
 
-#ifndef traceRETURN_uxTaskPriorityGet
-    #define traceRETURN_uxTaskPriorityGet( uxReturn )
+#ifndef traceENTER_vTaskParallelFor
+    #define traceENTER_vTaskParallelFor( xRange, xChunkSize, pxFunction, pvContext )
 #endif
 
-#ifndef traceENTER_uxTaskPriorityGetFromISR
-    #define traceENTER_uxTaskPriorityGetFromISR( xTask )
+#ifndef traceRETURN_vTaskParallelFor
+    #define traceRETURN_vTaskParallelFor()
 #endif
 
-#ifndef traceRETURN_uxTaskPriorityGetFromISR
-    #define traceRETURN_uxTaskPriorityGetFromISR( uxReturn )
+#ifndef traceENTER_vTaskTemplateInit
+    #define traceENTER_vTaskTemplateInit( pxTemplate, pxTaskCode, pcName, uxStackDepth, uxPriority, uxTaskCount, puxStackBuffers, pxTaskBuffers )
 #endif
 
-#ifndef traceENTER_uxTaskBasePriorityGet
-    #define traceENTER_uxTaskBasePriorityGet( xTask )
+#ifndef traceRETURN_vTaskTemplateInit
+    #define traceRETURN_vTaskTemplateInit()
 #endif
 
-#ifndef traceRETURN_uxTaskBasePriorityGet
-    #define traceRETURN_uxTaskBasePriorityGet( uxReturn )
+#ifndef traceENTER_xTaskCreateFromTemplate
+    #define traceENTER_xTaskCreateFromTemplate( pxTemplate, pvParameters )
 #endif
 
-#ifndef traceENTER_uxTaskBasePriorityGetFromISR
-    #define traceENTER_uxTaskBasePriorityGetFromISR( xTask )
+#ifndef traceRETURN_xTaskCreateFromTemplate
+    #define traceRETURN_xTaskCreateFromTemplate( xReturn )
 #endif
 
-#ifndef traceRETURN_uxTaskBasePriorityGetFromISR
-    #define traceRETURN_uxTaskBasePriorityGetFromISR( uxReturn )
+#ifndef traceENTER_uxTaskTemplateGetFreeCount
+    #define traceENTER_uxTaskTemplateGetFreeCount( pxTemplate )
 #endif
 
-#ifndef traceENTER_vTaskPrioritySet
-    #define traceENTER_vTaskPrioritySet( xTask, uxNewPriority )
+#ifndef traceRETURN_uxTaskTemplateGetFreeCount
+    #define traceRETURN_uxTaskTemplateGetFreeCount( uxReturn )
 #endif
 
-#ifndef traceRETURN_vTaskPrioritySet
-    #define traceRETURN_vTaskPrioritySet()
+#ifndef traceENTER_vTaskSharedStackInit
+    #define traceENTER_vTaskSharedStackInit( pxSharedStack, puxStackBuffer, uxStackDepth )
 #endif
 
-#ifndef traceENTER_vTaskCoreAffinitySet
-    #define traceENTER_vTaskCoreAffinitySet( xTask, uxCoreAffinityMask )
+#ifndef traceRETURN_vTaskSharedStackInit
+    #define traceRETURN_vTaskSharedStackInit()
 #endif
 
-#ifndef traceRETURN_vTaskCoreAffinitySet
-    #define traceRETURN_vTaskCoreAffinitySet()
+#ifndef traceENTER_xTaskCreateWithSharedStack
+    #define traceENTER_xTaskCreateWithSharedStack( pxSharedStack, pxTaskCode, pcName, pvParameters, uxPriority, puxSaveBuffer, uxSaveDepth, pxTaskBuffer )
 #endif
 
-#ifndef traceENTER_vTaskCoreAffinityGet
-    #define traceENTER_vTaskCoreAffinityGet( xTask )
+#ifndef traceRETURN_xTaskCreateWithSharedStack
+    #define traceRETURN_xTaskCreateWithSharedStack( xReturn )
 #endif
 
-#ifndef traceRETURN_vTaskCoreAffinityGet
-    #define traceRETURN_vTaskCoreAffinityGet( uxCoreAffinityMask )
+#ifndef traceENTER_vTaskSharedStackRelease
+    #define traceENTER_vTaskSharedStackRelease( xRelease )
 #endif
 
-#ifndef traceENTER_vTaskPreemptionDisable
-    #define traceENTER_vTaskPreemptionDisable( xTask )
+#ifndef traceRETURN_vTaskSharedStackRelease
+    #define traceRETURN_vTaskSharedStackRelease()
 #endif
 
-#ifndef traceRETURN_vTaskPreemptionDisable
-    #define traceRETURN_vTaskPreemptionDisable()
+#ifndef traceENTER_xStaticObjectsCreate
+    #define traceENTER_xStaticObjectsCreate( pxObjects, uxObjectCount )
 #endif
 
-#ifndef traceENTER_vTaskPreemptionEnable
-    #define traceENTER_vTaskPreemptionEnable( xTask )
+#ifndef traceRETURN_xStaticObjectsCreate
+    #define traceRETURN_xStaticObjectsCreate( xReturn )
 #endif
 
-#ifndef traceRETURN_vTaskPreemptionEnable
-    #define traceRETURN_vTaskPreemptionEnable()
+#ifndef traceENTER_xTaskGetWarmBootStateSize
+    #define traceENTER_xTaskGetWarmBootStateSize()
 #endif
 
-#ifndef traceENTER_vTaskSuspend
-    #define traceENTER_vTaskSuspend( xTaskToSuspend )
+#ifndef traceRETURN_xTaskGetWarmBootStateSize
+    #define traceRETURN_xTaskGetWarmBootStateSize( xSize )
 #endif
 
-#ifndef traceRETURN_vTaskSuspend
-    #define traceRETURN_vTaskSuspend()
+#ifndef traceENTER_xTaskSaveWarmBootState
+    #define traceENTER_xTaskSaveWarmBootState( pvBuffer, xBufferSize )
 #endif
 
-#ifndef traceENTER_vTaskResume
-    #define traceENTER_vTaskResume( xTaskToResume )
+#ifndef traceRETURN_xTaskSaveWarmBootState
+    #define traceRETURN_xTaskSaveWarmBootState( xReturn )
 #endif
 
-#ifndef traceRETURN_vTaskResume
-    #define traceRETURN_vTaskResume()
+#ifndef traceENTER_xTaskRestoreWarmBootState
+    #define traceENTER_xTaskRestoreWarmBootState( pvBuffer, xBufferSize, xTicksAsleep )
 #endif
 
-#ifndef traceENTER_xTaskResumeFromISR
-    #define traceENTER_xTaskResumeFromISR( xTaskToResume )
+#ifndef traceRETURN_xTaskRestoreWarmBootState
+    #define traceRETURN_xTaskRestoreWarmBootState( xReturn )
 #endif
 
-#ifndef traceRETURN_xTaskResumeFromISR
-    #define traceRETURN_xTaskResumeFromISR( xYieldRequired )
+#ifndef traceENTER_vLowPowerRegisterSleepStates
+    #define traceENTER_vLowPowerRegisterSleepStates( pxSleepStates, uxNumberOfStates )
 #endif
 
-#ifndef traceENTER_vTaskStartScheduler
-    #define traceENTER_vTaskStartScheduler()
+#ifndef traceRETURN_vLowPowerRegisterSleepStates
+    #define traceRETURN_vLowPowerRegisterSleepStates()
 #endif
 
-#ifndef traceRETURN_vTaskStartScheduler
-    #define traceRETURN_vTaskStartScheduler()
+#ifndef traceENTER_pxLowPowerGetSelectedState
+    #define traceENTER_pxLowPowerGetSelectedState()
 #endif
 
-#ifndef traceENTER_vTaskEndScheduler
-    #define traceENTER_vTaskEndScheduler()
+#ifndef traceRETURN_pxLowPowerGetSelectedState
+    #define traceRETURN_pxLowPowerGetSelectedState( pxSleepState )
 #endif
 
-#ifndef traceRETURN_vTaskEndScheduler
-    #define traceRETURN_vTaskEndScheduler()
+#ifndef traceLOW_POWER_SLEEP_STATE_SELECTED
+    /* Called when the idle task has chosen the sleep state to enter. */
+    #define traceLOW_POWER_SLEEP_STATE_SELECTED( pxSleepState, xPredictedIdleTime )
 #endif
 
-#ifndef traceENTER_vTaskSuspendAll
-    #define traceENTER_vTaskSuspendAll()
+#ifndef configGENERATE_RUN_TIME_STATS
+    #define configGENERATE_RUN_TIME_STATS    0
 #endif
 
-#ifndef traceRETURN_vTaskSuspendAll
-    #define traceRETURN_vTaskSuspendAll()
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+    #ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+        #error If configGENERATE_RUN_TIME_STATS is defined then portCONFIGURE_TIMER_FOR_RUN_TIME_STATS must also be defined.  portCONFIGURE_TIMER_FOR_RUN_TIME_STATS should call a port layer function to setup a peripheral timer/counter that can then be used as the run time counter time base.
+    #endif /* portCONFIGURE_TIMER_FOR_RUN_TIME_STATS */
+
+    #ifndef portGET_RUN_TIME_COUNTER_VALUE
+        #ifndef portALT_GET_RUN_TIME_COUNTER_VALUE
+            #error If configGENERATE_RUN_TIME_STATS is defined then either portGET_RUN_TIME_COUNTER_VALUE or portALT_GET_RUN_TIME_COUNTER_VALUE must also be defined.  See the examples provided and the FreeRTOS web site for more information.
+        #endif /* portALT_GET_RUN_TIME_COUNTER_VALUE */
+    #endif /* portGET_RUN_TIME_COUNTER_VALUE */
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#ifndef configUSE_SCHEDULING_LATENCY_STATS
+    #define configUSE_SCHEDULING_LATENCY_STATS    0
 #endif
 
-#ifndef traceENTER_xTaskResumeAll
-    #define traceENTER_xTaskResumeAll()
+/* The number of buckets in each task's scheduling latency histogram.  Bucket 0
+ * counts latencies of 0, and bucket n counts latencies from 2^(n-1) to
+ * (2^n)-1 run time counts, except the last bucket, which also counts all
+ * longer latencies. */
+#ifndef configSCHEDULING_LATENCY_BUCKETS
+    #define configSCHEDULING_LATENCY_BUCKETS    16U
 #endif
 
-#ifndef traceRETURN_xTaskResumeAll
-    #define traceRETURN_xTaskResumeAll( xAlreadyYielded )
+#if ( ( configUSE_SCHEDULING_LATENCY_STATS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_SCHEDULING_LATENCY_STATS requires configGENERATE_RUN_TIME_STATS to be set to 1.
 #endif
 
-#ifndef traceENTER_xTaskGetTickCount
-    #define traceENTER_xTaskGetTickCount()
+#if ( ( configUSE_SCHEDULING_LATENCY_STATS == 1 ) && ( configSCHEDULING_LATENCY_BUCKETS < 2 ) )
+    #error configSCHEDULING_LATENCY_BUCKETS must be at least 2.
 #endif
 
-#ifndef traceRETURN_xTaskGetTickCount
-    #define traceRETURN_xTaskGetTickCount( xTicks )
+#ifndef configUSE_IPC_STATISTICS
+    #define configUSE_IPC_STATISTICS    0
 #endif
 
-#ifndef traceENTER_xTaskGetTickCountFromISR
-    #define traceENTER_xTaskGetTickCountFromISR()
+#if ( ( configUSE_IPC_STATISTICS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_IPC_STATISTICS is not supported when portUSING_MPU_WRAPPERS is 1.
 #endif
 
-#ifndef traceRETURN_xTaskGetTickCountFromISR
-    #define traceRETURN_xTaskGetTickCountFromISR( xReturn )
+#ifndef configUSE_IPC_LATENCY_TRACING
+    #define configUSE_IPC_LATENCY_TRACING    0
 #endif
 
-#ifndef traceENTER_uxTaskGetNumberOfTasks
-    #define traceENTER_uxTaskGetNumberOfTasks()
+/* The number of buckets in each IPC latency histogram.  Bucket 0 counts
+ * latencies of 0, and bucket n counts latencies from 2^(n-1) to (2^n)-1 run
+ * time counts, except the last bucket, which also counts all longer
+ * latencies. */
+#ifndef configIPC_LATENCY_BUCKETS
+    #define configIPC_LATENCY_BUCKETS    16U
 #endif
 
-#ifndef traceRETURN_uxTaskGetNumberOfTasks
-    #define traceRETURN_uxTaskGetNumberOfTasks( uxCurrentNumberOfTasks )
+/* The number of unread messages of each message buffer that can carry a
+ * latency tag.  Messages written while all the tags are in use are not
+ * traced. */
+#ifndef configIPC_LATENCY_MESSAGE_BUFFER_TAGS
+    #define configIPC_LATENCY_MESSAGE_BUFFER_TAGS    8U
 #endif
 
-#ifndef traceENTER_pcTaskGetName
-    #define traceENTER_pcTaskGetName( xTaskToQuery )
+#if ( ( configUSE_IPC_LATENCY_TRACING == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_IPC_LATENCY_TRACING requires configGENERATE_RUN_TIME_STATS to be set to 1.
 #endif
 
-#ifndef traceRETURN_pcTaskGetName
-    #define traceRETURN_pcTaskGetName( pcTaskName )
+#if ( ( configUSE_IPC_LATENCY_TRACING == 1 ) && ( configIPC_LATENCY_BUCKETS < 2 ) )
+    #error configIPC_LATENCY_BUCKETS must be at least 2.
 #endif
 
-#ifndef traceENTER_xTaskGetHandle
-    #define traceENTER_xTaskGetHandle( pcNameToQuery )
+#if ( ( configUSE_IPC_LATENCY_TRACING == 1 ) && ( configIPC_LATENCY_MESSAGE_BUFFER_TAGS < 1 ) )
+    #error configIPC_LATENCY_MESSAGE_BUFFER_TAGS must be at least 1.
 #endif
 
-#ifndef traceRETURN_xTaskGetHandle
-    #define traceRETURN_xTaskGetHandle( pxTCB )
+#if ( ( configUSE_IPC_LATENCY_TRACING == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_IPC_LATENCY_TRACING is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceENTER_xTaskGetStaticBuffers
-    #define traceENTER_xTaskGetStaticBuffers( xTask, ppuxStackBuffer, ppxTaskBuffer )
+#if ( ( configUSE_ISR_RUN_TIME_STATS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_ISR_RUN_TIME_STATS requires configGENERATE_RUN_TIME_STATS to be set to 1.
 #endif
 
-#ifndef traceRETURN_xTaskGetStaticBuffers
-    #define traceRETURN_xTaskGetStaticBuffers( xReturn )
+#if ( ( configUSE_ISR_RUN_TIME_STATS == 1 ) && !defined( portGET_INTERRUPT_NUMBER ) )
+    #error configUSE_ISR_RUN_TIME_STATS requires the port to define portGET_INTERRUPT_NUMBER().
 #endif
 
-#ifndef traceENTER_uxTaskGetSystemState
-    #define traceENTER_uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, pulTotalRunTime )
+#if ( ( configUSE_ISR_RUN_TIME_STATS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_ISR_RUN_TIME_STATS is not supported when portUSING_MPU_WRAPPERS is 1.
 #endif
 
-#ifndef traceRETURN_uxTaskGetSystemState
-    #define traceRETURN_uxTaskGetSystemState( uxTask )
+#if ( ( configUSE_ISR_RUN_TIME_STATS == 1 ) && ( configISR_RUN_TIME_STATS_MAX_NESTING < 1 ) )
+    #error configISR_RUN_TIME_STATS_MAX_NESTING must be at least 1.
 #endif
 
-#if ( configNUMBER_OF_CORES == 1 )
-    #ifndef traceENTER_xTaskGetIdleTaskHandle
-        #define traceENTER_xTaskGetIdleTaskHandle()
-    #endif
+#if ( ( configUSE_CRITICAL_SECTION_STATS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_CRITICAL_SECTION_STATS requires configGENERATE_RUN_TIME_STATS to be set to 1.
 #endif
 
-#if ( configNUMBER_OF_CORES == 1 )
-    #ifndef traceRETURN_xTaskGetIdleTaskHandle
-        #define traceRETURN_xTaskGetIdleTaskHandle( xIdleTaskHandle )
-    #endif
+#if ( ( configUSE_SWITCH_REASON_STATS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_SWITCH_REASON_STATS is not supported when portUSING_MPU_WRAPPERS is 1.
 #endif
 
-#ifndef traceENTER_xTaskGetIdleTaskHandleForCore
-    #define traceENTER_xTaskGetIdleTaskHandleForCore( xCoreID )
+#if ( ( configUSE_CRITICAL_SECTION_STATS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_CRITICAL_SECTION_STATS is not supported when portUSING_MPU_WRAPPERS is 1.
 #endif
 
-#ifndef traceRETURN_xTaskGetIdleTaskHandleForCore
-    #define traceRETURN_xTaskGetIdleTaskHandleForCore( xIdleTaskHandle )
+#if ( ( configUSE_CRITICAL_SECTION_STATS == 1 ) && ( configUSE_GRANULAR_LOCKS == 1 ) )
+    #error configUSE_CRITICAL_SECTION_STATS is not supported when configUSE_GRANULAR_LOCKS is 1.
 #endif
 
-#ifndef traceENTER_vTaskStepTick
-    #define traceENTER_vTaskStepTick( xTicksToJump )
+#if ( ( configUSE_CORE_LOAD_STATS == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_CORE_LOAD_STATS requires configGENERATE_RUN_TIME_STATS to be set to 1.
 #endif
 
-#ifndef traceRETURN_vTaskStepTick
-    #define traceRETURN_vTaskStepTick()
+#if ( ( configUSE_CORE_LOAD_STATS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_CORE_LOAD_STATS is not supported when portUSING_MPU_WRAPPERS is 1.
 #endif
 
-#ifndef traceENTER_xTaskCatchUpTicks
-    #define traceENTER_xTaskCatchUpTicks( xTicksToCatchUp )
+#if ( ( configUSE_CORE_LOAD_STATS == 1 ) && ( configCORE_LOAD_WINDOW < 1 ) )
+    #error configCORE_LOAD_WINDOW must be at least 1.
 #endif
 
-#ifndef traceRETURN_xTaskCatchUpTicks
-    #define traceRETURN_xTaskCatchUpTicks( xYieldOccurred )
+#if ( ( configUSE_WAKE_SOURCE_STATS == 1 ) && ( configUSE_TICKLESS_IDLE == 0 ) )
+    #error configUSE_WAKE_SOURCE_STATS requires configUSE_TICKLESS_IDLE to be set to a value other than 0.
 #endif
 
-#ifndef traceENTER_xTaskAbortDelay
-    #define traceENTER_xTaskAbortDelay( xTask )
+#if ( ( configUSE_WAKE_SOURCE_STATS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_WAKE_SOURCE_STATS is not supported when portUSING_MPU_WRAPPERS is 1.
 #endif
 
-#ifndef traceRETURN_xTaskAbortDelay
-    #define traceRETURN_xTaskAbortDelay( xReturn )
+#if ( ( configUSE_WAKE_SOURCE_STATS == 1 ) && ( configWAKE_SOURCE_HISTOGRAM_LENGTH < 1 ) )
+    #error configWAKE_SOURCE_HISTOGRAM_LENGTH must be at least 1.
 #endif
 
-#ifndef traceENTER_xTaskIncrementTick
-    #define traceENTER_xTaskIncrementTick()
+#if ( ( configUSE_DVFS_GOVERNOR == 1 ) && ( configUSE_CORE_LOAD_STATS != 1 ) )
+    #error configUSE_DVFS_GOVERNOR requires configUSE_CORE_LOAD_STATS to be set to 1.
 #endif
 
-#ifndef traceRETURN_xTaskIncrementTick
-    #define traceRETURN_xTaskIncrementTick( xSwitchRequired )
+#if ( ( configUSE_DVFS_GOVERNOR == 1 ) && ( configDVFS_GOVERNOR_PERIOD < 1 ) )
+    #error configDVFS_GOVERNOR_PERIOD must be at least 1.
 #endif
 
-#ifndef traceENTER_vTaskSetApplicationTaskTag
-    #define traceENTER_vTaskSetApplicationTaskTag( xTask, pxHookFunction )
+#ifndef configUSE_RUN_TIME_SNAPSHOT
+    #define configUSE_RUN_TIME_SNAPSHOT    0
 #endif
 
-#ifndef traceRETURN_vTaskSetApplicationTaskTag
-    #define traceRETURN_vTaskSetApplicationTaskTag()
+/* The number of tasks the run time snapshot can describe.  Tasks created while
+ * every slot is in use are left out of the snapshot. */
+#ifndef configRUN_TIME_SNAPSHOT_SLOTS
+    #define configRUN_TIME_SNAPSHOT_SLOTS    16U
 #endif
 
-#ifndef traceENTER_xTaskGetApplicationTaskTag
-    #define traceENTER_xTaskGetApplicationTaskTag( xTask )
+#if ( ( configUSE_RUN_TIME_SNAPSHOT == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_RUN_TIME_SNAPSHOT requires configGENERATE_RUN_TIME_STATS to be set to 1.
 #endif
 
-#ifndef traceRETURN_xTaskGetApplicationTaskTag
-    #define traceRETURN_xTaskGetApplicationTaskTag( xReturn )
+#if ( ( configUSE_RUN_TIME_SNAPSHOT == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_RUN_TIME_SNAPSHOT is not supported when portUSING_MPU_WRAPPERS is 1.
 #endif
 
-#ifndef traceENTER_xTaskGetApplicationTaskTagFromISR
-    #define traceENTER_xTaskGetApplicationTaskTagFromISR( xTask )
+#if ( ( configUSE_RUN_TIME_SNAPSHOT == 1 ) && ( configRUN_TIME_SNAPSHOT_SLOTS < 1 ) )
+    #error configRUN_TIME_SNAPSHOT_SLOTS must be at least 1.
 #endif
 
-#ifndef traceRETURN_xTaskGetApplicationTaskTagFromISR
-    #define traceRETURN_xTaskGetApplicationTaskTagFromISR( xReturn )
+#ifndef configUSE_ENERGY_ACCOUNTING
+    #define configUSE_ENERGY_ACCOUNTING    0
 #endif
 
-#ifndef traceENTER_xTaskCallApplicationTaskHook
-    #define traceENTER_xTaskCallApplicationTaskHook( xTask, pvParameter )
+/* The type of the energy charged to each task.  The energy is the task's run
+ * time multiplied by configENERGY_ACTIVE_POWER(), plus
+ * configENERGY_WAKE_UP_COST for each wake-up, so it must be wide enough for
+ * the product. */
+#ifndef configENERGY_COUNTER_TYPE
+    #define configENERGY_COUNTER_TYPE    uint64_t
 #endif
 
-#ifndef traceRETURN_xTaskCallApplicationTaskHook
-    #define traceRETURN_xTaskCallApplicationTaskHook( xReturn )
+/* Returns the power drawn while a task runs, in units of the application's
+ * choosing, for example the power of the current DVFS level.  Evaluated each
+ * time a task is switched out. */
+#ifndef configENERGY_ACTIVE_POWER
+    #define configENERGY_ACTIVE_POWER()    ( 1U )
 #endif
 
-#ifndef traceENTER_vTaskSwitchContext
-    #define traceENTER_vTaskSwitchContext()
+/* The energy charged to a task each time a tickless idle sleep ends at its
+ * wake time, in the same units as the run time multiplied by
+ * configENERGY_ACTIVE_POWER(). */
+#ifndef configENERGY_WAKE_UP_COST
+    #define configENERGY_WAKE_UP_COST    0U
 #endif
 
-#ifndef traceRETURN_vTaskSwitchContext
-    #define traceRETURN_vTaskSwitchContext()
+#if ( ( configUSE_ENERGY_ACCOUNTING == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configUSE_ENERGY_ACCOUNTING requires configGENERATE_RUN_TIME_STATS to be set to 1.
 #endif
 
-#ifndef traceENTER_vTaskPlaceOnEventList
-    #define traceENTER_vTaskPlaceOnEventList( pxEventList, xTicksToWait )
+#ifndef configUSE_PC_SAMPLING
+    #define configUSE_PC_SAMPLING    0
 #endif
 
-#ifndef traceRETURN_vTaskPlaceOnEventList
-    #define traceRETURN_vTaskPlaceOnEventList()
+/* The number of program counter samples held until the application collects
+ * them.  Once the buffer is full each new sample overwrites the oldest. */
+#ifndef configPC_SAMPLE_BUFFER_LENGTH
+    #define configPC_SAMPLE_BUFFER_LENGTH    128U
 #endif
 
-#ifndef traceENTER_vTaskPlaceOnUnorderedEventList
-    #define traceENTER_vTaskPlaceOnUnorderedEventList( pxEventList, xItemValue, xTicksToWait )
+/* Set to 1 to have ports that support it take a sample from their tick
+ * interrupt.  Set to 0 to take samples only from an application timer
+ * interrupt, for example one running at a rate unrelated to the tick. */
+#ifndef configPC_SAMPLE_FROM_TICK
+    #define configPC_SAMPLE_FROM_TICK    1
 #endif
 
-#ifndef traceRETURN_vTaskPlaceOnUnorderedEventList
-    #define traceRETURN_vTaskPlaceOnUnorderedEventList()
+#if ( ( configUSE_PC_SAMPLING == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_PC_SAMPLING is not supported when portUSING_MPU_WRAPPERS is 1.
 #endif
 
-#ifndef traceENTER_vTaskPlaceOnEventListRestricted
-    #define traceENTER_vTaskPlaceOnEventListRestricted( pxEventList, xTicksToWait, xWaitIndefinitely )
+#if ( ( configUSE_PC_SAMPLING == 1 ) && ( configPC_SAMPLE_BUFFER_LENGTH < 1 ) )
+    #error configPC_SAMPLE_BUFFER_LENGTH must be at least 1.
 #endif
 
-#ifndef traceRETURN_vTaskPlaceOnEventListRestricted
-    #define traceRETURN_vTaskPlaceOnEventListRestricted()
+#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+    #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
 #endif
 
-#ifndef traceENTER_xTaskRemoveFromEventList
-    #define traceENTER_xTaskRemoveFromEventList( pxEventList )
+#ifndef portPRIVILEGE_BIT
+    #define portPRIVILEGE_BIT    ( ( UBaseType_t ) 0x00 )
 #endif
 
-#ifndef traceRETURN_xTaskRemoveFromEventList
-    #define traceRETURN_xTaskRemoveFromEventList( xReturn )
+#ifndef portYIELD_WITHIN_API
+    #define portYIELD_WITHIN_API    portYIELD
 #endif
 
-#ifndef traceENTER_vTaskRemoveFromUnorderedEventList
-    #define traceENTER_vTaskRemoveFromUnorderedEventList( pxEventListItem, xItemValue )
+#ifndef portSUPPRESS_TICKS_AND_SLEEP
+    #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )
 #endif
 
-#ifndef traceRETURN_vTaskRemoveFromUnorderedEventList
-    #define traceRETURN_vTaskRemoveFromUnorderedEventList()
+/* Called from the tick interrupt after vApplicationDVFSSetLevel() has changed
+ * the clock, for the port to recalculate its tick timer reload value and any
+ * other value derived from configCPU_CLOCK_HZ. */
+#ifndef portDVFS_CLOCK_CHANGED
+    #define portDVFS_CLOCK_CHANGED()
 #endif
 
-#ifndef traceENTER_vTaskSetTimeOutState
-    #define traceENTER_vTaskSetTimeOutState( pxTimeOut )
+#ifndef configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+    #define configEXPECTED_IDLE_TIME_BEFORE_SLEEP    2
 #endif
 
-#ifndef traceRETURN_vTaskSetTimeOutState
-    #define traceRETURN_vTaskSetTimeOutState()
+#if configEXPECTED_IDLE_TIME_BEFORE_SLEEP < 2
+    #error configEXPECTED_IDLE_TIME_BEFORE_SLEEP must not be less than 2
 #endif
 
-#ifndef traceENTER_vTaskInternalSetTimeOutState
-    #define traceENTER_vTaskInternalSetTimeOutState( pxTimeOut )
+#ifndef configUSE_TICKLESS_IDLE
+    #define configUSE_TICKLESS_IDLE    0
 #endif
 
-#ifndef traceRETURN_vTaskInternalSetTimeOutState
-    #define traceRETURN_vTaskInternalSetTimeOutState()
+#ifndef configUSE_TICKLESS_KERNEL
+    #define configUSE_TICKLESS_KERNEL    0
 #endif
 
-#ifndef traceENTER_xTaskCheckForTimeOut
-    #define traceENTER_xTaskCheckForTimeOut( pxTimeOut, pxTicksToWait )
+#if ( configUSE_TICKLESS_KERNEL == 1 )
+    #if ( configUSE_TICKLESS_IDLE != 0 )
+        #error configUSE_TICKLESS_KERNEL and configUSE_TICKLESS_IDLE cannot both be used.
+    #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_TICKLESS_KERNEL is only supported when configNUMBER_OF_CORES is 1.
+    #endif
+
+/* The one-shot timer is only programmed for the next task wake time and time
+ * slice, and is not programmed again when a hard timer is started, so hard
+ * timer callbacks would run late. */
+    #if ( configUSE_HARD_TIMERS == 1 )
+        #error configUSE_HARD_TIMERS is not supported when configUSE_TICKLESS_KERNEL is set to 1.
+    #endif
+
+/* Program the one-shot timer to interrupt xTicks ticks after the last tick
+ * passed to xTaskProcessElapsedTicks().  Ports clamp xTicks to the longest
+ * period the timer supports.  Called from critical sections in both tasks and
+ * interrupts. */
+    #ifndef portSET_NEXT_TICK_INTERRUPT
+        #error configUSE_TICKLESS_KERNEL requires the port to define portSET_NEXT_TICK_INTERRUPT( xTicks ).
+    #endif
+
+/* The number of whole ticks that have passed since the last tick passed to
+ * xTaskProcessElapsedTicks(). */
+    #ifndef portGET_TICKS_SINCE_LAST_EVENT
+        #error configUSE_TICKLESS_KERNEL requires the port to define portGET_TICKS_SINCE_LAST_EVENT().
+    #endif
+#endif /* configUSE_TICKLESS_KERNEL */
+
+#ifndef configUSE_HR_TIMEOUTS
+    #define configUSE_HR_TIMEOUTS    0
 #endif
 
-#ifndef traceRETURN_xTaskCheckForTimeOut
-    #define traceRETURN_xTaskCheckForTimeOut( xReturn )
+/* The type of the high resolution time returned by portGET_HR_TIME(). */
+#ifndef configHR_TIME_TYPE
+    #define configHR_TIME_TYPE    uint32_t
 #endif
 
-#ifndef traceENTER_vTaskMissedYield
-    #define traceENTER_vTaskMissedYield()
+#if ( configUSE_HR_TIMEOUTS == 1 )
+    #if ( INCLUDE_xTaskAbortDelay != 1 )
+        #error configUSE_HR_TIMEOUTS requires INCLUDE_xTaskAbortDelay to be set to 1.
+    #endif
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_HR_TIMEOUTS is not supported when the MPU wrappers are used.
+    #endif
+
+/* Read the free running high resolution timer, which wraps at the range of
+ * configHR_TIME_TYPE. */
+    #ifndef portGET_HR_TIME
+        #error configUSE_HR_TIMEOUTS requires the port to define portGET_HR_TIME().
+    #endif
+
+/* Interrupt at high resolution time xTime, or as soon as possible if xTime has
+ * already passed.  Setting an alarm replaces any alarm already set.  Called
+ * from critical sections in both tasks and interrupts. */
+    #ifndef portSET_HR_ALARM
+        #error configUSE_HR_TIMEOUTS requires the port to define portSET_HR_ALARM( xTime ).
+    #endif
+
+/* Convert microseconds to high resolution time units.  By default the high
+ * resolution timer counts microseconds. */
+    #ifndef portHR_TIME_FROM_US
+        #define portHR_TIME_FROM_US( ulMicroseconds )    ( ( configHR_TIME_TYPE ) ( ulMicroseconds ) )
+    #endif
+#endif /* configUSE_HR_TIMEOUTS */
+
+#ifndef configUSE_EDF_SCHEDULING
+    #define configUSE_EDF_SCHEDULING    0
 #endif
 
-#ifndef traceRETURN_vTaskMissedYield
-    #define traceRETURN_vTaskMissedYield()
+/* The priority at which tasks created with xTaskCreateDeadline() run, in
+ * earliest deadline first order. */
+#ifndef configEDF_PRIORITY
+    #define configEDF_PRIORITY    ( configMAX_PRIORITIES - 1U )
 #endif
 
-#ifndef traceENTER_uxTaskGetTaskNumber
-    #define traceENTER_uxTaskGetTaskNumber( xTask )
+#ifndef configUSE_DEADLINE_MISSED_HOOK
+    #define configUSE_DEADLINE_MISSED_HOOK    0
 #endif
 
-#ifndef traceRETURN_uxTaskGetTaskNumber
-    #define traceRETURN_uxTaskGetTaskNumber( uxReturn )
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_EDF_SCHEDULING is only supported when configNUMBER_OF_CORES is 1.
+    #endif
+
+    #if ( configEDF_PRIORITY >= configMAX_PRIORITIES )
+        #error configEDF_PRIORITY must be less than configMAX_PRIORITIES.
+    #endif
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+        #error configUSE_EDF_SCHEDULING requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1.
+    #endif
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_EDF_SCHEDULING is not supported when the MPU wrappers are used.
+    #endif
+
+/* Budgets and deadlines are checked on each tick, which the tickless kernel
+ * does not interrupt on. */
+    #if ( configUSE_TICKLESS_KERNEL == 1 )
+        #error configUSE_EDF_SCHEDULING is not supported when configUSE_TICKLESS_KERNEL is set to 1.
+    #endif
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if ( ( configUSE_DEADLINE_MISSED_HOOK == 1 ) && ( configUSE_EDF_SCHEDULING == 0 ) )
+    #error configUSE_DEADLINE_MISSED_HOOK requires configUSE_EDF_SCHEDULING to be set to 1.
 #endif
 
-#ifndef traceENTER_vTaskSetTaskNumber
-    #define traceENTER_vTaskSetTaskNumber( xTask, uxHandle )
+#ifndef configUSE_PERIODIC_TASKS
+    #define configUSE_PERIODIC_TASKS    0
 #endif
 
-#ifndef traceRETURN_vTaskSetTaskNumber
-    #define traceRETURN_vTaskSetTaskNumber()
+#if ( ( configUSE_PERIODIC_TASKS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_PERIODIC_TASKS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceENTER_eTaskConfirmSleepModeStatus
-    #define traceENTER_eTaskConfirmSleepModeStatus()
+#ifndef configUSE_TASK_BUDGETS
+    #define configUSE_TASK_BUDGETS    0
 #endif
 
-#ifndef traceRETURN_eTaskConfirmSleepModeStatus
-    #define traceRETURN_eTaskConfirmSleepModeStatus( eReturn )
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+/* The running task is charged for each tick period, which the tickless kernel
+ * does not interrupt on, and a task that has used up its budget is switched
+ * out by preempting it. */
+    #if ( configUSE_PREEMPTION == 0 )
+        #error configUSE_TASK_BUDGETS requires configUSE_PREEMPTION to be set to 1.
+    #endif
+
+    #if ( configUSE_TICKLESS_KERNEL == 1 )
+        #error configUSE_TASK_BUDGETS is not supported when configUSE_TICKLESS_KERNEL is set to 1.
+    #endif
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_TASK_BUDGETS is not supported when the MPU wrappers are used.
+    #endif
+#endif /* configUSE_TASK_BUDGETS */
+
+#ifndef configUSE_SLEEP_STATES
+    #define configUSE_SLEEP_STATES    0
 #endif
 
-#ifndef traceENTER_vTaskSetThreadLocalStoragePointer
-    #define traceENTER_vTaskSetThreadLocalStoragePointer( xTaskToSet, xIndex, pvValue )
+/* The number of recent idle periods used to predict how long the next idle
+ * period will last. */
+#ifndef configSLEEP_STATE_HISTORY_LENGTH
+    #define configSLEEP_STATE_HISTORY_LENGTH    8U
 #endif
 
-#ifndef traceRETURN_vTaskSetThreadLocalStoragePointer
-    #define traceRETURN_vTaskSetThreadLocalStoragePointer()
+#if ( configUSE_SLEEP_STATES == 1 )
+    #if ( configUSE_TICKLESS_IDLE == 0 )
+        #error configUSE_SLEEP_STATES requires configUSE_TICKLESS_IDLE to be set to a value other than 0.
+    #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_SLEEP_STATES is only supported when configNUMBER_OF_CORES is 1.
+    #endif
+
+    #if ( configSLEEP_STATE_HISTORY_LENGTH < 1 )
+        #error configSLEEP_STATE_HISTORY_LENGTH must be at least 1.
+    #endif
+#endif /* configUSE_SLEEP_STATES */
+
+#ifndef configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING
+    #define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
 #endif
 
-#ifndef traceENTER_pvTaskGetThreadLocalStoragePointer
-    #define traceENTER_pvTaskGetThreadLocalStoragePointer( xTaskToQuery, xIndex )
+#ifndef configPRE_SLEEP_PROCESSING
+    #define configPRE_SLEEP_PROCESSING( x )
 #endif
 
-#ifndef traceRETURN_pvTaskGetThreadLocalStoragePointer
-    #define traceRETURN_pvTaskGetThreadLocalStoragePointer( pvReturn )
+#ifndef configPOST_SLEEP_PROCESSING
+    #define configPOST_SLEEP_PROCESSING( x )
 #endif
 
-#ifndef traceENTER_vTaskAllocateMPURegions
-    #define traceENTER_vTaskAllocateMPURegions( xTaskToModify, pxRegions )
+#ifndef configUSE_QUEUE_SETS
+    #define configUSE_QUEUE_SETS    0
 #endif
 
-#ifndef traceRETURN_vTaskAllocateMPURegions
-    #define traceRETURN_vTaskAllocateMPURegions()
+#ifndef portTASK_USES_FLOATING_POINT
+    #define portTASK_USES_FLOATING_POINT()
 #endif
 
-#ifndef traceENTER_vTaskGetInfo
-    #define traceENTER_vTaskGetInfo( xTask, pxTaskStatus, xGetFreeStackSpace, eState )
+#ifndef portALLOCATE_SECURE_CONTEXT
+    #define portALLOCATE_SECURE_CONTEXT( ulSecureStackSize )
 #endif
 
-#ifndef traceRETURN_vTaskGetInfo
-    #define traceRETURN_vTaskGetInfo()
+#ifndef portDONT_DISCARD
+    #define portDONT_DISCARD
 #endif
 
-#ifndef traceENTER_uxTaskGetStackHighWaterMark2
-    #define traceENTER_uxTaskGetStackHighWaterMark2( xTask )
+#ifndef portCACHE_LINE_ALIGNED
+    #define portCACHE_LINE_ALIGNED
 #endif
 
-#ifndef traceRETURN_uxTaskGetStackHighWaterMark2
-    #define traceRETURN_uxTaskGetStackHighWaterMark2( uxReturn )
+#ifndef configUSE_TIME_SLICING
+    #define configUSE_TIME_SLICING    1
 #endif
 
-#ifndef traceENTER_uxTaskGetStackHighWaterMark
-    #define traceENTER_uxTaskGetStackHighWaterMark( xTask )
+#ifndef configUSE_TASK_TIME_SLICES
+    #define configUSE_TASK_TIME_SLICES    0
 #endif
 
-#ifndef traceRETURN_uxTaskGetStackHighWaterMark
-    #define traceRETURN_uxTaskGetStackHighWaterMark( uxReturn )
+/* The time slice, in ticks, given to each task when it is created. */
+#ifndef configDEFAULT_TIME_SLICE_TICKS
+    #define configDEFAULT_TIME_SLICE_TICKS    1U
 #endif
 
-#ifndef traceENTER_xTaskGetCurrentTaskHandle
-    #define traceENTER_xTaskGetCurrentTaskHandle()
+#if ( configUSE_TASK_TIME_SLICES == 1 )
+    #if ( ( configUSE_PREEMPTION == 0 ) || ( configUSE_TIME_SLICING == 0 ) )
+        #error configUSE_TASK_TIME_SLICES requires configUSE_PREEMPTION and configUSE_TIME_SLICING to be set to 1.
+    #endif
+
+    #if ( configDEFAULT_TIME_SLICE_TICKS == 0 )
+        #error configDEFAULT_TIME_SLICE_TICKS must be at least 1.
+    #endif
+
+    #if ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_TASK_TIME_SLICES is not supported when the MPU wrappers are used.
+    #endif
+#endif /* configUSE_TASK_TIME_SLICES */
+
+#ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
+    #define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS    0
 #endif
 
-#ifndef traceRETURN_xTaskGetCurrentTaskHandle
-    #define traceRETURN_xTaskGetCurrentTaskHandle( xReturn )
+#ifndef configUSE_STATS_FORMATTING_FUNCTIONS
+    #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 #endif
 
-#ifndef traceENTER_xTaskGetCurrentTaskHandleForCore
-    #define traceENTER_xTaskGetCurrentTaskHandleForCore( xCoreID )
+#ifndef portASSERT_IF_INTERRUPT_PRIORITY_INVALID
+    #define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
 #endif
 
-#ifndef traceRETURN_xTaskGetCurrentTaskHandleForCore
-    #define traceRETURN_xTaskGetCurrentTaskHandleForCore( xReturn )
+#ifndef configUSE_TRACE_FACILITY
+    #define configUSE_TRACE_FACILITY    0
 #endif
 
-#ifndef traceENTER_xTaskGetSchedulerState
-    #define traceENTER_xTaskGetSchedulerState()
+#ifndef mtCOVERAGE_TEST_MARKER
+    #define mtCOVERAGE_TEST_MARKER()
 #endif
 
-#ifndef traceRETURN_xTaskGetSchedulerState
-    #define traceRETURN_xTaskGetSchedulerState( xReturn )
+#ifndef mtCOVERAGE_TEST_DELAY
+    #define mtCOVERAGE_TEST_DELAY()
 #endif
 
-#ifndef traceENTER_xTaskPriorityInherit
-    #define traceENTER_xTaskPriorityInherit( pxMutexHolder )
+#ifndef portASSERT_IF_IN_ISR
+    #define portASSERT_IF_IN_ISR()
 #endif
 
-#ifndef traceRETURN_xTaskPriorityInherit
-    #define traceRETURN_xTaskPriorityInherit( xReturn )
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
 #endif
 
-#ifndef traceENTER_xTaskPriorityDisinherit
-    #define traceENTER_xTaskPriorityDisinherit( pxMutexHolder )
+#ifndef configAPPLICATION_ALLOCATED_HEAP
+    #define configAPPLICATION_ALLOCATED_HEAP    0
 #endif
 
-#ifndef traceRETURN_xTaskPriorityDisinherit
-    #define traceRETURN_xTaskPriorityDisinherit( xReturn )
+#ifndef configENABLE_HEAP_PROTECTOR
+    #define configENABLE_HEAP_PROTECTOR    0
 #endif
 
-#ifndef traceENTER_vTaskPriorityDisinheritAfterTimeout
-    #define traceENTER_vTaskPriorityDisinheritAfterTimeout( pxMutexHolder, uxHighestPriorityWaitingTask )
+#ifndef configUSE_PER_CORE_HEAP_ARENAS
+    #define configUSE_PER_CORE_HEAP_ARENAS    0
 #endif
 
-#ifndef traceRETURN_vTaskPriorityDisinheritAfterTimeout
-    #define traceRETURN_vTaskPriorityDisinheritAfterTimeout()
+#ifndef configUSE_TASK_ALLOCATION_CACHE
+    #define configUSE_TASK_ALLOCATION_CACHE    0
 #endif
 
-#ifndef traceENTER_vTaskYieldWithinAPI
-    #define traceENTER_vTaskYieldWithinAPI()
+#ifndef configTASK_ALLOCATION_CACHE_DEPTH
+    #define configTASK_ALLOCATION_CACHE_DEPTH    4
 #endif
 
-#ifndef traceRETURN_vTaskYieldWithinAPI
-    #define traceRETURN_vTaskYieldWithinAPI()
+#if ( ( configUSE_TASK_ALLOCATION_CACHE == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+    #error configUSE_TASK_ALLOCATION_CACHE requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1.
 #endif
 
-#ifndef traceENTER_vTaskEnterCritical
-    #define traceENTER_vTaskEnterCritical()
+#if ( ( configUSE_TASK_ALLOCATION_CACHE == 1 ) && ( ( configTASK_ALLOCATION_CACHE_DEPTH < 1 ) || ( configTASK_ALLOCATION_CACHE_DEPTH > 255 ) ) )
+    #error configTASK_ALLOCATION_CACHE_DEPTH must be between 1 and 255.
 #endif
 
-#ifndef traceRETURN_vTaskEnterCritical
-    #define traceRETURN_vTaskEnterCritical()
+/* The number of size classes held by each task's allocation cache. */
+#define tskALLOCATION_CACHE_SIZE_CLASSES    4U
+
+#ifndef configUSE_TASK_HEAP_QUOTAS
+    #define configUSE_TASK_HEAP_QUOTAS    0
 #endif
 
-#ifndef traceENTER_vTaskEnterCriticalFromISR
-    #define traceENTER_vTaskEnterCriticalFromISR()
+#ifndef configUSE_HEAP_QUOTA_EXCEEDED_HOOK
+    #define configUSE_HEAP_QUOTA_EXCEEDED_HOOK    0
 #endif
 
-#ifndef traceRETURN_vTaskEnterCriticalFromISR
-    #define traceRETURN_vTaskEnterCriticalFromISR( uxSavedInterruptStatus )
+#if ( ( configUSE_TASK_HEAP_QUOTAS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+    #error configUSE_TASK_HEAP_QUOTAS requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1.
 #endif
 
-#ifndef traceENTER_vTaskExitCritical
-    #define traceENTER_vTaskExitCritical()
+#if ( ( configUSE_TASK_HEAP_QUOTAS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_TASK_HEAP_QUOTAS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_vTaskExitCritical
-    #define traceRETURN_vTaskExitCritical()
+#ifndef configUSE_HEAP_PROFILER
+    #define configUSE_HEAP_PROFILER    0
+#endif
+
+#ifndef configHEAP_PROFILER_MAX_TASKS
+    #define configHEAP_PROFILER_MAX_TASKS    8
 #endif
 
-#ifndef traceENTER_vTaskExitCriticalFromISR
-    #define traceENTER_vTaskExitCriticalFromISR( uxSavedInterruptStatus )
+#ifndef configHEAP_PROFILER_CALLER_ADDRESS
+    #define configHEAP_PROFILER_CALLER_ADDRESS()    ( NULL )
 #endif
 
-#ifndef traceRETURN_vTaskExitCriticalFromISR
-    #define traceRETURN_vTaskExitCriticalFromISR()
+#if ( ( configUSE_HEAP_PROFILER == 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle == 0 ) )
+    #error configUSE_HEAP_PROFILER requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1.
 #endif
 
-#ifndef traceENTER_vTaskListTasks
-    #define traceENTER_vTaskListTasks( pcWriteBuffer, uxBufferLength )
+#if ( ( configUSE_HEAP_PROFILER == 1 ) && ( INCLUDE_xTaskGetSchedulerState == 0 ) && ( configUSE_TIMERS == 0 ) )
+    #error configUSE_HEAP_PROFILER requires INCLUDE_xTaskGetSchedulerState or configUSE_TIMERS to be set to 1.
 #endif
 
-#ifndef traceRETURN_vTaskListTasks
-    #define traceRETURN_vTaskListTasks()
+#if ( ( configUSE_HEAP_PROFILER == 1 ) && ( configHEAP_PROFILER_MAX_TASKS < 1 ) )
+    #error configHEAP_PROFILER_MAX_TASKS must be at least 1.
 #endif
 
-#ifndef traceENTER_vTaskGetRunTimeStatistics
-    #define traceENTER_vTaskGetRunTimeStatistics( pcWriteBuffer, uxBufferLength )
+#ifndef configSUPPORT_HEAP_REALLOC
+    #define configSUPPORT_HEAP_REALLOC    0
 #endif
 
-#ifndef traceRETURN_vTaskGetRunTimeStatistics
-    #define traceRETURN_vTaskGetRunTimeStatistics()
+#ifndef configSUPPORT_HEAP_ALIGNED_ALLOCATION
+    #define configSUPPORT_HEAP_ALIGNED_ALLOCATION    0
 #endif
 
-#ifndef traceENTER_uxTaskResetEventItemValue
-    #define traceENTER_uxTaskResetEventItemValue()
+#ifndef configHEAP_2_USE_SIZE_BINS
+    #define configHEAP_2_USE_SIZE_BINS    0
 #endif
 
-#ifndef traceRETURN_uxTaskResetEventItemValue
-    #define traceRETURN_uxTaskResetEventItemValue( uxReturn )
+#ifndef configHEAP_2_SIZE_BINS
+    #define configHEAP_2_SIZE_BINS    32
 #endif
 
-#ifndef traceENTER_pvTaskIncrementMutexHeldCount
-    #define traceENTER_pvTaskIncrementMutexHeldCount()
+#if ( ( configHEAP_2_USE_SIZE_BINS == 1 ) && ( configHEAP_2_SIZE_BINS < 1 ) )
+    #error configHEAP_2_SIZE_BINS must be at least 1.
 #endif
 
-#ifndef traceRETURN_pvTaskIncrementMutexHeldCount
-    #define traceRETURN_pvTaskIncrementMutexHeldCount( pxTCB )
+#ifndef configUSE_HEAP_COMPACTION
+    #define configUSE_HEAP_COMPACTION    0
 #endif
 
-#ifndef traceENTER_ulTaskGenericNotifyTake
-    #define traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait )
+#ifndef configHEAP_MOVABLE_BLOCKS
+    #define configHEAP_MOVABLE_BLOCKS    8
 #endif
 
-#ifndef traceRETURN_ulTaskGenericNotifyTake
-    #define traceRETURN_ulTaskGenericNotifyTake( ulReturn )
+/* The most bytes of movable blocks the idle task moves on each pass of its
+ * loop.  0 leaves compaction to the application. */
+#ifndef configHEAP_COMPACTION_IDLE_BYTES
+    #define configHEAP_COMPACTION_IDLE_BYTES    256
 #endif
 
-#ifndef traceENTER_xTaskGenericNotifyWait
-    #define traceENTER_xTaskGenericNotifyWait( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait )
+#if ( ( configUSE_HEAP_COMPACTION == 1 ) && ( configHEAP_MOVABLE_BLOCKS < 1 ) )
+    #error configHEAP_MOVABLE_BLOCKS must be at least 1.
 #endif
 
-#ifndef traceRETURN_xTaskGenericNotifyWait
-    #define traceRETURN_xTaskGenericNotifyWait( xReturn )
+#ifndef configUSE_HEAP_STARTUP_MODE
+    #define configUSE_HEAP_STARTUP_MODE    0
 #endif
 
-#ifndef traceENTER_xTaskGenericNotify
-    #define traceENTER_xTaskGenericNotify( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue )
+#if ( ( configUSE_HEAP_STARTUP_MODE == 1 ) && ( INCLUDE_xTaskGetSchedulerState == 0 ) && ( configUSE_TIMERS == 0 ) )
+    #error configUSE_HEAP_STARTUP_MODE requires INCLUDE_xTaskGetSchedulerState or configUSE_TIMERS to be set to 1.
 #endif
 
-#ifndef traceRETURN_xTaskGenericNotify
-    #define traceRETURN_xTaskGenericNotify( xReturn )
+#ifndef configHEAP_MAX_REGIONS
+    #define configHEAP_MAX_REGIONS    8
 #endif
 
-#ifndef traceENTER_xTaskGenericNotifyFromISR
-    #define traceENTER_xTaskGenericNotifyFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken )
+#ifndef configTASK_STACK_HEAP_CAPABILITIES
+    #define configTASK_STACK_HEAP_CAPABILITIES    portHEAP_CAPS_NONE
 #endif
 
-#ifndef traceRETURN_xTaskGenericNotifyFromISR
-    #define traceRETURN_xTaskGenericNotifyFromISR( xReturn )
+#ifndef configTASK_TCB_HEAP_CAPABILITIES
+    #define configTASK_TCB_HEAP_CAPABILITIES    portHEAP_CAPS_NONE
 #endif
 
-#ifndef traceENTER_vTaskGenericNotifyGiveFromISR
-    #define traceENTER_vTaskGenericNotifyGiveFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken )
+#if ( ( configUSE_HEAP_REGION_CAPABILITIES == 1 ) && ( configHEAP_MAX_REGIONS < 1 ) )
+    #error configHEAP_MAX_REGIONS must be at least 1.
 #endif
 
-#ifndef traceRETURN_vTaskGenericNotifyGiveFromISR
-    #define traceRETURN_vTaskGenericNotifyGiveFromISR()
+#ifndef configHEAP_ALLOCATION_POLICY
+    #define configHEAP_ALLOCATION_POLICY    HEAP_POLICY_FIRST_FIT
 #endif
 
-#ifndef traceENTER_xTaskGenericNotifyStateClear
-    #define traceENTER_xTaskGenericNotifyStateClear( xTask, uxIndexToClear )
+#if ( ( configHEAP_ALLOCATION_POLICY != HEAP_POLICY_FIRST_FIT ) && \
+    ( configHEAP_ALLOCATION_POLICY != HEAP_POLICY_BEST_FIT ) &&    \
+    ( configHEAP_ALLOCATION_POLICY != HEAP_POLICY_NEXT_FIT ) )
+    #error configHEAP_ALLOCATION_POLICY must be set to HEAP_POLICY_FIRST_FIT, HEAP_POLICY_BEST_FIT or HEAP_POLICY_NEXT_FIT.
 #endif
 
-#ifndef traceRETURN_xTaskGenericNotifyStateClear
-    #define traceRETURN_xTaskGenericNotifyStateClear( xReturn )
+#if ( ( configUSE_PER_CORE_HEAP_ARENAS == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+    #error configUSE_PER_CORE_HEAP_ARENAS is only supported when configNUMBER_OF_CORES is greater than 1.
 #endif
 
-#ifndef traceENTER_ulTaskGenericNotifyValueClear
-    #define traceENTER_ulTaskGenericNotifyValueClear( xTask, uxIndexToClear, ulBitsToClear )
+/* Each arena is protected by its own spinlock, and blocks freed on another
+ * core are handed back to their arena by compare and swap. */
+#if ( ( configUSE_PER_CORE_HEAP_ARENAS == 1 ) && ( configUSE_GRANULAR_LOCKS != 1 ) )
+    #error configUSE_PER_CORE_HEAP_ARENAS requires configUSE_GRANULAR_LOCKS to be set to 1.
 #endif
 
-#ifndef traceRETURN_ulTaskGenericNotifyValueClear
-    #define traceRETURN_ulTaskGenericNotifyValueClear( ulReturn )
+#if ( ( configUSE_PER_CORE_HEAP_ARENAS == 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) )
+    #error configUSE_PER_CORE_HEAP_ARENAS requires the port to define portATOMIC_COMPARE_AND_SWAP_U32.
 #endif
 
-#ifndef traceENTER_ulTaskGetRunTimeCounter
-    #define traceENTER_ulTaskGetRunTimeCounter( xTask )
+#ifndef configUSE_TASK_NOTIFICATIONS
+    #define configUSE_TASK_NOTIFICATIONS    1
 #endif
 
-#ifndef traceRETURN_ulTaskGetRunTimeCounter
-    #define traceRETURN_ulTaskGetRunTimeCounter( ulRunTimeCounter )
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+    #define configTASK_NOTIFICATION_ARRAY_ENTRIES    1
 #endif
 
-#ifndef traceENTER_ulTaskGetRunTimePercent
-    #define traceENTER_ulTaskGetRunTimePercent( xTask )
+#if configTASK_NOTIFICATION_ARRAY_ENTRIES < 1
+    #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
 #endif
 
-#ifndef traceRETURN_ulTaskGetRunTimePercent
-    #define traceRETURN_ulTaskGetRunTimePercent( ulReturn )
+#ifndef configTASK_NOTIFY_MAILBOX_DEPTH
+    #define configTASK_NOTIFY_MAILBOX_DEPTH    0
 #endif
 
-#ifndef traceENTER_ulTaskGetIdleRunTimeCounter
-    #define traceENTER_ulTaskGetIdleRunTimeCounter()
+/* The task notification that counts the messages in a task's mailbox.  The
+ * last index is used by default, so an application that uses the default index
+ * for its own notifications can set configTASK_NOTIFICATION_ARRAY_ENTRIES to
+ * 2. */
+#ifndef configTASK_NOTIFY_MAILBOX_INDEX
+    #define configTASK_NOTIFY_MAILBOX_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
 #endif
 
-#ifndef traceRETURN_ulTaskGetIdleRunTimeCounter
-    #define traceRETURN_ulTaskGetIdleRunTimeCounter( ulReturn )
+#if ( ( configTASK_NOTIFY_MAILBOX_DEPTH > 0 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configTASK_NOTIFY_MAILBOX_DEPTH requires configUSE_TASK_NOTIFICATIONS to be set to 1.
 #endif
 
-#ifndef traceENTER_ulTaskGetIdleRunTimePercent
-    #define traceENTER_ulTaskGetIdleRunTimePercent()
+#if ( ( configTASK_NOTIFY_MAILBOX_DEPTH > 0 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error Task notification mailboxes are not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_ulTaskGetIdleRunTimePercent
-    #define traceRETURN_ulTaskGetIdleRunTimePercent( ulReturn )
+#ifndef configUSE_TASK_GROUPS
+    #define configUSE_TASK_GROUPS    0
 #endif
 
-#ifndef traceENTER_xTaskGetMPUSettings
-    #define traceENTER_xTaskGetMPUSettings( xTask )
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_TASK_GROUPS requires configUSE_TASK_NOTIFICATIONS to be set to 1.
 #endif
 
-#ifndef traceRETURN_xTaskGetMPUSettings
-    #define traceRETURN_xTaskGetMPUSettings( xMPUSettings )
+#if ( ( configUSE_TASK_GROUPS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error Task groups are not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceENTER_xStreamBufferGenericCreate
-    #define traceENTER_xStreamBufferGenericCreate( xBufferSizeBytes, xTriggerLevelBytes, xStreamBufferType, pxSendCompletedCallback, pxReceiveCompletedCallback )
+#ifndef configUSE_PER_TASK_NOTIFICATION_ENTRIES
+    #define configUSE_PER_TASK_NOTIFICATION_ENTRIES    0
 #endif
 
-#ifndef traceRETURN_xStreamBufferGenericCreate
-    #define traceRETURN_xStreamBufferGenericCreate( pvAllocatedMemory )
+#if ( ( configUSE_PER_TASK_NOTIFICATION_ENTRIES == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_PER_TASK_NOTIFICATION_ENTRIES requires configUSE_TASK_NOTIFICATIONS to be set to 1.
 #endif
 
-#ifndef traceENTER_xStreamBufferGenericCreateStatic
-    #define traceENTER_xStreamBufferGenericCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, xStreamBufferType, pucStreamBufferStorageArea, pxStaticStreamBuffer, pxSendCompletedCallback, pxReceiveCompletedCallback )
+#if ( ( configUSE_PER_TASK_NOTIFICATION_ENTRIES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_PER_TASK_NOTIFICATION_ENTRIES is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_xStreamBufferGenericCreateStatic
-    #define traceRETURN_xStreamBufferGenericCreateStatic( xReturn )
+#if ( ( configUSE_QUEUE_SET_READY_BITMAP == 1 ) && ( configUSE_QUEUE_SETS != 1 ) )
+    #error configUSE_QUEUE_SET_READY_BITMAP requires configUSE_QUEUE_SETS to be set to 1.
 #endif
 
-#ifndef traceENTER_xStreamBufferGetStaticBuffers
-    #define traceENTER_xStreamBufferGetStaticBuffers( xStreamBuffer, ppucStreamBufferStorageArea, ppxStaticStreamBuffer )
+#if ( ( configUSE_QUEUE_WAIT_FOR_ANY == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_QUEUE_WAIT_FOR_ANY requires configUSE_TASK_NOTIFICATIONS to be set to 1.
 #endif
 
-#ifndef traceRETURN_xStreamBufferGetStaticBuffers
-    #define traceRETURN_xStreamBufferGetStaticBuffers( xReturn )
+#ifndef configUSE_POSIX_ERRNO
+    #define configUSE_POSIX_ERRNO    0
 #endif
 
-#ifndef traceENTER_vStreamBufferDelete
-    #define traceENTER_vStreamBufferDelete( xStreamBuffer )
+#ifndef configUSE_SB_COMPLETED_CALLBACK
+
+/* By default per-instance callbacks are not enabled for stream buffer or message buffer. */
+    #define configUSE_SB_COMPLETED_CALLBACK    0
 #endif
 
-#ifndef traceRETURN_vStreamBufferDelete
-    #define traceRETURN_vStreamBufferDelete()
+#ifndef portTICK_TYPE_IS_ATOMIC
+    #define portTICK_TYPE_IS_ATOMIC    0
 #endif
 
-#ifndef traceENTER_xStreamBufferReset
-    #define traceENTER_xStreamBufferReset( xStreamBuffer )
+#ifndef configSUPPORT_STATIC_ALLOCATION
+    /* Defaults to 0 for backward compatibility. */
+    #define configSUPPORT_STATIC_ALLOCATION    0
 #endif
 
-#ifndef traceRETURN_xStreamBufferReset
-    #define traceRETURN_xStreamBufferReset( xReturn )
+#ifndef configKERNEL_PROVIDED_STATIC_MEMORY
+    #define configKERNEL_PROVIDED_STATIC_MEMORY    0
 #endif
 
-#ifndef traceENTER_xStreamBufferResetFromISR
-    #define traceENTER_xStreamBufferResetFromISR( xStreamBuffer )
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
+    /* Defaults to 1 for backward compatibility. */
+    #define configSUPPORT_DYNAMIC_ALLOCATION    1
 #endif
 
-#ifndef traceRETURN_xStreamBufferResetFromISR
-    #define traceRETURN_xStreamBufferResetFromISR( xReturn )
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+    #if ( ( configUSE_TRACE_FACILITY != 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+        #error configUSE_STATS_FORMATTING_FUNCTIONS is 1 but the functions it enables are not used because neither configUSE_TRACE_FACILITY or configGENERATE_RUN_TIME_STATS are 1.  Set configUSE_STATS_FORMATTING_FUNCTIONS to 0 in FreeRTOSConfig.h.
+    #endif
 #endif
 
-#ifndef traceENTER_xStreamBufferSetTriggerLevel
-    #define traceENTER_xStreamBufferSetTriggerLevel( xStreamBuffer, xTriggerLevel )
+#ifndef configSTATS_BUFFER_MAX_LENGTH
+    #define configSTATS_BUFFER_MAX_LENGTH    0xFFFF
 #endif
 
-#ifndef traceRETURN_xStreamBufferSetTriggerLevel
-    #define traceRETURN_xStreamBufferSetTriggerLevel( xReturn )
+#ifndef configSTACK_DEPTH_TYPE
+
+/* Defaults to StackType_t for backward compatibility, but can be overridden
+ * in FreeRTOSConfig.h if StackType_t is too restrictive. */
+    #define configSTACK_DEPTH_TYPE    StackType_t
 #endif
 
-#ifndef traceENTER_xStreamBufferSpacesAvailable
-    #define traceENTER_xStreamBufferSpacesAvailable( xStreamBuffer )
+#ifndef configRUN_TIME_COUNTER_TYPE
+
+/* Defaults to uint32_t for backward compatibility, but can be overridden in
+ * FreeRTOSConfig.h if uint32_t is too restrictive. */
+
+    #define configRUN_TIME_COUNTER_TYPE    uint32_t
 #endif
 
-#ifndef traceRETURN_xStreamBufferSpacesAvailable
-    #define traceRETURN_xStreamBufferSpacesAvailable( xSpace )
+#ifndef configMESSAGE_BUFFER_LENGTH_TYPE
+
+/* Defaults to size_t for backward compatibility, but can be overridden
+ * in FreeRTOSConfig.h if lengths will always be less than the number of bytes
+ * in a size_t. */
+    #define configMESSAGE_BUFFER_LENGTH_TYPE    size_t
 #endif
 
-#ifndef traceENTER_xStreamBufferBytesAvailable
-    #define traceENTER_xStreamBufferBytesAvailable( xStreamBuffer )
+#ifndef configUSE_MESSAGE_BUFFER_VARINT_LENGTHS
+    #define configUSE_MESSAGE_BUFFER_VARINT_LENGTHS    0
 #endif
 
-#ifndef traceRETURN_xStreamBufferBytesAvailable
-    #define traceRETURN_xStreamBufferBytesAvailable( xReturn )
+#ifndef configUSE_MESSAGE_BUFFER_BATCH_RECEIVE
+    #define configUSE_MESSAGE_BUFFER_BATCH_RECEIVE    0
 #endif
 
-#ifndef traceENTER_xStreamBufferSend
-    #define traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait )
+#if ( ( configUSE_MESSAGE_BUFFER_BATCH_RECEIVE == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_MESSAGE_BUFFER_BATCH_RECEIVE is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_xStreamBufferSend
-    #define traceRETURN_xStreamBufferSend( xReturn )
+#ifndef configUSE_MULTI_PRODUCER_STREAM_BUFFERS
+    #define configUSE_MULTI_PRODUCER_STREAM_BUFFERS    0
 #endif
 
-#ifndef traceENTER_xStreamBufferSendFromISR
-    #define traceENTER_xStreamBufferSendFromISR( xStreamBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken )
+#if ( ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_MULTI_PRODUCER_STREAM_BUFFERS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_xStreamBufferSendFromISR
-    #define traceRETURN_xStreamBufferSendFromISR( xReturn )
+#if ( ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) )
+    #error configUSE_MULTI_PRODUCER_STREAM_BUFFERS requires the port to define portATOMIC_COMPARE_AND_SWAP_U32.
 #endif
 
-#ifndef traceENTER_xStreamBufferReceive
-    #define traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait )
+#ifndef configUSE_OBJECT_POOLS
+    #define configUSE_OBJECT_POOLS    0
 #endif
 
-#ifndef traceRETURN_xStreamBufferReceive
-    #define traceRETURN_xStreamBufferReceive( xReceivedLength )
+#ifndef configKERNEL_OBJECT_POOLS
+    #define configKERNEL_OBJECT_POOLS    0
 #endif
 
-#ifndef traceENTER_xStreamBufferNextMessageLengthBytes
-    #define traceENTER_xStreamBufferNextMessageLengthBytes( xStreamBuffer )
+#if ( ( configUSE_OBJECT_POOLS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_OBJECT_POOLS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_xStreamBufferNextMessageLengthBytes
-    #define traceRETURN_xStreamBufferNextMessageLengthBytes( xReturn )
+#if ( ( configKERNEL_OBJECT_POOLS == 1 ) && ( ( configUSE_OBJECT_POOLS != 1 ) || ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) ) )
+    #error configKERNEL_OBJECT_POOLS requires configUSE_OBJECT_POOLS and configSUPPORT_DYNAMIC_ALLOCATION to be set to 1.
 #endif
 
-#ifndef traceENTER_xStreamBufferReceiveFromISR
-    #define traceENTER_xStreamBufferReceiveFromISR( xStreamBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
+#ifndef configUSE_LOCK_FREE_POOLS
+    #define configUSE_LOCK_FREE_POOLS    0
 #endif
 
-#ifndef traceRETURN_xStreamBufferReceiveFromISR
-    #define traceRETURN_xStreamBufferReceiveFromISR( xReceivedLength )
+#if ( ( configUSE_LOCK_FREE_POOLS == 1 ) && ( configUSE_OBJECT_POOLS != 1 ) )
+    #error configUSE_LOCK_FREE_POOLS requires configUSE_OBJECT_POOLS to be set to 1.
 #endif
 
-#ifndef traceENTER_xStreamBufferIsEmpty
-    #define traceENTER_xStreamBufferIsEmpty( xStreamBuffer )
+#if ( ( configUSE_LOCK_FREE_POOLS == 1 ) && ( configNUMBER_OF_CORES > 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) )
+    #error configUSE_LOCK_FREE_POOLS requires the port to define portATOMIC_COMPARE_AND_SWAP_U32 when configNUMBER_OF_CORES is greater than 1.
 #endif
 
-#ifndef traceRETURN_xStreamBufferIsEmpty
-    #define traceRETURN_xStreamBufferIsEmpty( xReturn )
+#ifndef configUSE_ISR_HEAP
+    #define configUSE_ISR_HEAP    0
 #endif
 
-#ifndef traceENTER_xStreamBufferIsFull
-    #define traceENTER_xStreamBufferIsFull( xStreamBuffer )
+#ifndef configISR_HEAP_MAX_POOLS
+    #define configISR_HEAP_MAX_POOLS    4
 #endif
 
-#ifndef traceRETURN_xStreamBufferIsFull
-    #define traceRETURN_xStreamBufferIsFull( xReturn )
+#if ( ( configUSE_ISR_HEAP == 1 ) && ( configUSE_OBJECT_POOLS != 1 ) )
+    #error configUSE_ISR_HEAP requires configUSE_OBJECT_POOLS to be set to 1.
 #endif
 
-#ifndef traceENTER_xStreamBufferSendCompletedFromISR
-    #define traceENTER_xStreamBufferSendCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken )
+#if ( ( configUSE_ISR_HEAP == 1 ) && ( configISR_HEAP_MAX_POOLS < 1 ) )
+    #error configISR_HEAP_MAX_POOLS must be at least 1 when configUSE_ISR_HEAP is set to 1.
 #endif
 
-#ifndef traceRETURN_xStreamBufferSendCompletedFromISR
-    #define traceRETURN_xStreamBufferSendCompletedFromISR( xReturn )
+#ifndef configUSE_LIGHT_MUTEXES
+    #define configUSE_LIGHT_MUTEXES    0
 #endif
 
-#ifndef traceENTER_xStreamBufferReceiveCompletedFromISR
-    #define traceENTER_xStreamBufferReceiveCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken )
+#if ( ( configUSE_LIGHT_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_LIGHT_MUTEXES requires configUSE_MUTEXES to be set to 1.
 #endif
 
-#ifndef traceRETURN_xStreamBufferReceiveCompletedFromISR
-    #define traceRETURN_xStreamBufferReceiveCompletedFromISR( xReturn )
+#if ( ( configUSE_LIGHT_MUTEXES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_LIGHT_MUTEXES is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceENTER_uxStreamBufferGetStreamBufferNotificationIndex
-    #define traceENTER_uxStreamBufferGetStreamBufferNotificationIndex( xStreamBuffer )
+#ifndef configHEAP_3_USE_LIBC_MALLOC_LOCK
+    #define configHEAP_3_USE_LIBC_MALLOC_LOCK    0
 #endif
 
-#ifndef traceRETURN_uxStreamBufferGetStreamBufferNotificationIndex
-    #define traceRETURN_uxStreamBufferGetStreamBufferNotificationIndex( uxNotificationIndex )
+#if ( ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 1 ) && ( ( configUSE_LIGHT_MUTEXES != 1 ) || ( configUSE_RECURSIVE_MUTEXES != 1 ) ) )
+    #error configHEAP_3_USE_LIBC_MALLOC_LOCK requires configUSE_LIGHT_MUTEXES and configUSE_RECURSIVE_MUTEXES to be set to 1.
 #endif
 
-#ifndef traceENTER_vStreamBufferSetStreamBufferNotificationIndex
-    #define traceENTER_vStreamBufferSetStreamBufferNotificationIndex( xStreamBuffer, uxNotificationIndex )
+#if ( ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 1 ) && ( INCLUDE_xTaskGetSchedulerState == 0 ) && ( configUSE_TIMERS == 0 ) )
+    #error configHEAP_3_USE_LIBC_MALLOC_LOCK requires INCLUDE_xTaskGetSchedulerState or configUSE_TIMERS to be set to 1.
 #endif
 
-#ifndef traceRETURN_vStreamBufferSetStreamBufferNotificationIndex
-    #define traceRETURN_vStreamBufferSetStreamBufferNotificationIndex()
+#if ( ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle == 0 ) )
+    #error configHEAP_3_USE_LIBC_MALLOC_LOCK requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1.
 #endif
 
-#ifndef traceENTER_uxStreamBufferGetStreamBufferNumber
-    #define traceENTER_uxStreamBufferGetStreamBufferNumber( xStreamBuffer )
+#ifndef configUSE_RW_LOCKS
+    #define configUSE_RW_LOCKS    0
 #endif
 
-#ifndef traceRETURN_uxStreamBufferGetStreamBufferNumber
-    #define traceRETURN_uxStreamBufferGetStreamBufferNumber( uxStreamBufferNumber )
+#ifndef configUSE_TRANSITIVE_PRIORITY_INHERITANCE
+    #define configUSE_TRANSITIVE_PRIORITY_INHERITANCE    0
 #endif
 
-#ifndef traceENTER_vStreamBufferSetStreamBufferNumber
-    #define traceENTER_vStreamBufferSetStreamBufferNumber( xStreamBuffer, uxStreamBufferNumber )
+#if ( ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_TRANSITIVE_PRIORITY_INHERITANCE requires configUSE_MUTEXES to be set to 1.
 #endif
 
-#ifndef traceRETURN_vStreamBufferSetStreamBufferNumber
-    #define traceRETURN_vStreamBufferSetStreamBufferNumber()
+#if ( ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 ) && ( configUSE_GRANULAR_LOCKS == 1 ) )
+    #error configUSE_TRANSITIVE_PRIORITY_INHERITANCE cannot be used with configUSE_GRANULAR_LOCKS as the chain of mutex holders is walked under the kernel critical section.
 #endif
 
-#ifndef traceENTER_ucStreamBufferGetStreamBufferType
-    #define traceENTER_ucStreamBufferGetStreamBufferType( xStreamBuffer )
+#ifndef configUSE_MUTEX_PRIORITY_CEILING
+    #define configUSE_MUTEX_PRIORITY_CEILING    0
 #endif
 
-#ifndef traceRETURN_ucStreamBufferGetStreamBufferType
-    #define traceRETURN_ucStreamBufferGetStreamBufferType( ucStreamBufferType )
+#if ( ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEX_PRIORITY_CEILING requires configUSE_MUTEXES to be set to 1.
 #endif
 
-#ifndef traceENTER_vListInitialise
-    #define traceENTER_vListInitialise( pxList )
+#if ( ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_MUTEX_PRIORITY_CEILING is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_vListInitialise
-    #define traceRETURN_vListInitialise()
+#if ( ( configUSE_RW_LOCKS == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_RW_LOCKS requires configUSE_MUTEXES to be set to 1.
 #endif
 
-#ifndef traceENTER_vListInitialiseItem
-    #define traceENTER_vListInitialiseItem( pxItem )
+#if ( ( configUSE_RW_LOCKS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_RW_LOCKS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_vListInitialiseItem
-    #define traceRETURN_vListInitialiseItem()
+#ifndef configUSE_BARRIERS
+    #define configUSE_BARRIERS    0
 #endif
 
-#ifndef traceENTER_vListInsertEnd
-    #define traceENTER_vListInsertEnd( pxList, pxNewListItem )
+#if ( ( configUSE_BARRIERS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_BARRIERS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_vListInsertEnd
-    #define traceRETURN_vListInsertEnd()
+#if ( ( configUSE_BARRIERS == 1 ) && ( configNUMBER_OF_CORES > 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) )
+    #error configUSE_BARRIERS requires the port to define portATOMIC_COMPARE_AND_SWAP_U32 when configNUMBER_OF_CORES is greater than 1.
 #endif
 
-#ifndef traceENTER_vListInsert
-    #define traceENTER_vListInsert( pxList, pxNewListItem )
+#ifndef configUSE_CONDITION_VARIABLES
+    #define configUSE_CONDITION_VARIABLES    0
 #endif
 
-#ifndef traceRETURN_vListInsert
-    #define traceRETURN_vListInsert()
+#if ( ( configUSE_CONDITION_VARIABLES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_CONDITION_VARIABLES requires configUSE_MUTEXES to be set to 1.
 #endif
 
-#ifndef traceENTER_uxListRemove
-    #define traceENTER_uxListRemove( pxItemToRemove )
+#if ( ( configUSE_CONDITION_VARIABLES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_CONDITION_VARIABLES is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_uxListRemove
-    #define traceRETURN_uxListRemove( uxNumberOfItems )
+#ifndef configUSE_TASK_WAIT_ON_ADDRESS
+    #define configUSE_TASK_WAIT_ON_ADDRESS    0
 #endif
 
-#ifndef traceENTER_xCoRoutineCreate
-    #define traceENTER_xCoRoutineCreate( pxCoRoutineCode, uxPriority, uxIndex )
+#ifndef configTASK_WAIT_ADDRESS_LISTS
+    #define configTASK_WAIT_ADDRESS_LISTS    8
 #endif
 
-#ifndef traceRETURN_xCoRoutineCreate
-    #define traceRETURN_xCoRoutineCreate( xReturn )
+#if ( ( configUSE_TASK_WAIT_ON_ADDRESS == 1 ) && ( configTASK_WAIT_ADDRESS_LISTS < 1 ) )
+    #error configTASK_WAIT_ADDRESS_LISTS must be at least 1.
 #endif
 
-#ifndef traceENTER_vCoRoutineAddToDelayedList
-    #define traceENTER_vCoRoutineAddToDelayedList( xTicksToDelay, pxEventList )
+#if ( ( configUSE_TASK_WAIT_ON_ADDRESS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_TASK_WAIT_ON_ADDRESS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef traceRETURN_vCoRoutineAddToDelayedList
-    #define traceRETURN_vCoRoutineAddToDelayedList()
+#if ( ( configUSE_TASK_WAIT_ON_ADDRESS == 1 ) && ( configUSE_GRANULAR_LOCKS == 1 ) )
+    #error configUSE_TASK_WAIT_ON_ADDRESS cannot be used with configUSE_GRANULAR_LOCKS as the address wait lists are only protected by suspending the scheduler.
 #endif
 
-#ifndef traceENTER_vCoRoutineSchedule
-    #define traceENTER_vCoRoutineSchedule()
+#ifndef configUSE_EVENT_HANDLERS
+    #define configUSE_EVENT_HANDLERS    0
 #endif
 
-#ifndef traceRETURN_vCoRoutineSchedule
-    #define traceRETURN_vCoRoutineSchedule()
+#ifndef configEVENT_HANDLER_STACK_DEPTH
+    #define configEVENT_HANDLER_STACK_DEPTH    configMINIMAL_STACK_SIZE
 #endif
 
-#ifndef traceENTER_xCoRoutineRemoveFromEventList
-    #define traceENTER_xCoRoutineRemoveFromEventList( pxEventList )
+#if ( ( configUSE_EVENT_HANDLERS == 1 ) && ( ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) || ( configUSE_TASK_NOTIFICATIONS != 1 ) ) )
+    #error configUSE_EVENT_HANDLERS requires configSUPPORT_DYNAMIC_ALLOCATION and configUSE_TASK_NOTIFICATIONS to be set to 1.
 #endif
 
-#ifndef traceRETURN_xCoRoutineRemoveFromEventList
-    #define traceRETURN_xCoRoutineRemoveFromEventList( xReturn )
+#if ( ( configUSE_EVENT_HANDLERS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_EVENT_HANDLERS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef configGENERATE_RUN_TIME_STATS
-    #define configGENERATE_RUN_TIME_STATS    0
+#ifndef configUSE_SOFTIRQS
+    #define configUSE_SOFTIRQS    0
 #endif
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
+#ifndef configSOFTIRQ_COUNT
+    #define configSOFTIRQ_COUNT    8
+#endif
 
-    #ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
-        #error If configGENERATE_RUN_TIME_STATS is defined then portCONFIGURE_TIMER_FOR_RUN_TIME_STATS must also be defined.  portCONFIGURE_TIMER_FOR_RUN_TIME_STATS should call a port layer function to setup a peripheral timer/counter that can then be used as the run time counter time base.
-    #endif /* portCONFIGURE_TIMER_FOR_RUN_TIME_STATS */
+#ifndef configSOFTIRQ_TASK_PRIORITY
+    #define configSOFTIRQ_TASK_PRIORITY    ( configMAX_PRIORITIES - 1 )
+#endif
 
-    #ifndef portGET_RUN_TIME_COUNTER_VALUE
-        #ifndef portALT_GET_RUN_TIME_COUNTER_VALUE
-            #error If configGENERATE_RUN_TIME_STATS is defined then either portGET_RUN_TIME_COUNTER_VALUE or portALT_GET_RUN_TIME_COUNTER_VALUE must also be defined.  See the examples provided and the FreeRTOS web site for more information.
-        #endif /* portALT_GET_RUN_TIME_COUNTER_VALUE */
-    #endif /* portGET_RUN_TIME_COUNTER_VALUE */
+#ifndef configSOFTIRQ_TASK_STACK_DEPTH
+    #define configSOFTIRQ_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#endif
 
-#endif /* configGENERATE_RUN_TIME_STATS */
+#if ( ( configUSE_SOFTIRQS == 1 ) && ( ( configSOFTIRQ_COUNT < 1 ) || ( configSOFTIRQ_COUNT > 32 ) ) )
+    #error configSOFTIRQ_COUNT must be between 1 and 32.
+#endif
 
-#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
-    #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#if ( ( configUSE_SOFTIRQS == 1 ) && ( ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) || ( configUSE_TASK_NOTIFICATIONS != 1 ) ) )
+    #error configUSE_SOFTIRQS requires configSUPPORT_DYNAMIC_ALLOCATION and configUSE_TASK_NOTIFICATIONS to be set to 1.
 #endif
 
-#ifndef portPRIVILEGE_BIT
-    #define portPRIVILEGE_BIT    ( ( UBaseType_t ) 0x00 )
+#if ( ( configUSE_SOFTIRQS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_SOFTIRQS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef portYIELD_WITHIN_API
-    #define portYIELD_WITHIN_API    portYIELD
+#ifndef configUSE_COMPLETIONS
+    #define configUSE_COMPLETIONS    0
 #endif
 
-#ifndef portSUPPRESS_TICKS_AND_SLEEP
-    #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )
+#ifndef configCOMPLETION_NOTIFY_INDEX
+    #define configCOMPLETION_NOTIFY_INDEX    ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
 #endif
 
-#ifndef configEXPECTED_IDLE_TIME_BEFORE_SLEEP
-    #define configEXPECTED_IDLE_TIME_BEFORE_SLEEP    2
+#if ( ( configUSE_COMPLETIONS == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+    #error configUSE_COMPLETIONS requires configUSE_TASK_NOTIFICATIONS to be set to 1.
 #endif
 
-#if configEXPECTED_IDLE_TIME_BEFORE_SLEEP < 2
-    #error configEXPECTED_IDLE_TIME_BEFORE_SLEEP must not be less than 2
+#if ( ( configUSE_COMPLETIONS == 1 ) && ( configCOMPLETION_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES ) )
+    #error configCOMPLETION_NOTIFY_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES.
 #endif
 
-#ifndef configUSE_TICKLESS_IDLE
-    #define configUSE_TICKLESS_IDLE    0
+#if ( ( configUSE_COMPLETIONS == 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_RECURSIVE_MUTEXES != 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+    #error configUSE_COMPLETIONS requires INCLUDE_xTaskGetCurrentTaskHandle to be set to 1.
 #endif
 
-#ifndef configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING
-    #define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
+#if ( ( configUSE_COMPLETIONS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_COMPLETIONS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef configPRE_SLEEP_PROCESSING
-    #define configPRE_SLEEP_PROCESSING( x )
+#ifndef configUSE_DEFERRED_LOG
+    #define configUSE_DEFERRED_LOG    0
 #endif
 
-#ifndef configPOST_SLEEP_PROCESSING
-    #define configPOST_SLEEP_PROCESSING( x )
+#ifndef configDEFERRED_LOG_BUFFER_SIZE
+    #define configDEFERRED_LOG_BUFFER_SIZE    1024
 #endif
 
-#ifndef configUSE_QUEUE_SETS
-    #define configUSE_QUEUE_SETS    0
+#ifndef configDEFERRED_LOG_MAX_ARGUMENTS
+    #define configDEFERRED_LOG_MAX_ARGUMENTS    4
 #endif
 
-#ifndef portTASK_USES_FLOATING_POINT
-    #define portTASK_USES_FLOATING_POINT()
+/* The timestamp recorded with each deferred log message.  Can be defined to
+ * read a free running hardware counter for finer resolution. */
+#ifndef configDEFERRED_LOG_TIMESTAMP
+    #define configDEFERRED_LOG_TIMESTAMP()    xTaskGetTickCountFromISR()
 #endif
 
-#ifndef portALLOCATE_SECURE_CONTEXT
-    #define portALLOCATE_SECURE_CONTEXT( ulSecureStackSize )
+#if ( ( configUSE_DEFERRED_LOG == 1 ) && ( ( configSUPPORT_STATIC_ALLOCATION != 1 ) || ( configUSE_STREAM_BUFFERS != 1 ) ) )
+    #error configUSE_DEFERRED_LOG requires configSUPPORT_STATIC_ALLOCATION and configUSE_STREAM_BUFFERS to be set to 1.
 #endif
 
-#ifndef portDONT_DISCARD
-    #define portDONT_DISCARD
+#if ( ( configUSE_DEFERRED_LOG == 1 ) && ( ( configDEFERRED_LOG_MAX_ARGUMENTS < 1 ) || ( configDEFERRED_LOG_MAX_ARGUMENTS > 6 ) ) )
+    #error configDEFERRED_LOG_MAX_ARGUMENTS must be between 1 and 6.
 #endif
 
-#ifndef configUSE_TIME_SLICING
-    #define configUSE_TIME_SLICING    1
+#if ( ( configUSE_DEFERRED_LOG == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_DEFERRED_LOG is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
-    #define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS    0
+#ifndef configUSE_AMP_MESSAGE_BUFFERS
+    #define configUSE_AMP_MESSAGE_BUFFERS    0
 #endif
 
-#ifndef configUSE_STATS_FORMATTING_FUNCTIONS
-    #define configUSE_STATS_FORMATTING_FUNCTIONS    0
+/* Orders memory accesses as seen by the other processor of an AMP message
+ * channel.  portMEMORY_BARRIER() is only a compiler barrier on most ports, so
+ * should be replaced with a hardware barrier, such as DMB on Cortex-M, if the
+ * shared memory can be buffered or reordered. */
+#ifndef configAMP_MEMORY_BARRIER
+    #define configAMP_MEMORY_BARRIER()    portMEMORY_BARRIER()
 #endif
 
-#ifndef portASSERT_IF_INTERRUPT_PRIORITY_INVALID
-    #define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
+#if ( ( configUSE_AMP_MESSAGE_BUFFERS == 1 ) && ( ( configSUPPORT_STATIC_ALLOCATION != 1 ) || ( configUSE_STREAM_BUFFERS != 1 ) ) )
+    #error configUSE_AMP_MESSAGE_BUFFERS requires configSUPPORT_STATIC_ALLOCATION and configUSE_STREAM_BUFFERS to be set to 1.
 #endif
 
-#ifndef configUSE_TRACE_FACILITY
-    #define configUSE_TRACE_FACILITY    0
+#if ( ( configUSE_AMP_MESSAGE_BUFFERS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_AMP_MESSAGE_BUFFERS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef mtCOVERAGE_TEST_MARKER
-    #define mtCOVERAGE_TEST_MARKER()
+#ifndef configUSE_ASYNC_TASKS
+    #define configUSE_ASYNC_TASKS    0
 #endif
 
-#ifndef mtCOVERAGE_TEST_DELAY
-    #define mtCOVERAGE_TEST_DELAY()
+#if ( ( configUSE_ASYNC_TASKS == 1 ) && ( configUSE_EVENT_HANDLERS != 1 ) )
+    #error configUSE_ASYNC_TASKS requires configUSE_EVENT_HANDLERS to be set to 1.
 #endif
 
-#ifndef portASSERT_IF_IN_ISR
-    #define portASSERT_IF_IN_ISR()
+#ifndef configUSE_TASK_POOLS
+    #define configUSE_TASK_POOLS    0
 #endif
 
-#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
-    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#if ( ( configUSE_TASK_POOLS == 1 ) && ( ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) || ( configUSE_TASK_NOTIFICATIONS != 1 ) ) )
+    #error configUSE_TASK_POOLS requires configSUPPORT_DYNAMIC_ALLOCATION and configUSE_TASK_NOTIFICATIONS to be set to 1.
 #endif
 
-#ifndef configAPPLICATION_ALLOCATED_HEAP
-    #define configAPPLICATION_ALLOCATED_HEAP    0
+#if ( ( configUSE_TASK_POOLS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_TASK_POOLS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef configENABLE_HEAP_PROTECTOR
-    #define configENABLE_HEAP_PROTECTOR    0
+#ifndef configUSE_PARALLEL_FOR
+    #define configUSE_PARALLEL_FOR    0
 #endif
 
-#ifndef configUSE_TASK_NOTIFICATIONS
-    #define configUSE_TASK_NOTIFICATIONS    1
+#if ( ( configUSE_PARALLEL_FOR == 1 ) && ( ( configUSE_TASK_POOLS != 1 ) || ( configUSE_MUTEXES != 1 ) ) )
+    #error configUSE_PARALLEL_FOR requires configUSE_TASK_POOLS and configUSE_MUTEXES to be set to 1.
 #endif
 
-#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
-    #define configTASK_NOTIFICATION_ARRAY_ENTRIES    1
+#ifndef configUSE_TASK_TEMPLATES
+    #define configUSE_TASK_TEMPLATES    0
 #endif
 
-#if configTASK_NOTIFICATION_ARRAY_ENTRIES < 1
-    #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
+#if ( ( configUSE_TASK_TEMPLATES == 1 ) && ( ( configSUPPORT_STATIC_ALLOCATION != 1 ) || ( INCLUDE_vTaskDelete != 1 ) ) )
+    #error configUSE_TASK_TEMPLATES requires configSUPPORT_STATIC_ALLOCATION and INCLUDE_vTaskDelete to be set to 1.
 #endif
 
-#ifndef configUSE_POSIX_ERRNO
-    #define configUSE_POSIX_ERRNO    0
+#if ( ( configUSE_TASK_TEMPLATES == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_TASK_TEMPLATES is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef configUSE_SB_COMPLETED_CALLBACK
+#ifndef configUSE_SHARED_STACKS
+    #define configUSE_SHARED_STACKS    0
+#endif
 
-/* By default per-instance callbacks are not enabled for stream buffer or message buffer. */
-    #define configUSE_SB_COMPLETED_CALLBACK    0
+#if ( ( configUSE_SHARED_STACKS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION != 1 ) )
+    #error configUSE_SHARED_STACKS requires configSUPPORT_STATIC_ALLOCATION to be set to 1.
 #endif
 
-#ifndef portTICK_TYPE_IS_ATOMIC
-    #define portTICK_TYPE_IS_ATOMIC    0
+#if ( ( configUSE_SHARED_STACKS == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+    #error configUSE_SHARED_STACKS is only supported when configNUMBER_OF_CORES is 1.
 #endif
 
-#ifndef configSUPPORT_STATIC_ALLOCATION
-    /* Defaults to 0 for backward compatibility. */
-    #define configSUPPORT_STATIC_ALLOCATION    0
+#if ( ( configUSE_SHARED_STACKS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_SHARED_STACKS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef configKERNEL_PROVIDED_STATIC_MEMORY
-    #define configKERNEL_PROVIDED_STATIC_MEMORY    0
+#ifndef configUSE_STATIC_OBJECTS
+    #define configUSE_STATIC_OBJECTS    0
 #endif
 
-#ifndef configSUPPORT_DYNAMIC_ALLOCATION
-    /* Defaults to 1 for backward compatibility. */
-    #define configSUPPORT_DYNAMIC_ALLOCATION    1
+#if ( ( configUSE_STATIC_OBJECTS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION != 1 ) )
+    #error configUSE_STATIC_OBJECTS requires configSUPPORT_STATIC_ALLOCATION to be set to 1.
 #endif
 
-#if ( ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) )
-    #error configUSE_STATS_FORMATTING_FUNCTIONS cannot be used without dynamic allocation, but configSUPPORT_DYNAMIC_ALLOCATION is not set to 1.
+#ifndef configUSE_INLINE_GETTERS
+    #define configUSE_INLINE_GETTERS    0
 #endif
 
-#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
-    #if ( ( configUSE_TRACE_FACILITY != 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
-        #error configUSE_STATS_FORMATTING_FUNCTIONS is 1 but the functions it enables are not used because neither configUSE_TRACE_FACILITY or configGENERATE_RUN_TIME_STATS are 1.  Set configUSE_STATS_FORMATTING_FUNCTIONS to 0 in FreeRTOSConfig.h.
-    #endif
+#if ( ( configUSE_INLINE_GETTERS == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_INLINE_GETTERS is not supported when the MPU wrappers are used.
 #endif
 
-#ifndef configSTATS_BUFFER_MAX_LENGTH
-    #define configSTATS_BUFFER_MAX_LENGTH    0xFFFF
+#ifndef configUSE_WARM_BOOT
+    #define configUSE_WARM_BOOT    0
 #endif
 
-#ifndef configSTACK_DEPTH_TYPE
+#if ( ( configUSE_WARM_BOOT == 1 ) && ( ( configSUPPORT_STATIC_ALLOCATION != 1 ) || ( configRECORD_STACK_HIGH_ADDRESS != 1 ) ) )
+    #error configUSE_WARM_BOOT requires configSUPPORT_STATIC_ALLOCATION and configRECORD_STACK_HIGH_ADDRESS to be set to 1.
+#endif
 
-/* Defaults to StackType_t for backward compatibility, but can be overridden
- * in FreeRTOSConfig.h if StackType_t is too restrictive. */
-    #define configSTACK_DEPTH_TYPE    StackType_t
+#if ( ( configUSE_WARM_BOOT == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+    #error configUSE_WARM_BOOT is only supported when configNUMBER_OF_CORES is 1.
 #endif
 
-#ifndef configRUN_TIME_COUNTER_TYPE
+#if ( ( configUSE_WARM_BOOT == 1 ) && ( portUSING_MPU_WRAPPERS == 1 ) )
+    #error configUSE_WARM_BOOT is not supported when the MPU wrappers are used.
+#endif
 
-/* Defaults to uint32_t for backward compatibility, but can be overridden in
- * FreeRTOSConfig.h if uint32_t is too restrictive. */
+#if ( ( configUSE_WARM_BOOT == 1 ) && ( ( configKERNEL_OBJECT_POOLS == 1 ) || ( configUSE_SHARED_STACKS == 1 ) ) )
+    #error configUSE_WARM_BOOT cannot be used with configKERNEL_OBJECT_POOLS or configUSE_SHARED_STACKS.
+#endif
 
-    #define configRUN_TIME_COUNTER_TYPE    uint32_t
+/* The number of objects of each type held in the pools used when
+ * configKERNEL_OBJECT_POOLS is 1.  Objects are allocated from the heap once
+ * their pool is exhausted.  Set a length to 0 to not use a pool for that type
+ * of object. */
+#ifndef configKERNEL_TASK_POOL_LENGTH
+    #define configKERNEL_TASK_POOL_LENGTH    8
 #endif
 
-#ifndef configMESSAGE_BUFFER_LENGTH_TYPE
+#ifndef configKERNEL_QUEUE_POOL_LENGTH
+    #define configKERNEL_QUEUE_POOL_LENGTH    8
+#endif
 
-/* Defaults to size_t for backward compatibility, but can be overridden
- * in FreeRTOSConfig.h if lengths will always be less than the number of bytes
- * in a size_t. */
-    #define configMESSAGE_BUFFER_LENGTH_TYPE    size_t
+#ifndef configKERNEL_TIMER_POOL_LENGTH
+    #define configKERNEL_TIMER_POOL_LENGTH    8
+#endif
+
+#ifndef configKERNEL_EVENT_GROUP_POOL_LENGTH
+    #define configKERNEL_EVENT_GROUP_POOL_LENGTH    8
 #endif
 
 /* Sanity check the configuration. */
@@ -2880,6 +6591,10 @@
     #error configUSE_TASK_PREEMPTION_DISABLE is not supported in single core FreeRTOS
 #endif
 
+#if ( ( configUSE_PREEMPTION == 0 ) && ( configUSE_PREEMPTION_THRESHOLDS != 0 ) )
+    #error configUSE_PREEMPTION must be set to 1 to use preemption thresholds
+#endif
+
 #if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_CORE_AFFINITY != 0 ) )
     #error configUSE_CORE_AFFINITY is not supported in single core FreeRTOS
 #endif
@@ -2888,6 +6603,74 @@
     #error configUSE_PORT_OPTIMISED_TASK_SELECTION is not supported in SMP FreeRTOS
 #endif
 
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_SMP_READY_PRIORITY_BITMAP != 0 ) )
+    #error configUSE_SMP_READY_PRIORITY_BITMAP is not supported in single core FreeRTOS - use configUSE_PORT_OPTIMISED_TASK_SELECTION instead
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_PER_CORE_READY_LISTS != 0 ) )
+    #error configUSE_PER_CORE_READY_LISTS is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_PER_CORE_CO_ROUTINES != 0 ) )
+    #error configUSE_PER_CORE_CO_ROUTINES is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configUSE_PER_CORE_CO_ROUTINES == 1 ) && ( configUSE_CO_ROUTINES != 1 ) )
+    #error configUSE_PER_CORE_CO_ROUTINES requires configUSE_CO_ROUTINES to be set to 1.
+#endif
+
+#if ( ( configUSE_PER_CORE_CO_ROUTINES == 1 ) && ( configUSE_CORE_AFFINITY != 1 ) )
+    #error configUSE_PER_CORE_CO_ROUTINES requires configUSE_CORE_AFFINITY to be set to 1.
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_SOFT_AFFINITY != 0 ) )
+    #error configUSE_SOFT_AFFINITY is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_DEFERRED_CORE_YIELDS != 0 ) )
+    #error configUSE_DEFERRED_CORE_YIELDS is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_TASK_GANGS != 0 ) )
+    #error configUSE_TASK_GANGS is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_CORE_LOCAL_SUSPEND != 0 ) )
+    #error configUSE_CORE_LOCAL_SUSPEND is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_CORE_TOPOLOGY != 0 ) )
+    #error configUSE_CORE_TOPOLOGY is not supported in single core FreeRTOS
+#endif
+
+#if ( configUSE_CORE_TOPOLOGY == 1 )
+    #ifndef configCORE_CLUSTERS
+        #error configCORE_CLUSTERS must be defined, with one entry per core, when configUSE_CORE_TOPOLOGY is set to 1
+    #endif
+
+    #ifndef configCORE_CAPACITIES
+        #error configCORE_CAPACITIES must be defined, with one entry per core, when configUSE_CORE_TOPOLOGY is set to 1
+    #endif
+#endif
+
+/* heap_4.c keeps the other cores out of the heap with a compare and swap lock
+ * when configUSE_CORE_LOCAL_SUSPEND is 1. */
+#if ( ( configUSE_CORE_LOCAL_SUSPEND == 1 ) && !defined( portATOMIC_COMPARE_AND_SWAP_U32 ) )
+    #error configUSE_CORE_LOCAL_SUSPEND requires the port to define portATOMIC_COMPARE_AND_SWAP_U32.
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_GRANULAR_LOCKS != 0 ) )
+    #error configUSE_GRANULAR_LOCKS is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_CACHE_LINE_PADDING != 0 ) )
+    #error configUSE_CACHE_LINE_PADDING is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configUSE_CACHE_LINE_PADDING == 1 ) && ( ( configCACHE_LINE_SIZE < 8 ) || ( ( configCACHE_LINE_SIZE & ( configCACHE_LINE_SIZE - 1 ) ) != 0 ) ) )
+    #error configCACHE_LINE_SIZE must be a power of two and at least 8.
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
     #define configINITIAL_TICK_COUNT    0
 #endif
@@ -3105,6 +6888,10 @@ struct xSTATIC_LIST_ITEM
     #endif
     TickType_t xDummy2;
     void * pvDummy3[ 4 ];
+    #if ( configUSE_SKIP_LISTS == 1 )
+        void * pvDummy5[ 2 * configSKIP_LIST_LANES ];
+        UBaseType_t uxDummy6;
+    #endif
     #if ( configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES == 1 )
         TickType_t xDummy4;
     #endif
@@ -3135,11 +6922,45 @@ typedef struct xSTATIC_LIST
     UBaseType_t uxDummy2;
     void * pvDummy3;
     StaticMiniListItem_t xDummy4;
+    #if ( configUSE_SKIP_LISTS == 1 )
+        void * pvDummy6[ configSKIP_LIST_LANES ];
+        BaseType_t xDummy7;
+        UBaseType_t uxDummy8;
+    #endif
     #if ( configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES == 1 )
         TickType_t xDummy5;
     #endif
 } StaticList_t;
 
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+
+/*
+ * The hidden tag carried by each message sent through a queue, message buffer
+ * or task notification when configUSE_IPC_LATENCY_TRACING is 1.  A task that
+ * receives a tagged message adopts its tag, and the messages the task sends
+ * afterwards carry the same tag, so every message that results from one event
+ * shares its correlation ID and origin time however many hops it takes.  A
+ * message sent from an interrupt, or by a task that holds no tag, starts a new
+ * chain.  A correlation ID of 0 means the message carries no tag.
+ */
+    typedef struct xMESSAGE_TAG
+    {
+        uint32_t ulCorrelationID; /* Identifies the chain of messages the message belongs to. */
+        uint32_t ulOriginTime;    /* The run time counter value, truncated to 32 bits, when the first message of the chain was sent. */
+    } MessageTag_t;
+
+/*
+ * The latencies, from the origin of a chain of messages to their receipt,
+ * recorded for a queue, message buffer or task notification.  See
+ * configIPC_LATENCY_BUCKETS for the range of each bucket.
+ */
+    typedef struct xIPC_LATENCY_HISTOGRAM
+    {
+        uint32_t ulCounts[ configIPC_LATENCY_BUCKETS ]; /* The number of messages received with a latency in the range of each bucket. */
+        uint32_t ulMaxLatency;                          /* The longest latency seen, in run time counts. */
+    } IPCLatencyHistogram_t;
+#endif /* configUSE_IPC_LATENCY_TRACING */
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -3159,6 +6980,9 @@ typedef struct xSTATIC_TCB
     #if ( portUSING_MPU_WRAPPERS == 1 )
         xMPU_SETTINGS xDummy2;
     #endif
+    #if ( configUSE_TASK_VECTOR_UNIT_FLAG == 1 )
+        BaseType_t xDummy39;
+    #endif
     #if ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 )
         UBaseType_t uxDummy26;
     #endif
@@ -3168,22 +6992,64 @@ typedef struct xSTATIC_TCB
     #if ( configNUMBER_OF_CORES > 1 )
         BaseType_t xDummy23;
         UBaseType_t uxDummy24;
+        #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+            BaseType_t xDummy27;
+        #endif
+        #if ( ( configUSE_SOFT_AFFINITY == 1 ) || ( configUSE_CORE_TOPOLOGY == 1 ) )
+            BaseType_t xDummy40;
+        #endif
+        #if ( configUSE_TASK_GANGS == 1 )
+            UBaseType_t uxDummy56;
+        #endif
+        #if ( configUSE_CORE_TOPOLOGY == 1 )
+            UBaseType_t uxDummy57;
+        #endif
+    #endif
+    #if ( configUSE_CACHE_LINE_PADDING == 0 )
+        uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
     #endif
-    uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
     #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
         BaseType_t xDummy25;
     #endif
+    #if ( configUSE_PREEMPTION_THRESHOLDS == 1 )
+        UBaseType_t uxDummy60;
+        #if ( configNUMBER_OF_CORES == 1 )
+            void * pvDummy61;
+        #endif
+    #endif
+    #if ( configUSE_TASK_NAME_INDEX == 1 )
+        void * pvDummy62;
+    #endif
+    #if ( configUSE_TASK_GROUPS == 1 )
+        void * pvDummy63[ 2 ];
+    #endif
+    #if ( configUSE_PERIODIC_TASKS == 1 )
+        TickType_t xDummy64[ 5 ];
+        uint32_t ulDummy65[ 2 ];
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            configRUN_TIME_COUNTER_TYPE ulDummy66[ 3 ];
+        #endif
+    #endif
     #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
         void * pxDummy8;
     #endif
     #if ( portCRITICAL_NESTING_IN_TCB == 1 )
         UBaseType_t uxDummy9;
     #endif
+    #if ( configUSE_CACHE_LINE_PADDING == 1 )
+        #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            configRUN_TIME_COUNTER_TYPE ulDummy16;
+        #endif
+        uint8_t ucDummy7[ configMAX_TASK_NAME_LEN ];
+    #endif
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy10[ 2 ];
     #endif
     #if ( configUSE_MUTEXES == 1 )
         UBaseType_t uxDummy12[ 2 ];
+        #if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+            void * pvDummy47;
+        #endif
     #endif
     #if ( configUSE_APPLICATION_TASK_TAG == 1 )
         void * pxDummy14;
@@ -3191,9 +7057,55 @@ typedef struct xSTATIC_TCB
     #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
         void * pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
     #endif
-    #if ( configGENERATE_RUN_TIME_STATS == 1 )
+    #if ( configUSE_TASK_ALLOCATION_CACHE == 1 )
+        void * pvDummy28[ tskALLOCATION_CACHE_SIZE_CLASSES ][ configTASK_ALLOCATION_CACHE_DEPTH ];
+        uint8_t ucDummy29[ tskALLOCATION_CACHE_SIZE_CLASSES ];
+    #endif
+    #if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+        size_t xDummy67[ 2 ];
+    #endif
+    #if ( configUSE_TASK_TEMPLATES == 1 )
+        void * pvDummy30;
+    #endif
+    #if ( configUSE_LAZY_STACK_PAINTING == 1 )
+        void * pvDummy31[ 2 ];
+    #endif
+    #if ( configUSE_HR_TIMEOUTS == 1 )
+        StaticListItem_t xDummy32;
+        configHR_TIME_TYPE xDummy33;
+        uint8_t ucDummy34;
+    #endif
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xDummy41[ 7 ];
+        BaseType_t xDummy42;
+    #endif
+    #if ( configUSE_TASK_BUDGETS == 1 )
+        TickType_t xDummy43[ 5 ];
+        uint32_t ulDummy44;
+        uint8_t ucDummy45[ 2 ];
+    #endif
+    #if ( configUSE_TASK_TIME_SLICES == 1 )
+        TickType_t xDummy46[ 2 ];
+    #endif
+    #if ( configUSE_TASK_WAIT_ON_ADDRESS == 1 )
+        void * pvDummy48;
+    #endif
+    #if ( configUSE_SHARED_STACKS == 1 )
+        void * pvDummy49[ 2 ];
+        configSTACK_DEPTH_TYPE uxDummy50;
+        uint8_t ucDummy51[ 2 ];
+    #endif
+    #if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_CACHE_LINE_PADDING == 0 ) )
         configRUN_TIME_COUNTER_TYPE ulDummy16;
     #endif
+    #if ( configUSE_SCHEDULING_LATENCY_STATS == 1 )
+        configRUN_TIME_COUNTER_TYPE ulDummy35;
+        uint32_t ulDummy36[ configSCHEDULING_LATENCY_BUCKETS ];
+        uint8_t ucDummy37;
+    #endif
+    #if ( configUSE_RUN_TIME_SNAPSHOT == 1 )
+        UBaseType_t uxDummy38;
+    #endif
     #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
         configTLS_BLOCK_TYPE xDummy17;
     #endif
@@ -3201,6 +7113,32 @@ typedef struct xSTATIC_TCB
         uint32_t ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
         uint8_t ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
     #endif
+    #if ( configUSE_PER_TASK_NOTIFICATION_ENTRIES == 1 )
+        void * pvDummy54[ 2 ];
+        UBaseType_t uxDummy55;
+    #endif
+    #if ( configTASK_NOTIFY_MAILBOX_DEPTH > 0 )
+        void * pvDummy52[ configTASK_NOTIFY_MAILBOX_DEPTH ];
+        UBaseType_t uxDummy53;
+    #endif
+    #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+        uint64_t ullDummy58;
+    #endif
+    #if ( configUSE_STACK_PEAK_PROFILING == 1 )
+        void * pvDummy59[ 2 ];
+    #endif
+    #if ( configUSE_ENERGY_ACCOUNTING == 1 )
+        configENERGY_COUNTER_TYPE xDummy68;
+        configRUN_TIME_COUNTER_TYPE ulDummy69;
+        uint32_t ulDummy70;
+    #endif
+    #if ( configUSE_SWITCH_REASON_STATS == 1 )
+        uint32_t ulDummy71[ 6 ];
+    #endif
+    #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        MessageTag_t xDummy72[ 2 ];
+        IPCLatencyHistogram_t xDummy73;
+    #endif
     #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
         uint8_t uxDummy20;
     #endif
@@ -3213,6 +7151,30 @@ typedef struct xSTATIC_TCB
     #endif
 } StaticTask_t;
 
+#if ( configUSE_IPC_STATISTICS == 1 )
+
+/*
+ * The statistics gathered for each queue, semaphore, mutex, stream buffer,
+ * message buffer and event group when configUSE_IPC_STATISTICS is 1, as
+ * returned by vQueueGetStatistics(), vStreamBufferGetStatistics() and
+ * vEventGroupGetStatistics().  For an event group a set counts as a send and
+ * a satisfied wait counts as a receive.  The mutex members are only updated
+ * for mutexes.
+ */
+    typedef struct xIPC_STATISTICS
+    {
+        uint32_t ulSends;                /* The number of successful sends, gives or sets. */
+        uint32_t ulReceives;             /* The number of successful receives, takes or waits. */
+        uint32_t ulBlocks;               /* The number of times a task entered the Blocked state on the object. */
+        uint32_t ulTimeouts;             /* The number of times a task gave up after its block time expired. */
+        size_t xMaxDepth;                /* The largest number of items (bytes for a stream buffer) ever held. */
+        TickType_t xTotalBlockedTime;    /* The total time, in ticks, tasks spent blocked on the object. */
+        TickType_t xTotalHeldTime;       /* The total time, in ticks, the mutex was held. */
+        TickType_t xMaxHeldTime;         /* The longest time, in ticks, the mutex was held in one go. */
+        uint32_t ulPriorityInheritances; /* The number of times a task blocking on the mutex raised the holder's priority. */
+    } IPCStatistics_t;
+#endif /* configUSE_IPC_STATISTICS */
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -3249,10 +7211,75 @@ typedef struct xSTATIC_QUEUE
         void * pvDummy7;
     #endif
 
+    #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+        UBaseType_t uxDummy24[ 2 ];
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
     #endif
+
+    #if ( configUSE_ZERO_COPY_QUEUES == 1 )
+        void * pvDummy10[ 2 ];
+    #endif
+
+    #if ( configUSE_SPSC_QUEUES == 1 )
+        UBaseType_t uxDummy11[ 2 ];
+        uint8_t ucDummy12;
+    #endif
+
+    #if ( configUSE_MPMC_QUEUES == 1 )
+        void * pvDummy13;
+        uint32_t ulDummy14[ 2 ];
+    #endif
+
+    #if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+        void * pvDummy15;
+    #endif
+
+    #if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+        UBaseType_t uxDummy31;
+    #endif
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        IPCStatistics_t xDummy16;
+        TickType_t xDummy17;
+    #endif
+
+    #if ( configUSE_MUTEX_PRIORITY_CEILING == 1 )
+        UBaseType_t uxDummy18;
+    #endif
+
+    #if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+        uint32_t ulDummy19;
+        uint8_t ucDummy20;
+    #endif
+
+    #if ( configUSE_RING_QUEUES == 1 )
+        UBaseType_t uxDummy21;
+        uint8_t ucDummy22;
+    #endif
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        uint8_t ucDummy23;
+    #endif
+
+    #if ( configUSE_RPC_QUEUES == 1 )
+        StaticList_t xDummy25;
+        void * pvDummy26;
+        TickType_t xDummy27[ 2 ];
+        uint8_t ucDummy28[ 3 ];
+    #endif
+
+    #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        void * pvDummy29;
+        IPCLatencyHistogram_t xDummy30;
+    #endif
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xDummySpinlock;
+    #endif
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
@@ -3272,7 +7299,11 @@ typedef StaticQueue_t StaticSemaphore_t;
  */
 typedef struct xSTATIC_EVENT_GROUP
 {
-    TickType_t xDummy1;
+    #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+        uint64_t ullDummy1;
+    #else
+        TickType_t xDummy1;
+    #endif
     StaticList_t xDummy2;
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -3282,6 +7313,26 @@ typedef struct xSTATIC_EVENT_GROUP
     #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
         uint8_t ucDummy4;
     #endif
+
+    #if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+        #if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+            uint64_t ullDummy5;
+        #else
+            TickType_t xDummy5;
+        #endif
+    #endif
+
+    #if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+        UBaseType_t uxDummy6;
+    #endif
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        IPCStatistics_t xDummy7;
+    #endif
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xDummySpinlock;
+    #endif
 } StaticEventGroup_t;
 
 /*
@@ -3309,6 +7360,16 @@ typedef struct xSTATIC_TIMER
         UBaseType_t uxDummy7;
     #endif
     uint8_t ucDummy8;
+    #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+        TickType_t xDummy9;
+        uint8_t ucDummy10;
+    #endif
+    #if ( configUSE_TIMER_SLACK == 1 )
+        TickType_t xDummy11;
+    #endif
+    #if ( configTIMER_SERVICE_TASKS > 1 )
+        UBaseType_t uxDummy12;
+    #endif
 } StaticTimer_t;
 
 /*
@@ -3337,11 +7398,74 @@ typedef struct xSTATIC_STREAM_BUFFER
         void * pvDummy5[ 2 ];
     #endif
     UBaseType_t uxDummy6;
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+        void * pvDummy7;
+        UBaseType_t uxDummy8;
+    #endif
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        TickType_t xDummy9[ 2 ];
+    #endif
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        IPCStatistics_t xDummy10;
+    #endif
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        uint32_t ulDummy11;
+    #endif
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+        void * pvDummy12;
+        UBaseType_t uxDummy13;
+    #endif
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+        size_t uxDummy14[ 2 ];
+        void * pvDummy15;
+        BaseType_t xDummy16;
+    #endif
+    #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        MessageTag_t xDummy17[ configIPC_LATENCY_MESSAGE_BUFFER_TAGS ];
+        size_t uxDummy18[ configIPC_LATENCY_MESSAGE_BUFFER_TAGS ];
+        UBaseType_t uxDummy19[ 2 ];
+        IPCLatencyHistogram_t xDummy20;
+    #endif
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xDummySpinlock;
+    #endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
 typedef StaticStreamBuffer_t StaticMessageBuffer_t;
 
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the object pool structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create an object pool then the size of the object pool object needs to be
+ * known.  The StaticPool_t structure below is provided for this purpose.  Its
+ * size and alignment requirements are guaranteed to match those of the genuine
+ * structure, no matter which architecture is being used, and no matter how the
+ * values in FreeRTOSConfig.h are set.  Its contents are somewhat obfuscated in
+ * the hope users will recognise that it would be unwise to make direct use of
+ * the structure members.
+ */
+typedef struct xSTATIC_POOL
+{
+    #if ( configUSE_LOCK_FREE_POOLS == 1 )
+        void * pvDummy1;
+        uint32_t ulDummy5;
+        size_t xDummy2;
+        UBaseType_t uxDummy3;
+        uint32_t ulDummy6[ 2 ];
+    #else
+        void * pvDummy1[ 2 ];
+        size_t xDummy2;
+        UBaseType_t uxDummy3[ 3 ];
+    #endif
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy4;
+    #endif
+} StaticPool_t;
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
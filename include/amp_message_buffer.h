@@ -0,0 +1,372 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef AMP_MESSAGE_BUFFER_H
+#define AMP_MESSAGE_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include amp_message_buffer.h"
+#endif
+
+#include "message_buffer.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * An AMP message channel passes messages between two processors that each run
+ * their own instance of the kernel, such as the Cortex-M7 and Cortex-M4 of a
+ * dual core microcontroller.  The channel is a pair of message buffers, one
+ * for each direction, that live in memory both processors can access.  Each
+ * processor writes to one of the message buffers and reads from the other, so
+ * every message buffer has a single writer and a single reader and needs no
+ * lock between the processors.
+ *
+ * A task on one processor cannot notify a task on the other, so the message
+ * buffers of a channel never unblock a task directly.  Instead the channel
+ * calls an application provided doorbell function, which raises an interrupt
+ * on the other processor, for example through an inter-processor
+ * communication controller or a mailbox peripheral.  The handler of that
+ * interrupt calls vAMPMessageChannelDoorbellFromISR(), which unblocks any task
+ * on that processor that is waiting for a message to arrive or for space to be
+ * freed.  A doorbell is rung when a message is sent and when a message is
+ * received.  Surrounding a run of sends and receives with
+ * vAMPMessageChannelBeginBatch() and vAMPMessageChannelEndBatch() rings the
+ * doorbell once at the end of the run instead of once per message.
+ *
+ * The shared memory is laid out as an AMPSharedRegion_t followed by the
+ * storage areas of the two message buffers, each starting on a
+ * configSTREAM_BUFFER_STORAGE_ALIGNMENT boundary.  ampmbSHARED_REGION_BYTES()
+ * gives the size of the region.  The region must be at the same address on
+ * both processors, as the message buffers hold a pointer to their storage
+ * area, and both processors must be built with the same stream buffer options
+ * so they agree on the size of a StaticMessageBuffer_t.  The AMPSharedRegion_t
+ * at the start of the region must not be cached.  The storage areas can be
+ * cached if configUSE_STREAM_BUFFER_CACHE_MAINTENANCE is set to 1, in which
+ * case configSTREAM_BUFFER_STORAGE_ALIGNMENT should be the cache line size.
+ * configAMP_MEMORY_BARRIER() must order memory accesses as seen by the other
+ * processor - on Cortex-M it should be defined as a DMB instruction.
+ *
+ * A message is copied into the shared storage area by the sender and out of it
+ * by the receiver, with no other copy in between.  To hand off a large block of
+ * data without copying it, place the block in shared memory and send a message
+ * that holds its offset and length.
+ *
+ * As with any message buffer, if more than one task on a processor sends to,
+ * or receives from, the same channel then the application must serialise
+ * those tasks.
+ *
+ * Set configUSE_AMP_MESSAGE_BUFFERS to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * \defgroup AMPSharedRegion_t AMPSharedRegion_t
+ * \ingroup AMPMessageChannels
+ */
+typedef struct xAMP_SHARED_REGION
+{
+    volatile uint32_t ulReady;         /**< ampmbREGION_READY once the primary processor has created both message buffers. */
+    uint32_t ulControlBlockBytes;      /**< The size of a StaticMessageBuffer_t on the primary processor. */
+    uint32_t ulStorageBytes;           /**< The size of the storage area of each message buffer. */
+    StaticMessageBuffer_t xRings[ 2 ]; /**< Index 0 carries messages from the primary processor, index 1 messages to it. */
+} AMPSharedRegion_t;
+
+/**
+ * The value of ulReady once the shared region has been initialised.
+ */
+#define ampmbREGION_READY    ( ( uint32_t ) 0x414D5042UL )
+
+/**
+ * The offset of the first storage area from the start of the shared region.
+ */
+#define ampmbSTORAGE_OFFSET                                                                  \
+    ( ( sizeof( AMPSharedRegion_t ) + ( ( size_t ) configSTREAM_BUFFER_STORAGE_ALIGNMENT - 1U ) ) & \
+      ~( ( size_t ) configSTREAM_BUFFER_STORAGE_ALIGNMENT - 1U ) )
+
+/**
+ * The size of the shared region needed for a channel whose message buffers
+ * each have xStorageBytes of storage.  xStorageBytes must be a multiple of
+ * configSTREAM_BUFFER_STORAGE_ALIGNMENT.
+ */
+#define ampmbSHARED_REGION_BYTES( xStorageBytes )    ( ampmbSTORAGE_OFFSET + ( ( size_t ) 2U * ( xStorageBytes ) ) )
+
+/**
+ * Type of the function that raises the doorbell interrupt on the other
+ * processor.  It is called from tasks and, by
+ * xAMPMessageChannelSendFromISR(), from interrupts.
+ */
+typedef void (* AMPDoorbellFunction_t)( void * pvDoorbellContext );
+
+/**
+ * The processor local state of an AMP message channel.  Each processor has its
+ * own AMPMessageChannel_t, in memory that is not shared.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup AMPMessageChannel_t AMPMessageChannel_t
+ * \ingroup AMPMessageChannels
+ */
+typedef struct xAMP_MESSAGE_CHANNEL
+{
+    MessageBufferHandle_t xTxRing;        /**< The message buffer this processor writes to. */
+    MessageBufferHandle_t xRxRing;        /**< The message buffer this processor reads from. */
+    AMPDoorbellFunction_t pxRingDoorbell; /**< Raises the doorbell interrupt on the other processor. */
+    void * pvDoorbellContext;             /**< Passed to pxRingDoorbell. */
+    UBaseType_t uxBatchNesting;           /**< The number of calls to vAMPMessageChannelBeginBatch() not yet matched by vAMPMessageChannelEndBatch(). */
+    BaseType_t xDoorbellPending;          /**< pdTRUE if a doorbell was held back by a batch. */
+} AMPMessageChannel_t;
+
+/**
+ * amp_message_buffer.h
+ * @code{c}
+ * BaseType_t xAMPMessageChannelCreate( AMPMessageChannel_t * pxChannel,
+ *                                      void * pvSharedRegion,
+ *                                      size_t xStorageBytes,
+ *                                      BaseType_t xIsPrimary,
+ *                                      AMPDoorbellFunction_t pxRingDoorbell,
+ *                                      void * pvDoorbellContext );
+ * @endcode
+ *
+ * Connect this processor to an AMP message channel.  Exactly one of the two
+ * processors is the primary, which creates the message buffers in the shared
+ * region and then marks the region as ready.  The other processor attaches to
+ * the message buffers once the region is ready, so it should call
+ * xAMPMessageChannelCreate() again, for example after a short delay, until it
+ * returns pdPASS.  Each processor should only enable its doorbell interrupt
+ * once xAMPMessageChannelCreate() has returned pdPASS.
+ *
+ * @param pxChannel The processor local channel state being initialised.
+ *
+ * @param pvSharedRegion The start of the shared region, which must be at least
+ * ampmbSHARED_REGION_BYTES( xStorageBytes ) bytes, and aligned to
+ * configSTREAM_BUFFER_STORAGE_ALIGNMENT.
+ *
+ * @param xStorageBytes The size of the storage area of each message buffer.
+ * Must be a multiple of configSTREAM_BUFFER_STORAGE_ALIGNMENT.  Must be the
+ * same on both processors.
+ *
+ * @param xIsPrimary pdTRUE on the processor that creates the message buffers,
+ * pdFALSE on the other.
+ *
+ * @param pxRingDoorbell The function that raises the doorbell interrupt on the
+ * other processor.
+ *
+ * @param pvDoorbellContext Passed to pxRingDoorbell.
+ *
+ * @return pdPASS if the channel is ready to use.  pdFAIL if this is not the
+ * primary processor and the primary has not yet initialised the region, or
+ * the two processors do not agree on the layout of the region.
+ *
+ * \defgroup xAMPMessageChannelCreate xAMPMessageChannelCreate
+ * \ingroup AMPMessageChannels
+ */
+BaseType_t xAMPMessageChannelCreate( AMPMessageChannel_t * pxChannel,
+                                     void * pvSharedRegion,
+                                     size_t xStorageBytes,
+                                     BaseType_t xIsPrimary,
+                                     AMPDoorbellFunction_t pxRingDoorbell,
+                                     void * pvDoorbellContext ) PRIVILEGED_FUNCTION;
+
+/**
+ * amp_message_buffer.h
+ * @code{c}
+ * size_t xAMPMessageChannelSend( AMPMessageChannel_t * pxChannel,
+ *                                const void * pvTxData,
+ *                                size_t xDataLengthBytes,
+ *                                TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Send a message to the other processor, waiting in the Blocked state for up
+ * to xTicksToWait ticks for space if the channel is full.  The doorbell is
+ * rung once the message has been written, unless the calling task is within a
+ * batch.  If the task has to block then any doorbell held back by a batch is
+ * rung first, as the other processor will not free space for messages it has
+ * not been told about.
+ *
+ * @param pxChannel The channel to send to.
+ *
+ * @param pvTxData The message to send.
+ *
+ * @param xDataLengthBytes The length of the message in bytes.
+ *
+ * @param xTicksToWait The maximum time to wait for space.
+ *
+ * @return The number of bytes sent, which is either xDataLengthBytes or 0 if
+ * the message could not be sent before xTicksToWait expired.
+ *
+ * \defgroup xAMPMessageChannelSend xAMPMessageChannelSend
+ * \ingroup AMPMessageChannels
+ */
+size_t xAMPMessageChannelSend( AMPMessageChannel_t * pxChannel,
+                               const void * pvTxData,
+                               size_t xDataLengthBytes,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * amp_message_buffer.h
+ * @code{c}
+ * size_t xAMPMessageChannelSendFromISR( AMPMessageChannel_t * pxChannel,
+ *                                       const void * pvTxData,
+ *                                       size_t xDataLengthBytes );
+ * @endcode
+ *
+ * A version of xAMPMessageChannelSend() that can be called from an interrupt
+ * service routine.  It never blocks, and always rings the doorbell if the
+ * message was sent.
+ *
+ * @param pxChannel The channel to send to.
+ *
+ * @param pvTxData The message to send.
+ *
+ * @param xDataLengthBytes The length of the message in bytes.
+ *
+ * @return The number of bytes sent, which is either xDataLengthBytes or 0 if
+ * there was not enough space for the message.
+ *
+ * \defgroup xAMPMessageChannelSendFromISR xAMPMessageChannelSendFromISR
+ * \ingroup AMPMessageChannels
+ */
+size_t xAMPMessageChannelSendFromISR( AMPMessageChannel_t * pxChannel,
+                                      const void * pvTxData,
+                                      size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * amp_message_buffer.h
+ * @code{c}
+ * size_t xAMPMessageChannelReceive( AMPMessageChannel_t * pxChannel,
+ *                                   void * pvRxData,
+ *                                   size_t xBufferLengthBytes,
+ *                                   TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Receive a message from the other processor, waiting in the Blocked state for
+ * up to xTicksToWait ticks for a message if the channel is empty.  The
+ * doorbell is rung once the message has been read, so a task on the other
+ * processor that is waiting for space is unblocked, unless the calling task
+ * is within a batch.
+ *
+ * @param pxChannel The channel to receive from.
+ *
+ * @param pvRxData The buffer into which the message is copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ *
+ * @param xTicksToWait The maximum time to wait for a message.
+ *
+ * @return The length of the message received, or 0 if no message was received
+ * before xTicksToWait expired or the message was longer than
+ * xBufferLengthBytes, in which case it is left in the channel.
+ *
+ * \defgroup xAMPMessageChannelReceive xAMPMessageChannelReceive
+ * \ingroup AMPMessageChannels
+ */
+size_t xAMPMessageChannelReceive( AMPMessageChannel_t * pxChannel,
+                                  void * pvRxData,
+                                  size_t xBufferLengthBytes,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * amp_message_buffer.h
+ * @code{c}
+ * void vAMPMessageChannelBeginBatch( AMPMessageChannel_t * pxChannel );
+ * void vAMPMessageChannelEndBatch( AMPMessageChannel_t * pxChannel );
+ * @endcode
+ *
+ * Hold back the doorbells of the sends and receives made between the two
+ * calls, then ring the doorbell once, if any were held back, when the
+ * outermost batch ends.  Batches can be nested.
+ *
+ * Example usage:
+ * @code{c}
+ * void vForwardSamples( AMPMessageChannel_t * pxChannel, const Sample_t * pxSamples, size_t xCount )
+ * {
+ *     size_t x;
+ *
+ *     vAMPMessageChannelBeginBatch( pxChannel );
+ *
+ *     for( x = 0; x < xCount; x++ )
+ *     {
+ *         ( void ) xAMPMessageChannelSend( pxChannel, &( pxSamples[ x ] ), sizeof( Sample_t ), portMAX_DELAY );
+ *     }
+ *
+ *     // The other processor is interrupted once for all the samples.
+ *     vAMPMessageChannelEndBatch( pxChannel );
+ * }
+ * @endcode
+ *
+ * @param pxChannel The channel being batched.
+ *
+ * \defgroup vAMPMessageChannelBeginBatch vAMPMessageChannelBeginBatch
+ * \ingroup AMPMessageChannels
+ */
+void vAMPMessageChannelBeginBatch( AMPMessageChannel_t * pxChannel ) PRIVILEGED_FUNCTION;
+void vAMPMessageChannelEndBatch( AMPMessageChannel_t * pxChannel ) PRIVILEGED_FUNCTION;
+
+/**
+ * amp_message_buffer.h
+ * @code{c}
+ * void vAMPMessageChannelDoorbellFromISR( AMPMessageChannel_t * pxChannel,
+ *                                         BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Called from the handler of the doorbell interrupt raised by the other
+ * processor.  Unblocks a task on this processor that is waiting to receive
+ * from, or waiting for space to send to, the channel.
+ *
+ * Example usage:
+ * @code{c}
+ * void IPCC_RX_IRQHandler( void )
+ * {
+ *     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *     vClearDoorbellInterrupt();
+ *     vAMPMessageChannelDoorbellFromISR( &xChannel, &xHigherPriorityTaskWoken );
+ *     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * @endcode
+ *
+ * @param pxChannel The channel whose doorbell was rung.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if a task of a higher
+ * priority than the interrupted task was unblocked.
+ *
+ * \defgroup vAMPMessageChannelDoorbellFromISR vAMPMessageChannelDoorbellFromISR
+ * \ingroup AMPMessageChannels
+ */
+void vAMPMessageChannelDoorbellFromISR( AMPMessageChannel_t * pxChannel,
+                                        BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* AMP_MESSAGE_BUFFER_H */
@@ -0,0 +1,445 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef ASYNC_TASK_H
+#define ASYNC_TASK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include async_task.h"
+#endif
+
+#include "event_handler.h"
+#include "queue.h"
+#include "stream_buffer.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * An async task is a stackless task, for use where many concurrent activities,
+ * such as protocol sessions, each spend most of their time waiting.  It is
+ * written as a single function that starts with asyncSTART() and ends with
+ * asyncEND(), and waits using the asyncDELAY(), asyncNOTIFY_TAKE(),
+ * asyncQUEUE_SEND(), asyncQUEUE_RECEIVE(), asyncSTREAM_BUFFER_SEND() and
+ * asyncSTREAM_BUFFER_RECEIVE() macros.  Each wait returns from the function,
+ * which is called again, and carries on from where it left off, when the wait
+ * is over.
+ *
+ * Async tasks are event handlers, so every async task of one priority is run
+ * by the same dispatcher task and shares its stack.  As with co-routines, the
+ * values of the function's local variables are not kept across a wait, so
+ * anything that must be kept belongs in the structure passed in as the
+ * function's parameter, and the wait macros can only be used from the async
+ * task function itself, not from a function it calls.
+ *
+ * Waiting for a notification, and delaying, takes no processing time until
+ * the wait is over.  Waiting to send to or receive from a queue or stream
+ * buffer is implemented by trying the operation again on every tick, so
+ * should be kept for sessions that are expected to wait briefly, or combined
+ * with xAsyncTaskNotifyGive() from the other side to end the wait straight
+ * away.
+ *
+ * Set configUSE_ASYNC_TASKS to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup AsyncTask_t AsyncTask_t
+ * \ingroup AsyncTasks
+ */
+struct xASYNC_TASK;
+
+typedef void (* AsyncTaskFunction_t)( struct xASYNC_TASK * pxTask,
+                                      void * pvParameter );
+
+typedef struct xASYNC_TASK
+{
+    EventHandler_t xHandler;            /**< Runs the function each time the task is resumed. */
+    AsyncTaskFunction_t pxFunction;     /**< The async task function. */
+    void * pvParameter;                 /**< The value passed into pxFunction. */
+    UBaseType_t uxState;                /**< Where pxFunction carries on from when it is next called. */
+    TimeOut_t xTimeOut;                 /**< When the current wait started. */
+    TickType_t xTicksToWait;            /**< The length of the current wait. */
+    volatile UBaseType_t uxNotifyCount; /**< The number of notifications not yet taken. */
+} AsyncTask_t;
+
+/**
+ * async_task.h
+ * @code{c}
+ * BaseType_t xAsyncTaskInit( AsyncTask_t * pxTask,
+ *                            AsyncTaskFunction_t pxFunction,
+ *                            void * pvParameter,
+ *                            UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Initialise an async task and start it.  pxFunction is first called once the
+ * dispatcher task of uxPriority runs.
+ *
+ * @param pxTask The async task being initialised.
+ *
+ * @param pxFunction The async task function.
+ *
+ * @param pvParameter The value passed into pxFunction each time it is called.
+ *
+ * @param uxPriority The priority the async task runs at.
+ *
+ * @return pdPASS if the async task was started, or pdFAIL if the dispatcher
+ * task for uxPriority could not be created.
+ *
+ * \defgroup xAsyncTaskInit xAsyncTaskInit
+ * \ingroup AsyncTasks
+ */
+BaseType_t xAsyncTaskInit( AsyncTask_t * pxTask,
+                           AsyncTaskFunction_t pxFunction,
+                           void * pvParameter,
+                           UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * async_task.h
+ * @code{c}
+ * void vAsyncTaskNotifyGive( AsyncTask_t * pxTask );
+ * @endcode
+ *
+ * Send a notification to an async task, ending an asyncNOTIFY_TAKE() wait.
+ * The notification is counted, as for xTaskNotifyGive(), if the async task is
+ * not waiting for one.  Also ends any other wait early, so that whatever the
+ * async task is waiting for is tried again straight away.
+ *
+ * @param pxTask The async task being notified.
+ *
+ * \defgroup vAsyncTaskNotifyGive vAsyncTaskNotifyGive
+ * \ingroup AsyncTasks
+ */
+void vAsyncTaskNotifyGive( AsyncTask_t * pxTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * async_task.h
+ * @code{c}
+ * void vAsyncTaskNotifyGiveFromISR( AsyncTask_t * pxTask,
+ *                                   BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of vAsyncTaskNotifyGive() that can be called from an interrupt
+ * service routine.
+ *
+ * @param pxTask The async task being notified.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the notification unblocked
+ * a dispatcher task with a priority higher than the task that was interrupted,
+ * in which case a context switch should be requested before the interrupt
+ * exits.
+ *
+ * \defgroup vAsyncTaskNotifyGiveFromISR vAsyncTaskNotifyGiveFromISR
+ * \ingroup AsyncTasks
+ */
+void vAsyncTaskNotifyGiveFromISR( AsyncTask_t * pxTask,
+                                  BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Functions used by the async task macros.  They should not be called
+ * directly by application writers.
+ */
+void vAsyncTaskInternalStartWait( AsyncTask_t * pxTask,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xAsyncTaskInternalContinueWait( AsyncTask_t * pxTask,
+                                           BaseType_t xRetryEveryTick ) PRIVILEGED_FUNCTION;
+BaseType_t xAsyncTaskInternalNotifyTake( AsyncTask_t * pxTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * The state of an async task whose function has reached asyncEND().  Resume
+ * points are numbered from twice the source line, so are always even.
+ */
+#define asyncTASK_STATE_FINISHED    ( ( UBaseType_t ) 1U )
+
+/**
+ * async_task.h
+ * @code{c}
+ * asyncSTART( AsyncTask_t * pxTask );
+ * @endcode
+ *
+ * This macro MUST always be called at the start of an async task function.
+ *
+ * Example usage:
+ * @code{c}
+ * // Session state is kept in the parameter, as locals are lost on each wait.
+ * typedef struct
+ * {
+ *     QueueHandle_t xRequests;
+ *     uint32_t ulRequest;
+ * } Session_t;
+ *
+ * void vSession( AsyncTask_t * pxTask, void * pvParameter )
+ * {
+ *     Session_t * pxSession = ( Session_t * ) pvParameter;
+ *     BaseType_t xResult;
+ *
+ *     asyncSTART( pxTask );
+ *
+ *     for( ;; )
+ *     {
+ *         asyncQUEUE_RECEIVE( pxTask, pxSession->xRequests, &( pxSession->ulRequest ), pdMS_TO_TICKS( 100 ), &xResult );
+ *
+ *         if( xResult == pdPASS )
+ *         {
+ *             // Handle pxSession->ulRequest here.
+ *         }
+ *     }
+ *
+ *     asyncEND( pxTask );
+ * }
+ * @endcode
+ * \defgroup asyncSTART asyncSTART
+ * \ingroup AsyncTasks
+ */
+#define asyncSTART( pxTask )        \
+    switch( ( pxTask )->uxState ) { \
+        case 0:
+
+/**
+ * async_task.h
+ * @code{c}
+ * asyncEND( AsyncTask_t * pxTask );
+ * @endcode
+ *
+ * This macro MUST always be called at the end of an async task function.  An
+ * async task whose function reaches asyncEND() has finished, and is not run
+ * again unless it is initialised again.
+ *
+ * \defgroup asyncEND asyncEND
+ * \ingroup AsyncTasks
+ */
+#define asyncEND( pxTask )                            \
+    default:                                          \
+        break;                                        \
+    }                                                 \
+    ( pxTask )->uxState = asyncTASK_STATE_FINISHED
+
+/*
+ * This macro is intended for internal use by the async task implementation
+ * only.  It should not be used directly by application writers.  It waits
+ * until xCondition is true, evaluating it each time the async task is resumed,
+ * or until xTicksToWait ticks have passed, and sets *pxResult to pdPASS or
+ * pdFAIL accordingly.
+ */
+#define asyncWAIT_UNTIL( pxTask, xCondition, xTicksToWait, xRetryEveryTick, pxResult )       \
+    do {                                                                                     \
+        vAsyncTaskInternalStartWait( ( pxTask ), ( xTicksToWait ) );                         \
+        ( pxTask )->uxState = ( __LINE__ * 2 );                                              \
+        case ( __LINE__ * 2 ):                                                               \
+        if( ( xCondition ) )                                                                 \
+        {                                                                                    \
+            *( pxResult ) = pdPASS;                                                          \
+        }                                                                                    \
+        else if( xAsyncTaskInternalContinueWait( ( pxTask ), ( xRetryEveryTick ) ) != pdFALSE ) \
+        {                                                                                    \
+            return;                                                                          \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            *( pxResult ) = pdFAIL;                                                          \
+        }                                                                                    \
+    } while( 0 )
+
+/**
+ * async_task.h
+ * @code{c}
+ * asyncDELAY( AsyncTask_t * pxTask, TickType_t xTicksToDelay );
+ * @endcode
+ *
+ * Delay an async task for a fixed number of ticks.
+ *
+ * @param pxTask The async task being delayed, as passed into the async task
+ * function.
+ *
+ * @param xTicksToDelay The number of ticks to delay for.
+ *
+ * \defgroup asyncDELAY asyncDELAY
+ * \ingroup AsyncTasks
+ */
+#define asyncDELAY( pxTask, xTicksToDelay )                                             \
+    do {                                                                                \
+        BaseType_t xAsyncDelayResult;                                                   \
+        asyncWAIT_UNTIL( ( pxTask ), pdFALSE, ( xTicksToDelay ), pdFALSE, &xAsyncDelayResult ); \
+        ( void ) xAsyncDelayResult;                                                     \
+    } while( 0 )
+
+/**
+ * async_task.h
+ * @code{c}
+ * asyncNOTIFY_TAKE( AsyncTask_t * pxTask, TickType_t xTicksToWait, BaseType_t * pxResult );
+ * @endcode
+ *
+ * Wait for a notification sent with vAsyncTaskNotifyGive() or
+ * vAsyncTaskNotifyGiveFromISR(), taking one from the count of notifications
+ * received.
+ *
+ * @param pxTask The async task, as passed into the async task function.
+ *
+ * @param xTicksToWait The maximum number of ticks to wait for.
+ *
+ * @param pxResult Set to pdPASS if a notification was taken, or pdFAIL if
+ * xTicksToWait expired first.
+ *
+ * \defgroup asyncNOTIFY_TAKE asyncNOTIFY_TAKE
+ * \ingroup AsyncTasks
+ */
+#define asyncNOTIFY_TAKE( pxTask, xTicksToWait, pxResult ) \
+    asyncWAIT_UNTIL( ( pxTask ), ( xAsyncTaskInternalNotifyTake( pxTask ) != pdFALSE ), ( xTicksToWait ), pdFALSE, ( pxResult ) )
+
+/**
+ * async_task.h
+ * @code{c}
+ * asyncQUEUE_SEND( AsyncTask_t * pxTask, QueueHandle_t xQueue, const void * pvItemToQueue, TickType_t xTicksToWait, BaseType_t * pxResult );
+ * @endcode
+ *
+ * Send an item to the back of a queue, waiting for up to xTicksToWait ticks
+ * for space to become available.
+ *
+ * @param pxTask The async task, as passed into the async task function.
+ *
+ * @param xQueue The queue being sent to.
+ *
+ * @param pvItemToQueue The item being sent, which must not be a local variable
+ * of the async task function.
+ *
+ * @param xTicksToWait The maximum number of ticks to wait for.
+ *
+ * @param pxResult Set to pdPASS if the item was sent, or pdFAIL if
+ * xTicksToWait expired first.
+ *
+ * \defgroup asyncQUEUE_SEND asyncQUEUE_SEND
+ * \ingroup AsyncTasks
+ */
+#define asyncQUEUE_SEND( pxTask, xQueue, pvItemToQueue, xTicksToWait, pxResult ) \
+    asyncWAIT_UNTIL( ( pxTask ), ( xQueueSend( ( xQueue ), ( pvItemToQueue ), 0 ) == pdPASS ), ( xTicksToWait ), pdTRUE, ( pxResult ) )
+
+/**
+ * async_task.h
+ * @code{c}
+ * asyncQUEUE_RECEIVE( AsyncTask_t * pxTask, QueueHandle_t xQueue, void * pvBuffer, TickType_t xTicksToWait, BaseType_t * pxResult );
+ * @endcode
+ *
+ * Receive an item from a queue, waiting for up to xTicksToWait ticks for an
+ * item to become available.
+ *
+ * @param pxTask The async task, as passed into the async task function.
+ *
+ * @param xQueue The queue being received from.
+ *
+ * @param pvBuffer The buffer the item is copied into, which must not be a
+ * local variable of the async task function.
+ *
+ * @param xTicksToWait The maximum number of ticks to wait for.
+ *
+ * @param pxResult Set to pdPASS if an item was received, or pdFAIL if
+ * xTicksToWait expired first.
+ *
+ * \defgroup asyncQUEUE_RECEIVE asyncQUEUE_RECEIVE
+ * \ingroup AsyncTasks
+ */
+#define asyncQUEUE_RECEIVE( pxTask, xQueue, pvBuffer, xTicksToWait, pxResult ) \
+    asyncWAIT_UNTIL( ( pxTask ), ( xQueueReceive( ( xQueue ), ( pvBuffer ), 0 ) == pdPASS ), ( xTicksToWait ), pdTRUE, ( pxResult ) )
+
+/**
+ * async_task.h
+ * @code{c}
+ * asyncSTREAM_BUFFER_SEND( AsyncTask_t * pxTask, StreamBufferHandle_t xStreamBuffer, const void * pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait, BaseType_t * pxResult );
+ * @endcode
+ *
+ * Send xDataLengthBytes bytes to a stream buffer, waiting for up to
+ * xTicksToWait ticks for there to be space for all of them.  Either all the
+ * bytes are sent or none are.
+ *
+ * @param pxTask The async task, as passed into the async task function.
+ *
+ * @param xStreamBuffer The stream buffer being sent to.
+ *
+ * @param pvTxData The data being sent, which must not be a local variable of
+ * the async task function.
+ *
+ * @param xDataLengthBytes The number of bytes to send.
+ *
+ * @param xTicksToWait The maximum number of ticks to wait for.
+ *
+ * @param pxResult Set to pdPASS if the bytes were sent, or pdFAIL if
+ * xTicksToWait expired first.
+ *
+ * \defgroup asyncSTREAM_BUFFER_SEND asyncSTREAM_BUFFER_SEND
+ * \ingroup AsyncTasks
+ */
+#define asyncSTREAM_BUFFER_SEND( pxTask, xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait, pxResult )                 \
+    asyncWAIT_UNTIL( ( pxTask ),                                                                                             \
+                     ( ( xStreamBufferSpacesAvailable( xStreamBuffer ) >= ( xDataLengthBytes ) ) &&                          \
+                       ( xStreamBufferSend( ( xStreamBuffer ), ( pvTxData ), ( xDataLengthBytes ), 0 ) == ( xDataLengthBytes ) ) ), \
+                     ( xTicksToWait ), pdTRUE, ( pxResult ) )
+
+/**
+ * async_task.h
+ * @code{c}
+ * asyncSTREAM_BUFFER_RECEIVE( AsyncTask_t * pxTask, StreamBufferHandle_t xStreamBuffer, void * pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait, size_t * pxReceivedBytes );
+ * @endcode
+ *
+ * Receive bytes from a stream buffer, waiting for up to xTicksToWait ticks for
+ * at least one byte to become available.
+ *
+ * @param pxTask The async task, as passed into the async task function.
+ *
+ * @param xStreamBuffer The stream buffer being received from.
+ *
+ * @param pvRxData The buffer the bytes are copied into, which must not be a
+ * local variable of the async task function.
+ *
+ * @param xBufferLengthBytes The size of the buffer pointed to by pvRxData.
+ *
+ * @param xTicksToWait The maximum number of ticks to wait for.
+ *
+ * @param pxReceivedBytes Set to the number of bytes received, which is 0 if
+ * xTicksToWait expired first.
+ *
+ * \defgroup asyncSTREAM_BUFFER_RECEIVE asyncSTREAM_BUFFER_RECEIVE
+ * \ingroup AsyncTasks
+ */
+#define asyncSTREAM_BUFFER_RECEIVE( pxTask, xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait, pxReceivedBytes )        \
+    do {                                                                                                                     \
+        BaseType_t xAsyncReceiveResult;                                                                                      \
+        asyncWAIT_UNTIL( ( pxTask ),                                                                                         \
+                         ( ( *( pxReceivedBytes ) = xStreamBufferReceive( ( xStreamBuffer ), ( pvRxData ), ( xBufferLengthBytes ), 0 ) ) > ( size_t ) 0 ), \
+                         ( xTicksToWait ), pdTRUE, &xAsyncReceiveResult );                                                   \
+        ( void ) xAsyncReceiveResult;                                                                                        \
+    } while( 0 )
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ASYNC_TASK_H */
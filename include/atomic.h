@@ -34,6 +34,14 @@
  * Implementations with architecture specific atomic instructions can be
  * provided under each compiler directory.
  *
+ * If configUSE_COMPILER_ATOMICS is set to 1 in FreeRTOSConfig.h, and the
+ * compiler supports the GCC __atomic builtins, the functions are instead
+ * implemented with the target's native atomic instructions (for example
+ * LDREX/STREX on ARMv7-M and ARMv8-M, the RISC-V 'A' extension or the AArch64
+ * LSE instructions) for each width the compiler reports as always lock-free.
+ * Widths that are not lock-free on the target, such as 64-bit values on
+ * ARMv7-M, still disable interrupts.
+ *
  * The atomic interface can be used in FreeRTOS tasks on all FreeRTOS ports. It
  * can also be used in Interrupt Service Routines (ISRs) on FreeRTOS ports that
  * support nested interrupts (i.e. portHAS_NESTED_INTERRUPTS is set to 1). The
@@ -88,16 +96,63 @@
  * Port specific definition -- "always inline".
  * Inline is compiler specific, and may not always get inlined depending on your
  * optimization level.  Also, inline is considered as performance optimization
- * for atomic.  Thus, if portFORCE_INLINE is not provided by portmacro.h,
- * instead of resulting error, simply define it away.
+ * for atomic.  Thus, if portFORCE_INLINE is not provided by portmacro.h, fall
+ * back to a plain inline request, which also stops the compiler warning about
+ * the functions a source file does not use.
  */
 #ifndef portFORCE_INLINE
-    #define portFORCE_INLINE
+    #define portFORCE_INLINE    inline
 #endif
 
 #define ATOMIC_COMPARE_AND_SWAP_SUCCESS    0x1U     /**< Compare and swap succeeded, swapped. */
 #define ATOMIC_COMPARE_AND_SWAP_FAILURE    0x0U     /**< Compare and swap failed, did not swap. */
 
+/*
+ * Select the native implementation for each width the compiler can access
+ * without a lock.  A value of 2 for __GCC_ATOMIC_*_LOCK_FREE means always
+ * lock-free, so the builtins will not be turned into library calls.
+ */
+#if ( configUSE_COMPILER_ATOMICS == 1 ) && defined( __GCC_ATOMIC_INT_LOCK_FREE ) && ( __GCC_ATOMIC_INT_LOCK_FREE == 2 )
+    #define atomicUSE_BUILTINS_32    1
+#else
+    #define atomicUSE_BUILTINS_32    0
+#endif
+
+#if ( configUSE_COMPILER_ATOMICS == 1 ) && defined( __GCC_ATOMIC_LLONG_LOCK_FREE ) && ( __GCC_ATOMIC_LLONG_LOCK_FREE == 2 )
+    #define atomicUSE_BUILTINS_64    1
+#else
+    #define atomicUSE_BUILTINS_64    0
+#endif
+
+#if ( configUSE_COMPILER_ATOMICS == 1 ) && defined( __GCC_ATOMIC_POINTER_LOCK_FREE ) && ( __GCC_ATOMIC_POINTER_LOCK_FREE == 2 )
+    #define atomicUSE_BUILTINS_POINTER    1
+#else
+    #define atomicUSE_BUILTINS_POINTER    0
+#endif
+
+/*
+ * Memory orders for the *Explicit functions, with the meanings of the C11
+ * memory_order values of the same names.  The functions that disable
+ * interrupts are always sequentially consistent and ignore the order.
+ */
+#if ( configUSE_COMPILER_ATOMICS == 1 ) && defined( __ATOMIC_SEQ_CST )
+    #define ATOMIC_ORDER_RELAXED    __ATOMIC_RELAXED
+    #define ATOMIC_ORDER_ACQUIRE    __ATOMIC_ACQUIRE
+    #define ATOMIC_ORDER_RELEASE    __ATOMIC_RELEASE
+    #define ATOMIC_ORDER_ACQ_REL    __ATOMIC_ACQ_REL
+    #define ATOMIC_ORDER_SEQ_CST    __ATOMIC_SEQ_CST
+#else
+    #define ATOMIC_ORDER_RELAXED    0
+    #define ATOMIC_ORDER_ACQUIRE    2
+    #define ATOMIC_ORDER_RELEASE    3
+    #define ATOMIC_ORDER_ACQ_REL    4
+    #define ATOMIC_ORDER_SEQ_CST    5
+#endif
+
+/* A failed compare and swap only loads, so cannot have release semantics. */
+#define atomicFAILURE_ORDER( xOrder ) \
+    ( ( ( xOrder ) == ATOMIC_ORDER_RELEASE ) ? ATOMIC_ORDER_RELAXED : ( ( ( xOrder ) == ATOMIC_ORDER_ACQ_REL ) ? ATOMIC_ORDER_ACQUIRE : ( xOrder ) ) )
+
 /*----------------------------- Swap && CAS ------------------------------*/
 
 /**
@@ -121,19 +176,29 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwap_u32( uint32_t volatile *
 {
     uint32_t ulReturnValue;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
     {
-        if( *pulDestination == ulComparand )
-        {
-            *pulDestination = ulExchange;
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
-        }
-        else
+        uint32_t ulExpected = ulComparand;
+
+        ulReturnValue = ( __atomic_compare_exchange_n( pulDestination, &ulExpected, ulExchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) ) ? ATOMIC_COMPARE_AND_SWAP_SUCCESS : ATOMIC_COMPARE_AND_SWAP_FAILURE;
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
         {
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            if( *pulDestination == ulComparand )
+            {
+                *pulDestination = ulExchange;
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
+            else
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            }
         }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulReturnValue;
 }
@@ -156,12 +221,20 @@ static portFORCE_INLINE void * Atomic_SwapPointers_p32( void * volatile * ppvDes
 {
     void * pReturnValue;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_POINTER == 1 )
     {
-        pReturnValue = *ppvDestination;
-        *ppvDestination = pvExchange;
+        pReturnValue = __atomic_exchange_n( ppvDestination, pvExchange, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            pReturnValue = *ppvDestination;
+            *ppvDestination = pvExchange;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return pReturnValue;
 }
@@ -189,15 +262,25 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwapPointers_p32( void * volat
 {
     uint32_t ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_POINTER == 1 )
+    {
+        void * pvExpected = pvComparand;
+
+        ulReturnValue = ( __atomic_compare_exchange_n( ppvDestination, &pvExpected, pvExchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) ) ? ATOMIC_COMPARE_AND_SWAP_SUCCESS : ATOMIC_COMPARE_AND_SWAP_FAILURE;
+    }
+    #else
     {
-        if( *ppvDestination == pvComparand )
+        ATOMIC_ENTER_CRITICAL();
         {
-            *ppvDestination = pvExchange;
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            if( *ppvDestination == pvComparand )
+            {
+                *ppvDestination = pvExchange;
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
         }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulReturnValue;
 }
@@ -221,12 +304,20 @@ static portFORCE_INLINE uint32_t Atomic_Add_u32( uint32_t volatile * pulAddend,
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        ulCurrent = __atomic_fetch_add( pulAddend, ulCount, __ATOMIC_SEQ_CST );
+    }
+    #else
     {
-        ulCurrent = *pulAddend;
-        *pulAddend += ulCount;
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend += ulCount;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -249,12 +340,20 @@ static portFORCE_INLINE uint32_t Atomic_Subtract_u32( uint32_t volatile * pulAdd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend -= ulCount;
+        ulCurrent = __atomic_fetch_sub( pulAddend, ulCount, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend -= ulCount;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -274,12 +373,20 @@ static portFORCE_INLINE uint32_t Atomic_Increment_u32( uint32_t volatile * pulAd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend += 1;
+        ulCurrent = __atomic_fetch_add( pulAddend, 1U, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend += 1;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -299,12 +406,20 @@ static portFORCE_INLINE uint32_t Atomic_Decrement_u32( uint32_t volatile * pulAd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        ulCurrent = __atomic_fetch_sub( pulAddend, 1U, __ATOMIC_SEQ_CST );
+    }
+    #else
     {
-        ulCurrent = *pulAddend;
-        *pulAddend -= 1;
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend -= 1;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -327,12 +442,20 @@ static portFORCE_INLINE uint32_t Atomic_OR_u32( uint32_t volatile * pulDestinati
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        ulCurrent = __atomic_fetch_or( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
     {
-        ulCurrent = *pulDestination;
-        *pulDestination |= ulValue;
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination |= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -354,12 +477,20 @@ static portFORCE_INLINE uint32_t Atomic_AND_u32( uint32_t volatile * pulDestinat
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        ulCurrent = __atomic_fetch_and( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
     {
-        ulCurrent = *pulDestination;
-        *pulDestination &= ulValue;
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination &= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -381,12 +512,20 @@ static portFORCE_INLINE uint32_t Atomic_NAND_u32( uint32_t volatile * pulDestina
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
     {
-        ulCurrent = *pulDestination;
-        *pulDestination = ~( ulCurrent & ulValue );
+        ulCurrent = __atomic_fetch_nand( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination = ~( ulCurrent & ulValue );
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -408,15 +547,432 @@ static portFORCE_INLINE uint32_t Atomic_XOR_u32( uint32_t volatile * pulDestinat
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        ulCurrent = __atomic_fetch_xor( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination ^= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+
+    return ulCurrent;
+}
+
+/*----------------------------- Explicit order ------------------------------*/
+
+/**
+ * Atomic load
+ *
+ * @brief Atomically reads the value the specified pointer points to.
+ *
+ * @param[in] pulSource  Pointer to memory location from where value is to be
+ *                       loaded.
+ * @param[in] xOrder     One of the ATOMIC_ORDER_* memory orders, other than
+ *                       ATOMIC_ORDER_RELEASE and ATOMIC_ORDER_ACQ_REL.
+ *
+ * @return The value of *pulSource.
+ */
+static portFORCE_INLINE uint32_t Atomic_Load_u32( uint32_t const volatile * pulSource,
+                                                  int xOrder )
+{
+    uint32_t ulCurrent;
+
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        ulCurrent = __atomic_load_n( pulSource, xOrder );
+    }
+    #else
+    {
+        ( void ) xOrder;
+
+        /* An aligned 32-bit read cannot be torn on any FreeRTOS target. */
+        ulCurrent = *pulSource;
+    }
+    #endif
+
+    return ulCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic store
+ *
+ * @brief Atomically writes a value to the memory location the specified
+ *        pointer points to.
+ *
+ * @param[out] pulDestination  Pointer to memory location to be written.
+ * @param[in] ulValue          Value to write to *pulDestination.
+ * @param[in] xOrder           One of ATOMIC_ORDER_RELAXED,
+ *                             ATOMIC_ORDER_RELEASE or ATOMIC_ORDER_SEQ_CST.
+ */
+static portFORCE_INLINE void Atomic_Store_u32( uint32_t volatile * pulDestination,
+                                               uint32_t ulValue,
+                                               int xOrder )
+{
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        __atomic_store_n( pulDestination, ulValue, xOrder );
+    }
+    #else
+    {
+        ( void ) xOrder;
+        *pulDestination = ulValue;
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic compare-and-swap with an explicit memory order
+ *
+ * @brief As Atomic_CompareAndSwap_u32(), but with the memory order given by
+ *        xOrder when the swap succeeds.  A failed swap uses the strongest
+ *        order that is valid for a load and not stronger than xOrder.
+ *
+ * @param[in, out] pulDestination  Pointer to memory location from where value is
+ *                               to be loaded and checked.
+ * @param[in] ulExchange         If condition meets, write this value to memory.
+ * @param[in] ulComparand        Swap condition.
+ * @param[in] xOrder             One of the ATOMIC_ORDER_* memory orders.
+ *
+ * @return Unsigned integer of value 1 or 0. 1 for swapped, 0 for not swapped.
+ */
+static portFORCE_INLINE uint32_t Atomic_CompareAndSwapExplicit_u32( uint32_t volatile * pulDestination,
+                                                                    uint32_t ulExchange,
+                                                                    uint32_t ulComparand,
+                                                                    int xOrder )
+{
+    uint32_t ulReturnValue;
+
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        uint32_t ulExpected = ulComparand;
+
+        ulReturnValue = ( __atomic_compare_exchange_n( pulDestination, &ulExpected, ulExchange, 0, xOrder, atomicFAILURE_ORDER( xOrder ) ) ) ? ATOMIC_COMPARE_AND_SWAP_SUCCESS : ATOMIC_COMPARE_AND_SWAP_FAILURE;
+    }
+    #else
+    {
+        ( void ) xOrder;
+        ulReturnValue = Atomic_CompareAndSwap_u32( pulDestination, ulExchange, ulComparand );
+    }
+    #endif
+
+    return ulReturnValue;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic add with an explicit memory order
+ *
+ * @brief As Atomic_Add_u32(), but with the memory order given by xOrder.
+ *
+ * @param[in,out] pulAddend  Pointer to memory location from where value is to be
+ *                         loaded and written back to.
+ * @param[in] ulCount      Value to be added to *pulAddend.
+ * @param[in] xOrder       One of the ATOMIC_ORDER_* memory orders.
+ *
+ * @return previous *pulAddend value.
+ */
+static portFORCE_INLINE uint32_t Atomic_AddExplicit_u32( uint32_t volatile * pulAddend,
+                                                         uint32_t ulCount,
+                                                         int xOrder )
+{
+    uint32_t ulCurrent;
+
+    #if ( atomicUSE_BUILTINS_32 == 1 )
     {
-        ulCurrent = *pulDestination;
-        *pulDestination ^= ulValue;
+        ulCurrent = __atomic_fetch_add( pulAddend, ulCount, xOrder );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ( void ) xOrder;
+        ulCurrent = Atomic_Add_u32( pulAddend, ulCount );
+    }
+    #endif
+
+    return ulCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic subtract with an explicit memory order
+ *
+ * @brief As Atomic_Subtract_u32(), but with the memory order given by xOrder.
+ *
+ * @param[in,out] pulAddend  Pointer to memory location from where value is to be
+ *                         loaded and written back to.
+ * @param[in] ulCount      Value to be subtract from *pulAddend.
+ * @param[in] xOrder       One of the ATOMIC_ORDER_* memory orders.
+ *
+ * @return previous *pulAddend value.
+ */
+static portFORCE_INLINE uint32_t Atomic_SubtractExplicit_u32( uint32_t volatile * pulAddend,
+                                                              uint32_t ulCount,
+                                                              int xOrder )
+{
+    uint32_t ulCurrent;
+
+    #if ( atomicUSE_BUILTINS_32 == 1 )
+    {
+        ulCurrent = __atomic_fetch_sub( pulAddend, ulCount, xOrder );
+    }
+    #else
+    {
+        ( void ) xOrder;
+        ulCurrent = Atomic_Subtract_u32( pulAddend, ulCount );
+    }
+    #endif
 
     return ulCurrent;
 }
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic load (pointers)
+ *
+ * @brief Atomically reads the pointer the specified pointer points to.
+ *
+ * @param[in] ppvSource  Pointer to memory location from where a pointer value
+ *                       is to be loaded.
+ * @param[in] xOrder     One of the ATOMIC_ORDER_* memory orders, other than
+ *                       ATOMIC_ORDER_RELEASE and ATOMIC_ORDER_ACQ_REL.
+ *
+ * @return The value of *ppvSource.
+ */
+static portFORCE_INLINE void * Atomic_LoadPointer( void * const volatile * ppvSource,
+                                                   int xOrder )
+{
+    void * pvCurrent;
+
+    #if ( atomicUSE_BUILTINS_POINTER == 1 )
+    {
+        pvCurrent = __atomic_load_n( ppvSource, xOrder );
+    }
+    #else
+    {
+        ( void ) xOrder;
+        pvCurrent = *ppvSource;
+    }
+    #endif
+
+    return pvCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic store (pointers)
+ *
+ * @brief Atomically writes a pointer to the memory location the specified
+ *        pointer points to.
+ *
+ * @param[out] ppvDestination  Pointer to memory location to be written.
+ * @param[in] pvValue          Pointer value to write to *ppvDestination.
+ * @param[in] xOrder           One of ATOMIC_ORDER_RELAXED,
+ *                             ATOMIC_ORDER_RELEASE or ATOMIC_ORDER_SEQ_CST.
+ */
+static portFORCE_INLINE void Atomic_StorePointer( void * volatile * ppvDestination,
+                                                  void * pvValue,
+                                                  int xOrder )
+{
+    #if ( atomicUSE_BUILTINS_POINTER == 1 )
+    {
+        __atomic_store_n( ppvDestination, pvValue, xOrder );
+    }
+    #else
+    {
+        ( void ) xOrder;
+        *ppvDestination = pvValue;
+    }
+    #endif
+}
+
+/*----------------------------- 64-bit ------------------------------*/
+
+/**
+ * Atomic compare-and-swap (64-bit)
+ *
+ * @brief As Atomic_CompareAndSwap_u32(), for a 64-bit value.
+ *
+ * @param[in, out] pullDestination  Pointer to memory location from where value
+ *                                is to be loaded and checked.
+ * @param[in] ullExchange         If condition meets, write this value to memory.
+ * @param[in] ullComparand        Swap condition.
+ *
+ * @return Unsigned integer of value 1 or 0. 1 for swapped, 0 for not swapped.
+ */
+static portFORCE_INLINE uint32_t Atomic_CompareAndSwap_u64( uint64_t volatile * pullDestination,
+                                                            uint64_t ullExchange,
+                                                            uint64_t ullComparand )
+{
+    uint32_t ulReturnValue;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+    {
+        uint64_t ullExpected = ullComparand;
+
+        ulReturnValue = ( __atomic_compare_exchange_n( pullDestination, &ullExpected, ullExchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) ) ? ATOMIC_COMPARE_AND_SWAP_SUCCESS : ATOMIC_COMPARE_AND_SWAP_FAILURE;
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            if( *pullDestination == ullComparand )
+            {
+                *pullDestination = ullExchange;
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
+            else
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            }
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+
+    return ulReturnValue;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic add (64-bit)
+ *
+ * @brief Atomically adds count to the 64-bit value the specified pointer
+ *        points to.
+ *
+ * @param[in,out] pullAddend  Pointer to memory location from where value is to
+ *                          be loaded and written back to.
+ * @param[in] ullCount      Value to be added to *pullAddend.
+ *
+ * @return previous *pullAddend value.
+ */
+static portFORCE_INLINE uint64_t Atomic_Add_u64( uint64_t volatile * pullAddend,
+                                                 uint64_t ullCount )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+    {
+        ullCurrent = __atomic_fetch_add( pullAddend, ullCount, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ullCurrent = *pullAddend;
+            *pullAddend += ullCount;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic subtract (64-bit)
+ *
+ * @brief Atomically subtracts count from the 64-bit value the specified
+ *        pointer points to.
+ *
+ * @param[in,out] pullAddend  Pointer to memory location from where value is to
+ *                          be loaded and written back to.
+ * @param[in] ullCount      Value to be subtract from *pullAddend.
+ *
+ * @return previous *pullAddend value.
+ */
+static portFORCE_INLINE uint64_t Atomic_Subtract_u64( uint64_t volatile * pullAddend,
+                                                      uint64_t ullCount )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+    {
+        ullCurrent = __atomic_fetch_sub( pullAddend, ullCount, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ullCurrent = *pullAddend;
+            *pullAddend -= ullCount;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic load (64-bit)
+ *
+ * @brief Atomically reads the 64-bit value the specified pointer points to.
+ *        Unlike a 32-bit read, a plain 64-bit read can be torn on a 32-bit
+ *        target.
+ *
+ * @param[in] pullSource  Pointer to memory location from where value is to be
+ *                        loaded.
+ *
+ * @return The value of *pullSource.
+ */
+static portFORCE_INLINE uint64_t Atomic_Load_u64( uint64_t const volatile * pullSource )
+{
+    uint64_t ullCurrent;
+
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+    {
+        ullCurrent = __atomic_load_n( pullSource, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ullCurrent = *pullSource;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+
+    return ullCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic store (64-bit)
+ *
+ * @brief Atomically writes a 64-bit value to the memory location the
+ *        specified pointer points to.
+ *
+ * @param[out] pullDestination  Pointer to memory location to be written.
+ * @param[in] ullValue          Value to write to *pullDestination.
+ */
+static portFORCE_INLINE void Atomic_Store_u64( uint64_t volatile * pullDestination,
+                                               uint64_t ullValue )
+{
+    #if ( atomicUSE_BUILTINS_64 == 1 )
+    {
+        __atomic_store_n( pullDestination, ullValue, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            *pullDestination = ullValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+}
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -0,0 +1,168 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef BARRIER_H
+#define BARRIER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include barrier.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Returned by xBarrierWait() to the task whose arrival released the barrier. */
+#define barrierLAST_ARRIVAL    ( ( BaseType_t ) 2 )
+
+/**
+ * A barrier holds back a fixed number of participating tasks until all of them
+ * have called xBarrierWait(), then releases them together.  It can be used for
+ * any number of rounds, or phases, without being reset.
+ *
+ * The number of tasks that have arrived and the phase number are held in a
+ * single word that is updated by compare and swap, so arriving costs no
+ * critical section.  Only tasks that have to block enter the kernel, and the
+ * last task to arrive enters it once to unblock them all.
+ *
+ * Barriers cannot be used from interrupts.  The application provides the
+ * memory, and must call vBarrierInit() before the barrier is used.
+ *
+ * Set configUSE_BARRIERS to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup Barrier_t Barrier_t
+ * \ingroup Barriers
+ */
+typedef struct xBARRIER
+{
+    volatile uint32_t ulState;  /**< The phase number in the upper 16 bits, and the number of tasks that have arrived in the phase in the lower 16 bits. */
+    uint32_t ulParticipants;    /**< The number of tasks that must arrive to release the barrier. */
+    List_t xTasksWaiting;       /**< Tasks blocked waiting for the barrier to be released, in priority order. */
+} Barrier_t;
+
+/**
+ * barrier.h
+ * @code{c}
+ * void vBarrierInit( Barrier_t * pxBarrier, UBaseType_t uxParticipants );
+ * @endcode
+ *
+ * Initialise a barrier that is released each time uxParticipants tasks have
+ * arrived at it.  Must not be called while any task is waiting at the barrier.
+ *
+ * @param pxBarrier The barrier being initialised.
+ *
+ * @param uxParticipants The number of tasks that must arrive to release the
+ * barrier, from 1 to 65535.
+ *
+ * \defgroup vBarrierInit vBarrierInit
+ * \ingroup Barriers
+ */
+void vBarrierInit( Barrier_t * pxBarrier,
+                   UBaseType_t uxParticipants ) PRIVILEGED_FUNCTION;
+
+/**
+ * barrier.h
+ * @code{c}
+ * BaseType_t xBarrierWait( Barrier_t * pxBarrier, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Arrive at a barrier, then wait in the Blocked state for up to xTicksToWait
+ * ticks for the remaining participants to arrive.  The last task to arrive
+ * does not block, but releases the barrier and unblocks the waiting tasks.
+ * Must only be called from a task.
+ *
+ * A task that times out withdraws its arrival, so the barrier is not released
+ * without it.  If the barrier is released at the same time the task returns as
+ * though it had not timed out.
+ *
+ * Example usage:
+ * @code{c}
+ * Barrier_t xPhaseBarrier;
+ *
+ * void vPipelineStage( void * pvParameters )
+ * {
+ *     for( ;; )
+ *     {
+ *         // Process this stage's share of the current phase.
+ *         vProcessPhase( pvParameters );
+ *
+ *         // Wait for the other stages to finish the phase.
+ *         if( xBarrierWait( &xPhaseBarrier, portMAX_DELAY ) == barrierLAST_ARRIVAL )
+ *         {
+ *             // Exactly one stage gets here in each phase.
+ *             vPublishPhaseResults();
+ *         }
+ *     }
+ * }
+ * @endcode
+ *
+ * @param pxBarrier The barrier to wait at.
+ *
+ * @param xTicksToWait The maximum time to wait for the barrier to be released.
+ * Setting xTicksToWait to 0 returns immediately if the calling task is not the
+ * last to arrive.
+ *
+ * @return barrierLAST_ARRIVAL to the task whose arrival released the barrier,
+ * pdPASS to the other tasks released, or pdFAIL if xTicksToWait expired before
+ * the barrier was released.
+ *
+ * \defgroup xBarrierWait xBarrierWait
+ * \ingroup Barriers
+ */
+BaseType_t xBarrierWait( Barrier_t * pxBarrier,
+                         TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * barrier.h
+ * @code{c}
+ * UBaseType_t uxBarrierGetPhase( const Barrier_t * pxBarrier );
+ * @endcode
+ *
+ * @param pxBarrier The barrier being queried.
+ *
+ * @return The number of times the barrier has been released, modulo 65536.
+ *
+ * \defgroup uxBarrierGetPhase uxBarrierGetPhase
+ * \ingroup Barriers
+ */
+UBaseType_t uxBarrierGetPhase( const Barrier_t * pxBarrier ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* BARRIER_H */
@@ -0,0 +1,224 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef COMPLETION_H
+#define COMPLETION_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include completion.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A completion lets a task start an operation that finishes in an interrupt,
+ * such as a DMA transfer, then block until the interrupt reports that the
+ * operation has completed.  The interrupt passes a 32-bit status word, for
+ * example an error code or the number of bytes transferred, back to the task.
+ *
+ * A completion is three words of application provided memory.  The waiting
+ * task is unblocked with a direct to task notification at index
+ * configCOMPLETION_NOTIFY_INDEX, so a completion costs neither a queue nor a
+ * semaphore, and signalling it from an interrupt is a short critical section
+ * and a notification.  That notification index should not be used for any
+ * other purpose by tasks that wait on completions.
+ *
+ * A completion is used by one task at a time.  The task calls
+ * vCompletionArm(), starts the operation, then calls xCompletionWait().  The
+ * interrupt calls vCompletionSignalFromISR(), or another task calls
+ * vCompletionSignal().  Arming the completion before the operation is started
+ * means a signal that arrives before the task calls xCompletionWait() is not
+ * lost.  The application provides the memory, and must call vCompletionInit()
+ * before the completion is used.
+ *
+ * Set configUSE_COMPLETIONS to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup Completion_t Completion_t
+ * \ingroup Completions
+ */
+typedef struct xCOMPLETION
+{
+    volatile TaskHandle_t xTaskToNotify; /**< The task that armed the completion, or NULL if no task is waiting for it. */
+    volatile uint32_t ulStatus;          /**< The status word passed when the completion was signalled. */
+    volatile BaseType_t xSignalled;      /**< pdTRUE once the completion has been signalled since it was last armed. */
+} Completion_t;
+
+/**
+ * completion.h
+ * @code{c}
+ * void vCompletionInit( Completion_t * pxCompletion );
+ * @endcode
+ *
+ * Initialise a completion.  The completion is left unarmed and unsignalled.
+ *
+ * @param pxCompletion The completion being initialised.
+ *
+ * \defgroup vCompletionInit vCompletionInit
+ * \ingroup Completions
+ */
+void vCompletionInit( Completion_t * pxCompletion ) PRIVILEGED_FUNCTION;
+
+/**
+ * completion.h
+ * @code{c}
+ * void vCompletionArm( Completion_t * pxCompletion );
+ * @endcode
+ *
+ * Prepare a completion to be waited on by the calling task.  Clears the
+ * signalled state and status word left by any previous operation.  Must be
+ * called from a task before the operation that will signal the completion is
+ * started.
+ *
+ * @param pxCompletion The completion being armed.
+ *
+ * \defgroup vCompletionArm vCompletionArm
+ * \ingroup Completions
+ */
+void vCompletionArm( Completion_t * pxCompletion ) PRIVILEGED_FUNCTION;
+
+/**
+ * completion.h
+ * @code{c}
+ * BaseType_t xCompletionWait( Completion_t * pxCompletion, uint32_t * pulStatus, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Wait in the Blocked state for up to xTicksToWait ticks for a completion
+ * armed by the calling task to be signalled.  If the wait times out the
+ * completion is disarmed, so a signal that arrives later does not notify the
+ * task.  If the completion is signalled at the same time the task returns as
+ * though it had not timed out.
+ *
+ * The example below reads from a peripheral by DMA straight into a stream
+ * buffer, using the zero-copy region functions so the DMA descriptor points
+ * into the stream buffer's storage area and the data is not copied.  The
+ * interrupt passes the number of bytes transferred as the status word.
+ *
+ * Example usage:
+ * @code{c}
+ * Completion_t xRxComplete;
+ *
+ * void vRxDMAInterruptHandler( void )
+ * {
+ *     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *     vCompletionSignalFromISR( &xRxComplete, ulDMAGetBytesTransferred(), &xHigherPriorityTaskWoken );
+ *     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ *
+ * void vReceive( StreamBufferHandle_t xStreamBuffer )
+ * {
+ *     uint8_t * pucRegion;
+ *     uint32_t ulBytesReceived;
+ *     size_t xLength;
+ *
+ *     xLength = xStreamBufferGetWriteRegion( xStreamBuffer, &pucRegion, 0 );
+ *
+ *     if( xLength > 0 )
+ *     {
+ *         vCompletionArm( &xRxComplete );
+ *         vDMAStartReceive( pucRegion, xLength );
+ *
+ *         if( xCompletionWait( &xRxComplete, &ulBytesReceived, pdMS_TO_TICKS( 100 ) ) == pdPASS )
+ *         {
+ *             ( void ) xStreamBufferCommitWrite( xStreamBuffer, ( size_t ) ulBytesReceived );
+ *         }
+ *         else
+ *         {
+ *             vDMAAbort();
+ *         }
+ *     }
+ * }
+ * @endcode
+ *
+ * @param pxCompletion The completion to wait for.
+ *
+ * @param pulStatus If the completion is signalled and pulStatus is not NULL,
+ * *pulStatus is set to the status word passed when it was signalled.
+ *
+ * @param xTicksToWait The maximum time to wait for the completion to be
+ * signalled.
+ *
+ * @return pdPASS if the completion was signalled, or pdFAIL if xTicksToWait
+ * expired first.
+ *
+ * \defgroup xCompletionWait xCompletionWait
+ * \ingroup Completions
+ */
+BaseType_t xCompletionWait( Completion_t * pxCompletion,
+                            uint32_t * pulStatus,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * completion.h
+ * @code{c}
+ * void vCompletionSignal( Completion_t * pxCompletion, uint32_t ulStatus );
+ * void vCompletionSignalFromISR( Completion_t * pxCompletion, uint32_t ulStatus, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Signal a completion, passing ulStatus to the task waiting for it and
+ * unblocking that task.  vCompletionSignal() must only be called from a task,
+ * and vCompletionSignalFromISR() from an interrupt service routine.
+ *
+ * Signalling a completion that is not armed records the status word, but
+ * notifies no task.
+ *
+ * @param pxCompletion The completion being signalled.
+ *
+ * @param ulStatus The status word returned to the waiting task.
+ *
+ * @param pxHigherPriorityTaskWoken vCompletionSignalFromISR() sets
+ * *pxHigherPriorityTaskWoken to pdTRUE if signalling the completion unblocked
+ * a task with a priority higher than the currently running task, in which
+ * case a context switch should be requested before the interrupt is exited.
+ *
+ * \defgroup vCompletionSignal vCompletionSignal
+ * \ingroup Completions
+ */
+void vCompletionSignal( Completion_t * pxCompletion,
+                        uint32_t ulStatus ) PRIVILEGED_FUNCTION;
+
+void vCompletionSignalFromISR( Completion_t * pxCompletion,
+                               uint32_t ulStatus,
+                               BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* COMPLETION_H */
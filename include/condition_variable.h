@@ -0,0 +1,188 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef CONDITION_VARIABLE_H
+#define CONDITION_VARIABLE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include condition_variable.h"
+#endif
+
+#include "semphr.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A condition variable lets a task that holds a mutex wait for a predicate
+ * protected by the mutex to become true.  xCondWait() releases the mutex and
+ * blocks the task on the condition variable in one step, so a signal sent
+ * between the two cannot be missed, then takes the mutex again before
+ * returning.
+ *
+ * vCondBroadcast() unblocks the highest priority waiting task and moves the
+ * others straight onto the list of tasks waiting for the mutex (wait
+ * morphing).  They are then unblocked one at a time as the mutex is given,
+ * instead of all running only to block on the mutex again.
+ *
+ * Every task that waits on a condition variable must use the same mutex, which
+ * must be created with xSemaphoreCreateMutex() or xSemaphoreCreateMutexStatic()
+ * and must not be taken recursively.  Condition variables cannot be used from
+ * interrupts.  The application provides the memory, and must call vCondInit()
+ * before the condition variable is used.
+ *
+ * Set configUSE_CONDITION_VARIABLES to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup CondVar_t CondVar_t
+ * \ingroup ConditionVariables
+ */
+typedef struct xCOND_VAR
+{
+    SemaphoreHandle_t xMutex; /**< The mutex used by the waiting tasks, or NULL if no task has waited yet. */
+    List_t xTasksWaiting;     /**< Tasks blocked waiting for the condition variable to be signalled, in priority order. */
+} CondVar_t;
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * void vCondInit( CondVar_t * pxCond );
+ * @endcode
+ *
+ * Initialise a condition variable.  Must not be called while any task is
+ * waiting on the condition variable.
+ *
+ * @param pxCond The condition variable being initialised.
+ *
+ * \defgroup vCondInit vCondInit
+ * \ingroup ConditionVariables
+ */
+void vCondInit( CondVar_t * pxCond ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * BaseType_t xCondWait( CondVar_t * pxCond, SemaphoreHandle_t xMutex, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Atomically give xMutex, which the calling task must hold, and wait in the
+ * Blocked state for up to xTicksToWait ticks for pxCond to be signalled.  The
+ * mutex is always taken again before the function returns, even if
+ * xTicksToWait expired, waiting indefinitely for it if necessary.  Must only be
+ * called from a task.
+ *
+ * A task can return without the predicate having become true, for example
+ * because another task changed it again first, so the predicate must be
+ * checked in a loop:
+ * @code{c}
+ * SemaphoreHandle_t xPoolMutex;
+ * CondVar_t xWorkAvailable;
+ *
+ * void vWorker( void * pvParameters )
+ * {
+ *     for( ;; )
+ *     {
+ *         xSemaphoreTake( xPoolMutex, portMAX_DELAY );
+ *
+ *         while( uxPendingJobs == 0 )
+ *         {
+ *             ( void ) xCondWait( &xWorkAvailable, xPoolMutex, portMAX_DELAY );
+ *         }
+ *
+ *         vTakeJob();
+ *         xSemaphoreGive( xPoolMutex );
+ *     }
+ * }
+ * @endcode
+ *
+ * @param pxCond The condition variable to wait on.
+ *
+ * @param xMutex The mutex that protects the predicate.
+ *
+ * @param xTicksToWait The maximum time to wait for the condition variable to
+ * be signalled.
+ *
+ * @return pdPASS if the task was unblocked by vCondSignal() or
+ * vCondBroadcast(), or pdFAIL if xTicksToWait expired first.
+ *
+ * \defgroup xCondWait xCondWait
+ * \ingroup ConditionVariables
+ */
+BaseType_t xCondWait( CondVar_t * pxCond,
+                      SemaphoreHandle_t xMutex,
+                      TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * void vCondSignal( CondVar_t * pxCond );
+ * @endcode
+ *
+ * Unblock the highest priority task waiting on a condition variable, if any.
+ * Can be called with or without the mutex held.  Must only be called from a
+ * task.
+ *
+ * @param pxCond The condition variable being signalled.
+ *
+ * \defgroup vCondSignal vCondSignal
+ * \ingroup ConditionVariables
+ */
+void vCondSignal( CondVar_t * pxCond ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * void vCondBroadcast( CondVar_t * pxCond );
+ * @endcode
+ *
+ * Unblock every task waiting on a condition variable.  The highest priority
+ * task is unblocked immediately, and the others are moved to the list of tasks
+ * waiting for the mutex, so each is unblocked when the mutex is next given.
+ * A task moved to the mutex's list does not raise the priority of the mutex
+ * holder until it is unblocked and tries to take the mutex itself.  Can be
+ * called with or without the mutex held.  Must only be called from a task.
+ *
+ * @param pxCond The condition variable being broadcast.
+ *
+ * \defgroup vCondBroadcast vCondBroadcast
+ * \ingroup ConditionVariables
+ */
+void vCondBroadcast( CondVar_t * pxCond ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* CONDITION_VARIABLE_H */
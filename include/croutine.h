@@ -58,6 +58,10 @@ typedef struct corCoRoutineControlBlock
     UBaseType_t uxPriority;      /**< The priority of the co-routine in relation to other co-routines. */
     UBaseType_t uxIndex;         /**< Used to distinguish between co-routines when multiple co-routines use the same co-routine function. */
     uint16_t uxState;            /**< Used internally by the co-routine implementation. */
+
+    #if ( configUSE_PER_CORE_CO_ROUTINES == 1 )
+        BaseType_t xCoreID;      /**< The core whose co-routine scheduler runs the co-routine. */
+    #endif
 } CRCB_t;                        /* Co-routine control block.  Note must be identical in size down to uxPriority with TCB_t. */
 
 /**
@@ -137,6 +141,84 @@ BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode,
                              UBaseType_t uxPriority,
                              UBaseType_t uxIndex );
 
+/**
+ * croutine. h
+ * @code{c}
+ * BaseType_t xCoRoutineCreateOnCore(
+ *                                     crCOROUTINE_CODE pxCoRoutineCode,
+ *                                     UBaseType_t uxPriority,
+ *                                     UBaseType_t uxIndex,
+ *                                     BaseType_t xCoreID
+ *                                   );
+ * @endcode
+ *
+ * Only available when configUSE_PER_CORE_CO_ROUTINES is set to 1.
+ *
+ * Each core then has its own co-routine scheduler.  xCoRoutineCreate() adds
+ * the new co-routine to the scheduler of the core it is called on, whereas
+ * xCoRoutineCreateOnCore() adds it to the scheduler of core xCoreID.  The
+ * co-routine is only ever run by a task that calls vCoRoutineSchedule() on that
+ * core.
+ *
+ * The schedulers are not protected against access from other cores, so
+ * xCoRoutineCreateOnCore() must either be called before the scheduler is
+ * started or be called on core xCoreID.  For the same reason the co-routine
+ * queue functions can only be used to communicate with co-routines of the
+ * same core, and with interrupts serviced by that core.
+ *
+ * @param pxCoRoutineCode Pointer to the co-routine function.
+ *
+ * @param uxPriority The priority with respect to the other co-routines of the
+ * same core at which the co-routine will run.
+ *
+ * @param uxIndex Used to distinguish between different co-routines that
+ * execute the same function.
+ *
+ * @param xCoreID The core whose co-routine scheduler will run the co-routine.
+ *
+ * @return pdPASS if the co-routine was successfully created and added to a ready
+ * list, otherwise an error code defined with ProjDefs.h.
+ *
+ * Example usage:
+ * @code{c}
+ * // Created before the scheduler is started, one host task per core.
+ * void vCreateCoRoutines( void )
+ * {
+ * BaseType_t xCoreID;
+ * UBaseType_t uxIndex;
+ * TaskHandle_t xHostTask;
+ *
+ *   for( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+ *   {
+ *       for( uxIndex = 0; uxIndex < 100; uxIndex++ )
+ *       {
+ *           xCoRoutineCreateOnCore( vProtocolCoRoutine, 0, uxIndex, xCoreID );
+ *       }
+ *
+ *       // The host task must stay on the core whose co-routines it runs.
+ *       xTaskCreate( vHostTask, "CR", configMINIMAL_STACK_SIZE, NULL, 1, &xHostTask );
+ *       vTaskCoreAffinitySet( xHostTask, ( UBaseType_t ) 1 << xCoreID );
+ *   }
+ * }
+ *
+ * void vHostTask( void * pvParameters )
+ * {
+ *   for( ;; )
+ *   {
+ *       vCoRoutineSchedule();
+ *   }
+ * }
+ * @endcode
+ * \defgroup xCoRoutineCreateOnCore xCoRoutineCreateOnCore
+ * \ingroup Tasks
+ */
+#if ( configUSE_PER_CORE_CO_ROUTINES == 1 )
+    BaseType_t xCoRoutineCreateOnCore( crCOROUTINE_CODE pxCoRoutineCode,
+                                       UBaseType_t uxPriority,
+                                       UBaseType_t uxIndex,
+                                       BaseType_t xCoreID );
+#endif
+
 
 /**
  * croutine. h
@@ -155,6 +237,10 @@ BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode,
  * vCoRoutineSchedule should be called from the idle task (in an idle task
  * hook).
  *
+ * If configUSE_PER_CORE_CO_ROUTINES is set to 1 then vCoRoutineSchedule()
+ * runs the co-routines of the core it is called on, and must be called from
+ * a task whose core affinity is that single core.
+ *
  * Example usage:
  * @code{c}
  * // This idle task hook will schedule a co-routine each time it is called.
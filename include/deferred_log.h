@@ -0,0 +1,251 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include deferred_log.h"
+#endif
+
+#include "stream_buffer.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * The deferred log moves the cost of formatting log messages off the code
+ * being logged.  Logging a message only records the address of its format
+ * string, a timestamp and the raw values of its arguments in a stream buffer
+ * belonging to the calling core, with interrupts masked on that core for the
+ * duration of the write.  No lock is shared between cores, nothing is
+ * formatted, and no task is woken.  A single low priority task, or a host
+ * that is sent the raw records, later reads the records and formats them.
+ *
+ * Format strings must remain valid until the record is formatted, so should
+ * be string literals.  Each argument is recorded as a uint32_t, so only
+ * integer conversions of 32-bit values, such as "%" PRIu32 or "%" PRIx32, can
+ * be used.  Strings cannot be passed as arguments.
+ *
+ * Set configUSE_DEFERRED_LOG to 1 in FreeRTOSConfig.h to include this
+ * functionality.  configDEFERRED_LOG_BUFFER_SIZE sets the size, in bytes, of
+ * the stream buffer of each core, and configDEFERRED_LOG_MAX_ARGUMENTS (at
+ * most 6) the number of arguments a message can have.
+ *
+ * \defgroup DeferredLogRecord_t DeferredLogRecord_t
+ * \ingroup DeferredLog
+ */
+typedef struct xDEFERRED_LOG_RECORD
+{
+    const char * pcFormat;                                  /**< The format string passed when the message was logged. */
+    uint32_t ulTimestamp;                                   /**< The value of configDEFERRED_LOG_TIMESTAMP() when the message was logged. */
+    uint8_t ucCore;                                         /**< The core on which the message was logged. */
+    uint8_t ucArgumentCount;                                /**< The number of valid entries in ulArguments. */
+    uint32_t ulArguments[ configDEFERRED_LOG_MAX_ARGUMENTS ]; /**< The arguments passed when the message was logged. */
+} DeferredLogRecord_t;
+
+/**
+ * deferred_log.h
+ * @code{c}
+ * void vDeferredLogInit( void );
+ * @endcode
+ *
+ * Creates the stream buffer of each core.  Must be called before any message
+ * is logged, normally before the scheduler is started.  Messages logged before
+ * vDeferredLogInit() is called are counted as dropped.
+ *
+ * \defgroup vDeferredLogInit vDeferredLogInit
+ * \ingroup DeferredLog
+ */
+void vDeferredLogInit( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_log.h
+ * @code{c}
+ * void vDeferredLogWrite( const char * pcFormat, const uint32_t * pulArguments, UBaseType_t uxArgumentCount );
+ * @endcode
+ *
+ * Logs a message.  Can be called from tasks, from interrupts, and from within
+ * critical sections, but not from within the trace macros used by the stream
+ * buffer functions.  The deferredLOG0() to deferredLOG4() macros are normally
+ * used instead, as they place the arguments in an array.
+ *
+ * If the stream buffer of the calling core does not have space for the whole
+ * message then the message is dropped, and counted by
+ * ulDeferredLogGetDroppedCount().
+ *
+ * @param pcFormat A printf style format string, which must remain valid until
+ * the message has been formatted.
+ *
+ * @param pulArguments The arguments to be formatted, or NULL if
+ * uxArgumentCount is 0.
+ *
+ * @param uxArgumentCount The number of arguments, at most
+ * configDEFERRED_LOG_MAX_ARGUMENTS.
+ *
+ * Example usage:
+ * @code{c}
+ * void vADCInterruptHandler( void )
+ * {
+ *     uint32_t ulSample = ADC_RESULT_REGISTER;
+ *
+ *     deferredLOG1( "ADC sample %" PRIu32 "\r\n", ulSample );
+ * }
+ *
+ * // A low priority task writes the log out.
+ * void vLogTask( void * pvParameters )
+ * {
+ *     DeferredLogRecord_t xRecord;
+ *     char cLine[ 80 ];
+ *
+ *     for( ;; )
+ *     {
+ *         while( xDeferredLogReceive( &xRecord ) == pdPASS )
+ *         {
+ *             ( void ) xDeferredLogFormat( &xRecord, cLine, sizeof( cLine ) );
+ *             vWriteToUART( cLine );
+ *         }
+ *
+ *         vTaskDelay( pdMS_TO_TICKS( 10 ) );
+ *     }
+ * }
+ * @endcode
+ * \defgroup vDeferredLogWrite vDeferredLogWrite
+ * \ingroup DeferredLog
+ */
+void vDeferredLogWrite( const char * pcFormat,
+                        const uint32_t * pulArguments,
+                        UBaseType_t uxArgumentCount ) PRIVILEGED_FUNCTION;
+
+#define deferredLOG0( pcFormat )    vDeferredLogWrite( ( pcFormat ), NULL, ( UBaseType_t ) 0U )
+
+#define deferredLOG1( pcFormat, ulArgument1 )                                                 \
+    do {                                                                                      \
+        const uint32_t ulDeferredLogArguments[ 1 ] = { ( uint32_t ) ( ulArgument1 ) };        \
+        vDeferredLogWrite( ( pcFormat ), ulDeferredLogArguments, ( UBaseType_t ) 1U );        \
+    } while( 0 )
+
+#define deferredLOG2( pcFormat, ulArgument1, ulArgument2 )                                    \
+    do {                                                                                      \
+        const uint32_t ulDeferredLogArguments[ 2 ] = { ( uint32_t ) ( ulArgument1 ),          \
+                                                       ( uint32_t ) ( ulArgument2 ) };        \
+        vDeferredLogWrite( ( pcFormat ), ulDeferredLogArguments, ( UBaseType_t ) 2U );        \
+    } while( 0 )
+
+#define deferredLOG3( pcFormat, ulArgument1, ulArgument2, ulArgument3 )                       \
+    do {                                                                                      \
+        const uint32_t ulDeferredLogArguments[ 3 ] = { ( uint32_t ) ( ulArgument1 ),          \
+                                                       ( uint32_t ) ( ulArgument2 ),          \
+                                                       ( uint32_t ) ( ulArgument3 ) };        \
+        vDeferredLogWrite( ( pcFormat ), ulDeferredLogArguments, ( UBaseType_t ) 3U );        \
+    } while( 0 )
+
+#define deferredLOG4( pcFormat, ulArgument1, ulArgument2, ulArgument3, ulArgument4 )          \
+    do {                                                                                      \
+        const uint32_t ulDeferredLogArguments[ 4 ] = { ( uint32_t ) ( ulArgument1 ),          \
+                                                       ( uint32_t ) ( ulArgument2 ),          \
+                                                       ( uint32_t ) ( ulArgument3 ),          \
+                                                       ( uint32_t ) ( ulArgument4 ) };        \
+        vDeferredLogWrite( ( pcFormat ), ulDeferredLogArguments, ( UBaseType_t ) 4U );        \
+    } while( 0 )
+
+/**
+ * deferred_log.h
+ * @code{c}
+ * BaseType_t xDeferredLogReceive( DeferredLogRecord_t * pxRecord );
+ * @endcode
+ *
+ * Removes the next logged message from the stream buffer of one of the cores,
+ * without blocking.  The cores are read in turn, so messages logged on
+ * different cores are not returned in the order they were logged - use the
+ * timestamps to order them.  Only one task can read the log.
+ *
+ * The record can be formatted with xDeferredLogFormat(), or sent as it is to a
+ * host, which can find the format string from the address in pcFormat using
+ * the symbol table of the application image.
+ *
+ * @param pxRecord The structure into which the message is copied.  Entries of
+ * ulArguments beyond ucArgumentCount are not written.
+ *
+ * @return pdPASS if a message was read, or pdFAIL if the log was empty.
+ *
+ * \defgroup xDeferredLogReceive xDeferredLogReceive
+ * \ingroup DeferredLog
+ */
+BaseType_t xDeferredLogReceive( DeferredLogRecord_t * pxRecord ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_log.h
+ * @code{c}
+ * size_t xDeferredLogFormat( const DeferredLogRecord_t * pxRecord, char * pcBuffer, size_t xBufferLength );
+ * @endcode
+ *
+ * Formats a message read by xDeferredLogReceive() using snprintf().
+ *
+ * @param pxRecord The message to format.
+ *
+ * @param pcBuffer The buffer into which the NULL terminated message is
+ * written.
+ *
+ * @param xBufferLength The length of pcBuffer in bytes.  A message that does
+ * not fit is truncated.
+ *
+ * @return The number of characters written to pcBuffer, not including the
+ * NULL terminator.
+ *
+ * \defgroup xDeferredLogFormat xDeferredLogFormat
+ * \ingroup DeferredLog
+ */
+size_t xDeferredLogFormat( const DeferredLogRecord_t * pxRecord,
+                           char * pcBuffer,
+                           size_t xBufferLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * deferred_log.h
+ * @code{c}
+ * uint32_t ulDeferredLogGetDroppedCount( void );
+ * @endcode
+ *
+ * Returns the number of messages, summed over all the cores, that were
+ * dropped because the stream buffer of the core they were logged on was full.
+ *
+ * \defgroup ulDeferredLogGetDroppedCount ulDeferredLogGetDroppedCount
+ * \ingroup DeferredLog
+ */
+uint32_t ulDeferredLogGetDroppedCount( void ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* DEFERRED_LOG_H */
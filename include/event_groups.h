@@ -103,14 +103,30 @@ struct EventGroupDef_t;
 typedef struct EventGroupDef_t   * EventGroupHandle_t;
 
 /*
- * The type that holds event bits always matches TickType_t - therefore the
+ * The type that holds event bits matches TickType_t - therefore the
  * number of bits it holds is set by configTICK_TYPE_WIDTH_IN_BITS (16 bits if set to 0,
- * 32 bits if set to 1, 64 bits if set to 2.
+ * 32 bits if set to 1, 64 bits if set to 2.  If configUSE_64_BIT_EVENT_GROUPS
+ * is 1 it is 64 bits whatever the width of TickType_t.
  *
  * \defgroup EventBits_t EventBits_t
  * \ingroup EventGroup
  */
-typedef TickType_t               EventBits_t;
+#if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+    typedef uint64_t             EventBits_t;
+#else
+    typedef TickType_t           EventBits_t;
+#endif
+
+/*
+ * The event bits the application cannot use.  Unless configUSE_64_BIT_EVENT_GROUPS
+ * is 1 the bits waited for share a task's event list item value with the
+ * control bits, so the top byte of EventBits_t is reserved.
+ */
+#if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+    #define eventEVENT_BITS_RESERVED    ( ( EventBits_t ) 0U )
+#else
+    #define eventEVENT_BITS_RESERVED    ( ( EventBits_t ) eventEVENT_BITS_CONTROL_BYTES )
+#endif
 
 /**
  * event_groups.h
@@ -136,8 +152,10 @@ typedef TickType_t               EventBits_t;
  * configTICK_TYPE_WIDTH_IN_BITS is 0 then each event group contains 8 usable bits (bit
  * 0 to bit 7).  If configTICK_TYPE_WIDTH_IN_BITS is set to 1 then each event group has
  * 24 usable bits (bit 0 to bit 23).  If configTICK_TYPE_WIDTH_IN_BITS is set to 2 then
- * each event group has 56 usable bits (bit 0 to bit 53). The EventBits_t type
- * is used to store event bits within an event group.
+ * each event group has 56 usable bits (bit 0 to bit 53).  If
+ * configUSE_64_BIT_EVENT_GROUPS is set to 1 then each event group has 64 usable
+ * bits (bit 0 to bit 63) whatever the setting of configTICK_TYPE_WIDTH_IN_BITS.
+ * The EventBits_t type is used to store event bits within an event group.
  *
  * The configUSE_EVENT_GROUPS configuration constant must be set to 1 for xEventGroupCreate()
  * to be available.
@@ -196,8 +214,10 @@ typedef TickType_t               EventBits_t;
  * configTICK_TYPE_WIDTH_IN_BITS is 0 then each event group contains 8 usable bits (bit
  * 0 to bit 7).  If configTICK_TYPE_WIDTH_IN_BITS is set to 1 then each event group has
  * 24 usable bits (bit 0 to bit 23).  If configTICK_TYPE_WIDTH_IN_BITS is set to 2 then
- * each event group has 56 usable bits (bit 0 to bit 53).  The EventBits_t type
- * is used to store event bits within an event group.
+ * each event group has 56 usable bits (bit 0 to bit 53).  If
+ * configUSE_64_BIT_EVENT_GROUPS is set to 1 then each event group has 64 usable
+ * bits (bit 0 to bit 63) whatever the setting of configTICK_TYPE_WIDTH_IN_BITS.
+ * The EventBits_t type is used to store event bits within an event group.
  *
  * The configUSE_EVENT_GROUPS configuration constant must be set to 1 for xEventGroupCreateStatic()
  * to be available.
@@ -408,7 +428,8 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
  * a result event groups cannot be accessed directly from an interrupt service
  * routine.  Therefore xEventGroupClearBitsFromISR() sends a message to the
  * timer task to have the clear operation performed in the context of the timer
- * task.
+ * task.  The message holds the bits as a uint32_t, so if
+ * configUSE_64_BIT_EVENT_GROUPS is 1 only bits 0 to 31 can be cleared this way.
  *
  * @note If this function returns pdPASS then the timer task is ready to run
  * and a portYIELD_FROM_ISR(pdTRUE) should be executed to perform the needed
@@ -535,6 +556,46 @@ EventBits_t xEventGroupClearBits( EventGroupHandle_t xEventGroup,
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
                                 const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
 
+/**
+ * event_groups.h
+ * @code{c}
+ *  EventBits_t xEventGroupSetBitsWakeOne( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet );
+ * @endcode
+ *
+ * A version of xEventGroupSetBits() that unblocks no more than one task for
+ * each bit set.  The tasks waiting for the bits are tested in the order they
+ * blocked, and a task is only unblocked if at least one of the bits set that
+ * it is waiting for has not already unblocked an earlier task.  This avoids
+ * waking every task waiting for an event when only one of them can handle it,
+ * and ends the search of the waiting tasks as soon as every bit set has
+ * unblocked a task.
+ *
+ * A task that is not unblocked remains blocked even if its wait condition is
+ * met, so the waiting tasks usually clear the bits on exit.
+ *
+ * configUSE_EVENT_GROUP_WAKE_ONE must be set to 1 in FreeRTOSConfig.h for
+ * xEventGroupSetBitsWakeOne() to be available.  Setting it also makes the event
+ * group remember the bits its waiting tasks are waiting for, so that
+ * xEventGroupSetBits() and xEventGroupSetBitsWakeOne() return without searching
+ * the waiting tasks when none of them are waiting for the bits being set.
+ *
+ * This function cannot be called from an interrupt.
+ *
+ * @param xEventGroup The event group in which the bits are to be set.
+ *
+ * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
+ *
+ * @return The value of the event group at the time the call to
+ * xEventGroupSetBitsWakeOne() returns, as for xEventGroupSetBits().
+ *
+ * \defgroup xEventGroupSetBitsWakeOne xEventGroupSetBitsWakeOne
+ * \ingroup EventGroup
+ */
+#if ( configUSE_EVENT_GROUP_WAKE_ONE == 1 )
+    EventBits_t xEventGroupSetBitsWakeOne( EventGroupHandle_t xEventGroup,
+                                           const EventBits_t uxBitsToSet ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * event_groups.h
  * @code{c}
@@ -549,7 +610,8 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * interrupts or from critical sections.  Therefore xEventGroupSetBitsFromISR()
  * sends a message to the timer task to have the set operation performed in the
  * context of the timer task - where a scheduler lock is used in place of a
- * critical section.
+ * critical section.  The message holds the bits as a uint32_t, so if
+ * configUSE_64_BIT_EVENT_GROUPS is 1 only bits 0 to 31 can be set this way.
  *
  * @param xEventGroup The event group in which the bits are to be set.
  *
@@ -567,9 +629,22 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * *pxHigherPriorityTaskWoken must be initialised to pdFALSE.  See the
  * example code below.
  *
+ * If configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR is set to 1 in FreeRTOSConfig.h
+ * then xEventGroupSetBitsFromISR() instead sets the bits and unblocks the
+ * waiting tasks itself, without a message being sent to the timer daemon
+ * task, unless a task is accessing the event group at the time of the
+ * interrupt.  No more than configEVENT_GROUP_SET_BITS_FROM_ISR_MAX_TESTS
+ * waiting tasks are tested in the interrupt.  The timer daemon task tests any
+ * remaining waiting tasks.  *pxHigherPriorityTaskWoken is then set to pdTRUE
+ * if a task that was unblocked, or the timer daemon task, has a priority above
+ * that of the interrupted task.
+ *
  * @return If the request to execute the function was posted successfully then
  * pdPASS is returned, otherwise pdFALSE is returned.  pdFALSE will be returned
- * if the timer service queue was full.
+ * if the timer service queue was full.  If
+ * configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR is set to 1 then pdPASS is returned
+ * unless a message to the timer daemon task was needed but could not be
+ * posted.
  *
  * Example usage:
  * @code{c}
@@ -607,7 +682,7 @@ EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup,
  * \defgroup xEventGroupSetBitsFromISR xEventGroupSetBitsFromISR
  * \ingroup EventGroup
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 ) )
     BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
                                           const EventBits_t uxBitsToSet,
                                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
@@ -832,6 +907,32 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup ) PRIVILEGED_FUNCTION;
                                            StaticEventGroup_t ** ppxEventGroupBuffer ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * event_groups.h
+ * @code{c}
+ *  void vEventGroupGetStatistics( EventGroupHandle_t xEventGroup,
+ *                                 IPCStatistics_t * pxStatistics );
+ * @endcode
+ *
+ * Returns the statistics gathered for an event group.  Each call that sets
+ * bits counts as a send.  Each call to xEventGroupWaitBits() or
+ * xEventGroupSync() that returns with its wait condition met counts as a
+ * receive, and each such call that blocks then returns without its wait
+ * condition met counts as a timeout.  The maximum depth and the mutex members
+ * of IPCStatistics_t are not used.
+ *
+ * configUSE_IPC_STATISTICS must be set to 1 in FreeRTOSConfig.h for
+ * vEventGroupGetStatistics() to be available.
+ *
+ * @param xEventGroup The event group being queried.
+ *
+ * @param pxStatistics The structure the statistics are copied into.
+ */
+#if ( configUSE_IPC_STATISTICS == 1 )
+    void vEventGroupGetStatistics( EventGroupHandle_t xEventGroup,
+                                   IPCStatistics_t * pxStatistics ) PRIVILEGED_FUNCTION;
+#endif
+
 /* For internal use only. */
 void vEventGroupSetBitsCallback( void * pvEventGroup,
                                  uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
@@ -0,0 +1,191 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef EVENT_HANDLER_H
+#define EVENT_HANDLER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include event_handler.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * An event handler is a function that runs to completion each time it is
+ * posted, for use where a task would otherwise be created just to wait for
+ * an event and handle it.  All the event handlers of one priority are run, one
+ * at a time and in the order they were posted, by a single dispatcher task of
+ * that priority, so they share that task's stack and TCB.  Handlers of a
+ * higher priority preempt handlers, and tasks, of a lower priority in the
+ * usual way.
+ *
+ * A handler should return promptly and should not block, as the handlers
+ * waiting behind it at the same priority cannot run until it returns.  The
+ * dispatcher task of a priority is created, with a stack of
+ * configEVENT_HANDLER_STACK_DEPTH words, the first time a handler of that
+ * priority is initialised.
+ *
+ * Set configUSE_EVENT_HANDLERS to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup EventHandler_t EventHandler_t
+ * \ingroup EventHandlers
+ */
+typedef void (* EventHandlerFunction_t)( void * pvParameter );
+
+typedef struct xEVENT_HANDLER
+{
+    ListItem_t xPendingListItem;       /**< In one of the dispatcher's lists while the handler is posted. */
+    EventHandlerFunction_t pxFunction; /**< The function run each time the handler is posted. */
+    void * pvParameter;                /**< The value passed into pxFunction. */
+    UBaseType_t uxPriority;            /**< The priority pxFunction runs at. */
+} EventHandler_t;
+
+/**
+ * event_handler.h
+ * @code{c}
+ * BaseType_t xEventHandlerInit( EventHandler_t * pxHandler,
+ *                               EventHandlerFunction_t pxFunction,
+ *                               void * pvParameter,
+ *                               UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Initialise an event handler, creating the dispatcher task for uxPriority if
+ * this is the first handler of that priority.  Must not be called while the
+ * handler is posted.
+ *
+ * @param pxHandler The event handler being initialised.
+ *
+ * @param pxFunction The function run each time the handler is posted.
+ *
+ * @param pvParameter The value passed into pxFunction.
+ *
+ * @param uxPriority The priority pxFunction runs at.
+ *
+ * @return pdPASS if the handler was initialised, or pdFAIL if the dispatcher
+ * task for uxPriority could not be created.
+ *
+ * \defgroup xEventHandlerInit xEventHandlerInit
+ * \ingroup EventHandlers
+ */
+BaseType_t xEventHandlerInit( EventHandler_t * pxHandler,
+                              EventHandlerFunction_t pxFunction,
+                              void * pvParameter,
+                              UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_handler.h
+ * @code{c}
+ * BaseType_t xEventHandlerPost( EventHandler_t * pxHandler );
+ * @endcode
+ *
+ * Post an event handler so its function is run by the dispatcher task of the
+ * handler's priority.  Posting a handler that is already posted, but has not
+ * yet started to run, has no effect, so the function runs once however many
+ * times it was posted in the meantime.
+ *
+ * @param pxHandler The event handler being posted.
+ *
+ * @return pdPASS if the handler was posted, or pdFAIL if it was already
+ * posted.
+ *
+ * \defgroup xEventHandlerPost xEventHandlerPost
+ * \ingroup EventHandlers
+ */
+BaseType_t xEventHandlerPost( EventHandler_t * pxHandler ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_handler.h
+ * @code{c}
+ * BaseType_t xEventHandlerPostDelayed( EventHandler_t * pxHandler,
+ *                                      TickType_t xTicksToDelay );
+ * @endcode
+ *
+ * Post an event handler so its function is run by the dispatcher task of the
+ * handler's priority once xTicksToDelay ticks have passed.  Posting a handler
+ * that is already delayed restarts the delay.  Posting a handler that is
+ * already waiting to run has no effect.  A handler that is delayed runs
+ * straight away if it is posted with xEventHandlerPost() or
+ * xEventHandlerPostFromISR() before the delay expires.
+ *
+ * @param pxHandler The event handler being posted.
+ *
+ * @param xTicksToDelay The number of ticks to wait before running the
+ * handler.  0 runs the handler as soon as possible, as xEventHandlerPost()
+ * does.
+ *
+ * @return pdPASS if the handler was posted, or pdFAIL if it was already
+ * waiting to run.
+ *
+ * \defgroup xEventHandlerPostDelayed xEventHandlerPostDelayed
+ * \ingroup EventHandlers
+ */
+BaseType_t xEventHandlerPostDelayed( EventHandler_t * pxHandler,
+                                     TickType_t xTicksToDelay ) PRIVILEGED_FUNCTION;
+
+/**
+ * event_handler.h
+ * @code{c}
+ * BaseType_t xEventHandlerPostFromISR( EventHandler_t * pxHandler,
+ *                                      BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xEventHandlerPost() that can be called from an interrupt
+ * service routine.
+ *
+ * @param pxHandler The event handler being posted.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the handler
+ * unblocked a dispatcher task with a priority higher than the task that was
+ * interrupted, in which case a context switch should be requested before the
+ * interrupt exits.
+ *
+ * @return pdPASS if the handler was posted, or pdFAIL if it was already
+ * posted.
+ *
+ * \defgroup xEventHandlerPostFromISR xEventHandlerPostFromISR
+ * \ingroup EventHandlers
+ */
+BaseType_t xEventHandlerPostFromISR( EventHandler_t * pxHandler,
+                                     BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* EVENT_HANDLER_H */
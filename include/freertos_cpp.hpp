@@ -0,0 +1,387 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef FREERTOS_CPP_HPP
+#define FREERTOS_CPP_HPP
+
+#ifndef __cplusplus
+    #error freertos_cpp.hpp can only be included from C++ source files
+#endif
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include freertos_cpp.hpp"
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION != 1 )
+    #error freertos_cpp.hpp requires configSUPPORT_STATIC_ALLOCATION to be set to 1
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+
+/**
+ * Header only C++ classes that own a task, queue, stream buffer or mutex along
+ * with the memory it uses.  The memory is a member of the object, with its
+ * size fixed at compile time by the template parameters, so the kernel object
+ * is created with the static allocation functions and no heap is used.  Each
+ * member function is an inline call to the C API function it wraps.
+ *
+ * The kernel object is created by the constructor and deleted by the
+ * destructor, so the C++ object must outlive every use of its handle.  The
+ * objects cannot be copied or moved, as the kernel holds pointers into them.
+ * Objects with static storage duration may be constructed before the scheduler
+ * is started.
+ *
+ * Example usage:
+ * @code{cpp}
+ * #include "FreeRTOS.h"
+ * #include "freertos_cpp.hpp"
+ * #include <mutex>
+ *
+ * struct Event_t { uint32_t ulId; uint32_t ulData; };
+ *
+ * static freertos::Queue< Event_t, 8 > xEvents;
+ * static freertos::Mutex xLogMutex;
+ *
+ * static void vConsumer( void * pvParameters )
+ * {
+ *     Event_t xEvent;
+ *
+ *     for( ;; )
+ *     {
+ *         if( xEvents.receive( xEvent ) )
+ *         {
+ *             std::lock_guard< freertos::Mutex > xLock( xLogMutex );
+ *             vLogEvent( &xEvent );
+ *         }
+ *     }
+ * }
+ *
+ * static freertos::Task< 256 > xConsumerTask( vConsumer, "Consumer", tskIDLE_PRIORITY + 1 );
+ * @endcode
+ */
+namespace freertos
+{
+    /**
+     * A queue of up to Length items of type T.  Items are copied into and out
+     * of the queue with memcpy(), so T must be trivially copyable.
+     */
+    template< typename T, UBaseType_t Length >
+    class Queue
+    {
+        static_assert( Length > 0U, "A queue must hold at least one item" );
+        static_assert( sizeof( T ) > 0U, "Use a Semaphore, not a queue of empty items" );
+        static_assert( std::is_trivially_copyable< T >::value, "Queue items are copied with memcpy(), so must be trivially copyable" );
+
+        public:
+            Queue() : xHandle( xQueueCreateStatic( Length, sizeof( T ), ucStorage, &xQueueBuffer ) )
+            {
+                configASSERT( xHandle != NULL );
+            }
+
+            ~Queue()
+            {
+                vQueueDelete( xHandle );
+            }
+
+            Queue( const Queue & ) = delete;
+            Queue & operator=( const Queue & ) = delete;
+
+            /* Copy xItem to the back of the queue, waiting up to xTicksToWait
+             * for space.  Returns true if the item was sent. */
+            bool send( const T & xItem,
+                       TickType_t xTicksToWait = portMAX_DELAY )
+            {
+                return xQueueSendToBack( xHandle, &xItem, xTicksToWait ) == pdPASS;
+            }
+
+            bool sendFromISR( const T & xItem,
+                              BaseType_t * pxHigherPriorityTaskWoken )
+            {
+                return xQueueSendToBackFromISR( xHandle, &xItem, pxHigherPriorityTaskWoken ) == pdPASS;
+            }
+
+            #if ( configQUEUE_SEND_TO_FRONT_USED == 1 )
+                bool sendToFront( const T & xItem,
+                                  TickType_t xTicksToWait = portMAX_DELAY )
+                {
+                    return xQueueSendToFront( xHandle, &xItem, xTicksToWait ) == pdPASS;
+                }
+            #endif
+
+            #if ( configQUEUE_OVERWRITE_USED == 1 )
+
+                /* Only valid for a queue with a Length of 1. */
+                void overwrite( const T & xItem )
+                {
+                    static_assert( Length == 1U, "Only a queue with a length of 1 can be overwritten" );
+                    ( void ) xQueueOverwrite( xHandle, &xItem );
+                }
+            #endif
+
+            /* Copy the item at the front of the queue to xItem and remove it,
+             * waiting up to xTicksToWait for an item.  Returns true if an item
+             * was received. */
+            bool receive( T & xItem,
+                          TickType_t xTicksToWait = portMAX_DELAY )
+            {
+                return xQueueReceive( xHandle, &xItem, xTicksToWait ) == pdPASS;
+            }
+
+            bool receiveFromISR( T & xItem,
+                                 BaseType_t * pxHigherPriorityTaskWoken )
+            {
+                return xQueueReceiveFromISR( xHandle, &xItem, pxHigherPriorityTaskWoken ) == pdPASS;
+            }
+
+            /* As receive(), but the item is left in the queue. */
+            bool peek( T & xItem,
+                       TickType_t xTicksToWait = portMAX_DELAY )
+            {
+                return xQueuePeek( xHandle, &xItem, xTicksToWait ) == pdPASS;
+            }
+
+            UBaseType_t messagesWaiting() const
+            {
+                return uxQueueMessagesWaiting( xHandle );
+            }
+
+            UBaseType_t spacesAvailable() const
+            {
+                return uxQueueSpacesAvailable( xHandle );
+            }
+
+            void reset()
+            {
+                ( void ) xQueueReset( xHandle );
+            }
+
+            QueueHandle_t handle() const
+            {
+                return xHandle;
+            }
+
+            static constexpr UBaseType_t length()
+            {
+                return Length;
+            }
+
+        private:
+            alignas( T ) uint8_t ucStorage[ Length * sizeof( T ) ];
+            StaticQueue_t xQueueBuffer;
+            const QueueHandle_t xHandle;
+    };
+
+    /**
+     * A stream buffer that holds up to SizeBytes bytes.
+     */
+    template< size_t SizeBytes >
+    class StreamBuffer
+    {
+        static_assert( SizeBytes > 0U, "A stream buffer must hold at least one byte" );
+
+        public:
+            explicit StreamBuffer( size_t xTriggerLevelBytes = 1U ) : xHandle( xStreamBufferCreateStatic( SizeBytes, xTriggerLevelBytes, ucStorage, &xStreamBufferBuffer ) )
+            {
+                configASSERT( xHandle != NULL );
+            }
+
+            ~StreamBuffer()
+            {
+                vStreamBufferDelete( xHandle );
+            }
+
+            StreamBuffer( const StreamBuffer & ) = delete;
+            StreamBuffer & operator=( const StreamBuffer & ) = delete;
+
+            /* Returns the number of bytes written, see xStreamBufferSend(). */
+            size_t send( const void * pvTxData,
+                         size_t xDataLengthBytes,
+                         TickType_t xTicksToWait = portMAX_DELAY )
+            {
+                return xStreamBufferSend( xHandle, pvTxData, xDataLengthBytes, xTicksToWait );
+            }
+
+            size_t sendFromISR( const void * pvTxData,
+                                size_t xDataLengthBytes,
+                                BaseType_t * pxHigherPriorityTaskWoken )
+            {
+                return xStreamBufferSendFromISR( xHandle, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken );
+            }
+
+            /* Returns the number of bytes read, see xStreamBufferReceive(). */
+            size_t receive( void * pvRxData,
+                            size_t xBufferLengthBytes,
+                            TickType_t xTicksToWait = portMAX_DELAY )
+            {
+                return xStreamBufferReceive( xHandle, pvRxData, xBufferLengthBytes, xTicksToWait );
+            }
+
+            size_t receiveFromISR( void * pvRxData,
+                                   size_t xBufferLengthBytes,
+                                   BaseType_t * pxHigherPriorityTaskWoken )
+            {
+                return xStreamBufferReceiveFromISR( xHandle, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken );
+            }
+
+            size_t bytesAvailable() const
+            {
+                return xStreamBufferBytesAvailable( xHandle );
+            }
+
+            size_t spacesAvailable() const
+            {
+                return xStreamBufferSpacesAvailable( xHandle );
+            }
+
+            bool reset()
+            {
+                return xStreamBufferReset( xHandle ) == pdPASS;
+            }
+
+            StreamBufferHandle_t handle() const
+            {
+                return xHandle;
+            }
+
+            static constexpr size_t size()
+            {
+                return SizeBytes;
+            }
+
+        private:
+            uint8_t ucStorage[ SizeBytes ];
+            StaticStreamBuffer_t xStreamBufferBuffer;
+            const StreamBufferHandle_t xHandle;
+    };
+
+    #if ( configUSE_MUTEXES == 1 )
+
+        /**
+         * A mutex.  lock(), try_lock() and unlock() meet the standard library's
+         * Lockable requirements, so the mutex can be held with
+         * std::lock_guard or std::unique_lock.  Must not be used from an
+         * interrupt.
+         */
+        class Mutex
+        {
+            public:
+                Mutex() : xHandle( xSemaphoreCreateMutexStatic( &xMutexBuffer ) )
+                {
+                    configASSERT( xHandle != NULL );
+                }
+
+                ~Mutex()
+                {
+                    vSemaphoreDelete( xHandle );
+                }
+
+                Mutex( const Mutex & ) = delete;
+                Mutex & operator=( const Mutex & ) = delete;
+
+                void lock()
+                {
+                    ( void ) xSemaphoreTake( xHandle, portMAX_DELAY );
+                }
+
+                bool try_lock( TickType_t xTicksToWait = 0U )
+                {
+                    return xSemaphoreTake( xHandle, xTicksToWait ) == pdPASS;
+                }
+
+                void unlock()
+                {
+                    ( void ) xSemaphoreGive( xHandle );
+                }
+
+                SemaphoreHandle_t handle() const
+                {
+                    return xHandle;
+                }
+
+            private:
+                StaticSemaphore_t xMutexBuffer;
+                const SemaphoreHandle_t xHandle;
+        };
+
+    #endif /* configUSE_MUTEXES */
+
+    /**
+     * A task with a stack of StackDepth words.  The task is created when the
+     * object is constructed, and deleted when it is destroyed, so the task
+     * function must not delete the task itself.
+     */
+    template< configSTACK_DEPTH_TYPE StackDepth >
+    class Task
+    {
+        static_assert( StackDepth > 0U, "A task must have a stack" );
+
+        public:
+            Task( TaskFunction_t pxTaskCode,
+                  const char * pcName,
+                  UBaseType_t uxPriority,
+                  void * pvParameters = nullptr ) : xHandle( xTaskCreateStatic( pxTaskCode, pcName, StackDepth, pvParameters, uxPriority, uxStack, &xTaskBuffer ) )
+            {
+                configASSERT( xHandle != NULL );
+            }
+
+            #if ( INCLUDE_vTaskDelete == 1 )
+                ~Task()
+                {
+                    vTaskDelete( xHandle );
+                }
+            #endif
+
+            Task( const Task & ) = delete;
+            Task & operator=( const Task & ) = delete;
+
+            TaskHandle_t handle() const
+            {
+                return xHandle;
+            }
+
+            /* The size of the task's stack in bytes. */
+            static constexpr size_t stackSizeBytes()
+            {
+                return static_cast< size_t >( StackDepth ) * sizeof( StackType_t );
+            }
+
+        private:
+            StackType_t uxStack[ StackDepth ];
+            StaticTask_t xTaskBuffer;
+            const TaskHandle_t xHandle;
+    };
+}
+
+#endif /* FREERTOS_CPP_HPP */
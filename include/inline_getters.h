@@ -0,0 +1,194 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef INLINE_GETTERS_H
+#define INLINE_GETTERS_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include inline_getters.h"
+#endif
+
+#include "task.h"
+#include "queue.h"
+
+/* Inline the functions below even where the port does not define a stronger
+ * request to do so. */
+#ifndef portFORCE_INLINE
+    #define portFORCE_INLINE    inline
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * The functions in this file return the same values as xTaskGetTickCount(),
+ * xTaskGetCurrentTaskHandle(), xTaskGetSchedulerState() and
+ * uxQueueMessagesWaiting(), but are inlined into the caller, and where
+ * possible read the kernel's variables directly with a single load rather than
+ * making a function call that may enter a critical section.  They are intended
+ * for loops that poll the kernel's state at a high rate.
+ *
+ * Unlike the functions they replace, they do not call the trace macros.  Where
+ * a single load cannot give the correct value - for example a tick count that
+ * is wider than the processor's word, a current task handle on a multi core
+ * build, or a lock free queue - they call the function they replace.
+ *
+ * Set configUSE_INLINE_GETTERS to 1 in FreeRTOSConfig.h to use this file.
+ */
+#if ( configUSE_INLINE_GETTERS == 1 )
+
+/* The kernel variables read by the functions below.  They are private to
+ * tasks.c, and are only given external linkage so they can be read here. */
+    extern volatile TickType_t xTickCount;
+    extern volatile BaseType_t xSchedulerRunning;
+    extern volatile UBaseType_t uxSchedulerSuspended;
+
+    #if ( configNUMBER_OF_CORES == 1 )
+        extern TaskHandle_t volatile pxCurrentTCB;
+    #endif
+
+/**
+ * inline_getters.h
+ * @code{c}
+ * TickType_t xTaskGetTickCountInline( void );
+ * @endcode
+ *
+ * Inline version of xTaskGetTickCount().
+ *
+ * \defgroup xTaskGetTickCountInline xTaskGetTickCountInline
+ * \ingroup TaskUtils
+ */
+    static portFORCE_INLINE TickType_t xTaskGetTickCountInline( void )
+    {
+        #if ( ( portTICK_TYPE_IS_ATOMIC == 1 ) && ( configUSE_TICKLESS_KERNEL == 0 ) )
+            return xTickCount;
+        #else
+            return xTaskGetTickCount();
+        #endif
+    }
+
+/**
+ * inline_getters.h
+ * @code{c}
+ * TaskHandle_t xTaskGetCurrentTaskHandleInline( void );
+ * @endcode
+ *
+ * Inline version of xTaskGetCurrentTaskHandle().
+ *
+ * \defgroup xTaskGetCurrentTaskHandleInline xTaskGetCurrentTaskHandleInline
+ * \ingroup TaskUtils
+ */
+    static portFORCE_INLINE TaskHandle_t xTaskGetCurrentTaskHandleInline( void )
+    {
+        #if ( configNUMBER_OF_CORES == 1 )
+            return pxCurrentTCB;
+        #else
+
+            /* The calling task could move to another core between reading
+             * the core ID and reading that core's current task. */
+            return xTaskGetCurrentTaskHandle();
+        #endif
+    }
+
+/**
+ * inline_getters.h
+ * @code{c}
+ * BaseType_t xTaskGetSchedulerStateInline( void );
+ * @endcode
+ *
+ * Inline version of xTaskGetSchedulerState().
+ *
+ * \defgroup xTaskGetSchedulerStateInline xTaskGetSchedulerStateInline
+ * \ingroup TaskUtils
+ */
+    static portFORCE_INLINE BaseType_t xTaskGetSchedulerStateInline( void )
+    {
+        #if ( configNUMBER_OF_CORES == 1 )
+            BaseType_t xReturn;
+
+            if( xSchedulerRunning == pdFALSE )
+            {
+                xReturn = taskSCHEDULER_NOT_STARTED;
+            }
+            else if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
+            {
+                xReturn = taskSCHEDULER_RUNNING;
+            }
+            else
+            {
+                xReturn = taskSCHEDULER_SUSPENDED;
+            }
+
+            return xReturn;
+        #else
+
+            /* The scheduler state of a multi core build is read in a critical
+             * section, as another core may be suspending the scheduler. */
+            return xTaskGetSchedulerState();
+        #endif
+    }
+
+/**
+ * inline_getters.h
+ * @code{c}
+ * UBaseType_t uxQueueMessagesWaitingInline( const QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Inline version of uxQueueMessagesWaiting().
+ *
+ * \defgroup uxQueueMessagesWaitingInline uxQueueMessagesWaitingInline
+ * \ingroup QueueManagement
+ */
+    static portFORCE_INLINE UBaseType_t uxQueueMessagesWaitingInline( const QueueHandle_t xQueue )
+    {
+        #if ( ( configUSE_SPSC_QUEUES == 0 ) && ( configUSE_MPMC_QUEUES == 0 ) && ( configUSE_ATOMIC_SEMAPHORES == 0 ) )
+
+            /* StaticQueue_t mirrors the layout of the queue structure, in
+             * which the number of items in the queue is the first of the
+             * UBaseType_t members that uxDummy4 stands in for. */
+            return *( ( const volatile UBaseType_t * ) &( ( ( const StaticQueue_t * ) xQueue )->uxDummy4[ 0 ] ) );
+        #else
+
+            /* The number of items in a lock free queue is calculated from its
+             * indexes. */
+            return uxQueueMessagesWaiting( xQueue );
+        #endif
+    }
+
+#endif /* configUSE_INLINE_GETTERS */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* INLINE_GETTERS_H */
@@ -0,0 +1,218 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef LIGHT_MUTEX_H
+#define LIGHT_MUTEX_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include light_mutex.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A light mutex is a mutual exclusion lock that occupies a few words and
+ * supports priority inheritance, for use where a standard mutex created with
+ * xSemaphoreCreateMutex() is too heavy.  Taking a light mutex that is free, and
+ * giving a light mutex no other task is waiting for, each take one short
+ * critical section.  Only a task that has to wait for the mutex suspends the
+ * scheduler and uses the kernel's event list and priority inheritance code.
+ *
+ * Light mutexes cannot be used from interrupts and cannot be used with queue
+ * sets.  They can only be taken recursively using xLightMutexTakeRecursive()
+ * and xLightMutexGiveRecursive().  The application provides the memory, and
+ * must call vLightMutexInit() before the mutex is used.
+ *
+ * Set configUSE_LIGHT_MUTEXES to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup LightMutex_t LightMutex_t
+ * \ingroup LightMutexes
+ */
+typedef struct xLIGHT_MUTEX
+{
+    volatile TaskHandle_t xOwner; /**< The task holding the mutex, or NULL if the mutex is free. */
+    List_t xTasksWaitingToTake;   /**< Tasks blocked waiting for the mutex, in priority order. */
+
+    #if ( configUSE_RECURSIVE_MUTEXES == 1 )
+        UBaseType_t uxRecursiveCallCount; /**< The number of times the holder has taken the mutex with xLightMutexTakeRecursive() without giving it back.  Only accessed by the holder. */
+    #endif
+} LightMutex_t;
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * void vLightMutexInit( LightMutex_t * pxMutex );
+ * @endcode
+ *
+ * Initialise a light mutex so it is free.  Must not be called while any task
+ * holds or is waiting for the mutex.
+ *
+ * @param pxMutex The light mutex being initialised.
+ *
+ * \defgroup vLightMutexInit vLightMutexInit
+ * \ingroup LightMutexes
+ */
+void vLightMutexInit( LightMutex_t * pxMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * BaseType_t xLightMutexTake( LightMutex_t * pxMutex, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Take a light mutex, waiting in the Blocked state for up to xTicksToWait ticks
+ * if another task holds it.  While the calling task waits, the task holding
+ * the mutex inherits the calling task's priority if it is higher than its own.
+ * Must only be called from a task.
+ *
+ * @param pxMutex The light mutex being taken.
+ *
+ * @param xTicksToWait The maximum time to wait for the mutex to become free.
+ * Setting xTicksToWait to 0 returns immediately if the mutex is held.
+ *
+ * @return pdPASS if the calling task now holds the mutex, or pdFAIL if
+ * xTicksToWait expired first.
+ *
+ * \defgroup xLightMutexTake xLightMutexTake
+ * \ingroup LightMutexes
+ */
+BaseType_t xLightMutexTake( LightMutex_t * pxMutex,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * BaseType_t xLightMutexGive( LightMutex_t * pxMutex );
+ * @endcode
+ *
+ * Give a light mutex held by the calling task.  If the calling task inherited
+ * a priority while holding the mutex, and holds no other mutexes, it returns
+ * to its base priority.  The highest priority task waiting for the mutex, if
+ * any, is unblocked so it can take the mutex.
+ *
+ * @param pxMutex The light mutex being given.
+ *
+ * @return pdPASS if the mutex was given, or pdFAIL if the calling task did not
+ * hold the mutex.
+ *
+ * \defgroup xLightMutexGive xLightMutexGive
+ * \ingroup LightMutexes
+ */
+BaseType_t xLightMutexGive( LightMutex_t * pxMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * BaseType_t xLightMutexTakeRecursive( LightMutex_t * pxMutex, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Take a light mutex that the calling task may already hold.  If the calling
+ * task already holds the mutex then the call only increments a count of the
+ * times it has been taken, without entering a critical section, and always
+ * succeeds.  Otherwise the mutex is taken as by xLightMutexTake().  A mutex
+ * taken with this function must be given back with xLightMutexGiveRecursive()
+ * as many times as it was taken before another task can take it.
+ *
+ * configUSE_RECURSIVE_MUTEXES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param pxMutex The light mutex being taken.
+ *
+ * @param xTicksToWait The maximum time to wait for the mutex to become free if
+ * another task holds it.
+ *
+ * @return pdPASS if the calling task now holds the mutex, or pdFAIL if
+ * xTicksToWait expired first.
+ *
+ * \defgroup xLightMutexTakeRecursive xLightMutexTakeRecursive
+ * \ingroup LightMutexes
+ */
+#if ( configUSE_RECURSIVE_MUTEXES == 1 )
+    BaseType_t xLightMutexTakeRecursive( LightMutex_t * pxMutex,
+                                         TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * BaseType_t xLightMutexGiveRecursive( LightMutex_t * pxMutex );
+ * @endcode
+ *
+ * Give back one recursive take of a light mutex held by the calling task.  The
+ * mutex is only given, as by xLightMutexGive(), when this function has been
+ * called once for each successful call to xLightMutexTakeRecursive().  The
+ * calls that do not give the mutex only decrement a count, without entering
+ * a critical section.
+ *
+ * configUSE_RECURSIVE_MUTEXES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param pxMutex The light mutex being given.
+ *
+ * @return pdPASS if the take was given back, or pdFAIL if the calling task did
+ * not hold the mutex.
+ *
+ * \defgroup xLightMutexGiveRecursive xLightMutexGiveRecursive
+ * \ingroup LightMutexes
+ */
+#if ( configUSE_RECURSIVE_MUTEXES == 1 )
+    BaseType_t xLightMutexGiveRecursive( LightMutex_t * pxMutex ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * TaskHandle_t xLightMutexGetHolder( const LightMutex_t * pxMutex );
+ * @endcode
+ *
+ * @param pxMutex The light mutex being queried.
+ *
+ * @return The handle of the task holding the mutex, or NULL if the mutex is
+ * free.
+ *
+ * \defgroup xLightMutexGetHolder xLightMutexGetHolder
+ * \ingroup LightMutexes
+ */
+TaskHandle_t xLightMutexGetHolder( const LightMutex_t * pxMutex ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* LIGHT_MUTEX_H */
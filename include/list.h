@@ -136,6 +136,17 @@
     #define listTEST_LIST_INTEGRITY( pxList )                           configASSERT( ( ( pxList )->xListIntegrityValue1 == pdINTEGRITY_CHECK_VALUE ) && ( ( pxList )->xListIntegrityValue2 == pdINTEGRITY_CHECK_VALUE ) )
 #endif /* configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES */
 
+/* A lighter weight check than the integrity check bytes above, which adds
+ * nothing to the list structures.  Every item in a list is linked to both of
+ * its neighbours, so each link is held twice and corruption of either copy
+ * shows as an item whose neighbours do not point back to it.  Evaluates to
+ * pdTRUE if both neighbours of pxItem point back to it, otherwise pdFALSE.
+ * pxItem can be a list end marker. */
+#if ( configUSE_LIST_LINK_CHECKS > 0 )
+    #define listITEM_LINKS_ARE_VALID( pxItem ) \
+    ( ( ( ( pxItem )->pxNext->pxPrevious == ( pxItem ) ) && ( ( pxItem )->pxPrevious->pxNext == ( pxItem ) ) ) ? pdTRUE : pdFALSE )
+#endif
+
 
 /*
  * Definition of the only type of object that a list can contain.
@@ -149,6 +160,11 @@ struct xLIST_ITEM
     struct xLIST_ITEM * configLIST_VOLATILE pxPrevious; /**< Pointer to the previous ListItem_t in the list. */
     void * pvOwner;                                     /**< Pointer to the object (normally a TCB) that contains the list item.  There is therefore a two way link between the object containing the list item and the list item itself. */
     struct xLIST * configLIST_VOLATILE pxContainer;     /**< Pointer to the list in which this list item is placed (if any). */
+    #if ( configUSE_SKIP_LISTS == 1 )
+        struct xLIST_ITEM * configLIST_VOLATILE pxSkipNext[ configSKIP_LIST_LANES ];     /**< Pointers to the next ListItem_t in each skip list lane the item is in.  NULL at the end of a lane. */
+        struct xLIST_ITEM * configLIST_VOLATILE pxSkipPrevious[ configSKIP_LIST_LANES ]; /**< Pointers to the previous ListItem_t in each skip list lane the item is in.  NULL at the start of a lane. */
+        UBaseType_t uxSkipLanes;                                                         /**< The number of skip list lanes, counted from the lowest, the item is in.  Zero when the item is not in a skip list. */
+    #endif
     listSECOND_LIST_ITEM_INTEGRITY_CHECK_VALUE          /**< Set to a known value if configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
 };
 typedef struct xLIST_ITEM ListItem_t;
@@ -175,6 +191,11 @@ typedef struct xLIST
     configLIST_VOLATILE UBaseType_t uxNumberOfItems;
     ListItem_t * configLIST_VOLATILE pxIndex; /**< Used to walk through the list.  Points to the last item returned by a call to listGET_OWNER_OF_NEXT_ENTRY (). */
     MiniListItem_t xListEnd;                  /**< List item that contains the maximum possible item value meaning it is always at the end of the list and is therefore used as a marker. */
+    #if ( configUSE_SKIP_LISTS == 1 )
+        ListItem_t * configLIST_VOLATILE pxSkipHead[ configSKIP_LIST_LANES ]; /**< The first item in each skip list lane, or NULL if the lane is empty. */
+        BaseType_t xIsSkipList;                                               /**< pdTRUE if the list was initialised by vListInitialiseSkipList(). */
+        UBaseType_t uxSkipInserts;                                            /**< Counts sorted insertions.  The lanes a new item joins are derived from it. */
+    #endif
     listSECOND_LIST_INTEGRITY_CHECK_VALUE     /**< Set to a known value if configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
 } List_t;
 
@@ -282,7 +303,7 @@ typedef struct xLIST
  * \page listGET_OWNER_OF_NEXT_ENTRY listGET_OWNER_OF_NEXT_ENTRY
  * \ingroup LinkedList
  */
-#if ( configNUMBER_OF_CORES == 1 )
+#if ( ( configNUMBER_OF_CORES == 1 ) || ( configUSE_PER_CORE_CO_ROUTINES == 1 ) )
     #define listGET_OWNER_OF_NEXT_ENTRY( pxTCB, pxList )                                       \
     do {                                                                                       \
         List_t * const pxConstList = ( pxList );                                               \
@@ -295,13 +316,48 @@ typedef struct xLIST
         }                                                                                      \
         ( pxTCB ) = ( pxConstList )->pxIndex->pvOwner;                                         \
     } while( 0 )
-#else /* #if ( configNUMBER_OF_CORES == 1 ) */
+#else /* #if ( ( configNUMBER_OF_CORES == 1 ) || ( configUSE_PER_CORE_CO_ROUTINES == 1 ) ) */
 
 /* This function is not required in SMP. FreeRTOS SMP scheduler doesn't use
  * pxIndex and it should always point to the xListEnd. Not defining this macro
- * here to prevent updating pxIndex.
+ * here to prevent updating pxIndex.  The per core co-routine schedulers do use
+ * it, but only on their own ready lists, which the task scheduler never sees.
+ */
+#endif /* #if ( ( configNUMBER_OF_CORES == 1 ) || ( configUSE_PER_CORE_CO_ROUTINES == 1 ) ) */
+
+/*
+ * Unlink an item from the skip list lanes it is in, if any.  Lanes are only
+ * built by vListInsert() on lists initialised by vListInitialiseSkipList(), so
+ * for every other item uxSkipLanes is zero and this is a single test.  Used by
+ * uxListRemove() and listREMOVE_ITEM(), and not intended for application use.
  */
-#endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+#if ( configUSE_SKIP_LISTS == 1 )
+    #define listREMOVE_SKIP_LANES( pxList, pxItemToRemove )                                                                  \
+    do {                                                                                                                     \
+        UBaseType_t uxLane;                                                                                                  \
+                                                                                                                             \
+        for( uxLane = 0U; uxLane < ( pxItemToRemove )->uxSkipLanes; uxLane++ )                                              \
+        {                                                                                                                    \
+            if( ( pxItemToRemove )->pxSkipPrevious[ uxLane ] == NULL )                                                       \
+            {                                                                                                                \
+                ( pxList )->pxSkipHead[ uxLane ] = ( pxItemToRemove )->pxSkipNext[ uxLane ];                                 \
+            }                                                                                                                \
+            else                                                                                                             \
+            {                                                                                                                \
+                ( pxItemToRemove )->pxSkipPrevious[ uxLane ]->pxSkipNext[ uxLane ] = ( pxItemToRemove )->pxSkipNext[ uxLane ]; \
+            }                                                                                                                \
+                                                                                                                             \
+            if( ( pxItemToRemove )->pxSkipNext[ uxLane ] != NULL )                                                           \
+            {                                                                                                                \
+                ( pxItemToRemove )->pxSkipNext[ uxLane ]->pxSkipPrevious[ uxLane ] = ( pxItemToRemove )->pxSkipPrevious[ uxLane ]; \
+            }                                                                                                                \
+        }                                                                                                                    \
+                                                                                                                             \
+        ( pxItemToRemove )->uxSkipLanes = 0U;                                                                                \
+    } while( 0 )
+#else
+    #define listREMOVE_SKIP_LANES( pxList, pxItemToRemove )
+#endif /* configUSE_SKIP_LISTS */
 
 /*
  * Version of uxListRemove() that does not return a value.  Provided as a slight
@@ -327,6 +383,7 @@ typedef struct xLIST
                                                                                                     \
         ( pxItemToRemove )->pxNext->pxPrevious = ( pxItemToRemove )->pxPrevious;                    \
         ( pxItemToRemove )->pxPrevious->pxNext = ( pxItemToRemove )->pxNext;                        \
+        listREMOVE_SKIP_LANES( pxList, ( pxItemToRemove ) );                                        \
         /* Make sure the index is left pointing to a valid item. */                                 \
         if( pxList->pxIndex == ( pxItemToRemove ) )                                                 \
         {                                                                                           \
@@ -440,6 +497,25 @@ typedef struct xLIST
  */
 void vListInitialise( List_t * const pxList ) PRIVILEGED_FUNCTION;
 
+/*
+ * Initialise a list as vListInitialise() does, but also mark it as a skip
+ * list.  vListInsert() then links every fourth item inserted into the list
+ * into one or more sorted express lanes on top of the list itself, so it can
+ * find the insertion position in O(log n) rather than O(n) steps however the
+ * inserted values are distributed.  The list can otherwise be used exactly
+ * as any other list.  Only available when configUSE_SKIP_LISTS is set to 1.
+ *
+ * Items added to a skip list with vListInsertEnd() do not join any lanes.
+ *
+ * @param pxList Pointer to the list being initialised.
+ *
+ * \page vListInitialiseSkipList vListInitialiseSkipList
+ * \ingroup LinkedList
+ */
+#if ( configUSE_SKIP_LISTS == 1 )
+    void vListInitialiseSkipList( List_t * const pxList ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Must be called before a list item is used.  This sets the list container to
  * null so the item does not think that it is already contained in a list.
@@ -487,6 +563,22 @@ void vListInsert( List_t * const pxList,
 void vListInsertEnd( List_t * const pxList,
                      ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
 
+/*
+ * Move every item of pxSortedList, which must be in ascending item value
+ * order, into pxList at the positions vListInsert() would place them, leaving
+ * pxSortedList empty.  pxList is walked once for all the items rather than
+ * once for each item.
+ *
+ * @param pxList The list into which the items are to be inserted.
+ *
+ * @param pxSortedList The list holding the items to be inserted.
+ *
+ * \page vListMerge vListMerge
+ * \ingroup LinkedList
+ */
+void vListMerge( List_t * const pxList,
+                 List_t * const pxSortedList ) PRIVILEGED_FUNCTION;
+
 /*
  * Remove an item from a list.  The list item has a pointer to the list that
  * it is in, so only the list item need be passed into the function.
@@ -502,6 +594,26 @@ void vListInsertEnd( List_t * const pxList,
  */
 UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove ) PRIVILEGED_FUNCTION;
 
+/*
+ * Walk a list checking that each item's neighbours point back to it, that
+ * each item's container is the list, that the list's index is one of its
+ * items or its end marker, and that the number of items found matches the
+ * list's item count.  The walk is bounded by the item count, so it ends even
+ * if the links form a loop that does not include the end marker.  Must be
+ * called with the list protected from modification, for example from within a
+ * critical section.  Only available when configUSE_LIST_LINK_CHECKS is not 0.
+ *
+ * @param pxList The list to check.
+ *
+ * @return pdPASS if no corruption was found, otherwise pdFAIL.
+ *
+ * \page xListCheckLinks xListCheckLinks
+ * \ingroup LinkedList
+ */
+#if ( configUSE_LIST_LINK_CHECKS > 0 )
+    BaseType_t xListCheckLinks( const List_t * const pxList ) PRIVILEGED_FUNCTION;
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
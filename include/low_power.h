@@ -0,0 +1,128 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include low_power.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Describes one sleep state the hardware can enter while the tick is
+ * suppressed.  Sleep states are registered with vLowPowerRegisterSleepStates()
+ * in order from the shallowest to the deepest.
+ *
+ * Each time the idle task suppresses the tick it predicts how long the idle
+ * period will last, then enters the deepest state for which
+ * ulEntryLatencyUs + ulExitLatencyUs + ulTargetResidencyUs is no longer than
+ * the prediction.  The shallowest state is entered if no state fits.
+ *
+ * Set configUSE_SLEEP_STATES to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * \defgroup SleepState_t SleepState_t
+ * \ingroup LowPower
+ */
+typedef struct xSLEEP_STATE
+{
+    const char * pcName;          /**< A descriptive name for the state, used only for debugging. */
+    uint32_t ulEntryLatencyUs;    /**< The time taken to enter the state, in microseconds. */
+    uint32_t ulExitLatencyUs;     /**< The time taken to leave the state once woken, in microseconds. */
+    uint32_t ulTargetResidencyUs; /**< The time that must be spent in the state for the power it saves to exceed the cost of entering and leaving it, in microseconds. */
+    uint32_t ulPowerUw;           /**< The power drawn while in the state, in microwatts.  Each state must draw less than the state before it. */
+
+    /* The function that suppresses the tick and sleeps in this state, with the
+     * same behaviour as portSUPPRESS_TICKS_AND_SLEEP().  Set to NULL to use
+     * portSUPPRESS_TICKS_AND_SLEEP() itself, in which case
+     * configPRE_SLEEP_PROCESSING() can call pxLowPowerGetSelectedState() to
+     * find which state to enter. */
+    void ( * pxSuppressTicksAndSleep )( TickType_t xExpectedIdleTime );
+} SleepState_t;
+
+/**
+ * low_power.h
+ * @code{c}
+ * void vLowPowerRegisterSleepStates( const SleepState_t * pxSleepStates, UBaseType_t uxNumberOfStates );
+ * @endcode
+ *
+ * Register the sleep states the idle task chooses between.  Call before the
+ * scheduler is started.  Until sleep states are registered the idle task uses
+ * portSUPPRESS_TICKS_AND_SLEEP() directly.
+ *
+ * @param pxSleepStates An array of uxNumberOfStates sleep states, ordered from
+ * the shallowest to the deepest.  The array is not copied, so must remain
+ * valid.
+ *
+ * @param uxNumberOfStates The number of states in the array.
+ *
+ * \defgroup vLowPowerRegisterSleepStates vLowPowerRegisterSleepStates
+ * \ingroup LowPower
+ */
+void vLowPowerRegisterSleepStates( const SleepState_t * pxSleepStates,
+                                   UBaseType_t uxNumberOfStates ) PRIVILEGED_FUNCTION;
+
+/**
+ * low_power.h
+ * @code{c}
+ * const SleepState_t * pxLowPowerGetSelectedState( void );
+ * @endcode
+ *
+ * @return The sleep state the idle task selected for the idle period being
+ * entered, or NULL if no sleep states are registered.  Intended to be called
+ * from configPRE_SLEEP_PROCESSING() and configPOST_SLEEP_PROCESSING().
+ *
+ * \defgroup pxLowPowerGetSelectedState pxLowPowerGetSelectedState
+ * \ingroup LowPower
+ */
+const SleepState_t * pxLowPowerGetSelectedState( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY INTENDED
+ * FOR USE BY THE IDLE TASK IN PLACE OF portSUPPRESS_TICKS_AND_SLEEP().
+ *
+ * Predicts the length of the idle period, selects and enters a sleep state,
+ * then records how long the idle period lasted.  Called with the scheduler
+ * suspended.
+ */
+void vLowPowerSuppressTicksAndSleep( TickType_t xExpectedIdleTime ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* LOW_POWER_H */
@@ -57,7 +57,9 @@
  * architecture, so writing a 10 byte message to a message buffer on a 32-bit
  * architecture will actually reduce the available space in the message buffer
  * by 14 bytes (10 byte are used by the message, and 4 bytes to hold the length
- * of the message).
+ * of the message).  If configUSE_MESSAGE_BUFFER_VARINT_LENGTHS is set to 1 in
+ * FreeRTOSConfig.h the length is instead held in one byte for messages of up
+ * to 127 bytes, two bytes for messages of up to 16383 bytes, and so on.
  */
 
 #ifndef FREERTOS_MESSAGE_BUFFER_H
@@ -250,6 +252,70 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
     xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), 0, sbTYPE_MESSAGE_BUFFER, ( pucMessageBufferStorageArea ), ( pxStaticMessageBuffer ), ( pxSendCompletedCallback ), ( pxReceiveCompletedCallback ) )
 #endif
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * MessageBufferHandle_t xMessageBufferCreateAligned( size_t xBufferSizeBytes );
+ *
+ * MessageBufferHandle_t xMessageBufferCreateStaticAligned( size_t xBufferSizeBytes,
+ *                                                          uint8_t *pucMessageBufferStorageArea,
+ *                                                          StaticMessageBuffer_t *pxStaticMessageBuffer );
+ * @endcode
+ *
+ * Versions of xMessageBufferCreate() and xMessageBufferCreateStatic() that
+ * create a message buffer with an aligned storage area, as described for
+ * xStreamBufferCreateAligned().  In addition, the length stored with each
+ * message and the message itself are both padded to a multiple of
+ * portBYTE_ALIGNMENT bytes, so every message starts word aligned within the
+ * storage area.  The padding uses part of the message buffer's space.
+ *
+ * configUSE_ALIGNED_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h for
+ * these macros to be available.
+ *
+ * \defgroup xMessageBufferCreateAligned xMessageBufferCreateAligned
+ * \ingroup MessageBufferManagement
+ */
+#if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+    #define xMessageBufferCreateAligned( xBufferSizeBytes ) \
+    xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( size_t ) 0, ( sbTYPE_MESSAGE_BUFFER | sbTYPE_ALIGNED_STORAGE ), NULL, NULL )
+
+    #define xMessageBufferCreateStaticAligned( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) \
+    xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), 0, ( sbTYPE_MESSAGE_BUFFER | sbTYPE_ALIGNED_STORAGE ), ( pucMessageBufferStorageArea ), ( pxStaticMessageBuffer ), NULL, NULL )
+#endif
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * MessageBufferHandle_t xMessageBufferCreateMultiProducer( size_t xBufferSizeBytes );
+ *
+ * MessageBufferHandle_t xMessageBufferCreateStaticMultiProducer( size_t xBufferSizeBytes,
+ *                                                                uint8_t *pucMessageBufferStorageArea,
+ *                                                                StaticMessageBuffer_t *pxStaticMessageBuffer );
+ * @endcode
+ *
+ * Versions of xMessageBufferCreate() and xMessageBufferCreateStatic() that
+ * create a message buffer any number of tasks and interrupts can write to at
+ * the same time, as described for xStreamBufferCreateMultiProducer().  Each
+ * message is either written whole or, if there is not enough space for it,
+ * not written at all.  Writes never block, so xMessageBufferSend() ignores its
+ * xTicksToWait parameter.
+ *
+ * configUSE_MULTI_PRODUCER_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h
+ * for these macros to be available.
+ *
+ * \defgroup xMessageBufferCreateMultiProducer xMessageBufferCreateMultiProducer
+ * \ingroup MessageBufferManagement
+ */
+#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+    #define xMessageBufferCreateMultiProducer( xBufferSizeBytes ) \
+    xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( size_t ) 0, ( sbTYPE_MESSAGE_BUFFER | sbTYPE_MULTI_PRODUCER ), NULL, NULL )
+
+    #define xMessageBufferCreateStaticMultiProducer( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) \
+    xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), 0, ( sbTYPE_MESSAGE_BUFFER | sbTYPE_MULTI_PRODUCER ), ( pucMessageBufferStorageArea ), ( pxStaticMessageBuffer ), NULL, NULL )
+#endif
+
 /**
  * message_buffer.h
  *
@@ -692,6 +758,148 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
 #define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) \
     xStreamBufferReceiveFromISR( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendV( MessageBufferHandle_t xMessageBuffer,
+ *                             const StreamBufferSegment_t * const pxSegments,
+ *                             UBaseType_t uxSegmentCount,
+ *                             TickType_t xTicksToWait );
+ *
+ * size_t xMessageBufferSendVFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                    const StreamBufferSegment_t * const pxSegments,
+ *                                    UBaseType_t uxSegmentCount,
+ *                                    BaseType_t * const pxHigherPriorityTaskWoken );
+ *
+ * size_t xMessageBufferReceiveV( MessageBufferHandle_t xMessageBuffer,
+ *                                const StreamBufferSegment_t * const pxSegments,
+ *                                UBaseType_t uxSegmentCount,
+ *                                TickType_t xTicksToWait );
+ *
+ * size_t xMessageBufferReceiveVFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                       const StreamBufferSegment_t * const pxSegments,
+ *                                       UBaseType_t uxSegmentCount,
+ *                                       BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Scatter-gather versions of xMessageBufferSend(), xMessageBufferSendFromISR(),
+ * xMessageBufferReceive() and xMessageBufferReceiveFromISR().  The send
+ * functions gather the uxSegmentCount segments at pxSegments, in order, into a
+ * single message with a single length, so a header and a payload held in
+ * separate buffers can be sent without first being copied together.  The
+ * receive functions scatter the next message across the segments in order, and
+ * fail if the message is longer than the total length of the segments.
+ *
+ * Apart from taking a list of segments in place of a single buffer, each
+ * function behaves exactly as the function it replaces.
+ *
+ * configUSE_STREAM_BUFFER_SEGMENTS must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * \defgroup xMessageBufferSendV xMessageBufferSendV
+ * \ingroup MessageBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_SEGMENTS == 1 )
+    #define xMessageBufferSendV( xMessageBuffer, pxSegments, uxSegmentCount, xTicksToWait ) \
+    xStreamBufferSendV( ( xMessageBuffer ), ( pxSegments ), ( uxSegmentCount ), ( xTicksToWait ) )
+
+    #define xMessageBufferSendVFromISR( xMessageBuffer, pxSegments, uxSegmentCount, pxHigherPriorityTaskWoken ) \
+    xStreamBufferSendVFromISR( ( xMessageBuffer ), ( pxSegments ), ( uxSegmentCount ), ( pxHigherPriorityTaskWoken ) )
+
+    #define xMessageBufferReceiveV( xMessageBuffer, pxSegments, uxSegmentCount, xTicksToWait ) \
+    xStreamBufferReceiveV( ( xMessageBuffer ), ( pxSegments ), ( uxSegmentCount ), ( xTicksToWait ) )
+
+    #define xMessageBufferReceiveVFromISR( xMessageBuffer, pxSegments, uxSegmentCount, pxHigherPriorityTaskWoken ) \
+    xStreamBufferReceiveVFromISR( ( xMessageBuffer ), ( pxSegments ), ( uxSegmentCount ), ( pxHigherPriorityTaskWoken ) )
+#endif /* configUSE_STREAM_BUFFER_SEGMENTS */
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceiveBatch( MessageBufferHandle_t xMessageBuffer,
+ *                                    void * pvRxData,
+ *                                    size_t xBufferLengthBytes,
+ *                                    size_t * const pxMessageOffsets,
+ *                                    size_t xMaxMessages,
+ *                                    size_t * const pxMessageCount,
+ *                                    TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Receives as many whole messages as fit in the buffer at pvRxData, up to
+ * xMaxMessages, in a single call.  The messages are copied one after another
+ * without their lengths, and the offset into pvRxData of the start of each one
+ * is written to pxMessageOffsets, so message n is pxMessageOffsets[ n + 1 ] -
+ * pxMessageOffsets[ n ] bytes long, and the last message ends at the returned
+ * byte count.  The number of messages received is written to
+ * *pxMessageCount.
+ *
+ * The calling task blocks, as in xMessageBufferReceive(), only until the first
+ * message is available.  The batch ends at the first message that does not
+ * fit in the space remaining in pvRxData, which is left in the message buffer
+ * to be read by the next receive.  A task blocked waiting for space is
+ * notified once for the whole batch rather than once per message, so a burst
+ * of small messages costs the reader a single call and the writer a single
+ * wake.
+ *
+ * configUSE_MESSAGE_BUFFER_BATCH_RECEIVE must be set to 1 in FreeRTOSConfig.h
+ * for xMessageBufferReceiveBatch() to be available.
+ *
+ * @param xMessageBuffer The handle of the message buffer from which messages
+ * are being received.
+ *
+ * @param pvRxData A pointer to the buffer into which the messages are to be
+ * copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ *
+ * @param pxMessageOffsets An array of at least xMaxMessages entries into which
+ * the offset of each received message is written.
+ *
+ * @param xMaxMessages The largest number of messages to receive.
+ *
+ * @param pxMessageCount Used to return the number of messages received.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for a message.
+ *
+ * @return The total number of bytes of message data received, which is 0 if
+ * the call timed out before a message was available, or if the next message
+ * is larger than xBufferLengthBytes.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( MessageBufferHandle_t xMessageBuffer )
+ * {
+ * uint8_t ucRxData[ 64 ];
+ * size_t xOffsets[ 8 ], xMessages, xReceivedBytes, x, xEnd;
+ *
+ *  xReceivedBytes = xMessageBufferReceiveBatch( xMessageBuffer,
+ *                                               ucRxData,
+ *                                               sizeof( ucRxData ),
+ *                                               xOffsets,
+ *                                               8,
+ *                                               &xMessages,
+ *                                               pdMS_TO_TICKS( 20 ) );
+ *
+ *  for( x = 0; x < xMessages; x++ )
+ *  {
+ *      xEnd = ( ( x + 1 ) < xMessages ) ? xOffsets[ x + 1 ] : xReceivedBytes;
+ *
+ *      // Process the message held in ucRxData from xOffsets[ x ] to xEnd
+ *      // here....
+ *  }
+ * }
+ * @endcode
+ * \defgroup xMessageBufferReceiveBatch xMessageBufferReceiveBatch
+ * \ingroup MessageBufferManagement
+ */
+#if ( configUSE_MESSAGE_BUFFER_BATCH_RECEIVE == 1 )
+    #define xMessageBufferReceiveBatch( xMessageBuffer, pvRxData, xBufferLengthBytes, pxMessageOffsets, xMaxMessages, pxMessageCount, xTicksToWait ) \
+    xStreamBufferReceiveBatch( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxMessageOffsets ), ( xMaxMessages ), ( pxMessageCount ), ( xTicksToWait ) )
+#endif /* configUSE_MESSAGE_BUFFER_BATCH_RECEIVE */
+
 /**
  * message_buffer.h
  *
@@ -958,6 +1166,30 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
 #define xMessageBufferReceiveCompletedFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) \
     xStreamBufferReceiveCompletedFromISR( ( xMessageBuffer ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * void vMessageBufferGetLatencyHistogram( MessageBufferHandle_t xMessageBuffer,
+ *                                         IPCLatencyHistogram_t * pxHistogram );
+ * @endcode
+ *
+ * Returns the latencies of the tagged messages received from a message
+ * buffer.  See vStreamBufferGetLatencyHistogram() in stream_buffer.h.
+ *
+ * configUSE_IPC_LATENCY_TRACING must be set to 1 in FreeRTOSConfig.h for
+ * vMessageBufferGetLatencyHistogram() to be available.
+ *
+ * @param xMessageBuffer The handle of the message buffer being queried.
+ *
+ * @param pxHistogram The structure the histogram is copied into.
+ *
+ * \defgroup vMessageBufferGetLatencyHistogram vMessageBufferGetLatencyHistogram
+ * \ingroup MessageBufferManagement
+ */
+#define vMessageBufferGetLatencyHistogram( xMessageBuffer, pxHistogram ) \
+    vStreamBufferGetLatencyHistogram( ( xMessageBuffer ), ( pxHistogram ) )
+
 /* *INDENT-OFF* */
 #if defined( __cplusplus )
     } /* extern "C" */
@@ -0,0 +1,400 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include object_pool.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * An object pool holds a fixed number of equally sized items in a single block
+ * of memory.  Items are allocated from and freed back to the pool in constant
+ * time, and the pool's memory is never returned to the heap while the pool
+ * exists, so allocating and freeing items does not fragment the heap.
+ *
+ * Object pools are referenced by handles of type PoolHandle_t.
+ *
+ * Set configUSE_OBJECT_POOLS to 1 in FreeRTOSConfig.h to include this
+ * functionality.  Set configKERNEL_OBJECT_POOLS to 1 as well to have the
+ * kernel draw its own task, queue, timer and event group structures from
+ * object pools when they are created dynamically.
+ *
+ * \defgroup PoolHandle_t PoolHandle_t
+ * \ingroup ObjectPool
+ */
+struct PoolDef_t;
+typedef struct PoolDef_t * PoolHandle_t;
+
+/*
+ * The number of bytes of storage each item occupies in a pool created to hold
+ * items of xItemSize bytes.  Items are padded to keep them aligned to
+ * portBYTE_ALIGNMENT, and each item holds at least a pointer.
+ */
+#define poolITEM_STORAGE_SIZE( xItemSize )                                                                \
+    ( ( ( ( ( xItemSize ) > sizeof( void * ) ) ? ( xItemSize ) : sizeof( void * ) ) + portBYTE_ALIGNMENT_MASK ) & \
+      ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/**
+ * object_pool.h
+ * @code{c}
+ * PoolHandle_t xPoolCreate( size_t xItemSize, UBaseType_t uxItemCount );
+ * @endcode
+ *
+ * Create a new object pool that can hold uxItemCount items, each of
+ * xItemSize bytes.
+ *
+ * Internally, within the FreeRTOS implementation, an object pool uses a
+ * small structure followed by the storage for the items.  If an object pool
+ * is created using xPoolCreate() then all of the required memory is allocated
+ * by a single call to pvPortMalloc().  If an object pool is created using
+ * xPoolCreateStatic() then the application writer must instead provide the
+ * memory that will get used by the object pool.
+ *
+ * @param xItemSize The size, in bytes, of each item the pool holds.
+ *
+ * @param uxItemCount The number of items the pool holds.
+ *
+ * @return If the object pool was created then a handle to the pool is
+ * returned.  If there was insufficient FreeRTOS heap available to create the
+ * pool then NULL is returned.
+ *
+ * Example usage:
+ * @code{c}
+ * typedef struct
+ * {
+ *     uint32_t ulId;
+ *     uint8_t ucPayload[ 60 ];
+ * } Packet_t;
+ *
+ * void vAFunction( void )
+ * {
+ * PoolHandle_t xPacketPool;
+ * Packet_t * pxPacket;
+ *
+ *  // Create a pool of 32 packets.
+ *  xPacketPool = xPoolCreate( sizeof( Packet_t ), 32 );
+ *
+ *  if( xPacketPool != NULL )
+ *  {
+ *      pxPacket = ( Packet_t * ) pvPoolAllocate( xPacketPool );
+ *
+ *      if( pxPacket != NULL )
+ *      {
+ *          // Use the packet, then return it to the pool.
+ *          vPoolFree( xPacketPool, pxPacket );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xPoolCreate xPoolCreate
+ * \ingroup ObjectPool
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    PoolHandle_t xPoolCreate( size_t xItemSize,
+                              UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * object_pool.h
+ * @code{c}
+ * PoolHandle_t xPoolCreateStatic( size_t xItemSize,
+ *                                 UBaseType_t uxItemCount,
+ *                                 uint8_t * pucPoolStorageBuffer,
+ *                                 StaticPool_t * pxStaticPool );
+ * @endcode
+ *
+ * Create a new object pool using memory provided by the application writer.
+ *
+ * @param xItemSize The size, in bytes, of each item the pool holds.
+ *
+ * @param uxItemCount The number of items the pool holds.
+ *
+ * @param pucPoolStorageBuffer Must point to a buffer that is aligned to
+ * portBYTE_ALIGNMENT and is at least
+ * ( uxItemCount * poolITEM_STORAGE_SIZE( xItemSize ) ) bytes.  The items are
+ * held in this buffer.
+ *
+ * @param pxStaticPool Must point to a variable of type StaticPool_t, which
+ * will be used to hold the pool's data structure.
+ *
+ * @return If the object pool was created then a handle to the pool is
+ * returned.  If either pucPoolStorageBuffer or pxStaticPool are NULL then NULL
+ * is returned.
+ *
+ * \defgroup xPoolCreateStatic xPoolCreateStatic
+ * \ingroup ObjectPool
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    PoolHandle_t xPoolCreateStatic( size_t xItemSize,
+                                    UBaseType_t uxItemCount,
+                                    uint8_t * pucPoolStorageBuffer,
+                                    StaticPool_t * pxStaticPool ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * object_pool.h
+ * @code{c}
+ * void * pvPoolAllocate( PoolHandle_t xPool );
+ * @endcode
+ *
+ * Take an item from an object pool.  The call does not block.  The contents
+ * of the item are undefined.
+ *
+ * @param xPool The handle of the pool to take the item from.
+ *
+ * @return A pointer to the item, or NULL if every item in the pool is already
+ * allocated.
+ *
+ * \defgroup pvPoolAllocate pvPoolAllocate
+ * \ingroup ObjectPool
+ */
+void * pvPoolAllocate( PoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ * @code{c}
+ * void * pvPoolAllocateFromISR( PoolHandle_t xPool );
+ * @endcode
+ *
+ * A version of pvPoolAllocate() that can be called from an interrupt service
+ * routine (ISR).
+ *
+ * \defgroup pvPoolAllocateFromISR pvPoolAllocateFromISR
+ * \ingroup ObjectPool
+ */
+void * pvPoolAllocateFromISR( PoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ * @code{c}
+ * void vPoolFree( PoolHandle_t xPool, void * pvItem );
+ * @endcode
+ *
+ * Return an item to the object pool it was allocated from.
+ *
+ * @param xPool The handle of the pool the item was allocated from.
+ *
+ * @param pvItem The item being returned, as returned by pvPoolAllocate() or
+ * pvPoolAllocateFromISR().
+ *
+ * \defgroup vPoolFree vPoolFree
+ * \ingroup ObjectPool
+ */
+void vPoolFree( PoolHandle_t xPool,
+                void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ * @code{c}
+ * void vPoolFreeFromISR( PoolHandle_t xPool, void * pvItem );
+ * @endcode
+ *
+ * A version of vPoolFree() that can be called from an interrupt service
+ * routine (ISR).
+ *
+ * \defgroup vPoolFreeFromISR vPoolFreeFromISR
+ * \ingroup ObjectPool
+ */
+void vPoolFreeFromISR( PoolHandle_t xPool,
+                       void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ * @code{c}
+ * BaseType_t xPoolIsItemFromPool( PoolHandle_t xPool, const void * pvItem );
+ * @endcode
+ *
+ * Query whether pvItem lies within the storage of an object pool.
+ *
+ * @param xPool The handle of the pool being queried.
+ *
+ * @param pvItem The memory being tested.
+ *
+ * @return pdTRUE if pvItem is an item of xPool, otherwise pdFALSE.
+ *
+ * \defgroup xPoolIsItemFromPool xPoolIsItemFromPool
+ * \ingroup ObjectPool
+ */
+BaseType_t xPoolIsItemFromPool( PoolHandle_t xPool,
+                                const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ * @code{c}
+ * UBaseType_t uxPoolGetFreeItemCount( PoolHandle_t xPool );
+ * @endcode
+ *
+ * Query the number of items in an object pool that are not allocated.
+ *
+ * @param xPool The handle of the pool being queried.
+ *
+ * @return The number of items that can still be allocated from the pool.
+ *
+ * \defgroup uxPoolGetFreeItemCount uxPoolGetFreeItemCount
+ * \ingroup ObjectPool
+ */
+UBaseType_t uxPoolGetFreeItemCount( PoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ * @code{c}
+ * void vPoolDelete( PoolHandle_t xPool );
+ * @endcode
+ *
+ * Delete an object pool.  If the pool was created using xPoolCreate() then
+ * its memory is returned to the heap.  Items allocated from the pool must not
+ * be used after the pool is deleted.
+ *
+ * @param xPool The handle of the pool being deleted.
+ *
+ * \defgroup vPoolDelete vPoolDelete
+ * \ingroup ObjectPool
+ */
+void vPoolDelete( PoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_ISR_HEAP == 1 )
+
+/**
+ * object_pool.h
+ * @code{c}
+ * BaseType_t xPortISRHeapAddPool( PoolHandle_t xPool );
+ * @endcode
+ *
+ * Add an object pool to the pools pvPortMallocFromISR() allocates from.  Up to
+ * configISR_HEAP_MAX_POOLS pools, typically each with a different item size,
+ * can be added.  Pools must be added before any interrupt calls
+ * pvPortMallocFromISR() or vPortFreeFromISR(), and must not be deleted
+ * afterwards.
+ *
+ * @param xPool The handle of the pool being added.
+ *
+ * @return pdPASS if the pool was added, or pdFAIL if configISR_HEAP_MAX_POOLS
+ * pools have already been added.
+ *
+ * \defgroup xPortISRHeapAddPool xPortISRHeapAddPool
+ * \ingroup ObjectPool
+ */
+    BaseType_t xPortISRHeapAddPool( PoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ * @code{c}
+ * void * pvPortMallocFromISR( size_t xWantedSize );
+ * @endcode
+ *
+ * Allocate a block of at least xWantedSize bytes from an interrupt service
+ * routine.  The block is taken from the pool with the smallest items that are
+ * large enough and not exhausted, so allocation time does not depend on the
+ * state of the heap.  Set configUSE_LOCK_FREE_POOLS to 1 as well to allocate
+ * without masking interrupts.
+ *
+ * A block can be freed by vPortFreeFromISR() from an interrupt, or by
+ * vPoolFree() on the pool it belongs to from a task, so an interrupt can
+ * receive data straight into a block then pass the block's address to a task
+ * instead of copying the data:
+ * @code{c}
+ * void vRxInterruptHandler( void )
+ * {
+ *     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *     uint8_t * pucFrame = pvPortMallocFromISR( xFrameLength );
+ *
+ *     if( pucFrame != NULL )
+ *     {
+ *         vReadFrameFromPeripheral( pucFrame, xFrameLength );
+ *
+ *         if( xQueueSendFromISR( xFrameQueue, &pucFrame, &xHigherPriorityTaskWoken ) != pdPASS )
+ *         {
+ *             vPortFreeFromISR( pucFrame );
+ *         }
+ *     }
+ *
+ *     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ * @endcode
+ *
+ * @param xWantedSize The number of bytes required.
+ *
+ * @return A pointer to the block, or NULL if no pool with large enough items
+ * has an item free.
+ *
+ * \defgroup pvPortMallocFromISR pvPortMallocFromISR
+ * \ingroup ObjectPool
+ */
+    void * pvPortMallocFromISR( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ * @code{c}
+ * void vPortFreeFromISR( void * pv );
+ * @endcode
+ *
+ * Free a block allocated by pvPortMallocFromISR().  Can be called from an
+ * interrupt service routine.
+ *
+ * @param pv The block being freed.  Passing NULL has no effect.
+ *
+ * \defgroup vPortFreeFromISR vPortFreeFromISR
+ * \ingroup ObjectPool
+ */
+    void vPortFreeFromISR( void * pv ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_ISR_HEAP */
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE FOR THE
+ * EXCLUSIVE USE OF THE KERNEL WHEN configKERNEL_OBJECT_POOLS IS SET TO 1.
+ *
+ * pvPoolAllocateKernelObject() allocates xObjectSize bytes from the pool
+ * referenced by *pxPool, creating the pool to hold uxPoolLength objects the
+ * first time it is called.  The memory is allocated using pvPortMalloc() if
+ * the pool is empty or cannot be created.  vPoolFreeKernelObject() frees
+ * memory allocated by pvPoolAllocateKernelObject().
+ */
+#if ( configKERNEL_OBJECT_POOLS == 1 )
+    void * pvPoolAllocateKernelObject( PoolHandle_t * pxPool,
+                                       size_t xObjectSize,
+                                       UBaseType_t uxPoolLength ) PRIVILEGED_FUNCTION;
+    void vPoolFreeKernelObject( PoolHandle_t xPool,
+                                void * pvObject ) PRIVILEGED_FUNCTION;
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* OBJECT_POOL_H */
@@ -81,6 +81,13 @@
     #define portHAS_STACK_OVERFLOW_CHECKING    0
 #endif
 
+/* Set to 1 by ports that protect the limit of the running task's stack with a
+ * hardware guard, programmed through portSET_STACK_GUARD(), and report an
+ * overflow to vApplicationStackOverflowHook() from the resulting fault. */
+#ifndef portHAS_STACK_GUARD
+    #define portHAS_STACK_GUARD    0
+#endif
+
 #ifndef portARCH_NAME
     #define portARCH_NAME    NULL
 #endif
@@ -102,6 +109,11 @@
     #define configSTACK_ALLOCATION_FROM_SEPARATE_HEAP    0
 #endif
 
+#ifndef configUSE_HEAP_REGION_CAPABILITIES
+    /* Defined here as it changes the layout of HeapRegion_t. */
+    #define configUSE_HEAP_REGION_CAPABILITIES    0
+#endif
+
 #include "mpu_wrappers.h"
 
 /* *INDENT-OFF* */
@@ -150,8 +162,20 @@ typedef struct HeapRegion
 {
     uint8_t * pucStartAddress;
     size_t xSizeInBytes;
+    #if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+        uint32_t ulCapabilities; /* The portHEAP_CAPS_* bits the memory of the region has. */
+    #endif
 } HeapRegion_t;
 
+/* Capabilities a heap region can have when configUSE_HEAP_REGION_CAPABILITIES
+ * is 1.  Bits from portHEAP_CAPS_FIRST_APPLICATION_BIT upwards are free for the
+ * application to use. */
+#define portHEAP_CAPS_NONE                     ( ( uint32_t ) 0x00000000UL )
+#define portHEAP_CAPS_FAST                     ( ( uint32_t ) 0x00000001UL ) /* Tightly coupled or otherwise zero wait state memory. */
+#define portHEAP_CAPS_DMA                      ( ( uint32_t ) 0x00000002UL ) /* Memory DMA controllers can access. */
+#define portHEAP_CAPS_EXTERNAL                 ( ( uint32_t ) 0x00000004UL ) /* Large, slower external memory. */
+#define portHEAP_CAPS_FIRST_APPLICATION_BIT    ( ( uint32_t ) 0x00000100UL )
+
 /* Used to pass information about the heap out of vPortGetHeapStats(). */
 typedef struct xHeapStats
 {
@@ -164,6 +188,26 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* Used to pass the heap usage of each task out of uxPortGetHeapTaskUsage(). */
+typedef struct xHeapTaskUsage
+{
+    void * pvTask;               /* The handle of the task that allocated the blocks, or NULL for blocks allocated before the scheduler started or by more tasks than configHEAP_PROFILER_MAX_TASKS. */
+    size_t xCurrentBytes;        /* The total size of the task's blocks that are still allocated. */
+    size_t xPeakBytes;           /* The highest value xCurrentBytes has had. */
+    size_t xNumberOfAllocations; /* The number of blocks the task has allocated. */
+    size_t xNumberOfFrees;       /* The number of the task's blocks that have been freed, by any task. */
+} HeapTaskUsage_t;
+
+/* Used to pass the layout of the heap out of uxPortGetHeapBlockMap(). */
+typedef struct xHeapBlockInfo
+{
+    void * pvAddress;      /* The address an allocated block was returned at. */
+    size_t xBlockSize;     /* The size of the block, including the heap's own BlockLink_t structure. */
+    BaseType_t xAllocated; /* pdTRUE if the block is allocated, pdFALSE if it is free. */
+    void * pvTask;         /* The value HeapTaskUsage_t.pvTask holds for the task that allocated the block, or NULL if the block is free. */
+    void * pvCaller;       /* The value configHEAP_PROFILER_CALLER_ADDRESS() returned when the block was allocated, or NULL if the block is free. */
+} HeapBlockInfo_t;
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -183,6 +227,20 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+/*
+ * Fill pxTaskUsage with the number of bytes each task has allocated and not yet
+ * freed, and the most it has had allocated at once.  uxPortGetHeapBlockMap()
+ * fills pxBlockInfo with every block in the heap, free or allocated, in address
+ * order.  Both return the number of array entries written, which is at most
+ * uxArraySize.  Only available in heap_4.c when configUSE_HEAP_PROFILER is 1.
+ */
+#if ( configUSE_HEAP_PROFILER == 1 )
+    UBaseType_t uxPortGetHeapTaskUsage( HeapTaskUsage_t * pxTaskUsage,
+                                        UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxPortGetHeapBlockMap( HeapBlockInfo_t * pxBlockInfo,
+                                       UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -195,9 +253,85 @@ size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 void xPortResetHeapMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Allocates a block from a heap region that has all the capabilities in
+ * ulCapabilities, returning NULL if no such region has room.  Only heap_5.c
+ * supports region capabilities.
+ */
+#if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+    void * pvPortMallocCaps( size_t xWantedSize,
+                             uint32_t ulCapabilities ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Resizes a block allocated by pvPortMalloc(), in place if possible, and
+ * otherwise by moving its contents to a new block.  Only heap_4.c and
+ * heap_5.c support resizing blocks.
+ */
+#if ( configSUPPORT_HEAP_REALLOC == 1 )
+    void * pvPortRealloc( void * pv,
+                          size_t xWantedSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Allocates a block whose address is a multiple of xAlignment, which must be a
+ * power of two.  The block is freed by vPortFree().  Only heap_4.c and heap_5.c
+ * support aligned allocation.
+ */
+#if ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 )
+    void * pvPortMallocAligned( size_t xWantedSize,
+                                size_t xAlignment ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Movable blocks are accessed through a handle rather than an address so
+ * xPortCompactHeap() can move them to gather free space into larger blocks.
+ * pvPortLockMovable() returns the block's current address and keeps the block
+ * where it is until the matching call to vPortUnlockMovable(), and locks can be
+ * nested.  A movable block must be unlocked before it is freed with
+ * vPortFreeMovable(), and must not be passed to vPortFree().
+ * xPortMallocMovable() returns NULL if there is no room or all
+ * configHEAP_MOVABLE_BLOCKS handles are in use.
+ *
+ * xPortCompactHeap() moves unlocked movable blocks towards the start of the
+ * heap until at least xMaxBytesToMove bytes have been moved or no block can be
+ * moved, and returns the number of bytes moved.  The heap is locked while each
+ * block is moved.  Only heap_4.c supports movable blocks.
+ */
+#if ( configUSE_HEAP_COMPACTION == 1 )
+    struct HeapMovableBlockDefinition;
+    typedef struct HeapMovableBlockDefinition * HeapMovableHandle_t;
+
+    HeapMovableHandle_t xPortMallocMovable( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+    void vPortFreeMovable( HeapMovableHandle_t xHandle ) PRIVILEGED_FUNCTION;
+    void * pvPortLockMovable( HeapMovableHandle_t xHandle ) PRIVILEGED_FUNCTION;
+    void vPortUnlockMovable( HeapMovableHandle_t xHandle ) PRIVILEGED_FUNCTION;
+    size_t xPortCompactHeap( size_t xMaxBytesToMove ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Returns a block held in a task's allocation cache to the heap.  Only
+ * heap_4.c supports task allocation caches.
+ */
+#if ( configUSE_TASK_ALLOCATION_CACHE == 1 )
+    void vPortFreeCachedAllocation( void * pv ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Stops the heap charging the blocks of a task that is being deleted to the
+ * task, so freeing them later does not write to the task's freed TCB.  Only
+ * heap_4.c supports task heap quotas.
+ */
+#if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+    void vPortHeapDisownTask( void * pvTask ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configSTACK_ALLOCATION_FROM_SEPARATE_HEAP == 1 )
     void * pvPortMallocStack( size_t xSize ) PRIVILEGED_FUNCTION;
     void vPortFreeStack( void * pv ) PRIVILEGED_FUNCTION;
+#elif ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+    #define pvPortMallocStack( xSize )    pvPortMallocCaps( ( xSize ), configTASK_STACK_HEAP_CAPABILITIES )
+    #define vPortFreeStack                vPortFree
 #else
     #define pvPortMallocStack    pvPortMalloc
     #define vPortFreeStack       vPortFree
@@ -235,6 +369,19 @@ BaseType_t xPortStartScheduler( void ) PRIVILEGED_FUNCTION;
  */
 void vPortEndScheduler( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Ports that switch to a dedicated interrupt stack on each core, and paint
+ * those stacks with portISR_STACK_FILL_BYTE before the scheduler starts,
+ * implement this function to return the lowest address and the size in words
+ * of the interrupt stack of core xCoreID.  Used by
+ * uxTaskGetISRStackHighWaterMark().
+ */
+#if ( INCLUDE_uxTaskGetISRStackHighWaterMark == 1 )
+    void vPortGetISRStack( BaseType_t xCoreID,
+                           StackType_t ** ppxStackBuffer,
+                           configSTACK_DEPTH_TYPE * puxStackDepth ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * The structures and methods of manipulating the MPU are contained within the
  * port layer.
@@ -76,6 +76,12 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE      ( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX       ( ( uint8_t ) 4U )
 #define queueQUEUE_TYPE_SET                   ( ( uint8_t ) 5U )
+#define queueQUEUE_TYPE_SPSC                  ( ( uint8_t ) 6U )
+#define queueQUEUE_TYPE_MPMC                  ( ( uint8_t ) 7U )
+#define queueQUEUE_TYPE_ATOMIC_SEMAPHORE      ( ( uint8_t ) 8U )
+#define queueQUEUE_TYPE_RING                  ( ( uint8_t ) 9U )
+#define queueQUEUE_TYPE_PRIORITY              ( ( uint8_t ) 10U )
+#define queueQUEUE_TYPE_RPC                   ( ( uint8_t ) 11U )
 
 /**
  * queue. h
@@ -235,6 +241,291 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
     #define xQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_BASE ) )
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreateSPSC(
+ *                            UBaseType_t uxQueueLength,
+ *                            UBaseType_t uxItemSize
+ *                        );
+ * @endcode
+ *
+ * Creates a queue that is written by exactly one task or interrupt and read
+ * by exactly one task or interrupt.  xQueueCreateSPSCStatic() creates the same
+ * type of queue using memory provided by the caller.
+ *
+ * Items are posted and received without entering a critical section.  A
+ * critical section is only entered when the other end of the queue has a task
+ * blocked on it, so data can be handed from an interrupt to a task without
+ * masking interrupts.
+ *
+ * configUSE_SPSC_QUEUES must be set to 1 in FreeRTOSConfig.h for SPSC queues
+ * to be available.
+ *
+ * An SPSC queue is used with xQueueSend(), xQueueSendToBack(), xQueueReceive()
+ * and their FromISR versions.  Items cannot be sent to the front of an SPSC
+ * queue or overwritten, and an SPSC queue cannot be peeked or added to a queue
+ * set.  Having more than one writer or more than one reader corrupts the queue.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ * Must not be zero.
+ *
+ * @return If the queue is successfully created then a handle to the newly
+ * created queue is returned.  If the queue cannot be created then 0 is
+ * returned.
+ *
+ * \defgroup xQueueCreateSPSC xQueueCreateSPSC
+ * \ingroup QueueManagement
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_SPSC_QUEUES == 1 ) )
+    #define xQueueCreateSPSC( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_SPSC ) )
+#endif
+
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_SPSC_QUEUES == 1 ) )
+    #define xQueueCreateSPSCStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_SPSC ) )
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreateMPMC(
+ *                            UBaseType_t uxQueueLength,
+ *                            UBaseType_t uxItemSize
+ *                        );
+ * @endcode
+ *
+ * Creates a queue that any number of tasks and interrupts, running on any
+ * core, can write to and read from without entering a critical section.
+ * Writers and readers claim a storage slot with a compare and swap, so an
+ * item can be posted while another core is removing one.  A critical section
+ * is only entered when a task must block, or when a task is blocked on the
+ * other end of the queue.
+ *
+ * configUSE_MPMC_QUEUES must be set to 1 in FreeRTOSConfig.h for MPMC queues
+ * to be available.  When configNUMBER_OF_CORES is greater than 1 the port must
+ * define portATOMIC_COMPARE_AND_SWAP_U32.
+ *
+ * An MPMC queue is used with xQueueSend(), xQueueSendToBack(), xQueueReceive()
+ * and their FromISR versions.  Items cannot be sent to the front of an MPMC
+ * queue or overwritten, and an MPMC queue cannot be peeked or added to a queue
+ * set.  MPMC queues can only be created using dynamically allocated memory.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ * Must be a power of two.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ * Must not be zero.
+ *
+ * @return If the queue is successfully created then a handle to the newly
+ * created queue is returned.  If the queue cannot be created then 0 is
+ * returned.
+ *
+ * \defgroup xQueueCreateMPMC xQueueCreateMPMC
+ * \ingroup QueueManagement
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_MPMC_QUEUES == 1 ) )
+    #define xQueueCreateMPMC( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_MPMC ) )
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreateRing(
+ *                            UBaseType_t uxQueueLength,
+ *                            UBaseType_t uxItemSize
+ *                        );
+ * @endcode
+ *
+ * Creates a queue that keeps the most recent uxQueueLength items sent to it.
+ * Sending an item to the back of a full ring queue discards the oldest item
+ * in the queue to make room, so xQueueSend(), xQueueSendToBack() and their
+ * FromISR versions never block or fail on a ring queue.  The number of items
+ * discarded is returned by uxQueueGetRingItemsDropped().
+ *
+ * configUSE_RING_QUEUES must be set to 1 in FreeRTOSConfig.h for ring queues
+ * to be available.
+ *
+ * Items sent to the front of a ring queue, and items sent with
+ * xQueueSendMultiple(), are not sent until there is space, as they are on any
+ * other queue.  When configUSE_ZERO_COPY_QUEUES is 1 an item sent to a full
+ * ring queue is also not sent while a slot is reserved or acquired.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ * Must not be zero.
+ *
+ * @return If the queue is successfully created then a handle to the newly
+ * created queue is returned.  If the queue cannot be created then 0 is
+ * returned.
+ *
+ * \defgroup xQueueCreateRing xQueueCreateRing
+ * \ingroup QueueManagement
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_RING_QUEUES == 1 ) )
+    #define xQueueCreateRing( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_RING ) )
+#endif
+
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_RING_QUEUES == 1 ) )
+    #define xQueueCreateRingStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_RING ) )
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreatePriority(
+ *                            UBaseType_t uxQueueLength,
+ *                            UBaseType_t uxItemSize
+ *                        );
+ * @endcode
+ *
+ * Creates a queue from which items are received in order of a key, highest
+ * key first, instead of in the order they were sent.  Each item must start
+ * with its key, a uint32_t.  The items are held in a binary heap within the
+ * queue's storage area, so sending and receiving take a time proportional to
+ * the logarithm of the number of items in the queue.  Items with equal keys
+ * are not guaranteed to be received in the order they were sent.
+ *
+ * configUSE_PRIORITY_QUEUES must be set to 1 in FreeRTOSConfig.h for priority
+ * queues to be available.
+ *
+ * A priority queue is used with the same functions, and has the same blocking
+ * and ISR behaviour, as any other queue.  Sending an item to the front of a
+ * priority queue is the same as sending it to the back.  A priority queue
+ * cannot be used with xQueueSendMultiple(), uxQueueReceiveMultiple(), the zero
+ * copy queue functions or the co-routine functions.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ * Must be at least sizeof( uint32_t ).
+ *
+ * @return If the queue is successfully created then a handle to the newly
+ * created queue is returned.  If the queue cannot be created then 0 is
+ * returned.
+ *
+ * Example usage:
+ * @code{c}
+ * typedef struct AJob
+ * {
+ *  uint32_t ulPriority; // The key must be the first member.
+ *  void ( * pxFunction )( void * );
+ *  void * pvParameter;
+ * } Job_t;
+ *
+ * void vAFunction( void )
+ * {
+ * QueueHandle_t xJobQueue;
+ * Job_t xJob;
+ *
+ *  xJobQueue = xQueueCreatePriority( 10, sizeof( Job_t ) );
+ *
+ *  // ... Jobs are sent with xQueueSend(), then received highest
+ *  // ulPriority first.
+ *  if( xQueueReceive( xJobQueue, &xJob, portMAX_DELAY ) == pdPASS )
+ *  {
+ *      xJob.pxFunction( xJob.pvParameter );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueCreatePriority xQueueCreatePriority
+ * \ingroup QueueManagement
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_PRIORITY_QUEUES == 1 ) )
+    #define xQueueCreatePriority( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_PRIORITY ) )
+#endif
+
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_PRIORITY_QUEUES == 1 ) )
+    #define xQueueCreatePriorityStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_PRIORITY ) )
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreateRPC(
+ *                            UBaseType_t uxQueueLength,
+ *                            UBaseType_t uxItemSize
+ *                        );
+ * @endcode
+ *
+ * Creates a queue through which client tasks make requests of a server task.
+ * A client sends a request with xQueueCall(), which blocks the client until
+ * the server has received the request with xQueueReceive() and answered it
+ * with xQueueReply().  While a client is blocked in xQueueCall() its priority
+ * is lent to the server, as the priority of a task waiting for a mutex is lent
+ * to the mutex holder, so a high priority client is not kept waiting by tasks
+ * of a priority between its own and that of the server.
+ *
+ * configUSE_RPC_QUEUES must be set to 1 in FreeRTOSConfig.h for RPC queues to
+ * be available.
+ *
+ * An RPC queue is served by a single task, which must reply to each request
+ * before it receives the next.  Requests can only be sent with xQueueCall(),
+ * and only received with xQueueReceive() or xQueuePeek(), so an RPC queue
+ * cannot be used from an interrupt, in a queue set or with the multiple item,
+ * zero copy or co-routine queue functions.  Any reply data is passed back
+ * through a buffer the request points to.
+ *
+ * @param uxQueueLength The maximum number of requests that can wait to be
+ * received.  Clients that find the queue full wait for space, lending their
+ * priority to the server while they do.
+ *
+ * @param uxItemSize The number of bytes each request requires.  Must not be
+ * zero.
+ *
+ * @return If the queue is successfully created then a handle to the newly
+ * created queue is returned.  If the queue cannot be created then 0 is
+ * returned.
+ *
+ * Example usage:
+ * @code{c}
+ * typedef struct ARequest
+ * {
+ *  uint32_t ulCommand;
+ *  uint32_t * pulResult;
+ * } Request_t;
+ *
+ * QueueHandle_t xServerQueue;
+ *
+ * void vServerTask( void * pvParameters )
+ * {
+ * Request_t xRequest;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xQueueReceive( xServerQueue, &xRequest, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          // Runs at the priority of the highest priority waiting client.
+ *          *( xRequest.pulResult ) = ulProcessCommand( xRequest.ulCommand );
+ *          ( void ) xQueueReply( xServerQueue );
+ *      }
+ *  }
+ * }
+ *
+ * void vClientTask( void * pvParameters )
+ * {
+ * uint32_t ulResult;
+ * Request_t xRequest = { 1, &ulResult };
+ *
+ *  if( xQueueCall( xServerQueue, &xRequest, pdMS_TO_TICKS( 100 ) ) == pdPASS )
+ *  {
+ *      // ulResult holds the server's answer.
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueCreateRPC xQueueCreateRPC
+ * \ingroup QueueManagement
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_RPC_QUEUES == 1 ) )
+    #define xQueueCreateRPC( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_RPC ) )
+#endif
+
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_RPC_QUEUES == 1 ) )
+    #define xQueueCreateRPCStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_RPC ) )
+#endif
+
 /**
  * queue. h
  * @code{c}
@@ -342,8 +633,10 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
  * \defgroup xQueueSend xQueueSend
  * \ingroup QueueManagement
  */
-#define xQueueSendToFront( xQueue, pvItemToQueue, xTicksToWait ) \
-    xQueueGenericSend( ( xQueue ), ( pvItemToQueue ), ( xTicksToWait ), queueSEND_TO_FRONT )
+#if ( configQUEUE_SEND_TO_FRONT_USED == 1 )
+    #define xQueueSendToFront( xQueue, pvItemToQueue, xTicksToWait ) \
+        xQueueGenericSend( ( xQueue ), ( pvItemToQueue ), ( xTicksToWait ), queueSEND_TO_FRONT )
+#endif
 
 /**
  * queue. h
@@ -594,8 +887,10 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
  * \defgroup xQueueOverwrite xQueueOverwrite
  * \ingroup QueueManagement
  */
-#define xQueueOverwrite( xQueue, pvItemToQueue ) \
-    xQueueGenericSend( ( xQueue ), ( pvItemToQueue ), 0, queueOVERWRITE )
+#if ( configQUEUE_OVERWRITE_USED == 1 )
+    #define xQueueOverwrite( xQueue, pvItemToQueue ) \
+        xQueueGenericSend( ( xQueue ), ( pvItemToQueue ), 0, queueOVERWRITE )
+#endif
 
 
 /**
@@ -688,6 +983,49 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                               TickType_t xTicksToWait,
                               const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueSendMultiple(
+ *                                QueueHandle_t xQueue,
+ *                                const void * pvItems,
+ *                                UBaseType_t uxCount,
+ *                                TickType_t xTicksToWait
+ *                              );
+ * @endcode
+ *
+ * Post uxCount items to the back of a queue in one operation.  The items are
+ * copied from consecutive positions in pvItems, and either all of them are
+ * posted or none are.  Tasks waiting to receive from the queue are unblocked
+ * once for the whole batch rather than once per item.
+ *
+ * configUSE_QUEUE_MULTIPLE_ITEMS must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ *
+ * This function must not be called from an interrupt service routine, and
+ * must not be used on a semaphore.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItems A pointer to the first of the items to be placed on the
+ * queue.
+ *
+ * @param uxCount The number of items to post.  Must be between 1 and the
+ * length of the queue.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space for all the items to become available on the queue.
+ *
+ * @return pdPASS if all the items were posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue,
+                               const void * const pvItems,
+                               const UBaseType_t uxCount,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * @code{c}
@@ -914,6 +1252,244 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                           void * const pvBuffer,
                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReceiveUs( QueueHandle_t xQueue,
+ *                             void * const pvBuffer,
+ *                             uint32_t ulMicroseconds );
+ * @endcode
+ *
+ * Only available when configUSE_HR_TIMEOUTS is set to 1.
+ *
+ * As xQueueReceive(), but the block time is given in microseconds and timed
+ * by the port's high resolution timer, so it can be shorter than a tick or not
+ * a whole number of ticks.
+ *
+ * @param ulMicroseconds The maximum amount of time, in microseconds, the task
+ * should block waiting for an item to receive should the queue be empty at the
+ * time of the call.  Setting ulMicroseconds to 0 will cause the function to
+ * return immediately if the queue is empty.
+ *
+ * @return pdTRUE if an item was successfully received from the queue,
+ * otherwise pdFALSE.
+ *
+ * \defgroup xQueueReceiveUs xQueueReceiveUs
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_HR_TIMEOUTS == 1 )
+    BaseType_t xQueueReceiveUs( QueueHandle_t xQueue,
+                                void * const pvBuffer,
+                                uint32_t ulMicroseconds ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t uxQueueReceiveMultiple(
+ *                                     QueueHandle_t xQueue,
+ *                                     void * pvBuffer,
+ *                                     UBaseType_t uxMaxCount,
+ *                                     TickType_t xTicksToWait
+ *                                   );
+ * @endcode
+ *
+ * Receive up to uxMaxCount items from a queue in one operation.  The items
+ * are copied to consecutive positions in pvBuffer in the order they were
+ * queued.  Tasks waiting to post to the queue are unblocked once for the
+ * whole batch rather than once per item.
+ *
+ * configUSE_QUEUE_MULTIPLE_ITEMS must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ *
+ * This function must not be called from an interrupt service routine, and
+ * must not be used on a semaphore.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items will be
+ * copied.  The buffer must be large enough to hold uxMaxCount items.
+ *
+ * @param uxMaxCount The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for at least one item to receive should the queue be empty at the
+ * time of the call.
+ *
+ * @return The number of items received, which is zero if the queue remained
+ * empty for the whole block time.
+ *
+ * Example usage:
+ * @code{c}
+ * void vALoggingTask( void *pvParameters )
+ * {
+ * uint64_t ullEvents[ 16 ];
+ * UBaseType_t uxCount;
+ *
+ *  for( ;; )
+ *  {
+ *      uxCount = uxQueueReceiveMultiple( xQueue, ullEvents, 16, portMAX_DELAY );
+ *
+ *      // Process uxCount events from ullEvents.
+ *  }
+ * }
+ * @endcode
+ * \defgroup uxQueueReceiveMultiple uxQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                    void * const pvBuffer,
+                                    const UBaseType_t uxMaxCount,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReserveSend(
+ *                               QueueHandle_t xQueue,
+ *                               void **ppvSlot,
+ *                               TickType_t xTicksToWait
+ *                             );
+ * @endcode
+ *
+ * Reserve the storage slot the next item posted to the back of a queue would
+ * be copied into, so the item can be written in place instead of being copied.
+ * The item is not added to the queue until xQueueCommitSend() is called.
+ *
+ * configUSE_ZERO_COPY_QUEUES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Only one slot can be reserved on a queue at a time.  While a slot is
+ * reserved the queue appears full to every other sender, including
+ * xQueueOverwrite().  The queue must not be a semaphore, and must not be used
+ * from a co-routine.
+ *
+ * This function must not be used in an interrupt service routine.
+ *
+ * @param xQueue The handle to the queue on which the item is to be posted.
+ *
+ * @param ppvSlot Set to the start of the reserved slot, which is large enough
+ * to hold one item, or to NULL if no slot could be reserved.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a slot to become available.
+ *
+ * @return pdPASS if a slot was reserved, otherwise errQUEUE_FULL.
+ *
+ * Example usage:
+ * @code{c}
+ * void vAProducerTask( void *pvParameters )
+ * {
+ * struct AMessage *pxMessage;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xQueueReserveSend( xQueue, ( void ** ) &pxMessage, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          // Fill in the message directly in the queue storage.
+ *          pxMessage->ucMessageID = 0;
+ *          xQueueCommitSend( xQueue );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xQueueReserveSend xQueueReserveSend
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReserveSend( QueueHandle_t xQueue,
+                              void ** ppvSlot,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueCommitSend( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Add the item written into the slot returned by xQueueReserveSend() to the
+ * back of the queue, unblocking a task waiting to receive from the queue if
+ * there is one.
+ *
+ * configUSE_ZERO_COPY_QUEUES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xQueue The handle to the queue on which a slot was reserved.
+ *
+ * @return pdPASS if a reserved slot was committed, or pdFAIL if no slot was
+ * reserved.
+ *
+ * \defgroup xQueueCommitSend xQueueCommitSend
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueCommitSend( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueAcquireReceive(
+ *                                  QueueHandle_t xQueue,
+ *                                  void **ppvSlot,
+ *                                  TickType_t xTicksToWait
+ *                                );
+ * @endcode
+ *
+ * Remove the item at the front of a queue without copying it out, returning a
+ * pointer to the item in the queue storage.  The storage slot remains in use
+ * until xQueueReleaseReceive() is called.
+ *
+ * configUSE_ZERO_COPY_QUEUES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Only one slot can be acquired from a queue at a time.  While a slot is
+ * acquired the queue appears empty to every other receiver, and items cannot
+ * be posted to the front of the queue.  The queue must not be a semaphore,
+ * and must not be used from a co-routine.
+ *
+ * This function must not be used in an interrupt service routine.
+ *
+ * @param xQueue The handle to the queue from which the item is to be
+ * received.
+ *
+ * @param ppvSlot Set to the start of the received item, or to NULL if no item
+ * was received.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive should the queue be empty at the time of the
+ * call.
+ *
+ * @return pdPASS if an item was acquired, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xQueueAcquireReceive xQueueAcquireReceive
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueAcquireReceive( QueueHandle_t xQueue,
+                                 void ** ppvSlot,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReleaseReceive( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Return the slot of an item obtained by xQueueAcquireReceive() to the queue
+ * so it can be reused, unblocking a task waiting to post to the queue if
+ * there is one.  The item must not be accessed after it has been released.
+ *
+ * configUSE_ZERO_COPY_QUEUES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xQueue The handle to the queue from which a slot was acquired.
+ *
+ * @return pdPASS if an acquired slot was released, or pdFAIL if no slot was
+ * acquired.
+ *
+ * \defgroup xQueueReleaseReceive xQueueReleaseReceive
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReleaseReceive( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * @code{c}
@@ -950,6 +1526,92 @@ UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue ) PRIVILEGED_FUNC
  */
 UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t uxQueueGetRingItemsDropped( const QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Return the number of items a ring queue created with xQueueCreateRing() has
+ * discarded to make room for newer items since it was created.
+ *
+ * configUSE_RING_QUEUES must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * @param xQueue A handle to the ring queue being queried.
+ *
+ * @return The number of items discarded from the queue.
+ *
+ * \defgroup uxQueueGetRingItemsDropped uxQueueGetRingItemsDropped
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_RING_QUEUES == 1 )
+    UBaseType_t uxQueueGetRingItemsDropped( const QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueCall( QueueHandle_t xQueue,
+ *                        const void * pvRequest,
+ *                        TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Send a request to an RPC queue created with xQueueCreateRPC(), then wait
+ * for the server task to receive it and reply to it with xQueueReply().  The
+ * calling task lends its priority to the server while it waits, either for
+ * space in the queue or for the reply.
+ *
+ * configUSE_RPC_QUEUES must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * @param xQueue A handle to the RPC queue.
+ *
+ * @param pvRequest A pointer to the request to be copied into the queue.
+ *
+ * @param xTicksToWait The maximum time to wait for the request to be sent and
+ * replied to.  The request is sent as soon as there is space in the queue, so
+ * if the call times out after that the server still receives the request, but
+ * its reply is discarded.
+ *
+ * @return pdPASS if the server replied to the request, otherwise pdFAIL.
+ *
+ * \defgroup xQueueCall xQueueCall
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_RPC_QUEUES == 1 )
+    BaseType_t xQueueCall( QueueHandle_t xQueue,
+                           const void * const pvRequest,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * BaseType_t xQueueReply( QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Called by the server task of an RPC queue to reply to the request it last
+ * received from the queue, which unblocks the client that sent the request if
+ * the client is still waiting.  Once that client has stopped waiting the
+ * server drops to the priority of the highest priority client still waiting,
+ * or to its own priority when none are.
+ *
+ * configUSE_RPC_QUEUES must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * @param xQueue A handle to the RPC queue.
+ *
+ * @return pdPASS if the client that sent the request was unblocked, or pdFAIL
+ * if it had stopped waiting for the reply.
+ *
+ * \defgroup xQueueReply xQueueReply
+ * \ingroup QueueManagement
+ */
+#if ( configUSE_RPC_QUEUES == 1 )
+    BaseType_t xQueueReply( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * queue. h
  * @code{c}
@@ -1034,8 +1696,10 @@ void vQueueDelete( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
  * \defgroup xQueueSendFromISR xQueueSendFromISR
  * \ingroup QueueManagement
  */
-#define xQueueSendToFrontFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken ) \
-    xQueueGenericSendFromISR( ( xQueue ), ( pvItemToQueue ), ( pxHigherPriorityTaskWoken ), queueSEND_TO_FRONT )
+#if ( configQUEUE_SEND_TO_FRONT_USED == 1 )
+    #define xQueueSendToFrontFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken ) \
+        xQueueGenericSendFromISR( ( xQueue ), ( pvItemToQueue ), ( pxHigherPriorityTaskWoken ), queueSEND_TO_FRONT )
+#endif
 
 
 /**
@@ -1197,8 +1861,10 @@ void vQueueDelete( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
  * \defgroup xQueueOverwriteFromISR xQueueOverwriteFromISR
  * \ingroup QueueManagement
  */
-#define xQueueOverwriteFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken ) \
-    xQueueGenericSendFromISR( ( xQueue ), ( pvItemToQueue ), ( pxHigherPriorityTaskWoken ), queueOVERWRITE )
+#if ( configQUEUE_OVERWRITE_USED == 1 )
+    #define xQueueOverwriteFromISR( xQueue, pvItemToQueue, pxHigherPriorityTaskWoken ) \
+        xQueueGenericSendFromISR( ( xQueue ), ( pvItemToQueue ), ( pxHigherPriorityTaskWoken ), queueOVERWRITE )
+#endif
 
 /**
  * queue. h
@@ -1502,6 +2168,22 @@ QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION
                                            StaticQueue_t * pxStaticQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+/*
+ * For internal use only.  Use xSemaphoreCreateMutexWithCeiling() or
+ * xSemaphoreCreateMutexWithCeilingStatic() instead of calling these functions
+ * directly.
+ */
+#if ( ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    QueueHandle_t xQueueCreateMutexWithCeiling( const uint8_t ucQueueType,
+                                                UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    QueueHandle_t xQueueCreateMutexWithCeilingStatic( const uint8_t ucQueueType,
+                                                      UBaseType_t uxCeilingPriority,
+                                                      StaticQueue_t * pxStaticQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_COUNTING_SEMAPHORES == 1 )
     QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount,
                                                  const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
@@ -1513,6 +2195,17 @@ QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION
                                                        StaticQueue_t * pxStaticQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+#if ( ( configUSE_ATOMIC_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    QueueHandle_t xQueueCreateAtomicSemaphore( const UBaseType_t uxMaxCount,
+                                               const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_ATOMIC_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    QueueHandle_t xQueueCreateAtomicSemaphoreStatic( const UBaseType_t uxMaxCount,
+                                                     const UBaseType_t uxInitialCount,
+                                                     StaticQueue_t * pxStaticQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
@@ -1595,6 +2288,80 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
     const char * pcQueueGetName( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+/*
+ * Looks up a queue, semaphore or mutex in the queue registry by the name it
+ * was given by vQueueAddToRegistry(), so a queue can be located at run time
+ * without passing its handle around.  If more than one queue has the name
+ * then which of them is returned is not defined.
+ *
+ * Set configUSE_QUEUE_REGISTRY_INDEX to 1 in FreeRTOSConfig.h to hash the
+ * registry by name and by handle, so this function, pcQueueGetName(),
+ * vQueueAddToRegistry() and vQueueUnregisterQueue() do not search the whole
+ * registry.
+ *
+ * @param pcQueueName The name to look up.
+ * @return The handle of a queue registered with the name pcQueueName, or NULL
+ * if no queue in the registry has that name.
+ */
+#if ( configQUEUE_REGISTRY_SIZE > 0 )
+    QueueHandle_t xQueueGetHandleByName( const char * pcQueueName ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Returns the statistics gathered for a queue, semaphore or mutex when
+ * configUSE_IPC_STATISTICS is set to 1 in FreeRTOSConfig.h.  The counters
+ * accumulate from the time the queue is created.  See the IPCStatistics_t
+ * definition in FreeRTOS.h for the meaning of each member.  Statistics are not
+ * gathered for SPSC queues, MPMC queues or atomic semaphores.
+ *
+ * @param xQueue The handle of the queue, semaphore or mutex being queried.
+ *
+ * @param pxStatistics The structure the statistics are copied into.
+ */
+#if ( configUSE_IPC_STATISTICS == 1 )
+    void vQueueGetStatistics( QueueHandle_t xQueue,
+                              IPCStatistics_t * pxStatistics ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Returns the latencies of the tagged items received from a queue when
+ * configUSE_IPC_LATENCY_TRACING is set to 1 in FreeRTOSConfig.h.  Each latency
+ * is measured from the start of the chain of messages the item belongs to, not
+ * from when the item was sent to this queue.  See xTaskGetMessageTag() in
+ * task.h.  Only queues created with xQueueCreate() or xQueueCreateRing()
+ * carry tags, so the histogram of any other queue stays empty.
+ *
+ * @param xQueue The handle of the queue being queried.
+ *
+ * @param pxHistogram The structure the histogram is copied into.
+ */
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+    void vQueueGetLatencyHistogram( QueueHandle_t xQueue,
+                                    IPCLatencyHistogram_t * pxHistogram ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Writes the statistics of every queue, semaphore and mutex in the queue
+ * registry to pcWriteBuffer as a human readable table, one line per queue, in
+ * the manner of vTaskListTasks().  Each line holds the queue's name then, tab
+ * separated: sends, receives, blocks, timeouts, maximum depth, total blocked
+ * time, total held time, maximum held time and priority inheritances.  Times
+ * are in ticks.  Lines that do not fit in the buffer are omitted.
+ *
+ * configUSE_IPC_STATISTICS must be 1, configQUEUE_REGISTRY_SIZE must be
+ * greater than 0 and configUSE_STATS_FORMATTING_FUNCTIONS must be greater
+ * than 0 for this function to be available.  It uses snprintf(), so is
+ * intended for debugging only.
+ *
+ * @param pcWriteBuffer A buffer into which the table is written, in ASCII form.
+ *
+ * @param uxBufferLength The length of pcWriteBuffer in bytes.
+ */
+#if ( ( configUSE_IPC_STATISTICS == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+    void vQueueListStatistics( char * pcWriteBuffer,
+                               size_t uxBufferLength ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Generic version of the function used to create a queue using dynamic memory
  * allocation.  This is called by other functions and macros that create other
@@ -1660,6 +2427,11 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * semaphore) operation must not be performed on a member of a queue set unless
  * a call to xQueueSelectFromSet() has first returned a handle to that set member.
  *
+ * Note 5:  If configUSE_QUEUE_SET_READY_BITMAP is set to 1 the queue set does
+ * not store events.  uxEventQueueLength is instead the maximum number of
+ * queues and semaphores that can be added to the set, which must not exceed
+ * the number of bits in a UBaseType_t, and Note 3 does not apply.
+ *
  * @param uxEventQueueLength Queue sets store events that occur on
  * the queues and semaphores contained in the set.  uxEventQueueLength specifies
  * the maximum number of events that can be queued at once.  To be absolutely
@@ -1703,7 +2475,8 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * @return If the queue or semaphore was successfully added to the queue set
  * then pdPASS is returned.  If the queue could not be successfully added to the
  * queue set because it is already a member of a different queue set then pdFAIL
- * is returned.
+ * is returned.  If configUSE_QUEUE_SET_READY_BITMAP is set to 1 pdFAIL is also
+ * returned if the queue set already holds its maximum number of members.
  */
 #if ( configUSE_QUEUE_SETS == 1 )
     BaseType_t xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore,
@@ -1753,6 +2526,13 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * semaphore) operation must not be performed on a member of a queue set unless
  * a call to xQueueSelectFromSet() has first returned a handle to that set member.
  *
+ * Note 4:  If configUSE_QUEUE_SET_READY_BITMAP is set to 1 a member is
+ * returned for as long as it contains data, rather than once for each item
+ * sent to it, and the member that was added to the set first is returned when
+ * more than one contains data.  Only one task should select from such a set,
+ * as a member that becomes ready while already marked ready does not unblock
+ * a second task.
+ *
  * @param xQueueSet The queue set on which the task will (potentially) block.
  *
  * @param xTicksToWait The maximum time, in ticks, that the calling task will
@@ -1778,6 +2558,48 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
     QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet ) PRIVILEGED_FUNCTION;
 #endif
 
+/*
+ * xQueueWaitForAny() blocks the calling task until one of the queues or
+ * semaphores in an array contains data (in the case of a queue) or is
+ * available to take (in the case of a semaphore).  Unlike a queue set, the
+ * queues do not need to be added to a set first, and a send to one of them
+ * does not post its handle into a second queue.  Instead each empty queue
+ * records the waiting task and the next item added to it sends the task a
+ * notification on index configQUEUE_WAIT_FOR_ANY_NOTIFICATION_INDEX.
+ *
+ * configUSE_QUEUE_WAIT_FOR_ANY must be set to 1 in FreeRTOSConfig.h for
+ * xQueueWaitForAny() to be available.
+ *
+ * Note 1:  Only one task at a time can wait for a given queue or semaphore
+ * using xQueueWaitForAny(), although other tasks can still block on it using
+ * the normal receive and take functions.  SPSC queues, MPMC queues and
+ * atomic semaphores cannot be waited for.
+ *
+ * Note 2:  Waiting for a mutex will not cause the mutex holder to inherit the
+ * priority of the waiting task.
+ *
+ * Note 3:  Another task can remove the item before the calling task reads it,
+ * so receive from or take the returned queue or semaphore with a block time
+ * of 0 and call xQueueWaitForAny() again if that fails.
+ *
+ * @param pxQueues An array of the handles of the queues and semaphores to
+ * wait for.
+ *
+ * @param uxQueueCount The number of handles in pxQueues.
+ *
+ * @param xTicksToWait The maximum time, in ticks, that the calling task will
+ * remain in the Blocked state to wait for one of the queues or semaphores to
+ * be ready for a successful read or take operation.
+ *
+ * @return The handle of the first queue or semaphore in pxQueues that contains
+ * data or is available, or NULL if none was before the block time expired.
+ */
+#if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+    QueueHandle_t xQueueWaitForAny( const QueueHandle_t * const pxQueues,
+                                    UBaseType_t uxQueueCount,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 /* Not public API functions. */
 void vQueueWaitForMessageRestricted( QueueHandle_t xQueue,
                                      TickType_t xTicksToWait,
@@ -1785,6 +2607,11 @@ void vQueueWaitForMessageRestricted( QueueHandle_t xQueue,
 BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
                                BaseType_t xNewQueue ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_CONDITION_VARIABLES == 1 )
+    void vQueueMoveWaitingTasksToMutex( QueueHandle_t xMutex,
+                                        List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_TRACE_FACILITY == 1 )
     void vQueueSetQueueNumber( QueueHandle_t xQueue,
                                UBaseType_t uxQueueNumber ) PRIVILEGED_FUNCTION;
@@ -1801,6 +2628,12 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
 UBaseType_t uxQueueGetQueueItemSize( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 UBaseType_t uxQueueGetQueueLength( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+#if ( ( configUSE_WARM_BOOT == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) )
+    size_t xQueueCopyWarmBootState( uint8_t * pucState,
+                                    size_t xOffset,
+                                    BaseType_t xSave ) PRIVILEGED_FUNCTION;
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
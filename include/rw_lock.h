@@ -0,0 +1,192 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RW_LOCK_H
+#define RW_LOCK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include rw_lock.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A reader-writer lock lets any number of tasks hold it for reading at the
+ * same time, or one task hold it for writing, for use where data that is read
+ * far more often than it is written would otherwise be serialised by a mutex.
+ *
+ * The lock prefers writers: once a task is waiting to write, tasks that try to
+ * take the lock for reading wait until the write has completed, so a steady
+ * stream of readers cannot starve a writer.  A task holding the lock for
+ * writing inherits the priority of any higher priority task waiting for the
+ * lock, as for a mutex.  Tasks holding the lock for reading are not tracked,
+ * so do not inherit priorities.
+ *
+ * Reader-writer locks cannot be used from interrupts and cannot be taken
+ * recursively.  The application provides the memory, and must call
+ * vRWLockInit() before the lock is used.
+ *
+ * Set configUSE_RW_LOCKS to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup RWLock_t RWLock_t
+ * \ingroup RWLocks
+ */
+typedef struct xRW_LOCK
+{
+    volatile TaskHandle_t xWriter;   /**< The task holding the lock for writing, or NULL. */
+    volatile UBaseType_t uxReaders;  /**< The number of tasks holding the lock for reading. */
+    List_t xTasksWaitingToRead;      /**< Tasks blocked waiting to read, in priority order. */
+    List_t xTasksWaitingToWrite;     /**< Tasks blocked waiting to write, in priority order. */
+} RWLock_t;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * void vRWLockInit( RWLock_t * pxLock );
+ * @endcode
+ *
+ * Initialise a reader-writer lock so it is free.  Must not be called while any
+ * task holds or is waiting for the lock.
+ *
+ * @param pxLock The reader-writer lock being initialised.
+ *
+ * \defgroup vRWLockInit vRWLockInit
+ * \ingroup RWLocks
+ */
+void vRWLockInit( RWLock_t * pxLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockReadTake( RWLock_t * pxLock, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Take a reader-writer lock for reading, waiting in the Blocked state for up
+ * to xTicksToWait ticks if a task holds, or is waiting to take, the lock for
+ * writing.  While the calling task waits, the task holding the lock for
+ * writing inherits the calling task's priority if it is higher than its own.
+ * Must only be called from a task.
+ *
+ * @param pxLock The reader-writer lock being taken.
+ *
+ * @param xTicksToWait The maximum time to wait for the lock.  Setting
+ * xTicksToWait to 0 returns immediately if the lock cannot be taken.
+ *
+ * @return pdPASS if the calling task now holds the lock for reading, or pdFAIL
+ * if xTicksToWait expired first.
+ *
+ * \defgroup xRWLockReadTake xRWLockReadTake
+ * \ingroup RWLocks
+ */
+BaseType_t xRWLockReadTake( RWLock_t * pxLock,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockReadGive( RWLock_t * pxLock );
+ * @endcode
+ *
+ * Give a reader-writer lock the calling task holds for reading.  When the last
+ * reader gives the lock, the highest priority task waiting to write, if any,
+ * is unblocked so it can take the lock.
+ *
+ * @param pxLock The reader-writer lock being given.
+ *
+ * @return pdPASS if the lock was given, or pdFAIL if no task held the lock for
+ * reading.
+ *
+ * \defgroup xRWLockReadGive xRWLockReadGive
+ * \ingroup RWLocks
+ */
+BaseType_t xRWLockReadGive( RWLock_t * pxLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockWriteTake( RWLock_t * pxLock, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Take a reader-writer lock for writing, waiting in the Blocked state for up
+ * to xTicksToWait ticks while any task holds the lock.  While the calling task
+ * waits, the task holding the lock for writing, if any, inherits the calling
+ * task's priority if it is higher than its own.  Must only be called from a
+ * task.
+ *
+ * @param pxLock The reader-writer lock being taken.
+ *
+ * @param xTicksToWait The maximum time to wait for the lock.  Setting
+ * xTicksToWait to 0 returns immediately if the lock cannot be taken.
+ *
+ * @return pdPASS if the calling task now holds the lock for writing, or pdFAIL
+ * if xTicksToWait expired first.
+ *
+ * \defgroup xRWLockWriteTake xRWLockWriteTake
+ * \ingroup RWLocks
+ */
+BaseType_t xRWLockWriteTake( RWLock_t * pxLock,
+                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockWriteGive( RWLock_t * pxLock );
+ * @endcode
+ *
+ * Give a reader-writer lock the calling task holds for writing.  If the
+ * calling task inherited a priority while holding the lock, and holds no
+ * mutexes, it returns to its base priority.  The highest priority task waiting
+ * to write is then unblocked or, if no task is waiting to write, all the tasks
+ * waiting to read are unblocked.
+ *
+ * @param pxLock The reader-writer lock being given.
+ *
+ * @return pdPASS if the lock was given, or pdFAIL if the calling task did not
+ * hold the lock for writing.
+ *
+ * \defgroup xRWLockWriteGive xRWLockWriteGive
+ * \ingroup RWLocks
+ */
+BaseType_t xRWLockWriteGive( RWLock_t * pxLock ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* RW_LOCK_H */
@@ -798,6 +798,85 @@ typedef QueueHandle_t SemaphoreHandle_t;
     #define xSemaphoreCreateMutexStatic( pxMutexBuffer )    xQueueCreateMutexStatic( queueQUEUE_TYPE_MUTEX, ( pxMutexBuffer ) )
 #endif
 
+/**
+ * semphr. h
+ * @code{c}
+ * SemaphoreHandle_t xSemaphoreCreateMutexWithCeiling( UBaseType_t uxCeilingPriority );
+ * @endcode
+ *
+ * Creates a new mutex type semaphore that uses the immediate priority ceiling
+ * protocol in place of priority inheritance, and returns a handle by which the
+ * new mutex can be referenced.  configUSE_MUTEX_PRIORITY_CEILING must be set to
+ * 1 in FreeRTOSConfig.h for this function to be available.
+ *
+ * A task that takes the mutex has its priority raised to uxCeilingPriority as
+ * soon as it takes the mutex, and returned to its base priority when it no
+ * longer holds any mutexes.  No task that also uses the mutex can then preempt
+ * the holder, so, on a single core, the mutex is never found to be held by
+ * another task and taking it never blocks or causes priority inheritance.
+ *
+ * uxCeilingPriority must be at least the priority of the highest priority
+ * task that takes the mutex, including any priority the task can inherit.
+ *
+ * The mutex is otherwise used exactly as one created by
+ * xSemaphoreCreateMutex().
+ *
+ * @param uxCeilingPriority The priority to raise the holder of the mutex to.
+ * Must be greater than 0 and less than configMAX_PRIORITIES.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If there was not enough heap to allocate the mutex data
+ * structures then NULL is returned.
+ *
+ * Example usage:
+ * @code{c}
+ * SemaphoreHandle_t xSemaphore;
+ *
+ * void vATask( void * pvParameters )
+ * {
+ *  // Create a mutex shared by tasks of priority 3 and below.
+ *  xSemaphore = xSemaphoreCreateMutexWithCeiling( 3 );
+ *
+ *  if( xSemaphore != NULL )
+ *  {
+ *      // The semaphore was created successfully and can be used.
+ *  }
+ * }
+ * @endcode
+ * \defgroup xSemaphoreCreateMutexWithCeiling xSemaphoreCreateMutexWithCeiling
+ * \ingroup Semaphores
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) )
+    #define xSemaphoreCreateMutexWithCeiling( uxCeilingPriority )    xQueueCreateMutexWithCeiling( queueQUEUE_TYPE_MUTEX, ( uxCeilingPriority ) )
+#endif
+
+/**
+ * semphr. h
+ * @code{c}
+ * SemaphoreHandle_t xSemaphoreCreateMutexWithCeilingStatic( UBaseType_t uxCeilingPriority,
+ *                                                           StaticSemaphore_t *pxMutexBuffer );
+ * @endcode
+ *
+ * Creates a mutex that uses the immediate priority ceiling protocol, as
+ * xSemaphoreCreateMutexWithCeiling(), using memory provided by the application
+ * writer in place of dynamically allocated memory.
+ *
+ * @param uxCeilingPriority The priority to raise the holder of the mutex to.
+ * Must be greater than 0 and less than configMAX_PRIORITIES.
+ *
+ * @param pxMutexBuffer Must point to a variable of type StaticSemaphore_t,
+ * which will be used to hold the mutex's data structure.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If pxMutexBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateMutexWithCeilingStatic xSemaphoreCreateMutexWithCeilingStatic
+ * \ingroup Semaphores
+ */
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) )
+    #define xSemaphoreCreateMutexWithCeilingStatic( uxCeilingPriority, pxMutexBuffer )    xQueueCreateMutexWithCeilingStatic( queueQUEUE_TYPE_MUTEX, ( uxCeilingPriority ), ( pxMutexBuffer ) )
+#endif
+
 
 /**
  * semphr. h
@@ -1112,6 +1191,67 @@ typedef QueueHandle_t SemaphoreHandle_t;
     #define xSemaphoreCreateCountingStatic( uxMaxCount, uxInitialCount, pxSemaphoreBuffer )    xQueueCreateCountingSemaphoreStatic( ( uxMaxCount ), ( uxInitialCount ), ( pxSemaphoreBuffer ) )
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * semphr. h
+ * @code{c}
+ * SemaphoreHandle_t xSemaphoreCreateCountingAtomic( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount );
+ * @endcode
+ *
+ * Creates a counting semaphore whose count is changed by compare and swap
+ * instead of inside a critical section.  xSemaphoreGive(), xSemaphoreTake()
+ * and their FromISR versions only enter the kernel when a give or take has to
+ * wake a blocked task, or when a take finds the count at zero and has to
+ * block.  That makes an atomic semaphore cheaper than a semaphore created with
+ * xSemaphoreCreateCounting() when it is given from a high frequency interrupt.
+ *
+ * configUSE_ATOMIC_SEMAPHORES must be set to 1 in FreeRTOSConfig.h for atomic
+ * semaphores to be available.  An atomic semaphore cannot be added to a queue
+ * set or waited for using xQueueWaitForAny().
+ *
+ * @param uxMaxCount The maximum count value that can be reached.  When the
+ *        semaphore reaches this value it can no longer be 'given'.
+ *
+ * @param uxInitialCount The count value assigned to the semaphore when it is
+ *        created.
+ *
+ * @return Handle to the created semaphore.  Null if the semaphore could not be
+ *         created.
+ *
+ * \defgroup xSemaphoreCreateCountingAtomic xSemaphoreCreateCountingAtomic
+ * \ingroup Semaphores
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_ATOMIC_SEMAPHORES == 1 ) )
+    #define xSemaphoreCreateCountingAtomic( uxMaxCount, uxInitialCount )    xQueueCreateAtomicSemaphore( ( uxMaxCount ), ( uxInitialCount ) )
+#endif
+
+/**
+ * semphr. h
+ * @code{c}
+ * SemaphoreHandle_t xSemaphoreCreateCountingAtomicStatic( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount, StaticSemaphore_t *pxSemaphoreBuffer );
+ * @endcode
+ *
+ * As xSemaphoreCreateCountingAtomic(), except the memory used to hold the
+ * semaphore is provided by the application writer.
+ *
+ * @param uxMaxCount The maximum count value that can be reached.
+ *
+ * @param uxInitialCount The count value assigned to the semaphore when it is
+ *        created.
+ *
+ * @param pxSemaphoreBuffer Must point to a variable of type StaticSemaphore_t,
+ * which will then be used to hold the semaphore's data structure.
+ *
+ * @return If the semaphore was successfully created then a handle to the
+ * created semaphore is returned.  If pxSemaphoreBuffer was NULL then NULL is
+ * returned.
+ *
+ * \defgroup xSemaphoreCreateCountingAtomicStatic xSemaphoreCreateCountingAtomicStatic
+ * \ingroup Semaphores
+ */
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_ATOMIC_SEMAPHORES == 1 ) )
+    #define xSemaphoreCreateCountingAtomicStatic( uxMaxCount, uxInitialCount, pxSemaphoreBuffer )    xQueueCreateAtomicSemaphoreStatic( ( uxMaxCount ), ( uxInitialCount ), ( pxSemaphoreBuffer ) )
+#endif
+
 /**
  * semphr. h
  * @code{c}
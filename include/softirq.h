@@ -0,0 +1,141 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+#ifndef SOFTIRQ_H
+#define SOFTIRQ_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include softirq.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A software interrupt (softirq) is a numbered handler that an interrupt
+ * raises to have work done after it returns, without a queue message or a
+ * task of its own.  Raising a softirq sets its bit in the pending bitmap of the
+ * core it is raised on, and wakes that core's softirq task, which runs at
+ * configSOFTIRQ_TASK_PRIORITY - by default the highest priority, so the
+ * handlers run as soon as the outermost interrupt returns.  The task runs the
+ * handlers of all the pending softirqs in number order, lowest first, so lower
+ * numbers are served first when several are pending.
+ *
+ * Raising a softirq that is already pending has no effect, so a handler runs
+ * once however many times it was raised in the meantime, and must work out how
+ * much work there is to do itself - typically by draining a ring buffer or a
+ * hardware FIFO.  Handlers share the softirq task's stack, of
+ * configSOFTIRQ_TASK_STACK_DEPTH words, and should not block.
+ *
+ * Set configUSE_SOFTIRQS to 1 in FreeRTOSConfig.h to include this
+ * functionality.  configSOFTIRQ_COUNT sets how many softirqs there are.
+ *
+ * \defgroup SoftIRQHandlerFunction_t SoftIRQHandlerFunction_t
+ * \ingroup SoftIRQs
+ */
+typedef void (* SoftIRQHandlerFunction_t)( void * pvParameter );
+
+/**
+ * softirq.h
+ * @code{c}
+ * BaseType_t xSoftIRQRegister( UBaseType_t uxSoftIRQ,
+ *                              SoftIRQHandlerFunction_t pxFunction,
+ *                              void * pvParameter );
+ * @endcode
+ *
+ * Set the handler of a softirq, creating the softirq tasks if this is the first
+ * softirq registered.  Must not be called while the softirq could be raised.
+ *
+ * @param uxSoftIRQ The number of the softirq, from 0 to configSOFTIRQ_COUNT - 1.
+ *
+ * @param pxFunction The function run each time the softirq is raised.
+ *
+ * @param pvParameter The value passed into pxFunction.
+ *
+ * @return pdPASS if the handler was set, or pdFAIL if the softirq tasks could
+ * not be created.
+ *
+ * \defgroup xSoftIRQRegister xSoftIRQRegister
+ * \ingroup SoftIRQs
+ */
+BaseType_t xSoftIRQRegister( UBaseType_t uxSoftIRQ,
+                             SoftIRQHandlerFunction_t pxFunction,
+                             void * pvParameter ) PRIVILEGED_FUNCTION;
+
+/**
+ * softirq.h
+ * @code{c}
+ * void vSoftIRQRaise( UBaseType_t uxSoftIRQ );
+ * @endcode
+ *
+ * Raise a softirq from a task, so its handler is run by the softirq task of
+ * the calling core.
+ *
+ * @param uxSoftIRQ The number of the softirq to raise.
+ *
+ * \defgroup vSoftIRQRaise vSoftIRQRaise
+ * \ingroup SoftIRQs
+ */
+void vSoftIRQRaise( UBaseType_t uxSoftIRQ ) PRIVILEGED_FUNCTION;
+
+/**
+ * softirq.h
+ * @code{c}
+ * void vSoftIRQRaiseFromISR( UBaseType_t uxSoftIRQ,
+ *                            BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of vSoftIRQRaise() that can be called from an interrupt service
+ * routine.  Pass *pxHigherPriorityTaskWoken to portYIELD_FROM_ISR() at the end
+ * of the interrupt so the handler runs as soon as the interrupt returns.
+ *
+ * @param uxSoftIRQ The number of the softirq to raise.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if waking the softirq task
+ * means a context switch should be performed before the interrupt exits.  It
+ * is never set to pdFALSE.
+ *
+ * \defgroup vSoftIRQRaiseFromISR vSoftIRQRaiseFromISR
+ * \ingroup SoftIRQs
+ */
+void vSoftIRQRaiseFromISR( UBaseType_t uxSoftIRQ,
+                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* SOFTIRQ_H */
@@ -0,0 +1,243 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef STATIC_OBJECTS_H
+#define STATIC_OBJECTS_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include static_objects.h"
+#endif
+
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+#include "timers.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * The macros in this file define the tasks, queues, stream buffers and timers
+ * an application creates at start up, together with the buffers they use, at
+ * compile time.  Each macro defines a handle variable named after the object,
+ * the statically allocated buffers the object uses, and a function that
+ * creates the object in those buffers.  The objects are then all created by
+ * one call to xStaticObjectsCreate() before the scheduler is started, so no
+ * StaticTask_t, StaticQueue_t or similar buffers, and no calls to
+ * xTaskCreateStatic() or similar functions, need to be written by hand.
+ *
+ * The buffers are zero initialised, so they are placed in .bss rather than
+ * .data and cost nothing to load.  The kernel data structures within them
+ * link the object into kernel lists and hold port specific context, so they
+ * are set up when the object is created rather than at compile time.
+ *
+ * The objects and the table passed to xStaticObjectsCreate() must be defined
+ * in the same source file.  Other source files can access an object through
+ * its handle by declaring it extern, for example
+ * extern TaskHandle_t xLedTask.
+ *
+ * Set configUSE_STATIC_OBJECTS to 1 in FreeRTOSConfig.h to include this
+ * functionality.  configSUPPORT_STATIC_ALLOCATION must also be set to 1.
+ *
+ * Example usage:
+ * @code{c}
+ * #include "FreeRTOS.h"
+ * #include "static_objects.h"
+ *
+ * FREERTOS_STATIC_TASK( xLedTask, tskIDLE_PRIORITY + 1, 128, vLedTask );
+ * FREERTOS_STATIC_QUEUE( xEventQueue, 10, sizeof( Event_t ) );
+ * FREERTOS_STATIC_STREAM_BUFFER( xRxStream, 256, 1 );
+ * FREERTOS_STATIC_TIMER( xBlinkTimer, pdMS_TO_TICKS( 500 ), pdTRUE, vBlinkCallback );
+ *
+ * static const StaticObject_t xObjects[] =
+ * {
+ *     FREERTOS_STATIC_OBJECT( xLedTask ),
+ *     FREERTOS_STATIC_OBJECT( xEventQueue ),
+ *     FREERTOS_STATIC_OBJECT( xRxStream ),
+ *     FREERTOS_STATIC_OBJECT( xBlinkTimer )
+ * };
+ *
+ * int main( void )
+ * {
+ *     configASSERT( xStaticObjectsCreate( xObjects, sizeof( xObjects ) / sizeof( xObjects[ 0 ] ) ) == pdPASS );
+ *     vTaskStartScheduler();
+ * }
+ * @endcode
+ *
+ * \defgroup StaticObject_t StaticObject_t
+ * \ingroup StaticObjects
+ */
+typedef struct xSTATIC_OBJECT
+{
+    const char * pcName;                 /* The name of the object, for debugging. */
+    BaseType_t ( * pxCreate )( void );   /* Creates the object, returning pdPASS if it was created. */
+} StaticObject_t;
+
+/*
+ * The entry for the object defined as xName in a table of objects passed to
+ * xStaticObjectsCreate().
+ */
+#define FREERTOS_STATIC_OBJECT( xName )    { #xName, xName##StaticObjectCreate }
+
+/**
+ * static_objects.h
+ * @code{c}
+ * FREERTOS_STATIC_TASK( xName, uxPriority, uxStackDepth, pxTaskCode );
+ * @endcode
+ *
+ * Define a task that runs pxTaskCode at priority uxPriority on a stack of
+ * uxStackDepth words.  The task's handle is written to the TaskHandle_t
+ * variable xName when it is created, and xName is also used as the task's
+ * name.  NULL is passed to the task as its parameter.
+ *
+ * \defgroup FREERTOS_STATIC_TASK FREERTOS_STATIC_TASK
+ * \ingroup StaticObjects
+ */
+#define FREERTOS_STATIC_TASK( xName, uxPriority, uxStackDepth, pxTaskCode )                                                                      \
+    TaskHandle_t xName = NULL;                                                                                                                   \
+    static StackType_t xName##StaticStack[ ( uxStackDepth ) ];                                                                                   \
+    static StaticTask_t xName##StaticBuffer;                                                                                                     \
+    static BaseType_t xName##StaticObjectCreate( void )                                                                                          \
+    {                                                                                                                                            \
+        xName = xTaskCreateStatic( ( pxTaskCode ), #xName, ( uxStackDepth ), NULL, ( uxPriority ), xName##StaticStack, &( xName##StaticBuffer ) ); \
+        return ( xName != NULL ) ? pdPASS : pdFAIL;                                                                                              \
+    }                                                                                                                                            \
+    extern TaskHandle_t xName
+
+/**
+ * static_objects.h
+ * @code{c}
+ * FREERTOS_STATIC_QUEUE( xName, uxQueueLength, uxItemSize );
+ * @endcode
+ *
+ * Define a queue that holds uxQueueLength items of uxItemSize bytes, which
+ * must not be 0.  The queue's handle is written to the QueueHandle_t variable
+ * xName when it is created.
+ *
+ * \defgroup FREERTOS_STATIC_QUEUE FREERTOS_STATIC_QUEUE
+ * \ingroup StaticObjects
+ */
+#define FREERTOS_STATIC_QUEUE( xName, uxQueueLength, uxItemSize )                                                                      \
+    QueueHandle_t xName = NULL;                                                                                                        \
+    static uint8_t xName##StaticStorage[ ( uxQueueLength ) * ( uxItemSize ) ];                                                         \
+    static StaticQueue_t xName##StaticBuffer;                                                                                          \
+    static BaseType_t xName##StaticObjectCreate( void )                                                                                \
+    {                                                                                                                                  \
+        xName = xQueueCreateStatic( ( uxQueueLength ), ( uxItemSize ), xName##StaticStorage, &( xName##StaticBuffer ) );               \
+        return ( xName != NULL ) ? pdPASS : pdFAIL;                                                                                    \
+    }                                                                                                                                  \
+    extern QueueHandle_t xName
+
+/**
+ * static_objects.h
+ * @code{c}
+ * FREERTOS_STATIC_STREAM_BUFFER( xName, xBufferSizeBytes, xTriggerLevelBytes );
+ * @endcode
+ *
+ * Define a stream buffer as created by xStreamBufferCreateStatic() with the
+ * same xBufferSizeBytes and xTriggerLevelBytes.  The stream buffer's handle is
+ * written to the StreamBufferHandle_t variable xName when it is created.
+ *
+ * \defgroup FREERTOS_STATIC_STREAM_BUFFER FREERTOS_STATIC_STREAM_BUFFER
+ * \ingroup StaticObjects
+ */
+#define FREERTOS_STATIC_STREAM_BUFFER( xName, xBufferSizeBytes, xTriggerLevelBytes )                                                     \
+    StreamBufferHandle_t xName = NULL;                                                                                                 \
+    static uint8_t xName##StaticStorage[ ( xBufferSizeBytes ) ];                                                                       \
+    static StaticStreamBuffer_t xName##StaticBuffer;                                                                                   \
+    static BaseType_t xName##StaticObjectCreate( void )                                                                                \
+    {                                                                                                                                  \
+        xName = xStreamBufferCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), xName##StaticStorage, &( xName##StaticBuffer ) ); \
+        return ( xName != NULL ) ? pdPASS : pdFAIL;                                                                                    \
+    }                                                                                                                                  \
+    extern StreamBufferHandle_t xName
+
+/**
+ * static_objects.h
+ * @code{c}
+ * FREERTOS_STATIC_TIMER( xName, xTimerPeriodInTicks, xAutoReload, pxCallbackFunction );
+ * @endcode
+ *
+ * Define a software timer as created by xTimerCreateStatic() with the same
+ * xTimerPeriodInTicks, xAutoReload and pxCallbackFunction, and a NULL timer
+ * ID.  The timer's handle is written to the TimerHandle_t variable xName when
+ * it is created, and xName is also used as the timer's name.  As with
+ * xTimerCreateStatic(), the timer is created in the dormant state.
+ *
+ * configUSE_TIMERS must be set to 1 in FreeRTOSConfig.h for this macro to be
+ * available.
+ *
+ * \defgroup FREERTOS_STATIC_TIMER FREERTOS_STATIC_TIMER
+ * \ingroup StaticObjects
+ */
+#if ( configUSE_TIMERS == 1 )
+    #define FREERTOS_STATIC_TIMER( xName, xTimerPeriodInTicks, xAutoReload, pxCallbackFunction )                                            \
+    TimerHandle_t xName = NULL;                                                                                                        \
+    static StaticTimer_t xName##StaticBuffer;                                                                                          \
+    static BaseType_t xName##StaticObjectCreate( void )                                                                                \
+    {                                                                                                                                  \
+        xName = xTimerCreateStatic( #xName, ( xTimerPeriodInTicks ), ( xAutoReload ), NULL, ( pxCallbackFunction ), &( xName##StaticBuffer ) ); \
+        return ( xName != NULL ) ? pdPASS : pdFAIL;                                                                                    \
+    }                                                                                                                                  \
+    extern TimerHandle_t xName
+#endif
+
+/**
+ * static_objects.h
+ * @code{c}
+ * BaseType_t xStaticObjectsCreate( const StaticObject_t * pxObjects, UBaseType_t uxObjectCount );
+ * @endcode
+ *
+ * Create, in order, the uxObjectCount objects in the table pxObjects, each
+ * defined by one of the FREERTOS_STATIC_ macros above.  Normally called once,
+ * before the scheduler is started.
+ *
+ * @param pxObjects The table of objects to create, each entry given by
+ * FREERTOS_STATIC_OBJECT().
+ *
+ * @param uxObjectCount The number of entries in pxObjects.
+ *
+ * @return pdPASS if every object was created, otherwise pdFAIL, in which case
+ * the objects after the first that could not be created are not created.
+ *
+ * \defgroup xStaticObjectsCreate xStaticObjectsCreate
+ * \ingroup StaticObjects
+ */
+BaseType_t xStaticObjectsCreate( const StaticObject_t * pxObjects,
+                                 UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* STATIC_OBJECTS_H */
@@ -69,6 +69,25 @@
 #define sbTYPE_MESSAGE_BUFFER            ( ( BaseType_t ) 1 )
 #define sbTYPE_STREAM_BATCHING_BUFFER    ( ( BaseType_t ) 2 )
 
+/**
+ * Added to a stream buffer type to request an aligned storage area.  For
+ * internal use only.
+ */
+#define sbTYPE_ALIGNED_STORAGE           ( ( BaseType_t ) 0x10 )
+
+/**
+ * Added to a stream buffer type to request a buffer that can be written by
+ * more than one task or interrupt at a time.  For internal use only.
+ */
+#define sbTYPE_MULTI_PRODUCER            ( ( BaseType_t ) 0x20 )
+
+/**
+ * Added to a statically allocated message buffer type to request a buffer
+ * that is shared with a processor running its own instance of the kernel.  For
+ * internal use only - see amp_message_buffer.h.
+ */
+#define sbTYPE_INTERPROCESSOR            ( ( BaseType_t ) 0x40 )
+
 /**
  * Type by which stream buffers are referenced.  For example, a call to
  * xStreamBufferCreate() returns an StreamBufferHandle_t variable that can
@@ -85,6 +104,25 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
                                                  BaseType_t xIsInsideISR,
                                                  BaseType_t * const pxHigherPriorityTaskWoken );
 
+/**
+ *  Type used as a stream buffer's watermark callback.  See
+ *  xStreamBufferSetWatermarks().
+ */
+typedef void (* StreamBufferWatermarkCallbackFunction_t)( StreamBufferHandle_t xStreamBuffer,
+                                                          BaseType_t xAboveHighWatermark,
+                                                          BaseType_t xIsInsideISR,
+                                                          BaseType_t * const pxHigherPriorityTaskWoken );
+
+/**
+ * Type used to describe one of the buffers passed to xStreamBufferSendV() and
+ * xStreamBufferReceiveV().
+ */
+typedef struct xSTREAM_BUFFER_SEGMENT
+{
+    void * pvData;       /* The start of the segment.  Only read from when sending. */
+    size_t xLengthBytes; /* The number of bytes in the segment. */
+} StreamBufferSegment_t;
+
 /**
  * stream_buffer.h
  *
@@ -271,6 +309,91 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
     xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), sbTYPE_STREAM_BUFFER, ( pucStreamBufferStorageArea ), ( pxStaticStreamBuffer ), ( pxSendCompletedCallback ), ( pxReceiveCompletedCallback ) )
 #endif
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * StreamBufferHandle_t xStreamBufferCreateAligned( size_t xBufferSizeBytes,
+ *                                                  size_t xTriggerLevelBytes );
+ *
+ * StreamBufferHandle_t xStreamBufferCreateStaticAligned( size_t xBufferSizeBytes,
+ *                                                        size_t xTriggerLevelBytes,
+ *                                                        uint8_t *pucStreamBufferStorageArea,
+ *                                                        StaticStreamBuffer_t *pxStaticStreamBuffer );
+ * @endcode
+ *
+ * Versions of xStreamBufferCreate() and xStreamBufferCreateStatic() that
+ * create a stream buffer whose storage area starts on a
+ * configSTREAM_BUFFER_STORAGE_ALIGNMENT byte boundary and is a whole number of
+ * configSTREAM_BUFFER_STORAGE_ALIGNMENT bytes long.  Setting
+ * configSTREAM_BUFFER_STORAGE_ALIGNMENT to the cache line size means the
+ * storage area does not share a cache line with other data, so it can be the
+ * source or target of a DMA transfer, for example through the zero-copy
+ * functions, without a bounce buffer.
+ *
+ * xStreamBufferCreateAligned() rounds the storage area up, so the stream
+ * buffer can hold at least xBufferSizeBytes bytes.  The storage area passed to
+ * xStreamBufferCreateStaticAligned() must already be aligned, and
+ * xBufferSizeBytes must be a multiple of configSTREAM_BUFFER_STORAGE_ALIGNMENT.
+ *
+ * configUSE_ALIGNED_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h for
+ * these macros to be available.  The parameters and return values are the same
+ * as for xStreamBufferCreate() and xStreamBufferCreateStatic().
+ *
+ * \defgroup xStreamBufferCreateAligned xStreamBufferCreateAligned
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+    #define xStreamBufferCreateAligned( xBufferSizeBytes, xTriggerLevelBytes ) \
+    xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( sbTYPE_STREAM_BUFFER | sbTYPE_ALIGNED_STORAGE ), NULL, NULL )
+
+    #define xStreamBufferCreateStaticAligned( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) \
+    xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( sbTYPE_STREAM_BUFFER | sbTYPE_ALIGNED_STORAGE ), ( pucStreamBufferStorageArea ), ( pxStaticStreamBuffer ), NULL, NULL )
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * StreamBufferHandle_t xStreamBufferCreateMultiProducer( size_t xBufferSizeBytes,
+ *                                                         size_t xTriggerLevelBytes );
+ *
+ * StreamBufferHandle_t xStreamBufferCreateStaticMultiProducer( size_t xBufferSizeBytes,
+ *                                                             size_t xTriggerLevelBytes,
+ *                                                             uint8_t *pucStreamBufferStorageArea,
+ *                                                             StaticStreamBuffer_t *pxStaticStreamBuffer );
+ * @endcode
+ *
+ * Versions of xStreamBufferCreate() and xStreamBufferCreateStatic() that
+ * create a stream buffer that any number of tasks and interrupts can write to
+ * at the same time, without a critical section and without interrupts being
+ * masked.  A writer reserves its bytes by atomically moving a reservation head,
+ * copies its data into the reserved bytes, then commits them.  The reader only
+ * sees the written bytes once every writer that reserved space ahead of them
+ * has committed, so bytes from one call to xStreamBufferSend() are never
+ * interleaved with bytes from another.  There must still be only one reader.
+ *
+ * Writes to a multi-producer stream buffer never block: xStreamBufferSend()
+ * ignores its xTicksToWait parameter and, like xStreamBufferSendFromISR(),
+ * writes as many bytes as there is space for.  The zero-copy write functions
+ * cannot be used with a multi-producer stream buffer.
+ *
+ * configUSE_MULTI_PRODUCER_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h
+ * for these macros to be available, and xBufferSizeBytes must be less than
+ * 2^24.  The parameters and return values are the same as for
+ * xStreamBufferCreate() and xStreamBufferCreateStatic().
+ *
+ * \defgroup xStreamBufferCreateMultiProducer xStreamBufferCreateMultiProducer
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+    #define xStreamBufferCreateMultiProducer( xBufferSizeBytes, xTriggerLevelBytes ) \
+    xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( sbTYPE_STREAM_BUFFER | sbTYPE_MULTI_PRODUCER ), NULL, NULL )
+
+    #define xStreamBufferCreateStaticMultiProducer( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) \
+    xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( sbTYPE_STREAM_BUFFER | sbTYPE_MULTI_PRODUCER ), ( pucStreamBufferStorageArea ), ( pxStaticStreamBuffer ), NULL, NULL )
+#endif
+
 /**
  * stream_buffer.h
  *
@@ -1101,6 +1224,135 @@ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILE
 BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer,
                                          size_t xTriggerLevel ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferSetMaxLatency( StreamBufferHandle_t xStreamBuffer, TickType_t xMaxLatencyTicks );
+ * @endcode
+ *
+ * Sets the longest time data can wait in a stream buffer for the trigger level
+ * to be reached.  A task that is blocked on a read of the stream buffer is
+ * moved out of the blocked state when either the trigger level is reached or
+ * xMaxLatencyTicks ticks have passed since the first byte was written to the
+ * empty buffer, whichever comes first, and then receives however many bytes are
+ * available.  This allows a high trigger level to batch data efficiently
+ * without delaying a small amount of data indefinitely.  The task's own block
+ * time still limits the total time it waits.
+ *
+ * When a maximum latency is set, the send completed callback, or
+ * sbSEND_COMPLETED(), is also called when the first bytes are written to an
+ * empty stream buffer, so a blocked reader can start timing the latency.
+ *
+ * The maximum latency is 0, meaning no limit, when the stream buffer is
+ * created, and it is kept when the stream buffer is reset.  It cannot be set
+ * on message buffers or broadcast stream buffers.
+ *
+ * configUSE_STREAM_BUFFER_MAX_LATENCY must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferSetMaxLatency() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being updated.
+ *
+ * @param xMaxLatencyTicks The maximum latency in ticks, or 0 to wait only for
+ * the trigger level.
+ *
+ * @return pdTRUE if the maximum latency was set.  pdFALSE if xStreamBuffer is a
+ * message buffer or a broadcast stream buffer.
+ *
+ * \defgroup xStreamBufferSetMaxLatency xStreamBufferSetMaxLatency
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+    BaseType_t xStreamBufferSetMaxLatency( StreamBufferHandle_t xStreamBuffer,
+                                           TickType_t xMaxLatencyTicks ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferSetWatermarks( StreamBufferHandle_t xStreamBuffer,
+ *                                        size_t xHighWatermarkBytes,
+ *                                        size_t xLowWatermarkBytes,
+ *                                        StreamBufferWatermarkCallbackFunction_t pxWatermarkCallback );
+ * @endcode
+ *
+ * Sets a function to be called when the number of bytes held in a stream
+ * buffer or message buffer rises to xHighWatermarkBytes, and again when it
+ * then falls to xLowWatermarkBytes.  A driver feeding the buffer can use the
+ * callback to assert hardware flow control, such as deasserting RTS on a UART
+ * or NAKing on a USB endpoint, before the buffer is full, and release it once
+ * the reader has caught up, so the writer never has to block or drop data.
+ *
+ * pxWatermarkCallback is called with xAboveHighWatermark set to pdTRUE when a
+ * write leaves at least xHighWatermarkBytes bytes in the buffer, and with
+ * xAboveHighWatermark set to pdFALSE when a read, or a reset, then leaves
+ * xLowWatermarkBytes bytes or fewer.  It is not called again while the number
+ * of bytes held stays between the two watermarks.  The bytes held include the
+ * length of each message in a message buffer, and the bytes not yet read by
+ * the slowest reader of a broadcast stream buffer.
+ *
+ * The callback is called from within a critical section, after the write or
+ * read and before any task waiting on the stream buffer is notified.
+ * xIsInsideISR is pdTRUE if the write or read was made from an interrupt, in
+ * which case pxHigherPriorityTaskWoken can be passed to an interrupt safe API
+ * function.  pxHigherPriorityTaskWoken is NULL otherwise, and may be NULL when
+ * the stream buffer is reset from an interrupt.  The callback must be short
+ * and must not block.
+ *
+ * If flow control was asserted through an earlier callback it is released
+ * through that callback before the new watermarks take effect, and the
+ * callback is then called straight away if the buffer already holds
+ * xHighWatermarkBytes bytes.  The watermarks are kept when the stream buffer
+ * is reset.
+ *
+ * configUSE_STREAM_BUFFER_WATERMARKS must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferSetWatermarks() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being updated.
+ *
+ * @param xHighWatermarkBytes The number of bytes held at which the callback
+ * is called with xAboveHighWatermark set to pdTRUE.  Must be less than the
+ * size of the stream buffer's storage area.
+ *
+ * @param xLowWatermarkBytes The number of bytes held at which the callback is
+ * then called with xAboveHighWatermark set to pdFALSE.  Must be less than
+ * xHighWatermarkBytes.
+ *
+ * @param pxWatermarkCallback The function to call, or NULL to remove the
+ * watermarks.
+ *
+ * @return pdPASS if the watermarks were set.  pdFAIL if pxWatermarkCallback is
+ * not NULL and the watermarks are out of range.
+ *
+ * Example use:
+ * @code{c}
+ * static void prvUARTFlowControl( StreamBufferHandle_t xStreamBuffer,
+ *                                 BaseType_t xAboveHighWatermark,
+ *                                 BaseType_t xIsInsideISR,
+ *                                 BaseType_t * const pxHigherPriorityTaskWoken )
+ * {
+ *  // Ask the far end to stop sending while the buffer is nearly full.
+ *  vSetUARTRTS( xAboveHighWatermark == pdFALSE );
+ * }
+ *
+ * void vAFunction( StreamBufferHandle_t xUARTRxBuffer )
+ * {
+ *  // The buffer is 256 bytes.  Stop the sender at 192 bytes and let it start
+ *  // again once the reader has brought the buffer down to 64 bytes.
+ *  xStreamBufferSetWatermarks( xUARTRxBuffer, 192, 64, prvUARTFlowControl );
+ * }
+ * @endcode
+ * \defgroup xStreamBufferSetWatermarks xStreamBufferSetWatermarks
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+    BaseType_t xStreamBufferSetWatermarks( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xHighWatermarkBytes,
+                                           size_t xLowWatermarkBytes,
+                                           StreamBufferWatermarkCallbackFunction_t pxWatermarkCallback ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * stream_buffer.h
  *
@@ -1188,6 +1440,622 @@ BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
                                                  BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+ *                            const StreamBufferSegment_t * const pxSegments,
+ *                            UBaseType_t uxSegmentCount,
+ *                            TickType_t xTicksToWait );
+ *
+ * size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                   const StreamBufferSegment_t * const pxSegments,
+ *                                   UBaseType_t uxSegmentCount,
+ *                                   BaseType_t * const pxHigherPriorityTaskWoken );
+ *
+ * size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+ *                               const StreamBufferSegment_t * const pxSegments,
+ *                               UBaseType_t uxSegmentCount,
+ *                               TickType_t xTicksToWait );
+ *
+ * size_t xStreamBufferReceiveVFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                      const StreamBufferSegment_t * const pxSegments,
+ *                                      UBaseType_t uxSegmentCount,
+ *                                      BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Scatter-gather versions of xStreamBufferSend(), xStreamBufferSendFromISR(),
+ * xStreamBufferReceive() and xStreamBufferReceiveFromISR().  The send
+ * functions copy the uxSegmentCount segments at pxSegments into the buffer in
+ * order, as if they were one buffer of their total length.  The receive
+ * functions fill the segments in order.  When used with a message buffer the
+ * segments form one message, stored with a single length.
+ *
+ * Apart from taking a list of segments in place of a single buffer, each
+ * function behaves exactly as the function it replaces, including the number
+ * of bytes returned.
+ *
+ * configUSE_STREAM_BUFFER_SEGMENTS must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * \defgroup xStreamBufferSendV xStreamBufferSendV
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_SEGMENTS == 1 )
+    size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+                               const StreamBufferSegment_t * const pxSegments,
+                               UBaseType_t uxSegmentCount,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                      const StreamBufferSegment_t * const pxSegments,
+                                      UBaseType_t uxSegmentCount,
+                                      BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+                                  const StreamBufferSegment_t * const pxSegments,
+                                  UBaseType_t uxSegmentCount,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferReceiveVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                         const StreamBufferSegment_t * const pxSegments,
+                                         UBaseType_t uxSegmentCount,
+                                         BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_STREAM_BUFFER_SEGMENTS */
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveBatch( StreamBufferHandle_t xStreamBuffer,
+ *                                   void * pvRxData,
+ *                                   size_t xBufferLengthBytes,
+ *                                   size_t * const pxMessageOffsets,
+ *                                   size_t xMaxMessages,
+ *                                   size_t * const pxMessageCount,
+ *                                   TickType_t xTicksToWait );
+ * @endcode
+ *
+ * The implementation of xMessageBufferReceiveBatch().  Must only be used with
+ * a message buffer, and should be called through xMessageBufferReceiveBatch()
+ * rather than directly.
+ *
+ * configUSE_MESSAGE_BUFFER_BATCH_RECEIVE must be set to 1 in FreeRTOSConfig.h
+ * for this function to be available.
+ *
+ * \defgroup xStreamBufferReceiveBatch xStreamBufferReceiveBatch
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_MESSAGE_BUFFER_BATCH_RECEIVE == 1 )
+    size_t xStreamBufferReceiveBatch( StreamBufferHandle_t xStreamBuffer,
+                                      void * pvRxData,
+                                      size_t xBufferLengthBytes,
+                                      size_t * const pxMessageOffsets,
+                                      size_t xMaxMessages,
+                                      size_t * const pxMessageCount,
+                                      TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_MESSAGE_BUFFER_BATCH_RECEIVE */
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetWriteRegion( StreamBufferHandle_t xStreamBuffer,
+ *                                     uint8_t ** ppucRegion,
+ *                                     TickType_t xTicksToWait );
+ *
+ * size_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+ *                                  size_t xBytesWritten );
+ *
+ * size_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         size_t xBytesWritten,
+ *                                         BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Write data directly into a stream buffer's storage area, for example from a
+ * DMA engine, instead of copying it in with xStreamBufferSend().
+ *
+ * xStreamBufferGetWriteRegion() sets *ppucRegion to the next free byte of the
+ * storage area and returns the number of bytes that can be written there
+ * without wrapping back to the start of the storage area.  The region can be
+ * shorter than xStreamBufferSpacesAvailable() when the free space wraps; once
+ * the region has been committed a second call returns the remainder.
+ *
+ * Writing to the region does not make the data visible to the reader.
+ * xStreamBufferCommitWrite() adds the first xBytesWritten bytes of the region
+ * to the stream buffer and, in the same way as xStreamBufferSend(), unblocks a
+ * task waiting to receive if the trigger level has been reached.  Use
+ * xStreamBufferCommitWriteFromISR() to commit from an interrupt service
+ * routine.  xStreamBufferGetWriteRegion() can only be called from an interrupt
+ * if xTicksToWait is 0.
+ *
+ * The region belongs to the stream buffer's single writer, so must not be used
+ * at the same time as xStreamBufferSend() or xStreamBufferSendFromISR().
+ * These functions cannot be used with message buffers.
+ *
+ * configUSE_ZERO_COPY_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param ppucRegion Set to point to the start of the writable region.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state waiting for space if the stream buffer is full.
+ *
+ * @param xBytesWritten The number of bytes written to the region, which must
+ * not be more than the length returned by xStreamBufferGetWriteRegion().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if committing the data
+ * unblocked a task with a priority above that of the currently running task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return xStreamBufferGetWriteRegion() returns the length of the writable
+ * region, which is 0 if the stream buffer is still full when the block time
+ * expires.  The commit functions
+ * return the number of bytes committed, which is 0 if xBytesWritten is 0 or is
+ * longer than the region.
+ *
+ * \defgroup xStreamBufferGetWriteRegion xStreamBufferGetWriteRegion
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+    size_t xStreamBufferGetWriteRegion( StreamBufferHandle_t xStreamBuffer,
+                                        uint8_t ** ppucRegion,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xBytesWritten,
+                                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetReadRegion( StreamBufferHandle_t xStreamBuffer,
+ *                                    uint8_t ** ppucRegion,
+ *                                    TickType_t xTicksToWait );
+ *
+ * size_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+ *                              size_t xBytesRead );
+ *
+ * size_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                     size_t xBytesRead,
+ *                                     BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Read data directly from a stream buffer's storage area instead of copying it
+ * out with xStreamBufferReceive().
+ *
+ * xStreamBufferGetReadRegion() sets *ppucRegion to the oldest byte in the
+ * stream buffer and returns the number of bytes that can be read from there
+ * without wrapping back to the start of the storage area.  The region can be
+ * shorter than xStreamBufferBytesAvailable() when the data wraps; once the
+ * region has been consumed a second call returns the remainder.
+ *
+ * The bytes in the region stay in the stream buffer until
+ * xStreamBufferConsume() removes the first xBytesRead of them and, in the same
+ * way as xStreamBufferReceive(), unblocks a task waiting for space.  Use
+ * xStreamBufferConsumeFromISR() to consume from an interrupt service routine.
+ * xStreamBufferGetReadRegion() can only be called from an interrupt if
+ * xTicksToWait is 0.
+ *
+ * The region belongs to the stream buffer's single reader, so must not be used
+ * at the same time as xStreamBufferReceive() or xStreamBufferReceiveFromISR().
+ * These functions cannot be used with message buffers.
+ *
+ * configUSE_ZERO_COPY_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param ppucRegion Set to point to the start of the readable region.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state waiting for data if the stream buffer is empty.
+ * The task is unblocked when the trigger level is reached, as for
+ * xStreamBufferReceive().
+ *
+ * @param xBytesRead The number of bytes the reader has finished with, which
+ * must not be more than the length returned by xStreamBufferGetReadRegion().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if consuming the data
+ * unblocked a task with a priority above that of the currently running task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return xStreamBufferGetReadRegion() returns the length of the readable
+ * region, which is 0 if the stream buffer is still empty when the block time
+ * expires.  The consume functions
+ * return the number of bytes consumed, which is 0 if xBytesRead is 0 or is
+ * longer than the region.
+ *
+ * \defgroup xStreamBufferGetReadRegion xStreamBufferGetReadRegion
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+    size_t xStreamBufferGetReadRegion( StreamBufferHandle_t xStreamBuffer,
+                                       uint8_t ** ppucRegion,
+                                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xBytesRead ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xBytesRead,
+                                        BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * StreamBufferHandle_t xStreamBufferCreateBroadcast( size_t xBufferSizeBytes,
+ *                                                    size_t xTriggerLevelBytes,
+ *                                                    UBaseType_t uxReaderCount );
+ *
+ * StreamBufferHandle_t xStreamBufferCreateBroadcastWithCallback( size_t xBufferSizeBytes,
+ *                                                                size_t xTriggerLevelBytes,
+ *                                                                UBaseType_t uxReaderCount,
+ *                                                                StreamBufferCallbackFunction_t pxSendCompletedCallback,
+ *                                                                StreamBufferCallbackFunction_t pxReceiveCompletedCallback );
+ * @endcode
+ *
+ * Creates a broadcast stream buffer using dynamically allocated memory.  A
+ * broadcast stream buffer has a single writer but uxReaderCount readers, each
+ * of which reads every byte written to the stream buffer at its own pace.  The
+ * readers are numbered from 0 to ( uxReaderCount - 1 ).
+ *
+ * The data is held once however many readers there are.  Space is only freed
+ * for the writer once the slowest reader has read past it, so
+ * xStreamBufferSpacesAvailable() and xStreamBufferBytesAvailable() report the
+ * state of the stream buffer as seen by the slowest reader.
+ *
+ * Data is written using xStreamBufferSend(), xStreamBufferSendFromISR() or
+ * their variants, and read using xStreamBufferReceiveBroadcast() or
+ * xStreamBufferReceiveBroadcastFromISR().  xStreamBufferReceive() and the
+ * zero-copy read functions cannot be used with a broadcast stream buffer.
+ * Broadcast message buffers are not supported.
+ *
+ * configUSE_BROADCAST_STREAM_BUFFERS and configSUPPORT_DYNAMIC_ALLOCATION must
+ * both be set to 1 in FreeRTOSConfig.h for xStreamBufferCreateBroadcast() to be
+ * available.  configUSE_SB_COMPLETED_CALLBACK must also be set to 1 in
+ * FreeRTOSConfig.h for xStreamBufferCreateBroadcastWithCallback() to be
+ * available.
+ *
+ * @param xBufferSizeBytes The total number of bytes the stream buffer will be
+ * able to hold at any one time.
+ *
+ * @param xTriggerLevelBytes The number of bytes a reader must have left to read
+ * before a task blocked in xStreamBufferReceiveBroadcast() on that reader is
+ * unblocked.
+ *
+ * @param uxReaderCount The number of readers, which must be at least 1.
+ *
+ * @param pxSendCompletedCallback Callback invoked when a send leaves at least
+ * the trigger level number of bytes in the stream buffer.  Waiting readers are
+ * unblocked whether or not a callback is provided.
+ *
+ * @param pxReceiveCompletedCallback Callback invoked when more than zero bytes
+ * are read by any reader.  If the parameter is NULL, it will use the default
+ * implementation provided by sbRECEIVE_COMPLETED macro.
+ *
+ * @return If NULL is returned, then the stream buffer cannot be created
+ * because there is insufficient heap memory available.  A non-NULL value being
+ * returned indicates that the stream buffer has been created successfully.
+ *
+ * Example use:
+ * @code{c}
+ *
+ * void vAFunction( void )
+ * {
+ * StreamBufferHandle_t xSamples;
+ * uint8_t ucRxData[ 20 ];
+ * size_t xReceivedBytes;
+ *
+ *  // Create a stream buffer that holds 100 bytes of samples that are read
+ *  // by three tasks.
+ *  xSamples = xStreamBufferCreateBroadcast( 100, 1, 3 );
+ *
+ *  if( xSamples != NULL )
+ *  {
+ *      // Reader 1 waits up to 100ms for samples, independently of readers 0
+ *      // and 2.
+ *      xReceivedBytes = xStreamBufferReceiveBroadcast( xSamples,
+ *                                                      1,
+ *                                                      ucRxData,
+ *                                                      sizeof( ucRxData ),
+ *                                                      pdMS_TO_TICKS( 100 ) );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferCreateBroadcast xStreamBufferCreateBroadcast
+ * \ingroup StreamBufferManagement
+ */
+#if ( ( configUSE_BROADCAST_STREAM_BUFFERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    #define xStreamBufferCreateBroadcast( xBufferSizeBytes, xTriggerLevelBytes, uxReaderCount ) \
+    xStreamBufferGenericCreateBroadcast( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( uxReaderCount ), NULL, NULL )
+
+    #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
+        #define xStreamBufferCreateBroadcastWithCallback( xBufferSizeBytes, xTriggerLevelBytes, uxReaderCount, pxSendCompletedCallback, pxReceiveCompletedCallback ) \
+    xStreamBufferGenericCreateBroadcast( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( uxReaderCount ), ( pxSendCompletedCallback ), ( pxReceiveCompletedCallback ) )
+    #endif
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveBroadcast( StreamBufferHandle_t xStreamBuffer,
+ *                                       UBaseType_t uxReader,
+ *                                       void * pvRxData,
+ *                                       size_t xBufferLengthBytes,
+ *                                       TickType_t xTicksToWait );
+ *
+ * size_t xStreamBufferReceiveBroadcastFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                              UBaseType_t uxReader,
+ *                                              void * pvRxData,
+ *                                              size_t xBufferLengthBytes,
+ *                                              BaseType_t * const pxHigherPriorityTaskWoken );
+ *
+ * size_t xStreamBufferBroadcastBytesAvailable( StreamBufferHandle_t xStreamBuffer,
+ *                                              UBaseType_t uxReader );
+ * @endcode
+ *
+ * Receives bytes from a broadcast stream buffer created with
+ * xStreamBufferCreateBroadcast() on behalf of reader uxReader.  Each reader
+ * receives every byte sent to the stream buffer; reading through one reader
+ * does not remove the data from the others.
+ *
+ * These functions behave as xStreamBufferReceive() and
+ * xStreamBufferReceiveFromISR() for the given reader.  Only one task at a time
+ * can read through each reader, but different readers can be used by
+ * different tasks at the same time.  Blocked readers are notified using the
+ * stream buffer's task notification index, as set by
+ * vStreamBufferSetStreamBufferNotificationIndex().
+ *
+ * xStreamBufferBroadcastBytesAvailable() returns the number of bytes reader
+ * uxReader has not read yet.
+ *
+ * configUSE_BROADCAST_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * @param xStreamBuffer The handle of the broadcast stream buffer.
+ *
+ * @param uxReader The reader to receive for, from 0 to one less than the
+ * reader count passed to xStreamBufferCreateBroadcast().
+ *
+ * @param pvRxData A pointer to the buffer into which the received bytes will
+ * be copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data to be available to this reader.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if reading the data freed
+ * space for a task with a priority above that of the currently running task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return The number of bytes read from the stream buffer, or for
+ * xStreamBufferBroadcastBytesAvailable() the number of bytes that could be
+ * read.
+ *
+ * \defgroup xStreamBufferReceiveBroadcast xStreamBufferReceiveBroadcast
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+    size_t xStreamBufferReceiveBroadcast( StreamBufferHandle_t xStreamBuffer,
+                                          UBaseType_t uxReader,
+                                          void * pvRxData,
+                                          size_t xBufferLengthBytes,
+                                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferReceiveBroadcastFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                 UBaseType_t uxReader,
+                                                 void * pvRxData,
+                                                 size_t xBufferLengthBytes,
+                                                 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferBroadcastBytesAvailable( StreamBufferHandle_t xStreamBuffer,
+                                                 UBaseType_t uxReader ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * StreamBufferHandle_t xStreamBufferCreatePipeline( size_t xBufferSizeBytes,
+ *                                                   size_t xTriggerLevelBytes,
+ *                                                   UBaseType_t uxStageCount );
+ *
+ * StreamBufferHandle_t xStreamBufferCreatePipelineWithCallback( size_t xBufferSizeBytes,
+ *                                                               size_t xTriggerLevelBytes,
+ *                                                               UBaseType_t uxStageCount,
+ *                                                               StreamBufferCallbackFunction_t pxSendCompletedCallback,
+ *                                                               StreamBufferCallbackFunction_t pxReceiveCompletedCallback );
+ * @endcode
+ *
+ * Creates a stream buffer that holds a pipeline of uxStageCount processing
+ * stages between its writer and its reader.  Data written to the stream buffer
+ * is first passed to stage 0, which processes it in place in the stream
+ * buffer's storage area using xStreamBufferGetStageRegion() and
+ * xStreamBufferCommitStage().  Each committed byte then passes to the next
+ * stage, and the bytes committed by the last stage become readable by the
+ * reader.  One storage area so carries the data through every stage without
+ * being copied between stream buffers, and space is only freed when the reader
+ * has read it.
+ *
+ * The writer and reader use the stream buffer as normal, including through
+ * the zero-copy functions.  The send completed callback, or
+ * sbSEND_COMPLETED(), runs when the last stage makes data readable, so hands
+ * the processed data on to the reader.  Pipeline message buffers are not
+ * supported.
+ *
+ * configUSE_STREAM_BUFFER_PIPELINES and configSUPPORT_DYNAMIC_ALLOCATION must
+ * both be set to 1 in FreeRTOSConfig.h for xStreamBufferCreatePipeline() to be
+ * available.  configUSE_SB_COMPLETED_CALLBACK must also be set to 1 in
+ * FreeRTOSConfig.h for xStreamBufferCreatePipelineWithCallback() to be
+ * available.
+ *
+ * @param xBufferSizeBytes The total number of bytes the stream buffer will be
+ * able to hold at any one time, whichever stage they are waiting for.
+ *
+ * @param xTriggerLevelBytes The number of bytes that must be readable before
+ * the reader is unblocked.  The trigger level of each stage is set with
+ * xStreamBufferSetStageTriggerLevel().
+ *
+ * @param uxStageCount The number of stages, which must be at least 1.
+ *
+ * @param pxSendCompletedCallback Callback invoked when the last stage leaves at
+ * least the trigger level number of bytes readable.  If the parameter is NULL,
+ * it will use the default implementation provided by sbSEND_COMPLETED macro.
+ *
+ * @param pxReceiveCompletedCallback Callback invoked when more than zero bytes
+ * are read by the reader.  If the parameter is NULL, it will use the default
+ * implementation provided by sbRECEIVE_COMPLETED macro.
+ *
+ * @return If NULL is returned, then the stream buffer cannot be created
+ * because there is insufficient heap memory available.  A non-NULL value being
+ * returned indicates that the stream buffer has been created successfully.
+ *
+ * Example use:
+ * @code{c}
+ *
+ * // DMA writes samples, stage 0 decimates them and stage 1 filters them, all
+ * // in place, then the codec task reads them.
+ * void vFilterTask( void * pvParameters )
+ * {
+ * StreamBufferHandle_t xAudio = ( StreamBufferHandle_t ) pvParameters;
+ * uint8_t * pucRegion;
+ * size_t xLength;
+ *
+ *  // Filter at least 64 bytes at a time.
+ *  xStreamBufferSetStageTriggerLevel( xAudio, 1, 64 );
+ *
+ *  for( ;; )
+ *  {
+ *      xLength = xStreamBufferGetStageRegion( xAudio, 1, &pucRegion, portMAX_DELAY );
+ *
+ *      if( xLength > 0 )
+ *      {
+ *          vFilter( pucRegion, xLength );
+ *          xStreamBufferCommitStage( xAudio, 1, xLength );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferCreatePipeline xStreamBufferCreatePipeline
+ * \ingroup StreamBufferManagement
+ */
+#if ( ( configUSE_STREAM_BUFFER_PIPELINES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    #define xStreamBufferCreatePipeline( xBufferSizeBytes, xTriggerLevelBytes, uxStageCount ) \
+    xStreamBufferGenericCreatePipeline( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( uxStageCount ), NULL, NULL )
+
+    #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
+        #define xStreamBufferCreatePipelineWithCallback( xBufferSizeBytes, xTriggerLevelBytes, uxStageCount, pxSendCompletedCallback, pxReceiveCompletedCallback ) \
+    xStreamBufferGenericCreatePipeline( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), ( uxStageCount ), ( pxSendCompletedCallback ), ( pxReceiveCompletedCallback ) )
+    #endif
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferGetStageRegion( StreamBufferHandle_t xStreamBuffer,
+ *                                     UBaseType_t uxStage,
+ *                                     uint8_t ** ppucRegion,
+ *                                     TickType_t xTicksToWait );
+ *
+ * size_t xStreamBufferCommitStage( StreamBufferHandle_t xStreamBuffer,
+ *                                  UBaseType_t uxStage,
+ *                                  size_t xBytesProcessed );
+ *
+ * size_t xStreamBufferCommitStageFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         UBaseType_t uxStage,
+ *                                         size_t xBytesProcessed,
+ *                                         BaseType_t * const pxHigherPriorityTaskWoken );
+ *
+ * BaseType_t xStreamBufferSetStageTriggerLevel( StreamBufferHandle_t xStreamBuffer,
+ *                                               UBaseType_t uxStage,
+ *                                               size_t xTriggerLevel );
+ * @endcode
+ *
+ * Process the data in a pipeline stream buffer created with
+ * xStreamBufferCreatePipeline() on behalf of stage uxStage.
+ *
+ * xStreamBufferGetStageRegion() sets *ppucRegion to the oldest byte waiting
+ * for the stage and returns the number of bytes that can be processed from
+ * there without wrapping back to the start of the storage area.  The stage can
+ * read and modify the bytes in place.  xStreamBufferCommitStage() then passes
+ * the first xBytesProcessed bytes of the region on to the next stage, or to
+ * the reader if uxStage is the last stage, and unblocks the task waiting for
+ * them if that leaves it at least its trigger level number of bytes.  Use
+ * xStreamBufferCommitStageFromISR() to commit from an interrupt service
+ * routine.  xStreamBufferGetStageRegion() can only be called from an interrupt
+ * if xTicksToWait is 0.
+ *
+ * xStreamBufferSetStageTriggerLevel() sets the number of bytes that must be
+ * waiting for a stage before a task blocked in xStreamBufferGetStageRegion()
+ * for it is unblocked, so a stage can process its data in batches.  The
+ * trigger level of each stage defaults to 1.
+ *
+ * Only one task at a time can process each stage, but different stages can be
+ * processed by different tasks at the same time.  Blocked stages are notified
+ * using the stream buffer's task notification index, as set by
+ * vStreamBufferSetStreamBufferNotificationIndex().
+ *
+ * configUSE_STREAM_BUFFER_PIPELINES must be set to 1 in FreeRTOSConfig.h for
+ * these functions to be available.
+ *
+ * @param xStreamBuffer The handle of the pipeline stream buffer.
+ *
+ * @param uxStage The stage, from 0 to one less than the stage count passed to
+ * xStreamBufferCreatePipeline().
+ *
+ * @param ppucRegion Set to point to the start of the stage's region.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state waiting for the stage's trigger level to be
+ * reached.
+ *
+ * @param xBytesProcessed The number of bytes the stage has finished with,
+ * which must not be more than the length returned by
+ * xStreamBufferGetStageRegion().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if committing the data
+ * unblocked a task with a priority above that of the currently running task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @param xTriggerLevel The new trigger level for the stage, which must not be
+ * more than the length of the stream buffer.
+ *
+ * @return xStreamBufferGetStageRegion() returns the length of the region,
+ * which is 0 if no data is waiting for the stage when the block time expires.
+ * The commit functions return the number of bytes committed, which is 0 if
+ * xBytesProcessed is 0 or is longer than the region.
+ * xStreamBufferSetStageTriggerLevel() returns pdPASS if the trigger level was
+ * set, or pdFAIL if it was larger than the stream buffer.
+ *
+ * \defgroup xStreamBufferGetStageRegion xStreamBufferGetStageRegion
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+    size_t xStreamBufferGetStageRegion( StreamBufferHandle_t xStreamBuffer,
+                                        UBaseType_t uxStage,
+                                        uint8_t ** ppucRegion,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferCommitStage( StreamBufferHandle_t xStreamBuffer,
+                                     UBaseType_t uxStage,
+                                     size_t xBytesProcessed ) PRIVILEGED_FUNCTION;
+    size_t xStreamBufferCommitStageFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            UBaseType_t uxStage,
+                                            size_t xBytesProcessed,
+                                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+    BaseType_t xStreamBufferSetStageTriggerLevel( StreamBufferHandle_t xStreamBuffer,
+                                                  UBaseType_t uxStage,
+                                                  size_t xTriggerLevel ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * stream_buffer.h
  *
@@ -1245,6 +2113,70 @@ UBaseType_t uxStreamBufferGetStreamBufferNotificationIndex( StreamBufferHandle_t
 void vStreamBufferSetStreamBufferNotificationIndex( StreamBufferHandle_t xStreamBuffer,
                                                     UBaseType_t uxNotificationIndex ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * void vStreamBufferGetStatistics( StreamBufferHandle_t xStreamBuffer,
+ *                                  IPCStatistics_t * pxStatistics );
+ * @endcode
+ *
+ * Returns the statistics gathered for a stream buffer or message buffer.  The
+ * counters accumulate from the time the stream buffer is created or last
+ * reset.  A send or receive is only counted if it transferred at least one
+ * byte, and the maximum depth is measured in bytes.  The mutex members of
+ * IPCStatistics_t are not used.
+ *
+ * configUSE_IPC_STATISTICS must be set to 1 in FreeRTOSConfig.h for
+ * vStreamBufferGetStatistics() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being queried.
+ *
+ * @param pxStatistics The structure the statistics are copied into.
+ *
+ * \defgroup vStreamBufferGetStatistics vStreamBufferGetStatistics
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_IPC_STATISTICS == 1 )
+    void vStreamBufferGetStatistics( StreamBufferHandle_t xStreamBuffer,
+                                     IPCStatistics_t * pxStatistics ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * void vStreamBufferGetLatencyHistogram( StreamBufferHandle_t xStreamBuffer,
+ *                                        IPCLatencyHistogram_t * pxHistogram );
+ * @endcode
+ *
+ * Returns the latencies of the tagged messages received from a message
+ * buffer.  Each latency is measured from the start of the chain of messages
+ * the message belongs to, not from when the message was sent to this buffer.
+ * See xTaskGetMessageTag() in task.h.  The histogram is cleared when the
+ * message buffer is reset.
+ *
+ * Only messages sent with xMessageBufferSend() or xMessageBufferSendFromISR(),
+ * and read with xMessageBufferReceive(), xMessageBufferReceiveFromISR() or
+ * xMessageBufferReceiveBatch(), carry tags.  Stream buffers and
+ * multi-producer, broadcast and inter-processor message buffers do not, so
+ * their histograms stay empty.
+ *
+ * configUSE_IPC_LATENCY_TRACING must be set to 1 in FreeRTOSConfig.h for
+ * vStreamBufferGetLatencyHistogram() to be available.
+ *
+ * @param xStreamBuffer The handle of the message buffer being queried.
+ *
+ * @param pxHistogram The structure the histogram is copied into.
+ *
+ * \defgroup vStreamBufferGetLatencyHistogram vStreamBufferGetLatencyHistogram
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+    void vStreamBufferGetLatencyHistogram( StreamBufferHandle_t xStreamBuffer,
+                                           IPCLatencyHistogram_t * pxHistogram ) PRIVILEGED_FUNCTION;
+#endif
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
                                                  size_t xTriggerLevelBytes,
@@ -1252,6 +2184,22 @@ StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
                                                  StreamBufferCallbackFunction_t pxSendCompletedCallback,
                                                  StreamBufferCallbackFunction_t pxReceiveCompletedCallback ) PRIVILEGED_FUNCTION;
 
+#if ( ( configUSE_BROADCAST_STREAM_BUFFERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    StreamBufferHandle_t xStreamBufferGenericCreateBroadcast( size_t xBufferSizeBytes,
+                                                              size_t xTriggerLevelBytes,
+                                                              UBaseType_t uxReaderCount,
+                                                              StreamBufferCallbackFunction_t pxSendCompletedCallback,
+                                                              StreamBufferCallbackFunction_t pxReceiveCompletedCallback ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_STREAM_BUFFER_PIPELINES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    StreamBufferHandle_t xStreamBufferGenericCreatePipeline( size_t xBufferSizeBytes,
+                                                             size_t xTriggerLevelBytes,
+                                                             UBaseType_t uxStageCount,
+                                                             StreamBufferCallbackFunction_t pxSendCompletedCallback,
+                                                             StreamBufferCallbackFunction_t pxReceiveCompletedCallback ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
     StreamBufferHandle_t xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes,
                                                            size_t xTriggerLevelBytes,
@@ -101,6 +101,21 @@ typedef const struct tskTaskControlBlock   * ConstTaskHandle_t;
  */
 typedef BaseType_t (* TaskHookFunction_t)( void * arg );
 
+/*
+ * Defines the prototype to which the writer passed to vTaskListTasksStream()
+ * and vTaskGetRunTimeStatisticsStream() must conform.  pcText points to
+ * uxLength characters that are not null terminated.
+ */
+typedef void (* TaskStatsWriterFunction_t)( const char * pcText,
+                                            size_t uxLength,
+                                            void * pvContext );
+
+/*
+ * Defines the prototype to which functions submitted to the idle task with
+ * xIdleWorkSubmit() must conform.
+ */
+typedef void (* IdleWorkFunction_t)( void * pvParameter );
+
 /* Task states returned by eTaskGetState. */
 typedef enum
 {
@@ -122,6 +137,21 @@ typedef enum
     eSetValueWithoutOverwrite /* Set the task's notification value if the previous value has been read by the task. */
 } eNotifyAction;
 
+/* Why a task was switched out, as counted when configUSE_SWITCH_REASON_STATS
+ * is 1.  See vTaskGetSwitchReasonCounts(). */
+typedef enum
+{
+    eSwitchTimeSlice = 0, /* The tick interrupt moved to another task of the same priority. */
+    eSwitchYield,         /* The task called taskYIELD(). */
+    eSwitchBlock,         /* The task blocked, delayed, suspended or deleted itself. */
+    eSwitchTaskWake,      /* The task readied a higher priority task through a kernel API. */
+    eSwitchISRWake,       /* An interrupt, including the tick, readied a higher priority task. */
+    eSwitchPriorityChange /* A priority change or priority disinheritance left a higher priority task ready. */
+} eSwitchReason;
+
+/* The number of eSwitchReason values. */
+#define tskSWITCH_REASON_COUNT    6U
+
 /*
  * Used internally only.
  */
@@ -131,6 +161,45 @@ typedef struct xTIME_OUT
     TickType_t xTimeOnEntering;
 } TimeOut_t;
 
+/**
+ * A group of tasks that can all be notified by one call to
+ * xTaskGroupNotify().  A task belongs to at most one group at a time, and is
+ * removed from its group when it is deleted.  The application provides the
+ * memory, and must call vTaskGroupInit() before the group is used.
+ *
+ * The members of the structure are not to be accessed directly.
+ *
+ * \defgroup TaskGroup_t TaskGroup_t
+ * \ingroup TaskNotifications
+ */
+typedef struct xTASK_GROUP
+{
+    void * pvFirstMember;      /**< The first task in the group, the rest are linked through their TCBs. */
+    UBaseType_t uxMemberCount; /**< The number of tasks in the group. */
+} TaskGroup_t;
+
+/**
+ * The release and execution statistics of a task made periodic by
+ * xTaskCreatePeriodic() or xTaskSetPeriodic(), as returned by
+ * vTaskGetPeriodicStats().
+ *
+ * \defgroup TaskPeriodicStats_t TaskPeriodicStats_t
+ * \ingroup TaskCtrl
+ */
+typedef struct xTASK_PERIODIC_STATS
+{
+    TickType_t xPeriod;             /**< The number of ticks between consecutive releases. */
+    TickType_t xNextRelease;        /**< The tick count at which the task is next released. */
+    uint32_t ulReleaseCount;        /**< The number of periods the task has started. */
+    uint32_t ulOverrunCount;        /**< The number of releases that passed while the task was still running an earlier period. */
+    TickType_t xLastReleaseJitter;  /**< The number of ticks between the last release and the task running. */
+    TickType_t xMaxReleaseJitter;   /**< The largest value xLastReleaseJitter has had. */
+    #if ( configGENERATE_RUN_TIME_STATS == 1 )
+        configRUN_TIME_COUNTER_TYPE ulLastExecutionTime; /**< The run time, in run time counter units, the task used in its last complete period. */
+        configRUN_TIME_COUNTER_TYPE ulMaxExecutionTime;  /**< The largest value ulLastExecutionTime has had. */
+    #endif
+} TaskPeriodicStats_t;
+
 /*
  * Defines the memory ranges allocated to the task when an MPU is used.
  */
@@ -158,6 +227,35 @@ typedef struct xTASK_PARAMETERS
     #endif
 } TaskParameters_t;
 
+/*
+ * A template from which short lived tasks are created with
+ * xTaskCreateFromTemplate().  The members are used by the kernel and must not be
+ * accessed directly.
+ */
+#if ( configUSE_TASK_TEMPLATES == 1 )
+    typedef struct xTASK_TEMPLATE
+    {
+        TaskFunction_t pxTaskCode;
+        const char * pcName;
+        configSTACK_DEPTH_TYPE uxStackDepth;
+        UBaseType_t uxPriority;
+        List_t xFreeTasks; /* The TCB and stack pairs not in use by a task. */
+    } TaskTemplate_t;
+#endif
+
+/*
+ * A stack shared by a group of tasks created with xTaskCreateWithSharedStack().
+ * The members are used by the kernel and must not be accessed directly.
+ */
+#if ( configUSE_SHARED_STACKS == 1 )
+    typedef struct xSHARED_STACK
+    {
+        StackType_t * pxStack;
+        configSTACK_DEPTH_TYPE uxStackDepth;
+        TaskHandle_t xOwner; /* The task whose frames are on the stack, or NULL if no task is part way through running on it. */
+    } SharedStack_t;
+#endif
+
 /* Used with the uxTaskGetSystemState() function to return the state of each task
  * in the system. */
 typedef struct xTASK_STATUS
@@ -178,8 +276,86 @@ typedef struct xTASK_STATUS
     #if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
         UBaseType_t uxCoreAffinityMask;           /* The core affinity mask for the task */
     #endif
+    #if ( configUSE_SCHEDULING_LATENCY_STATS == 1 )
+        uint32_t ulSchedulingLatencyHistogram[ configSCHEDULING_LATENCY_BUCKETS ]; /* The number of times the task has waited to run after becoming ready, by how long it waited.  Bucket 0 counts waits of 0 run time counts, and bucket n waits from 2^(n-1) to (2^n)-1 counts, with the last bucket also counting all longer waits.  Only valid when configUSE_SCHEDULING_LATENCY_STATS is defined as 1 in FreeRTOSConfig.h. */
+    #endif
+    #if ( configUSE_TASK_BUDGETS == 1 )
+        uint32_t ulBudgetOverruns;                /* The number of times the task has used up its budget and been throttled.  Only valid when configUSE_TASK_BUDGETS is defined as 1 in FreeRTOSConfig.h. */
+    #endif
+    #if ( configUSE_STACK_PEAK_PROFILING == 1 )
+        configSTACK_DEPTH_TYPE uxStackPeakFreeWords; /* The free stack space, in words, below the deepest stack pointer sampled for the task.  Only valid when configUSE_STACK_PEAK_PROFILING is defined as 1 in FreeRTOSConfig.h. */
+        void * pvStackPeakProgramCounter;            /* The program counter sampled with the deepest stack pointer, or NULL if not known.  Only valid when configUSE_STACK_PEAK_PROFILING is defined as 1 in FreeRTOSConfig.h. */
+    #endif
+    #if ( configUSE_ENERGY_ACCOUNTING == 1 )
+        configENERGY_COUNTER_TYPE ullEnergy;         /* The task's run time multiplied by configENERGY_ACTIVE_POWER(), plus configENERGY_WAKE_UP_COST for each wake-up.  Only valid when configUSE_ENERGY_ACCOUNTING is defined as 1 in FreeRTOSConfig.h. */
+        uint32_t ulWakeUps;                          /* The number of tickless idle sleeps that ended because the task's delay or block time expired.  Only valid when configUSE_ENERGY_ACCOUNTING is defined as 1 in FreeRTOSConfig.h. */
+    #endif
+    #if ( configUSE_SWITCH_REASON_STATS == 1 )
+        uint32_t ulSwitchReasonCounts[ tskSWITCH_REASON_COUNT ]; /* The number of times the task was switched out for each reason, indexed by eSwitchReason.  Only valid when configUSE_SWITCH_REASON_STATS is defined as 1 in FreeRTOSConfig.h. */
+    #endif
 } TaskStatus_t;
 
+/* Used with the uxTaskGetRunTimeSnapshot() function to return the run time of
+ * each task in the system as recorded when the task was last switched out. */
+#if ( configUSE_RUN_TIME_SNAPSHOT == 1 )
+    typedef struct xTASK_SNAPSHOT
+    {
+        TaskHandle_t xHandle;                         /* The handle of the task to which the rest of the information in the structure relates.  The handle is invalid if the task was deleted since the structure was populated. */
+        char pcTaskName[ configMAX_TASK_NAME_LEN ];   /* A copy of the task's name. */
+        UBaseType_t uxCurrentPriority;                /* The priority at which the task was running (may be inherited) when it was last switched out. */
+        configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /* The total run time allocated to the task up to when it was last switched out, as defined by the run time stats clock. */
+        uint32_t ulSwitchOutCount;                    /* The number of times the task has been switched out. */
+    } TaskSnapshot_t;
+#endif
+
+/* Used with the uxTaskGetPCSamples() function to return the program counter
+ * samples recorded by vTaskRecordPCSampleFromISR(). */
+#if ( configUSE_PC_SAMPLING == 1 )
+    typedef struct xTASK_PC_SAMPLE
+    {
+        TaskHandle_t xHandle;   /* The handle of the task that was interrupted, or NULL if the task has been deleted since the sample was recorded. */
+        void * pvProgramCounter; /* The program counter of the interrupted task. */
+    } TaskPCSample_t;
+#endif
+
+/* Used with the vTaskGetCriticalSectionStats() function to return the longest
+ * critical section and the longest scheduler suspension measured. */
+#if ( configUSE_CRITICAL_SECTION_STATS == 1 )
+    typedef struct xCRITICAL_SECTION_STATS
+    {
+        configRUN_TIME_COUNTER_TYPE ulMaxCriticalTime;  /* The longest time from an outermost taskENTER_CRITICAL() or taskENTER_CRITICAL_FROM_ISR() to the matching exit, as defined by the run time stats clock. */
+        const char * pcMaxCriticalFile;                 /* The source file containing the taskENTER_CRITICAL() or taskENTER_CRITICAL_FROM_ISR() that started the longest critical section, or NULL if none has been measured. */
+        uint32_t ulMaxCriticalLine;                     /* The line of pcMaxCriticalFile containing it. */
+        configRUN_TIME_COUNTER_TYPE ulMaxSuspendedTime; /* The longest time from the scheduler being suspended by vTaskSuspendAll() to it being resumed by the matching xTaskResumeAll(). */
+        TaskHandle_t xMaxSuspendedTask;                 /* The task that suspended the scheduler for that time.  The handle is invalid if the task was deleted since. */
+    } CriticalSectionStats_t;
+#endif
+
+/* Used with the vTaskGetTicklessIdleStats() function to return totals over
+ * the tickless sleeps reported by the port. */
+#if ( configUSE_WAKE_SOURCE_STATS == 1 )
+    typedef struct xTICKLESS_IDLE_STATS
+    {
+        uint32_t ulSleeps;            /* The number of tickless sleeps entered. */
+        uint32_t ulEarlyWakes;        /* The number of sleeps ended by something other than the tick interrupt. */
+        uint32_t ulUnlistedWakes;     /* The number of sleeps whose wake source is not in the histogram because the histogram was full. */
+        uint64_t ullPlannedTicks;     /* The total length, in ticks, the sleeps were expected to last. */
+        uint64_t ullActualTicks;      /* The total length, in ticks, the sleeps lasted. */
+        TickType_t xLastPlannedTicks; /* The length the most recent sleep was expected to last. */
+        TickType_t xLastActualTicks;  /* The length the most recent sleep lasted. */
+        uint32_t ulLastWakeSource;    /* The source that ended the most recent sleep. */
+    } TicklessIdleStats_t;
+
+/* Used with the uxTaskGetWakeSourceHistogram() function to return the number
+ * of tickless sleeps each wake source has ended. */
+    typedef struct xWAKE_SOURCE_COUNT
+    {
+        uint32_t ulWakeSource; /* The wake source, which on Cortex-M ports is the exception number of the interrupt that was pending when the processor woke. */
+        uint32_t ulWakeCount;  /* The number of sleeps the source has ended. */
+        uint64_t ullTicksLost; /* The total number of ticks by which those sleeps were shorter than expected. */
+    } WakeSourceCount_t;
+#endif
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -213,7 +389,15 @@ typedef enum
  * \defgroup taskYIELD taskYIELD
  * \ingroup SchedulerControl
  */
-#define taskYIELD()                          portYIELD()
+#if ( configUSE_SWITCH_REASON_STATS == 1 )
+    #define taskYIELD()                       \
+    do {                                      \
+        vTaskSetSwitchReason( eSwitchYield ); \
+        portYIELD();                          \
+    } while( 0 )
+#else
+    #define taskYIELD()                      portYIELD()
+#endif
 
 /**
  * task. h
@@ -227,12 +411,25 @@ typedef enum
  * \defgroup taskENTER_CRITICAL taskENTER_CRITICAL
  * \ingroup SchedulerControl
  */
-#define taskENTER_CRITICAL()                 portENTER_CRITICAL()
-#if ( configNUMBER_OF_CORES == 1 )
-    #define taskENTER_CRITICAL_FROM_ISR()    portSET_INTERRUPT_MASK_FROM_ISR()
-#else
-    #define taskENTER_CRITICAL_FROM_ISR()    portENTER_CRITICAL_FROM_ISR()
-#endif
+#if ( configUSE_CRITICAL_SECTION_STATS == 1 )
+    #define taskENTER_CRITICAL()                                \
+    do {                                                        \
+        portENTER_CRITICAL();                                   \
+        vTaskCriticalStatsEnter( __FILE__, ( uint32_t ) __LINE__ ); \
+    } while( 0 )
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define taskENTER_CRITICAL_FROM_ISR()    uxTaskCriticalStatsEnterFromISR( ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR(), __FILE__, ( uint32_t ) __LINE__ )
+    #else
+        #define taskENTER_CRITICAL_FROM_ISR()    uxTaskCriticalStatsEnterFromISR( ( UBaseType_t ) portENTER_CRITICAL_FROM_ISR(), __FILE__, ( uint32_t ) __LINE__ )
+    #endif
+#else /* if ( configUSE_CRITICAL_SECTION_STATS == 1 ) */
+    #define taskENTER_CRITICAL()                 portENTER_CRITICAL()
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define taskENTER_CRITICAL_FROM_ISR()    portSET_INTERRUPT_MASK_FROM_ISR()
+    #else
+        #define taskENTER_CRITICAL_FROM_ISR()    portENTER_CRITICAL_FROM_ISR()
+    #endif
+#endif /* if ( configUSE_CRITICAL_SECTION_STATS == 1 ) */
 
 /**
  * task. h
@@ -246,11 +443,52 @@ typedef enum
  * \defgroup taskEXIT_CRITICAL taskEXIT_CRITICAL
  * \ingroup SchedulerControl
  */
-#define taskEXIT_CRITICAL()                    portEXIT_CRITICAL()
-#if ( configNUMBER_OF_CORES == 1 )
-    #define taskEXIT_CRITICAL_FROM_ISR( x )    portCLEAR_INTERRUPT_MASK_FROM_ISR( x )
+#if ( configUSE_CRITICAL_SECTION_STATS == 1 )
+    #define taskEXIT_CRITICAL()        \
+    do {                               \
+        vTaskCriticalStatsExit();      \
+        portEXIT_CRITICAL();           \
+    } while( 0 )
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define taskEXIT_CRITICAL_FROM_ISR( x )        \
+    do {                                               \
+        vTaskCriticalStatsExit();                      \
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( x );        \
+    } while( 0 )
+    #else
+        #define taskEXIT_CRITICAL_FROM_ISR( x )        \
+    do {                                               \
+        vTaskCriticalStatsExit();                      \
+        portEXIT_CRITICAL_FROM_ISR( x );               \
+    } while( 0 )
+    #endif
+#else /* if ( configUSE_CRITICAL_SECTION_STATS == 1 ) */
+    #define taskEXIT_CRITICAL()                    portEXIT_CRITICAL()
+    #if ( configNUMBER_OF_CORES == 1 )
+        #define taskEXIT_CRITICAL_FROM_ISR( x )    portCLEAR_INTERRUPT_MASK_FROM_ISR( x )
+    #else
+        #define taskEXIT_CRITICAL_FROM_ISR( x )    portEXIT_CRITICAL_FROM_ISR( x )
+    #endif
+#endif /* if ( configUSE_CRITICAL_SECTION_STATS == 1 ) */
+
+/*
+ * For internal use only.  Macros to mark the start and end of a critical
+ * region that only accesses the data of a single kernel object (a data group).
+ * When configUSE_GRANULAR_LOCKS is 1 the spinlock pointed to by pxSpinlock is
+ * taken in place of the kernel TASK and ISR locks, otherwise these are the
+ * same as taskENTER_CRITICAL() and taskEXIT_CRITICAL() and their FromISR
+ * versions.
+ */
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    #define taskDATA_GROUP_ENTER_CRITICAL( pxSpinlock )                 vTaskDataGroupEnterCritical( pxSpinlock )
+    #define taskDATA_GROUP_EXIT_CRITICAL( pxSpinlock )                  vTaskDataGroupExitCritical( pxSpinlock )
+    #define taskDATA_GROUP_ENTER_CRITICAL_FROM_ISR( pxSpinlock )        uxTaskDataGroupEnterCriticalFromISR( pxSpinlock )
+    #define taskDATA_GROUP_EXIT_CRITICAL_FROM_ISR( x, pxSpinlock )      vTaskDataGroupExitCriticalFromISR( ( x ), ( pxSpinlock ) )
 #else
-    #define taskEXIT_CRITICAL_FROM_ISR( x )    portEXIT_CRITICAL_FROM_ISR( x )
+    #define taskDATA_GROUP_ENTER_CRITICAL( pxSpinlock )                 taskENTER_CRITICAL()
+    #define taskDATA_GROUP_EXIT_CRITICAL( pxSpinlock )                  taskEXIT_CRITICAL()
+    #define taskDATA_GROUP_ENTER_CRITICAL_FROM_ISR( pxSpinlock )        taskENTER_CRITICAL_FROM_ISR()
+    #define taskDATA_GROUP_EXIT_CRITICAL_FROM_ISR( x, pxSpinlock )      taskEXIT_CRITICAL_FROM_ISR( x )
 #endif
 
 /**
@@ -400,6 +638,238 @@ typedef enum
                                        TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskCreateWithNotificationEntries( TaskFunction_t pxTaskCode,
+ *                                                const char * const pcName,
+ *                                                const configSTACK_DEPTH_TYPE uxStackDepth,
+ *                                                void * const pvParameters,
+ *                                                UBaseType_t uxPriority,
+ *                                                UBaseType_t uxNotificationEntries,
+ *                                                TaskHandle_t * const pxCreatedTask );
+ * @endcode
+ *
+ * Create a new task, as xTaskCreate(), that has uxNotificationEntries indexes
+ * in its array of direct to task notifications rather than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  The array is allocated separately
+ * from the task's TCB, so configTASK_NOTIFICATION_ARRAY_ENTRIES can be set to
+ * the number of indexes most tasks need and only the tasks that need more pay
+ * for them.
+ *
+ * configSUPPORT_DYNAMIC_ALLOCATION and configUSE_PER_TASK_NOTIFICATION_ENTRIES
+ * must both be set to 1 in FreeRTOSConfig.h for this function to be available.
+ *
+ * @param uxNotificationEntries The number of indexes in the task's notification
+ * array.  Must be at least configTASK_NOTIFICATION_ARRAY_ENTRIES, as indexes
+ * the kernel uses itself, such as configTASK_NOTIFY_MAILBOX_INDEX, must exist in
+ * every task.  xTaskNotifyWaitAnyIndexed() can only wait on the first
+ * ( sizeof( UBaseType_t ) * 8 ) indexes.
+ *
+ * See xTaskCreate() for the other parameters.
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, otherwise an error code defined in the file projdefs.h
+ *
+ * Example usage:
+ * @code{c}
+ * // The gateway task is notified by eight interrupt sources at indexes 0 to 7,
+ * // while all other tasks only have configTASK_NOTIFICATION_ARRAY_ENTRIES (1)
+ * // index.
+ * xTaskCreateWithNotificationEntries( vGatewayTask, "Gateway", STACK_SIZE, NULL, 5, 8, &xGatewayTask );
+ * @endcode
+ * \defgroup xTaskCreateWithNotificationEntries xTaskCreateWithNotificationEntries
+ * \ingroup Tasks
+ */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_PER_TASK_NOTIFICATION_ENTRIES == 1 ) )
+    BaseType_t xTaskCreateWithNotificationEntries( TaskFunction_t pxTaskCode,
+                                                   const char * const pcName,
+                                                   const configSTACK_DEPTH_TYPE uxStackDepth,
+                                                   void * const pvParameters,
+                                                   UBaseType_t uxPriority,
+                                                   UBaseType_t uxNotificationEntries,
+                                                   TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskCreateDeadline( TaskFunction_t pxTaskCode,
+ *                                 const char * const pcName,
+ *                                 const configSTACK_DEPTH_TYPE uxStackDepth,
+ *                                 void * const pvParameters,
+ *                                 TickType_t xPeriod,
+ *                                 TickType_t xRelativeDeadline,
+ *                                 TickType_t xBudget,
+ *                                 TaskHandle_t * const pxCreatedTask );
+ * @endcode
+ *
+ * configUSE_EDF_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Create a periodic task that is scheduled earliest deadline first.  The task
+ * runs at priority configEDF_PRIORITY, so it preempts tasks of lower priority
+ * and is preempted by tasks of higher priority as usual, but among the tasks
+ * at configEDF_PRIORITY the one with the earliest absolute deadline runs.
+ * Other tasks that run at configEDF_PRIORITY, for example by inheriting it,
+ * are treated as having a deadline of the time they became ready.
+ *
+ * The task's first period starts when it is created.  Each call to
+ * xTaskWaitForNextPeriod() ends the current period's work and blocks the task
+ * until the next period starts, xPeriod ticks after the previous one.  The
+ * task must finish each period's work within xRelativeDeadline ticks of the
+ * start of the period.
+ *
+ * @param pxTaskCode Pointer to the task entry function.
+ *
+ * @param pcName A descriptive name for the task.
+ *
+ * @param uxStackDepth The size of the task stack specified as the number of
+ * variables the stack can hold.
+ *
+ * @param pvParameters Pointer that will be used as the parameter for the task
+ * being created.
+ *
+ * @param xPeriod The number of ticks between the starts of consecutive
+ * periods.  Must be greater than zero.
+ *
+ * @param xRelativeDeadline The number of ticks after the start of each period
+ * by which the task must call xTaskWaitForNextPeriod().  Must be greater than
+ * zero and not greater than xPeriod.
+ *
+ * @param xBudget The number of ticks the task may run for in each period, or
+ * zero for no limit.  A task that uses up its budget has its deadline moved
+ * back by xPeriod and its budget refilled, so an overrunning task cannot make
+ * other deadline scheduled tasks miss their deadlines.
+ *
+ * @param pxCreatedTask Used to pass back a handle by which the created task
+ * can be referenced.
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, otherwise an error code defined in the file projdefs.h
+ *
+ * Example usage:
+ * @code{c}
+ * void vControlTask( void * pvParameters )
+ * {
+ *   for( ;; )
+ *   {
+ *       // Run one iteration of the control loop.
+ *       vRunControlLoop();
+ *
+ *       if( xTaskWaitForNextPeriod() == pdFALSE )
+ *       {
+ *           // This iteration finished after its deadline.
+ *       }
+ *   }
+ * }
+ *
+ * void vOtherFunction( void )
+ * {
+ *   // Run every 10 ticks, finishing within 8 ticks and using at most 3.
+ *   xTaskCreateDeadline( vControlTask, "Control", STACK_SIZE, NULL, 10, 8, 3, NULL );
+ * }
+ * @endcode
+ * \defgroup xTaskCreateDeadline xTaskCreateDeadline
+ * \ingroup Tasks
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    BaseType_t xTaskCreateDeadline( TaskFunction_t pxTaskCode,
+                                    const char * const pcName,
+                                    const configSTACK_DEPTH_TYPE uxStackDepth,
+                                    void * const pvParameters,
+                                    TickType_t xPeriod,
+                                    TickType_t xRelativeDeadline,
+                                    TickType_t xBudget,
+                                    TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskCreatePeriodic( TaskFunction_t pxTaskCode,
+ *                                 const char * const pcName,
+ *                                 const configSTACK_DEPTH_TYPE uxStackDepth,
+ *                                 void * const pvParameters,
+ *                                 UBaseType_t uxPriority,
+ *                                 TickType_t xPeriod,
+ *                                 TickType_t xPhase,
+ *                                 TaskHandle_t * const pxCreatedTask );
+ * @endcode
+ *
+ * configUSE_PERIODIC_TASKS and configSUPPORT_DYNAMIC_ALLOCATION must both be
+ * set to 1 in FreeRTOSConfig.h for this function to be available.
+ *
+ * Create a task that is released every xPeriod ticks, at the tick counts
+ * that are xPhase more than a multiple of xPeriod.  Tasks given the same or
+ * related periods therefore keep a fixed phase relationship with each other
+ * however late they were created.  The task calls xTaskWaitForNextRelease()
+ * at the top of its loop, and the tick moves it straight back to the ready
+ * list when its release is due, so the release time never drifts by the time
+ * the task took to run.
+ *
+ * The kernel records the release jitter, overruns and, if
+ * configGENERATE_RUN_TIME_STATS is 1, the execution time of each period.  See
+ * vTaskGetPeriodicStats().
+ *
+ * @param pxTaskCode Pointer to the task entry function.
+ *
+ * @param pcName A descriptive name for the task.
+ *
+ * @param uxStackDepth The size of the task stack specified as the number of
+ * variables the stack can hold.
+ *
+ * @param pvParameters Pointer that will be used as the parameter for the task
+ * being created.
+ *
+ * @param uxPriority The priority at which the task should run.
+ *
+ * @param xPeriod The number of ticks between consecutive releases.  Must be
+ * greater than zero.
+ *
+ * @param xPhase The offset of the releases from the multiples of xPeriod.
+ *
+ * @param pxCreatedTask Used to pass back a handle by which the created task
+ * can be referenced.
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, otherwise an error code defined in the file projdefs.h
+ *
+ * Example usage:
+ * @code{c}
+ * void vSampleTask( void * pvParameters )
+ * {
+ *   for( ;; )
+ *   {
+ *       if( xTaskWaitForNextRelease() == pdFALSE )
+ *       {
+ *           // The previous sample took longer than the period.
+ *       }
+ *
+ *       vTakeSample();
+ *   }
+ * }
+ *
+ * void vOtherFunction( void )
+ * {
+ *   // Sample every 10 ticks, on ticks 5, 15, 25...
+ *   xTaskCreatePeriodic( vSampleTask, "Sample", STACK_SIZE, NULL, 3, 10, 5, NULL );
+ * }
+ * @endcode
+ * \defgroup xTaskCreatePeriodic xTaskCreatePeriodic
+ * \ingroup Tasks
+ */
+#if ( ( configUSE_PERIODIC_TASKS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    BaseType_t xTaskCreatePeriodic( TaskFunction_t pxTaskCode,
+                                    const char * const pcName,
+                                    const configSTACK_DEPTH_TYPE uxStackDepth,
+                                    void * const pvParameters,
+                                    UBaseType_t uxPriority,
+                                    TickType_t xPeriod,
+                                    TickType_t xPhase,
+                                    TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -529,6 +999,287 @@ typedef enum
                                                UBaseType_t uxCoreAffinityMask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskTemplateInit( TaskTemplate_t * pxTemplate,
+ *                         TaskFunction_t pxTaskCode,
+ *                         const char * const pcName,
+ *                         const configSTACK_DEPTH_TYPE uxStackDepth,
+ *                         UBaseType_t uxPriority,
+ *                         UBaseType_t uxTaskCount,
+ *                         StackType_t * const puxStackBuffers,
+ *                         StaticTask_t * const pxTaskBuffers );
+ * @endcode
+ *
+ * Only available when configUSE_TASK_TEMPLATES is set to 1.
+ *
+ * Initialise a template from which up to uxTaskCount tasks that all run
+ * pxTaskCode can be created with xTaskCreateFromTemplate().  The template owns
+ * uxTaskCount TCB and stack pairs, which are prepared once here rather than
+ * each time a task is created.  When a task created from the template is
+ * deleted its stack is refilled and the pair is returned to the template, so
+ * the cost of preparing the stack is paid when the task is cleaned up (often
+ * by the idle task) rather than when the next task is created.
+ *
+ * @param pxTemplate The template to initialise.
+ *
+ * @param pxTaskCode, pcName, uxStackDepth, uxPriority As the parameters of the
+ * same name passed to xTaskCreateStatic(), used for every task created from
+ * the template.  pcName must remain valid while the template is in use.
+ *
+ * @param uxTaskCount The number of tasks created from the template that can
+ * exist at any one time.
+ *
+ * @param puxStackBuffers Must point to a StackType_t array that has at least
+ * ( uxTaskCount * uxStackDepth ) indexes.
+ *
+ * @param pxTaskBuffers Must point to an array of uxTaskCount StaticTask_t
+ * variables.
+ *
+ * Example usage:
+ * @code{c}
+ *  #define HANDLER_STACK_SIZE    200
+ *  #define MAX_HANDLERS          4
+ *
+ *  static TaskTemplate_t xHandlerTemplate;
+ *  static StaticTask_t xHandlerTCBs[ MAX_HANDLERS ];
+ *  static StackType_t xHandlerStacks[ MAX_HANDLERS * HANDLER_STACK_SIZE ];
+ *
+ *  void vHandlerTask( void * pvParameters )
+ *  {
+ *      vProcessRequest( pvParameters );
+ *      vTaskDelete( NULL );
+ *  }
+ *
+ *  void vInit( void )
+ *  {
+ *      vTaskTemplateInit( &xHandlerTemplate, vHandlerTask, "Req", HANDLER_STACK_SIZE,
+ *                         tskIDLE_PRIORITY + 2, MAX_HANDLERS, xHandlerStacks, xHandlerTCBs );
+ *  }
+ *
+ *  void vOnRequest( Request_t * pxRequest )
+ *  {
+ *      if( xTaskCreateFromTemplate( &xHandlerTemplate, pxRequest ) == NULL )
+ *      {
+ *          // All MAX_HANDLERS handler tasks are already running.
+ *      }
+ *  }
+ * @endcode
+ * \defgroup vTaskTemplateInit vTaskTemplateInit
+ * \ingroup Tasks
+ */
+#if ( configUSE_TASK_TEMPLATES == 1 )
+    void vTaskTemplateInit( TaskTemplate_t * pxTemplate,
+                            TaskFunction_t pxTaskCode,
+                            const char * const pcName,
+                            const configSTACK_DEPTH_TYPE uxStackDepth,
+                            UBaseType_t uxPriority,
+                            UBaseType_t uxTaskCount,
+                            StackType_t * const puxStackBuffers,
+                            StaticTask_t * const pxTaskBuffers ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * TaskHandle_t xTaskCreateFromTemplate( TaskTemplate_t * pxTemplate,
+ *                                       void * const pvParameters );
+ * @endcode
+ *
+ * Only available when configUSE_TASK_TEMPLATES is set to 1.
+ *
+ * Create a task from a template initialised with vTaskTemplateInit(), using
+ * one of the template's TCB and stack pairs, and add it to the list of tasks
+ * that are ready to run.
+ *
+ * @param pxTemplate The template from which the task is created.
+ *
+ * @param pvParameters Pointer that will be used as the parameter for the task
+ * being created.
+ *
+ * @return The handle of the created task, or NULL if every TCB and stack pair
+ * of the template is in use by a task that has not yet been deleted and
+ * cleaned up.
+ *
+ * \defgroup xTaskCreateFromTemplate xTaskCreateFromTemplate
+ * \ingroup Tasks
+ */
+#if ( configUSE_TASK_TEMPLATES == 1 )
+    TaskHandle_t xTaskCreateFromTemplate( TaskTemplate_t * pxTemplate,
+                                          void * const pvParameters ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskTemplateGetFreeCount( const TaskTemplate_t * pxTemplate );
+ * @endcode
+ *
+ * Only available when configUSE_TASK_TEMPLATES is set to 1.
+ *
+ * @return The number of tasks that can currently be created from pxTemplate.
+ *
+ * \defgroup uxTaskTemplateGetFreeCount uxTaskTemplateGetFreeCount
+ * \ingroup Tasks
+ */
+#if ( configUSE_TASK_TEMPLATES == 1 )
+    UBaseType_t uxTaskTemplateGetFreeCount( const TaskTemplate_t * pxTemplate ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSharedStackInit( SharedStack_t * pxSharedStack,
+ *                            StackType_t * const puxStackBuffer,
+ *                            const configSTACK_DEPTH_TYPE uxStackDepth );
+ * @endcode
+ *
+ * Only available when configUSE_SHARED_STACKS is set to 1.
+ *
+ * Initialise a stack that a group of tasks created with
+ * xTaskCreateWithSharedStack() run on, so the group needs one stack large
+ * enough for its deepest task rather than one stack per task.
+ *
+ * The kernel lets only one task of the group run on the stack at a time.  The
+ * task that last ran on the stack owns it until it blocks or suspends itself
+ * between calls to vTaskSharedStackRelease( pdTRUE ) and
+ * vTaskSharedStackRelease( pdFALSE ), even if it is preempted or blocks
+ * elsewhere in between.  Until then the other tasks of the group are held in the Ready
+ * state and are not selected to run.  The owner does not inherit the priority
+ * of the tasks it holds.  When the owner releases the stack, the part of the
+ * stack it is using is copied to its save buffer, and is copied back before it
+ * next runs.
+ *
+ * The port must switch context from a stack other than the stack of the task
+ * being switched out, such as the interrupt stack, as the shared stack is
+ * written during the switch.
+ *
+ * @param pxSharedStack The shared stack to initialise.
+ *
+ * @param puxStackBuffer Must point to a StackType_t array that has at least
+ * uxStackDepth indexes.
+ *
+ * @param uxStackDepth The size of the stack, which must be large enough for
+ * the deepest task in the group.
+ *
+ * \defgroup vTaskSharedStackInit vTaskSharedStackInit
+ * \ingroup Tasks
+ */
+#if ( configUSE_SHARED_STACKS == 1 )
+    void vTaskSharedStackInit( SharedStack_t * pxSharedStack,
+                               StackType_t * const puxStackBuffer,
+                               const configSTACK_DEPTH_TYPE uxStackDepth ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * TaskHandle_t xTaskCreateWithSharedStack( SharedStack_t * pxSharedStack,
+ *                                          TaskFunction_t pxTaskCode,
+ *                                          const char * const pcName,
+ *                                          void * const pvParameters,
+ *                                          UBaseType_t uxPriority,
+ *                                          StackType_t * const puxSaveBuffer,
+ *                                          const configSTACK_DEPTH_TYPE uxSaveDepth,
+ *                                          StaticTask_t * const pxTaskBuffer );
+ * @endcode
+ *
+ * Only available when configUSE_SHARED_STACKS is set to 1.
+ *
+ * Create a task that runs on a stack initialised with vTaskSharedStackInit()
+ * and add it to the list of tasks that are ready to run.  Must not be called
+ * by a task that runs on the same shared stack.
+ *
+ * @param pxSharedStack The stack the task runs on.
+ *
+ * @param pxTaskCode, pcName, pvParameters, uxPriority, pxTaskBuffer As the
+ * parameters of the same name passed to xTaskCreateStatic().
+ *
+ * @param puxSaveBuffer Must point to a StackType_t array that has at least
+ * uxSaveDepth indexes.  It holds the task's part of the shared stack while
+ * other tasks of the group run.
+ *
+ * @param uxSaveDepth The size of the save buffer.  It must hold the stack the
+ * task uses where it blocks with vTaskSharedStackRelease( pdTRUE ) in effect,
+ * including the context the port saves when it switches the task out, and
+ * the initial context built when the task is created.
+ *
+ * @return The handle of the created task.
+ *
+ * Example usage:
+ * @code{c}
+ *  #define SHARED_STACK_SIZE    400
+ *  #define SAVE_SIZE            64
+ *
+ *  static SharedStack_t xSharedStack;
+ *  static StackType_t xStack[ SHARED_STACK_SIZE ];
+ *  static StackType_t xSaveBuffers[ 2 ][ SAVE_SIZE ];
+ *  static StaticTask_t xTCBs[ 2 ];
+ *
+ *  void vWorkerTask( void * pvParameters )
+ *  {
+ *      for( ;; )
+ *      {
+ *          // Give the shared stack to the other tasks while waiting.
+ *          vTaskSharedStackRelease( pdTRUE );
+ *          ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+ *          vTaskSharedStackRelease( pdFALSE );
+ *
+ *          // May block or be preempted, but no other task of the group
+ *          // runs until this one releases the stack again.
+ *          vDoWork( pvParameters );
+ *      }
+ *  }
+ *
+ *  void vInit( void )
+ *  {
+ *      vTaskSharedStackInit( &xSharedStack, xStack, SHARED_STACK_SIZE );
+ *      ( void ) xTaskCreateWithSharedStack( &xSharedStack, vWorkerTask, "W0", ( void * ) 0,
+ *                                           tskIDLE_PRIORITY + 1, xSaveBuffers[ 0 ], SAVE_SIZE, &( xTCBs[ 0 ] ) );
+ *      ( void ) xTaskCreateWithSharedStack( &xSharedStack, vWorkerTask, "W1", ( void * ) 1,
+ *                                           tskIDLE_PRIORITY + 1, xSaveBuffers[ 1 ], SAVE_SIZE, &( xTCBs[ 1 ] ) );
+ *  }
+ * @endcode
+ * \defgroup xTaskCreateWithSharedStack xTaskCreateWithSharedStack
+ * \ingroup Tasks
+ */
+#if ( configUSE_SHARED_STACKS == 1 )
+    TaskHandle_t xTaskCreateWithSharedStack( SharedStack_t * pxSharedStack,
+                                             TaskFunction_t pxTaskCode,
+                                             const char * const pcName,
+                                             void * const pvParameters,
+                                             UBaseType_t uxPriority,
+                                             StackType_t * const puxSaveBuffer,
+                                             const configSTACK_DEPTH_TYPE uxSaveDepth,
+                                             StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSharedStackRelease( BaseType_t xRelease );
+ * @endcode
+ *
+ * Only available when configUSE_SHARED_STACKS is set to 1.
+ *
+ * Called by a task created with xTaskCreateWithSharedStack() to mark the
+ * point at which it can give the shared stack to the other tasks of its
+ * group, normally a blocking call at the top of the task's loop.  The call
+ * returns straight away whether or not the task then blocks, so it must be
+ * made again with pdFALSE once the task is past that point.
+ *
+ * @param xRelease pdTRUE to give the stack up each time the task blocks or
+ * suspends itself from now on, or pdFALSE to keep the stack when it blocks.
+ * The task owns the stack again when it next runs.
+ *
+ * \defgroup vTaskSharedStackRelease vTaskSharedStackRelease
+ * \ingroup Tasks
+ */
+#if ( configUSE_SHARED_STACKS == 1 )
+    void vTaskSharedStackRelease( BaseType_t xRelease ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -858,6 +1609,29 @@ void vTaskDelete( TaskHandle_t xTaskToDelete ) PRIVILEGED_FUNCTION;
  */
 void vTaskDelay( const TickType_t xTicksToDelay ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskDelayUs( uint32_t ulMicroseconds );
+ * @endcode
+ *
+ * Only available when configUSE_HR_TIMEOUTS is set to 1.
+ *
+ * As vTaskDelay(), but the delay is given in microseconds and timed by the
+ * port's high resolution timer, so it can be shorter than a tick or not a
+ * whole number of ticks.  The task is unblocked by the high resolution alarm
+ * interrupt rather than by the tick.
+ *
+ * @param ulMicroseconds The amount of time, in microseconds, that the calling
+ * task should block.
+ *
+ * \defgroup vTaskDelayUs vTaskDelayUs
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_HR_TIMEOUTS == 1 )
+    void vTaskDelayUs( uint32_t ulMicroseconds ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -935,6 +1709,286 @@ BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
         ( void ) xTaskDelayUntil( ( pxPreviousWakeTime ), ( xTimeIncrement ) ); \
     } while( 0 )
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskWaitForNextPeriod( void );
+ * @endcode
+ *
+ * configUSE_EDF_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Called by a task created with xTaskCreateDeadline() when it has finished
+ * the work of its current period.  The task blocks until its next period
+ * starts, when it becomes ready with a new deadline and a full budget.  If
+ * the next period should already have started, the task continues at once;
+ * periods that have been missed entirely are skipped.
+ *
+ * @return pdTRUE if the task finished before its deadline, otherwise pdFALSE.
+ * See xTaskCreateDeadline() for an example.
+ *
+ * \defgroup xTaskWaitForNextPeriod xTaskWaitForNextPeriod
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    BaseType_t xTaskWaitForNextPeriod( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * TickType_t xTaskGetDeadline( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_EDF_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xTask The task to query, or NULL for the calling task.  The task
+ * must have been created with xTaskCreateDeadline().
+ *
+ * @return The tick count by which the task must finish its current period.
+ *
+ * \defgroup xTaskGetDeadline xTaskGetDeadline
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    TickType_t xTaskGetDeadline( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskSetPeriodic( TaskHandle_t xTask, TickType_t xPeriod, TickType_t xPhase );
+ * @endcode
+ *
+ * configUSE_PERIODIC_TASKS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Make an existing task periodic, as if it had been created with
+ * xTaskCreatePeriodic().  The first release is the first tick count, not
+ * earlier than the current one, that is xPhase more than a multiple of
+ * xPeriod.
+ *
+ * @param xTask The task to make periodic, or NULL for the calling task.
+ *
+ * @param xPeriod The number of ticks between consecutive releases.  Must be
+ * greater than zero and less than half the range of TickType_t.
+ *
+ * @param xPhase The offset of the releases from the multiples of xPeriod.
+ *
+ * @return pdPASS if the task was made periodic, or pdFAIL if it already was.
+ *
+ * \defgroup xTaskSetPeriodic xTaskSetPeriodic
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_PERIODIC_TASKS == 1 )
+    BaseType_t xTaskSetPeriodic( TaskHandle_t xTask,
+                                 TickType_t xPeriod,
+                                 TickType_t xPhase ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskWaitForNextRelease( void );
+ * @endcode
+ *
+ * configUSE_PERIODIC_TASKS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Called by a periodic task to end its current period and wait for its next
+ * release.  If the release has already passed, because the period's work
+ * took longer than the period, the task continues at once from the most
+ * recent release; the releases that passed are counted as overruns and any
+ * before the most recent are skipped.
+ *
+ * @return pdTRUE if the task was released on time, or pdFALSE if the
+ * previous period overran or the wait was ended early by xTaskAbortDelay()
+ * or vTaskResume().
+ *
+ * See xTaskCreatePeriodic() for an example.
+ *
+ * \defgroup xTaskWaitForNextRelease xTaskWaitForNextRelease
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_PERIODIC_TASKS == 1 )
+    BaseType_t xTaskWaitForNextRelease( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetPeriodicStats( TaskHandle_t xTask, TaskPeriodicStats_t * pxStats );
+ * @endcode
+ *
+ * configUSE_PERIODIC_TASKS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xTask The periodic task to query, or NULL for the calling task.
+ *
+ * @param pxStats The structure the task's release and execution statistics
+ * are written to.
+ *
+ * \defgroup vTaskGetPeriodicStats vTaskGetPeriodicStats
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_PERIODIC_TASKS == 1 )
+    void vTaskGetPeriodicStats( TaskHandle_t xTask,
+                                TaskPeriodicStats_t * pxStats ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetBudget( TaskHandle_t xTask, TickType_t xBudget, TickType_t xPeriod );
+ * @endcode
+ *
+ * configUSE_TASK_BUDGETS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Limits the processor time a task can use, so a task that runs away at a
+ * high priority cannot starve the tasks below it.  The task may run for
+ * xBudget ticks in every xPeriod ticks.  Once it has used its budget it is
+ * throttled: it is held in the Blocked state until the start of the next
+ * period, when the budget is replenished.  eTaskGetState() reports a
+ * throttled task as eBlocked, but xTaskAbortDelay() cannot release it.
+ *
+ * The running task is charged a whole tick each time the tick interrupt finds
+ * it running, so the budget is only as accurate as the tick period.  A task
+ * that is throttled while holding a mutex keeps it until it runs again.
+ *
+ * @param xTask The task to limit, or NULL for the calling task.  The idle
+ * task cannot be given a budget.
+ *
+ * @param xBudget The ticks the task may run for in each period, or 0 to
+ * remove the task's budget.
+ *
+ * @param xPeriod The ticks between the replenishments of the budget.  The
+ * first period starts when vTaskSetBudget() is called.
+ *
+ * Example usage:
+ * @code{c}
+ * void vAFunction( TaskHandle_t xLoggingTask )
+ * {
+ *   // The logging task runs at a high priority so it drains its buffers
+ *   // promptly, but may use no more than 2 ticks in every 10.
+ *   vTaskSetBudget( xLoggingTask, 2, 10 );
+ * }
+ * @endcode
+ * \defgroup vTaskSetBudget vTaskSetBudget
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    void vTaskSetBudget( TaskHandle_t xTask,
+                         TickType_t xBudget,
+                         TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetTimeSlice( TaskHandle_t xTask, TickType_t xTicks );
+ * @endcode
+ *
+ * configUSE_TASK_TIME_SLICES must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Sets how long a task runs before the tick gives the processor to the next
+ * ready task of the same priority.  By default each task gets
+ * configDEFAULT_TIME_SLICE_TICKS ticks.  A longer time slice lets a batch task
+ * that shares its priority with others run with fewer context switches.
+ * The time slice starts again whenever the task is switched in, so only
+ * tasks of the same priority are kept waiting for it; a task of a higher
+ * priority still preempts at once.
+ *
+ * @param xTask The task to change, or NULL for the calling task.
+ *
+ * @param xTicks The length of the task's time slice in ticks.  Must be at
+ * least 1.
+ *
+ * Example usage:
+ * @code{c}
+ * void vBatchTask( void * pvParameters )
+ * {
+ *   // Run for 10 ticks at a time when sharing the processor.
+ *   vTaskSetTimeSlice( NULL, pdMS_TO_TICKS( 10 ) );
+ *
+ *   for( ;; )
+ *   {
+ *       // Task code goes here.
+ *   }
+ * }
+ * @endcode
+ * \defgroup vTaskSetTimeSlice vTaskSetTimeSlice
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_TIME_SLICES == 1 )
+    void vTaskSetTimeSlice( TaskHandle_t xTask,
+                            TickType_t xTicks ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetHeapQuota( TaskHandle_t xTask, size_t xQuota );
+ * @endcode
+ *
+ * configUSE_TASK_HEAP_QUOTAS must be set to 1 in FreeRTOSConfig.h, and the
+ * application must use heap_4.c, for this function to be available.
+ *
+ * Limits the heap a task can hold, so a task that leaks or runs away cannot
+ * exhaust the heap the other tasks depend on.  Each block pvPortMalloc()
+ * returns once the scheduler has started is charged to the task that
+ * allocated it, including the block's header, until it is freed by any task.
+ * An allocation that would take the task over its quota fails as if the heap
+ * were exhausted, and vApplicationHeapQuotaExceededHook() is called if
+ * configUSE_HEAP_QUOTA_EXCEEDED_HOOK is 1.  The TCB and stack of a task
+ * created by xTaskCreate() are charged to the task that created it.
+ *
+ * @param xTask The task to limit, or NULL for the calling task.
+ *
+ * @param xQuota The most heap, in bytes, the task may hold, or 0 to remove
+ * the task's quota.  A quota below what the task already holds only stops it
+ * allocating more.
+ *
+ * Example usage:
+ * @code{c}
+ * void vAFunction( TaskHandle_t xParserTask )
+ * {
+ *   // The parser builds its output on the heap, but may not hold more than
+ *   // 4K of it at once.
+ *   vTaskSetHeapQuota( xParserTask, 4096 );
+ * }
+ * @endcode
+ * \defgroup vTaskSetHeapQuota vTaskSetHeapQuota
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+    void vTaskSetHeapQuota( TaskHandle_t xTask,
+                            size_t xQuota ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * size_t xTaskGetHeapUsage( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_TASK_HEAP_QUOTAS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param xTask The task to query, or NULL for the calling task.
+ *
+ * @return The size of the heap blocks, including their headers, charged to
+ * the task and not yet freed.
+ *
+ * \defgroup xTaskGetHeapUsage xTaskGetHeapUsage
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+    size_t xTaskGetHeapUsage( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 
 /**
  * task. h
@@ -970,6 +2024,53 @@ BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
     BaseType_t xTaskAbortDelay( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskYieldIfHigherReady( UBaseType_t * puxTasksAtSamePriority );
+ * @endcode
+ *
+ * INCLUDE_xTaskYieldIfHigherReady must be defined as 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ *
+ * Yield, as taskYIELD() does, but only if another task would run as a result.
+ * That is, if a task of equal priority to the calling task is waiting to run,
+ * a task of higher priority is ready (which can happen when preemption is
+ * off), or a yield was held pending.  Otherwise the function returns without
+ * the cost of a context switch interrupt, so a cooperative task can call it
+ * often from a compute loop.
+ *
+ * On a single core the check reads the ready lists without entering a
+ * critical section, so a task that becomes ready just after the check is not
+ * seen until the next call.
+ *
+ * Must be called from a task, with the scheduler running and not suspended.
+ *
+ * @param puxTasksAtSamePriority If not NULL, set to the number of other ready
+ * tasks that share the calling task's priority and are not running.
+ *
+ * @return pdTRUE if the calling task yielded, otherwise pdFALSE.
+ *
+ * Example usage:
+ * @code{c}
+ * void vComputeTask( void * pvParameters )
+ * {
+ *     for( ;; )
+ *     {
+ *         vProcessNextBlock();
+ *
+ *         // Only pay for a context switch when another task can use it.
+ *         ( void ) xTaskYieldIfHigherReady( NULL );
+ *     }
+ * }
+ * @endcode
+ * \defgroup xTaskYieldIfHigherReady xTaskYieldIfHigherReady
+ * \ingroup TaskCtrl
+ */
+#if ( INCLUDE_xTaskYieldIfHigherReady == 1 )
+    BaseType_t xTaskYieldIfHigherReady( UBaseType_t * puxTasksAtSamePriority ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -1415,6 +2516,95 @@ BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume ) PRIVILEGED_FUNCTION;
     UBaseType_t vTaskCoreAffinityGet( ConstTaskHandle_t xTask );
 #endif
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_TASK_GANGS == 1 ) )
+
+/**
+ * @brief Places a task in a gang of tasks that are scheduled together.
+ *
+ * configUSE_TASK_GANGS must be defined as 1 for this function to be
+ * available.
+ *
+ * While one member of a gang is running, the other cores prefer the ready
+ * members of the same gang to other ready tasks of the same priority, and
+ * cores running other tasks of the same or lower priority are asked to yield
+ * so the rest of the gang can run alongside it.  When the time slice of one
+ * member ends, all the members that are running are switched out together.
+ * The members of a gang should share a priority.
+ *
+ * @param xTask The handle of the task to place in the gang. Passing NULL
+ * places the calling task in the gang.
+ *
+ * @param uxGang The gang to place the task in, or 0 to remove the task from
+ * its gang.  Gangs are identified by the application's own non-zero numbers.
+ *
+ * Example usage:
+ *
+ * // Run the four stages of a filter side by side on four cores.
+ * for( i = 0; i < 4; i++ )
+ * {
+ *     xTaskCreate( vFilterStage, "Filter", STACK_SIZE, ( void * ) i, FILTER_PRIORITY, &( xHandles[ i ] ) );
+ *     vTaskGangSet( xHandles[ i ], FILTER_GANG );
+ * }
+ */
+    void vTaskGangSet( const TaskHandle_t xTask,
+                       UBaseType_t uxGang );
+
+/**
+ * @brief Gets the gang of a task.
+ *
+ * configUSE_TASK_GANGS must be defined as 1 for this function to be
+ * available.
+ *
+ * @param xTask The handle of the task to query. Passing NULL queries the
+ * calling task.
+ *
+ * @return The gang the task belongs to, or 0 if it is not in a gang.
+ */
+    UBaseType_t uxTaskGangGet( ConstTaskHandle_t xTask );
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_TOPOLOGY == 1 ) )
+
+/**
+ * @brief Sets the capacity of the cores a task should preferably run on.
+ *
+ * configUSE_CORE_TOPOLOGY must be defined as 1 for this function to be
+ * available.
+ *
+ * The task prefers the least capable cores whose capacity, as given by
+ * configCORE_CAPACITIES, is at least uxCapacity - or the most capable cores if
+ * none are that capable.  It still runs on other cores when nothing else at
+ * its priority can, and its core affinity mask is respected.
+ *
+ * @param xTask The handle of the task. Passing NULL sets the hint of the
+ * calling task.
+ *
+ * @param uxCapacity The capacity the task needs, or 0 for no preference.
+ *
+ * Example usage:
+ *
+ * // Keep the logger on the little cores and the control loop on the big ones.
+ * vTaskCapacityHintSet( xLoggerTask, 1 );
+ * vTaskCapacityHintSet( xControlTask, 100 );
+ */
+    void vTaskCapacityHintSet( const TaskHandle_t xTask,
+                               UBaseType_t uxCapacity );
+
+/**
+ * @brief Gets the capacity of the cores a task prefers.
+ *
+ * configUSE_CORE_TOPOLOGY must be defined as 1 for this function to be
+ * available.
+ *
+ * @param xTask The handle of the task. Passing NULL queries the calling task.
+ *
+ * @return The capacity of the cores the task prefers, which is the hint passed
+ * to vTaskCapacityHintSet() rounded up to the capacity of a core, or 0 if the
+ * task has no preference.
+ */
+    UBaseType_t uxTaskCapacityHintGet( ConstTaskHandle_t xTask );
+#endif
+
 #if ( configUSE_TASK_PREEMPTION_DISABLE == 1 )
 
 /**
@@ -1473,14 +2663,76 @@ BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume ) PRIVILEGED_FUNCTION;
  *
  *         // The task will not be preempted when it is executing in this portion ...
  *
- *         // ... until the preemption is enabled again.
- *         vTaskPreemptionEnable( NULL );
+ *         // ... until the preemption is enabled again.
+ *         vTaskPreemptionEnable( NULL );
+ *
+ *         // The task can be preempted when it is executing in this portion.
+ *     }
+ * }
+ */
+    void vTaskPreemptionEnable( const TaskHandle_t xTask );
+#endif
+
+#if ( configUSE_PREEMPTION_THRESHOLDS == 1 )
+
+/**
+ * @brief Sets the preemption threshold of a task.
+ *
+ * configUSE_PREEMPTION_THRESHOLDS must be defined as 1 for this function to be
+ * available.
+ *
+ * While a task runs it can only be preempted by a task whose priority is
+ * above both its own priority and its preemption threshold.  Tasks of a
+ * priority between the two still preempt the task while it is blocked, but
+ * otherwise wait until it blocks, so a group of closely related tasks can
+ * run to completion with respect to each other, and can share a stack, while
+ * tasks of a higher priority keep their response time.  Time slicing among
+ * tasks of the task's own priority is also suppressed while its threshold is
+ * raised.  A threshold at or below the priority of the task has no effect,
+ * which is the default.
+ *
+ * On single core FreeRTOS a task that is preempted while its threshold is
+ * raised resumes ahead of the tasks its threshold shields it from.  When
+ * configNUMBER_OF_CORES is greater than 1 the threshold only prevents the
+ * task from being preempted, and the task competes at its own priority once
+ * it has been preempted.
+ *
+ * @param xTask The handle of the task. Passing NULL sets the threshold of the
+ * calling task.
+ *
+ * @param uxThreshold The new preemption threshold, which must be less than
+ * configMAX_PRIORITIES.
+ *
+ * Example usage:
+ * @code{c}
+ * void vTaskCode( void *pvParameters )
+ * {
+ *     for( ;; )
+ *     {
+ *         // Tasks of priority up to 4 cannot preempt this task ...
+ *         vTaskPreemptionThresholdSet( NULL, 4 );
+ *
+ *         // ... while it updates state it shares with them.
  *
- *         // The task can be preempted when it is executing in this portion.
+ *         vTaskPreemptionThresholdSet( NULL, 0 );
  *     }
  * }
+ * @endcode
  */
-    void vTaskPreemptionEnable( const TaskHandle_t xTask );
+    void vTaskPreemptionThresholdSet( TaskHandle_t xTask,
+                                      UBaseType_t uxThreshold ) PRIVILEGED_FUNCTION;
+
+/**
+ * @brief Returns the preemption threshold set by vTaskPreemptionThresholdSet().
+ *
+ * configUSE_PREEMPTION_THRESHOLDS must be defined as 1 for this function to be
+ * available.
+ *
+ * @param xTask The handle of the task. Passing NULL queries the calling task.
+ *
+ * @return The preemption threshold of the task.
+ */
+    UBaseType_t uxTaskPreemptionThresholdGet( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 #endif
 
 /*-----------------------------------------------------------
@@ -1576,6 +2828,129 @@ void vTaskStartScheduler( void ) PRIVILEGED_FUNCTION;
  */
 void vTaskEndScheduler( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * @code{c}
+ * size_t xTaskGetWarmBootStateSize( void );
+ * @endcode
+ *
+ * Returns the size, in bytes, of the buffer xTaskSaveWarmBootState() needs to
+ * save the state of the kernel.  The size depends only on the configuration,
+ * not on the number of tasks or other objects created.
+ *
+ * configUSE_WARM_BOOT must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * \defgroup xTaskGetWarmBootStateSize xTaskGetWarmBootStateSize
+ * \ingroup SchedulerControl
+ */
+#if ( configUSE_WARM_BOOT == 1 )
+    size_t xTaskGetWarmBootStateSize( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskSaveWarmBootState( void * pvBuffer, size_t xBufferSize );
+ * @endcode
+ *
+ * Save the state of the kernel - the task lists, the tick count, the timer
+ * lists and the queue registry - to pvBuffer, so that after a reset that
+ * retains RAM, such as the wake from some deep sleep modes, the system can be
+ * resumed by xTaskRestoreWarmBootState() rather than by creating all its
+ * tasks and other objects again.
+ *
+ * Only the kernel's own variables are saved.  The TCBs, stacks, queues,
+ * timers and other objects are resumed from where they are in memory, so all
+ * of them must have been created with the static allocation functions, in RAM
+ * that is retained while the device sleeps, and the same build of the
+ * application must run after the reset.  pvBuffer must also be in retained
+ * RAM.
+ *
+ * Must be called from the idle task, normally from configPRE_SLEEP_PROCESSING()
+ * immediately before the device enters the sleep mode, as the idle task is
+ * the only task that is started again from its beginning when the state is
+ * restored.  The other tasks resume from where they blocked.  If the device
+ * does not then sleep, the saved state must be discarded, for example by
+ * setting pvBuffer to zero, as it no longer matches the tasks' stacks.
+ *
+ * configUSE_WARM_BOOT must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * @param pvBuffer The buffer to save the state to.
+ *
+ * @param xBufferSize The size of pvBuffer in bytes, which must be at least the
+ * size returned by xTaskGetWarmBootStateSize().
+ *
+ * @return pdPASS if the state was saved, or pdFAIL if pvBuffer was too small.
+ *
+ * \defgroup xTaskSaveWarmBootState xTaskSaveWarmBootState
+ * \ingroup SchedulerControl
+ */
+#if ( configUSE_WARM_BOOT == 1 )
+    BaseType_t xTaskSaveWarmBootState( void * pvBuffer,
+                                       size_t xBufferSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskRestoreWarmBootState( void * pvBuffer, size_t xBufferSize, TickType_t xTicksAsleep );
+ * @endcode
+ *
+ * Restore the state of the kernel saved to pvBuffer by
+ * xTaskSaveWarmBootState().  Called after a reset, before any tasks or other
+ * objects are created.  If it returns pdPASS the application must not create
+ * the objects again, but only initialise its hardware and call
+ * vTaskStartScheduler(), which then resumes the tasks that existed when the
+ * state was saved.  If it returns pdFAIL the application must boot as normal.
+ *
+ * The saved state is discarded once it has been restored, so it is not
+ * restored again after a later reset.
+ *
+ * configUSE_WARM_BOOT must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * @param pvBuffer The buffer the state was saved to.
+ *
+ * @param xBufferSize The size of pvBuffer in bytes.
+ *
+ * @param xTicksAsleep The number of ticks that passed between the state being
+ * saved and this function being called, as measured by a clock that runs while
+ * the device sleeps.  The tick count is moved forward by this number of ticks,
+ * unblocking tasks whose timeouts expired meanwhile.  Pass 0 if the time is
+ * not known.
+ *
+ * @return pdPASS if the state was restored, or pdFAIL if pvBuffer does not
+ * hold valid saved state, as is the case after a power on reset.
+ *
+ * Example usage:
+ * @code{c}
+ * // In RAM that is retained, and not initialised at start up.
+ * static uint8_t ucWarmBootState[ WARM_BOOT_STATE_SIZE ] __attribute__( ( section( ".noinit" ) ) );
+ *
+ * int main( void )
+ * {
+ *     prvSetupHardware();
+ *
+ *     if( xTaskRestoreWarmBootState( ucWarmBootState, sizeof( ucWarmBootState ), prvTicksAsleep() ) != pdPASS )
+ *     {
+ *         prvCreateTasksAndQueues();
+ *     }
+ *
+ *     vTaskStartScheduler();
+ * }
+ * @endcode
+ *
+ * \defgroup xTaskRestoreWarmBootState xTaskRestoreWarmBootState
+ * \ingroup SchedulerControl
+ */
+#if ( configUSE_WARM_BOOT == 1 )
+    BaseType_t xTaskRestoreWarmBootState( void * pvBuffer,
+                                          size_t xBufferSize,
+                                          TickType_t xTicksAsleep ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -1863,6 +3238,111 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
     configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task.h
+ * @code{c}
+ * configSTACK_DEPTH_TYPE uxTaskGetISRStackHighWaterMark( BaseType_t xCoreID );
+ * @endcode
+ *
+ * INCLUDE_uxTaskGetISRStackHighWaterMark must be set to 1 in FreeRTOSConfig.h
+ * for this function to be available, and the port must switch to a dedicated
+ * interrupt stack on each core.
+ *
+ * Returns the high water mark of the interrupt stack of core xCoreID.  That
+ * is, the minimum free stack space there has been (in words) since the
+ * scheduler started.  As interrupts do not run on task stacks on such ports,
+ * task stacks only need to be sized for the tasks themselves, and this
+ * function shows how large the interrupt stacks need to be.
+ *
+ * @param xCoreID The core whose interrupt stack is checked.  Must be 0 when
+ * configNUMBER_OF_CORES is 1.
+ *
+ * @return The smallest amount of free interrupt stack space there has been, in
+ * words.
+ */
+#if ( INCLUDE_uxTaskGetISRStackHighWaterMark == 1 )
+    configSTACK_DEPTH_TYPE uxTaskGetISRStackHighWaterMark( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task.h
+ * @code{c}
+ * configSTACK_DEPTH_TYPE uxTaskGetStackPeak( TaskHandle_t xTask, void ** ppvProgramCounter );
+ * @endcode
+ *
+ * configUSE_STACK_PEAK_PROFILING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * The stack pointer of a task is sampled each time the task is switched out,
+ * and whenever vTaskSampleStackPeakFromISR() is called while it is running.
+ * The deepest sample is kept along with the program counter saved with it, so
+ * the function that was using the most stack can be found.  Unlike
+ * uxTaskGetStackHighWaterMark2() this does not scan the stack, and it does
+ * not rely on the stack having been filled when the task was created, but a
+ * peak between two samples is not seen.
+ *
+ * @param xTask Handle of the task to query.  Set xTask to NULL to query the
+ * calling task.
+ *
+ * @param ppvProgramCounter If not NULL, set to the program counter sampled
+ * with the deepest stack pointer, or NULL if the port cannot provide it or
+ * nothing has been sampled since the peak was reset.
+ *
+ * @return The free stack space, in words, below the deepest stack pointer
+ * sampled since the task was created or vTaskResetStackPeak() was called.
+ */
+#if ( configUSE_STACK_PEAK_PROFILING == 1 )
+    configSTACK_DEPTH_TYPE uxTaskGetStackPeak( TaskHandle_t xTask,
+                                               void ** ppvProgramCounter ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task.h
+ * @code{c}
+ * void vTaskResetStackPeak( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_STACK_PEAK_PROFILING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Forgets the deepest stack pointer recorded for xTask, so the peak of a
+ * particular phase of the application can be measured.
+ *
+ * @param xTask Handle of the task.  Set xTask to NULL to reset the peak of the
+ * calling task.
+ */
+#if ( configUSE_STACK_PEAK_PROFILING == 1 )
+    void vTaskResetStackPeak( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task.h
+ * @code{c}
+ * void vTaskSampleStackPeakFromISR( StackType_t * pxStackPointer, void * pvProgramCounter );
+ * @endcode
+ *
+ * configUSE_STACK_PEAK_PROFILING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Records a stack pointer sample for the task running on the calling core.
+ * The kernel can only read a task's stack pointer when the task is switched
+ * out, so sampling from a periodic interrupt - typically the tick hook - is
+ * what finds peaks in code that does not block.  The interrupt must pass the
+ * stack pointer and program counter of the interrupted task, which only the
+ * application knows how to read.  For example, on a Cortex-M3 the tick hook
+ * could pass the process stack pointer and the program counter the hardware
+ * stacked at offset 6 from it.  Samples outside the task's stack are ignored.
+ *
+ * @param pxStackPointer The stack pointer of the interrupted task.
+ *
+ * @param pvProgramCounter The program counter of the interrupted task, or
+ * NULL if it is not known.
+ */
+#if ( configUSE_STACK_PEAK_PROFILING == 1 )
+    void vTaskSampleStackPeakFromISR( StackType_t * pxStackPointer,
+                                      void * pvProgramCounter ) PRIVILEGED_FUNCTION;
+#endif
+
 /* When using trace macros it is sometimes necessary to include task.h before
  * FreeRTOS.h.  When this is done TaskHookFunction_t will not yet have been defined,
  * so the following two prototypes will cause a compilation error.  This can be
@@ -1910,6 +3390,41 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
     #endif /* configUSE_APPLICATION_TASK_TAG ==1 */
 #endif /* ifdef configUSE_APPLICATION_TASK_TAG */
 
+#if ( configUSE_TASK_VECTOR_UNIT_FLAG == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vTaskSetUsesVectorUnit( TaskHandle_t xTask, BaseType_t xUsesVectorUnit );
+ * @endcode
+ *
+ * configUSE_TASK_VECTOR_UNIT_FLAG must be defined as 1 for this function to be
+ * available.
+ *
+ * Declare whether the task xTask uses the floating point unit or vector
+ * extension (such as Arm Helium/MVE).  Tasks start with the flag clear.  On
+ * ports that support it the hardware only preserves floating point and vector
+ * state for tasks that have the flag set, so a task that has not set the flag
+ * must not execute any floating point or vector instructions - including any
+ * generated by the compiler.  Set the flag before the task first uses the unit.
+ * Passing xTask as NULL sets the flag for the calling task.
+ */
+    void vTaskSetUsesVectorUnit( TaskHandle_t xTask,
+                                 BaseType_t xUsesVectorUnit ) PRIVILEGED_FUNCTION;
+
+/**
+ * task.h
+ * @code{c}
+ * BaseType_t xTaskGetUsesVectorUnit( TaskHandle_t xTask );
+ * @endcode
+ *
+ * Returns the value set by vTaskSetUsesVectorUnit() for the task xTask, or for
+ * the calling task if xTask is NULL.
+ */
+    BaseType_t xTaskGetUsesVectorUnit( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_VECTOR_UNIT_FLAG */
+
 #if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
 
 /* Each task contains an array of pointers that is dimensioned by the
@@ -1948,6 +3463,54 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( ( configUSE_TASK_HEAP_QUOTAS == 1 ) && ( configUSE_HEAP_QUOTA_EXCEEDED_HOOK == 1 ) )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationHeapQuotaExceededHook( TaskHandle_t xTask, size_t xWantedSize );
+ * @endcode
+ *
+ * The application heap quota exceeded hook is called when an allocation fails
+ * because it would take a task over the quota set by vTaskSetHeapQuota().  It
+ * is called from within pvPortMalloc() with the scheduler suspended, so must
+ * not call API functions that could block.
+ *
+ * @param xTask The task the allocation would have been charged to.
+ * @param xWantedSize The size of the block that could not be allocated,
+ * including its header.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationHeapQuotaExceededHook( TaskHandle_t xTask,
+                                            size_t xWantedSize );
+
+#endif
+
+#if ( configUSE_LIST_LINK_CHECKS > 0 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationListCorruptedHook( const List_t * pxList );
+ * @endcode
+ *
+ * The application list corrupted hook is called when the links of one of the
+ * kernel's task lists are found not to be consistent.  It is called from
+ * within the kernel, possibly from the tick interrupt, so must not call API
+ * functions.  The kernel cannot continue safely once it returns, so it would
+ * normally record what it can and reset the system.
+ *
+ * @param pxList The list found to be corrupted.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationListCorruptedHook( const List_t * pxList );
+
+#endif
+
 #if ( configUSE_IDLE_HOOK == 1 )
 
 /**
@@ -1986,6 +3549,66 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configUSE_DVFS_GOVERNOR == 1 )
+
+/**
+ *  task.h
+ * @code{c}
+ * UBaseType_t uxApplicationDVFSGovernorHook( const UBaseType_t * puxCoreLoads, UBaseType_t uxCurrentLevel );
+ * void vApplicationDVFSSetLevel( UBaseType_t uxLevel );
+ * @endcode
+ *
+ * uxApplicationDVFSGovernorHook() is called from the tick interrupt every
+ * configDVFS_GOVERNOR_PERIOD ticks with the load of each core, as returned by
+ * xTaskGetCoreLoad(), in puxCoreLoads[ 0 ] to
+ * puxCoreLoads[ configNUMBER_OF_CORES - 1 ], and the current performance
+ * level, which is 0 when the scheduler starts.  It returns the performance
+ * level to run at.  The meaning of a level is defined by the application.
+ *
+ * When the level returned differs from the current level the kernel calls
+ * vApplicationDVFSSetLevel() to change the clock frequency, and the voltage if
+ * need be, then portDVFS_CLOCK_CHANGED() for the port to recalculate its tick
+ * timer reload value.  configCPU_CLOCK_HZ, or configSYSTICK_CLOCK_HZ if the
+ * tick timer uses a different clock, must then evaluate to the new frequency,
+ * for example by defining it as a variable set by vApplicationDVFSSetLevel().
+ *
+ * Both functions run within a critical section, so must not call API
+ * functions other than those ending in FromISR.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    UBaseType_t uxApplicationDVFSGovernorHook( const UBaseType_t * puxCoreLoads,
+                                               UBaseType_t uxCurrentLevel );
+
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationDVFSSetLevel( UBaseType_t uxLevel );
+
+#endif
+
+#if ( configUSE_DEADLINE_MISSED_HOOK != 0 )
+
+/**
+ *  task.h
+ * @code{c}
+ * void vApplicationDeadlineMissedHook( TaskHandle_t xTask );
+ * @endcode
+ *
+ * This hook function is called once per period when a task created with
+ * xTaskCreateDeadline() has not finished by its deadline.  It is called from
+ * the tick interrupt when the deadline passes while the task is running or is
+ * the next deadline scheduled task to run, otherwise from the task itself when
+ * it calls xTaskWaitForNextPeriod().
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationDeadlineMissedHook( TaskHandle_t xTask );
+
+#endif
+
 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
 
 /**
@@ -2080,6 +3703,58 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
     TaskHandle_t xTaskGetIdleTaskHandleForCore( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
 #endif /* #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) */
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xIdleWorkSubmit( IdleWorkFunction_t pxFunction, void * pvParameter );
+ * BaseType_t xIdleWorkSubmitFromISR( IdleWorkFunction_t pxFunction, void * pvParameter );
+ * BaseType_t xIdleWorkSubmitToCore( IdleWorkFunction_t pxFunction, void * pvParameter, BaseType_t xCoreID );
+ * @endcode
+ *
+ * configUSE_IDLE_WORK_QUEUE must be set to 1 in FreeRTOSConfig.h for these
+ * functions to be available.
+ *
+ * Queue a call to pxFunction( pvParameter ) for the idle task to make when the
+ * core has nothing else to do, so low priority maintenance - such as heap
+ * compaction or flash wear levelling - can use spare cycles without a task and
+ * stack of its own.  Each core has its own queue of
+ * configIDLE_WORK_QUEUE_LENGTH entries, run in the order they were submitted
+ * by whichever idle task is running on that core, one entry on each pass
+ * through the idle loop.  The core is not put into a low power mode while its
+ * queue holds work.
+ *
+ * xIdleWorkSubmit() and xIdleWorkSubmitFromISR() queue the work on the core
+ * they are called on.  xIdleWorkSubmitToCore(), which is only available when
+ * configNUMBER_OF_CORES is greater than 1, queues it on core xCoreID.
+ *
+ * pxFunction runs in the idle task, so MUST NOT, UNDER ANY CIRCUMSTANCES, CALL
+ * A FUNCTION THAT MIGHT BLOCK, and should return promptly.  A long job should
+ * do part of its work then submit itself again.
+ *
+ * @param pxFunction The function the idle task calls.
+ *
+ * @param pvParameter The value passed into pxFunction.
+ *
+ * @param xCoreID The core whose idle task runs pxFunction.
+ *
+ * @return pdPASS if the work was queued, or pdFAIL if the queue was full.
+ *
+ * \defgroup xIdleWorkSubmit xIdleWorkSubmit
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_IDLE_WORK_QUEUE == 1 )
+    BaseType_t xIdleWorkSubmit( IdleWorkFunction_t pxFunction,
+                                void * pvParameter ) PRIVILEGED_FUNCTION;
+    BaseType_t xIdleWorkSubmitFromISR( IdleWorkFunction_t pxFunction,
+                                       void * pvParameter ) PRIVILEGED_FUNCTION;
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        BaseType_t xIdleWorkSubmitToCore( IdleWorkFunction_t pxFunction,
+                                          void * pvParameter,
+                                          BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+    #endif
+#endif /* configUSE_IDLE_WORK_QUEUE */
+
 /**
  * configUSE_TRACE_FACILITY must be defined as 1 in FreeRTOSConfig.h for
  * uxTaskGetSystemState() to be available.
@@ -2167,20 +3842,140 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
  *                      sprintf( pcWriteBuffer, "%s\t\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter );
  *                  }
  *
- *                  pcWriteBuffer += strlen( ( char * ) pcWriteBuffer );
- *              }
- *          }
+ *                  pcWriteBuffer += strlen( ( char * ) pcWriteBuffer );
+ *              }
+ *          }
+ *
+ *          // The array is no longer needed, free the memory it consumes.
+ *          vPortFree( pxTaskStatusArray );
+ *      }
+ *  }
+ *  @endcode
+ */
+#if ( configUSE_TRACE_FACILITY == 1 )
+    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
+                                      const UBaseType_t uxArraySize,
+                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetRunTimeSnapshot( TaskSnapshot_t * const pxSnapshotArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime );
+ * @endcode
+ *
+ * configUSE_RUN_TIME_SNAPSHOT must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * A lower overhead alternative to uxTaskGetSystemState() for sampling run time
+ * statistics periodically.  The kernel keeps a TaskSnapshot_t record for each
+ * of up to configRUN_TIME_SNAPSHOT_SLOTS tasks and updates a task's record in
+ * vTaskSwitchContext() each time the task is switched out.
+ * uxTaskGetRunTimeSnapshot() copies the records without suspending the
+ * scheduler or entering a critical section.  A sequence count in each record
+ * lets the copy detect, and retry, a record that changed while it was being
+ * read, so each copied record is consistent, although different records may
+ * have been copied either side of a context switch.
+ *
+ * The run time of a task that is running when the snapshot is taken does not
+ * include the time since it was last switched in.  Tasks created while every
+ * record is in use do not appear in the snapshot.
+ *
+ * Must only be called from a task, not from an interrupt.
+ *
+ * @param pxSnapshotArray A pointer to an array of TaskSnapshot_t structures.
+ * One structure is filled for each task in the snapshot, up to uxArraySize.
+ *
+ * @param uxArraySize The size of the array pointed to by pxSnapshotArray.
+ *
+ * @param pulTotalRunTime If pulTotalRunTime is not NULL then
+ * *pulTotalRunTime is set to the current value of the run time stats clock.
+ *
+ * @return The number of TaskSnapshot_t structures that were populated.
+ */
+#if ( configUSE_RUN_TIME_SNAPSHOT == 1 )
+    UBaseType_t uxTaskGetRunTimeSnapshot( TaskSnapshot_t * const pxSnapshotArray,
+                                          const UBaseType_t uxArraySize,
+                                          configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskRecordPCSampleFromISR( void * pvProgramCounter );
+ * @endcode
+ *
+ * configUSE_PC_SAMPLING must be defined as 1 for this function to be
+ * available.
+ *
+ * Records the program counter of the task that was running on the calling
+ * core when the interrupt occurred, together with the task's handle, in a
+ * buffer of configPC_SAMPLE_BUFFER_LENGTH samples.  Once the buffer is full
+ * each new sample overwrites the oldest.  Sampling at a fixed rate builds a
+ * statistical profile of where each task spends its time, which the run time
+ * stats cannot show.
+ *
+ * Ports that support it call this function from their tick interrupt when
+ * configPC_SAMPLE_FROM_TICK is 1.  Otherwise call it from a periodic timer
+ * interrupt - running at a rate unrelated to the tick avoids sampling in step
+ * with periodic tasks.  The interrupt must only interrupt tasks, not other
+ * interrupts, as the sample is attributed to the running task.
+ *
+ * @param pvProgramCounter The program counter of the interrupted task, as
+ * saved by the interrupt entry.
+ */
+#if ( configUSE_PC_SAMPLING == 1 )
+    void vTaskRecordPCSampleFromISR( void * pvProgramCounter ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetPCSamples( TaskPCSample_t * const pxSampleArray, const UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * configUSE_PC_SAMPLING must be defined as 1 for this function to be
+ * available.
  *
- *          // The array is no longer needed, free the memory it consumes.
- *          vPortFree( pxTaskStatusArray );
+ * Moves up to uxArraySize program counter samples, oldest first, out of the
+ * buffer written by vTaskRecordPCSampleFromISR().  Samples are removed as
+ * they are copied, so each sample is returned once.  The handle in a sample
+ * is set to NULL when its task is deleted, so a handle returned by this
+ * function is valid until the task is next deleted.
+ *
+ * The samples are normally sent to a host and symbolised there, for example
+ * with tools/profiler/freertos_profile.py:
+ * @code{c}
+ * void vDrainSamples( void )
+ * {
+ * static TaskPCSample_t xSamples[ 32 ];
+ * UBaseType_t x, uxCount;
+ *
+ *  do
+ *  {
+ *      uxCount = uxTaskGetPCSamples( xSamples, 32 );
+ *
+ *      for( x = 0; x < uxCount; x++ )
+ *      {
+ *          printf( "%s %p\n",
+ *                  ( xSamples[ x ].xHandle != NULL ) ? pcTaskGetName( xSamples[ x ].xHandle ) : "<deleted>",
+ *                  xSamples[ x ].pvProgramCounter );
  *      }
- *  }
- *  @endcode
+ *  } while( uxCount > 0 );
+ * }
+ * @endcode
+ *
+ * Must only be called from a task, not from an interrupt.
+ *
+ * @param pxSampleArray A pointer to an array of TaskPCSample_t structures.
+ *
+ * @param uxArraySize The size of the array pointed to by pxSampleArray.
+ *
+ * @return The number of TaskPCSample_t structures that were populated.
  */
-#if ( configUSE_TRACE_FACILITY == 1 )
-    UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray,
-                                      const UBaseType_t uxArraySize,
-                                      configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+#if ( configUSE_PC_SAMPLING == 1 )
+    UBaseType_t uxTaskGetPCSamples( TaskPCSample_t * const pxSampleArray,
+                                    const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
 #endif
 
 /**
@@ -2242,11 +4037,76 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
  * \defgroup vTaskListTasks vTaskListTasks
  * \ingroup TaskUtils
  */
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
     void vTaskListTasks( char * pcWriteBuffer,
                          size_t uxBufferLength ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskListTasksStream( TaskStatsWriterFunction_t pxWriter, void * pvContext );
+ * @endcode
+ *
+ * configUSE_TRACE_FACILITY and configUSE_STATS_FORMATTING_FUNCTIONS must
+ * both be defined as 1 for this function to be available.
+ *
+ * Generates the same table as vTaskListTasks(), but passes each line to
+ * pxWriter as soon as it has been formatted instead of writing it into a
+ * buffer.  Unlike vTaskListTasks() it does not allocate a TaskStatus_t array
+ * from the heap, and it formats the numbers itself rather than calling
+ * snprintf(), so it can be used when configSUPPORT_DYNAMIC_ALLOCATION is 0 and
+ * disturbs a loaded system much less.
+ *
+ * The task lists are walked with the scheduler suspended, and pxWriter is
+ * called from within that walk.  pxWriter must therefore not call any API
+ * function that could block or yield - typically it copies the line into a
+ * console or UART transmit buffer.
+ *
+ * @param pxWriter The function called with each formatted line.
+ *
+ * @param pvContext Passed unchanged to every call to pxWriter.
+ *
+ * \defgroup vTaskListTasksStream vTaskListTasksStream
+ * \ingroup TaskUtils
+ */
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+    void vTaskListTasksStream( TaskStatsWriterFunction_t pxWriter,
+                               void * pvContext ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskListStackPeaks( char *pcWriteBuffer, size_t uxBufferLength );
+ * @endcode
+ *
+ * configUSE_STACK_PEAK_PROFILING, configUSE_TRACE_FACILITY and
+ * configUSE_STATS_FORMATTING_FUNCTIONS must all be defined as 1 for this
+ * function to be available.
+ *
+ * Writes a table of the deepest stack pointer sampled for each task, as
+ * returned by uxTaskGetStackPeak(), into pcWriteBuffer.  Each line holds the
+ * task name, the free stack space in words below the peak, and the program
+ * counter sampled with the peak, which can be looked up in the map file or
+ * with addr2line to find the function responsible.
+ *
+ * Like vTaskListTasks(), this function is provided for convenience only, uses
+ * snprintf(), and allocates a TaskStatus_t array from the heap.
+ *
+ * @param pcWriteBuffer A buffer into which the table is written in ASCII
+ * form.
+ *
+ * @param uxBufferLength Length of the pcWriteBuffer.
+ *
+ * \defgroup vTaskListStackPeaks vTaskListStackPeaks
+ * \ingroup TaskUtils
+ */
+#if ( ( configUSE_STACK_PEAK_PROFILING == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    void vTaskListStackPeaks( char * pcWriteBuffer,
+                              size_t uxBufferLength ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2367,11 +4227,38 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
  * \defgroup vTaskGetRunTimeStatistics vTaskGetRunTimeStatistics
  * \ingroup TaskUtils
  */
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
     void vTaskGetRunTimeStatistics( char * pcWriteBuffer,
                                     size_t uxBufferLength ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetRunTimeStatisticsStream( TaskStatsWriterFunction_t pxWriter, void * pvContext );
+ * @endcode
+ *
+ * configGENERATE_RUN_TIME_STATS, configUSE_STATS_FORMATTING_FUNCTIONS and
+ * configUSE_TRACE_FACILITY must all be defined as 1 for this function to be
+ * available.
+ *
+ * Generates the same table as vTaskGetRunTimeStatistics(), but passes each
+ * line to pxWriter as soon as it has been formatted instead of writing it into
+ * a buffer.  No heap is used and snprintf() is not called.  The same
+ * restrictions on pxWriter apply as for vTaskListTasksStream().
+ *
+ * @param pxWriter The function called with each formatted line.
+ *
+ * @param pvContext Passed unchanged to every call to pxWriter.
+ *
+ * \defgroup vTaskGetRunTimeStatisticsStream vTaskGetRunTimeStatisticsStream
+ * \ingroup TaskUtils
+ */
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+    void vTaskGetRunTimeStatisticsStream( TaskStatsWriterFunction_t pxWriter,
+                                          void * pvContext ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2514,6 +4401,293 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
     configRUN_TIME_COUNTER_TYPE ulTaskGetIdleRunTimePercent( void ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskGetCoreLoad( BaseType_t xCoreID, UBaseType_t * puxLoad );
+ * configRUN_TIME_COUNTER_TYPE ulTaskGetCoreIdleRunTimeCounter( BaseType_t xCoreID );
+ * @endcode
+ *
+ * configUSE_CORE_LOAD_STATS must be defined as 1 for these functions to be
+ * available.
+ *
+ * Each core's idle time is the run time, as measured by the run time stats
+ * clock, of the idle tasks that ran on it.  With more than one core this
+ * includes the passive idle tasks.  Interrupts taken while an idle task runs
+ * count as idle time.
+ *
+ * xTaskGetCoreLoad() sets *puxLoad to the percentage of the last
+ * configCORE_LOAD_WINDOW run time stats clock counts that core xCoreID spent
+ * running tasks other than the idle tasks.  The window slides: the load of
+ * the current, partly complete, window is combined with that of the previous
+ * window in proportion to how much of it is still inside the sliding window.
+ * Until the first window is complete the load is that since the scheduler
+ * started.
+ *
+ * ulTaskGetCoreIdleRunTimeCounter() returns the total idle time of core
+ * xCoreID since the scheduler started.
+ *
+ * @param xCoreID The core to query, from 0 to configNUMBER_OF_CORES - 1.
+ *
+ * @param puxLoad Used to return the load of the core, from 0 to 100.
+ *
+ * @return xTaskGetCoreLoad() returns pdFAIL if xCoreID is not a valid core or
+ * no time has passed on the run time stats clock, otherwise pdPASS.
+ * ulTaskGetCoreIdleRunTimeCounter() returns 0 if xCoreID is not a valid core.
+ *
+ * \defgroup xTaskGetCoreLoad xTaskGetCoreLoad
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_CORE_LOAD_STATS == 1 )
+    BaseType_t xTaskGetCoreLoad( BaseType_t xCoreID,
+                                 UBaseType_t * puxLoad ) PRIVILEGED_FUNCTION;
+    configRUN_TIME_COUNTER_TYPE ulTaskGetCoreIdleRunTimeCounter( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetDVFSLevel( void );
+ * @endcode
+ *
+ * configUSE_DVFS_GOVERNOR must be defined as 1 for this function to be
+ * available.
+ *
+ * @return The performance level most recently chosen by
+ * uxApplicationDVFSGovernorHook(), or 0 if the governor has not yet changed
+ * it.
+ *
+ * \defgroup uxTaskGetDVFSLevel uxTaskGetDVFSLevel
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_DVFS_GOVERNOR == 1 )
+    UBaseType_t uxTaskGetDVFSLevel( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetCriticalSectionStats( CriticalSectionStats_t * pxStats );
+ * void vTaskResetCriticalSectionStats( void );
+ * @endcode
+ *
+ * configUSE_CRITICAL_SECTION_STATS must be defined as 1 for these functions to
+ * be available.
+ *
+ * With configUSE_CRITICAL_SECTION_STATS set to 1, taskENTER_CRITICAL() and
+ * taskENTER_CRITICAL_FROM_ISR() read the run time stats clock when they start
+ * an outermost critical section, and taskEXIT_CRITICAL() and
+ * taskEXIT_CRITICAL_FROM_ISR() read it again when it ends, so the longest
+ * window the kernel or the application keeps interrupts masked is recorded
+ * along with the source file and line that started it.  The time from
+ * vTaskSuspendAll() to the matching xTaskResumeAll() is recorded separately,
+ * with the task that suspended the scheduler.  Critical sections entered by
+ * calling portENTER_CRITICAL() or portDISABLE_INTERRUPTS() directly, as some
+ * ports do in their tick interrupt, are not measured, and nor is anything
+ * before the scheduler is started.  A critical section that a task leaves by
+ * yielding, on ports that switch context inside critical sections, is measured
+ * up to the context switch.
+ *
+ * vTaskGetCriticalSectionStats() copies the longest critical section and
+ * scheduler suspension measured, over all the cores, into *pxStats.
+ *
+ * vTaskResetCriticalSectionStats() clears them, for example after start up so
+ * only the critical sections of the running system are reported.
+ *
+ * \defgroup vTaskGetCriticalSectionStats vTaskGetCriticalSectionStats
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_CRITICAL_SECTION_STATS == 1 )
+    void vTaskGetCriticalSectionStats( CriticalSectionStats_t * pxStats ) PRIVILEGED_FUNCTION;
+    void vTaskResetCriticalSectionStats( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetSwitchReasonCounts( uint32_t * pulCounts );
+ * void vTaskResetSwitchReasonCounts( void );
+ * @endcode
+ *
+ * configUSE_SWITCH_REASON_STATS must be defined as 1 for these functions to
+ * be available.
+ *
+ * With configUSE_SWITCH_REASON_STATS set to 1, vTaskSwitchContext() counts
+ * each context switch against the reason the task switched out left the
+ * Running state, both for the system and, in the ulSwitchReasonCounts member
+ * of TaskStatus_t, for the task.  A task that is no longer ready, including a
+ * task throttled for using up its budget, was switched out by blocking.
+ * Otherwise taskYIELD() and the kernel's own yields record the reason before
+ * yielding, and a switch no yield recorded a reason for was requested by an
+ * interrupt, such as by portYIELD_FROM_ISR() or the tick.  A switch requested
+ * by an interrupt is a time slice if the task switched in has the same
+ * priority as the task switched out, and an interrupt wake-up otherwise.  With
+ * more than one core, a task that readies a task that runs on another core is
+ * counted as an interrupt wake-up on that core.
+ *
+ * vTaskGetSwitchReasonCounts() copies the system wide counts, indexed by
+ * eSwitchReason, into the tskSWITCH_REASON_COUNT entries of pulCounts.
+ *
+ * vTaskResetSwitchReasonCounts() clears the system wide counts, so the counts
+ * taken over an interval show which mechanism caused the switches in it.  The
+ * counts of each task are not cleared.
+ *
+ * \defgroup vTaskGetSwitchReasonCounts vTaskGetSwitchReasonCounts
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_SWITCH_REASON_STATS == 1 )
+    void vTaskGetSwitchReasonCounts( uint32_t * pulCounts ) PRIVILEGED_FUNCTION;
+    void vTaskResetSwitchReasonCounts( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetTicklessIdleStats( TicklessIdleStats_t * pxStats );
+ * UBaseType_t uxTaskGetWakeSourceHistogram( WakeSourceCount_t * const pxHistogram, const UBaseType_t uxArraySize );
+ * void vTaskResetTicklessIdleStats( void );
+ * @endcode
+ *
+ * configUSE_WAKE_SOURCE_STATS must be defined as 1 for these functions to be
+ * available, and the port's portSUPPRESS_TICKS_AND_SLEEP() must report each
+ * sleep by calling vTaskRecordTicklessSleep(), as the GCC Cortex-M ports do.
+ *
+ * Each tickless sleep is recorded with the time it was expected to last, the
+ * time it actually lasted, and the source that woke the processor - which on
+ * Cortex-M ports is the exception number of the interrupt pending when the
+ * processor woke, with portTICK_WAKE_SOURCE (15, the SysTick) for sleeps that
+ * lasted as long as expected.  The sources that most often end sleeps early,
+ * and the ticks of sleep they cost, identify the peripherals that keep the
+ * system out of its deeper sleep states.
+ *
+ * vTaskGetTicklessIdleStats() copies the totals into *pxStats.
+ *
+ * uxTaskGetWakeSourceHistogram() copies up to uxArraySize entries of the wake
+ * source histogram, in the order the sources were first seen, into
+ * pxHistogram, and returns the number of entries copied.  The histogram holds
+ * up to configWAKE_SOURCE_HISTOGRAM_LENGTH sources.
+ *
+ * vTaskResetTicklessIdleStats() clears the totals and the histogram.
+ *
+ * Example usage:
+ * @code{c}
+ * void vReportWakeSources( void )
+ * {
+ *     WakeSourceCount_t xSources[ configWAKE_SOURCE_HISTOGRAM_LENGTH ];
+ *     UBaseType_t x, uxSources;
+ *
+ *     uxSources = uxTaskGetWakeSourceHistogram( xSources, configWAKE_SOURCE_HISTOGRAM_LENGTH );
+ *
+ *     for( x = 0; x < uxSources; x++ )
+ *     {
+ *         printf( "vector %u: %u wakes, %u ticks lost\r\n",
+ *                 ( unsigned ) xSources[ x ].ulWakeSource,
+ *                 ( unsigned ) xSources[ x ].ulWakeCount,
+ *                 ( unsigned ) xSources[ x ].ullTicksLost );
+ *     }
+ * }
+ * @endcode
+ *
+ * \defgroup vTaskGetTicklessIdleStats vTaskGetTicklessIdleStats
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_WAKE_SOURCE_STATS == 1 )
+    void vTaskGetTicklessIdleStats( TicklessIdleStats_t * pxStats ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxTaskGetWakeSourceHistogram( WakeSourceCount_t * const pxHistogram,
+                                              const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+    void vTaskResetTicklessIdleStats( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * configRUN_TIME_COUNTER_TYPE ulTaskGetISRRunTimeCounter( void );
+ * configRUN_TIME_COUNTER_TYPE ulTaskGetInterruptRunTimeCounter( UBaseType_t uxInterruptNumber, uint32_t * pulEntries );
+ * configRUN_TIME_COUNTER_TYPE ulTaskGetMaxISRToTaskLatency( void );
+ * @endcode
+ *
+ * configUSE_ISR_RUN_TIME_STATS must be defined as 1 for these functions to be
+ * available.
+ *
+ * With configUSE_ISR_RUN_TIME_STATS set to 1 the time, as measured by the run
+ * time stats clock, spent in interrupt service routines that call
+ * traceISR_ENTER() on entry is accounted to the interrupts rather than to the
+ * tasks they interrupted.  The ports call traceISR_ENTER() in their own
+ * interrupt handlers, and an application ISR can call it as its first
+ * statement.  portYIELD_FROM_ISR() calls traceISR_EXIT() or
+ * traceISR_EXIT_TO_SCHEDULER(), so an ISR that does not end with
+ * portYIELD_FROM_ISR() must call traceISR_EXIT() before it returns.  Time
+ * spent in a nested interrupt is only accounted to the nested interrupt.
+ * Only interrupts at or below configMAX_SYSCALL_INTERRUPT_PRIORITY may be
+ * measured.
+ *
+ * ulTaskGetISRRunTimeCounter() returns the total time spent in measured
+ * interrupts.
+ *
+ * ulTaskGetInterruptRunTimeCounter() returns the time spent in the interrupt
+ * with the port specific number uxInterruptNumber, as returned by
+ * portGET_INTERRUPT_NUMBER(), and sets *pulEntries, if pulEntries is not NULL,
+ * to the number of times the interrupt was entered.  Only interrupts numbered
+ * below configISR_RUN_TIME_STATS_VECTORS are recorded individually.
+ *
+ * ulTaskGetMaxISRToTaskLatency() returns the longest time from entry to an
+ * interrupt that requested a context switch, by exiting with
+ * traceISR_EXIT_TO_SCHEDULER(), to the context switch taking place.
+ *
+ * With more than one core, the times are the sums, or for the latency the
+ * maximum, over all the cores.
+ *
+ * \defgroup ulTaskGetISRRunTimeCounter ulTaskGetISRRunTimeCounter
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_ISR_RUN_TIME_STATS == 1 )
+    configRUN_TIME_COUNTER_TYPE ulTaskGetISRRunTimeCounter( void ) PRIVILEGED_FUNCTION;
+    configRUN_TIME_COUNTER_TYPE ulTaskGetInterruptRunTimeCounter( UBaseType_t uxInterruptNumber,
+                                                                  uint32_t * pulEntries ) PRIVILEGED_FUNCTION;
+    configRUN_TIME_COUNTER_TYPE ulTaskGetMaxISRToTaskLatency( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskGetMessageTag( MessageTag_t * pxTag );
+ * void vTaskClearMessageTag( void );
+ * void vTaskGetNotifyLatencyHistogram( TaskHandle_t xTask, IPCLatencyHistogram_t * pxHistogram );
+ * @endcode
+ *
+ * configUSE_IPC_LATENCY_TRACING must be defined as 1 for these functions to be
+ * available.
+ *
+ * With configUSE_IPC_LATENCY_TRACING set to 1 each message sent through a
+ * queue, a message buffer or a task notification carries a hidden tag.  A task
+ * that receives a tagged message keeps its tag, and the messages the task
+ * sends afterwards carry the same tag, so the latency recorded when each
+ * message is received is measured from the event that started the chain.  A
+ * message sent from an interrupt, or by a task that holds no tag, starts a new
+ * chain.  See MessageTag_t.
+ *
+ * xTaskGetMessageTag() sets *pxTag to the tag held by the calling task, and
+ * returns pdTRUE if the task holds a tag or pdFALSE if it does not.
+ *
+ * vTaskClearMessageTag() clears the tag held by the calling task, so the next
+ * message it sends starts a new chain.  A task that handles unrelated events
+ * in turn should call it when it finishes handling each event.
+ *
+ * vTaskGetNotifyLatencyHistogram() sets *pxHistogram to the latencies of the
+ * tagged notifications taken by the task xTask, or by the calling task if
+ * xTask is NULL.  A task holds the tag of only the last notification sent to
+ * it, whatever the notification index.
+ *
+ * \defgroup xTaskGetMessageTag xTaskGetMessageTag
+ * \ingroup TaskUtils
+ */
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+    BaseType_t xTaskGetMessageTag( MessageTag_t * pxTag ) PRIVILEGED_FUNCTION;
+    void vTaskClearMessageTag( void ) PRIVILEGED_FUNCTION;
+    void vTaskGetNotifyLatencyHistogram( TaskHandle_t xTask,
+                                         IPCLatencyHistogram_t * pxHistogram ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -2886,47 +5060,198 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify,
  * the effect of resetting the task's notification value to 0.  Setting
  * ulBitsToClearOnEntry to 0 will leave the task's notification value unchanged.
  *
- * @param ulBitsToClearOnExit If a notification is pending or received before
- * the calling task exits the xTaskNotifyWait() function then the task's
- * notification value (see the xTaskNotify() API function) is passed out using
- * the pulNotificationValue parameter.  Then any bits that are set in
- * ulBitsToClearOnExit will be cleared in the task's notification value (note
- * *pulNotificationValue is set before any bits are cleared).  Setting
- * ulBitsToClearOnExit to ULONG_MAX (if limits.h is included) or 0xffffffffUL
- * (if limits.h is not included) will have the effect of resetting the task's
- * notification value to 0 before the function exits.  Setting
- * ulBitsToClearOnExit to 0 will leave the task's notification value unchanged
- * when the function exits (in which case the value passed out in
- * pulNotificationValue will match the task's notification value).
+ * @param ulBitsToClearOnExit If a notification is pending or received before
+ * the calling task exits the xTaskNotifyWait() function then the task's
+ * notification value (see the xTaskNotify() API function) is passed out using
+ * the pulNotificationValue parameter.  Then any bits that are set in
+ * ulBitsToClearOnExit will be cleared in the task's notification value (note
+ * *pulNotificationValue is set before any bits are cleared).  Setting
+ * ulBitsToClearOnExit to ULONG_MAX (if limits.h is included) or 0xffffffffUL
+ * (if limits.h is not included) will have the effect of resetting the task's
+ * notification value to 0 before the function exits.  Setting
+ * ulBitsToClearOnExit to 0 will leave the task's notification value unchanged
+ * when the function exits (in which case the value passed out in
+ * pulNotificationValue will match the task's notification value).
+ *
+ * @param pulNotificationValue Used to pass the task's notification value out
+ * of the function.  Note the value passed out will not be effected by the
+ * clearing of any bits caused by ulBitsToClearOnExit being non-zero.
+ *
+ * @param xTicksToWait The maximum amount of time that the task should wait in
+ * the Blocked state for a notification to be received, should a notification
+ * not already be pending when xTaskNotifyWait() was called.  The task
+ * will not consume any processing time while it is in the Blocked state.  This
+ * is specified in kernel ticks, the macro pdMS_TO_TICKS( value_in_ms ) can be
+ * used to convert a time specified in milliseconds to a time specified in
+ * ticks.
+ *
+ * @return If a notification was received (including notifications that were
+ * already pending when xTaskNotifyWait was called) then pdPASS is
+ * returned.  Otherwise pdFAIL is returned.
+ *
+ * \defgroup xTaskNotifyWaitIndexed xTaskNotifyWaitIndexed
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn,
+                                   uint32_t ulBitsToClearOnEntry,
+                                   uint32_t ulBitsToClearOnExit,
+                                   uint32_t * pulNotificationValue,
+                                   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyWait( ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) \
+    xTaskGenericNotifyWait( tskDEFAULT_INDEX_TO_NOTIFY, ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
+#define xTaskNotifyWaitIndexed( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) \
+    xTaskGenericNotifyWait( ( uxIndexToWaitOn ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskNotifyWaitAnyIndexed( UBaseType_t uxIndexMask, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, UBaseType_t *puxIndexNotified, uint32_t *pulNotificationValue, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Waits for a direct to task notification to be pending at any one of a set of
+ * indexes within the calling task's array of direct to task notifications.
+ * A task that serves several notification sources can use a different index
+ * for each source and block on all of them at once, rather than using a queue
+ * set.
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * The task is unblocked by a notification sent to any index in uxIndexMask.
+ * If notifications are pending at more than one of the indexes then the
+ * lowest index is returned, and the notifications at the other indexes remain
+ * pending so are returned by later calls.
+ *
+ * @param uxIndexMask A bit mask of the indexes to wait on, with bit n set to
+ * wait on index n.  At least one bit must be set, and bits at or above
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES must be clear.
+ *
+ * @param ulBitsToClearOnEntry Bits that are set in ulBitsToClearOnEntry are
+ * cleared in the notification value of each index in uxIndexMask before the
+ * calling task blocks.  The values are not changed if a notification is
+ * already pending.
+ *
+ * @param ulBitsToClearOnExit Bits that are set in ulBitsToClearOnExit are
+ * cleared in the notification value of the index returned in
+ * *puxIndexNotified, after the value has been passed out in
+ * *pulNotificationValue.
+ *
+ * @param puxIndexNotified Used to pass out the index at which the notification
+ * was received.  Can be NULL.  Not written if no notification was received.
+ *
+ * @param pulNotificationValue Used to pass out the notification value of the
+ * index at which the notification was received.  Can be NULL.  Not written if
+ * no notification was received.
+ *
+ * @param xTicksToWait The maximum amount of time that the task should wait in
+ * the Blocked state for a notification to be received, should no notification
+ * already be pending at any of the indexes.
+ *
+ * @return pdPASS if a notification was received at one of the indexes
+ * (including notifications that were already pending), otherwise pdFAIL.
+ *
+ * \defgroup xTaskNotifyWaitAnyIndexed xTaskNotifyWaitAnyIndexed
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskNotifyWaitAnyIndexed( UBaseType_t uxIndexMask,
+                                      uint32_t ulBitsToClearOnEntry,
+                                      uint32_t ulBitsToClearOnExit,
+                                      UBaseType_t * puxIndexNotified,
+                                      uint32_t * pulNotificationValue,
+                                      TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskNotifySendMessage( TaskHandle_t xTaskToNotify, void *pvMessage );
+ * BaseType_t xTaskNotifySendMessageFromISR( TaskHandle_t xTaskToNotify, void *pvMessage, BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Sends a pointer sized message to a task's notification mailbox.  Each task
+ * has a mailbox that holds up to configTASK_NOTIFY_MAILBOX_DEPTH messages, which
+ * the task receives in the order they were sent by calling
+ * xTaskNotifyReceiveMessage().  As with other direct to task notifications
+ * the message is written straight into the receiving task's TCB, so a mailbox
+ * can replace a queue that only ever has one reader at a fraction of the cost.
+ *
+ * configTASK_NOTIFY_MAILBOX_DEPTH must be set to a non-zero value in
+ * FreeRTOSConfig.h for these functions to be available.
+ *
+ * The messages held are counted by the notification value at index
+ * configTASK_NOTIFY_MAILBOX_INDEX of the task's notification array, so that
+ * index must not be used for other notifications.
+ *
+ * Like xTaskNotify(), sending a message never blocks.  If the mailbox is full
+ * the message is not sent.
+ *
+ * @param xTaskToNotify The handle of the task the message is sent to.
+ *
+ * @param pvMessage The message.  Only the pointer is copied, not the data it
+ * points to.
+ *
+ * @param pxHigherPriorityTaskWoken xTaskNotifySendMessageFromISR() sets
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending the message caused the
+ * receiving task to leave the Blocked state, and the receiving task has a
+ * priority above that of the currently running task.  If it is set to pdTRUE a
+ * context switch should be requested before the interrupt is exited.
+ *
+ * @return pdPASS if the message was placed in the mailbox, or pdFAIL if the
+ * mailbox was full.
+ *
+ * \defgroup xTaskNotifySendMessage xTaskNotifySendMessage
+ * \ingroup TaskNotifications
+ */
+#if ( configTASK_NOTIFY_MAILBOX_DEPTH > 0 )
+    BaseType_t xTaskNotifySendMessage( TaskHandle_t xTaskToNotify,
+                                       void * pvMessage ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskNotifySendMessageFromISR( TaskHandle_t xTaskToNotify,
+                                              void * pvMessage,
+                                              BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskNotifyReceiveMessage( void **ppvMessage, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Receives the oldest message from the calling task's notification mailbox,
+ * optionally blocking until a message is sent.  See xTaskNotifySendMessage().
  *
- * @param pulNotificationValue Used to pass the task's notification value out
- * of the function.  Note the value passed out will not be effected by the
- * clearing of any bits caused by ulBitsToClearOnExit being non-zero.
+ * configTASK_NOTIFY_MAILBOX_DEPTH must be set to a non-zero value in
+ * FreeRTOSConfig.h for this function to be available.
+ *
+ * @param ppvMessage Used to pass out the message.  Not written if no message
+ * was received.
  *
  * @param xTicksToWait The maximum amount of time that the task should wait in
- * the Blocked state for a notification to be received, should a notification
- * not already be pending when xTaskNotifyWait() was called.  The task
- * will not consume any processing time while it is in the Blocked state.  This
- * is specified in kernel ticks, the macro pdMS_TO_TICKS( value_in_ms ) can be
- * used to convert a time specified in milliseconds to a time specified in
- * ticks.
+ * the Blocked state for a message, should the mailbox be empty.
  *
- * @return If a notification was received (including notifications that were
- * already pending when xTaskNotifyWait was called) then pdPASS is
- * returned.  Otherwise pdFAIL is returned.
+ * @return pdPASS if a message was received, otherwise pdFAIL.
  *
- * \defgroup xTaskNotifyWaitIndexed xTaskNotifyWaitIndexed
+ * Example usage:
+ * @code{c}
+ * void vDriverTask( void *pvParameters )
+ * {
+ * Request_t *pxRequest;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xTaskNotifyReceiveMessage( ( void ** ) &pxRequest, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          prvProcessRequest( pxRequest );
+ *      }
+ *  }
+ * }
+ * @endcode
+ *
+ * \defgroup xTaskNotifyReceiveMessage xTaskNotifyReceiveMessage
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn,
-                                   uint32_t ulBitsToClearOnEntry,
-                                   uint32_t ulBitsToClearOnExit,
-                                   uint32_t * pulNotificationValue,
-                                   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
-#define xTaskNotifyWait( ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) \
-    xTaskGenericNotifyWait( tskDEFAULT_INDEX_TO_NOTIFY, ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
-#define xTaskNotifyWaitIndexed( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) \
-    xTaskGenericNotifyWait( ( uxIndexToWaitOn ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
+#if ( configTASK_NOTIFY_MAILBOX_DEPTH > 0 )
+    BaseType_t xTaskNotifyReceiveMessage( void ** ppvMessage,
+                                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
 
 /**
  * task. h
@@ -3328,6 +5653,200 @@ uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask,
 #define ulTaskNotifyValueClearIndexed( xTask, uxIndexToClear, ulBitsToClear ) \
     ulTaskGenericNotifyValueClear( ( xTask ), ( uxIndexToClear ), ( ulBitsToClear ) )
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupInit( TaskGroup_t * pxGroup );
+ * @endcode
+ *
+ * Initialise an empty task group.  configUSE_TASK_GROUPS must be defined as 1
+ * for this function to be available.
+ *
+ * @param pxGroup The task group being initialised.
+ *
+ * \defgroup vTaskGroupInit vTaskGroupInit
+ * \ingroup TaskNotifications
+ */
+#if ( configUSE_TASK_GROUPS == 1 )
+    void vTaskGroupInit( TaskGroup_t * pxGroup ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskGroupAddTask( TaskGroup_t * pxGroup, TaskHandle_t xTask );
+ * @endcode
+ *
+ * Add a task to a task group.  configUSE_TASK_GROUPS must be defined as 1 for
+ * this function to be available.
+ *
+ * @param pxGroup The task group the task is being added to.
+ *
+ * @param xTask The handle of the task being added.  Passing NULL adds the
+ * calling task.
+ *
+ * @return pdPASS if the task was added, or pdFAIL if the task already belongs
+ * to a task group.
+ *
+ * \defgroup xTaskGroupAddTask xTaskGroupAddTask
+ * \ingroup TaskNotifications
+ */
+#if ( configUSE_TASK_GROUPS == 1 )
+    BaseType_t xTaskGroupAddTask( TaskGroup_t * pxGroup,
+                                  TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGroupRemoveTask( TaskHandle_t xTask );
+ * @endcode
+ *
+ * Remove a task from the task group it belongs to, if any.
+ * configUSE_TASK_GROUPS must be defined as 1 for this function to be
+ * available.
+ *
+ * @param xTask The handle of the task being removed.  Passing NULL removes the
+ * calling task.
+ *
+ * \defgroup vTaskGroupRemoveTask vTaskGroupRemoveTask
+ * \ingroup TaskNotifications
+ */
+#if ( configUSE_TASK_GROUPS == 1 )
+    void vTaskGroupRemoveTask( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskGroupNotifyIndexed( TaskGroup_t * pxGroup, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction );
+ *
+ * BaseType_t xTaskGroupNotify( TaskGroup_t * pxGroup, uint32_t ulValue, eNotifyAction eAction );
+ * @endcode
+ *
+ * Send the same notification to every task in a task group, as though
+ * xTaskNotifyIndexed() had been called for each, but in a single critical
+ * section and with a single decision on whether to yield once every member has
+ * been notified.  The critical section lasts in proportion to the number of
+ * tasks in the group.  configUSE_TASK_GROUPS must be defined as 1 for these
+ * functions to be available.
+ *
+ * Example usage:
+ * @code{c}
+ * TaskGroup_t xWorkers;
+ *
+ * void vStartWorkers( void )
+ * {
+ *     TaskHandle_t xWorker;
+ *     UBaseType_t x;
+ *
+ *     vTaskGroupInit( &xWorkers );
+ *
+ *     for( x = 0; x < 16; x++ )
+ *     {
+ *         xTaskCreate( vWorker, "Worker", configMINIMAL_STACK_SIZE, NULL, 2, &xWorker );
+ *         xTaskGroupAddTask( &xWorkers, xWorker );
+ *     }
+ * }
+ *
+ * void vStartPhase( uint32_t ulPhaseBit )
+ * {
+ *     // Every worker blocked in xTaskNotifyWait() is unblocked.
+ *     xTaskGroupNotify( &xWorkers, ulPhaseBit, eSetBits );
+ * }
+ * @endcode
+ *
+ * @param pxGroup The task group being notified.
+ *
+ * @param uxIndexToNotify The index within each member's array of notification
+ * values to which the notification is sent.  xTaskGroupNotify() always sends
+ * to index 0.
+ *
+ * @param ulValue The value used by eAction, as for xTaskNotifyIndexed().
+ *
+ * @param eAction How each member's notification value is updated, as for
+ * xTaskNotifyIndexed().
+ *
+ * @return pdFAIL if eAction is eSetValueWithoutOverwrite and the value could not
+ * be written to at least one member because that member already had a
+ * notification pending, otherwise pdPASS.  Every member is notified either
+ * way.
+ *
+ * \defgroup xTaskGroupNotifyIndexed xTaskGroupNotifyIndexed
+ * \ingroup TaskNotifications
+ */
+#if ( configUSE_TASK_GROUPS == 1 )
+    BaseType_t xTaskGroupGenericNotify( TaskGroup_t * pxGroup,
+                                        UBaseType_t uxIndexToNotify,
+                                        uint32_t ulValue,
+                                        eNotifyAction eAction ) PRIVILEGED_FUNCTION;
+    #define xTaskGroupNotify( pxGroup, ulValue, eAction ) \
+    xTaskGroupGenericNotify( ( pxGroup ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ) )
+    #define xTaskGroupNotifyIndexed( pxGroup, uxIndexToNotify, ulValue, eAction ) \
+    xTaskGroupGenericNotify( ( pxGroup ), ( uxIndexToNotify ), ( ulValue ), ( eAction ) )
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskWaitOnAddress( volatile uint32_t * pulAddress, uint32_t ulExpectedValue, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Blocks the calling task on a 32-bit word in application memory, but only if
+ * the word still holds ulExpectedValue.  The check and the block are atomic
+ * with respect to xTaskWakeAddress(), so a task that changes the word and then
+ * calls xTaskWakeAddress() cannot be missed.  Together the two functions let
+ * application locks and lock-free structures spin on a word in user code and
+ * only enter the kernel when they have to wait.
+ *
+ * configUSE_TASK_WAIT_ON_ADDRESS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param pulAddress The word to wait on.
+ *
+ * @param ulExpectedValue The task only blocks if *pulAddress equals this
+ * value.
+ *
+ * @param xTicksToWait The maximum time to wait for xTaskWakeAddress() to be
+ * called for pulAddress.
+ *
+ * @return pdPASS if the task was woken by xTaskWakeAddress().  pdFAIL if the
+ * word did not hold ulExpectedValue, if xTicksToWait was 0, or if the wait
+ * timed out.  The caller must re-read the word in either case, as it may have
+ * changed again.
+ *
+ * \defgroup xTaskWaitOnAddress xTaskWaitOnAddress
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskWaitOnAddress( volatile uint32_t * pulAddress,
+                               uint32_t ulExpectedValue,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskWakeAddress( volatile uint32_t * pulAddress, UBaseType_t uxTasksToWake );
+ * @endcode
+ *
+ * Wakes up to uxTasksToWake of the tasks blocked in xTaskWaitOnAddress() on
+ * pulAddress, highest priority first.  Must not be called from an interrupt.
+ *
+ * configUSE_TASK_WAIT_ON_ADDRESS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param pulAddress The word the tasks to wake are waiting on.
+ *
+ * @param uxTasksToWake The maximum number of tasks to wake.  Pass
+ * ( UBaseType_t ) ~0U to wake them all.
+ *
+ * @return The number of tasks woken.
+ *
+ * \defgroup xTaskWakeAddress xTaskWakeAddress
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskWakeAddress( volatile uint32_t * pulAddress,
+                             UBaseType_t uxTasksToWake ) PRIVILEGED_FUNCTION;
+
 /**
  * task.h
  * @code{c}
@@ -3458,6 +5977,58 @@ BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
  */
 BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp ) PRIVILEGED_FUNCTION;
 
+/**
+ * task.h
+ * @code{c}
+ * BaseType_t xTaskProcessElapsedTicks( TickType_t xElapsedTicks );
+ * @endcode
+ *
+ * Only available when configUSE_TICKLESS_KERNEL is set to 1.
+ *
+ * Called by the one-shot timer interrupt of a port that implements
+ * configUSE_TICKLESS_KERNEL, in place of xTaskIncrementTick(), and with
+ * interrupts masked in the same way.  The tick count is stepped over the
+ * ticks at which nothing happens, as vTaskStepTick() does, and each tick at
+ * which a task unblocks is processed by xTaskIncrementTick().  The timer is
+ * then programmed for the next time the kernel has work to do.  The tick hook
+ * is only called for the ticks that are processed.
+ *
+ * @param xElapsedTicks The number of ticks that have passed since the
+ * previous call.
+ *
+ * @return pdTRUE if a context switch is required, otherwise pdFALSE.
+ *
+ * \defgroup xTaskProcessElapsedTicks xTaskProcessElapsedTicks
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TICKLESS_KERNEL == 1 )
+    BaseType_t xTaskProcessElapsedTicks( TickType_t xElapsedTicks ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task.h
+ * @code{c}
+ * BaseType_t xTaskProcessHrAlarmFromISR( void );
+ * @endcode
+ *
+ * Only available when configUSE_HR_TIMEOUTS is set to 1.
+ *
+ * Called by the high resolution alarm interrupt of a port that implements
+ * configUSE_HR_TIMEOUTS.  Unblocks the tasks whose microsecond block times
+ * have expired, then sets the alarm for the next one to expire.  If the
+ * scheduler is suspended the work is done when it is resumed.
+ *
+ * @return pdTRUE if a task with a priority higher than the running task was
+ * unblocked, in which case a context switch should be requested before the
+ * interrupt exits.  Otherwise pdFALSE.
+ *
+ * \defgroup xTaskProcessHrAlarmFromISR xTaskProcessHrAlarmFromISR
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_HR_TIMEOUTS == 1 )
+    BaseType_t xTaskProcessHrAlarmFromISR( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task.h
  * @code{c}
@@ -3478,7 +6049,15 @@ void vTaskResetState( void ) PRIVILEGED_FUNCTION;
 *----------------------------------------------------------*/
 
 #if ( configNUMBER_OF_CORES == 1 )
-    #define taskYIELD_WITHIN_API()    portYIELD_WITHIN_API()
+    #if ( configUSE_SWITCH_REASON_STATS == 1 )
+        #define taskYIELD_WITHIN_API()               \
+    do {                                         \
+        vTaskSetSwitchReason( eSwitchTaskWake ); \
+        portYIELD_WITHIN_API();                  \
+    } while( 0 )
+    #else
+        #define taskYIELD_WITHIN_API()    portYIELD_WITHIN_API()
+    #endif
 #else /* #if ( configNUMBER_OF_CORES == 1 ) */
     #define taskYIELD_WITHIN_API()    vTaskYieldWithinAPI()
 #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
@@ -3580,6 +6159,66 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEG
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
+ *
+ * THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.
+ *
+ * A version of vTaskRemoveFromUnorderedEventList() that can be called from an
+ * interrupt, or with the scheduler running, by an event group that knows no
+ * task is accessing pxEventListItem's event list.  If the scheduler is
+ * suspended the task is held on the pending ready list.
+ *
+ * @return pdTRUE if the task being removed has a higher priority than the task
+ * that was interrupted, otherwise pdFALSE.
+ */
+#if ( configUSE_EVENT_GROUP_DIRECT_SET_FROM_ISR == 1 )
+    BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem,
+                                                         const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE HEAP IMPLEMENTATION.
+ *
+ * Take a block of size class uxSizeClass from, or add one to, the allocation
+ * cache of the calling task.  pvTaskTakeCachedAllocation() returns NULL if the
+ * cache holds no block of the class, and xTaskCacheAllocation() returns pdFALSE
+ * if the class is already full.  Both do nothing before the scheduler starts.
+ * Blocks still in a task's cache when the task is deleted are passed to
+ * vPortFreeCachedAllocation().
+ */
+#if ( configUSE_TASK_ALLOCATION_CACHE == 1 )
+    void * pvTaskTakeCachedAllocation( UBaseType_t uxSizeClass ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskCacheAllocation( UBaseType_t uxSizeClass,
+                                     void * pv ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE FOR USE BY
+ * THE HEAP IMPLEMENTATION WHEN configUSE_TASK_HEAP_QUOTAS IS 1, AND MUST BE
+ * CALLED WITH THE HEAP LOCKED.
+ *
+ * pvTaskHeapOwner() returns the task a new block is charged to, which is NULL
+ * before the scheduler starts.  xTaskHeapQuotaAllows() returns pdFALSE, after
+ * calling the quota exceeded hook if there is one, if charging xBytes more to
+ * pvOwner would take it over its quota.  vTaskHeapCharge() and
+ * vTaskHeapRefund() add xBytes to and take xBytes from the heap usage of
+ * pvOwner, and do nothing if pvOwner is NULL.  Before a task's TCB is freed
+ * it passes itself to vPortHeapDisownTask() if any blocks are still charged
+ * to it.
+ */
+#if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+    void * pvTaskHeapOwner( void ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskHeapQuotaAllows( void * pvOwner,
+                                     size_t xBytes ) PRIVILEGED_FUNCTION;
+    void vTaskHeapCharge( void * pvOwner,
+                          size_t xBytes ) PRIVILEGED_FUNCTION;
+    void vTaskHeapRefund( void * pvOwner,
+                          size_t xBytes ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -3594,12 +6233,79 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
     portDONT_DISCARD void vTaskSwitchContext( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
 #endif
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE CALLED BY
+ * THE taskENTER_CRITICAL() AND taskEXIT_CRITICAL() MACROS, AND THEIR FROM_ISR
+ * VERSIONS, WHEN configUSE_CRITICAL_SECTION_STATS IS 1.
+ *
+ * Start and end the measurement of a critical section.  The critical section
+ * has been entered, and not yet exited, when they are called.
+ * uxTaskCriticalStatsEnterFromISR() returns uxSavedInterruptStatus.
+ */
+#if ( configUSE_CRITICAL_SECTION_STATS == 1 )
+    void vTaskCriticalStatsEnter( const char * pcFile,
+                                  uint32_t ulLine ) PRIVILEGED_FUNCTION;
+    UBaseType_t uxTaskCriticalStatsEnterFromISR( UBaseType_t uxSavedInterruptStatus,
+                                                 const char * pcFile,
+                                                 uint32_t ulLine ) PRIVILEGED_FUNCTION;
+    void vTaskCriticalStatsExit( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE CALLED BY
+ * THE traceISR_ENTER(), traceISR_EXIT() AND traceISR_EXIT_TO_SCHEDULER()
+ * MACROS WHEN configUSE_ISR_RUN_TIME_STATS IS 1.
+ *
+ * Start and stop charging run time to the interrupt numbered
+ * uxInterruptNumber.  xSwitchRequired is pdTRUE if the interrupt is requesting
+ * a context switch.
+ */
+#if ( configUSE_ISR_RUN_TIME_STATS == 1 )
+    void vTaskISREnter( UBaseType_t uxInterruptNumber ) PRIVILEGED_FUNCTION;
+    void vTaskISRExit( UBaseType_t uxInterruptNumber,
+                       BaseType_t xSwitchRequired ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE QUEUE AND STREAM BUFFER MODULES WHEN configUSE_IPC_LATENCY_TRACING IS 1.
+ *
+ * vTaskStampMessageTag() sets *pxTag to the tag of a message being sent: the
+ * calling task's tag, or a new tag if the task holds none or xFromISR is
+ * pdTRUE.  vTaskReceiveMessageTag() adds the latency of a received message
+ * tagged *pxTag to *pxHistogram and, if xFromISR is pdFALSE, gives the tag to
+ * the calling task.  The caller must prevent concurrent access to
+ * *pxHistogram.
+ */
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+    void vTaskStampMessageTag( MessageTag_t * const pxTag,
+                               const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+    void vTaskReceiveMessageTag( const MessageTag_t * const pxTag,
+                                 IPCLatencyHistogram_t * const pxHistogram,
+                                 const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
  * THE EVENT BITS MODULE.
  */
 TickType_t uxTaskResetEventItemValue( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE EVENT BITS MODULE WHEN configUSE_64_BIT_EVENT_GROUPS IS 1.
+ *
+ * Set and get the event bits stored in the TCB of xTask, or of the calling
+ * task if xTask is NULL, in place of the task's event list item value, which
+ * then holds only the control bits.  Called with the event group's list of
+ * waiting tasks locked.
+ */
+#if ( configUSE_64_BIT_EVENT_GROUPS == 1 )
+    void vTaskSetEventGroupBits( TaskHandle_t xTask,
+                                 uint64_t ullBits ) PRIVILEGED_FUNCTION;
+    uint64_t ullTaskGetEventGroupBits( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Return the handle of the calling task.
  */
@@ -3645,6 +6351,26 @@ BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGE
 void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
                                           UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
 
+/*
+ * Raises the priority of the calling task to uxCeilingPriority, if it is not
+ * already that high, when it takes a mutex created with a priority ceiling.
+ * The priority is returned to the base priority by xTaskPriorityDisinherit()
+ * when the task no longer holds any mutexes.
+ */
+#if ( configUSE_MUTEX_PRIORITY_CEILING == 1 )
+    void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Records where to find the holder of the mutex the
+ * calling task is about to block on, so xTaskPriorityInherit() can pass an
+ * inherited priority along chains of blocked mutex holders.  Called with NULL
+ * once the task is no longer blocked on the mutex.
+ */
+#if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+    void vTaskInternalSetBlockedOnMutex( TaskHandle_t volatile * pxMutexHolder ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Get the uxTaskNumber assigned to the task referenced by the xTask parameter.
  */
@@ -3691,18 +6417,78 @@ void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
     eSleepModeStatus eTaskConfirmSleepModeStatus( void ) PRIVILEGED_FUNCTION;
 #endif
 
+/*
+ * Only available when configUSE_WAKE_SOURCE_STATS is set to 1.
+ * Called by the port's portSUPPRESS_TICKS_AND_SLEEP() implementation, with
+ * interrupts disabled, after each sleep it enters.  xExpectedIdleTime is the
+ * length the sleep was expected to last, after any limit imposed by the port,
+ * xTicksStepped is the value the port passes to vTaskStepTick(), and
+ * ulWakeSource identifies what ended the sleep.  ulWakeSource must be
+ * portTICK_WAKE_SOURCE if the tick interrupt ended it.  Sleeps the port
+ * abandons because eTaskConfirmSleepModeStatus() returned eAbortSleep are not
+ * reported.
+ */
+#if ( configUSE_WAKE_SOURCE_STATS == 1 )
+    void vTaskRecordTicklessSleep( TickType_t xExpectedIdleTime,
+                                   TickType_t xTicksStepped,
+                                   uint32_t ulWakeSource ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * For internal use only.  Increment the mutex held count when a mutex is
  * taken and return the handle of the task that has taken the mutex.
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Increment the mutex held count of a task that is
+ * blocked waiting for a mutex when the mutex is handed to it.
+ */
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) )
+    void vTaskInternalIncrementMutexHeldCount( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Returns pdTRUE if xTask is in the Running state on
+ * any core, without taking a critical section.  Used to decide whether to spin
+ * while waiting for a mutex held by a task running on another core.
+ */
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_MUTEXES == 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+    BaseType_t xTaskInternalIsTaskRunning( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critical
  * section.
  */
 void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Copy the xSize bytes at pvVariable to offset xOffset
+ * of pucState if xSave is pdTRUE, or from offset xOffset of pucState to
+ * pvVariable if xSave is pdFALSE.  Nothing is copied if pucState is NULL.
+ * Returns the offset of the byte after those copied.  Used by the kernel
+ * modules to save and restore their state for xTaskSaveWarmBootState().
+ */
+#if ( configUSE_WARM_BOOT == 1 )
+    size_t xTaskWarmBootCopy( uint8_t * pucState,
+                              size_t xOffset,
+                              void * pvVariable,
+                              size_t xSize,
+                              BaseType_t xSave ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Arm a high resolution timeout that expires
+ * ulMicroseconds from now.  If the calling task is blocked when it expires it
+ * is unblocked as if by xTaskAbortDelay(), and xTaskCheckForTimeOut() reports a
+ * timeout from then on, until vTaskClearHrTimeout() is called.
+ */
+#if ( configUSE_HR_TIMEOUTS == 1 )
+    void vTaskSetHrTimeout( uint32_t ulMicroseconds ) PRIVILEGED_FUNCTION;
+    void vTaskClearHrTimeout( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * For internal use only. Same as portYIELD_WITHIN_API() in single core FreeRTOS.
  * For SMP this is not defined by the port.
@@ -3711,6 +6497,15 @@ void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNC
     void vTaskYieldWithinAPI( void );
 #endif
 
+/*
+ * For internal use only.  Called by taskYIELD() and taskYIELD_WITHIN_API()
+ * to record why the calling task is about to yield, unless a reason is already
+ * recorded for the next context switch on the calling core.
+ */
+#if ( configUSE_SWITCH_REASON_STATS == 1 )
+    void vTaskSetSwitchReason( eSwitchReason eReason ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * This function is only intended for use when implementing a port of the scheduler
  * and is only available when portCRITICAL_NESTING_IN_TCB is set to 1 or configNUMBER_OF_CORES
@@ -3755,6 +6550,42 @@ void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNC
     void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus );
 #endif
 
+/*
+ * For internal use only.  Enter and exit a critical section that protects a
+ * single kernel object using the spinlock pointed to by pxSpinlock.  Interrupts
+ * are disabled on the calling core but the kernel TASK and ISR locks are not
+ * taken.  Only available when configUSE_GRANULAR_LOCKS is set to 1 - use the
+ * taskDATA_GROUP_ENTER_CRITICAL() and taskDATA_GROUP_EXIT_CRITICAL() macros.
+ */
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    void vTaskDataGroupEnterCritical( portSPINLOCK_TYPE * pxSpinlock );
+    void vTaskDataGroupExitCritical( portSPINLOCK_TYPE * pxSpinlock );
+#endif
+
+/*
+ * For internal use only.  Interrupt safe versions of
+ * vTaskDataGroupEnterCritical() and vTaskDataGroupExitCritical().
+ */
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    UBaseType_t uxTaskDataGroupEnterCriticalFromISR( portSPINLOCK_TYPE * pxSpinlock );
+    void vTaskDataGroupExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus,
+                                            portSPINLOCK_TYPE * pxSpinlock );
+#endif
+
+/*
+ * For internal use only.  Suspend and resume context switches on the calling
+ * core only.  Unlike vTaskSuspendAll() the kernel TASK lock is not taken, so
+ * the other cores carry on scheduling, and no mutual exclusion with the other
+ * cores is provided - the caller must use its own lock for that.  Calls can
+ * be nested, and the calling task must not block until the matching call to
+ * xTaskResumeCore().  xTaskResumeCore() returns pdTRUE if it yielded.  Only
+ * available when configUSE_CORE_LOCAL_SUSPEND is set to 1.
+ */
+#if ( configUSE_CORE_LOCAL_SUSPEND == 1 )
+    void vTaskSuspendCore( void );
+    BaseType_t xTaskResumeCore( void );
+#endif
+
 #if ( portUSING_MPU_WRAPPERS == 1 )
 
 /*
@@ -0,0 +1,307 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include task_pool.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A task pool is a fixed set of worker tasks that run jobs submitted to the
+ * pool, for use in place of a set of tasks written by the application to
+ * block on a queue of function pointers.  A submitted job is recorded in a
+ * ring of jobs owned by the pool, without copying it through a queue, and an
+ * idle worker is woken with a direct to task notification.  Jobs are started
+ * in the order they were submitted.
+ *
+ * Task pools are referenced by handles of type TaskPoolHandle_t.
+ *
+ * Set configUSE_TASK_POOLS to 1 in FreeRTOSConfig.h to include this
+ * functionality.
+ *
+ * \defgroup TaskPoolHandle_t TaskPoolHandle_t
+ * \ingroup TaskPools
+ */
+struct TaskPoolDef_t;
+typedef struct TaskPoolDef_t * TaskPoolHandle_t;
+
+/*
+ * Defines the prototype to which job functions must conform.
+ */
+typedef void (* TaskPoolFunction_t)( void * pvParameter );
+
+/**
+ * Used with vTaskPoolGetStats() to obtain the statistics of a task pool.
+ *
+ * \defgroup TaskPoolStats_t TaskPoolStats_t
+ * \ingroup TaskPools
+ */
+typedef struct xTASK_POOL_STATS
+{
+    UBaseType_t uxPendingJobs;    /**< The number of jobs submitted but not yet started. */
+    UBaseType_t uxMaxPendingJobs; /**< The largest value uxPendingJobs has had. */
+    UBaseType_t uxIdleWorkers;    /**< The number of workers waiting for a job. */
+    uint32_t ulJobsStarted;       /**< The number of jobs started since the pool was created. */
+    TickType_t xMaxLatency;       /**< The longest time, in ticks, a job waited between being submitted and being started. */
+    TickType_t xTotalLatency;     /**< The total time, in ticks, started jobs waited, from which the average can be calculated. */
+} TaskPoolStats_t;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * TaskPoolHandle_t xTaskPoolCreate( const char * const pcName,
+ *                                   UBaseType_t uxWorkerCount,
+ *                                   UBaseType_t uxMaxPendingJobs,
+ *                                   configSTACK_DEPTH_TYPE uxStackDepth,
+ *                                   UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Create a task pool and its worker tasks.  The pool, its ring of jobs and the
+ * workers are allocated from the FreeRTOS heap, and remain for the lifetime of
+ * the application.
+ *
+ * @param pcName The name given to each worker task.
+ *
+ * @param uxWorkerCount The number of worker tasks, and so the number of jobs
+ * that can run at the same time.
+ *
+ * @param uxMaxPendingJobs The number of jobs that can be submitted but not yet
+ * started at any one time.
+ *
+ * @param uxStackDepth The size of each worker's stack, in words.
+ *
+ * @param uxPriority The priority of the worker tasks.
+ *
+ * @return The handle of the new pool, or NULL if there was not enough heap to
+ * create the pool and all its workers.
+ *
+ * \defgroup xTaskPoolCreate xTaskPoolCreate
+ * \ingroup TaskPools
+ */
+TaskPoolHandle_t xTaskPoolCreate( const char * const pcName,
+                                  UBaseType_t uxWorkerCount,
+                                  UBaseType_t uxMaxPendingJobs,
+                                  configSTACK_DEPTH_TYPE uxStackDepth,
+                                  UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * BaseType_t xTaskPoolSubmit( TaskPoolHandle_t xPool,
+ *                             TaskPoolFunction_t pxFunction,
+ *                             void * pvParameter );
+ * @endcode
+ *
+ * Submit a job to a task pool.  pxFunction( pvParameter ) is run by the first
+ * worker to become free.  No job is submitted if uxMaxPendingJobs jobs are
+ * already waiting to start.
+ *
+ * @param xPool The pool the job is submitted to.
+ *
+ * @param pxFunction The function run by the job.
+ *
+ * @param pvParameter The value passed into pxFunction.
+ *
+ * @return pdPASS if the job was submitted, or pdFAIL if too many jobs were
+ * already waiting to start.
+ *
+ * \defgroup xTaskPoolSubmit xTaskPoolSubmit
+ * \ingroup TaskPools
+ */
+BaseType_t xTaskPoolSubmit( TaskPoolHandle_t xPool,
+                            TaskPoolFunction_t pxFunction,
+                            void * pvParameter ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * BaseType_t xTaskPoolSubmitFromISR( TaskPoolHandle_t xPool,
+ *                                    TaskPoolFunction_t pxFunction,
+ *                                    void * pvParameter,
+ *                                    BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xTaskPoolSubmit() that can be called from an interrupt service
+ * routine.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if submitting the job woke a
+ * worker with a priority higher than the task that was interrupted, in which
+ * case a context switch should be requested before the interrupt exits.
+ *
+ * \defgroup xTaskPoolSubmitFromISR xTaskPoolSubmitFromISR
+ * \ingroup TaskPools
+ */
+BaseType_t xTaskPoolSubmitFromISR( TaskPoolHandle_t xPool,
+                                   TaskPoolFunction_t pxFunction,
+                                   void * pvParameter,
+                                   BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * void vTaskPoolGetStats( TaskPoolHandle_t xPool, TaskPoolStats_t * pxStats );
+ * @endcode
+ *
+ * Obtain the queue depth and latency statistics of a task pool.
+ *
+ * @param xPool The pool being queried.
+ *
+ * @param pxStats The structure into which the statistics are written.
+ *
+ * \defgroup vTaskPoolGetStats vTaskPoolGetStats
+ * \ingroup TaskPools
+ */
+void vTaskPoolGetStats( TaskPoolHandle_t xPool,
+                        TaskPoolStats_t * pxStats ) PRIVILEGED_FUNCTION;
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+
+/**
+ * task_pool.h
+ * @code{c}
+ * void vTaskPoolCoreAffinitySet( TaskPoolHandle_t xPool, UBaseType_t uxCoreAffinityMask );
+ * @endcode
+ *
+ * Sets the core affinity mask of every worker of a task pool, as
+ * vTaskCoreAffinitySet() does for a single task.
+ *
+ * @param xPool The pool whose workers are being restricted.
+ *
+ * @param uxCoreAffinityMask A bitwise value that indicates the cores on which
+ * the workers can run.
+ *
+ * \defgroup vTaskPoolCoreAffinitySet vTaskPoolCoreAffinitySet
+ * \ingroup TaskPools
+ */
+    void vTaskPoolCoreAffinitySet( TaskPoolHandle_t xPool,
+                                   UBaseType_t uxCoreAffinityMask ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_PARALLEL_FOR == 1 )
+
+/*
+ * Defines the prototype to which parallel-for functions must conform.  The
+ * function processes the items from xStart up to, but not including, xEnd.
+ */
+    typedef void (* TaskParallelForFunction_t)( void * pvContext,
+                                                size_t xStart,
+                                                size_t xEnd );
+
+/**
+ * task_pool.h
+ * @code{c}
+ * BaseType_t xTaskParallelForInit( configSTACK_DEPTH_TYPE uxStackDepth,
+ *                                  UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Create the helper tasks used by vTaskParallelFor(), one fewer than the
+ * number of cores, as the task calling vTaskParallelFor() does its share of
+ * the work too.  No helpers are created in single core builds.  Must be called
+ * once before vTaskParallelFor() is used.
+ *
+ * @param uxStackDepth The size of each helper's stack, in words.
+ *
+ * @param uxPriority The priority of the helpers, which would normally be the
+ * priority of the tasks that call vTaskParallelFor().
+ *
+ * @return pdPASS if the helpers were created, otherwise pdFAIL.
+ *
+ * \defgroup xTaskParallelForInit xTaskParallelForInit
+ * \ingroup TaskPools
+ */
+    BaseType_t xTaskParallelForInit( configSTACK_DEPTH_TYPE uxStackDepth,
+                                     UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_pool.h
+ * @code{c}
+ * void vTaskParallelFor( size_t xRange,
+ *                        size_t xChunkSize,
+ *                        TaskParallelForFunction_t pxFunction,
+ *                        void * pvContext );
+ * @endcode
+ *
+ * Split the items 0 to xRange - 1 into chunks of up to xChunkSize items, and
+ * call pxFunction once for each chunk, spreading the calls across the calling
+ * task and the helper tasks so they run on all the cores at once.  Each task
+ * takes the next chunk as soon as it finishes the last, so the work stays
+ * balanced when some chunks take longer than others.  Returns once every
+ * chunk has been processed.  Parallel-for calls made from more than one task
+ * at the same time run one after the other.
+ *
+ * @param xRange The number of items to process.
+ *
+ * @param xChunkSize The largest number of items passed into one call of
+ * pxFunction.
+ *
+ * @param pxFunction The function that processes a chunk of items.
+ *
+ * @param pvContext The value passed into pxFunction.
+ *
+ * Example usage:
+ * @code{c}
+ * void vScaleBlock( void * pvContext, size_t xStart, size_t xEnd )
+ * {
+ *     int16_t * psSamples = ( int16_t * ) pvContext;
+ *
+ *     for( ; xStart < xEnd; xStart++ )
+ *     {
+ *         psSamples[ xStart ] = ( int16_t ) ( psSamples[ xStart ] / 2 );
+ *     }
+ * }
+ *
+ * // Process 1024 samples in chunks of 64.
+ * vTaskParallelFor( 1024, 64, vScaleBlock, psSamples );
+ * @endcode
+ * \defgroup vTaskParallelFor vTaskParallelFor
+ * \ingroup TaskPools
+ */
+    void vTaskParallelFor( size_t xRange,
+                           size_t xChunkSize,
+                           TaskParallelForFunction_t pxFunction,
+                           void * pvContext ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_PARALLEL_FOR */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* TASK_POOL_H */
@@ -0,0 +1,236 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include telemetry.h"
+#endif
+
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * The telemetry serialiser packs the kernel's statistics - TaskStatus_t,
+ * HeapStats_t and the IPCStatistics_t of queues and stream buffers - into a
+ * compact binary snapshot that is far smaller, and far quicker to produce,
+ * than the text tables of vTaskListTasks() and vTaskGetRunTimeStatistics().
+ * tools/telemetry/freertos_telemetry_decode.py decodes a snapshot on the host.
+ *
+ * A snapshot is a six byte header - the four bytes of telemetryMAGIC, the
+ * schema version, then a flags byte - followed by a sequence of records.  Each
+ * record is a type byte, the length of the record's payload, then the payload.
+ * Every integer, including the payload length, is an unsigned LEB128 varint,
+ * so small values take a single byte whatever the width of the type they came
+ * from.  Names are a length followed by that many bytes.  The payload of each
+ * record type is listed with its telemetryRECORD_ definition below.
+ *
+ * Fields are only ever appended to a record type within a schema version, and
+ * the decoder skips any trailing fields and any record types it does not
+ * recognise, so older decoders can read newer snapshots.  Update
+ * telemetrySCHEMA_VERSION, and the decoder, if a field is removed or changes
+ * meaning.
+ *
+ * The serialiser writes into a buffer supplied by the application and never
+ * allocates memory.  A record that does not fit is left out completely, and
+ * telemetryFLAG_TRUNCATED is set in the header.
+ *
+ * Set configUSE_TELEMETRY to 1 in FreeRTOSConfig.h, and build telemetry.c, to
+ * include this functionality.  Requires configUSE_TRACE_FACILITY to be 1.
+ * Queue and stream buffer records also require configUSE_IPC_STATISTICS to
+ * be 1.
+ */
+#define telemetryMAGIC              "FRTM"
+#define telemetrySCHEMA_VERSION     ( ( uint8_t ) 1U )
+#define telemetryHEADER_LENGTH      ( ( size_t ) 6U )
+
+/* Bits of the header's flags byte. */
+#define telemetryFLAG_TRUNCATED    ( ( uint8_t ) 0x01U ) /* At least one record did not fit in the buffer. */
+
+/* Tick count, total run time (0 unless configGENERATE_RUN_TIME_STATS is 1),
+ * number of tasks, number of cores. */
+#define telemetryRECORD_SYSTEM    ( ( uint8_t ) 1U )
+
+/* Task number, state (an eTaskState), current priority, base priority, run
+ * time counter, stack high water mark, name. */
+#define telemetryRECORD_TASK    ( ( uint8_t ) 2U )
+
+/* The seven members of HeapStats_t, in the order they are declared. */
+#define telemetryRECORD_HEAP    ( ( uint8_t ) 3U )
+
+/* Queue number, queue type, name (empty if the queue is not in the queue
+ * registry), then the nine members of IPCStatistics_t in the order they are
+ * declared. */
+#define telemetryRECORD_QUEUE    ( ( uint8_t ) 4U )
+
+/* Stream buffer number, stream buffer type, then the nine members of
+ * IPCStatistics_t in the order they are declared. */
+#define telemetryRECORD_STREAM_BUFFER    ( ( uint8_t ) 5U )
+
+/*
+ * The state of a snapshot being written.  Only access the members through the
+ * functions below.
+ */
+typedef struct xTELEMETRY_BUFFER
+{
+    uint8_t * pucBuffer;
+    size_t xBufferLength;
+    size_t xBytesWritten;
+    BaseType_t xTruncated;
+} TelemetryBuffer_t;
+
+/**
+ * telemetry.h
+ * @code{c}
+ * void vTelemetryBegin( TelemetryBuffer_t * pxTelemetry, uint8_t * pucBuffer, size_t xBufferLength );
+ * @endcode
+ *
+ * Starts a snapshot in pucBuffer by writing the header.
+ *
+ * @param pxTelemetry The snapshot to start.
+ *
+ * @param pucBuffer The buffer the snapshot is written into.
+ *
+ * @param xBufferLength The length of pucBuffer in bytes.  Must be at least
+ * telemetryHEADER_LENGTH.
+ */
+void vTelemetryBegin( TelemetryBuffer_t * pxTelemetry,
+                      uint8_t * pucBuffer,
+                      size_t xBufferLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * telemetry.h
+ * @code{c}
+ * BaseType_t xTelemetryAddTask( TelemetryBuffer_t * pxTelemetry, const TaskStatus_t * pxTaskStatus );
+ * @endcode
+ *
+ * Adds a telemetryRECORD_TASK record describing one task, as returned by
+ * vTaskGetInfo() or uxTaskGetSystemState().
+ *
+ * @return pdPASS if the record was added, or pdFAIL if it did not fit.
+ */
+BaseType_t xTelemetryAddTask( TelemetryBuffer_t * pxTelemetry,
+                              const TaskStatus_t * pxTaskStatus ) PRIVILEGED_FUNCTION;
+
+/**
+ * telemetry.h
+ * @code{c}
+ * UBaseType_t uxTelemetryAddSystemState( TelemetryBuffer_t * pxTelemetry, TaskStatus_t * pxTaskStatusArray, UBaseType_t uxArraySize );
+ * @endcode
+ *
+ * Calls uxTaskGetSystemState(), then adds a telemetryRECORD_SYSTEM record
+ * followed by a telemetryRECORD_TASK record for every task.
+ *
+ * @param pxTaskStatusArray Working space for uxTaskGetSystemState().  Like
+ * the rest of the serialiser this function does not allocate memory, so the
+ * application supplies the array.
+ *
+ * @param uxArraySize The number of structures in pxTaskStatusArray.  Must be
+ * at least uxTaskGetNumberOfTasks(), otherwise no task records are added.
+ *
+ * @return The number of task records added.
+ */
+UBaseType_t uxTelemetryAddSystemState( TelemetryBuffer_t * pxTelemetry,
+                                       TaskStatus_t * pxTaskStatusArray,
+                                       UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+
+/**
+ * telemetry.h
+ * @code{c}
+ * BaseType_t xTelemetryAddHeapStats( TelemetryBuffer_t * pxTelemetry, const HeapStats_t * pxHeapStats );
+ * @endcode
+ *
+ * Adds a telemetryRECORD_HEAP record.  pxHeapStats is typically filled in by
+ * vPortGetHeapStats().
+ *
+ * @return pdPASS if the record was added, or pdFAIL if it did not fit.
+ */
+BaseType_t xTelemetryAddHeapStats( TelemetryBuffer_t * pxTelemetry,
+                                   const HeapStats_t * pxHeapStats ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_IPC_STATISTICS == 1 )
+
+/**
+ * telemetry.h
+ * @code{c}
+ * BaseType_t xTelemetryAddQueue( TelemetryBuffer_t * pxTelemetry, QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Adds a telemetryRECORD_QUEUE record holding the statistics of a queue,
+ * semaphore or mutex.
+ *
+ * @return pdPASS if the record was added, or pdFAIL if it did not fit.
+ */
+    BaseType_t xTelemetryAddQueue( TelemetryBuffer_t * pxTelemetry,
+                                   QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * telemetry.h
+ * @code{c}
+ * BaseType_t xTelemetryAddStreamBuffer( TelemetryBuffer_t * pxTelemetry, StreamBufferHandle_t xStreamBuffer );
+ * @endcode
+ *
+ * Adds a telemetryRECORD_STREAM_BUFFER record holding the statistics of a
+ * stream or message buffer.
+ *
+ * @return pdPASS if the record was added, or pdFAIL if it did not fit.
+ */
+    BaseType_t xTelemetryAddStreamBuffer( TelemetryBuffer_t * pxTelemetry,
+                                          StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_IPC_STATISTICS */
+
+/**
+ * telemetry.h
+ * @code{c}
+ * size_t xTelemetryEnd( TelemetryBuffer_t * pxTelemetry );
+ * @endcode
+ *
+ * Finishes a snapshot by recording in the header whether any records were
+ * left out.
+ *
+ * @return The length of the snapshot in bytes - the number of bytes from the
+ * start of the buffer to send to the host.
+ */
+size_t xTelemetryEnd( TelemetryBuffer_t * pxTelemetry ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* TELEMETRY_H */
@@ -67,6 +67,13 @@
 #define tmrCOMMAND_STOP_FROM_ISR                ( ( BaseType_t ) 8 )
 #define tmrCOMMAND_CHANGE_PERIOD_FROM_ISR       ( ( BaseType_t ) 9 )
 
+/* Commands that act on every timer in a timer group.  These are only sent from
+ * tasks, by xTimerGroupGenericCommand(). */
+#define tmrFIRST_GROUP_COMMAND                  ( ( BaseType_t ) 10 )
+#define tmrCOMMAND_GROUP_START                  ( ( BaseType_t ) 10 )
+#define tmrCOMMAND_GROUP_STOP                   ( ( BaseType_t ) 11 )
+#define tmrCOMMAND_GROUP_CHANGE_PERIOD          ( ( BaseType_t ) 12 )
+
 
 /**
  * Type by which software timers are referenced.  For example, a call to
@@ -89,6 +96,16 @@ typedef void (* TimerCallbackFunction_t)( TimerHandle_t xTimer );
 typedef void (* PendedFunction_t)( void * arg1,
                                    uint32_t arg2 );
 
+/*
+ * Describes a group of timers that can be started, stopped or have their
+ * period changed with a single command.  See xTimerGroupStart().
+ */
+typedef struct xTIMER_GROUP
+{
+    const TimerHandle_t * pxTimers; /**< The timers in the group, which must all be processed by the same timer service task. */
+    UBaseType_t uxTimerCount;       /**< The number of timers pointed to by pxTimers. */
+} TimerGroup_t;
+
 /**
  * TimerHandle_t xTimerCreate(  const char * const pcTimerName,
  *                              TickType_t xTimerPeriodInTicks,
@@ -409,6 +426,47 @@ void * pvTimerGetTimerID( const TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
 void vTimerSetTimerID( TimerHandle_t xTimer,
                        void * pvNewID ) PRIVILEGED_FUNCTION;
 
+/**
+ * void vTimerSetSlack( TimerHandle_t xTimer, TickType_t xSlackInTicks );
+ *
+ * Allows the timer to expire up to xSlackInTicks ticks after its expiry time.
+ *
+ * The timer task wakes at the latest time that is still within the slack of
+ * every timer due by then, and calls the callbacks of all the timers that
+ * have expired in one batch.  Giving timers slack therefore reduces the number
+ * of times the timer task runs and, when configUSE_TICKLESS_IDLE is used, lets
+ * the microcontroller sleep for longer.  Timers have no slack when created.
+ *
+ * The new slack is used the next time the timer task works out when to wake.
+ *
+ * configUSE_TIMERS and configUSE_TIMER_SLACK must both be set to 1 for
+ * vTimerSetSlack() to be available.
+ *
+ * @param xTimer The timer being updated.
+ *
+ * @param xSlackInTicks The number of ticks the timer may expire late by.
+ */
+#if ( configUSE_TIMER_SLACK == 1 )
+    void vTimerSetSlack( TimerHandle_t xTimer,
+                         TickType_t xSlackInTicks ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * TickType_t xTimerGetSlack( TimerHandle_t xTimer );
+ *
+ * Returns the slack set by vTimerSetSlack().
+ *
+ * configUSE_TIMERS and configUSE_TIMER_SLACK must both be set to 1 for
+ * xTimerGetSlack() to be available.
+ *
+ * @param xTimer The timer being queried.
+ *
+ * @return The number of ticks the timer may expire late by.
+ */
+#if ( configUSE_TIMER_SLACK == 1 )
+    TickType_t xTimerGetSlack( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer );
  *
@@ -454,6 +512,60 @@ BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
  */
 TaskHandle_t xTimerGetTimerDaemonTaskHandle( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * TaskHandle_t xTimerGetServiceTaskHandle( UBaseType_t uxServiceTask );
+ *
+ * Returns the handle of the timer service task with index uxServiceTask.
+ * Index 0 is the task returned by xTimerGetTimerDaemonTaskHandle().  It is not
+ * valid to call xTimerGetServiceTaskHandle() before the scheduler has been
+ * started.
+ *
+ * configTIMER_SERVICE_TASKS must be greater than 1 for
+ * xTimerGetServiceTaskHandle() to be available.
+ */
+#if ( configTIMER_SERVICE_TASKS > 1 )
+    TaskHandle_t xTimerGetServiceTaskHandle( UBaseType_t uxServiceTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * void vTimerSetServiceTask( TimerHandle_t xTimer, UBaseType_t uxServiceTask );
+ *
+ * Assigns the timer to the timer service task with index uxServiceTask.  That
+ * task processes the commands sent to the timer and calls its callback, so
+ * timers that need low jitter can be given a service task of their own,
+ * created with a higher priority through configTIMER_SERVICE_TASK_PRIORITIES,
+ * and are not delayed by the callbacks of other timers.
+ *
+ * Timers are assigned to service task 0 when created, or to the service task
+ * of the creating core if configTIMER_SERVICE_TASK_PER_CORE is 1.  A timer can
+ * only be reassigned while it is dormant and no command sent to it is still
+ * waiting to be processed, so normally before it is first started.
+ *
+ * configTIMER_SERVICE_TASKS must be greater than 1 for vTimerSetServiceTask()
+ * to be available.
+ *
+ * @param xTimer The timer being assigned.
+ *
+ * @param uxServiceTask The index of the timer service task, which must be less
+ * than configTIMER_SERVICE_TASKS.
+ */
+#if ( configTIMER_SERVICE_TASKS > 1 )
+    void vTimerSetServiceTask( TimerHandle_t xTimer,
+                               UBaseType_t uxServiceTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * UBaseType_t uxTimerGetServiceTask( TimerHandle_t xTimer );
+ *
+ * Returns the index of the timer service task the timer is assigned to.
+ *
+ * configTIMER_SERVICE_TASKS must be greater than 1 for uxTimerGetServiceTask()
+ * to be available.
+ */
+#if ( configTIMER_SERVICE_TASKS > 1 )
+    UBaseType_t uxTimerGetServiceTask( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * BaseType_t xTimerStart( TimerHandle_t xTimer, TickType_t xTicksToWait );
  *
@@ -798,6 +910,121 @@ TaskHandle_t xTimerGetTimerDaemonTaskHandle( void ) PRIVILEGED_FUNCTION;
 #define xTimerReset( xTimer, xTicksToWait ) \
     xTimerGenericCommand( ( xTimer ), tmrCOMMAND_RESET, ( xTaskGetTickCount() ), NULL, ( xTicksToWait ) )
 
+/**
+ * BaseType_t xTimerResetDirect( TimerHandle_t xTimer, TickType_t xTicksToWait );
+ *
+ * A version of xTimerReset() that avoids the timer command queue when it can.
+ *
+ * Resetting a timer that is already active can only move its expiry time
+ * later.  If the timer is active and no timer commands are waiting to be
+ * processed, xTimerResetDirect() records the reset time in the timer itself
+ * under a critical section and returns without waking the timer service task.
+ * When the timer service task later reaches the old expiry time it moves the
+ * timer to the expiry time relative to the last reset instead of calling the
+ * callback.  Otherwise the reset is sent through the command queue exactly as
+ * xTimerReset() does.
+ *
+ * This makes it cheap to reset a watchdog style timer very frequently.  A
+ * command that the timer service task has already received but not yet
+ * processed takes precedence over a concurrent direct reset.
+ *
+ * configUSE_TIMERS and configUSE_TIMER_DIRECT_RESET must both be set to 1 for
+ * xTimerResetDirect() to be available.  It must not be called from an
+ * interrupt service routine.
+ *
+ * @param xTimer The handle of the timer being reset/started/restarted.
+ *
+ * @param xTicksToWait Used as for xTimerReset() if the reset has to be sent to
+ * the timer command queue.
+ *
+ * @return pdPASS if the reset was recorded directly or the command was sent to
+ * the timer command queue, otherwise pdFAIL.
+ */
+#if ( configUSE_TIMER_DIRECT_RESET == 1 )
+    BaseType_t xTimerResetDirect( TimerHandle_t xTimer,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * BaseType_t xTimerGroupStart( const TimerGroup_t * pxGroup, TickType_t xTicksToWait );
+ *
+ * BaseType_t xTimerGroupReset( const TimerGroup_t * pxGroup, TickType_t xTicksToWait );
+ *
+ * BaseType_t xTimerGroupStop( const TimerGroup_t * pxGroup, TickType_t xTicksToWait );
+ *
+ * BaseType_t xTimerGroupChangePeriod( const TimerGroup_t * pxGroup,
+ *                                     TickType_t xNewPeriod,
+ *                                     TickType_t xTicksToWait );
+ *
+ * Versions of xTimerStart(), xTimerReset(), xTimerStop() and
+ * xTimerChangePeriod() that act on every timer in a group with a single
+ * command sent to the timer command queue, rather than one command per timer.
+ * Each timer ends up in the same state as if the command had been sent to it
+ * on its own, so a started or reset group is re-phased to expire one period
+ * after the call.  The timer service task takes every timer in the group out
+ * of the active timer list, then puts them back in a single pass over the
+ * list, which makes mode changes that reconfigure many related timers cheaper
+ * than sending each timer its own command.
+ *
+ * A timer group is described by a TimerGroup_t that points to an array of
+ * timer handles.  The TimerGroup_t and the array are read by the timer service
+ * task when it processes the command, so they must remain valid, and
+ * unchanged, until then.  All the timers in a group must be processed by the
+ * same timer service task, and must not be hard timers.  A timer can be in
+ * more than one group.
+ *
+ * configUSE_TIMERS and configUSE_TIMER_GROUPS must both be set to 1 for these
+ * functions to be available.  They must not be called from an interrupt
+ * service routine.
+ *
+ * @param pxGroup The group of timers being started, reset, stopped or having
+ * their period changed.
+ *
+ * @param xNewPeriod The new period of every timer in the group, as for
+ * xTimerChangePeriod().
+ *
+ * @param xTicksToWait Specifies the time, in ticks, that the calling task
+ * should be held in the Blocked state to wait for the command to be sent to
+ * the timer command queue, as for xTimerStart().
+ *
+ * @return pdFAIL will be returned if the command could not be sent to the
+ * timer command queue even after xTicksToWait ticks had passed.  pdPASS will
+ * be returned if the command was successfully sent to the timer command
+ * queue.
+ *
+ * Example usage:
+ * @verbatim
+ * // The timers used while the application is in its active mode.
+ * static TimerHandle_t xActiveModeTimers[ 50 ];
+ * static const TimerGroup_t xActiveModeGroup = { xActiveModeTimers, 50 };
+ *
+ * void vEnterLowPowerMode( void )
+ * {
+ *     // Stop all 50 timers with a single timer command.
+ *     xTimerGroupStop( &xActiveModeGroup, portMAX_DELAY );
+ * }
+ *
+ * void vEnterActiveMode( void )
+ * {
+ *     // Start all 50 timers again, in phase with each other.
+ *     xTimerGroupStart( &xActiveModeGroup, portMAX_DELAY );
+ * }
+ * @endverbatim
+ */
+#if ( configUSE_TIMER_GROUPS == 1 )
+    #define xTimerGroupStart( pxGroup, xTicksToWait ) \
+    xTimerGroupGenericCommand( ( pxGroup ), tmrCOMMAND_GROUP_START, ( xTaskGetTickCount() ), ( xTicksToWait ) )
+
+    #define xTimerGroupReset( pxGroup, xTicksToWait ) \
+    xTimerGroupGenericCommand( ( pxGroup ), tmrCOMMAND_GROUP_START, ( xTaskGetTickCount() ), ( xTicksToWait ) )
+
+    #define xTimerGroupStop( pxGroup, xTicksToWait ) \
+    xTimerGroupGenericCommand( ( pxGroup ), tmrCOMMAND_GROUP_STOP, 0U, ( xTicksToWait ) )
+
+    #define xTimerGroupChangePeriod( pxGroup, xNewPeriod, xTicksToWait ) \
+    xTimerGroupGenericCommand( ( pxGroup ), tmrCOMMAND_GROUP_CHANGE_PERIOD, ( xNewPeriod ), ( xTicksToWait ) )
+#endif /* configUSE_TIMER_GROUPS */
+
 /**
  * BaseType_t xTimerStartFromISR(   TimerHandle_t xTimer,
  *                                  BaseType_t *pxHigherPriorityTaskWoken );
@@ -1245,6 +1472,53 @@ TaskHandle_t xTimerGetTimerDaemonTaskHandle( void ) PRIVILEGED_FUNCTION;
                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * BaseType_t xTimerPendFunctionCallToServiceTask( UBaseType_t uxServiceTask,
+ *                                                 PendedFunction_t xFunctionToPend,
+ *                                                 void *pvParameter1,
+ *                                                 uint32_t ulParameter2,
+ *                                                 TickType_t xTicksToWait );
+ *
+ * BaseType_t xTimerPendFunctionCallToServiceTaskFromISR( UBaseType_t uxServiceTask,
+ *                                                        PendedFunction_t xFunctionToPend,
+ *                                                        void *pvParameter1,
+ *                                                        uint32_t ulParameter2,
+ *                                                        BaseType_t *pxHigherPriorityTaskWoken );
+ *
+ * Equivalent to xTimerPendFunctionCall() and xTimerPendFunctionCallFromISR(),
+ * except the function is executed by the timer service task with index
+ * uxServiceTask rather than by service task 0.  Pended functions therefore
+ * execute at the priority of the chosen service task, as set by
+ * configTIMER_SERVICE_TASK_PRIORITIES, and queue only behind the commands and
+ * callbacks of that service task.  For example, a service task with a high
+ * priority and no timers assigned to it can run urgent deferred interrupt
+ * processing without waiting for a backlog of lower priority work to drain.
+ * Functions pended to the same service task execute in the order in which
+ * they were pended.
+ *
+ * configTIMER_SERVICE_TASKS must be greater than 1 for these functions to be
+ * available.
+ *
+ * @param uxServiceTask The index of the timer service task, which must be less
+ * than configTIMER_SERVICE_TASKS.
+ *
+ * The remaining parameters and the return value are as described for
+ * xTimerPendFunctionCall() and xTimerPendFunctionCallFromISR().
+ */
+#if ( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configTIMER_SERVICE_TASKS > 1 ) )
+    BaseType_t xTimerPendFunctionCallToServiceTask( UBaseType_t uxServiceTask,
+                                                    PendedFunction_t xFunctionToPend,
+                                                    void * pvParameter1,
+                                                    uint32_t ulParameter2,
+                                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+    BaseType_t xTimerPendFunctionCallToServiceTaskFromISR( UBaseType_t uxServiceTask,
+                                                           PendedFunction_t xFunctionToPend,
+                                                           void * pvParameter1,
+                                                           uint32_t ulParameter2,
+                                                           BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * const char * const pcTimerGetName( TimerHandle_t xTimer );
  *
@@ -1302,6 +1576,59 @@ BaseType_t xTimerGetReloadMode( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
  */
 UBaseType_t uxTimerGetReloadMode( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
 
+/**
+ * void vTimerSetHardMode( TimerHandle_t xTimer, const BaseType_t xHard );
+ *
+ * Makes the timer a hard timer, or a normal timer again.
+ *
+ * The callback of a hard timer is called from the tick interrupt on the tick
+ * the timer expires, rather than from the timer service task, so its latency
+ * does not include a context switch or depend on the priority of the timer
+ * service task.  The callback therefore runs in interrupt context: it must be
+ * short, must not block, and can only call API functions that end in
+ * "FromISR", passing NULL as their pxHigherPriorityTaskWoken parameter - the
+ * tick interrupt performs any context switch they require.
+ *
+ * Commands sent to a hard timer, such as xTimerStart() or xTimerStopFromISR(),
+ * are executed immediately instead of being queued, so they cannot fail and
+ * the period of a started or reset timer is measured from the time of the
+ * call.  Auto-reload hard timers do not drift.  Hard timers are not processed
+ * while the scheduler is suspended; their callbacks are called when the
+ * scheduler is resumed and the pended ticks are processed.
+ *
+ * A timer can only change mode while it is dormant and no command sent to it
+ * is still waiting to be processed, so normally before it is first started.
+ *
+ * configUSE_TIMERS and configUSE_HARD_TIMERS must both be set to 1 for
+ * vTimerSetHardMode() to be available.
+ *
+ * @param xTimer The timer being updated.
+ *
+ * @param xHard If xHard is set to pdTRUE the timer becomes a hard timer.  If
+ * xHard is set to pdFALSE the timer becomes a normal timer.
+ */
+#if ( configUSE_HARD_TIMERS == 1 )
+    void vTimerSetHardMode( TimerHandle_t xTimer,
+                            const BaseType_t xHard ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * BaseType_t xTimerGetHardMode( TimerHandle_t xTimer );
+ *
+ * Queries whether the timer is a hard timer.
+ *
+ * configUSE_TIMERS and configUSE_HARD_TIMERS must both be set to 1 for
+ * xTimerGetHardMode() to be available.
+ *
+ * @param xTimer The timer being queried.
+ *
+ * @return If the timer is a hard timer then pdTRUE is returned, otherwise
+ * pdFALSE is returned.
+ */
+#if ( configUSE_HARD_TIMERS == 1 )
+    BaseType_t xTimerGetHardMode( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * TickType_t xTimerGetPeriod( TimerHandle_t xTimer );
  *
@@ -1376,6 +1703,14 @@ BaseType_t xTimerGenericCommandFromISR( TimerHandle_t xTimer,
     ( ( xCommandID ) < tmrFIRST_FROM_ISR_COMMAND ?                                                                  \
       xTimerGenericCommandFromTask( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait ) : \
       xTimerGenericCommandFromISR( xTimer, xCommandID, xOptionalValue, pxHigherPriorityTaskWoken, xTicksToWait ) )
+
+#if ( configUSE_TIMER_GROUPS == 1 )
+    BaseType_t xTimerGroupGenericCommand( const TimerGroup_t * const pxGroup,
+                                          const BaseType_t xCommandID,
+                                          const TickType_t xOptionalValue,
+                                          const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_TRACE_FACILITY == 1 )
     void vTimerSetTimerNumber( TimerHandle_t xTimer,
                                UBaseType_t uxTimerNumber ) PRIVILEGED_FUNCTION;
@@ -1401,6 +1736,32 @@ BaseType_t xTimerGenericCommandFromISR( TimerHandle_t xTimer,
                                          StackType_t ** ppxTimerTaskStackBuffer,
                                          configSTACK_DEPTH_TYPE * puxTimerTaskStackSize );
 
+    #if ( configTIMER_SERVICE_TASKS > 1 )
+
+/**
+ * timers.h
+ * @code{c}
+ * void vApplicationGetTimerServiceTaskMemory( StaticTask_t ** ppxTimerTaskTCBBuffer, StackType_t ** ppxTimerTaskStackBuffer, configSTACK_DEPTH_TYPE * puxTimerTaskStackSize, UBaseType_t uxServiceTask )
+ * @endcode
+ *
+ * This function is used to provide statically allocated blocks of memory to
+ * FreeRTOS to hold the timer service tasks other than the first, which uses
+ * vApplicationGetTimerTaskMemory().  This function is required when
+ * configSUPPORT_STATIC_ALLOCATION is set and configTIMER_SERVICE_TASKS is
+ * greater than 1.
+ *
+ * @param ppxTimerTaskTCBBuffer   A handle to a statically allocated TCB buffer
+ * @param ppxTimerTaskStackBuffer A handle to a statically allocated Stack buffer for the timer service task
+ * @param puxTimerTaskStackSize   A pointer to the number of elements that will fit in the allocated stack buffer
+ * @param uxServiceTask           The index of the timer service task, from 1 to configTIMER_SERVICE_TASKS - 1
+ */
+        void vApplicationGetTimerServiceTaskMemory( StaticTask_t ** ppxTimerTaskTCBBuffer,
+                                                    StackType_t ** ppxTimerTaskStackBuffer,
+                                                    configSTACK_DEPTH_TYPE * puxTimerTaskStackSize,
+                                                    UBaseType_t uxServiceTask );
+
+    #endif /* configTIMER_SERVICE_TASKS */
+
 #endif
 
 #if ( configUSE_DAEMON_TASK_STARTUP_HOOK != 0 )
@@ -1420,12 +1781,42 @@ BaseType_t xTimerGenericCommandFromISR( TimerHandle_t xTimer,
 
 #endif
 
+/*
+ * For internal use only.  Called by the tick interrupt, after the tick count
+ * has been incremented to xTickCount, to call the callbacks of the hard timers
+ * that have expired.
+ */
+#if ( configUSE_HARD_TIMERS == 1 )
+    void vTimerProcessHardTimers( const TickType_t xTickCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Returns the number of ticks from xTickCount until
+ * the next hard timer expires, or portMAX_DELAY if no hard timer is active.
+ * Used to limit the time the tick interrupt is suppressed for by tickless
+ * idle.
+ */
+#if ( configUSE_HARD_TIMERS == 1 )
+    TickType_t xTimerGetTicksToNextHardTimer( const TickType_t xTickCount ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * This function resets the internal state of the timer module. It must be called
  * by the application before restarting the scheduler.
  */
 void vTimerResetState( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Save the state of the timer module to pucState at
+ * offset xOffset if xSave is pdTRUE, or restore it if xSave is pdFALSE, using
+ * xTaskWarmBootCopy().  Returns the offset of the byte after the state.
+ */
+#if ( configUSE_WARM_BOOT == 1 )
+    size_t xTimerCopyWarmBootState( uint8_t * pucState,
+                                    size_t xOffset,
+                                    BaseType_t xSave ) PRIVILEGED_FUNCTION;
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
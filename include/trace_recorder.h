@@ -0,0 +1,253 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+/* This header is included by FreeRTOS.h when configUSE_TRACE_RECORDER is 1, so
+ * the trace macros it defines replace the empty defaults.  It must not be
+ * included directly. */
+#ifndef INC_FREERTOS_H
+    #error FreeRTOS.h includes trace_recorder.h when configUSE_TRACE_RECORDER is 1 - do not include it directly
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Identifies a trace recorder buffer or stream, and the layout of the
+ * structures below.  Update traceRECORDER_VERSION, and
+ * tools/trace/freertos_trace_decode.py, if the layout changes. */
+#define traceRECORDER_MAGIC                  ( ( uint32_t ) 0x52545246UL ) /* "FRTR" when stored little endian. */
+#define traceRECORDER_VERSION                ( ( uint16_t ) 1U )
+
+/* The event IDs.  The object index recorded with each event is the task number
+ * (uxTaskGetTaskNumber()) for task events, the queue number
+ * (uxQueueGetQueueNumber()) for queue events, the low 16 bits of the tick count
+ * for tick events, and the value passed to vTraceRecorderUserEvent() for user
+ * events. */
+#define traceEVENT_TASK_SWITCHED_IN          ( ( uint8_t ) 1U )
+#define traceEVENT_TASK_READY                ( ( uint8_t ) 2U )
+#define traceEVENT_TASK_CREATE               ( ( uint8_t ) 3U )
+#define traceEVENT_TASK_DELETE               ( ( uint8_t ) 4U )
+#define traceEVENT_TASK_DELAY                ( ( uint8_t ) 5U )
+#define traceEVENT_TASK_SUSPEND              ( ( uint8_t ) 6U )
+#define traceEVENT_TASK_RESUME               ( ( uint8_t ) 7U )
+#define traceEVENT_TASK_NOTIFY               ( ( uint8_t ) 8U )
+#define traceEVENT_TASK_NOTIFY_WAIT          ( ( uint8_t ) 9U )
+#define traceEVENT_QUEUE_CREATE              ( ( uint8_t ) 10U )
+#define traceEVENT_QUEUE_DELETE              ( ( uint8_t ) 11U )
+#define traceEVENT_QUEUE_SEND                ( ( uint8_t ) 12U )
+#define traceEVENT_QUEUE_RECEIVE             ( ( uint8_t ) 13U )
+#define traceEVENT_QUEUE_BLOCK_ON_SEND       ( ( uint8_t ) 14U )
+#define traceEVENT_QUEUE_BLOCK_ON_RECEIVE    ( ( uint8_t ) 15U )
+#define traceEVENT_ISR_ENTER                 ( ( uint8_t ) 16U )
+#define traceEVENT_ISR_EXIT                  ( ( uint8_t ) 17U )
+#define traceEVENT_TICK                      ( ( uint8_t ) 18U )
+#define traceEVENT_USER                      ( ( uint8_t ) 19U )
+
+/* Name records.  When streaming, each name record is followed by
+ * configTRACE_RECORDER_NAME_LENGTH bytes holding the name. */
+#define traceEVENT_TASK_NAME                 ( ( uint8_t ) 32U )
+#define traceEVENT_QUEUE_NAME                ( ( uint8_t ) 33U )
+
+/*
+ * One recorded event.  ulTimestampDelta is the number of timestamp counts
+ * since the previous event recorded on the same core.
+ */
+typedef struct xTRACE_EVENT
+{
+    uint32_t ulTimestampDelta;
+    uint16_t usObjectIndex;
+    uint8_t ucEventId;
+    uint8_t ucCore;
+} TraceEvent_t;
+
+/*
+ * The name of a task or queue.  ucObjectType is traceEVENT_TASK_NAME or
+ * traceEVENT_QUEUE_NAME.  Names are not necessarily NULL terminated.
+ */
+typedef struct xTRACE_OBJECT_NAME
+{
+    uint16_t usObjectIndex;
+    uint8_t ucObjectType;
+    uint8_t ucReserved;
+    char cName[ configTRACE_RECORDER_NAME_LENGTH ];
+} TraceObjectName_t;
+
+/*
+ * Describes the recorder.  When streaming, the header is the first thing
+ * written, with ulEventsPerCore set to 0.
+ */
+typedef struct xTRACE_RECORDER_HEADER
+{
+    uint32_t ulMagic;
+    uint16_t usVersion;
+    uint8_t ucNumberOfCores;
+    uint8_t ucNameLength;
+    uint32_t ulTimestampHz;
+    uint32_t ulEventsPerCore;
+    uint32_t ulNameTableLength;
+} TraceRecorderHeader_t;
+
+/*
+ * The events recorded on one core.  ulLastTimestamp is the timestamp of the
+ * most recent event.  ulEventsWritten counts every event recorded, so the most
+ * recent event is at index ( ulEventsWritten - 1 ) modulo
+ * configTRACE_RECORDER_BUFFER_LENGTH, and older events have been overwritten if
+ * ulEventsWritten exceeds configTRACE_RECORDER_BUFFER_LENGTH.
+ */
+typedef struct xTRACE_RECORDER_CORE
+{
+    uint32_t ulLastTimestamp;
+    uint32_t ulEventsWritten;
+    #if ( configTRACE_RECORDER_STREAMING == 0 )
+        TraceEvent_t xEvents[ configTRACE_RECORDER_BUFFER_LENGTH ];
+    #endif
+} TraceRecorderCore_t;
+
+/*
+ * The whole of the recorder's state, held in xTraceRecorder.  To decode a trace
+ * recorded in the ring buffers, save the memory holding xTraceRecorder - for
+ * example with "dump binary value trace.bin xTraceRecorder" in GDB - and pass
+ * the file to tools/trace/freertos_trace_decode.py.
+ */
+typedef struct xTRACE_RECORDER
+{
+    TraceRecorderHeader_t xHeader;
+    uint32_t ulNamesWritten;
+    TraceObjectName_t xNames[ configTRACE_RECORDER_NAME_TABLE_LENGTH ];
+    TraceRecorderCore_t xCores[ configNUMBER_OF_CORES ];
+} TraceRecorder_t;
+
+extern TraceRecorder_t xTraceRecorder;
+
+/*
+ * Record an event on the calling core.  Can be called from tasks and
+ * interrupts.
+ */
+void vTraceRecorderEvent( uint8_t ucEventId,
+                          UBaseType_t uxObjectIndex ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record the name of a task or queue, then, unless ucEventId is 0, record
+ * ucEventId for it.
+ */
+void vTraceRecorderNamedEvent( uint8_t ucEventId,
+                               uint8_t ucObjectType,
+                               UBaseType_t uxObjectIndex,
+                               const char * pcName ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record the creation of a queue, returning the queue number assigned to it.
+ */
+UBaseType_t uxTraceRecorderQueueCreate( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record an application defined event, such as the start of a section of code
+ * being measured.  usValue is recorded as the event's object index.
+ */
+void vTraceRecorderUserEvent( uint16_t usValue ) PRIVILEGED_FUNCTION;
+
+#if ( configTRACE_RECORDER_STREAMING == 1 )
+
+/*
+ * Start passing events to configTRACE_RECORDER_WRITE().  Writes the header and
+ * the names of the tasks and queues created so far.  Events that occur before
+ * streaming starts are discarded.  Call once the trace transport is ready.
+ */
+    void vTraceRecorderStartStreaming( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/* The trace macros used by the recorder.  Task events expand within tasks.c,
+ * and queue events within queue.c, so can access the TCB and queue structures
+ * directly. */
+#define traceTASK_SWITCHED_IN()                            vTraceRecorderEvent( traceEVENT_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber )
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )            vTraceRecorderEvent( traceEVENT_TASK_READY, ( pxTCB )->uxTCBNumber )
+#define traceTASK_CREATE( pxNewTCB )                       vTraceRecorderNamedEvent( traceEVENT_TASK_CREATE, traceEVENT_TASK_NAME, ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName )
+#define traceTASK_DELETE( pxTaskToDelete )                 vTraceRecorderEvent( traceEVENT_TASK_DELETE, ( pxTaskToDelete )->uxTCBNumber )
+#define traceTASK_DELAY()                                  vTraceRecorderEvent( traceEVENT_TASK_DELAY, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_DELAY_UNTIL( xTimeToWake )               vTraceRecorderEvent( traceEVENT_TASK_DELAY, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_SUSPEND( pxTaskToSuspend )               vTraceRecorderEvent( traceEVENT_TASK_SUSPEND, ( pxTaskToSuspend )->uxTCBNumber )
+#define traceTASK_RESUME( pxTaskToResume )                 vTraceRecorderEvent( traceEVENT_TASK_RESUME, ( pxTaskToResume )->uxTCBNumber )
+#define traceTASK_RESUME_FROM_ISR( pxTaskToResume )        vTraceRecorderEvent( traceEVENT_TASK_RESUME, ( pxTaskToResume )->uxTCBNumber )
+#define traceTASK_NOTIFY( uxIndexToNotify )                vTraceRecorderEvent( traceEVENT_TASK_NOTIFY, pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )       vTraceRecorderEvent( traceEVENT_TASK_NOTIFY, pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify )  vTraceRecorderEvent( traceEVENT_TASK_NOTIFY, pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )       vTraceRecorderEvent( traceEVENT_TASK_NOTIFY_WAIT, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )       vTraceRecorderEvent( traceEVENT_TASK_NOTIFY_WAIT, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_INCREMENT_TICK( xTickCount )             vTraceRecorderEvent( traceEVENT_TICK, ( UBaseType_t ) ( xTickCount ) )
+#define traceQUEUE_CREATE( pxNewQueue )                    ( pxNewQueue )->uxQueueNumber = uxTraceRecorderQueueCreate()
+#define traceQUEUE_DELETE( pxQueue )                       vTraceRecorderEvent( traceEVENT_QUEUE_DELETE, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )     vTraceRecorderNamedEvent( 0U, traceEVENT_QUEUE_NAME, ( xQueue )->uxQueueNumber, ( pcQueueName ) )
+#define traceQUEUE_SEND( pxQueue )                         vTraceRecorderEvent( traceEVENT_QUEUE_SEND, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )                vTraceRecorderEvent( traceEVENT_QUEUE_SEND, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE( pxQueue )                      vTraceRecorderEvent( traceEVENT_QUEUE_RECEIVE, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )             vTraceRecorderEvent( traceEVENT_QUEUE_RECEIVE, ( pxQueue )->uxQueueNumber )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )             vTraceRecorderEvent( traceEVENT_QUEUE_BLOCK_ON_SEND, ( pxQueue )->uxQueueNumber )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )          vTraceRecorderEvent( traceEVENT_QUEUE_BLOCK_ON_RECEIVE, ( pxQueue )->uxQueueNumber )
+
+#if ( configUSE_ISR_RUN_TIME_STATS == 1 )
+
+/* The interrupt run time stats are collected by the same macros. */
+    #define traceISR_ENTER()                             \
+    do                                                   \
+    {                                                    \
+        vTraceRecorderEvent( traceEVENT_ISR_ENTER, 0U ); \
+        vTaskISREnter( portGET_INTERRUPT_NUMBER() );     \
+    } while( 0 )
+
+    #define traceISR_EXIT()                                  \
+    do                                                       \
+    {                                                        \
+        vTraceRecorderEvent( traceEVENT_ISR_EXIT, 0U );      \
+        vTaskISRExit( portGET_INTERRUPT_NUMBER(), pdFALSE ); \
+    } while( 0 )
+
+    #define traceISR_EXIT_TO_SCHEDULER()                    \
+    do                                                      \
+    {                                                       \
+        vTraceRecorderEvent( traceEVENT_ISR_EXIT, 0U );     \
+        vTaskISRExit( portGET_INTERRUPT_NUMBER(), pdTRUE ); \
+    } while( 0 )
+#else /* if ( configUSE_ISR_RUN_TIME_STATS == 1 ) */
+    #define traceISR_ENTER()                vTraceRecorderEvent( traceEVENT_ISR_ENTER, 0U )
+    #define traceISR_EXIT()                 vTraceRecorderEvent( traceEVENT_ISR_EXIT, 0U )
+    #define traceISR_EXIT_TO_SCHEDULER()    vTraceRecorderEvent( traceEVENT_ISR_EXIT, 0U )
+#endif /* if ( configUSE_ISR_RUN_TIME_STATS == 1 ) */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* TRACE_RECORDER_H */
@@ -0,0 +1,513 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "light_mutex.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include light mutex functionality. This #if is closed at the very bottom
+ * of this file. If you want to include light mutexes then ensure
+ * configUSE_LIGHT_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_LIGHT_MUTEXES == 1 )
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define lightmutexYIELD_IF_USING_PREEMPTION()
+    #else
+        #if ( configNUMBER_OF_CORES == 1 )
+            #define lightmutexYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+        #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            #define lightmutexYIELD_IF_USING_PREEMPTION()    vTaskYieldWithinAPI()
+        #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the priority of the highest priority task waiting for the mutex, or
+ * tskIDLE_PRIORITY if no tasks are waiting.  Must be called from a critical
+ * section.
+ */
+    static UBaseType_t prvGetHighestPriorityOfWaitingTasks( const LightMutex_t * const pxMutex ) PRIVILEGED_FUNCTION;
+
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+
+/*
+ * Polls the mutex for up to configMUTEX_SPIN_ITERATIONS iterations while the
+ * task holding it is running on another core.  Returns pdTRUE if the mutex was
+ * given during that time, or pdFALSE if the holder stopped running or the
+ * iterations ran out, in which case the calling task should block.
+ */
+        static BaseType_t prvSpinWhileOwnerRuns( const LightMutex_t * const pxMutex ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*-----------------------------------------------------------*/
+
+    void vLightMutexInit( LightMutex_t * pxMutex )
+    {
+        traceENTER_vLightMutexInit( pxMutex );
+
+        configASSERT( pxMutex );
+
+        pxMutex->xOwner = NULL;
+        vListInitialise( &( pxMutex->xTasksWaitingToTake ) );
+
+        #if ( configUSE_RECURSIVE_MUTEXES == 1 )
+        {
+            pxMutex->uxRecursiveCallCount = ( UBaseType_t ) 0U;
+        }
+        #endif
+
+        traceRETURN_vLightMutexInit();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLightMutexTake( LightMutex_t * pxMutex,
+                                TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xInheritanceOccurred = pdFALSE;
+        BaseType_t xTakeAttemptComplete = pdFALSE;
+        TimeOut_t xTimeOut;
+
+        #if ( ( configNUMBER_OF_CORES > 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+            BaseType_t xSpinAttempted = pdFALSE;
+        #endif
+
+        traceENTER_xLightMutexTake( pxMutex, xTicksToWait );
+
+        configASSERT( pxMutex );
+
+        /* A light mutex cannot be taken recursively. */
+        configASSERT( pxMutex->xOwner != xTaskGetCurrentTaskHandle() );
+
+        /* Cannot block if the scheduler is suspended. */
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            /* The fast path.  Light mutexes are not used from interrupts, so a
+             * short critical section is all that is needed to take a free
+             * mutex. */
+            taskENTER_CRITICAL();
+            {
+                if( pxMutex->xOwner == NULL )
+                {
+                    /* Record the new owner and increment its count of held
+                     * mutexes, as for a standard mutex. */
+                    pxMutex->xOwner = pvTaskIncrementMutexHeldCount();
+                    xReturn = pdPASS;
+                    xTakeAttemptComplete = pdTRUE;
+                }
+                else if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The mutex is held and no block time is specified (or the
+                     * block time has expired) so exit now. */
+                    xTakeAttemptComplete = pdTRUE;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The mutex is held and a block time was specified so
+                     * configure the timeout structure ready to block. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xTakeAttemptComplete != pdFALSE )
+            {
+                break;
+            }
+
+            #if ( ( configNUMBER_OF_CORES > 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+            {
+                /* A mutex held by a task running on another core is likely to
+                 * be given back soon, so poll it for a while before paying for
+                 * a context switch.  Only spin once per call so the time spent
+                 * spinning is bounded. */
+                if( xSpinAttempted == pdFALSE )
+                {
+                    xSpinAttempted = pdTRUE;
+
+                    if( prvSpinWhileOwnerRuns( pxMutex ) != pdFALSE )
+                    {
+                        continue;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) ) */
+
+            /* The slow path.  Other tasks cannot take or give the mutex while
+             * the scheduler is suspended. */
+            vTaskSuspendAll();
+
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( pxMutex->xOwner != NULL )
+                {
+                    traceBLOCKING_ON_LIGHT_MUTEX_TAKE( pxMutex );
+
+                    taskENTER_CRITICAL();
+                    {
+                        #if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+                        {
+                            vTaskInternalSetBlockedOnMutex( &( pxMutex->xOwner ) );
+                        }
+                        #endif
+
+                        if( xTaskPriorityInherit( pxMutex->xOwner ) != pdFALSE )
+                        {
+                            xInheritanceOccurred = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    taskEXIT_CRITICAL();
+
+                    vTaskPlaceOnEventList( &( pxMutex->xTasksWaitingToTake ), xTicksToWait );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    #if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+                    {
+                        vTaskInternalSetBlockedOnMutex( NULL );
+                    }
+                    #endif
+                }
+                else
+                {
+                    /* The mutex was given before the scheduler was suspended,
+                     * so attempt to take it again. */
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out.  Return to attempt to take the mutex one last time
+                 * with xTicksToWait now 0. */
+                ( void ) xTaskResumeAll();
+            }
+        }
+
+        if( ( xReturn == pdFAIL ) && ( xInheritanceOccurred != pdFALSE ) )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* This task blocking on the mutex caused another task to inherit
+                 * this task's priority.  Now this task has timed out the priority
+                 * should be disinherited again, but only as low as the next
+                 * highest priority task that is waiting for the same mutex. */
+                vTaskPriorityDisinheritAfterTimeout( pxMutex->xOwner, prvGetHighestPriorityOfWaitingTasks( pxMutex ) );
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xLightMutexTake( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLightMutexGive( LightMutex_t * pxMutex )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xLightMutexGive( pxMutex );
+
+        configASSERT( pxMutex );
+
+        taskENTER_CRITICAL();
+        {
+            /* Only the task holding the mutex can give it. */
+            if( pxMutex->xOwner == xTaskGetCurrentTaskHandle() )
+            {
+                /* Decrement the count of held mutexes and return to the base
+                 * priority if a priority was inherited and no other mutexes are
+                 * held. */
+                xYieldRequired = xTaskPriorityDisinherit( pxMutex->xOwner );
+                pxMutex->xOwner = NULL;
+
+                /* The mutex is only slower to give if a task is waiting for
+                 * it.  The highest priority waiting task is unblocked and takes
+                 * the mutex when it runs. */
+                if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxMutex->xTasksWaitingToTake ) ) != pdFALSE )
+                    {
+                        xYieldRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xYieldRequired != pdFALSE )
+                {
+                    lightmutexYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        configASSERT( xReturn == pdPASS );
+
+        traceRETURN_xLightMutexGive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_RECURSIVE_MUTEXES == 1 )
+
+        BaseType_t xLightMutexTakeRecursive( LightMutex_t * pxMutex,
+                                             TickType_t xTicksToWait )
+        {
+            BaseType_t xReturn;
+
+            traceENTER_xLightMutexTakeRecursive( pxMutex, xTicksToWait );
+
+            configASSERT( pxMutex );
+
+            /* Only the task holding the mutex can set xOwner to its own handle,
+             * so if xOwner is the calling task's handle it cannot change while
+             * it is being tested, and uxRecursiveCallCount is only accessed by
+             * the holder.  Taking the mutex again therefore does not need a
+             * critical section. */
+            if( pxMutex->xOwner == xTaskGetCurrentTaskHandle() )
+            {
+                ( pxMutex->uxRecursiveCallCount )++;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = xLightMutexTake( pxMutex, xTicksToWait );
+
+                /* pdPASS will only be returned if the mutex was successfully
+                 * obtained.  The calling task may have entered the Blocked
+                 * state before reaching here. */
+                if( xReturn != pdFAIL )
+                {
+                    pxMutex->uxRecursiveCallCount = ( UBaseType_t ) 1U;
+                }
+                else
+                {
+                    traceLIGHT_MUTEX_TAKE_RECURSIVE_FAILED( pxMutex );
+                }
+            }
+
+            traceRETURN_xLightMutexTakeRecursive( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_RECURSIVE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_RECURSIVE_MUTEXES == 1 )
+
+        BaseType_t xLightMutexGiveRecursive( LightMutex_t * pxMutex )
+        {
+            BaseType_t xReturn;
+
+            traceENTER_xLightMutexGiveRecursive( pxMutex );
+
+            configASSERT( pxMutex );
+
+            /* See the comment in xLightMutexTakeRecursive() for why no critical
+             * section is needed to test xOwner. */
+            if( pxMutex->xOwner == xTaskGetCurrentTaskHandle() )
+            {
+                /* uxRecursiveCallCount cannot be zero if xOwner is equal to the
+                 * task handle. */
+                configASSERT( pxMutex->uxRecursiveCallCount );
+                ( pxMutex->uxRecursiveCallCount )--;
+
+                /* Has the recursive call count unwound to 0? */
+                if( pxMutex->uxRecursiveCallCount == ( UBaseType_t ) 0U )
+                {
+                    xReturn = xLightMutexGive( pxMutex );
+                }
+                else
+                {
+                    xReturn = pdPASS;
+                }
+            }
+            else
+            {
+                /* The mutex cannot be given because the calling task is not
+                 * the holder. */
+                xReturn = pdFAIL;
+            }
+
+            traceRETURN_xLightMutexGiveRecursive( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_RECURSIVE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+    TaskHandle_t xLightMutexGetHolder( const LightMutex_t * pxMutex )
+    {
+        TaskHandle_t xReturn;
+
+        traceENTER_xLightMutexGetHolder( pxMutex );
+
+        configASSERT( pxMutex );
+
+        xReturn = pxMutex->xOwner;
+
+        traceRETURN_xLightMutexGetHolder( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvGetHighestPriorityOfWaitingTasks( const LightMutex_t * const pxMutex )
+    {
+        UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+        /* The priority of the highest priority waiting task is stored as
+         * configMAX_PRIORITIES less that priority in the head entry of the
+         * event list. */
+        if( listCURRENT_LIST_LENGTH( &( pxMutex->xTasksWaitingToTake ) ) > 0U )
+        {
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxMutex->xTasksWaitingToTake ) ) );
+        }
+        else
+        {
+            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+        }
+
+        return uxHighestPriorityOfWaitingTasks;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+
+        static BaseType_t prvSpinWhileOwnerRuns( const LightMutex_t * const pxMutex )
+        {
+            UBaseType_t uxIteration;
+            BaseType_t xReturn = pdFALSE;
+            TaskHandle_t xOwner;
+
+            for( uxIteration = 0U; uxIteration < ( UBaseType_t ) configMUTEX_SPIN_ITERATIONS; uxIteration++ )
+            {
+                xOwner = pxMutex->xOwner;
+
+                if( xOwner == NULL )
+                {
+                    /* The mutex has been given. */
+                    xReturn = pdTRUE;
+                    break;
+                }
+                else if( xTaskInternalIsTaskRunning( xOwner ) == pdFALSE )
+                {
+                    /* The holder has blocked or been preempted, so will not
+                     * give the mutex soon. */
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            return xReturn;
+        }
+
+    #endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include light mutex functionality. If you want to include light mutexes
+ * then ensure configUSE_LIGHT_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_LIGHT_MUTEXES == 1 */
@@ -42,6 +42,18 @@
  * generate the correct privileged Vs unprivileged linkage and placement. */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/*
+ * Find the item in the skip list pxList after which pxNewListItem is to be
+ * inserted, and link pxNewListItem into the skip list lanes it is to join.
+ * The search starts in the highest lane and drops down a lane each time the
+ * next item in the current lane has a greater value than the new item, so it
+ * takes O(log n) steps on average.
+ */
+#if ( configUSE_SKIP_LISTS == 1 )
+    static ListItem_t * prvSkipListSearch( List_t * const pxList,
+                                           ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
+#endif
+
 /*-----------------------------------------------------------
 * PUBLIC LIST API documented in list.h
 *----------------------------------------------------------*/
@@ -77,6 +89,20 @@ void vListInitialise( List_t * const pxList )
 
     pxList->uxNumberOfItems = ( UBaseType_t ) 0U;
 
+    #if ( configUSE_SKIP_LISTS == 1 )
+    {
+        UBaseType_t uxLane;
+
+        for( uxLane = 0U; uxLane < ( UBaseType_t ) configSKIP_LIST_LANES; uxLane++ )
+        {
+            pxList->pxSkipHead[ uxLane ] = NULL;
+        }
+
+        pxList->xIsSkipList = pdFALSE;
+        pxList->uxSkipInserts = ( UBaseType_t ) 0U;
+    }
+    #endif
+
     /* Write known values into the list if
      * configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
     listSET_LIST_INTEGRITY_CHECK_1_VALUE( pxList );
@@ -86,6 +112,21 @@ void vListInitialise( List_t * const pxList )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_SKIP_LISTS == 1 )
+
+    void vListInitialiseSkipList( List_t * const pxList )
+    {
+        traceENTER_vListInitialiseSkipList( pxList );
+
+        vListInitialise( pxList );
+        pxList->xIsSkipList = pdTRUE;
+
+        traceRETURN_vListInitialiseSkipList();
+    }
+
+#endif /* configUSE_SKIP_LISTS */
+/*-----------------------------------------------------------*/
+
 void vListInitialiseItem( ListItem_t * const pxItem )
 {
     traceENTER_vListInitialiseItem( pxItem );
@@ -93,6 +134,12 @@ void vListInitialiseItem( ListItem_t * const pxItem )
     /* Make sure the list item is not recorded as being on a list. */
     pxItem->pxContainer = NULL;
 
+    #if ( configUSE_SKIP_LISTS == 1 )
+    {
+        pxItem->uxSkipLanes = ( UBaseType_t ) 0U;
+    }
+    #endif
+
     /* Write known values into the list item if
      * configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
     listSET_FIRST_LIST_ITEM_INTEGRITY_CHECK_VALUE( pxItem );
@@ -141,6 +188,8 @@ void vListInsert( List_t * const pxList,
 {
     ListItem_t * pxIterator;
     const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
+    TickType_t xHeadValue;
+    TickType_t xTailValue;
 
     traceENTER_vListInsert( pxList, pxNewListItem );
 
@@ -157,44 +206,85 @@ void vListInsert( List_t * const pxList,
      * stored in ready lists (all of which have the same xItemValue value) get a
      * share of the CPU.  However, if the xItemValue is the same as the back marker
      * the iteration loop below will not end.  Therefore the value is checked
-     * first, and the algorithm slightly modified if necessary. */
-    if( xValueOfInsertion == portMAX_DELAY )
-    {
-        pxIterator = pxList->xListEnd.pxPrevious;
-    }
-    else
+     * first, and the algorithm slightly modified if necessary.
+     *
+     * The new list item is also placed directly at the end of the list if no
+     * list item has a greater value.  Items in an event list are ordered by
+     * priority, so this keeps inserting one of many waiting tasks of the same
+     * priority constant time, as does inserting a task of a higher priority
+     * than all the others, which ends the iteration loop at its first test.
+     *
+     * Otherwise the list is searched from whichever end the new value is
+     * nearer to.  Wake times in the delayed lists and the timer lists are
+     * mostly close to the latest one already there, so searching back from
+     * the end keeps those inserts close to constant time too.  Both searches
+     * find the same position.
+     *
+     * Skip lists are searched through their lanes instead, which also links
+     * the new item into the lanes it is to join. */
+    #if ( configUSE_SKIP_LISTS == 1 )
+        if( pxList->xIsSkipList != pdFALSE )
+        {
+            pxIterator = prvSkipListSearch( pxList, pxNewListItem );
+        }
+        else
+    #endif /* configUSE_SKIP_LISTS */
     {
-        /* *** NOTE ***********************************************************
-        *  If you find your application is crashing here then likely causes are
-        *  listed below.  In addition see https://www.freertos.org/Why-FreeRTOS/FAQs for
-        *  more tips, and ensure configASSERT() is defined!
-        *  https://www.FreeRTOS.org/a00110.html#configASSERT
-        *
-        *   1) Stack overflow -
-        *      see https://www.FreeRTOS.org/Stacks-and-stack-overflow-checking.html
-        *   2) Incorrect interrupt priority assignment, especially on Cortex-M
-        *      parts where numerically high priority values denote low actual
-        *      interrupt priorities, which can seem counter intuitive.  See
-        *      https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html and the definition
-        *      of configMAX_SYSCALL_INTERRUPT_PRIORITY on
-        *      https://www.FreeRTOS.org/a00110.html
-        *   3) Calling an API function from within a critical section or when
-        *      the scheduler is suspended, or calling an API function that does
-        *      not end in "FromISR" from an interrupt.
-        *   4) Using a queue or semaphore before it has been initialised or
-        *      before the scheduler has been started (are interrupts firing
-        *      before vTaskStartScheduler() has been called?).
-        *   5) If the FreeRTOS port supports interrupt nesting then ensure that
-        *      the priority of the tick interrupt is at or below
-        *      configMAX_SYSCALL_INTERRUPT_PRIORITY.
-        **********************************************************************/
-
-        for( pxIterator = ( ListItem_t * ) &( pxList->xListEnd ); pxIterator->pxNext->xItemValue <= xValueOfInsertion; pxIterator = pxIterator->pxNext )
-        {
-            /* There is nothing to do here, just iterating to the wanted
-             * insertion position.
-             * IF YOU FIND YOUR CODE STUCK HERE, SEE THE NOTE JUST ABOVE.
-             */
+        xTailValue = pxList->xListEnd.pxPrevious->xItemValue;
+
+        if( ( xValueOfInsertion == portMAX_DELAY ) || ( xTailValue <= xValueOfInsertion ) )
+        {
+            pxIterator = pxList->xListEnd.pxPrevious;
+        }
+        else
+        {
+            xHeadValue = pxList->xListEnd.pxNext->xItemValue;
+
+            if( ( xHeadValue <= xValueOfInsertion ) && ( ( xValueOfInsertion - xHeadValue ) > ( xTailValue - xValueOfInsertion ) ) )
+            {
+                /* The head item's value is no greater than the new value, so this
+                 * loop ends at the head item at the latest. */
+                for( pxIterator = pxList->xListEnd.pxPrevious; pxIterator->xItemValue > xValueOfInsertion; pxIterator = pxIterator->pxPrevious )
+                {
+                    /* There is nothing to do here, just iterating back to the
+                     * last item with a value no greater than the new value. */
+                }
+            }
+            else
+            {
+                /* *** NOTE ***********************************************************
+                *  If you find your application is crashing here then likely causes are
+                *  listed below.  In addition see https://www.freertos.org/Why-FreeRTOS/FAQs for
+                *  more tips, and ensure configASSERT() is defined!
+                *  https://www.FreeRTOS.org/a00110.html#configASSERT
+                *
+                *   1) Stack overflow -
+                *      see https://www.FreeRTOS.org/Stacks-and-stack-overflow-checking.html
+                *   2) Incorrect interrupt priority assignment, especially on Cortex-M
+                *      parts where numerically high priority values denote low actual
+                *      interrupt priorities, which can seem counter intuitive.  See
+                *      https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html and the definition
+                *      of configMAX_SYSCALL_INTERRUPT_PRIORITY on
+                *      https://www.FreeRTOS.org/a00110.html
+                *   3) Calling an API function from within a critical section or when
+                *      the scheduler is suspended, or calling an API function that does
+                *      not end in "FromISR" from an interrupt.
+                *   4) Using a queue or semaphore before it has been initialised or
+                *      before the scheduler has been started (are interrupts firing
+                *      before vTaskStartScheduler() has been called?).
+                *   5) If the FreeRTOS port supports interrupt nesting then ensure that
+                *      the priority of the tick interrupt is at or below
+                *      configMAX_SYSCALL_INTERRUPT_PRIORITY.
+                **********************************************************************/
+
+                for( pxIterator = ( ListItem_t * ) &( pxList->xListEnd ); pxIterator->pxNext->xItemValue <= xValueOfInsertion; pxIterator = pxIterator->pxNext )
+                {
+                    /* There is nothing to do here, just iterating to the wanted
+                     * insertion position.
+                     * IF YOU FIND YOUR CODE STUCK HERE, SEE THE NOTE JUST ABOVE.
+                     */
+                }
+            }
         }
     }
 
@@ -213,6 +303,58 @@ void vListInsert( List_t * const pxList,
 }
 /*-----------------------------------------------------------*/
 
+void vListMerge( List_t * const pxList,
+                 List_t * const pxSortedList )
+{
+    ListItem_t * pxIterator = ( ListItem_t * ) &( pxList->xListEnd );
+    ListItem_t * pxNewListItem;
+
+    traceENTER_vListMerge( pxList, pxSortedList );
+
+    listTEST_LIST_INTEGRITY( pxList );
+    listTEST_LIST_INTEGRITY( pxSortedList );
+
+    while( listLIST_IS_EMPTY( pxSortedList ) == pdFALSE )
+    {
+        pxNewListItem = listGET_HEAD_ENTRY( pxSortedList );
+        ( void ) uxListRemove( pxNewListItem );
+
+        #if ( configUSE_SKIP_LISTS == 1 )
+            if( pxList->xIsSkipList != pdFALSE )
+            {
+                /* The item must also be linked into the skip list's lanes,
+                 * which vListInsert() does. */
+                vListInsert( pxList, pxNewListItem );
+            }
+            else
+        #endif /* configUSE_SKIP_LISTS */
+        {
+            /* The items of pxSortedList are in ascending order, so the search
+             * for each one carries on from where the last one was inserted and
+             * pxList is only walked once.  As in vListInsert(), an item is
+             * placed after any item already in the list with the same value. */
+            while( ( pxIterator->pxNext != ( ListItem_t * ) &( pxList->xListEnd ) ) &&
+                   ( pxIterator->pxNext->xItemValue <= pxNewListItem->xItemValue ) )
+            {
+                pxIterator = pxIterator->pxNext;
+            }
+
+            pxNewListItem->pxNext = pxIterator->pxNext;
+            pxNewListItem->pxNext->pxPrevious = pxNewListItem;
+            pxNewListItem->pxPrevious = pxIterator;
+            pxIterator->pxNext = pxNewListItem;
+            pxNewListItem->pxContainer = pxList;
+
+            ( pxList->uxNumberOfItems ) = ( UBaseType_t ) ( pxList->uxNumberOfItems + 1U );
+
+            pxIterator = pxNewListItem;
+        }
+    }
+
+    traceRETURN_vListMerge();
+}
+/*-----------------------------------------------------------*/
+
 
 UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
 {
@@ -224,6 +366,7 @@ UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
 
     pxItemToRemove->pxNext->pxPrevious = pxItemToRemove->pxPrevious;
     pxItemToRemove->pxPrevious->pxNext = pxItemToRemove->pxNext;
+    listREMOVE_SKIP_LANES( pxList, pxItemToRemove );
 
     /* Only used during decision coverage testing. */
     mtCOVERAGE_TEST_DELAY();
@@ -246,3 +389,179 @@ UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
     return pxList->uxNumberOfItems;
 }
 /*-----------------------------------------------------------*/
+
+#if ( configUSE_LIST_LINK_CHECKS > 0 )
+
+    BaseType_t xListCheckLinks( const List_t * const pxList )
+    {
+        const ListItem_t * const pxEnd = listGET_END_MARKER( pxList );
+        const ListItem_t * pxItem = pxEnd;
+        UBaseType_t uxItems = ( UBaseType_t ) 0U;
+        BaseType_t xIndexFound = pdFALSE;
+        BaseType_t xReturn = pdPASS;
+
+        traceENTER_xListCheckLinks( pxList );
+
+        if( pxList->pxIndex == pxEnd )
+        {
+            xIndexFound = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Following each item's pxNext pointer and checking the item it
+         * leads to points back checks every link in the list once.  No more
+         * items are followed than the list says it holds, so a loop that does
+         * not lead back to the end marker is found rather than followed
+         * forever. */
+        do
+        {
+            if( pxItem->pxNext->pxPrevious != pxItem )
+            {
+                xReturn = pdFAIL;
+            }
+            else
+            {
+                pxItem = pxItem->pxNext;
+
+                if( pxItem != pxEnd )
+                {
+                    if( ( uxItems == pxList->uxNumberOfItems ) || ( pxItem->pxContainer != pxList ) )
+                    {
+                        xReturn = pdFAIL;
+                    }
+                    else
+                    {
+                        if( pxItem == pxList->pxIndex )
+                        {
+                            xIndexFound = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        uxItems++;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        } while( ( xReturn == pdPASS ) && ( pxItem != pxEnd ) );
+
+        if( ( uxItems != pxList->uxNumberOfItems ) || ( xIndexFound == pdFALSE ) )
+        {
+            xReturn = pdFAIL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xListCheckLinks( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_LIST_LINK_CHECKS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SKIP_LISTS == 1 )
+
+    static ListItem_t * prvSkipListSearch( List_t * const pxList,
+                                           ListItem_t * const pxNewListItem )
+    {
+        ListItem_t * pxPreceding[ configSKIP_LIST_LANES ];
+        ListItem_t * pxIterator = NULL;
+        ListItem_t * pxNext;
+        ListItem_t * const pxListEnd = ( ListItem_t * ) &( pxList->xListEnd );
+        const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
+        UBaseType_t uxLane;
+        UBaseType_t uxLanes;
+        UBaseType_t uxInserts;
+
+        /* Walk each lane from the last item found in the lane above, or from
+         * the lane's head while no item has been found, to the last item with
+         * a value no greater than the new value.  A NULL iterator stands for
+         * the position before the first item.  As in the plain search, the
+         * new item goes after any items with the same value. */
+        for( uxLane = ( UBaseType_t ) configSKIP_LIST_LANES; uxLane > 0U; )
+        {
+            uxLane--;
+
+            pxNext = ( pxIterator == NULL ) ? pxList->pxSkipHead[ uxLane ] : pxIterator->pxSkipNext[ uxLane ];
+
+            while( ( pxNext != NULL ) && ( pxNext->xItemValue <= xValueOfInsertion ) )
+            {
+                pxIterator = pxNext;
+                pxNext = pxNext->pxSkipNext[ uxLane ];
+            }
+
+            pxPreceding[ uxLane ] = pxIterator;
+        }
+
+        /* Finish the search in the list itself.  The end marker is tested for
+         * explicitly as its value may equal the new value. */
+        if( pxIterator == NULL )
+        {
+            pxIterator = pxListEnd;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        while( ( pxIterator->pxNext != pxListEnd ) && ( pxIterator->pxNext->xItemValue <= xValueOfInsertion ) )
+        {
+            pxIterator = pxIterator->pxNext;
+        }
+
+        /* One in four items joins the lowest lane, one in sixteen also joins
+         * the lane above, and so on.  Deriving that from a count of the
+         * insertions, rather than from a random number, keeps list operations
+         * deterministic and free of shared state. */
+        pxList->uxSkipInserts++;
+        uxInserts = pxList->uxSkipInserts;
+
+        for( uxLanes = 0U; ( uxLanes < ( UBaseType_t ) configSKIP_LIST_LANES ) && ( ( uxInserts & 0x03U ) == 0U ); uxLanes++ )
+        {
+            uxInserts >>= 2U;
+        }
+
+        for( uxLane = 0U; uxLane < uxLanes; uxLane++ )
+        {
+            if( pxPreceding[ uxLane ] == NULL )
+            {
+                pxNext = pxList->pxSkipHead[ uxLane ];
+                pxList->pxSkipHead[ uxLane ] = pxNewListItem;
+            }
+            else
+            {
+                pxNext = pxPreceding[ uxLane ]->pxSkipNext[ uxLane ];
+                pxPreceding[ uxLane ]->pxSkipNext[ uxLane ] = pxNewListItem;
+            }
+
+            pxNewListItem->pxSkipNext[ uxLane ] = pxNext;
+            pxNewListItem->pxSkipPrevious[ uxLane ] = pxPreceding[ uxLane ];
+
+            if( pxNext != NULL )
+            {
+                pxNext->pxSkipPrevious[ uxLane ] = pxNewListItem;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        pxNewListItem->uxSkipLanes = uxLanes;
+
+        return pxIterator;
+    }
+
+#endif /* configUSE_SKIP_LISTS */
+/*-----------------------------------------------------------*/
@@ -0,0 +1,264 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "low_power.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include sleep state selection. This #if is closed at the very bottom of
+ * this file. If you want to include sleep state selection then ensure
+ * configUSE_SLEEP_STATES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_SLEEP_STATES == 1 )
+
+/* Recorded in the idle period history for idle periods that lasted as long as
+ * expected, so were not ended by an interrupt. */
+    #define lowpowerFULL_IDLE_PERIOD    portMAX_DELAY
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Predicts how long the idle period about to be entered will last.  The idle
+ * period cannot last longer than xExpectedIdleTime, the time until the next
+ * task unblocks, but is predicted to be shorter if interrupts ended at least
+ * half of the recent idle periods early - in which case the prediction is the
+ * mean length of those shortened periods.
+ */
+    static TickType_t prvPredictIdleTime( TickType_t xExpectedIdleTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the deepest registered sleep state whose entry latency, exit latency
+ * and target residency together fit within xPredictedIdleTime, or the
+ * shallowest state if none fit.
+ */
+    static const SleepState_t * prvSelectSleepState( TickType_t xPredictedIdleTime ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The registered sleep states, ordered from shallowest to deepest. */
+    PRIVILEGED_DATA static const SleepState_t * pxRegisteredSleepStates = NULL;
+    PRIVILEGED_DATA static UBaseType_t uxNumberOfSleepStates = 0U;
+
+/* The state selected for the idle period being entered. */
+    PRIVILEGED_DATA static const SleepState_t * volatile pxSelectedSleepState = NULL;
+
+/* The length of each of the most recent idle periods that an interrupt ended
+ * early, or lowpowerFULL_IDLE_PERIOD for those that lasted as long as
+ * expected.  Written circularly. */
+    PRIVILEGED_DATA static TickType_t xIdlePeriodHistory[ configSLEEP_STATE_HISTORY_LENGTH ];
+    PRIVILEGED_DATA static UBaseType_t uxNextIdlePeriod = 0U;
+
+/*-----------------------------------------------------------*/
+
+    void vLowPowerRegisterSleepStates( const SleepState_t * pxSleepStates,
+                                       UBaseType_t uxNumberOfStates )
+    {
+        UBaseType_t x;
+
+        traceENTER_vLowPowerRegisterSleepStates( pxSleepStates, uxNumberOfStates );
+
+        configASSERT( pxSleepStates );
+        configASSERT( uxNumberOfStates > 0U );
+
+        /* Each state must be deeper, so draw less power, than the state before
+         * it. */
+        for( x = 1U; x < uxNumberOfStates; x++ )
+        {
+            configASSERT( pxSleepStates[ x ].ulPowerUw < pxSleepStates[ x - 1U ].ulPowerUw );
+        }
+
+        for( x = 0U; x < ( UBaseType_t ) configSLEEP_STATE_HISTORY_LENGTH; x++ )
+        {
+            xIdlePeriodHistory[ x ] = lowpowerFULL_IDLE_PERIOD;
+        }
+
+        uxNextIdlePeriod = 0U;
+        pxRegisteredSleepStates = pxSleepStates;
+        uxNumberOfSleepStates = uxNumberOfStates;
+
+        traceRETURN_vLowPowerRegisterSleepStates();
+    }
+/*-----------------------------------------------------------*/
+
+    const SleepState_t * pxLowPowerGetSelectedState( void )
+    {
+        traceENTER_pxLowPowerGetSelectedState();
+
+        traceRETURN_pxLowPowerGetSelectedState( pxSelectedSleepState );
+
+        return pxSelectedSleepState;
+    }
+/*-----------------------------------------------------------*/
+
+    void vLowPowerSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+    {
+        TickType_t xPredictedIdleTime;
+        TickType_t xIdleStartTime;
+        TickType_t xIdleTime;
+
+        if( pxRegisteredSleepStates == NULL )
+        {
+            portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
+        }
+        else
+        {
+            xPredictedIdleTime = prvPredictIdleTime( xExpectedIdleTime );
+            pxSelectedSleepState = prvSelectSleepState( xPredictedIdleTime );
+            traceLOW_POWER_SLEEP_STATE_SELECTED( pxSelectedSleepState, xPredictedIdleTime );
+
+            /* The scheduler is suspended, so the tick count only changes when
+             * the sleep function steps it past the ticks that were suppressed. */
+            xIdleStartTime = xTaskGetTickCount();
+
+            if( pxSelectedSleepState->pxSuppressTicksAndSleep != NULL )
+            {
+                pxSelectedSleepState->pxSuppressTicksAndSleep( xExpectedIdleTime );
+            }
+            else
+            {
+                portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
+            }
+
+            xIdleTime = xTaskGetTickCount() - xIdleStartTime;
+
+            /* A sleep that lasts its full length steps the tick count by one
+             * less than the expected idle time, as the final tick is pended
+             * by the tick interrupt that ends it.  Anything shorter was ended
+             * by another interrupt. */
+            if( ( xIdleTime + ( TickType_t ) 1 ) < xExpectedIdleTime )
+            {
+                xIdlePeriodHistory[ uxNextIdlePeriod ] = xIdleTime;
+            }
+            else
+            {
+                xIdlePeriodHistory[ uxNextIdlePeriod ] = lowpowerFULL_IDLE_PERIOD;
+            }
+
+            uxNextIdlePeriod++;
+
+            if( uxNextIdlePeriod >= ( UBaseType_t ) configSLEEP_STATE_HISTORY_LENGTH )
+            {
+                uxNextIdlePeriod = 0U;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxSelectedSleepState = NULL;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvPredictIdleTime( TickType_t xExpectedIdleTime )
+    {
+        TickType_t xPredictedIdleTime = xExpectedIdleTime;
+        uint64_t ullShortenedTotal = 0U;
+        UBaseType_t uxShortenedPeriods = 0U;
+        UBaseType_t x;
+
+        for( x = 0U; x < ( UBaseType_t ) configSLEEP_STATE_HISTORY_LENGTH; x++ )
+        {
+            if( xIdlePeriodHistory[ x ] != lowpowerFULL_IDLE_PERIOD )
+            {
+                ullShortenedTotal += ( uint64_t ) xIdlePeriodHistory[ x ];
+                uxShortenedPeriods++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* Only trust the interrupt history if interrupts are ending most idle
+         * periods, so one stray interrupt does not keep the processor out of
+         * its deeper states. */
+        if( ( uxShortenedPeriods * 2U ) >= ( UBaseType_t ) configSLEEP_STATE_HISTORY_LENGTH )
+        {
+            ullShortenedTotal /= ( uint64_t ) uxShortenedPeriods;
+
+            if( ullShortenedTotal < ( uint64_t ) xExpectedIdleTime )
+            {
+                xPredictedIdleTime = ( TickType_t ) ullShortenedTotal;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xPredictedIdleTime;
+    }
+/*-----------------------------------------------------------*/
+
+    static const SleepState_t * prvSelectSleepState( TickType_t xPredictedIdleTime )
+    {
+        const SleepState_t * pxState;
+        uint64_t ullPredictedIdleTimeUs;
+        uint64_t ullStateCostUs;
+        UBaseType_t x;
+
+        ullPredictedIdleTimeUs = ( ( uint64_t ) xPredictedIdleTime * 1000000U ) / ( uint64_t ) configTICK_RATE_HZ;
+
+        /* Search from the deepest state to the shallowest.  The shallowest
+         * state is used if no other state fits. */
+        for( x = uxNumberOfSleepStates - 1U; x > 0U; x-- )
+        {
+            pxState = &( pxRegisteredSleepStates[ x ] );
+            ullStateCostUs = ( uint64_t ) pxState->ulEntryLatencyUs + ( uint64_t ) pxState->ulExitLatencyUs + ( uint64_t ) pxState->ulTargetResidencyUs;
+
+            if( ullStateCostUs <= ullPredictedIdleTimeUs )
+            {
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return &( pxRegisteredSleepStates[ x ] );
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_SLEEP_STATES */
@@ -0,0 +1,881 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "object_pool.h"
+
+#if ( ( configUSE_OBJECT_POOLS == 1 ) && ( configUSE_LOCK_FREE_POOLS == 1 ) )
+    #include "atomic.h"
+#endif
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include object pool functionality. This #if is closed at the very bottom
+ * of this file. If you want to include object pools then ensure
+ * configUSE_OBJECT_POOLS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_OBJECT_POOLS == 1 )
+
+    #if ( configUSE_LOCK_FREE_POOLS == 1 )
+
+/* A lock free pool links its free items by index rather than by pointer so the
+ * head of the free list and a tag that changes each time the head changes fit
+ * in the 32-bit word updated by a single compare and swap.  The tag stops an
+ * item that was popped and pushed again between another context reading the
+ * head and swapping it being mistaken for an unchanged head. */
+        #define poolFREE_LIST_INDEX_MASK    ( ( uint32_t ) 0x0000FFFFUL )
+        #define poolFREE_LIST_TAG_MASK      ( ( uint32_t ) 0xFFFF0000UL )
+        #define poolFREE_LIST_TAG_ONE       ( ( uint32_t ) 0x00010000UL )
+        #define poolMAX_ITEM_COUNT          ( ( UBaseType_t ) 0xFFFEU )
+
+        #define poolITEM_COUNT_IS_VALID( uxItemCount ) \
+    ( ( ( uxItemCount ) > ( UBaseType_t ) 0 ) && ( ( uxItemCount ) <= poolMAX_ITEM_COUNT ) )
+
+/* Evaluates to a non-zero value if *pulDestination held ulComparand and was
+ * atomically set to ulExchange. */
+        #ifdef portATOMIC_COMPARE_AND_SWAP_U32
+            #define poolCOMPARE_AND_SWAP( pulDestination, ulExchange, ulComparand )    portATOMIC_COMPARE_AND_SWAP_U32( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
+        #else
+            #define poolCOMPARE_AND_SWAP( pulDestination, ulExchange, ulComparand )    Atomic_CompareAndSwap_u32( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
+        #endif
+    #else /* if ( configUSE_LOCK_FREE_POOLS == 1 ) */
+        #define poolITEM_COUNT_IS_VALID( uxItemCount )    ( ( uxItemCount ) > ( UBaseType_t ) 0 )
+    #endif /* if ( configUSE_LOCK_FREE_POOLS == 1 ) */
+
+    typedef struct PoolDef_t
+    {
+        uint8_t * pucStorage;        /**< Points to the first item in the pool. */
+        #if ( configUSE_LOCK_FREE_POOLS == 1 )
+            volatile uint32_t ulFreeList; /**< One more than the index of the item freed most recently in the low half word, the tag in the high half word. */
+        #else
+            void * pvFreeList;            /**< Items that have been freed, each holding a pointer to the next. */
+        #endif
+        size_t xItemSize;            /**< The number of bytes each item occupies, see poolITEM_STORAGE_SIZE(). */
+        UBaseType_t uxItemCount;     /**< The number of items in the pool. */
+        #if ( configUSE_LOCK_FREE_POOLS == 1 )
+            volatile uint32_t ulItemsUsed;     /**< Items from this index on have never been allocated, so are not in ulFreeList. */
+            volatile uint32_t ulFreeItemCount; /**< The number of items that are neither allocated nor reserved by an allocation in progress. */
+        #else
+            UBaseType_t uxItemsUsed;     /**< Items from this index on have never been allocated, so are not in pvFreeList. */
+            UBaseType_t uxFreeItemCount; /**< The number of items that are not allocated. */
+        #endif
+
+        #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+            uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the pool is statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+    } Pool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by both xPoolCreate() and xPoolCreateStatic() to set up the pool's
+ * data structure.
+ */
+    static void prvInitialiseNewPool( Pool_t * const pxPool,
+                                      uint8_t * const pucStorage,
+                                      const size_t xItemSize,
+                                      const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes an item from, or returns an item to, the pool.  Must be called from a
+ * critical section unless configUSE_LOCK_FREE_POOLS is 1, in which case they
+ * can be called from any task or interrupt without one.
+ */
+    static void * prvTakeItem( Pool_t * const pxPool ) PRIVILEGED_FUNCTION;
+    static void prvReturnItem( Pool_t * const pxPool,
+                               void * pvItem ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        PoolHandle_t xPoolCreate( size_t xItemSize,
+                                  UBaseType_t uxItemCount )
+        {
+            Pool_t * pxNewPool = NULL;
+            const size_t xItemStorageSize = poolITEM_STORAGE_SIZE( xItemSize );
+            const size_t xStructSize = ( sizeof( Pool_t ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+            traceENTER_xPoolCreate( xItemSize, uxItemCount );
+
+            configASSERT( xItemSize > ( size_t ) 0 );
+            configASSERT( poolITEM_COUNT_IS_VALID( uxItemCount ) );
+
+            if( ( xItemSize > ( size_t ) 0 ) &&
+                ( poolITEM_COUNT_IS_VALID( uxItemCount ) ) &&
+                /* Check the item size was not so large that rounding it up
+                 * overflowed. */
+                ( xItemStorageSize >= xItemSize ) &&
+                /* Check for multiplication overflow. */
+                ( ( ( SIZE_MAX - xStructSize ) / xItemStorageSize ) >= ( size_t ) uxItemCount ) )
+            {
+                /* The pool structure and the items are allocated in one
+                 * block, with the items starting on an aligned boundary after
+                 * the structure. */
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxNewPool = ( Pool_t * ) pvPortMalloc( xStructSize + ( ( size_t ) uxItemCount * xItemStorageSize ) );
+
+                if( pxNewPool != NULL )
+                {
+                    prvInitialiseNewPool( pxNewPool, ( ( uint8_t * ) pxNewPool ) + xStructSize, xItemStorageSize, uxItemCount );
+
+                    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                    {
+                        /* Both static and dynamic allocation can be used, so
+                         * note this pool was allocated dynamically in case the
+                         * pool is later deleted. */
+                        pxNewPool->ucStaticallyAllocated = pdFALSE;
+                    }
+                    #endif /* configSUPPORT_STATIC_ALLOCATION */
+
+                    tracePOOL_CREATE( pxNewPool );
+                }
+                else
+                {
+                    tracePOOL_CREATE_FAILED( xItemSize, uxItemCount );
+                }
+            }
+            else
+            {
+                tracePOOL_CREATE_FAILED( xItemSize, uxItemCount );
+            }
+
+            traceRETURN_xPoolCreate( pxNewPool );
+
+            return pxNewPool;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        PoolHandle_t xPoolCreateStatic( size_t xItemSize,
+                                        UBaseType_t uxItemCount,
+                                        uint8_t * pucPoolStorageBuffer,
+                                        StaticPool_t * pxStaticPool )
+        {
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            Pool_t * const pxNewPool = ( Pool_t * ) pxStaticPool;
+            PoolHandle_t xReturn = NULL;
+
+            traceENTER_xPoolCreateStatic( xItemSize, uxItemCount, pucPoolStorageBuffer, pxStaticPool );
+
+            configASSERT( pucPoolStorageBuffer );
+            configASSERT( pxStaticPool );
+            configASSERT( xItemSize > ( size_t ) 0 );
+            configASSERT( poolITEM_COUNT_IS_VALID( uxItemCount ) );
+            configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pucPoolStorageBuffer ) & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0U );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticPool_t equals the size of the real pool
+                 * structure. */
+                volatile size_t xSize = sizeof( StaticPool_t );
+                configASSERT( xSize == sizeof( Pool_t ) );
+            }
+            #endif /* configASSERT_DEFINED */
+
+            if( ( pucPoolStorageBuffer != NULL ) && ( pxStaticPool != NULL ) && ( xItemSize > ( size_t ) 0 ) && ( poolITEM_COUNT_IS_VALID( uxItemCount ) ) )
+            {
+                prvInitialiseNewPool( pxNewPool, pucPoolStorageBuffer, poolITEM_STORAGE_SIZE( xItemSize ), uxItemCount );
+
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note
+                     * this pool was allocated statically in case the pool is
+                     * later deleted. */
+                    pxNewPool->ucStaticallyAllocated = pdTRUE;
+                }
+                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+                tracePOOL_CREATE( pxNewPool );
+
+                xReturn = pxNewPool;
+            }
+            else
+            {
+                tracePOOL_CREATE_FAILED( xItemSize, uxItemCount );
+            }
+
+            traceRETURN_xPoolCreateStatic( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_LOCK_FREE_POOLS == 1 )
+
+        static void prvInitialiseNewPool( Pool_t * const pxPool,
+                                          uint8_t * const pucStorage,
+                                          const size_t xItemSize,
+                                          const UBaseType_t uxItemCount ) /* PRIVILEGED_FUNCTION */
+        {
+            pxPool->pucStorage = pucStorage;
+            pxPool->ulFreeList = 0U;
+            pxPool->xItemSize = xItemSize;
+            pxPool->uxItemCount = uxItemCount;
+            pxPool->ulItemsUsed = 0U;
+            pxPool->ulFreeItemCount = ( uint32_t ) uxItemCount;
+        }
+/*-----------------------------------------------------------*/
+
+        static void * prvTakeItem( Pool_t * const pxPool ) /* PRIVILEGED_FUNCTION */
+        {
+            uint32_t ulCount;
+            uint32_t ulHead;
+            uint32_t ulNext;
+            uint32_t ulUsed;
+            uint8_t * pucItem;
+            void * pvItem = NULL;
+            BaseType_t xReserved = pdFALSE;
+
+            /* First reserve an item by decrementing the free item count.  Items
+             * are only counted as free once they are back in the free list, so
+             * a reservation guarantees an item is in the free list or has never
+             * been used, even if other contexts reserved items first. */
+            ulCount = pxPool->ulFreeItemCount;
+
+            while( ( ulCount != 0U ) && ( xReserved == pdFALSE ) )
+            {
+                if( poolCOMPARE_AND_SWAP( &( pxPool->ulFreeItemCount ), ulCount - 1U, ulCount ) != 0U )
+                {
+                    xReserved = pdTRUE;
+                }
+                else
+                {
+                    ulCount = pxPool->ulFreeItemCount;
+                }
+            }
+
+            while( ( xReserved != pdFALSE ) && ( pvItem == NULL ) )
+            {
+                ulHead = pxPool->ulFreeList;
+
+                if( ( ulHead & poolFREE_LIST_INDEX_MASK ) != 0U )
+                {
+                    /* Pop the item freed most recently.  The link read from the
+                     * item is stale if another context popped it in the
+                     * meantime, but then the tag has changed and the swap
+                     * fails. */
+                    pucItem = &( pxPool->pucStorage[ ( size_t ) ( ( ulHead & poolFREE_LIST_INDEX_MASK ) - 1U ) * pxPool->xItemSize ] );
+
+                    /* MISRA Ref 11.3.1 [Misaligned access] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                    /* coverity[misra_c_2012_rule_11_3_violation] */
+                    ulNext = *( ( volatile uint32_t * ) pucItem );
+
+                    if( poolCOMPARE_AND_SWAP( &( pxPool->ulFreeList ), ( ( ulHead & poolFREE_LIST_TAG_MASK ) + poolFREE_LIST_TAG_ONE ) | ulNext, ulHead ) != 0U )
+                    {
+                        pvItem = ( void * ) pucItem;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Use an item that has never been allocated.  If there are
+                     * none then the reserved item is being pushed onto the free
+                     * list by another core, so try again. */
+                    ulUsed = pxPool->ulItemsUsed;
+
+                    if( ( ulUsed < ( uint32_t ) pxPool->uxItemCount ) &&
+                        ( poolCOMPARE_AND_SWAP( &( pxPool->ulItemsUsed ), ulUsed + 1U, ulUsed ) != 0U ) )
+                    {
+                        pvItem = ( void * ) &( pxPool->pucStorage[ ( size_t ) ulUsed * pxPool->xItemSize ] );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+
+            return pvItem;
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvReturnItem( Pool_t * const pxPool,
+                                   void * pvItem ) /* PRIVILEGED_FUNCTION */
+        {
+            const uint32_t ulIndex = ( uint32_t ) ( ( size_t ) ( ( uint8_t * ) pvItem - pxPool->pucStorage ) / pxPool->xItemSize ) + 1U;
+            uint32_t ulHead;
+            uint32_t ulCount;
+
+            /* Push the item onto the free list before counting it as free, so
+             * an allocation that reserves it is sure to find it. */
+            do
+            {
+                ulHead = pxPool->ulFreeList;
+
+                /* MISRA Ref 11.5.5 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                *( ( volatile uint32_t * ) pvItem ) = ulHead & poolFREE_LIST_INDEX_MASK;
+            } while( poolCOMPARE_AND_SWAP( &( pxPool->ulFreeList ), ( ( ulHead & poolFREE_LIST_TAG_MASK ) + poolFREE_LIST_TAG_ONE ) | ulIndex, ulHead ) == 0U );
+
+            do
+            {
+                ulCount = pxPool->ulFreeItemCount;
+                configASSERT( ulCount < ( uint32_t ) pxPool->uxItemCount );
+            } while( poolCOMPARE_AND_SWAP( &( pxPool->ulFreeItemCount ), ulCount + 1U, ulCount ) == 0U );
+        }
+/*-----------------------------------------------------------*/
+
+    #else /* if ( configUSE_LOCK_FREE_POOLS == 1 ) */
+
+        static void prvInitialiseNewPool( Pool_t * const pxPool,
+                                          uint8_t * const pucStorage,
+                                          const size_t xItemSize,
+                                          const UBaseType_t uxItemCount ) /* PRIVILEGED_FUNCTION */
+        {
+            /* The items are only linked into the free list as they are freed, so
+             * creating a pool takes the same time no matter how many items it
+             * holds. */
+            pxPool->pucStorage = pucStorage;
+            pxPool->pvFreeList = NULL;
+            pxPool->xItemSize = xItemSize;
+            pxPool->uxItemCount = uxItemCount;
+            pxPool->uxItemsUsed = 0;
+            pxPool->uxFreeItemCount = uxItemCount;
+        }
+/*-----------------------------------------------------------*/
+
+        static void * prvTakeItem( Pool_t * const pxPool ) /* PRIVILEGED_FUNCTION */
+        {
+            void * pvItem = NULL;
+
+            if( pxPool->pvFreeList != NULL )
+            {
+                /* Reuse the item freed most recently. */
+                pvItem = pxPool->pvFreeList;
+
+                /* MISRA Ref 11.5.5 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxPool->pvFreeList = *( ( void ** ) pvItem );
+            }
+            else if( pxPool->uxItemsUsed < pxPool->uxItemCount )
+            {
+                /* Use an item that has never been allocated. */
+                pvItem = ( void * ) &( pxPool->pucStorage[ ( size_t ) pxPool->uxItemsUsed * pxPool->xItemSize ] );
+                pxPool->uxItemsUsed++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pvItem != NULL )
+            {
+                pxPool->uxFreeItemCount--;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return pvItem;
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvReturnItem( Pool_t * const pxPool,
+                                   void * pvItem ) /* PRIVILEGED_FUNCTION */
+        {
+            /* MISRA Ref 11.5.5 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            *( ( void ** ) pvItem ) = pxPool->pvFreeList;
+            pxPool->pvFreeList = pvItem;
+            pxPool->uxFreeItemCount++;
+            configASSERT( pxPool->uxFreeItemCount <= pxPool->uxItemCount );
+        }
+
+    #endif /* if ( configUSE_LOCK_FREE_POOLS == 1 ) */
+/*-----------------------------------------------------------*/
+
+    void * pvPoolAllocate( PoolHandle_t xPool )
+    {
+        Pool_t * const pxPool = xPool;
+        void * pvReturn;
+
+        traceENTER_pvPoolAllocate( xPool );
+
+        configASSERT( pxPool );
+
+        #if ( configUSE_LOCK_FREE_POOLS == 1 )
+        {
+            pvReturn = prvTakeItem( pxPool );
+        }
+        #else
+        {
+            taskENTER_CRITICAL();
+            {
+                pvReturn = prvTakeItem( pxPool );
+            }
+            taskEXIT_CRITICAL();
+        }
+        #endif
+
+        traceRETURN_pvPoolAllocate( pvReturn );
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void * pvPoolAllocateFromISR( PoolHandle_t xPool )
+    {
+        Pool_t * const pxPool = xPool;
+        void * pvReturn;
+
+        traceENTER_pvPoolAllocateFromISR( xPool );
+
+        configASSERT( pxPool );
+
+        #if ( configUSE_LOCK_FREE_POOLS == 1 )
+        {
+            pvReturn = prvTakeItem( pxPool );
+        }
+        #else
+        {
+            UBaseType_t uxSavedInterruptStatus;
+
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                pvReturn = prvTakeItem( pxPool );
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        #endif
+
+        traceRETURN_pvPoolAllocateFromISR( pvReturn );
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPoolFree( PoolHandle_t xPool,
+                    void * pvItem )
+    {
+        Pool_t * const pxPool = xPool;
+
+        traceENTER_vPoolFree( xPool, pvItem );
+
+        configASSERT( pxPool );
+        configASSERT( xPoolIsItemFromPool( xPool, pvItem ) != pdFALSE );
+
+        #if ( configUSE_LOCK_FREE_POOLS == 1 )
+        {
+            prvReturnItem( pxPool, pvItem );
+        }
+        #else
+        {
+            taskENTER_CRITICAL();
+            {
+                prvReturnItem( pxPool, pvItem );
+            }
+            taskEXIT_CRITICAL();
+        }
+        #endif
+
+        traceRETURN_vPoolFree();
+    }
+/*-----------------------------------------------------------*/
+
+    void vPoolFreeFromISR( PoolHandle_t xPool,
+                           void * pvItem )
+    {
+        Pool_t * const pxPool = xPool;
+
+        traceENTER_vPoolFreeFromISR( xPool, pvItem );
+
+        configASSERT( pxPool );
+        configASSERT( xPoolIsItemFromPool( xPool, pvItem ) != pdFALSE );
+
+        #if ( configUSE_LOCK_FREE_POOLS == 1 )
+        {
+            prvReturnItem( pxPool, pvItem );
+        }
+        #else
+        {
+            UBaseType_t uxSavedInterruptStatus;
+
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                prvReturnItem( pxPool, pvItem );
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        #endif
+
+        traceRETURN_vPoolFreeFromISR();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPoolIsItemFromPool( PoolHandle_t xPool,
+                                    const void * pvItem )
+    {
+        Pool_t const * const pxPool = xPool;
+        const uint8_t * const pucItem = ( const uint8_t * ) pvItem;
+        BaseType_t xReturn = pdFALSE;
+
+        traceENTER_xPoolIsItemFromPool( xPool, pvItem );
+
+        configASSERT( pxPool );
+
+        /* The pool's storage and item size do not change after the pool is
+         * created, so no critical section is needed. */
+        if( ( pucItem >= pxPool->pucStorage ) &&
+            ( pucItem < &( pxPool->pucStorage[ ( size_t ) pxPool->uxItemCount * pxPool->xItemSize ] ) ) )
+        {
+            /* The item must also start on an item boundary. */
+            if( ( ( size_t ) ( pucItem - pxPool->pucStorage ) % pxPool->xItemSize ) == ( size_t ) 0 )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xPoolIsItemFromPool( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxPoolGetFreeItemCount( PoolHandle_t xPool )
+    {
+        Pool_t const * const pxPool = xPool;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxPoolGetFreeItemCount( xPool );
+
+        configASSERT( pxPool );
+
+        #if ( configUSE_LOCK_FREE_POOLS == 1 )
+        {
+            uxReturn = ( UBaseType_t ) pxPool->ulFreeItemCount;
+        }
+        #else
+        {
+            uxReturn = pxPool->uxFreeItemCount;
+        }
+        #endif
+
+        traceRETURN_uxPoolGetFreeItemCount( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPoolDelete( PoolHandle_t xPool )
+    {
+        Pool_t * const pxPool = xPool;
+
+        traceENTER_vPoolDelete( xPool );
+
+        configASSERT( pxPool );
+
+        tracePOOL_DELETE( pxPool );
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            /* The pool can only have been allocated dynamically - free it
+             * again. */
+            vPortFree( pxPool );
+        }
+        #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            /* The pool could have been allocated statically or dynamically, so
+             * check before attempting to free the memory. */
+            if( pxPool->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxPool );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) ) */
+        {
+            /* The pool must have been statically allocated, so is not going to
+             * be deleted.  Avoid compiler warnings about the unused parameter. */
+            ( void ) pxPool;
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+        traceRETURN_vPoolDelete();
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configKERNEL_OBJECT_POOLS == 1 )
+
+        void * pvPoolAllocateKernelObject( PoolHandle_t * pxPool,
+                                           size_t xObjectSize,
+                                           UBaseType_t uxPoolLength )
+        {
+            PoolHandle_t xNewPool;
+            void * pvReturn = NULL;
+
+            if( ( *pxPool == NULL ) && ( uxPoolLength > ( UBaseType_t ) 0 ) )
+            {
+                /* The pool is created the first time an object of its type is
+                 * created.  Two tasks could get here at once, in which case
+                 * the pool created second is not needed. */
+                xNewPool = xPoolCreate( xObjectSize, uxPoolLength );
+
+                if( xNewPool != NULL )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        if( *pxPool == NULL )
+                        {
+                            *pxPool = xNewPool;
+                            xNewPool = NULL;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    taskEXIT_CRITICAL();
+
+                    if( xNewPool != NULL )
+                    {
+                        vPoolDelete( xNewPool );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( *pxPool != NULL )
+            {
+                pvReturn = pvPoolAllocate( *pxPool );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pvReturn == NULL )
+            {
+                /* The pool is exhausted, or could not be created, so fall back
+                 * to the heap. */
+                pvReturn = pvPortMalloc( xObjectSize );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return pvReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        void vPoolFreeKernelObject( PoolHandle_t xPool,
+                                    void * pvObject )
+        {
+            if( ( xPool != NULL ) && ( xPoolIsItemFromPool( xPool, pvObject ) != pdFALSE ) )
+            {
+                vPoolFree( xPool, pvObject );
+            }
+            else
+            {
+                vPortFree( pvObject );
+            }
+        }
+
+    #endif /* configKERNEL_OBJECT_POOLS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ISR_HEAP == 1 )
+
+/* The pools registered with xPortISRHeapAddPool(), ordered by item size so
+ * pvPortMallocFromISR() tries the smallest pool that fits first. */
+        static PoolHandle_t xISRHeapPools[ configISR_HEAP_MAX_POOLS ] = { NULL };
+        static UBaseType_t uxISRHeapPoolCount = 0;
+
+/*-----------------------------------------------------------*/
+
+        BaseType_t xPortISRHeapAddPool( PoolHandle_t xPool )
+        {
+            Pool_t const * const pxPool = xPool;
+            UBaseType_t uxIndex;
+            BaseType_t xReturn = pdFAIL;
+
+            traceENTER_xPortISRHeapAddPool( xPool );
+
+            configASSERT( pxPool );
+
+            taskENTER_CRITICAL();
+            {
+                if( uxISRHeapPoolCount < ( UBaseType_t ) configISR_HEAP_MAX_POOLS )
+                {
+                    /* Shift the pools with larger items up to make room. */
+                    for( uxIndex = uxISRHeapPoolCount; uxIndex > ( UBaseType_t ) 0; uxIndex-- )
+                    {
+                        if( xISRHeapPools[ uxIndex - 1U ]->xItemSize > pxPool->xItemSize )
+                        {
+                            xISRHeapPools[ uxIndex ] = xISRHeapPools[ uxIndex - 1U ];
+                        }
+                        else
+                        {
+                            break;
+                        }
+                    }
+
+                    xISRHeapPools[ uxIndex ] = xPool;
+                    uxISRHeapPoolCount++;
+                    xReturn = pdPASS;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            traceRETURN_xPortISRHeapAddPool( xReturn );
+
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        void * pvPortMallocFromISR( size_t xWantedSize )
+        {
+            UBaseType_t uxIndex;
+            void * pvReturn = NULL;
+
+            traceENTER_pvPortMallocFromISR( xWantedSize );
+
+            /* Fall through to pools with larger items if every pool with items
+             * that are large enough is exhausted. */
+            for( uxIndex = 0; ( uxIndex < uxISRHeapPoolCount ) && ( pvReturn == NULL ); uxIndex++ )
+            {
+                if( xISRHeapPools[ uxIndex ]->xItemSize >= xWantedSize )
+                {
+                    pvReturn = pvPoolAllocateFromISR( xISRHeapPools[ uxIndex ] );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            traceRETURN_pvPortMallocFromISR( pvReturn );
+
+            return pvReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        void vPortFreeFromISR( void * pv )
+        {
+            UBaseType_t uxIndex;
+            BaseType_t xFreed = pdFALSE;
+
+            traceENTER_vPortFreeFromISR( pv );
+
+            if( pv != NULL )
+            {
+                for( uxIndex = 0; ( uxIndex < uxISRHeapPoolCount ) && ( xFreed == pdFALSE ); uxIndex++ )
+                {
+                    if( xPoolIsItemFromPool( xISRHeapPools[ uxIndex ], pv ) != pdFALSE )
+                    {
+                        vPoolFreeFromISR( xISRHeapPools[ uxIndex ], pv );
+                        xFreed = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                /* The block was not allocated by pvPortMallocFromISR(). */
+                configASSERT( xFreed != pdFALSE );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_vPortFreeFromISR();
+        }
+
+    #endif /* configUSE_ISR_HEAP */
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include object pool functionality. If you want to include object pools
+ * then ensure configUSE_OBJECT_POOLS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_OBJECT_POOLS == 1 */
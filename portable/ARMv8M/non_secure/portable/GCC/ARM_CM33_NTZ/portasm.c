@@ -82,10 +82,12 @@
                 "    str r3, [r1]                                 \n" /* Program RNR = 8. */
                 "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
                 "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
-                "    movs r3, #12                                 \n" /* r3 = 12. */
-                "    str r3, [r1]                                 \n" /* Program RNR = 12. */
-                "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
-                "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
+                #if ( configUSE_SHARED_MPU_REGIONS == 0 )
+                    "    movs r3, #12                                 \n" /* r3 = 12. */
+                    "    str r3, [r1]                                 \n" /* Program RNR = 12. */
+                    "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
+                    "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
+                #endif /* configUSE_SHARED_MPU_REGIONS == 0 */
             #endif /* configTOTAL_MPU_REGIONS == 16 */
             "                                                 \n"
             "   ldr r1, =0xe000ed94                           \n" /* r1 = 0xe000ed94 [Location of MPU_CTRL]. */
@@ -293,6 +295,14 @@ void vClearInterruptMask( __attribute__( ( unused ) ) uint32_t ulMask ) /* __att
             " program_mpu:                                    \n"
             "    ldr r2, =pxCurrentTCB                        \n" /* Read the location of pxCurrentTCB i.e. &( pxCurrentTCB ). */
             "    ldr r0, [r2]                                 \n" /* r0 = pxCurrentTCB. */
+            #if ( configUSE_MPU_SETTINGS_CACHE == 1 )
+                "    adds r3, r0, #4                              \n" /* r3 = &( pxCurrentTCB->xMPUSettings ). */
+                "    ldr r1, =pxProgrammedMPUSettings             \n" /* Read the location of pxProgrammedMPUSettings i.e. &( pxProgrammedMPUSettings ). */
+                "    ldr r2, [r1]                                 \n" /* r2 = pxProgrammedMPUSettings. */
+                "    cmp r2, r3                                   \n"
+                "    beq restore_context                          \n" /* The MPU already holds the task's regions. */
+                "    str r3, [r1]                                 \n" /* pxProgrammedMPUSettings = &( pxCurrentTCB->xMPUSettings ). */
+            #endif /* configUSE_MPU_SETTINGS_CACHE */
             "                                                 \n"
             "    dmb                                          \n" /* Complete outstanding transfers before disabling MPU. */
             "    ldr r1, =0xe000ed94                          \n" /* r1 = 0xe000ed94 [Location of MPU_CTRL]. */
@@ -319,10 +329,12 @@ void vClearInterruptMask( __attribute__( ( unused ) ) uint32_t ulMask ) /* __att
                 "    str r3, [r1]                                 \n" /* Program RNR = 8. */
                 "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
                 "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
-                "    movs r3, #12                                 \n" /* r3 = 12. */
-                "    str r3, [r1]                                 \n" /* Program RNR = 12. */
-                "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
-                "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
+                #if ( configUSE_SHARED_MPU_REGIONS == 0 )
+                    "    movs r3, #12                                 \n" /* r3 = 12. */
+                    "    str r3, [r1]                                 \n" /* Program RNR = 12. */
+                    "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
+                    "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
+                #endif /* configUSE_SHARED_MPU_REGIONS == 0 */
             #endif /* configTOTAL_MPU_REGIONS == 16 */
             "                                                 \n"
             "   ldr r1, =0xe000ed94                           \n" /* r1 = 0xe000ed94 [Location of MPU_CTRL]. */
@@ -63,6 +63,22 @@
  */
     #define INDEX_OFFSET    1
 
+/**
+ * @brief Layout of the handles returned to the user.
+ *
+ * The low 16 bits hold the external index and the next 15 bits hold the
+ * generation of the pool slot.  The generation of a slot is incremented when
+ * the slot is freed, so a stale handle to a deleted object is rejected
+ * instead of reaching an object later created in the same slot.
+ */
+    #define HANDLE_INDEX_MASK          ( 0xFFFFUL )
+    #define HANDLE_GENERATION_SHIFT    ( 16UL )
+    #define HANDLE_GENERATION_MASK     ( 0x7FFFUL )
+
+    #if ( configPROTECTED_KERNEL_OBJECT_POOL_SIZE >= HANDLE_INDEX_MASK )
+        #error configPROTECTED_KERNEL_OBJECT_POOL_SIZE must be less than 65535.
+    #endif
+
 /**
  * @brief Opaque type for a kernel object.
  */
@@ -77,6 +93,7 @@
         OpaqueObjectHandle_t xInternalObjectHandle;
         uint32_t ulKernelObjectType;
         void * pvKernelObjectData;
+        uint32_t ulGeneration;
     } KernelObject_t;
 
 /**
@@ -89,12 +106,24 @@
     #define KERNEL_OBJECT_TYPE_EVENT_GROUP      ( 4UL )
     #define KERNEL_OBJECT_TYPE_TIMER            ( 5UL )
 
+/**
+ * @brief Extracts the external index and the generation from a handle.
+ */
+    #define GET_HANDLE_INDEX( lIndex )         ( ( int32_t ) ( ( ( uint32_t ) ( lIndex ) ) & HANDLE_INDEX_MASK ) )
+    #define GET_HANDLE_GENERATION( lIndex )    ( ( ( ( uint32_t ) ( lIndex ) ) >> HANDLE_GENERATION_SHIFT ) & HANDLE_GENERATION_MASK )
+
 /**
  * @brief Checks whether an external index is valid or not.
+ *
+ * Valid external indexes have an index within the pool and the current
+ * generation of that pool slot.
  */
-    #define IS_EXTERNAL_INDEX_VALID( lIndex )   \
-    ( ( ( ( lIndex ) >= INDEX_OFFSET ) &&       \
-        ( ( lIndex ) < ( configPROTECTED_KERNEL_OBJECT_POOL_SIZE + INDEX_OFFSET ) ) ) ? pdTRUE : pdFALSE )
+    #define IS_EXTERNAL_INDEX_VALID( lIndex )                                                                     \
+    ( ( ( ( lIndex ) >= INDEX_OFFSET ) &&                                                                         \
+        ( GET_HANDLE_INDEX( lIndex ) >= INDEX_OFFSET ) &&                                                         \
+        ( GET_HANDLE_INDEX( lIndex ) < ( configPROTECTED_KERNEL_OBJECT_POOL_SIZE + INDEX_OFFSET ) ) &&            \
+        ( GET_HANDLE_GENERATION( lIndex ) ==                                                                      \
+          xKernelObjectPool[ GET_HANDLE_INDEX( lIndex ) - INDEX_OFFSET ].ulGeneration ) ) ? pdTRUE : pdFALSE )
 
 /**
  * @brief Checks whether an internal index is valid or not.
@@ -106,12 +135,14 @@
 /**
  * @brief Converts an internal index into external.
  */
-    #define CONVERT_TO_EXTERNAL_INDEX( lIndex )    ( ( lIndex ) + INDEX_OFFSET )
+    #define CONVERT_TO_EXTERNAL_INDEX( lIndex )                                                          \
+    ( ( int32_t ) ( ( xKernelObjectPool[ ( lIndex ) ].ulGeneration << HANDLE_GENERATION_SHIFT ) |        \
+                    ( ( uint32_t ) ( ( lIndex ) + INDEX_OFFSET ) ) ) )
 
 /**
  * @brief Converts an external index into internal.
  */
-    #define CONVERT_TO_INTERNAL_INDEX( lIndex )    ( ( lIndex ) - INDEX_OFFSET )
+    #define CONVERT_TO_INTERNAL_INDEX( lIndex )    ( GET_HANDLE_INDEX( lIndex ) - INDEX_OFFSET )
 
 /**
  * @brief Max value that fits in a uint32_t type.
@@ -289,6 +320,9 @@
             xKernelObjectPool[ lIndex ].xInternalObjectHandle = NULL;
             xKernelObjectPool[ lIndex ].ulKernelObjectType = KERNEL_OBJECT_TYPE_INVALID;
             xKernelObjectPool[ lIndex ].pvKernelObjectData = NULL;
+
+            /* Invalidate all the handles to the object that was in this slot. */
+            xKernelObjectPool[ lIndex ].ulGeneration = ( xKernelObjectPool[ lIndex ].ulGeneration + 1UL ) & HANDLE_GENERATION_MASK;
         }
         taskEXIT_CRITICAL();
     }
@@ -118,8 +118,14 @@
 /* The I bit in the DAIF bits. */
 #define portDAIF_I                 ( 0x80 )
 
+/* The distributor's software generated interrupt register, used by
+ * vPortYieldCore() to interrupt another core. */
+#define portGICD_SGIR_OFFSET               ( 0xF00UL )
+#define portGICD_SGIR_REGISTER             ( *( ( volatile uint32_t * ) ( configINTERRUPT_CONTROLLER_BASE_ADDRESS + portGICD_SGIR_OFFSET ) ) )
+#define portGICD_SGIR_TARGET_LIST_SHIFT    ( 16UL )
+
 /* Macro to unmask all interrupt priorities. */
-#define portCLEAR_INTERRUPT_MASK()                            \
+#define portCLEAR_INTERRUPT_PRIORITIES_MASK()                 \
     {                                                         \
         portDISABLE_INTERRUPTS();                             \
         portICCPMR_PRIORITY_MASK_REGISTER = portUNMASK_VALUE; \
@@ -147,23 +153,51 @@ extern void vPortRestoreTaskContext( void );
 
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES == 1 )
+
 /* A variable is used to keep track of the critical section nesting.  This
  * variable has to be stored as part of the task context and must be initialised to
  * a non zero value to ensure interrupts don't inadvertently become unmasked before
  * the scheduler starts.  As it is stored as part of the task context it will
  * automatically be set to 0 when the first task is started. */
-volatile uint64_t ullCriticalNesting = 9999ULL;
+    volatile uint64_t ullCriticalNesting = 9999ULL;
 
 /* Saved as part of the task context.  If ullPortTaskHasFPUContext is non-zero
  * then floating point context must be saved and restored for the task. */
-uint64_t ullPortTaskHasFPUContext = pdFALSE;
+    uint64_t ullPortTaskHasFPUContext = pdFALSE;
 
 /* Set to 1 to pend a context switch from an ISR. */
-uint64_t ullPortYieldRequired = pdFALSE;
+    uint64_t ullPortYieldRequired = pdFALSE;
 
 /* Counts the interrupt nesting depth.  A context switch is only performed if
  * if the nesting depth is 0. */
-uint64_t ullPortInterruptNesting = 0;
+    uint64_t ullPortInterruptNesting = 0;
+
+    #define portCORE_VARIABLE( xVariable )    ( xVariable )
+
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
+
+/* As above, but with one entry per core.  The assembly code indexes these
+ * arrays with the ID of the core it is running on. */
+    volatile uint64_t ullCriticalNesting[ configNUMBER_OF_CORES ] = { [ 0 ... ( configNUMBER_OF_CORES - 1 ) ] = 9999ULL };
+    uint64_t ullPortTaskHasFPUContext[ configNUMBER_OF_CORES ] = { pdFALSE };
+    uint64_t ullPortYieldRequired[ configNUMBER_OF_CORES ] = { pdFALSE };
+    uint64_t ullPortInterruptNesting[ configNUMBER_OF_CORES ] = { 0 };
+
+    #define portCORE_VARIABLE( xVariable )    ( ( xVariable )[ portGET_CORE_ID() ] )
+
+/* The spinlocks used to implement portGET_ISR_LOCK() and portGET_TASK_LOCK(),
+ * the core that holds each (plus one, so zero means no owner) and how many
+ * times the owning core has taken it. */
+    static volatile uint32_t ulPortSpinlocks[ portRTOS_SPINLOCK_COUNT ] = { 0 };
+    static volatile uint32_t ulPortSpinlockOwners[ portRTOS_SPINLOCK_COUNT ] = { 0 };
+    static uint32_t ulPortSpinlockRecursionCounts[ portRTOS_SPINLOCK_COUNT ] = { 0 };
+
+/* Set by the primary core once the scheduler has been started, to release the
+ * secondary cores waiting in vPortStartSecondaryCore(). */
+    static volatile uint64_t ullPortSchedulerStarted = pdFALSE;
+
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
 /* Used in the ASM code. */
 __attribute__( ( used ) ) const uint64_t ullICCEOIR = portICCEOIR_END_OF_INTERRUPT_REGISTER_ADDRESS;
@@ -282,7 +316,7 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 
         pxTopOfStack--;
         *pxTopOfStack = pdTRUE;
-        ullPortTaskHasFPUContext = pdTRUE;
+        portCORE_VARIABLE( ullPortTaskHasFPUContext ) = pdTRUE;
     }
     #else /* if ( configUSE_TASK_FPU_SUPPORT == 1 ) */
     {
@@ -366,6 +400,15 @@ BaseType_t xPortStartScheduler( void )
             /* Start the timer that generates the tick ISR. */
             configSETUP_TICK_INTERRUPT();
 
+            #if ( configNUMBER_OF_CORES > 1 )
+            {
+                /* Release the secondary cores. */
+                ullPortSchedulerStarted = pdTRUE;
+                __asm volatile ( "DSB SY     \n"
+                                 "SEV        \n" ::: "memory" );
+            }
+            #endif /* configNUMBER_OF_CORES */
+
             /* Start the first task executing. */
             vPortRestoreTaskContext();
         }
@@ -379,50 +422,54 @@ void vPortEndScheduler( void )
 {
     /* Not implemented in ports where there is nothing to return to.
      * Artificially force an assert. */
-    configASSERT( ullCriticalNesting == 1000ULL );
+    configASSERT( portCORE_VARIABLE( ullCriticalNesting ) == 1000ULL );
 }
 /*-----------------------------------------------------------*/
 
-void vPortEnterCritical( void )
-{
-    /* Mask interrupts up to the max syscall interrupt priority. */
-    uxPortSetInterruptMask();
-
-    /* Now interrupts are disabled ullCriticalNesting can be accessed
-     * directly.  Increment ullCriticalNesting to keep a count of how many times
-     * portENTER_CRITICAL() has been called. */
-    ullCriticalNesting++;
-
-    /* This is not the interrupt safe version of the enter critical function so
-     * assert() if it is being called from an interrupt context.  Only API
-     * functions that end in "FromISR" can be used in an interrupt.  Only assert if
-     * the critical nesting count is 1 to protect against recursive calls if the
-     * assert function also uses a critical section. */
-    if( ullCriticalNesting == 1ULL )
+#if ( configNUMBER_OF_CORES == 1 )
+
+    void vPortEnterCritical( void )
     {
-        configASSERT( ullPortInterruptNesting == 0 );
+        /* Mask interrupts up to the max syscall interrupt priority. */
+        uxPortSetInterruptMask();
+
+        /* Now interrupts are disabled ullCriticalNesting can be accessed
+         * directly.  Increment ullCriticalNesting to keep a count of how many times
+         * portENTER_CRITICAL() has been called. */
+        ullCriticalNesting++;
+
+        /* This is not the interrupt safe version of the enter critical function so
+         * assert() if it is being called from an interrupt context.  Only API
+         * functions that end in "FromISR" can be used in an interrupt.  Only assert if
+         * the critical nesting count is 1 to protect against recursive calls if the
+         * assert function also uses a critical section. */
+        if( ullCriticalNesting == 1ULL )
+        {
+            configASSERT( ullPortInterruptNesting == 0 );
+        }
     }
-}
 /*-----------------------------------------------------------*/
 
-void vPortExitCritical( void )
-{
-    if( ullCriticalNesting > portNO_CRITICAL_NESTING )
+    void vPortExitCritical( void )
     {
-        /* Decrement the nesting count as the critical section is being
-         * exited. */
-        ullCriticalNesting--;
-
-        /* If the nesting level has reached zero then all interrupt
-         * priorities must be re-enabled. */
-        if( ullCriticalNesting == portNO_CRITICAL_NESTING )
+        if( ullCriticalNesting > portNO_CRITICAL_NESTING )
         {
-            /* Critical nesting has reached zero so all interrupt priorities
-             * should be unmasked. */
-            portCLEAR_INTERRUPT_MASK();
+            /* Decrement the nesting count as the critical section is being
+             * exited. */
+            ullCriticalNesting--;
+
+            /* If the nesting level has reached zero then all interrupt
+             * priorities must be re-enabled. */
+            if( ullCriticalNesting == portNO_CRITICAL_NESTING )
+            {
+                /* Critical nesting has reached zero so all interrupt priorities
+                 * should be unmasked. */
+                portCLEAR_INTERRUPT_PRIORITIES_MASK();
+            }
         }
     }
-}
+
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
 void FreeRTOS_Tick_Handler( void )
@@ -458,13 +505,32 @@ void FreeRTOS_Tick_Handler( void )
     portENABLE_INTERRUPTS();
 
     /* Increment the RTOS tick. */
-    if( xTaskIncrementTick() != pdFALSE )
+    #if ( configNUMBER_OF_CORES == 1 )
+    {
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            ullPortYieldRequired = pdTRUE;
+        }
+    }
+    #else
     {
-        ullPortYieldRequired = pdTRUE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* The other cores can access the scheduler's data structures at the
+         * same time, so the ISR lock must be held. */
+        uxSavedInterruptStatus = portENTER_CRITICAL_FROM_ISR();
+        {
+            if( xTaskIncrementTick() != pdFALSE )
+            {
+                portCORE_VARIABLE( ullPortYieldRequired ) = pdTRUE;
+            }
+        }
+        portEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
     }
+    #endif /* configNUMBER_OF_CORES */
 
     /* Ensure all interrupt priorities are active again. */
-    portCLEAR_INTERRUPT_MASK();
+    portCLEAR_INTERRUPT_PRIORITIES_MASK();
 }
 /*-----------------------------------------------------------*/
 
@@ -474,7 +540,19 @@ void FreeRTOS_Tick_Handler( void )
     {
         /* A task is registering the fact that it needs an FPU context.  Set the
          * FPU flag (which is saved as part of the task context). */
-        ullPortTaskHasFPUContext = pdTRUE;
+        #if ( configNUMBER_OF_CORES == 1 )
+        {
+            ullPortTaskHasFPUContext = pdTRUE;
+        }
+        #else
+        {
+            /* Interrupts are disabled so the task cannot move to another core
+             * between reading the core ID and setting the flag. */
+            portDISABLE_INTERRUPTS();
+            ullPortTaskHasFPUContext[ portGET_CORE_ID() ] = pdTRUE;
+            portENABLE_INTERRUPTS();
+        }
+        #endif /* configNUMBER_OF_CORES */
 
         /* Consider initialising the FPSR here - but probably not necessary in
          * AArch64. */
@@ -487,7 +565,7 @@ void vPortClearInterruptMask( UBaseType_t uxNewMaskValue )
 {
     if( uxNewMaskValue == pdFALSE )
     {
-        portCLEAR_INTERRUPT_MASK();
+        portCLEAR_INTERRUPT_PRIORITIES_MASK();
     }
 }
 /*-----------------------------------------------------------*/
@@ -495,9 +573,12 @@ void vPortClearInterruptMask( UBaseType_t uxNewMaskValue )
 UBaseType_t uxPortSetInterruptMask( void )
 {
     uint32_t ulReturn;
+    uint64_t ullDAIF;
 
     /* Interrupt in the CPU must be turned off while the ICCPMR is being
-     * updated. */
+     * updated.  Note whether they were already off, as they are when this is
+     * called from within the SMP scheduler's critical sections. */
+    __asm volatile ( "MRS %0, DAIF" : "=r" ( ullDAIF )::"memory" );
     portDISABLE_INTERRUPTS();
 
     if( portICCPMR_PRIORITY_MASK_REGISTER == ( uint32_t ) ( configMAX_API_CALL_INTERRUPT_PRIORITY << portPRIORITY_SHIFT ) )
@@ -513,7 +594,10 @@ UBaseType_t uxPortSetInterruptMask( void )
                          "isb sy     \n" ::: "memory" );
     }
 
-    portENABLE_INTERRUPTS();
+    if( ( ullDAIF & portDAIF_I ) == 0 )
+    {
+        portENABLE_INTERRUPTS();
+    }
 
     return ulReturn;
 }
@@ -554,3 +638,93 @@ UBaseType_t uxPortSetInterruptMask( void )
 
 #endif /* configASSERT_DEFINED */
 /*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vPortYieldCore( BaseType_t xCoreID )
+    {
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configNUMBER_OF_CORES ) );
+
+        /* Make sure the target core sees any scheduler data written before
+         * the yield request.  The core ID is assumed to match the core's GIC
+         * CPU interface number. */
+        __asm volatile ( "DSB ISH" ::: "memory" );
+        portGICD_SGIR_REGISTER = ( ( 1UL << ( portGICD_SGIR_TARGET_LIST_SHIFT + ( uint32_t ) xCoreID ) ) | configYIELD_CORE_SGI_ID );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortRecursiveLock( uint32_t ulLockNum,
+                             BaseType_t xAcquire )
+    {
+        const uint32_t ulOwner = ( uint32_t ) portGET_CORE_ID() + 1UL;
+        volatile uint32_t * const pulLock = &( ulPortSpinlocks[ ulLockNum ] );
+        uint32_t ulTemp;
+
+        configASSERT( ulLockNum < portRTOS_SPINLOCK_COUNT );
+
+        if( xAcquire != pdFALSE )
+        {
+            if( ulPortSpinlockOwners[ ulLockNum ] == ulOwner )
+            {
+                /* This core already holds the lock. */
+                configASSERT( ulPortSpinlockRecursionCounts[ ulLockNum ] != UINT32_MAX );
+                ulPortSpinlockRecursionCounts[ ulLockNum ]++;
+            }
+            else
+            {
+                /* Wait in a low power state until the lock looks free, then
+                 * try to claim it with an exclusive store.  The load-acquire
+                 * orders the critical section after the lock is taken. */
+                __asm volatile ( "   SEVL                    \n"
+                                 "1: WFE                     \n"
+                                 "2: LDAXR   %w0, [%1]       \n"
+                                 "   CBNZ    %w0, 1b         \n"
+                                 "   STXR    %w0, %w2, [%1]  \n"
+                                 "   CBNZ    %w0, 2b         \n"
+                                 : "=&r" ( ulTemp )
+                                 : "r" ( pulLock ), "r" ( 1UL )
+                                 : "memory" );
+
+                ulPortSpinlockOwners[ ulLockNum ] = ulOwner;
+                ulPortSpinlockRecursionCounts[ ulLockNum ] = 1UL;
+            }
+        }
+        else
+        {
+            configASSERT( ulPortSpinlockOwners[ ulLockNum ] == ulOwner );
+            configASSERT( ulPortSpinlockRecursionCounts[ ulLockNum ] != 0UL );
+
+            ulPortSpinlockRecursionCounts[ ulLockNum ]--;
+
+            if( ulPortSpinlockRecursionCounts[ ulLockNum ] == 0UL )
+            {
+                ulPortSpinlockOwners[ ulLockNum ] = 0UL;
+
+                /* The store-release orders the critical section before the
+                 * lock is freed, and clearing the exclusive monitor wakes any
+                 * core waiting in WFE. */
+                __asm volatile ( "STLR    wzr, [%0]" :: "r" ( pulLock ) : "memory" );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortStartSecondaryCore( void )
+    {
+        /* Interrupts are automatically turned back on in the CPU when the
+         * first task starts executing on this core. */
+        portDISABLE_INTERRUPTS();
+
+        while( ullPortSchedulerStarted == pdFALSE )
+        {
+            __asm volatile ( "WFE" ::: "memory" );
+        }
+
+        __asm volatile ( "DMB SY" ::: "memory" );
+
+        /* Start the first task executing on this core. */
+        vPortRestoreTaskContext();
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
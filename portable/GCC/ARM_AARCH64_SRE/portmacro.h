@@ -72,21 +72,34 @@ typedef uint64_t         TickType_t;
 #define portTICK_PERIOD_MS       ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
 #define portBYTE_ALIGNMENT       16
 #define portPOINTER_SIZE_TYPE    uint64_t
+#define portCACHE_LINE_ALIGNED   __attribute__( ( aligned( configCACHE_LINE_SIZE ) ) )
 
 /*-----------------------------------------------------------*/
 
 /* Task utilities. */
 
 /* Called at the end of an ISR that can cause a context switch. */
-#define portEND_SWITCHING_ISR( xSwitchRequired ) \
-    {                                            \
-        extern uint64_t ullPortYieldRequired;    \
-                                                 \
-        if( xSwitchRequired != pdFALSE )         \
-        {                                        \
-            ullPortYieldRequired = pdTRUE;       \
-        }                                        \
-    }
+#if ( configNUMBER_OF_CORES == 1 )
+    #define portEND_SWITCHING_ISR( xSwitchRequired ) \
+        {                                            \
+            extern uint64_t ullPortYieldRequired;    \
+                                                     \
+            if( xSwitchRequired != pdFALSE )         \
+            {                                        \
+                ullPortYieldRequired = pdTRUE;       \
+            }                                        \
+        }
+#else
+    #define portEND_SWITCHING_ISR( xSwitchRequired )                       \
+        {                                                                  \
+            extern uint64_t ullPortYieldRequired[ configNUMBER_OF_CORES ]; \
+                                                                           \
+            if( xSwitchRequired != pdFALSE )                               \
+            {                                                              \
+                ullPortYieldRequired[ portGET_CORE_ID() ] = pdTRUE;        \
+            }                                                              \
+        }
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
 #define portYIELD_FROM_ISR( x )    portEND_SWITCHING_ISR( x )
 #if defined( GUEST )
@@ -118,11 +131,97 @@ extern void vPortInstallFreeRTOSVectorTable( void );
 
 /* These macros do not globally disable/enable interrupts.  They do mask off
  * interrupts that have a priority below configMAX_API_CALL_INTERRUPT_PRIORITY. */
-#define portENTER_CRITICAL()                      vPortEnterCritical();
-#define portEXIT_CRITICAL()                       vPortExitCritical();
+#if ( configNUMBER_OF_CORES == 1 )
+    #define portENTER_CRITICAL()                  vPortEnterCritical();
+    #define portEXIT_CRITICAL()                   vPortExitCritical();
+#else
+    extern void vTaskEnterCritical( void );
+    extern void vTaskExitCritical( void );
+    extern UBaseType_t vTaskEnterCriticalFromISR( void );
+    extern void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus );
+    #define portENTER_CRITICAL()                  vTaskEnterCritical()
+    #define portEXIT_CRITICAL()                   vTaskExitCritical()
+    #define portENTER_CRITICAL_FROM_ISR()         vTaskEnterCriticalFromISR()
+    #define portEXIT_CRITICAL_FROM_ISR( x )       vTaskExitCriticalFromISR( x )
+    #define portSET_INTERRUPT_MASK()              uxPortSetInterruptMask()
+    #define portCLEAR_INTERRUPT_MASK( x )         vPortClearInterruptMask( x )
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
 #define portSET_INTERRUPT_MASK_FROM_ISR()         uxPortSetInterruptMask()
 #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortClearInterruptMask( x )
 
+/*-----------------------------------------------------------
+* Multi-core support
+*----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* The SGI sent to a core to make it yield.  The application must enable it
+ * at the lowest usable interrupt priority (the same as the tick interrupt) on
+ * every core before that core starts the scheduler. */
+    #ifndef configYIELD_CORE_SGI_ID
+        #define configYIELD_CORE_SGI_ID    0
+    #endif
+
+    #if ( configYIELD_CORE_SGI_ID > 15 )
+        #error configYIELD_CORE_SGI_ID must be an SGI, so in the range 0 to 15.
+    #endif
+
+/* Set in MPIDR_EL1 when affinity level 0 numbers hardware threads rather than
+ * cores, in which case the core number is held in affinity level 1. */
+    #define portMPIDR_MT_BIT    ( 1ULL << 24 )
+
+/* The core number within the cluster is used as the FreeRTOS core ID, so
+ * the cores must be numbered from 0 to configNUMBER_OF_CORES - 1. */
+    static inline BaseType_t xPortGetCoreID( void )
+    {
+        uint64_t ullMPIDR;
+
+        __asm volatile ( "MRS %0, MPIDR_EL1" : "=r" ( ullMPIDR ) );
+
+        if( ( ullMPIDR & portMPIDR_MT_BIT ) != 0ULL )
+        {
+            ullMPIDR >>= 8;
+        }
+
+        return ( BaseType_t ) ( ullMPIDR & 0xFFULL );
+    }
+
+    void vPortYieldCore( BaseType_t xCoreID );
+    void vPortRecursiveLock( uint32_t ulLockNum,
+                             BaseType_t xAcquire );
+
+/* Must be called by each secondary core, once it has configured its own GIC
+ * CPU interface, to start running tasks.  It waits for the primary core to
+ * start the scheduler and does not return. */
+    void vPortStartSecondaryCore( void );
+
+    #define portGET_CORE_ID()                                  xPortGetCoreID()
+    #define portYIELD_CORE( xCoreID )                          vPortYieldCore( xCoreID )
+
+    #define portRTOS_ISR_LOCK                                  ( 0UL )
+    #define portRTOS_TASK_LOCK                                 ( 1UL )
+    #define portRTOS_SPINLOCK_COUNT                            ( 2UL )
+
+    #define portGET_ISR_LOCK()                                 vPortRecursiveLock( portRTOS_ISR_LOCK, pdTRUE )
+    #define portRELEASE_ISR_LOCK()                             vPortRecursiveLock( portRTOS_ISR_LOCK, pdFALSE )
+    #define portGET_TASK_LOCK()                                vPortRecursiveLock( portRTOS_TASK_LOCK, pdTRUE )
+    #define portRELEASE_TASK_LOCK()                            vPortRecursiveLock( portRTOS_TASK_LOCK, pdFALSE )
+
+/* The critical nesting count is saved as part of the task context, so each
+ * core holds the count of the task it is running. */
+    #define portCRITICAL_NESTING_IN_TCB                        0
+
+    extern volatile uint64_t ullCriticalNesting[ configNUMBER_OF_CORES ];
+    extern uint64_t ullPortInterruptNesting[ configNUMBER_OF_CORES ];
+    #define portGET_CRITICAL_NESTING_COUNT( xCoreID )          ( ullCriticalNesting[ ( xCoreID ) ] )
+    #define portSET_CRITICAL_NESTING_COUNT( xCoreID, x )       ( ullCriticalNesting[ ( xCoreID ) ] = ( x ) )
+    #define portINCREMENT_CRITICAL_NESTING_COUNT( xCoreID )    ( ullCriticalNesting[ ( xCoreID ) ]++ )
+    #define portDECREMENT_CRITICAL_NESTING_COUNT( xCoreID )    ( ullCriticalNesting[ ( xCoreID ) ]-- )
+
+    #define portASSERT_IF_IN_ISR()                             configASSERT( ullPortInterruptNesting[ portGET_CORE_ID() ] == 0ULL )
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site.  These are
@@ -67,6 +67,8 @@ typedef void ( * portISR_t )( void );
 #define portNVIC_SYSTICK_COUNT_FLAG_BIT       ( 1UL << 16UL )
 #define portNVIC_PEND_SYSTICK_CLEAR_BIT       ( 1UL << 25UL )
 #define portNVIC_PEND_SYSTICK_SET_BIT         ( 1UL << 26UL )
+#define portNVIC_VECTPENDING_MASK             ( 0x1FFUL << 12UL )
+#define portNVIC_VECTPENDING_SHIFT            ( 12UL )
 #define portMIN_INTERRUPT_PRIORITY            ( 255UL )
 #define portNVIC_PENDSV_PRI                   ( portMIN_INTERRUPT_PRIORITY << 16UL )
 #define portNVIC_SYSTICK_PRI                  ( portMIN_INTERRUPT_PRIORITY << 24UL )
@@ -396,6 +398,10 @@ PRIVILEGED_DATA static volatile uint32_t ulCriticalNesting = 0xaaaaaaaaUL;
         uint32_t ulReloadValue, ulCompleteTickPeriods, ulCompletedSysTickDecrements, ulSysTickDecrementsLeft;
         TickType_t xModifiableIdleTime;
 
+        #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            uint32_t ulWakeSource;
+        #endif
+
         /* Make sure the SysTick reload value does not overflow the counter. */
         if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
         {
@@ -482,6 +488,14 @@ PRIVILEGED_DATA static volatile uint32_t ulCriticalNesting = 0xaaaaaaaaUL;
 
             configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
 
+            #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            {
+                /* Interrupts are still disabled, so the interrupt that ended
+                 * the sleep is still pending. */
+                ulWakeSource = ( portNVIC_INT_CTRL_REG & portNVIC_VECTPENDING_MASK ) >> portNVIC_VECTPENDING_SHIFT;
+            }
+            #endif
+
             /* Re-enable interrupts to allow the interrupt that brought the MCU
              * out of sleep mode to execute immediately.  See comments above
              * the cpsid instruction above. */
@@ -602,6 +616,12 @@ PRIVILEGED_DATA static volatile uint32_t ulCriticalNesting = 0xaaaaaaaaUL;
             /* Step the tick to account for any tick periods that elapsed. */
             vTaskStepTick( ulCompleteTickPeriods );
 
+            #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            {
+                vTaskRecordTicklessSleep( xExpectedIdleTime, ulCompleteTickPeriods, ulWakeSource );
+            }
+            #endif
+
             /* Exit with interrupts enabled. */
             __asm volatile ( "cpsie i" ::: "memory" );
         }
@@ -819,6 +839,18 @@ void SysTick_Handler( void ) /* PRIVILEGED_FUNCTION */
 
     traceISR_ENTER();
     {
+        #if ( ( configUSE_PC_SAMPLING == 1 ) && ( configPC_SAMPLE_FROM_TICK == 1 ) )
+        {
+            uint32_t * pulProcessStack;
+
+            /* The SysTick cannot interrupt another interrupt, so the program
+             * counter of the running task is the one the hardware stacked at
+             * offset 6 on the process stack. */
+            __asm volatile ( "mrs %0, psp" : "=r" ( pulProcessStack ) );
+            vTaskRecordPCSampleFromISR( ( void * ) pulProcessStack[ 6 ] );
+        }
+        #endif
+
         /* Increment the RTOS tick. */
         if( xTaskIncrementTick() != pdFALSE )
         {
@@ -50,8 +50,18 @@ typedef void ( * portISR_t )( void );
 #define portNVIC_SYSTICK_COUNT_FLAG_BIT       ( 1UL << 16UL )
 #define portNVIC_PENDSVCLEAR_BIT              ( 1UL << 27UL )
 #define portNVIC_PEND_SYSTICK_SET_BIT         ( 1UL << 26UL )
+#define portNVIC_VECTPENDING_MASK             ( 0x1FFUL << 12UL )
+#define portNVIC_VECTPENDING_SHIFT            ( 12UL )
 #define portNVIC_PEND_SYSTICK_CLEAR_BIT       ( 1UL << 25UL )
 
+/* Constants required to use the DWT cycle counter as the run time stats clock. */
+#define portDCB_DEMCR_REG                     ( *( ( volatile uint32_t * ) 0xe000edfc ) )
+#define portDWT_CTRL_REG                      ( *( ( volatile uint32_t * ) 0xe0001000 ) )
+#define portDWT_CYCCNT_REG                    ( *( ( volatile uint32_t * ) 0xe0001004 ) )
+#define portDCB_DEMCR_TRCENA_BIT              ( 1UL << 24UL )
+#define portDWT_CTRL_CYCCNTENA_BIT            ( 1UL << 0UL )
+#define portDWT_CTRL_NOCYCCNT_BIT             ( 1UL << 25UL )
+
 #define portMIN_INTERRUPT_PRIORITY            ( 255UL )
 #define portNVIC_PENDSV_PRI                   ( ( ( uint32_t ) portMIN_INTERRUPT_PRIORITY ) << 16UL )
 #define portNVIC_SYSTICK_PRI                  ( ( ( uint32_t ) portMIN_INTERRUPT_PRIORITY ) << 24UL )
@@ -121,6 +131,10 @@ void vPortSetupTimerInterrupt( void );
  * Exception handlers.
  */
 void xPortPendSVHandler( void ) __attribute__( ( naked ) );
+
+#if ( configUSE_DIRECT_ISR_YIELD == 1 )
+    void vPortDirectYieldISREntry( void ) __attribute__( ( naked ) );
+#endif
 void xPortSysTickHandler( void );
 void vPortSVCHandler( void ) __attribute__( ( naked ) );
 
@@ -163,6 +177,15 @@ static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
     static uint32_t ulStoppedTimerCompensation = 0;
 #endif /* configUSE_TICKLESS_IDLE */
 
+/*
+ * The value of the cycle counter when it was last read, and the number of
+ * times it has wrapped, which together extend it to 64 bits.
+ */
+#if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+    static uint32_t ulLastCycleCount = 0;
+    static uint32_t ulCycleCounterWraps = 0;
+#endif /* configUSE_CYCLE_COUNTER_RUN_TIME_STATS */
+
 /*
  * Used by the portASSERT_IF_INTERRUPT_PRIORITY_INVALID() macro to ensure
  * FreeRTOS API functions are not called from interrupts that have been assigned
@@ -497,6 +520,26 @@ void xPortSysTickHandler( void )
     portDISABLE_INTERRUPTS();
     traceISR_ENTER();
     {
+        #if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+        {
+            /* Read the cycle counter at least once a tick so a wrap is never
+             * missed. */
+            ( void ) ullPortGetCycleCounterValue();
+        }
+        #endif
+
+        #if ( ( configUSE_PC_SAMPLING == 1 ) && ( configPC_SAMPLE_FROM_TICK == 1 ) )
+        {
+            uint32_t * pulProcessStack;
+
+            /* The SysTick cannot interrupt another interrupt, so the program
+             * counter of the running task is the one the hardware stacked at
+             * offset 6 on the process stack. */
+            __asm volatile ( "mrs %0, psp" : "=r" ( pulProcessStack ) );
+            vTaskRecordPCSampleFromISR( ( void * ) pulProcessStack[ 6 ] );
+        }
+        #endif
+
         /* Increment the RTOS tick. */
         if( xTaskIncrementTick() != pdFALSE )
         {
@@ -515,6 +558,89 @@ void xPortSysTickHandler( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+
+    void vPortConfigureCycleCounter( void )
+    {
+        /* Enable the DWT, then check this core implements the cycle counter. */
+        portDCB_DEMCR_REG |= portDCB_DEMCR_TRCENA_BIT;
+        configASSERT( ( portDWT_CTRL_REG & portDWT_CTRL_NOCYCCNT_BIT ) == 0UL );
+
+        ulLastCycleCount = 0UL;
+        ulCycleCounterWraps = 0UL;
+        portDWT_CYCCNT_REG = 0UL;
+        portDWT_CTRL_REG |= portDWT_CTRL_CYCCNTENA_BIT;
+    }
+/*-----------------------------------------------------------*/
+
+    uint64_t ullPortGetCycleCounterValue( void )
+    {
+        uint32_t ulPreviousMask, ulCycleCount;
+        uint64_t ullCycleCount;
+
+        /* Mask interrupts so the wrap count is updated by one caller at a
+         * time.  The SysTick handler reads the counter every tick, and
+         * tickless idle cannot suppress more ticks than the 24-bit SysTick
+         * can count, so the 32-bit counter cannot wrap twice between reads
+         * unless the SysTick runs more than 256 times slower than the core. */
+        ulPreviousMask = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ulCycleCount = portDWT_CYCCNT_REG;
+
+            if( ulCycleCount < ulLastCycleCount )
+            {
+                ulCycleCounterWraps++;
+            }
+
+            ulLastCycleCount = ulCycleCount;
+            ullCycleCount = ( ( ( uint64_t ) ulCycleCounterWraps ) << 32 ) | ( uint64_t ) ulCycleCount;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( ulPreviousMask );
+
+        return ullCycleCount;
+    }
+
+#endif /* configUSE_CYCLE_COUNTER_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DIRECT_ISR_YIELD == 1 )
+
+    void vPortDirectYieldISREntry( void )
+    {
+        /* This is a naked function, entered from a handler defined with
+         * portDIRECT_YIELD_ISR() with the handler's function in r0. */
+
+        __asm volatile
+        (
+            "   push {r4, lr}                       \n" /* Keep EXC_RETURN.  r4 keeps the stack 8 byte aligned. */
+            "   blx r0                              \n" /* Returns xHigherPriorityTaskWoken. */
+            "   pop {r4, lr}                        \n"
+            "   cbz r0, 2f                          \n"
+            "                                       \n"
+            "   ldr r1, =0xe000ed04                 \n" /* The interrupt control and state register. */
+            "   and r0, lr, #0xc                    \n" /* EXC_RETURN bits 3 and 2 are both set when returning to a task. */
+            "   cmp r0, #0xc                        \n"
+            "   bne 1f                              \n"
+            "                                       \n"
+            "   mov r0, %0                          \n" /* Switch here, so a PendSV pended by an earlier interrupt is not needed. */
+            "   str r0, [r1]                        \n"
+            "   b xPortPendSVHandler                \n" /* The task's registers are as they were when the interrupt was taken. */
+            "                                       \n"
+            "1:                                     \n" /* Nested in another handler, so pend PendSV as normal. */
+            "   mov r0, %1                          \n"
+            "   str r0, [r1]                        \n"
+            "                                       \n"
+            "2:                                     \n"
+            "   bx lr                               \n"
+            "                                       \n"
+            "   .ltorg                              \n"
+            ::"i" ( portNVIC_PENDSVCLEAR_BIT ), "i" ( portNVIC_PENDSVSET_BIT )
+        );
+    }
+
+#endif /* configUSE_DIRECT_ISR_YIELD */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TICKLESS_IDLE == 1 )
 
     __attribute__( ( weak ) ) void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
@@ -522,6 +648,10 @@ void xPortSysTickHandler( void )
         uint32_t ulReloadValue, ulCompleteTickPeriods, ulCompletedSysTickDecrements, ulSysTickDecrementsLeft;
         TickType_t xModifiableIdleTime;
 
+        #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            uint32_t ulWakeSource;
+        #endif
+
         /* Make sure the SysTick reload value does not overflow the counter. */
         if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
         {
@@ -608,6 +738,14 @@ void xPortSysTickHandler( void )
 
             configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
 
+            #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            {
+                /* Interrupts are still disabled, so the interrupt that ended
+                 * the sleep is still pending. */
+                ulWakeSource = ( portNVIC_INT_CTRL_REG & portNVIC_VECTPENDING_MASK ) >> portNVIC_VECTPENDING_SHIFT;
+            }
+            #endif
+
             /* Re-enable interrupts to allow the interrupt that brought the MCU
              * out of sleep mode to execute immediately.  See comments above
              * the cpsid instruction above. */
@@ -728,6 +866,12 @@ void xPortSysTickHandler( void )
             /* Step the tick to account for any tick periods that elapsed. */
             vTaskStepTick( ulCompleteTickPeriods );
 
+            #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            {
+                vTaskRecordTicklessSleep( xExpectedIdleTime, ulCompleteTickPeriods, ulWakeSource );
+            }
+            #endif
+
             /* Exit with interrupts enabled. */
             __asm volatile ( "cpsie i" ::: "memory" );
         }
@@ -761,6 +905,35 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DVFS_GOVERNOR == 1 )
+
+/*
+ * Called from the tick interrupt once the application has changed the clock
+ * frequency, so configSYSTICK_CLOCK_HZ and configCPU_CLOCK_HZ now evaluate to
+ * the new frequency.  Recalculates the constants used to configure the tick
+ * interrupt and restarts the SysTick so the next tick follows a full tick
+ * period at the new frequency.  Weak so an application that generates the tick
+ * from a different timer can override it along with vPortSetupTimerInterrupt().
+ */
+    __attribute__( ( weak ) ) void vPortClockChanged( void )
+    {
+        #if ( configUSE_TICKLESS_IDLE == 1 )
+        {
+            ulTimerCountsForOneTick = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ );
+            xMaximumPossibleSuppressedTicks = portMAX_24_BIT_NUMBER / ulTimerCountsForOneTick;
+            ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR / ( configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ );
+        }
+        #endif /* configUSE_TICKLESS_IDLE */
+
+        /* The tick interrupt has just been taken, so writing the current value
+         * register reloads the SysTick with the new value straight away. */
+        portNVIC_SYSTICK_LOAD_REG = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ ) - 1UL;
+        portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+    }
+
+#endif /* configUSE_DVFS_GOVERNOR */
+/*-----------------------------------------------------------*/
+
 #if ( configASSERT_DEFINED == 1 )
 
     void vPortValidateInterruptPriority( void )
@@ -82,10 +82,12 @@
                 "    str r3, [r1]                                 \n" /* Program RNR = 8. */
                 "    ldmia r0!, {r4-r11}                          \n" /* Read 4 set of RBAR/RLAR registers from TCB. */
                 "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
-                "    movs r3, #12                                 \n" /* r3 = 12. */
-                "    str r3, [r1]                                 \n" /* Program RNR = 12. */
-                "    ldmia r0!, {r4-r11}                          \n" /* Read 4 set of RBAR/RLAR registers from TCB. */
-                "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
+                #if ( configUSE_SHARED_MPU_REGIONS == 0 )
+                    "    movs r3, #12                                 \n" /* r3 = 12. */
+                    "    str r3, [r1]                                 \n" /* Program RNR = 12. */
+                    "    ldmia r0!, {r4-r11}                          \n" /* Read 4 set of RBAR/RLAR registers from TCB. */
+                    "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
+                #endif /* configUSE_SHARED_MPU_REGIONS == 0 */
             #endif /* configTOTAL_MPU_REGIONS == 16 */
             "                                                 \n"
             "    ldr r1, =0xe000ed94                          \n" /* r1 = 0xe000ed94 [Location of MPU_CTRL]. */
@@ -314,6 +316,14 @@ void vClearInterruptMask( __attribute__( ( unused ) ) uint32_t ulMask ) /* __att
             " program_mpu:                                    \n"
             "    ldr r3, =pxCurrentTCB                        \n" /* Read the location of pxCurrentTCB i.e. &( pxCurrentTCB ). */
             "    ldr r0, [r3]                                 \n" /* r0 = pxCurrentTCB.*/
+            #if ( configUSE_MPU_SETTINGS_CACHE == 1 )
+                "    adds r3, r0, #4                              \n" /* r3 = &( pxCurrentTCB->xMPUSettings ). */
+                "    ldr r1, =pxProgrammedMPUSettings             \n" /* Read the location of pxProgrammedMPUSettings i.e. &( pxProgrammedMPUSettings ). */
+                "    ldr r2, [r1]                                 \n" /* r2 = pxProgrammedMPUSettings. */
+                "    cmp r2, r3                                   \n"
+                "    beq restore_context                          \n" /* The MPU already holds the task's regions. */
+                "    str r3, [r1]                                 \n" /* pxProgrammedMPUSettings = &( pxCurrentTCB->xMPUSettings ). */
+            #endif /* configUSE_MPU_SETTINGS_CACHE */
             "                                                 \n"
             "    dmb                                          \n" /* Complete outstanding transfers before disabling MPU. */
             "    ldr r1, =0xe000ed94                          \n" /* r1 = 0xe000ed94 [Location of MPU_CTRL]. */
@@ -340,10 +350,12 @@ void vClearInterruptMask( __attribute__( ( unused ) ) uint32_t ulMask ) /* __att
                 "    str r3, [r1]                                 \n" /* Program RNR = 8. */
                 "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
                 "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
-                "    movs r3, #12                                 \n" /* r3 = 12. */
-                "    str r3, [r1]                                 \n" /* Program RNR = 12. */
-                "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
-                "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
+                #if ( configUSE_SHARED_MPU_REGIONS == 0 )
+                    "    movs r3, #12                                 \n" /* r3 = 12. */
+                    "    str r3, [r1]                                 \n" /* Program RNR = 12. */
+                    "    ldmia r0!, {r4-r11}                          \n" /* Read 4 sets of RBAR/RLAR registers from TCB. */
+                    "    stmia r2, {r4-r11}                           \n" /* Write 4 set of RBAR/RLAR registers using alias registers. */
+                #endif /* configUSE_SHARED_MPU_REGIONS == 0 */
             #endif /* configTOTAL_MPU_REGIONS == 16 */
             "                                                 \n"
             "   ldr r1, =0xe000ed94                           \n" /* r1 = 0xe000ed94 [Location of MPU_CTRL]. */
@@ -412,12 +424,22 @@ void vClearInterruptMask( __attribute__( ( unused ) ) uint32_t ulMask ) /* __att
             "   mrs r2, psp                                     \n" /* Read PSP in r2. */
             "                                                   \n"
             "   cbz r0, save_ns_context                         \n" /* No secure context to save. */
+            #if ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 )
+                "   lsls r3, lr, #25                            \n" /* r3 = LR << 25. Bit[6] of EXC_RETURN is 1 if secure stack was used, 0 if non-secure stack was used to store stack frame. */
+                "   bpl save_ns_context                         \n" /* The task was executing non-secure code - leave its secure context loaded. */
+            #endif /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
             "   push {r0-r2, r14}                               \n"
             "   bl SecureContext_SaveContext                    \n" /* Params are in r0 and r1. r0 = xSecureContext and r1 = pxCurrentTCB. */
             "   pop {r0-r3}                                     \n" /* LR is now in r3. */
             "   mov lr, r3                                      \n" /* LR = r3. */
-            "   lsls r1, r3, #25                                \n" /* r1 = r3 << 25. Bit[6] of EXC_RETURN is 1 if secure stack was used, 0 if non-secure stack was used to store stack frame. */
-            "   bpl save_ns_context                             \n" /* bpl - branch if positive or zero. If r1 >= 0 ==> Bit[6] in EXC_RETURN is 0 i.e. non-secure stack was used. */
+            #if ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 )
+                "   ldr r3, =xLoadedSecureContext               \n" /* Read the location of xLoadedSecureContext i.e. &( xLoadedSecureContext ). */
+                "   movs r1, #0                                 \n" /* r1 = portNO_SECURE_CONTEXT. */
+                "   str r1, [r3]                                \n" /* No secure context is loaded now. */
+            #else /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
+                "   lsls r1, r3, #25                            \n" /* r1 = r3 << 25. Bit[6] of EXC_RETURN is 1 if secure stack was used, 0 if non-secure stack was used to store stack frame. */
+                "   bpl save_ns_context                         \n" /* bpl - branch if positive or zero. If r1 >= 0 ==> Bit[6] in EXC_RETURN is 0 i.e. non-secure stack was used. */
+            #endif /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
             "                                                   \n"
             "   ldr r3, =pxCurrentTCB                           \n" /* Read the location of pxCurrentTCB i.e. &( pxCurrentTCB ). */
             "   ldr r1, [r3]                                    \n" /* Read pxCurrentTCB.*/
@@ -464,12 +486,35 @@ void vClearInterruptMask( __attribute__( ( unused ) ) uint32_t ulMask ) /* __att
             "   ldr r3, =xSecureContext                         \n" /* Read the location of xSecureContext i.e. &( xSecureContext ). */
             "   str r0, [r3]                                    \n" /* Restore the task's xSecureContext. */
             "   cbz r0, restore_ns_context                      \n" /* If there is no secure context for the task, restore the non-secure context. */
-            "   ldr r3, =pxCurrentTCB                           \n" /* Read the location of pxCurrentTCB i.e. &( pxCurrentTCB ). */
-            "   ldr r1, [r3]                                    \n" /* Read pxCurrentTCB. */
+            #if ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 )
+                "   ldr r3, =xLoadedSecureContext               \n" /* Read the location of xLoadedSecureContext i.e. &( xLoadedSecureContext ). */
+                "   ldr r1, [r3]                                \n" /* Read xLoadedSecureContext. */
+                "   cmp r0, r1                                  \n"
+                "   beq secure_context_loaded                   \n" /* The task's secure context is still loaded. */
+                "   cbz r1, load_secure_context                 \n" /* No other secure context to save first. */
+                "   push {r0, r2, r3, r4}                       \n"
+                "   mov r0, r1                                  \n" /* r0 = xLoadedSecureContext. */
+                "   ldr r1, =pvLoadedSecureContextTask          \n" /* Read the location of pvLoadedSecureContextTask i.e. &( pvLoadedSecureContextTask ). */
+                "   ldr r1, [r1]                                \n" /* Read pvLoadedSecureContextTask. */
+                "   bl SecureContext_SaveContext                \n" /* Save the secure context left loaded by another task. */
+                "   pop {r0, r2, r3, r4}                        \n"
+                " load_secure_context:                          \n"
+                "   str r0, [r3]                                \n" /* xLoadedSecureContext = xSecureContext. */
+                "   ldr r3, =pxCurrentTCB                       \n" /* Read the location of pxCurrentTCB i.e. &( pxCurrentTCB ). */
+                "   ldr r1, [r3]                                \n" /* Read pxCurrentTCB. */
+                "   ldr r3, =pvLoadedSecureContextTask          \n" /* Read the location of pvLoadedSecureContextTask i.e. &( pvLoadedSecureContextTask ). */
+                "   str r1, [r3]                                \n" /* pvLoadedSecureContextTask = pxCurrentTCB. */
+            #else /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
+                "   ldr r3, =pxCurrentTCB                       \n" /* Read the location of pxCurrentTCB i.e. &( pxCurrentTCB ). */
+                "   ldr r1, [r3]                                \n" /* Read pxCurrentTCB. */
+            #endif /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
             "   push {r2, r4}                                   \n"
             "   bl SecureContext_LoadContext                    \n" /* Restore the secure context. Params are in r0 and r1. r0 = xSecureContext and r1 = pxCurrentTCB. */
             "   pop {r2, r4}                                    \n"
             "   mov lr, r4                                      \n" /* LR = r4. */
+            #if ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 )
+                " secure_context_loaded:                        \n"
+            #endif /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
             "   lsls r1, r4, #25                                \n" /* r1 = r4 << 25. Bit[6] of EXC_RETURN is 1 if secure stack was used, 0 if non-secure stack was used to store stack frame. */
             "   bpl restore_ns_context                          \n" /* bpl - branch if positive or zero. If r1 >= 0 ==> Bit[6] in EXC_RETURN is 0 i.e. non-secure stack was used. */
             "   msr psp, r2                                     \n" /* Remember the new top of stack for the task. */
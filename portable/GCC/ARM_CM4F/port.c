@@ -54,8 +54,18 @@ typedef void ( * portISR_t )( void );
 #define portNVIC_SYSTICK_COUNT_FLAG_BIT       ( 1UL << 16UL )
 #define portNVIC_PENDSVCLEAR_BIT              ( 1UL << 27UL )
 #define portNVIC_PEND_SYSTICK_SET_BIT         ( 1UL << 26UL )
+#define portNVIC_VECTPENDING_MASK             ( 0x1FFUL << 12UL )
+#define portNVIC_VECTPENDING_SHIFT            ( 12UL )
 #define portNVIC_PEND_SYSTICK_CLEAR_BIT       ( 1UL << 25UL )
 
+/* Constants required to use the DWT cycle counter as the run time stats clock. */
+#define portDCB_DEMCR_REG                     ( *( ( volatile uint32_t * ) 0xe000edfc ) )
+#define portDWT_CTRL_REG                      ( *( ( volatile uint32_t * ) 0xe0001000 ) )
+#define portDWT_CYCCNT_REG                    ( *( ( volatile uint32_t * ) 0xe0001004 ) )
+#define portDCB_DEMCR_TRCENA_BIT              ( 1UL << 24UL )
+#define portDWT_CTRL_CYCCNTENA_BIT            ( 1UL << 0UL )
+#define portDWT_CTRL_NOCYCCNT_BIT             ( 1UL << 25UL )
+
 /* Constants used to detect a Cortex-M7 r0p1 core, which should use the ARM_CM7
  * r0p1 port. */
 #define portCPUID                             ( *( ( volatile uint32_t * ) 0xE000ed00 ) )
@@ -116,6 +126,54 @@ typedef void ( * portISR_t )( void );
     #define portNVIC_SYSTICK_CLK_BIT_CONFIG    ( 0 )
 #endif
 
+/* Constants used by the hardware stack guard.  The guard uses the highest
+ * numbered MPU region so it takes precedence over any region the application
+ * configures.  It is read only, rather than no access, so the kernel can still
+ * read the bottom of the running task's stack when it calculates the high
+ * water mark. */
+#if ( configUSE_MPU_STACK_GUARD == 1 )
+    #ifndef configMPU_STACK_GUARD_SIZE
+        #define configMPU_STACK_GUARD_SIZE    32UL
+    #endif
+
+    /* The memory type of the guard, as TEX, S, C and B bits.  Defaults to
+     * write-back, write-allocate, not shareable, as the default memory map
+     * uses for SRAM. */
+    #ifndef configMPU_STACK_GUARD_TEX_S_C_B
+        #define configMPU_STACK_GUARD_TEX_S_C_B    ( 0x0BUL )
+    #endif
+
+    #if ( ( configMPU_STACK_GUARD_SIZE < 32UL ) || ( ( configMPU_STACK_GUARD_SIZE & ( configMPU_STACK_GUARD_SIZE - 1UL ) ) != 0UL ) )
+        #error configMPU_STACK_GUARD_SIZE must be a power of two of at least 32.
+    #endif
+
+    #if ( configCHECK_FOR_STACK_OVERFLOW == 0 )
+        #error configUSE_MPU_STACK_GUARD reports overflows to vApplicationStackOverflowHook(), so configCHECK_FOR_STACK_OVERFLOW must be greater than 0.
+    #endif
+#endif
+
+#define portMPU_TYPE_REG                      ( *( ( volatile uint32_t * ) 0xe000ed90 ) )
+#define portMPU_CTRL_REG                      ( *( ( volatile uint32_t * ) 0xe000ed94 ) )
+#define portMPU_REGION_BASE_ADDRESS_REG       ( *( ( volatile uint32_t * ) 0xe000ed9c ) )
+#define portMPU_REGION_ATTRIBUTE_REG          ( *( ( volatile uint32_t * ) 0xe000eda0 ) )
+#define portNVIC_SYS_CTRL_STATE_REG           ( *( ( volatile uint32_t * ) 0xe000ed24 ) )
+#define portSCB_CFSR_REG                      ( *( ( volatile uint32_t * ) 0xe000ed28 ) )
+#define portSCB_MMFAR_REG                     ( *( ( volatile uint32_t * ) 0xe000ed34 ) )
+#define portMPU_TYPE_DREGION_MASK             ( 0xffUL << 8UL )
+#define portMPU_ENABLE                        ( 0x01UL )
+#define portMPU_BACKGROUND_ENABLE             ( 1UL << 2UL )
+#define portMPU_REGION_VALID                  ( 0x10UL )
+#define portMPU_REGION_ENABLE                 ( 0x01UL )
+#define portMPU_REGION_READ_ONLY              ( 0x06UL << 24UL )
+#define portMPU_REGION_EXECUTE_NEVER          ( 0x01UL << 28UL )
+#define portMPU_RASR_TEX_S_C_B_LOCATION       ( 16UL )
+#define portMPU_RASR_TEX_S_C_B_MASK           ( 0x3FUL )
+#define portMPU_STACK_GUARD_REGION            ( 7UL )
+#define portNVIC_MEM_FAULT_ENABLE             ( 1UL << 16UL )
+#define portMMFSR_MMARVALID                   ( 1UL << 7UL )
+#define portMMFSR_MLSPERR                     ( 1UL << 5UL )
+#define portMMFSR_MSTKERR                     ( 1UL << 4UL )
+
 /* Let the user override the pre-loading of the initial LR with the address of
  * prvTaskExitError() in case it messes up unwinding of the stack in the
  * debugger. */
@@ -136,6 +194,10 @@ void vPortSetupTimerInterrupt( void );
  * Exception handlers.
  */
 void xPortPendSVHandler( void ) __attribute__( ( naked ) );
+
+#if ( configUSE_DIRECT_ISR_YIELD == 1 )
+    void vPortDirectYieldISREntry( void ) __attribute__( ( naked ) );
+#endif
 void xPortSysTickHandler( void );
 void vPortSVCHandler( void ) __attribute__( ( naked ) );
 
@@ -154,12 +216,34 @@ static void vPortEnableVFP( void ) __attribute__( ( naked ) );
  */
 static void prvTaskExitError( void );
 
+#if ( configUSE_MPU_STACK_GUARD == 1 )
+
+/*
+ * Enable the MPU and the MemManage fault, ready for the stack guard.
+ */
+    static void prvSetupStackGuard( void );
+
+/*
+ * The MemManage handler, which reports a write to the stack guard as a stack
+ * overflow.
+ */
+    void vPortMemManageHandler( void );
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* Each task maintains its own interrupt status in the critical nesting
  * variable. */
 static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
 
+#if ( configUSE_MPU_STACK_GUARD == 1 )
+
+/* The region attributes of the stack guard, which are the same for all tasks,
+ * and the base address of the guard of the running task. */
+    static uint32_t ulStackGuardAttributes = 0UL;
+    static uint32_t ulStackGuardBaseAddress = 0UL;
+#endif
+
 /*
  * The number of SysTick increments that make up one tick period.
  */
@@ -183,6 +267,15 @@ static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
     static uint32_t ulStoppedTimerCompensation = 0;
 #endif /* configUSE_TICKLESS_IDLE */
 
+/*
+ * The value of the cycle counter when it was last read, and the number of
+ * times it has wrapped, which together extend it to 64 bits.
+ */
+#if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+    static uint32_t ulLastCycleCount = 0;
+    static uint32_t ulCycleCounterWraps = 0;
+#endif /* configUSE_CYCLE_COUNTER_RUN_TIME_STATS */
+
 /*
  * Used by the portASSERT_IF_INTERRUPT_PRIORITY_INVALID() macro to ensure
  * FreeRTOS API functions are not called from interrupts that have been assigned
@@ -447,6 +540,13 @@ BaseType_t xPortStartScheduler( void )
     /* Lazy save always. */
     *( portFPCCR ) |= portASPEN_AND_LSPEN_BITS;
 
+    #if ( configUSE_MPU_STACK_GUARD == 1 )
+    {
+        /* The kernel has already set the guard of the first task. */
+        prvSetupStackGuard();
+    }
+    #endif
+
     /* Start the first task. */
     prvPortStartFirstTask();
 
@@ -566,6 +666,26 @@ void xPortSysTickHandler( void )
     portDISABLE_INTERRUPTS();
     traceISR_ENTER();
     {
+        #if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+        {
+            /* Read the cycle counter at least once a tick so a wrap is never
+             * missed. */
+            ( void ) ullPortGetCycleCounterValue();
+        }
+        #endif
+
+        #if ( ( configUSE_PC_SAMPLING == 1 ) && ( configPC_SAMPLE_FROM_TICK == 1 ) )
+        {
+            uint32_t * pulProcessStack;
+
+            /* The SysTick cannot interrupt another interrupt, so the program
+             * counter of the running task is the one the hardware stacked at
+             * offset 6 on the process stack. */
+            __asm volatile ( "mrs %0, psp" : "=r" ( pulProcessStack ) );
+            vTaskRecordPCSampleFromISR( ( void * ) pulProcessStack[ 6 ] );
+        }
+        #endif
+
         /* Increment the RTOS tick. */
         if( xTaskIncrementTick() != pdFALSE )
         {
@@ -584,6 +704,89 @@ void xPortSysTickHandler( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+
+    void vPortConfigureCycleCounter( void )
+    {
+        /* Enable the DWT, then check this core implements the cycle counter. */
+        portDCB_DEMCR_REG |= portDCB_DEMCR_TRCENA_BIT;
+        configASSERT( ( portDWT_CTRL_REG & portDWT_CTRL_NOCYCCNT_BIT ) == 0UL );
+
+        ulLastCycleCount = 0UL;
+        ulCycleCounterWraps = 0UL;
+        portDWT_CYCCNT_REG = 0UL;
+        portDWT_CTRL_REG |= portDWT_CTRL_CYCCNTENA_BIT;
+    }
+/*-----------------------------------------------------------*/
+
+    uint64_t ullPortGetCycleCounterValue( void )
+    {
+        uint32_t ulPreviousMask, ulCycleCount;
+        uint64_t ullCycleCount;
+
+        /* Mask interrupts so the wrap count is updated by one caller at a
+         * time.  The SysTick handler reads the counter every tick, and
+         * tickless idle cannot suppress more ticks than the 24-bit SysTick
+         * can count, so the 32-bit counter cannot wrap twice between reads
+         * unless the SysTick runs more than 256 times slower than the core. */
+        ulPreviousMask = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ulCycleCount = portDWT_CYCCNT_REG;
+
+            if( ulCycleCount < ulLastCycleCount )
+            {
+                ulCycleCounterWraps++;
+            }
+
+            ulLastCycleCount = ulCycleCount;
+            ullCycleCount = ( ( ( uint64_t ) ulCycleCounterWraps ) << 32 ) | ( uint64_t ) ulCycleCount;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( ulPreviousMask );
+
+        return ullCycleCount;
+    }
+
+#endif /* configUSE_CYCLE_COUNTER_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DIRECT_ISR_YIELD == 1 )
+
+    void vPortDirectYieldISREntry( void )
+    {
+        /* This is a naked function, entered from a handler defined with
+         * portDIRECT_YIELD_ISR() with the handler's function in r0. */
+
+        __asm volatile
+        (
+            "   push {r4, lr}                       \n" /* Keep EXC_RETURN.  r4 keeps the stack 8 byte aligned. */
+            "   blx r0                              \n" /* Returns xHigherPriorityTaskWoken. */
+            "   pop {r4, lr}                        \n"
+            "   cbz r0, 2f                          \n"
+            "                                       \n"
+            "   ldr r1, =0xe000ed04                 \n" /* The interrupt control and state register. */
+            "   and r0, lr, #0xc                    \n" /* EXC_RETURN bits 3 and 2 are both set when returning to a task. */
+            "   cmp r0, #0xc                        \n"
+            "   bne 1f                              \n"
+            "                                       \n"
+            "   mov r0, %0                          \n" /* Switch here, so a PendSV pended by an earlier interrupt is not needed. */
+            "   str r0, [r1]                        \n"
+            "   b xPortPendSVHandler                \n" /* The task's registers are as they were when the interrupt was taken. */
+            "                                       \n"
+            "1:                                     \n" /* Nested in another handler, so pend PendSV as normal. */
+            "   mov r0, %1                          \n"
+            "   str r0, [r1]                        \n"
+            "                                       \n"
+            "2:                                     \n"
+            "   bx lr                               \n"
+            "                                       \n"
+            "   .ltorg                              \n"
+            ::"i" ( portNVIC_PENDSVCLEAR_BIT ), "i" ( portNVIC_PENDSVSET_BIT )
+        );
+    }
+
+#endif /* configUSE_DIRECT_ISR_YIELD */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TICKLESS_IDLE == 1 )
 
     __attribute__( ( weak ) ) void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
@@ -591,6 +794,10 @@ void xPortSysTickHandler( void )
         uint32_t ulReloadValue, ulCompleteTickPeriods, ulCompletedSysTickDecrements, ulSysTickDecrementsLeft;
         TickType_t xModifiableIdleTime;
 
+        #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            uint32_t ulWakeSource;
+        #endif
+
         /* Make sure the SysTick reload value does not overflow the counter. */
         if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
         {
@@ -677,6 +884,14 @@ void xPortSysTickHandler( void )
 
             configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
 
+            #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            {
+                /* Interrupts are still disabled, so the interrupt that ended
+                 * the sleep is still pending. */
+                ulWakeSource = ( portNVIC_INT_CTRL_REG & portNVIC_VECTPENDING_MASK ) >> portNVIC_VECTPENDING_SHIFT;
+            }
+            #endif
+
             /* Re-enable interrupts to allow the interrupt that brought the MCU
              * out of sleep mode to execute immediately.  See comments above
              * the cpsid instruction above. */
@@ -797,6 +1012,12 @@ void xPortSysTickHandler( void )
             /* Step the tick to account for any tick periods that elapsed. */
             vTaskStepTick( ulCompleteTickPeriods );
 
+            #if ( configUSE_WAKE_SOURCE_STATS == 1 )
+            {
+                vTaskRecordTicklessSleep( xExpectedIdleTime, ulCompleteTickPeriods, ulWakeSource );
+            }
+            #endif
+
             /* Exit with interrupts enabled. */
             __asm volatile ( "cpsie i" ::: "memory" );
         }
@@ -830,6 +1051,129 @@ __attribute__( ( weak ) ) void vPortSetupTimerInterrupt( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DVFS_GOVERNOR == 1 )
+
+/*
+ * Called from the tick interrupt once the application has changed the clock
+ * frequency, so configSYSTICK_CLOCK_HZ and configCPU_CLOCK_HZ now evaluate to
+ * the new frequency.  Recalculates the constants used to configure the tick
+ * interrupt and restarts the SysTick so the next tick follows a full tick
+ * period at the new frequency.  Weak so an application that generates the tick
+ * from a different timer can override it along with vPortSetupTimerInterrupt().
+ */
+    __attribute__( ( weak ) ) void vPortClockChanged( void )
+    {
+        #if ( configUSE_TICKLESS_IDLE == 1 )
+        {
+            ulTimerCountsForOneTick = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ );
+            xMaximumPossibleSuppressedTicks = portMAX_24_BIT_NUMBER / ulTimerCountsForOneTick;
+            ulStoppedTimerCompensation = portMISSED_COUNTS_FACTOR / ( configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ );
+        }
+        #endif /* configUSE_TICKLESS_IDLE */
+
+        /* The tick interrupt has just been taken, so writing the current value
+         * register reloads the SysTick with the new value straight away. */
+        portNVIC_SYSTICK_LOAD_REG = ( configSYSTICK_CLOCK_HZ / configTICK_RATE_HZ ) - 1UL;
+        portNVIC_SYSTICK_CURRENT_VALUE_REG = 0UL;
+    }
+
+#endif /* configUSE_DVFS_GOVERNOR */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MPU_STACK_GUARD == 1 )
+
+    static void prvSetupStackGuard( void )
+    {
+        uint32_t ulRegionSizeInBytes = 32UL;
+        uint32_t ulSizeSetting = 4UL;
+
+        /* The port must run on a part that has an MPU. */
+        configASSERT( ( portMPU_TYPE_REG & portMPU_TYPE_DREGION_MASK ) != 0UL );
+
+        /* The SIZE field of the region holds log2( size ) - 1, and the
+         * smallest region is 32 bytes. */
+        while( ulRegionSizeInBytes < configMPU_STACK_GUARD_SIZE )
+        {
+            ulRegionSizeInBytes <<= 1UL;
+            ulSizeSetting++;
+        }
+
+        ulStackGuardAttributes = ( portMPU_REGION_READ_ONLY ) |
+                                 ( portMPU_REGION_EXECUTE_NEVER ) |
+                                 ( ( configMPU_STACK_GUARD_TEX_S_C_B & portMPU_RASR_TEX_S_C_B_MASK ) << portMPU_RASR_TEX_S_C_B_LOCATION ) |
+                                 ( ulSizeSetting << 1UL ) |
+                                 ( portMPU_REGION_ENABLE );
+
+        /* Program the guard of the first task now the attributes are known. */
+        portMPU_REGION_BASE_ADDRESS_REG = ulStackGuardBaseAddress | portMPU_REGION_VALID | portMPU_STACK_GUARD_REGION;
+        portMPU_REGION_ATTRIBUTE_REG = ulStackGuardAttributes;
+
+        /* Privileged code keeps the default memory map everywhere else. */
+        portNVIC_SYS_CTRL_STATE_REG |= portNVIC_MEM_FAULT_ENABLE;
+        portMPU_CTRL_REG |= ( portMPU_ENABLE | portMPU_BACKGROUND_ENABLE );
+
+        __asm volatile ( "dsb" ::: "memory" );
+        __asm volatile ( "isb" );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortSetStackGuard( StackType_t * pxStackLimit )
+    {
+        /* The region must be aligned to its size, so the guard starts at the
+         * first aligned address within the stack.  Up to twice
+         * configMPU_STACK_GUARD_SIZE bytes of the stack are therefore not
+         * usable. */
+        ulStackGuardBaseAddress = ( ( uint32_t ) pxStackLimit + ( configMPU_STACK_GUARD_SIZE - 1UL ) ) & ~( configMPU_STACK_GUARD_SIZE - 1UL );
+
+        /* Writing the region number with the base address selects the region
+         * the attributes are written to. */
+        portMPU_REGION_BASE_ADDRESS_REG = ulStackGuardBaseAddress | portMPU_REGION_VALID | portMPU_STACK_GUARD_REGION;
+        portMPU_REGION_ATTRIBUTE_REG = ulStackGuardAttributes;
+
+        __asm volatile ( "dsb" ::: "memory" );
+        __asm volatile ( "isb" );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortMemManageHandler( void )
+    {
+        extern TaskHandle_t pxCurrentTCB;
+        uint32_t ulFaultStatus = portSCB_CFSR_REG;
+        BaseType_t xStackOverflow = pdFALSE;
+
+        if( ( ulFaultStatus & ( portMMFSR_MSTKERR | portMMFSR_MLSPERR ) ) != 0UL )
+        {
+            /* Exception entry stacked the task's context into the guard.
+             * Nothing else on the process stack is protected. */
+            xStackOverflow = pdTRUE;
+        }
+        else if( ( ( ulFaultStatus & portMMFSR_MMARVALID ) != 0UL ) &&
+                 ( ( portSCB_MMFAR_REG - ulStackGuardBaseAddress ) < configMPU_STACK_GUARD_SIZE ) )
+        {
+            xStackOverflow = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Only stack overflows are expected to cause a MemManage fault. */
+        configASSERT( xStackOverflow == pdTRUE );
+
+        if( xStackOverflow == pdTRUE )
+        {
+            vApplicationStackOverflowHook( pxCurrentTCB, pcTaskGetName( pxCurrentTCB ) );
+        }
+
+        /* The task that faulted cannot continue. */
+        for( ; ; )
+        {
+        }
+    }
+
+#endif /* configUSE_MPU_STACK_GUARD */
+/*-----------------------------------------------------------*/
+
 /* This is a naked function. */
 static void vPortEnableVFP( void )
 {
@@ -138,6 +138,81 @@ extern void vPortExitCritical( void );
     extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
     #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )    vPortSuppressTicksAndSleep( xExpectedIdleTime )
 #endif
+
+/* The wake source reported to vTaskRecordTicklessSleep() is the exception
+ * number of the interrupt pending when the processor wakes, so the SysTick
+ * exception number identifies sleeps the tick interrupt ended. */
+#define portTICK_WAKE_SOURCE    ( 15UL )
+
+/* Frequency scaling support. */
+#if ( configUSE_DVFS_GOVERNOR == 1 )
+    extern void vPortClockChanged( void );
+    #define portDVFS_CLOCK_CHANGED()    vPortClockChanged()
+#endif
+/*-----------------------------------------------------------*/
+
+/* Run time stats clock.  Set configUSE_CYCLE_COUNTER_RUN_TIME_STATS to 1 to
+ * use the DWT cycle counter, extended to 64 bits by the port, as the run time
+ * stats clock instead of providing one in FreeRTOSConfig.h. */
+#ifndef configUSE_CYCLE_COUNTER_RUN_TIME_STATS
+    #define configUSE_CYCLE_COUNTER_RUN_TIME_STATS    0
+#endif
+
+#if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+    #if defined( portGET_RUN_TIME_COUNTER_VALUE ) || defined( portALT_GET_RUN_TIME_COUNTER_VALUE )
+        #error Do not define a run time stats clock when configUSE_CYCLE_COUNTER_RUN_TIME_STATS is 1.
+    #endif
+
+    extern void vPortConfigureCycleCounter( void );
+    extern uint64_t ullPortGetCycleCounterValue( void );
+    #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    vPortConfigureCycleCounter()
+    #define portGET_RUN_TIME_COUNTER_VALUE()            ( ( configRUN_TIME_COUNTER_TYPE ) ullPortGetCycleCounterValue() )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Hardware stack guard.  Set configUSE_MPU_STACK_GUARD to 1 to have the port
+ * make the lowest configMPU_STACK_GUARD_SIZE aligned bytes of the running
+ * task's stack a read only MPU region, so a stack overflow causes a MemManage
+ * fault as soon as it happens instead of being looked for on each context
+ * switch.  vPortMemManageHandler() must be installed as the MemManage handler. */
+#ifndef configUSE_MPU_STACK_GUARD
+    #define configUSE_MPU_STACK_GUARD    0
+#endif
+
+#if ( configUSE_MPU_STACK_GUARD == 1 )
+    extern void vPortSetStackGuard( StackType_t * pxStackLimit );
+    #define portHAS_STACK_GUARD                    1
+    #define portSET_STACK_GUARD( pxStackLimit )    vPortSetStackGuard( pxStackLimit )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Direct yield from ISR.  Set configUSE_DIRECT_ISR_YIELD to 1 to have an
+ * interrupt handler defined with portDIRECT_YIELD_ISR() switch to the task it
+ * unblocked itself, rather than pend PendSV and switch in a second exception.
+ * The switch is only made this way when the interrupt was taken from a task -
+ * a nested interrupt pends PendSV as normal. */
+#ifndef configUSE_DIRECT_ISR_YIELD
+    #define configUSE_DIRECT_ISR_YIELD    0
+#endif
+
+#if ( configUSE_DIRECT_ISR_YIELD == 1 )
+
+/* Defines the interrupt handler vHandlerName, to be installed directly in the
+ * vector table, which calls xISRFunction.  xISRFunction has the prototype
+ * BaseType_t xISRFunction( void ) and returns its xHigherPriorityTaskWoken
+ * value rather than calling portYIELD_FROM_ISR(). */
+    #define portDIRECT_YIELD_ISR( vHandlerName, xISRFunction )  \
+    void vHandlerName( void ) __attribute__( ( naked ) );       \
+    void vHandlerName( void )                                   \
+    {                                                           \
+        __asm volatile                                          \
+        (                                                       \
+            "   movw r0, #:lower16:" #xISRFunction "    \n"     \
+            "   movt r0, #:upper16:" #xISRFunction "    \n"     \
+            "   b vPortDirectYieldISREntry              \n"     \
+        );                                                      \
+    }
+#endif /* configUSE_DIRECT_ISR_YIELD */
 /*-----------------------------------------------------------*/
 
 /* Architecture specific optimisations. */
@@ -210,6 +285,23 @@ portFORCE_INLINE static BaseType_t xPortIsInsideInterrupt( void )
 
 /*-----------------------------------------------------------*/
 
+/* The interrupt number used by configUSE_ISR_RUN_TIME_STATS is the exception
+ * number held in IPSR. */
+portFORCE_INLINE static UBaseType_t uxPortGetInterruptNumber( void )
+{
+    uint32_t ulCurrentInterrupt;
+
+    __asm volatile ( "mrs %0, ipsr" : "=r" ( ulCurrentInterrupt )::"memory" );
+
+    return ( UBaseType_t ) ulCurrentInterrupt;
+}
+
+#ifndef portGET_INTERRUPT_NUMBER
+    #define portGET_INTERRUPT_NUMBER()    uxPortGetInterruptNumber()
+#endif
+
+/*-----------------------------------------------------------*/
+
 portFORCE_INLINE static void vPortRaiseBASEPRI( void )
 {
     uint32_t ulNewBASEPRI;
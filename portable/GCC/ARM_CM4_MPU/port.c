@@ -298,6 +298,16 @@ static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
 
 #endif /* #if ( configUSE_MPU_WRAPPERS_V1 == 0 ) */
 
+#if ( configUSE_MPU_SETTINGS_CACHE == 1 )
+
+/*
+ * The MPU settings of the task whose regions are programmed in the MPU, or
+ * NULL if the MPU must be reprogrammed on the next context switch.
+ */
+    PRIVILEGED_DATA portDONT_DISCARD xMPU_SETTINGS * volatile pxProgrammedMPUSettings = NULL;
+
+#endif /* #if ( configUSE_MPU_SETTINGS_CACHE == 1 ) */
+
 /*
  * Used by the portASSERT_IF_INTERRUPT_PRIORITY_INVALID() macro to ensure
  * FreeRTOS API functions are not called from interrupts that have been assigned
@@ -1123,6 +1133,13 @@ void xPortPendSVHandler( void )
         " ldr r3, =pxCurrentTCB                 \n" /* r3 = =pxCurrentTCB. */
         " ldr r2, [r3]                          \n" /* r2 = pxCurrentTCB. */
         " add r2, r2, #4                        \n" /* r2 = Second item in the TCB which is xMPUSettings. */
+        #if ( configUSE_MPU_SETTINGS_CACHE == 1 )
+            " ldr r3, =pxProgrammedMPUSettings      \n" /* r3 = &pxProgrammedMPUSettings. */
+            " ldr r0, [r3]                          \n" /* r0 = pxProgrammedMPUSettings. */
+            " cmp r0, r2                            \n"
+            " beq 1f                                \n" /* The MPU already holds the task's regions. */
+            " str r2, [r3]                          \n" /* pxProgrammedMPUSettings = &( pxCurrentTCB->xMPUSettings ). */
+        #endif
         "                                       \n"
         " dmb                                   \n" /* Complete outstanding transfers before disabling MPU. */
         " ldr r0, =0xe000ed94                   \n" /* MPU_CTRL register. */
@@ -1148,6 +1165,7 @@ void xPortPendSVHandler( void )
         " dsb                                   \n" /* Force memory writes before continuing. */
         "                                       \n"
         /*---------- Restore Context. ---------- */
+        " 1:                                    \n"
         " ldr r3, =pxCurrentTCB                 \n" /* r3 = =pxCurrentTCB. */
         " ldr r2, [r3]                          \n" /* r2 = pxCurrentTCB. */
         " ldr r1, [r2]                          \n" /* r1 = Location of saved context in TCB. */
@@ -1505,6 +1523,15 @@ void vPortStoreTaskMPUSettings( xMPU_SETTINGS * xMPUSettings,
             lIndex++;
         }
     }
+
+    #if ( configUSE_MPU_SETTINGS_CACHE == 1 )
+    {
+        /* The task's regions may have changed, so make the next context switch
+         * reprogram the MPU.  Done last so the MPU cannot be left holding
+         * regions that were only partly updated. */
+        pxProgrammedMPUSettings = NULL;
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -104,6 +104,13 @@ typedef unsigned long    UBaseType_t;
     #define configTOTAL_MPU_REGIONS    ( 8UL )
 #endif
 
+/* Set configUSE_MPU_SETTINGS_CACHE to 1 to skip reprogramming the MPU on a
+ * context switch when it already holds the regions of the task being switched
+ * in. */
+#ifndef configUSE_MPU_SETTINGS_CACHE
+    #define configUSE_MPU_SETTINGS_CACHE    0
+#endif
+
 /*
  * The TEX, Shareable (S), Cacheable (C) and Bufferable (B) bits define the
  * memory type, and where necessary the cacheable and shareable properties
@@ -108,6 +108,19 @@ typedef unsigned long    UBaseType_t;
  */
 extern BaseType_t xPortIsInsideInterrupt( void );
 
+/**
+ * @brief The number of the executing exception, as used by
+ * configUSE_ISR_RUN_TIME_STATS.
+ */
+static portFORCE_INLINE UBaseType_t uxPortGetInterruptNumber( void )
+{
+    uint32_t ulCurrentInterrupt;
+
+    __asm volatile ( "mrs %0, ipsr" : "=r" ( ulCurrentInterrupt )::"memory" );
+
+    return ( UBaseType_t ) ulCurrentInterrupt;
+}
+
 extern void vPortYield( void ) /* PRIVILEGED_FUNCTION */;
 
 extern void vPortEnterCritical( void ) /* PRIVILEGED_FUNCTION */;
@@ -143,6 +156,20 @@ extern void vClearInterruptMask( uint32_t ulMask ) /* __attribute__(( naked )) P
     #define configTOTAL_MPU_REGIONS    ( 8UL )
 #endif
 
+/* Set configUSE_SHARED_MPU_REGIONS to 1 to reserve the last 4 of 16 MPU
+ * regions for regions that are shared by all the tasks.  Shared regions are
+ * programmed once when the scheduler starts rather than on every context
+ * switch, and do not use any of the per task regions. */
+#ifndef configUSE_SHARED_MPU_REGIONS
+    #define configUSE_SHARED_MPU_REGIONS    0
+#endif
+
+#if ( configUSE_SHARED_MPU_REGIONS == 1 )
+    #define portNUM_SHARED_REGIONS    ( 4UL )
+#else
+    #define portNUM_SHARED_REGIONS    ( 0UL )
+#endif
+
 /* MPU regions. */
 #define portPRIVILEGED_FLASH_REGION                   ( 0UL )
 #define portUNPRIVILEGED_FLASH_REGION                 ( 1UL )
@@ -150,7 +177,8 @@ extern void vClearInterruptMask( uint32_t ulMask ) /* __attribute__(( naked )) P
 #define portPRIVILEGED_RAM_REGION                     ( 3UL )
 #define portSTACK_REGION                              ( 4UL )
 #define portFIRST_CONFIGURABLE_REGION                 ( 5UL )
-#define portLAST_CONFIGURABLE_REGION                  ( configTOTAL_MPU_REGIONS - 1UL )
+#define portLAST_CONFIGURABLE_REGION                  ( configTOTAL_MPU_REGIONS - portNUM_SHARED_REGIONS - 1UL )
+#define portFIRST_SHARED_REGION                       ( configTOTAL_MPU_REGIONS - portNUM_SHARED_REGIONS )
 #define portNUM_CONFIGURABLE_REGIONS                  ( ( portLAST_CONFIGURABLE_REGION - portFIRST_CONFIGURABLE_REGION ) + 1 )
 #define portTOTAL_NUM_REGIONS                         ( portNUM_CONFIGURABLE_REGIONS + 1 )       /* Plus one to make space for the stack region. */
 
@@ -375,6 +403,114 @@ extern void vClearInterruptMask( uint32_t ulMask ) /* __attribute__(( naked )) P
     extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
     #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )    vPortSuppressTicksAndSleep( xExpectedIdleTime )
 #endif
+
+/* The wake source reported to vTaskRecordTicklessSleep() is the exception
+ * number of the interrupt pending when the processor wakes, so the SysTick
+ * exception number identifies sleeps the tick interrupt ended. */
+#define portTICK_WAKE_SOURCE    ( 15UL )
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Run time stats clock.
+ *
+ * Set configUSE_CYCLE_COUNTER_RUN_TIME_STATS to 1 to use the DWT cycle
+ * counter, extended to 64 bits by the port, as the run time stats clock
+ * instead of providing one in FreeRTOSConfig.h.
+ */
+#ifndef configUSE_CYCLE_COUNTER_RUN_TIME_STATS
+    #define configUSE_CYCLE_COUNTER_RUN_TIME_STATS    0
+#endif
+
+#if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+    #if ( portHAS_ARMV8M_MAIN_EXTENSION == 0 )
+        #error configUSE_CYCLE_COUNTER_RUN_TIME_STATS needs the DWT cycle counter, which ARMv8-M Baseline cores do not have.
+    #endif
+
+    #if defined( portGET_RUN_TIME_COUNTER_VALUE ) || defined( portALT_GET_RUN_TIME_COUNTER_VALUE )
+        #error Do not define a run time stats clock when configUSE_CYCLE_COUNTER_RUN_TIME_STATS is 1.
+    #endif
+
+    extern void vPortConfigureCycleCounter( void );
+    extern uint64_t ullPortGetCycleCounterValue( void );
+    #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    vPortConfigureCycleCounter()
+    #define portGET_RUN_TIME_COUNTER_VALUE()            ( ( configRUN_TIME_COUNTER_TYPE ) ullPortGetCycleCounterValue() )
+#endif
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief MPU settings cache.
+ *
+ * Set configUSE_MPU_SETTINGS_CACHE to 1 to have PendSV skip reprogramming the
+ * per task MPU regions when the MPU already holds the regions of the task
+ * being switched in.
+ */
+#ifndef configUSE_MPU_SETTINGS_CACHE
+    #define configUSE_MPU_SETTINGS_CACHE    0
+#endif
+
+#if ( configENABLE_MPU == 1 )
+    #if ( ( configUSE_MPU_SETTINGS_CACHE == 1 ) || ( configUSE_SHARED_MPU_REGIONS == 1 ) )
+        #if ( portHAS_ARMV8M_MAIN_EXTENSION == 0 ) || defined( __ICCARM__ )
+            #error configUSE_MPU_SETTINGS_CACHE and configUSE_SHARED_MPU_REGIONS are only supported by the GCC ARMv8-M Mainline ports.
+        #endif
+    #endif
+
+    #if ( ( configUSE_SHARED_MPU_REGIONS == 1 ) && ( configTOTAL_MPU_REGIONS != 16 ) )
+        #error configUSE_SHARED_MPU_REGIONS requires configTOTAL_MPU_REGIONS to be 16.
+    #endif
+
+    #if ( configUSE_SHARED_MPU_REGIONS == 1 )
+        struct xMEMORY_REGION;
+
+/**
+ * @brief Defines the regions shared by all the tasks.
+ *
+ * Must be called before the scheduler is started.  xRegions points to an array
+ * of portNUM_SHARED_REGIONS regions - unused regions have a length of 0.
+ */
+        extern void vPortSetSharedMPURegions( const struct xMEMORY_REGION * const xRegions ) /* PRIVILEGED_FUNCTION */;
+    #endif
+#endif /* configENABLE_MPU */
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Lazy secure context switching.
+ *
+ * Set configUSE_LAZY_SECURE_CONTEXT_SWITCH to 1 to leave a task's secure
+ * context loaded when the task is switched out while executing non-secure
+ * code.  The context is only saved when another task needs the secure side,
+ * and is not loaded again if the task is the next one to use it.
+ */
+#ifndef configUSE_LAZY_SECURE_CONTEXT_SWITCH
+    #define configUSE_LAZY_SECURE_CONTEXT_SWITCH    0
+#endif
+
+#if ( ( configENABLE_TRUSTZONE == 1 ) && ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 ) )
+    #if ( portHAS_ARMV8M_MAIN_EXTENSION == 0 ) || defined( __ICCARM__ ) || ( configENABLE_MPU == 1 )
+        #error configUSE_LAZY_SECURE_CONTEXT_SWITCH is only supported by the GCC ARMv8-M Mainline ports with configENABLE_MPU set to 0.
+    #endif
+#endif
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief The interrupt number used by configUSE_ISR_RUN_TIME_STATS.
+ */
+#ifndef portGET_INTERRUPT_NUMBER
+    #define portGET_INTERRUPT_NUMBER()    uxPortGetInterruptNumber()
+#endif
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Per task FPU and MVE state.
+ *
+ * When configUSE_TASK_VECTOR_UNIT_FLAG is 1 the hardware only creates the
+ * extended stack frame (s0-s31, FPSCR and VPR) for tasks that have called
+ * vTaskSetUsesVectorUnit().
+ */
+#if defined( configUSE_TASK_VECTOR_UNIT_FLAG ) && ( configUSE_TASK_VECTOR_UNIT_FLAG == 1 )
+    extern void vPortSetVectorUnitState( BaseType_t xUsesVectorUnit ) /* PRIVILEGED_FUNCTION */;
+    #define portSET_VECTOR_UNIT_STATE( xUsesVectorUnit )    vPortSetVectorUnitState( xUsesVectorUnit )
+#endif
 /*-----------------------------------------------------------*/
 
 /**
@@ -458,7 +594,9 @@ extern void vClearInterruptMask( uint32_t ulMask ) /* __attribute__(( naked )) P
 /*-----------------------------------------------------------*/
 
 /* Select correct value of configUSE_PORT_OPTIMISED_TASK_SELECTION
- * based on whether or not Mainline extension is implemented. */
+ * based on whether or not Mainline extension is implemented.  Baseline
+ * implementations can still set it to 1 to use a table-driven selection that
+ * does not need the count leading zeros instruction. */
 #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
     #if ( portHAS_ARMV8M_MAIN_EXTENSION == 1 )
         #define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
@@ -472,27 +610,55 @@ extern void vClearInterruptMask( uint32_t ulMask ) /* __attribute__(( naked )) P
  */
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
 
+    #if ( portHAS_ARMV8M_MAIN_EXTENSION == 1 )
+
 /**
  * @brief Count the number of leading zeros in a 32-bit value.
  */
-    static portFORCE_INLINE uint32_t ulPortCountLeadingZeros( uint32_t ulBitmap )
-    {
-        uint32_t ulReturn;
+        static portFORCE_INLINE uint32_t ulPortCountLeadingZeros( uint32_t ulBitmap )
+        {
+            uint32_t ulReturn;
 
-        __asm volatile ( "clz %0, %1" : "=r" ( ulReturn ) : "r" ( ulBitmap ) : "memory" );
+            __asm volatile ( "clz %0, %1" : "=r" ( ulReturn ) : "r" ( ulBitmap ) : "memory" );
 
-        return ulReturn;
-    }
+            return ulReturn;
+        }
+
+    #else /* if ( portHAS_ARMV8M_MAIN_EXTENSION == 1 ) */
+
+/**
+ * @brief Get the number of the most significant set bit in a non-zero value.
+ *
+ * Baseline implementations have no count leading zeros instruction, so the
+ * most significant set bit is smeared into every bit below it, leaving one of
+ * only 32 possible values, which a de Bruijn multiply maps onto a 32-entry
+ * table.
+ */
+        static portFORCE_INLINE uint32_t ulPortGetHighestSetBit( uint32_t ulBitmap )
+        {
+            static const uint8_t ucDeBruijnBitNumber[ 32 ] =
+            {
+                0U,  9U,  1U,  10U, 13U, 21U, 2U,  29U, 11U, 14U, 16U, 18U, 22U, 25U, 3U,  30U,
+                8U,  12U, 20U, 28U, 15U, 17U, 24U, 7U,  19U, 27U, 23U, 6U,  26U, 5U,  4U,  31U
+            };
+
+            ulBitmap |= ulBitmap >> 1U;
+            ulBitmap |= ulBitmap >> 2U;
+            ulBitmap |= ulBitmap >> 4U;
+            ulBitmap |= ulBitmap >> 8U;
+            ulBitmap |= ulBitmap >> 16U;
+            ulBitmap *= 0x07C4ACDDUL;
+
+            return ( uint32_t ) ucDeBruijnBitNumber[ ulBitmap >> 27U ];
+        }
+
+    #endif /* if ( portHAS_ARMV8M_MAIN_EXTENSION == 1 ) */
 
 /* Check the configuration. */
     #if ( configMAX_PRIORITIES > 32 )
         #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 different priorities as tasks that share a priority will time slice.
     #endif
 
-    #if ( portHAS_ARMV8M_MAIN_EXTENSION == 0 )
-        #error ARMv8-M baseline implementations (such as Cortex-M23) do not support port-optimised task selection.  Please set configUSE_PORT_OPTIMISED_TASK_SELECTION to 0 or leave it undefined.
-    #endif
-
 /**
  * @brief Store/clear the ready priorities in a bit map.
  */
@@ -502,7 +668,11 @@ extern void vClearInterruptMask( uint32_t ulMask ) /* __attribute__(( naked )) P
 /**
  * @brief Get the priority of the highest-priority task that is ready to execute.
  */
-    #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( 31UL - ulPortCountLeadingZeros( ( uxReadyPriorities ) ) )
+    #if ( portHAS_ARMV8M_MAIN_EXTENSION == 1 )
+        #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( 31UL - ulPortCountLeadingZeros( ( uxReadyPriorities ) ) )
+    #else
+        #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ulPortGetHighestSetBit( ( uxReadyPriorities ) )
+    #endif
 
 #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 /*-----------------------------------------------------------*/
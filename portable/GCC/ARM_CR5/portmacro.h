@@ -128,7 +128,14 @@ void FreeRTOS_Tick_Handler( void );
  * If configUSE_TASK_FPU_SUPPORT is set to 1, then tasks are created without an
  * FPU context and must call vPortTaskUsesFPU() to allocate an FPU context
  * prior to any FPU instructions. If configUSE_TASK_FPU_SUPPORT is set to 2,
- * then all tasks have an FPU context allocated by default.
+ * then all tasks have an FPU context allocated by default. If
+ * configUSE_TASK_FPU_SUPPORT is set to 3, then all tasks have an FPU context
+ * that is switched lazily - the FPU registers are only saved and restored when
+ * a task executes a floating point instruction while the FPU holds another
+ * task's registers. FreeRTOS_Undefined_Handler must then be installed as the
+ * undefined instruction handler, an undefined instruction mode stack must be
+ * set up, and the kernel and any interrupt handlers not called through
+ * vApplicationFPUSafeIRQHandler() must not use the FPU.
  */
 #if ( configUSE_TASK_FPU_SUPPORT == 1 )
     void vPortTaskUsesFPU( void );
@@ -141,6 +148,13 @@ void FreeRTOS_Tick_Handler( void );
  */
     #define vPortTaskUsesFPU()
     #define portTASK_USES_FLOATING_POINT()
+#elif ( configUSE_TASK_FPU_SUPPORT == 3 )
+    #define vPortTaskUsesFPU()
+    #define portTASK_USES_FLOATING_POINT()
+
+/* Stop a deleted task's FPU save area being used after it is freed. */
+    void vPortCleanUpTCB( void * pvTCB );
+    #define portCLEAN_UP_TCB( pxTCB )    vPortCleanUpTCB( pxTCB )
 #endif /* configUSE_TASK_FPU_SUPPORT */
 
 #define portLOWEST_INTERRUPT_PRIORITY           ( ( ( uint32_t ) configUNIQUE_INTERRUPT_PRIORITIES ) - 1UL )
@@ -265,6 +265,25 @@ void FreeRTOS_SVC_Handler( void );
  */
 void FreeRTOS_IRQ_Handler( void );
 
+#if ( configUSE_FAST_IRQ_HANDLER == 1 )
+
+/**
+ * @brief Application provided handler for interrupts that do not use the
+ * kernel.
+ *
+ * Called by FreeRTOS_IRQ_Handler() in IRQ mode, with IRQs disabled, before the
+ * kernel aware interrupt entry code runs. Typically reads the pending vector
+ * from the interrupt controller and services it directly if it is one of the
+ * application's high frequency, non-kernel interrupts.
+ *
+ * @return Non-zero if the interrupt was handled, in which case the kernel
+ * aware path is skipped. 0 to pass the interrupt to vApplicationIRQHandler().
+ *
+ * @ingroup Interrupt Management
+ */
+    uint32_t ulApplicationFastIRQHandler( void );
+#endif /* configUSE_FAST_IRQ_HANDLER */
+
 /**
  * @brief Yield the CPU.
  *
@@ -62,6 +62,24 @@ extern "C" {
 
 #define portENABLE_FPU configENABLE_FPU
 
+/*
+ * Set configUSE_FAST_IRQ_HANDLER to 1 to have FreeRTOS_IRQ_Handler call the
+ * application provided ulApplicationFastIRQHandler() before doing any kernel
+ * bookkeeping. If ulApplicationFastIRQHandler() handles the interrupt and
+ * returns a non-zero value then FreeRTOS_IRQ_Handler returns from the exception
+ * straight away - the interrupt nesting count is not updated, the processor
+ * stays in IRQ mode, and no context switch is considered. If it returns 0 then
+ * the interrupt is passed to vApplicationIRQHandler() as normal.
+ *
+ * This lets high frequency interrupts that never call the FreeRTOS API skip
+ * the kernel aware entry and exit code. ulApplicationFastIRQHandler() runs on
+ * the IRQ stack with IRQs disabled, must not re-enable them, and must not call
+ * any FreeRTOS API function.
+ */
+#ifndef configUSE_FAST_IRQ_HANDLER
+    #define configUSE_FAST_IRQ_HANDLER    0
+#endif /* configUSE_FAST_IRQ_HANDLER */
+
 /* On the ArmV7-R Architecture the Operating mode of the Processor is set
  * using the Current Program Status Register (CPSR) Mode bits, [4:0]. The only
  * unprivileged mode is User Mode.
@@ -88,6 +88,11 @@
     #define portFPU_REGISTER_WORDS     ( ( 16 * 2 ) + 1 ) /* D0-D15 and FPSCR. */
 #endif /* configFPU_D32 */
 
+/* When configUSE_TASK_FPU_SUPPORT is 3 each task has an area at the top of its
+ * stack that its FPU registers are moved to when another task takes the FPU.
+ * A word of padding keeps the task's initial stack pointer 8 byte aligned. */
+#define portFPU_LAZY_CONTEXT_WORDS    ( portFPU_REGISTER_WORDS + 1 )
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -112,10 +117,19 @@ static void prvTaskExitError( void );
  * automatically be set to 0 when the first task is started. */
 volatile uint32_t ulCriticalNesting = 9999UL;
 
-/* Saved as part of the task context.  If ulPortTaskHasFPUContext is non-zero then
- * a floating point context must be saved and restored for the task. */
+/* Saved as part of the task context.  If ulPortTaskHasFPUContext is pdTRUE then
+ * a floating point context must be saved and restored for the task.  When
+ * configUSE_TASK_FPU_SUPPORT is 3 it instead holds the address of the task's FPU
+ * save area. */
 volatile uint32_t ulPortTaskHasFPUContext = pdFALSE;
 
+/* Only used when configUSE_TASK_FPU_SUPPORT is 3.  The address of the FPU save
+ * area of the task whose registers are held in the FPU, or 0 if there is no such
+ * task.  Only that task runs with the FPU enabled - any other task that executes
+ * a floating point instruction enters FreeRTOS_Undefined_Handler, which moves
+ * the FPU registers over to it. */
+volatile uint32_t ulPortFPUOwnerContext = 0UL;
+
 /* Set to 1 to pend a context switch from an ISR. */
 volatile uint32_t ulPortYieldRequired = pdFALSE;
 
@@ -135,6 +149,20 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
                                      TaskFunction_t pxCode,
                                      void * pvParameters )
 {
+    #if ( configUSE_TASK_FPU_SUPPORT == 3 )
+        StackType_t * pxFPUContext;
+    #endif
+
+    #if ( configUSE_TASK_FPU_SUPPORT == 3 )
+    {
+        /* Reserve the task's FPU save area above its initial context.  The
+         * task's floating point registers start as 0. */
+        pxTopOfStack -= portFPU_LAZY_CONTEXT_WORDS;
+        pxFPUContext = pxTopOfStack + 1;
+        memset( pxFPUContext, 0x00, portFPU_LAZY_CONTEXT_WORDS * sizeof( StackType_t ) );
+    }
+    #endif /* configUSE_TASK_FPU_SUPPORT */
+
     /* Setup the initial stack of the task.  The stack is set exactly as
      * expected by the portRESTORE_CONTEXT() macro.
      *
@@ -216,9 +244,17 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
         *pxTopOfStack = pdTRUE;
         ulPortTaskHasFPUContext = pdTRUE;
     }
+    #elif ( configUSE_TASK_FPU_SUPPORT == 3 )
+    {
+        /* The FPU registers are not part of the context.  The slot that would
+         * otherwise hold pdTRUE or pdFALSE holds the address of the task's FPU
+         * save area instead. */
+        pxTopOfStack--;
+        *pxTopOfStack = ( StackType_t ) pxFPUContext;
+    }
     #else
     {
-        #error "Invalid configUSE_TASK_FPU_SUPPORT value - configUSE_TASK_FPU_SUPPORT must be set to 1, 2, or left undefined."
+        #error "Invalid configUSE_TASK_FPU_SUPPORT value - configUSE_TASK_FPU_SUPPORT must be set to 1, 2, 3, or left undefined."
     }
     #endif /* if ( configUSE_TASK_FPU_SUPPORT == 1 ) */
 
@@ -341,7 +377,7 @@ void FreeRTOS_Tick_Handler( void )
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TASK_FPU_SUPPORT != 2 )
+#if ( configUSE_TASK_FPU_SUPPORT == 1 )
 
     void vPortTaskUsesFPU( void )
     {
@@ -355,3 +391,30 @@ void FreeRTOS_Tick_Handler( void )
 
 #endif /* configUSE_TASK_FPU_SUPPORT */
 /*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_FPU_SUPPORT == 3 )
+
+    void vPortCleanUpTCB( void * pvTCB )
+    {
+        uint32_t ulFPUContext;
+
+        /* The first member of a TCB is the task's saved stack pointer, and the
+         * first word of the saved context is the address of the task's FPU
+         * save area. */
+        ulFPUContext = **( ( uint32_t ** ) pvTCB );
+
+        /* If the task being deleted owns the FPU then forget it, so its save
+         * area, which is about to be freed, is not written to when the next
+         * task takes the FPU. */
+        portENTER_CRITICAL();
+        {
+            if( ulPortFPUOwnerContext == ulFPUContext )
+            {
+                ulPortFPUOwnerContext = 0UL;
+            }
+        }
+        portEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TASK_FPU_SUPPORT */
+/*-----------------------------------------------------------*/
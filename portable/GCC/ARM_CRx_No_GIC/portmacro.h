@@ -145,8 +145,14 @@ UBaseType_t ulPortCountLeadingZeros( UBaseType_t ulBitmap );
  * created without an FPU context and must call vPortTaskUsesFPU() to give
  * themselves an FPU context before using any FPU instructions.  If
  * configUSE_TASK_FPU_SUPPORT is set to 2 then all tasks will have an FPU
- * context by default. */
-#if ( configUSE_TASK_FPU_SUPPORT != 2 )
+ * context by default.  If configUSE_TASK_FPU_SUPPORT is set to 3 then all tasks
+ * have an FPU context that is switched lazily - the FPU registers are only saved
+ * and restored when a task executes a floating point instruction while the FPU
+ * holds another task's registers.  FreeRTOS_Undefined_Handler must then be
+ * installed as the undefined instruction handler, an undefined instruction mode
+ * stack must be set up, and the kernel and any interrupt handlers not called
+ * through vApplicationFPUSafeIRQHandler() must not use the FPU. */
+#if ( configUSE_TASK_FPU_SUPPORT == 1 )
     void vPortTaskUsesFPU( void );
 #else
     /* Each task has an FPU context already, so define this function as a
@@ -155,6 +161,12 @@ UBaseType_t ulPortCountLeadingZeros( UBaseType_t ulBitmap );
 #endif
 #define portTASK_USES_FLOATING_POINT()    vPortTaskUsesFPU()
 
+#if ( configUSE_TASK_FPU_SUPPORT == 3 )
+    /* Stop a deleted task's FPU save area being used after it is freed. */
+    void vPortCleanUpTCB( void * pvTCB );
+    #define portCLEAN_UP_TCB( pxTCB )    vPortCleanUpTCB( pxTCB )
+#endif
+
 #define portLOWEST_INTERRUPT_PRIORITY           ( ( ( uint32_t ) configUNIQUE_INTERRUPT_PRIORITIES ) - 1UL )
 #define portLOWEST_USABLE_INTERRUPT_PRIORITY    ( portLOWEST_INTERRUPT_PRIORITY - 1UL )
 
@@ -178,25 +178,30 @@ void _init_startup( void )
  * consuming process.
  */
 
+#if ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 0 )
+
 /*
  * Lock routine called by Newlib on malloc / realloc / free entry to guarantee a
  * safe section as memory allocation management uses global data.
- * See the aforementioned details.
+ * See the aforementioned details.  heap_3.c provides the lock instead when
+ * configHEAP_3_USE_LIBC_MALLOC_LOCK is 1.
  */
-void __malloc_lock( struct _reent * ptr )
-{
-    vTaskSuspendAll();
-}
+    void __malloc_lock( struct _reent * ptr )
+    {
+        vTaskSuspendAll();
+    }
 
 /*
  * Unlock routine called by Newlib on malloc / realloc / free exit to guarantee
  * a safe section as memory allocation management uses global data.
  * See the aforementioned details.
  */
-void __malloc_unlock( struct _reent * ptr )
-{
-    xTaskResumeAll();
-}
+    void __malloc_unlock( struct _reent * ptr )
+    {
+        xTaskResumeAll();
+    }
+
+#endif /* configHEAP_3_USE_LIBC_MALLOC_LOCK */
 /*-----------------------------------------------------------*/
 
 /* Added as there is no such function in FreeRTOS. */
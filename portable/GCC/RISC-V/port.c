@@ -50,6 +50,31 @@
     #warning "configMTIMECMP_BASE_ADDRESS must be defined in FreeRTOSConfig.h. If the target chip includes a memory-mapped mtimecmp register then set configMTIMECMP_BASE_ADDRESS to the mapped address.  Otherwise set configMTIMECMP_BASE_ADDRESS to 0.  See www.FreeRTOS.org/Using-FreeRTOS-on-RISC-V.html"
 #endif
 
+#if ( configNUMBER_OF_CORES > 1 )
+    #if !defined( configMSIP_BASE_ADDRESS ) && defined( configCLINT_BASE_ADDRESS )
+        /* The MSIP registers are at the start of a SiFive compatible CLINT. */
+        #define configMSIP_BASE_ADDRESS    ( configCLINT_BASE_ADDRESS )
+    #endif
+
+    #ifndef configMSIP_BASE_ADDRESS
+        #error "configMSIP_BASE_ADDRESS must be set to the address of the CLINT or ACLINT MSWI MSIP registers when configNUMBER_OF_CORES is greater than 1."
+    #endif
+
+    #ifndef configISR_STACK_SIZE_WORDS
+        #error "configISR_STACK_SIZE_WORDS must be defined when configNUMBER_OF_CORES is greater than 1 as each hart needs its own interrupt stack."
+    #endif
+#endif /* configNUMBER_OF_CORES */
+
+#if ( configCLIC_BASE_ADDRESS != 0 )
+
+/* The clicintip, clicintie, clicintattr and clicintctl registers of each
+ * interrupt are the bytes of one word in the CLIC, starting at this offset. */
+    #define portCLIC_INTERRUPT_OFFSET    ( 0x1000UL )
+    #define portCLIC_INTIE               ( 1UL )
+    #define portCLIC_INTCTL              ( 3UL )
+    #define portCLIC_MTIMER_ID           ( 7UL )
+#endif /* configCLIC_BASE_ADDRESS */
+
 /* Let the user override the pre-loading of the initial RA. */
 #ifdef configTASK_RETURN_ADDRESS
     #define portTASK_RETURN_ADDRESS    configTASK_RETURN_ADDRESS
@@ -64,14 +89,14 @@
  * of the stack used by main.  Using the linker script method will repurpose the
  * stack that was used by main before the scheduler was started for use as the
  * interrupt stack after the scheduler has started. */
-#ifdef configISR_STACK_SIZE_WORDS
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* Each hart has its own interrupt stack.  The top of each is recorded in
+ * xPortHartData[] when the scheduler starts. */
+static __attribute__( ( aligned( 16 ) ) ) StackType_t xISRStacks[ configNUMBER_OF_CORES ][ configISR_STACK_SIZE_WORDS ] = { 0 };
+#elif defined( configISR_STACK_SIZE_WORDS )
 static __attribute__( ( aligned( 16 ) ) ) StackType_t xISRStack[ configISR_STACK_SIZE_WORDS ] = { 0 };
 const StackType_t xISRStackTop = ( StackType_t ) &( xISRStack[ configISR_STACK_SIZE_WORDS & ~portBYTE_ALIGNMENT_MASK ] );
-
-/* Don't use 0xa5 as the stack fill bytes as that is used by the kernel for
- * the task stacks, and so will legitimately appear in many positions within
- * the ISR stack. */
-    #define portISR_STACK_FILL_BYTE    0xee
 #else
     extern const uint32_t __freertos_irq_stack_top[];
     const StackType_t xISRStackTop = ( StackType_t ) __freertos_irq_stack_top;
@@ -84,6 +109,13 @@ const StackType_t xISRStackTop = ( StackType_t ) &( xISRStack[ configISR_STACK_S
  */
 void vPortSetupTimerInterrupt( void ) __attribute__( ( weak ) );
 
+/*
+ * Call traceISR_ENTER() and traceISR_EXIT() from portASM.S.  xPortISRTraceExit()
+ * returns xSwitchRequired unchanged.
+ */
+void vPortISRTraceEnter( void );
+BaseType_t xPortISRTraceExit( BaseType_t xSwitchRequired );
+
 /*-----------------------------------------------------------*/
 
 /* Used to program the machine timer compare register. */
@@ -93,10 +125,42 @@ const size_t uxTimerIncrementsForOneTick = ( size_t ) ( ( configCPU_CLOCK_HZ ) /
 uint64_t const ullMachineTimerCompareRegisterBase = configMTIMECMP_BASE_ADDRESS;
 volatile uint64_t * pullMachineTimerCompareRegister = NULL;
 
+#if ( configNUMBER_OF_CORES == 1 )
+
 /* Holds the critical nesting value - deliberately non-zero at start up to
  * ensure interrupts are not accidentally enabled before the scheduler starts. */
-size_t xCriticalNesting = ( size_t ) 0xaaaaaaaa;
-size_t * pxCriticalNesting = &xCriticalNesting;
+    size_t xCriticalNesting = ( size_t ) 0xaaaaaaaa;
+    size_t * pxCriticalNesting = &xCriticalNesting;
+
+#else
+
+/* The critical nesting count, interrupt stack, core ID and MSIP register of
+ * each hart.  Indexed by mhartid so portASM.S can find the entry without a
+ * spare register.  Filled in by xPortStartScheduler(). */
+    PortHartData_t xPortHartData[ configFIRST_HART_ID + configNUMBER_OF_CORES ] = { 0 };
+
+/* The spinlocks used to implement portGET_ISR_LOCK() and portGET_TASK_LOCK(),
+ * the core that holds each (plus one, so zero means no owner) and how many
+ * times the owning core has taken it. */
+    static volatile uint32_t ulPortSpinlocks[ portRTOS_SPINLOCK_COUNT ] = { 0 };
+    static volatile uint32_t ulPortSpinlockOwners[ portRTOS_SPINLOCK_COUNT ] = { 0 };
+    static uint32_t ulPortSpinlockRecursionCounts[ portRTOS_SPINLOCK_COUNT ] = { 0 };
+
+/* Set once the scheduler has been started, to release the harts waiting in
+ * vPortStartSecondaryCore(). */
+    static volatile BaseType_t xPortSchedulerStarted = pdFALSE;
+
+/* Called by portASM.S in place of xTaskIncrementTick(). */
+    BaseType_t xPortIncrementTick( void );
+
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
+
+#if ( configCLIC_BASE_ADDRESS != 0 )
+
+/* The interrupt threshold portASM.S uses for critical sections and while the
+ * kernel's handlers run. */
+    const size_t uxPortMaxSyscallInterruptLevel = ( size_t ) configMAX_SYSCALL_INTERRUPT_PRIORITY;
+#endif
 
 /* Used to catch tasks that attempt to return from their implementing function. */
 size_t xTaskReturnAddress = ( size_t ) portTASK_RETURN_ADDRESS;
@@ -117,7 +181,11 @@ size_t xTaskReturnAddress = ( size_t ) portTASK_RETURN_ADDRESS;
         portISR_STACK_FILL_BYTE, portISR_STACK_FILL_BYTE, portISR_STACK_FILL_BYTE, portISR_STACK_FILL_BYTE
     }; \
 
-    #define portCHECK_ISR_STACK()    configASSERT( ( memcmp( ( void * ) xISRStack, ( void * ) ucExpectedStackBytes, sizeof( ucExpectedStackBytes ) ) == 0 ) )
+    #if ( configNUMBER_OF_CORES > 1 )
+        #define portCHECK_ISR_STACK()    configASSERT( ( memcmp( ( void * ) xISRStacks[ portGET_CORE_ID() ], ( void * ) ucExpectedStackBytes, sizeof( ucExpectedStackBytes ) ) == 0 ) )
+    #else
+        #define portCHECK_ISR_STACK()    configASSERT( ( memcmp( ( void * ) xISRStack, ( void * ) ucExpectedStackBytes, sizeof( ucExpectedStackBytes ) ) == 0 ) )
+    #endif
 #else /* if defined( configISR_STACK_SIZE_WORDS ) && ( configCHECK_FOR_STACK_OVERFLOW > 2 ) */
     /* Define the function away. */
     #define portCHECK_ISR_STACK()
@@ -161,7 +229,34 @@ BaseType_t xPortStartScheduler( void )
 {
     extern void xPortStartFirstTask( void );
 
-    #if ( configASSERT_DEFINED == 1 )
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        BaseType_t xCoreID;
+        PortHartData_t * pxHartData;
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* portContext.h assumes four word sized members. */
+            configASSERT( sizeof( PortHartData_t ) == ( 4 * sizeof( size_t ) ) );
+            configASSERT( portGET_CORE_ID() == 0 );
+        }
+        #endif /* configASSERT_DEFINED */
+
+        #if ( ( configASSERT_DEFINED == 1 ) || ( INCLUDE_uxTaskGetISRStackHighWaterMark == 1 ) )
+        {
+            memset( ( void * ) xISRStacks, portISR_STACK_FILL_BYTE, sizeof( xISRStacks ) );
+        }
+        #endif
+
+        for( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+        {
+            pxHartData = &( xPortHartData[ xCoreID + configFIRST_HART_ID ] );
+            pxHartData->xCoreID = ( size_t ) xCoreID;
+            pxHartData->xISRStackTop = ( StackType_t ) &( xISRStacks[ xCoreID ][ configISR_STACK_SIZE_WORDS ] ) & ~( StackType_t ) portBYTE_ALIGNMENT_MASK;
+            pxHartData->pulMSIP = ( volatile uint32_t * ) ( ( configMSIP_BASE_ADDRESS ) + ( ( ( size_t ) xCoreID + configFIRST_HART_ID ) * sizeof( uint32_t ) ) );
+        }
+    }
+    #elif ( ( configASSERT_DEFINED == 1 ) || ( INCLUDE_uxTaskGetISRStackHighWaterMark == 1 ) )
     {
         /* Check alignment of the interrupt stack - which is the same as the
          * stack that was being used by main() prior to the scheduler being
@@ -174,14 +269,24 @@ BaseType_t xPortStartScheduler( void )
         }
         #endif /* configISR_STACK_SIZE_WORDS */
     }
-    #endif /* configASSERT_DEFINED */
+    #endif /* configNUMBER_OF_CORES */
 
     /* If there is a CLINT then it is ok to use the default implementation
      * in this file, otherwise vPortSetupTimerInterrupt() must be implemented to
      * configure whichever clock is to be used to generate the tick interrupt. */
     vPortSetupTimerInterrupt();
 
-    #if ( ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) )
+    #if ( ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) && ( configCLIC_BASE_ADDRESS != 0 ) )
+    {
+        /* mie is not used in CLIC mode.  Give the timer interrupt the kernel's
+         * level and enable it in the CLIC instead.  The application sets the
+         * levels of, and enables, its own interrupts. */
+        volatile uint8_t * const pucMTimerInterrupt = ( volatile uint8_t * ) ( ( configCLIC_BASE_ADDRESS ) + portCLIC_INTERRUPT_OFFSET + ( portCLIC_MTIMER_ID * sizeof( uint32_t ) ) );
+
+        pucMTimerInterrupt[ portCLIC_INTCTL ] = ( uint8_t ) configKERNEL_INTERRUPT_PRIORITY;
+        pucMTimerInterrupt[ portCLIC_INTIE ] = 1U;
+    }
+    #elif ( ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) )
     {
         /* Enable mtime and external interrupts.  1<<7 for timer interrupt,
          * 1<<11 for external interrupt.  _RB_ What happens here when mtime is
@@ -190,6 +295,16 @@ BaseType_t xPortStartScheduler( void )
     }
     #endif /* ( configMTIME_BASE_ADDRESS != 0 ) && ( configMTIMECMP_BASE_ADDRESS != 0 ) */
 
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        /* Enable the machine software interrupt used by portYIELD_CORE(),
+         * then release the other harts. */
+        __asm volatile ( "csrs mie, %0" ::"r" ( 0x8 ) );
+        xPortSchedulerStarted = pdTRUE;
+        __asm volatile ( "fence rw, rw" ::: "memory" );
+    }
+    #endif /* configNUMBER_OF_CORES */
+
     xPortStartFirstTask();
 
     /* Should not get here as after calling xPortStartFirstTask() only tasks
@@ -198,6 +313,29 @@ BaseType_t xPortStartScheduler( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( INCLUDE_uxTaskGetISRStackHighWaterMark == 1 )
+
+    void vPortGetISRStack( BaseType_t xCoreID,
+                           StackType_t ** ppxStackBuffer,
+                           configSTACK_DEPTH_TYPE * puxStackDepth )
+    {
+        #if ( configNUMBER_OF_CORES > 1 )
+        {
+            *ppxStackBuffer = &( xISRStacks[ xCoreID ][ 0 ] );
+        }
+        #else
+        {
+            ( void ) xCoreID;
+            *ppxStackBuffer = &( xISRStack[ 0 ] );
+        }
+        #endif
+
+        *puxStackDepth = ( configSTACK_DEPTH_TYPE ) configISR_STACK_SIZE_WORDS;
+    }
+
+#endif /* INCLUDE_uxTaskGetISRStackHighWaterMark */
+/*-----------------------------------------------------------*/
+
 void vPortEndScheduler( void )
 {
     /* Not implemented. */
@@ -206,3 +344,134 @@ void vPortEndScheduler( void )
     }
 }
 /*-----------------------------------------------------------*/
+
+void vPortISRTraceEnter( void )
+{
+    traceISR_ENTER();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortISRTraceExit( BaseType_t xSwitchRequired )
+{
+    if( xSwitchRequired != pdFALSE )
+    {
+        traceISR_EXIT_TO_SCHEDULER();
+    }
+    else
+    {
+        traceISR_EXIT();
+    }
+
+    return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    BaseType_t xPortIncrementTick( void )
+    {
+        BaseType_t xSwitchRequired;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* The other harts can access the scheduler's data structures at the
+         * same time, so the ISR lock must be held. */
+        uxSavedInterruptStatus = portENTER_CRITICAL_FROM_ISR();
+        {
+            xSwitchRequired = xTaskIncrementTick();
+        }
+        portEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortYieldCore( BaseType_t xCoreID )
+    {
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configNUMBER_OF_CORES ) );
+
+        /* Make sure the target hart sees any scheduler data written before the
+         * yield request, then raise its machine software interrupt. */
+        __asm volatile ( "fence rw, w" ::: "memory" );
+        *( xPortHartData[ xCoreID + configFIRST_HART_ID ].pulMSIP ) = 1UL;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortRecursiveLock( uint32_t ulLockNum,
+                             BaseType_t xAcquire )
+    {
+        const uint32_t ulOwner = ( uint32_t ) portGET_CORE_ID() + 1UL;
+        volatile uint32_t * const pulLock = &( ulPortSpinlocks[ ulLockNum ] );
+        uint32_t ulPrevious;
+
+        configASSERT( ulLockNum < portRTOS_SPINLOCK_COUNT );
+
+        if( xAcquire != pdFALSE )
+        {
+            if( ulPortSpinlockOwners[ ulLockNum ] == ulOwner )
+            {
+                /* This core already holds the lock. */
+                configASSERT( ulPortSpinlockRecursionCounts[ ulLockNum ] != UINT32_MAX );
+                ulPortSpinlockRecursionCounts[ ulLockNum ]++;
+            }
+            else
+            {
+                /* Spin on a plain load until the lock looks free, so waiting
+                 * harts do not keep taking the cache line from each other, then
+                 * try to claim it.  The acquire orders the critical section
+                 * after the lock is taken. */
+                do
+                {
+                    while( *pulLock != 0UL )
+                    {
+                    }
+
+                    __asm volatile ( "amoswap.w.aq %0, %2, %1" : "=r" ( ulPrevious ), "+A" ( *pulLock ) : "r" ( 1UL ) : "memory" );
+                } while( ulPrevious != 0UL );
+
+                ulPortSpinlockOwners[ ulLockNum ] = ulOwner;
+                ulPortSpinlockRecursionCounts[ ulLockNum ] = 1UL;
+            }
+        }
+        else
+        {
+            configASSERT( ulPortSpinlockOwners[ ulLockNum ] == ulOwner );
+            configASSERT( ulPortSpinlockRecursionCounts[ ulLockNum ] != 0UL );
+
+            ulPortSpinlockRecursionCounts[ ulLockNum ]--;
+
+            if( ulPortSpinlockRecursionCounts[ ulLockNum ] == 0UL )
+            {
+                ulPortSpinlockOwners[ ulLockNum ] = 0UL;
+
+                /* The release orders the critical section before the lock is
+                 * freed. */
+                __asm volatile ( "amoswap.w.rl zero, zero, %0" : "+A" ( *pulLock ) :: "memory" );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortStartSecondaryCore( void )
+    {
+        extern void xPortStartFirstTask( void );
+
+        /* Interrupts are enabled when the first task starts executing on this
+         * hart. */
+        portDISABLE_INTERRUPTS();
+
+        while( xPortSchedulerStarted == pdFALSE )
+        {
+        }
+
+        __asm volatile ( "fence rw, rw" ::: "memory" );
+
+        /* Enable the machine software interrupt used by portYIELD_CORE() and
+         * external interrupts.  Only the hart that started the scheduler takes
+         * the tick interrupt. */
+        __asm volatile ( "csrs mie, %0" ::"r" ( 0x808 ) );
+
+        xPortStartFirstTask();
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
@@ -31,12 +31,14 @@
 
 #if __riscv_xlen == 64
     #define portWORD_SIZE    8
+    #define portWORD_SHIFT   3
     #define store_x          sd
     #define load_x           ld
 #elif __riscv_xlen == 32
     #define store_x          sw
     #define load_x           lw
     #define portWORD_SIZE    4
+    #define portWORD_SHIFT   2
 #else
     #error Assembler did not define __riscv_xlen
 #endif
@@ -58,15 +60,342 @@
     #define portMSTATUS_OFFSET             30
 #endif
 
+/* Set portasmLAZY_FPU_CONTEXT to 1 to save the F/D floating point registers,
+ * and portasmLAZY_VECTOR_CONTEXT to 1 to save the V extension vector state, as
+ * part of the task context.  Either can be defined in
+ * freertos_risc_v_chip_specific_extensions.h or on the assembler's command
+ * line.  The state is only saved for tasks that have used the unit, as shown by
+ * the mstatus FS or VS field being Clean or Dirty - tasks start with the field
+ * set to Initial, so tasks that never use the unit pay nothing.  The saved state
+ * is placed above the standard stack frame so the layout seen by
+ * portasmSAVE_ADDITIONAL_REGISTERS is unchanged.  mscratch is used as a scratch
+ * register while the context is saved and restored. */
+#ifndef portasmLAZY_FPU_CONTEXT
+    #define portasmLAZY_FPU_CONTEXT    0
+#endif
+
+#ifndef portasmLAZY_VECTOR_CONTEXT
+    #define portasmLAZY_VECTOR_CONTEXT    0
+#endif
+
+/* mstatus FS (bits 14:13) and VS (bits 10:9) fields.  The top bit of each
+ * field is set when the state is Clean or Dirty. */
+#define portMSTATUS_FS_MASK            0x6000
+#define portMSTATUS_FS_INITIAL         0x2000
+#define portMSTATUS_FS_USED_BIT        14
+#define portMSTATUS_VS_MASK            0x600
+#define portMSTATUS_VS_INITIAL         0x200
+#define portMSTATUS_VS_USED_BIT        10
+
+#if ( portasmLAZY_FPU_CONTEXT == 1 )
+    #ifndef __riscv_flen
+        #error portasmLAZY_FPU_CONTEXT is 1 but the target does not have the F extension.
+    #endif
+
+    #if __riscv_flen == 64
+        #define store_f    fsd
+        #define load_f     fld
+    #else
+        #define store_f    fsw
+        #define load_f     flw
+    #endif
+
+/* 32 floating point registers followed by fcsr, padded to keep the stack 16
+ * byte aligned. */
+    #define portFPU_REG_SIZE        ( __riscv_flen / 8 )
+    #define portFPU_FCSR_OFFSET     ( 32 * portFPU_REG_SIZE )
+    #define portFPU_CONTEXT_SIZE    ( portFPU_FCSR_OFFSET + 16 )
+#endif
+
+#if ( portasmLAZY_VECTOR_CONTEXT == 1 )
+    #ifndef __riscv_vector
+        #error portasmLAZY_VECTOR_CONTEXT is 1 but the target does not have the V extension.
+    #endif
+
+/* v0-v31 (32 * vlenb bytes) followed by vl, vtype, vstart and vcsr. */
+    #define portVPU_CSR_SIZE    ( 4 * portWORD_SIZE )
+#endif
+
+/* Set portasmNUMBER_OF_CORES to the same value as configNUMBER_OF_CORES, in
+ * freertos_risc_v_chip_specific_extensions.h or on the assembler's command
+ * line, when building for more than one hart.  The assembler files do not
+ * include FreeRTOSConfig.h.  A mismatch fails to link as the single and multi
+ * core builds reference different variables. */
+#ifndef portasmNUMBER_OF_CORES
+    #define portasmNUMBER_OF_CORES    1
+#endif
+
+#if ( portasmNUMBER_OF_CORES > 1 )
+
+/* Offsets, in words, of the members of the PortHartData_t structure declared
+ * in portmacro.h, and log2 of the structure's size. */
+    #define portHART_CRITICAL_NESTING_OFFSET    0
+    #define portHART_ISR_STACK_TOP_OFFSET       1
+    #define portHART_CORE_ID_OFFSET             2
+    #define portHART_MSIP_OFFSET                3
+    #define portHART_DATA_SHIFT                 ( portWORD_SHIFT + 2 )
+#endif
+
+/* Set portasmHAS_CLIC to 1, in freertos_risc_v_chip_specific_extensions.h or
+ * on the assembler's command line, when configCLIC_BASE_ADDRESS is set so the
+ * hart runs its core local interrupt controller (CLIC) in CLIC mode.  Critical
+ * sections then raise the mintthresh CSR to configMAX_SYSCALL_INTERRUPT_PRIORITY
+ * instead of clearing mstatus.MIE, and the kernel's handlers run with mstatus.MIE
+ * set once they are on the interrupt stack, so interrupts above that level
+ * preempt the kernel in hardware.  The level is read from
+ * uxPortMaxSyscallInterruptLevel, which is only defined when
+ * configCLIC_BASE_ADDRESS is set. */
+#ifndef portasmHAS_CLIC
+    #define portasmHAS_CLIC    0
+#endif
+
+#if ( portasmHAS_CLIC == 1 )
+    #if ( portasmNUMBER_OF_CORES > 1 )
+        #error portasmHAS_CLIC cannot be set to 1 when portasmNUMBER_OF_CORES is greater than 1.
+    #endif
+
+/* CSR numbers, as not all assemblers know the CLIC CSR names. */
+    #define portCSR_MINTTHRESH    0x347
+#endif
+
 /*-----------------------------------------------------------*/
 
-.extern pxCurrentTCB
+#if ( portasmNUMBER_OF_CORES > 1 )
+   .extern pxCurrentTCBs
+   .extern xPortHartData
+#else
+   .extern pxCurrentTCB
    .extern xISRStackTop
    .extern xCriticalNesting
    .extern pxCriticalNesting
+#endif
+
+#if ( portasmHAS_CLIC == 1 )
+   .extern uxPortMaxSyscallInterruptLevel
+#endif
 /*-----------------------------------------------------------*/
 
+#if ( portasmNUMBER_OF_CORES > 1 )
+
+/* Set reg to the address of the xPortHartData[] entry of the hart executing
+ * the macro.  The entry is indexed by mhartid so no other register or CSR is
+ * needed to find it.  scratch is also used. */
+   .macro portcontextGET_HART_DATA reg, scratch
+csrr \reg, mhartid
+slli \reg, \reg, portHART_DATA_SHIFT
+la \scratch, xPortHartData
+add \reg, \reg, \scratch
+   .endm
+/*-----------------------------------------------------------*/
+
+/* Set reg to the address of this hart's entry in pxCurrentTCBs[].  scratch is
+ * also used. */
+   .macro portcontextGET_CURRENT_TCB_ADDRESS reg, scratch
+portcontextGET_HART_DATA \reg, \scratch
+load_x \reg, portHART_CORE_ID_OFFSET * portWORD_SIZE( \reg )
+slli \reg, \reg, portWORD_SHIFT
+la \scratch, pxCurrentTCBs
+add \reg, \reg, \scratch
+   .endm
+/*-----------------------------------------------------------*/
+
+#endif /* portasmNUMBER_OF_CORES */
+
+/* Switch to this hart's interrupt stack.  With a CLIC, also mask the interrupts
+ * that use the kernel and set mstatus.MIE so higher level interrupts can nest.
+ * t0 and t1 are used. */
+   .macro portcontextSWITCH_TO_ISR_STACK
+#if ( portasmNUMBER_OF_CORES > 1 )
+portcontextGET_HART_DATA t0, t1
+load_x sp, portHART_ISR_STACK_TOP_OFFSET * portWORD_SIZE( t0 )
+#else
+load_x sp, xISRStackTop
+#endif
+#if ( portasmHAS_CLIC == 1 )
+load_x t0, uxPortMaxSyscallInterruptLevel
+csrw portCSR_MINTTHRESH, t0
+csrsi mstatus, 8
+#endif
+   .endm
+/*-----------------------------------------------------------*/
+
+/* Read mcause into reg.  In CLIC mode mcause also holds the previous interrupt
+ * level and privilege, so only the interrupt bit and the exception code are
+ * kept.  scratch is also used. */
+   .macro portcontextREAD_MCAUSE reg, scratch
+csrr \reg, mcause
+#if ( portasmHAS_CLIC == 1 )
+srli \scratch, \reg, __riscv_xlen - 1
+slli \scratch, \scratch, __riscv_xlen - 1 /* The interrupt bit. */
+slli \reg, \reg, __riscv_xlen - 12
+srli \reg, \reg, __riscv_xlen - 12        /* The 12-bit exception code. */
+or \reg, \reg, \scratch
+#endif
+   .endm
+/*-----------------------------------------------------------*/
+
+#if ( portasmLAZY_FPU_CONTEXT == 1 )
+
+/* Push f0-f31 and fcsr.  Only sp and t0 are used. */
+   .macro portcontextSAVE_FPU_CONTEXT
+addi sp, sp, -portFPU_CONTEXT_SIZE
+store_f f0, 0 * portFPU_REG_SIZE( sp )
+store_f f1, 1 * portFPU_REG_SIZE( sp )
+store_f f2, 2 * portFPU_REG_SIZE( sp )
+store_f f3, 3 * portFPU_REG_SIZE( sp )
+store_f f4, 4 * portFPU_REG_SIZE( sp )
+store_f f5, 5 * portFPU_REG_SIZE( sp )
+store_f f6, 6 * portFPU_REG_SIZE( sp )
+store_f f7, 7 * portFPU_REG_SIZE( sp )
+store_f f8, 8 * portFPU_REG_SIZE( sp )
+store_f f9, 9 * portFPU_REG_SIZE( sp )
+store_f f10, 10 * portFPU_REG_SIZE( sp )
+store_f f11, 11 * portFPU_REG_SIZE( sp )
+store_f f12, 12 * portFPU_REG_SIZE( sp )
+store_f f13, 13 * portFPU_REG_SIZE( sp )
+store_f f14, 14 * portFPU_REG_SIZE( sp )
+store_f f15, 15 * portFPU_REG_SIZE( sp )
+store_f f16, 16 * portFPU_REG_SIZE( sp )
+store_f f17, 17 * portFPU_REG_SIZE( sp )
+store_f f18, 18 * portFPU_REG_SIZE( sp )
+store_f f19, 19 * portFPU_REG_SIZE( sp )
+store_f f20, 20 * portFPU_REG_SIZE( sp )
+store_f f21, 21 * portFPU_REG_SIZE( sp )
+store_f f22, 22 * portFPU_REG_SIZE( sp )
+store_f f23, 23 * portFPU_REG_SIZE( sp )
+store_f f24, 24 * portFPU_REG_SIZE( sp )
+store_f f25, 25 * portFPU_REG_SIZE( sp )
+store_f f26, 26 * portFPU_REG_SIZE( sp )
+store_f f27, 27 * portFPU_REG_SIZE( sp )
+store_f f28, 28 * portFPU_REG_SIZE( sp )
+store_f f29, 29 * portFPU_REG_SIZE( sp )
+store_f f30, 30 * portFPU_REG_SIZE( sp )
+store_f f31, 31 * portFPU_REG_SIZE( sp )
+frcsr t0
+sw t0, portFPU_FCSR_OFFSET( sp )
+   .endm
+/*-----------------------------------------------------------*/
+
+/* Load f0-f31 and fcsr from the frame at t1, then step t1 over it. */
+   .macro portcontextRESTORE_FPU_CONTEXT
+load_f f0, 0 * portFPU_REG_SIZE( t1 )
+load_f f1, 1 * portFPU_REG_SIZE( t1 )
+load_f f2, 2 * portFPU_REG_SIZE( t1 )
+load_f f3, 3 * portFPU_REG_SIZE( t1 )
+load_f f4, 4 * portFPU_REG_SIZE( t1 )
+load_f f5, 5 * portFPU_REG_SIZE( t1 )
+load_f f6, 6 * portFPU_REG_SIZE( t1 )
+load_f f7, 7 * portFPU_REG_SIZE( t1 )
+load_f f8, 8 * portFPU_REG_SIZE( t1 )
+load_f f9, 9 * portFPU_REG_SIZE( t1 )
+load_f f10, 10 * portFPU_REG_SIZE( t1 )
+load_f f11, 11 * portFPU_REG_SIZE( t1 )
+load_f f12, 12 * portFPU_REG_SIZE( t1 )
+load_f f13, 13 * portFPU_REG_SIZE( t1 )
+load_f f14, 14 * portFPU_REG_SIZE( t1 )
+load_f f15, 15 * portFPU_REG_SIZE( t1 )
+load_f f16, 16 * portFPU_REG_SIZE( t1 )
+load_f f17, 17 * portFPU_REG_SIZE( t1 )
+load_f f18, 18 * portFPU_REG_SIZE( t1 )
+load_f f19, 19 * portFPU_REG_SIZE( t1 )
+load_f f20, 20 * portFPU_REG_SIZE( t1 )
+load_f f21, 21 * portFPU_REG_SIZE( t1 )
+load_f f22, 22 * portFPU_REG_SIZE( t1 )
+load_f f23, 23 * portFPU_REG_SIZE( t1 )
+load_f f24, 24 * portFPU_REG_SIZE( t1 )
+load_f f25, 25 * portFPU_REG_SIZE( t1 )
+load_f f26, 26 * portFPU_REG_SIZE( t1 )
+load_f f27, 27 * portFPU_REG_SIZE( t1 )
+load_f f28, 28 * portFPU_REG_SIZE( t1 )
+load_f f29, 29 * portFPU_REG_SIZE( t1 )
+load_f f30, 30 * portFPU_REG_SIZE( t1 )
+load_f f31, 31 * portFPU_REG_SIZE( t1 )
+lw t2, portFPU_FCSR_OFFSET( t1 )
+fscsr t2
+addi t1, t1, portFPU_CONTEXT_SIZE
+   .endm
+/*-----------------------------------------------------------*/
+
+#endif /* portasmLAZY_FPU_CONTEXT */
+
+#if ( portasmLAZY_VECTOR_CONTEXT == 1 )
+
+/* Push vl, vtype, vstart and vcsr, then v0-v31 as four groups of eight
+ * registers.  Only sp and t0 are used. */
+   .macro portcontextSAVE_VPU_CONTEXT
+addi sp, sp, -portVPU_CSR_SIZE
+csrr t0, vl
+store_x t0, 0 * portWORD_SIZE( sp )
+csrr t0, vtype
+store_x t0, 1 * portWORD_SIZE( sp )
+csrr t0, vstart
+store_x t0, 2 * portWORD_SIZE( sp )
+csrr t0, vcsr
+store_x t0, 3 * portWORD_SIZE( sp )
+csrw vstart, x0    /* Whole register stores start from element vstart. */
+csrr t0, vlenb
+slli t0, t0, 3     /* t0 = the size of eight vector registers. */
+sub sp, sp, t0
+vs8r.v v24, ( sp )
+sub sp, sp, t0
+vs8r.v v16, ( sp )
+sub sp, sp, t0
+vs8r.v v8, ( sp )
+sub sp, sp, t0
+vs8r.v v0, ( sp )
+   .endm
+/*-----------------------------------------------------------*/
+
+/* Load v0-v31, vl, vtype, vstart and vcsr from the frame at t1, then step t1
+ * over it.  t0 and t2 are also used. */
+   .macro portcontextRESTORE_VPU_CONTEXT
+csrw vstart, x0
+csrr t2, vlenb
+slli t2, t2, 3
+vl8r.v v0, ( t1 )
+add t1, t1, t2
+vl8r.v v8, ( t1 )
+add t1, t1, t2
+vl8r.v v16, ( t1 )
+add t1, t1, t2
+vl8r.v v24, ( t1 )
+add t1, t1, t2
+load_x t0, 0 * portWORD_SIZE( t1 )
+load_x t2, 1 * portWORD_SIZE( t1 )
+vsetvl x0, t0, t2
+load_x t0, 2 * portWORD_SIZE( t1 )
+csrw vstart, t0
+load_x t0, 3 * portWORD_SIZE( t1 )
+csrw vcsr, t0
+addi t1, t1, portVPU_CSR_SIZE
+   .endm
+/*-----------------------------------------------------------*/
+
+#endif /* portasmLAZY_VECTOR_CONTEXT */
+
    .macro portcontextSAVE_CONTEXT_INTERNAL
+#if ( portasmLAZY_FPU_CONTEXT == 1 ) || ( portasmLAZY_VECTOR_CONTEXT == 1 )
+csrw mscratch, t0 /* Free t0 to save the FPU and vector state above the standard frame. */
+#endif
+#if ( portasmLAZY_VECTOR_CONTEXT == 1 )
+csrr t0, mstatus
+srli t0, t0, portMSTATUS_VS_USED_BIT
+andi t0, t0, 1
+beqz t0, 1f       /* The task has not used the vector unit. */
+portcontextSAVE_VPU_CONTEXT
+1:
+#endif
+#if ( portasmLAZY_FPU_CONTEXT == 1 )
+csrr t0, mstatus
+srli t0, t0, portMSTATUS_FS_USED_BIT
+andi t0, t0, 1
+beqz t0, 2f       /* The task has not used the FPU. */
+portcontextSAVE_FPU_CONTEXT
+2:
+#endif
+#if ( portasmLAZY_FPU_CONTEXT == 1 ) || ( portasmLAZY_VECTOR_CONTEXT == 1 )
+csrr t0, mscratch
+#endif
 addi sp, sp, -portCONTEXT_SIZE
 store_x x1, 1 * portWORD_SIZE( sp )
 store_x x5, 2 * portWORD_SIZE( sp )
@@ -99,7 +428,12 @@ store_x x15, 12 * portWORD_SIZE( sp )
     store_x x31, 28 * portWORD_SIZE( sp )
 #endif /* ifndef __riscv_32e */
 
+#if ( portasmNUMBER_OF_CORES > 1 )
+portcontextGET_HART_DATA t0, t1
+load_x t0, portHART_CRITICAL_NESTING_OFFSET * portWORD_SIZE( t0 ) /* Load this hart's critical nesting count into t0. */
+#else
 load_x t0, xCriticalNesting                                   /* Load the value of xCriticalNesting into t0. */
+#endif
 store_x t0, portCRITICAL_NESTING_OFFSET * portWORD_SIZE( sp ) /* Store the critical nesting value to the stack. */
 
 
@@ -109,7 +443,12 @@ store_x t0, portMSTATUS_OFFSET * portWORD_SIZE( sp )
 
 portasmSAVE_ADDITIONAL_REGISTERS /* Defined in freertos_risc_v_chip_specific_extensions.h to save any registers unique to the RISC-V implementation. */
 
+#if ( portasmNUMBER_OF_CORES > 1 )
+portcontextGET_CURRENT_TCB_ADDRESS t0, t1
+load_x t0, 0 ( t0 )              /* Load this hart's pxCurrentTCBs[] entry. */
+#else
 load_x t0, pxCurrentTCB          /* Load pxCurrentTCB. */
+#endif
 store_x sp, 0 ( t0 )             /* Write sp to first TCB member. */
 
    .endm
@@ -117,25 +456,33 @@ store_x sp, 0 ( t0 )             /* Write sp to first TCB member. */
 
    .macro portcontextSAVE_EXCEPTION_CONTEXT
 portcontextSAVE_CONTEXT_INTERNAL
-csrr a0, mcause
+portcontextREAD_MCAUSE a0, t0
 csrr a1, mepc
 addi a1, a1, 4          /* Synchronous so update exception return address to the instruction after the instruction that generated the exception. */
 store_x a1, 0 ( sp )    /* Save updated exception return address. */
-load_x sp, xISRStackTop /* Switch to ISR stack. */
+portcontextSWITCH_TO_ISR_STACK
    .endm
 /*-----------------------------------------------------------*/
 
    .macro portcontextSAVE_INTERRUPT_CONTEXT
 portcontextSAVE_CONTEXT_INTERNAL
-csrr a0, mcause
+portcontextREAD_MCAUSE a0, t0
 csrr a1, mepc
 store_x a1, 0 ( sp )    /* Asynchronous interrupt so save unmodified exception return address. */
-load_x sp, xISRStackTop /* Switch to ISR stack. */
+portcontextSWITCH_TO_ISR_STACK
    .endm
 /*-----------------------------------------------------------*/
 
    .macro portcontextRESTORE_CONTEXT
+#if ( portasmHAS_CLIC == 1 )
+csrci mstatus, 8        /* Stop interrupts nesting before leaving the interrupt stack. */
+#endif
+#if ( portasmNUMBER_OF_CORES > 1 )
+portcontextGET_CURRENT_TCB_ADDRESS t1, t0
+load_x t1, 0 ( t1 )     /* Load this hart's pxCurrentTCBs[] entry. */
+#else
 load_x t1, pxCurrentTCB /* Load pxCurrentTCB. */
+#endif
 load_x sp, 0 ( t1 )     /* Read sp from first TCB member. */
 
 /* Load mepc with the address of the instruction in the task to run next. */
@@ -146,12 +493,55 @@ csrw mepc, t0
 portasmRESTORE_ADDITIONAL_REGISTERS
 
 /* Load mstatus with the interrupt enable bits used by the task. */
+#if ( portasmHAS_CLIC == 1 )
+csrw mcause, x0         /* Tasks run at interrupt level 0, so mret must not return to the level of a nested interrupt.  Written first as mcause mirrors the mstatus MPIE and MPP bits. */
+#endif
 load_x t0, portMSTATUS_OFFSET * portWORD_SIZE( sp )
 csrw mstatus, t0                                             /* Required for MPIE bit. */
 
 load_x t0, portCRITICAL_NESTING_OFFSET * portWORD_SIZE( sp ) /* Obtain xCriticalNesting value for this task from task's stack. */
+#if ( portasmNUMBER_OF_CORES > 1 )
+portcontextGET_HART_DATA t1, t2
+store_x t0, portHART_CRITICAL_NESTING_OFFSET * portWORD_SIZE( t1 ) /* Restore this hart's critical nesting count for this task. */
+#else
 load_x t1, pxCriticalNesting                                 /* Load the address of xCriticalNesting into t1. */
 store_x t0, 0 ( t1 )                                         /* Restore the critical nesting value for this task. */
+#endif
+
+#if ( portasmHAS_CLIC == 1 )
+beqz t0, 6f
+load_x t0, uxPortMaxSyscallInterruptLevel                    /* The task is in a critical section. */
+6:
+csrw portCSR_MINTTHRESH, t0                                  /* Restore the interrupt threshold for this task. */
+#endif
+
+#if ( portasmLAZY_FPU_CONTEXT == 1 ) || ( portasmLAZY_VECTOR_CONTEXT == 1 )
+load_x t0, portMSTATUS_OFFSET * portWORD_SIZE( sp ) /* The saved FS and VS fields show which state was saved. */
+addi t1, sp, portCONTEXT_SIZE                       /* Any FPU and vector state is above the standard frame. */
+#endif
+#if ( portasmLAZY_FPU_CONTEXT == 1 )
+srli t2, t0, portMSTATUS_FS_USED_BIT
+andi t2, t2, 1
+beqz t2, 3f
+portcontextRESTORE_FPU_CONTEXT
+j 4f
+3:
+srli t2, t0, portMSTATUS_FS_USED_BIT - 1
+andi t2, t2, 1
+beqz t2, 4f       /* FPU off. */
+fscsr x0          /* FPU Initial, so don't inherit the rounding mode of the last task to use it. */
+4:
+#endif
+#if ( portasmLAZY_VECTOR_CONTEXT == 1 )
+srli t2, t0, portMSTATUS_VS_USED_BIT
+andi t2, t2, 1
+beqz t2, 5f
+portcontextRESTORE_VPU_CONTEXT
+5:
+#endif
+#if ( portasmLAZY_FPU_CONTEXT == 1 ) || ( portasmLAZY_VECTOR_CONTEXT == 1 )
+csrw mscratch, t1 /* The task's stack pointer once the frame is removed. */
+#endif
 
 load_x x1, 1 * portWORD_SIZE( sp )
 load_x x5, 2 * portWORD_SIZE( sp )
@@ -183,7 +573,11 @@ load_x x15, 12 * portWORD_SIZE( sp )
     load_x x30, 27 * portWORD_SIZE( sp )
     load_x x31, 28 * portWORD_SIZE( sp )
 #endif /* ifndef __riscv_32e */
+#if ( portasmLAZY_FPU_CONTEXT == 1 ) || ( portasmLAZY_VECTOR_CONTEXT == 1 )
+csrr sp, mscratch
+#else
 addi sp, sp, portCONTEXT_SIZE
+#endif
 
 mret
    .endm
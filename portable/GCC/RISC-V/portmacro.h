@@ -87,10 +87,23 @@ typedef portUBASE_TYPE   TickType_t;
 #else
     #define portBYTE_ALIGNMENT    16
 #endif
+
+/* The byte the statically allocated interrupt stacks are painted with.  Don't
+ * use 0xa5 as that is used by the kernel for the task stacks, and so will
+ * legitimately appear in many positions within the ISR stack. */
+#ifdef configISR_STACK_SIZE_WORDS
+    #define portISR_STACK_FILL_BYTE    0xee
+#endif
 /*-----------------------------------------------------------*/
 
 /* Scheduler utilities. */
-extern void vTaskSwitchContext( void );
+#if ( configNUMBER_OF_CORES == 1 )
+    extern void vTaskSwitchContext( void );
+    #define portTASK_SWITCH_CONTEXT()    vTaskSwitchContext()
+#else
+    extern void vTaskSwitchContext( BaseType_t xCoreID );
+    #define portTASK_SWITCH_CONTEXT()    vTaskSwitchContext( portGET_CORE_ID() )
+#endif
 #define portYIELD()                __asm volatile ( "ecall" );
 #define portEND_SWITCHING_ISR( xSwitchRequired ) \
     do                                           \
@@ -98,7 +111,7 @@ extern void vTaskSwitchContext( void );
         if( xSwitchRequired != pdFALSE )         \
         {                                        \
             traceISR_EXIT_TO_SCHEDULER();        \
-            vTaskSwitchContext();                \
+            portTASK_SWITCH_CONTEXT();           \
         }                                        \
         else                                     \
         {                                        \
@@ -106,30 +119,179 @@ extern void vTaskSwitchContext( void );
         }                                        \
     } while( 0 )
 #define portYIELD_FROM_ISR( x )    portEND_SWITCHING_ISR( x )
+
+/* Set configCLIC_BASE_ADDRESS to the address of the hart's core local interrupt
+ * controller (CLIC), and portasmHAS_CLIC to 1 for the assembler, to run the
+ * CLIC in CLIC mode.  configKERNEL_INTERRUPT_PRIORITY and
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY are then CLIC interrupt levels: the tick
+ * runs at configKERNEL_INTERRUPT_PRIORITY, and interrupts above
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY are never masked by the kernel so must
+ * not call the API.  See readme.txt.  Leave undefined, or set to 0, to use the
+ * CLINT interrupt mode. */
+#ifndef configCLIC_BASE_ADDRESS
+    #define configCLIC_BASE_ADDRESS    0
+#endif
+
+#if ( configCLIC_BASE_ADDRESS != 0 )
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error "configCLIC_BASE_ADDRESS cannot be set when configNUMBER_OF_CORES is greater than 1."
+    #endif
+
+    #if !defined( configKERNEL_INTERRUPT_PRIORITY ) || !defined( configMAX_SYSCALL_INTERRUPT_PRIORITY )
+        #error "configKERNEL_INTERRUPT_PRIORITY and configMAX_SYSCALL_INTERRUPT_PRIORITY must be set to CLIC interrupt levels when configCLIC_BASE_ADDRESS is set."
+    #endif
+
+    #if ( configKERNEL_INTERRUPT_PRIORITY == 0 ) || ( configKERNEL_INTERRUPT_PRIORITY > configMAX_SYSCALL_INTERRUPT_PRIORITY ) || ( configMAX_SYSCALL_INTERRUPT_PRIORITY > 255 )
+        #error "configKERNEL_INTERRUPT_PRIORITY must be a CLIC interrupt level above 0 and no higher than configMAX_SYSCALL_INTERRUPT_PRIORITY, which must be no higher than 255."
+    #endif
+#endif /* configCLIC_BASE_ADDRESS */
+
+/* The interrupt number used by configUSE_ISR_RUN_TIME_STATS is the mcause
+ * exception code.  Build portASM.S with portasmCALL_ISR_TRACE_HOOKS set to 1
+ * to measure the tick and the interrupts it dispatches. */
+#ifndef portGET_INTERRUPT_NUMBER
+    #define portGET_INTERRUPT_NUMBER()    uxPortGetInterruptNumber()
+#endif
+
+static inline UBaseType_t uxPortGetInterruptNumber( void )
+{
+    UBaseType_t uxCause;
+
+    __asm volatile ( "csrr %0, mcause" : "=r" ( uxCause ) );
+
+    #if ( configCLIC_BASE_ADDRESS != 0 )
+    {
+        /* In CLIC mode mcause also holds the previous interrupt level and
+         * privilege above the 12-bit exception code. */
+        return uxCause & 0xfffU;
+    }
+    #else
+    {
+        return uxCause & ~( ( UBaseType_t ) 1 << ( __riscv_xlen - 1 ) );
+    }
+    #endif
+}
 /*-----------------------------------------------------------*/
 
 /* Critical section management. */
 #define portCRITICAL_NESTING_IN_TCB    0
 
-#define portDISABLE_INTERRUPTS()                                   __asm volatile ( "csrc mstatus, 8" )
-#define portENABLE_INTERRUPTS()                                    __asm volatile ( "csrs mstatus, 8" )
+#if ( configCLIC_BASE_ADDRESS != 0 )
 
-extern size_t xCriticalNesting;
-#define portENTER_CRITICAL()      \
-    {                             \
-        portDISABLE_INTERRUPTS(); \
-        xCriticalNesting++;       \
+/* Raise the CLIC interrupt threshold (the mintthresh CSR) rather than clear
+ * mstatus.MIE, so interrupts above configMAX_SYSCALL_INTERRUPT_PRIORITY are not
+ * delayed by critical sections. */
+    #define portDISABLE_INTERRUPTS()    __asm volatile ( "csrw 0x347, %0" ::"r" ( configMAX_SYSCALL_INTERRUPT_PRIORITY ) : "memory" )
+    #define portENABLE_INTERRUPTS()     __asm volatile ( "csrw 0x347, zero" ::: "memory" )
+#else
+    #define portDISABLE_INTERRUPTS()    __asm volatile ( "csrc mstatus, 8" )
+    #define portENABLE_INTERRUPTS()     __asm volatile ( "csrs mstatus, 8" )
+#endif
+
+#if ( configNUMBER_OF_CORES == 1 )
+    extern size_t xCriticalNesting;
+    #define portENTER_CRITICAL()      \
+        {                             \
+            portDISABLE_INTERRUPTS(); \
+            xCriticalNesting++;       \
+        }
+
+    #define portEXIT_CRITICAL()          \
+        {                                \
+            xCriticalNesting--;          \
+            if( xCriticalNesting == 0 )  \
+            {                            \
+                portENABLE_INTERRUPTS(); \
+            }                            \
+        }
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
+    extern void vTaskEnterCritical( void );
+    extern void vTaskExitCritical( void );
+    extern UBaseType_t vTaskEnterCriticalFromISR( void );
+    extern void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus );
+    #define portENTER_CRITICAL()               vTaskEnterCritical()
+    #define portEXIT_CRITICAL()                vTaskExitCritical()
+    #define portENTER_CRITICAL_FROM_ISR()      vTaskEnterCriticalFromISR()
+    #define portEXIT_CRITICAL_FROM_ISR( x )    vTaskExitCriticalFromISR( x )
+
+/* Disable interrupts and return the previous mstatus MIE bit. */
+    static inline UBaseType_t uxPortSetInterruptMask( void )
+    {
+        UBaseType_t uxMStatus;
+
+        __asm volatile ( "csrrc %0, mstatus, 8" : "=r" ( uxMStatus )::"memory" );
+
+        return uxMStatus & 8U;
     }
 
-#define portEXIT_CRITICAL()          \
-    {                                \
-        xCriticalNesting--;          \
-        if( xCriticalNesting == 0 )  \
-        {                            \
-            portENABLE_INTERRUPTS(); \
-        }                            \
+    #define portSET_INTERRUPT_MASK()                     uxPortSetInterruptMask()
+    #define portCLEAR_INTERRUPT_MASK( uxSavedStatus )    __asm volatile ( "csrs mstatus, %0" ::"r" ( ( uxSavedStatus ) & 8U ) : "memory" )
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
+
+/*-----------------------------------------------------------*/
+
+/* Multi-core support. */
+#if ( configNUMBER_OF_CORES > 1 )
+
+    #ifndef __riscv_atomic
+        #error configNUMBER_OF_CORES is greater than 1 but the target does not have the A extension needed for the spinlocks.
+    #endif
+
+/* The harts that run FreeRTOS must have consecutive hart IDs.  Set
+ * configFIRST_HART_ID to the mhartid of the hart that is FreeRTOS core 0. */
+    #ifndef configFIRST_HART_ID
+        #define configFIRST_HART_ID    0
+    #endif
+
+/* Per hart state used by portASM.S, indexed by mhartid.  The layout must
+ * match the portHART_ offsets in portContext.h. */
+    typedef struct xPORT_HART_DATA
+    {
+        size_t xCriticalNesting;       /* The critical nesting count of the task running on the hart. */
+        StackType_t xISRStackTop;      /* The top of the hart's interrupt stack. */
+        size_t xCoreID;                /* The FreeRTOS core ID of the hart. */
+        volatile uint32_t * pulMSIP;   /* The hart's CLINT/ACLINT MSIP register. */
+    } PortHartData_t;
+
+    extern PortHartData_t xPortHartData[ configFIRST_HART_ID + configNUMBER_OF_CORES ];
+
+    static inline BaseType_t xPortGetCoreID( void )
+    {
+        UBaseType_t uxHartID;
+
+        __asm volatile ( "csrr %0, mhartid" : "=r" ( uxHartID ) );
+
+        return ( BaseType_t ) ( uxHartID - configFIRST_HART_ID );
     }
 
+    void vPortYieldCore( BaseType_t xCoreID );
+    void vPortRecursiveLock( uint32_t ulLockNum,
+                             BaseType_t xAcquire );
+
+/* Must be called by each hart other than the one that starts the scheduler,
+ * once it has set mtvec, to start running tasks.  It waits for the scheduler
+ * to be started and does not return. */
+    void vPortStartSecondaryCore( void );
+
+    #define portGET_CORE_ID()                                  xPortGetCoreID()
+    #define portYIELD_CORE( xCoreID )                          vPortYieldCore( xCoreID )
+
+    #define portRTOS_ISR_LOCK                                  ( 0UL )
+    #define portRTOS_TASK_LOCK                                 ( 1UL )
+    #define portRTOS_SPINLOCK_COUNT                            ( 2UL )
+
+    #define portGET_ISR_LOCK()                                 vPortRecursiveLock( portRTOS_ISR_LOCK, pdTRUE )
+    #define portRELEASE_ISR_LOCK()                             vPortRecursiveLock( portRTOS_ISR_LOCK, pdFALSE )
+    #define portGET_TASK_LOCK()                                vPortRecursiveLock( portRTOS_TASK_LOCK, pdTRUE )
+    #define portRELEASE_TASK_LOCK()                            vPortRecursiveLock( portRTOS_TASK_LOCK, pdFALSE )
+
+    #define portGET_CRITICAL_NESTING_COUNT( xCoreID )          ( xPortHartData[ ( xCoreID ) + configFIRST_HART_ID ].xCriticalNesting )
+    #define portSET_CRITICAL_NESTING_COUNT( xCoreID, x )       ( xPortHartData[ ( xCoreID ) + configFIRST_HART_ID ].xCriticalNesting = ( x ) )
+    #define portINCREMENT_CRITICAL_NESTING_COUNT( xCoreID )    ( xPortHartData[ ( xCoreID ) + configFIRST_HART_ID ].xCriticalNesting++ )
+    #define portDECREMENT_CRITICAL_NESTING_COUNT( xCoreID )    ( xPortHartData[ ( xCoreID ) + configFIRST_HART_ID ].xCriticalNesting-- )
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
 /*-----------------------------------------------------------*/
 
 /* Architecture specific optimisations. */
@@ -173,6 +335,8 @@ extern size_t xCriticalNesting;
 #endif
 
 #define portMEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
+
+#define portCACHE_LINE_ALIGNED    __attribute__( ( aligned( configCACHE_LINE_SIZE ) ) )
 /*-----------------------------------------------------------*/
 
 /* configCLINT_BASE_ADDRESS is a legacy definition that was replaced by the
@@ -163,6 +163,61 @@ portFORCE_INLINE static BaseType_t xPortIsInsideInterrupt( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Port-optimised task selection.
+ *
+ * ARMv6-M has no count leading zeros instruction, so the highest ready
+ * priority is found in software: the most significant set bit of the ready
+ * bitmap is smeared into every bit below it, leaving one of only 32 possible
+ * values, which a de Bruijn multiply maps onto a 32-entry table.  Selection is
+ * then constant time rather than a scan of the ready lists.  Defaults to 0.
+ */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#endif
+
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+
+/* Check the configuration. */
+    #if ( configMAX_PRIORITIES > 32 )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.  It is very rare that a system requires more than 10 to 15 different priorities as tasks that share a priority will time slice.
+    #endif
+
+/**
+ * @brief Get the number of the most significant set bit in a non-zero value.
+ */
+    portFORCE_INLINE static uint32_t ulPortGetHighestSetBit( uint32_t ulBitmap )
+    {
+        static const uint8_t ucDeBruijnBitNumber[ 32 ] =
+        {
+            0U,  9U,  1U,  10U, 13U, 21U, 2U,  29U, 11U, 14U, 16U, 18U, 22U, 25U, 3U,  30U,
+            8U,  12U, 20U, 28U, 15U, 17U, 24U, 7U,  19U, 27U, 23U, 6U,  26U, 5U,  4U,  31U
+        };
+
+        ulBitmap |= ulBitmap >> 1U;
+        ulBitmap |= ulBitmap >> 2U;
+        ulBitmap |= ulBitmap >> 4U;
+        ulBitmap |= ulBitmap >> 8U;
+        ulBitmap |= ulBitmap >> 16U;
+        ulBitmap *= 0x07C4ACDDUL;
+
+        return ( uint32_t ) ucDeBruijnBitNumber[ ulBitmap >> 27U ];
+    }
+
+/**
+ * @brief Store/clear the ready priorities in a bit map.
+ */
+    #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )      ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+    #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )       ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+/**
+ * @brief Get the priority of the highest-priority task that is ready to execute.
+ */
+    #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ulPortGetHighestSetBit( ( uxReadyPriorities ) )
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
 /* Suppress warnings that are generated by the IAR tools, but cannot be fixed in
  * the source code because to do so would cause other compilers to generate
  * warnings. */
@@ -67,12 +67,38 @@
 #ifndef secureconfigMAX_SECURE_CONTEXTS
     #define secureconfigMAX_SECURE_CONTEXTS    8UL
 #endif
+
+/**
+ * @brief Size in bytes of each secure context stack when the stacks are
+ * statically allocated.
+ *
+ * When secureconfigSTATIC_SECURE_STACK_SIZE is defined the stack of each
+ * secure context is taken from a pool of secureconfigMAX_SECURE_CONTEXTS
+ * stacks of this size, indexed the same as xSecureContexts, instead of being
+ * allocated from the secure heap.  A task that asks for a larger stack is not
+ * given a secure context.
+ */
+#ifdef secureconfigSTATIC_SECURE_STACK_SIZE
+    #if ( ( secureconfigSTATIC_SECURE_STACK_SIZE % 8 ) != 0 )
+        #error secureconfigSTATIC_SECURE_STACK_SIZE must be a multiple of 8.
+    #endif
+#endif
 /*-----------------------------------------------------------*/
 
 /**
  * @brief Pre-allocated array of secure contexts.
  */
 SecureContext_t xSecureContexts[ secureconfigMAX_SECURE_CONTEXTS ];
+
+#ifdef secureconfigSTATIC_SECURE_STACK_SIZE
+
+/**
+ * @brief Pre-allocated stacks of the secure contexts.
+ *
+ * uint64_t keeps each stack 8 byte aligned as required by the AAPCS.
+ */
+    static uint64_t ullSecureContextStacks[ secureconfigMAX_SECURE_CONTEXTS ][ ( secureconfigSTATIC_SECURE_STACK_SIZE + securecontextSTACK_SEAL_SIZE ) / sizeof( uint64_t ) ];
+#endif /* secureconfigSTATIC_SECURE_STACK_SIZE */
 /*-----------------------------------------------------------*/
 
 /**
@@ -214,7 +240,21 @@ secureportNON_SECURE_CALLABLE void SecureContext_Init( void )
         if( ulSecureContextIndex < secureconfigMAX_SECURE_CONTEXTS )
         {
             /* Allocate the stack space. */
-            pucStackMemory = pvPortMalloc( ulSecureStackSize + securecontextSTACK_SEAL_SIZE );
+            #ifdef secureconfigSTATIC_SECURE_STACK_SIZE
+            {
+                if( ulSecureStackSize <= secureconfigSTATIC_SECURE_STACK_SIZE )
+                {
+                    /* Use the whole of the context's stack so the seal is
+                     * always in the same place. */
+                    pucStackMemory = ( uint8_t * ) &( ullSecureContextStacks[ ulSecureContextIndex ][ 0 ] );
+                    ulSecureStackSize = secureconfigSTATIC_SECURE_STACK_SIZE;
+                }
+            }
+            #else /* secureconfigSTATIC_SECURE_STACK_SIZE */
+            {
+                pucStackMemory = pvPortMalloc( ulSecureStackSize + securecontextSTACK_SEAL_SIZE );
+            }
+            #endif /* secureconfigSTATIC_SECURE_STACK_SIZE */
 
             if( pucStackMemory != NULL )
             {
@@ -297,7 +337,11 @@ secureportNON_SECURE_CALLABLE void SecureContext_FreeContext( SecureContextHandl
             if( xSecureContexts[ ulSecureContextIndex ].pvTaskHandle == pvTaskHandle )
             {
                 /* Free the stack space. */
-                vPortFree( xSecureContexts[ ulSecureContextIndex ].pucStackLimit );
+                #ifndef secureconfigSTATIC_SECURE_STACK_SIZE
+                {
+                    vPortFree( xSecureContexts[ ulSecureContextIndex ].pucStackLimit );
+                }
+                #endif /* secureconfigSTATIC_SECURE_STACK_SIZE */
 
                 /* Return the secure context back to the free secure contexts pool. */
                 vReturnSecureContext( ulSecureContextIndex );
@@ -71,6 +71,10 @@
     #error TrustZone needs to be disabled in order to run FreeRTOS on the Secure Side.
 #endif
 
+#if ( ( configUSE_TASK_VECTOR_UNIT_FLAG == 1 ) && ( configENABLE_FPU == 0 ) )
+    #error configUSE_TASK_VECTOR_UNIT_FLAG needs configENABLE_FPU to be set to 1.
+#endif
+
 /**
  * Cortex-M23 does not have non-secure PSPLIM. We should use PSPLIM on Cortex-M23
  * only when FreeRTOS runs on secure side.
@@ -115,6 +119,18 @@ typedef void ( * portISR_t )( void );
 #define portSCB_USG_FAULT_ENABLE_BIT          ( 1UL << 18UL )
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Constants required to use the DWT cycle counter as the run time
+ * stats clock.
+ */
+#define portDCB_DEMCR_REG                     ( *( ( volatile uint32_t * ) 0xe000edfc ) )
+#define portDWT_CTRL_REG                      ( *( ( volatile uint32_t * ) 0xe0001000 ) )
+#define portDWT_CYCCNT_REG                    ( *( ( volatile uint32_t * ) 0xe0001004 ) )
+#define portDCB_DEMCR_TRCENA_BIT              ( 1UL << 24UL )
+#define portDWT_CTRL_CYCCNTENA_BIT            ( 1UL << 0UL )
+#define portDWT_CTRL_NOCYCCNT_BIT             ( 1UL << 25UL )
+/*-----------------------------------------------------------*/
+
 /**
  * @brief Constants used to check the installation of the FreeRTOS interrupt handlers.
  */
@@ -417,6 +433,16 @@ static void prvTaskExitError( void );
  * @brief Setup the Memory Protection Unit (MPU).
  */
     static void prvSetupMPU( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * @brief Translates a generic memory region definition into ARMv8-M MPU
+ * region settings.
+ *
+ * @param pxRegion The region to translate.
+ * @param pxRegionSettings The RBAR and RLAR values for the region.
+ */
+    static void prvGetMPURegionSettings( const struct xMEMORY_REGION * const pxRegion,
+                                         MPURegionSettings_t * pxRegionSettings ) PRIVILEGED_FUNCTION;
 #endif /* configENABLE_MPU */
 
 #if ( configENABLE_FPU == 1 )
@@ -427,6 +453,15 @@ static void prvTaskExitError( void );
     static void prvSetupFPU( void ) PRIVILEGED_FUNCTION;
 #endif /* configENABLE_FPU */
 
+#if ( ( configENABLE_TRUSTZONE == 1 ) && ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 ) )
+
+/**
+ * @brief Saves the secure context that is still loaded on the secure side, if
+ * any, so the secure stack pointer registers are free for another context.
+ */
+    static void prvUnloadSecureContext( void ) PRIVILEGED_FUNCTION;
+#endif /* configENABLE_TRUSTZONE && configUSE_LAZY_SECURE_CONTEXT_SWITCH */
+
 #if( ( configENABLE_PAC == 1 ) || ( configENABLE_BTI == 1 ) )
 
 /**
@@ -561,8 +596,39 @@ PRIVILEGED_DATA static volatile uint32_t ulCriticalNesting = 0xaaaaaaaaUL;
  * task is using on the secure side.
  */
     PRIVILEGED_DATA portDONT_DISCARD volatile SecureContextHandle_t xSecureContext = portNO_SECURE_CONTEXT;
+
+    #if ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 )
+
+/**
+ * @brief The secure context that is loaded on the secure side, and the task
+ * that owns it.
+ *
+ * A task that is switched out while executing non-secure code leaves its
+ * secure context loaded so it does not have to be saved and loaded again if
+ * no other task uses the secure side before the task runs again.
+ */
+        PRIVILEGED_DATA portDONT_DISCARD volatile SecureContextHandle_t xLoadedSecureContext = portNO_SECURE_CONTEXT;
+        PRIVILEGED_DATA portDONT_DISCARD void * volatile pvLoadedSecureContextTask = NULL;
+    #endif /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
 #endif /* configENABLE_TRUSTZONE */
 
+#if ( ( configENABLE_MPU == 1 ) && ( configUSE_MPU_SETTINGS_CACHE == 1 ) )
+
+/**
+ * @brief The MPU settings of the task whose regions are programmed in the MPU,
+ * or NULL if the MPU must be reprogrammed on the next context switch.
+ */
+    PRIVILEGED_DATA portDONT_DISCARD xMPU_SETTINGS * volatile pxProgrammedMPUSettings = NULL;
+#endif /* configENABLE_MPU && configUSE_MPU_SETTINGS_CACHE */
+
+#if ( ( configENABLE_MPU == 1 ) && ( configUSE_SHARED_MPU_REGIONS == 1 ) )
+
+/**
+ * @brief Settings of the regions shared by all the tasks.
+ */
+    PRIVILEGED_DATA static MPURegionSettings_t xSharedMPURegionsSettings[ portNUM_SHARED_REGIONS ] = { 0 };
+#endif /* configENABLE_MPU && configUSE_SHARED_MPU_REGIONS */
+
 /**
  * @brief Used by the portASSERT_IF_INTERRUPT_PRIORITY_INVALID() macro to ensure
  * FreeRTOS API functions are not called from interrupts that have been assigned
@@ -595,6 +661,16 @@ PRIVILEGED_DATA static volatile uint32_t ulCriticalNesting = 0xaaaaaaaaUL;
  */
     PRIVILEGED_DATA static uint32_t ulStoppedTimerCompensation = 0;
 #endif /* configUSE_TICKLESS_IDLE */
+
+#if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+
+/**
+ * @brief The value of the cycle counter when it was last read, and the number
+ * of times it has wrapped, which together extend it to 64 bits.
+ */
+    PRIVILEGED_DATA static uint32_t ulLastCycleCount = 0;
+    PRIVILEGED_DATA static uint32_t ulCycleCounterWraps = 0;
+#endif /* configUSE_CYCLE_COUNTER_RUN_TIME_STATS */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TICKLESS_IDLE == 1 )
@@ -975,6 +1051,21 @@ static void prvTaskExitError( void )
                                ( portMPU_RLAR_ATTR_INDEX0 ) |
                                ( portMPU_RLAR_REGION_ENABLE );
 
+            #if ( configUSE_SHARED_MPU_REGIONS == 1 )
+            {
+                uint32_t ulSharedRegion;
+
+                /* Setup the regions shared by all the tasks.  These are not
+                 * reprogrammed on context switches. */
+                for( ulSharedRegion = 0; ulSharedRegion < portNUM_SHARED_REGIONS; ulSharedRegion++ )
+                {
+                    portMPU_RNR_REG = portFIRST_SHARED_REGION + ulSharedRegion;
+                    portMPU_RBAR_REG = xSharedMPURegionsSettings[ ulSharedRegion ].ulRBAR;
+                    portMPU_RLAR_REG = xSharedMPURegionsSettings[ ulSharedRegion ].ulRLAR;
+                }
+            }
+            #endif /* configUSE_SHARED_MPU_REGIONS */
+
             /* Enable mem fault. */
             portSCB_SYS_HANDLER_CTRL_STATE_REG |= portSCB_MEM_FAULT_ENABLE_BIT;
 
@@ -1014,6 +1105,43 @@ static void prvTaskExitError( void )
 #endif /* configENABLE_FPU */
 /*-----------------------------------------------------------*/
 
+#if ( ( configENABLE_TRUSTZONE == 1 ) && ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 ) )
+
+    static void prvUnloadSecureContext( void ) /* PRIVILEGED_FUNCTION */
+    {
+        if( xLoadedSecureContext != portNO_SECURE_CONTEXT )
+        {
+            SecureContext_SaveContext( xLoadedSecureContext, pvLoadedSecureContextTask );
+            xLoadedSecureContext = portNO_SECURE_CONTEXT;
+            pvLoadedSecureContextTask = NULL;
+        }
+    }
+
+#endif /* configENABLE_TRUSTZONE && configUSE_LAZY_SECURE_CONTEXT_SWITCH */
+/*-----------------------------------------------------------*/
+
+#if ( ( configENABLE_FPU == 1 ) && ( configUSE_TASK_VECTOR_UNIT_FLAG == 1 ) )
+
+    void vPortSetVectorUnitState( BaseType_t xUsesVectorUnit ) /* PRIVILEGED_FUNCTION */
+    {
+        /* ASPEN = 0 ==> Executing a floating point or MVE instruction does not
+         * set CONTROL.FPCA, so exceptions taken from the task use the standard
+         * stack frame and neither the hardware nor PendSV preserve s0-s31,
+         * FPSCR or VPR for it.  A task that has used the unit keeps the
+         * extended frame, as it is recorded in the task's EXC_RETURN value. */
+        if( xUsesVectorUnit != pdFALSE )
+        {
+            *( portFPCCR ) |= portFPCCR_ASPEN_MASK;
+        }
+        else
+        {
+            *( portFPCCR ) &= ~portFPCCR_ASPEN_MASK;
+        }
+    }
+
+#endif /* ( configENABLE_FPU == 1 ) && ( configUSE_TASK_VECTOR_UNIT_FLAG == 1 ) */
+/*-----------------------------------------------------------*/
+
 void vPortYield( void ) /* PRIVILEGED_FUNCTION */
 {
     /* Set a PendSV to request a context switch. */
@@ -1057,6 +1185,14 @@ void SysTick_Handler( void ) /* PRIVILEGED_FUNCTION */
     ulPreviousMask = portSET_INTERRUPT_MASK_FROM_ISR();
     traceISR_ENTER();
     {
+        #if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+        {
+            /* Read the cycle counter at least once a tick so a wrap is never
+             * missed. */
+            ( void ) ullPortGetCycleCounterValue();
+        }
+        #endif
+
         /* Increment the RTOS tick. */
         if( xTaskIncrementTick() != pdFALSE )
         {
@@ -1073,6 +1209,51 @@ void SysTick_Handler( void ) /* PRIVILEGED_FUNCTION */
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_CYCLE_COUNTER_RUN_TIME_STATS == 1 )
+
+    void vPortConfigureCycleCounter( void ) /* PRIVILEGED_FUNCTION */
+    {
+        /* Enable the DWT, then check this core implements the cycle counter. */
+        portDCB_DEMCR_REG |= portDCB_DEMCR_TRCENA_BIT;
+        configASSERT( ( portDWT_CTRL_REG & portDWT_CTRL_NOCYCCNT_BIT ) == 0UL );
+
+        ulLastCycleCount = 0UL;
+        ulCycleCounterWraps = 0UL;
+        portDWT_CYCCNT_REG = 0UL;
+        portDWT_CTRL_REG |= portDWT_CTRL_CYCCNTENA_BIT;
+    }
+/*-----------------------------------------------------------*/
+
+    uint64_t ullPortGetCycleCounterValue( void ) /* PRIVILEGED_FUNCTION */
+    {
+        uint32_t ulPreviousMask, ulCycleCount;
+        uint64_t ullCycleCount;
+
+        /* Mask interrupts so the wrap count is updated by one caller at a
+         * time.  The SysTick handler reads the counter every tick, and
+         * tickless idle cannot suppress more ticks than the 24-bit SysTick
+         * can count, so the 32-bit counter cannot wrap twice between reads
+         * unless the SysTick runs more than 256 times slower than the core. */
+        ulPreviousMask = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            ulCycleCount = portDWT_CYCCNT_REG;
+
+            if( ulCycleCount < ulLastCycleCount )
+            {
+                ulCycleCounterWraps++;
+            }
+
+            ulLastCycleCount = ulCycleCount;
+            ullCycleCount = ( ( ( uint64_t ) ulCycleCounterWraps ) << 32 ) | ( uint64_t ) ulCycleCount;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( ulPreviousMask );
+
+        return ullCycleCount;
+    }
+
+#endif /* configUSE_CYCLE_COUNTER_RUN_TIME_STATS */
+/*-----------------------------------------------------------*/
+
 void vPortSVCHandler_C( uint32_t * pulCallerStackAddress ) /* PRIVILEGED_FUNCTION portDONT_DISCARD */
 {
     #if ( ( configENABLE_MPU == 1 ) && ( configUSE_MPU_WRAPPERS_V1 == 1 ) )
@@ -1114,6 +1295,14 @@ void vPortSVCHandler_C( uint32_t * pulCallerStackAddress ) /* PRIVILEGED_FUNCTIO
                  * vPortAllocateSecureContext function. */
                 ulR0 = pulCallerStackAddress[ 0 ];
 
+                #if ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 )
+                {
+                    /* A context can only be allocated and loaded when no
+                     * other context is loaded. */
+                    prvUnloadSecureContext();
+                }
+                #endif /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
+
                 #if ( configENABLE_MPU == 1 )
                 {
                     /* Read the CONTROL register value. */
@@ -1135,6 +1324,13 @@ void vPortSVCHandler_C( uint32_t * pulCallerStackAddress ) /* PRIVILEGED_FUNCTIO
 
                 configASSERT( xSecureContext != securecontextINVALID_CONTEXT_ID );
                 SecureContext_LoadContext( xSecureContext, pxCurrentTCB );
+
+                #if ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 )
+                {
+                    xLoadedSecureContext = xSecureContext;
+                    pvLoadedSecureContextTask = pxCurrentTCB;
+                }
+                #endif /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
                 break;
 
             case portSVC_FREE_SECURE_CONTEXT:
@@ -1144,6 +1340,17 @@ void vPortSVCHandler_C( uint32_t * pulCallerStackAddress ) /* PRIVILEGED_FUNCTIO
                 ulR0 = pulCallerStackAddress[ 0 ];
                 ulR1 = pulCallerStackAddress[ 1 ];
 
+                #if ( configUSE_LAZY_SECURE_CONTEXT_SWITCH == 1 )
+                {
+                    /* Do not free the stack the secure side is still
+                     * pointing at. */
+                    if( ( SecureContextHandle_t ) ulR1 == xLoadedSecureContext )
+                    {
+                        prvUnloadSecureContext();
+                    }
+                }
+                #endif /* configUSE_LAZY_SECURE_CONTEXT_SWITCH */
+
                 /* Free the secure context. */
                 SecureContext_FreeContext( ( SecureContextHandle_t ) ulR1, ( void * ) ulR0 );
                 break;
@@ -1165,6 +1372,13 @@ void vPortSVCHandler_C( uint32_t * pulCallerStackAddress ) /* PRIVILEGED_FUNCTIO
             {
                 /* Setup the Floating Point Unit (FPU). */
                 prvSetupFPU();
+
+                #if ( configUSE_TASK_VECTOR_UNIT_FLAG == 1 )
+                {
+                    /* Apply the first task's declared FPU and MVE use. */
+                    vPortSetVectorUnitState( xTaskGetUsesVectorUnit( NULL ) );
+                }
+                #endif
             }
             #endif /* configENABLE_FPU */
 
@@ -1912,55 +2126,7 @@ void vPortEndScheduler( void ) /* PRIVILEGED_FUNCTION */
                 /* Translate the generic region definition contained in xRegions
                  * into the ARMv8 specific MPU settings that are then stored in
                  * xMPUSettings. */
-                ulRegionStartAddress = ( ( uint32_t ) xRegions[ lIndex ].pvBaseAddress ) & portMPU_RBAR_ADDRESS_MASK;
-                ulRegionEndAddress = ( uint32_t ) xRegions[ lIndex ].pvBaseAddress + xRegions[ lIndex ].ulLengthInBytes - 1;
-                ulRegionEndAddress &= portMPU_RLAR_ADDRESS_MASK;
-
-                /* Start address. */
-                xMPUSettings->xRegionsSettings[ ulRegionNumber ].ulRBAR = ( ulRegionStartAddress ) |
-                                                                          ( portMPU_REGION_NON_SHAREABLE );
-
-                /* RO/RW. */
-                if( ( xRegions[ lIndex ].ulParameters & tskMPU_REGION_READ_ONLY ) != 0 )
-                {
-                    xMPUSettings->xRegionsSettings[ ulRegionNumber ].ulRBAR |= ( portMPU_REGION_READ_ONLY );
-                }
-                else
-                {
-                    xMPUSettings->xRegionsSettings[ ulRegionNumber ].ulRBAR |= ( portMPU_REGION_READ_WRITE );
-                }
-
-                /* XN. */
-                if( ( xRegions[ lIndex ].ulParameters & tskMPU_REGION_EXECUTE_NEVER ) != 0 )
-                {
-                    xMPUSettings->xRegionsSettings[ ulRegionNumber ].ulRBAR |= ( portMPU_REGION_EXECUTE_NEVER );
-                }
-
-                /* End Address. */
-                xMPUSettings->xRegionsSettings[ ulRegionNumber ].ulRLAR = ( ulRegionEndAddress ) |
-                                                                          ( portMPU_RLAR_REGION_ENABLE );
-
-                /* PXN. */
-                #if ( portARMV8M_MINOR_VERSION >= 1 )
-                {
-                    if( ( xRegions[ lIndex ].ulParameters & tskMPU_REGION_PRIVILEGED_EXECUTE_NEVER ) != 0 )
-                    {
-                        xMPUSettings->xRegionsSettings[ ulRegionNumber ].ulRLAR |= ( portMPU_RLAR_PRIVILEGED_EXECUTE_NEVER );
-                    }
-                }
-                #endif /* portARMV8M_MINOR_VERSION >= 1 */
-
-                /* Normal memory/ Device memory. */
-                if( ( xRegions[ lIndex ].ulParameters & tskMPU_REGION_DEVICE_MEMORY ) != 0 )
-                {
-                    /* Attr1 in MAIR0 is configured as device memory. */
-                    xMPUSettings->xRegionsSettings[ ulRegionNumber ].ulRLAR |= portMPU_RLAR_ATTR_INDEX1;
-                }
-                else
-                {
-                    /* Attr0 in MAIR0 is configured as normal memory. */
-                    xMPUSettings->xRegionsSettings[ ulRegionNumber ].ulRLAR |= portMPU_RLAR_ATTR_INDEX0;
-                }
+                prvGetMPURegionSettings( &( xRegions[ lIndex ] ), &( xMPUSettings->xRegionsSettings[ ulRegionNumber ] ) );
             }
             else
             {
@@ -1971,11 +2137,108 @@ void vPortEndScheduler( void ) /* PRIVILEGED_FUNCTION */
 
             lIndex++;
         }
+
+        #if ( configUSE_MPU_SETTINGS_CACHE == 1 )
+        {
+            /* The task's regions may have changed, so make the next context
+             * switch reprogram the MPU.  Done last so the MPU cannot be left
+             * holding regions that were only partly updated. */
+            pxProgrammedMPUSettings = NULL;
+        }
+        #endif /* configUSE_MPU_SETTINGS_CACHE */
     }
 
 #endif /* configENABLE_MPU */
 /*-----------------------------------------------------------*/
 
+#if ( configENABLE_MPU == 1 )
+
+    static void prvGetMPURegionSettings( const struct xMEMORY_REGION * const pxRegion,
+                                         MPURegionSettings_t * pxRegionSettings ) /* PRIVILEGED_FUNCTION */
+    {
+        uint32_t ulRegionStartAddress, ulRegionEndAddress;
+
+        ulRegionStartAddress = ( ( uint32_t ) pxRegion->pvBaseAddress ) & portMPU_RBAR_ADDRESS_MASK;
+        ulRegionEndAddress = ( uint32_t ) pxRegion->pvBaseAddress + pxRegion->ulLengthInBytes - 1;
+        ulRegionEndAddress &= portMPU_RLAR_ADDRESS_MASK;
+
+        /* Start address. */
+        pxRegionSettings->ulRBAR = ( ulRegionStartAddress ) |
+                                   ( portMPU_REGION_NON_SHAREABLE );
+
+        /* RO/RW. */
+        if( ( pxRegion->ulParameters & tskMPU_REGION_READ_ONLY ) != 0 )
+        {
+            pxRegionSettings->ulRBAR |= ( portMPU_REGION_READ_ONLY );
+        }
+        else
+        {
+            pxRegionSettings->ulRBAR |= ( portMPU_REGION_READ_WRITE );
+        }
+
+        /* XN. */
+        if( ( pxRegion->ulParameters & tskMPU_REGION_EXECUTE_NEVER ) != 0 )
+        {
+            pxRegionSettings->ulRBAR |= ( portMPU_REGION_EXECUTE_NEVER );
+        }
+
+        /* End Address. */
+        pxRegionSettings->ulRLAR = ( ulRegionEndAddress ) |
+                                   ( portMPU_RLAR_REGION_ENABLE );
+
+        /* PXN. */
+        #if ( portARMV8M_MINOR_VERSION >= 1 )
+        {
+            if( ( pxRegion->ulParameters & tskMPU_REGION_PRIVILEGED_EXECUTE_NEVER ) != 0 )
+            {
+                pxRegionSettings->ulRLAR |= ( portMPU_RLAR_PRIVILEGED_EXECUTE_NEVER );
+            }
+        }
+        #endif /* portARMV8M_MINOR_VERSION >= 1 */
+
+        /* Normal memory/ Device memory. */
+        if( ( pxRegion->ulParameters & tskMPU_REGION_DEVICE_MEMORY ) != 0 )
+        {
+            /* Attr1 in MAIR0 is configured as device memory. */
+            pxRegionSettings->ulRLAR |= portMPU_RLAR_ATTR_INDEX1;
+        }
+        else
+        {
+            /* Attr0 in MAIR0 is configured as normal memory. */
+            pxRegionSettings->ulRLAR |= portMPU_RLAR_ATTR_INDEX0;
+        }
+    }
+
+#endif /* configENABLE_MPU */
+/*-----------------------------------------------------------*/
+
+#if ( ( configENABLE_MPU == 1 ) && ( configUSE_SHARED_MPU_REGIONS == 1 ) )
+
+    void vPortSetSharedMPURegions( const struct xMEMORY_REGION * const xRegions ) /* PRIVILEGED_FUNCTION */
+    {
+        uint32_t ulSharedRegion;
+
+        /* The shared regions are programmed when the scheduler starts, so this
+         * must be called before the scheduler is started. */
+        configASSERT( xRegions != NULL );
+
+        for( ulSharedRegion = 0; ulSharedRegion < portNUM_SHARED_REGIONS; ulSharedRegion++ )
+        {
+            if( xRegions[ ulSharedRegion ].ulLengthInBytes > 0UL )
+            {
+                prvGetMPURegionSettings( &( xRegions[ ulSharedRegion ] ), &( xSharedMPURegionsSettings[ ulSharedRegion ] ) );
+            }
+            else
+            {
+                xSharedMPURegionsSettings[ ulSharedRegion ].ulRBAR = 0UL;
+                xSharedMPURegionsSettings[ ulSharedRegion ].ulRLAR = 0UL;
+            }
+        }
+    }
+
+#endif /* configENABLE_MPU && configUSE_SHARED_MPU_REGIONS */
+/*-----------------------------------------------------------*/
+
 #if ( ( configENABLE_MPU == 1 ) && ( configUSE_MPU_WRAPPERS_V1 == 0 ) )
 
     BaseType_t xPortIsAuthorizedToAccessBuffer( const void * pvBuffer,
@@ -2025,6 +2288,29 @@ void vPortEndScheduler( void ) /* PRIVILEGED_FUNCTION */
                         }
                     }
                 }
+
+                #if ( configUSE_SHARED_MPU_REGIONS == 1 )
+                {
+                    for( i = 0; ( i < portNUM_SHARED_REGIONS ) && ( xAccessGranted == pdFALSE ); i++ )
+                    {
+                        /* Is the shared MPU region enabled? */
+                        if( ( xSharedMPURegionsSettings[ i ].ulRLAR & portMPU_RLAR_REGION_ENABLE ) == portMPU_RLAR_REGION_ENABLE )
+                        {
+                            if( portIS_ADDRESS_WITHIN_RANGE( ulBufferStartAddress,
+                                                             portEXTRACT_FIRST_ADDRESS_FROM_RBAR( xSharedMPURegionsSettings[ i ].ulRBAR ),
+                                                             portEXTRACT_LAST_ADDRESS_FROM_RLAR( xSharedMPURegionsSettings[ i ].ulRLAR ) ) &&
+                                portIS_ADDRESS_WITHIN_RANGE( ulBufferEndAddress,
+                                                             portEXTRACT_FIRST_ADDRESS_FROM_RBAR( xSharedMPURegionsSettings[ i ].ulRBAR ),
+                                                             portEXTRACT_LAST_ADDRESS_FROM_RLAR( xSharedMPURegionsSettings[ i ].ulRLAR ) ) &&
+                                portIS_AUTHORIZED( ulAccessRequested,
+                                                   prvGetRegionAccessPermissions( xSharedMPURegionsSettings[ i ].ulRBAR ) ) )
+                            {
+                                xAccessGranted = pdTRUE;
+                            }
+                        }
+                    }
+                }
+                #endif /* configUSE_SHARED_MPU_REGIONS */
             }
         }
 
@@ -33,8 +33,13 @@
 #define portSTATUS_STACK_LOCATION       156
 #define portFPCSR_STACK_LOCATION        0
 #define portTASK_HAS_FPU_STACK_LOCATION     0
+#define portTASK_HAS_DSP_STACK_LOCATION     4
 #define portFPU_CONTEXT_SIZE            264
 
+/* Stack frame used by the tick interrupt when it runs on a shadow register
+set: the argument slots, AC0 - AC3 and DSPControl, padded to 8 bytes. */
+#define portTICK_SRS_CONTEXT_SIZE       56
+
 /******************************************************************/
 .macro  portSAVE_FPU_REGS    offset, base
     /* Macro to assist with saving just the FPU registers to the
@@ -217,6 +222,25 @@
     sw          s6, portEPC_STACK_LOCATION(s5)
     sw          $1, 16(s5)
 
+    #if ( configUSE_TASK_DSP_SUPPORT == 1 )
+        /* AC1, AC2, AC3 and DSPControl only need saving if a nested interrupt
+        was interrupted, or if the interrupted task uses the DSP ASE.  The
+        ulTaskHasDSPContext flag is saved as part of the task context. */
+        la          s6, uxInterruptNesting
+        lw          s6, 0(s6)
+        addiu       s6, s6, -1
+        bne         s6, zero, 3f
+        nop
+
+        la          s6, ulTaskHasDSPContext
+        lw          s6, 0(s6)
+        sw          s6, portTASK_HAS_DSP_STACK_LOCATION(s5)
+        beq         s6, zero, 4f
+        nop
+
+    3:
+    #endif
+
     /* Save the AC0, AC1, AC2, AC3 registers from the DSP.  s6 is used as a
     scratch register. */
     mfhi        s6, $ac1
@@ -238,6 +262,10 @@
     rddsp       s6
     sw          s6, 148(s5)
 
+    #if ( configUSE_TASK_DSP_SUPPORT == 1 )
+    4:
+    #endif
+
     /* ac0 is done separately to match the MX port. */
     mfhi        s6, $ac0
     sw          s6, 12(s5)
@@ -309,6 +337,25 @@
 
 1:
 
+    #if ( configUSE_TASK_DSP_SUPPORT == 1 )
+        /* Only restore AC1, AC2, AC3 and DSPControl when returning to a nested
+        interrupt, or to a task that uses the DSP ASE.  s7 is used as a scratch
+        register as it is restored below. */
+        la          s6, uxInterruptNesting
+        lw          s6, (s6)
+        addiu       s6, s6, -1
+        bne         s6, zero, 3f
+        nop
+
+        lw          s6, portTASK_HAS_DSP_STACK_LOCATION(s5)
+        la          s7, ulTaskHasDSPContext
+        sw          s6, 0(s7)
+        beq         s6, zero, 4f
+        nop
+
+    3:
+    #endif
+
     /* Restore the context. */
     lw          s6, 128(s5)
     mthi        s6, $ac1
@@ -329,6 +376,10 @@
     lw          s6, 148(s5)
     wrdsp       s6
 
+    #if ( configUSE_TASK_DSP_SUPPORT == 1 )
+    4:
+    #endif
+
     lw          s6, 8(s5)
     mtlo        s6, $ac0
     lw          s6, 12(s5)
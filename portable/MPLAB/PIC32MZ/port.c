@@ -92,6 +92,15 @@ override this behaviour by:
        timer used to generate the tick interrupt.  For example, when timer 1 is
        used configCLEAR_TICK_TIMER_INTERRUPT() is defined to
        IFS0CLR = _IFS0_T1IF_MASK.
+
+When configTICK_SHADOW_REGISTER_SET is set to a shadow register set number the
+tick interrupt runs on that register set, which removes most of the context
+save and restore from every tick.  The priority level of the tick is then
+mapped to the shadow register set, so the tick interrupt priority is raised to
+portTICK_INTERRUPT_PRIORITY (one above configKERNEL_INTERRUPT_PRIORITY) to keep
+it separate from the yield interrupt, and no other interrupt may use that
+priority.  An application supplied vApplicationSetupTickTimerInterrupt() must
+also use portTICK_INTERRUPT_PRIORITY.
 */
 #ifndef configTICK_INTERRUPT_VECTOR
     #define configTICK_INTERRUPT_VECTOR _TIMER_1_VECTOR
@@ -102,6 +111,11 @@ override this behaviour by:
     #endif
 #endif
 
+/* Bits within the PRISS register that select the shadow register set used by
+each interrupt priority level. */
+#define portPRISS_BITS_PER_PRIORITY ( 4UL )
+#define portPRISS_SET_MASK          ( 0x0FUL )
+
 /* Let the user override the pre-loading of the initial RA with the address of
 prvTaskExitError() in case it messes up unwinding of the stack in the
 debugger - in which case configTASK_RETURN_ADDRESS can be defined as 0 (NULL). */
@@ -166,6 +180,12 @@ const StackType_t * const xISRStackTop = &( xISRStack[ ( configISR_STACK_SIZE &
     uint32_t ulTaskHasFPUContext = 0;
 #endif
 
+/* Saved as part of the task context. Set to pdFALSE if the task does not use
+ the DSP ASE, in which case AC1 - AC3 and DSPControl are not saved. */
+#if ( configUSE_TASK_DSP_SUPPORT == 1 )
+    uint32_t ulTaskHasDSPContext = 0;
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -199,7 +219,10 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
     pxTopOfStack -= 15;
 
     *pxTopOfStack = (StackType_t) pvParameters; /* Parameters to pass in. */
-    pxTopOfStack -= 15;
+    pxTopOfStack -= 14;
+
+    *pxTopOfStack = (StackType_t) pdFALSE; /* by default disable DSP context save */
+    pxTopOfStack--;
 
     *pxTopOfStack = (StackType_t) pdFALSE; /*by default disable FPU context save on parts with FPU */
 
@@ -237,7 +260,7 @@ const uint32_t ulCompareMatch = ( (configPERIPHERAL_CLOCK_HZ / portTIMER_PRESCAL
     T1CON = 0x0000;
     T1CONbits.TCKPS = portPRESCALE_BITS;
     PR1 = ulCompareMatch;
-    IPC1bits.T1IP = configKERNEL_INTERRUPT_PRIORITY;
+    IPC1bits.T1IP = portTICK_INTERRUPT_PRIORITY;
 
     /* Clear the interrupt as a starting condition. */
     IFS0bits.T1IF = 0;
@@ -281,6 +304,14 @@ extern void *pxCurrentTCB;
     IEC0CLR = _IEC0_CS0IE_MASK;
     IEC0SET = 1 << _IEC0_CS0IE_POSITION;
 
+    #if ( configTICK_SHADOW_REGISTER_SET > 0 )
+    {
+        /* Run the tick interrupt on its own shadow register set. */
+        PRISSCLR = portPRISS_SET_MASK << ( portTICK_INTERRUPT_PRIORITY * portPRISS_BITS_PER_PRIORITY );
+        PRISSSET = ( ( uint32_t ) configTICK_SHADOW_REGISTER_SET ) << ( portTICK_INTERRUPT_PRIORITY * portPRISS_BITS_PER_PRIORITY );
+    }
+    #endif /* configTICK_SHADOW_REGISTER_SET */
+
     /* Setup the timer to generate the tick.  Interrupts will have been
     disabled by the time we get here. */
     vApplicationSetupTickTimerInterrupt();
@@ -367,3 +398,20 @@ void vPortClearInterruptMaskFromISR( UBaseType_t uxSavedStatusRegister )
 #endif /* __mips_hard_float == 1 */
 
 /*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_DSP_SUPPORT == 1 )
+
+    void vPortTaskUsesDSP(void)
+    {
+        portENTER_CRITICAL();
+
+        /* A task is registering the fact that it uses the DSP accumulators.
+        Set the DSP flag (saved as part of the task context). */
+        ulTaskHasDSPContext = pdTRUE;
+
+        portEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_TASK_DSP_SUPPORT */
+
+/*-----------------------------------------------------------*/
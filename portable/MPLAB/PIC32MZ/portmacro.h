@@ -155,6 +155,31 @@ extern void vPortClearInterruptMaskFromISR( UBaseType_t );
     #define portTASK_USES_FLOATING_POINT() vPortTaskUsesFPU()
 #endif
 
+/* Set configUSE_TASK_DSP_SUPPORT to 1 to only save AC1 - AC3 and DSPControl
+for tasks that have called vPortTaskUsesDSP().  Any task that executes DSP ASE
+instructions, including ones generated by the compiler, must call it first. */
+#if ( configUSE_TASK_DSP_SUPPORT == 1 )
+    void vPortTaskUsesDSP( void );
+#endif
+
+/* Set configTICK_SHADOW_REGISTER_SET to the number of a shadow register set to
+dedicate it to the tick interrupt.  See the comments in port.c. */
+#ifdef configTICK_SHADOW_REGISTER_SET
+    #if ( configTICK_SHADOW_REGISTER_SET > 7 )
+        #error configTICK_SHADOW_REGISTER_SET must be 0 (not used) or the number of a shadow register set, 1 to 7.
+    #endif
+
+    #if ( configTICK_SHADOW_REGISTER_SET > 0 ) && ( configKERNEL_INTERRUPT_PRIORITY >= configMAX_SYSCALL_INTERRUPT_PRIORITY )
+        #error configTICK_SHADOW_REGISTER_SET raises the tick interrupt priority to configKERNEL_INTERRUPT_PRIORITY + 1, which must not be above configMAX_SYSCALL_INTERRUPT_PRIORITY.
+    #endif
+#endif
+
+#if ( configTICK_SHADOW_REGISTER_SET > 0 )
+    #define portTICK_INTERRUPT_PRIORITY     ( configKERNEL_INTERRUPT_PRIORITY + 1 )
+#else
+    #define portTICK_INTERRUPT_PRIORITY     configKERNEL_INTERRUPT_PRIORITY
+#endif
+
 #ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
     #define configUSE_PORT_OPTIMISED_TASK_SELECTION 1
 #endif
@@ -56,11 +56,29 @@
  */
 static DWORD WINAPI prvSimulatedPeripheralTimer( LPVOID lpParameter );
 
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 /*
  * Process all the simulated interrupts - each represented by a bit in
  * ulPendingInterrupts variable.
  */
-static void prvProcessSimulatedInterrupts( void );
+    static void prvProcessSimulatedInterrupts( void );
+
+#else
+
+/*
+ * Run the pending simulated interrupts on the fiber of the running task, then
+ * switch to the fiber of another task if they made one ready that should run.
+ * Called wherever the running task enables (simulated) interrupts.
+ */
+    static void prvDispatchSimulatedInterrupts( void );
+
+/*
+ * The function every task fiber starts in, which calls the task function.
+ */
+    static VOID WINAPI prvFiberEntry( LPVOID lpParameter );
+
+#endif
 
 /*
  * Interrupt handlers used by the kernel itself.  These are executed from the
@@ -86,20 +104,28 @@ static BOOL WINAPI prvEndProcess( DWORD dwCtrlType );
 
 /*-----------------------------------------------------------*/
 
-/* The WIN32 simulator runs each task in a thread.  The context switching is
- * managed by the threads, so the task stack does not have to be managed directly,
- * although the task stack is still used to hold an xThreadState structure this is
- * the only thing it will ever hold.  The structure indirectly maps the task handle
- * to a thread handle. */
+/* The WIN32 simulator runs each task in a thread, or a fiber if
+ * configUSE_WIN32_FIBERS is 1.  The context switching is managed by the threads,
+ * so the task stack does not have to be managed directly, although the task stack
+ * is still used to hold an xThreadState structure this is the only thing it will
+ * ever hold.  The structure indirectly maps the task handle to a thread handle. */
 typedef struct
 {
-    /* Handle of the thread that executes the task. */
+    /* Handle of the thread, or fiber, that executes the task. */
     void * pvThread;
 
-    /* Event used to make sure the thread does not execute past a yield point
-     * between the call to SuspendThread() to suspend the thread and the
-     * asynchronous SuspendThread() operation actually being performed. */
-    void * pvYieldEvent;
+    #if ( configUSE_WIN32_FIBERS == 0 )
+
+        /* Event used to make sure the thread does not execute past a yield point
+         * between the call to SuspendThread() to suspend the thread and the
+         * asynchronous SuspendThread() operation actually being performed. */
+        void * pvYieldEvent;
+    #else
+        /* The task function and its parameter, called when the fiber first
+         * runs. */
+        TaskFunction_t pxCode;
+        void * pvParameters;
+    #endif
 } ThreadState_t;
 
 /* Simulated interrupts waiting to be processed.  This is a bit mask where each
@@ -108,9 +134,17 @@ static volatile uint32_t ulPendingInterrupts = 0UL;
 
 /* An event used to inform the simulated interrupt processing thread (a high
  * priority thread that simulated interrupt processing) that an interrupt is
- * pending. */
+ * pending.  With fibers it wakes the idle task instead. */
 static void * pvInterruptEvent = NULL;
 
+#if ( configUSE_WIN32_FIBERS == 1 )
+
+/* The fiber of the thread that started the scheduler, switched back to when
+ * the scheduler ends. */
+    static void * pvMainFiber = NULL;
+
+#endif
+
 /* Mutex used to protect all the simulated interrupt variables that are accessed
  * by multiple threads. */
 static void * pvInterruptEventMutex = NULL;
@@ -201,6 +235,8 @@ static BOOL WINAPI prvEndProcess( DWORD dwCtrlType )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
                                      TaskFunction_t pxCode,
                                      void * pvParameters )
@@ -245,8 +281,53 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 
     return ( StackType_t * ) pxThreadState;
 }
+
+#else /* configUSE_WIN32_FIBERS */
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    ThreadState_t * pxThreadState = NULL;
+    int8_t * pcTopOfStack = ( int8_t * ) pxTopOfStack;
+    const SIZE_T xStackSize = 1024; /* Set the size to a small number which will get rounded up to the minimum possible. */
+
+    /* As with threads, the task stack only holds the ThreadState_t.  The fiber
+     * has a stack of its own. */
+    pxThreadState = ( ThreadState_t * ) ( pcTopOfStack - sizeof( ThreadState_t ) );
+    pxThreadState->pxCode = pxCode;
+    pxThreadState->pvParameters = pvParameters;
+
+    /* FIBER_FLAG_FLOAT_SWITCH saves and restores the floating point state of
+     * each task, which a thread would have of its own. */
+    pxThreadState->pvThread = CreateFiberEx( 0, xStackSize, FIBER_FLAG_FLOAT_SWITCH, prvFiberEntry, pxThreadState );
+    configASSERT( pxThreadState->pvThread );
+
+    return ( StackType_t * ) pxThreadState;
+}
 /*-----------------------------------------------------------*/
 
+static VOID WINAPI prvFiberEntry( LPVOID lpParameter )
+{
+    ThreadState_t * pxThreadState = ( ThreadState_t * ) lpParameter;
+
+    pxThreadState->pxCode( pxThreadState->pvParameters );
+
+    /* Task functions must not return.  Returning from a fiber would end the
+     * thread that runs every task, so yield forever instead. */
+    configASSERT( pdFALSE );
+
+    for( ; ; )
+    {
+        portYIELD();
+    }
+}
+
+#endif /* configUSE_WIN32_FIBERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 BaseType_t xPortStartScheduler( void )
 {
     void * pvHandle = NULL;
@@ -347,6 +428,53 @@ BaseType_t xPortStartScheduler( void )
      * not get here. */
     return 0;
 }
+
+#else /* configUSE_WIN32_FIBERS */
+
+BaseType_t xPortStartScheduler( void )
+{
+    void * pvHandle = NULL;
+    ThreadState_t * pxThreadState = NULL;
+
+    /* Install the interrupt handlers used by the scheduler itself. */
+    vPortSetInterruptHandler( portINTERRUPT_YIELD, prvProcessYieldInterrupt );
+    vPortSetInterruptHandler( portINTERRUPT_TICK, prvProcessTickInterrupt );
+
+    /* Every task runs on this thread, so this thread becomes a fiber too, to
+     * be able to switch to the tasks' fibers and back again when the scheduler
+     * ends. */
+    pvInterruptEvent = CreateEvent( NULL, FALSE, FALSE, NULL );
+    pvMainFiber = ConvertThreadToFiber( NULL );
+
+    if( ( pvInterruptEvent != NULL ) && ( pvMainFiber != NULL ) )
+    {
+        /* The scheduler is now running. */
+        ulCriticalNesting = portNO_CRITICAL_NESTING;
+        xPortRunning = pdTRUE;
+
+        /* Start the thread that simulates the timer peripheral to generate
+         * tick interrupts.  It only pends the interrupt, so it does not need
+         * to preempt this thread. */
+        pvHandle = CreateThread( NULL, 0, prvSimulatedPeripheralTimer, NULL, 0, NULL );
+
+        if( pvHandle != NULL )
+        {
+            SetThreadPriority( pvHandle, portSIMULATED_TIMER_THREAD_PRIORITY );
+            SetThreadPriorityBoost( pvHandle, TRUE );
+        }
+
+        /* Start the highest priority task by switching to its fiber. */
+        pxThreadState = ( ThreadState_t * ) *( ( size_t * ) pxCurrentTCB );
+        SwitchToFiber( pxThreadState->pvThread );
+
+        /* vPortEndScheduler() switched back to this fiber. */
+        ConvertFiberToThread();
+    }
+
+    return 0;
+}
+
+#endif /* configUSE_WIN32_FIBERS */
 /*-----------------------------------------------------------*/
 
 static uint32_t prvProcessYieldInterrupt( void )
@@ -368,6 +496,8 @@ static uint32_t prvProcessTickInterrupt( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 static void prvProcessSimulatedInterrupts( void )
 {
     uint32_t ulSwitchRequired, i;
@@ -476,8 +606,69 @@ static void prvProcessSimulatedInterrupts( void )
         }
     }
 }
+
+#else /* configUSE_WIN32_FIBERS */
+
+static void prvDispatchSimulatedInterrupts( void )
+{
+    uint32_t ulSwitchRequired, ulPending, i;
+    ThreadState_t * pxThreadState;
+
+    /* Prevents a critical section used inside a handler from running the
+     * interrupts again when it is exited. */
+    xInsideInterrupt = pdTRUE;
+    ulSwitchRequired = pdFALSE;
+
+    /* Take all the pending interrupts at once, as other Windows threads can
+     * pend more at any time.  Interrupts pended by the handlers themselves are
+     * run before returning to a task. */
+    ulPending = ( uint32_t ) InterlockedExchange( ( volatile LONG * ) &ulPendingInterrupts, 0 );
+
+    while( ulPending != 0UL )
+    {
+        for( i = 0; i < portMAX_INTERRUPTS; i++ )
+        {
+            if( ( ( ulPending & ( 1UL << i ) ) != 0 ) && ( ulIsrHandler[ i ] != NULL ) )
+            {
+                /* Run the actual handler.  Handlers return pdTRUE if they
+                 * necessitate a context switch. */
+                if( ulIsrHandler[ i ]() != pdFALSE )
+                {
+                    /* A bit mask is used purely to help debugging. */
+                    ulSwitchRequired |= ( 1 << i );
+                }
+            }
+        }
+
+        ulPending = ( uint32_t ) InterlockedExchange( ( volatile LONG * ) &ulPendingInterrupts, 0 );
+    }
+
+    /* Cleared before switching, as a fiber that has not run before starts in
+     * its task function rather than returning here. */
+    xInsideInterrupt = pdFALSE;
+
+    if( ulSwitchRequired != pdFALSE )
+    {
+        /* Select the next task to run. */
+        vTaskSwitchContext();
+
+        /* The running task's fiber is saved by SwitchToFiber() itself, so
+         * unlike with threads there is no asynchronous suspension to wait
+         * for.  The fiber continues from here when it is next selected. */
+        pxThreadState = ( ThreadState_t * ) ( *( size_t * ) pxCurrentTCB );
+
+        if( pxThreadState->pvThread != GetCurrentFiber() )
+        {
+            SwitchToFiber( pxThreadState->pvThread );
+        }
+    }
+}
+
+#endif /* configUSE_WIN32_FIBERS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 void vPortDeleteThread( void * pvTaskToDelete )
 {
     ThreadState_t * pxThreadState;
@@ -510,8 +701,28 @@ void vPortDeleteThread( void * pvTaskToDelete )
         ReleaseMutex( pvInterruptEventMutex );
     }
 }
+
+#else /* configUSE_WIN32_FIBERS */
+
+void vPortDeleteThread( void * pvTaskToDelete )
+{
+    ThreadState_t * pxThreadState;
+
+    /* Find the fiber of the task being deleted. */
+    pxThreadState = ( ThreadState_t * ) ( *( size_t * ) pvTaskToDelete );
+
+    /* A task that deleted itself has been switched out by the time its TCB is
+     * cleaned up, so unlike a thread its fiber, and the fiber's stack, can
+     * always be freed here. */
+    configASSERT( pxThreadState->pvThread != GetCurrentFiber() );
+    DeleteFiber( pxThreadState->pvThread );
+}
+
+#endif /* configUSE_WIN32_FIBERS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 void vPortCloseRunningThread( void * pvTaskToDelete,
                               volatile BaseType_t * pxPendYield )
 {
@@ -564,14 +775,47 @@ void vPortCloseRunningThread( void * pvTaskToDelete,
     CloseHandle( pxThreadState->pvYieldEvent );
     ExitThread( 0 );
 }
+
+#else /* configUSE_WIN32_FIBERS */
+
+void vPortCloseRunningThread( void * pvTaskToDelete,
+                              volatile BaseType_t * pxPendYield )
+{
+    /* A fiber cannot delete itself, so it is left for vPortDeleteThread() to
+     * delete when the idle task cleans up the TCB. */
+    ( void ) pvTaskToDelete;
+
+    /* This function will not return, so vTaskDelete() cannot yield. */
+    *pxPendYield = pdTRUE;
+
+    /* This is called from a critical section, which must be exited before
+     * switching away from the task for the last time. */
+    taskEXIT_CRITICAL();
+
+    vPortGenerateSimulatedInterrupt( portINTERRUPT_YIELD );
+
+    /* The task is never selected to run again, so should not get here. */
+    configASSERT( pdFALSE );
+}
+
+#endif /* configUSE_WIN32_FIBERS */
 /*-----------------------------------------------------------*/
 
 void vPortEndScheduler( void )
 {
     xPortRunning = pdFALSE;
+
+    #if ( configUSE_WIN32_FIBERS == 1 )
+    {
+        /* Return from xPortStartScheduler(). */
+        SwitchToFiber( pvMainFiber );
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
 {
     ThreadState_t * pxThreadState = ( ThreadState_t * ) *( ( size_t * ) pxCurrentTCB );
@@ -610,8 +854,32 @@ void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
         }
     }
 }
+
+#else /* configUSE_WIN32_FIBERS */
+
+void vPortGenerateSimulatedInterrupt( uint32_t ulInterruptNumber )
+{
+    configASSERT( xPortRunning );
+
+    if( ulInterruptNumber < portMAX_INTERRUPTS )
+    {
+        InterlockedOr( ( volatile LONG * ) &ulPendingInterrupts, ( LONG ) ( 1UL << ulInterruptNumber ) );
+
+        /* Run the interrupt now unless this call is within a critical
+         * section, in which case it runs when the critical section nesting
+         * count is wound back down to zero. */
+        if( ( ulCriticalNesting == portNO_CRITICAL_NESTING ) && ( xInsideInterrupt == pdFALSE ) )
+        {
+            prvDispatchSimulatedInterrupts();
+        }
+    }
+}
+
+#endif /* configUSE_WIN32_FIBERS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 void vPortGenerateSimulatedInterruptFromWindowsThread( uint32_t ulInterruptNumber )
 {
     if( xPortRunning == pdTRUE )
@@ -636,6 +904,39 @@ void vPortGenerateSimulatedInterruptFromWindowsThread( uint32_t ulInterruptNumbe
         ReleaseMutex( pvInterruptEventMutex );
     }
 }
+
+#else /* configUSE_WIN32_FIBERS */
+
+void vPortGenerateSimulatedInterruptFromWindowsThread( uint32_t ulInterruptNumber )
+{
+    if( ( xPortRunning == pdTRUE ) && ( ulInterruptNumber < portMAX_INTERRUPTS ) )
+    {
+        /* The interrupt runs on the fiber of the running task the next time
+         * that task enables (simulated) interrupts. */
+        InterlockedOr( ( volatile LONG * ) &ulPendingInterrupts, ( LONG ) ( 1UL << ulInterruptNumber ) );
+
+        /* Wake the idle task if it is waiting for an interrupt.  The event is
+         * set after the interrupt is pended so the wake up cannot be missed. */
+        SetEvent( pvInterruptEvent );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortWaitForSimulatedInterrupt( void )
+{
+    if( ulPendingInterrupts == 0UL )
+    {
+        /* Let the host run something else until an interrupt is pended. */
+        WaitForSingleObject( pvInterruptEvent, INFINITE );
+    }
+
+    if( ulCriticalNesting == portNO_CRITICAL_NESTING )
+    {
+        prvDispatchSimulatedInterrupts();
+    }
+}
+
+#endif /* configUSE_WIN32_FIBERS */
 /*-----------------------------------------------------------*/
 
 void vPortSetInterruptHandler( uint32_t ulInterruptNumber,
@@ -657,6 +958,8 @@ void vPortSetInterruptHandler( uint32_t ulInterruptNumber,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WIN32_FIBERS == 0 )
+
 void vPortEnterCritical( void )
 {
     if( xPortRunning == pdTRUE )
@@ -727,4 +1030,35 @@ void vPortExitCritical( void )
         }
     }
 }
+
+#else /* configUSE_WIN32_FIBERS */
+
+void vPortEnterCritical( void )
+{
+    /* Simulated interrupts only run on the thread that runs the tasks, so
+     * holding them off needs nothing more than the nesting count. */
+    ulCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    if( ulCriticalNesting > portNO_CRITICAL_NESTING )
+    {
+        ulCriticalNesting--;
+
+        /* Run any interrupts that were pended while interrupts were
+         * (simulated) disabled, unless the critical section was exited from
+         * inside an interrupt. */
+        if( ( ulCriticalNesting == portNO_CRITICAL_NESTING ) &&
+            ( xInsideInterrupt == pdFALSE ) &&
+            ( ulPendingInterrupts != 0UL ) )
+        {
+            configASSERT( xPortRunning );
+            prvDispatchSimulatedInterrupts();
+        }
+    }
+}
+
+#endif /* configUSE_WIN32_FIBERS */
 /*-----------------------------------------------------------*/
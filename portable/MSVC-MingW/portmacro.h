@@ -47,6 +47,24 @@ extern "C" {
 /******************************************************************************
 *   Defines
 ******************************************************************************/
+
+/* Set configUSE_WIN32_FIBERS to 1 in FreeRTOSConfig.h to run every task as a
+ * fiber of the thread that calls vTaskStartScheduler(), rather than as a
+ * thread of its own.  A context switch is then a SwitchToFiber() call on the
+ * same thread, which is orders of magnitude faster than suspending one thread
+ * and resuming another, and the host does not need more than one core.
+ *
+ * Simulated interrupts are pended by other Windows threads, such as the one
+ * that generates the tick, but only run on the fiber of the running task when
+ * it enables (simulated) interrupts: on leaving a critical section, yielding,
+ * or calling an API function that uses a critical section, including
+ * xTaskGetTickCount().  A task that runs without calling the kernel is
+ * therefore not preempted until it next does.  The idle task waits for the
+ * next simulated interrupt instead of spinning.  Defaults to 0. */
+#ifndef configUSE_WIN32_FIBERS
+    #define configUSE_WIN32_FIBERS    0
+#endif
+
 /* Type definitions. */
 #define portCHAR                 char
 #define portFLOAT                float
@@ -77,13 +95,17 @@ typedef portSTACK_TYPE           StackType_t;
     #define portMAX_DELAY              ( TickType_t ) 0xffffffffUL
 
 /* 32-bit tick type on a 32/64-bit architecture, so reads of the tick
- * count do not need to be guarded with a critical section. */
-    #define portTICK_TYPE_IS_ATOMIC    1
+ * count do not need to be guarded with a critical section.  With fibers the
+ * critical section is kept, as leaving it lets a task that polls the tick
+ * count run the tick interrupt. */
+    #if ( configUSE_WIN32_FIBERS == 0 )
+        #define portTICK_TYPE_IS_ATOMIC    1
+    #endif
 #elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_64_BITS )
     typedef uint64_t             TickType_t;
     #define portMAX_DELAY              ( TickType_t ) 0xffffffffffffffffULL
 
-#if defined( __x86_64__ ) || defined( _M_X64 )
+#if ( defined( __x86_64__ ) || defined( _M_X64 ) ) && ( configUSE_WIN32_FIBERS == 0 )
 /* 64-bit tick type on a 64-bit architecture, so reads of the tick
  * count do not need to be guarded with a critical section. */
     #define portTICK_TYPE_IS_ATOMIC    1
@@ -107,7 +129,20 @@ typedef portSTACK_TYPE           StackType_t;
 
 
 extern volatile BaseType_t xInsideInterrupt;
-#define portSOFTWARE_BARRIER()    while( xInsideInterrupt != pdFALSE )
+
+#if ( configUSE_WIN32_FIBERS == 0 )
+    #define portSOFTWARE_BARRIER()    while( xInsideInterrupt != pdFALSE )
+#else
+
+/* Simulated interrupts run on the same thread as the tasks, so a task can
+ * never observe one part way through. */
+    #define portSOFTWARE_BARRIER()
+
+/* Called by the idle task, which has nothing to do until a simulated
+ * interrupt makes a task ready. */
+    void vPortWaitForSimulatedInterrupt( void );
+    #define portIDLE_WAIT_FOR_INTERRUPT()    vPortWaitForSimulatedInterrupt()
+#endif
 
 
 /* Simulated interrupts return pdFALSE if no context switch should be performed,
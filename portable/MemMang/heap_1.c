@@ -103,7 +103,10 @@ void * pvPortMalloc( size_t xWantedSize )
     }
     #endif /* if ( portBYTE_ALIGNMENT != 1 ) */
 
-    vTaskSuspendAll();
+    /* Allocating only moves xNextFreeByte on, so a short critical section is
+     * used rather than suspending and resuming the scheduler, which would
+     * cost far more than the allocation itself. */
+    taskENTER_CRITICAL();
     {
         if( pucAlignedHeap == NULL )
         {
@@ -125,7 +128,7 @@ void * pvPortMalloc( size_t xWantedSize )
 
         traceMALLOC( pvReturn, xWantedSize );
     }
-    ( void ) xTaskResumeAll();
+    taskEXIT_CRITICAL();
 
     #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
     {
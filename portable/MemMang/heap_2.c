@@ -32,6 +32,13 @@
  * into a single larger block (and so will fragment memory).  See heap_4.c for
  * an equivalent that does combine adjacent blocks into single larger blocks.
  *
+ * When configHEAP_2_USE_SIZE_BINS is 1, free blocks of up to
+ * configHEAP_2_SIZE_BINS multiples of portBYTE_ALIGNMENT bytes are held in
+ * bins of blocks of one size, with a bitmap of the bins that are not empty,
+ * rather than in the list of free blocks sorted by size.  A block of a binned
+ * size is then freed, and allocated when a block of exactly that size is free,
+ * without searching.
+ *
  * See heap_1.c, heap_3.c and heap_4.c for alternative implementations, and the
  * memory management pages of https://www.FreeRTOS.org for more information.
  */
@@ -109,9 +116,12 @@ static const size_t xHeapStructSize = ( ( sizeof( BlockLink_t ) + ( size_t ) ( p
 /* Create a couple of list links to mark the start and end of the list. */
 PRIVILEGED_DATA static BlockLink_t xStart, xEnd;
 
-/* Keeps track of the number of free bytes remaining, but says nothing about
- * fragmentation. */
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
 PRIVILEGED_DATA static size_t xFreeBytesRemaining = configADJUSTED_HEAP_SIZE;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = configADJUSTED_HEAP_SIZE;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = ( size_t ) 0U;
 
 /* Indicates whether the heap has been initialised or not. */
 PRIVILEGED_DATA static BaseType_t xHeapHasBeenInitialised = pdFALSE;
@@ -123,6 +133,40 @@ PRIVILEGED_DATA static BaseType_t xHeapHasBeenInitialised = pdFALSE;
  */
 static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
 
+#if ( configHEAP_2_USE_SIZE_BINS == 1 )
+
+/* A block of xBlockSize bytes is held in bin heapBIN_INDEX( xBlockSize ) if
+ * that is less than configHEAP_2_SIZE_BINS.  Every block in a bin is at least
+ * as large as a request rounded up to the size the bin is indexed by. */
+    #define heapBIN_INDEX( xBlockSize )          ( ( xBlockSize ) / ( size_t ) portBYTE_ALIGNMENT )
+    #define heapSIZE_IS_BINNED( xBlockSize )     ( heapBIN_INDEX( xBlockSize ) < ( size_t ) configHEAP_2_SIZE_BINS )
+    #define heapBITS_PER_BITMAP_WORD             ( ( UBaseType_t ) ( sizeof( UBaseType_t ) * heapBITS_PER_BYTE ) )
+    #define heapBITMAP_WORDS                     ( ( ( UBaseType_t ) configHEAP_2_SIZE_BINS + heapBITS_PER_BITMAP_WORD - 1U ) / heapBITS_PER_BITMAP_WORD )
+
+/* The free blocks of each binned size, linked through pxNextFreeBlock. */
+    PRIVILEGED_DATA static BlockLink_t * pxBins[ configHEAP_2_SIZE_BINS ];
+
+/* Bit n is set if pxBins[ n ] is not empty. */
+    PRIVILEGED_DATA static UBaseType_t uxBinBitmap[ heapBITMAP_WORDS ];
+
+/*
+ * Adds a free block to its bin if it has a binned size, otherwise to the list
+ * of free blocks.  Must be called with the scheduler suspended.
+ */
+    static void prvAddFreeBlock( BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes and returns a block from the bin for xWantedSize bytes, or from the
+ * smallest larger bin that is not empty, or returns NULL if all those bins are
+ * empty.  Must be called with the scheduler suspended.
+ */
+    static BlockLink_t * prvTakeBinnedBlock( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+    #define heapADD_FREE_BLOCK( pxBlock )    prvAddFreeBlock( pxBlock )
+#else
+    #define heapADD_FREE_BLOCK( pxBlock )    prvInsertBlockIntoFreeList( ( pxBlock ) )
+#endif /* configHEAP_2_USE_SIZE_BINS */
+
 /*-----------------------------------------------------------*/
 
 /* STATIC FUNCTIONS ARE DEFINED AS MACROS TO MINIMIZE THE FUNCTION CALL DEPTH. */
@@ -219,15 +263,41 @@ void * pvPortMalloc( size_t xWantedSize )
         {
             if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
             {
-                /* Blocks are stored in byte order - traverse the list from the start
-                 * (smallest) block until one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = xStart.pxNextFreeBlock;
+                pxBlock = &xEnd;
 
-                while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+                #if ( configHEAP_2_USE_SIZE_BINS == 1 )
                 {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = pxBlock->pxNextFreeBlock;
+                    if( heapSIZE_IS_BINNED( xWantedSize ) )
+                    {
+                        pxBlock = prvTakeBinnedBlock( xWantedSize );
+
+                        if( pxBlock == NULL )
+                        {
+                            pxBlock = &xEnd;
+                        }
+                    }
+                }
+                #endif /* configHEAP_2_USE_SIZE_BINS */
+
+                if( pxBlock == &xEnd )
+                {
+                    /* Blocks are stored in byte order - traverse the list from the start
+                     * (smallest) block until one of adequate size is found. */
+                    pxPreviousBlock = &xStart;
+                    pxBlock = xStart.pxNextFreeBlock;
+
+                    while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+                    {
+                        pxPreviousBlock = pxBlock;
+                        pxBlock = pxBlock->pxNextFreeBlock;
+                    }
+
+                    if( pxBlock != &xEnd )
+                    {
+                        /* This block is being returned for use so must be taken out of the
+                         * list of free blocks. */
+                        pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+                    }
                 }
 
                 /* If we found the end marker then a block of adequate size was not found. */
@@ -235,11 +305,7 @@ void * pvPortMalloc( size_t xWantedSize )
                 {
                     /* Return the memory space - jumping over the BlockLink_t structure
                      * at its start. */
-                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxPreviousBlock->pxNextFreeBlock ) + xHeapStructSize );
-
-                    /* This block is being returned for use so must be taken out of the
-                     * list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
 
                     /* If the block is larger than required it can be split into two. */
                     if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
@@ -256,18 +322,25 @@ void * pvPortMalloc( size_t xWantedSize )
 
                         /* Insert the new block into the list of free blocks.
                          * The list of free blocks is sorted by their size, we have to
-                         * iterate to find the right place to insert new block. */
-                        prvInsertBlockIntoFreeList( ( pxNewBlockLink ) );
+                         * iterate to find the right place to insert new block, unless
+                         * the block has a binned size. */
+                        heapADD_FREE_BLOCK( pxNewBlockLink );
                     }
 
                     xFreeBytesRemaining -= pxBlock->xBlockSize;
 
+                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                    {
+                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                    }
+
                     xAllocatedBlockSize = pxBlock->xBlockSize;
 
                     /* The block is being returned - it is allocated and owned
                      * by the application and has no "next" block. */
                     heapALLOCATE_BLOCK( pxBlock );
                     pxBlock->pxNextFreeBlock = NULL;
+                    xNumberOfSuccessfulAllocations++;
                 }
             }
         }
@@ -326,9 +399,10 @@ void vPortFree( void * pv )
                 vTaskSuspendAll();
                 {
                     /* Add this block to the list of free blocks. */
-                    prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
+                    heapADD_FREE_BLOCK( ( ( BlockLink_t * ) pxLink ) );
                     xFreeBytesRemaining += pxLink->xBlockSize;
                     traceFREE( pv, pxLink->xBlockSize );
+                    xNumberOfSuccessfulFrees++;
                 }
                 ( void ) xTaskResumeAll();
             }
@@ -343,6 +417,18 @@ size_t xPortGetFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void xPortResetHeapMinimumEverFreeHeapSize( void )
+{
+    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
 void vPortInitialiseBlocks( void )
 {
     /* This just exists to keep the linker quiet. */
@@ -393,6 +479,149 @@ static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
 }
 /*-----------------------------------------------------------*/
 
+#if ( configHEAP_2_USE_SIZE_BINS == 1 )
+
+    static void prvAddFreeBlock( BlockLink_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+    {
+        size_t xBin;
+
+        if( heapSIZE_IS_BINNED( pxBlock->xBlockSize ) )
+        {
+            xBin = heapBIN_INDEX( pxBlock->xBlockSize );
+
+            pxBlock->pxNextFreeBlock = pxBins[ xBin ];
+            pxBins[ xBin ] = pxBlock;
+            uxBinBitmap[ xBin / heapBITS_PER_BITMAP_WORD ] |= ( ( UBaseType_t ) 1U ) << ( xBin % heapBITS_PER_BITMAP_WORD );
+        }
+        else
+        {
+            prvInsertBlockIntoFreeList( pxBlock );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BlockLink_t * prvTakeBinnedBlock( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+    {
+        BlockLink_t * pxBlock = NULL;
+        UBaseType_t uxBin = ( UBaseType_t ) heapBIN_INDEX( xWantedSize );
+        UBaseType_t uxWord = uxBin / heapBITS_PER_BITMAP_WORD;
+        UBaseType_t uxBits;
+
+        if( pxBins[ uxBin ] == NULL )
+        {
+            /* No block of exactly the wanted size is free, so find the smallest
+             * larger bin that is not empty. */
+            uxBits = uxBinBitmap[ uxWord ] & ~( ( ( ( UBaseType_t ) 1U ) << ( uxBin % heapBITS_PER_BITMAP_WORD ) ) - 1U );
+
+            while( ( uxBits == 0U ) && ( ( uxWord + 1U ) < heapBITMAP_WORDS ) )
+            {
+                uxWord++;
+                uxBits = uxBinBitmap[ uxWord ];
+            }
+
+            if( uxBits != 0U )
+            {
+                uxBin = uxWord * heapBITS_PER_BITMAP_WORD;
+
+                while( ( uxBits & 1U ) == 0U )
+                {
+                    uxBits >>= 1U;
+                    uxBin++;
+                }
+            }
+            else
+            {
+                uxBin = ( UBaseType_t ) configHEAP_2_SIZE_BINS;
+            }
+        }
+
+        if( uxBin < ( UBaseType_t ) configHEAP_2_SIZE_BINS )
+        {
+            pxBlock = pxBins[ uxBin ];
+            pxBins[ uxBin ] = pxBlock->pxNextFreeBlock;
+
+            if( pxBins[ uxBin ] == NULL )
+            {
+                uxBinBitmap[ uxBin / heapBITS_PER_BITMAP_WORD ] &= ~( ( ( UBaseType_t ) 1U ) << ( uxBin % heapBITS_PER_BITMAP_WORD ) );
+            }
+        }
+
+        return pxBlock;
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configHEAP_2_USE_SIZE_BINS */
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+
+    #if ( configHEAP_2_USE_SIZE_BINS == 1 )
+        UBaseType_t uxBin;
+    #endif
+
+    vTaskSuspendAll();
+    {
+        /* The heap is initialised automatically when the first allocation is
+         * made. */
+        if( xHeapHasBeenInitialised != pdFALSE )
+        {
+            for( pxBlock = xStart.pxNextFreeBlock; pxBlock != &xEnd; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                xBlocks++;
+
+                if( pxBlock->xBlockSize > xMaxSize )
+                {
+                    xMaxSize = pxBlock->xBlockSize;
+                }
+
+                if( pxBlock->xBlockSize < xMinSize )
+                {
+                    xMinSize = pxBlock->xBlockSize;
+                }
+            }
+
+            #if ( configHEAP_2_USE_SIZE_BINS == 1 )
+            {
+                for( uxBin = 0U; uxBin < ( UBaseType_t ) configHEAP_2_SIZE_BINS; uxBin++ )
+                {
+                    for( pxBlock = pxBins[ uxBin ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+                    {
+                        xBlocks++;
+
+                        if( pxBlock->xBlockSize > xMaxSize )
+                        {
+                            xMaxSize = pxBlock->xBlockSize;
+                        }
+
+                        if( pxBlock->xBlockSize < xMinSize )
+                        {
+                            xMinSize = pxBlock->xBlockSize;
+                        }
+                    }
+                }
+            }
+            #endif /* configHEAP_2_USE_SIZE_BINS */
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
 /*
  * Reset the state in this file. This state is normally initialized at start up.
  * This function must be called by the application before restarting the
@@ -401,7 +630,17 @@ static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
 void vPortHeapResetState( void )
 {
     xFreeBytesRemaining = configADJUSTED_HEAP_SIZE;
+    xMinimumEverFreeBytesRemaining = configADJUSTED_HEAP_SIZE;
+    xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+    xNumberOfSuccessfulFrees = ( size_t ) 0U;
 
     xHeapHasBeenInitialised = pdFALSE;
+
+    #if ( configHEAP_2_USE_SIZE_BINS == 1 )
+    {
+        ( void ) memset( pxBins, 0x00, sizeof( pxBins ) );
+        ( void ) memset( uxBinBitmap, 0x00, sizeof( uxBinBitmap ) );
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
@@ -50,22 +50,56 @@
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 1 )
+    #include "light_mutex.h"
+#endif
+
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
     #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
 
+#if ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 1 )
+
+/* The C library serialises malloc() and free() by calling __malloc_lock() and
+ * __malloc_unlock(), which are implemented below, so the scheduler does not
+ * also need to be suspended. */
+    #define heapSUSPEND_ALL()
+    #define heapRESUME_ALL()
+#else
+    #define heapSUSPEND_ALL()    vTaskSuspendAll()
+    #define heapRESUME_ALL()     ( void ) xTaskResumeAll()
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 1 )
+
+/* Declared here rather than by including reent.h, which picolibc does not
+ * provide.  The parameter is not used. */
+    struct _reent;
+    void __malloc_lock( struct _reent * pxReent );
+    void __malloc_unlock( struct _reent * pxReent );
+
+/* Held by the task that is inside the C library's allocator.  Recursive as the
+ * library can take the lock again, for example when realloc() calls
+ * malloc(). */
+    PRIVILEGED_DATA static LightMutex_t xMallocMutex;
+    PRIVILEGED_DATA static volatile BaseType_t xMallocMutexInitialised = pdFALSE;
+
+#endif /* configHEAP_3_USE_LIBC_MALLOC_LOCK */
+
 /*-----------------------------------------------------------*/
 
 void * pvPortMalloc( size_t xWantedSize )
 {
     void * pvReturn;
 
-    vTaskSuspendAll();
+    heapSUSPEND_ALL();
     {
         pvReturn = malloc( xWantedSize );
         traceMALLOC( pvReturn, xWantedSize );
     }
-    ( void ) xTaskResumeAll();
+    heapRESUME_ALL();
 
     #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
     {
@@ -84,16 +118,81 @@ void vPortFree( void * pv )
 {
     if( pv != NULL )
     {
-        vTaskSuspendAll();
+        heapSUSPEND_ALL();
         {
             free( pv );
             traceFREE( pv, 0 );
         }
-        ( void ) xTaskResumeAll();
+        heapRESUME_ALL();
     }
 }
 /*-----------------------------------------------------------*/
 
+#if ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 1 )
+
+void __malloc_lock( struct _reent * pxReent )
+{
+    ( void ) pxReent;
+
+    if( xMallocMutexInitialised == pdFALSE )
+    {
+        taskENTER_CRITICAL();
+        {
+            if( xMallocMutexInitialised == pdFALSE )
+            {
+                vLightMutexInit( &xMallocMutex );
+                xMallocMutexInitialised = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+    {
+        ( void ) xLightMutexTakeRecursive( &xMallocMutex, portMAX_DELAY );
+    }
+    else
+    {
+        /* Before the scheduler starts, or while it is suspended, no other
+         * task can run, so the mutex is not taken.  The calling task cannot
+         * block, so another task must not have been switched out while inside
+         * the allocator. */
+        configASSERT( ( xLightMutexGetHolder( &xMallocMutex ) == NULL ) ||
+                      ( xLightMutexGetHolder( &xMallocMutex ) == xTaskGetCurrentTaskHandle() ) );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void __malloc_unlock( struct _reent * pxReent )
+{
+    TaskHandle_t xHolder;
+
+    ( void ) pxReent;
+
+    /* Only give the mutex if the matching __malloc_lock() took it. */
+    xHolder = xLightMutexGetHolder( &xMallocMutex );
+
+    if( ( xHolder != NULL ) && ( xHolder == xTaskGetCurrentTaskHandle() ) )
+    {
+        ( void ) xLightMutexGiveRecursive( &xMallocMutex );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configHEAP_3_USE_LIBC_MALLOC_LOCK */
+
 /*
  * Reset the state in this file. This state is normally initialized at start up.
  * This function must be called by the application before restarting the
@@ -101,6 +200,10 @@ void vPortFree( void * pv )
  */
 void vPortHeapResetState( void )
 {
-    /* No state needs to be re-initialised in heap_3. */
+    #if ( configHEAP_3_USE_LIBC_MALLOC_LOCK == 1 )
+    {
+        xMallocMutexInitialised = pdFALSE;
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
@@ -33,6 +33,29 @@
  *
  * See heap_1.c, heap_2.c and heap_3.c for alternative implementations, and the
  * memory management pages of https://www.FreeRTOS.org for more information.
+ *
+ * When configUSE_TASK_ALLOCATION_CACHE is 1 blocks of up to 128 bytes that a
+ * task frees are held in the task's own allocation cache, and reused by the
+ * task's next allocations of the same size class without suspending the
+ * scheduler.  Cached blocks are counted as allocated by xPortGetFreeHeapSize()
+ * and vPortGetHeapStats() until the task is deleted.
+ *
+ * When configUSE_HEAP_PROFILER is 1 each allocated block also records the task
+ * that allocated it and the call site it was allocated from, so
+ * uxPortGetHeapTaskUsage() can report the bytes each task holds and
+ * uxPortGetHeapBlockMap() can report the whole layout of the heap.  Blocks
+ * reused from a task allocation cache keep the task that first allocated them.
+ *
+ * When configUSE_CORE_LOCAL_SUSPEND is 1 in an SMP build, a heap operation
+ * only stops task switches on the calling core, and uses a lock of its own to
+ * keep the other cores out, rather than suspending the scheduler on every core.
+ *
+ * When configUSE_TASK_HEAP_QUOTAS is 1 each allocated block also records the
+ * task it is charged to, and an allocation that would take the calling task
+ * over the quota set by vTaskSetHeapQuota() fails.  A block that is not worth
+ * splitting is charged in full, so a task can go over its quota by less than
+ * the minimum block size.  Blocks reused from a task allocation cache stay
+ * charged to the task that first allocated them.
  */
 #include <stdlib.h>
 #include <string.h>
@@ -101,6 +124,13 @@ typedef struct A_BLOCK_LINK
 {
     struct A_BLOCK_LINK * pxNextFreeBlock; /**< The next free block in the list. */
     size_t xBlockSize;                     /**< The size of the free block. */
+    #if ( configUSE_HEAP_PROFILER == 1 )
+        UBaseType_t uxTaskUsageIndex;      /**< The entry of xTaskUsage[] the owner of an allocated block is accounted in. */
+        void * pvCaller;                   /**< The call site that allocated the block. */
+    #endif
+    #if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+        void * pvOwner;                    /**< The task an allocated block is charged to, or NULL. */
+    #endif
 } BlockLink_t;
 
 /* Setting configENABLE_HEAP_PROTECTOR to 1 enables heap block pointers
@@ -130,11 +160,58 @@ typedef struct A_BLOCK_LINK
 
 #endif /* configENABLE_HEAP_PROTECTOR */
 
+/* Evaluates to pdFALSE if charging xBytes more to pvOwner would take it over
+ * its heap quota. */
+#if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+    #define heapQUOTA_ALLOWS( pvOwner, xBytes )    xTaskHeapQuotaAllows( ( pvOwner ), ( xBytes ) )
+#else
+    #define heapQUOTA_ALLOWS( pvOwner, xBytes )    pdTRUE
+#endif
+
 /* Assert that a heap block pointer is within the heap bounds. */
 #define heapVALIDATE_BLOCK_POINTER( pxBlock )                          \
     configASSERT( ( ( uint8_t * ) ( pxBlock ) >= &( ucHeap[ 0 ] ) ) && \
                   ( ( uint8_t * ) ( pxBlock ) <= &( ucHeap[ configTOTAL_HEAP_SIZE - 1 ] ) ) )
 
+#if ( configUSE_CORE_LOCAL_SUSPEND == 1 )
+
+/* Only the calling core stops switching tasks while it uses the heap, and the
+ * other cores are kept out by ulHeapLock.  The holder of the lock cannot be
+ * switched out, so a core waiting for it only spins for as long as one heap
+ * operation takes. */
+    #define heapLOCK()      prvHeapLock()
+    #define heapUNLOCK()    prvHeapUnlock()
+#else
+    #define heapLOCK()      vTaskSuspendAll()
+    #define heapUNLOCK()    ( void ) xTaskResumeAll()
+#endif /* configUSE_CORE_LOCAL_SUSPEND */
+
+#if ( configUSE_HEAP_STARTUP_MODE == 1 )
+
+/* Nothing can preempt the heap before the scheduler has started, so the
+ * scheduler is only suspended once it is running.  The scheduler cannot start
+ * part way through a heap operation, so heapRESUME_ALL() always matches the
+ * preceding heapSUSPEND_ALL(). */
+    #define heapSUSPEND_ALL()                       \
+    do {                                            \
+        if( prvHeapSchedulerStarted() != pdFALSE )  \
+        {                                           \
+            heapLOCK();                             \
+        }                                           \
+    } while( 0 )
+
+    #define heapRESUME_ALL()                        \
+    do {                                            \
+        if( xHeapSchedulerStarted != pdFALSE )      \
+        {                                           \
+            heapUNLOCK();                           \
+        }                                           \
+    } while( 0 )
+#else
+    #define heapSUSPEND_ALL()    heapLOCK()
+    #define heapRESUME_ALL()     heapUNLOCK()
+#endif /* configUSE_HEAP_STARTUP_MODE */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -151,6 +228,139 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEG
  */
 static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Searches the list of free blocks for a block of at least xWantedSize bytes
+ * using the policy selected by configHEAP_ALLOCATION_POLICY.  Returns the block
+ * with the block that precedes it in the list in *ppxPreviousBlock, or pxEnd if
+ * no block is large enough.  Must be called with the scheduler suspended.
+ */
+static BlockLink_t * prvFindFreeBlock( size_t xWantedSize,
+                                       BlockLink_t ** ppxPreviousBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the size of the block needed to hold xWantedSize bytes, including the
+ * BlockLink_t structure and alignment padding, or 0 if xWantedSize is 0 or the
+ * size would overflow.
+ */
+static size_t prvGetBlockSize( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_CORE_LOCAL_SUSPEND == 1 )
+
+/*
+ * Stop task switches on the calling core, then take ulHeapLock to keep the
+ * other cores out of the heap.  Used in place of vTaskSuspendAll() so the
+ * other cores can carry on scheduling while the heap is in use.
+ */
+    static void prvHeapLock( void ) PRIVILEGED_FUNCTION;
+    static void prvHeapUnlock( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_HEAP_STARTUP_MODE == 1 )
+
+/*
+ * Returns pdTRUE once the scheduler has started.  The result is remembered so
+ * only calls made before the scheduler starts need to query the scheduler.
+ */
+    static BaseType_t prvHeapSchedulerStarted( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configSUPPORT_HEAP_REALLOC == 1 ) || ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 ) )
+
+/*
+ * Shrinks an allocated block to xBlockSize bytes, returning the end of the
+ * block to the list of free blocks if it is large enough to be worth
+ * splitting off.  Must be called with the scheduler suspended.
+ */
+    static void prvTrimAllocatedBlock( BlockLink_t * pxBlock,
+                                       size_t xBlockSize ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_TASK_ALLOCATION_CACHE == 1 )
+
+/* Requests of up to heapCACHE_LARGEST_CLASS_SIZE bytes are rounded up to the
+ * size of their class - heapCACHE_SMALLEST_CLASS_SIZE doubled once for each
+ * class above the first - so a block in a task's allocation cache can be reused
+ * for any request of its class without searching the list of free blocks. */
+    #define heapCACHE_SMALLEST_CLASS_SIZE    ( ( size_t ) 16 )
+    #define heapCACHE_LARGEST_CLASS_SIZE     ( heapCACHE_SMALLEST_CLASS_SIZE << ( tskALLOCATION_CACHE_SIZE_CLASSES - 1U ) )
+
+/*
+ * Return the size class a block with xUsableSize bytes after its BlockLink_t
+ * structure is cached in, or tskALLOCATION_CACHE_SIZE_CLASSES if the block is
+ * too small or too large to be cached.
+ */
+    static UBaseType_t prvGetCacheSizeClass( size_t xUsableSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * The heap allocation and free used when the calling task's allocation cache
+ * cannot be used.
+ */
+    static void * prvAllocateFromHeap( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+    static void prvFreeToHeap( void * pv ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_ALLOCATION_CACHE */
+
+#if ( configUSE_HEAP_COMPACTION == 1 )
+
+/* Movable blocks are allocated and freed directly from the heap, bypassing any
+ * task allocation cache. */
+    #if ( configUSE_TASK_ALLOCATION_CACHE == 1 )
+        #define heapMALLOC_MOVABLE( xWantedSize )    prvAllocateFromHeap( xWantedSize )
+        #define heapFREE_MOVABLE( pv )               prvFreeToHeap( pv )
+    #else
+        #define heapMALLOC_MOVABLE( xWantedSize )    pvPortMalloc( xWantedSize )
+        #define heapFREE_MOVABLE( pv )               vPortFree( pv )
+    #endif
+
+/* Assert that a movable block handle is one of the entries of xMovableBlocks[]
+ * and is in use. */
+    #define heapVALIDATE_MOVABLE_HANDLE( pxMovable )                                        \
+    configASSERT( ( ( pxMovable ) >= &( xMovableBlocks[ 0 ] ) ) &&                          \
+                  ( ( pxMovable ) < &( xMovableBlocks[ configHEAP_MOVABLE_BLOCKS ] ) ) &&   \
+                  ( ( pxMovable )->pxBlock != NULL ) )
+
+/*
+ * Moves the first unlocked movable block that follows a free block down to the
+ * start of the free block, so the free block moves up the heap where it can
+ * merge with the free block after it.  Returns the size of the block moved, or
+ * 0 if there was no block to move.  Must be called with the scheduler
+ * suspended.
+ */
+    static size_t prvMoveMovableBlock( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_HEAP_COMPACTION */
+
+#if ( configUSE_HEAP_PROFILER == 1 )
+
+/* The entry of xTaskUsage[] that accounts for blocks allocated before the
+ * scheduler started, and for tasks that do not fit in the other entries. */
+    #define heapPROFILER_SHARED_ENTRY    ( ( UBaseType_t ) configHEAP_PROFILER_MAX_TASKS )
+
+/* Record the call site in a block that has just been allocated.  This must be
+ * expanded in pvPortMalloc() itself so configHEAP_PROFILER_CALLER_ADDRESS()
+ * sees pvPortMalloc()'s caller.  The block belongs to the caller so the heap
+ * does not need to be locked. */
+    #define heapRECORD_CALLER( pv )                                                                    \
+    do {                                                                                               \
+        if( ( pv ) != NULL )                                                                           \
+        {                                                                                              \
+            ( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pv ) ) - xHeapStructSize ) )->pvCaller = configHEAP_PROFILER_CALLER_ADDRESS(); \
+        }                                                                                              \
+    } while( 0 )
+
+/*
+ * Account a block that has just been allocated to the calling task, and a block
+ * that is being freed to the task that allocated it.  Must be called with the
+ * scheduler suspended.
+ */
+    static void prvRecordAllocation( BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+    static void prvRecordFree( const BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_HEAP_PROFILER */
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -168,49 +378,96 @@ PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
 PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = ( size_t ) 0U;
 PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = ( size_t ) 0U;
 
+#if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+
+/* The free block after which the next search starts, or NULL to start from
+ * xStart. */
+    PRIVILEGED_DATA static BlockLink_t * pxNextFitStart = NULL;
+
+#endif
+
+#if ( configUSE_HEAP_STARTUP_MODE == 1 )
+
+/* Set to pdTRUE the first time the heap finds the scheduler running. */
+    PRIVILEGED_DATA static BaseType_t xHeapSchedulerStarted = pdFALSE;
+
+#endif
+
+#if ( configUSE_CORE_LOCAL_SUSPEND == 1 )
+
+/* 1 while a core is using the heap, otherwise 0. */
+    PRIVILEGED_DATA static volatile uint32_t ulHeapLock = 0U;
+
+#endif
+
+#if ( configUSE_HEAP_COMPACTION == 1 )
+
+/* The block a movable block handle refers to, and the number of times it has
+ * been locked in place.  pxBlock is NULL for unused entries. */
+    typedef struct HeapMovableBlockDefinition
+    {
+        BlockLink_t * pxBlock;
+        UBaseType_t uxLockCount;
+    } HeapMovableBlock_t;
+
+/* The entries that HeapMovableHandle_t handles point to. */
+    PRIVILEGED_DATA static HeapMovableBlock_t xMovableBlocks[ configHEAP_MOVABLE_BLOCKS ];
+
+#endif /* configUSE_HEAP_COMPACTION */
+
+#if ( ( configUSE_HEAP_PROFILER == 1 ) || ( configUSE_TASK_HEAP_QUOTAS == 1 ) )
+
+/* The first block in the heap, from which the blocks can be walked in address
+ * order. */
+    PRIVILEGED_DATA static BlockLink_t * pxFirstBlock = NULL;
+
+#endif
+
+#if ( configUSE_HEAP_PROFILER == 1 )
+
+/* The heap usage of up to configHEAP_PROFILER_MAX_TASKS tasks, followed by the
+ * shared entry. */
+    PRIVILEGED_DATA static HeapTaskUsage_t xTaskUsage[ configHEAP_PROFILER_MAX_TASKS + 1 ];
+
+#endif /* configUSE_HEAP_PROFILER */
+
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_ALLOCATION_CACHE == 1 )
+
 void * pvPortMalloc( size_t xWantedSize )
 {
-    BlockLink_t * pxBlock;
-    BlockLink_t * pxPreviousBlock;
-    BlockLink_t * pxNewBlockLink;
     void * pvReturn = NULL;
-    size_t xAdditionalRequiredSize;
-    size_t xAllocatedBlockSize = 0;
+    BlockLink_t * pxLink;
+    UBaseType_t uxSizeClass;
 
-    if( xWantedSize > 0 )
+    if( ( xWantedSize > 0 ) && ( xWantedSize <= heapCACHE_LARGEST_CLASS_SIZE ) )
     {
-        /* The wanted size must be increased so it can contain a BlockLink_t
-         * structure in addition to the requested amount of bytes. */
-        if( heapADD_WILL_OVERFLOW( xWantedSize, xHeapStructSize ) == 0 )
+        for( uxSizeClass = 0U; ( heapCACHE_SMALLEST_CLASS_SIZE << uxSizeClass ) < xWantedSize; uxSizeClass++ )
         {
-            xWantedSize += xHeapStructSize;
+            /* Nothing to do here, just iterate to the right size class. */
+        }
 
-            /* Ensure that blocks are always aligned to the required number
-             * of bytes. */
-            if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
-            {
-                /* Byte alignment required. */
-                xAdditionalRequiredSize = portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK );
+        /* Round the request up to the size of its class even if the block
+         * does not come from the cache, so it can be cached once it is
+         * freed. */
+        xWantedSize = heapCACHE_SMALLEST_CLASS_SIZE << uxSizeClass;
+        pvReturn = pvTaskTakeCachedAllocation( uxSizeClass );
 
-                if( heapADD_WILL_OVERFLOW( xWantedSize, xAdditionalRequiredSize ) == 0 )
-                {
-                    xWantedSize += xAdditionalRequiredSize;
-                }
-                else
-                {
-                    xWantedSize = 0;
-                }
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+        if( pvReturn != NULL )
+        {
+            pxLink = ( void * ) ( ( ( uint8_t * ) pvReturn ) - xHeapStructSize );
+            heapVALIDATE_BLOCK_POINTER( pxLink );
+            configASSERT( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( pxLink ) );
+
+            /* The block is owned by the application again and has no "next"
+             * block. */
+            pxLink->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+            traceMALLOC( pvReturn, pxLink->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK );
         }
         else
         {
-            xWantedSize = 0;
+            mtCOVERAGE_TEST_MARKER();
         }
     }
     else
@@ -218,7 +475,39 @@ void * pvPortMalloc( size_t xWantedSize )
         mtCOVERAGE_TEST_MARKER();
     }
 
-    vTaskSuspendAll();
+    if( pvReturn == NULL )
+    {
+        pvReturn = prvAllocateFromHeap( xWantedSize );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    #if ( configUSE_HEAP_PROFILER == 1 )
+    {
+        heapRECORD_CALLER( pvReturn );
+    }
+    #endif
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void * prvAllocateFromHeap( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+#else /* if ( configUSE_TASK_ALLOCATION_CACHE == 1 ) */
+void * pvPortMalloc( size_t xWantedSize )
+#endif /* if ( configUSE_TASK_ALLOCATION_CACHE == 1 ) */
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxPreviousBlock;
+    BlockLink_t * pxNewBlockLink;
+    void * pvReturn = NULL;
+    size_t xAllocatedBlockSize = 0;
+
+    xWantedSize = prvGetBlockSize( xWantedSize );
+
+    heapSUSPEND_ALL();
     {
         /* If this is the first call to malloc then the heap will require
          * initialisation to setup the list of free blocks. */
@@ -237,20 +526,11 @@ void * pvPortMalloc( size_t xWantedSize )
          * the kernel, so it must be free. */
         if( heapBLOCK_SIZE_IS_VALID( xWantedSize ) != 0 )
         {
-            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            if( ( xWantedSize > 0 ) &&
+                ( xWantedSize <= xFreeBytesRemaining ) &&
+                ( heapQUOTA_ALLOWS( pvTaskHeapOwner(), xWantedSize ) != pdFALSE ) )
             {
-                /* Traverse the list from the start (lowest address) block until
-                 * one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
-                heapVALIDATE_BLOCK_POINTER( pxBlock );
-
-                while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != heapPROTECT_BLOCK_POINTER( NULL ) ) )
-                {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
-                    heapVALIDATE_BLOCK_POINTER( pxBlock );
-                }
+                pxBlock = prvFindFreeBlock( xWantedSize, &pxPreviousBlock );
 
                 /* If the end marker was reached then a block of adequate size
                  * was not found. */
@@ -310,6 +590,19 @@ void * pvPortMalloc( size_t xWantedSize )
                     heapALLOCATE_BLOCK( pxBlock );
                     pxBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
                     xNumberOfSuccessfulAllocations++;
+
+                    #if ( configUSE_HEAP_PROFILER == 1 )
+                    {
+                        prvRecordAllocation( pxBlock );
+                    }
+                    #endif
+
+                    #if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+                    {
+                        pxBlock->pvOwner = pvTaskHeapOwner();
+                        vTaskHeapCharge( pxBlock->pvOwner, xAllocatedBlockSize );
+                    }
+                    #endif
                 }
                 else
                 {
@@ -331,7 +624,7 @@ void * pvPortMalloc( size_t xWantedSize )
         /* Prevent compiler warnings when trace macros are not used. */
         ( void ) xAllocatedBlockSize;
     }
-    ( void ) xTaskResumeAll();
+    heapRESUME_ALL();
 
     #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
     {
@@ -346,12 +639,132 @@ void * pvPortMalloc( size_t xWantedSize )
     }
     #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
 
+    #if ( ( configUSE_HEAP_PROFILER == 1 ) && ( configUSE_TASK_ALLOCATION_CACHE == 0 ) )
+    {
+        /* When task allocation caches are used pvPortMalloc() records the
+         * caller instead. */
+        heapRECORD_CALLER( pvReturn );
+    }
+    #endif
+
     configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
     return pvReturn;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_ALLOCATION_CACHE == 1 )
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+    UBaseType_t uxSizeClass;
+    size_t xBlockSize;
+    BaseType_t xCached = pdFALSE;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have an BlockLink_t structure immediately
+         * before it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        heapVALIDATE_BLOCK_POINTER( pxLink );
+
+        /* A block that is not allocated is left for prvFreeToHeap() to catch. */
+        if( ( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 ) && ( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( NULL ) ) )
+        {
+            xBlockSize = pxLink->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+            uxSizeClass = prvGetCacheSizeClass( xBlockSize - xHeapStructSize );
+
+            if( uxSizeClass < tskALLOCATION_CACHE_SIZE_CLASSES )
+            {
+                /* A cached block remains allocated as far as the heap is
+                 * concerned.  Pointing its link at itself marks it as cached,
+                 * so freeing it again is still caught. */
+                pxLink->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxLink );
+                xCached = xTaskCacheAllocation( uxSizeClass, pv );
+
+                if( xCached != pdFALSE )
+                {
+                    #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+                    {
+                        ( void ) memset( pv, 0, xBlockSize - xHeapStructSize );
+                    }
+                    #endif
+
+                    traceFREE( pv, xBlockSize );
+                }
+                else
+                {
+                    pxLink->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    if( xCached == pdFALSE )
+    {
+        prvFreeToHeap( pv );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortFreeCachedAllocation( void * pv )
+{
+    BlockLink_t * pxLink = ( void * ) ( ( ( uint8_t * ) pv ) - xHeapStructSize );
+
+    heapVALIDATE_BLOCK_POINTER( pxLink );
+    configASSERT( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( pxLink ) );
+
+    /* Clear the cached mark so the block is freed as a normal allocated
+     * block.  Its free has already been traced. */
+    pxLink->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+    prvFreeToHeap( pv );
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetCacheSizeClass( size_t xUsableSize ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxSizeClass = tskALLOCATION_CACHE_SIZE_CLASSES;
+
+    /* A block may be larger than its class when it was not worth splitting,
+     * so the largest class a block can hold is the one it is cached in.
+     * Blocks over twice the size of the largest class are not cached. */
+    if( ( xUsableSize >= heapCACHE_SMALLEST_CLASS_SIZE ) && ( xUsableSize < ( heapCACHE_LARGEST_CLASS_SIZE << 1 ) ) )
+    {
+        for( uxSizeClass = tskALLOCATION_CACHE_SIZE_CLASSES - 1U; xUsableSize < ( heapCACHE_SMALLEST_CLASS_SIZE << uxSizeClass ); uxSizeClass-- )
+        {
+            /* Nothing to do here, just iterate to the right size class. */
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return uxSizeClass;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFreeToHeap( void * pv ) /* PRIVILEGED_FUNCTION */
+#else /* if ( configUSE_TASK_ALLOCATION_CACHE == 1 ) */
 void vPortFree( void * pv )
+#endif /* if ( configUSE_TASK_ALLOCATION_CACHE == 1 ) */
 {
     uint8_t * puc = ( uint8_t * ) pv;
     BlockLink_t * pxLink;
@@ -387,15 +800,30 @@ void vPortFree( void * pv )
                 }
                 #endif
 
-                vTaskSuspendAll();
+                heapSUSPEND_ALL();
                 {
                     /* Add this block to the list of free blocks. */
                     xFreeBytesRemaining += pxLink->xBlockSize;
                     traceFREE( pv, pxLink->xBlockSize );
+
+                    #if ( configUSE_HEAP_PROFILER == 1 )
+                    {
+                        /* Before the block can be merged with its
+                         * neighbours. */
+                        prvRecordFree( pxLink );
+                    }
+                    #endif
+
+                    #if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+                    {
+                        vTaskHeapRefund( pxLink->pvOwner, pxLink->xBlockSize );
+                    }
+                    #endif
+
                     prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
                     xNumberOfSuccessfulFrees++;
                 }
-                ( void ) xTaskResumeAll();
+                heapRESUME_ALL();
             }
             else
             {
@@ -453,54 +881,775 @@ void * pvPortCalloc( size_t xNum,
 }
 /*-----------------------------------------------------------*/
 
-static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
-{
-    BlockLink_t * pxFirstFreeBlock;
-    portPOINTER_SIZE_TYPE uxStartAddress, uxEndAddress;
-    size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+#if ( configSUPPORT_HEAP_REALLOC == 1 )
 
-    /* Ensure the heap starts on a correctly aligned boundary. */
-    uxStartAddress = ( portPOINTER_SIZE_TYPE ) ucHeap;
+void * pvPortRealloc( void * pv,
+                      size_t xWantedSize )
+{
+    void * pvReturn = NULL;
+    BlockLink_t * pxLink;
+    BlockLink_t * pxNextBlock;
+    BlockLink_t * pxIterator;
+    size_t xBlockSize;
+    size_t xRequiredSize;
 
-    if( ( uxStartAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    if( pv == NULL )
     {
-        uxStartAddress += ( portBYTE_ALIGNMENT - 1 );
-        uxStartAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
-        xTotalHeapSize -= ( size_t ) ( uxStartAddress - ( portPOINTER_SIZE_TYPE ) ucHeap );
+        pvReturn = pvPortMalloc( xWantedSize );
     }
-
-    #if ( configENABLE_HEAP_PROTECTOR == 1 )
+    else if( xWantedSize == ( size_t ) 0 )
     {
-        vApplicationGetRandomHeapCanary( &( xHeapCanary ) );
+        vPortFree( pv );
     }
-    #endif
+    else
+    {
+        /* The memory being resized will have an BlockLink_t structure
+         * immediately before it. */
+        pxLink = ( void * ) ( ( ( uint8_t * ) pv ) - xHeapStructSize );
+
+        heapVALIDATE_BLOCK_POINTER( pxLink );
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
+        configASSERT( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( NULL ) );
+
+        xRequiredSize = prvGetBlockSize( xWantedSize );
+        xBlockSize = pxLink->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+
+        if( ( xRequiredSize > 0 ) && ( heapBLOCK_SIZE_IS_VALID( xRequiredSize ) != 0 ) )
+        {
+            heapSUSPEND_ALL();
+            {
+                if( xRequiredSize <= xBlockSize )
+                {
+                    /* The block is already large enough, so any space that is
+                     * no longer needed is given back. */
+                    prvTrimAllocatedBlock( pxLink, xRequiredSize );
+                    pvReturn = pv;
+                }
+                else
+                {
+                    /* The block can grow in place if the block that follows it
+                     * is free and the two together are large enough. */
+                    pxNextBlock = ( void * ) ( ( ( uint8_t * ) pxLink ) + xBlockSize );
+                    heapVALIDATE_BLOCK_POINTER( pxNextBlock );
+
+                    if( ( pxNextBlock != pxEnd ) &&
+                        ( heapBLOCK_IS_ALLOCATED( pxNextBlock ) == 0 ) &&
+                        ( ( xRequiredSize - xBlockSize ) <= pxNextBlock->xBlockSize ) &&
+                        ( heapQUOTA_ALLOWS( pxLink->pvOwner, xRequiredSize - xBlockSize ) != pdFALSE ) )
+                    {
+                        /* Find the free block that comes before the following
+                         * block in the list so it can be taken out. */
+                        for( pxIterator = &xStart; heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) < pxNextBlock; pxIterator = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) )
+                        {
+                            /* Nothing to do here, just iterate to the right position. */
+                        }
+
+                        configASSERT( heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) == pxNextBlock );
+
+                        pxIterator->pxNextFreeBlock = pxNextBlock->pxNextFreeBlock;
+
+                        #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+                        {
+                            if( pxNextFitStart == pxNextBlock )
+                            {
+                                pxNextFitStart = pxIterator;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        #endif /* configHEAP_ALLOCATION_POLICY */
+
+                        xFreeBytesRemaining -= pxNextBlock->xBlockSize;
+
+                        if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                        {
+                            xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        #if ( configUSE_HEAP_PROFILER == 1 )
+                        {
+                            HeapTaskUsage_t * const pxUsage = &( xTaskUsage[ pxLink->uxTaskUsageIndex ] );
+
+                            pxUsage->xCurrentBytes += pxNextBlock->xBlockSize;
+
+                            if( pxUsage->xCurrentBytes > pxUsage->xPeakBytes )
+                            {
+                                pxUsage->xPeakBytes = pxUsage->xCurrentBytes;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        #endif
+
+                        #if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+                        {
+                            /* The block stays charged to the task that
+                             * allocated it, whichever task resizes it. */
+                            vTaskHeapCharge( pxLink->pvOwner, pxNextBlock->xBlockSize );
+                        }
+                        #endif
+
+                        /* The two blocks become one, which is then trimmed back
+                         * to the size required. */
+                        pxLink->xBlockSize = xBlockSize + pxNextBlock->xBlockSize;
+                        heapALLOCATE_BLOCK( pxLink );
+                        prvTrimAllocatedBlock( pxLink, xRequiredSize );
+                        pvReturn = pv;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            heapRESUME_ALL();
+
+            if( pvReturn == NULL )
+            {
+                /* The block could not be resized in place, so it is moved.  The
+                 * original block is left untouched if that fails. */
+                pvReturn = pvPortMalloc( xWantedSize );
+
+                if( pvReturn != NULL )
+                {
+                    ( void ) memcpy( pvReturn, pv, ( xWantedSize < ( xBlockSize - xHeapStructSize ) ) ? xWantedSize : ( xBlockSize - xHeapStructSize ) );
+                    vPortFree( pv );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return pvReturn;
+}
+
+#endif /* configSUPPORT_HEAP_REALLOC */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 )
+
+void * pvPortMallocAligned( size_t xWantedSize,
+                            size_t xAlignment )
+{
+    void * pvReturn = NULL;
+    BlockLink_t * pxLink;
+    BlockLink_t * pxAlignedLink;
+    portPOINTER_SIZE_TYPE uxAddress;
+    size_t xPadding;
+
+    /* The alignment must be a power of two. */
+    configASSERT( ( xAlignment != ( size_t ) 0 ) && ( ( xAlignment & ( xAlignment - ( size_t ) 1 ) ) == ( size_t ) 0 ) );
+
+    if( xAlignment <= ( size_t ) portBYTE_ALIGNMENT )
+    {
+        pvReturn = pvPortMalloc( xWantedSize );
+    }
+    else if( ( prvGetBlockSize( xWantedSize ) > 0 ) &&
+             ( heapADD_WILL_OVERFLOW( xWantedSize, xAlignment + heapMINIMUM_BLOCK_SIZE ) == 0 ) )
+    {
+        /* Allocate enough to leave room for a free block in front of the
+         * aligned address, then give back whatever is not needed at either end
+         * of the block. */
+        pvReturn = pvPortMalloc( xWantedSize + xAlignment + heapMINIMUM_BLOCK_SIZE );
+
+        if( pvReturn != NULL )
+        {
+            heapSUSPEND_ALL();
+            {
+                pxLink = ( void * ) ( ( ( uint8_t * ) pvReturn ) - xHeapStructSize );
+                uxAddress = ( portPOINTER_SIZE_TYPE ) pvReturn;
+
+                if( ( uxAddress & ( portPOINTER_SIZE_TYPE ) ( xAlignment - ( size_t ) 1 ) ) != 0 )
+                {
+                    /* The padding in front of the aligned address is made large
+                     * enough to be a free block of its own. */
+                    uxAddress += ( portPOINTER_SIZE_TYPE ) ( heapMINIMUM_BLOCK_SIZE + ( xAlignment - ( size_t ) 1 ) );
+                    uxAddress &= ~( ( portPOINTER_SIZE_TYPE ) ( xAlignment - ( size_t ) 1 ) );
+                    xPadding = ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pvReturn );
+
+                    pxAlignedLink = ( void * ) ( ( ( uint8_t * ) pxLink ) + xPadding );
+                    pxAlignedLink->xBlockSize = ( pxLink->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK ) - xPadding;
+                    heapALLOCATE_BLOCK( pxAlignedLink );
+                    pxAlignedLink->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+
+                    #if ( configUSE_HEAP_PROFILER == 1 )
+                    {
+                        pxAlignedLink->uxTaskUsageIndex = pxLink->uxTaskUsageIndex;
+                        xTaskUsage[ pxLink->uxTaskUsageIndex ].xCurrentBytes -= xPadding;
+                    }
+                    #endif
+
+                    #if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+                    {
+                        pxAlignedLink->pvOwner = pxLink->pvOwner;
+                        vTaskHeapRefund( pxLink->pvOwner, xPadding );
+                    }
+                    #endif
+
+                    /* The padding is returned to the list of free blocks. */
+                    pxLink->xBlockSize = xPadding;
+                    xFreeBytesRemaining += xPadding;
+                    prvInsertBlockIntoFreeList( pxLink );
+
+                    pxLink = pxAlignedLink;
+                    pvReturn = ( void * ) uxAddress;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvTrimAllocatedBlock( pxLink, prvGetBlockSize( xWantedSize ) );
+            }
+            heapRESUME_ALL();
+
+            #if ( configUSE_HEAP_PROFILER == 1 )
+            {
+                heapRECORD_CALLER( pvReturn );
+            }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pvReturn ) & ( portPOINTER_SIZE_TYPE ) ( xAlignment - ( size_t ) 1 ) ) == 0 );
+    return pvReturn;
+}
+
+#endif /* configSUPPORT_HEAP_ALIGNED_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_COMPACTION == 1 )
+
+HeapMovableHandle_t xPortMallocMovable( size_t xWantedSize )
+{
+    HeapMovableBlock_t * pxReturn = NULL;
+    void * pv;
+    UBaseType_t uxIndex;
+
+    pv = heapMALLOC_MOVABLE( xWantedSize );
+
+    if( pv != NULL )
+    {
+        heapSUSPEND_ALL();
+        {
+            for( uxIndex = 0; uxIndex < ( UBaseType_t ) configHEAP_MOVABLE_BLOCKS; uxIndex++ )
+            {
+                if( xMovableBlocks[ uxIndex ].pxBlock == NULL )
+                {
+                    pxReturn = &( xMovableBlocks[ uxIndex ] );
+                    pxReturn->pxBlock = ( BlockLink_t * ) ( ( ( uint8_t * ) pv ) - xHeapStructSize );
+                    pxReturn->uxLockCount = ( UBaseType_t ) 0U;
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        heapRESUME_ALL();
+
+        if( pxReturn == NULL )
+        {
+            /* All the handles are in use. */
+            heapFREE_MOVABLE( pv );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFreeMovable( HeapMovableHandle_t xHandle )
+{
+    HeapMovableBlock_t * const pxMovable = xHandle;
+    void * pv = NULL;
+
+    if( pxMovable != NULL )
+    {
+        heapSUSPEND_ALL();
+        {
+            heapVALIDATE_MOVABLE_HANDLE( pxMovable );
+            configASSERT( pxMovable->uxLockCount == ( UBaseType_t ) 0U );
+
+            /* Once the handle is released the block can no longer be moved, so
+             * it can be freed outside of the heap lock like any other. */
+            pv = ( void * ) ( ( ( uint8_t * ) pxMovable->pxBlock ) + xHeapStructSize );
+            pxMovable->pxBlock = NULL;
+        }
+        heapRESUME_ALL();
+
+        heapFREE_MOVABLE( pv );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortLockMovable( HeapMovableHandle_t xHandle )
+{
+    HeapMovableBlock_t * const pxMovable = xHandle;
+    void * pvReturn;
+
+    heapSUSPEND_ALL();
+    {
+        heapVALIDATE_MOVABLE_HANDLE( pxMovable );
+
+        ( pxMovable->uxLockCount )++;
+        pvReturn = ( void * ) ( ( ( uint8_t * ) pxMovable->pxBlock ) + xHeapStructSize );
+    }
+    heapRESUME_ALL();
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortUnlockMovable( HeapMovableHandle_t xHandle )
+{
+    HeapMovableBlock_t * const pxMovable = xHandle;
+
+    heapSUSPEND_ALL();
+    {
+        heapVALIDATE_MOVABLE_HANDLE( pxMovable );
+        configASSERT( pxMovable->uxLockCount > ( UBaseType_t ) 0U );
+
+        ( pxMovable->uxLockCount )--;
+    }
+    heapRESUME_ALL();
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortCompactHeap( size_t xMaxBytesToMove )
+{
+    size_t xBytesMoved = 0;
+    size_t xBlockSize;
+
+    do
+    {
+        /* The heap is only locked while one block is moved, so the time for
+         * which tasks are held off is bounded by the largest movable block
+         * rather than by xMaxBytesToMove. */
+        heapSUSPEND_ALL();
+        {
+            if( pxEnd != NULL )
+            {
+                xBlockSize = prvMoveMovableBlock();
+            }
+            else
+            {
+                /* The heap has not been initialised, so has nothing to move. */
+                xBlockSize = 0;
+            }
+        }
+        heapRESUME_ALL();
+
+        xBytesMoved += xBlockSize;
+    } while( ( xBlockSize > ( size_t ) 0 ) && ( xBytesMoved < xMaxBytesToMove ) );
+
+    return xBytesMoved;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvMoveMovableBlock( void ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxPreviousBlock = &xStart;
+    BlockLink_t * pxFreeBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
+    BlockLink_t * pxNextBlock = NULL;
+    BlockLink_t * pxNewFreeBlock;
+    HeapMovableBlock_t * pxMovable = NULL;
+    UBaseType_t uxIndex;
+    size_t xFreeBlockSize;
+    size_t xMovedBlockSize = 0;
+
+    /* Free blocks are held in address order and are always merged with any
+     * free neighbours, so the block that follows a free block in memory is
+     * either allocated or pxEnd.  Find the lowest free block followed by an
+     * unlocked movable block. */
+    while( ( pxFreeBlock != pxEnd ) && ( pxMovable == NULL ) )
+    {
+        heapVALIDATE_BLOCK_POINTER( pxFreeBlock );
+        pxNextBlock = ( BlockLink_t * ) ( ( ( uint8_t * ) pxFreeBlock ) + pxFreeBlock->xBlockSize );
+
+        for( uxIndex = 0; uxIndex < ( UBaseType_t ) configHEAP_MOVABLE_BLOCKS; uxIndex++ )
+        {
+            if( ( xMovableBlocks[ uxIndex ].pxBlock == pxNextBlock ) &&
+                ( xMovableBlocks[ uxIndex ].uxLockCount == ( UBaseType_t ) 0U ) )
+            {
+                pxMovable = &( xMovableBlocks[ uxIndex ] );
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( pxMovable == NULL )
+        {
+            pxPreviousBlock = pxFreeBlock;
+            pxFreeBlock = heapPROTECT_BLOCK_POINTER( pxFreeBlock->pxNextFreeBlock );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    if( pxMovable != NULL )
+    {
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxNextBlock ) != 0 );
+
+        xFreeBlockSize = pxFreeBlock->xBlockSize;
+        xMovedBlockSize = pxNextBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+
+        /* Take the free block out of the list, then slide the movable block,
+         * including its BlockLink_t structure, down over it. */
+        pxPreviousBlock->pxNextFreeBlock = pxFreeBlock->pxNextFreeBlock;
+
+        #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+        {
+            if( pxNextFitStart == pxFreeBlock )
+            {
+                pxNextFitStart = pxPreviousBlock;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configHEAP_ALLOCATION_POLICY */
+
+        ( void ) memmove( ( void * ) pxFreeBlock, ( void * ) pxNextBlock, xMovedBlockSize );
+        pxMovable->pxBlock = pxFreeBlock;
+
+        /* The free space now follows the block that was moved. */
+        pxNewFreeBlock = ( BlockLink_t * ) ( ( ( uint8_t * ) pxFreeBlock ) + xMovedBlockSize );
+        pxNewFreeBlock->xBlockSize = xFreeBlockSize;
+
+        #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+        {
+            ( void ) memset( ( ( uint8_t * ) pxNewFreeBlock ) + xHeapStructSize, 0, xFreeBlockSize - xHeapStructSize );
+        }
+        #endif
+
+        prvInsertBlockIntoFreeList( pxNewFreeBlock );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xMovedBlockSize;
+}
+
+#endif /* configUSE_HEAP_COMPACTION */
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxFirstFreeBlock;
+    portPOINTER_SIZE_TYPE uxStartAddress, uxEndAddress;
+    size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+
+    /* Ensure the heap starts on a correctly aligned boundary. */
+    uxStartAddress = ( portPOINTER_SIZE_TYPE ) ucHeap;
+
+    if( ( uxStartAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    {
+        uxStartAddress += ( portBYTE_ALIGNMENT - 1 );
+        uxStartAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+        xTotalHeapSize -= ( size_t ) ( uxStartAddress - ( portPOINTER_SIZE_TYPE ) ucHeap );
+    }
+
+    #if ( configENABLE_HEAP_PROTECTOR == 1 )
+    {
+        vApplicationGetRandomHeapCanary( &( xHeapCanary ) );
+    }
+    #endif
 
     /* xStart is used to hold a pointer to the first item in the list of free
      * blocks.  The void cast is used to prevent compiler warnings. */
     xStart.pxNextFreeBlock = ( void * ) heapPROTECT_BLOCK_POINTER( uxStartAddress );
     xStart.xBlockSize = ( size_t ) 0;
 
-    /* pxEnd is used to mark the end of the list of free blocks and is inserted
-     * at the end of the heap space. */
-    uxEndAddress = uxStartAddress + ( portPOINTER_SIZE_TYPE ) xTotalHeapSize;
-    uxEndAddress -= ( portPOINTER_SIZE_TYPE ) xHeapStructSize;
-    uxEndAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
-    pxEnd = ( BlockLink_t * ) uxEndAddress;
-    pxEnd->xBlockSize = 0;
-    pxEnd->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+    /* pxEnd is used to mark the end of the list of free blocks and is inserted
+     * at the end of the heap space. */
+    uxEndAddress = uxStartAddress + ( portPOINTER_SIZE_TYPE ) xTotalHeapSize;
+    uxEndAddress -= ( portPOINTER_SIZE_TYPE ) xHeapStructSize;
+    uxEndAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+    pxEnd = ( BlockLink_t * ) uxEndAddress;
+    pxEnd->xBlockSize = 0;
+    pxEnd->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+
+    /* To start with there is a single free block that is sized to take up the
+     * entire heap space, minus the space taken by pxEnd. */
+    pxFirstFreeBlock = ( BlockLink_t * ) uxStartAddress;
+    pxFirstFreeBlock->xBlockSize = ( size_t ) ( uxEndAddress - ( portPOINTER_SIZE_TYPE ) pxFirstFreeBlock );
+    pxFirstFreeBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxEnd );
+
+    #if ( ( configUSE_HEAP_PROFILER == 1 ) || ( configUSE_TASK_HEAP_QUOTAS == 1 ) )
+    {
+        pxFirstBlock = pxFirstFreeBlock;
+    }
+    #endif
+
+    /* Only one block exists - and it covers the entire usable heap space. */
+    xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+    xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvGetBlockSize( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+{
+    size_t xAdditionalRequiredSize;
+
+    if( xWantedSize > 0 )
+    {
+        /* The wanted size must be increased so it can contain a BlockLink_t
+         * structure in addition to the requested amount of bytes. */
+        if( heapADD_WILL_OVERFLOW( xWantedSize, xHeapStructSize ) == 0 )
+        {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned to the required number
+             * of bytes. */
+            if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+            {
+                /* Byte alignment required. */
+                xAdditionalRequiredSize = portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK );
+
+                if( heapADD_WILL_OVERFLOW( xWantedSize, xAdditionalRequiredSize ) == 0 )
+                {
+                    xWantedSize += xAdditionalRequiredSize;
+                }
+                else
+                {
+                    xWantedSize = 0;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xWantedSize = 0;
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xWantedSize;
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvFindFreeBlock( size_t xWantedSize,
+                                       BlockLink_t ** ppxPreviousBlock ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxPreviousBlock = &xStart;
+
+    #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_FIRST_FIT )
+    {
+        /* Traverse the list from the start (lowest address) block until one of
+         * adequate size is found. */
+        pxBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
+        heapVALIDATE_BLOCK_POINTER( pxBlock );
+
+        while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != heapPROTECT_BLOCK_POINTER( NULL ) ) )
+        {
+            pxPreviousBlock = pxBlock;
+            pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+            heapVALIDATE_BLOCK_POINTER( pxBlock );
+        }
+    }
+    #elif ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_BEST_FIT )
+    {
+        BlockLink_t * pxIterator;
+        BlockLink_t * pxIteratorPrevious = &xStart;
+
+        /* Traverse the whole list for the smallest block of adequate size,
+         * stopping early if one is found that fits exactly.  pxEnd has a size
+         * of zero so never fits. */
+        pxBlock = pxEnd;
+        pxIterator = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
+        heapVALIDATE_BLOCK_POINTER( pxIterator );
+
+        while( ( pxIterator != pxEnd ) && ( pxBlock->xBlockSize != xWantedSize ) )
+        {
+            if( ( pxIterator->xBlockSize >= xWantedSize ) &&
+                ( ( pxBlock == pxEnd ) || ( pxIterator->xBlockSize < pxBlock->xBlockSize ) ) )
+            {
+                pxBlock = pxIterator;
+                pxPreviousBlock = pxIteratorPrevious;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxIteratorPrevious = pxIterator;
+            pxIterator = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock );
+            heapVALIDATE_BLOCK_POINTER( pxIterator );
+        }
+    }
+    #else /* configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT */
+    {
+        BlockLink_t * const pxSearchStart = ( pxNextFitStart != NULL ) ? pxNextFitStart : &xStart;
+
+        /* Traverse the list from where the last search finished up to the end
+         * marker... */
+        pxPreviousBlock = pxSearchStart;
+        pxBlock = heapPROTECT_BLOCK_POINTER( pxSearchStart->pxNextFreeBlock );
+        heapVALIDATE_BLOCK_POINTER( pxBlock );
+
+        while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock != pxEnd ) )
+        {
+            pxPreviousBlock = pxBlock;
+            pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+            heapVALIDATE_BLOCK_POINTER( pxBlock );
+        }
+
+        /* ...then wrap around to the start (lowest address) block, up to and
+         * including the block the search started after. */
+        if( ( pxBlock == pxEnd ) && ( pxSearchStart != &xStart ) )
+        {
+            pxPreviousBlock = &xStart;
+            pxBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
+            heapVALIDATE_BLOCK_POINTER( pxBlock );
+
+            while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxPreviousBlock != pxSearchStart ) )
+            {
+                pxPreviousBlock = pxBlock;
+                pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+                heapVALIDATE_BLOCK_POINTER( pxBlock );
+            }
+
+            if( pxBlock->xBlockSize < xWantedSize )
+            {
+                pxBlock = pxEnd;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-    /* To start with there is a single free block that is sized to take up the
-     * entire heap space, minus the space taken by pxEnd. */
-    pxFirstFreeBlock = ( BlockLink_t * ) uxStartAddress;
-    pxFirstFreeBlock->xBlockSize = ( size_t ) ( uxEndAddress - ( portPOINTER_SIZE_TYPE ) pxFirstFreeBlock );
-    pxFirstFreeBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxEnd );
+        /* The block that precedes the allocated block stays in the list, so
+         * the next search starts from there. */
+        if( pxBlock != pxEnd )
+        {
+            pxNextFitStart = pxPreviousBlock;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configHEAP_ALLOCATION_POLICY */
 
-    /* Only one block exists - and it covers the entire usable heap space. */
-    xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
-    xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+    *ppxPreviousBlock = pxPreviousBlock;
+
+    return pxBlock;
 }
 /*-----------------------------------------------------------*/
 
+#if ( ( configSUPPORT_HEAP_REALLOC == 1 ) || ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 ) )
+
+    static void prvTrimAllocatedBlock( BlockLink_t * pxBlock,
+                                       size_t xBlockSize ) /* PRIVILEGED_FUNCTION */
+    {
+        BlockLink_t * pxNewBlockLink;
+        const size_t xCurrentBlockSize = pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+
+        configASSERT( xBlockSize <= xCurrentBlockSize );
+
+        if( ( xCurrentBlockSize - xBlockSize ) > heapMINIMUM_BLOCK_SIZE )
+        {
+            /* Create a new free block following the bytes that are kept.  The
+             * void cast is used to prevent byte alignment warnings from the
+             * compiler. */
+            pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xBlockSize );
+            configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+            pxNewBlockLink->xBlockSize = xCurrentBlockSize - xBlockSize;
+            pxBlock->xBlockSize = xBlockSize;
+            heapALLOCATE_BLOCK( pxBlock );
+
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                ( void ) memset( ( ( uint8_t * ) pxNewBlockLink ) + xHeapStructSize, 0, pxNewBlockLink->xBlockSize - xHeapStructSize );
+            }
+            #endif
+
+            #if ( configUSE_HEAP_PROFILER == 1 )
+            {
+                xTaskUsage[ pxBlock->uxTaskUsageIndex ].xCurrentBytes -= pxNewBlockLink->xBlockSize;
+            }
+            #endif
+
+            #if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+            {
+                vTaskHeapRefund( pxBlock->pvOwner, pxNewBlockLink->xBlockSize );
+            }
+            #endif
+
+            xFreeBytesRemaining += pxNewBlockLink->xBlockSize;
+            prvInsertBlockIntoFreeList( pxNewBlockLink );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* if ( ( configSUPPORT_HEAP_REALLOC == 1 ) || ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
 static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVILEGED_FUNCTION */
 {
     BlockLink_t * pxIterator;
@@ -540,6 +1689,21 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVI
     {
         if( heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) != pxEnd )
         {
+            #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+            {
+                /* The next search cannot start from a block that is about to
+                 * be merged into the block being inserted. */
+                if( pxNextFitStart == heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) )
+                {
+                    pxNextFitStart = pxBlockToInsert;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configHEAP_ALLOCATION_POLICY */
+
             /* Form one big block from the two blocks. */
             pxBlockToInsert->xBlockSize += heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock )->xBlockSize;
             pxBlockToInsert->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock )->pxNextFreeBlock;
@@ -574,7 +1738,7 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
     BlockLink_t * pxBlock;
     size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
 
-    vTaskSuspendAll();
+    heapSUSPEND_ALL();
     {
         pxBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
 
@@ -604,7 +1768,7 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
             }
         }
     }
-    ( void ) xTaskResumeAll();
+    heapRESUME_ALL();
 
     pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
     pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
@@ -621,6 +1785,292 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_HEAP_PROFILER == 1 )
+
+    static void prvRecordAllocation( BlockLink_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+    {
+        void * pvTask = NULL;
+        UBaseType_t uxEntry;
+        UBaseType_t uxIndex = heapPROFILER_SHARED_ENTRY;
+        UBaseType_t uxUnusedEntry = heapPROFILER_SHARED_ENTRY;
+        UBaseType_t uxIdleEntry = heapPROFILER_SHARED_ENTRY;
+        HeapTaskUsage_t * pxUsage;
+
+        if( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED )
+        {
+            pvTask = ( void * ) xTaskGetCurrentTaskHandle();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pvTask != NULL )
+        {
+            /* Find the task's entry, noting an entry that has never been used
+             * and an entry with nothing allocated in case there is none. */
+            for( uxEntry = 0U; ( uxEntry < heapPROFILER_SHARED_ENTRY ) && ( uxIndex == heapPROFILER_SHARED_ENTRY ); uxEntry++ )
+            {
+                if( xTaskUsage[ uxEntry ].pvTask == pvTask )
+                {
+                    uxIndex = uxEntry;
+                }
+                else if( ( xTaskUsage[ uxEntry ].pvTask == NULL ) && ( uxUnusedEntry == heapPROFILER_SHARED_ENTRY ) )
+                {
+                    uxUnusedEntry = uxEntry;
+                }
+                else if( ( xTaskUsage[ uxEntry ].xCurrentBytes == ( size_t ) 0U ) && ( uxIdleEntry == heapPROFILER_SHARED_ENTRY ) )
+                {
+                    uxIdleEntry = uxEntry;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            if( uxIndex == heapPROFILER_SHARED_ENTRY )
+            {
+                /* An entry that has nothing allocated may belong to a task that
+                 * has been deleted, so it is only taken over once every entry
+                 * has been used.  Otherwise the task shares the last entry. */
+                if( uxUnusedEntry != heapPROFILER_SHARED_ENTRY )
+                {
+                    uxIndex = uxUnusedEntry;
+                }
+                else
+                {
+                    uxIndex = uxIdleEntry;
+                }
+
+                if( uxIndex != heapPROFILER_SHARED_ENTRY )
+                {
+                    ( void ) memset( &( xTaskUsage[ uxIndex ] ), 0x00, sizeof( HeapTaskUsage_t ) );
+                    xTaskUsage[ uxIndex ].pvTask = pvTask;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxBlock->uxTaskUsageIndex = uxIndex;
+        pxBlock->pvCaller = NULL;
+
+        pxUsage = &( xTaskUsage[ uxIndex ] );
+        pxUsage->xCurrentBytes += pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+        pxUsage->xNumberOfAllocations++;
+
+        if( pxUsage->xCurrentBytes > pxUsage->xPeakBytes )
+        {
+            pxUsage->xPeakBytes = pxUsage->xCurrentBytes;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_HEAP_PROFILER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_PROFILER == 1 )
+
+    static void prvRecordFree( const BlockLink_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+    {
+        HeapTaskUsage_t * pxUsage;
+
+        configASSERT( pxBlock->uxTaskUsageIndex <= heapPROFILER_SHARED_ENTRY );
+
+        pxUsage = &( xTaskUsage[ pxBlock->uxTaskUsageIndex ] );
+        configASSERT( pxUsage->xCurrentBytes >= ( pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK ) );
+
+        pxUsage->xCurrentBytes -= pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+        pxUsage->xNumberOfFrees++;
+    }
+
+#endif /* configUSE_HEAP_PROFILER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_PROFILER == 1 )
+
+    UBaseType_t uxPortGetHeapTaskUsage( HeapTaskUsage_t * pxTaskUsage,
+                                        UBaseType_t uxArraySize )
+    {
+        UBaseType_t uxEntry;
+        UBaseType_t uxEntriesWritten = 0U;
+
+        heapSUSPEND_ALL();
+        {
+            for( uxEntry = 0U; ( uxEntry <= heapPROFILER_SHARED_ENTRY ) && ( uxEntriesWritten < uxArraySize ); uxEntry++ )
+            {
+                /* Leave out the entries that have never allocated anything. */
+                if( xTaskUsage[ uxEntry ].xNumberOfAllocations != ( size_t ) 0U )
+                {
+                    pxTaskUsage[ uxEntriesWritten ] = xTaskUsage[ uxEntry ];
+                    uxEntriesWritten++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        heapRESUME_ALL();
+
+        return uxEntriesWritten;
+    }
+
+#endif /* configUSE_HEAP_PROFILER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_PROFILER == 1 )
+
+    UBaseType_t uxPortGetHeapBlockMap( HeapBlockInfo_t * pxBlockInfo,
+                                       UBaseType_t uxArraySize )
+    {
+        BlockLink_t * pxBlock;
+        HeapBlockInfo_t * pxInfo;
+        UBaseType_t uxEntriesWritten = 0U;
+
+        heapSUSPEND_ALL();
+        {
+            /* pxFirstBlock will be NULL if the heap has not been initialised.
+             * Free and allocated blocks are contiguous from the first block up
+             * to the end marker, so each block follows on from the last. */
+            pxBlock = pxFirstBlock;
+
+            while( ( pxBlock != NULL ) && ( pxBlock != pxEnd ) && ( uxEntriesWritten < uxArraySize ) )
+            {
+                heapVALIDATE_BLOCK_POINTER( pxBlock );
+
+                pxInfo = &( pxBlockInfo[ uxEntriesWritten ] );
+                pxInfo->pvAddress = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+                pxInfo->xBlockSize = pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+
+                if( heapBLOCK_IS_ALLOCATED( pxBlock ) != 0 )
+                {
+                    configASSERT( pxBlock->uxTaskUsageIndex <= heapPROFILER_SHARED_ENTRY );
+                    pxInfo->xAllocated = pdTRUE;
+                    pxInfo->pvTask = xTaskUsage[ pxBlock->uxTaskUsageIndex ].pvTask;
+                    pxInfo->pvCaller = pxBlock->pvCaller;
+                }
+                else
+                {
+                    pxInfo->xAllocated = pdFALSE;
+                    pxInfo->pvTask = NULL;
+                    pxInfo->pvCaller = NULL;
+                }
+
+                uxEntriesWritten++;
+
+                /* A block size of zero would never reach the end marker. */
+                configASSERT( pxInfo->xBlockSize != ( size_t ) 0U );
+                pxBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + pxInfo->xBlockSize );
+            }
+        }
+        heapRESUME_ALL();
+
+        return uxEntriesWritten;
+    }
+
+#endif /* configUSE_HEAP_PROFILER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_HEAP_QUOTAS == 1 )
+
+    void vPortHeapDisownTask( void * pvTask )
+    {
+        BlockLink_t * pxBlock;
+
+        heapSUSPEND_ALL();
+        {
+            /* Free and allocated blocks are contiguous from the first block up
+             * to the end marker, so each block follows on from the last. */
+            pxBlock = pxFirstBlock;
+
+            while( ( pxBlock != NULL ) && ( pxBlock != pxEnd ) )
+            {
+                heapVALIDATE_BLOCK_POINTER( pxBlock );
+
+                if( ( heapBLOCK_IS_ALLOCATED( pxBlock ) != 0 ) && ( pxBlock->pvOwner == pvTask ) )
+                {
+                    pxBlock->pvOwner = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* A block size of zero would never reach the end marker. */
+                configASSERT( ( pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK ) != ( size_t ) 0U );
+                pxBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + ( pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK ) );
+            }
+        }
+        heapRESUME_ALL();
+    }
+
+#endif /* configUSE_TASK_HEAP_QUOTAS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_STARTUP_MODE == 1 )
+
+    static BaseType_t prvHeapSchedulerStarted( void ) /* PRIVILEGED_FUNCTION */
+    {
+        if( xHeapSchedulerStarted == pdFALSE )
+        {
+            if( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED )
+            {
+                xHeapSchedulerStarted = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xHeapSchedulerStarted;
+    }
+
+#endif /* configUSE_HEAP_STARTUP_MODE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CORE_LOCAL_SUSPEND == 1 )
+
+    static void prvHeapLock( void ) /* PRIVILEGED_FUNCTION */
+    {
+        vTaskSuspendCore();
+
+        while( portATOMIC_COMPARE_AND_SWAP_U32( &ulHeapLock, 1U, 0U ) == 0U )
+        {
+            /* Another core is using the heap. */
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvHeapUnlock( void ) /* PRIVILEGED_FUNCTION */
+    {
+        ( void ) portATOMIC_COMPARE_AND_SWAP_U32( &ulHeapLock, 0U, 1U );
+
+        ( void ) xTaskResumeCore();
+    }
+
+#endif /* configUSE_CORE_LOCAL_SUSPEND */
+/*-----------------------------------------------------------*/
+
 /*
  * Reset the state in this file. This state is normally initialized at start up.
  * This function must be called by the application before restarting the
@@ -634,5 +2084,41 @@ void vPortHeapResetState( void )
     xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
     xNumberOfSuccessfulAllocations = ( size_t ) 0U;
     xNumberOfSuccessfulFrees = ( size_t ) 0U;
+
+    #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+    {
+        pxNextFitStart = NULL;
+    }
+    #endif
+
+    #if ( ( configUSE_HEAP_PROFILER == 1 ) || ( configUSE_TASK_HEAP_QUOTAS == 1 ) )
+    {
+        pxFirstBlock = NULL;
+    }
+    #endif
+
+    #if ( configUSE_HEAP_PROFILER == 1 )
+    {
+        ( void ) memset( xTaskUsage, 0x00, sizeof( xTaskUsage ) );
+    }
+    #endif
+
+    #if ( configUSE_HEAP_COMPACTION == 1 )
+    {
+        ( void ) memset( xMovableBlocks, 0x00, sizeof( xMovableBlocks ) );
+    }
+    #endif
+
+    #if ( configUSE_HEAP_STARTUP_MODE == 1 )
+    {
+        xHeapSchedulerStarted = pdFALSE;
+    }
+    #endif
+
+    #if ( configUSE_CORE_LOCAL_SUSPEND == 1 )
+    {
+        ulHeapLock = 0U;
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
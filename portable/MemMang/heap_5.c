@@ -67,6 +67,12 @@
  *
  * Note 0x80000000 is the lower address so appears in the array first.
  *
+ * When configUSE_PER_CORE_HEAP_ARENAS is 1 each core allocates from its own
+ * arena, so cores do not have to suspend the scheduler to allocate.  The first
+ * region in the array is the arena of core 0, the second the arena of core 1,
+ * and so on, with the last core's arena also taking any regions left over.  A
+ * core only allocates from another core's arena once its own is exhausted.
+ *
  */
 #include <stdlib.h>
 #include <string.h>
@@ -163,13 +169,6 @@ typedef struct A_BLOCK_LINK
 
 /*-----------------------------------------------------------*/
 
-/*
- * Inserts a block of memory that is being freed into the correct position in
- * the list of free memory blocks.  The block being freed will be merged with
- * the block in front it and/or the block behind it if the memory blocks are
- * adjacent to each other.
- */
-static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
 #if ( configENABLE_HEAP_PROTECTOR == 1 )
@@ -188,42 +187,935 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  * block must by correctly byte aligned. */
 static const size_t xHeapStructSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
 
-/* Create a couple of list links to mark the start and end of the list. */
-PRIVILEGED_DATA static BlockLink_t xStart;
-PRIVILEGED_DATA static BlockLink_t * pxEnd = NULL;
+/* Create a couple of list links to mark the start and end of the list, and
+ * keep track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation.  There
+ * is one arena for the whole heap unless configUSE_PER_CORE_HEAP_ARENAS is 1,
+ * in which case there is one arena per core. */
+#if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+
+/* The other members of HeapArena_t are only accessed with the arena's
+ * own spinlock held.  Blocks freed by a core that does not own the arena are
+ * pushed onto ulRemoteFreeList by compare and swap instead, and reclaimed the
+ * next time the arena is locked. */
+    #define heapARENA_COUNT               configNUMBER_OF_CORES
+    #define heapDEFINED_ARENAS            uxDefinedArenas
+    #define heapLOCK_ARENA( pxArena )     taskDATA_GROUP_ENTER_CRITICAL( ( portSPINLOCK_TYPE * ) &( ( pxArena )->xArenaLock ) )
+    #define heapUNLOCK_ARENA( pxArena )   taskDATA_GROUP_EXIT_CRITICAL( ( portSPINLOCK_TYPE * ) &( ( pxArena )->xArenaLock ) )
+
+/* The value of ulRemoteFreeList when no blocks are waiting to be reclaimed. */
+    #define heapNO_REMOTE_FREES           ( ( uint32_t ) 0xFFFFFFFFUL )
+#else
+    #define heapARENA_COUNT               1
+    #define heapDEFINED_ARENAS            ( ( UBaseType_t ) 1U )
+
+    #if ( configUSE_HEAP_STARTUP_MODE == 1 )
+
+/* Nothing can preempt the heap before the scheduler has started, so the
+ * scheduler is only suspended once it is running.  The scheduler cannot start
+ * part way through a heap operation, so heapUNLOCK_ARENA() always matches the
+ * preceding heapLOCK_ARENA(). */
+        #define heapLOCK_ARENA( pxArena )                   \
+    do {                                                \
+        if( prvHeapSchedulerStarted() != pdFALSE )      \
+        {                                               \
+            vTaskSuspendAll();                          \
+        }                                               \
+    } while( 0 )
+
+        #define heapUNLOCK_ARENA( pxArena )                 \
+    do {                                                \
+        if( xHeapSchedulerStarted != pdFALSE )          \
+        {                                               \
+            ( void ) xTaskResumeAll();                  \
+        }                                               \
+    } while( 0 )
+    #else
+        #define heapLOCK_ARENA( pxArena )      vTaskSuspendAll()
+        #define heapUNLOCK_ARENA( pxArena )    ( void ) xTaskResumeAll()
+    #endif /* configUSE_HEAP_STARTUP_MODE */
+#endif /* configUSE_PER_CORE_HEAP_ARENAS */
+
+typedef struct HEAP_ARENA
+{
+    BlockLink_t xStart;                    /**< Holds a pointer to the first item in the list of free blocks. */
+    BlockLink_t * pxEnd;                   /**< Marks the end of the list of free blocks. */
+    size_t xFreeBytesRemaining;            /**< The number of free bytes in the arena. */
+    size_t xMinimumEverFreeBytesRemaining; /**< The lowest value xFreeBytesRemaining has had. */
+    size_t xNumberOfSuccessfulAllocations; /**< The number of blocks allocated from the arena. */
+    size_t xNumberOfSuccessfulFrees;       /**< The number of blocks returned to the arena. */
+    #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+        BlockLink_t * pxNextFitStart;      /**< The free block after which the next search starts, or NULL to start from xStart. */
+    #endif
+    #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+        uint8_t * pucLowAddress;           /**< The start of the arena's first region.  Used to find the arena a block belongs to, and as the base of the offsets in ulRemoteFreeList. */
+        volatile uint32_t ulRemoteFreeList; /**< The offset of the block most recently freed by another core, or heapNO_REMOTE_FREES. */
+        portSPINLOCK_TYPE xArenaLock;      /**< Protects all the members other than ulRemoteFreeList. */
+    #endif
+} HeapArena_t;
+
+PRIVILEGED_DATA static HeapArena_t xArenas[ heapARENA_COUNT ];
+
+#if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+
+/* The number of arenas that were given a heap region, which is less than the
+ * number of cores if fewer regions than cores were defined. */
+    PRIVILEGED_DATA static UBaseType_t uxDefinedArenas = 0U;
+
+#endif /* configUSE_PER_CORE_HEAP_ARENAS */
 
-/* Keeps track of the number of calls to allocate and free memory as well as the
- * number of free bytes remaining, but says nothing about fragmentation. */
-PRIVILEGED_DATA static size_t xFreeBytesRemaining = ( size_t ) 0U;
-PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
-PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = ( size_t ) 0U;
-PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = ( size_t ) 0U;
+#if ( ( configUSE_HEAP_STARTUP_MODE == 1 ) && ( configUSE_PER_CORE_HEAP_ARENAS == 0 ) )
+
+/* Set to pdTRUE the first time the heap finds the scheduler running. */
+    PRIVILEGED_DATA static BaseType_t xHeapSchedulerStarted = pdFALSE;
+
+#endif
+
+#if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+
+/* The start address and capabilities of each heap region, in address order.
+ * A block belongs to the last region that starts at or below it. */
+typedef struct HEAP_REGION_CAPABILITIES
+{
+    uint8_t * pucStartAddress; /**< The aligned start of the region. */
+    uint32_t ulCapabilities;   /**< The capabilities given to the region in HeapRegion_t. */
+} HeapRegionCapabilities_t;
+
+    PRIVILEGED_DATA static HeapRegionCapabilities_t xRegionCapabilities[ configHEAP_MAX_REGIONS ];
+    PRIVILEGED_DATA static UBaseType_t uxRegionsWithCapabilities = 0U;
+
+/* A free block can satisfy a request if it is large enough and lies in a
+ * region that has all the requested capabilities. */
+    #define heapBLOCK_FITS( pxBlock, xWantedSize, ulCapabilities )          \
+    ( ( ( pxBlock )->xBlockSize >= ( xWantedSize ) ) &&                    \
+      ( ( ( ulCapabilities ) == portHEAP_CAPS_NONE ) ||                    \
+        ( ( prvGetRegionCapabilities( pxBlock ) & ( ulCapabilities ) ) == ( ulCapabilities ) ) ) )
+#else
+    #define heapBLOCK_FITS( pxBlock, xWantedSize, ulCapabilities )    ( ( pxBlock )->xBlockSize >= ( xWantedSize ) )
+#endif /* configUSE_HEAP_REGION_CAPABILITIES */
 
 #if ( configENABLE_HEAP_PROTECTOR == 1 )
 
-/* Canary value for protecting internal heap pointers. */
-    PRIVILEGED_DATA static portPOINTER_SIZE_TYPE xHeapCanary;
+/* Canary value for protecting internal heap pointers. */
+    PRIVILEGED_DATA static portPOINTER_SIZE_TYPE xHeapCanary;
+
+/* Highest and lowest heap addresses used for heap block bounds checking. */
+    PRIVILEGED_DATA static uint8_t * pucHeapHighAddress = NULL;
+    PRIVILEGED_DATA static uint8_t * pucHeapLowAddress = NULL;
+
+#endif /* configENABLE_HEAP_PROTECTOR */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Inserts a block of memory that is being freed into the correct position in
+ * the arena's list of free memory blocks.  The block being freed will be merged
+ * with the block in front it and/or the block behind it if the memory blocks
+ * are adjacent to each other.
+ */
+static void prvInsertBlockIntoFreeList( HeapArena_t * pxArena,
+                                        BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes a block of at least xWantedSize bytes, which already includes the
+ * BlockLink_t structure and alignment padding, out of the arena's list of free
+ * blocks.  The block must lie in a region with all of ulCapabilities.  The size
+ * of the block taken is written to *pxAllocatedBlockSize.  Must be called with
+ * the arena locked.
+ */
+static void * prvAllocateFromArena( HeapArena_t * pxArena,
+                                    size_t xWantedSize,
+                                    uint32_t ulCapabilities,
+                                    size_t * pxAllocatedBlockSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Searches the arena's list of free blocks for a block of at least xWantedSize
+ * bytes in a region with all of ulCapabilities, using the policy selected by
+ * configHEAP_ALLOCATION_POLICY.  Returns the block with the block that precedes
+ * it in the list in *ppxPreviousBlock, or the arena's pxEnd if no block is
+ * suitable.  Must be called with the arena locked.
+ */
+static BlockLink_t * prvFindFreeBlock( HeapArena_t * pxArena,
+                                       size_t xWantedSize,
+                                       uint32_t ulCapabilities,
+                                       BlockLink_t ** ppxPreviousBlock ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+
+/*
+ * Returns the capabilities of the heap region pv lies in.
+ */
+    static uint32_t prvGetRegionCapabilities( const void * pv ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Returns the size of the block needed to hold xWantedSize bytes, including the
+ * BlockLink_t structure and alignment padding, or 0 if xWantedSize is 0 or the
+ * size would overflow.
+ */
+static size_t prvGetBlockSize( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+#if ( ( configUSE_HEAP_STARTUP_MODE == 1 ) && ( configUSE_PER_CORE_HEAP_ARENAS == 0 ) )
+
+/*
+ * Returns pdTRUE once the scheduler has started.  The result is remembered so
+ * only calls made before the scheduler starts need to query the scheduler.
+ */
+    static BaseType_t prvHeapSchedulerStarted( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configSUPPORT_HEAP_REALLOC == 1 ) || ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 ) )
+
+/*
+ * Shrinks an allocated block to xBlockSize bytes, returning the end of the
+ * block to the arena's list of free blocks if it is large enough to be worth
+ * splitting off.  Must be called with the arena locked.
+ */
+    static void prvTrimAllocatedBlock( HeapArena_t * pxArena,
+                                       BlockLink_t * pxBlock,
+                                       size_t xBlockSize ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+
+/*
+ * Returns the arena whose heap regions contain pxBlock.
+ */
+    static HeapArena_t * prvGetArenaOfBlock( const BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Hands a block freed by a core that does not own the arena back to the arena
+ * without locking it.
+ */
+    static void prvPushRemoteFree( HeapArena_t * pxArena,
+                                   BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves the blocks pushed by prvPushRemoteFree() into the arena's list of free
+ * blocks.  Must be called with the arena locked.
+ */
+    static void prvReclaimRemoteFrees( HeapArena_t * pxArena ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_PER_CORE_HEAP_ARENAS */
+
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    return pvPortMallocCaps( xWantedSize, portHEAP_CAPS_NONE );
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMallocCaps( size_t xWantedSize,
+                         uint32_t ulCapabilities )
+#else
+void * pvPortMalloc( size_t xWantedSize )
+#endif /* if ( configUSE_HEAP_REGION_CAPABILITIES == 1 ) */
+{
+    void * pvReturn = NULL;
+    size_t xAllocatedBlockSize = 0;
+
+    #if ( configUSE_HEAP_REGION_CAPABILITIES == 0 )
+        const uint32_t ulCapabilities = portHEAP_CAPS_NONE;
+    #endif
+
+    /* The heap must be initialised before the first call to
+     * pvPortMalloc(). */
+    configASSERT( xArenas[ 0 ].pxEnd );
+
+    xWantedSize = prvGetBlockSize( xWantedSize );
+
+    #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+    {
+        UBaseType_t uxArena = ( ( UBaseType_t ) portGET_CORE_ID() ) % uxDefinedArenas;
+        UBaseType_t uxArenasTried;
+
+        /* Try the calling core's own arena first, only falling back to the
+         * arenas of the other cores if it cannot supply the block.  The task
+         * may move to another core at any time, but as every arena is locked
+         * before it is used that only changes which arena is tried first. */
+        for( uxArenasTried = 0U; ( pvReturn == NULL ) && ( uxArenasTried < uxDefinedArenas ); uxArenasTried++ )
+        {
+            heapLOCK_ARENA( &( xArenas[ uxArena ] ) );
+            {
+                prvReclaimRemoteFrees( &( xArenas[ uxArena ] ) );
+                pvReturn = prvAllocateFromArena( &( xArenas[ uxArena ] ), xWantedSize, ulCapabilities, &xAllocatedBlockSize );
+            }
+            heapUNLOCK_ARENA( &( xArenas[ uxArena ] ) );
+
+            uxArena = ( uxArena + 1U ) % uxDefinedArenas;
+        }
+
+        traceMALLOC( pvReturn, xAllocatedBlockSize );
+
+        /* Prevent compiler warnings when trace macros are not used. */
+        ( void ) xAllocatedBlockSize;
+    }
+    #else /* if ( configUSE_PER_CORE_HEAP_ARENAS == 1 ) */
+    {
+        heapLOCK_ARENA( &( xArenas[ 0 ] ) );
+        {
+            pvReturn = prvAllocateFromArena( &( xArenas[ 0 ] ), xWantedSize, ulCapabilities, &xAllocatedBlockSize );
+
+            traceMALLOC( pvReturn, xAllocatedBlockSize );
+
+            /* Prevent compiler warnings when trace macros are not used. */
+            ( void ) xAllocatedBlockSize;
+        }
+        heapUNLOCK_ARENA( &( xArenas[ 0 ] ) );
+    }
+    #endif /* if ( configUSE_PER_CORE_HEAP_ARENAS == 1 ) */
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void * prvAllocateFromArena( HeapArena_t * pxArena,
+                                    size_t xWantedSize,
+                                    uint32_t ulCapabilities,
+                                    size_t * pxAllocatedBlockSize ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxPreviousBlock;
+    BlockLink_t * pxNewBlockLink;
+    void * pvReturn = NULL;
+
+    /* Check the block size we are trying to allocate is not so large that the
+     * top bit is set.  The top bit of the block size member of the BlockLink_t
+     * structure is used to determine who owns the block - the application or
+     * the kernel, so it must be free. */
+    if( heapBLOCK_SIZE_IS_VALID( xWantedSize ) != 0 )
+    {
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= pxArena->xFreeBytesRemaining ) )
+        {
+            pxBlock = prvFindFreeBlock( pxArena, xWantedSize, ulCapabilities, &pxPreviousBlock );
+
+            /* If the end marker was reached then a block of adequate size
+             * was not found. */
+            if( pxBlock != pxArena->pxEnd )
+            {
+                /* Return the memory space pointed to - jumping over the
+                 * BlockLink_t structure at its start. */
+                pvReturn = ( void * ) ( ( ( uint8_t * ) heapPROTECT_BLOCK_POINTER( pxPreviousBlock->pxNextFreeBlock ) ) + xHeapStructSize );
+                heapVALIDATE_BLOCK_POINTER( pvReturn );
+
+                /* This block is being returned for use so must be taken out
+                 * of the list of free blocks. */
+                pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+                /* If the block is larger than required it can be split into
+                 * two. */
+                configASSERT( heapSUBTRACT_WILL_UNDERFLOW( pxBlock->xBlockSize, xWantedSize ) == 0 );
+
+                if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+                {
+                    /* This block is to be split into two.  Create a new
+                     * block following the number of bytes requested. The void
+                     * cast is used to prevent byte alignment warnings from the
+                     * compiler. */
+                    pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                    configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+                    /* Calculate the sizes of two blocks split from the
+                     * single block. */
+                    pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    /* Insert the new block into the list of free blocks. */
+                    pxNewBlockLink->pxNextFreeBlock = pxPreviousBlock->pxNextFreeBlock;
+                    pxPreviousBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxNewBlockLink );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxArena->xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                if( pxArena->xFreeBytesRemaining < pxArena->xMinimumEverFreeBytesRemaining )
+                {
+                    pxArena->xMinimumEverFreeBytesRemaining = pxArena->xFreeBytesRemaining;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                *pxAllocatedBlockSize = pxBlock->xBlockSize;
+
+                /* The block is being returned - it is allocated and owned
+                 * by the application and has no "next" block. */
+                heapALLOCATE_BLOCK( pxBlock );
+                pxBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+                pxArena->xNumberOfSuccessfulAllocations++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have an BlockLink_t structure immediately
+         * before it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        heapVALIDATE_BLOCK_POINTER( pxLink );
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
+        configASSERT( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( NULL ) );
+
+        if( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 )
+        {
+            if( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( NULL ) )
+            {
+                /* The block is being returned to the heap - it is no longer
+                 * allocated. */
+                heapFREE_BLOCK( pxLink );
+                #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+                {
+                    /* Check for underflow as this can occur if xBlockSize is
+                     * overwritten in a heap block. */
+                    if( heapSUBTRACT_WILL_UNDERFLOW( pxLink->xBlockSize, xHeapStructSize ) == 0 )
+                    {
+                        ( void ) memset( puc + xHeapStructSize, 0, pxLink->xBlockSize - xHeapStructSize );
+                    }
+                }
+                #endif
+
+                #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+                {
+                    HeapArena_t * const pxArena = prvGetArenaOfBlock( pxLink );
+
+                    /* Only the core that owns the arena takes its lock to free
+                     * a block.  Other cores hand the block back without
+                     * waiting for the owner to finish with the arena. */
+                    if( pxArena == &( xArenas[ ( ( UBaseType_t ) portGET_CORE_ID() ) % uxDefinedArenas ] ) )
+                    {
+                        heapLOCK_ARENA( pxArena );
+                        {
+                            /* Add this block to the list of free blocks. */
+                            pxArena->xFreeBytesRemaining += pxLink->xBlockSize;
+                            traceFREE( pv, pxLink->xBlockSize );
+                            prvInsertBlockIntoFreeList( pxArena, ( ( BlockLink_t * ) pxLink ) );
+                            pxArena->xNumberOfSuccessfulFrees++;
+                        }
+                        heapUNLOCK_ARENA( pxArena );
+                    }
+                    else
+                    {
+                        traceFREE( pv, pxLink->xBlockSize );
+                        prvPushRemoteFree( pxArena, pxLink );
+                    }
+                }
+                #else /* if ( configUSE_PER_CORE_HEAP_ARENAS == 1 ) */
+                {
+                    heapLOCK_ARENA( &( xArenas[ 0 ] ) );
+                    {
+                        /* Add this block to the list of free blocks. */
+                        xArenas[ 0 ].xFreeBytesRemaining += pxLink->xBlockSize;
+                        traceFREE( pv, pxLink->xBlockSize );
+                        prvInsertBlockIntoFreeList( &( xArenas[ 0 ] ), ( ( BlockLink_t * ) pxLink ) );
+                        xArenas[ 0 ].xNumberOfSuccessfulFrees++;
+                    }
+                    heapUNLOCK_ARENA( &( xArenas[ 0 ] ) );
+                }
+                #endif /* if ( configUSE_PER_CORE_HEAP_ARENAS == 1 ) */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+
+    static HeapArena_t * prvGetArenaOfBlock( const BlockLink_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxArena;
+
+        /* The arenas were given their regions in address order, so the block
+         * belongs to the last arena that starts at or below it. */
+        for( uxArena = uxDefinedArenas - 1U; ( uxArena > 0U ) && ( ( const uint8_t * ) pxBlock < xArenas[ uxArena ].pucLowAddress ); uxArena-- )
+        {
+            /* Nothing to do here, just iterate to the right arena. */
+        }
+
+        return &( xArenas[ uxArena ] );
+    }
+
+#endif /* configUSE_PER_CORE_HEAP_ARENAS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+
+    static uint32_t prvGetRegionCapabilities( const void * pv ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxRegion;
+        uint32_t ulCapabilities = portHEAP_CAPS_NONE;
+
+        /* The regions were recorded in address order, so pv lies in the last
+         * region that starts at or below it. */
+        for( uxRegion = uxRegionsWithCapabilities; ( uxRegion > 0U ) && ( ( const uint8_t * ) pv < xRegionCapabilities[ uxRegion - 1U ].pucStartAddress ); uxRegion-- )
+        {
+            /* Nothing to do here, just iterate to the right region. */
+        }
+
+        if( uxRegion > 0U )
+        {
+            ulCapabilities = xRegionCapabilities[ uxRegion - 1U ].ulCapabilities;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ulCapabilities;
+    }
+
+#endif /* configUSE_HEAP_REGION_CAPABILITIES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+
+    static void prvPushRemoteFree( HeapArena_t * pxArena,
+                                   BlockLink_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+    {
+        const uint32_t ulOffset = ( uint32_t ) ( ( ( uint8_t * ) pxBlock ) - pxArena->pucLowAddress );
+        uint32_t ulHead;
+        BlockLink_t * pxNext;
+
+        /* Link the block in front of the current head of the list then try to
+         * make it the new head, starting again if another core changed the
+         * head in the meantime.  Blocks are only ever taken off the list all
+         * at once, so a head that is still the same has not been reused. */
+        do
+        {
+            ulHead = pxArena->ulRemoteFreeList;
+
+            if( ulHead == heapNO_REMOTE_FREES )
+            {
+                pxNext = NULL;
+            }
+            else
+            {
+                pxNext = ( void * ) ( pxArena->pucLowAddress + ulHead );
+            }
+
+            pxBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxNext );
+        } while( portATOMIC_COMPARE_AND_SWAP_U32( &( pxArena->ulRemoteFreeList ), ulOffset, ulHead ) == 0U );
+    }
+
+#endif /* configUSE_PER_CORE_HEAP_ARENAS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+
+    static void prvReclaimRemoteFrees( HeapArena_t * pxArena ) /* PRIVILEGED_FUNCTION */
+    {
+        uint32_t ulHead;
+        BlockLink_t * pxBlock;
+        BlockLink_t * pxNext;
+
+        /* Take the whole list, leaving it empty for the other cores to push
+         * onto again. */
+        do
+        {
+            ulHead = pxArena->ulRemoteFreeList;
+        } while( ( ulHead != heapNO_REMOTE_FREES ) &&
+                 ( portATOMIC_COMPARE_AND_SWAP_U32( &( pxArena->ulRemoteFreeList ), heapNO_REMOTE_FREES, ulHead ) == 0U ) );
+
+        if( ulHead != heapNO_REMOTE_FREES )
+        {
+            pxBlock = ( void * ) ( pxArena->pucLowAddress + ulHead );
+
+            while( pxBlock != NULL )
+            {
+                heapVALIDATE_BLOCK_POINTER( pxBlock );
+
+                /* Inserting the block overwrites its link to the next one. */
+                pxNext = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+
+                pxArena->xFreeBytesRemaining += pxBlock->xBlockSize;
+                prvInsertBlockIntoFreeList( pxArena, pxBlock );
+                pxArena->xNumberOfSuccessfulFrees++;
+
+                pxBlock = pxNext;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_PER_CORE_HEAP_ARENAS */
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    size_t xFreeBytesRemaining = ( size_t ) 0U;
+    UBaseType_t uxArena;
+
+    for( uxArena = 0U; uxArena < heapDEFINED_ARENAS; uxArena++ )
+    {
+        xFreeBytesRemaining += xArenas[ uxArena ].xFreeBytesRemaining;
+    }
+
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
+    UBaseType_t uxArena;
+
+    /* With more than one arena this is the sum of the arenas' own minimums,
+     * which may be lower than the heap as a whole ever got. */
+    for( uxArena = 0U; uxArena < heapDEFINED_ARENAS; uxArena++ )
+    {
+        xMinimumEverFreeBytesRemaining += xArenas[ uxArena ].xMinimumEverFreeBytesRemaining;
+    }
+
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void xPortResetHeapMinimumEverFreeHeapSize( void )
+{
+    UBaseType_t uxArena;
+
+    for( uxArena = 0U; uxArena < heapDEFINED_ARENAS; uxArena++ )
+    {
+        xArenas[ uxArena ].xMinimumEverFreeBytesRemaining = xArenas[ uxArena ].xFreeBytesRemaining;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_HEAP_REALLOC == 1 )
+
+void * pvPortRealloc( void * pv,
+                      size_t xWantedSize )
+{
+    void * pvReturn = NULL;
+    BlockLink_t * pxLink;
+    BlockLink_t * pxNextBlock;
+    BlockLink_t * pxIterator;
+    HeapArena_t * pxArena;
+    size_t xBlockSize;
+    size_t xRequiredSize;
+
+    if( pv == NULL )
+    {
+        pvReturn = pvPortMalloc( xWantedSize );
+    }
+    else if( xWantedSize == ( size_t ) 0 )
+    {
+        vPortFree( pv );
+    }
+    else
+    {
+        /* The memory being resized will have an BlockLink_t structure
+         * immediately before it. */
+        pxLink = ( void * ) ( ( ( uint8_t * ) pv ) - xHeapStructSize );
+
+        heapVALIDATE_BLOCK_POINTER( pxLink );
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
+        configASSERT( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( NULL ) );
+
+        xRequiredSize = prvGetBlockSize( xWantedSize );
+        xBlockSize = pxLink->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
+
+        if( ( xRequiredSize > 0 ) && ( heapBLOCK_SIZE_IS_VALID( xRequiredSize ) != 0 ) )
+        {
+            #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+                pxArena = prvGetArenaOfBlock( pxLink );
+            #else
+                pxArena = &( xArenas[ 0 ] );
+            #endif
+
+            heapLOCK_ARENA( pxArena );
+            {
+                #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+                {
+                    /* The block that follows may have been freed by another
+                     * core. */
+                    prvReclaimRemoteFrees( pxArena );
+                }
+                #endif
+
+                if( xRequiredSize <= xBlockSize )
+                {
+                    /* The block is already large enough, so any space that is
+                     * no longer needed is given back. */
+                    prvTrimAllocatedBlock( pxArena, pxLink, xRequiredSize );
+                    pvReturn = pv;
+                }
+                else
+                {
+                    /* The block can grow in place if the block that follows it
+                     * is free and the two together are large enough. */
+                    pxNextBlock = ( void * ) ( ( ( uint8_t * ) pxLink ) + xBlockSize );
+                    heapVALIDATE_BLOCK_POINTER( pxNextBlock );
+
+                    if( ( pxNextBlock != pxArena->pxEnd ) &&
+                        ( heapBLOCK_IS_ALLOCATED( pxNextBlock ) == 0 ) &&
+                        ( ( xRequiredSize - xBlockSize ) <= pxNextBlock->xBlockSize ) )
+                    {
+                        /* Find the free block that comes before the following
+                         * block in the list so it can be taken out. */
+                        for( pxIterator = &( pxArena->xStart ); heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) < pxNextBlock; pxIterator = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) )
+                        {
+                            /* Nothing to do here, just iterate to the right position. */
+                        }
+
+                        /* With per core heap arenas a block that another core
+                         * has marked as free but not yet handed back is not in
+                         * the list, so is left alone. */
+                        if( heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) == pxNextBlock )
+                        {
+                            pxIterator->pxNextFreeBlock = pxNextBlock->pxNextFreeBlock;
+
+                            #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+                            {
+                                if( pxArena->pxNextFitStart == pxNextBlock )
+                                {
+                                    pxArena->pxNextFitStart = pxIterator;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+                            #endif /* configHEAP_ALLOCATION_POLICY */
+
+                            pxArena->xFreeBytesRemaining -= pxNextBlock->xBlockSize;
+
+                            if( pxArena->xFreeBytesRemaining < pxArena->xMinimumEverFreeBytesRemaining )
+                            {
+                                pxArena->xMinimumEverFreeBytesRemaining = pxArena->xFreeBytesRemaining;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+
+                            /* The two blocks become one, which is then trimmed back
+                             * to the size required. */
+                            pxLink->xBlockSize = xBlockSize + pxNextBlock->xBlockSize;
+                            heapALLOCATE_BLOCK( pxLink );
+                            prvTrimAllocatedBlock( pxArena, pxLink, xRequiredSize );
+                            pvReturn = pv;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            heapUNLOCK_ARENA( pxArena );
+
+            if( pvReturn == NULL )
+            {
+                /* The block could not be resized in place, so it is moved, to
+                 * a region with the same capabilities if regions have them.
+                 * The original block is left untouched if that fails. */
+                #if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+                    pvReturn = pvPortMallocCaps( xWantedSize, prvGetRegionCapabilities( pxLink ) );
+                #else
+                    pvReturn = pvPortMalloc( xWantedSize );
+                #endif
+
+                if( pvReturn != NULL )
+                {
+                    ( void ) memcpy( pvReturn, pv, ( xWantedSize < ( xBlockSize - xHeapStructSize ) ) ? xWantedSize : ( xBlockSize - xHeapStructSize ) );
+                    vPortFree( pv );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return pvReturn;
+}
+
+#endif /* configSUPPORT_HEAP_REALLOC */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 )
+
+void * pvPortMallocAligned( size_t xWantedSize,
+                            size_t xAlignment )
+{
+    void * pvReturn = NULL;
+    BlockLink_t * pxLink;
+    BlockLink_t * pxAlignedLink;
+    HeapArena_t * pxArena;
+    portPOINTER_SIZE_TYPE uxAddress;
+    size_t xPadding;
+
+    /* The alignment must be a power of two. */
+    configASSERT( ( xAlignment != ( size_t ) 0 ) && ( ( xAlignment & ( xAlignment - ( size_t ) 1 ) ) == ( size_t ) 0 ) );
+
+    if( xAlignment <= ( size_t ) portBYTE_ALIGNMENT )
+    {
+        pvReturn = pvPortMalloc( xWantedSize );
+    }
+    else if( ( prvGetBlockSize( xWantedSize ) > 0 ) &&
+             ( heapADD_WILL_OVERFLOW( xWantedSize, xAlignment + heapMINIMUM_BLOCK_SIZE ) == 0 ) )
+    {
+        /* Allocate enough to leave room for a free block in front of the
+         * aligned address, then give back whatever is not needed at either end
+         * of the block. */
+        pvReturn = pvPortMalloc( xWantedSize + xAlignment + heapMINIMUM_BLOCK_SIZE );
+
+        if( pvReturn != NULL )
+        {
+            pxLink = ( void * ) ( ( ( uint8_t * ) pvReturn ) - xHeapStructSize );
+
+            #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+                pxArena = prvGetArenaOfBlock( pxLink );
+            #else
+                pxArena = &( xArenas[ 0 ] );
+            #endif
+
+            heapLOCK_ARENA( pxArena );
+            {
+                uxAddress = ( portPOINTER_SIZE_TYPE ) pvReturn;
+
+                if( ( uxAddress & ( portPOINTER_SIZE_TYPE ) ( xAlignment - ( size_t ) 1 ) ) != 0 )
+                {
+                    /* The padding in front of the aligned address is made large
+                     * enough to be a free block of its own. */
+                    uxAddress += ( portPOINTER_SIZE_TYPE ) ( heapMINIMUM_BLOCK_SIZE + ( xAlignment - ( size_t ) 1 ) );
+                    uxAddress &= ~( ( portPOINTER_SIZE_TYPE ) ( xAlignment - ( size_t ) 1 ) );
+                    xPadding = ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pvReturn );
+
+                    pxAlignedLink = ( void * ) ( ( ( uint8_t * ) pxLink ) + xPadding );
+                    pxAlignedLink->xBlockSize = ( pxLink->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK ) - xPadding;
+                    heapALLOCATE_BLOCK( pxAlignedLink );
+                    pxAlignedLink->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+
+                    /* The padding is returned to the list of free blocks. */
+                    pxLink->xBlockSize = xPadding;
+                    pxArena->xFreeBytesRemaining += xPadding;
+                    prvInsertBlockIntoFreeList( pxArena, pxLink );
+
+                    pxLink = pxAlignedLink;
+                    pvReturn = ( void * ) uxAddress;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-/* Highest and lowest heap addresses used for heap block bounds checking. */
-    PRIVILEGED_DATA static uint8_t * pucHeapHighAddress = NULL;
-    PRIVILEGED_DATA static uint8_t * pucHeapLowAddress = NULL;
+                prvTrimAllocatedBlock( pxArena, pxLink, prvGetBlockSize( xWantedSize ) );
+            }
+            heapUNLOCK_ARENA( pxArena );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
 
-#endif /* configENABLE_HEAP_PROTECTOR */
+    configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pvReturn ) & ( portPOINTER_SIZE_TYPE ) ( xAlignment - ( size_t ) 1 ) ) == 0 );
+    return pvReturn;
+}
 
+#endif /* configSUPPORT_HEAP_ALIGNED_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-void * pvPortMalloc( size_t xWantedSize )
+static size_t prvGetBlockSize( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
 {
-    BlockLink_t * pxBlock;
-    BlockLink_t * pxPreviousBlock;
-    BlockLink_t * pxNewBlockLink;
-    void * pvReturn = NULL;
     size_t xAdditionalRequiredSize;
-    size_t xAllocatedBlockSize = 0;
-
-    /* The heap must be initialised before the first call to
-     * pvPortMalloc(). */
-    configASSERT( pxEnd );
 
     if( xWantedSize > 0 )
     {
@@ -264,92 +1156,104 @@ void * pvPortMalloc( size_t xWantedSize )
         mtCOVERAGE_TEST_MARKER();
     }
 
-    vTaskSuspendAll();
+    return xWantedSize;
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvFindFreeBlock( HeapArena_t * pxArena,
+                                       size_t xWantedSize,
+                                       uint32_t ulCapabilities,
+                                       BlockLink_t ** ppxPreviousBlock ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxPreviousBlock = &( pxArena->xStart );
+
+    #if ( configUSE_HEAP_REGION_CAPABILITIES == 0 )
     {
-        /* Check the block size we are trying to allocate is not so large that the
-         * top bit is set.  The top bit of the block size member of the BlockLink_t
-         * structure is used to determine who owns the block - the application or
-         * the kernel, so it must be free. */
-        if( heapBLOCK_SIZE_IS_VALID( xWantedSize ) != 0 )
-        {
-            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
-            {
-                /* Traverse the list from the start (lowest address) block until
-                 * one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
-                heapVALIDATE_BLOCK_POINTER( pxBlock );
+        /* Prevent compiler warnings when region capabilities are not used. */
+        ( void ) ulCapabilities;
+    }
+    #endif
 
-                while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != heapPROTECT_BLOCK_POINTER( NULL ) ) )
-                {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
-                    heapVALIDATE_BLOCK_POINTER( pxBlock );
-                }
+    #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_FIRST_FIT )
+    {
+        /* Traverse the list from the start (lowest address) block until one of
+         * adequate size is found. */
+        pxBlock = heapPROTECT_BLOCK_POINTER( pxArena->xStart.pxNextFreeBlock );
+        heapVALIDATE_BLOCK_POINTER( pxBlock );
 
-                /* If the end marker was reached then a block of adequate size
-                 * was not found. */
-                if( pxBlock != pxEnd )
-                {
-                    /* Return the memory space pointed to - jumping over the
-                     * BlockLink_t structure at its start. */
-                    pvReturn = ( void * ) ( ( ( uint8_t * ) heapPROTECT_BLOCK_POINTER( pxPreviousBlock->pxNextFreeBlock ) ) + xHeapStructSize );
-                    heapVALIDATE_BLOCK_POINTER( pvReturn );
+        while( ( heapBLOCK_FITS( pxBlock, xWantedSize, ulCapabilities ) == 0 ) && ( pxBlock->pxNextFreeBlock != heapPROTECT_BLOCK_POINTER( NULL ) ) )
+        {
+            pxPreviousBlock = pxBlock;
+            pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+            heapVALIDATE_BLOCK_POINTER( pxBlock );
+        }
+    }
+    #elif ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_BEST_FIT )
+    {
+        BlockLink_t * pxIterator;
+        BlockLink_t * pxIteratorPrevious = &( pxArena->xStart );
+
+        /* Traverse the whole list for the smallest suitable block,
+         * stopping early if one is found that fits exactly.  The end markers
+         * have a size of zero so never fit. */
+        pxBlock = pxArena->pxEnd;
+        pxIterator = heapPROTECT_BLOCK_POINTER( pxArena->xStart.pxNextFreeBlock );
+        heapVALIDATE_BLOCK_POINTER( pxIterator );
 
-                    /* This block is being returned for use so must be taken out
-                     * of the list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+        while( ( pxIterator != pxArena->pxEnd ) && ( pxBlock->xBlockSize != xWantedSize ) )
+        {
+            if( ( heapBLOCK_FITS( pxIterator, xWantedSize, ulCapabilities ) != 0 ) &&
+                ( ( pxBlock == pxArena->pxEnd ) || ( pxIterator->xBlockSize < pxBlock->xBlockSize ) ) )
+            {
+                pxBlock = pxIterator;
+                pxPreviousBlock = pxIteratorPrevious;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                    /* If the block is larger than required it can be split into
-                     * two. */
-                    configASSERT( heapSUBTRACT_WILL_UNDERFLOW( pxBlock->xBlockSize, xWantedSize ) == 0 );
+            pxIteratorPrevious = pxIterator;
+            pxIterator = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock );
+            heapVALIDATE_BLOCK_POINTER( pxIterator );
+        }
+    }
+    #else /* configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT */
+    {
+        BlockLink_t * const pxSearchStart = ( pxArena->pxNextFitStart != NULL ) ? pxArena->pxNextFitStart : &( pxArena->xStart );
 
-                    if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
-                    {
-                        /* This block is to be split into two.  Create a new
-                         * block following the number of bytes requested. The void
-                         * cast is used to prevent byte alignment warnings from the
-                         * compiler. */
-                        pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
-                        configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
-
-                        /* Calculate the sizes of two blocks split from the
-                         * single block. */
-                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
-                        pxBlock->xBlockSize = xWantedSize;
-
-                        /* Insert the new block into the list of free blocks. */
-                        pxNewBlockLink->pxNextFreeBlock = pxPreviousBlock->pxNextFreeBlock;
-                        pxPreviousBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxNewBlockLink );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+        /* Traverse the list from where the last search finished up to the end
+         * marker... */
+        pxPreviousBlock = pxSearchStart;
+        pxBlock = heapPROTECT_BLOCK_POINTER( pxSearchStart->pxNextFreeBlock );
+        heapVALIDATE_BLOCK_POINTER( pxBlock );
 
-                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+        while( ( heapBLOCK_FITS( pxBlock, xWantedSize, ulCapabilities ) == 0 ) && ( pxBlock != pxArena->pxEnd ) )
+        {
+            pxPreviousBlock = pxBlock;
+            pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+            heapVALIDATE_BLOCK_POINTER( pxBlock );
+        }
 
-                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
-                    {
-                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+        /* ...then wrap around to the start (lowest address) block, up to and
+         * including the block the search started after. */
+        if( ( pxBlock == pxArena->pxEnd ) && ( pxSearchStart != &( pxArena->xStart ) ) )
+        {
+            pxPreviousBlock = &( pxArena->xStart );
+            pxBlock = heapPROTECT_BLOCK_POINTER( pxArena->xStart.pxNextFreeBlock );
+            heapVALIDATE_BLOCK_POINTER( pxBlock );
 
-                    xAllocatedBlockSize = pxBlock->xBlockSize;
+            while( ( heapBLOCK_FITS( pxBlock, xWantedSize, ulCapabilities ) == 0 ) && ( pxPreviousBlock != pxSearchStart ) )
+            {
+                pxPreviousBlock = pxBlock;
+                pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+                heapVALIDATE_BLOCK_POINTER( pxBlock );
+            }
 
-                    /* The block is being returned - it is allocated and owned
-                     * by the application and has no "next" block. */
-                    heapALLOCATE_BLOCK( pxBlock );
-                    pxBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
-                    xNumberOfSuccessfulAllocations++;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+            if( heapBLOCK_FITS( pxBlock, xWantedSize, ulCapabilities ) == 0 )
+            {
+                pxBlock = pxArena->pxEnd;
             }
             else
             {
@@ -361,140 +1265,80 @@ void * pvPortMalloc( size_t xWantedSize )
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceMALLOC( pvReturn, xAllocatedBlockSize );
-
-        /* Prevent compiler warnings when trace macros are not used. */
-        ( void ) xAllocatedBlockSize;
-    }
-    ( void ) xTaskResumeAll();
-
-    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
-    {
-        if( pvReturn == NULL )
+        /* The block that precedes the allocated block stays in the list, so
+         * the next search starts from there. */
+        if( pxBlock != pxArena->pxEnd )
         {
-            vApplicationMallocFailedHook();
+            pxArena->pxNextFitStart = pxPreviousBlock;
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
     }
-    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+    #endif /* configHEAP_ALLOCATION_POLICY */
 
-    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
-    return pvReturn;
+    *ppxPreviousBlock = pxPreviousBlock;
+
+    return pxBlock;
 }
 /*-----------------------------------------------------------*/
 
-void vPortFree( void * pv )
-{
-    uint8_t * puc = ( uint8_t * ) pv;
-    BlockLink_t * pxLink;
+#if ( ( configSUPPORT_HEAP_REALLOC == 1 ) || ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 ) )
 
-    if( pv != NULL )
+    static void prvTrimAllocatedBlock( HeapArena_t * pxArena,
+                                       BlockLink_t * pxBlock,
+                                       size_t xBlockSize ) /* PRIVILEGED_FUNCTION */
     {
-        /* The memory being freed will have an BlockLink_t structure immediately
-         * before it. */
-        puc -= xHeapStructSize;
+        BlockLink_t * pxNewBlockLink;
+        const size_t xCurrentBlockSize = pxBlock->xBlockSize & ~heapBLOCK_ALLOCATED_BITMASK;
 
-        /* This casting is to keep the compiler from issuing warnings. */
-        pxLink = ( void * ) puc;
-
-        heapVALIDATE_BLOCK_POINTER( pxLink );
-        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
-        configASSERT( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( NULL ) );
+        configASSERT( xBlockSize <= xCurrentBlockSize );
 
-        if( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 )
+        if( ( xCurrentBlockSize - xBlockSize ) > heapMINIMUM_BLOCK_SIZE )
         {
-            if( pxLink->pxNextFreeBlock == heapPROTECT_BLOCK_POINTER( NULL ) )
-            {
-                /* The block is being returned to the heap - it is no longer
-                 * allocated. */
-                heapFREE_BLOCK( pxLink );
-                #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
-                {
-                    /* Check for underflow as this can occur if xBlockSize is
-                     * overwritten in a heap block. */
-                    if( heapSUBTRACT_WILL_UNDERFLOW( pxLink->xBlockSize, xHeapStructSize ) == 0 )
-                    {
-                        ( void ) memset( puc + xHeapStructSize, 0, pxLink->xBlockSize - xHeapStructSize );
-                    }
-                }
-                #endif
+            /* Create a new free block following the bytes that are kept.  The
+             * void cast is used to prevent byte alignment warnings from the
+             * compiler. */
+            pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xBlockSize );
+            configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
 
-                vTaskSuspendAll();
-                {
-                    /* Add this block to the list of free blocks. */
-                    xFreeBytesRemaining += pxLink->xBlockSize;
-                    traceFREE( pv, pxLink->xBlockSize );
-                    prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
-                    xNumberOfSuccessfulFrees++;
-                }
-                ( void ) xTaskResumeAll();
-            }
-            else
+            pxNewBlockLink->xBlockSize = xCurrentBlockSize - xBlockSize;
+            pxBlock->xBlockSize = xBlockSize;
+            heapALLOCATE_BLOCK( pxBlock );
+
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
             {
-                mtCOVERAGE_TEST_MARKER();
+                ( void ) memset( ( ( uint8_t * ) pxNewBlockLink ) + xHeapStructSize, 0, pxNewBlockLink->xBlockSize - xHeapStructSize );
             }
+            #endif
+
+            pxArena->xFreeBytesRemaining += pxNewBlockLink->xBlockSize;
+            prvInsertBlockIntoFreeList( pxArena, pxNewBlockLink );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
     }
-}
-/*-----------------------------------------------------------*/
-
-size_t xPortGetFreeHeapSize( void )
-{
-    return xFreeBytesRemaining;
-}
-/*-----------------------------------------------------------*/
-
-size_t xPortGetMinimumEverFreeHeapSize( void )
-{
-    return xMinimumEverFreeBytesRemaining;
-}
-/*-----------------------------------------------------------*/
-
-void xPortResetHeapMinimumEverFreeHeapSize( void )
-{
-    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
-}
-/*-----------------------------------------------------------*/
-
-void * pvPortCalloc( size_t xNum,
-                     size_t xSize )
-{
-    void * pv = NULL;
-
-    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
-    {
-        pv = pvPortMalloc( xNum * xSize );
-
-        if( pv != NULL )
-        {
-            ( void ) memset( pv, 0, xNum * xSize );
-        }
-    }
 
-    return pv;
-}
+#endif /* if ( ( configSUPPORT_HEAP_REALLOC == 1 ) || ( configSUPPORT_HEAP_ALIGNED_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVILEGED_FUNCTION */
+static void prvInsertBlockIntoFreeList( HeapArena_t * pxArena,
+                                        BlockLink_t * pxBlockToInsert ) /* PRIVILEGED_FUNCTION */
 {
     BlockLink_t * pxIterator;
     uint8_t * puc;
 
     /* Iterate through the list until a block is found that has a higher address
      * than the block being inserted. */
-    for( pxIterator = &xStart; heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) < pxBlockToInsert; pxIterator = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) )
+    for( pxIterator = &( pxArena->xStart ); heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) < pxBlockToInsert; pxIterator = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) )
     {
         /* Nothing to do here, just iterate to the right position. */
     }
 
-    if( pxIterator != &xStart )
+    if( pxIterator != &( pxArena->xStart ) )
     {
         heapVALIDATE_BLOCK_POINTER( pxIterator );
     }
@@ -519,15 +1363,30 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVI
 
     if( ( puc + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) )
     {
-        if( heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) != pxEnd )
+        if( heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) != pxArena->pxEnd )
         {
+            #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+            {
+                /* The next search cannot start from a block that is about to
+                 * be merged into the block being inserted. */
+                if( pxArena->pxNextFitStart == heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) )
+                {
+                    pxArena->pxNextFitStart = pxBlockToInsert;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configHEAP_ALLOCATION_POLICY */
+
             /* Form one big block from the two blocks. */
             pxBlockToInsert->xBlockSize += heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock )->xBlockSize;
             pxBlockToInsert->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock )->pxNextFreeBlock;
         }
         else
         {
-            pxBlockToInsert->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxEnd );
+            pxBlockToInsert->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxArena->pxEnd );
         }
     }
     else
@@ -554,6 +1413,8 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) /* PRIVI
 {
     BlockLink_t * pxFirstFreeBlockInRegion = NULL;
     BlockLink_t * pxPreviousFreeBlock;
+    BlockLink_t * pxPreviousRegionEnd = NULL;
+    HeapArena_t * pxArena = &( xArenas[ 0 ] );
     portPOINTER_SIZE_TYPE xAlignedHeap;
     size_t xTotalRegionSize, xTotalHeapSize = 0;
     BaseType_t xDefinedRegions = 0;
@@ -561,7 +1422,7 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) /* PRIVI
     const HeapRegion_t * pxHeapRegion;
 
     /* Can only call once! */
-    configASSERT( pxEnd == NULL );
+    configASSERT( xArenas[ 0 ].pxEnd == NULL );
 
     #if ( configENABLE_HEAP_PROTECTOR == 1 )
     {
@@ -575,6 +1436,18 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) /* PRIVI
     {
         xTotalRegionSize = pxHeapRegion->xSizeInBytes;
 
+        /* The first region belongs to the first arena, the second to the
+         * second arena and so on, with any regions left over once every arena
+         * has one added to the last arena. */
+        if( xDefinedRegions < ( BaseType_t ) heapARENA_COUNT )
+        {
+            pxArena = &( xArenas[ xDefinedRegions ] );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
         /* Ensure the heap region starts on a correctly aligned boundary. */
         xAddress = ( portPOINTER_SIZE_TYPE ) pxHeapRegion->pucStartAddress;
 
@@ -589,22 +1462,29 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) /* PRIVI
 
         xAlignedHeap = xAddress;
 
+        /* Check blocks are passed in with increasing start addresses. */
+        configASSERT( ( pxPreviousRegionEnd == NULL ) || ( ( size_t ) xAddress > ( size_t ) pxPreviousRegionEnd ) );
+
         /* Set xStart if it has not already been set. */
-        if( xDefinedRegions == 0 )
+        if( pxArena->pxEnd == NULL )
         {
             /* xStart is used to hold a pointer to the first item in the list of
              *  free blocks.  The void cast is used to prevent compiler warnings. */
-            xStart.pxNextFreeBlock = ( BlockLink_t * ) heapPROTECT_BLOCK_POINTER( xAlignedHeap );
-            xStart.xBlockSize = ( size_t ) 0;
+            pxArena->xStart.pxNextFreeBlock = ( BlockLink_t * ) heapPROTECT_BLOCK_POINTER( xAlignedHeap );
+            pxArena->xStart.xBlockSize = ( size_t ) 0;
+
+            #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+            {
+                pxArena->pucLowAddress = ( uint8_t * ) xAlignedHeap;
+                pxArena->ulRemoteFreeList = heapNO_REMOTE_FREES;
+                portINIT_SPINLOCK( &( pxArena->xArenaLock ) );
+                uxDefinedArenas++;
+            }
+            #endif
         }
         else
         {
-            /* Should only get here if one region has already been added to the
-             * heap. */
-            configASSERT( pxEnd != heapPROTECT_BLOCK_POINTER( NULL ) );
-
-            /* Check blocks are passed in with increasing start addresses. */
-            configASSERT( ( size_t ) xAddress > ( size_t ) pxEnd );
+            mtCOVERAGE_TEST_MARKER();
         }
 
         #if ( configENABLE_HEAP_PROTECTOR == 1 )
@@ -617,33 +1497,44 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) /* PRIVI
         }
         #endif /* configENABLE_HEAP_PROTECTOR */
 
-        /* Remember the location of the end marker in the previous region, if
-         * any. */
-        pxPreviousFreeBlock = pxEnd;
+        /* Remember the location of the end marker in the arena's previous
+         * region, if any. */
+        pxPreviousFreeBlock = pxArena->pxEnd;
 
         /* pxEnd is used to mark the end of the list of free blocks and is
          * inserted at the end of the region space. */
         xAddress = xAlignedHeap + ( portPOINTER_SIZE_TYPE ) xTotalRegionSize;
         xAddress -= ( portPOINTER_SIZE_TYPE ) xHeapStructSize;
         xAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
-        pxEnd = ( BlockLink_t * ) xAddress;
-        pxEnd->xBlockSize = 0;
-        pxEnd->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+        pxArena->pxEnd = ( BlockLink_t * ) xAddress;
+        pxArena->pxEnd->xBlockSize = 0;
+        pxArena->pxEnd->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+        pxPreviousRegionEnd = pxArena->pxEnd;
+
+        #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+        {
+            /* Blocks freed by other cores are recorded as 32-bit offsets from
+             * the start of the arena. */
+            configASSERT( ( size_t ) ( ( ( uint8_t * ) pxArena->pxEnd ) - pxArena->pucLowAddress ) < ( size_t ) heapNO_REMOTE_FREES );
+        }
+        #endif
 
         /* To start with there is a single free block in this region that is
          * sized to take up the entire heap region minus the space taken by the
          * free block structure. */
         pxFirstFreeBlockInRegion = ( BlockLink_t * ) xAlignedHeap;
         pxFirstFreeBlockInRegion->xBlockSize = ( size_t ) ( xAddress - ( portPOINTER_SIZE_TYPE ) pxFirstFreeBlockInRegion );
-        pxFirstFreeBlockInRegion->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxEnd );
+        pxFirstFreeBlockInRegion->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxArena->pxEnd );
 
-        /* If this is not the first region that makes up the entire heap space
+        /* If this is not the first region that makes up the arena's heap space
          * then link the previous region to this region. */
         if( pxPreviousFreeBlock != NULL )
         {
             pxPreviousFreeBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxFirstFreeBlockInRegion );
         }
 
+        pxArena->xFreeBytesRemaining += pxFirstFreeBlockInRegion->xBlockSize;
+        pxArena->xMinimumEverFreeBytesRemaining = pxArena->xFreeBytesRemaining;
         xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
 
         #if ( configENABLE_HEAP_PROTECTOR == 1 )
@@ -656,14 +1547,30 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) /* PRIVI
         }
         #endif
 
+        #if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+        {
+            /* Remember the region's capabilities so pvPortMallocCaps() can
+             * tell which region a free block lies in. */
+            configASSERT( uxRegionsWithCapabilities < ( UBaseType_t ) configHEAP_MAX_REGIONS );
+
+            if( uxRegionsWithCapabilities < ( UBaseType_t ) configHEAP_MAX_REGIONS )
+            {
+                xRegionCapabilities[ uxRegionsWithCapabilities ].pucStartAddress = ( uint8_t * ) xAlignedHeap;
+                xRegionCapabilities[ uxRegionsWithCapabilities ].ulCapabilities = pxHeapRegion->ulCapabilities;
+                uxRegionsWithCapabilities++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_HEAP_REGION_CAPABILITIES */
+
         /* Move onto the next HeapRegion_t structure. */
         xDefinedRegions++;
         pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
     }
 
-    xMinimumEverFreeBytesRemaining = xTotalHeapSize;
-    xFreeBytesRemaining = xTotalHeapSize;
-
     /* Check something was actually defined before it is accessed. */
     configASSERT( xTotalHeapSize );
 }
@@ -672,59 +1579,100 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) /* PRIVI
 void vPortGetHeapStats( HeapStats_t * pxHeapStats )
 {
     BlockLink_t * pxBlock;
+    HeapArena_t * pxArena;
+    UBaseType_t uxArena;
     size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    size_t xAvailableHeapSpace = 0, xMinimumEverFree = 0, xAllocations = 0, xFrees = 0;
 
-    vTaskSuspendAll();
+    for( uxArena = 0U; uxArena < heapDEFINED_ARENAS; uxArena++ )
     {
-        pxBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
+        pxArena = &( xArenas[ uxArena ] );
 
-        /* pxBlock will be NULL if the heap has not been initialised.  The heap
-         * is initialised automatically when the first allocation is made. */
-        if( pxBlock != NULL )
+        heapLOCK_ARENA( pxArena );
         {
-            while( pxBlock != pxEnd )
+            #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
             {
-                /* Increment the number of blocks and record the largest block seen
-                 * so far. */
-                xBlocks++;
+                /* Count blocks other cores have freed as free. */
+                prvReclaimRemoteFrees( pxArena );
+            }
+            #endif
 
-                if( pxBlock->xBlockSize > xMaxSize )
-                {
-                    xMaxSize = pxBlock->xBlockSize;
-                }
+            pxBlock = heapPROTECT_BLOCK_POINTER( pxArena->xStart.pxNextFreeBlock );
 
-                /* Heap five will have a zero sized block at the end of each
-                 * each region - the block is only used to link to the next
-                 * heap region so it not a real block. */
-                if( pxBlock->xBlockSize != 0 )
+            /* pxBlock will be NULL if the heap has not been initialised.  The heap
+             * is initialised automatically when the first allocation is made. */
+            if( pxBlock != NULL )
+            {
+                while( pxBlock != pxArena->pxEnd )
                 {
-                    if( pxBlock->xBlockSize < xMinSize )
+                    /* Increment the number of blocks and record the largest block seen
+                     * so far. */
+                    xBlocks++;
+
+                    if( pxBlock->xBlockSize > xMaxSize )
                     {
-                        xMinSize = pxBlock->xBlockSize;
+                        xMaxSize = pxBlock->xBlockSize;
                     }
-                }
 
-                /* Move to the next block in the chain until the last block is
-                 * reached. */
-                pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+                    /* Heap five will have a zero sized block at the end of each
+                     * each region - the block is only used to link to the next
+                     * heap region so it not a real block. */
+                    if( pxBlock->xBlockSize != 0 )
+                    {
+                        if( pxBlock->xBlockSize < xMinSize )
+                        {
+                            xMinSize = pxBlock->xBlockSize;
+                        }
+                    }
+
+                    /* Move to the next block in the chain until the last block is
+                     * reached. */
+                    pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+                }
             }
+
+            xAvailableHeapSpace += pxArena->xFreeBytesRemaining;
+            xAllocations += pxArena->xNumberOfSuccessfulAllocations;
+            xFrees += pxArena->xNumberOfSuccessfulFrees;
+            xMinimumEverFree += pxArena->xMinimumEverFreeBytesRemaining;
         }
+        heapUNLOCK_ARENA( pxArena );
     }
-    ( void ) xTaskResumeAll();
 
     pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
     pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
     pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+    pxHeapStats->xAvailableHeapSpaceInBytes = xAvailableHeapSpace;
+    pxHeapStats->xNumberOfSuccessfulAllocations = xAllocations;
+    pxHeapStats->xNumberOfSuccessfulFrees = xFrees;
+    pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFree;
+}
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_HEAP_STARTUP_MODE == 1 ) && ( configUSE_PER_CORE_HEAP_ARENAS == 0 ) )
 
-    taskENTER_CRITICAL();
+    static BaseType_t prvHeapSchedulerStarted( void ) /* PRIVILEGED_FUNCTION */
     {
-        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
-        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
-        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
-        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+        if( xHeapSchedulerStarted == pdFALSE )
+        {
+            if( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED )
+            {
+                xHeapSchedulerStarted = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xHeapSchedulerStarted;
     }
-    taskEXIT_CRITICAL();
-}
+
+#endif /* configUSE_HEAP_STARTUP_MODE */
 /*-----------------------------------------------------------*/
 
 /*
@@ -734,12 +1682,33 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
  */
 void vPortHeapResetState( void )
 {
-    pxEnd = NULL;
+    UBaseType_t uxArena;
+
+    for( uxArena = 0U; uxArena < ( UBaseType_t ) heapARENA_COUNT; uxArena++ )
+    {
+        xArenas[ uxArena ].pxEnd = NULL;
+
+        xArenas[ uxArena ].xFreeBytesRemaining = ( size_t ) 0U;
+        xArenas[ uxArena ].xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
+        xArenas[ uxArena ].xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+        xArenas[ uxArena ].xNumberOfSuccessfulFrees = ( size_t ) 0U;
 
-    xFreeBytesRemaining = ( size_t ) 0U;
-    xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
-    xNumberOfSuccessfulAllocations = ( size_t ) 0U;
-    xNumberOfSuccessfulFrees = ( size_t ) 0U;
+        #if ( configHEAP_ALLOCATION_POLICY == HEAP_POLICY_NEXT_FIT )
+            xArenas[ uxArena ].pxNextFitStart = NULL;
+        #endif
+    }
+
+    #if ( configUSE_PER_CORE_HEAP_ARENAS == 1 )
+        uxDefinedArenas = 0U;
+    #endif
+
+    #if ( configUSE_HEAP_REGION_CAPABILITIES == 1 )
+        uxRegionsWithCapabilities = 0U;
+    #endif
+
+    #if ( ( configUSE_HEAP_STARTUP_MODE == 1 ) && ( configUSE_PER_CORE_HEAP_ARENAS == 0 ) )
+        xHeapSchedulerStarted = pdFALSE;
+    #endif
 
     #if ( configENABLE_HEAP_PROTECTOR == 1 )
         pucHeapHighAddress = NULL;
@@ -0,0 +1,897 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that uses a two
+ * level segregated fit (TLSF) allocator.  Free blocks are held in a set of
+ * lists indexed by their size, with a bitmap recording which lists are not
+ * empty, so a block of adequate size is found, and a freed block is combined
+ * with the blocks either side of it, in a fixed number of steps no matter how
+ * many free blocks there are.  Like heap_4.c it combines (coalescences)
+ * adjacent memory blocks as they are freed.
+ *
+ * Each block records the size of the block and the address of the block
+ * before it in memory.  A free block also links itself into the list for its
+ * size.  A block is found by rounding the wanted size up to the next list
+ * boundary, so any block in a larger list is known to be large enough, which
+ * can leave a request unsatisfied when only a block in the list for its own
+ * size would have fitted.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE         ( ( size_t ) 8 )
+
+/* Max value that fits in a size_t type. */
+#define heapSIZE_MAX              ( ~( ( size_t ) 0 ) )
+
+/* Check if multiplying a and b will result in overflow. */
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )     ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Check if adding a and b will result in overflow. */
+#define heapADD_WILL_OVERFLOW( a, b )          ( ( a ) > ( heapSIZE_MAX - ( b ) ) )
+
+/* Check if the subtraction operation ( a - b ) will result in underflow. */
+#define heapSUBTRACT_WILL_UNDERFLOW( a, b )    ( ( a ) < ( b ) )
+
+/* MSB of the xBlockSize member of an BlockLink_t structure is used to track
+ * the allocation status of a block.  When MSB of the xBlockSize member of
+ * an BlockLink_t structure is set then the block belongs to the application.
+ * When the bit is free the block is still part of the free heap space. */
+#define heapBLOCK_ALLOCATED_BITMASK    ( ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+#define heapBLOCK_SIZE_IS_VALID( xBlockSize )    ( ( ( xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) == 0 )
+#define heapBLOCK_IS_ALLOCATED( pxBlock )        ( ( ( pxBlock->xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) != 0 )
+#define heapALLOCATE_BLOCK( pxBlock )            ( ( pxBlock->xBlockSize ) |= heapBLOCK_ALLOCATED_BITMASK )
+#define heapFREE_BLOCK( pxBlock )                ( ( pxBlock->xBlockSize ) &= ~heapBLOCK_ALLOCATED_BITMASK )
+#define heapBLOCK_SIZE( pxBlock )                ( ( pxBlock->xBlockSize ) & ~heapBLOCK_ALLOCATED_BITMASK )
+
+/* Each first level list covers a power of two range of block sizes, which is
+ * divided into heapSECOND_LEVEL_COUNT second level lists of equal width.
+ * Blocks smaller than heapSMALL_BLOCK_SIZE are all held in the first first
+ * level list, divided into second level lists heapSMALL_BLOCK_STEP bytes
+ * wide. */
+#define heapSECOND_LEVEL_COUNT_LOG2    ( ( size_t ) 3 )
+#define heapSECOND_LEVEL_COUNT         ( ( size_t ) 1 << heapSECOND_LEVEL_COUNT_LOG2 )
+#define heapFIRST_LEVEL_SHIFT          ( heapSECOND_LEVEL_COUNT_LOG2 + ( size_t ) 4 )
+#define heapSMALL_BLOCK_SIZE           ( ( size_t ) 1 << heapFIRST_LEVEL_SHIFT )
+#define heapSMALL_BLOCK_STEP           ( heapSMALL_BLOCK_SIZE / heapSECOND_LEVEL_COUNT )
+#define heapFIRST_LEVEL_COUNT          ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - heapFIRST_LEVEL_SHIFT + ( size_t ) 1 )
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the heap. */
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+ * heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Define the structure placed at the start of each block.  Only the first two
+ * members are kept while the block is allocated, the links to the other free
+ * blocks of a similar size overlap the memory returned to the application. */
+typedef struct A_BLOCK_LINK
+{
+    struct A_BLOCK_LINK * pxPreviousPhysicalBlock; /**< The block immediately before this block in memory, or NULL for the first block. */
+    size_t xBlockSize;                             /**< The size of the block. */
+    struct A_BLOCK_LINK * pxNextFreeBlock;         /**< The next block in the same free list.  Only valid while the block is free. */
+    struct A_BLOCK_LINK * pxPreviousFreeBlock;     /**< The previous block in the same free list.  Only valid while the block is free. */
+} BlockLink_t;
+
+/* Setting configENABLE_HEAP_PROTECTOR to 1 enables heap block pointers
+ * protection using an application supplied canary value to catch heap
+ * corruption should a heap buffer overflow occur.
+ */
+#if ( configENABLE_HEAP_PROTECTOR == 1 )
+
+/**
+ * @brief Application provided function to get a random value to be used as canary.
+ *
+ * @param pxHeapCanary [out] Output parameter to return the canary value.
+ */
+    extern void vApplicationGetRandomHeapCanary( portPOINTER_SIZE_TYPE * pxHeapCanary );
+
+/* Canary value for protecting internal heap pointers. */
+    PRIVILEGED_DATA static portPOINTER_SIZE_TYPE xHeapCanary;
+
+/* Macro to load/store BlockLink_t pointers to memory. By XORing the
+ * pointers with a random canary value, heap overflows will result
+ * in randomly unpredictable pointer values which will be caught by
+ * heapVALIDATE_BLOCK_POINTER assert. */
+    #define heapPROTECT_BLOCK_POINTER( pxBlock )    ( ( BlockLink_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxBlock ) ) ^ xHeapCanary ) )
+#else
+
+    #define heapPROTECT_BLOCK_POINTER( pxBlock )    ( pxBlock )
+
+#endif /* configENABLE_HEAP_PROTECTOR */
+
+/* Assert that a heap block pointer is within the heap bounds. */
+#define heapVALIDATE_BLOCK_POINTER( pxBlock )                          \
+    configASSERT( ( ( uint8_t * ) ( pxBlock ) >= &( ucHeap[ 0 ] ) ) && \
+                  ( ( uint8_t * ) ( pxBlock ) <= &( ucHeap[ configTOTAL_HEAP_SIZE - 1 ] ) ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Calculates the first and second level list indexes of the list that holds
+ * free blocks of xBlockSize bytes.
+ */
+static void prvGetListIndexes( size_t xBlockSize,
+                               size_t * pxFirstLevel,
+                               size_t * pxSecondLevel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index of the most significant bit set in xValue, which must not
+ * be zero.
+ */
+static size_t prvHighestBitSet( size_t xValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds a free block to, or removes a free block from, the list that holds
+ * blocks of its size.
+ */
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove ) PRIVILEGED_FUNCTION;
+
+/*
+ * Finds a free block of at least xWantedSize bytes and removes it from its
+ * free list.  Returns NULL if there is no such block.
+ */
+static BlockLink_t * prvTakeFreeBlock( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the block immediately after pxBlock in memory.
+ */
+static BlockLink_t * prvNextPhysicalBlock( const BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the BlockLink_t structure kept at the beginning of
+ * each allocated memory block, which must by correctly byte aligned. */
+static const size_t xHeapStructSize = ( ( sizeof( BlockLink_t * ) + sizeof( size_t ) ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Block sizes must not get too small - a free block must be able to hold a
+ * whole BlockLink_t structure. */
+static const size_t xHeapMinimumBlockSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* The heads of the free lists, and bitmaps that mark the first level lists
+ * that contain a non-empty second level list and the second level lists that
+ * are not empty. */
+PRIVILEGED_DATA static BlockLink_t * pxFreeLists[ heapFIRST_LEVEL_COUNT ][ heapSECOND_LEVEL_COUNT ];
+PRIVILEGED_DATA static size_t xFirstLevelBitmap = ( size_t ) 0U;
+PRIVILEGED_DATA static uint8_t ucSecondLevelBitmaps[ heapFIRST_LEVEL_COUNT ];
+
+/* Marks the end of the heap.  A zero sized block that is always allocated,
+ * so the last real block never tries to merge with the memory after it. */
+PRIVILEGED_DATA static BlockLink_t * pxEnd = NULL;
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = ( size_t ) 0U;
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxNewBlockLink;
+    void * pvReturn = NULL;
+    size_t xAdditionalRequiredSize;
+    size_t xAllocatedBlockSize = 0;
+
+    if( xWantedSize > 0 )
+    {
+        /* The wanted size must be increased so it can contain the part of the
+         * BlockLink_t structure kept in an allocated block in addition to the
+         * requested amount of bytes. */
+        if( heapADD_WILL_OVERFLOW( xWantedSize, xHeapStructSize ) == 0 )
+        {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned to the required number
+             * of bytes. */
+            if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+            {
+                /* Byte alignment required. */
+                xAdditionalRequiredSize = portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK );
+
+                if( heapADD_WILL_OVERFLOW( xWantedSize, xAdditionalRequiredSize ) == 0 )
+                {
+                    xWantedSize += xAdditionalRequiredSize;
+                }
+                else
+                {
+                    xWantedSize = 0;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The block must be large enough to hold the free list links once
+             * it is freed again. */
+            if( ( xWantedSize != 0 ) && ( xWantedSize < xHeapMinimumBlockSize ) )
+            {
+                xWantedSize = xHeapMinimumBlockSize;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xWantedSize = 0;
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc then the heap will require
+         * initialisation to setup the list of free blocks. */
+        if( pxEnd == NULL )
+        {
+            prvHeapInit();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Check the block size we are trying to allocate is not so large that the
+         * top bit is set.  The top bit of the block size member of the BlockLink_t
+         * structure is used to determine who owns the block - the application or
+         * the kernel, so it must be free. */
+        if( heapBLOCK_SIZE_IS_VALID( xWantedSize ) != 0 )
+        {
+            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            {
+                pxBlock = prvTakeFreeBlock( xWantedSize );
+
+                if( pxBlock != NULL )
+                {
+                    /* Return the memory space pointed to - jumping over the
+                     * part of the BlockLink_t structure at its start. */
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+                    heapVALIDATE_BLOCK_POINTER( pvReturn );
+
+                    /* If the block is larger than required it can be split into
+                     * two. */
+                    configASSERT( heapSUBTRACT_WILL_UNDERFLOW( pxBlock->xBlockSize, xWantedSize ) == 0 );
+
+                    if( ( pxBlock->xBlockSize - xWantedSize ) >= xHeapMinimumBlockSize )
+                    {
+                        /* This block is to be split into two.  Create a new
+                         * block following the number of bytes requested. The void
+                         * cast is used to prevent byte alignment warnings from the
+                         * compiler. */
+                        pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                        configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+                        /* Calculate the sizes of two blocks split from the
+                         * single block. */
+                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                        pxBlock->xBlockSize = xWantedSize;
+
+                        /* Link the new block between this block and the block
+                         * after it, then insert it into the list of free
+                         * blocks of its size. */
+                        pxNewBlockLink->pxPreviousPhysicalBlock = heapPROTECT_BLOCK_POINTER( pxBlock );
+                        prvNextPhysicalBlock( pxNewBlockLink )->pxPreviousPhysicalBlock = heapPROTECT_BLOCK_POINTER( pxNewBlockLink );
+                        prvInsertBlockIntoFreeList( pxNewBlockLink );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                    {
+                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xAllocatedBlockSize = pxBlock->xBlockSize;
+
+                    /* The block is being returned - it is allocated and owned
+                     * by the application. */
+                    heapALLOCATE_BLOCK( pxBlock );
+                    xNumberOfSuccessfulAllocations++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xAllocatedBlockSize );
+
+        /* Prevent compiler warnings when trace macros are not used. */
+        ( void ) xAllocatedBlockSize;
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+    BlockLink_t * pxAdjacentBlock;
+    size_t xFreedBlockSize;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have part of a BlockLink_t structure
+         * immediately before it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        heapVALIDATE_BLOCK_POINTER( pxLink );
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
+
+        if( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 )
+        {
+            /* The block after this one must still record this block as the
+             * block before it, otherwise the heap has been corrupted. */
+            pxAdjacentBlock = prvNextPhysicalBlock( pxLink );
+            heapVALIDATE_BLOCK_POINTER( pxAdjacentBlock );
+            configASSERT( heapPROTECT_BLOCK_POINTER( pxAdjacentBlock->pxPreviousPhysicalBlock ) == pxLink );
+
+            if( heapPROTECT_BLOCK_POINTER( pxAdjacentBlock->pxPreviousPhysicalBlock ) == pxLink )
+            {
+                /* The block is being returned to the heap - it is no longer
+                 * allocated. */
+                heapFREE_BLOCK( pxLink );
+                #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+                {
+                    /* Check for underflow as this can occur if xBlockSize is
+                     * overwritten in a heap block. */
+                    if( heapSUBTRACT_WILL_UNDERFLOW( pxLink->xBlockSize, xHeapStructSize ) == 0 )
+                    {
+                        ( void ) memset( puc + xHeapStructSize, 0, pxLink->xBlockSize - xHeapStructSize );
+                    }
+                }
+                #endif
+
+                vTaskSuspendAll();
+                {
+                    xFreedBlockSize = pxLink->xBlockSize;
+                    xFreeBytesRemaining += xFreedBlockSize;
+                    traceFREE( pv, xFreedBlockSize );
+
+                    /* Merge with the block after this one if it is free. */
+                    if( heapBLOCK_IS_ALLOCATED( pxAdjacentBlock ) == 0 )
+                    {
+                        prvRemoveBlockFromFreeList( pxAdjacentBlock );
+                        pxLink->xBlockSize += pxAdjacentBlock->xBlockSize;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Merge with the block before this one if it is free. */
+                    pxAdjacentBlock = heapPROTECT_BLOCK_POINTER( pxLink->pxPreviousPhysicalBlock );
+
+                    if( pxAdjacentBlock != NULL )
+                    {
+                        heapVALIDATE_BLOCK_POINTER( pxAdjacentBlock );
+
+                        if( heapBLOCK_IS_ALLOCATED( pxAdjacentBlock ) == 0 )
+                        {
+                            prvRemoveBlockFromFreeList( pxAdjacentBlock );
+                            pxAdjacentBlock->xBlockSize += pxLink->xBlockSize;
+                            pxLink = pxAdjacentBlock;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Add the resulting block to the list of free blocks. */
+                    prvNextPhysicalBlock( pxLink )->pxPreviousPhysicalBlock = heapPROTECT_BLOCK_POINTER( pxLink );
+                    prvInsertBlockIntoFreeList( pxLink );
+                    xNumberOfSuccessfulFrees++;
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void xPortResetHeapMinimumEverFreeHeapSize( void )
+{
+    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvHighestBitSet( size_t xValue ) /* PRIVILEGED_FUNCTION */
+{
+    size_t xBit = 0;
+    size_t xShift = ( sizeof( size_t ) * heapBITS_PER_BYTE ) >> 1;
+
+    configASSERT( xValue != 0 );
+
+    /* Halve the range of bits searched each time round, so the number of
+     * steps depends only on the width of size_t. */
+    while( xShift != 0 )
+    {
+        if( ( xValue >> xShift ) != 0 )
+        {
+            xValue >>= xShift;
+            xBit += xShift;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xShift >>= 1;
+    }
+
+    return xBit;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetListIndexes( size_t xBlockSize,
+                               size_t * pxFirstLevel,
+                               size_t * pxSecondLevel ) /* PRIVILEGED_FUNCTION */
+{
+    size_t xHighestBit;
+
+    if( xBlockSize < heapSMALL_BLOCK_SIZE )
+    {
+        *pxFirstLevel = 0;
+        *pxSecondLevel = xBlockSize / heapSMALL_BLOCK_STEP;
+    }
+    else
+    {
+        xHighestBit = prvHighestBitSet( xBlockSize );
+        *pxFirstLevel = xHighestBit - ( heapFIRST_LEVEL_SHIFT - ( size_t ) 1 );
+        *pxSecondLevel = ( xBlockSize >> ( xHighestBit - heapSECOND_LEVEL_COUNT_LOG2 ) ) ^ heapSECOND_LEVEL_COUNT;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvNextPhysicalBlock( const BlockLink_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxNextBlock;
+
+    /* The void cast is used to prevent byte alignment warnings from the
+     * compiler. */
+    pxNextBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapBLOCK_SIZE( pxBlock ) );
+    heapVALIDATE_BLOCK_POINTER( pxNextBlock );
+
+    return pxNextBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVILEGED_FUNCTION */
+{
+    size_t xFirstLevel, xSecondLevel;
+    BlockLink_t * pxHead;
+
+    prvGetListIndexes( pxBlockToInsert->xBlockSize, &xFirstLevel, &xSecondLevel );
+
+    /* Insert the block at the head of its list. */
+    pxHead = pxFreeLists[ xFirstLevel ][ xSecondLevel ];
+    pxBlockToInsert->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxHead );
+    pxBlockToInsert->pxPreviousFreeBlock = heapPROTECT_BLOCK_POINTER( NULL );
+
+    if( pxHead != NULL )
+    {
+        pxHead->pxPreviousFreeBlock = heapPROTECT_BLOCK_POINTER( pxBlockToInsert );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxFreeLists[ xFirstLevel ][ xSecondLevel ] = pxBlockToInsert;
+
+    /* Mark the list as not empty. */
+    xFirstLevelBitmap |= ( ( size_t ) 1 ) << xFirstLevel;
+    ucSecondLevelBitmaps[ xFirstLevel ] |= ( uint8_t ) ( 1U << xSecondLevel );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove ) /* PRIVILEGED_FUNCTION */
+{
+    size_t xFirstLevel, xSecondLevel;
+    BlockLink_t * pxNext;
+    BlockLink_t * pxPrevious;
+
+    prvGetListIndexes( pxBlockToRemove->xBlockSize, &xFirstLevel, &xSecondLevel );
+
+    pxNext = heapPROTECT_BLOCK_POINTER( pxBlockToRemove->pxNextFreeBlock );
+    pxPrevious = heapPROTECT_BLOCK_POINTER( pxBlockToRemove->pxPreviousFreeBlock );
+
+    if( pxNext != NULL )
+    {
+        heapVALIDATE_BLOCK_POINTER( pxNext );
+        pxNext->pxPreviousFreeBlock = heapPROTECT_BLOCK_POINTER( pxPrevious );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxPrevious != NULL )
+    {
+        heapVALIDATE_BLOCK_POINTER( pxPrevious );
+        pxPrevious->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxNext );
+    }
+    else
+    {
+        /* The block was at the head of its list. */
+        configASSERT( pxFreeLists[ xFirstLevel ][ xSecondLevel ] == pxBlockToRemove );
+        pxFreeLists[ xFirstLevel ][ xSecondLevel ] = pxNext;
+
+        if( pxNext == NULL )
+        {
+            /* The list is now empty. */
+            ucSecondLevelBitmaps[ xFirstLevel ] &= ( uint8_t ) ~( 1U << xSecondLevel );
+
+            if( ucSecondLevelBitmaps[ xFirstLevel ] == 0U )
+            {
+                xFirstLevelBitmap &= ~( ( ( size_t ) 1 ) << xFirstLevel );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvTakeFreeBlock( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+{
+    size_t xFirstLevel, xSecondLevel, xBitmap, xSearchSize;
+    BlockLink_t * pxBlock = NULL;
+
+    /* Round the wanted size up to the start of the next list, so every block
+     * in the list found is large enough. */
+    if( xWantedSize >= heapSMALL_BLOCK_SIZE )
+    {
+        xSearchSize = xWantedSize + ( ( ( size_t ) 1 ) << ( prvHighestBitSet( xWantedSize ) - heapSECOND_LEVEL_COUNT_LOG2 ) ) - ( size_t ) 1;
+    }
+    else
+    {
+        xSearchSize = xWantedSize + heapSMALL_BLOCK_STEP - ( size_t ) 1;
+    }
+
+    if( heapBLOCK_SIZE_IS_VALID( xSearchSize ) != 0 )
+    {
+        prvGetListIndexes( xSearchSize, &xFirstLevel, &xSecondLevel );
+
+        /* Look for a non-empty list of the same or larger blocks in the same
+         * first level list. */
+        xBitmap = ( size_t ) ucSecondLevelBitmaps[ xFirstLevel ] & ( heapSIZE_MAX << xSecondLevel );
+
+        if( xBitmap == 0 )
+        {
+            /* Otherwise use the smallest list in the next non-empty first
+             * level list. */
+            if( ( xFirstLevel + ( size_t ) 1 ) < heapFIRST_LEVEL_COUNT )
+            {
+                xBitmap = xFirstLevelBitmap & ( heapSIZE_MAX << ( xFirstLevel + ( size_t ) 1 ) );
+            }
+            else
+            {
+                xBitmap = 0;
+            }
+
+            if( xBitmap != 0 )
+            {
+                /* The lowest bit set is the only bit left set in
+                 * xBitmap & -xBitmap. */
+                xFirstLevel = prvHighestBitSet( xBitmap & ( ~xBitmap + ( size_t ) 1 ) );
+                xBitmap = ( size_t ) ucSecondLevelBitmaps[ xFirstLevel ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xBitmap != 0 )
+        {
+            xSecondLevel = prvHighestBitSet( xBitmap & ( ~xBitmap + ( size_t ) 1 ) );
+            pxBlock = pxFreeLists[ xFirstLevel ][ xSecondLevel ];
+            heapVALIDATE_BLOCK_POINTER( pxBlock );
+            configASSERT( pxBlock->xBlockSize >= xWantedSize );
+            prvRemoveBlockFromFreeList( pxBlock );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxFirstFreeBlock;
+    portPOINTER_SIZE_TYPE uxStartAddress, uxEndAddress;
+    size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+
+    /* Ensure the heap starts on a correctly aligned boundary. */
+    uxStartAddress = ( portPOINTER_SIZE_TYPE ) ucHeap;
+
+    if( ( uxStartAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    {
+        uxStartAddress += ( portBYTE_ALIGNMENT - 1 );
+        uxStartAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+        xTotalHeapSize -= ( size_t ) ( uxStartAddress - ( portPOINTER_SIZE_TYPE ) ucHeap );
+    }
+
+    #if ( configENABLE_HEAP_PROTECTOR == 1 )
+    {
+        vApplicationGetRandomHeapCanary( &( xHeapCanary ) );
+    }
+    #endif
+
+    /* pxEnd is used to mark the end of the heap and is inserted at the end of
+     * the heap space.  It is marked as allocated so it is never merged with
+     * the block before it. */
+    uxEndAddress = uxStartAddress + ( portPOINTER_SIZE_TYPE ) xTotalHeapSize;
+    uxEndAddress -= ( portPOINTER_SIZE_TYPE ) xHeapStructSize;
+    uxEndAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+    pxEnd = ( BlockLink_t * ) uxEndAddress;
+    pxEnd->xBlockSize = 0;
+    heapALLOCATE_BLOCK( pxEnd );
+
+    /* To start with there is a single free block that is sized to take up the
+     * entire heap space, minus the space taken by pxEnd. */
+    pxFirstFreeBlock = ( BlockLink_t * ) uxStartAddress;
+    pxFirstFreeBlock->xBlockSize = ( size_t ) ( uxEndAddress - ( portPOINTER_SIZE_TYPE ) pxFirstFreeBlock );
+    pxFirstFreeBlock->pxPreviousPhysicalBlock = heapPROTECT_BLOCK_POINTER( NULL );
+    pxEnd->pxPreviousPhysicalBlock = heapPROTECT_BLOCK_POINTER( pxFirstFreeBlock );
+    prvInsertBlockIntoFreeList( pxFirstFreeBlock );
+
+    /* Only one block exists - and it covers the entire usable heap space. */
+    xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+    xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    size_t xFirstLevel, xSecondLevel;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+
+    vTaskSuspendAll();
+    {
+        /* Walk every non-empty free list.  The lists will all be empty if the
+         * heap has not been initialised.  The heap is initialised
+         * automatically when the first allocation is made. */
+        for( xFirstLevel = 0; xFirstLevel < heapFIRST_LEVEL_COUNT; xFirstLevel++ )
+        {
+            for( xSecondLevel = 0; xSecondLevel < heapSECOND_LEVEL_COUNT; xSecondLevel++ )
+            {
+                pxBlock = pxFreeLists[ xFirstLevel ][ xSecondLevel ];
+
+                while( pxBlock != NULL )
+                {
+                    heapVALIDATE_BLOCK_POINTER( pxBlock );
+
+                    /* Increment the number of blocks and record the largest
+                     * block seen so far. */
+                    xBlocks++;
+
+                    if( pxBlock->xBlockSize > xMaxSize )
+                    {
+                        xMaxSize = pxBlock->xBlockSize;
+                    }
+
+                    if( pxBlock->xBlockSize < xMinSize )
+                    {
+                        xMinSize = pxBlock->xBlockSize;
+                    }
+
+                    pxBlock = heapPROTECT_BLOCK_POINTER( pxBlock->pxNextFreeBlock );
+                }
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Reset the state in this file. This state is normally initialized at start up.
+ * This function must be called by the application before restarting the
+ * scheduler.
+ */
+void vPortHeapResetState( void )
+{
+    pxEnd = NULL;
+
+    ( void ) memset( pxFreeLists, 0, sizeof( pxFreeLists ) );
+    ( void ) memset( ucSecondLevelBitmaps, 0, sizeof( ucSecondLevelBitmaps ) );
+    xFirstLevelBitmap = ( size_t ) 0U;
+
+    xFreeBytesRemaining = ( size_t ) 0U;
+    xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
+    xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+    xNumberOfSuccessfulFrees = ( size_t ) 0U;
+}
+/*-----------------------------------------------------------*/
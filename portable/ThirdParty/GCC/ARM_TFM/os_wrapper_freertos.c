@@ -26,6 +26,9 @@
  * This file contains the implementation of APIs which are defined in
  * \interface/include/os_wrapper/mutex.h by TF-M(tag: TF-Mv2.0.0).
  * The implementation is based on FreeRTOS mutex type semaphore.
+ *
+ * It also contains the optional secure call service declared in
+ * tfm_secure_call_service.h.
  */
 
 #include "os_wrapper/mutex.h"
@@ -33,6 +36,7 @@
 #include "FreeRTOS.h"
 #include "semphr.h"
 #include "mpu_wrappers.h"
+#include "tfm_secure_call_service.h"
 
 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
 
@@ -110,3 +114,121 @@ uint32_t os_wrapper_mutex_delete( void * handle )
     return OS_WRAPPER_SUCCESS;
 }
 /*-----------------------------------------------------------*/
+
+#if ( configTFM_SECURE_CALL_SERVICE == 1 )
+
+/*
+ * Asynchronous submission of secure calls, see tfm_secure_call_service.h.
+ */
+    static QueueHandle_t xSecureCallQueue = NULL;
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+        static StaticQueue_t xSecureCallQueueBuffer;
+        static uint8_t ucSecureCallQueueStorage[ configTFM_SECURE_CALL_QUEUE_LENGTH * sizeof( TFMSecureCall_t * ) ];
+        static StaticTask_t xSecureCallTaskBuffer;
+        static StackType_t uxSecureCallTaskStack[ configTFM_SECURE_CALL_TASK_STACK_DEPTH ];
+    #endif
+
+    static void prvSecureCallServiceTask( void * pvParameters )
+    {
+        TFMSecureCall_t * pxBatch[ configTFM_SECURE_CALL_QUEUE_LENGTH ];
+        UBaseType_t uxCount, x;
+
+        ( void ) pvParameters;
+
+        for( ; ; )
+        {
+            /* Block for the first request, then take any others that are
+             * already queued so the whole batch crosses into the secure side
+             * without a context switch between calls. */
+            if( xQueueReceive( xSecureCallQueue, &( pxBatch[ 0 ] ), portMAX_DELAY ) == pdPASS )
+            {
+                uxCount = 1;
+
+                while( ( uxCount < configTFM_SECURE_CALL_QUEUE_LENGTH ) &&
+                       ( xQueueReceive( xSecureCallQueue, &( pxBatch[ uxCount ] ), 0 ) == pdPASS ) )
+                {
+                    uxCount++;
+                }
+
+                for( x = 0; x < uxCount; x++ )
+                {
+                    pxBatch[ x ]->lResult = tfm_ns_interface_dispatch( pxBatch[ x ]->xFunction,
+                                                                       pxBatch[ x ]->ulArguments[ 0 ],
+                                                                       pxBatch[ x ]->ulArguments[ 1 ],
+                                                                       pxBatch[ x ]->ulArguments[ 2 ],
+                                                                       pxBatch[ x ]->ulArguments[ 3 ] );
+                }
+
+                /* Report completion of the whole batch at once. */
+                vTaskSuspendAll();
+                {
+                    for( x = 0; x < uxCount; x++ )
+                    {
+                        ( void ) xTaskNotifyGiveIndexed( pxBatch[ x ]->xTaskToNotify, configTFM_SECURE_CALL_NOTIFY_INDEX );
+                    }
+                }
+                ( void ) xTaskResumeAll();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTFMSecureCallServiceStart( UBaseType_t uxPriority )
+    {
+        BaseType_t xReturn = pdFAIL;
+        TaskHandle_t xHandle = NULL;
+
+        configASSERT( xSecureCallQueue == NULL );
+
+        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        {
+            xSecureCallQueue = xQueueCreate( configTFM_SECURE_CALL_QUEUE_LENGTH, sizeof( TFMSecureCall_t * ) );
+
+            if( xSecureCallQueue != NULL )
+            {
+                xReturn = xTaskCreate( prvSecureCallServiceTask, "TFMCall", configTFM_SECURE_CALL_TASK_STACK_DEPTH, NULL, uxPriority, &xHandle );
+
+                if( xReturn != pdPASS )
+                {
+                    vQueueDelete( xSecureCallQueue );
+                    xSecureCallQueue = NULL;
+                }
+            }
+        }
+        #else /* configSUPPORT_DYNAMIC_ALLOCATION */
+        {
+            xSecureCallQueue = xQueueCreateStatic( configTFM_SECURE_CALL_QUEUE_LENGTH,
+                                                   sizeof( TFMSecureCall_t * ),
+                                                   ucSecureCallQueueStorage,
+                                                   &xSecureCallQueueBuffer );
+            xHandle = xTaskCreateStatic( prvSecureCallServiceTask, "TFMCall", configTFM_SECURE_CALL_TASK_STACK_DEPTH, NULL,
+                                         uxPriority, uxSecureCallTaskStack, &xSecureCallTaskBuffer );
+
+            if( ( xSecureCallQueue != NULL ) && ( xHandle != NULL ) )
+            {
+                xReturn = pdPASS;
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTFMSecureCallSubmit( TFMSecureCall_t * pxCall,
+                                     TickType_t xTicksToWait )
+    {
+        configASSERT( pxCall != NULL );
+        configASSERT( xSecureCallQueue != NULL );
+
+        if( pxCall->xTaskToNotify == NULL )
+        {
+            pxCall->xTaskToNotify = xTaskGetCurrentTaskHandle();
+        }
+
+        return xQueueSend( xSecureCallQueue, &pxCall, xTicksToWait );
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configTFM_SECURE_CALL_SERVICE */
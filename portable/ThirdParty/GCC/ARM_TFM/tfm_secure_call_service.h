@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2019-2024, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+/*
+ * Asynchronous submission of TF-M secure calls.
+ *
+ * Tasks queue secure calls to a single non-secure service task which issues
+ * them through tfm_ns_interface_dispatch() in batches, then reports the
+ * completion of each call through a direct to task notification.  Set
+ * configTFM_SECURE_CALL_SERVICE to 1 in FreeRTOSConfig.h to build it.
+ */
+
+#ifndef TFM_SECURE_CALL_SERVICE_H
+#define TFM_SECURE_CALL_SERVICE_H
+
+#include "tfm_ns_interface.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+#ifndef configTFM_SECURE_CALL_SERVICE
+    #define configTFM_SECURE_CALL_SERVICE    0
+#endif
+
+/* The maximum number of secure calls that can be queued, which is also the
+ * maximum number of calls dispatched in one batch. */
+#ifndef configTFM_SECURE_CALL_QUEUE_LENGTH
+    #define configTFM_SECURE_CALL_QUEUE_LENGTH    8
+#endif
+
+/* The stack depth, in words, of the service task. */
+#ifndef configTFM_SECURE_CALL_TASK_STACK_DEPTH
+    #define configTFM_SECURE_CALL_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#endif
+
+/* The index within the submitting task's notification array used to report
+ * that a secure call has completed. */
+#ifndef configTFM_SECURE_CALL_NOTIFY_INDEX
+    #define configTFM_SECURE_CALL_NOTIFY_INDEX    0
+#endif
+
+#if ( configTFM_SECURE_CALL_NOTIFY_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+    #error configTFM_SECURE_CALL_NOTIFY_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+#endif
+
+/*
+ * A secure call request.  The structure is owned by the submitting task and
+ * must remain valid until the completion notification is received, at which
+ * point lResult holds the value returned by the secure function.
+ */
+typedef struct xTFM_SECURE_CALL
+{
+    veneer_fn xFunction;      /* The secure (veneer) function to call. */
+    uint32_t ulArguments[ 4 ];
+    int32_t lResult;
+    TaskHandle_t xTaskToNotify; /* Set to NULL to notify the submitting task. */
+} TFMSecureCall_t;
+
+/*
+ * Create the service task and its request queue.  Must be called once, after
+ * tfm_ns_interface_init().  The service task should have a priority at least
+ * as high as the tasks submitting secure calls, so that queued calls are
+ * dispatched back to back.
+ *
+ * Returns pdPASS if the service was created, otherwise pdFAIL.
+ */
+BaseType_t xTFMSecureCallServiceStart( UBaseType_t uxPriority );
+
+/*
+ * Queue a secure call to be made by the service task.  Returns pdPASS if the
+ * call was queued, or errQUEUE_FULL if the queue remained full for
+ * xTicksToWait ticks.  Once the call has been made the task to notify has the
+ * notification at index configTFM_SECURE_CALL_NOTIFY_INDEX incremented, so a
+ * task can wait for it with:
+ *
+ * ulTaskNotifyTakeIndexed( configTFM_SECURE_CALL_NOTIFY_INDEX, pdTRUE, xTicksToWait );
+ */
+BaseType_t xTFMSecureCallSubmit( TFMSecureCall_t * pxCall,
+                                 TickType_t xTicksToWait );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* TFM_SECURE_CALL_SERVICE_H */
@@ -40,6 +40,12 @@
 * The timer interrupt uses SIGALRM and care is taken to ensure that
 * the signal handler runs only on the thread for the current task.
 *
+* When configNUMBER_OF_CORES is greater than 1 the thread of the task
+* running on each core is resumed, so that many task threads run at the
+* same time. A core is asked to yield by sending SIG_YIELD to the thread
+* of the task it is running, and the tick is delivered to the thread of
+* the task running on core 0.
+*
 * Use of part of the standard C library requires care as some
 * functions can take pthread mutexes internally which can result in
 * deadlocks as the FreeRTOS kernel can switch tasks while they're
@@ -52,10 +58,10 @@
 #ifdef __linux__
     #define _GNU_SOURCE
 #endif
-#include "portmacro.h"
 #include <errno.h>
 #include <pthread.h>
 #include <limits.h>
+#include <sched.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -77,6 +83,7 @@
 /*-----------------------------------------------------------*/
 
 #define SIG_RESUME    SIGUSR1
+#define SIG_YIELD     SIGUSR2
 
 typedef struct THREAD
 {
@@ -85,6 +92,9 @@ typedef struct THREAD
     void * pvParams;
     BaseType_t xDying;
     struct event * ev;
+    #if ( configNUMBER_OF_CORES > 1 )
+        volatile BaseType_t xCoreID; /* Core the thread was last resumed on. */
+    #endif
 } Thread_t;
 
 /*
@@ -109,6 +119,30 @@ static BaseType_t xSchedulerEnd = pdFALSE;
 static pthread_t hTimerTickThread;
 static bool xTimerTickThreadShouldRun;
 static uint64_t prvStartTimeNs;
+static volatile uint32_t ulPendingTicks = 0;
+
+#if ( configUSE_POSIX_SIMULATED_TIME == 1 )
+    typedef struct SIMULATED_INTERRUPT
+    {
+        uint64_t ullCycle;
+        PortSimulatedInterruptHandler_t pxHandler;
+        void * pvParameter;
+    } SimulatedInterrupt_t;
+
+    static uint64_t ullSimulatedCycles = 0;
+    static uint64_t ullSimulatedNextTick = 0;
+    static SimulatedInterrupt_t xSimulatedInterrupts[ configPOSIX_SIMULATED_INTERRUPT_QUEUE_LENGTH ]; /* Sorted by cycle. */
+    static UBaseType_t uxSimulatedInterruptCount = 0;
+    static volatile uint32_t ulSimulationAdvanceRequest = 0;
+    static volatile uint32_t ulSimulatedContextSwitches = 0;
+    static volatile BaseType_t xSimulationRunning = pdFALSE;
+#endif
+
+#if ( configNUMBER_OF_CORES > 1 )
+    static __thread Thread_t * pxThisThread = NULL;
+    static volatile BaseType_t xLockOwner[ 2 ] = { -1, -1 };
+    static UBaseType_t uxLockCount[ 2 ] = { 0 };
+#endif
 /*-----------------------------------------------------------*/
 
 static void prvSetupSignalsAndSchedulerPolicy( void );
@@ -119,8 +153,15 @@ static void prvSwitchThread( Thread_t * xThreadToResume,
 static void prvSuspendSelf( Thread_t * thread );
 static void prvResumeThread( Thread_t * xThreadId );
 static void vPortSystemTickHandler( int sig );
+#if ( configNUMBER_OF_CORES > 1 )
+    static void vPortYieldHandler( int sig );
+#endif
 static void vPortStartFirstTask( void );
 static void prvPortYieldFromISR( void );
+#if ( configUSE_POSIX_SIMULATED_TIME == 1 )
+    static void * prvSimulationDriver( void * arg );
+    static BaseType_t prvSimulationProcessEvents( void );
+#endif
 /*-----------------------------------------------------------*/
 
 static void prvFatalError( const char * pcCall,
@@ -157,6 +198,10 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
     size_t ulStackSize;
     int iRet;
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        UBaseType_t uxSavedMask;
+    #endif
+
     ( void ) pthread_once( &hSigSetupThread, prvSetupSignalsAndSchedulerPolicy );
 
     /*
@@ -177,7 +222,12 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 
     thread->ev = event_create();
 
-    vPortEnterCritical();
+    /* The new thread inherits the signal mask of this one. */
+    #if ( configNUMBER_OF_CORES == 1 )
+        vPortEnterCritical();
+    #else
+        uxSavedMask = xPortSetInterruptMask();
+    #endif
 
     iRet = pthread_create( &thread->pthread, &xThreadAttributes,
                            prvWaitForStart, thread );
@@ -187,7 +237,11 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
         prvFatalError( "pthread_create", iRet );
     }
 
-    vPortExitCritical();
+    #if ( configNUMBER_OF_CORES == 1 )
+        vPortExitCritical();
+    #else
+        vPortClearInterruptMask( uxSavedMask );
+    #endif
 
     return pxTopOfStack;
 }
@@ -195,10 +249,23 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 
 void vPortStartFirstTask( void )
 {
-    Thread_t * pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+    #if ( configNUMBER_OF_CORES == 1 )
+        Thread_t * pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
-    /* Start the first task. */
-    prvResumeThread( pxFirstThread );
+        /* Start the first task. */
+        prvResumeThread( pxFirstThread );
+    #else
+        BaseType_t xCoreID;
+        Thread_t * pxFirstThread;
+
+        /* Start the first task of each core. */
+        for( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+        {
+            pxFirstThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
+            pxFirstThread->xCoreID = xCoreID;
+            prvResumeThread( pxFirstThread );
+        }
+    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 }
 /*-----------------------------------------------------------*/
 
@@ -304,11 +371,25 @@ static void prvPortYieldFromISR( void )
     Thread_t * xThreadToSuspend;
     Thread_t * xThreadToResume;
 
-    xThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+    #if ( configNUMBER_OF_CORES == 1 )
+        xThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
-    vTaskSwitchContext();
+        vTaskSwitchContext();
+
+        xThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+    #else
+        /* Read the core ID before switching: once vTaskSwitchContext() has
+         * released the kernel locks another core may pick this task up and
+         * overwrite it. */
+        const BaseType_t xCoreID = xPortGetCoreID();
+
+        xThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
 
-    xThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        vTaskSwitchContext( xCoreID );
+
+        xThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
+        xThreadToResume->xCoreID = xCoreID;
+    #endif /* if ( configNUMBER_OF_CORES == 1 ) */
 
     prvSwitchThread( xThreadToResume, xThreadToSuspend );
 }
@@ -316,14 +397,113 @@ static void prvPortYieldFromISR( void )
 
 void vPortYield( void )
 {
-    vPortEnterCritical();
+    #if ( configNUMBER_OF_CORES == 1 )
+        vPortEnterCritical();
+
+        prvPortYieldFromISR();
+
+        vPortExitCritical();
+    #else
+        UBaseType_t uxSavedMask = xPortSetInterruptMask();
 
-    prvPortYieldFromISR();
+        prvPortYieldFromISR();
 
-    vPortExitCritical();
+        vPortClearInterruptMask( uxSavedMask );
+    #endif
 }
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+    BaseType_t xPortGetCoreID( void )
+    {
+        /* Threads that do not belong to a task, such as the one that starts
+         * the scheduler, run on core 0. */
+        return ( pxThisThread != NULL ) ? pxThisThread->xCoreID : 0;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortYieldCore( BaseType_t xCoreID )
+    {
+        Thread_t * pxThread = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( xCoreID ) );
+
+        /* Called with the kernel locks held, so the task cannot leave the core
+         * before the signal is sent. If it is switched out before handling the
+         * signal, the signal stays pending and only causes a spurious yield. */
+        ( void ) pthread_kill( pxThread->pthread, SIG_YIELD );
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortRecursiveLock( BaseType_t xLockNum,
+                             BaseType_t xAcquire )
+    {
+        const BaseType_t xCoreID = xPortGetCoreID();
+        BaseType_t xExpected;
+
+        if( xAcquire != pdFALSE )
+        {
+            if( __atomic_load_n( &xLockOwner[ xLockNum ], __ATOMIC_ACQUIRE ) != xCoreID )
+            {
+                xExpected = -1;
+
+                while( __atomic_compare_exchange_n( &xLockOwner[ xLockNum ], &xExpected, xCoreID,
+                                                    false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) == false )
+                {
+                    xExpected = -1;
+                    ( void ) sched_yield();
+                }
+            }
+
+            uxLockCount[ xLockNum ]++;
+        }
+        else
+        {
+            configASSERT( xLockOwner[ xLockNum ] == xCoreID );
+            configASSERT( uxLockCount[ xLockNum ] > 0U );
+
+            uxLockCount[ xLockNum ]--;
+
+            if( uxLockCount[ xLockNum ] == 0U )
+            {
+                __atomic_store_n( &xLockOwner[ xLockNum ], -1, __ATOMIC_RELEASE );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+
+        void vPortGetSpinlock( BaseType_t xCoreID,
+                               BaseType_t * pxSpinlock )
+        {
+            BaseType_t xExpected = -1;
+
+            /* Data group spinlocks are never taken recursively. */
+            configASSERT( __atomic_load_n( pxSpinlock, __ATOMIC_RELAXED ) != xCoreID );
+
+            while( __atomic_compare_exchange_n( pxSpinlock, &xExpected, xCoreID,
+                                                false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) == false )
+            {
+                xExpected = -1;
+                ( void ) sched_yield();
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        void vPortReleaseSpinlock( BaseType_t xCoreID,
+                                   BaseType_t * pxSpinlock )
+        {
+            configASSERT( __atomic_load_n( pxSpinlock, __ATOMIC_RELAXED ) == xCoreID );
+            ( void ) xCoreID;
+
+            __atomic_store_n( pxSpinlock, -1, __ATOMIC_RELEASE );
+        }
+
+    #endif /* if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
 void vPortDisableInterrupts( void )
 {
     pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
@@ -338,15 +518,32 @@ void vPortEnableInterrupts( void )
 
 UBaseType_t xPortSetInterruptMask( void )
 {
-    /* Interrupts are always disabled inside ISRs (signals
-     * handlers). */
-    return ( UBaseType_t ) 0;
+    #if ( configNUMBER_OF_CORES == 1 )
+        /* Interrupts are always disabled inside ISRs (signals
+         * handlers). */
+        return ( UBaseType_t ) 0;
+    #else
+        sigset_t xPreviousMask;
+
+        /* The SMP scheduler also masks interrupts from task context, so
+         * return whether they were already masked. */
+        pthread_sigmask( SIG_BLOCK, &xAllSignals, &xPreviousMask );
+
+        return ( UBaseType_t ) sigismember( &xPreviousMask, SIGALRM );
+    #endif
 }
 /*-----------------------------------------------------------*/
 
 void vPortClearInterruptMask( UBaseType_t uxMask )
 {
-    ( void ) uxMask;
+    #if ( configNUMBER_OF_CORES == 1 )
+        ( void ) uxMask;
+    #else
+        if( uxMask == 0U )
+        {
+            vPortEnableInterrupts();
+        }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -364,25 +561,86 @@ static uint64_t prvGetTimeNs( void )
  * to adjust timing according to full demo requirements */
 /* static uint64_t prvTickCount; */
 
-static void * prvTimerTickHandler( void * arg )
-{
-    ( void ) arg;
+#if ( configUSE_POSIX_SIMULATED_TIME == 0 )
 
-    prvPortSetCurrentThreadName("Scheduler timer");
+    static void prvSleepUntil( const struct timespec * pxDeadline )
+    {
+        #ifdef __APPLE__
+            /* No clock_nanosleep(), so sleep for the time left until the
+             * deadline. */
+            struct timespec xNow;
+            struct timespec xRemaining;
+
+            clock_gettime( CLOCK_MONOTONIC, &xNow );
+            xRemaining.tv_sec = pxDeadline->tv_sec - xNow.tv_sec;
+            xRemaining.tv_nsec = pxDeadline->tv_nsec - xNow.tv_nsec;
+
+            if( xRemaining.tv_nsec < 0 )
+            {
+                xRemaining.tv_sec--;
+                xRemaining.tv_nsec += 1000000000L;
+            }
+
+            if( xRemaining.tv_sec >= 0 )
+            {
+                while( nanosleep( &xRemaining, &xRemaining ) == -1 && errno == EINTR )
+                {
+                }
+            }
+        #else /* __APPLE__ */
+            while( clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, pxDeadline, NULL ) == EINTR )
+            {
+            }
+        #endif /* __APPLE__ */
+    }
+/*-----------------------------------------------------------*/
 
-    while( xTimerTickThreadShouldRun )
+    static void * prvTimerTickHandler( void * arg )
     {
-        /*
-         * signal to the active task to cause tick handling or
-         * preemption (if enabled)
-         */
-        Thread_t * thread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
-        pthread_kill( thread->pthread, SIGALRM );
-        usleep( portTICK_RATE_MICROSECONDS );
+        struct timespec xNextTick;
+
+        ( void ) arg;
+
+        prvPortSetCurrentThreadName("Scheduler timer");
+
+        clock_gettime( CLOCK_MONOTONIC, &xNextTick );
+
+        while( xTimerTickThreadShouldRun )
+        {
+            /*
+             * Sleep until an absolute deadline so that the time taken to
+             * deliver a tick does not delay all of the following ones.
+             */
+            xNextTick.tv_nsec += ( long ) portTICK_RATE_MICROSECONDS * 1000L;
+
+            while( xNextTick.tv_nsec >= 1000000000L )
+            {
+                xNextTick.tv_sec++;
+                xNextTick.tv_nsec -= 1000000000L;
+            }
+
+            prvSleepUntil( &xNextTick );
+
+            /*
+             * Count the tick, then signal to the active task to cause tick
+             * handling or preemption (if enabled). Signals do not queue, so
+             * ticks that elapse while the signal is blocked are caught up
+             * from the count by the next tick interrupt.
+             */
+            ( void ) __atomic_add_fetch( &ulPendingTicks, 1U, __ATOMIC_RELEASE );
+
+            #if ( configNUMBER_OF_CORES == 1 )
+                Thread_t * thread = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+            #else
+                Thread_t * thread = prvGetThreadFromTask( xTaskGetCurrentTaskHandleForCore( 0 ) );
+            #endif
+            pthread_kill( thread->pthread, SIGALRM );
+        }
+
+        return NULL;
     }
 
-    return NULL;
-}
+#endif /* if ( configUSE_POSIX_SIMULATED_TIME == 0 ) */
 /*-----------------------------------------------------------*/
 
 /*
@@ -392,35 +650,326 @@ static void * prvTimerTickHandler( void * arg )
 void prvSetupTimerInterrupt( void )
 {
     xTimerTickThreadShouldRun = true;
-    pthread_create( &hTimerTickThread, NULL, prvTimerTickHandler, NULL );
+
+    #if ( configUSE_POSIX_SIMULATED_TIME == 1 )
+    {
+        /* Cycles consumed before the scheduler started do not count
+         * towards the first tick. */
+        ullSimulatedNextTick = ullSimulatedCycles + ( uint64_t ) configPOSIX_SIMULATED_CYCLES_PER_TICK;
+        xSimulationRunning = pdTRUE;
+        pthread_create( &hTimerTickThread, NULL, prvSimulationDriver, NULL );
+    }
+    #else
+    {
+        pthread_create( &hTimerTickThread, NULL, prvTimerTickHandler, NULL );
+    }
+    #endif
 
     prvStartTimeNs = prvGetTimeNs();
 }
 /*-----------------------------------------------------------*/
 
-static void vPortSystemTickHandler( int sig )
-{
-    Thread_t * pxThreadToSuspend;
-    Thread_t * pxThreadToResume;
+#if ( configNUMBER_OF_CORES == 1 )
+
+    static void vPortSystemTickHandler( int sig )
+    {
+        Thread_t * pxThreadToSuspend;
+        Thread_t * pxThreadToResume;
+        BaseType_t xSwitchRequired = pdFALSE;
 
-    ( void ) sig;
+        ( void ) sig;
 
-    uxCriticalNesting++; /* Signals are blocked in this signal handler. */
+        uxCriticalNesting++; /* Signals are blocked in this signal handler. */
 
-    pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
-    if( xTaskIncrementTick() != pdFALSE )
+        #if ( configUSE_POSIX_SIMULATED_TIME == 1 )
+        {
+            xSwitchRequired = prvSimulationProcessEvents();
+        }
+        #else
+        {
+            uint32_t ulTicks;
+
+            /* Process every tick that elapsed since the last tick interrupt. */
+            ulTicks = __atomic_exchange_n( &ulPendingTicks, 0U, __ATOMIC_ACQUIRE );
+
+            while( ulTicks > 0U )
+            {
+                if( xTaskIncrementTick() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+
+                ulTicks--;
+            }
+        }
+        #endif /* if ( configUSE_POSIX_SIMULATED_TIME == 1 ) */
+
+        if( xSwitchRequired != pdFALSE )
+        {
+            /* Select Next Task. */
+            vTaskSwitchContext();
+
+            pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+            prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+        }
+
+        uxCriticalNesting--;
+    }
+
+#else /* if ( configNUMBER_OF_CORES == 1 ) */
+
+    static void vPortSystemTickHandler( int sig )
     {
-        /* Select Next Task. */
-        vTaskSwitchContext();
+        UBaseType_t uxSavedInterruptStatus;
+        uint32_t ulTicks;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        ( void ) sig;
 
-        pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+        /* Process every tick that elapsed since the last tick interrupt. */
+        ulTicks = __atomic_exchange_n( &ulPendingTicks, 0U, __ATOMIC_ACQUIRE );
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            while( ulTicks > 0U )
+            {
+                if( xTaskIncrementTick() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+
+                ulTicks--;
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-        prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+        if( xSwitchRequired != pdFALSE )
+        {
+            prvPortYieldFromISR();
+        }
     }
+/*-----------------------------------------------------------*/
 
-    uxCriticalNesting--;
-}
+    static void vPortYieldHandler( int sig )
+    {
+        ( void ) sig;
+
+        prvPortYieldFromISR();
+    }
+
+#endif /* if ( configNUMBER_OF_CORES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_POSIX_VIRTUAL_TIME == 1 )
+
+    void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+    {
+        /* Called by the idle task with the scheduler suspended. A nesting
+         * critical section is used because vTaskStepTick() enters one too. */
+        vPortEnterCritical();
+
+        /* Only jump when a task will unblock at a known time and nothing
+         * has become ready since the idle task decided to sleep. */
+        if( eTaskConfirmSleepModeStatus() == eStandardSleep )
+        {
+            vTaskStepTick( xExpectedIdleTime );
+        }
+
+        vPortExitCritical();
+    }
+
+#endif /* if ( configUSE_POSIX_VIRTUAL_TIME == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_POSIX_SIMULATED_TIME == 1 )
+
+    static uint64_t prvSimulationGetNextEvent( void )
+    {
+        uint64_t ullNextEvent = ullSimulatedNextTick;
+
+        if( ( uxSimulatedInterruptCount > 0U ) && ( xSimulatedInterrupts[ 0 ].ullCycle < ullNextEvent ) )
+        {
+            ullNextEvent = xSimulatedInterrupts[ 0 ].ullCycle;
+        }
+
+        return ullNextEvent;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSimulationRaiseIfDue( BaseType_t xEventDue )
+    {
+        /* The tick handler runs as soon as this thread leaves any critical
+         * section it is in. */
+        if( ( xEventDue != pdFALSE ) && ( xSimulationRunning != pdFALSE ) )
+        {
+            pthread_kill( pthread_self(), SIGALRM );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvSimulationProcessEvents( void )
+    {
+        SimulatedInterrupt_t xInterrupt;
+        UBaseType_t uxIndex;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* Called from the tick handler.  Only jump ahead if the idle task is
+         * still the one running, as the request could have been made just
+         * before another task was unblocked. */
+        if( __atomic_exchange_n( &ulSimulationAdvanceRequest, 0U, __ATOMIC_ACQUIRE ) != 0U )
+        {
+            if( ( xTaskGetCurrentTaskHandle() == xTaskGetIdleTaskHandle() ) && ( prvSimulationGetNextEvent() > ullSimulatedCycles ) )
+            {
+                ullSimulatedCycles = prvSimulationGetNextEvent();
+            }
+        }
+
+        /* Process the ticks and interrupts that are due in cycle order.  A
+         * tick comes before an interrupt due on the same cycle. */
+        for( ; ; )
+        {
+            if( ( uxSimulatedInterruptCount > 0U ) &&
+                ( xSimulatedInterrupts[ 0 ].ullCycle <= ullSimulatedCycles ) &&
+                ( xSimulatedInterrupts[ 0 ].ullCycle < ullSimulatedNextTick ) )
+            {
+                /* Remove the interrupt before calling its handler, which may
+                 * schedule it again. */
+                xInterrupt = xSimulatedInterrupts[ 0 ];
+                uxSimulatedInterruptCount--;
+
+                for( uxIndex = 0U; uxIndex < uxSimulatedInterruptCount; uxIndex++ )
+                {
+                    xSimulatedInterrupts[ uxIndex ] = xSimulatedInterrupts[ uxIndex + 1U ];
+                }
+
+                if( xInterrupt.pxHandler( xInterrupt.pvParameter ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+            }
+            else if( ullSimulatedNextTick <= ullSimulatedCycles )
+            {
+                ullSimulatedNextTick += ( uint64_t ) configPOSIX_SIMULATED_CYCLES_PER_TICK;
+
+                if( xTaskIncrementTick() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static void * prvSimulationDriver( void * arg )
+    {
+        TaskHandle_t xIdleTask = xTaskGetIdleTaskHandle();
+
+        ( void ) arg;
+
+        prvPortSetCurrentThreadName("Scheduler timer");
+
+        /* Simulated time only moves on by itself when every task is
+         * blocked.  Nothing happens in the kernel until then except what
+         * the idle task does, which does not depend on the time, so when
+         * this thread notices does not change the outcome of the run. */
+        while( xTimerTickThreadShouldRun )
+        {
+            if( ( __atomic_load_n( &ulSimulationAdvanceRequest, __ATOMIC_ACQUIRE ) == 0U ) &&
+                ( xTaskGetCurrentTaskHandle() == xIdleTask ) )
+            {
+                __atomic_store_n( &ulSimulationAdvanceRequest, 1U, __ATOMIC_RELEASE );
+                pthread_kill( prvGetThreadFromTask( xIdleTask )->pthread, SIGALRM );
+            }
+
+            sched_yield();
+        }
+
+        return NULL;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortSimulationConsumeCycles( uint32_t ulCycles )
+    {
+        BaseType_t xEventDue;
+
+        vPortEnterCritical();
+        {
+            ullSimulatedCycles += ( uint64_t ) ulCycles;
+            xEventDue = ( prvSimulationGetNextEvent() <= ullSimulatedCycles ) ? pdTRUE : pdFALSE;
+        }
+        vPortExitCritical();
+
+        prvSimulationRaiseIfDue( xEventDue );
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xPortSimulationScheduleInterrupt( uint64_t ullCycle,
+                                                 PortSimulatedInterruptHandler_t pxHandler,
+                                                 void * pvParameter )
+    {
+        UBaseType_t uxIndex;
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xEventDue = pdFALSE;
+
+        configASSERT( pxHandler != NULL );
+
+        vPortEnterCritical();
+        {
+            if( uxSimulatedInterruptCount < ( UBaseType_t ) configPOSIX_SIMULATED_INTERRUPT_QUEUE_LENGTH )
+            {
+                /* Interrupts due on the same cycle run in the order they
+                 * were scheduled. */
+                for( uxIndex = uxSimulatedInterruptCount; ( uxIndex > 0U ) && ( xSimulatedInterrupts[ uxIndex - 1U ].ullCycle > ullCycle ); uxIndex-- )
+                {
+                    xSimulatedInterrupts[ uxIndex ] = xSimulatedInterrupts[ uxIndex - 1U ];
+                }
+
+                xSimulatedInterrupts[ uxIndex ].ullCycle = ullCycle;
+                xSimulatedInterrupts[ uxIndex ].pxHandler = pxHandler;
+                xSimulatedInterrupts[ uxIndex ].pvParameter = pvParameter;
+                uxSimulatedInterruptCount++;
+
+                xEventDue = ( ullCycle <= ullSimulatedCycles ) ? pdTRUE : pdFALSE;
+                xReturn = pdPASS;
+            }
+        }
+        vPortExitCritical();
+
+        prvSimulationRaiseIfDue( xEventDue );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint64_t ullPortSimulationGetCycles( void )
+    {
+        uint64_t ullCycles;
+
+        vPortEnterCritical();
+        {
+            ullCycles = ullSimulatedCycles;
+        }
+        vPortExitCritical();
+
+        return ullCycles;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulPortSimulationGetContextSwitches( void )
+    {
+        return ulSimulatedContextSwitches;
+    }
+
+#endif /* if ( configUSE_POSIX_SIMULATED_TIME == 1 ) */
 /*-----------------------------------------------------------*/
 
 void vPortThreadDying( void * pxTaskToDelete,
@@ -452,10 +1001,16 @@ static void * prvWaitForStart( void * pvParams )
 {
     Thread_t * pxThread = pvParams;
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        pxThisThread = pxThread;
+    #endif
+
     prvSuspendSelf( pxThread );
 
     /* Resumed for the first time, unblocks all signals. */
-    uxCriticalNesting = 0;
+    #if ( configNUMBER_OF_CORES == 1 )
+        uxCriticalNesting = 0;
+    #endif
     vPortEnableInterrupts();
 
     /* Set thread name */
@@ -478,7 +1033,9 @@ static void * prvWaitForStart( void * pvParams )
 static void prvSwitchThread( Thread_t * pxThreadToResume,
                              Thread_t * pxThreadToSuspend )
 {
-    BaseType_t uxSavedCriticalNesting;
+    #if ( configNUMBER_OF_CORES == 1 )
+        BaseType_t uxSavedCriticalNesting;
+    #endif
 
     if( pxThreadToSuspend != pxThreadToResume )
     {
@@ -487,9 +1044,16 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
          *
          * The critical section nesting is per-task, so save it on the
          * stack of the current (suspending thread), restoring it when
-         * we switch back to this task.
+         * we switch back to this task. The SMP scheduler keeps it in
+         * the TCB instead.
          */
-        uxSavedCriticalNesting = uxCriticalNesting;
+        #if ( configNUMBER_OF_CORES == 1 )
+            uxSavedCriticalNesting = uxCriticalNesting;
+        #endif
+
+        #if ( configUSE_POSIX_SIMULATED_TIME == 1 )
+            ulSimulatedContextSwitches++;
+        #endif
 
         prvResumeThread( pxThreadToResume );
 
@@ -500,7 +1064,9 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
 
         prvSuspendSelf( pxThreadToSuspend );
 
-        uxCriticalNesting = uxSavedCriticalNesting;
+        #if ( configNUMBER_OF_CORES == 1 )
+            uxCriticalNesting = uxSavedCriticalNesting;
+        #endif
     }
 }
 /*-----------------------------------------------------------*/
@@ -570,15 +1136,41 @@ static void prvSetupSignalsAndSchedulerPolicy( void )
     {
         prvFatalError( "sigaction", errno );
     }
+
+    #if ( configNUMBER_OF_CORES > 1 )
+    {
+        struct sigaction sigyield;
+
+        sigyield.sa_flags = 0;
+        sigyield.sa_handler = vPortYieldHandler;
+        sigfillset( &sigyield.sa_mask );
+
+        iRet = sigaction( SIG_YIELD, &sigyield, NULL );
+
+        if( iRet == -1 )
+        {
+            prvFatalError( "sigaction", errno );
+        }
+    }
+    #endif /* if ( configNUMBER_OF_CORES > 1 ) */
 }
 /*-----------------------------------------------------------*/
 
 uint32_t ulPortGetRunTime( void )
 {
-    struct tms xTimes;
+    #if ( configUSE_POSIX_SIMULATED_TIME == 1 )
+    {
+        /* Keep the run time statistics repeatable too. */
+        return ( uint32_t ) ullPortSimulationGetCycles();
+    }
+    #else
+    {
+        struct tms xTimes;
 
-    times( &xTimes );
+        times( &xTimes );
 
-    return ( uint32_t ) xTimes.tms_utime;
+        return ( uint32_t ) xTimes.tms_utime;
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
@@ -76,6 +76,7 @@ typedef unsigned long    TickType_t;
 #define portTICK_PERIOD_MS                 ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
 #define portTICK_RATE_MICROSECONDS         ( ( TickType_t ) 1000000 / configTICK_RATE_HZ )
 #define portBYTE_ALIGNMENT                 8
+#define portCACHE_LINE_ALIGNED             __attribute__( ( aligned( configCACHE_LINE_SIZE ) ) )
 /*-----------------------------------------------------------*/
 
 /* Scheduler utilities. */
@@ -102,8 +103,6 @@ extern void vPortYield( void );
 /* Critical section management. */
 extern void vPortDisableInterrupts( void );
 extern void vPortEnableInterrupts( void );
-#define portSET_INTERRUPT_MASK()      ( vPortDisableInterrupts() )
-#define portCLEAR_INTERRUPT_MASK()    ( vPortEnableInterrupts() )
 
 extern UBaseType_t xPortSetInterruptMask( void );
 extern void vPortClearInterruptMask( UBaseType_t xMask );
@@ -112,10 +111,69 @@ extern void vPortEnterCritical( void );
 extern void vPortExitCritical( void );
 #define portSET_INTERRUPT_MASK_FROM_ISR()         xPortSetInterruptMask()
 #define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )    vPortClearInterruptMask( x )
-#define portDISABLE_INTERRUPTS()                  portSET_INTERRUPT_MASK()
-#define portENABLE_INTERRUPTS()                   portCLEAR_INTERRUPT_MASK()
-#define portENTER_CRITICAL()                      vPortEnterCritical()
-#define portEXIT_CRITICAL()                       vPortExitCritical()
+
+#if ( configNUMBER_OF_CORES > 1 )
+    #define portSET_INTERRUPT_MASK()                  xPortSetInterruptMask()
+    #define portCLEAR_INTERRUPT_MASK( uxMask )        vPortClearInterruptMask( uxMask )
+
+    #define portDISABLE_INTERRUPTS()                  vPortDisableInterrupts()
+    #define portENABLE_INTERRUPTS()                   vPortEnableInterrupts()
+    #define portENTER_CRITICAL()                      vTaskEnterCritical()
+    #define portEXIT_CRITICAL()                       vTaskExitCritical()
+    #define portENTER_CRITICAL_FROM_ISR()             vTaskEnterCriticalFromISR()
+    #define portEXIT_CRITICAL_FROM_ISR( x )           vTaskExitCriticalFromISR( x )
+#else
+    #define portSET_INTERRUPT_MASK()      ( vPortDisableInterrupts() )
+    #define portCLEAR_INTERRUPT_MASK()    ( vPortEnableInterrupts() )
+
+    #define portDISABLE_INTERRUPTS()      portSET_INTERRUPT_MASK()
+    #define portENABLE_INTERRUPTS()       portCLEAR_INTERRUPT_MASK()
+    #define portENTER_CRITICAL()          vPortEnterCritical()
+    #define portEXIT_CRITICAL()           vPortExitCritical()
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
+/*-----------------------------------------------------------*/
+
+/* Multi-core support.
+ *
+ * Each core is emulated by the pthread of the task that is running on it, so
+ * up to configNUMBER_OF_CORES task threads run concurrently on the host. The
+ * TASK and ISR locks are recursive spinlocks and a core is asked to yield by
+ * sending a signal to the thread of the task it is running. */
+#if ( configNUMBER_OF_CORES > 1 )
+    #define portCRITICAL_NESTING_IN_TCB    1
+
+    extern BaseType_t xPortGetCoreID( void );
+    extern void vPortYieldCore( BaseType_t xCoreID );
+    extern void vPortRecursiveLock( BaseType_t xLockNum,
+                                    BaseType_t xAcquire );
+
+    #define portTASK_LOCK                  0
+    #define portISR_LOCK                   1
+
+    #define portGET_CORE_ID()              xPortGetCoreID()
+    #define portYIELD_CORE( xCoreID )      vPortYieldCore( xCoreID )
+
+    #define portGET_TASK_LOCK()            vPortRecursiveLock( portTASK_LOCK, pdTRUE )
+    #define portRELEASE_TASK_LOCK()        vPortRecursiveLock( portTASK_LOCK, pdFALSE )
+    #define portGET_ISR_LOCK()             vPortRecursiveLock( portISR_LOCK, pdTRUE )
+    #define portRELEASE_ISR_LOCK()         vPortRecursiveLock( portISR_LOCK, pdFALSE )
+
+    /* Data group spinlocks used when configUSE_GRANULAR_LOCKS is 1.  A
+     * spinlock holds the ID of the core that owns it, or -1 when it is free.
+     * It is only taken with interrupts masked and is never taken recursively. */
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        extern void vPortGetSpinlock( BaseType_t xCoreID,
+                                      BaseType_t * pxSpinlock );
+        extern void vPortReleaseSpinlock( BaseType_t xCoreID,
+                                          BaseType_t * pxSpinlock );
+
+        #define portSPINLOCK_TYPE                              BaseType_t
+        #define portINIT_SPINLOCK( pxSpinlock )                ( *( pxSpinlock ) = -1 )
+        #define portGET_SPINLOCK( xCoreID, pxSpinlock )        vPortGetSpinlock( ( xCoreID ), ( pxSpinlock ) )
+        #define portRELEASE_SPINLOCK( xCoreID, pxSpinlock )    vPortReleaseSpinlock( ( xCoreID ), ( pxSpinlock ) )
+    #endif /* configUSE_GRANULAR_LOCKS */
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
 
 /*-----------------------------------------------------------*/
 
@@ -140,6 +198,78 @@ extern void vPortCancelThread( void * pxTaskToDelete );
  */
 #define portMEMORY_BARRIER()                        __asm volatile ( "" ::: "memory" )
 
+/* Virtual time.
+ *
+ * When configUSE_POSIX_VIRTUAL_TIME is 1 and every task is blocked, the tick
+ * count jumps straight to the time at which the next task unblocks instead
+ * of waiting for the real-time ticks, so simulations run faster than real
+ * time. The jump is made through the tickless idle hook, so
+ * configUSE_TICKLESS_IDLE must also be 1. */
+#ifndef configUSE_POSIX_VIRTUAL_TIME
+    #define configUSE_POSIX_VIRTUAL_TIME    0
+#endif
+
+#if ( configUSE_POSIX_VIRTUAL_TIME == 1 )
+    #if ( configUSE_TICKLESS_IDLE != 1 )
+        #error configUSE_POSIX_VIRTUAL_TIME requires configUSE_TICKLESS_IDLE to be 1.
+    #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_POSIX_VIRTUAL_TIME is only supported when configNUMBER_OF_CORES is 1.
+    #endif
+
+    extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+    #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )    vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif /* if ( configUSE_POSIX_VIRTUAL_TIME == 1 ) */
+/*-----------------------------------------------------------*/
+
+/* Simulated time.
+ *
+ * When configUSE_POSIX_SIMULATED_TIME is 1 the tick is not driven by the host
+ * clock. Time is counted in simulated cycles instead, which only advance
+ * when a task calls vPortSimulationConsumeCycles(), or when every task is
+ * blocked, in which case time jumps to the next tick or simulated interrupt.
+ * Ticks and simulated interrupts are processed in cycle order, so runs are
+ * repeatable. A cost model is attached to kernel APIs by defining their
+ * traceENTER_xxx() macros to call vPortSimulationConsumeCycles(). */
+#ifndef configUSE_POSIX_SIMULATED_TIME
+    #define configUSE_POSIX_SIMULATED_TIME    0
+#endif
+
+#if ( configUSE_POSIX_SIMULATED_TIME == 1 )
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_POSIX_SIMULATED_TIME is only supported when configNUMBER_OF_CORES is 1.
+    #endif
+
+    #if ( configUSE_POSIX_VIRTUAL_TIME == 1 )
+        #error configUSE_POSIX_SIMULATED_TIME and configUSE_POSIX_VIRTUAL_TIME cannot both be 1.
+    #endif
+
+    #if ( INCLUDE_xTaskGetIdleTaskHandle != 1 )
+        #error configUSE_POSIX_SIMULATED_TIME requires INCLUDE_xTaskGetIdleTaskHandle to be 1.
+    #endif
+
+    #ifndef configPOSIX_SIMULATED_CYCLES_PER_TICK
+        #define configPOSIX_SIMULATED_CYCLES_PER_TICK    1000U
+    #endif
+
+    #ifndef configPOSIX_SIMULATED_INTERRUPT_QUEUE_LENGTH
+        #define configPOSIX_SIMULATED_INTERRUPT_QUEUE_LENGTH    8
+    #endif
+
+/* A simulated interrupt handler returns pdTRUE if a context switch is
+ * required, for example because a FromISR API woke a higher priority task. */
+    typedef uint32_t ( * PortSimulatedInterruptHandler_t )( void * pvParameter );
+
+    extern void vPortSimulationConsumeCycles( uint32_t ulCycles );
+    extern BaseType_t xPortSimulationScheduleInterrupt( uint64_t ullCycle,
+                                                        PortSimulatedInterruptHandler_t pxHandler,
+                                                        void * pvParameter );
+    extern uint64_t ullPortSimulationGetCycles( void );
+    extern uint32_t ulPortSimulationGetContextSwitches( void );
+#endif /* if ( configUSE_POSIX_SIMULATED_TIME == 1 ) */
+/*-----------------------------------------------------------*/
+
 extern uint32_t ulPortGetRunTime( void );
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    /* no-op */
 #define portGET_RUN_TIME_COUNTER_VALUE()            ulPortGetRunTime()
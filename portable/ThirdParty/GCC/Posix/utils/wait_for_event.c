@@ -32,77 +32,200 @@
 
 #include "wait_for_event.h"
 
-struct event
-{
-    pthread_mutex_t mutex;
-    pthread_cond_t cond;
-    bool event_triggered;
-};
-
-struct event * event_create( void )
-{
-    struct event * ev = malloc( sizeof( struct event ) );
-
-    if( ev != NULL )
+#ifdef __linux__
+
+/*
+ * On Linux an event is a single futex word, so a task switch costs one
+ * FUTEX_WAKE in the signalling thread and one FUTEX_WAIT in the waiting
+ * thread instead of the mutex and condition variable round trips below.
+ * The word is 1 when the event is triggered, 0 when it is not and -1 when
+ * it is not and its (single) waiter is, or is about to be, asleep.
+ */
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+
+    struct event
     {
-        ev->event_triggered = false;
-        pthread_mutex_init( &ev->mutex, NULL );
-        pthread_cond_init( &ev->cond, NULL );
+        int state;
+    };
+
+    static int prvFutex( int * uaddr,
+                         int op,
+                         int val,
+                         const struct timespec * timeout )
+    {
+        return ( int ) syscall( SYS_futex, uaddr, op, val, timeout, NULL, FUTEX_BITSET_MATCH_ANY );
     }
 
-    return ev;
-}
+    struct event * event_create( void )
+    {
+        struct event * ev = malloc( sizeof( struct event ) );
 
-void event_delete( struct event * ev )
-{
-    pthread_mutex_destroy( &ev->mutex );
-    pthread_cond_destroy( &ev->cond );
-    free( ev );
-}
+        if( ev != NULL )
+        {
+            ev->state = 0;
+        }
 
-bool event_wait( struct event * ev )
-{
-    pthread_mutex_lock( &ev->mutex );
+        return ev;
+    }
 
-    while( ev->event_triggered == false )
+    void event_delete( struct event * ev )
     {
-        pthread_cond_wait( &ev->cond, &ev->mutex );
+        free( ev );
     }
 
-    ev->event_triggered = false;
-    pthread_mutex_unlock( &ev->mutex );
-    return true;
-}
-bool event_wait_timed( struct event * ev,
-                       time_t ms )
-{
-    struct timespec ts;
-    int ret = 0;
-
-    clock_gettime( CLOCK_REALTIME, &ts );
-    ts.tv_sec += ms / 1000;
-    ts.tv_nsec += ( ( ms % 1000 ) * 1000000 );
-    pthread_mutex_lock( &ev->mutex );
-
-    while( ( ev->event_triggered == false ) && ( ret == 0 ) )
+    static bool prvEventWait( struct event * ev,
+                              const struct timespec * deadline )
     {
-        ret = pthread_cond_timedwait( &ev->cond, &ev->mutex, &ts );
+        int state = __atomic_load_n( &ev->state, __ATOMIC_RELAXED );
 
-        if( ( ret == -1 ) && ( errno == ETIMEDOUT ) )
+        for( ; ; )
         {
-            return false;
+            if( state == 1 )
+            {
+                /* Consume the event. */
+                if( __atomic_compare_exchange_n( &ev->state, &state, 0, false,
+                                                 __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) )
+                {
+                    return true;
+                }
+            }
+            else if( state == 0 )
+            {
+                /* Announce that a waiter is about to sleep. */
+                ( void ) __atomic_compare_exchange_n( &ev->state, &state, -1, false,
+                                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED );
+            }
+            else
+            {
+                if( ( prvFutex( &ev->state, FUTEX_WAIT_BITSET_PRIVATE, -1, deadline ) == -1 ) &&
+                    ( errno == ETIMEDOUT ) )
+                {
+                    /* Withdraw the waiter unless the event raced in. */
+                    state = -1;
+
+                    if( __atomic_compare_exchange_n( &ev->state, &state, 0, false,
+                                                     __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    state = __atomic_load_n( &ev->state, __ATOMIC_RELAXED );
+                }
+            }
         }
     }
 
-    ev->event_triggered = false;
-    pthread_mutex_unlock( &ev->mutex );
-    return true;
-}
-
-void event_signal( struct event * ev )
-{
-    pthread_mutex_lock( &ev->mutex );
-    ev->event_triggered = true;
-    pthread_cond_signal( &ev->cond );
-    pthread_mutex_unlock( &ev->mutex );
-}
+    bool event_wait( struct event * ev )
+    {
+        return prvEventWait( ev, NULL );
+    }
+
+    bool event_wait_timed( struct event * ev,
+                           time_t ms )
+    {
+        struct timespec ts;
+
+        /* FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline. */
+        clock_gettime( CLOCK_MONOTONIC, &ts );
+        ts.tv_sec += ms / 1000;
+        ts.tv_nsec += ( ( ms % 1000 ) * 1000000 );
+
+        if( ts.tv_nsec >= 1000000000 )
+        {
+            ts.tv_sec++;
+            ts.tv_nsec -= 1000000000;
+        }
+
+        return prvEventWait( ev, &ts );
+    }
+
+    void event_signal( struct event * ev )
+    {
+        if( __atomic_exchange_n( &ev->state, 1, __ATOMIC_RELEASE ) == -1 )
+        {
+            ( void ) prvFutex( &ev->state, FUTEX_WAKE_PRIVATE, 1, NULL );
+        }
+    }
+
+#else /* __linux__ */
+
+    struct event
+    {
+        pthread_mutex_t mutex;
+        pthread_cond_t cond;
+        bool event_triggered;
+    };
+
+    struct event * event_create( void )
+    {
+        struct event * ev = malloc( sizeof( struct event ) );
+
+        if( ev != NULL )
+        {
+            ev->event_triggered = false;
+            pthread_mutex_init( &ev->mutex, NULL );
+            pthread_cond_init( &ev->cond, NULL );
+        }
+
+        return ev;
+    }
+
+    void event_delete( struct event * ev )
+    {
+        pthread_mutex_destroy( &ev->mutex );
+        pthread_cond_destroy( &ev->cond );
+        free( ev );
+    }
+
+    bool event_wait( struct event * ev )
+    {
+        pthread_mutex_lock( &ev->mutex );
+
+        while( ev->event_triggered == false )
+        {
+            pthread_cond_wait( &ev->cond, &ev->mutex );
+        }
+
+        ev->event_triggered = false;
+        pthread_mutex_unlock( &ev->mutex );
+        return true;
+    }
+    bool event_wait_timed( struct event * ev,
+                           time_t ms )
+    {
+        struct timespec ts;
+        int ret = 0;
+
+        clock_gettime( CLOCK_REALTIME, &ts );
+        ts.tv_sec += ms / 1000;
+        ts.tv_nsec += ( ( ms % 1000 ) * 1000000 );
+        pthread_mutex_lock( &ev->mutex );
+
+        while( ( ev->event_triggered == false ) && ( ret == 0 ) )
+        {
+            ret = pthread_cond_timedwait( &ev->cond, &ev->mutex, &ts );
+
+            if( ( ret == -1 ) && ( errno == ETIMEDOUT ) )
+            {
+                return false;
+            }
+        }
+
+        ev->event_triggered = false;
+        pthread_mutex_unlock( &ev->mutex );
+        return true;
+    }
+
+    void event_signal( struct event * ev )
+    {
+        pthread_mutex_lock( &ev->mutex );
+        ev->event_triggered = true;
+        pthread_cond_signal( &ev->cond );
+        pthread_mutex_unlock( &ev->mutex );
+    }
+
+#endif /* __linux__ */
@@ -82,6 +82,7 @@ typedef uint32_t         UBaseType_t;
 #define portTICK_PERIOD_MS              ( ( TickType_t ) 1000 / configTICK_RATE_HZ )
 #define portBYTE_ALIGNMENT              8
 #define portDONT_DISCARD                __attribute__( ( used ) )
+#define portCACHE_LINE_ALIGNED          __attribute__( ( aligned( configCACHE_LINE_SIZE ) ) )
 
 /* We have to use PICO_DIVIDER_DISABLE_INTERRUPTS as the source of truth rather than our config,
  * as our FreeRTOSConfig.h header cannot be included by ASM code - which is what this affects in the SDK */
@@ -154,6 +155,55 @@ void vYieldCore( int xCoreID );
 
 /*-----------------------------------------------------------*/
 
+/* Cross-core mailboxes. */
+#if ( configUSE_PICO_CROSS_CORE_MAILBOX == 1 )
+    #if ( configNUMBER_OF_CORES != portMAX_CORE_COUNT )
+        #error "configUSE_PICO_CROSS_CORE_MAILBOX requires configNUMBER_OF_CORES to be 2"
+    #endif
+
+    #if ( ( configPICO_MAILBOX_LENGTH < 1 ) || ( ( configPICO_MAILBOX_LENGTH & ( configPICO_MAILBOX_LENGTH - 1 ) ) != 0 ) )
+        #error "configPICO_MAILBOX_LENGTH must be a power of two"
+    #endif
+
+/* Messages carry 31 bits, which is enough for a pointer into SRAM. */
+    #define portMAILBOX_MESSAGE_MASK    ( 0x7fffffffUL )
+
+/* Doorbells are numbered 0 to 29. */
+    #define portMAILBOX_DOORBELL_MASK    ( 0x3fffffffUL )
+
+/* Send ulMessage to the mailbox of core xCoreID, blocking for up to
+ * xTicksToWait if it is full.  Returns pdPASS if the message was sent.  May
+ * only be called from a task. */
+    BaseType_t xPortMailboxSend( BaseType_t xCoreID,
+                                 uint32_t ulMessage,
+                                 TickType_t xTicksToWait );
+
+/* Receive the oldest message from the mailbox of core xCoreID, blocking for up
+ * to xTicksToWait if it is empty.  Returns pdPASS if a message was written to
+ * *pulMessage.  Only one task may receive from each mailbox, and it may run on
+ * either core.  May only be called from a task. */
+    BaseType_t xPortMailboxReceive( BaseType_t xCoreID,
+                                    uint32_t * pulMessage,
+                                    TickType_t xTicksToWait );
+
+/* Ring the doorbells set in ulDoorbells on core xCoreID, for example after
+ * writing to a shared memory ring that is too large for a message.  Doorbells
+ * that are already pending are not counted twice.  May be called from a task
+ * or an interrupt. */
+    void vPortDoorbellRing( BaseType_t xCoreID,
+                            uint32_t ulDoorbells );
+
+/* Wait up to xTicksToWait for any of the doorbells set in ulDoorbells to be
+ * rung on core xCoreID.  Returns the doorbells that were pending, which are
+ * cleared, or 0 on timeout.  Only one task may wait on each core's doorbells.
+ * May only be called from a task. */
+    uint32_t ulPortDoorbellWait( BaseType_t xCoreID,
+                                 uint32_t ulDoorbells,
+                                 TickType_t xTicksToWait );
+#endif /* #if ( configUSE_PICO_CROSS_CORE_MAILBOX == 1 ) */
+
+/*-----------------------------------------------------------*/
+
 /* Critical nesting count management. */
 #define portCRITICAL_NESTING_IN_TCB    0
 
@@ -263,6 +313,67 @@ static inline void vPortRecursiveLock( uint32_t ulLockNum,
 
 /*-----------------------------------------------------------*/
 
+/* Compare and swap that is atomic across both cores and with respect to
+ * interrupts on the calling core.  Returns 1 if *pulDestination held
+ * ulComparand and was set to ulExchange, otherwise 0. */
+static inline uint32_t ulPortCompareAndSwap( volatile uint32_t * pulDestination,
+                                             uint32_t ulExchange,
+                                             uint32_t ulComparand )
+{
+    spin_lock_t * pxSpinLock = spin_lock_instance( configSMP_SPINLOCK_ATOMIC );
+    uint32_t ulSavedInterruptStatus = spin_lock_blocking( pxSpinLock );
+    uint32_t ulReturn = 0U;
+
+    if( *pulDestination == ulComparand )
+    {
+        *pulDestination = ulExchange;
+        ulReturn = 1U;
+    }
+
+    spin_unlock( pxSpinLock, ulSavedInterruptStatus );
+
+    return ulReturn;
+}
+
+#define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulExchange, ulComparand )    ulPortCompareAndSwap( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
+
+/*-----------------------------------------------------------*/
+
+/* Data group spinlocks used when configUSE_GRANULAR_LOCKS is 1.  There are
+ * too few hardware spinlocks to give one to every kernel object, so each
+ * spinlock is a word holding one more than the ID of the owning core, or 0
+ * when free, that is claimed with ulPortCompareAndSwap().  It is only taken
+ * with interrupts masked and is never taken recursively. */
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_GRANULAR_LOCKS == 1 ) )
+    static inline void vPortGetSpinlock( BaseType_t xCoreID,
+                                         volatile uint32_t * pulSpinlock )
+    {
+        configASSERT( *pulSpinlock != ( ( uint32_t ) xCoreID + 1U ) );
+
+        while( ulPortCompareAndSwap( pulSpinlock, ( uint32_t ) xCoreID + 1U, 0U ) == 0U )
+        {
+            tight_loop_contents();
+        }
+    }
+
+    static inline void vPortReleaseSpinlock( BaseType_t xCoreID,
+                                             volatile uint32_t * pulSpinlock )
+    {
+        configASSERT( *pulSpinlock == ( ( uint32_t ) xCoreID + 1U ) );
+        ( void ) xCoreID;
+
+        __dmb();
+        *pulSpinlock = 0U;
+    }
+
+    #define portSPINLOCK_TYPE                              volatile uint32_t
+    #define portINIT_SPINLOCK( pxSpinlock )                ( *( pxSpinlock ) = 0U )
+    #define portGET_SPINLOCK( xCoreID, pxSpinlock )        vPortGetSpinlock( ( xCoreID ), ( pxSpinlock ) )
+    #define portRELEASE_SPINLOCK( xCoreID, pxSpinlock )    vPortReleaseSpinlock( ( xCoreID ), ( pxSpinlock ) )
+#endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_GRANULAR_LOCKS == 1 ) ) */
+
+/*-----------------------------------------------------------*/
+
 /* Tickless idle/low power functionality. */
 #ifndef portSUPPRESS_TICKS_AND_SLEEP
     extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
@@ -85,6 +85,34 @@
     #define configSMP_SPINLOCK_1    PICO_SPINLOCK_ID_OS2
 #endif
 
+/* The Cortex-M0+ has no exclusive access instructions, so the compare and swap
+ * used by MPMC queues is made atomic across both cores with a further spin
+ * lock, defaulted here to the one the SDK sets aside for atomic emulation */
+#ifndef configSMP_SPINLOCK_ATOMIC
+    #define configSMP_SPINLOCK_ATOMIC    PICO_SPINLOCK_ID_ATOMIC
+#endif
+
+/* configUSE_PICO_CROSS_CORE_MAILBOX == 1 gives each core a mailbox that tasks
+ * can send 31 bit messages and ring doorbells to without using the kernel
+ * locks.  Words for the other core travel through the SIO FIFO that is also used
+ * for yield requests, and blocked senders and receivers are woken with direct
+ * to task notifications.  Requires configNUMBER_OF_CORES == 2 */
+#ifndef configUSE_PICO_CROSS_CORE_MAILBOX
+    #define configUSE_PICO_CROSS_CORE_MAILBOX    0
+#endif
+
+/* configPICO_MAILBOX_LENGTH is the number of messages each core's mailbox can
+ * hold, which must be a power of two */
+#ifndef configPICO_MAILBOX_LENGTH
+    #define configPICO_MAILBOX_LENGTH    16
+#endif
+
+/* configPICO_MAILBOX_NOTIFICATION_INDEX is the index into the task notification
+ * array used to wake tasks blocked on a mailbox or doorbell */
+#ifndef configPICO_MAILBOX_NOTIFICATION_INDEX
+    #define configPICO_MAILBOX_NOTIFICATION_INDEX    0
+#endif
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
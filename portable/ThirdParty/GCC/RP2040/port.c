@@ -107,6 +107,16 @@ static void vPortStartFirstTask( void ) __attribute__( ( naked ) );
  */
 static void prvTaskExitError( void );
 
+#if ( configUSE_PICO_CROSS_CORE_MAILBOX == 1 )
+
+/*
+ * Read every word from this core's SIO FIFO, delivering mailbox messages and
+ * doorbells.  Called from the FIFO interrupt, and by an interrupt that is
+ * waiting for space in the other core's FIFO.
+ */
+    static void prvMailboxDrainFIFOFromISR( void );
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* Each task maintains its own interrupt status in the critical nesting
@@ -137,6 +147,38 @@ UBaseType_t uxCriticalNestings[ configNUMBER_OF_CORES ] = { 0 };
     #endif
 #endif /* configSUPPORT_PICO_SYNC_INTEROP */
 
+#if ( configUSE_PICO_CROSS_CORE_MAILBOX == 1 )
+    #if ( configUSE_TASK_NOTIFICATIONS == 0 )
+        #error "configUSE_PICO_CROSS_CORE_MAILBOX requires configUSE_TASK_NOTIFICATIONS"
+    #endif
+
+    #if ( configPICO_MAILBOX_NOTIFICATION_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES )
+        #error "configPICO_MAILBOX_NOTIFICATION_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES"
+    #endif
+
+/* Words written to the SIO FIFO.  A zero word is a yield request. */
+    #define portMAILBOX_TAG_MESSAGE     ( 0x80000000UL )
+    #define portMAILBOX_TAG_DOORBELL    ( 0x40000000UL )
+
+/* A core's mailbox.  Messages are only ever written by the core that owns the
+ * mailbox, with interrupts disabled, and only read by the single receiving
+ * task, so the ring itself needs no lock.  Senders claim a slot in
+ * ulReserved before sending so that a message in the FIFO always has room. */
+    typedef struct MailboxCore
+    {
+        uint32_t ulMessages[ configPICO_MAILBOX_LENGTH ];
+        volatile uint32_t ulWritten;            /* Messages delivered, written by the owning core. */
+        volatile uint32_t ulRead;               /* Messages received, written by the receiving task. */
+        volatile uint32_t ulReserved;           /* Slots claimed by senders and not yet freed by the receiver. */
+        volatile uint32_t ulDoorbells;          /* Doorbells rung and not yet taken. */
+        TaskHandle_t volatile xReceivingTask;   /* Task waiting for a message, if any. */
+        TaskHandle_t volatile xSendingTask;     /* Task waiting for a free slot, if any. */
+        TaskHandle_t volatile xDoorbellTask;    /* Task waiting for a doorbell, if any. */
+    } MailboxCore_t;
+
+    static MailboxCore_t xMailboxes[ configNUMBER_OF_CORES ];
+#endif /* configUSE_PICO_CROSS_CORE_MAILBOX */
+
 /*
  * The number of SysTick increments that make up one tick period.
  */
@@ -280,9 +322,14 @@ void vPortStartFirstTask( void )
 #if ( LIB_PICO_MULTICORE == 1 ) && ( configSUPPORT_PICO_SYNC_INTEROP == 1 )
     static void prvFIFOInterruptHandler()
     {
-        /* We must remove the contents (which we don't care about)
-         * to clear the IRQ */
-        multicore_fifo_drain();
+        #if ( configUSE_PICO_CROSS_CORE_MAILBOX == 1 )
+            /* Deliver any mailbox words, which also clears the IRQ */
+            prvMailboxDrainFIFOFromISR();
+        #else
+            /* We must remove the contents (which we don't care about)
+             * to clear the IRQ */
+            multicore_fifo_drain();
+        #endif
 
         /* And explicitly clear any other IRQ flags. */
         multicore_fifo_clear_irq();
@@ -525,6 +572,349 @@ void vYieldCore( int xCoreID )
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_PICO_CROSS_CORE_MAILBOX == 1 )
+
+    static void prvMailboxNotify( TaskHandle_t xTask )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        if( xTask != NULL )
+        {
+            if( portCHECK_IF_IN_ISR() )
+            {
+                vTaskNotifyGiveIndexedFromISR( xTask, configPICO_MAILBOX_NOTIFICATION_INDEX, &xHigherPriorityTaskWoken );
+                portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+            }
+            else
+            {
+                ( void ) xTaskNotifyGiveIndexed( xTask, configPICO_MAILBOX_NOTIFICATION_INDEX );
+            }
+        }
+    }
+
+    static void prvMailboxUpdate( volatile uint32_t * pulValue,
+                                  uint32_t ulSet,
+                                  uint32_t ulClear )
+    {
+        uint32_t ulValue;
+
+        do
+        {
+            ulValue = *pulValue;
+        } while( ulPortCompareAndSwap( pulValue, ( ulValue | ulSet ) & ~ulClear, ulValue ) == 0U );
+    }
+
+    /* Deliver a word to the mailbox of the calling core, which must have
+     * interrupts disabled.  Returns the task to wake, if any. */
+    static TaskHandle_t prvMailboxDeliver( uint32_t ulWord )
+    {
+        MailboxCore_t * pxMailbox = &xMailboxes[ get_core_num() ];
+        TaskHandle_t xTaskToWake = NULL;
+
+        if( ( ulWord & portMAILBOX_TAG_MESSAGE ) != 0U )
+        {
+            /* The sender reserved a slot, so there is always room. */
+            pxMailbox->ulMessages[ pxMailbox->ulWritten & ( configPICO_MAILBOX_LENGTH - 1U ) ] = ulWord & portMAILBOX_MESSAGE_MASK;
+            __dmb();
+            pxMailbox->ulWritten++;
+            __dmb();
+            xTaskToWake = pxMailbox->xReceivingTask;
+        }
+        else if( ( ulWord & portMAILBOX_TAG_DOORBELL ) != 0U )
+        {
+            prvMailboxUpdate( &pxMailbox->ulDoorbells, ulWord & portMAILBOX_DOORBELL_MASK, 0U );
+            __dmb();
+            xTaskToWake = pxMailbox->xDoorbellTask;
+        }
+        else
+        {
+            /* A yield request, which the FIFO interrupt always performs. */
+        }
+
+        return xTaskToWake;
+    }
+
+    static void prvMailboxDrainFIFOFromISR( void )
+    {
+        TaskHandle_t xTaskToWake;
+        uint32_t ulSave;
+
+        while( multicore_fifo_rvalid() )
+        {
+            /* Higher priority interrupts may deliver to this core too. */
+            ulSave = save_and_disable_interrupts();
+            xTaskToWake = prvMailboxDeliver( sio_hw->fifo_rd );
+            restore_interrupts( ulSave );
+
+            prvMailboxNotify( xTaskToWake );
+        }
+    }
+
+    static void prvMailboxPost( BaseType_t xCoreID,
+                                uint32_t ulWord )
+    {
+        TaskHandle_t xTaskToWake = NULL;
+        uint32_t ulSave;
+
+        for( ; ; )
+        {
+            ulSave = save_and_disable_interrupts();
+
+            if( xCoreID == ( BaseType_t ) get_core_num() )
+            {
+                xTaskToWake = prvMailboxDeliver( ulWord );
+                restore_interrupts( ulSave );
+                break;
+            }
+            else if( multicore_fifo_wready() )
+            {
+                sio_hw->fifo_wr = ulWord;
+                restore_interrupts( ulSave );
+                break;
+            }
+            else
+            {
+                restore_interrupts( ulSave );
+
+                /* The other core's FIFO interrupt will make space.  If this is
+                 * an interrupt, this core's FIFO interrupt cannot run, so drain
+                 * it here in case the other core is waiting on it in turn. */
+                if( portCHECK_IF_IN_ISR() )
+                {
+                    prvMailboxDrainFIFOFromISR();
+
+                    /* Act on any yield request that was drained. */
+                    portYIELD_FROM_ISR( pdTRUE );
+                }
+            }
+        }
+
+        prvMailboxNotify( xTaskToWake );
+    }
+
+    /* Record the calling task as the one to wake in *pxWaitingTask.  Returns
+     * pdFALSE if another task is already recorded there. */
+    static BaseType_t prvMailboxRegister( TaskHandle_t volatile * pxWaitingTask )
+    {
+        uint32_t ulCurrentTask = ( uint32_t ) xTaskGetCurrentTaskHandle();
+
+        ( void ) ulPortCompareAndSwap( ( volatile uint32_t * ) pxWaitingTask, ulCurrentTask, 0U );
+        __dmb();
+
+        return ( ( uint32_t ) *pxWaitingTask == ulCurrentTask ) ? pdTRUE : pdFALSE;
+    }
+
+    static void prvMailboxUnregister( TaskHandle_t volatile * pxWaitingTask )
+    {
+        ( void ) ulPortCompareAndSwap( ( volatile uint32_t * ) pxWaitingTask, 0U, ( uint32_t ) xTaskGetCurrentTaskHandle() );
+    }
+
+    /* Block until woken, or for a single tick if another task is registered to
+     * be woken instead.  Returns pdFALSE once the timeout has expired. */
+    static BaseType_t prvMailboxBlock( BaseType_t xRegistered,
+                                       TimeOut_t * pxTimeOut,
+                                       TickType_t * pxTicksToWait )
+    {
+        if( xTaskCheckForTimeOut( pxTimeOut, pxTicksToWait ) != pdFALSE )
+        {
+            return pdFALSE;
+        }
+
+        ( void ) ulTaskNotifyTakeIndexed( configPICO_MAILBOX_NOTIFICATION_INDEX, pdTRUE,
+                                          ( xRegistered != pdFALSE ) ? *pxTicksToWait : ( TickType_t ) 1 );
+
+        return pdTRUE;
+    }
+
+    BaseType_t xPortMailboxSend( BaseType_t xCoreID,
+                                 uint32_t ulMessage,
+                                 TickType_t xTicksToWait )
+    {
+        MailboxCore_t * pxMailbox;
+        TimeOut_t xTimeOut;
+        uint32_t ulReserved;
+        BaseType_t xAttempted = pdFALSE, xRegistered = pdFALSE, xReturn = pdFAIL;
+
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configNUMBER_OF_CORES ) );
+        configASSERT( ( ulMessage & ~portMAILBOX_MESSAGE_MASK ) == 0U );
+        configASSERT( !portCHECK_IF_IN_ISR() );
+
+        pxMailbox = &xMailboxes[ xCoreID ];
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            ulReserved = pxMailbox->ulReserved;
+
+            if( ulReserved < configPICO_MAILBOX_LENGTH )
+            {
+                if( ulPortCompareAndSwap( &pxMailbox->ulReserved, ulReserved + 1U, ulReserved ) != 0U )
+                {
+                    xReturn = pdPASS;
+                    break;
+                }
+            }
+            else if( xAttempted == pdFALSE )
+            {
+                /* Check again once registered, as the receiver may have freed
+                 * a slot before it could see this task waiting. */
+                xRegistered = prvMailboxRegister( &pxMailbox->xSendingTask );
+                xAttempted = pdTRUE;
+            }
+            else if( prvMailboxBlock( xRegistered, &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                xAttempted = xRegistered;
+            }
+        }
+
+        if( xRegistered != pdFALSE )
+        {
+            prvMailboxUnregister( &pxMailbox->xSendingTask );
+        }
+
+        if( xReturn == pdPASS )
+        {
+            prvMailboxPost( xCoreID, portMAILBOX_TAG_MESSAGE | ulMessage );
+        }
+
+        return xReturn;
+    }
+
+    BaseType_t xPortMailboxReceive( BaseType_t xCoreID,
+                                    uint32_t * pulMessage,
+                                    TickType_t xTicksToWait )
+    {
+        MailboxCore_t * pxMailbox;
+        TimeOut_t xTimeOut;
+        uint32_t ulReserved;
+        BaseType_t xAttempted = pdFALSE, xRegistered, xReturn = pdFAIL;
+
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configNUMBER_OF_CORES ) );
+        configASSERT( pulMessage != NULL );
+        configASSERT( !portCHECK_IF_IN_ISR() );
+
+        pxMailbox = &xMailboxes[ xCoreID ];
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            if( pxMailbox->ulRead != pxMailbox->ulWritten )
+            {
+                __dmb();
+                *pulMessage = pxMailbox->ulMessages[ pxMailbox->ulRead & ( configPICO_MAILBOX_LENGTH - 1U ) ];
+                __dmb();
+                pxMailbox->ulRead++;
+
+                do
+                {
+                    ulReserved = pxMailbox->ulReserved;
+                } while( ulPortCompareAndSwap( &pxMailbox->ulReserved, ulReserved - 1U, ulReserved ) == 0U );
+
+                xReturn = pdPASS;
+                break;
+            }
+            else if( xAttempted == pdFALSE )
+            {
+                /* Only one task receives from a mailbox. */
+                xRegistered = prvMailboxRegister( &pxMailbox->xReceivingTask );
+                configASSERT( xRegistered != pdFALSE );
+                ( void ) xRegistered;
+                xAttempted = pdTRUE;
+            }
+            else if( prvMailboxBlock( pdTRUE, &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xAttempted != pdFALSE )
+        {
+            prvMailboxUnregister( &pxMailbox->xReceivingTask );
+        }
+
+        if( xReturn == pdPASS )
+        {
+            /* Free the slot and wake a sender waiting for one. */
+            __dmb();
+            prvMailboxNotify( pxMailbox->xSendingTask );
+        }
+
+        return xReturn;
+    }
+
+    void vPortDoorbellRing( BaseType_t xCoreID,
+                            uint32_t ulDoorbells )
+    {
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configNUMBER_OF_CORES ) );
+        configASSERT( ( ulDoorbells & ~portMAILBOX_DOORBELL_MASK ) == 0U );
+
+        if( ulDoorbells != 0U )
+        {
+            prvMailboxPost( xCoreID, portMAILBOX_TAG_DOORBELL | ulDoorbells );
+        }
+    }
+
+    uint32_t ulPortDoorbellWait( BaseType_t xCoreID,
+                                 uint32_t ulDoorbells,
+                                 TickType_t xTicksToWait )
+    {
+        MailboxCore_t * pxMailbox;
+        TimeOut_t xTimeOut;
+        uint32_t ulPending, ulReturn = 0U;
+        BaseType_t xAttempted = pdFALSE, xRegistered;
+
+        configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configNUMBER_OF_CORES ) );
+        configASSERT( !portCHECK_IF_IN_ISR() );
+
+        pxMailbox = &xMailboxes[ xCoreID ];
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            ulPending = pxMailbox->ulDoorbells & ulDoorbells;
+
+            if( ulPending != 0U )
+            {
+                prvMailboxUpdate( &pxMailbox->ulDoorbells, 0U, ulPending );
+                ulReturn = ulPending;
+                break;
+            }
+            else if( xAttempted == pdFALSE )
+            {
+                /* Only one task waits on a core's doorbells. */
+                xRegistered = prvMailboxRegister( &pxMailbox->xDoorbellTask );
+                configASSERT( xRegistered != pdFALSE );
+                ( void ) xRegistered;
+                xAttempted = pdTRUE;
+            }
+            else if( prvMailboxBlock( pdTRUE, &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xAttempted != pdFALSE )
+        {
+            prvMailboxUnregister( &pxMailbox->xDoorbellTask );
+        }
+
+        return ulReturn;
+    }
+
+#endif /* configUSE_PICO_CROSS_CORE_MAILBOX */
+
 void xPortPendSVHandler( void )
 {
     /* This is a naked function. */
@@ -227,6 +227,45 @@
     #define portASSERT_IF_IN_ISR()    vPortAssertIfInISR()
     void vPortAssertIfInISR( void );
 
+/*
+ * SMP support for the upstream scheduler (configNUMBER_OF_CORES > 1).
+ *
+ * The kernel's TASK and ISR locks are two global portMUX spinlocks. portMUX
+ * spinlocks are already recursive per core, which is what the scheduler
+ * expects from these locks. When configUSE_GRANULAR_LOCKS is 1 the per-object
+ * locks of queues, event groups, stream buffers and timers are portMUX
+ * spinlocks too, so cores that work on unrelated objects do not contend on
+ * the global locks.
+ */
+    #if ( configNUMBER_OF_CORES > 1 )
+        #if ( configNUMBER_OF_CORES > portNUM_PROCESSORS )
+            #error configNUMBER_OF_CORES must not be greater than portNUM_PROCESSORS.
+        #endif
+
+        extern portMUX_TYPE port_xTaskLock;
+        extern portMUX_TYPE port_xISRLock;
+
+        #define portGET_CORE_ID()                              xPortGetCoreID()
+        #define portYIELD_CORE( xCoreID )                      vPortYieldOtherCore( xCoreID )
+        #define portCHECK_IF_IN_ISR()                          xPortInIsrContext()
+
+        #define portSET_INTERRUPT_MASK()                       xPortSetInterruptMaskFromISR()
+        #define portCLEAR_INTERRUPT_MASK( uxSavedStatus )      vPortClearInterruptMaskFromISR( uxSavedStatus )
+
+        #define portGET_TASK_LOCK()                            ( void ) vPortCPUAcquireMutexTimeout( &port_xTaskLock, portMUX_NO_TIMEOUT )
+        #define portRELEASE_TASK_LOCK()                        vPortCPUReleaseMutex( &port_xTaskLock )
+        #define portGET_ISR_LOCK()                             ( void ) vPortCPUAcquireMutexTimeout( &port_xISRLock, portMUX_NO_TIMEOUT )
+        #define portRELEASE_ISR_LOCK()                         vPortCPUReleaseMutex( &port_xISRLock )
+
+        #define portENTER_CRITICAL_FROM_ISR()                  vTaskEnterCriticalFromISR()
+        #define portEXIT_CRITICAL_FROM_ISR( uxSavedStatus )    vTaskExitCriticalFromISR( uxSavedStatus )
+
+        #define portSPINLOCK_TYPE                              portMUX_TYPE
+        #define portINIT_SPINLOCK( pxSpinlock )                vPortCPUInitializeMutex( pxSpinlock )
+        #define portGET_SPINLOCK( xCoreID, pxSpinlock )        do { ( void ) ( xCoreID ); ( void ) vPortCPUAcquireMutexTimeout( pxSpinlock, portMUX_NO_TIMEOUT ); } while( 0 )
+        #define portRELEASE_SPINLOCK( xCoreID, pxSpinlock )    do { ( void ) ( xCoreID ); vPortCPUReleaseMutex( pxSpinlock ); } while( 0 )
+    #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
 /* Critical section management. NW-TODO: replace XTOS_SET_INTLEVEL with more efficient version, if any? */
 /* These cannot be nested. They should be used with a lot of care and cannot be called from interrupt level. */
 /* */
@@ -480,7 +519,7 @@
     #define xPortGetFreeHeapSize               esp_get_free_heap_size
     #define xPortGetMinimumEverFreeHeapSize    esp_get_minimum_free_heap_size
 
-    #if ( ESP_IDF_VERSION < ESP_IDF_VERSION_VAL( 4, 2, 0 ) )
+    #if ( ESP_IDF_VERSION < ESP_IDF_VERSION_VAL( 4, 2, 0 ) ) || ( configNUMBER_OF_CORES > 1 )
 
 /*
  * Send an interrupt to another core in order to make the task running
@@ -489,7 +528,7 @@
 
         void vPortYieldOtherCore( BaseType_t coreid ) PRIVILEGED_FUNCTION;
 
-    #endif /* ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(4, 2, 0) */
+    #endif /* ( ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(4, 2, 0) ) || ( configNUMBER_OF_CORES > 1 ) */
 
 /*
  * Callback to set a watchpoint on the end of the stack. Called every context switch to change the stack
@@ -103,6 +103,12 @@ _Static_assert( tskNO_AFFINITY == CONFIG_FREERTOS_NO_AFFINITY, "incorrect tskNO_
 extern volatile int port_xSchedulerRunning[ portNUM_PROCESSORS ];
 unsigned port_interruptNesting[ portNUM_PROCESSORS ] = { 0 }; /* Interrupt nesting level. Increased/decreased in portasm.c, _frxt_int_enter/_frxt_int_exit */
 
+#if ( configNUMBER_OF_CORES > 1 )
+    /* Kernel TASK and ISR locks, see portGET_TASK_LOCK()/portGET_ISR_LOCK(). */
+    portMUX_TYPE port_xTaskLock = portMUX_INITIALIZER_UNLOCKED;
+    portMUX_TYPE port_xISRLock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* User exception dispatcher when exiting */
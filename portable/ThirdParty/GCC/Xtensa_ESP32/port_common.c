@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include "FreeRTOS.h"
 #include "task.h"
@@ -82,6 +83,38 @@ void esp_startup_start_app_common( void )
     ( void ) res;
 }
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* Called by the startup code on every core other than the PRO CPU. The tasks
+ * of all cores are created by vTaskStartScheduler() on the PRO CPU, so the
+ * other cores only have to wait for it and then start dispatching. */
+    void esp_startup_start_app_other_cores( void )
+    {
+        if( xPortGetCoreID() >= configNUMBER_OF_CORES )
+        {
+            abort();
+        }
+
+        /* Wait for the scheduler to be started on the PRO CPU. */
+        while( port_xSchedulerRunning[ 0 ] == 0 )
+        {
+        }
+
+        #if CONFIG_ESP_INT_WDT
+            esp_int_wdt_cpu_init();
+        #endif
+
+        esp_crosscore_int_init();
+
+        ESP_EARLY_LOGI( "cpu_start", "Starting scheduler on APP CPU." );
+        xPortStartScheduler();
+
+        /* Should not get here. */
+        abort();
+    }
+
+#endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
 #if !CONFIG_FREERTOS_UNICORE
     static volatile bool s_other_cpu_startup_done = false;
     static bool other_cpu_startup_idle_hook_cb( void )
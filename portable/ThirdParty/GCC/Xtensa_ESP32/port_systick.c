@@ -181,6 +181,17 @@ BaseType_t xPortSysTickHandler( void )
 {
     portbenchmarkIntLatency();
     traceISR_ENTER( SYSTICK_INTR_ID );
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        /* The SMP scheduler keeps a single tick count; core 0 advances it and
+         * requests time slicing yields on the other cores itself. */
+        if( xPortGetCoreID() != 0 )
+        {
+            traceISR_EXIT();
+            return pdFALSE;
+        }
+    #endif
+
     BaseType_t ret = xTaskIncrementTick();
 
     if( ret != pdFALSE )
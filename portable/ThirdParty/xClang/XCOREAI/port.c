@@ -94,6 +94,26 @@ void vPortYieldOtherCore( int xOtherCoreID )
 }
 /*-----------------------------------------------------------*/
 
+void vPortWaitForInterrupt( void )
+{
+    /*
+     * Disable events on all of this thread's resources, then pause
+     * the hardware thread until the next interrupt arrives. A paused
+     * thread takes no issue slots, so they go to the hardware threads
+     * that are running tasks. The intercore interrupt sent by
+     * portYIELD_CORE() wakes the thread when a task becomes ready
+     * for this core, and the interrupt exit code then switches to it.
+     */
+    asm volatile (
+        "clre\n\t"
+        "waiteu\n\t"
+        :
+        :
+        : "memory"
+        );
+}
+/*-----------------------------------------------------------*/
+
 static int prvCoreInit( void )
 {
     int xCoreID;
@@ -100,6 +100,16 @@
 
         void vPortYieldOtherCore( int xOtherCoreID );
         #define portYIELD_CORE( x )    vPortYieldOtherCore( x )
+
+/*
+ * Pauses the calling hardware thread until it receives an interrupt.
+ * Intended to be called from vApplicationPassiveIdleHook() so that
+ * FreeRTOS cores with nothing to run leave their issue slots to the
+ * hardware threads that are running tasks. Events are disabled on all
+ * of the calling thread's resources first, so tasks must not be
+ * preempted while waiting on events (for example inside a select).
+ */
+        void vPortWaitForInterrupt( void );
 /*-----------------------------------------------------------*/
 
 /* Architecture specific optimisations. */
@@ -137,6 +137,22 @@ extern void vPortYield( void );
  * it should be released as many times as it is locked. */
     #define portRELEASE_ISR_LOCK()           do {} while( 0 )
 
+/* Spinlocks used by configUSE_GRANULAR_LOCKS to protect individual kernel
+ * objects (queues, stream buffers, event groups and the timer lists) instead
+ * of the TASK/ISR lock pair.  A spinlock is only ever taken with interrupts
+ * masked on the calling core and is never taken recursively, so it does not
+ * need to be a recursive lock. */
+    #define portSPINLOCK_TYPE                          BaseType_t
+
+/* Initialise the spinlock pointed to by pxSpinlock to the unlocked state. */
+    #define portINIT_SPINLOCK( pxSpinlock )            ( *( pxSpinlock ) = 0 )
+
+/* Acquire the spinlock pointed to by pxSpinlock from core xCoreID. */
+    #define portGET_SPINLOCK( xCoreID, pxSpinlock )    do { ( void ) ( xCoreID ); ( void ) ( pxSpinlock ); } while( 0 )
+
+/* Release the spinlock pointed to by pxSpinlock from core xCoreID. */
+    #define portRELEASE_SPINLOCK( xCoreID, pxSpinlock )    do { ( void ) ( xCoreID ); ( void ) ( pxSpinlock ); } while( 0 )
+
 #endif /* if ( configNUMBER_OF_CORES > 1 ) */
 
 #endif /* PORTMACRO_H */
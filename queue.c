@@ -42,11 +42,26 @@
     #include "croutine.h"
 #endif
 
+#if ( configKERNEL_OBJECT_POOLS == 1 )
+    #include "object_pool.h"
+#endif
+
+#if ( ( configUSE_MPMC_QUEUES == 1 ) || ( configUSE_ATOMIC_SEMAPHORES == 1 ) )
+    #include "atomic.h"
+#endif
+
 /* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
  * correct privileged Vs unprivileged linkage and placement. */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* vQueueListStatistics() formats its output with snprintf().  As with the
+ * task stats formatting functions, set configUSE_STATS_FORMATTING_FUNCTIONS to
+ * 2 to include it without including stdio.h here. */
+#if ( ( configUSE_IPC_STATISTICS == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) )
+    #include <stdio.h>
+#endif
+
 
 /* Constants used with the cRxLock and cTxLock structure members. */
 #define queueUNLOCKED             ( ( int8_t ) -1 )
@@ -89,7 +104,7 @@ typedef struct SemaphoreData
     #define queueYIELD_IF_USING_PREEMPTION()
 #else
     #if ( configNUMBER_OF_CORES == 1 )
-        #define queueYIELD_IF_USING_PREEMPTION()    portYIELD_WITHIN_API()
+        #define queueYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
     #else /* #if ( configNUMBER_OF_CORES == 1 ) */
         #define queueYIELD_IF_USING_PREEMPTION()    vTaskYieldWithinAPI()
     #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
@@ -129,16 +144,282 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         struct QueueDefinition * pxQueueSetContainer;
     #endif
 
+    #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+        UBaseType_t uxQueueSetIndex; /**< The slot the queue occupies in the member table of its queue set. */
+        UBaseType_t uxReadyMembers;  /**< Queue sets only.  Bit N is set while the member in slot N may contain data. */
+    #endif
+
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
     #endif
+
+    #if ( configUSE_ZERO_COPY_QUEUES == 1 )
+        int8_t * pcReservedSendSlot;    /**< The storage slot handed out by xQueueReserveSend() that has not yet been committed, or NULL if there is none. */
+        int8_t * pcAcquiredReceiveSlot; /**< The storage slot handed out by xQueueAcquireReceive() that has not yet been released, or NULL if there is none. */
+    #endif
+
+    #if ( configUSE_SPSC_QUEUES == 1 )
+        volatile UBaseType_t uxSpscItemsWritten; /**< The number of items ever posted to an SPSC queue.  Only written by the producer. */
+        volatile UBaseType_t uxSpscItemsRead;    /**< The number of items ever removed from an SPSC queue.  Only written by the consumer. */
+        uint8_t ucSpscQueue;                     /**< Set to pdTRUE if the queue was created with the queueQUEUE_TYPE_SPSC type. */
+    #endif
+
+    #if ( configUSE_MPMC_QUEUES == 1 )
+        volatile uint32_t * pulMpmcSequence; /**< The sequence number of each storage slot of an MPMC queue, or NULL if the queue is not an MPMC queue. */
+        volatile uint32_t ulMpmcEnqueuePos;  /**< The position the next item posted to an MPMC queue will be written to. */
+        volatile uint32_t ulMpmcDequeuePos;  /**< The position the next item removed from an MPMC queue will be read from. */
+    #endif
+
+    #if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+        TaskHandle_t xTaskWaitingForAny; /**< The task blocked in xQueueWaitForAny() waiting for this queue to contain data, or NULL if there is none. */
+    #endif
+
+    #if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+        UBaseType_t uxMultipleSendersWaiting; /**< The number of tasks blocked in xQueueSendMultiple() waiting for space for more than one item. */
+    #endif
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        IPCStatistics_t xStatistics; /**< The statistics returned by vQueueGetStatistics(). */
+        TickType_t xMutexTakenTime;  /**< The tick count at which a mutex was last taken. */
+    #endif
+
+    #if ( configUSE_MUTEX_PRIORITY_CEILING == 1 )
+        UBaseType_t uxCeilingPriority; /**< The priority a task taking the mutex is raised to, or 0 if the mutex uses priority inheritance. */
+    #endif
+
+    #if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+        volatile uint32_t ulAtomicCount; /**< The count of an atomic semaphore.  Only changed by compare and swap. */
+        uint8_t ucAtomicSemaphore;       /**< Set to pdTRUE if the queue was created with the queueQUEUE_TYPE_ATOMIC_SEMAPHORE type. */
+    #endif
+
+    #if ( configUSE_RING_QUEUES == 1 )
+        UBaseType_t uxRingItemsDropped; /**< The number of items a ring queue has discarded to make room for new items. */
+        uint8_t ucRingQueue;            /**< Set to pdTRUE if the queue was created with the queueQUEUE_TYPE_RING type. */
+    #endif
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        uint8_t ucPriorityQueue; /**< Set to pdTRUE if the queue was created with the queueQUEUE_TYPE_PRIORITY type. */
+    #endif
+
+    #if ( configUSE_RPC_QUEUES == 1 )
+        List_t xTasksWaitingForReply;   /**< Tasks blocked in xQueueCall() waiting for a reply, in the order their requests were sent.  The item value of each holds the ticket of its request. */
+        TaskHandle_t xRpcServer;        /**< The task that receives the requests sent to an RPC queue, or NULL if it is not yet known. */
+        TickType_t xRpcNextTicket;      /**< The ticket given to the next request sent with xQueueCall(). */
+        TickType_t xRpcNextReply;       /**< The ticket of the next request xQueueReply() replies to. */
+        uint8_t ucRpcQueue;             /**< Set to pdTRUE if the queue was created with the queueQUEUE_TYPE_RPC type. */
+        uint8_t ucRpcRequestInService;  /**< Set to pdTRUE between the server receiving a request and replying to it. */
+        uint8_t ucRpcServerHoldsQueue;  /**< Set to pdTRUE while the queue is counted as a mutex held by the server, so clients can lend it their priority. */
+    #endif
+
+    #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        MessageTag_t * pxMessageTags;            /**< The latency tag of the item in each slot, or NULL if the queue does not carry tags. */
+        IPCLatencyHistogram_t xLatencyHistogram; /**< The latencies of the tagged items received from the queue. */
+    #endif
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xQueueLock; /**< Protects the queue members in place of the kernel critical section when configUSE_GRANULAR_LOCKS is 1. */
+    #endif
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
  * name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+/*
+ * Tests of the copy position passed to the send functions.  The handling of the
+ * positions excluded by configQUEUE_SEND_TO_FRONT_USED and
+ * configQUEUE_OVERWRITE_USED is removed by the compiler, as the tests of those
+ * positions are then constant.
+ */
+#define queueIS_OVERWRITE( xCopyPosition )       ( ( configQUEUE_OVERWRITE_USED == 1 ) && ( ( xCopyPosition ) == queueOVERWRITE ) )
+#define queueIS_SEND_TO_BACK( xCopyPosition )    ( ( ( configQUEUE_SEND_TO_FRONT_USED == 0 ) && ( configQUEUE_OVERWRITE_USED == 0 ) ) || ( ( xCopyPosition ) == queueSEND_TO_BACK ) )
+#define queueIS_COPY_POSITION_USED( xCopyPosition ) \
+    ( ( ( xCopyPosition ) == queueSEND_TO_BACK ) || ( ( configQUEUE_SEND_TO_FRONT_USED == 1 ) && ( ( xCopyPosition ) == queueSEND_TO_FRONT ) ) || queueIS_OVERWRITE( xCopyPosition ) )
+
+/*
+ * Evaluates to pdTRUE if the queue is a mutex that uses priority inheritance.
+ * The holder of a mutex with a priority ceiling already runs at a priority at
+ * least as high as that of any task that takes the mutex, so there is nothing
+ * for it to inherit.
+ */
+#if ( configUSE_MUTEX_PRIORITY_CEILING == 1 )
+    #define queueUSES_PRIORITY_INHERITANCE( pxQueue )    ( ( ( ( pxQueue )->uxQueueType == queueQUEUE_IS_MUTEX ) && ( ( pxQueue )->uxCeilingPriority == ( UBaseType_t ) 0U ) ) ? pdTRUE : pdFALSE )
+#else
+    #define queueUSES_PRIORITY_INHERITANCE( pxQueue )    ( ( ( pxQueue )->uxQueueType == queueQUEUE_IS_MUTEX ) ? pdTRUE : pdFALSE )
+#endif
+
+/*
+ * A ring queue accepts an item sent to its back even when it is full, as the
+ * oldest item is then discarded.  The count of items is unchanged when that
+ * happens, as it is when an item is overwritten, so there is no new data to
+ * report to a receiver or queue set.
+ */
+#if ( configUSE_RING_QUEUES == 1 )
+    #define queueIS_RING( pxQueue )    ( ( pxQueue )->ucRingQueue != ( uint8_t ) pdFALSE )
+#else
+    #define queueIS_RING( pxQueue )    ( pdFALSE )
+#endif
+
+#define queueRING_CAN_DISCARD( pxQueue, xCopyPosition )    ( queueIS_RING( pxQueue ) && queueIS_SEND_TO_BACK( xCopyPosition ) )
+#define queueITEM_REPLACED( pxQueue, xCopyPosition, uxPreviousMessagesWaiting ) \
+    ( ( queueIS_OVERWRITE( xCopyPosition ) || queueIS_RING( pxQueue ) ) && ( ( uxPreviousMessagesWaiting ) == ( pxQueue )->uxMessagesWaiting ) )
+
+/*
+ * The storage area of a priority queue holds a binary max-heap of
+ * uxMessagesWaiting items, ordered by the uint32_t key at the start of each
+ * item, so the item with the highest key is always in the first slot.
+ * pcWriteTo and pcReadFrom are not used.  Items are removed in two steps: the
+ * first slot is copied out by prvCopyDataFromQueue(), which leaves the heap
+ * unchanged so a peek is just a copy, then queuePRIORITY_REMOVE_HEAD() removes
+ * it from the heap before uxMessagesWaiting is decremented.
+ */
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+    #define queueIS_PRIORITY( pxQueue )    ( ( pxQueue )->ucPriorityQueue != ( uint8_t ) pdFALSE )
+    #define queuePRIORITY_REMOVE_HEAD( pxQueue )     \
+    do {                                             \
+        if( queueIS_PRIORITY( pxQueue ) )            \
+        {                                            \
+            prvPriorityQueueRemoveHead( pxQueue );   \
+        }                                            \
+    } while( 0 )
+#else
+    #define queueIS_PRIORITY( pxQueue )    ( pdFALSE )
+    #define queuePRIORITY_REMOVE_HEAD( pxQueue )
+#endif
+
+/*
+ * Each request sent to an RPC queue with xQueueCall() is given a ticket, and
+ * the client waits in xTasksWaitingForReply with the ticket as its item value.
+ * Requests are received and replied to in the order they were sent, so
+ * xQueueReply() only has to compare the ticket of the head of the list with
+ * xRpcNextReply, and a client that timed out leaves no entry to be replied to
+ * in error.  The top bit of the item value is taskEVENT_LIST_ITEM_VALUE_IN_USE,
+ * and the next is set by xQueueReply() to tell the client it was replied to.
+ */
+#if ( configUSE_RPC_QUEUES == 1 )
+    #define queueIS_RPC( pxQueue )            ( ( pxQueue )->ucRpcQueue != ( uint8_t ) pdFALSE )
+    #define queueASSERT_NOT_RPC( pxQueue )    configASSERT( !queueIS_RPC( pxQueue ) )
+
+    #if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
+        #define queueRPC_REPLIED        ( ( TickType_t ) 0x4000U )
+        #define queueRPC_TICKET_MASK    ( ( TickType_t ) 0x3fffU )
+    #elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_32_BITS )
+        #define queueRPC_REPLIED        ( ( TickType_t ) 0x40000000U )
+        #define queueRPC_TICKET_MASK    ( ( TickType_t ) 0x3fffffffU )
+    #elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_64_BITS )
+        #define queueRPC_REPLIED        ( ( TickType_t ) 0x4000000000000000U )
+        #define queueRPC_TICKET_MASK    ( ( TickType_t ) 0x3fffffffffffffffU )
+    #endif
+#else
+    #define queueIS_RPC( pxQueue )            ( pdFALSE )
+    #define queueASSERT_NOT_RPC( pxQueue )
+#endif
+
+/*
+ * Space and data availability tests used by the send and receive functions.
+ * When configUSE_ZERO_COPY_QUEUES is 1 an outstanding send reservation makes
+ * the queue appear full to every other sender, as the reserved slot sits in
+ * front of any slot a later send would use.  An outstanding receive
+ * acquisition still occupies its storage slot, and makes the queue appear
+ * empty to every other receiver until it is released, as that slot would
+ * otherwise be the next one overwritten.  Items cannot be written to the front
+ * of the queue while a slot is acquired because the front slot is the
+ * acquired one, so a sender that finds a slot acquired blocks until the slot
+ * is released.
+ */
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+    #define queueHAS_SPACE( pxQueue )                                                                                                        \
+    ( ( ( pxQueue )->pcReservedSendSlot == NULL ) &&                                                                                         \
+      ( ( ( pxQueue )->uxMessagesWaiting + ( ( ( pxQueue )->pcAcquiredReceiveSlot != NULL ) ? ( UBaseType_t ) 1U : ( UBaseType_t ) 0U ) ) < ( pxQueue )->uxLength ) )
+    #define queueHAS_ITEMS( pxQueue )    ( ( ( pxQueue )->pcAcquiredReceiveSlot == NULL ) && ( ( pxQueue )->uxMessagesWaiting > ( UBaseType_t ) 0 ) )
+    #define queueCAN_ACCEPT( pxQueue, xCopyPosition )                                                                   \
+    ( ( queueHAS_SPACE( pxQueue ) && ( ( ( pxQueue )->pcAcquiredReceiveSlot == NULL ) || queueIS_SEND_TO_BACK( xCopyPosition ) ) ) || \
+      ( ( queueIS_OVERWRITE( xCopyPosition ) || queueRING_CAN_DISCARD( pxQueue, xCopyPosition ) ) &&                                 \
+        ( ( pxQueue )->pcReservedSendSlot == NULL ) && ( ( pxQueue )->pcAcquiredReceiveSlot == NULL ) ) )
+    #define queueIS_FULL_TO_BLOCKED_SENDER( pxQueue )    ( ( !queueHAS_SPACE( pxQueue ) ) || ( ( pxQueue )->pcAcquiredReceiveSlot != NULL ) )
+    #define queueSPACES_AVAILABLE( pxQueue )                                                                                      \
+    ( ( ( pxQueue )->pcReservedSendSlot != NULL ) ? ( UBaseType_t ) 0U :                                                       \
+      ( UBaseType_t ) ( ( pxQueue )->uxLength - ( pxQueue )->uxMessagesWaiting - ( ( ( pxQueue )->pcAcquiredReceiveSlot != NULL ) ? ( UBaseType_t ) 1U : ( UBaseType_t ) 0U ) ) )
+#else
+    #define queueHAS_SPACE( pxQueue )                    ( ( pxQueue )->uxMessagesWaiting < ( pxQueue )->uxLength )
+    #define queueHAS_ITEMS( pxQueue )                    ( ( pxQueue )->uxMessagesWaiting > ( UBaseType_t ) 0 )
+    #define queueCAN_ACCEPT( pxQueue, xCopyPosition )    ( queueHAS_SPACE( pxQueue ) || queueIS_OVERWRITE( xCopyPosition ) || queueRING_CAN_DISCARD( pxQueue, xCopyPosition ) )
+    #define queueIS_FULL_TO_BLOCKED_SENDER( pxQueue )    ( ( pxQueue )->uxMessagesWaiting == ( pxQueue )->uxLength )
+    #define queueSPACES_AVAILABLE( pxQueue )             ( ( UBaseType_t ) ( ( pxQueue )->uxLength - ( pxQueue )->uxMessagesWaiting ) )
+#endif /* #if ( configUSE_ZERO_COPY_QUEUES == 1 ) */
+
+
+/*
+ * SPSC and MPMC queues are not protected by a critical section, and do not use
+ * uxMessagesWaiting.  In an SPSC queue the producer owns pcWriteTo and
+ * uxSpscItemsWritten, and the consumer owns pcReadFrom and uxSpscItemsRead.
+ * An MPMC queue is a bounded ring in which each slot carries a sequence
+ * number.  A slot at position n can be written when its sequence number is n,
+ * and read when its sequence number is n + 1.  Producers and consumers claim
+ * positions by compare and swap.  An atomic semaphore is a semaphore whose
+ * count is changed by compare and swap.  All three types only enter the
+ * kernel to block or to wake a blocked task.
+ */
+#if ( ( configUSE_SPSC_QUEUES == 1 ) || ( configUSE_MPMC_QUEUES == 1 ) || ( configUSE_ATOMIC_SEMAPHORES == 1 ) )
+    #define queueUSE_LOCK_FREE_QUEUES    1
+#else
+    #define queueUSE_LOCK_FREE_QUEUES    0
+#endif
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+    #define queueIS_SPSC( pxQueue )       ( ( pxQueue )->ucSpscQueue != ( uint8_t ) pdFALSE )
+    #define queueSPSC_ITEMS( pxQueue )    ( ( UBaseType_t ) ( ( pxQueue )->uxSpscItemsWritten - ( pxQueue )->uxSpscItemsRead ) )
+#else
+    #define queueIS_SPSC( pxQueue )       ( pdFALSE )
+#endif
+
+#if ( configUSE_MPMC_QUEUES == 1 )
+    #define queueIS_MPMC( pxQueue )    ( ( pxQueue )->pulMpmcSequence != NULL )
+
+/* The MPMC queue length is a power of two so positions can wrap freely. */
+    #define queueMPMC_SLOT( pxQueue, ulPosition )    ( ( UBaseType_t ) ( ( ulPosition ) & ( uint32_t ) ( ( pxQueue )->uxLength - ( UBaseType_t ) 1U ) ) )
+#else
+    #define queueIS_MPMC( pxQueue )    ( pdFALSE )
+#endif
+
+#if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+    #define queueIS_ATOMIC_SEMAPHORE( pxQueue )    ( ( pxQueue )->ucAtomicSemaphore != ( uint8_t ) pdFALSE )
+#else
+    #define queueIS_ATOMIC_SEMAPHORE( pxQueue )    ( pdFALSE )
+#endif
+
+#if ( ( configUSE_MPMC_QUEUES == 1 ) || ( configUSE_ATOMIC_SEMAPHORES == 1 ) )
+
+/* Evaluates to a non-zero value if *pulDestination held ulComparand and was
+ * atomically set to ulExchange. */
+    #ifdef portATOMIC_COMPARE_AND_SWAP_U32
+        #define queueCOMPARE_AND_SWAP( pulDestination, ulExchange, ulComparand )    portATOMIC_COMPARE_AND_SWAP_U32( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
+    #else
+        #define queueCOMPARE_AND_SWAP( pulDestination, ulExchange, ulComparand )    Atomic_CompareAndSwap_u32( ( pulDestination ), ( ulExchange ), ( ulComparand ) )
+    #endif
+#endif
+
+#if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+
+/* Each member of a queue set has a bit in the uxReadyMembers bitmap of the
+ * set, which limits the number of members. */
+    #define queueSET_MAX_MEMBERS    ( ( UBaseType_t ) ( sizeof( UBaseType_t ) * ( size_t ) 8U ) )
+#endif
+
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+    #define queueIS_LOCK_FREE( pxQueue )    ( queueIS_SPSC( pxQueue ) || queueIS_MPMC( pxQueue ) || queueIS_ATOMIC_SEMAPHORE( pxQueue ) )
+
+/* The number of items held by any type of queue. */
+    #define queueITEMS_HELD( pxQueue )      ( queueIS_LOCK_FREE( pxQueue ) ? prvLockFreeItemsHeld( pxQueue ) : ( pxQueue )->uxMessagesWaiting )
+
+/* Used by the functions that cannot be used on an SPSC or MPMC queue. */
+    #define queueASSERT_NOT_LOCK_FREE( pxQueue )    configASSERT( !queueIS_LOCK_FREE( pxQueue ) )
+#else
+    #define queueITEMS_HELD( pxQueue )              ( ( pxQueue )->uxMessagesWaiting )
+    #define queueASSERT_NOT_LOCK_FREE( pxQueue )
+#endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -172,6 +453,45 @@ typedef xQUEUE Queue_t;
 
 #endif /* configQUEUE_REGISTRY_SIZE */
 
+#if ( configUSE_QUEUE_REGISTRY_INDEX == 1 )
+
+/* Hash chains over xQueueRegistry[], one set by handle and one by name, so the
+ * registry functions do not search the whole registry.  The layout of
+ * xQueueRegistry[] is unchanged so kernel aware debuggers can still read it.
+ * A chain holds the index of a registry entry plus one, so 0 ends a chain.
+ * Entries freed by vQueueUnregisterQueue() are chained through
+ * uxQueueRegistryNextByHandle[] from uxQueueRegistryFree, and the entries from
+ * uxQueueRegistryUnused on have never been used. */
+    PRIVILEGED_DATA static UBaseType_t uxQueueRegistryByHandle[ configQUEUE_REGISTRY_INDEX_BUCKETS ];
+    PRIVILEGED_DATA static UBaseType_t uxQueueRegistryByName[ configQUEUE_REGISTRY_INDEX_BUCKETS ];
+    PRIVILEGED_DATA static UBaseType_t uxQueueRegistryNextByHandle[ configQUEUE_REGISTRY_SIZE ];
+    PRIVILEGED_DATA static UBaseType_t uxQueueRegistryNextByName[ configQUEUE_REGISTRY_SIZE ];
+    PRIVILEGED_DATA static UBaseType_t uxQueueRegistryFree = 0U;
+    PRIVILEGED_DATA static UBaseType_t uxQueueRegistryUnused = 0U;
+
+    #define queueREGISTRY_HANDLE_BUCKET( xQueue ) \
+    ( ( UBaseType_t ) ( ( ( portPOINTER_SIZE_TYPE ) ( xQueue ) / ( portPOINTER_SIZE_TYPE ) sizeof( void * ) ) % ( portPOINTER_SIZE_TYPE ) configQUEUE_REGISTRY_INDEX_BUCKETS ) )
+
+#endif /* configUSE_QUEUE_REGISTRY_INDEX */
+
+#if ( configKERNEL_OBJECT_POOLS == 1 )
+
+/* The pool dynamically allocated queues that have no storage area, such as
+ * semaphores and mutexes, are drawn from.  It is created when the first such
+ * queue is created.  Queues with a storage area vary in size so are always
+ * allocated from the heap. */
+    PRIVILEGED_DATA static PoolHandle_t xQueuePool = NULL;
+
+    #define queueALLOCATE( xSize )                                                                       \
+    ( ( ( xSize ) == sizeof( Queue_t ) ) ?                                                               \
+      pvPoolAllocateKernelObject( &xQueuePool, sizeof( Queue_t ), configKERNEL_QUEUE_POOL_LENGTH ) : \
+      pvPortMalloc( xSize ) )
+    #define queueFREE( pxQueue )    vPoolFreeKernelObject( xQueuePool, ( pxQueue ) )
+#else
+    #define queueALLOCATE( xSize )    pvPortMalloc( xSize )
+    #define queueFREE( pxQueue )      vPortFree( pxQueue )
+#endif
+
 /*
  * Unlocks a queue locked by a call to prvLockQueue.  Locking a queue does not
  * prevent an ISR from adding or removing items to the queue, but does prevent
@@ -182,6 +502,29 @@ typedef xQUEUE Queue_t;
  */
 static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+/*
+ * Enter and exit a critical section that protects the members of pxQueue.
+ * Mutexes use the kernel critical section as giving and taking them changes
+ * the priority of the mutex holder.  All other queues use their own lock.
+ */
+    static void prvQueueEnterCritical( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static void prvQueueExitCritical( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static UBaseType_t prvQueueEnterCriticalFromISR( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static void prvQueueExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus,
+                                             const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * A task that blocks on a queue adds itself to the queue event lists with the
+ * scheduler suspended and the queue locked, but without holding the queue
+ * lock.  The task level functions call this to wait for that to complete
+ * before they access the event lists themselves.  Interrupts instead update
+ * the queue lock counts, as they do in every configuration.
+ */
+    static void prvWaitForQueueUnlock( void ) PRIVILEGED_FUNCTION;
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
 /*
  * Uses a critical section to determine if there is any data in a queue.
  *
@@ -210,6 +553,37 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+
+/*
+ * Tag the uxCount items about to be written to the slots starting at pcSlot,
+ * or record the latencies of the uxCount items just read from the slots ending
+ * at pcSlot.  Both do nothing if the queue does not carry tags, and are called
+ * from a critical section.
+ */
+    static void prvStampMessageTags( Queue_t * const pxQueue,
+                                     const int8_t * pcSlot,
+                                     UBaseType_t uxCount,
+                                     const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+    static void prvReceiveMessageTags( Queue_t * const pxQueue,
+                                       const int8_t * pcSlot,
+                                       UBaseType_t uxCount,
+                                       const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+/*
+ * Adds pvItemToQueue to the heap held in a priority queue's storage area, or
+ * removes the item with the highest key from it.  Neither updates
+ * uxMessagesWaiting.  Called from a critical section.
+ */
+    static void prvPriorityQueueInsert( Queue_t * const pxQueue,
+                                        const void * pvItemToQueue ) PRIVILEGED_FUNCTION;
+    static void prvPriorityQueueRemoveHead( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
@@ -219,6 +593,195 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
     static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
 
+#if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+
+/*
+ * Places pxQueue in a free slot of the member table of pxQueueSet, or clears
+ * the slot pxQueue occupies.  Must be called from a critical section of
+ * pxQueue.
+ */
+    static BaseType_t prvClaimQueueSetSlot( Queue_t * const pxQueue,
+                                            Queue_t * const pxQueueSet ) PRIVILEGED_FUNCTION;
+    static void prvReleaseQueueSetSlot( const Queue_t * const pxQueue,
+                                        Queue_t * const pxQueueSet ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the highest priority member of pxQueueSet that contains data, or
+ * NULL if there is none, clearing the ready bit of each member found to have
+ * been emptied since it became ready.  Must be called from a critical section
+ * of pxQueueSet.
+ */
+    static Queue_t * prvSelectReadyQueueSetMember( Queue_t * const pxQueueSet ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+
+/*
+ * Notifies the task, if any, that is blocked in xQueueWaitForAny() waiting
+ * for pxQueue to contain data.  Must be called from a critical section after
+ * the data has been added to the queue.
+ */
+    static void prvNotifyTaskWaitingForAny( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static void prvNotifyTaskWaitingForAnyFromISR( const Queue_t * const pxQueue,
+                                                   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+
+/*
+ * Blocks until a storage slot can be handed out for in place access, then
+ * records and returns it.  xIsSend selects between reserving the next free
+ * slot for xQueueReserveSend() and acquiring the next item for
+ * xQueueAcquireReceive().
+ */
+    static BaseType_t prvClaimQueueSlot( Queue_t * const pxQueue,
+                                         void ** const ppvSlot,
+                                         TickType_t xTicksToWait,
+                                         const BaseType_t xIsSend ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+/*
+ * Copies uxCount items to the back of the queue, or from the front of the
+ * queue, using at most two memcpy() calls to allow for the storage area
+ * wrapping.  Both are called from a critical section.
+ */
+    static void prvCopyItemsToQueue( Queue_t * const pxQueue,
+                                     const void * pvItems,
+                                     const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+    static void prvCopyItemsFromQueue( Queue_t * const pxQueue,
+                                       void * const pvBuffer,
+                                       const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if fewer than uxCount items can currently be posted to the
+ * queue.
+ */
+    static BaseType_t prvIsQueueTooFullFor( const Queue_t * pxQueue,
+                                            const UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks the highest priority task waiting to post to the queue, or every
+ * task waiting to post to the queue while a task is blocked in
+ * xQueueSendMultiple() waiting for space for more than one item.  The waiting
+ * list must not be empty.  Returns pdTRUE if a task that has a higher priority
+ * than the calling task was unblocked.
+ */
+    static BaseType_t prvUnblockSenders( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+    #define queueUNBLOCK_SENDERS( pxQueue )    prvUnblockSenders( pxQueue )
+#else
+    #define queueUNBLOCK_SENDERS( pxQueue )    xTaskRemoveFromEventList( &( ( pxQueue )->xTasksWaitingToSend ) )
+#endif
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+/*
+ * Posts an item to, or removes an item from, an SPSC queue.  Returns pdFAIL if
+ * the queue is full or empty.
+ */
+    static BaseType_t prvSpscWrite( Queue_t * const pxQueue,
+                                    const void * pvItemToQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvSpscRead( Queue_t * const pxQueue,
+                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_MPMC_QUEUES == 1 )
+
+/*
+ * Claims a position in an MPMC queue by compare and swap, then copies the item
+ * to or from the slot it maps to and publishes the slot's new sequence number.
+ * Returns pdFAIL if the queue is full or empty.
+ */
+    static BaseType_t prvMpmcWrite( Queue_t * const pxQueue,
+                                    const void * pvItemToQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvMpmcRead( Queue_t * const pxQueue,
+                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+
+/*
+ * Increments (xIsGive is pdTRUE) or decrements the count of an atomic
+ * semaphore by compare and swap.  Returns pdFAIL if the count is already at
+ * its maximum or zero.
+ */
+    static BaseType_t prvAtomicSemaphoreUpdate( Queue_t * const pxQueue,
+                                                const BaseType_t xIsGive ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+
+/*
+ * Posts an item to, or removes an item from, an SPSC or MPMC queue without
+ * entering a critical section.  Returns pdFAIL if the queue is full or empty.
+ */
+    static BaseType_t prvLockFreeWrite( Queue_t * const pxQueue,
+                                        const void * pvItemToQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvLockFreeRead( Queue_t * const pxQueue,
+                                       void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of items held by an SPSC or MPMC queue.  The count can
+ * be out of date as soon as it is returned.
+ */
+    static UBaseType_t prvLockFreeItemsHeld( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if a call to prvLockFreeWrite() (xIsSend is pdTRUE) or
+ * prvLockFreeRead() would currently fail.
+ */
+    static BaseType_t prvLockFreeMustWait( const Queue_t * pxQueue,
+                                           const BaseType_t xIsSend ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after an item has been posted to (xItemPosted is pdTRUE) or removed
+ * from an SPSC or MPMC queue.  The kernel is only entered if a task is
+ * blocked on, or is in the process of blocking on, the other end of the queue.
+ * Returns pdTRUE if a task with a higher priority than the calling task was
+ * woken.
+ */
+    static BaseType_t prvLockFreeWakeWaiter( Queue_t * const pxQueue,
+                                             const BaseType_t xItemPosted,
+                                             const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+/*
+ * The blocking send and receive used by xQueueGenericSend() and
+ * xQueueReceive() for SPSC and MPMC queues.
+ */
+    static BaseType_t prvLockFreeSend( Queue_t * const pxQueue,
+                                       const void * const pvItemToQueue,
+                                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvLockFreeReceive( Queue_t * const pxQueue,
+                                          void * const pvBuffer,
+                                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_QUEUE_REGISTRY_INDEX == 1 )
+
+/*
+ * Returns the bucket of uxQueueRegistryByName[] that holds the queues named
+ * pcQueueName.
+ */
+    static UBaseType_t prvRegistryNameBucket( const char * pcQueueName ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index of the registry entry of xQueue plus one, or 0 if xQueue
+ * is not in the registry.  Must be called from a critical section.
+ */
+    static UBaseType_t prvRegistryFindHandle( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes entry uxEntry, which is the index of a registry entry plus one, from
+ * the chain that starts at *puxHead and is linked through puxNext[].  Must be
+ * called from a critical section.
+ */
+    static void prvRegistryUnlink( UBaseType_t * puxHead,
+                                   UBaseType_t * puxNext,
+                                   UBaseType_t uxEntry ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Called after a Queue_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -249,14 +812,148 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
  */
     static UBaseType_t prvGetHighestPriorityOfWaitToReceiveList( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_MUTEXES == 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+
+/*
+ * Polls a mutex for up to configMUTEX_SPIN_ITERATIONS iterations while the task
+ * holding it is running on another core.  Returns pdTRUE if the mutex was given
+ * during that time, or pdFALSE if the holder stopped running or the iterations
+ * ran out, in which case the calling task should block.
+ */
+    static BaseType_t prvSpinWhileMutexHolderRuns( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) )
+
+/*
+ * Called after a mutex has been given.  If tasks are waiting for the mutex
+ * then ownership passes straight to the highest priority one, which the
+ * caller then unblocks, and the mutex count is returned to zero so no other
+ * task can take the mutex first.  Must be called from a critical section.
+ */
+    static void prvHandOffMutex( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_RPC_QUEUES == 1 )
+
+/*
+ * Called when the server receives a request from an RPC queue.  Records the
+ * calling task as the server and counts the queue as a mutex it holds, so the
+ * clients waiting on the queue can lend it their priority.  Must be called
+ * from a critical section.
+ */
+    static void prvRpcRequestReceived( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the priority of the highest priority task waiting in xQueueCall(),
+ * either for space in the queue or for a reply, or tskIDLE_PRIORITY if no
+ * tasks are waiting.  Must be called from a critical section.
+ */
+    static UBaseType_t prvGetHighestPriorityOfCallers( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
 /*-----------------------------------------------------------*/
 
+/*
+ * Macros to mark the start and end of a critical section that accesses the
+ * members of a queue.
+ */
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+    #define queueENTER_CRITICAL( pxQueue )                                  prvQueueEnterCritical( pxQueue )
+    #define queueEXIT_CRITICAL( pxQueue )                                   prvQueueExitCritical( pxQueue )
+    #define queueENTER_CRITICAL_FROM_ISR( pxQueue )                         prvQueueEnterCriticalFromISR( pxQueue )
+    #define queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue )  prvQueueExitCriticalFromISR( ( uxSavedInterruptStatus ), ( pxQueue ) )
+#else
+    #define queueENTER_CRITICAL( pxQueue )                                  taskENTER_CRITICAL()
+    #define queueEXIT_CRITICAL( pxQueue )                                   taskEXIT_CRITICAL()
+    #define queueENTER_CRITICAL_FROM_ISR( pxQueue )                         taskENTER_CRITICAL_FROM_ISR()
+    #define queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue )  taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus )
+#endif
+
+/*
+ * Macros called from a critical section after data is added to a queue, to
+ * wake a task waiting for it in xQueueWaitForAny().
+ */
+#if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+    #define queueNOTIFY_TASK_WAITING_FOR_ANY( pxQueue )                                        prvNotifyTaskWaitingForAny( pxQueue )
+    #define queueNOTIFY_TASK_WAITING_FOR_ANY_FROM_ISR( pxQueue, pxHigherPriorityTaskWoken )    prvNotifyTaskWaitingForAnyFromISR( ( pxQueue ), ( pxHigherPriorityTaskWoken ) )
+#else
+    #define queueNOTIFY_TASK_WAITING_FOR_ANY( pxQueue )
+    #define queueNOTIFY_TASK_WAITING_FOR_ANY_FROM_ISR( pxQueue, pxHigherPriorityTaskWoken )
+#endif
+
+/*
+ * Macros that update the statistics gathered when configUSE_IPC_STATISTICS is
+ * 1.  Sends and receives are counted from within the critical section that
+ * moves the data, and blocking is counted with the scheduler suspended.  The
+ * time spent blocked is added once the blocking task runs again, and a
+ * timeout is counted after the scheduler is resumed, so both of those enter
+ * their own critical section.  xBlockStartTime is a local variable of the
+ * calling function.  SPSC and MPMC queues are not entered through a critical
+ * section, so statistics are not gathered for them.
+ */
+#if ( configUSE_IPC_STATISTICS == 1 )
+    #define queueSTATS_SENT( pxQueue )        ( ( pxQueue )->xStatistics.ulSends++ )
+    #define queueSTATS_RECEIVED( pxQueue )    ( ( pxQueue )->xStatistics.ulReceives++ )
+    #define queueSTATS_BLOCKING( pxQueue )     \
+    do {                                       \
+        ( pxQueue )->xStatistics.ulBlocks++;   \
+        xBlockStartTime = xTaskGetTickCount(); \
+    } while( 0 )
+    #define queueSTATS_UNBLOCKED( pxQueue )                                    \
+    do {                                                                       \
+        const TickType_t xBlockedTime = xTaskGetTickCount() - xBlockStartTime; \
+        queueENTER_CRITICAL( pxQueue );                                        \
+        ( pxQueue )->xStatistics.xTotalBlockedTime += xBlockedTime;            \
+        queueEXIT_CRITICAL( pxQueue );                                         \
+    } while( 0 )
+    #define queueSTATS_TIMED_OUT( pxQueue )    \
+    do {                                       \
+        queueENTER_CRITICAL( pxQueue );        \
+        ( pxQueue )->xStatistics.ulTimeouts++; \
+        queueEXIT_CRITICAL( pxQueue );         \
+    } while( 0 )
+    #define queueSTATS_DEPTH( pxQueue )                                                      \
+    do {                                                                                     \
+        if( ( size_t ) ( pxQueue )->uxMessagesWaiting > ( pxQueue )->xStatistics.xMaxDepth ) \
+        {                                                                                    \
+            ( pxQueue )->xStatistics.xMaxDepth = ( size_t ) ( pxQueue )->uxMessagesWaiting;  \
+        }                                                                                    \
+    } while( 0 )
+#else
+    #define queueSTATS_SENT( pxQueue )
+    #define queueSTATS_RECEIVED( pxQueue )
+    #define queueSTATS_BLOCKING( pxQueue )
+    #define queueSTATS_UNBLOCKED( pxQueue )
+    #define queueSTATS_TIMED_OUT( pxQueue )
+    #define queueSTATS_DEPTH( pxQueue )
+#endif /* configUSE_IPC_STATISTICS */
+
+/*
+ * Latency tags are kept for the plain and ring queues, one per slot in an
+ * array allocated with the queue.  Every path that writes an item to a slot
+ * tags it, so a slot never holds the stale tag of an earlier item.  An item
+ * sent to the back of the queue is written at pcWriteTo, and one sent to the
+ * front, or overwriting, at pcReadFrom.  An item read is left at pcReadFrom.
+ */
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+    #define queueSLOT_INDEX( pxQueue, pcSlot )    ( ( UBaseType_t ) ( ( size_t ) ( ( pcSlot ) - ( pxQueue )->pcHead ) / ( size_t ) ( pxQueue )->uxItemSize ) )
+    #define queueSTAMP_MESSAGE( pxQueue, xPosition, xFromISR ) \
+    prvStampMessageTags( ( pxQueue ), queueIS_SEND_TO_BACK( xPosition ) ? ( pxQueue )->pcWriteTo : ( pxQueue )->u.xQueue.pcReadFrom, ( UBaseType_t ) 1U, ( xFromISR ) )
+    #define queueSTAMP_MESSAGES( pxQueue, pcSlot, uxCount, xFromISR )      prvStampMessageTags( ( pxQueue ), ( pcSlot ), ( uxCount ), ( xFromISR ) )
+    #define queueRECEIVE_MESSAGE_TAGS( pxQueue, pcSlot, uxCount, xFromISR )    prvReceiveMessageTags( ( pxQueue ), ( pcSlot ), ( uxCount ), ( xFromISR ) )
+#else
+    #define queueSTAMP_MESSAGE( pxQueue, xPosition, xFromISR )
+    #define queueSTAMP_MESSAGES( pxQueue, pcSlot, uxCount, xFromISR )
+    #define queueRECEIVE_MESSAGE_TAGS( pxQueue, pcSlot, uxCount, xFromISR )
+#endif /* configUSE_IPC_LATENCY_TRACING */
+
 /*
  * Macro to mark a queue as locked.  Locking a queue prevents an ISR from
  * accessing the queue event lists.
  */
 #define prvLockQueue( pxQueue )                            \
-    taskENTER_CRITICAL();                                  \
+    queueENTER_CRITICAL( pxQueue );                        \
     {                                                      \
         if( ( pxQueue )->cRxLock == queueUNLOCKED )        \
         {                                                  \
@@ -267,7 +964,13 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
             ( pxQueue )->cTxLock = queueLOCKED_UNMODIFIED; \
         }                                                  \
     }                                                      \
-    taskEXIT_CRITICAL()
+    queueEXIT_CRITICAL( pxQueue )
+
+/*
+ * Macro to determine if a task has locked the queue by calling prvLockQueue.
+ */
+#define prvIsQueueLocked( pxQueue ) \
+    ( ( ( pxQueue )->cRxLock != queueUNLOCKED ) || ( ( pxQueue )->cTxLock != queueUNLOCKED ) )
 
 /*
  * Macro to increment cTxLock member of the queue data structure. It is
@@ -315,7 +1018,19 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
         /* Check for multiplication overflow. */
         ( ( SIZE_MAX / pxQueue->uxLength ) >= pxQueue->uxItemSize ) )
     {
-        taskENTER_CRITICAL();
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            /* A task blocking on the queue keeps it locked with only the
+             * scheduler suspended, so suspend the scheduler to ensure the lock
+             * counts and event lists are not changed underneath it. */
+            if( xNewQueue == pdFALSE )
+            {
+                vTaskSuspendAll();
+            }
+        }
+        #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+        queueENTER_CRITICAL( pxQueue );
         {
             pxQueue->u.xQueue.pcTail = pxQueue->pcHead + ( pxQueue->uxLength * pxQueue->uxItemSize );
             pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0U;
@@ -324,37 +1039,125 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
-            if( xNewQueue == pdFALSE )
+            #if ( configUSE_SPSC_QUEUES == 1 )
             {
-                /* If there are tasks blocked waiting to read from the queue, then
-                 * the tasks will remain blocked as after this function exits the queue
-                 * will still be empty.  If there are tasks blocked waiting to write to
-                 * the queue, then one should be unblocked as after this function exits
-                 * it will be possible to write to it. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                pxQueue->uxSpscItemsWritten = ( UBaseType_t ) 0U;
+                pxQueue->uxSpscItemsRead = ( UBaseType_t ) 0U;
+            }
+            #endif
+
+            #if ( configUSE_MPMC_QUEUES == 1 )
+            {
+                if( queueIS_MPMC( pxQueue ) )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-                    {
-                        queueYIELD_IF_USING_PREEMPTION();
-                    }
-                    else
+                    UBaseType_t uxSlot;
+
+                    /* Every slot starts out free for the position that maps
+                     * to it on the first pass around the ring. */
+                    for( uxSlot = ( UBaseType_t ) 0U; uxSlot < pxQueue->uxLength; uxSlot++ )
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        pxQueue->pulMpmcSequence[ uxSlot ] = ( uint32_t ) uxSlot;
                     }
+
+                    pxQueue->ulMpmcEnqueuePos = 0U;
+                    pxQueue->ulMpmcDequeuePos = 0U;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-            else
+            #endif
+
+            #if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+            {
+                pxQueue->ulAtomicCount = 0U;
+            }
+            #endif
+
+            #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+            {
+                /* A queue set counts its ready members in uxMessagesWaiting,
+                 * so the two are cleared together.  The member table is kept. */
+                pxQueue->uxReadyMembers = ( UBaseType_t ) 0U;
+            }
+            #endif
+
+            #if ( configUSE_ZERO_COPY_QUEUES == 1 )
+            {
+                /* Any slots handed out before the reset are discarded. */
+                pxQueue->pcReservedSendSlot = NULL;
+                pxQueue->pcAcquiredReceiveSlot = NULL;
+            }
+            #endif
+
+            #if ( configUSE_RPC_QUEUES == 1 )
+            {
+                if( ( xNewQueue == pdFALSE ) && queueIS_RPC( pxQueue ) )
+                {
+                    /* The discarded requests are never replied to, so their
+                     * clients time out.  Skip their tickets so the next reply
+                     * goes to the client of the next request sent.  A request
+                     * being served cannot be discarded this way. */
+                    configASSERT( pxQueue->ucRpcRequestInService == pdFALSE );
+                    pxQueue->xRpcNextReply = pxQueue->xRpcNextTicket;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            if( xNewQueue == pdFALSE )
+            {
+                /* If there are tasks blocked waiting to read from the queue, then
+                 * the tasks will remain blocked as after this function exits the queue
+                 * will still be empty.  If there are tasks blocked waiting to write to
+                 * the queue, then one should be unblocked as after this function exits
+                 * it will be possible to write to it. */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( queueUNBLOCK_SENDERS( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
             {
                 /* Ensure the event queues start in the correct state. */
-                vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
-                vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+                #if ( configEVENT_LIST_IMPLEMENTATION == EVENT_LIST_SKIP_LIST )
+                {
+                    vListInitialiseSkipList( &( pxQueue->xTasksWaitingToSend ) );
+                    vListInitialiseSkipList( &( pxQueue->xTasksWaitingToReceive ) );
+                }
+                #else
+                {
+                    vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
+                    vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+                }
+                #endif
             }
         }
-        taskEXIT_CRITICAL();
+        queueEXIT_CRITICAL( pxQueue );
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            if( xNewQueue == pdFALSE )
+            {
+                ( void ) xTaskResumeAll();
+            }
+        }
+        #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
     }
     else
     {
@@ -425,6 +1228,23 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             }
             #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 
+            #if ( configUSE_MPMC_QUEUES == 1 )
+            {
+                /* MPMC queues can only be created dynamically as the slot
+                 * sequence numbers are allocated with the queue. */
+                configASSERT( ucQueueType != queueQUEUE_TYPE_MPMC );
+                pxNewQueue->pulMpmcSequence = NULL;
+            }
+            #endif /* configUSE_MPMC_QUEUES */
+
+            #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+            {
+                /* The tags are allocated with the queue, so a statically
+                 * allocated queue does not carry them. */
+                pxNewQueue->pxMessageTags = NULL;
+            }
+            #endif
+
             prvInitialiseNewQueue( uxQueueLength, uxItemSize, pucQueueStorage, ucQueueType, pxNewQueue );
         }
         else
@@ -505,15 +1325,55 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
     {
         Queue_t * pxNewQueue = NULL;
         size_t xQueueSizeInBytes;
+        size_t xSequenceSizeInBytes = ( size_t ) 0;
+        size_t xTagsSizeInBytes = ( size_t ) 0;
         uint8_t * pucQueueStorage;
 
         traceENTER_xQueueGenericCreate( uxQueueLength, uxItemSize, ucQueueType );
 
+        #if ( configUSE_MPMC_QUEUES == 1 )
+        {
+            /* An MPMC queue holds a sequence number for each slot between the
+             * queue structure and the queue storage area. */
+            if( ( ucQueueType == queueQUEUE_TYPE_MPMC ) &&
+                ( uxQueueLength > ( UBaseType_t ) 0 ) &&
+                /* Check for multiplication overflow. */
+                ( ( SIZE_MAX / uxQueueLength ) >= sizeof( uint32_t ) ) )
+            {
+                xSequenceSizeInBytes = ( size_t ) uxQueueLength * sizeof( uint32_t );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_MPMC_QUEUES */
+
+        #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        {
+            /* Plain and ring queues hold a latency tag for each slot, after
+             * any MPMC sequence numbers.  Semaphores, queue sets and the
+             * queue types with their own send and receive paths do not. */
+            if( ( ( ucQueueType == queueQUEUE_TYPE_BASE ) || ( ucQueueType == queueQUEUE_TYPE_RING ) ) &&
+                ( uxItemSize > ( UBaseType_t ) 0 ) &&
+                ( uxQueueLength > ( UBaseType_t ) 0 ) &&
+                /* Check for multiplication overflow. */
+                ( ( SIZE_MAX / uxQueueLength ) >= sizeof( MessageTag_t ) ) )
+            {
+                xTagsSizeInBytes = ( size_t ) uxQueueLength * sizeof( MessageTag_t );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_IPC_LATENCY_TRACING */
+
         if( ( uxQueueLength > ( UBaseType_t ) 0 ) &&
             /* Check for multiplication overflow. */
             ( ( SIZE_MAX / uxQueueLength ) >= uxItemSize ) &&
             /* Check for addition overflow. */
-            ( ( SIZE_MAX - sizeof( Queue_t ) ) >= ( size_t ) ( uxQueueLength * uxItemSize ) ) )
+            ( ( SIZE_MAX - sizeof( Queue_t ) - xSequenceSizeInBytes - xTagsSizeInBytes ) >= ( size_t ) ( uxQueueLength * uxItemSize ) ) )
         {
             /* Allocate enough space to hold the maximum number of items that
              * can be in the queue at any time.  It is valid for uxItemSize to be
@@ -523,7 +1383,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
+            pxNewQueue = ( Queue_t * ) queueALLOCATE( sizeof( Queue_t ) + xSequenceSizeInBytes + xTagsSizeInBytes + xQueueSizeInBytes );
 
             if( pxNewQueue != NULL )
             {
@@ -532,6 +1392,41 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
                 pucQueueStorage = ( uint8_t * ) pxNewQueue;
                 pucQueueStorage += sizeof( Queue_t );
 
+                #if ( configUSE_MPMC_QUEUES == 1 )
+                {
+                    if( xSequenceSizeInBytes > ( size_t ) 0 )
+                    {
+                        /* MISRA Ref 11.3.1 [Misaligned access] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                        /* coverity[misra_c_2012_rule_11_3_violation] */
+                        pxNewQueue->pulMpmcSequence = ( volatile uint32_t * ) pucQueueStorage;
+                        pucQueueStorage += xSequenceSizeInBytes;
+                    }
+                    else
+                    {
+                        pxNewQueue->pulMpmcSequence = NULL;
+                    }
+                }
+                #endif /* configUSE_MPMC_QUEUES */
+
+                #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+                {
+                    if( xTagsSizeInBytes > ( size_t ) 0 )
+                    {
+                        /* MISRA Ref 11.3.1 [Misaligned access] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                        /* coverity[misra_c_2012_rule_11_3_violation] */
+                        pxNewQueue->pxMessageTags = ( MessageTag_t * ) pucQueueStorage;
+                        ( void ) memset( ( void * ) pxNewQueue->pxMessageTags, 0x00, xTagsSizeInBytes );
+                        pucQueueStorage += xTagsSizeInBytes;
+                    }
+                    else
+                    {
+                        pxNewQueue->pxMessageTags = NULL;
+                    }
+                }
+                #endif /* configUSE_IPC_LATENCY_TRACING */
+
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
                     /* Queues can be created either statically or dynamically, so
@@ -591,6 +1486,76 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
      * defined. */
     pxNewQueue->uxLength = uxQueueLength;
     pxNewQueue->uxItemSize = uxItemSize;
+
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        /* An SPSC queue must hold data, so cannot be a semaphore. */
+        configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_SPSC ) && ( uxItemSize == ( UBaseType_t ) 0 ) ) );
+        pxNewQueue->ucSpscQueue = ( ucQueueType == queueQUEUE_TYPE_SPSC ) ? ( uint8_t ) pdTRUE : ( uint8_t ) pdFALSE;
+    }
+    #endif
+
+    #if ( configUSE_MPMC_QUEUES == 1 )
+    {
+        /* An MPMC queue must hold data, and its length must be a power of
+         * two. */
+        configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_MPMC ) && ( uxItemSize == ( UBaseType_t ) 0 ) ) );
+        configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_MPMC ) && ( ( uxQueueLength & ( uxQueueLength - ( UBaseType_t ) 1U ) ) != ( UBaseType_t ) 0U ) ) );
+    }
+    #endif
+
+    #if ( configUSE_RING_QUEUES == 1 )
+    {
+        /* A ring queue must hold data, so cannot be a semaphore. */
+        configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_RING ) && ( uxItemSize == ( UBaseType_t ) 0 ) ) );
+        pxNewQueue->ucRingQueue = ( ucQueueType == queueQUEUE_TYPE_RING ) ? ( uint8_t ) pdTRUE : ( uint8_t ) pdFALSE;
+        pxNewQueue->uxRingItemsDropped = ( UBaseType_t ) 0U;
+    }
+    #endif
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+    {
+        /* Each item in a priority queue starts with its key. */
+        configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_PRIORITY ) && ( uxItemSize < ( UBaseType_t ) sizeof( uint32_t ) ) ) );
+        pxNewQueue->ucPriorityQueue = ( ucQueueType == queueQUEUE_TYPE_PRIORITY ) ? ( uint8_t ) pdTRUE : ( uint8_t ) pdFALSE;
+    }
+    #endif
+
+    #if ( configUSE_RPC_QUEUES == 1 )
+    {
+        /* An RPC queue must hold requests, so cannot be a semaphore. */
+        configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_RPC ) && ( uxItemSize == ( UBaseType_t ) 0 ) ) );
+        pxNewQueue->ucRpcQueue = ( ucQueueType == queueQUEUE_TYPE_RPC ) ? ( uint8_t ) pdTRUE : ( uint8_t ) pdFALSE;
+        vListInitialise( &( pxNewQueue->xTasksWaitingForReply ) );
+        pxNewQueue->xRpcServer = NULL;
+        pxNewQueue->xRpcNextTicket = ( TickType_t ) 0U;
+        pxNewQueue->xRpcNextReply = ( TickType_t ) 0U;
+        pxNewQueue->ucRpcRequestInService = ( uint8_t ) pdFALSE;
+        pxNewQueue->ucRpcServerHoldsQueue = ( uint8_t ) pdFALSE;
+    }
+    #endif
+
+    #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+    {
+        ( void ) memset( ( void * ) &( pxNewQueue->xLatencyHistogram ), 0x00, sizeof( pxNewQueue->xLatencyHistogram ) );
+    }
+    #endif
+
+    #if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+    {
+        /* An atomic semaphore holds no data. */
+        configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_ATOMIC_SEMAPHORE ) && ( uxItemSize != ( UBaseType_t ) 0 ) ) );
+        pxNewQueue->ucAtomicSemaphore = ( ucQueueType == queueQUEUE_TYPE_ATOMIC_SEMAPHORE ) ? ( uint8_t ) pdTRUE : ( uint8_t ) pdFALSE;
+    }
+    #endif
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+    {
+        /* The lock must be usable before the queue is reset. */
+        portINIT_SPINLOCK( &( pxNewQueue->xQueueLock ) );
+    }
+    #endif
+
     ( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -605,6 +1570,37 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
     }
     #endif /* configUSE_QUEUE_SETS */
 
+    #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+    {
+        pxNewQueue->uxQueueSetIndex = ( UBaseType_t ) 0U;
+    }
+    #endif
+
+    #if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+    {
+        pxNewQueue->xTaskWaitingForAny = NULL;
+    }
+    #endif /* configUSE_QUEUE_WAIT_FOR_ANY */
+
+    #if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+    {
+        pxNewQueue->uxMultipleSendersWaiting = ( UBaseType_t ) 0U;
+    }
+    #endif
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+    {
+        ( void ) memset( &( pxNewQueue->xStatistics ), 0x00, sizeof( pxNewQueue->xStatistics ) );
+        pxNewQueue->xMutexTakenTime = ( TickType_t ) 0U;
+    }
+    #endif /* configUSE_IPC_STATISTICS */
+
+    #if ( configUSE_MUTEX_PRIORITY_CEILING == 1 )
+    {
+        pxNewQueue->uxCeilingPriority = ( UBaseType_t ) 0U;
+    }
+    #endif /* configUSE_MUTEX_PRIORITY_CEILING */
+
     traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
@@ -629,6 +1625,13 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
 
             /* Start with the semaphore in the expected state. */
             ( void ) xQueueGenericSend( pxNewQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
+
+            #if ( configUSE_IPC_STATISTICS == 1 )
+            {
+                /* The give above is not one made by the application. */
+                ( void ) memset( &( pxNewQueue->xStatistics ), 0x00, sizeof( pxNewQueue->xStatistics ) );
+            }
+            #endif
         }
         else
         {
@@ -684,6 +1687,77 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    QueueHandle_t xQueueCreateMutexWithCeiling( const uint8_t ucQueueType,
+                                                UBaseType_t uxCeilingPriority )
+    {
+        QueueHandle_t xNewQueue;
+        const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+        traceENTER_xQueueCreateMutexWithCeiling( ucQueueType, uxCeilingPriority );
+
+        configASSERT( ( uxCeilingPriority > ( UBaseType_t ) 0U ) && ( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES ) );
+
+        xNewQueue = xQueueGenericCreate( uxMutexLength, uxMutexSize, ucQueueType );
+
+        if( xNewQueue != NULL )
+        {
+            ( ( Queue_t * ) xNewQueue )->uxCeilingPriority = uxCeilingPriority;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvInitialiseMutex( ( Queue_t * ) xNewQueue );
+
+        traceRETURN_xQueueCreateMutexWithCeiling( xNewQueue );
+
+        return xNewQueue;
+    }
+
+#endif /* ( ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+    QueueHandle_t xQueueCreateMutexWithCeilingStatic( const uint8_t ucQueueType,
+                                                      UBaseType_t uxCeilingPriority,
+                                                      StaticQueue_t * pxStaticQueue )
+    {
+        QueueHandle_t xNewQueue;
+        const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+        traceENTER_xQueueCreateMutexWithCeilingStatic( ucQueueType, uxCeilingPriority, pxStaticQueue );
+
+        configASSERT( ( uxCeilingPriority > ( UBaseType_t ) 0U ) && ( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES ) );
+
+        /* Prevent compiler warnings about unused parameters if
+         * configUSE_TRACE_FACILITY does not equal 1. */
+        ( void ) ucQueueType;
+
+        xNewQueue = xQueueGenericCreateStatic( uxMutexLength, uxMutexSize, NULL, pxStaticQueue, ucQueueType );
+
+        if( xNewQueue != NULL )
+        {
+            ( ( Queue_t * ) xNewQueue )->uxCeilingPriority = uxCeilingPriority;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvInitialiseMutex( ( Queue_t * ) xNewQueue );
+
+        traceRETURN_xQueueCreateMutexWithCeilingStatic( xNewQueue );
+
+        return xNewQueue;
+    }
+
+#endif /* ( ( configUSE_MUTEX_PRIORITY_CEILING == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
 
     TaskHandle_t xQueueGetMutexHolder( QueueHandle_t xSemaphore )
@@ -936,57 +2010,182 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
 #endif /* ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
-                              const void * const pvItemToQueue,
-                              TickType_t xTicksToWait,
-                              const BaseType_t xCopyPosition )
-{
-    BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
-    TimeOut_t xTimeOut;
-    Queue_t * const pxQueue = xQueue;
-
-    traceENTER_xQueueGenericSend( xQueue, pvItemToQueue, xTicksToWait, xCopyPosition );
+#if ( ( configUSE_ATOMIC_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-    configASSERT( pxQueue );
-    configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-    configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
-    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    QueueHandle_t xQueueCreateAtomicSemaphoreStatic( const UBaseType_t uxMaxCount,
+                                                     const UBaseType_t uxInitialCount,
+                                                     StaticQueue_t * pxStaticQueue )
     {
-        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
-    }
-    #endif
+        QueueHandle_t xHandle = NULL;
 
-    for( ; ; )
-    {
-        taskENTER_CRITICAL();
+        traceENTER_xQueueCreateAtomicSemaphoreStatic( uxMaxCount, uxInitialCount, pxStaticQueue );
+
+        if( ( uxMaxCount != 0U ) &&
+            ( uxInitialCount <= uxMaxCount ) )
         {
-            /* Is there room on the queue now?  The running task must be the
-             * highest priority task wanting to access the queue.  If the head item
-             * in the queue is to be overwritten then it does not matter if the
-             * queue is full. */
-            if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+            xHandle = xQueueGenericCreateStatic( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, pxStaticQueue, queueQUEUE_TYPE_ATOMIC_SEMAPHORE );
+
+            if( xHandle != NULL )
             {
-                traceQUEUE_SEND( pxQueue );
+                ( ( Queue_t * ) xHandle )->ulAtomicCount = ( uint32_t ) uxInitialCount;
 
-                #if ( configUSE_QUEUE_SETS == 1 )
-                {
-                    const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
+                traceCREATE_COUNTING_SEMAPHORE();
+            }
+            else
+            {
+                traceCREATE_COUNTING_SEMAPHORE_FAILED();
+            }
+        }
+        else
+        {
+            configASSERT( xHandle );
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-                    xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+        traceRETURN_xQueueCreateAtomicSemaphoreStatic( xHandle );
 
-                    if( pxQueue->pxQueueSetContainer != NULL )
-                    {
-                        if( ( xCopyPosition == queueOVERWRITE ) && ( uxPreviousMessagesWaiting != ( UBaseType_t ) 0 ) )
-                        {
-                            /* Do not notify the queue set as an existing item
-                             * was overwritten in the queue so the number of items
-                             * in the queue has not changed. */
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-                        else if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
-                        {
-                            /* The queue is a member of a queue set, and posting
-                             * to the queue set caused a higher priority task to
+        return xHandle;
+    }
+
+#endif /* ( ( configUSE_ATOMIC_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_ATOMIC_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    QueueHandle_t xQueueCreateAtomicSemaphore( const UBaseType_t uxMaxCount,
+                                               const UBaseType_t uxInitialCount )
+    {
+        QueueHandle_t xHandle = NULL;
+
+        traceENTER_xQueueCreateAtomicSemaphore( uxMaxCount, uxInitialCount );
+
+        if( ( uxMaxCount != 0U ) &&
+            ( uxInitialCount <= uxMaxCount ) )
+        {
+            xHandle = xQueueGenericCreate( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_ATOMIC_SEMAPHORE );
+
+            if( xHandle != NULL )
+            {
+                ( ( Queue_t * ) xHandle )->ulAtomicCount = ( uint32_t ) uxInitialCount;
+
+                traceCREATE_COUNTING_SEMAPHORE();
+            }
+            else
+            {
+                traceCREATE_COUNTING_SEMAPHORE_FAILED();
+            }
+        }
+        else
+        {
+            configASSERT( xHandle );
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xQueueCreateAtomicSemaphore( xHandle );
+
+        return xHandle;
+    }
+
+#endif /* ( ( configUSE_ATOMIC_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
+                              const void * const pvItemToQueue,
+                              TickType_t xTicksToWait,
+                              const BaseType_t xCopyPosition )
+{
+    BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+    TimeOut_t xTimeOut;
+    Queue_t * const pxQueue = xQueue;
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        TickType_t xBlockStartTime = 0U;
+    #endif
+
+    traceENTER_xQueueGenericSend( xQueue, pvItemToQueue, xTicksToWait, xCopyPosition );
+
+    configASSERT( pxQueue );
+    configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+    configASSERT( queueIS_COPY_POSITION_USED( xCopyPosition ) );
+    configASSERT( !( queueIS_OVERWRITE( xCopyPosition ) && ( pxQueue->uxLength != 1 ) ) );
+    queueASSERT_NOT_RPC( pxQueue );
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
+
+    #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+    {
+        if( queueIS_LOCK_FREE( pxQueue ) )
+        {
+            BaseType_t xReturn;
+
+            /* Items can only be posted to the back of an SPSC or MPMC
+             * queue. */
+            configASSERT( xCopyPosition == queueSEND_TO_BACK );
+
+            xReturn = prvLockFreeSend( pxQueue, pvItemToQueue, xTicksToWait );
+
+            traceRETURN_xQueueGenericSend( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+
+    for( ; ; )
+    {
+        queueENTER_CRITICAL( pxQueue );
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            if( prvIsQueueLocked( pxQueue ) )
+            {
+                /* A task on another core is adding itself to the event lists. */
+                queueEXIT_CRITICAL( pxQueue );
+                prvWaitForQueueUnlock();
+                continue;
+            }
+        }
+        #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+        {
+            /* Is there room on the queue now?  The running task must be the
+             * highest priority task wanting to access the queue.  If the head item
+             * in the queue is to be overwritten then it does not matter if the
+             * queue is full. */
+            if( queueCAN_ACCEPT( pxQueue, xCopyPosition ) )
+            {
+                traceQUEUE_SEND( pxQueue );
+                queueSTATS_SENT( pxQueue );
+                queueSTAMP_MESSAGE( pxQueue, xCopyPosition, pdFALSE );
+
+                #if ( configUSE_QUEUE_SETS == 1 )
+                {
+                    const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+                    xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+
+                    #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) )
+                    {
+                        prvHandOffMutex( pxQueue );
+                    }
+                    #endif
+
+                    if( pxQueue->pxQueueSetContainer != NULL )
+                    {
+                        if( queueITEM_REPLACED( pxQueue, xCopyPosition, uxPreviousMessagesWaiting ) )
+                        {
+                            /* Do not notify the queue set as an existing item
+                             * was overwritten or discarded so the number of items
+                             * in the queue has not changed. */
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                        else if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                        {
+                            /* The queue is a member of a queue set, and posting
+                             * to the queue set caused a higher priority task to
                              * unblock. A context switch is required. */
                             queueYIELD_IF_USING_PREEMPTION();
                         }
@@ -1032,6 +2231,12 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 {
                     xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
+                    #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) )
+                    {
+                        prvHandOffMutex( pxQueue );
+                    }
+                    #endif
+
                     /* If there was a task waiting for data to arrive on the
                      * queue then unblock it now. */
                     if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
@@ -1064,7 +2269,9 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 }
                 #endif /* configUSE_QUEUE_SETS */
 
-                taskEXIT_CRITICAL();
+                queueNOTIFY_TASK_WAITING_FOR_ANY( pxQueue );
+
+                queueEXIT_CRITICAL( pxQueue );
 
                 traceRETURN_xQueueGenericSend( pdPASS );
 
@@ -1076,7 +2283,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 {
                     /* The queue was full and no block time is specified (or
                      * the block time has expired) so leave now. */
-                    taskEXIT_CRITICAL();
+                    queueEXIT_CRITICAL( pxQueue );
 
                     /* Return to the original privilege level before exiting
                      * the function. */
@@ -1099,7 +2306,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 }
             }
         }
-        taskEXIT_CRITICAL();
+        queueEXIT_CRITICAL( pxQueue );
 
         /* Interrupts and other tasks can send to and receive from the queue
          * now the critical section has been exited. */
@@ -1113,6 +2320,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
             if( prvIsQueueFull( pxQueue ) != pdFALSE )
             {
                 traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                queueSTATS_BLOCKING( pxQueue );
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
 
                 /* Unlocking the queue means queue events can effect the
@@ -1131,6 +2339,8 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 {
                     taskYIELD_WITHIN_API();
                 }
+
+                queueSTATS_UNBLOCKED( pxQueue );
             }
             else
             {
@@ -1145,6 +2355,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
             prvUnlockQueue( pxQueue );
             ( void ) xTaskResumeAll();
 
+            queueSTATS_TIMED_OUT( pxQueue );
             traceQUEUE_SEND_FAILED( pxQueue );
             traceRETURN_xQueueGenericSend( errQUEUE_FULL );
 
@@ -1154,6 +2365,232 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    BaseType_t xQueueSendMultiple( QueueHandle_t xQueue,
+                                   const void * const pvItems,
+                                   const UBaseType_t uxCount,
+                                   TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+        TimeOut_t xTimeOut;
+        UBaseType_t uxWoken;
+        Queue_t * const pxQueue = xQueue;
+
+        #if ( configUSE_IPC_STATISTICS == 1 )
+            TickType_t xBlockStartTime = 0U;
+        #endif
+
+        traceENTER_xQueueSendMultiple( xQueue, pvItems, uxCount, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvItems );
+        queueASSERT_NOT_LOCK_FREE( pxQueue );
+        queueASSERT_NOT_RPC( pxQueue );
+
+        /* The items in a priority queue are not held in order, so cannot be
+         * moved as a block. */
+        configASSERT( !queueIS_PRIORITY( pxQueue ) );
+
+        /* Semaphores have no storage to copy into, and all the items must fit
+         * in the queue at once. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        configASSERT( ( uxCount > ( UBaseType_t ) 0U ) && ( uxCount <= pxQueue->uxLength ) );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            queueENTER_CRITICAL( pxQueue );
+
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                if( prvIsQueueLocked( pxQueue ) )
+                {
+                    /* A task on another core is adding itself to the event lists. */
+                    queueEXIT_CRITICAL( pxQueue );
+                    prvWaitForQueueUnlock();
+                    continue;
+                }
+            }
+            #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+            /* Is there room for all the items now? */
+            if( queueSPACES_AVAILABLE( pxQueue ) >= uxCount )
+            {
+                traceQUEUE_SEND( pxQueue );
+                queueSTATS_SENT( pxQueue );
+
+                queueSTAMP_MESSAGES( pxQueue, pxQueue->pcWriteTo, uxCount, pdFALSE );
+                prvCopyItemsToQueue( pxQueue, pvItems, uxCount );
+                xYieldRequired = pdFALSE;
+                uxWoken = ( UBaseType_t ) 0U;
+
+                #if ( configUSE_QUEUE_SETS == 1 )
+                {
+                    if( pxQueue->pxQueueSetContainer != NULL )
+                    {
+                        /* A queue set holds one entry per item in its member
+                         * queues, so is notified once for each item in place
+                         * of waking receivers. */
+                        for( ; uxWoken < uxCount; uxWoken++ )
+                        {
+                            if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                            {
+                                xYieldRequired = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_QUEUE_SETS */
+
+                /* Unblock up to one task waiting for data for each item
+                 * posted, yielding at most once for the whole batch. */
+                for( ; ( uxWoken < uxCount ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ); uxWoken++ )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        xYieldRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( xYieldRequired != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                queueNOTIFY_TASK_WAITING_FOR_ANY( pxQueue );
+
+                queueEXIT_CRITICAL( pxQueue );
+
+                traceRETURN_xQueueSendMultiple( pdPASS );
+
+                return pdPASS;
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                /* There is not enough space and no block time is specified (or
+                 * the block time has expired) so leave now. */
+                queueEXIT_CRITICAL( pxQueue );
+
+                traceQUEUE_SEND_FAILED( pxQueue );
+                traceRETURN_xQueueSendMultiple( errQUEUE_FULL );
+
+                return errQUEUE_FULL;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                /* There is not enough space and a block time was specified so
+                 * configure the timeout structure. */
+                vTaskInternalSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+            else
+            {
+                /* Entry time was already set. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            queueEXIT_CRITICAL( pxQueue );
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( prvIsQueueTooFullFor( pxQueue, uxCount ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    queueSTATS_BLOCKING( pxQueue );
+
+                    if( uxCount > ( UBaseType_t ) 1U )
+                    {
+                        /* Receivers then unblock every waiting sender, as one
+                         * wake can be used up by this task without it being
+                         * able to post. */
+                        queueENTER_CRITICAL( pxQueue );
+                        {
+                            pxQueue->uxMultipleSendersWaiting++;
+                        }
+                        queueEXIT_CRITICAL( pxQueue );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( uxCount > ( UBaseType_t ) 1U )
+                    {
+                        queueENTER_CRITICAL( pxQueue );
+                        {
+                            pxQueue->uxMultipleSendersWaiting--;
+                        }
+                        queueEXIT_CRITICAL( pxQueue );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    queueSTATS_UNBLOCKED( pxQueue );
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* The timeout has expired. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                queueSTATS_TIMED_OUT( pxQueue );
+                traceQUEUE_SEND_FAILED( pxQueue );
+                traceRETURN_xQueueSendMultiple( errQUEUE_FULL );
+
+                return errQUEUE_FULL;
+            }
+        }
+    }
+
+#endif /* #if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 ) */
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                                      const void * const pvItemToQueue,
                                      BaseType_t * const pxHigherPriorityTaskWoken,
@@ -1167,7 +2604,9 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
 
     configASSERT( pxQueue );
     configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-    configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+    configASSERT( queueIS_COPY_POSITION_USED( xCopyPosition ) );
+    configASSERT( !( queueIS_OVERWRITE( xCopyPosition ) && ( pxQueue->uxLength != 1 ) ) );
+    queueASSERT_NOT_RPC( pxQueue );
 
     /* RTOS ports that support interrupt nesting have the concept of a maximum
      * system call (or maximum API call) interrupt priority.  Interrupts that are
@@ -1185,6 +2624,42 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
      * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
     portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
+    #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+    {
+        if( queueIS_LOCK_FREE( pxQueue ) )
+        {
+            /* Items can only be posted to the back of an SPSC or MPMC
+             * queue. */
+            configASSERT( xCopyPosition == queueSEND_TO_BACK );
+
+            if( prvLockFreeWrite( pxQueue, pvItemToQueue ) != pdFALSE )
+            {
+                traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+                if( ( prvLockFreeWakeWaiter( pxQueue, pdTRUE, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+                xReturn = errQUEUE_FULL;
+            }
+
+            traceRETURN_xQueueGenericSendFromISR( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+
     /* Similar to xQueueGenericSend, except without blocking if there is no room
      * in the queue.  Also don't directly wake a task that was blocked on a queue
      * read, instead return a flag to say whether a context switch is required or
@@ -1193,14 +2668,16 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
     {
-        if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+        if( queueCAN_ACCEPT( pxQueue, xCopyPosition ) )
         {
             const int8_t cTxLock = pxQueue->cTxLock;
             const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
 
             traceQUEUE_SEND_FROM_ISR( pxQueue );
+            queueSTATS_SENT( pxQueue );
+            queueSTAMP_MESSAGE( pxQueue, xCopyPosition, pdTRUE );
 
             /* Semaphores use xQueueGiveFromISR(), so pxQueue will not be a
              *  semaphore or mutex.  That means prvCopyDataToQueue() cannot result
@@ -1208,6 +2685,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
              *  called here even though the disinherit function does not check if
              *  the scheduler is suspended before accessing the ready lists. */
             ( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+            queueNOTIFY_TASK_WAITING_FOR_ANY_FROM_ISR( pxQueue, pxHigherPriorityTaskWoken );
 
             /* The event list is not altered if the queue is locked.  This will
              * be done when the queue is unlocked later. */
@@ -1217,10 +2695,10 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                 {
                     if( pxQueue->pxQueueSetContainer != NULL )
                     {
-                        if( ( xCopyPosition == queueOVERWRITE ) && ( uxPreviousMessagesWaiting != ( UBaseType_t ) 0 ) )
+                        if( queueITEM_REPLACED( pxQueue, xCopyPosition, uxPreviousMessagesWaiting ) )
                         {
                             /* Do not notify the queue set as an existing item
-                             * was overwritten in the queue so the number of items
+                             * was overwritten or discarded so the number of items
                              * in the queue has not changed. */
                             mtCOVERAGE_TEST_MARKER();
                         }
@@ -1303,6 +2781,12 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                 }
                 #endif /* configUSE_QUEUE_SETS */
             }
+            else if( queueITEM_REPLACED( pxQueue, xCopyPosition, uxPreviousMessagesWaiting ) )
+            {
+                /* The number of items in the queue has not changed, so there
+                 * is nothing for the task that unlocks the queue to report. */
+                mtCOVERAGE_TEST_MARKER();
+            }
             else
             {
                 /* Increment the lock count so the task that unlocks the queue
@@ -1318,7 +2802,7 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
             xReturn = errQUEUE_FULL;
         }
     }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
 
     traceRETURN_xQueueGenericSendFromISR( xReturn );
 
@@ -1368,10 +2852,42 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
      * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
     portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
+    #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+    {
+        if( queueIS_LOCK_FREE( pxQueue ) )
+        {
+            if( prvLockFreeWrite( pxQueue, NULL ) != pdFALSE )
+            {
+                traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+                if( ( prvLockFreeWakeWaiter( pxQueue, pdTRUE, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+                xReturn = errQUEUE_FULL;
+            }
+
+            traceRETURN_xQueueGiveFromISR( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
     {
         const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
@@ -1383,6 +2899,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
             const int8_t cTxLock = pxQueue->cTxLock;
 
             traceQUEUE_SEND_FROM_ISR( pxQueue );
+            queueSTATS_SENT( pxQueue );
 
             /* A task can only have an inherited priority if it is a mutex
              * holder - and if there is a mutex holder then the mutex cannot be
@@ -1391,6 +2908,8 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
              * priority disinheritance is needed.  Simply increase the count of
              * messages (semaphores) available. */
             pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting + ( UBaseType_t ) 1 );
+            queueSTATS_DEPTH( pxQueue );
+            queueNOTIFY_TASK_WAITING_FOR_ANY_FROM_ISR( pxQueue, pxHigherPriorityTaskWoken );
 
             /* The event list is not altered if the queue is locked.  This will
              * be done when the queue is unlocked later. */
@@ -1491,7 +3010,7 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
             xReturn = errQUEUE_FULL;
         }
     }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
 
     traceRETURN_xQueueGiveFromISR( xReturn );
 
@@ -1507,6 +3026,10 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
     TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
 
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        TickType_t xBlockStartTime = 0U;
+    #endif
+
     traceENTER_xQueueReceive( xQueue, pvBuffer, xTicksToWait );
 
     /* Check the pointer is not NULL. */
@@ -1523,27 +3046,71 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
     }
     #endif
 
+    #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+    {
+        if( queueIS_LOCK_FREE( pxQueue ) )
+        {
+            BaseType_t xReturn;
+
+            xReturn = prvLockFreeReceive( pxQueue, pvBuffer, xTicksToWait );
+
+            traceRETURN_xQueueReceive( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+
     for( ; ; )
     {
-        taskENTER_CRITICAL();
+        queueENTER_CRITICAL( pxQueue );
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            if( prvIsQueueLocked( pxQueue ) )
+            {
+                /* A task on another core is adding itself to the event lists. */
+                queueEXIT_CRITICAL( pxQueue );
+                prvWaitForQueueUnlock();
+                continue;
+            }
+        }
+        #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
         {
             const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
 
             /* Is there data in the queue now?  To be running the calling task
              * must be the highest priority task wanting to access the queue. */
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            if( queueHAS_ITEMS( pxQueue ) )
             {
                 /* Data available, remove one item. */
                 prvCopyDataFromQueue( pxQueue, pvBuffer );
+                queueRECEIVE_MESSAGE_TAGS( pxQueue, pxQueue->u.xQueue.pcReadFrom, ( UBaseType_t ) 1U, pdFALSE );
+                queuePRIORITY_REMOVE_HEAD( pxQueue );
                 traceQUEUE_RECEIVE( pxQueue );
+                queueSTATS_RECEIVED( pxQueue );
                 pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
 
+                #if ( configUSE_RPC_QUEUES == 1 )
+                {
+                    if( queueIS_RPC( pxQueue ) )
+                    {
+                        prvRpcRequestReceived( pxQueue );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+
                 /* There is now space in the queue, were any tasks waiting to
                  * post to the queue?  If so, unblock the highest priority waiting
                  * task. */
                 if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    if( queueUNBLOCK_SENDERS( pxQueue ) != pdFALSE )
                     {
                         queueYIELD_IF_USING_PREEMPTION();
                     }
@@ -1557,7 +3124,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                taskEXIT_CRITICAL();
+                queueEXIT_CRITICAL( pxQueue );
 
                 traceRETURN_xQueueReceive( pdPASS );
 
@@ -1569,7 +3136,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 {
                     /* The queue was empty and no block time is specified (or
                      * the block time has expired) so leave now. */
-                    taskEXIT_CRITICAL();
+                    queueEXIT_CRITICAL( pxQueue );
 
                     traceQUEUE_RECEIVE_FAILED( pxQueue );
                     traceRETURN_xQueueReceive( errQUEUE_EMPTY );
@@ -1590,7 +3157,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 }
             }
         }
-        taskEXIT_CRITICAL();
+        queueEXIT_CRITICAL( pxQueue );
 
         /* Interrupts and other tasks can send to and receive from the queue
          * now the critical section has been exited. */
@@ -1606,6 +3173,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
             if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
             {
                 traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                queueSTATS_BLOCKING( pxQueue );
                 vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
                 prvUnlockQueue( pxQueue );
 
@@ -1617,6 +3185,8 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
+
+                queueSTATS_UNBLOCKED( pxQueue );
             }
             else
             {
@@ -1635,6 +3205,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 
             if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
             {
+                queueSTATS_TIMED_OUT( pxQueue );
                 traceQUEUE_RECEIVE_FAILED( pxQueue );
                 traceRETURN_xQueueReceive( errQUEUE_EMPTY );
 
@@ -1649,450 +3220,468 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
-                                TickType_t xTicksToWait )
-{
-    BaseType_t xEntryTimeSet = pdFALSE;
-    TimeOut_t xTimeOut;
-    Queue_t * const pxQueue = xQueue;
+#if ( configUSE_HR_TIMEOUTS == 1 )
 
-    #if ( configUSE_MUTEXES == 1 )
-        BaseType_t xInheritanceOccurred = pdFALSE;
-    #endif
+    BaseType_t xQueueReceiveUs( QueueHandle_t xQueue,
+                                void * const pvBuffer,
+                                uint32_t ulMicroseconds )
+    {
+        BaseType_t xReturn;
 
-    traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait );
+        traceENTER_xQueueReceiveUs( xQueue, pvBuffer, ulMicroseconds );
 
-    /* Check the queue pointer is not NULL. */
-    configASSERT( ( pxQueue ) );
+        if( ulMicroseconds == 0U )
+        {
+            xReturn = xQueueReceive( xQueue, pvBuffer, 0 );
+        }
+        else
+        {
+            /* Block without a tick based timeout.  The high resolution timeout
+             * unblocks the task as if the delay was aborted, which
+             * xQueueReceive() treats as the block time expiring. */
+            vTaskSetHrTimeout( ulMicroseconds );
+            xReturn = xQueueReceive( xQueue, pvBuffer, portMAX_DELAY );
+            vTaskClearHrTimeout();
+        }
 
-    /* Check this really is a semaphore, in which case the item size will be
-     * 0. */
-    configASSERT( pxQueue->uxItemSize == 0 );
+        traceRETURN_xQueueReceiveUs( xReturn );
 
-    /* Cannot block if the scheduler is suspended. */
-    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
-    {
-        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        return xReturn;
     }
-    #endif
 
-    for( ; ; )
+#endif /* configUSE_HR_TIMEOUTS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                        void * const pvBuffer,
+                                        const UBaseType_t uxMaxCount,
+                                        TickType_t xTicksToWait )
     {
-        taskENTER_CRITICAL();
+        BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
+        TimeOut_t xTimeOut;
+        UBaseType_t uxReceived, uxWoken;
+        Queue_t * const pxQueue = xQueue;
+
+        #if ( configUSE_IPC_STATISTICS == 1 )
+            TickType_t xBlockStartTime = 0U;
+        #endif
+
+        traceENTER_uxQueueReceiveMultiple( xQueue, pvBuffer, uxMaxCount, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvBuffer );
+        queueASSERT_NOT_LOCK_FREE( pxQueue );
+        queueASSERT_NOT_RPC( pxQueue );
+
+        /* The items in a priority queue are not held in order, so cannot be
+         * moved as a block. */
+        configASSERT( !queueIS_PRIORITY( pxQueue ) );
+
+        /* Semaphores have no storage to copy from. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+        configASSERT( uxMaxCount > ( UBaseType_t ) 0U );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
-            /* Semaphores are queues with an item size of 0, and where the
-             * number of messages in the queue is the semaphore's count value. */
-            const UBaseType_t uxSemaphoreCount = pxQueue->uxMessagesWaiting;
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
 
-            /* Is there data in the queue now?  To be running the calling task
-             * must be the highest priority task wanting to access the queue. */
-            if( uxSemaphoreCount > ( UBaseType_t ) 0 )
+        for( ; ; )
+        {
+            queueENTER_CRITICAL( pxQueue );
+
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
             {
-                traceQUEUE_RECEIVE( pxQueue );
+                if( prvIsQueueLocked( pxQueue ) )
+                {
+                    /* A task on another core is adding itself to the event lists. */
+                    queueEXIT_CRITICAL( pxQueue );
+                    prvWaitForQueueUnlock();
+                    continue;
+                }
+            }
+            #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
 
-                /* Semaphores are queues with a data size of zero and where the
-                 * messages waiting is the semaphore's count.  Reduce the count. */
-                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxSemaphoreCount - ( UBaseType_t ) 1 );
+            if( queueHAS_ITEMS( pxQueue ) )
+            {
+                /* Remove as many of the requested items as are available. */
+                uxReceived = pxQueue->uxMessagesWaiting;
 
-                #if ( configUSE_MUTEXES == 1 )
+                if( uxReceived > uxMaxCount )
                 {
-                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
-                    {
-                        /* Record the information required to implement
-                         * priority inheritance should it become necessary. */
-                        pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                    uxReceived = uxMaxCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
                 }
-                #endif /* configUSE_MUTEXES */
 
-                /* Check to see if other tasks are blocked waiting to give the
-                 * semaphore, and if so, unblock the highest priority such task. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                prvCopyItemsFromQueue( pxQueue, pvBuffer, uxReceived );
+                queueRECEIVE_MESSAGE_TAGS( pxQueue, pxQueue->u.xQueue.pcReadFrom, uxReceived, pdFALSE );
+                traceQUEUE_RECEIVE( pxQueue );
+                queueSTATS_RECEIVED( pxQueue );
+                xYieldRequired = pdFALSE;
+
+                /* Unblock up to one task waiting to post for each item
+                 * removed, or every waiting task while one needs space for
+                 * more than one item, yielding at most once for the whole
+                 * batch. */
+                for( uxWoken = ( UBaseType_t ) 0U; ( uxWoken < uxReceived ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ); uxWoken++ )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    if( queueUNBLOCK_SENDERS( pxQueue ) != pdFALSE )
                     {
-                        queueYIELD_IF_USING_PREEMPTION();
+                        xYieldRequired = pdTRUE;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
+
+                if( xYieldRequired != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                taskEXIT_CRITICAL();
+                queueEXIT_CRITICAL( pxQueue );
 
-                traceRETURN_xQueueSemaphoreTake( pdPASS );
+                traceRETURN_uxQueueReceiveMultiple( uxReceived );
 
-                return pdPASS;
+                return uxReceived;
             }
-            else
+            else if( xTicksToWait == ( TickType_t ) 0 )
             {
-                if( xTicksToWait == ( TickType_t ) 0 )
-                {
-                    /* The semaphore count was 0 and no block time is specified
-                     * (or the block time has expired) so exit now. */
-                    taskEXIT_CRITICAL();
+                /* The queue was empty and no block time is specified (or the
+                 * block time has expired) so leave now. */
+                queueEXIT_CRITICAL( pxQueue );
 
-                    traceQUEUE_RECEIVE_FAILED( pxQueue );
-                    traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+                traceRETURN_uxQueueReceiveMultiple( 0 );
 
-                    return errQUEUE_EMPTY;
-                }
-                else if( xEntryTimeSet == pdFALSE )
-                {
-                    /* The semaphore count was 0 and a block time was specified
-                     * so configure the timeout structure ready to block. */
-                    vTaskInternalSetTimeOutState( &xTimeOut );
-                    xEntryTimeSet = pdTRUE;
-                }
-                else
-                {
-                    /* Entry time was already set. */
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                return ( UBaseType_t ) 0U;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                /* The queue was empty and a block time was specified so
+                 * configure the timeout structure. */
+                vTaskInternalSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+            else
+            {
+                /* Entry time was already set. */
+                mtCOVERAGE_TEST_MARKER();
             }
-        }
-        taskEXIT_CRITICAL();
 
-        /* Interrupts and other tasks can give to and take from the semaphore
-         * now the critical section has been exited. */
+            queueEXIT_CRITICAL( pxQueue );
 
-        vTaskSuspendAll();
-        prvLockQueue( pxQueue );
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
 
-        /* Update the timeout state to see if it has expired yet. */
-        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
-        {
-            /* A block time is specified and not expired.  If the semaphore
-             * count is 0 then enter the Blocked state to wait for a semaphore to
-             * become available.  As semaphores are implemented with queues the
-             * queue being empty is equivalent to the semaphore count being 0. */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
             {
-                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
-
-                #if ( configUSE_MUTEXES == 1 )
+                if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
                 {
-                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    queueSTATS_BLOCKING( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
                     {
-                        taskENTER_CRITICAL();
-                        {
-                            xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
-                        }
-                        taskEXIT_CRITICAL();
+                        taskYIELD_WITHIN_API();
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
-                }
-                #endif /* if ( configUSE_MUTEXES == 1 ) */
-
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
-                prvUnlockQueue( pxQueue );
 
-                if( xTaskResumeAll() == pdFALSE )
-                {
-                    taskYIELD_WITHIN_API();
+                    queueSTATS_UNBLOCKED( pxQueue );
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    /* The queue contains data again.  Loop back to try and
+                     * read the data. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
                 }
             }
             else
             {
-                /* There was no timeout and the semaphore count was not 0, so
-                 * attempt to take the semaphore again. */
+                /* Timed out.  Loop back once more to read any data that
+                 * arrived, otherwise the zero block time path above is
+                 * taken. */
                 prvUnlockQueue( pxQueue );
                 ( void ) xTaskResumeAll();
+                xTicksToWait = ( TickType_t ) 0;
+                queueSTATS_TIMED_OUT( pxQueue );
             }
         }
-        else
+    }
+
+#endif /* #if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+
+    static BaseType_t prvClaimQueueSlot( Queue_t * const pxQueue,
+                                         void ** const ppvSlot,
+                                         TickType_t xTicksToWait,
+                                         const BaseType_t xIsSend )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
+
+        #if ( configUSE_IPC_STATISTICS == 1 )
+            TickType_t xBlockStartTime = 0U;
+        #endif
+
+        for( ; ; )
         {
-            /* Timed out. */
-            prvUnlockQueue( pxQueue );
-            ( void ) xTaskResumeAll();
+            queueENTER_CRITICAL( pxQueue );
 
-            /* If the semaphore count is 0 exit now as the timeout has
-             * expired.  Otherwise return to attempt to take the semaphore that is
-             * known to be available.  As semaphores are implemented by queues the
-             * queue being empty is equivalent to the semaphore count being 0. */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
             {
-                #if ( configUSE_MUTEXES == 1 )
+                if( prvIsQueueLocked( pxQueue ) )
                 {
-                    /* xInheritanceOccurred could only have be set if
-                     * pxQueue->uxQueueType == queueQUEUE_IS_MUTEX so no need to
-                     * test the mutex type again to check it is actually a mutex. */
-                    if( xInheritanceOccurred != pdFALSE )
-                    {
-                        taskENTER_CRITICAL();
-                        {
-                            UBaseType_t uxHighestWaitingPriority;
+                    /* A task on another core is adding itself to the event lists. */
+                    queueEXIT_CRITICAL( pxQueue );
+                    prvWaitForQueueUnlock();
+                    continue;
+                }
+            }
+            #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
 
-                            /* This task blocking on the mutex caused another
-                             * task to inherit this task's priority.  Now this task
-                             * has timed out the priority should be disinherited
-                             * again, but only as low as the next highest priority
-                             * task that is waiting for the same mutex. */
-                            uxHighestWaitingPriority = prvGetHighestPriorityOfWaitToReceiveList( pxQueue );
+            if( ( xIsSend != pdFALSE ) && ( queueHAS_SPACE( pxQueue ) ) )
+            {
+                /* Hand out the slot the next item would have been copied to.
+                 * The item is not counted, and no task is unblocked, until the
+                 * reservation is committed. */
+                pxQueue->pcReservedSendSlot = pxQueue->pcWriteTo;
+                pxQueue->pcWriteTo += pxQueue->uxItemSize;
 
-                            /* vTaskPriorityDisinheritAfterTimeout uses the uxHighestWaitingPriority
-                             * parameter to index pxReadyTasksLists when adding the task holding
-                             * mutex to the ready list for its new priority. Coverity thinks that
-                             * it can result in out-of-bounds access which is not true because
-                             * uxHighestWaitingPriority, as returned by prvGetHighestPriorityOfWaitToReceiveList,
-                             * is capped at ( configMAX_PRIORITIES - 1 ). */
-                            /* coverity[overrun] */
-                            vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
-                        }
-                        taskEXIT_CRITICAL();
-                    }
+                if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->pcWriteTo = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
                 }
-                #endif /* configUSE_MUTEXES */
 
-                traceQUEUE_RECEIVE_FAILED( pxQueue );
-                traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
+                *ppvSlot = ( void * ) pxQueue->pcReservedSendSlot;
+                queueEXIT_CRITICAL( pxQueue );
 
-                return errQUEUE_EMPTY;
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
+                return pdPASS;
             }
-        }
-    }
-}
-/*-----------------------------------------------------------*/
-
-BaseType_t xQueuePeek( QueueHandle_t xQueue,
-                       void * const pvBuffer,
-                       TickType_t xTicksToWait )
-{
-    BaseType_t xEntryTimeSet = pdFALSE;
-    TimeOut_t xTimeOut;
-    int8_t * pcOriginalReadPosition;
-    Queue_t * const pxQueue = xQueue;
-
-    traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait );
-
-    /* Check the pointer is not NULL. */
-    configASSERT( ( pxQueue ) );
-
-    /* The buffer into which data is received can only be NULL if the data size
-     * is zero (so no data is copied into the buffer. */
-    configASSERT( !( ( ( pvBuffer ) == NULL ) && ( ( pxQueue )->uxItemSize != ( UBaseType_t ) 0U ) ) );
-
-    /* Cannot block if the scheduler is suspended. */
-    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
-    {
-        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
-    }
-    #endif
-
-    for( ; ; )
-    {
-        taskENTER_CRITICAL();
-        {
-            const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
-
-            /* Is there data in the queue now?  To be running the calling task
-             * must be the highest priority task wanting to access the queue. */
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            else if( ( xIsSend == pdFALSE ) && ( queueHAS_ITEMS( pxQueue ) ) )
             {
-                /* Remember the read position so it can be reset after the data
-                 * is read from the queue as this function is only peeking the
-                 * data, not removing it. */
-                pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-
-                prvCopyDataFromQueue( pxQueue, pvBuffer );
-                traceQUEUE_PEEK( pxQueue );
-
-                /* The data is not being removed, so reset the read pointer. */
-                pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+                /* Hand out the slot the next item would have been copied
+                 * from.  The item is removed from the queue, but its slot is
+                 * not made available to senders until it is released. */
+                pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
 
-                /* The data is being left in the queue, so see if there are
-                 * any other tasks waiting for the data. */
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-                    {
-                        /* The task waiting has a higher priority than this task. */
-                        queueYIELD_IF_USING_PREEMPTION();
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                    pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
 
-                taskEXIT_CRITICAL();
+                pxQueue->pcAcquiredReceiveSlot = pxQueue->u.xQueue.pcReadFrom;
+                queueRECEIVE_MESSAGE_TAGS( pxQueue, pxQueue->u.xQueue.pcReadFrom, ( UBaseType_t ) 1U, pdFALSE );
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1 );
 
-                traceRETURN_xQueuePeek( pdPASS );
+                *ppvSlot = ( void * ) pxQueue->pcAcquiredReceiveSlot;
+                queueEXIT_CRITICAL( pxQueue );
 
                 return pdPASS;
             }
-            else
+            else if( xTicksToWait == ( TickType_t ) 0 )
             {
-                if( xTicksToWait == ( TickType_t ) 0 )
-                {
-                    /* The queue was empty and no block time is specified (or
-                     * the block time has expired) so leave now. */
-                    taskEXIT_CRITICAL();
+                /* No slot is available and no block time is specified (or the
+                 * block time has expired) so leave now. */
+                queueEXIT_CRITICAL( pxQueue );
 
-                    traceQUEUE_PEEK_FAILED( pxQueue );
-                    traceRETURN_xQueuePeek( errQUEUE_EMPTY );
+                *ppvSlot = NULL;
 
-                    return errQUEUE_EMPTY;
-                }
-                else if( xEntryTimeSet == pdFALSE )
-                {
-                    /* The queue was empty and a block time was specified so
-                     * configure the timeout structure ready to enter the blocked
-                     * state. */
-                    vTaskInternalSetTimeOutState( &xTimeOut );
-                    xEntryTimeSet = pdTRUE;
-                }
-                else
-                {
-                    /* Entry time was already set. */
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                return ( xIsSend != pdFALSE ) ? errQUEUE_FULL : errQUEUE_EMPTY;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                /* No slot is available and a block time was specified so
+                 * configure the timeout structure. */
+                vTaskInternalSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+            else
+            {
+                /* Entry time was already set. */
+                mtCOVERAGE_TEST_MARKER();
             }
-        }
-        taskEXIT_CRITICAL();
 
-        /* Interrupts and other tasks can send to and receive from the queue
-         * now that the critical section has been exited. */
+            queueEXIT_CRITICAL( pxQueue );
 
-        vTaskSuspendAll();
-        prvLockQueue( pxQueue );
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
 
-        /* Update the timeout state to see if it has expired yet. */
-        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
-        {
-            /* Timeout has not expired yet, check to see if there is data in the
-            * queue now, and if not enter the Blocked state to wait for data. */
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
             {
-                traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
-                prvUnlockQueue( pxQueue );
+                if( ( xIsSend != pdFALSE ) && ( prvIsQueueFull( pxQueue ) != pdFALSE ) )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    queueSTATS_BLOCKING( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
 
-                if( xTaskResumeAll() == pdFALSE )
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    queueSTATS_UNBLOCKED( pxQueue );
+                }
+                else if( ( xIsSend == pdFALSE ) && ( prvIsQueueEmpty( pxQueue ) != pdFALSE ) )
                 {
-                    taskYIELD_WITHIN_API();
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    queueSTATS_BLOCKING( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    queueSTATS_UNBLOCKED( pxQueue );
                 }
                 else
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
                 }
             }
             else
             {
-                /* There is data in the queue now, so don't enter the blocked
-                 * state, instead return to try and obtain the data. */
+                /* Timed out.  Loop back once more so the slot is claimed if
+                 * one became available, otherwise the zero block time path
+                 * above is taken. */
                 prvUnlockQueue( pxQueue );
                 ( void ) xTaskResumeAll();
+                xTicksToWait = ( TickType_t ) 0;
+                queueSTATS_TIMED_OUT( pxQueue );
             }
         }
-        else
+    }
+
+#endif /* #if ( configUSE_ZERO_COPY_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+
+    BaseType_t xQueueReserveSend( QueueHandle_t xQueue,
+                                  void ** ppvSlot,
+                                  TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueReserveSend( xQueue, ppvSlot, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( ppvSlot );
+        queueASSERT_NOT_LOCK_FREE( pxQueue );
+        queueASSERT_NOT_RPC( pxQueue );
+
+        /* The slot used by an item in a priority queue depends on its key. */
+        configASSERT( !queueIS_PRIORITY( pxQueue ) );
+
+        /* Semaphores have no storage to hand out. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
-            /* The timeout has expired.  If there is still no data in the queue
-             * exit, otherwise go back and try to read the data again. */
-            prvUnlockQueue( pxQueue );
-            ( void ) xTaskResumeAll();
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
 
-            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
-            {
-                traceQUEUE_PEEK_FAILED( pxQueue );
-                traceRETURN_xQueuePeek( errQUEUE_EMPTY );
+        xReturn = prvClaimQueueSlot( pxQueue, ppvSlot, xTicksToWait, pdTRUE );
 
-                return errQUEUE_EMPTY;
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
+        if( xReturn == pdPASS )
+        {
+            traceQUEUE_RESERVE_SEND( pxQueue );
+        }
+        else
+        {
+            traceQUEUE_SEND_FAILED( pxQueue );
         }
-    }
-}
-/*-----------------------------------------------------------*/
 
-BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
-                                 void * const pvBuffer,
-                                 BaseType_t * const pxHigherPriorityTaskWoken )
-{
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
-    Queue_t * const pxQueue = xQueue;
+        traceRETURN_xQueueReserveSend( xReturn );
 
-    traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken );
+        return xReturn;
+    }
 
-    configASSERT( pxQueue );
-    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+#endif /* #if ( configUSE_ZERO_COPY_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
 
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
 
-    /* MISRA Ref 4.7.1 [Return value shall be checked] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    BaseType_t xQueueCommitSend( QueueHandle_t xQueue )
     {
-        const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+        BaseType_t xReturn;
+        BaseType_t xQueueSetNotified = pdFALSE;
+        Queue_t * const pxQueue = xQueue;
 
-        /* Cannot block in an ISR, so check there is data available. */
-        if( uxMessagesWaiting > ( UBaseType_t ) 0 )
-        {
-            const int8_t cRxLock = pxQueue->cRxLock;
+        traceENTER_xQueueCommitSend( xQueue );
 
-            traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+        configASSERT( pxQueue );
 
-            prvCopyDataFromQueue( pxQueue, pvBuffer );
-            pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
+        queueENTER_CRITICAL( pxQueue );
+        {
+            /* Was a slot reserved by a prior call to xQueueReserveSend()? */
+            configASSERT( pxQueue->pcReservedSendSlot != NULL );
 
-            /* If the queue is locked the event list will not be modified.
-             * Instead update the lock count so the task that unlocks the queue
-             * will know that an ISR has removed data while the queue was
-             * locked. */
-            if( cRxLock == queueUNLOCKED )
+            if( pxQueue->pcReservedSendSlot != NULL )
             {
-                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                traceQUEUE_SEND( pxQueue );
+                queueSTATS_SENT( pxQueue );
+
+                /* The item was written in place, so only needs counting. */
+                queueSTAMP_MESSAGES( pxQueue, pxQueue->pcReservedSendSlot, ( UBaseType_t ) 1U, pdFALSE );
+                pxQueue->pcReservedSendSlot = NULL;
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + ( UBaseType_t ) 1 );
+                queueSTATS_DEPTH( pxQueue );
+                queueNOTIFY_TASK_WAITING_FOR_ANY( pxQueue );
+
+                #if ( configUSE_QUEUE_SETS == 1 )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    if( pxQueue->pxQueueSetContainer != NULL )
                     {
-                        /* The task waiting has a higher priority than us so
-                         * force a context switch. */
-                        if( pxHigherPriorityTaskWoken != NULL )
+                        /* The queue set is notified in place of waking a
+                         * receiver, as is done by xQueueGenericSend(). */
+                        xQueueSetNotified = pdTRUE;
+
+                        if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
                         {
-                            *pxHigherPriorityTaskWoken = pdTRUE;
+                            queueYIELD_IF_USING_PREEMPTION();
                         }
                         else
                         {
@@ -2104,391 +3693,2841 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
+                #endif /* configUSE_QUEUE_SETS */
+
+                /* If there was a task waiting for data to arrive on the queue
+                 * then unblock it now. */
+                if( ( xQueueSetNotified == pdFALSE ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
-            }
-            else
-            {
-                /* Increment the lock count so the task that unlocks the queue
-                 * knows that data was removed while it was locked. */
-                prvIncrementQueueRxLock( pxQueue, cRxLock );
-            }
 
-            xReturn = pdPASS;
-        }
-        else
-        {
-            xReturn = pdFAIL;
-            traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+                /* Other senders saw the queue as full while the slot was
+                 * reserved, so unblock one of them if there is still space. */
+                if( ( queueHAS_SPACE( pxQueue ) ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ) )
+                {
+                    if( queueUNBLOCK_SENDERS( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
         }
-    }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        queueEXIT_CRITICAL( pxQueue );
 
-    traceRETURN_xQueueReceiveFromISR( xReturn );
+        traceRETURN_xQueueCommitSend( xReturn );
 
-    return xReturn;
-}
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_ZERO_COPY_QUEUES == 1 ) */
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
-                              void * const pvBuffer )
-{
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
-    int8_t * pcOriginalReadPosition;
-    Queue_t * const pxQueue = xQueue;
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
 
-    traceENTER_xQueuePeekFromISR( xQueue, pvBuffer );
+    BaseType_t xQueueAcquireReceive( QueueHandle_t xQueue,
+                                     void ** ppvSlot,
+                                     TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn;
+        Queue_t * const pxQueue = xQueue;
 
-    configASSERT( pxQueue );
-    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-    configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+        traceENTER_xQueueAcquireReceive( xQueue, ppvSlot, xTicksToWait );
 
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+        configASSERT( pxQueue );
+        configASSERT( ppvSlot );
+        queueASSERT_NOT_LOCK_FREE( pxQueue );
+        queueASSERT_NOT_RPC( pxQueue );
 
-    /* MISRA Ref 4.7.1 [Return value shall be checked] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
-    {
-        /* Cannot block in an ISR, so check there is data available. */
-        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        /* The slot used by an item in a priority queue depends on its key. */
+        configASSERT( !queueIS_PRIORITY( pxQueue ) );
+
+        /* Semaphores have no storage to hand out. */
+        configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
         {
-            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
 
-            /* Remember the read position so it can be reset as nothing is
-             * actually being removed from the queue. */
-            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-            prvCopyDataFromQueue( pxQueue, pvBuffer );
-            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+        xReturn = prvClaimQueueSlot( pxQueue, ppvSlot, xTicksToWait, pdFALSE );
 
-            xReturn = pdPASS;
+        if( xReturn == pdPASS )
+        {
+            traceQUEUE_RECEIVE( pxQueue );
         }
         else
         {
-            xReturn = pdFAIL;
-            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+            traceQUEUE_RECEIVE_FAILED( pxQueue );
         }
-    }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-    traceRETURN_xQueuePeekFromISR( xReturn );
+        traceRETURN_xQueueAcquireReceive( xReturn );
 
-    return xReturn;
-}
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_ZERO_COPY_QUEUES == 1 ) */
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
 
-    traceENTER_uxQueueMessagesWaiting( xQueue );
+    BaseType_t xQueueReleaseReceive( QueueHandle_t xQueue )
+    {
+        BaseType_t xReturn;
+        Queue_t * const pxQueue = xQueue;
 
-    configASSERT( xQueue );
+        traceENTER_xQueueReleaseReceive( xQueue );
 
-    portBASE_TYPE_ENTER_CRITICAL();
-    {
-        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
-    }
-    portBASE_TYPE_EXIT_CRITICAL();
+        configASSERT( pxQueue );
 
-    traceRETURN_uxQueueMessagesWaiting( uxReturn );
+        queueENTER_CRITICAL( pxQueue );
+        {
+            /* Was a slot acquired by a prior call to xQueueAcquireReceive()? */
+            configASSERT( pxQueue->pcAcquiredReceiveSlot != NULL );
 
-    return uxReturn;
-}
-/*-----------------------------------------------------------*/
+            if( pxQueue->pcAcquiredReceiveSlot != NULL )
+            {
+                traceQUEUE_RELEASE_RECEIVE( pxQueue );
+                queueSTATS_RECEIVED( pxQueue );
 
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
-    Queue_t * const pxQueue = xQueue;
+                pxQueue->pcAcquiredReceiveSlot = NULL;
 
-    traceENTER_uxQueueSpacesAvailable( xQueue );
+                /* There is now space in the queue, were any tasks waiting to
+                 * post to the queue?  If so, unblock the highest priority
+                 * waiting task. */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( queueUNBLOCK_SENDERS( pxQueue ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-    configASSERT( pxQueue );
+                /* Other receivers saw the queue as empty while the slot was
+                 * acquired, so unblock one of them if items remain. */
+                if( ( queueHAS_ITEMS( pxQueue ) ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-    portBASE_TYPE_ENTER_CRITICAL();
-    {
-        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
-    }
-    portBASE_TYPE_EXIT_CRITICAL();
+                xReturn = pdPASS;
+            }
+            else
+            {
+                xReturn = pdFAIL;
+            }
+        }
+        queueEXIT_CRITICAL( pxQueue );
 
-    traceRETURN_uxQueueSpacesAvailable( uxReturn );
+        traceRETURN_xQueueReleaseReceive( xReturn );
 
-    return uxReturn;
-}
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_ZERO_COPY_QUEUES == 1 ) */
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
+                                TickType_t xTicksToWait )
 {
-    UBaseType_t uxReturn;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
 
-    traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        TickType_t xBlockStartTime = 0U;
+    #endif
 
-    configASSERT( pxQueue );
-    uxReturn = pxQueue->uxMessagesWaiting;
+    #if ( configUSE_MUTEXES == 1 )
+        BaseType_t xInheritanceOccurred = pdFALSE;
+    #endif
 
-    traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn );
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_MUTEXES == 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+        BaseType_t xSpinAttempted = pdFALSE;
+    #endif
 
-    return uxReturn;
-}
-/*-----------------------------------------------------------*/
+    #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) )
+        BaseType_t xHandOffPossible = pdFALSE;
+    #endif
 
-void vQueueDelete( QueueHandle_t xQueue )
-{
-    Queue_t * const pxQueue = xQueue;
+    traceENTER_xQueueSemaphoreTake( xQueue, xTicksToWait );
 
-    traceENTER_vQueueDelete( xQueue );
+    /* Check the queue pointer is not NULL. */
+    configASSERT( ( pxQueue ) );
 
-    configASSERT( pxQueue );
-    traceQUEUE_DELETE( pxQueue );
+    /* Check this really is a semaphore, in which case the item size will be
+     * 0. */
+    configASSERT( pxQueue->uxItemSize == 0 );
 
-    #if ( configQUEUE_REGISTRY_SIZE > 0 )
+    /* Cannot block if the scheduler is suspended. */
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
     {
-        vQueueUnregisterQueue( pxQueue );
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
     }
     #endif
 
-    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
-    {
-        /* The queue can only have been allocated dynamically - free it
-         * again. */
-        vPortFree( pxQueue );
-    }
-    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
     {
-        /* The queue could have been allocated statically or dynamically, so
-         * check before attempting to free the memory. */
-        if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+        if( queueIS_LOCK_FREE( pxQueue ) )
         {
-            vPortFree( pxQueue );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-    }
-    #else /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) ) */
-    {
-        /* The queue must have been statically allocated, so is not going to be
-         * deleted.  Avoid compiler warnings about the unused parameter. */
-        ( void ) pxQueue;
-    }
-    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-
-    traceRETURN_vQueueDelete();
-}
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_TRACE_FACILITY == 1 )
+            BaseType_t xReturn;
 
-    UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
-    {
-        traceENTER_uxQueueGetQueueNumber( xQueue );
+            xReturn = prvLockFreeReceive( pxQueue, NULL, xTicksToWait );
 
-        traceRETURN_uxQueueGetQueueNumber( ( ( Queue_t * ) xQueue )->uxQueueNumber );
+            traceRETURN_xQueueSemaphoreTake( xReturn );
 
-        return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+            return xReturn;
+        }
     }
+    #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_TRACE_FACILITY == 1 )
-
-    void vQueueSetQueueNumber( QueueHandle_t xQueue,
-                               UBaseType_t uxQueueNumber )
+    for( ; ; )
     {
-        traceENTER_vQueueSetQueueNumber( xQueue, uxQueueNumber );
+        queueENTER_CRITICAL( pxQueue );
 
-        ( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            if( prvIsQueueLocked( pxQueue ) )
+            {
+                /* A task on another core is adding itself to the event lists. */
+                queueEXIT_CRITICAL( pxQueue );
+                prvWaitForQueueUnlock();
+                continue;
+            }
+        }
+        #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
 
-        traceRETURN_vQueueSetQueueNumber();
-    }
+        {
+            /* Semaphores are queues with an item size of 0, and where the
+             * number of messages in the queue is the semaphore's count value. */
+            const UBaseType_t uxSemaphoreCount = pxQueue->uxMessagesWaiting;
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
+            /* Is there data in the queue now?  To be running the calling task
+             * must be the highest priority task wanting to access the queue. */
+            if( uxSemaphoreCount > ( UBaseType_t ) 0 )
+            {
+                traceQUEUE_RECEIVE( pxQueue );
+                queueSTATS_RECEIVED( pxQueue );
+
+                /* Semaphores are queues with a data size of zero and where the
+                 * messages waiting is the semaphore's count.  Reduce the count. */
+                pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxSemaphoreCount - ( UBaseType_t ) 1 );
+
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+                    {
+                        /* Record the information required to implement
+                         * priority inheritance should it become necessary. */
+                        pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+
+                        #if ( configUSE_IPC_STATISTICS == 1 )
+                        {
+                            pxQueue->xMutexTakenTime = xTaskGetTickCount();
+                        }
+                        #endif
+
+                        #if ( configUSE_MUTEX_PRIORITY_CEILING == 1 )
+                        {
+                            if( pxQueue->uxCeilingPriority != ( UBaseType_t ) 0U )
+                            {
+                                vTaskPriorityRaiseToCeiling( pxQueue->uxCeilingPriority );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        #endif
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_MUTEXES */
+
+                /* Check to see if other tasks are blocked waiting to give the
+                 * semaphore, and if so, unblock the highest priority such task. */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                queueEXIT_CRITICAL( pxQueue );
+
+                traceRETURN_xQueueSemaphoreTake( pdPASS );
+
+                return pdPASS;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The semaphore count was 0 and no block time is specified
+                     * (or the block time has expired) so exit now. */
+                    queueEXIT_CRITICAL( pxQueue );
+
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
+
+                    return errQUEUE_EMPTY;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The semaphore count was 0 and a block time was specified
+                     * so configure the timeout structure ready to block. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        queueEXIT_CRITICAL( pxQueue );
+
+        /* Interrupts and other tasks can give to and take from the semaphore
+         * now the critical section has been exited. */
+
+        #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_MUTEXES == 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+        {
+            /* A mutex held by a task running on another core is likely to be
+             * given back soon, so poll it for a while before paying for a
+             * context switch.  Only spin once per call so the time spent
+             * spinning is bounded. */
+            if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( xSpinAttempted == pdFALSE ) )
+            {
+                xSpinAttempted = pdTRUE;
+
+                if( prvSpinWhileMutexHolderRuns( pxQueue ) != pdFALSE )
+                {
+                    continue;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_MUTEXES == 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) ) */
+
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
+
+        /* Update the timeout state to see if it has expired yet. */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            /* A block time is specified and not expired.  If the semaphore
+             * count is 0 then enter the Blocked state to wait for a semaphore to
+             * become available.  As semaphores are implemented with queues the
+             * queue being empty is equivalent to the semaphore count being 0. */
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                queueSTATS_BLOCKING( pxQueue );
+
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    if( queueUSES_PRIORITY_INHERITANCE( pxQueue ) != pdFALSE )
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            #if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+                            {
+                                vTaskInternalSetBlockedOnMutex( &( pxQueue->u.xSemaphore.xMutexHolder ) );
+                            }
+                            #endif
+
+                            xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
+
+                            #if ( configUSE_IPC_STATISTICS == 1 )
+                            {
+                                if( xInheritanceOccurred != pdFALSE )
+                                {
+                                    pxQueue->xStatistics.ulPriorityInheritances++;
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+                            }
+                            #endif
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* if ( configUSE_MUTEXES == 1 ) */
+
+                #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) )
+                {
+                    /* A task that already holds the mutex cannot be handed
+                     * it, so must not mistake its own ownership for a hand-off
+                     * when it wakes. */
+                    if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) &&
+                        ( pxQueue->u.xSemaphore.xMutexHolder != xTaskGetCurrentTaskHandle() ) )
+                    {
+                        xHandOffPossible = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvUnlockQueue( pxQueue );
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                queueSTATS_UNBLOCKED( pxQueue );
+
+                #if ( configUSE_TRANSITIVE_PRIORITY_INHERITANCE == 1 )
+                {
+                    if( queueUSES_PRIORITY_INHERITANCE( pxQueue ) != pdFALSE )
+                    {
+                        vTaskInternalSetBlockedOnMutex( NULL );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif
+
+                #if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) )
+                {
+                    /* Only the task giving the mutex can make this task the
+                     * holder while it is blocked, and only this task can
+                     * change the holder once it is running, so no critical
+                     * section is needed to test xMutexHolder. */
+                    if( ( xHandOffPossible != pdFALSE ) &&
+                        ( pxQueue->u.xSemaphore.xMutexHolder == xTaskGetCurrentTaskHandle() ) )
+                    {
+                        traceQUEUE_RECEIVE( pxQueue );
+
+                        queueENTER_CRITICAL( pxQueue );
+                        {
+                            queueSTATS_RECEIVED( pxQueue );
+                        }
+                        queueEXIT_CRITICAL( pxQueue );
+
+                        #if ( configUSE_MUTEX_PRIORITY_CEILING == 1 )
+                        {
+                            if( pxQueue->uxCeilingPriority != ( UBaseType_t ) 0U )
+                            {
+                                vTaskPriorityRaiseToCeiling( pxQueue->uxCeilingPriority );
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        #endif
+
+                        traceRETURN_xQueueSemaphoreTake( pdPASS );
+
+                        return pdPASS;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) ) */
+            }
+            else
+            {
+                /* There was no timeout and the semaphore count was not 0, so
+                 * attempt to take the semaphore again. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* Timed out. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            /* If the semaphore count is 0 exit now as the timeout has
+             * expired.  Otherwise return to attempt to take the semaphore that is
+             * known to be available.  As semaphores are implemented by queues the
+             * queue being empty is equivalent to the semaphore count being 0. */
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    /* xInheritanceOccurred could only have be set if
+                     * pxQueue->uxQueueType == queueQUEUE_IS_MUTEX so no need to
+                     * test the mutex type again to check it is actually a mutex. */
+                    if( xInheritanceOccurred != pdFALSE )
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            UBaseType_t uxHighestWaitingPriority;
+
+                            /* This task blocking on the mutex caused another
+                             * task to inherit this task's priority.  Now this task
+                             * has timed out the priority should be disinherited
+                             * again, but only as low as the next highest priority
+                             * task that is waiting for the same mutex. */
+                            uxHighestWaitingPriority = prvGetHighestPriorityOfWaitToReceiveList( pxQueue );
+
+                            /* vTaskPriorityDisinheritAfterTimeout uses the uxHighestWaitingPriority
+                             * parameter to index pxReadyTasksLists when adding the task holding
+                             * mutex to the ready list for its new priority. Coverity thinks that
+                             * it can result in out-of-bounds access which is not true because
+                             * uxHighestWaitingPriority, as returned by prvGetHighestPriorityOfWaitToReceiveList,
+                             * is capped at ( configMAX_PRIORITIES - 1 ). */
+                            /* coverity[overrun] */
+                            vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                }
+                #endif /* configUSE_MUTEXES */
+
+                queueSTATS_TIMED_OUT( pxQueue );
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+                traceRETURN_xQueueSemaphoreTake( errQUEUE_EMPTY );
+
+                return errQUEUE_EMPTY;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeek( QueueHandle_t xQueue,
+                       void * const pvBuffer,
+                       TickType_t xTicksToWait )
+{
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+    int8_t * pcOriginalReadPosition;
+    Queue_t * const pxQueue = xQueue;
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        TickType_t xBlockStartTime = 0U;
+    #endif
+
+    traceENTER_xQueuePeek( xQueue, pvBuffer, xTicksToWait );
+
+    /* Check the pointer is not NULL. */
+    configASSERT( ( pxQueue ) );
+
+    /* SPSC and MPMC queues cannot be peeked. */
+    queueASSERT_NOT_LOCK_FREE( pxQueue );
+
+    /* The buffer into which data is received can only be NULL if the data size
+     * is zero (so no data is copied into the buffer. */
+    configASSERT( !( ( ( pvBuffer ) == NULL ) && ( ( pxQueue )->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+    /* Cannot block if the scheduler is suspended. */
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
+
+    for( ; ; )
+    {
+        queueENTER_CRITICAL( pxQueue );
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            if( prvIsQueueLocked( pxQueue ) )
+            {
+                /* A task on another core is adding itself to the event lists. */
+                queueEXIT_CRITICAL( pxQueue );
+                prvWaitForQueueUnlock();
+                continue;
+            }
+        }
+        #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+        {
+            /* Is there data in the queue now?  To be running the calling task
+             * must be the highest priority task wanting to access the queue. */
+            if( queueHAS_ITEMS( pxQueue ) )
+            {
+                /* Remember the read position so it can be reset after the data
+                 * is read from the queue as this function is only peeking the
+                 * data, not removing it. */
+                pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+
+                prvCopyDataFromQueue( pxQueue, pvBuffer );
+                traceQUEUE_PEEK( pxQueue );
+
+                /* The data is not being removed, so reset the read pointer. */
+                pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+                /* The data is being left in the queue, so see if there are
+                 * any other tasks waiting for the data. */
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                    {
+                        /* The task waiting has a higher priority than this task. */
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                queueEXIT_CRITICAL( pxQueue );
+
+                traceRETURN_xQueuePeek( pdPASS );
+
+                return pdPASS;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The queue was empty and no block time is specified (or
+                     * the block time has expired) so leave now. */
+                    queueEXIT_CRITICAL( pxQueue );
+
+                    traceQUEUE_PEEK_FAILED( pxQueue );
+                    traceRETURN_xQueuePeek( errQUEUE_EMPTY );
+
+                    return errQUEUE_EMPTY;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The queue was empty and a block time was specified so
+                     * configure the timeout structure ready to enter the blocked
+                     * state. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        queueEXIT_CRITICAL( pxQueue );
+
+        /* Interrupts and other tasks can send to and receive from the queue
+         * now that the critical section has been exited. */
+
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
+
+        /* Update the timeout state to see if it has expired yet. */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            /* Timeout has not expired yet, check to see if there is data in the
+            * queue now, and if not enter the Blocked state to wait for data. */
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
+                queueSTATS_BLOCKING( pxQueue );
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvUnlockQueue( pxQueue );
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                queueSTATS_UNBLOCKED( pxQueue );
+            }
+            else
+            {
+                /* There is data in the queue now, so don't enter the blocked
+                 * state, instead return to try and obtain the data. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* The timeout has expired.  If there is still no data in the queue
+             * exit, otherwise go back and try to read the data again. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                queueSTATS_TIMED_OUT( pxQueue );
+                traceQUEUE_PEEK_FAILED( pxQueue );
+                traceRETURN_xQueuePeek( errQUEUE_EMPTY );
+
+                return errQUEUE_EMPTY;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
+                                 void * const pvBuffer,
+                                 BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_xQueueReceiveFromISR( xQueue, pvBuffer, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxQueue );
+    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+    queueASSERT_NOT_RPC( pxQueue );
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+    {
+        if( queueIS_LOCK_FREE( pxQueue ) )
+        {
+            if( prvLockFreeRead( pxQueue, pvBuffer ) != pdFALSE )
+            {
+                traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+                if( ( prvLockFreeWakeWaiter( pxQueue, pdFALSE, pdTRUE ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+                xReturn = pdFAIL;
+            }
+
+            traceRETURN_xQueueReceiveFromISR( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
+    {
+        const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+        /* Cannot block in an ISR, so check there is data available. */
+        if( queueHAS_ITEMS( pxQueue ) )
+        {
+            const int8_t cRxLock = pxQueue->cRxLock;
+
+            traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+            queueSTATS_RECEIVED( pxQueue );
+
+            prvCopyDataFromQueue( pxQueue, pvBuffer );
+            queueRECEIVE_MESSAGE_TAGS( pxQueue, pxQueue->u.xQueue.pcReadFrom, ( UBaseType_t ) 1U, pdTRUE );
+            queuePRIORITY_REMOVE_HEAD( pxQueue );
+            pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting - ( UBaseType_t ) 1 );
+
+            /* If the queue is locked the event list will not be modified.
+             * Instead update the lock count so the task that unlocks the queue
+             * will know that an ISR has removed data while the queue was
+             * locked. */
+            if( cRxLock == queueUNLOCKED )
+            {
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+                {
+                    if( queueUNBLOCK_SENDERS( pxQueue ) != pdFALSE )
+                    {
+                        /* The task waiting has a higher priority than us so
+                         * force a context switch. */
+                        if( pxHigherPriorityTaskWoken != NULL )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Increment the lock count so the task that unlocks the queue
+                 * knows that data was removed while it was locked. */
+                prvIncrementQueueRxLock( pxQueue, cRxLock );
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+            traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
+
+    traceRETURN_xQueueReceiveFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
+                              void * const pvBuffer )
+{
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+    int8_t * pcOriginalReadPosition;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_xQueuePeekFromISR( xQueue, pvBuffer );
+
+    configASSERT( pxQueue );
+    queueASSERT_NOT_LOCK_FREE( pxQueue );
+    configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+    configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
+    {
+        /* Cannot block in an ISR, so check there is data available. */
+        if( queueHAS_ITEMS( pxQueue ) )
+        {
+            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+            /* Remember the read position so it can be reset as nothing is
+             * actually being removed from the queue. */
+            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+            prvCopyDataFromQueue( pxQueue, pvBuffer );
+            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
+
+    traceRETURN_xQueuePeekFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+
+    traceENTER_uxQueueMessagesWaiting( xQueue );
+
+    configASSERT( xQueue );
+
+    portBASE_TYPE_ENTER_CRITICAL();
+    {
+        uxReturn = queueITEMS_HELD( ( Queue_t * ) xQueue );
+    }
+    portBASE_TYPE_EXIT_CRITICAL();
+
+    traceRETURN_uxQueueMessagesWaiting( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueSpacesAvailable( xQueue );
+
+    configASSERT( pxQueue );
+
+    portBASE_TYPE_ENTER_CRITICAL();
+    {
+        uxReturn = queueSPACES_AVAILABLE( pxQueue );
+
+        #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+        {
+            if( queueIS_LOCK_FREE( pxQueue ) )
+            {
+                uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - prvLockFreeItemsHeld( pxQueue ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+    }
+    portBASE_TYPE_EXIT_CRITICAL();
+
+    traceRETURN_uxQueueSpacesAvailable( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RING_QUEUES == 1 )
+
+    UBaseType_t uxQueueGetRingItemsDropped( const QueueHandle_t xQueue )
+    {
+        UBaseType_t uxReturn;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_uxQueueGetRingItemsDropped( xQueue );
+
+        configASSERT( pxQueue );
+        configASSERT( queueIS_RING( pxQueue ) );
+
+        portBASE_TYPE_ENTER_CRITICAL();
+        {
+            uxReturn = pxQueue->uxRingItemsDropped;
+        }
+        portBASE_TYPE_EXIT_CRITICAL();
+
+        traceRETURN_uxQueueGetRingItemsDropped( uxReturn );
+
+        return uxReturn;
+    }
+
+#endif /* configUSE_RING_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_RPC_QUEUES == 1 )
+
+    BaseType_t xQueueCall( QueueHandle_t xQueue,
+                           const void * const pvRequest,
+                           TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xRequestSent = pdFALSE, xCallComplete = pdFALSE, xWaitingForReply = pdFALSE;
+        TickType_t xTicket = ( TickType_t ) 0U;
+        TimeOut_t xTimeOut;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueCall( xQueue, pvRequest, xTicksToWait );
+
+        configASSERT( pxQueue );
+        configASSERT( pvRequest );
+        configASSERT( queueIS_RPC( pxQueue ) );
+
+        /* Cannot block if the scheduler is suspended. */
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        while( xCallComplete == pdFALSE )
+        {
+            /* No other task can reply to the request before this task is
+             * waiting for the reply while the scheduler is suspended. */
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            queueENTER_CRITICAL( pxQueue );
+            {
+                if( queueHAS_SPACE( pxQueue ) )
+                {
+                    traceQUEUE_SEND( pxQueue );
+                    queueSTATS_SENT( pxQueue );
+                    ( void ) prvCopyDataToQueue( pxQueue, pvRequest, queueSEND_TO_BACK );
+                    xTicket = pxQueue->xRpcNextTicket;
+                    pxQueue->xRpcNextTicket = ( xTicket + ( TickType_t ) 1U ) & queueRPC_TICKET_MASK;
+                    xRequestSent = pdTRUE;
+
+                    if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+                    {
+                        if( pxQueue->xRpcServer == NULL )
+                        {
+                            /* The first request, so the server is the task
+                             * waiting to receive it. */
+                            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                            /* coverity[misra_c_2012_rule_11_5_violation] */
+                            pxQueue->xRpcServer = ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        /* The scheduler is suspended, so the server is moved
+                         * to the pending ready list and any context switch
+                         * occurs when the scheduler is resumed. */
+                        ( void ) xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            queueEXIT_CRITICAL( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                /* Lend this task's priority to the server for as long as it
+                 * waits, whether for space or for the reply. */
+                queueENTER_CRITICAL( pxQueue );
+                {
+                    ( void ) xTaskPriorityInherit( pxQueue->xRpcServer );
+                }
+                queueEXIT_CRITICAL( pxQueue );
+
+                if( xRequestSent != pdFALSE )
+                {
+                    vTaskPlaceOnUnorderedEventList( &( pxQueue->xTasksWaitingForReply ), xTicket, xTicksToWait );
+                    xWaitingForReply = pdTRUE;
+                    xCallComplete = pdTRUE;
+                }
+                else
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                }
+
+                prvUnlockQueue( pxQueue );
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Timed out, either before the request could be sent or
+                 * before the reply could be waited for. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+
+                if( xRequestSent == pdFALSE )
+                {
+                    traceQUEUE_SEND_FAILED( pxQueue );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xCallComplete = pdTRUE;
+            }
+        }
+
+        if( xWaitingForReply != pdFALSE )
+        {
+            /* xQueueReply() sets queueRPC_REPLIED in the item value of the
+             * client it unblocks.  The item value is left unchanged if the
+             * client timed out instead. */
+            if( ( uxTaskResetEventItemValue() & queueRPC_REPLIED ) != ( TickType_t ) 0U )
+            {
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        queueENTER_CRITICAL( pxQueue );
+        {
+            /* This task no longer lends its priority to the server, so the
+             * server should drop to the priority of the highest priority client
+             * still waiting.  The server is only known to hold a priority that
+             * was lent to it while it counts the queue as held. */
+            if( pxQueue->ucRpcServerHoldsQueue != pdFALSE )
+            {
+                vTaskPriorityDisinheritAfterTimeout( pxQueue->xRpcServer, prvGetHighestPriorityOfCallers( pxQueue ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        queueEXIT_CRITICAL( pxQueue );
+
+        traceRETURN_xQueueCall( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xQueueReply( QueueHandle_t xQueue )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired = pdFALSE;
+        ListItem_t * pxClientItem;
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_xQueueReply( xQueue );
+
+        configASSERT( pxQueue );
+        configASSERT( queueIS_RPC( pxQueue ) );
+
+        /* Clients are added to and removed from xTasksWaitingForReply with the
+         * scheduler suspended. */
+        vTaskSuspendAll();
+        {
+            queueENTER_CRITICAL( pxQueue );
+            {
+                /* Only the server can reply, and only to a request it has
+                 * received. */
+                configASSERT( pxQueue->ucRpcRequestInService != pdFALSE );
+                configASSERT( pxQueue->xRpcServer == xTaskGetCurrentTaskHandle() );
+                pxQueue->ucRpcRequestInService = pdFALSE;
+
+                if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingForReply ) ) == pdFALSE )
+                {
+                    /* The client of the request being replied to is at the
+                     * head of the list, unless it has stopped waiting. */
+                    pxClientItem = listGET_HEAD_ENTRY( &( pxQueue->xTasksWaitingForReply ) );
+
+                    if( ( listGET_LIST_ITEM_VALUE( pxClientItem ) & queueRPC_TICKET_MASK ) == pxQueue->xRpcNextReply )
+                    {
+                        vTaskRemoveFromUnorderedEventList( pxClientItem, queueRPC_REPLIED );
+                        xReturn = pdPASS;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxQueue->xRpcNextReply = ( pxQueue->xRpcNextReply + ( TickType_t ) 1U ) & queueRPC_TICKET_MASK;
+
+                /* Stop counting the queue as held once no clients are left to
+                 * lend the server their priority, which returns the server to
+                 * its base priority if it holds no other mutexes.  Otherwise
+                 * the client unblocked above lowers the server's priority to
+                 * that of the clients still waiting when it runs. */
+                if( ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingForReply ) ) != pdFALSE ) &&
+                    ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE ) )
+                {
+                    pxQueue->ucRpcServerHoldsQueue = pdFALSE;
+                    xYieldRequired = xTaskPriorityDisinherit( pxQueue->xRpcServer );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            queueEXIT_CRITICAL( pxQueue );
+        }
+
+        if( ( xTaskResumeAll() == pdFALSE ) && ( xYieldRequired != pdFALSE ) )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xQueueReply( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRpcRequestReceived( Queue_t * const pxQueue )
+    {
+        /* The replies are matched to the clients in the order the requests
+         * were sent, so each request must be replied to before the next is
+         * received. */
+        configASSERT( pxQueue->ucRpcRequestInService == pdFALSE );
+        pxQueue->ucRpcRequestInService = pdTRUE;
+
+        if( pxQueue->ucRpcServerHoldsQueue == pdFALSE )
+        {
+            /* Count the queue as a mutex held by the server until the last
+             * waiting client has been replied to. */
+            pxQueue->xRpcServer = pvTaskIncrementMutexHeldCount();
+            pxQueue->ucRpcServerHoldsQueue = pdTRUE;
+        }
+        else
+        {
+            /* An RPC queue is served by a single task. */
+            configASSERT( pxQueue->xRpcServer == xTaskGetCurrentTaskHandle() );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvGetHighestPriorityOfCallers( const Queue_t * const pxQueue )
+    {
+        UBaseType_t uxHighestPriority = tskIDLE_PRIORITY, uxPriority;
+        const ListItem_t * pxIterator;
+        const ListItem_t * const pxEnd = listGET_END_MARKER( &( pxQueue->xTasksWaitingForReply ) );
+
+        /* The tasks waiting for space are held in priority order, but the
+         * tasks waiting for a reply are held in the order their requests were
+         * sent, so the whole list is searched. */
+        if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+        {
+            uxHighestPriority = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToSend ) ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        for( pxIterator = listGET_HEAD_ENTRY( &( pxQueue->xTasksWaitingForReply ) ); pxIterator != pxEnd; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            uxPriority = uxTaskPriorityGet( ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxIterator ) );
+
+            if( uxPriority > uxHighestPriority )
+            {
+                uxHighestPriority = uxPriority;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return uxHighestPriority;
+    }
+
+#endif /* configUSE_RPC_QUEUES */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
+
+    configASSERT( pxQueue );
+    uxReturn = queueITEMS_HELD( pxQueue );
+
+    traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vQueueDelete( QueueHandle_t xQueue )
+{
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_vQueueDelete( xQueue );
+
+    configASSERT( pxQueue );
+    traceQUEUE_DELETE( pxQueue );
+
+    #if ( configQUEUE_REGISTRY_SIZE > 0 )
+    {
+        vQueueUnregisterQueue( pxQueue );
+    }
+    #endif
+
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+    {
+        /* The queue can only have been allocated dynamically - free it
+         * again. */
+        queueFREE( pxQueue );
+    }
+    #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    {
+        /* The queue could have been allocated statically or dynamically, so
+         * check before attempting to free the memory. */
+        if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+        {
+            queueFREE( pxQueue );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #else /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) ) */
+    {
+        /* The queue must have been statically allocated, so is not going to be
+         * deleted.  Avoid compiler warnings about the unused parameter. */
+        ( void ) pxQueue;
+    }
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+    traceRETURN_vQueueDelete();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+    {
+        traceENTER_uxQueueGetQueueNumber( xQueue );
+
+        traceRETURN_uxQueueGetQueueNumber( ( ( Queue_t * ) xQueue )->uxQueueNumber );
+
+        return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+    void vQueueSetQueueNumber( QueueHandle_t xQueue,
+                               UBaseType_t uxQueueNumber )
+    {
+        traceENTER_vQueueSetQueueNumber( xQueue, uxQueueNumber );
+
+        ( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+
+        traceRETURN_vQueueSetQueueNumber();
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
 
 #if ( configUSE_TRACE_FACILITY == 1 )
 
-    uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+    uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+    {
+        traceENTER_ucQueueGetQueueType( xQueue );
+
+        traceRETURN_ucQueueGetQueueType( ( ( Queue_t * ) xQueue )->ucQueueType );
+
+        return ( ( Queue_t * ) xQueue )->ucQueueType;
+    }
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_IPC_STATISTICS == 1 )
+
+    void vQueueGetStatistics( QueueHandle_t xQueue,
+                              IPCStatistics_t * pxStatistics )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_vQueueGetStatistics( xQueue, pxStatistics );
+
+        configASSERT( pxQueue );
+        configASSERT( pxStatistics );
+
+        /* Copy the statistics from a critical section so the returned set is
+         * consistent. */
+        queueENTER_CRITICAL( pxQueue );
+        {
+            *pxStatistics = pxQueue->xStatistics;
+        }
+        queueEXIT_CRITICAL( pxQueue );
+
+        traceRETURN_vQueueGetStatistics();
+    }
+
+#endif /* configUSE_IPC_STATISTICS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+
+    void vQueueGetLatencyHistogram( QueueHandle_t xQueue,
+                                    IPCLatencyHistogram_t * pxHistogram )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_vQueueGetLatencyHistogram( xQueue, pxHistogram );
+
+        configASSERT( pxQueue );
+        configASSERT( pxHistogram );
+
+        queueENTER_CRITICAL( pxQueue );
+        {
+            *pxHistogram = pxQueue->xLatencyHistogram;
+        }
+        queueEXIT_CRITICAL( pxQueue );
+
+        traceRETURN_vQueueGetLatencyHistogram();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvStampMessageTags( Queue_t * const pxQueue,
+                                     const int8_t * pcSlot,
+                                     UBaseType_t uxCount,
+                                     const BaseType_t xFromISR )
+    {
+        UBaseType_t uxIndex;
+
+        if( pxQueue->pxMessageTags != NULL )
+        {
+            uxIndex = queueSLOT_INDEX( pxQueue, pcSlot );
+
+            while( uxCount > ( UBaseType_t ) 0U )
+            {
+                vTaskStampMessageTag( &( pxQueue->pxMessageTags[ uxIndex ] ), xFromISR );
+
+                uxIndex++;
+
+                if( uxIndex >= pxQueue->uxLength )
+                {
+                    uxIndex = ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                uxCount--;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvReceiveMessageTags( Queue_t * const pxQueue,
+                                       const int8_t * pcSlot,
+                                       UBaseType_t uxCount,
+                                       const BaseType_t xFromISR )
+    {
+        UBaseType_t uxIndex;
+
+        if( pxQueue->pxMessageTags != NULL )
+        {
+            /* pcSlot is the last of the uxCount slots read, so step back to
+             * the first to record the items in the order they were sent. */
+            uxIndex = queueSLOT_INDEX( pxQueue, pcSlot );
+
+            if( uxIndex >= ( uxCount - ( UBaseType_t ) 1U ) )
+            {
+                uxIndex -= ( uxCount - ( UBaseType_t ) 1U );
+            }
+            else
+            {
+                uxIndex += pxQueue->uxLength - ( uxCount - ( UBaseType_t ) 1U );
+            }
+
+            while( uxCount > ( UBaseType_t ) 0U )
+            {
+                vTaskReceiveMessageTag( &( pxQueue->pxMessageTags[ uxIndex ] ), &( pxQueue->xLatencyHistogram ), xFromISR );
+
+                uxIndex++;
+
+                if( uxIndex >= pxQueue->uxLength )
+                {
+                    uxIndex = ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                uxCount--;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_IPC_LATENCY_TRACING */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueGetQueueItemSize( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
+{
+    traceENTER_uxQueueGetQueueItemSize( xQueue );
+
+    traceRETURN_uxQueueGetQueueItemSize( ( ( Queue_t * ) xQueue )->uxItemSize );
+
+    return ( ( Queue_t * ) xQueue )->uxItemSize;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueGetQueueLength( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
+{
+    traceENTER_uxQueueGetQueueLength( xQueue );
+
+    traceRETURN_uxQueueGetQueueLength( ( ( Queue_t * ) xQueue )->uxLength );
+
+    return ( ( Queue_t * ) xQueue )->uxLength;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+    static UBaseType_t prvGetHighestPriorityOfWaitToReceiveList( const Queue_t * const pxQueue )
+    {
+        UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+        /* If a task waiting for a mutex causes the mutex holder to inherit a
+         * priority, but the waiting task times out, then the holder should
+         * disinherit the priority - but only down to the highest priority of any
+         * other tasks that are waiting for the same mutex.  For this purpose,
+         * return the priority of the highest priority task that is waiting for the
+         * mutex. */
+        if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
+        {
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) ) );
+        }
+        else
+        {
+            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+        }
+
+        return uxHighestPriorityOfWaitingTasks;
+    }
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_MUTEXES == 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) )
+
+    static BaseType_t prvSpinWhileMutexHolderRuns( const Queue_t * const pxQueue )
+    {
+        UBaseType_t uxIteration;
+        BaseType_t xReturn = pdFALSE;
+
+        for( uxIteration = 0U; uxIteration < ( UBaseType_t ) configMUTEX_SPIN_ITERATIONS; uxIteration++ )
+        {
+            if( pxQueue->uxMessagesWaiting != ( UBaseType_t ) 0U )
+            {
+                /* The mutex has been given. */
+                xReturn = pdTRUE;
+                break;
+            }
+            else if( xTaskInternalIsTaskRunning( pxQueue->u.xSemaphore.xMutexHolder ) == pdFALSE )
+            {
+                /* The holder has blocked or been preempted, so will not give
+                 * the mutex soon. */
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+
+#endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_MUTEXES == 1 ) && ( configMUTEX_SPIN_ITERATIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) )
+
+    static void prvHandOffMutex( Queue_t * const pxQueue )
+    {
+        TaskHandle_t xNewHolder;
+
+        /* This function is called from a critical section. */
+
+        if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) &&
+            ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE ) )
+        {
+            /* The list is ordered by priority, so the task at its head is the
+             * one xTaskRemoveFromEventList() will unblock. */
+            xNewHolder = listGET_OWNER_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
+
+            pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0U;
+            pxQueue->u.xSemaphore.xMutexHolder = xNewHolder;
+            vTaskInternalIncrementMutexHeldCount( xNewHolder );
+
+            #if ( configUSE_IPC_STATISTICS == 1 )
+            {
+                pxQueue->xMutexTakenTime = xTaskGetTickCount();
+            }
+            #endif
+
+            traceQUEUE_MUTEX_HANDOFF( pxQueue, xNewHolder );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_MUTEX_HANDOFF == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
+                                      const void * pvItemToQueue,
+                                      const BaseType_t xPosition )
+{
+    BaseType_t xReturn = pdFALSE;
+    UBaseType_t uxMessagesWaiting;
+
+    /* This function is called from a critical section. */
+
+    uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+    if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
+    {
+        #if ( configUSE_MUTEXES == 1 )
+        {
+            if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+            {
+                #if ( configUSE_IPC_STATISTICS == 1 )
+                {
+                    const TickType_t xHeldTime = xTaskGetTickCount() - pxQueue->xMutexTakenTime;
+
+                    pxQueue->xStatistics.xTotalHeldTime += xHeldTime;
+
+                    if( xHeldTime > pxQueue->xStatistics.xMaxHeldTime )
+                    {
+                        pxQueue->xStatistics.xMaxHeldTime = xHeldTime;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_IPC_STATISTICS */
+
+                /* The mutex is no longer being held. */
+                xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+                pxQueue->u.xSemaphore.xMutexHolder = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_MUTEXES */
+    }
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        else if( queueIS_PRIORITY( pxQueue ) )
+        {
+            /* The position of the item is set by its key, so sending to the
+             * front and to the back are the same.  Overwriting replaces the
+             * only item in a queue of length 1. */
+            if( queueIS_OVERWRITE( xPosition ) && ( uxMessagesWaiting > ( UBaseType_t ) 0 ) )
+            {
+                --uxMessagesWaiting;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->uxMessagesWaiting = uxMessagesWaiting;
+            prvPriorityQueueInsert( pxQueue, pvItemToQueue );
+        }
+    #endif /* configUSE_PRIORITY_QUEUES */
+    else if( queueIS_SEND_TO_BACK( xPosition ) )
+    {
+        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        pxQueue->pcWriteTo += pxQueue->uxItemSize;
+
+        if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+        {
+            pxQueue->pcWriteTo = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( configUSE_RING_QUEUES == 1 )
+        {
+            if( queueIS_RING( pxQueue ) && ( uxMessagesWaiting == pxQueue->uxLength ) )
+            {
+                /* The ring queue was full, so the item just written replaced
+                 * the oldest item.  Move the read position past it so the next
+                 * item received is the oldest that remains. */
+                pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+
+                if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+                {
+                    pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxQueue->uxRingItemsDropped++;
+                traceQUEUE_RING_DISCARD( pxQueue );
+                --uxMessagesWaiting;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_RING_QUEUES */
+    }
+    else
+    {
+        ( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
+
+        if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
+        {
+            pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( queueIS_OVERWRITE( xPosition ) )
+        {
+            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+            {
+                /* An item is not being added but overwritten, so subtract
+                 * one from the recorded number of items in the queue so when
+                 * one is added again below the number of recorded items remains
+                 * correct. */
+                --uxMessagesWaiting;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting + ( UBaseType_t ) 1 );
+    queueSTATS_DEPTH( pxQueue );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyDataFromQueue( Queue_t * const pxQueue,
+                                  void * const pvBuffer )
+{
+    if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    #if ( configUSE_PRIORITY_QUEUES == 1 )
+        else if( queueIS_PRIORITY( pxQueue ) )
+        {
+            /* The item with the highest key is always in the first slot.  It
+             * is removed from the heap separately so a peek does not change
+             * the heap. */
+            ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->pcHead, ( size_t ) pxQueue->uxItemSize );
+        }
+    #endif /* configUSE_PRIORITY_QUEUES */
+    else
+    {
+        pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+
+        if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+        {
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRIORITY_QUEUES == 1 )
+
+    static uint32_t prvPriorityQueueKey( const int8_t * pcItem )
+    {
+        uint32_t ulKey;
+
+        /* Items are not necessarily aligned within the storage area. */
+        ( void ) memcpy( ( void * ) &ulKey, ( const void * ) pcItem, sizeof( ulKey ) );
+
+        return ulKey;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvPriorityQueueInsert( Queue_t * const pxQueue,
+                                        const void * pvItemToQueue )
+    {
+        const size_t xItemSize = ( size_t ) pxQueue->uxItemSize;
+        const uint32_t ulKey = prvPriorityQueueKey( ( const int8_t * ) pvItemToQueue );
+        UBaseType_t uxHole = pxQueue->uxMessagesWaiting;
+        UBaseType_t uxParent;
+
+        /* Move the parents of the new slot down until the hole reaches the
+         * slot the new item belongs in.  An item is not moved above an item
+         * with an equal key, so items with equal keys tend to be received in
+         * the order they were sent, although that is not guaranteed. */
+        while( uxHole > ( UBaseType_t ) 0 )
+        {
+            uxParent = ( uxHole - ( UBaseType_t ) 1 ) / ( UBaseType_t ) 2;
+
+            if( prvPriorityQueueKey( pxQueue->pcHead + ( ( size_t ) uxParent * xItemSize ) ) >= ulKey )
+            {
+                break;
+            }
+
+            ( void ) memcpy( ( void * ) ( pxQueue->pcHead + ( ( size_t ) uxHole * xItemSize ) ), ( void * ) ( pxQueue->pcHead + ( ( size_t ) uxParent * xItemSize ) ), xItemSize );
+            uxHole = uxParent;
+        }
+
+        ( void ) memcpy( ( void * ) ( pxQueue->pcHead + ( ( size_t ) uxHole * xItemSize ) ), pvItemToQueue, xItemSize );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvPriorityQueueRemoveHead( Queue_t * const pxQueue )
+    {
+        const size_t xItemSize = ( size_t ) pxQueue->uxItemSize;
+        const UBaseType_t uxLast = pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1;
+        const int8_t * const pcLastItem = pxQueue->pcHead + ( ( size_t ) uxLast * xItemSize );
+        const uint32_t ulLastKey = prvPriorityQueueKey( pcLastItem );
+        UBaseType_t uxHole = 0;
+        UBaseType_t uxChild;
+
+        /* The first slot is now a hole.  Move the larger child of the hole up
+         * until the last item can fill the hole without breaking the heap.
+         * The last item's slot is outside the smaller heap so is not
+         * overwritten before the last item is moved. */
+        for( ; ; )
+        {
+            uxChild = ( uxHole * ( UBaseType_t ) 2 ) + ( UBaseType_t ) 1;
+
+            if( uxChild >= uxLast )
+            {
+                break;
+            }
+
+            if( ( ( uxChild + ( UBaseType_t ) 1 ) < uxLast ) &&
+                ( prvPriorityQueueKey( pxQueue->pcHead + ( ( size_t ) ( uxChild + ( UBaseType_t ) 1 ) * xItemSize ) ) > prvPriorityQueueKey( pxQueue->pcHead + ( ( size_t ) uxChild * xItemSize ) ) ) )
+            {
+                uxChild++;
+            }
+
+            if( prvPriorityQueueKey( pxQueue->pcHead + ( ( size_t ) uxChild * xItemSize ) ) <= ulLastKey )
+            {
+                break;
+            }
+
+            ( void ) memcpy( ( void * ) ( pxQueue->pcHead + ( ( size_t ) uxHole * xItemSize ) ), ( void * ) ( pxQueue->pcHead + ( ( size_t ) uxChild * xItemSize ) ), xItemSize );
+            uxHole = uxChild;
+        }
+
+        if( uxHole != uxLast )
+        {
+            ( void ) memcpy( ( void * ) ( pxQueue->pcHead + ( ( size_t ) uxHole * xItemSize ) ), ( const void * ) pcLastItem, xItemSize );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_PRIORITY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    static void prvCopyItemsToQueue( Queue_t * const pxQueue,
+                                     const void * pvItems,
+                                     const UBaseType_t uxCount )
+    {
+        const size_t xTotalBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+        size_t xFirstBytes = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo );
+
+        /* This function is called from a critical section. */
+
+        if( xFirstBytes >= xTotalBytes )
+        {
+            /* The items fit before the end of the storage area. */
+            ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xTotalBytes );
+            pxQueue->pcWriteTo += xTotalBytes;
+
+            if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+            {
+                pxQueue->pcWriteTo = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            /* The items wrap, so the remainder goes to the start of the
+             * storage area. */
+            ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItems, xFirstBytes );
+            ( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) ( ( const uint8_t * ) pvItems + xFirstBytes ), xTotalBytes - xFirstBytes );
+            pxQueue->pcWriteTo = pxQueue->pcHead + ( xTotalBytes - xFirstBytes );
+        }
+
+        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + uxCount );
+        queueSTATS_DEPTH( pxQueue );
+    }
+
+#endif /* #if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    static void prvCopyItemsFromQueue( Queue_t * const pxQueue,
+                                       void * const pvBuffer,
+                                       const UBaseType_t uxCount )
+    {
+        const size_t xTotalBytes = ( size_t ) uxCount * ( size_t ) pxQueue->uxItemSize;
+        int8_t * pcFirstItem = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+        size_t xFirstBytes;
+
+        /* This function is called from a critical section.  pcReadFrom points
+         * to the last item read, so the first item to read follows it. */
+
+        if( pcFirstItem >= pxQueue->u.xQueue.pcTail )
+        {
+            pcFirstItem = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xFirstBytes = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcFirstItem );
+
+        if( xFirstBytes >= xTotalBytes )
+        {
+            /* The items are all before the end of the storage area. */
+            ( void ) memcpy( pvBuffer, ( void * ) pcFirstItem, xTotalBytes );
+            pxQueue->u.xQueue.pcReadFrom = pcFirstItem + ( xTotalBytes - pxQueue->uxItemSize );
+        }
+        else
+        {
+            /* The items wrap, so the remainder comes from the start of the
+             * storage area. */
+            ( void ) memcpy( pvBuffer, ( void * ) pcFirstItem, xFirstBytes );
+            ( void ) memcpy( ( void * ) ( ( uint8_t * ) pvBuffer + xFirstBytes ), ( void * ) pxQueue->pcHead, xTotalBytes - xFirstBytes );
+            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead + ( ( xTotalBytes - xFirstBytes ) - pxQueue->uxItemSize );
+        }
+
+        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - uxCount );
+    }
+
+#endif /* #if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+    static BaseType_t prvSpscWrite( Queue_t * const pxQueue,
+                                    const void * pvItemToQueue )
+    {
+        BaseType_t xReturn;
+
+        if( queueSPSC_ITEMS( pxQueue ) < pxQueue->uxLength )
+        {
+            ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+            pxQueue->pcWriteTo += pxQueue->uxItemSize;
+
+            if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+            {
+                pxQueue->pcWriteTo = pxQueue->pcHead;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The item must be complete before the consumer can see it, and
+             * must be visible before the caller checks for a blocked
+             * consumer. */
+            portMEMORY_BARRIER();
+            pxQueue->uxSpscItemsWritten = ( UBaseType_t ) ( pxQueue->uxSpscItemsWritten + ( UBaseType_t ) 1 );
+            portMEMORY_BARRIER();
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_SPSC_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+    static BaseType_t prvSpscRead( Queue_t * const pxQueue,
+                                   void * const pvBuffer )
+    {
+        BaseType_t xReturn;
+
+        if( queueSPSC_ITEMS( pxQueue ) > ( UBaseType_t ) 0 )
+        {
+            /* The item must not be read before it is known to be complete. */
+            portMEMORY_BARRIER();
+            prvCopyDataFromQueue( pxQueue, pvBuffer );
+
+            /* The slot must not be reused before the item has been read, and
+             * must be seen to be free before the caller checks for a blocked
+             * producer. */
+            portMEMORY_BARRIER();
+            pxQueue->uxSpscItemsRead = ( UBaseType_t ) ( pxQueue->uxSpscItemsRead + ( UBaseType_t ) 1 );
+            portMEMORY_BARRIER();
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_SPSC_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MPMC_QUEUES == 1 )
+
+    static BaseType_t prvMpmcWrite( Queue_t * const pxQueue,
+                                    const void * pvItemToQueue )
     {
-        traceENTER_ucQueueGetQueueType( xQueue );
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xDone = pdFALSE;
+        uint32_t ulPosition = pxQueue->ulMpmcEnqueuePos;
+        UBaseType_t uxSlot = queueMPMC_SLOT( pxQueue, ulPosition );
+        int32_t lDifference;
 
-        traceRETURN_ucQueueGetQueueType( ( ( Queue_t * ) xQueue )->ucQueueType );
+        while( xDone == pdFALSE )
+        {
+            uxSlot = queueMPMC_SLOT( pxQueue, ulPosition );
+            lDifference = ( int32_t ) ( pxQueue->pulMpmcSequence[ uxSlot ] - ulPosition );
 
-        return ( ( Queue_t * ) xQueue )->ucQueueType;
+            if( lDifference == 0 )
+            {
+                /* The slot is free.  Claim it unless another producer got
+                 * there first. */
+                if( queueCOMPARE_AND_SWAP( &( pxQueue->ulMpmcEnqueuePos ), ulPosition + 1U, ulPosition ) != 0U )
+                {
+                    xReturn = pdPASS;
+                    xDone = pdTRUE;
+                }
+                else
+                {
+                    ulPosition = pxQueue->ulMpmcEnqueuePos;
+                }
+            }
+            else if( lDifference < 0 )
+            {
+                /* The slot still holds an item from the previous pass around
+                 * the ring, so the queue is full. */
+                xDone = pdTRUE;
+            }
+            else
+            {
+                /* Another producer claimed this position. */
+                ulPosition = pxQueue->ulMpmcEnqueuePos;
+            }
+        }
+
+        if( xReturn == pdPASS )
+        {
+            ( void ) memcpy( ( void * ) &( pxQueue->pcHead[ uxSlot * pxQueue->uxItemSize ] ), pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+
+            /* The item must be complete before a consumer can see it, and
+             * must be visible before the caller checks for a blocked
+             * consumer. */
+            portMEMORY_BARRIER();
+            pxQueue->pulMpmcSequence[ uxSlot ] = ulPosition + 1U;
+            portMEMORY_BARRIER();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
     }
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* #if ( configUSE_MPMC_QUEUES == 1 ) */
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueGetQueueItemSize( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
-{
-    traceENTER_uxQueueGetQueueItemSize( xQueue );
+#if ( configUSE_MPMC_QUEUES == 1 )
 
-    traceRETURN_uxQueueGetQueueItemSize( ( ( Queue_t * ) xQueue )->uxItemSize );
+    static BaseType_t prvMpmcRead( Queue_t * const pxQueue,
+                                   void * const pvBuffer )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xDone = pdFALSE;
+        uint32_t ulPosition = pxQueue->ulMpmcDequeuePos;
+        UBaseType_t uxSlot = queueMPMC_SLOT( pxQueue, ulPosition );
+        int32_t lDifference;
 
-    return ( ( Queue_t * ) xQueue )->uxItemSize;
-}
+        while( xDone == pdFALSE )
+        {
+            uxSlot = queueMPMC_SLOT( pxQueue, ulPosition );
+            lDifference = ( int32_t ) ( pxQueue->pulMpmcSequence[ uxSlot ] - ( ulPosition + 1U ) );
+
+            if( lDifference == 0 )
+            {
+                /* The slot holds an item.  Claim it unless another consumer
+                 * got there first. */
+                if( queueCOMPARE_AND_SWAP( &( pxQueue->ulMpmcDequeuePos ), ulPosition + 1U, ulPosition ) != 0U )
+                {
+                    xReturn = pdPASS;
+                    xDone = pdTRUE;
+                }
+                else
+                {
+                    ulPosition = pxQueue->ulMpmcDequeuePos;
+                }
+            }
+            else if( lDifference < 0 )
+            {
+                /* No item has been published to the slot yet, so the queue is
+                 * empty. */
+                xDone = pdTRUE;
+            }
+            else
+            {
+                /* Another consumer claimed this position. */
+                ulPosition = pxQueue->ulMpmcDequeuePos;
+            }
+        }
+
+        if( xReturn == pdPASS )
+        {
+            /* The item must not be read before it is known to be complete. */
+            portMEMORY_BARRIER();
+            ( void ) memcpy( pvBuffer, ( void * ) &( pxQueue->pcHead[ uxSlot * pxQueue->uxItemSize ] ), ( size_t ) pxQueue->uxItemSize );
+
+            /* The slot must not be reused before the item has been read, and
+             * must be seen to be free before the caller checks for a blocked
+             * producer.  The slot next becomes writable one pass further
+             * around the ring. */
+            portMEMORY_BARRIER();
+            pxQueue->pulMpmcSequence[ uxSlot ] = ulPosition + ( uint32_t ) pxQueue->uxLength;
+            portMEMORY_BARRIER();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_MPMC_QUEUES == 1 ) */
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueGetQueueLength( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION */
-{
-    traceENTER_uxQueueGetQueueLength( xQueue );
+#if ( configUSE_ATOMIC_SEMAPHORES == 1 )
 
-    traceRETURN_uxQueueGetQueueLength( ( ( Queue_t * ) xQueue )->uxLength );
+    static BaseType_t prvAtomicSemaphoreUpdate( Queue_t * const pxQueue,
+                                                const BaseType_t xIsGive )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xDone = pdFALSE;
+        uint32_t ulCount;
 
-    return ( ( Queue_t * ) xQueue )->uxLength;
-}
+        while( xDone == pdFALSE )
+        {
+            ulCount = pxQueue->ulAtomicCount;
+
+            if( ( xIsGive != pdFALSE ) ? ( ulCount >= ( uint32_t ) pxQueue->uxLength ) : ( ulCount == 0U ) )
+            {
+                /* The semaphore cannot be given or taken. */
+                xDone = pdTRUE;
+            }
+            else if( queueCOMPARE_AND_SWAP( &( pxQueue->ulAtomicCount ), ( xIsGive != pdFALSE ) ? ( ulCount + 1U ) : ( ulCount - 1U ), ulCount ) != 0U )
+            {
+                xReturn = pdPASS;
+                xDone = pdTRUE;
+            }
+            else
+            {
+                /* Another task or interrupt changed the count first, so try
+                 * again with the new count. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+
+#endif /* #if ( configUSE_ATOMIC_SEMAPHORES == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
 
-    static UBaseType_t prvGetHighestPriorityOfWaitToReceiveList( const Queue_t * const pxQueue )
+    static BaseType_t prvLockFreeWrite( Queue_t * const pxQueue,
+                                        const void * pvItemToQueue )
     {
-        UBaseType_t uxHighestPriorityOfWaitingTasks;
+        BaseType_t xReturn = pdFAIL;
 
-        /* If a task waiting for a mutex causes the mutex holder to inherit a
-         * priority, but the waiting task times out, then the holder should
-         * disinherit the priority - but only down to the highest priority of any
-         * other tasks that are waiting for the same mutex.  For this purpose,
-         * return the priority of the highest priority task that is waiting for the
-         * mutex. */
-        if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
+        #if ( configUSE_SPSC_QUEUES == 1 )
         {
-            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) ) );
+            if( queueIS_SPSC( pxQueue ) )
+            {
+                xReturn = prvSpscWrite( pxQueue, pvItemToQueue );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
-        else
+        #endif /* #if ( configUSE_SPSC_QUEUES == 1 ) */
+
+        #if ( configUSE_MPMC_QUEUES == 1 )
         {
-            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+            if( queueIS_MPMC( pxQueue ) )
+            {
+                xReturn = prvMpmcWrite( pxQueue, pvItemToQueue );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
+        #endif /* #if ( configUSE_MPMC_QUEUES == 1 ) */
 
-        return uxHighestPriorityOfWaitingTasks;
+        #if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+        {
+            if( queueIS_ATOMIC_SEMAPHORE( pxQueue ) )
+            {
+                /* An atomic semaphore holds no data. */
+                ( void ) pvItemToQueue;
+                xReturn = prvAtomicSemaphoreUpdate( pxQueue, pdTRUE );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_ATOMIC_SEMAPHORES == 1 ) */
+
+        return xReturn;
+    }
+
+#endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+
+    static BaseType_t prvLockFreeRead( Queue_t * const pxQueue,
+                                       void * const pvBuffer )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        #if ( configUSE_SPSC_QUEUES == 1 )
+        {
+            if( queueIS_SPSC( pxQueue ) )
+            {
+                xReturn = prvSpscRead( pxQueue, pvBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_SPSC_QUEUES == 1 ) */
+
+        #if ( configUSE_MPMC_QUEUES == 1 )
+        {
+            if( queueIS_MPMC( pxQueue ) )
+            {
+                xReturn = prvMpmcRead( pxQueue, pvBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_MPMC_QUEUES == 1 ) */
+
+        #if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+        {
+            if( queueIS_ATOMIC_SEMAPHORE( pxQueue ) )
+            {
+                /* An atomic semaphore holds no data. */
+                ( void ) pvBuffer;
+                xReturn = prvAtomicSemaphoreUpdate( pxQueue, pdFALSE );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_ATOMIC_SEMAPHORES == 1 ) */
+
+        return xReturn;
+    }
+
+#endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+
+    static UBaseType_t prvLockFreeItemsHeld( const Queue_t * pxQueue )
+    {
+        UBaseType_t uxReturn = ( UBaseType_t ) 0U;
+
+        #if ( configUSE_SPSC_QUEUES == 1 )
+        {
+            if( queueIS_SPSC( pxQueue ) )
+            {
+                uxReturn = queueSPSC_ITEMS( pxQueue );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_SPSC_QUEUES == 1 ) */
+
+        #if ( configUSE_MPMC_QUEUES == 1 )
+        {
+            if( queueIS_MPMC( pxQueue ) )
+            {
+                /* The dequeue position is read first so it can never be ahead
+                 * of the enqueue position read after it.  A position that has
+                 * been claimed but not yet published is counted, so the result
+                 * is limited to the queue length. */
+                const uint32_t ulDequeuePos = pxQueue->ulMpmcDequeuePos;
+                uint32_t ulItems;
+
+                portMEMORY_BARRIER();
+                ulItems = pxQueue->ulMpmcEnqueuePos - ulDequeuePos;
+
+                if( ulItems > ( uint32_t ) pxQueue->uxLength )
+                {
+                    ulItems = ( uint32_t ) pxQueue->uxLength;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                uxReturn = ( UBaseType_t ) ulItems;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_MPMC_QUEUES == 1 ) */
+
+        #if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+        {
+            if( queueIS_ATOMIC_SEMAPHORE( pxQueue ) )
+            {
+                uxReturn = ( UBaseType_t ) pxQueue->ulAtomicCount;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_ATOMIC_SEMAPHORES == 1 ) */
+
+        return uxReturn;
+    }
+
+#endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+
+    static BaseType_t prvLockFreeMustWait( const Queue_t * pxQueue,
+                                           const BaseType_t xIsSend )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        #if ( configUSE_SPSC_QUEUES == 1 )
+        {
+            if( queueIS_SPSC( pxQueue ) )
+            {
+                if( xIsSend != pdFALSE )
+                {
+                    xReturn = ( queueSPSC_ITEMS( pxQueue ) >= pxQueue->uxLength ) ? pdTRUE : pdFALSE;
+                }
+                else
+                {
+                    xReturn = ( queueSPSC_ITEMS( pxQueue ) == ( UBaseType_t ) 0 ) ? pdTRUE : pdFALSE;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_SPSC_QUEUES == 1 ) */
+
+        #if ( configUSE_MPMC_QUEUES == 1 )
+        {
+            if( queueIS_MPMC( pxQueue ) )
+            {
+                /* Test the slot at the next position in the same way as
+                 * prvMpmcWrite() or prvMpmcRead() would. */
+                const uint32_t ulPosition = ( xIsSend != pdFALSE ) ? pxQueue->ulMpmcEnqueuePos : pxQueue->ulMpmcDequeuePos;
+                const uint32_t ulReadyValue = ( xIsSend != pdFALSE ) ? ulPosition : ( ulPosition + 1U );
+
+                xReturn = ( ( int32_t ) ( pxQueue->pulMpmcSequence[ queueMPMC_SLOT( pxQueue, ulPosition ) ] - ulReadyValue ) < 0 ) ? pdTRUE : pdFALSE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_MPMC_QUEUES == 1 ) */
+
+        #if ( configUSE_ATOMIC_SEMAPHORES == 1 )
+        {
+            if( queueIS_ATOMIC_SEMAPHORE( pxQueue ) )
+            {
+                if( xIsSend != pdFALSE )
+                {
+                    xReturn = ( pxQueue->ulAtomicCount >= ( uint32_t ) pxQueue->uxLength ) ? pdTRUE : pdFALSE;
+                }
+                else
+                {
+                    xReturn = ( pxQueue->ulAtomicCount == 0U ) ? pdTRUE : pdFALSE;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* #if ( configUSE_ATOMIC_SEMAPHORES == 1 ) */
+
+        return xReturn;
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
-                                      const void * pvItemToQueue,
-                                      const BaseType_t xPosition )
-{
-    BaseType_t xReturn = pdFALSE;
-    UBaseType_t uxMessagesWaiting;
-
-    /* This function is called from a critical section. */
-
-    uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
 
-    if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
+    static BaseType_t prvLockFreeWakeWaiter( Queue_t * const pxQueue,
+                                             const BaseType_t xItemPosted,
+                                             const BaseType_t xFromISR )
     {
-        #if ( configUSE_MUTEXES == 1 )
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        UBaseType_t uxSavedInterruptStatus = ( UBaseType_t ) 0U;
+        List_t * const pxWaitingList = ( xItemPosted != pdFALSE ) ? &( pxQueue->xTasksWaitingToReceive ) : &( pxQueue->xTasksWaitingToSend );
+        const int8_t cLock = ( xItemPosted != pdFALSE ) ? pxQueue->cTxLock : pxQueue->cRxLock;
+
+        /* A task that blocks on the queue locks it before checking whether it
+         * still needs to block, so if the queue is unlocked and no task is
+         * waiting there is nothing to do. */
+        if( ( cLock != queueUNLOCKED ) || ( listLIST_IS_EMPTY( pxWaitingList ) == pdFALSE ) )
         {
-            if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+            if( xFromISR != pdFALSE )
             {
-                /* The mutex is no longer being held. */
-                xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
-                pxQueue->u.xSemaphore.xMutexHolder = NULL;
+                /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                /* coverity[misra_c_2012_directive_4_7_violation] */
+                uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( pxQueue );
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                queueENTER_CRITICAL( pxQueue );
             }
-        }
-        #endif /* configUSE_MUTEXES */
-    }
-    else if( xPosition == queueSEND_TO_BACK )
-    {
-        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
-        pxQueue->pcWriteTo += pxQueue->uxItemSize;
 
-        if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
-        {
-            pxQueue->pcWriteTo = pxQueue->pcHead;
+            {
+                const int8_t cTxLock = pxQueue->cTxLock;
+                const int8_t cRxLock = pxQueue->cRxLock;
+
+                if( ( ( xItemPosted != pdFALSE ) ? cTxLock : cRxLock ) == queueUNLOCKED )
+                {
+                    if( listLIST_IS_EMPTY( pxWaitingList ) == pdFALSE )
+                    {
+                        if( xTaskRemoveFromEventList( pxWaitingList ) != pdFALSE )
+                        {
+                            xHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( xItemPosted != pdFALSE )
+                {
+                    /* Increment the lock count so the task that unlocks the
+                     * queue knows that data was posted while it was locked. */
+                    prvIncrementQueueTxLock( pxQueue, cTxLock );
+                }
+                else
+                {
+                    /* Increment the lock count so the task that unlocks the
+                     * queue knows that data was removed while it was locked. */
+                    prvIncrementQueueRxLock( pxQueue, cRxLock );
+                }
+            }
+
+            if( xFromISR != pdFALSE )
+            {
+                queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxQueue );
+            }
+            else
+            {
+                queueEXIT_CRITICAL( pxQueue );
+            }
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
+
+        return xHigherPriorityTaskWoken;
     }
-    else
+
+#endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+
+    static BaseType_t prvLockFreeSend( Queue_t * const pxQueue,
+                                       const void * const pvItemToQueue,
+                                       TickType_t xTicksToWait )
     {
-        ( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
-        pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
 
-        if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
+        for( ; ; )
         {
-            pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
+            if( prvLockFreeWrite( pxQueue, pvItemToQueue ) != pdFALSE )
+            {
+                traceQUEUE_SEND( pxQueue );
 
-        if( xPosition == queueOVERWRITE )
-        {
-            if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+                if( prvLockFreeWakeWaiter( pxQueue, pdTRUE, pdFALSE ) != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                return pdPASS;
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
             {
-                /* An item is not being added but overwritten, so subtract
-                 * one from the recorded number of items in the queue so when
-                 * one is added again below the number of recorded items remains
-                 * correct. */
-                --uxMessagesWaiting;
+                traceQUEUE_SEND_FAILED( pxQueue );
+
+                return errQUEUE_FULL;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskInternalSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
             }
             else
             {
+                /* Entry time was already set. */
                 mtCOVERAGE_TEST_MARKER();
             }
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                /* The queue is now locked, so if a consumer removes an item
+                 * after this check it will see the lock and enter the kernel
+                 * to record that space became available. */
+                portMEMORY_BARRIER();
+
+                if( prvLockFreeMustWait( pxQueue, pdTRUE ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* Try again. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out.  Loop back once more in case space became
+                 * available, otherwise the zero block time path is taken. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+                xTicksToWait = ( TickType_t ) 0;
+                queueSTATS_TIMED_OUT( pxQueue );
+            }
         }
     }
 
-    pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( uxMessagesWaiting + ( UBaseType_t ) 1 );
-
-    return xReturn;
-}
+#endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
 /*-----------------------------------------------------------*/
 
-static void prvCopyDataFromQueue( Queue_t * const pxQueue,
-                                  void * const pvBuffer )
-{
-    if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+#if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+
+    static BaseType_t prvLockFreeReceive( Queue_t * const pxQueue,
+                                          void * const pvBuffer,
+                                          TickType_t xTicksToWait )
     {
-        pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        TimeOut_t xTimeOut;
 
-        if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
-        {
-            pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
-        }
-        else
+        for( ; ; )
         {
-            mtCOVERAGE_TEST_MARKER();
-        }
+            if( prvLockFreeRead( pxQueue, pvBuffer ) != pdFALSE )
+            {
+                traceQUEUE_RECEIVE( pxQueue );
 
-        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize );
+                if( prvLockFreeWakeWaiter( pxQueue, pdFALSE, pdFALSE ) != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                return pdPASS;
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+
+                return errQUEUE_EMPTY;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskInternalSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+            else
+            {
+                /* Entry time was already set. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            vTaskSuspendAll();
+            prvLockQueue( pxQueue );
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                /* The queue is now locked, so if a producer posts an item
+                 * after this check it will see the lock and enter the kernel
+                 * to record that data became available. */
+                portMEMORY_BARRIER();
+
+                if( prvLockFreeMustWait( pxQueue, pdFALSE ) != pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                    vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                    prvUnlockQueue( pxQueue );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* The queue contains data again.  Loop back to try and
+                     * read the data. */
+                    prvUnlockQueue( pxQueue );
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out.  Loop back once more in case data arrived,
+                 * otherwise the zero block time path is taken. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+                xTicksToWait = ( TickType_t ) 0;
+                queueSTATS_TIMED_OUT( pxQueue );
+            }
+        }
     }
-}
+
+#endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
 /*-----------------------------------------------------------*/
 
 static void prvUnlockQueue( Queue_t * const pxQueue )
@@ -2499,7 +6538,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
      * removed from the queue while the queue was locked.  When a queue is
      * locked items can be added or removed, but the event lists cannot be
      * updated. */
-    taskENTER_CRITICAL();
+    queueENTER_CRITICAL( pxQueue );
     {
         int8_t cTxLock = pxQueue->cTxLock;
 
@@ -2577,10 +6616,10 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 
         pxQueue->cTxLock = queueUNLOCKED;
     }
-    taskEXIT_CRITICAL();
+    queueEXIT_CRITICAL( pxQueue );
 
     /* Do the same for the Rx lock. */
-    taskENTER_CRITICAL();
+    queueENTER_CRITICAL( pxQueue );
     {
         int8_t cRxLock = pxQueue->cRxLock;
 
@@ -2588,7 +6627,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
         {
             if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
             {
-                if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+                if( queueUNBLOCK_SENDERS( pxQueue ) != pdFALSE )
                 {
                     vTaskMissedYield();
                 }
@@ -2607,17 +6646,106 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 
         pxQueue->cRxLock = queueUNLOCKED;
     }
-    taskEXIT_CRITICAL();
+    queueEXIT_CRITICAL( pxQueue );
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+    static void prvQueueEnterCritical( const Queue_t * const pxQueue )
+    {
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            taskENTER_CRITICAL();
+        }
+        else
+        {
+            /* The lock is the only member written through a pointer to a const
+             * queue. */
+            taskDATA_GROUP_ENTER_CRITICAL( ( portSPINLOCK_TYPE * ) &( pxQueue->xQueueLock ) );
+        }
+    }
+
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+    static void prvQueueExitCritical( const Queue_t * const pxQueue )
+    {
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            taskDATA_GROUP_EXIT_CRITICAL( ( portSPINLOCK_TYPE * ) &( pxQueue->xQueueLock ) );
+        }
+    }
+
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+    static UBaseType_t prvQueueEnterCriticalFromISR( const Queue_t * const pxQueue )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        }
+        else
+        {
+            uxSavedInterruptStatus = taskDATA_GROUP_ENTER_CRITICAL_FROM_ISR( ( portSPINLOCK_TYPE * ) &( pxQueue->xQueueLock ) );
+        }
+
+        return uxSavedInterruptStatus;
+    }
+
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+    static void prvQueueExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus,
+                                             const Queue_t * const pxQueue )
+    {
+        if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+        {
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            taskDATA_GROUP_EXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, ( portSPINLOCK_TYPE * ) &( pxQueue->xQueueLock ) );
+        }
+    }
+
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_GRANULAR_LOCKS == 1 )
+
+    static void prvWaitForQueueUnlock( void )
+    {
+        /* A task only locks a queue while it has the scheduler suspended, so
+         * the queue is unlocked again by the time the scheduler can be
+         * suspended here. */
+        vTaskSuspendAll();
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+/*-----------------------------------------------------------*/
+
 static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
 {
     BaseType_t xReturn;
 
-    taskENTER_CRITICAL();
+    queueENTER_CRITICAL( pxQueue );
     {
-        if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+        if( !queueHAS_ITEMS( pxQueue ) )
         {
             xReturn = pdTRUE;
         }
@@ -2626,7 +6754,7 @@ static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue )
             xReturn = pdFALSE;
         }
     }
-    taskEXIT_CRITICAL();
+    queueEXIT_CRITICAL( pxQueue );
 
     return xReturn;
 }
@@ -2641,7 +6769,20 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
 
     configASSERT( pxQueue );
 
-    if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+    #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+    {
+        if( queueIS_LOCK_FREE( pxQueue ) )
+        {
+            xReturn = prvLockFreeMustWait( pxQueue, pdFALSE );
+
+            traceRETURN_xQueueIsQueueEmptyFromISR( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+
+    if( !queueHAS_ITEMS( pxQueue ) )
     {
         xReturn = pdTRUE;
     }
@@ -2660,21 +6801,73 @@ static BaseType_t prvIsQueueFull( const Queue_t * pxQueue )
 {
     BaseType_t xReturn;
 
-    taskENTER_CRITICAL();
+    queueENTER_CRITICAL( pxQueue );
+    {
+        if( queueIS_FULL_TO_BLOCKED_SENDER( pxQueue ) )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+    }
+    queueEXIT_CRITICAL( pxQueue );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 )
+
+    static BaseType_t prvIsQueueTooFullFor( const Queue_t * pxQueue,
+                                            const UBaseType_t uxCount )
     {
-        if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+        BaseType_t xReturn;
+
+        queueENTER_CRITICAL( pxQueue );
         {
-            xReturn = pdTRUE;
+            if( queueSPACES_AVAILABLE( pxQueue ) < uxCount )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                xReturn = pdFALSE;
+            }
         }
-        else
+        queueEXIT_CRITICAL( pxQueue );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvUnblockSenders( Queue_t * const pxQueue )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        /* Waking one sender per item removed assumes each sender needs one
+         * slot.  A sender waiting for more slots than are free would use up
+         * the wake and block again, leaving a sender behind it that needs
+         * fewer slots blocked while there is space for it.  So while such a
+         * sender is waiting, every sender is unblocked to check for itself. */
+        do
         {
-            xReturn = pdFALSE;
-        }
+            if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } while( ( pxQueue->uxMultipleSendersWaiting > ( UBaseType_t ) 0U ) &&
+                 ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE ) );
+
+        return xReturn;
     }
-    taskEXIT_CRITICAL();
 
-    return xReturn;
-}
+#endif /* #if ( configUSE_QUEUE_MULTIPLE_ITEMS == 1 ) */
 /*-----------------------------------------------------------*/
 
 BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
@@ -2686,7 +6879,20 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
     configASSERT( pxQueue );
 
-    if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+    #if ( queueUSE_LOCK_FREE_QUEUES == 1 )
+    {
+        if( queueIS_LOCK_FREE( pxQueue ) )
+        {
+            xReturn = prvLockFreeMustWait( pxQueue, pdTRUE );
+
+            traceRETURN_xQueueIsQueueFullFromISR( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* #if ( queueUSE_LOCK_FREE_QUEUES == 1 ) */
+
+    if( !queueHAS_SPACE( pxQueue ) )
     {
         xReturn = pdTRUE;
     }
@@ -2742,7 +6948,10 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
         {
             if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
             {
-                /* There is room in the queue, copy the data into the queue. */
+                /* There is room in the queue, copy the data into the queue.
+                 * A co-routine holds no tag, so its item starts a new
+                 * chain. */
+                queueSTAMP_MESSAGE( pxQueue, queueSEND_TO_BACK, pdTRUE );
                 prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
                 xReturn = pdPASS;
 
@@ -2843,6 +7052,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
                 --( pxQueue->uxMessagesWaiting );
                 ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+                queueRECEIVE_MESSAGE_TAGS( pxQueue, pxQueue->u.xQueue.pcReadFrom, ( UBaseType_t ) 1U, pdTRUE );
 
                 xReturn = pdPASS;
 
@@ -2896,6 +7106,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
          * exit without doing anything. */
         if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
         {
+            queueSTAMP_MESSAGE( pxQueue, queueSEND_TO_BACK, pdTRUE );
             prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
 
             /* We only want to wake one co-routine per ISR, so check that a
@@ -2965,6 +7176,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
             --( pxQueue->uxMessagesWaiting );
             ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+            queueRECEIVE_MESSAGE_TAGS( pxQueue, pxQueue->u.xQueue.pcReadFrom, ( UBaseType_t ) 1U, pdTRUE );
 
             if( ( *pxCoRoutineWoken ) == pdFALSE )
             {
@@ -3004,7 +7216,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 #endif /* configUSE_CO_ROUTINES */
 /*-----------------------------------------------------------*/
 
-#if ( configQUEUE_REGISTRY_SIZE > 0 )
+#if ( ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_QUEUE_REGISTRY_INDEX == 0 ) )
 
     void vQueueAddToRegistry( QueueHandle_t xQueue,
                               const char * pcQueueName )
@@ -3052,10 +7264,10 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
         traceRETURN_vQueueAddToRegistry();
     }
 
-#endif /* configQUEUE_REGISTRY_SIZE */
+#endif /* ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_QUEUE_REGISTRY_INDEX == 0 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configQUEUE_REGISTRY_SIZE > 0 )
+#if ( ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_QUEUE_REGISTRY_INDEX == 0 ) )
 
     const char * pcQueueGetName( QueueHandle_t xQueue )
     {
@@ -3087,10 +7299,10 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
         return pcReturn;
     }
 
-#endif /* configQUEUE_REGISTRY_SIZE */
+#endif /* ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_QUEUE_REGISTRY_INDEX == 0 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configQUEUE_REGISTRY_SIZE > 0 )
+#if ( ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_QUEUE_REGISTRY_INDEX == 0 ) )
 
     void vQueueUnregisterQueue( QueueHandle_t xQueue )
     {
@@ -3121,10 +7333,378 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
             }
         }
 
-        traceRETURN_vQueueUnregisterQueue();
+        traceRETURN_vQueueUnregisterQueue();
+    }
+
+#endif /* ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_QUEUE_REGISTRY_INDEX == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_QUEUE_REGISTRY_INDEX == 0 ) )
+
+    QueueHandle_t xQueueGetHandleByName( const char * pcQueueName )
+    {
+        UBaseType_t ux;
+        QueueHandle_t xReturn = NULL;
+
+        traceENTER_xQueueGetHandleByName( pcQueueName );
+
+        configASSERT( pcQueueName );
+
+        /* Note there is nothing here to protect against another task adding or
+         * removing entries from the registry while it is being searched. */
+
+        for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+        {
+            if( ( xQueueRegistry[ ux ].pcQueueName != NULL ) &&
+                ( strcmp( xQueueRegistry[ ux ].pcQueueName, pcQueueName ) == 0 ) )
+            {
+                xReturn = xQueueRegistry[ ux ].xHandle;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_xQueueGetHandleByName( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_QUEUE_REGISTRY_INDEX == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_REGISTRY_INDEX == 1 )
+
+    static UBaseType_t prvRegistryNameBucket( const char * pcQueueName )
+    {
+        uint32_t ulHash = 2166136261UL;
+        const char * pcNextChar;
+
+        /* FNV-1a. */
+        for( pcNextChar = pcQueueName; *pcNextChar != ( char ) 0x00; pcNextChar++ )
+        {
+            ulHash = ( ulHash ^ ( uint32_t ) ( uint8_t ) *pcNextChar ) * 16777619UL;
+        }
+
+        return ( UBaseType_t ) ( ulHash % ( uint32_t ) configQUEUE_REGISTRY_INDEX_BUCKETS );
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvRegistryFindHandle( QueueHandle_t xQueue )
+    {
+        UBaseType_t uxEntry = uxQueueRegistryByHandle[ queueREGISTRY_HANDLE_BUCKET( xQueue ) ];
+
+        while( ( uxEntry != 0U ) && ( xQueueRegistry[ uxEntry - 1U ].xHandle != xQueue ) )
+        {
+            uxEntry = uxQueueRegistryNextByHandle[ uxEntry - 1U ];
+        }
+
+        return uxEntry;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRegistryUnlink( UBaseType_t * puxHead,
+                                   UBaseType_t * puxNext,
+                                   UBaseType_t uxEntry )
+    {
+        UBaseType_t * puxLink = puxHead;
+
+        while( *puxLink != 0U )
+        {
+            if( *puxLink == uxEntry )
+            {
+                *puxLink = puxNext[ uxEntry - 1U ];
+            }
+            else
+            {
+                puxLink = &( puxNext[ *puxLink - 1U ] );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vQueueAddToRegistry( QueueHandle_t xQueue,
+                              const char * pcQueueName )
+    {
+        UBaseType_t uxEntry;
+        UBaseType_t uxBucket;
+
+        traceENTER_vQueueAddToRegistry( xQueue, pcQueueName );
+
+        configASSERT( xQueue );
+
+        if( pcQueueName != NULL )
+        {
+            taskENTER_CRITICAL();
+            {
+                uxEntry = prvRegistryFindHandle( xQueue );
+
+                if( uxEntry != 0U )
+                {
+                    /* Replace the name of a queue already in the registry. */
+                    prvRegistryUnlink( &( uxQueueRegistryByName[ prvRegistryNameBucket( xQueueRegistry[ uxEntry - 1U ].pcQueueName ) ] ), uxQueueRegistryNextByName, uxEntry );
+                }
+                else
+                {
+                    /* Otherwise take a free entry, if there is one. */
+                    if( uxQueueRegistryFree != 0U )
+                    {
+                        uxEntry = uxQueueRegistryFree;
+                        uxQueueRegistryFree = uxQueueRegistryNextByHandle[ uxEntry - 1U ];
+                    }
+                    else if( uxQueueRegistryUnused < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE )
+                    {
+                        uxQueueRegistryUnused++;
+                        uxEntry = uxQueueRegistryUnused;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( uxEntry != 0U )
+                    {
+                        uxBucket = queueREGISTRY_HANDLE_BUCKET( xQueue );
+                        xQueueRegistry[ uxEntry - 1U ].xHandle = xQueue;
+                        uxQueueRegistryNextByHandle[ uxEntry - 1U ] = uxQueueRegistryByHandle[ uxBucket ];
+                        uxQueueRegistryByHandle[ uxBucket ] = uxEntry;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( uxEntry != 0U )
+                {
+                    uxBucket = prvRegistryNameBucket( pcQueueName );
+                    xQueueRegistry[ uxEntry - 1U ].pcQueueName = pcQueueName;
+                    uxQueueRegistryNextByName[ uxEntry - 1U ] = uxQueueRegistryByName[ uxBucket ];
+                    uxQueueRegistryByName[ uxBucket ] = uxEntry;
+
+                    traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        traceRETURN_vQueueAddToRegistry();
+    }
+/*-----------------------------------------------------------*/
+
+    const char * pcQueueGetName( QueueHandle_t xQueue )
+    {
+        UBaseType_t uxEntry;
+        const char * pcReturn = NULL;
+
+        traceENTER_pcQueueGetName( xQueue );
+
+        configASSERT( xQueue );
+
+        taskENTER_CRITICAL();
+        {
+            uxEntry = prvRegistryFindHandle( xQueue );
+
+            if( uxEntry != 0U )
+            {
+                pcReturn = xQueueRegistry[ uxEntry - 1U ].pcQueueName;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_pcQueueGetName( pcReturn );
+
+        return pcReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    QueueHandle_t xQueueGetHandleByName( const char * pcQueueName )
+    {
+        UBaseType_t uxEntry;
+        QueueHandle_t xReturn = NULL;
+
+        traceENTER_xQueueGetHandleByName( pcQueueName );
+
+        configASSERT( pcQueueName );
+
+        /* Only the queues whose names share a bucket with the name being
+         * queried are compared, so a critical section is short enough. */
+        taskENTER_CRITICAL();
+        {
+            for( uxEntry = uxQueueRegistryByName[ prvRegistryNameBucket( pcQueueName ) ]; uxEntry != 0U; uxEntry = uxQueueRegistryNextByName[ uxEntry - 1U ] )
+            {
+                if( strcmp( xQueueRegistry[ uxEntry - 1U ].pcQueueName, pcQueueName ) == 0 )
+                {
+                    xReturn = xQueueRegistry[ uxEntry - 1U ].xHandle;
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_xQueueGetHandleByName( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vQueueUnregisterQueue( QueueHandle_t xQueue )
+    {
+        UBaseType_t uxEntry;
+
+        traceENTER_vQueueUnregisterQueue( xQueue );
+
+        configASSERT( xQueue );
+
+        taskENTER_CRITICAL();
+        {
+            uxEntry = prvRegistryFindHandle( xQueue );
+
+            if( uxEntry != 0U )
+            {
+                prvRegistryUnlink( &( uxQueueRegistryByHandle[ queueREGISTRY_HANDLE_BUCKET( xQueue ) ] ), uxQueueRegistryNextByHandle, uxEntry );
+                prvRegistryUnlink( &( uxQueueRegistryByName[ prvRegistryNameBucket( xQueueRegistry[ uxEntry - 1U ].pcQueueName ) ] ), uxQueueRegistryNextByName, uxEntry );
+
+                /* Clear the entry so a kernel aware debugger sees it is
+                 * free. */
+                xQueueRegistry[ uxEntry - 1U ].pcQueueName = NULL;
+                xQueueRegistry[ uxEntry - 1U ].xHandle = ( QueueHandle_t ) 0;
+
+                uxQueueRegistryNextByHandle[ uxEntry - 1U ] = uxQueueRegistryFree;
+                uxQueueRegistryFree = uxEntry;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vQueueUnregisterQueue();
+    }
+
+#endif /* configUSE_QUEUE_REGISTRY_INDEX */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_WARM_BOOT == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) )
+
+    size_t xQueueCopyWarmBootState( uint8_t * pucState,
+                                    size_t xOffset,
+                                    BaseType_t xSave )
+    {
+        xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) xQueueRegistry, sizeof( xQueueRegistry ), xSave );
+
+        #if ( configUSE_QUEUE_REGISTRY_INDEX == 1 )
+        {
+            xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) uxQueueRegistryByHandle, sizeof( uxQueueRegistryByHandle ), xSave );
+            xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) uxQueueRegistryByName, sizeof( uxQueueRegistryByName ), xSave );
+            xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) uxQueueRegistryNextByHandle, sizeof( uxQueueRegistryNextByHandle ), xSave );
+            xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) uxQueueRegistryNextByName, sizeof( uxQueueRegistryNextByName ), xSave );
+            xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) &uxQueueRegistryFree, sizeof( uxQueueRegistryFree ), xSave );
+            xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) &uxQueueRegistryUnused, sizeof( uxQueueRegistryUnused ), xSave );
+        }
+        #endif
+
+        return xOffset;
+    }
+
+#endif /* ( configUSE_WARM_BOOT == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_IPC_STATISTICS == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+    void vQueueListStatistics( char * pcWriteBuffer,
+                               size_t uxBufferLength )
+    {
+        UBaseType_t ux;
+        IPCStatistics_t xStatistics;
+        size_t uxConsumedBufferLength = 0;
+        int iSnprintfReturnValue;
+
+        traceENTER_vQueueListStatistics( pcWriteBuffer, uxBufferLength );
+
+        configASSERT( pcWriteBuffer );
+        configASSERT( uxBufferLength > 0U );
+
+        /*
+         * PLEASE NOTE:
+         *
+         * This function is provided for convenience only, in the same way as
+         * vTaskListTasks().  It formats the statistics of each queue in the
+         * queue registry into a human readable table that displays: name,
+         * sends, receives, blocks, timeouts, maximum depth, total blocked time
+         * and, for mutexes, total held time, maximum held time and priority
+         * inheritances.  Queues that are not in the registry are not listed, so
+         * call vQueueGetStatistics() directly to obtain their statistics.
+         *
+         * vQueueListStatistics() has a dependency on the snprintf() C library
+         * function that might bloat the code size, use a lot of stack, and
+         * provide different results on different platforms.
+         */
+
+        /* Make sure the write buffer does not contain a string. */
+        *pcWriteBuffer = ( char ) 0x00;
+
+        /* Note there is nothing here to protect against another task adding or
+         * removing entries from the registry while it is being searched. */
+        for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+        {
+            if( xQueueRegistry[ ux ].pcQueueName != NULL )
+            {
+                vQueueGetStatistics( xQueueRegistry[ ux ].xHandle, &xStatistics );
+
+                /* MISRA Ref 21.6.1 [snprintf for utility] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-216 */
+                /* coverity[misra_c_2012_rule_21_6_violation] */
+                iSnprintfReturnValue = snprintf( &( pcWriteBuffer[ uxConsumedBufferLength ] ),
+                                                 uxBufferLength - uxConsumedBufferLength,
+                                                 "%s\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\r\n",
+                                                 xQueueRegistry[ ux ].pcQueueName,
+                                                 ( unsigned int ) xStatistics.ulSends,
+                                                 ( unsigned int ) xStatistics.ulReceives,
+                                                 ( unsigned int ) xStatistics.ulBlocks,
+                                                 ( unsigned int ) xStatistics.ulTimeouts,
+                                                 ( unsigned int ) xStatistics.xMaxDepth,
+                                                 ( unsigned int ) xStatistics.xTotalBlockedTime,
+                                                 ( unsigned int ) xStatistics.xTotalHeldTime,
+                                                 ( unsigned int ) xStatistics.xMaxHeldTime,
+                                                 ( unsigned int ) xStatistics.ulPriorityInheritances );
+
+                if( ( iSnprintfReturnValue < 0 ) ||
+                    ( ( size_t ) iSnprintfReturnValue >= ( uxBufferLength - uxConsumedBufferLength ) ) )
+                {
+                    /* The line did not fit, so remove the partial line and
+                     * stop. */
+                    pcWriteBuffer[ uxConsumedBufferLength ] = ( char ) 0x00;
+                    break;
+                }
+
+                uxConsumedBufferLength += ( size_t ) iSnprintfReturnValue;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_vQueueListStatistics();
     }
 
-#endif /* configQUEUE_REGISTRY_SIZE */
+#endif /* ( ( configUSE_IPC_STATISTICS == 1 ) && ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TIMERS == 1 )
@@ -3171,6 +7751,37 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_CONDITION_VARIABLES == 1 )
+
+    void vQueueMoveWaitingTasksToMutex( QueueHandle_t xMutex,
+                                        List_t * const pxEventList )
+    {
+        Queue_t * const pxQueue = xMutex;
+        ListItem_t * pxEventListItem;
+
+        traceENTER_vQueueMoveWaitingTasksToMutex( xMutex, pxEventList );
+
+        configASSERT( pxQueue );
+        configASSERT( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX );
+
+        /* This function is not part of the public API.  It is called by
+         * vCondBroadcast() from a critical section to move the tasks blocked on
+         * a condition variable to the list of tasks waiting for the mutex, so
+         * each is unblocked in priority order as the mutex is given.  The tasks
+         * stay in the delayed list, so their block times still apply. */
+        while( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+        {
+            pxEventListItem = listGET_HEAD_ENTRY( pxEventList );
+            ( void ) uxListRemove( pxEventListItem );
+            vListInsert( &( pxQueue->xTasksWaitingToReceive ), pxEventListItem );
+        }
+
+        traceRETURN_vQueueMoveWaitingTasksToMutex();
+    }
+
+#endif /* configUSE_CONDITION_VARIABLES */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
     QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
@@ -3179,8 +7790,30 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
         traceENTER_xQueueCreateSet( uxEventQueueLength );
 
+        #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+        {
+            /* uxEventQueueLength is the maximum number of members, each of
+             * which needs a bit in uxReadyMembers.  The storage holds the
+             * member table rather than queued handles. */
+            configASSERT( uxEventQueueLength <= queueSET_MAX_MEMBERS );
+        }
+        #endif
+
         pxQueue = xQueueGenericCreate( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
 
+        #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+        {
+            if( pxQueue != NULL )
+            {
+                ( void ) memset( ( ( Queue_t * ) pxQueue )->pcHead, 0x00, ( size_t ) uxEventQueueLength * sizeof( Queue_t * ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         traceRETURN_xQueueCreateSet( pxQueue );
 
         return pxQueue;
@@ -3198,7 +7831,20 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
         traceENTER_xQueueAddToSet( xQueueOrSemaphore, xQueueSet );
 
-        taskENTER_CRITICAL();
+        /* SPSC and MPMC queues do not notify a queue set, and the requests
+         * sent to an RPC queue must be received with xQueueReceive(). */
+        queueASSERT_NOT_LOCK_FREE( ( Queue_t * ) xQueueOrSemaphore );
+        queueASSERT_NOT_RPC( ( Queue_t * ) xQueueOrSemaphore );
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            /* A mutex is protected by the kernel critical section, which ranks
+             * above the lock of the queue set it would have to notify. */
+            configASSERT( ( ( Queue_t * ) xQueueOrSemaphore )->uxQueueType != queueQUEUE_IS_MUTEX );
+        }
+        #endif
+
+        queueENTER_CRITICAL( ( Queue_t * ) xQueueOrSemaphore );
         {
             if( ( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer != NULL )
             {
@@ -3213,11 +7859,28 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
             }
             else
             {
-                ( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer = xQueueSet;
-                xReturn = pdPASS;
+                #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+                {
+                    /* Fails if every slot of the member table is in use. */
+                    xReturn = prvClaimQueueSetSlot( ( Queue_t * ) xQueueOrSemaphore, ( Queue_t * ) xQueueSet );
+                }
+                #else
+                {
+                    xReturn = pdPASS;
+                }
+                #endif
+
+                if( xReturn == pdPASS )
+                {
+                    ( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer = xQueueSet;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
         }
-        taskEXIT_CRITICAL();
+        queueEXIT_CRITICAL( ( Queue_t * ) xQueueOrSemaphore );
 
         traceRETURN_xQueueAddToSet( xReturn );
 
@@ -3251,12 +7914,18 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
         }
         else
         {
-            taskENTER_CRITICAL();
+            queueENTER_CRITICAL( pxQueueOrSemaphore );
             {
+                #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+                {
+                    prvReleaseQueueSetSlot( pxQueueOrSemaphore, ( Queue_t * ) xQueueSet );
+                }
+                #endif
+
                 /* The queue is no longer contained in the set. */
                 pxQueueOrSemaphore->pxQueueSetContainer = NULL;
             }
-            taskEXIT_CRITICAL();
+            queueEXIT_CRITICAL( pxQueueOrSemaphore );
             xReturn = pdPASS;
         }
 
@@ -3277,7 +7946,87 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
         traceENTER_xQueueSelectFromSet( xQueueSet, xTicksToWait );
 
-        ( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait );
+        #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+        {
+            Queue_t * const pxQueueSet = ( Queue_t * ) xQueueSet;
+            TickType_t xRemainingTicks = xTicksToWait;
+            TimeOut_t xTimeOut;
+            BaseType_t xEntryTimeSet = pdFALSE;
+
+            configASSERT( pxQueueSet );
+
+            /* Cannot block if the scheduler is suspended. */
+            #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+            {
+                configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+            }
+            #endif
+
+            for( ; ; )
+            {
+                queueENTER_CRITICAL( pxQueueSet );
+                {
+                    xReturn = prvSelectReadyQueueSetMember( pxQueueSet );
+                }
+                queueEXIT_CRITICAL( pxQueueSet );
+
+                if( ( xReturn != NULL ) || ( xRemainingTicks == ( TickType_t ) 0 ) )
+                {
+                    break;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    vTaskSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                vTaskSuspendAll();
+                prvLockQueue( pxQueueSet );
+
+                if( xTaskCheckForTimeOut( &xTimeOut, &xRemainingTicks ) == pdFALSE )
+                {
+                    /* uxMessagesWaiting counts the members with their ready bit
+                     * set, so the task only blocks if no member has become
+                     * ready since the bitmap was checked. */
+                    if( prvIsQueueEmpty( pxQueueSet ) != pdFALSE )
+                    {
+                        traceBLOCKING_ON_QUEUE_RECEIVE( pxQueueSet );
+                        vTaskPlaceOnEventList( &( pxQueueSet->xTasksWaitingToReceive ), xRemainingTicks );
+                        prvUnlockQueue( pxQueueSet );
+
+                        if( xTaskResumeAll() == pdFALSE )
+                        {
+                            taskYIELD_WITHIN_API();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        prvUnlockQueue( pxQueueSet );
+                        ( void ) xTaskResumeAll();
+                    }
+                }
+                else
+                {
+                    /* Check the bitmap once more before giving up. */
+                    prvUnlockQueue( pxQueueSet );
+                    ( void ) xTaskResumeAll();
+                    xRemainingTicks = ( TickType_t ) 0;
+                }
+            }
+        }
+        #else /* if ( configUSE_QUEUE_SET_READY_BITMAP == 1 ) */
+        {
+            ( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait );
+        }
+        #endif /* if ( configUSE_QUEUE_SET_READY_BITMAP == 1 ) */
 
         traceRETURN_xQueueSelectFromSet( xReturn );
 
@@ -3295,7 +8044,23 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
         traceENTER_xQueueSelectFromSetFromISR( xQueueSet );
 
-        ( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL );
+        #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+        {
+            UBaseType_t uxSavedInterruptStatus;
+
+            configASSERT( xQueueSet );
+
+            uxSavedInterruptStatus = ( UBaseType_t ) queueENTER_CRITICAL_FROM_ISR( ( Queue_t * ) xQueueSet );
+            {
+                xReturn = prvSelectReadyQueueSetMember( ( Queue_t * ) xQueueSet );
+            }
+            queueEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, ( Queue_t * ) xQueueSet );
+        }
+        #else
+        {
+            ( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL );
+        }
+        #endif
 
         traceRETURN_xQueueSelectFromSetFromISR( xReturn );
 
@@ -3305,6 +8070,149 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 #endif /* configUSE_QUEUE_SETS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+
+    QueueHandle_t xQueueWaitForAny( const QueueHandle_t * const pxQueues,
+                                    UBaseType_t uxQueueCount,
+                                    TickType_t xTicksToWait )
+    {
+        QueueHandle_t xReturn = NULL;
+        Queue_t * pxQueue;
+        TimeOut_t xTimeOut;
+        BaseType_t xTimedOut = pdFALSE;
+        UBaseType_t uxIndex;
+        TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+
+        traceENTER_xQueueWaitForAny( pxQueues, uxQueueCount, xTicksToWait );
+
+        configASSERT( pxQueues );
+        configASSERT( uxQueueCount > ( UBaseType_t ) 0 );
+
+        /* Cannot block if the scheduler is suspended. */
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        while( ( xReturn == NULL ) && ( xTimedOut == pdFALSE ) )
+        {
+            /* Clear the notification state before the queues are checked, so
+             * data added after a queue has been checked is not missed. */
+            ( void ) xTaskNotifyStateClearIndexed( NULL, configQUEUE_WAIT_FOR_ANY_NOTIFICATION_INDEX );
+
+            /* Each queue that is empty records the calling task, so the next
+             * item added to it notifies the task without the queue being
+             * copied into a queue set. */
+            for( uxIndex = ( UBaseType_t ) 0U; ( uxIndex < uxQueueCount ) && ( xReturn == NULL ); uxIndex++ )
+            {
+                pxQueue = pxQueues[ uxIndex ];
+
+                configASSERT( pxQueue );
+                queueASSERT_NOT_LOCK_FREE( pxQueue );
+
+                queueENTER_CRITICAL( pxQueue );
+                {
+                    /* Only one task at a time can wait for a queue using
+                     * xQueueWaitForAny(). */
+                    configASSERT( ( pxQueue->xTaskWaitingForAny == NULL ) || ( pxQueue->xTaskWaitingForAny == xCurrentTask ) );
+
+                    if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+                    {
+                        xReturn = pxQueue;
+                    }
+                    else
+                    {
+                        pxQueue->xTaskWaitingForAny = xCurrentTask;
+                    }
+                }
+                queueEXIT_CRITICAL( pxQueue );
+            }
+
+            if( xReturn == NULL )
+            {
+                if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_WAIT_FOR_ANY( pxQueues, uxQueueCount );
+                    ( void ) xTaskNotifyWaitIndexed( configQUEUE_WAIT_FOR_ANY_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+                }
+                else
+                {
+                    xTimedOut = pdTRUE;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* Stop the queues notifying the task. */
+        for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxQueueCount; uxIndex++ )
+        {
+            pxQueue = pxQueues[ uxIndex ];
+
+            queueENTER_CRITICAL( pxQueue );
+            {
+                if( pxQueue->xTaskWaitingForAny == xCurrentTask )
+                {
+                    pxQueue->xTaskWaitingForAny = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            queueEXIT_CRITICAL( pxQueue );
+        }
+
+        traceRETURN_xQueueWaitForAny( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_WAIT_FOR_ANY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+
+    static void prvNotifyTaskWaitingForAny( const Queue_t * const pxQueue )
+    {
+        /* This function must be called from a critical section. */
+        if( pxQueue->xTaskWaitingForAny != NULL )
+        {
+            ( void ) xTaskNotifyIndexed( pxQueue->xTaskWaitingForAny, configQUEUE_WAIT_FOR_ANY_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_QUEUE_WAIT_FOR_ANY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_WAIT_FOR_ANY == 1 )
+
+    static void prvNotifyTaskWaitingForAnyFromISR( const Queue_t * const pxQueue,
+                                                   BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        /* This function must be called from a critical section. */
+        if( pxQueue->xTaskWaitingForAny != NULL )
+        {
+            ( void ) xTaskNotifyIndexedFromISR( pxQueue->xTaskWaitingForAny, configQUEUE_WAIT_FOR_ANY_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_QUEUE_WAIT_FOR_ANY */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
     static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue )
@@ -3312,22 +8220,54 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
         Queue_t * pxQueueSetContainer = pxQueue->pxQueueSetContainer;
         BaseType_t xReturn = pdFALSE;
 
+        #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+            const UBaseType_t uxMemberBit = ( UBaseType_t ) 1U << pxQueue->uxQueueSetIndex;
+        #endif
+
         /* This function must be called form a critical section. */
 
         /* The following line is not reachable in unit tests because every call
          * to prvNotifyQueueSetContainer is preceded by a check that
          * pxQueueSetContainer != NULL */
         configASSERT( pxQueueSetContainer ); /* LCOV_EXCL_BR_LINE */
-        configASSERT( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength );
 
-        if( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength )
+        #if ( configUSE_QUEUE_SET_READY_BITMAP == 0 )
+        {
+            configASSERT( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength );
+        }
+        #endif
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            /* The caller holds the lock of the member queue with interrupts
+             * masked, so only the lock of the queue set itself is needed. */
+            portGET_SPINLOCK( ( BaseType_t ) portGET_CORE_ID(), &( pxQueueSetContainer->xQueueLock ) );
+        }
+        #endif
+
+        #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+            /* Only a member that was not already ready wakes a task, as one
+             * select returns the member however many items it holds. */
+            if( ( pxQueueSetContainer->uxReadyMembers & uxMemberBit ) == ( UBaseType_t ) 0U )
+        #else
+            if( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength )
+        #endif
         {
             const int8_t cTxLock = pxQueueSetContainer->cTxLock;
 
             traceQUEUE_SET_SEND( pxQueueSetContainer );
 
-            /* The data copied is the handle of the queue that contains data. */
-            xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
+            #if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+            {
+                pxQueueSetContainer->uxReadyMembers |= uxMemberBit;
+                pxQueueSetContainer->uxMessagesWaiting++;
+            }
+            #else
+            {
+                /* The data copied is the handle of the queue that contains data. */
+                xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
+            }
+            #endif
 
             if( cTxLock == queueUNLOCKED )
             {
@@ -3358,7 +8298,140 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
             mtCOVERAGE_TEST_MARKER();
         }
 
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            portRELEASE_SPINLOCK( ( BaseType_t ) portGET_CORE_ID(), &( pxQueueSetContainer->xQueueLock ) );
+        }
+        #endif
+
         return xReturn;
     }
 
 #endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SET_READY_BITMAP == 1 )
+
+    static BaseType_t prvClaimQueueSetSlot( Queue_t * const pxQueue,
+                                            Queue_t * const pxQueueSet )
+    {
+        /* MISRA Ref 11.3.1 [Misaligned access] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+        /* coverity[misra_c_2012_rule_11_3_violation] */
+        Queue_t ** const ppxMembers = ( Queue_t ** ) pxQueueSet->pcHead;
+        UBaseType_t uxIndex;
+        BaseType_t xReturn = pdFAIL;
+
+        /* This function must be called from a critical section of pxQueue. */
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            portGET_SPINLOCK( ( BaseType_t ) portGET_CORE_ID(), &( pxQueueSet->xQueueLock ) );
+        }
+        #endif
+
+        /* The lowest free slot is used, so members added first have the
+         * highest priority. */
+        for( uxIndex = ( UBaseType_t ) 0U; ( uxIndex < pxQueueSet->uxLength ) && ( xReturn == pdFAIL ); uxIndex++ )
+        {
+            if( ppxMembers[ uxIndex ] == NULL )
+            {
+                ppxMembers[ uxIndex ] = pxQueue;
+                pxQueue->uxQueueSetIndex = uxIndex;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            portRELEASE_SPINLOCK( ( BaseType_t ) portGET_CORE_ID(), &( pxQueueSet->xQueueLock ) );
+        }
+        #endif
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvReleaseQueueSetSlot( const Queue_t * const pxQueue,
+                                        Queue_t * const pxQueueSet )
+    {
+        /* MISRA Ref 11.3.1 [Misaligned access] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+        /* coverity[misra_c_2012_rule_11_3_violation] */
+        Queue_t ** const ppxMembers = ( Queue_t ** ) pxQueueSet->pcHead;
+        const UBaseType_t uxMemberBit = ( UBaseType_t ) 1U << pxQueue->uxQueueSetIndex;
+
+        /* This function must be called from a critical section of pxQueue. */
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            portGET_SPINLOCK( ( BaseType_t ) portGET_CORE_ID(), &( pxQueueSet->xQueueLock ) );
+        }
+        #endif
+
+        ppxMembers[ pxQueue->uxQueueSetIndex ] = NULL;
+
+        /* The queue is empty, but may not have been selected since it was
+         * last emptied, in which case its ready bit is still set. */
+        if( ( pxQueueSet->uxReadyMembers & uxMemberBit ) != ( UBaseType_t ) 0U )
+        {
+            pxQueueSet->uxReadyMembers &= ~uxMemberBit;
+            pxQueueSet->uxMessagesWaiting--;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            portRELEASE_SPINLOCK( ( BaseType_t ) portGET_CORE_ID(), &( pxQueueSet->xQueueLock ) );
+        }
+        #endif
+    }
+/*-----------------------------------------------------------*/
+
+    static Queue_t * prvSelectReadyQueueSetMember( Queue_t * const pxQueueSet )
+    {
+        /* MISRA Ref 11.3.1 [Misaligned access] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+        /* coverity[misra_c_2012_rule_11_3_violation] */
+        Queue_t * const * const ppxMembers = ( Queue_t * const * ) pxQueueSet->pcHead;
+        Queue_t * pxReturn = NULL;
+        UBaseType_t uxIndex;
+        UBaseType_t uxMemberBit;
+
+        /* Ready bits are only cleared here, and when a member is removed, so
+         * receiving from a member does not touch the set.  A member whose bit
+         * is set may since have been emptied, so its item count is checked.
+         * Data is copied into a member before the set is notified, so a
+         * member read as empty here will set its bit again when it next
+         * receives data. */
+        for( uxIndex = ( UBaseType_t ) 0U; ( uxIndex < pxQueueSet->uxLength ) && ( pxQueueSet->uxReadyMembers != ( UBaseType_t ) 0U ) && ( pxReturn == NULL ); uxIndex++ )
+        {
+            uxMemberBit = ( UBaseType_t ) 1U << uxIndex;
+
+            if( ( pxQueueSet->uxReadyMembers & uxMemberBit ) != ( UBaseType_t ) 0U )
+            {
+                if( ppxMembers[ uxIndex ]->uxMessagesWaiting > ( UBaseType_t ) 0U )
+                {
+                    pxReturn = ppxMembers[ uxIndex ];
+                }
+                else
+                {
+                    pxQueueSet->uxReadyMembers &= ~uxMemberBit;
+                    pxQueueSet->uxMessagesWaiting--;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return pxReturn;
+    }
+
+#endif /* configUSE_QUEUE_SET_READY_BITMAP */
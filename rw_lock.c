@@ -0,0 +1,524 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rw_lock.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer lock functionality. This #if is closed at the very
+ * bottom of this file. If you want to include reader-writer locks then ensure
+ * configUSE_RW_LOCKS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_RW_LOCKS == 1 )
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define rwlockYIELD_IF_USING_PREEMPTION()
+    #else
+        #if ( configNUMBER_OF_CORES == 1 )
+            #define rwlockYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+        #else /* #if ( configNUMBER_OF_CORES == 1 ) */
+            #define rwlockYIELD_IF_USING_PREEMPTION()    vTaskYieldWithinAPI()
+        #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
+    #endif
+
+/* A task can take the lock for reading if no task holds it for writing and, so
+ * writers are preferred, no task is waiting to take it for writing. */
+    #define rwlockCAN_READ( pxLock )     ( ( ( pxLock )->xWriter == NULL ) && ( listLIST_IS_EMPTY( &( ( pxLock )->xTasksWaitingToWrite ) ) != pdFALSE ) )
+
+/* A task can take the lock for writing if no other task holds it at all. */
+    #define rwlockCAN_WRITE( pxLock )    ( ( ( pxLock )->xWriter == NULL ) && ( ( pxLock )->uxReaders == ( UBaseType_t ) 0U ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by both xRWLockReadTake() and xRWLockWriteTake() to take the lock,
+ * blocking on the event list that matches xForWriting while it cannot be
+ * taken.
+ */
+    static BaseType_t prvRWLockTake( RWLock_t * const pxLock,
+                                     TickType_t xTicksToWait,
+                                     const BaseType_t xForWriting ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks every task waiting to read.  Returns pdTRUE if any of them has a
+ * priority higher than the calling task.  Must be called from a critical
+ * section.
+ */
+    static BaseType_t prvUnblockAllReaders( RWLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the priority of the highest priority task waiting for the lock,
+ * whether to read or to write, or tskIDLE_PRIORITY if no tasks are waiting.
+ * Must be called from a critical section.
+ */
+    static UBaseType_t prvGetHighestPriorityOfLockWaiters( const RWLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    void vRWLockInit( RWLock_t * pxLock )
+    {
+        traceENTER_vRWLockInit( pxLock );
+
+        configASSERT( pxLock );
+
+        pxLock->xWriter = NULL;
+        pxLock->uxReaders = ( UBaseType_t ) 0U;
+        vListInitialise( &( pxLock->xTasksWaitingToRead ) );
+        vListInitialise( &( pxLock->xTasksWaitingToWrite ) );
+
+        traceRETURN_vRWLockInit();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockReadTake( RWLock_t * pxLock,
+                                TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xRWLockReadTake( pxLock, xTicksToWait );
+
+        xReturn = prvRWLockTake( pxLock, xTicksToWait, pdFALSE );
+
+        traceRETURN_xRWLockReadTake( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockWriteTake( RWLock_t * pxLock,
+                                 TickType_t xTicksToWait )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xRWLockWriteTake( pxLock, xTicksToWait );
+
+        xReturn = prvRWLockTake( pxLock, xTicksToWait, pdTRUE );
+
+        traceRETURN_xRWLockWriteTake( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockReadGive( RWLock_t * pxLock )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xRWLockReadGive( pxLock );
+
+        configASSERT( pxLock );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxLock->uxReaders > ( UBaseType_t ) 0U )
+            {
+                ( pxLock->uxReaders )--;
+
+                /* The last reader to give the lock lets the highest priority
+                 * waiting writer, if any, take it. */
+                if( ( pxLock->uxReaders == ( UBaseType_t ) 0U ) &&
+                    ( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) == pdFALSE ) )
+                {
+                    if( xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToWrite ) ) != pdFALSE )
+                    {
+                        rwlockYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        configASSERT( xReturn == pdPASS );
+
+        traceRETURN_xRWLockReadGive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockWriteGive( RWLock_t * pxLock )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xRWLockWriteGive( pxLock );
+
+        configASSERT( pxLock );
+
+        taskENTER_CRITICAL();
+        {
+            /* Only the task holding the lock for writing can give it. */
+            if( pxLock->xWriter == xTaskGetCurrentTaskHandle() )
+            {
+                /* Decrement the count of held mutexes and return to the base
+                 * priority if a priority was inherited and no other mutexes are
+                 * held. */
+                xYieldRequired = xTaskPriorityDisinherit( pxLock->xWriter );
+                pxLock->xWriter = NULL;
+
+                /* Writers are preferred, so the highest priority waiting
+                 * writer is unblocked if there is one.  Otherwise all the
+                 * waiting readers can share the lock. */
+                if( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToWrite ) ) != pdFALSE )
+                    {
+                        xYieldRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else if( prvUnblockAllReaders( pxLock ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xYieldRequired != pdFALSE )
+                {
+                    rwlockYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        configASSERT( xReturn == pdPASS );
+
+        traceRETURN_xRWLockWriteGive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvRWLockTake( RWLock_t * const pxLock,
+                                     TickType_t xTicksToWait,
+                                     const BaseType_t xForWriting )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xEntryTimeSet = pdFALSE;
+        BaseType_t xInheritanceOccurred = pdFALSE;
+        BaseType_t xTakeAttemptComplete = pdFALSE;
+        BaseType_t xCanTake;
+        TimeOut_t xTimeOut;
+        List_t * const pxEventList = ( xForWriting != pdFALSE ) ? &( pxLock->xTasksWaitingToWrite ) : &( pxLock->xTasksWaitingToRead );
+
+        configASSERT( pxLock );
+
+        /* A reader-writer lock cannot be taken for writing recursively, and a
+         * task holding it for writing cannot also take it for reading. */
+        configASSERT( pxLock->xWriter != xTaskGetCurrentTaskHandle() );
+
+        /* Cannot block if the scheduler is suspended. */
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        for( ; ; )
+        {
+            /* The fast path.  Reader-writer locks are not used from interrupts,
+             * so a short critical section is all that is needed to take a lock
+             * that is available. */
+            taskENTER_CRITICAL();
+            {
+                if( xForWriting != pdFALSE )
+                {
+                    xCanTake = rwlockCAN_WRITE( pxLock );
+                }
+                else
+                {
+                    xCanTake = rwlockCAN_READ( pxLock );
+                }
+
+                if( xCanTake != pdFALSE )
+                {
+                    if( xForWriting != pdFALSE )
+                    {
+                        /* Record the writer and increment its count of held
+                         * mutexes, so it takes part in priority inheritance as
+                         * for a standard mutex. */
+                        pxLock->xWriter = pvTaskIncrementMutexHeldCount();
+                    }
+                    else
+                    {
+                        ( pxLock->uxReaders )++;
+                    }
+
+                    xReturn = pdPASS;
+                    xTakeAttemptComplete = pdTRUE;
+                }
+                else if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The lock cannot be taken and no block time is specified
+                     * (or the block time has expired) so exit now. */
+                    xTakeAttemptComplete = pdTRUE;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The lock cannot be taken and a block time was specified
+                     * so configure the timeout structure ready to block. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xTakeAttemptComplete != pdFALSE )
+            {
+                break;
+            }
+
+            /* The slow path.  Other tasks cannot take or give the lock while
+             * the scheduler is suspended. */
+            vTaskSuspendAll();
+
+            if( xForWriting != pdFALSE )
+            {
+                xCanTake = rwlockCAN_WRITE( pxLock );
+            }
+            else
+            {
+                xCanTake = rwlockCAN_READ( pxLock );
+            }
+
+            /* Update the timeout state to see if it has expired yet. */
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+            {
+                if( xCanTake == pdFALSE )
+                {
+                    traceBLOCKING_ON_RW_LOCK_TAKE( pxLock, xForWriting );
+
+                    /* Only a writer can inherit a priority, as the tasks
+                     * holding the lock for reading are not tracked. */
+                    if( pxLock->xWriter != NULL )
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            if( xTaskPriorityInherit( pxLock->xWriter ) != pdFALSE )
+                            {
+                                xInheritanceOccurred = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+
+                    if( xTaskResumeAll() == pdFALSE )
+                    {
+                        taskYIELD_WITHIN_API();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    /* The lock became available before the scheduler was
+                     * suspended, so attempt to take it again. */
+                    ( void ) xTaskResumeAll();
+                }
+            }
+            else
+            {
+                /* Timed out.  Return to attempt to take the lock one last time
+                 * with xTicksToWait now 0. */
+                ( void ) xTaskResumeAll();
+            }
+        }
+
+        if( xReturn == pdFAIL )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( xInheritanceOccurred != pdFALSE )
+                {
+                    /* This task blocking on the lock caused the writer to
+                     * inherit this task's priority.  Now this task has timed
+                     * out the priority should be disinherited again, but only
+                     * as low as the next highest priority task that is waiting
+                     * for the same lock. */
+                    vTaskPriorityDisinheritAfterTimeout( pxLock->xWriter, prvGetHighestPriorityOfLockWaiters( pxLock ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Readers wait while a writer is waiting.  If this was the last
+                 * waiting writer and no task holds the lock for writing, the
+                 * readers it was holding back can now take the lock. */
+                if( ( xForWriting != pdFALSE ) && ( rwlockCAN_READ( pxLock ) != pdFALSE ) )
+                {
+                    if( prvUnblockAllReaders( pxLock ) != pdFALSE )
+                    {
+                        rwlockYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvUnblockAllReaders( RWLock_t * const pxLock )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        while( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToRead ) ) == pdFALSE )
+        {
+            if( xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToRead ) ) != pdFALSE )
+            {
+                xHigherPriorityTaskWoken = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xHigherPriorityTaskWoken;
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvGetHighestPriorityOfLockWaiters( const RWLock_t * const pxLock )
+    {
+        UBaseType_t uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+        UBaseType_t uxPriority;
+
+        /* The priority of the highest priority task waiting on each event list
+         * is stored as configMAX_PRIORITIES less that priority in the head
+         * entry of the list. */
+        if( listCURRENT_LIST_LENGTH( &( pxLock->xTasksWaitingToWrite ) ) > 0U )
+        {
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxLock->xTasksWaitingToWrite ) ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( listCURRENT_LIST_LENGTH( &( pxLock->xTasksWaitingToRead ) ) > 0U )
+        {
+            uxPriority = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxLock->xTasksWaitingToRead ) ) );
+
+            if( uxPriority > uxHighestPriorityOfWaitingTasks )
+            {
+                uxHighestPriorityOfWaitingTasks = uxPriority;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return uxHighestPriorityOfWaitingTasks;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer lock functionality. If you want to include
+ * reader-writer locks then ensure configUSE_RW_LOCKS is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_RW_LOCKS == 1 */
@@ -0,0 +1,341 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "softirq.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include softirq functionality. This #if is closed at the very bottom of
+ * this file. If you want to include softirqs then ensure configUSE_SOFTIRQS is
+ * set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_SOFTIRQS == 1 )
+
+/* The name given to each softirq task. */
+    #define softirqTASK_NAME    "SIRQ"
+
+/* The handler of one softirq. */
+    typedef struct SoftIRQDef_t
+    {
+        SoftIRQHandlerFunction_t pxFunction;
+        void * pvParameter;
+    } SoftIRQ_t;
+
+/*-----------------------------------------------------------*/
+
+/* The handler of each softirq, or NULL if none has been registered. */
+    PRIVILEGED_DATA static SoftIRQ_t xSoftIRQs[ configSOFTIRQ_COUNT ];
+
+/* The softirqs raised on each core that its softirq task has not started to
+ * run yet, one bit per softirq.  Only accessed from critical sections. */
+    PRIVILEGED_DATA static volatile uint32_t ulPendingSoftIRQs[ configNUMBER_OF_CORES ] = { 0U };
+
+/* The softirq task of each core, or NULL until the first softirq is
+ * registered. */
+    PRIVILEGED_DATA static TaskHandle_t xSoftIRQTasks[ configNUMBER_OF_CORES ] = { NULL };
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The softirq task of one core.  Runs the handlers of the softirqs raised on
+ * its core, then waits for more to be raised.
+ */
+    static portTASK_FUNCTION_PROTO( prvSoftIRQTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Creates the softirq task of each core if they do not exist yet.  Returns
+ * pdPASS if they exist on return.
+ */
+    static BaseType_t prvCreateSoftIRQTasks( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Marks uxSoftIRQ pending on the calling core and returns the task that runs
+ * it, or NULL if it was already pending.  Must be called from a critical
+ * section.
+ */
+    static TaskHandle_t prvMarkPending( UBaseType_t uxSoftIRQ ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    BaseType_t xSoftIRQRegister( UBaseType_t uxSoftIRQ,
+                                 SoftIRQHandlerFunction_t pxFunction,
+                                 void * pvParameter )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xSoftIRQRegister( uxSoftIRQ, pxFunction, pvParameter );
+
+        configASSERT( uxSoftIRQ < ( UBaseType_t ) configSOFTIRQ_COUNT );
+        configASSERT( pxFunction );
+
+        if( uxSoftIRQ < ( UBaseType_t ) configSOFTIRQ_COUNT )
+        {
+            xReturn = prvCreateSoftIRQTasks();
+
+            if( xReturn == pdPASS )
+            {
+                taskENTER_CRITICAL();
+                {
+                    xSoftIRQs[ uxSoftIRQ ].pvParameter = pvParameter;
+                    xSoftIRQs[ uxSoftIRQ ].pxFunction = pxFunction;
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xSoftIRQRegister( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vSoftIRQRaise( UBaseType_t uxSoftIRQ )
+    {
+        TaskHandle_t xTaskToWake;
+
+        traceENTER_vSoftIRQRaise( uxSoftIRQ );
+
+        configASSERT( uxSoftIRQ < ( UBaseType_t ) configSOFTIRQ_COUNT );
+
+        /* The calling task cannot move to another core while it is in the
+         * critical section. */
+        taskENTER_CRITICAL();
+        {
+            xTaskToWake = prvMarkPending( uxSoftIRQ );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xTaskToWake != NULL )
+        {
+            ( void ) xTaskNotifyGive( xTaskToWake );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vSoftIRQRaise();
+    }
+/*-----------------------------------------------------------*/
+
+    void vSoftIRQRaiseFromISR( UBaseType_t uxSoftIRQ,
+                               BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        TaskHandle_t xTaskToWake;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_vSoftIRQRaiseFromISR( uxSoftIRQ, pxHigherPriorityTaskWoken );
+
+        configASSERT( uxSoftIRQ < ( UBaseType_t ) configSOFTIRQ_COUNT );
+
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            xTaskToWake = prvMarkPending( uxSoftIRQ );
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        if( xTaskToWake != NULL )
+        {
+            vTaskNotifyGiveFromISR( xTaskToWake, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vSoftIRQRaiseFromISR();
+    }
+/*-----------------------------------------------------------*/
+
+    static TaskHandle_t prvMarkPending( UBaseType_t uxSoftIRQ )
+    {
+        TaskHandle_t xTaskToWake = NULL;
+        const uint32_t ulBit = ( uint32_t ) 1U << uxSoftIRQ;
+        BaseType_t xCoreID;
+
+        #if ( configNUMBER_OF_CORES > 1 )
+        {
+            xCoreID = ( BaseType_t ) portGET_CORE_ID();
+        }
+        #else
+        {
+            xCoreID = 0;
+        }
+        #endif
+
+        /* A softirq must be registered before it is raised. */
+        configASSERT( xSoftIRQTasks[ xCoreID ] != NULL );
+
+        if( ( ulPendingSoftIRQs[ xCoreID ] & ulBit ) == 0U )
+        {
+            /* Only the first softirq raised since the task last took the
+             * pending bits needs to wake it. */
+            if( ulPendingSoftIRQs[ xCoreID ] == 0U )
+            {
+                xTaskToWake = xSoftIRQTasks[ xCoreID ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            ulPendingSoftIRQs[ xCoreID ] |= ulBit;
+            traceSOFTIRQ_RAISE( uxSoftIRQ, xCoreID );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xTaskToWake;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCreateSoftIRQTasks( void )
+    {
+        BaseType_t xReturn = pdPASS;
+        BaseType_t xCoreID;
+        TaskHandle_t xTask;
+
+        /* Stop two tasks creating the softirq tasks at the same time.  The
+         * softirq tasks do not run until the scheduler is resumed, even though
+         * their priority is above that of the calling task. */
+        vTaskSuspendAll();
+        {
+            for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+            {
+                if( xSoftIRQTasks[ xCoreID ] == NULL )
+                {
+                    if( xTaskCreate( prvSoftIRQTask,
+                                     softirqTASK_NAME,
+                                     configSOFTIRQ_TASK_STACK_DEPTH,
+                                     ( void * ) &( ulPendingSoftIRQs[ xCoreID ] ),
+                                     configSOFTIRQ_TASK_PRIORITY,
+                                     &xTask ) == pdPASS )
+                    {
+                        /* Keep each task on its own core so the handlers run
+                         * on the core that raised them, while their data is
+                         * still in its cache. */
+                        #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+                        {
+                            vTaskCoreAffinitySet( xTask, ( UBaseType_t ) 1U << ( UBaseType_t ) xCoreID );
+                        }
+                        #endif
+
+                        xSoftIRQTasks[ xCoreID ] = xTask;
+                    }
+                    else
+                    {
+                        xReturn = pdFAIL;
+                        break;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvSoftIRQTask, pvParameters )
+    {
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        volatile uint32_t * const pulPending = ( volatile uint32_t * ) pvParameters;
+        uint32_t ulPending;
+        UBaseType_t uxSoftIRQ;
+
+        for( ; ; )
+        {
+            ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+            /* Take all the pending bits at once, so softirqs raised while the
+             * handlers run are run in the next pass, rather than a softirq
+             * with a low number starving those after it. */
+            for( ; ; )
+            {
+                taskENTER_CRITICAL();
+                {
+                    ulPending = *pulPending;
+                    *pulPending = 0U;
+                }
+                taskEXIT_CRITICAL();
+
+                if( ulPending == 0U )
+                {
+                    break;
+                }
+
+                for( uxSoftIRQ = 0; ulPending != 0U; uxSoftIRQ++ )
+                {
+                    if( ( ulPending & 1U ) != 0U )
+                    {
+                        traceSOFTIRQ_RUN( uxSoftIRQ );
+                        xSoftIRQs[ uxSoftIRQ ].pxFunction( xSoftIRQs[ uxSoftIRQ ].pvParameter );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    ulPending >>= 1U;
+                }
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include softirq functionality. If you want to include softirqs then ensure
+ * configUSE_SOFTIRQS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_SOFTIRQS == 1 */
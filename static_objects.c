@@ -0,0 +1,88 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "static_objects.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include statically declared objects. This #if is closed at the very
+ * bottom of this file. If you want to include statically declared objects then
+ * ensure configUSE_STATIC_OBJECTS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_STATIC_OBJECTS == 1 )
+
+    BaseType_t xStaticObjectsCreate( const StaticObject_t * pxObjects,
+                                     UBaseType_t uxObjectCount )
+    {
+        BaseType_t xReturn = pdPASS;
+        UBaseType_t uxObject;
+
+        traceENTER_xStaticObjectsCreate( pxObjects, uxObjectCount );
+
+        configASSERT( ( pxObjects != NULL ) || ( uxObjectCount == 0U ) );
+
+        for( uxObject = 0U; uxObject < uxObjectCount; uxObject++ )
+        {
+            configASSERT( pxObjects[ uxObject ].pxCreate != NULL );
+
+            if( pxObjects[ uxObject ].pxCreate() != pdPASS )
+            {
+                /* Static creation only fails if the configuration or the
+                 * object's parameters are invalid, so stop at the first
+                 * failure rather than leave a partially created system
+                 * running with objects missing from the middle of it. */
+                xReturn = pdFAIL;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_xStaticObjectsCreate( xReturn );
+
+        return xReturn;
+    }
+
+/* This entire source file will be skipped if the application is not configured
+ * to include statically declared objects. If you want to include statically
+ * declared objects then ensure configUSE_STATIC_OBJECTS is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_STATIC_OBJECTS == 1 */
@@ -58,9 +58,103 @@
         #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build stream_buffer.c
     #endif
 
+    #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+        #if ( ( ( configSTREAM_BUFFER_STORAGE_ALIGNMENT % portBYTE_ALIGNMENT ) != 0 ) || \
+        ( ( configSTREAM_BUFFER_STORAGE_ALIGNMENT & ( configSTREAM_BUFFER_STORAGE_ALIGNMENT - 1 ) ) != 0 ) )
+            #error configSTREAM_BUFFER_STORAGE_ALIGNMENT must be a power of two multiple of portBYTE_ALIGNMENT
+        #endif
+    #endif
+
+/* Macros to mark the start and end of a critical section that accesses the
+ * members of a stream buffer. */
+    #define sbENTER_CRITICAL( pxStreamBuffer )                                 taskDATA_GROUP_ENTER_CRITICAL( &( ( pxStreamBuffer )->xStreamBufferLock ) )
+    #define sbEXIT_CRITICAL( pxStreamBuffer )                                  taskDATA_GROUP_EXIT_CRITICAL( &( ( pxStreamBuffer )->xStreamBufferLock ) )
+    #define sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer )                        taskDATA_GROUP_ENTER_CRITICAL_FROM_ISR( &( ( pxStreamBuffer )->xStreamBufferLock ) )
+    #define sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer ) taskDATA_GROUP_EXIT_CRITICAL_FROM_ISR( ( uxSavedInterruptStatus ), &( ( pxStreamBuffer )->xStreamBufferLock ) )
+
+/* Macros that update the statistics gathered when configUSE_IPC_STATISTICS is
+ * 1.  A stream buffer has a single writer and a single reader, so the send
+ * counters are only updated by the writer and the receive counter only by the
+ * reader, neither of which need a critical section.  The writers of a
+ * multi-producer stream buffer can race on the send counters, which are then
+ * approximate.  The receive counter of a broadcast stream buffer is updated
+ * from the critical section that moves the reader's tail.  Blocking is shared between the writer and the reader so is
+ * recorded by prvWaitForNotification() from a critical section. */
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        #define sbSTATS_SENT( pxStreamBuffer, xBytes )                    \
+    do                                                                    \
+    {                                                                     \
+        if( ( xBytes ) > ( size_t ) 0 )                                   \
+        {                                                                 \
+            const size_t xBytesHeld = prvBytesInBuffer( pxStreamBuffer ); \
+                                                                          \
+            ( pxStreamBuffer )->xStatistics.ulSends++;                    \
+                                                                          \
+            if( xBytesHeld > ( pxStreamBuffer )->xStatistics.xMaxDepth )  \
+            {                                                             \
+                ( pxStreamBuffer )->xStatistics.xMaxDepth = xBytesHeld;   \
+            }                                                             \
+        }                                                                 \
+    } while( 0 )
+        #define sbSTATS_RECEIVED( pxStreamBuffer, xBytes ) \
+    do                                                     \
+    {                                                      \
+        if( ( xBytes ) > ( size_t ) 0 )                    \
+        {                                                  \
+            ( pxStreamBuffer )->xStatistics.ulReceives++;  \
+        }                                                  \
+    } while( 0 )
+        #define sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToWait )    prvWaitForNotification( ( pxStreamBuffer ), ( xTicksToWait ) )
+    #else
+        #define sbSTATS_SENT( pxStreamBuffer, xBytes )
+        #define sbSTATS_RECEIVED( pxStreamBuffer, xBytes )
+        #define sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToWait )    ( void ) xTaskNotifyWaitIndexed( ( pxStreamBuffer )->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, ( xTicksToWait ) )
+    #endif /* configUSE_IPC_STATISTICS */
+
+/* The task waiting on an inter-processor message buffer was blocked by the
+ * kernel on the other processor, so it cannot be notified from this one.  The
+ * completed macros and callbacks are skipped for such a buffer, and the AMP
+ * message channel that owns it rings a doorbell instead.  The barrier orders
+ * the accesses to the storage area with the update of the head or tail that
+ * publishes them to the other processor. */
+    #if ( configUSE_AMP_MESSAGE_BUFFERS == 1 )
+        #define sbIS_INTERPROCESSOR( pxStreamBuffer ) \
+    ( ( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_INTERPROCESSOR ) != ( uint8_t ) 0 ) ? pdTRUE : pdFALSE )
+        #define sbINTERPROCESSOR_BARRIER()    configAMP_MEMORY_BARRIER()
+    #else
+        #define sbIS_INTERPROCESSOR( pxStreamBuffer )    ( pdFALSE )
+        #define sbINTERPROCESSOR_BARRIER()
+    #endif /* configUSE_AMP_MESSAGE_BUFFERS */
+
 /* If the user has not provided application specific Rx notification macros,
  * or #defined the notification macros away, then provide default implementations
  * that uses task notifications. */
+    #if ( ( configUSE_GRANULAR_LOCKS == 1 ) && !defined( sbRECEIVE_COMPLETED ) )
+
+/* The waiting task is notified after the stream buffer lock is released, as
+ * sending a notification enters the kernel critical section. */
+        #define sbRECEIVE_COMPLETED( pxStreamBuffer )                                    \
+    do                                                                                   \
+    {                                                                                    \
+        TaskHandle_t xTaskToNotify;                                                      \
+                                                                                         \
+        sbENTER_CRITICAL( pxStreamBuffer );                                              \
+        {                                                                                \
+            xTaskToNotify = ( pxStreamBuffer )->xTaskWaitingToSend;                      \
+            ( pxStreamBuffer )->xTaskWaitingToSend = NULL;                               \
+        }                                                                                \
+        sbEXIT_CRITICAL( pxStreamBuffer );                                               \
+                                                                                         \
+        if( xTaskToNotify != NULL )                                                      \
+        {                                                                                \
+            ( void ) xTaskNotifyIndexed( xTaskToNotify,                                  \
+                                         ( pxStreamBuffer )->uxNotificationIndex,        \
+                                         ( uint32_t ) 0,                                 \
+                                         eNoAction );                                    \
+        }                                                                                \
+    } while( 0 )
+    #endif /* if ( ( configUSE_GRANULAR_LOCKS == 1 ) && !defined( sbRECEIVE_COMPLETED ) ) */
+
     #ifndef sbRECEIVE_COMPLETED
         #define sbRECEIVE_COMPLETED( pxStreamBuffer )                                 \
     do                                                                                \
@@ -90,22 +184,28 @@
         {                                                                                        \
             ( pxStreamBuffer )->pxReceiveCompletedCallback( ( pxStreamBuffer ), pdFALSE, NULL ); \
         }                                                                                        \
-        else                                                                                     \
+        else if( sbIS_INTERPROCESSOR( pxStreamBuffer ) == pdFALSE )                             \
         {                                                                                        \
             sbRECEIVE_COMPLETED( ( pxStreamBuffer ) );                                           \
         }                                                                                        \
     } while( 0 )
     #else /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
-        #define prvRECEIVE_COMPLETED( pxStreamBuffer )    sbRECEIVE_COMPLETED( ( pxStreamBuffer ) )
+        #define prvRECEIVE_COMPLETED( pxStreamBuffer )                \
+    do {                                                              \
+        if( sbIS_INTERPROCESSOR( pxStreamBuffer ) == pdFALSE )        \
+        {                                                             \
+            sbRECEIVE_COMPLETED( ( pxStreamBuffer ) );                \
+        }                                                             \
+    } while( 0 )
     #endif /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
 
     #ifndef sbRECEIVE_COMPLETED_FROM_ISR
         #define sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer,                                \
                                               pxHigherPriorityTaskWoken )                    \
     do {                                                                                     \
-        UBaseType_t uxSavedInterruptStatus;                                                  \
+        UBaseType_t uxSavedCompletedStatus;                                                  \
                                                                                              \
-        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();                              \
+        uxSavedCompletedStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );               \
         {                                                                                    \
             if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )                             \
             {                                                                                \
@@ -117,7 +217,7 @@
                 ( pxStreamBuffer )->xTaskWaitingToSend = NULL;                               \
             }                                                                                \
         }                                                                                    \
-        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );                                \
+        sbEXIT_CRITICAL_FROM_ISR( uxSavedCompletedStatus, pxStreamBuffer );                  \
     } while( 0 )
     #endif /* sbRECEIVE_COMPLETED_FROM_ISR */
 
@@ -129,20 +229,48 @@
         {                                                                                                                \
             ( pxStreamBuffer )->pxReceiveCompletedCallback( ( pxStreamBuffer ), pdTRUE, ( pxHigherPriorityTaskWoken ) ); \
         }                                                                                                                \
-        else                                                                                                             \
+        else if( sbIS_INTERPROCESSOR( pxStreamBuffer ) == pdFALSE )                                                     \
         {                                                                                                                \
             sbRECEIVE_COMPLETED_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) );                           \
         }                                                                                                                \
     } while( 0 )
     #else /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
-        #define prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) \
-    sbRECEIVE_COMPLETED_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) )
+        #define prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )           \
+    do {                                                                                             \
+        if( sbIS_INTERPROCESSOR( pxStreamBuffer ) == pdFALSE )                                       \
+        {                                                                                            \
+            sbRECEIVE_COMPLETED_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) );       \
+        }                                                                                            \
+    } while( 0 )
     #endif /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
 
 /* If the user has not provided an application specific Tx notification macro,
  * or #defined the notification macro away, then provide a default
  * implementation that uses task notifications.
  */
+    #if ( ( configUSE_GRANULAR_LOCKS == 1 ) && !defined( sbSEND_COMPLETED ) )
+        #define sbSEND_COMPLETED( pxStreamBuffer )                                       \
+    do                                                                                   \
+    {                                                                                    \
+        TaskHandle_t xTaskToNotify;                                                      \
+                                                                                         \
+        sbENTER_CRITICAL( pxStreamBuffer );                                              \
+        {                                                                                \
+            xTaskToNotify = ( pxStreamBuffer )->xTaskWaitingToReceive;                   \
+            ( pxStreamBuffer )->xTaskWaitingToReceive = NULL;                            \
+        }                                                                                \
+        sbEXIT_CRITICAL( pxStreamBuffer );                                               \
+                                                                                         \
+        if( xTaskToNotify != NULL )                                                      \
+        {                                                                                \
+            ( void ) xTaskNotifyIndexed( xTaskToNotify,                                  \
+                                         ( pxStreamBuffer )->uxNotificationIndex,        \
+                                         ( uint32_t ) 0,                                 \
+                                         eNoAction );                                    \
+        }                                                                                \
+    } while( 0 )
+    #endif /* if ( ( configUSE_GRANULAR_LOCKS == 1 ) && !defined( sbSEND_COMPLETED ) ) */
+
     #ifndef sbSEND_COMPLETED
         #define sbSEND_COMPLETED( pxStreamBuffer )                                  \
     vTaskSuspendAll();                                                              \
@@ -169,22 +297,28 @@
         {                                                                                     \
             ( pxStreamBuffer )->pxSendCompletedCallback( ( pxStreamBuffer ), pdFALSE, NULL ); \
         }                                                                                     \
-        else                                                                                  \
+        else if( sbIS_INTERPROCESSOR( pxStreamBuffer ) == pdFALSE )                          \
         {                                                                                     \
             sbSEND_COMPLETED( ( pxStreamBuffer ) );                                           \
         }                                                                                     \
     } while( 0 )
     #else /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
-        #define prvSEND_COMPLETED( pxStreamBuffer )    sbSEND_COMPLETED( ( pxStreamBuffer ) )
+        #define prvSEND_COMPLETED( pxStreamBuffer )                   \
+    do {                                                              \
+        if( sbIS_INTERPROCESSOR( pxStreamBuffer ) == pdFALSE )        \
+        {                                                             \
+            sbSEND_COMPLETED( ( pxStreamBuffer ) );                   \
+        }                                                             \
+    } while( 0 )
     #endif /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
 
 
     #ifndef sbSEND_COMPLETE_FROM_ISR
         #define sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )          \
     do {                                                                                       \
-        UBaseType_t uxSavedInterruptStatus;                                                    \
+        UBaseType_t uxSavedCompletedStatus;                                                    \
                                                                                                \
-        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();                                \
+        uxSavedCompletedStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );                 \
         {                                                                                      \
             if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )                            \
             {                                                                                  \
@@ -196,7 +330,7 @@
                 ( pxStreamBuffer )->xTaskWaitingToReceive = NULL;                              \
             }                                                                                  \
         }                                                                                      \
-        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );                                  \
+        sbEXIT_CRITICAL_FROM_ISR( uxSavedCompletedStatus, pxStreamBuffer );                    \
     } while( 0 )
     #endif /* sbSEND_COMPLETE_FROM_ISR */
 
@@ -208,26 +342,214 @@
         {                                                                                                             \
             ( pxStreamBuffer )->pxSendCompletedCallback( ( pxStreamBuffer ), pdTRUE, ( pxHigherPriorityTaskWoken ) ); \
         }                                                                                                             \
-        else                                                                                                          \
+        else if( sbIS_INTERPROCESSOR( pxStreamBuffer ) == pdFALSE )                                                  \
         {                                                                                                             \
             sbSEND_COMPLETE_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) );                            \
         }                                                                                                             \
     } while( 0 )
     #else /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
-        #define prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) \
-    sbSEND_COMPLETE_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) )
+        #define prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )          \
+    do {                                                                                        \
+        if( sbIS_INTERPROCESSOR( pxStreamBuffer ) == pdFALSE )                                  \
+        {                                                                                       \
+            sbSEND_COMPLETE_FROM_ISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) );      \
+        }                                                                                       \
+    } while( 0 )
     #endif /* if ( configUSE_SB_COMPLETED_CALLBACK == 1 ) */
 
-/* The number of bytes used to hold the length of a message in the buffer. */
-    #define sbBYTES_TO_STORE_MESSAGE_LENGTH    ( sizeof( configMESSAGE_BUFFER_LENGTH_TYPE ) )
+/* Each reader of a broadcast stream buffer has its own waiting task, which is
+ * unblocked in addition to calling the send completed macro or callback. */
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+        #define prvBROADCAST_SEND_COMPLETED( pxStreamBuffer )    prvNotifyBroadcastReaders( pxStreamBuffer )
+        #define prvBROADCAST_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) \
+    prvNotifyBroadcastReadersFromISR( ( pxStreamBuffer ), ( pxHigherPriorityTaskWoken ) )
+        #define sbBROADCAST_READER_IS_WAITING( pxStreamBuffer )    prvBroadcastReaderIsWaiting( pxStreamBuffer )
+        #define sbASSERT_NOT_BROADCAST( pxStreamBuffer )           configASSERT( ( pxStreamBuffer )->pxReaders == NULL )
+        #define sbIS_BROADCAST( pxStreamBuffer )                   ( ( ( pxStreamBuffer )->pxReaders != NULL ) ? pdTRUE : pdFALSE )
+    #else
+        #define prvBROADCAST_SEND_COMPLETED( pxStreamBuffer )
+        #define prvBROADCAST_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )
+        #define sbBROADCAST_READER_IS_WAITING( pxStreamBuffer )    ( pdFALSE )
+        #define sbASSERT_NOT_BROADCAST( pxStreamBuffer )
+        #define sbIS_BROADCAST( pxStreamBuffer )                   ( pdFALSE )
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+
+/* Only message buffers with a single writer and a single reader on this
+ * processor carry latency tags, as the tags are matched to the messages by
+ * the order in which they are written and read. */
+    #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        #define sbCARRIES_TAGS( pxStreamBuffer )                                                                                                       \
+    ( ( ( ( pxStreamBuffer )->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER | sbFLAGS_IS_INTERPROCESSOR ) ) == sbFLAGS_IS_MESSAGE_BUFFER ) && \
+      ( sbIS_BROADCAST( pxStreamBuffer ) == pdFALSE ) )
+    #endif
+
+/* Data written to a pipeline stream buffer is first passed to stage 0, and
+ * only the bytes committed by the last stage can be read, so the reader's
+ * readable head is the last stage's head rather than xHead. */
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+        #define prvPIPELINE_SEND_COMPLETED( pxStreamBuffer )          \
+    do {                                                              \
+        if( ( pxStreamBuffer )->pxStages != NULL )                    \
+        {                                                             \
+            prvNotifyStage( ( pxStreamBuffer ), ( UBaseType_t ) 0U ); \
+        }                                                             \
+    } while( 0 )
+        #define prvPIPELINE_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )             \
+    do {                                                                                                    \
+        if( ( pxStreamBuffer )->pxStages != NULL )                                                          \
+        {                                                                                                   \
+            prvNotifyStageFromISR( ( pxStreamBuffer ), ( UBaseType_t ) 0U, ( pxHigherPriorityTaskWoken ) ); \
+        }                                                                                                   \
+    } while( 0 )
+        #define sbREADABLE_HEAD( pxStreamBuffer ) \
+    ( ( ( pxStreamBuffer )->pxStages != NULL ) ? ( pxStreamBuffer )->pxStages[ ( pxStreamBuffer )->uxStageCount - ( UBaseType_t ) 1U ].xHead : ( pxStreamBuffer )->xHead )
+        #define sbSTAGE_IS_WAITING( pxStreamBuffer )    prvStageIsWaiting( pxStreamBuffer )
+    #else
+        #define prvPIPELINE_SEND_COMPLETED( pxStreamBuffer )
+        #define prvPIPELINE_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )
+        #define sbREADABLE_HEAD( pxStreamBuffer )       ( ( pxStreamBuffer )->xHead )
+        #define sbSTAGE_IS_WAITING( pxStreamBuffer )    ( pdFALSE )
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
+
+/* A write that puts the first bytes into an empty stream buffer starts the
+ * maximum latency period set by xStreamBufferSetMaxLatency(). */
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        #define prvSTART_LATENCY_PERIOD( pxStreamBuffer, xBytesWritten )    prvStartLatencyPeriod( ( pxStreamBuffer ), ( xBytesWritten ) )
+        #define prvSTART_LATENCY_PERIOD_FROM_ISR( pxStreamBuffer, xBytesWritten, pxHigherPriorityTaskWoken ) \
+    prvStartLatencyPeriodFromISR( ( pxStreamBuffer ), ( xBytesWritten ), ( pxHigherPriorityTaskWoken ) )
+    #else
+        #define prvSTART_LATENCY_PERIOD( pxStreamBuffer, xBytesWritten )
+        #define prvSTART_LATENCY_PERIOD_FROM_ISR( pxStreamBuffer, xBytesWritten, pxHigherPriorityTaskWoken )
+    #endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+
+/* A write or read that changes the number of bytes held checks them against
+ * the watermarks set by xStreamBufferSetWatermarks(). */
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+        #define prvCHECK_WATERMARKS( pxStreamBuffer )    prvCheckWatermarks( ( pxStreamBuffer ), pdFALSE, NULL )
+        #define prvCHECK_WATERMARKS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) \
+    prvCheckWatermarks( ( pxStreamBuffer ), pdTRUE, ( pxHigherPriorityTaskWoken ) )
+    #else
+        #define prvCHECK_WATERMARKS( pxStreamBuffer )
+        #define prvCHECK_WATERMARKS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )
+    #endif /* configUSE_STREAM_BUFFER_WATERMARKS */
+
+/* The number of bytes used to hold the length, xLength, of a message in the
+ * buffer, and the fewest bytes any message length can be held in.  When
+ * configUSE_MESSAGE_BUFFER_VARINT_LENGTHS is 1 the length is held as a base 128
+ * varint, least significant seven bits first, with the top bit of each byte
+ * set if another byte follows.  Otherwise it is held as a
+ * configMESSAGE_BUFFER_LENGTH_TYPE. */
+    #if ( configUSE_MESSAGE_BUFFER_VARINT_LENGTHS == 1 )
+        #define sbMAX_BYTES_TO_STORE_MESSAGE_LENGTH           ( ( ( sizeof( size_t ) * ( size_t ) 8U ) + ( size_t ) 6U ) / ( size_t ) 7U )
+        #define sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH           ( ( size_t ) 1U )
+        #define sbBYTES_TO_STORE_MESSAGE_LENGTH( xLength )    prvVarintLength( xLength )
+    #else
+        #define sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH           ( sizeof( configMESSAGE_BUFFER_LENGTH_TYPE ) )
+        #define sbBYTES_TO_STORE_MESSAGE_LENGTH( xLength )    sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH
+    #endif /* configUSE_MESSAGE_BUFFER_VARINT_LENGTHS */
 
 /* Bits stored in the ucFlags field of the stream buffer. */
     #define sbFLAGS_IS_MESSAGE_BUFFER          ( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
     #define sbFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
     #define sbFLAGS_IS_BATCHING_BUFFER         ( ( uint8_t ) 4 ) /* Set if the stream buffer was created as a batching buffer, meaning the receiver task will only unblock when the trigger level exceededs. */
+    #define sbFLAGS_IS_ALIGNED_STORAGE         ( ( uint8_t ) 8 ) /* Set if the storage area is aligned to configSTREAM_BUFFER_STORAGE_ALIGNMENT and messages are padded to portBYTE_ALIGNMENT. */
+    #define sbFLAGS_IS_MULTI_PRODUCER          ( ( uint8_t ) 16 ) /* Set if the stream buffer can be written by more than one task or interrupt at a time. */
+    #define sbFLAGS_IS_INTERPROCESSOR          ( ( uint8_t ) 32 ) /* Set if the message buffer is shared with a processor that runs its own instance of the kernel. */
+
+/* The ulProducerState member of a multi-producer stream buffer holds the
+ * number of writers that have reserved space but not yet committed it in its
+ * top 8 bits, and the reservation head - the index at which the next writer
+ * will reserve space - in its low 24 bits.  Keeping both in one word lets a
+ * writer reserve, and commit, with a single compare and swap. */
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        #define sbPRODUCER_HEAD_MASK           ( ( uint32_t ) 0x00FFFFFFUL )
+        #define sbPRODUCER_COUNT_SHIFT         ( 24U )
+        #define sbPRODUCER_MAX_COUNT           ( ( uint32_t ) 0xFFUL )
+        #define sbPRODUCER_HEAD( ulState )     ( ( size_t ) ( ( ulState ) & sbPRODUCER_HEAD_MASK ) )
+        #define sbPRODUCER_COUNT( ulState )    ( ( ulState ) >> sbPRODUCER_COUNT_SHIFT )
+        #define sbPRODUCER_STATE( ulCount, xHead ) \
+    ( ( ( uint32_t ) ( ulCount ) << sbPRODUCER_COUNT_SHIFT ) | ( uint32_t ) ( xHead ) )
+        #define sbIS_MULTI_PRODUCER( pxStreamBuffer ) \
+    ( ( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 ) ? pdTRUE : pdFALSE )
+
+/* Writes to a multi-producer stream buffer take their own path, which never
+ * blocks. */
+        #define sbSEND( pxStreamBuffer, pxSegments, uxSegmentCount, xDataLengthBytes, xTicksToWait )                        \
+    ( ( sbIS_MULTI_PRODUCER( pxStreamBuffer ) != pdFALSE ) ?                                                                \
+      prvSendMultiProducer( ( pxStreamBuffer ), ( pxSegments ), ( uxSegmentCount ), ( xDataLengthBytes ), pdFALSE, NULL ) : \
+      prvSend( ( pxStreamBuffer ), ( pxSegments ), ( uxSegmentCount ), ( xDataLengthBytes ), ( xTicksToWait ) ) )
+        #define sbSEND_FROM_ISR( pxStreamBuffer, pxSegments, uxSegmentCount, xDataLengthBytes, pxHigherPriorityTaskWoken )                          \
+    ( ( sbIS_MULTI_PRODUCER( pxStreamBuffer ) != pdFALSE ) ?                                                                                        \
+      prvSendMultiProducer( ( pxStreamBuffer ), ( pxSegments ), ( uxSegmentCount ), ( xDataLengthBytes ), pdTRUE, ( pxHigherPriorityTaskWoken ) ) : \
+      prvSendFromISR( ( pxStreamBuffer ), ( pxSegments ), ( uxSegmentCount ), ( xDataLengthBytes ), ( pxHigherPriorityTaskWoken ) ) )
+        #define sbASSERT_NOT_MULTI_PRODUCER( pxStreamBuffer )    configASSERT( sbIS_MULTI_PRODUCER( pxStreamBuffer ) == pdFALSE )
+    #else
+        #define sbSEND( pxStreamBuffer, pxSegments, uxSegmentCount, xDataLengthBytes, xTicksToWait ) \
+    prvSend( ( pxStreamBuffer ), ( pxSegments ), ( uxSegmentCount ), ( xDataLengthBytes ), ( xTicksToWait ) )
+        #define sbSEND_FROM_ISR( pxStreamBuffer, pxSegments, uxSegmentCount, xDataLengthBytes, pxHigherPriorityTaskWoken ) \
+    prvSendFromISR( ( pxStreamBuffer ), ( pxSegments ), ( uxSegmentCount ), ( xDataLengthBytes ), ( pxHigherPriorityTaskWoken ) )
+        #define sbASSERT_NOT_MULTI_PRODUCER( pxStreamBuffer )
+    #endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+
+/* The storage area of a stream buffer created with sbTYPE_ALIGNED_STORAGE
+ * starts on, and is a whole number of, configSTREAM_BUFFER_STORAGE_ALIGNMENT
+ * bytes.  Each message in such a message buffer has its length and its data
+ * padded to portBYTE_ALIGNMENT so every message starts word aligned. */
+    #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+        #define sbSTORAGE_ALIGNMENT_MASK    ( ( size_t ) configSTREAM_BUFFER_STORAGE_ALIGNMENT - ( size_t ) 1U )
+        #define sbSTORAGE_PADDING( ucFlags ) \
+    ( ( ( ( ucFlags ) & sbFLAGS_IS_ALIGNED_STORAGE ) != ( uint8_t ) 0 ) ? sbSTORAGE_ALIGNMENT_MASK : ( size_t ) 0U )
+        #define sbMESSAGE_PADDING( pxStreamBuffer )                                                           \
+    ( ( ( ( pxStreamBuffer )->ucFlags & ( sbFLAGS_IS_ALIGNED_STORAGE | sbFLAGS_IS_MESSAGE_BUFFER ) ) ==       \
+        ( sbFLAGS_IS_ALIGNED_STORAGE | sbFLAGS_IS_MESSAGE_BUFFER ) ) ? ( size_t ) portBYTE_ALIGNMENT_MASK : ( size_t ) 0U )
+        #define sbPADDED_LENGTH( pxStreamBuffer, xLength ) \
+    ( ( ( xLength ) + sbMESSAGE_PADDING( pxStreamBuffer ) ) & ~sbMESSAGE_PADDING( pxStreamBuffer ) )
+        #define sbMESSAGE_HEADER_BYTES( pxStreamBuffer, xLength )    sbPADDED_LENGTH( ( pxStreamBuffer ), sbBYTES_TO_STORE_MESSAGE_LENGTH( xLength ) )
+        #define sbMIN_MESSAGE_HEADER_BYTES( pxStreamBuffer )         sbPADDED_LENGTH( ( pxStreamBuffer ), sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH )
+    #else
+        #define sbSTORAGE_PADDING( ucFlags )                         ( ( size_t ) 0U )
+        #define sbPADDED_LENGTH( pxStreamBuffer, xLength )           ( xLength )
+        #define sbMESSAGE_HEADER_BYTES( pxStreamBuffer, xLength )    sbBYTES_TO_STORE_MESSAGE_LENGTH( xLength )
+        #define sbMIN_MESSAGE_HEADER_BYTES( pxStreamBuffer )         sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH
+    #endif /* configUSE_ALIGNED_STREAM_BUFFERS */
+
+/* When configUSE_STREAM_BUFFER_CACHE_MAINTENANCE is 1 only the bytes of the
+ * storage area that are copied in or out are cleaned from, or invalidated in,
+ * the data cache, so the storage area can be shared with a DMA controller or
+ * another core without maintaining the whole buffer. */
+    #if ( configUSE_STREAM_BUFFER_CACHE_MAINTENANCE == 1 )
+        #define sbCLEAN_STORAGE( pucStart, xCount )         portCLEAN_DCACHE_RANGE( ( void * ) ( pucStart ), ( xCount ) )
+        #define sbINVALIDATE_STORAGE( pucStart, xCount )    portINVALIDATE_DCACHE_RANGE( ( void * ) ( pucStart ), ( xCount ) )
+    #else
+        #define sbCLEAN_STORAGE( pucStart, xCount )
+        #define sbINVALIDATE_STORAGE( pucStart, xCount )
+    #endif /* configUSE_STREAM_BUFFER_CACHE_MAINTENANCE */
 
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+/* The read position of one reader of a broadcast stream buffer. */
+        typedef struct StreamBufferReaderDef_t
+        {
+            volatile size_t xTail;                       /* Index to the next item this reader will read within the buffer. */
+            volatile TaskHandle_t xTaskWaitingToReceive; /* Holds the handle of this reader's task while it waits for data, or NULL. */
+        } StreamBufferReader_t;
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+
+/* The position of one stage of a pipeline stream buffer.  The bytes from a
+ * stage's xHead up to the previous stage's xHead, or up to the stream buffer's
+ * xHead for stage 0, are waiting to be processed by the stage. */
+        typedef struct StreamBufferStageDef_t
+        {
+            volatile size_t xHead;                       /* Index to the next byte this stage will process within the buffer. */
+            size_t xTriggerLevelBytes;                   /* The number of bytes that must be waiting for this stage before its waiting task is unblocked. */
+            volatile TaskHandle_t xTaskWaitingToReceive; /* Holds the handle of this stage's task while it waits for data, or NULL. */
+        } StreamBufferStage_t;
+    #endif
+
 /* Structure that hold state information on the buffer. */
 typedef struct StreamBufferDef_t
 {
@@ -249,6 +571,48 @@ typedef struct StreamBufferDef_t
         StreamBufferCallbackFunction_t pxReceiveCompletedCallback; /* Optional callback called on receive complete.  sbRECEIVE_COMPLETED is called if this is NULL. */
     #endif
     UBaseType_t uxNotificationIndex;                               /* The index we are using for notification, by default tskDEFAULT_INDEX_TO_NOTIFY. */
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+        StreamBufferReader_t * pxReaders; /* The position of each reader of a broadcast stream buffer, or NULL if the stream buffer has a single reader. */
+        UBaseType_t uxReaderCount;        /* The number of readers pointed to by pxReaders. */
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+        StreamBufferStage_t * pxStages; /* The position of each stage of a pipeline stream buffer, or NULL if the stream buffer has no stages. */
+        UBaseType_t uxStageCount;       /* The number of stages pointed to by pxStages. */
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        TickType_t xMaxLatencyTicks;        /* The longest a waiting reader is held off after the first byte is written, or 0 for no limit. */
+        volatile TickType_t xFirstByteTime; /* The tick count when the first byte was written to the empty buffer. */
+    #endif
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+        IPCStatistics_t xStatistics; /* The statistics returned by vStreamBufferGetStatistics(). */
+    #endif
+
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        volatile uint32_t ulProducerState; /* The number of uncommitted writers and the reservation head of a multi-producer stream buffer, see sbPRODUCER_STATE(). */
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+        size_t xHighWatermarkBytes;                                  /* The number of bytes held at or above which the watermark callback is called with xAboveHighWatermark set to pdTRUE. */
+        size_t xLowWatermarkBytes;                                   /* The number of bytes held at or below which the watermark callback is called with xAboveHighWatermark set to pdFALSE. */
+        StreamBufferWatermarkCallbackFunction_t pxWatermarkCallback; /* The callback set by xStreamBufferSetWatermarks(), or NULL if no watermarks are set. */
+        BaseType_t xAboveHighWatermark;                              /* pdTRUE from crossing the high watermark until crossing the low watermark. */
+    #endif
+
+    #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        MessageTag_t xMessageTags[ configIPC_LATENCY_MESSAGE_BUFFER_TAGS ]; /* The latency tags of the oldest unread tagged messages, used as a ring. */
+        size_t xMessageTagEnds[ configIPC_LATENCY_MESSAGE_BUFFER_TAGS ];    /* The index just past each tagged message, which identifies the message when it is read. */
+        volatile UBaseType_t uxMessageTagsWritten;                          /* The number of tags written, wrapping.  Only changed by the writer. */
+        volatile UBaseType_t uxMessageTagsRead;                             /* The number of tags read, wrapping.  Only changed by the reader. */
+        IPCLatencyHistogram_t xLatencyHistogram;                            /* The latencies returned by vStreamBufferGetLatencyHistogram(). */
+    #endif
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+        portSPINLOCK_TYPE xStreamBufferLock; /* Protects the members in place of the kernel critical section.  Must remain the last member as it is not cleared on reset. */
+    #endif
 } StreamBuffer_t;
 
 /*
@@ -256,6 +620,17 @@ typedef struct StreamBufferDef_t
  */
 static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_IPC_STATISTICS == 1 )
+
+/*
+ * Waits for the task notification that signals the stream buffer has changed,
+ * and records the block, the time spent blocked and, if no notification was
+ * received before xTicksToWait expired, the timeout.
+ */
+    static void prvWaitForNotification( StreamBuffer_t * const pxStreamBuffer,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Add xCount bytes from pucData into the pxStreamBuffer's data storage area.
  * This function does not update the buffer's xHead pointer, so multiple writes
@@ -280,9 +655,11 @@ static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
  * buffer's data storage area.
  */
 static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
-                                        void * pvRxData,
+                                        const StreamBufferSegment_t * const pxSegments,
+                                        const UBaseType_t uxSegmentCount,
                                         size_t xBufferLengthBytes,
-                                        size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
+                                        size_t xBytesAvailable,
+                                        BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
 
 /*
  * If the stream buffer is being used as a message buffer, then writes an entire
@@ -292,10 +669,50 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
  * data storage area.
  */
 static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
-                                       const void * pvTxData,
+                                       const StreamBufferSegment_t * const pxSegments,
+                                       const UBaseType_t uxSegmentCount,
                                        size_t xDataLengthBytes,
                                        size_t xSpace,
-                                       size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
+                                       size_t xRequiredSpace,
+                                       BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_IPC_LATENCY_TRACING == 1 )
+
+/*
+ * Tags the message that ends at xNextHead as it is written, or records the
+ * latency of the message that ended at xNextTail as it is read.  The writer
+ * and the reader each change only their own count, so neither needs a
+ * critical section.  A message written while every tag is in use is not
+ * tagged.
+ */
+    static void prvStampMessageTag( StreamBuffer_t * const pxStreamBuffer,
+                                    size_t xNextHead,
+                                    BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+    static void prvReceiveMessageTag( StreamBuffer_t * const pxStreamBuffer,
+                                      size_t xNextTail,
+                                      BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Writes the header holding the length of a message, followed by any padding,
+ * at xHead, or reads the header at xTail into *pxMessageLength.  Both return
+ * the index of the first byte of the message data.
+ */
+static size_t prvWriteMessageLength( StreamBuffer_t * const pxStreamBuffer,
+                                     size_t xMessageLength,
+                                     size_t xHead ) PRIVILEGED_FUNCTION;
+static size_t prvReadMessageLength( StreamBuffer_t * const pxStreamBuffer,
+                                    size_t * const pxMessageLength,
+                                    size_t xTail ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_MESSAGE_BUFFER_VARINT_LENGTHS == 1 )
+
+/*
+ * Returns the number of bytes needed to hold xLength as a varint.
+ */
+    static size_t prvVarintLength( size_t xLength ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * Copies xCount bytes from the pxStreamBuffer's data storage area to pucData.
@@ -314,6 +731,262 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                       size_t xCount,
                                       size_t xTail ) PRIVILEGED_FUNCTION;
 
+/*
+ * As prvWriteBytesToBuffer() and prvReadBytesFromBuffer(), but the xCount bytes
+ * are gathered from, or scattered to, the uxSegmentCount segments at
+ * pxSegments in order.
+ */
+static size_t prvWriteSegmentsToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                        const StreamBufferSegment_t * const pxSegments,
+                                        const UBaseType_t uxSegmentCount,
+                                        size_t xCount,
+                                        size_t xHead ) PRIVILEGED_FUNCTION;
+static size_t prvReadSegmentsFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                         const StreamBufferSegment_t * const pxSegments,
+                                         const UBaseType_t uxSegmentCount,
+                                         size_t xCount,
+                                         size_t xTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * The bodies of xStreamBufferSend(), xStreamBufferSendFromISR(),
+ * xStreamBufferReceive() and xStreamBufferReceiveFromISR(), which move data
+ * to or from a list of segments.  xDataLengthBytes and xBufferLengthBytes are
+ * the total length of the segments.
+ */
+static size_t prvSend( StreamBuffer_t * const pxStreamBuffer,
+                       const StreamBufferSegment_t * const pxSegments,
+                       const UBaseType_t uxSegmentCount,
+                       size_t xDataLengthBytes,
+                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+static size_t prvSendFromISR( StreamBuffer_t * const pxStreamBuffer,
+                              const StreamBufferSegment_t * const pxSegments,
+                              const UBaseType_t uxSegmentCount,
+                              size_t xDataLengthBytes,
+                              BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+/*
+ * Blocks the calling task for up to xTicksToWait ticks if the buffer holds
+ * xBytesToStoreMessageLength bytes or fewer, then returns the number of bytes
+ * in the buffer.
+ */
+static size_t prvWaitToReceive( StreamBuffer_t * const pxStreamBuffer,
+                                size_t xBytesToStoreMessageLength,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+static size_t prvReceive( StreamBuffer_t * const pxStreamBuffer,
+                          const StreamBufferSegment_t * const pxSegments,
+                          const UBaseType_t uxSegmentCount,
+                          size_t xBufferLengthBytes,
+                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+static size_t prvReceiveFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                 const StreamBufferSegment_t * const pxSegments,
+                                 const UBaseType_t uxSegmentCount,
+                                 size_t xBufferLengthBytes,
+                                 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+
+/*
+ * The body of prvSend() and prvSendFromISR() for a multi-producer stream
+ * buffer.  Reserves space at the reservation head, writes the data into it
+ * and commits it, all without a critical section.  xFromISR is pdTRUE when
+ * called from an interrupt, in which case pxHigherPriorityTaskWoken is used to
+ * report a task being unblocked.
+ */
+    static size_t prvSendMultiProducer( StreamBuffer_t * const pxStreamBuffer,
+                                        const StreamBufferSegment_t * const pxSegments,
+                                        const UBaseType_t uxSegmentCount,
+                                        size_t xDataLengthBytes,
+                                        BaseType_t xFromISR,
+                                        BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+    #if ( configUSE_STREAM_BUFFER_SEGMENTS == 1 )
+
+/*
+ * Returns the total length of the uxSegmentCount segments at pxSegments.
+ */
+    static size_t prvSegmentsLength( const StreamBufferSegment_t * const pxSegments,
+                                     const UBaseType_t uxSegmentCount ) PRIVILEGED_FUNCTION;
+    #endif /* configUSE_STREAM_BUFFER_SEGMENTS */
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+/*
+ * The number of bytes that can be written to, or read from, the buffer's data
+ * storage area starting at xHead or xTail respectively without wrapping back
+ * to the start of the storage area.
+ */
+    static size_t prvContiguousSpaceAtHead( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+    static size_t prvContiguousBytesAtTail( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move xHead forward over xCount bytes the writer has placed directly in the
+ * region returned by xStreamBufferGetWriteRegion(), or xTail forward over
+ * xCount bytes the reader has finished with in the region returned by
+ * xStreamBufferGetReadRegion().  Returns the number of bytes committed or
+ * consumed, which is 0 if xCount is larger than the region.
+ */
+    static size_t prvCommitBytesAtHead( StreamBuffer_t * const pxStreamBuffer,
+                                        size_t xCount ) PRIVILEGED_FUNCTION;
+    static size_t prvConsumeBytesAtTail( StreamBuffer_t * const pxStreamBuffer,
+                                         size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if the writer (xIsWriter is pdTRUE) or the reader would be
+ * given an empty region.  A batching buffer's reader is also given an empty
+ * region until the trigger level has been exceeded, as in
+ * xStreamBufferReceive().
+ */
+    static BaseType_t prvRegionIsEmpty( StreamBuffer_t * const pxStreamBuffer,
+                                        const BaseType_t xIsWriter ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task for up to xTicksToWait ticks if the writer or the
+ * reader would be given an empty region.  The task is unblocked by the same
+ * notifications that unblock xStreamBufferSend() and xStreamBufferReceive().
+ */
+    static void prvWaitForRegion( StreamBuffer_t * const pxStreamBuffer,
+                                  const BaseType_t xIsWriter,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+/*
+ * The number of bytes in the buffer that a broadcast reader whose next read is
+ * from xTail has not read yet.
+ */
+    static size_t prvBytesAfterTail( const StreamBuffer_t * const pxStreamBuffer,
+                                     size_t xTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move a broadcast reader's tail to xNextTail, then move the stream buffer's
+ * own tail up to the slowest reader to free the space all the readers have
+ * finished with.  Must be called from a critical section.
+ */
+    static void prvAdvanceReaderTail( StreamBuffer_t * const pxStreamBuffer,
+                                      StreamBufferReader_t * const pxReader,
+                                      size_t xNextTail ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock each broadcast reader that is waiting for data and now has at least
+ * the trigger level number of bytes to read.  Does nothing if the stream
+ * buffer is not a broadcast stream buffer.
+ */
+    static void prvNotifyBroadcastReaders( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+    static void prvNotifyBroadcastReadersFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if a task is waiting on any reader of a broadcast stream
+ * buffer.
+ */
+    static BaseType_t prvBroadcastReaderIsWaiting( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+
+/*
+ * Returns the number of bytes waiting to be processed by stage uxStage of a
+ * pipeline stream buffer.
+ */
+    static size_t prvBytesForStage( const StreamBuffer_t * const pxStreamBuffer,
+                                    UBaseType_t uxStage ) PRIVILEGED_FUNCTION;
+
+/*
+ * Passes the first xCount bytes of stage uxStage's region on to the next
+ * stage, or to the reader, and returns the number of bytes passed on.
+ */
+    static size_t prvCommitStage( StreamBuffer_t * const pxStreamBuffer,
+                                  UBaseType_t uxStage,
+                                  size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock the task waiting for stage uxStage of a pipeline stream buffer if
+ * the stage now has at least its trigger level number of bytes waiting.
+ */
+    static void prvNotifyStage( StreamBuffer_t * const pxStreamBuffer,
+                                UBaseType_t uxStage ) PRIVILEGED_FUNCTION;
+    static void prvNotifyStageFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                       UBaseType_t uxStage,
+                                       BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if a task is waiting on any stage of a pipeline stream
+ * buffer.
+ */
+    static BaseType_t prvStageIsWaiting( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
+
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) )
+
+/*
+ * Polls the stream buffer for up to configSTREAM_BUFFER_SPIN_ITERATIONS
+ * iterations.  prvSpinForData() returns pdTRUE if more than xBytesHeld bytes
+ * became available in that time, and prvSpinForSpace() returns pdTRUE if at
+ * least xRequiredSpace bytes became free.  Both return pdFALSE if the
+ * iterations ran out, in which case the calling task should block.
+ */
+    static BaseType_t prvSpinForData( const StreamBuffer_t * const pxStreamBuffer,
+                                      size_t xBytesHeld ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvSpinForSpace( StreamBuffer_t * const pxStreamBuffer,
+                                       size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
+    #endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) ) */
+
+    #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+
+/*
+ * Returns xIndex moved forward xCount bytes, wrapping back to the start of the
+ * storage area if necessary.  Used to step over the padding in an aligned
+ * message buffer.
+ */
+    static size_t prvSkipPadding( const StreamBuffer_t * const pxStreamBuffer,
+                                  size_t xIndex,
+                                  size_t xCount ) PRIVILEGED_FUNCTION;
+    #endif /* configUSE_ALIGNED_STREAM_BUFFERS */
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+
+/*
+ * Called after xBytesWritten bytes have been written.  If they are the only
+ * bytes in the buffer, record the time and unblock a waiting reader even
+ * though the trigger level has not been reached, so the reader can limit its
+ * wait to the maximum latency.
+ */
+    static void prvStartLatencyPeriod( StreamBuffer_t * const pxStreamBuffer,
+                                       size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+    static void prvStartLatencyPeriodFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                              size_t xBytesWritten,
+                                              BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task for up to xTicksToWait ticks until the buffer holds
+ * more than xBytesToStoreMessageLength bytes and at least the trigger level,
+ * or the first byte has been in the buffer for the maximum latency.  Returns
+ * the number of bytes the reader must then find in the buffer before it reads,
+ * which is 0 once the maximum latency has expired.
+ */
+    static size_t prvWaitForMaxLatency( StreamBuffer_t * const pxStreamBuffer,
+                                        size_t xBytesToStoreMessageLength,
+                                        TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    #endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+
+/*
+ * Calls the watermark callback if the number of bytes held has risen to the
+ * high watermark, or fallen to the low watermark, since it was last called.
+ * prvCheckWatermarks() enters a critical section, so the calls made by a writer
+ * and a reader cannot be reordered, then calls prvCrossWatermarks(), which must
+ * be called from a critical section.
+ */
+    static void prvCheckWatermarks( StreamBuffer_t * const pxStreamBuffer,
+                                    BaseType_t xIsInsideISR,
+                                    BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+    static void prvCrossWatermarks( StreamBuffer_t * const pxStreamBuffer,
+                                    BaseType_t xIsInsideISR,
+                                    BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+    #endif /* configUSE_STREAM_BUFFER_WATERMARKS */
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -335,10 +1008,35 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                                      StreamBufferCallbackFunction_t pxReceiveCompletedCallback )
     {
         void * pvAllocatedMemory;
+        uint8_t * pucStorageArea;
         uint8_t ucFlags;
+        size_t xStoragePadding;
+
+        #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+            BaseType_t xAlignedStorage;
+        #endif
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+            BaseType_t xMultiProducer;
+        #endif
 
         traceENTER_xStreamBufferGenericCreate( xBufferSizeBytes, xTriggerLevelBytes, xStreamBufferType, pxSendCompletedCallback, pxReceiveCompletedCallback );
 
+        #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+        {
+            /* Separate the storage option from the type of the buffer. */
+            xAlignedStorage = xStreamBufferType & sbTYPE_ALIGNED_STORAGE;
+            xStreamBufferType &= ~sbTYPE_ALIGNED_STORAGE;
+        }
+        #endif
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        {
+            xMultiProducer = xStreamBufferType & sbTYPE_MULTI_PRODUCER;
+            xStreamBufferType &= ~sbTYPE_MULTI_PRODUCER;
+        }
+        #endif
+
         /* In case the stream buffer is going to be used as a message buffer
          * (that is, it will hold discrete messages with a little meta data that
          * says how big the next message is) check the buffer will be large enough
@@ -347,7 +1045,7 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
         {
             /* Is a message buffer but not statically allocated. */
             ucFlags = sbFLAGS_IS_MESSAGE_BUFFER;
-            configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+            configASSERT( xBufferSizeBytes > sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH );
         }
         else if( xStreamBufferType == sbTYPE_STREAM_BATCHING_BUFFER )
         {
@@ -362,6 +1060,32 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             configASSERT( xBufferSizeBytes > 0 );
         }
 
+        #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+        {
+            if( xAlignedStorage != ( BaseType_t ) 0 )
+            {
+                ucFlags |= sbFLAGS_IS_ALIGNED_STORAGE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        {
+            if( xMultiProducer != ( BaseType_t ) 0 )
+            {
+                ucFlags |= sbFLAGS_IS_MULTI_PRODUCER;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
 
         /* A trigger level of 0 would cause a waiting task to unblock even when
@@ -378,11 +1102,15 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
          * incremented so the free space is returned as the user would expect -
          * this is a quirk of the implementation that means otherwise the free
          * space would be reported as one byte smaller than would be logically
-         * expected. */
-        if( xBufferSizeBytes < ( xBufferSizeBytes + 1U + sizeof( StreamBuffer_t ) ) )
+         * expected.  Aligned storage is also rounded up to a whole number of
+         * alignment units, and can start up to xStoragePadding bytes after the
+         * structure. */
+        xStoragePadding = sbSTORAGE_PADDING( ucFlags );
+
+        if( xBufferSizeBytes < ( xBufferSizeBytes + 1U + sizeof( StreamBuffer_t ) + ( 2U * xStoragePadding ) ) )
         {
-            xBufferSizeBytes++;
-            pvAllocatedMemory = pvPortMalloc( xBufferSizeBytes + sizeof( StreamBuffer_t ) );
+            xBufferSizeBytes = ( xBufferSizeBytes + 1U + xStoragePadding ) & ~xStoragePadding;
+            pvAllocatedMemory = pvPortMalloc( xBufferSizeBytes + sizeof( StreamBuffer_t ) + xStoragePadding );
         }
         else
         {
@@ -394,17 +1122,35 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            prvInitialiseNewStreamBuffer( ( StreamBuffer_t * ) pvAllocatedMemory,                         /* Structure at the start of the allocated memory. */
-                                                                                                          /* MISRA Ref 11.5.1 [Malloc memory assignment] */
-                                                                                                          /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-                                                                                                          /* coverity[misra_c_2012_rule_11_5_violation] */
-                                          ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( StreamBuffer_t ), /* Storage area follows. */
+            pucStorageArea = ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( StreamBuffer_t );
+
+            #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+            {
+                /* Move the storage area up to the next alignment boundary. */
+                pucStorageArea = &( pucStorageArea[ ( ( portPOINTER_SIZE_TYPE ) 0U - ( portPOINTER_SIZE_TYPE ) pucStorageArea ) & ( portPOINTER_SIZE_TYPE ) xStoragePadding ] );
+            }
+            #endif
+
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            prvInitialiseNewStreamBuffer( ( StreamBuffer_t * ) pvAllocatedMemory, /* Structure at the start of the allocated memory. */
+                                          pucStorageArea,                         /* Storage area follows. */
                                           xBufferSizeBytes,
                                           xTriggerLevelBytes,
                                           ucFlags,
                                           pxSendCompletedCallback,
                                           pxReceiveCompletedCallback );
 
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                portINIT_SPINLOCK( &( ( ( StreamBuffer_t * ) pvAllocatedMemory )->xStreamBufferLock ) );
+            }
+            #endif
+
             traceSTREAM_BUFFER_CREATE( ( ( StreamBuffer_t * ) pvAllocatedMemory ), xStreamBufferType );
         }
         else
@@ -439,12 +1185,46 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
         StreamBufferHandle_t xReturn;
         uint8_t ucFlags;
 
+        #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+            BaseType_t xAlignedStorage;
+        #endif
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+            BaseType_t xMultiProducer;
+        #endif
+
+        #if ( configUSE_AMP_MESSAGE_BUFFERS == 1 )
+            BaseType_t xInterprocessor;
+        #endif
+
         traceENTER_xStreamBufferGenericCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, xStreamBufferType, pucStreamBufferStorageArea, pxStaticStreamBuffer, pxSendCompletedCallback, pxReceiveCompletedCallback );
 
         configASSERT( pucStreamBufferStorageArea );
         configASSERT( pxStaticStreamBuffer );
         configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
 
+        #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+        {
+            /* Separate the storage option from the type of the buffer. */
+            xAlignedStorage = xStreamBufferType & sbTYPE_ALIGNED_STORAGE;
+            xStreamBufferType &= ~sbTYPE_ALIGNED_STORAGE;
+        }
+        #endif
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        {
+            xMultiProducer = xStreamBufferType & sbTYPE_MULTI_PRODUCER;
+            xStreamBufferType &= ~sbTYPE_MULTI_PRODUCER;
+        }
+        #endif
+
+        #if ( configUSE_AMP_MESSAGE_BUFFERS == 1 )
+        {
+            xInterprocessor = xStreamBufferType & sbTYPE_INTERPROCESSOR;
+            xStreamBufferType &= ~sbTYPE_INTERPROCESSOR;
+        }
+        #endif
+
         /* A trigger level of 0 would cause a waiting task to unblock even when
          * the buffer was empty. */
         if( xTriggerLevelBytes == ( size_t ) 0 )
@@ -461,7 +1241,7 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
         {
             /* Statically allocated message buffer. */
             ucFlags = sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_STATICALLY_ALLOCATED;
-            configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+            configASSERT( xBufferSizeBytes > sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH );
         }
         else if( xStreamBufferType == sbTYPE_STREAM_BATCHING_BUFFER )
         {
@@ -475,6 +1255,52 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             ucFlags = sbFLAGS_IS_STATICALLY_ALLOCATED;
         }
 
+        #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+        {
+            if( xAlignedStorage != ( BaseType_t ) 0 )
+            {
+                /* The application provides the storage area, so it must
+                 * already be aligned and a whole number of alignment units. */
+                configASSERT( ( ( portPOINTER_SIZE_TYPE ) pucStreamBufferStorageArea & ( portPOINTER_SIZE_TYPE ) sbSTORAGE_ALIGNMENT_MASK ) == 0U );
+                configASSERT( ( xBufferSizeBytes & sbSTORAGE_ALIGNMENT_MASK ) == ( size_t ) 0U );
+                ucFlags |= sbFLAGS_IS_ALIGNED_STORAGE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        {
+            if( xMultiProducer != ( BaseType_t ) 0 )
+            {
+                ucFlags |= sbFLAGS_IS_MULTI_PRODUCER;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
+        #if ( configUSE_AMP_MESSAGE_BUFFERS == 1 )
+        {
+            if( xInterprocessor != ( BaseType_t ) 0 )
+            {
+                /* Only a message buffer with a single writer can be shared
+                 * with another processor. */
+                configASSERT( ( ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER ) ) == sbFLAGS_IS_MESSAGE_BUFFER );
+                ucFlags |= sbFLAGS_IS_INTERPROCESSOR;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         #if ( configASSERT_DEFINED == 1 )
         {
             /* Sanity check that the size of the structure used to declare a
@@ -495,6 +1321,12 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           pxSendCompletedCallback,
                                           pxReceiveCompletedCallback );
 
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                portINIT_SPINLOCK( &( pxStreamBuffer->xStreamBufferLock ) );
+            }
+            #endif
+
             /* Remember this was statically allocated in case it is ever deleted
              * again. */
             pxStreamBuffer->ucFlags |= sbFLAGS_IS_STATICALLY_ALLOCATED;
@@ -554,19 +1386,213 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
     #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
-{
-    StreamBuffer_t * pxStreamBuffer = xStreamBuffer;
-
-    traceENTER_vStreamBufferDelete( xStreamBuffer );
+    #if ( ( configUSE_BROADCAST_STREAM_BUFFERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    StreamBufferHandle_t xStreamBufferGenericCreateBroadcast( size_t xBufferSizeBytes,
+                                                              size_t xTriggerLevelBytes,
+                                                              UBaseType_t uxReaderCount,
+                                                              StreamBufferCallbackFunction_t pxSendCompletedCallback,
+                                                              StreamBufferCallbackFunction_t pxReceiveCompletedCallback )
+    {
+        void * pvAllocatedMemory = NULL;
+        StreamBuffer_t * pxStreamBuffer;
+        size_t xReaderSizeBytes = 0;
 
-    configASSERT( pxStreamBuffer );
+        traceENTER_xStreamBufferGenericCreateBroadcast( xBufferSizeBytes, xTriggerLevelBytes, uxReaderCount, pxSendCompletedCallback, pxReceiveCompletedCallback );
 
-    traceSTREAM_BUFFER_DELETE( xStreamBuffer );
+        configASSERT( xBufferSizeBytes > 0 );
+        configASSERT( uxReaderCount > ( UBaseType_t ) 0 );
+        configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
 
-    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
-    {
-        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        /* A trigger level of 0 would cause a waiting task to unblock even when
+         * the buffer was empty. */
+        if( xTriggerLevelBytes == ( size_t ) 0 )
+        {
+            xTriggerLevelBytes = ( size_t ) 1;
+        }
+
+        /* The StreamBuffer_t structure, the array of readers and the buffer are
+         * allocated in a single call to pvPortMalloc(), in that order.  As in
+         * xStreamBufferGenericCreate() the requested size is incremented so the
+         * free space is returned as the user would expect. */
+        if( ( uxReaderCount > ( UBaseType_t ) 0 ) && ( ( SIZE_MAX / uxReaderCount ) >= sizeof( StreamBufferReader_t ) ) )
+        {
+            xReaderSizeBytes = ( size_t ) uxReaderCount * sizeof( StreamBufferReader_t );
+
+            if( ( xBufferSizeBytes < ( SIZE_MAX - sizeof( StreamBuffer_t ) ) ) &&
+                ( xReaderSizeBytes < ( SIZE_MAX - sizeof( StreamBuffer_t ) - xBufferSizeBytes ) ) )
+            {
+                xBufferSizeBytes++;
+                pvAllocatedMemory = pvPortMalloc( sizeof( StreamBuffer_t ) + xReaderSizeBytes + xBufferSizeBytes );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pvAllocatedMemory != NULL )
+        {
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxStreamBuffer = ( StreamBuffer_t * ) pvAllocatedMemory;
+
+            prvInitialiseNewStreamBuffer( pxStreamBuffer,
+                                          ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( StreamBuffer_t ) + xReaderSizeBytes, /* Storage area follows the readers. */
+                                          xBufferSizeBytes,
+                                          xTriggerLevelBytes,
+                                          0,
+                                          pxSendCompletedCallback,
+                                          pxReceiveCompletedCallback );
+
+            /* The readers follow the structure, which keeps them aligned. */
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            pxStreamBuffer->pxReaders = ( StreamBufferReader_t * ) ( ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( StreamBuffer_t ) );
+            pxStreamBuffer->uxReaderCount = uxReaderCount;
+            ( void ) memset( ( void * ) pxStreamBuffer->pxReaders, 0x00, xReaderSizeBytes );
+
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                portINIT_SPINLOCK( &( pxStreamBuffer->xStreamBufferLock ) );
+            }
+            #endif
+
+            traceSTREAM_BUFFER_CREATE( pxStreamBuffer, sbTYPE_STREAM_BUFFER );
+        }
+        else
+        {
+            traceSTREAM_BUFFER_CREATE_FAILED( sbTYPE_STREAM_BUFFER );
+        }
+
+        traceRETURN_xStreamBufferGenericCreateBroadcast( pvAllocatedMemory );
+
+        /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        return ( StreamBufferHandle_t ) pvAllocatedMemory;
+    }
+    #endif /* ( ( configUSE_BROADCAST_STREAM_BUFFERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+    #if ( ( configUSE_STREAM_BUFFER_PIPELINES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    StreamBufferHandle_t xStreamBufferGenericCreatePipeline( size_t xBufferSizeBytes,
+                                                             size_t xTriggerLevelBytes,
+                                                             UBaseType_t uxStageCount,
+                                                             StreamBufferCallbackFunction_t pxSendCompletedCallback,
+                                                             StreamBufferCallbackFunction_t pxReceiveCompletedCallback )
+    {
+        void * pvAllocatedMemory = NULL;
+        StreamBuffer_t * pxStreamBuffer;
+        size_t xStageSizeBytes = 0;
+        UBaseType_t uxStage;
+
+        traceENTER_xStreamBufferGenericCreatePipeline( xBufferSizeBytes, xTriggerLevelBytes, uxStageCount, pxSendCompletedCallback, pxReceiveCompletedCallback );
+
+        configASSERT( xBufferSizeBytes > 0 );
+        configASSERT( uxStageCount > ( UBaseType_t ) 0 );
+        configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
+
+        /* A trigger level of 0 would cause a waiting task to unblock even when
+         * the buffer was empty. */
+        if( xTriggerLevelBytes == ( size_t ) 0 )
+        {
+            xTriggerLevelBytes = ( size_t ) 1;
+        }
+
+        /* The StreamBuffer_t structure, the array of stages and the buffer are
+         * allocated in a single call to pvPortMalloc(), in that order.  As in
+         * xStreamBufferGenericCreate() the requested size is incremented so the
+         * free space is returned as the user would expect. */
+        if( ( uxStageCount > ( UBaseType_t ) 0 ) && ( ( SIZE_MAX / uxStageCount ) >= sizeof( StreamBufferStage_t ) ) )
+        {
+            xStageSizeBytes = ( size_t ) uxStageCount * sizeof( StreamBufferStage_t );
+
+            if( ( xBufferSizeBytes < ( SIZE_MAX - sizeof( StreamBuffer_t ) ) ) &&
+                ( xStageSizeBytes < ( SIZE_MAX - sizeof( StreamBuffer_t ) - xBufferSizeBytes ) ) )
+            {
+                xBufferSizeBytes++;
+                pvAllocatedMemory = pvPortMalloc( sizeof( StreamBuffer_t ) + xStageSizeBytes + xBufferSizeBytes );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( pvAllocatedMemory != NULL )
+        {
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxStreamBuffer = ( StreamBuffer_t * ) pvAllocatedMemory;
+
+            prvInitialiseNewStreamBuffer( pxStreamBuffer,
+                                          ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( StreamBuffer_t ) + xStageSizeBytes, /* Storage area follows the stages. */
+                                          xBufferSizeBytes,
+                                          xTriggerLevelBytes,
+                                          0,
+                                          pxSendCompletedCallback,
+                                          pxReceiveCompletedCallback );
+
+            /* The stages follow the structure, which keeps them aligned. */
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            pxStreamBuffer->pxStages = ( StreamBufferStage_t * ) ( ( ( uint8_t * ) pvAllocatedMemory ) + sizeof( StreamBuffer_t ) );
+            pxStreamBuffer->uxStageCount = uxStageCount;
+            ( void ) memset( ( void * ) pxStreamBuffer->pxStages, 0x00, xStageSizeBytes );
+
+            for( uxStage = ( UBaseType_t ) 0U; uxStage < uxStageCount; uxStage++ )
+            {
+                pxStreamBuffer->pxStages[ uxStage ].xTriggerLevelBytes = ( size_t ) 1;
+            }
+
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                portINIT_SPINLOCK( &( pxStreamBuffer->xStreamBufferLock ) );
+            }
+            #endif
+
+            traceSTREAM_BUFFER_CREATE( pxStreamBuffer, sbTYPE_STREAM_BUFFER );
+        }
+        else
+        {
+            traceSTREAM_BUFFER_CREATE_FAILED( sbTYPE_STREAM_BUFFER );
+        }
+
+        traceRETURN_xStreamBufferGenericCreatePipeline( pvAllocatedMemory );
+
+        /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        return ( StreamBufferHandle_t ) pvAllocatedMemory;
+    }
+    #endif /* ( ( configUSE_STREAM_BUFFER_PIPELINES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
+{
+    StreamBuffer_t * pxStreamBuffer = xStreamBuffer;
+
+    traceENTER_vStreamBufferDelete( xStreamBuffer );
+
+    configASSERT( pxStreamBuffer );
+
+    traceSTREAM_BUFFER_DELETE( xStreamBuffer );
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+    {
+        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
         {
             /* Both the structure and the buffer were allocated using a single call
             * to pvPortMalloc(), hence only one call to vPortFree() is required. */
@@ -601,6 +1627,26 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
         UBaseType_t uxStreamBufferNumber;
     #endif
 
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+        StreamBufferReader_t * pxReaders;
+        UBaseType_t uxReaderCount;
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+        StreamBufferStage_t * pxStages;
+        UBaseType_t uxStageCount, uxStage;
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        TickType_t xMaxLatencyTicks;
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+        size_t xHighWatermarkBytes, xLowWatermarkBytes;
+        StreamBufferWatermarkCallbackFunction_t pxWatermarkCallback;
+        BaseType_t xAboveHighWatermark;
+    #endif
+
     traceENTER_xStreamBufferReset( xStreamBuffer );
 
     configASSERT( pxStreamBuffer );
@@ -614,9 +1660,12 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
     #endif
 
     /* Can only reset a message buffer if there are no tasks blocked on it. */
-    taskENTER_CRITICAL();
+    sbENTER_CRITICAL( pxStreamBuffer );
     {
-        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) &&
+            ( pxStreamBuffer->xTaskWaitingToSend == NULL ) &&
+            ( sbBROADCAST_READER_IS_WAITING( pxStreamBuffer ) == pdFALSE ) &&
+            ( sbSTAGE_IS_WAITING( pxStreamBuffer ) == pdFALSE ) )
         {
             #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
             {
@@ -625,6 +1674,35 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+            {
+                pxReaders = pxStreamBuffer->pxReaders;
+                uxReaderCount = pxStreamBuffer->uxReaderCount;
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+            {
+                pxStages = pxStreamBuffer->pxStages;
+                uxStageCount = pxStreamBuffer->uxStageCount;
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+            {
+                xMaxLatencyTicks = pxStreamBuffer->xMaxLatencyTicks;
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+            {
+                xHighWatermarkBytes = pxStreamBuffer->xHighWatermarkBytes;
+                xLowWatermarkBytes = pxStreamBuffer->xLowWatermarkBytes;
+                pxWatermarkCallback = pxStreamBuffer->pxWatermarkCallback;
+                xAboveHighWatermark = pxStreamBuffer->xAboveHighWatermark;
+            }
+            #endif
+
             prvInitialiseNewStreamBuffer( pxStreamBuffer,
                                           pxStreamBuffer->pucBuffer,
                                           pxStreamBuffer->xLength,
@@ -633,6 +1711,55 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
                                           pxSendCallback,
                                           pxReceiveCallback );
 
+            #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+            {
+                /* Every reader starts again from the empty buffer. */
+                pxStreamBuffer->pxReaders = pxReaders;
+                pxStreamBuffer->uxReaderCount = uxReaderCount;
+
+                if( pxReaders != NULL )
+                {
+                    ( void ) memset( ( void * ) pxReaders, 0x00, ( size_t ) uxReaderCount * sizeof( StreamBufferReader_t ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+            {
+                /* Every stage starts again from the empty buffer, keeping its
+                 * trigger level. */
+                pxStreamBuffer->pxStages = pxStages;
+                pxStreamBuffer->uxStageCount = uxStageCount;
+
+                for( uxStage = ( UBaseType_t ) 0U; uxStage < uxStageCount; uxStage++ )
+                {
+                    pxStages[ uxStage ].xHead = ( size_t ) 0U;
+                }
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+            {
+                pxStreamBuffer->xMaxLatencyTicks = xMaxLatencyTicks;
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+            {
+                /* The watermarks are kept, and the now empty buffer releases
+                 * flow control if it was asserted. */
+                pxStreamBuffer->xHighWatermarkBytes = xHighWatermarkBytes;
+                pxStreamBuffer->xLowWatermarkBytes = xLowWatermarkBytes;
+                pxStreamBuffer->pxWatermarkCallback = pxWatermarkCallback;
+                pxStreamBuffer->xAboveHighWatermark = xAboveHighWatermark;
+                prvCrossWatermarks( pxStreamBuffer, pdFALSE, NULL );
+            }
+            #endif
+
             #if ( configUSE_TRACE_FACILITY == 1 )
             {
                 pxStreamBuffer->uxStreamBufferNumber = uxStreamBufferNumber;
@@ -644,7 +1771,7 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
             xReturn = pdPASS;
         }
     }
-    taskEXIT_CRITICAL();
+    sbEXIT_CRITICAL( pxStreamBuffer );
 
     traceRETURN_xStreamBufferReset( xReturn );
 
@@ -663,6 +1790,26 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
         UBaseType_t uxStreamBufferNumber;
     #endif
 
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+        StreamBufferReader_t * pxReaders;
+        UBaseType_t uxReaderCount;
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+        StreamBufferStage_t * pxStages;
+        UBaseType_t uxStageCount, uxStage;
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+        TickType_t xMaxLatencyTicks;
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+        size_t xHighWatermarkBytes, xLowWatermarkBytes;
+        StreamBufferWatermarkCallbackFunction_t pxWatermarkCallback;
+        BaseType_t xAboveHighWatermark;
+    #endif
+
     traceENTER_xStreamBufferResetFromISR( xStreamBuffer );
 
     configASSERT( pxStreamBuffer );
@@ -679,9 +1826,12 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
     {
-        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) &&
+            ( pxStreamBuffer->xTaskWaitingToSend == NULL ) &&
+            ( sbBROADCAST_READER_IS_WAITING( pxStreamBuffer ) == pdFALSE ) &&
+            ( sbSTAGE_IS_WAITING( pxStreamBuffer ) == pdFALSE ) )
         {
             #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
             {
@@ -690,6 +1840,35 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+            {
+                pxReaders = pxStreamBuffer->pxReaders;
+                uxReaderCount = pxStreamBuffer->uxReaderCount;
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+            {
+                pxStages = pxStreamBuffer->pxStages;
+                uxStageCount = pxStreamBuffer->uxStageCount;
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+            {
+                xMaxLatencyTicks = pxStreamBuffer->xMaxLatencyTicks;
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+            {
+                xHighWatermarkBytes = pxStreamBuffer->xHighWatermarkBytes;
+                xLowWatermarkBytes = pxStreamBuffer->xLowWatermarkBytes;
+                pxWatermarkCallback = pxStreamBuffer->pxWatermarkCallback;
+                xAboveHighWatermark = pxStreamBuffer->xAboveHighWatermark;
+            }
+            #endif
+
             prvInitialiseNewStreamBuffer( pxStreamBuffer,
                                           pxStreamBuffer->pucBuffer,
                                           pxStreamBuffer->xLength,
@@ -698,6 +1877,55 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
                                           pxSendCallback,
                                           pxReceiveCallback );
 
+            #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+            {
+                /* Every reader starts again from the empty buffer. */
+                pxStreamBuffer->pxReaders = pxReaders;
+                pxStreamBuffer->uxReaderCount = uxReaderCount;
+
+                if( pxReaders != NULL )
+                {
+                    ( void ) memset( ( void * ) pxReaders, 0x00, ( size_t ) uxReaderCount * sizeof( StreamBufferReader_t ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+            {
+                /* Every stage starts again from the empty buffer, keeping its
+                 * trigger level. */
+                pxStreamBuffer->pxStages = pxStages;
+                pxStreamBuffer->uxStageCount = uxStageCount;
+
+                for( uxStage = ( UBaseType_t ) 0U; uxStage < uxStageCount; uxStage++ )
+                {
+                    pxStages[ uxStage ].xHead = ( size_t ) 0U;
+                }
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+            {
+                pxStreamBuffer->xMaxLatencyTicks = xMaxLatencyTicks;
+            }
+            #endif
+
+            #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+            {
+                /* The watermarks are kept, and the now empty buffer releases
+                 * flow control if it was asserted. */
+                pxStreamBuffer->xHighWatermarkBytes = xHighWatermarkBytes;
+                pxStreamBuffer->xLowWatermarkBytes = xLowWatermarkBytes;
+                pxStreamBuffer->pxWatermarkCallback = pxWatermarkCallback;
+                pxStreamBuffer->xAboveHighWatermark = xAboveHighWatermark;
+                prvCrossWatermarks( pxStreamBuffer, pdTRUE, NULL );
+            }
+            #endif
+
             #if ( configUSE_TRACE_FACILITY == 1 )
             {
                 pxStreamBuffer->uxStreamBufferNumber = uxStreamBufferNumber;
@@ -709,7 +1937,7 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
             xReturn = pdPASS;
         }
     }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
 
     traceRETURN_xStreamBufferResetFromISR( xReturn );
 
@@ -751,40 +1979,130 @@ BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
-size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
-{
-    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xSpace;
-    size_t xOriginalTail;
-
-    traceENTER_xStreamBufferSpacesAvailable( xStreamBuffer );
-
-    configASSERT( pxStreamBuffer );
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
 
-    /* The code below reads xTail and then xHead.  This is safe if the stream
-     * buffer is updated once between the two reads - but not if the stream buffer
-     * is updated more than once between the two reads - hence the loop. */
-    do
+    BaseType_t xStreamBufferSetMaxLatency( StreamBufferHandle_t xStreamBuffer,
+                                           TickType_t xMaxLatencyTicks )
     {
-        xOriginalTail = pxStreamBuffer->xTail;
-        xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
-        xSpace -= pxStreamBuffer->xHead;
-    } while( xOriginalTail != pxStreamBuffer->xTail );
-
-    xSpace -= ( size_t ) 1;
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
 
-    if( xSpace >= pxStreamBuffer->xLength )
-    {
-        xSpace -= pxStreamBuffer->xLength;
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
-    }
+        traceENTER_xStreamBufferSetMaxLatency( xStreamBuffer, xMaxLatencyTicks );
 
-    traceRETURN_xStreamBufferSpacesAvailable( xSpace );
+        configASSERT( pxStreamBuffer );
 
-    return xSpace;
+        /* Message buffers unblock the reader on every message, and broadcast
+         * stream buffers are read through their own receive functions, so the
+         * latency only applies to stream and stream batching buffers. */
+        if( ( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 ) &&
+            ( sbIS_BROADCAST( pxStreamBuffer ) == pdFALSE ) )
+        {
+            pxStreamBuffer->xMaxLatencyTicks = xMaxLatencyTicks;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        traceRETURN_xStreamBufferSetMaxLatency( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+
+    BaseType_t xStreamBufferSetWatermarks( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xHighWatermarkBytes,
+                                           size_t xLowWatermarkBytes,
+                                           StreamBufferWatermarkCallbackFunction_t pxWatermarkCallback )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+
+        traceENTER_xStreamBufferSetWatermarks( xStreamBuffer, xHighWatermarkBytes, xLowWatermarkBytes, pxWatermarkCallback );
+
+        configASSERT( pxStreamBuffer );
+
+        /* A NULL callback removes the watermarks.  Otherwise the high
+         * watermark must be above the low one, and below xLength as the buffer
+         * never holds more than xLength - 1 bytes. */
+        if( ( pxWatermarkCallback == NULL ) ||
+            ( ( xLowWatermarkBytes < xHighWatermarkBytes ) && ( xHighWatermarkBytes < pxStreamBuffer->xLength ) ) )
+        {
+            sbENTER_CRITICAL( pxStreamBuffer );
+            {
+                /* Release flow control asserted through the previous callback
+                 * before the new watermarks are checked. */
+                if( pxStreamBuffer->xAboveHighWatermark != pdFALSE )
+                {
+                    pxStreamBuffer->xAboveHighWatermark = pdFALSE;
+                    pxStreamBuffer->pxWatermarkCallback( pxStreamBuffer, pdFALSE, pdFALSE, NULL );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxStreamBuffer->xHighWatermarkBytes = xHighWatermarkBytes;
+                pxStreamBuffer->xLowWatermarkBytes = xLowWatermarkBytes;
+                pxStreamBuffer->pxWatermarkCallback = pxWatermarkCallback;
+                prvCrossWatermarks( pxStreamBuffer, pdFALSE, NULL );
+            }
+            sbEXIT_CRITICAL( pxStreamBuffer );
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xStreamBufferSetWatermarks( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_WATERMARKS */
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xSpace;
+    size_t xOriginalTail;
+
+    traceENTER_xStreamBufferSpacesAvailable( xStreamBuffer );
+
+    configASSERT( pxStreamBuffer );
+
+    /* The code below reads xTail and then xHead.  This is safe if the stream
+     * buffer is updated once between the two reads - but not if the stream buffer
+     * is updated more than once between the two reads - hence the loop. */
+    do
+    {
+        xOriginalTail = pxStreamBuffer->xTail;
+        xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
+        xSpace -= pxStreamBuffer->xHead;
+    } while( xOriginalTail != pxStreamBuffer->xTail );
+
+    xSpace -= ( size_t ) 1;
+
+    if( xSpace >= pxStreamBuffer->xLength )
+    {
+        xSpace -= pxStreamBuffer->xLength;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceRETURN_xStreamBufferSpacesAvailable( xSpace );
+
+    return xSpace;
 }
 /*-----------------------------------------------------------*/
 
@@ -805,22 +2123,17 @@ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer )
 }
 /*-----------------------------------------------------------*/
 
-size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
-                          const void * pvTxData,
-                          size_t xDataLengthBytes,
-                          TickType_t xTicksToWait )
+static size_t prvSend( StreamBuffer_t * const pxStreamBuffer,
+                       const StreamBufferSegment_t * const pxSegments,
+                       const UBaseType_t uxSegmentCount,
+                       size_t xDataLengthBytes,
+                       TickType_t xTicksToWait )
 {
-    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
     size_t xReturn, xSpace = 0;
     size_t xRequiredSpace = xDataLengthBytes;
     TimeOut_t xTimeOut;
     size_t xMaxReportedSpace = 0;
 
-    traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait );
-
-    configASSERT( pvTxData );
-    configASSERT( pxStreamBuffer );
-
     /* The maximum amount of space a stream buffer will ever report is its length
      * minus 1. */
     xMaxReportedSpace = pxStreamBuffer->xLength - ( size_t ) 1;
@@ -831,7 +2144,7 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
      * message. */
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
     {
-        xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        xRequiredSpace = sbPADDED_LENGTH( pxStreamBuffer, xRequiredSpace ) + sbMESSAGE_HEADER_BYTES( pxStreamBuffer, xDataLengthBytes );
 
         /* Overflow? */
         configASSERT( xRequiredSpace > xDataLengthBytes );
@@ -864,22 +2177,54 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         }
     }
 
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) )
+    {
+        /* A reader running on another core is likely to free the space soon,
+         * so poll for it before paying for the notification and the context
+         * switches of blocking. */
+        if( ( xTicksToWait != ( TickType_t ) 0 ) && ( prvSpinForSpace( pxStreamBuffer, xRequiredSpace ) != pdFALSE ) )
+        {
+            xTicksToWait = ( TickType_t ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) ) */
+
     if( xTicksToWait != ( TickType_t ) 0 )
     {
         vTaskSetTimeOutState( &xTimeOut );
 
         do
         {
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                /* Clearing the notification state enters the kernel critical
+                 * section so cannot be done while holding the stream buffer
+                 * lock.  A notification sent after this point is not lost. */
+                if( xStreamBufferSpacesAvailable( pxStreamBuffer ) < xRequiredSpace )
+                {
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                }
+            }
+            #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
             /* Wait until the required number of bytes are free in the message
              * buffer. */
-            taskENTER_CRITICAL();
+            sbENTER_CRITICAL( pxStreamBuffer );
             {
                 xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
 
                 if( xSpace < xRequiredSpace )
                 {
-                    /* Clear notification state as going to wait for space. */
-                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                    #if ( configUSE_GRANULAR_LOCKS == 0 )
+                    {
+                        /* Clear notification state as going to wait for space. */
+                        ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                    }
+                    #endif
 
                     /* Should only be one writer. */
                     configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
@@ -887,14 +2232,14 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
                 }
                 else
                 {
-                    taskEXIT_CRITICAL();
+                    sbEXIT_CRITICAL( pxStreamBuffer );
                     break;
                 }
             }
-            taskEXIT_CRITICAL();
+            sbEXIT_CRITICAL( pxStreamBuffer );
 
-            traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
-            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+            sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToWait );
             pxStreamBuffer->xTaskWaitingToSend = NULL;
         } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
     }
@@ -912,55 +2257,79 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pxSegments, uxSegmentCount, xDataLengthBytes, xSpace, xRequiredSpace, pdFALSE );
 
     if( xReturn > ( size_t ) 0 )
     {
-        traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+        traceSTREAM_BUFFER_SEND( pxStreamBuffer, xReturn );
+        sbSTATS_SENT( pxStreamBuffer, xReturn );
+        prvSTART_LATENCY_PERIOD( pxStreamBuffer, xReturn );
+        prvCHECK_WATERMARKS( pxStreamBuffer );
 
         /* Was a task waiting for the data? */
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
             prvSEND_COMPLETED( pxStreamBuffer );
+            prvBROADCAST_SEND_COMPLETED( pxStreamBuffer );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
+
+        prvPIPELINE_SEND_COMPLETED( pxStreamBuffer );
     }
     else
     {
         mtCOVERAGE_TEST_MARKER();
-        traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+        traceSTREAM_BUFFER_SEND_FAILED( pxStreamBuffer );
     }
 
-    traceRETURN_xStreamBufferSend( xReturn );
-
     return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
-                                 const void * pvTxData,
-                                 size_t xDataLengthBytes,
-                                 BaseType_t * const pxHigherPriorityTaskWoken )
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
+                          const void * pvTxData,
+                          size_t xDataLengthBytes,
+                          TickType_t xTicksToWait )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReturn, xSpace;
-    size_t xRequiredSpace = xDataLengthBytes;
+    StreamBufferSegment_t xSegment;
+    size_t xReturn;
 
-    traceENTER_xStreamBufferSendFromISR( xStreamBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken );
+    traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait );
 
     configASSERT( pvTxData );
     configASSERT( pxStreamBuffer );
 
+    /* The data is only read through the segment. */
+    xSegment.pvData = ( void * ) pvTxData;
+    xSegment.xLengthBytes = xDataLengthBytes;
+    xReturn = sbSEND( pxStreamBuffer, &xSegment, ( UBaseType_t ) 1U, xDataLengthBytes, xTicksToWait );
+
+    traceRETURN_xStreamBufferSend( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSendFromISR( StreamBuffer_t * const pxStreamBuffer,
+                              const StreamBufferSegment_t * const pxSegments,
+                              const UBaseType_t uxSegmentCount,
+                              size_t xDataLengthBytes,
+                              BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    size_t xReturn, xSpace;
+    size_t xRequiredSpace = xDataLengthBytes;
+
     /* This send function is used to write to both message buffers and stream
      * buffers.  If this is a message buffer then the space needed must be
      * increased by the amount of bytes needed to store the length of the
      * message. */
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
     {
-        xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        xRequiredSpace = sbPADDED_LENGTH( pxStreamBuffer, xRequiredSpace ) + sbMESSAGE_HEADER_BYTES( pxStreamBuffer, xDataLengthBytes );
     }
     else
     {
@@ -968,10 +2337,13 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
     }
 
     xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pxSegments, uxSegmentCount, xDataLengthBytes, xSpace, xRequiredSpace, pdTRUE );
 
     if( xReturn > ( size_t ) 0 )
     {
+        prvSTART_LATENCY_PERIOD_FROM_ISR( pxStreamBuffer, xReturn, pxHigherPriorityTaskWoken );
+        prvCHECK_WATERMARKS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
         /* Was a task waiting for the data? */
         if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
         {
@@ -979,147 +2351,422 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
             /* coverity[misra_c_2012_directive_4_7_violation] */
             prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            prvBROADCAST_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
+
+        prvPIPELINE_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
     }
     else
     {
         mtCOVERAGE_TEST_MARKER();
     }
 
-    traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
-    traceRETURN_xStreamBufferSendFromISR( xReturn );
+    traceSTREAM_BUFFER_SEND_FROM_ISR( pxStreamBuffer, xReturn );
+    sbSTATS_SENT( pxStreamBuffer, xReturn );
 
     return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
-                                       const void * pvTxData,
-                                       size_t xDataLengthBytes,
-                                       size_t xSpace,
-                                       size_t xRequiredSpace )
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
+                                 const void * pvTxData,
+                                 size_t xDataLengthBytes,
+                                 BaseType_t * const pxHigherPriorityTaskWoken )
 {
-    size_t xNextHead = pxStreamBuffer->xHead;
-    configMESSAGE_BUFFER_LENGTH_TYPE xMessageLength;
-
-    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
-    {
-        /* This is a message buffer, as opposed to a stream buffer. */
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    StreamBufferSegment_t xSegment;
+    size_t xReturn;
 
-        /* Convert xDataLengthBytes to the message length type. */
-        xMessageLength = ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes;
+    traceENTER_xStreamBufferSendFromISR( xStreamBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken );
 
-        /* Ensure the data length given fits within configMESSAGE_BUFFER_LENGTH_TYPE. */
-        configASSERT( ( size_t ) xMessageLength == xDataLengthBytes );
+    configASSERT( pvTxData );
+    configASSERT( pxStreamBuffer );
 
-        if( xSpace >= xRequiredSpace )
-        {
-            /* There is enough space to write both the message length and the message
-             * itself into the buffer.  Start by writing the length of the data, the data
-             * itself will be written later in this function. */
-            xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xMessageLength ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
-        }
-        else
-        {
-            /* Not enough space, so do not write data to the buffer. */
-            xDataLengthBytes = 0;
-        }
-    }
-    else
-    {
-        /* This is a stream buffer, as opposed to a message buffer, so writing a
-         * stream of bytes rather than discrete messages.  Plan to write as many
-         * bytes as possible. */
-        xDataLengthBytes = configMIN( xDataLengthBytes, xSpace );
-    }
+    /* The data is only read through the segment. */
+    xSegment.pvData = ( void * ) pvTxData;
+    xSegment.xLengthBytes = xDataLengthBytes;
+    xReturn = sbSEND_FROM_ISR( pxStreamBuffer, &xSegment, ( UBaseType_t ) 1U, xDataLengthBytes, pxHigherPriorityTaskWoken );
 
-    if( xDataLengthBytes != ( size_t ) 0 )
-    {
-        /* Write the data to the buffer. */
-        /* MISRA Ref 11.5.5 [Void pointer assignment] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-        /* coverity[misra_c_2012_rule_11_5_violation] */
-        pxStreamBuffer->xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, xNextHead );
-    }
+    traceRETURN_xStreamBufferSendFromISR( xReturn );
 
-    return xDataLengthBytes;
+    return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
-                             void * pvRxData,
-                             size_t xBufferLengthBytes,
-                             TickType_t xTicksToWait )
-{
-    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
 
-    traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait );
+    static size_t prvSendMultiProducer( StreamBuffer_t * const pxStreamBuffer,
+                                        const StreamBufferSegment_t * const pxSegments,
+                                        const UBaseType_t uxSegmentCount,
+                                        size_t xDataLengthBytes,
+                                        BaseType_t xFromISR,
+                                        BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        size_t xReturn = 0, xRequiredSpace, xReserved, xSpace, xStart, xNextHead, xPublishedBytes = 0;
+        uint32_t ulState, ulNewState;
 
-    configASSERT( pvRxData );
-    configASSERT( pxStreamBuffer );
+        /* This send function is used to write to both message buffers and
+         * stream buffers.  If this is a message buffer then the space needed
+         * must be increased by the amount of bytes needed to store the length
+         * of the message. */
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            #if ( configUSE_MESSAGE_BUFFER_VARINT_LENGTHS == 0 )
+            {
+                /* Ensure the data length given fits within configMESSAGE_BUFFER_LENGTH_TYPE. */
+                configASSERT( ( size_t ) ( ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes ) == xDataLengthBytes );
+            }
+            #endif
 
-    /* This receive function is used by both message buffers, which store
-     * discrete messages, and stream buffers, which store a continuous stream of
-     * bytes.  Discrete messages include an additional
-     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the
-     * message. */
-    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
-    {
-        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
-    }
-    else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
-    {
-        /* Force task to block if the batching buffer contains less bytes than
-         * the trigger level. */
-        xBytesToStoreMessageLength = pxStreamBuffer->xTriggerLevelBytes;
-    }
-    else
-    {
-        xBytesToStoreMessageLength = 0;
-    }
+            xRequiredSpace = sbPADDED_LENGTH( pxStreamBuffer, xDataLengthBytes ) + sbMESSAGE_HEADER_BYTES( pxStreamBuffer, xDataLengthBytes );
 
-    if( xTicksToWait != ( TickType_t ) 0 )
-    {
-        /* Checking if there is data and clearing the notification state must be
-         * performed atomically. */
-        taskENTER_CRITICAL();
+            /* Overflow? */
+            configASSERT( xRequiredSpace > xDataLengthBytes );
+        }
+        else
         {
-            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+            xRequiredSpace = xDataLengthBytes;
+        }
 
-            /* If this function was invoked by a message buffer read then
-             * xBytesToStoreMessageLength holds the number of bytes used to hold
-             * the length of the next discrete message.  If this function was
-             * invoked by a stream buffer read then xBytesToStoreMessageLength will
-             * be 0. If this function was invoked by a stream batch buffer read
-             * then xBytesToStoreMessageLength will be xTriggerLevelBytes value
-             * for the buffer.*/
-            if( xBytesAvailable <= xBytesToStoreMessageLength )
+        /* Reserve the space by moving the reservation head past it, counting
+         * this writer as one that has not yet committed.  The free space is
+         * measured from the reservation head rather than xHead, as the bytes
+         * other writers have reserved are not free.  The reader only moves
+         * xTail forward, so the space can only have grown by the time the
+         * reservation is made. */
+        do
+        {
+            ulState = pxStreamBuffer->ulProducerState;
+            xStart = sbPRODUCER_HEAD( ulState );
+
+            xSpace = ( pxStreamBuffer->xLength + pxStreamBuffer->xTail ) - xStart - ( size_t ) 1;
+
+            if( xSpace >= pxStreamBuffer->xLength )
             {
-                /* Clear notification state as going to wait for data. */
-                ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                xSpace -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                /* Should only be one reader. */
-                configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
-                pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+            {
+                /* A message is written whole or not at all. */
+                xReserved = ( xSpace >= xRequiredSpace ) ? xRequiredSpace : ( size_t ) 0;
+            }
+            else
+            {
+                /* Write as many bytes of the stream as possible. */
+                xReserved = configMIN( xRequiredSpace, xSpace );
+            }
+
+            xNextHead = xStart + xReserved;
+
+            if( xNextHead >= pxStreamBuffer->xLength )
+            {
+                xNextHead -= pxStreamBuffer->xLength;
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
-        }
-        taskEXIT_CRITICAL();
 
-        if( xBytesAvailable <= xBytesToStoreMessageLength )
+            configASSERT( sbPRODUCER_COUNT( ulState ) < sbPRODUCER_MAX_COUNT );
+            ulNewState = sbPRODUCER_STATE( sbPRODUCER_COUNT( ulState ) + 1U, xNextHead );
+        } while( ( xReserved != ( size_t ) 0 ) &&
+                 ( portATOMIC_COMPARE_AND_SWAP_U32( &( pxStreamBuffer->ulProducerState ), ulNewState, ulState ) == 0U ) );
+
+        if( xReserved != ( size_t ) 0 )
         {
-            /* Wait for data to be available. */
-            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
-            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
-            pxStreamBuffer->xTaskWaitingToReceive = NULL;
+            /* Write the data into the reserved space, which no other writer
+             * can touch and the reader cannot see. */
+            xNextHead = xStart;
+
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+            {
+                xNextHead = prvWriteMessageLength( pxStreamBuffer, xDataLengthBytes, xNextHead );
+                xReturn = xDataLengthBytes;
+            }
+            else
+            {
+                xReturn = xReserved;
+            }
+
+            ( void ) prvWriteSegmentsToBuffer( pxStreamBuffer, pxSegments, uxSegmentCount, xReturn, xNextHead );
+
+            /* The data must be in the buffer before the reader can be told
+             * about it. */
+            portMEMORY_BARRIER();
+
+            /* Commit the space.  A writer that is not the last to commit leaves
+             * the reservation head for the last writer to publish.  The last
+             * writer publishes the reservation head as xHead, which makes its
+             * own bytes, and those of every writer that committed before it,
+             * visible to the reader.  If another writer reserves space between
+             * the head being published and the commit, the compare and swap
+             * fails and this writer is no longer the last, but the head it
+             * published is still correct as the new reservation starts after
+             * it. */
+            do
+            {
+                ulState = pxStreamBuffer->ulProducerState;
+
+                if( sbPRODUCER_COUNT( ulState ) == ( uint32_t ) 1U )
+                {
+                    xNextHead = sbPRODUCER_HEAD( ulState );
+                    xPublishedBytes = ( pxStreamBuffer->xLength + xNextHead ) - pxStreamBuffer->xHead;
+
+                    if( xPublishedBytes >= pxStreamBuffer->xLength )
+                    {
+                        xPublishedBytes -= pxStreamBuffer->xLength;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    pxStreamBuffer->xHead = xNextHead;
+                }
+                else
+                {
+                    xPublishedBytes = 0;
+                }
+
+                ulNewState = ulState - sbPRODUCER_STATE( 1U, 0U );
+            } while( portATOMIC_COMPARE_AND_SWAP_U32( &( pxStreamBuffer->ulProducerState ), ulNewState, ulState ) == 0U );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            if( xFromISR != pdFALSE )
+            {
+                traceSTREAM_BUFFER_SEND_FROM_ISR( pxStreamBuffer, xReturn );
+            }
+            else
+            {
+                traceSTREAM_BUFFER_SEND( pxStreamBuffer, xReturn );
+            }
+
+            sbSTATS_SENT( pxStreamBuffer, xReturn );
+        }
+        else
+        {
+            if( xFromISR != pdFALSE )
+            {
+                traceSTREAM_BUFFER_SEND_FROM_ISR( pxStreamBuffer, xReturn );
+            }
+            else
+            {
+                traceSTREAM_BUFFER_SEND_FAILED( pxStreamBuffer );
+            }
+        }
+
+        /* Only the writer that published the head tells the reader about the
+         * data, which includes that of the writers that committed before it. */
+        if( xPublishedBytes > ( size_t ) 0 )
+        {
+            if( xFromISR != pdFALSE )
+            {
+                prvSTART_LATENCY_PERIOD_FROM_ISR( pxStreamBuffer, xPublishedBytes, pxHigherPriorityTaskWoken );
+                prvCHECK_WATERMARKS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
+                if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+                {
+                    prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+                    prvBROADCAST_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvPIPELINE_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                prvSTART_LATENCY_PERIOD( pxStreamBuffer, xPublishedBytes );
+                prvCHECK_WATERMARKS( pxStreamBuffer );
+
+                if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+                {
+                    prvSEND_COMPLETED( pxStreamBuffer );
+                    prvBROADCAST_SEND_COMPLETED( pxStreamBuffer );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvPIPELINE_SEND_COMPLETED( pxStreamBuffer );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                       const StreamBufferSegment_t * const pxSegments,
+                                       const UBaseType_t uxSegmentCount,
+                                       size_t xDataLengthBytes,
+                                       size_t xSpace,
+                                       size_t xRequiredSpace,
+                                       BaseType_t xFromISR )
+{
+    size_t xNextHead = pxStreamBuffer->xHead;
+
+    /* xFromISR is only used to tag messages. */
+    ( void ) xFromISR;
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* This is a message buffer, as opposed to a stream buffer. */
+
+        #if ( configUSE_MESSAGE_BUFFER_VARINT_LENGTHS == 0 )
+        {
+            /* Ensure the data length given fits within configMESSAGE_BUFFER_LENGTH_TYPE. */
+            configASSERT( ( size_t ) ( ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes ) == xDataLengthBytes );
+        }
+        #endif
+
+        if( xSpace >= xRequiredSpace )
+        {
+            /* There is enough space to write both the message length and the message
+             * itself into the buffer.  Start by writing the length of the data, the data
+             * itself will be written later in this function. */
+            xNextHead = prvWriteMessageLength( pxStreamBuffer, xDataLengthBytes, xNextHead );
+        }
+        else
+        {
+            /* Not enough space, so do not write data to the buffer. */
+            xDataLengthBytes = 0;
+        }
+    }
+    else
+    {
+        /* This is a stream buffer, as opposed to a message buffer, so writing a
+         * stream of bytes rather than discrete messages.  Plan to write as many
+         * bytes as possible. */
+        xDataLengthBytes = configMIN( xDataLengthBytes, xSpace );
+    }
+
+    if( xDataLengthBytes != ( size_t ) 0 )
+    {
+        /* Write the data to the buffer. */
+        xNextHead = prvWriteSegmentsToBuffer( pxStreamBuffer, pxSegments, uxSegmentCount, xDataLengthBytes, xNextHead );
+
+        #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+        {
+            /* Pad an aligned message so the next message is word aligned. */
+            xNextHead = prvSkipPadding( pxStreamBuffer, xNextHead, sbPADDED_LENGTH( pxStreamBuffer, xDataLengthBytes ) - xDataLengthBytes );
+        }
+        #endif
+
+        #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        {
+            /* The tag must be in place before the reader can see the
+             * message. */
+            prvStampMessageTag( pxStreamBuffer, xNextHead, xFromISR );
+        }
+        #endif
+
+        sbINTERPROCESSOR_BARRIER();
+        pxStreamBuffer->xHead = xNextHead;
+    }
+
+    return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitToReceive( StreamBuffer_t * const pxStreamBuffer,
+                                size_t xBytesToStoreMessageLength,
+                                TickType_t xTicksToWait )
+{
+    size_t xBytesAvailable;
+
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) )
+    {
+        /* A writer running on another core is likely to write the data
+         * soon. */
+        if( ( xTicksToWait != ( TickType_t ) 0 ) && ( prvSpinForData( pxStreamBuffer, xBytesToStoreMessageLength ) != pdFALSE ) )
+        {
+            xTicksToWait = ( TickType_t ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) ) */
+
+    if( xTicksToWait != ( TickType_t ) 0 )
+    {
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            /* Clearing the notification state enters the kernel critical
+             * section so cannot be done while holding the stream buffer lock.
+             * A notification sent after this point is not lost. */
+            if( prvBytesInBuffer( pxStreamBuffer ) <= xBytesToStoreMessageLength )
+            {
+                ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+            }
+        }
+        #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+        /* Checking if there is data and clearing the notification state must be
+         * performed atomically. */
+        sbENTER_CRITICAL( pxStreamBuffer );
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+            /* If this function was invoked by a message buffer read then
+             * xBytesToStoreMessageLength holds the number of bytes used to hold
+             * the length of the next discrete message.  If this function was
+             * invoked by a stream buffer read then xBytesToStoreMessageLength will
+             * be 0. If this function was invoked by a stream batch buffer read
+             * then xBytesToStoreMessageLength will be xTriggerLevelBytes value
+             * for the buffer.*/
+            if( xBytesAvailable <= xBytesToStoreMessageLength )
+            {
+                #if ( configUSE_GRANULAR_LOCKS == 0 )
+                {
+                    /* Clear notification state as going to wait for data. */
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                }
+                #endif
+
+                /* Should only be one reader. */
+                configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        sbEXIT_CRITICAL( pxStreamBuffer );
+
+        if( xBytesAvailable <= xBytesToStoreMessageLength )
+        {
+            /* Wait for data to be available. */
+            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+            sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToWait );
+            pxStreamBuffer->xTaskWaitingToReceive = NULL;
 
             /* Recheck the data available after blocking. */
             xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
@@ -1134,6 +2781,60 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
     }
 
+    return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReceive( StreamBuffer_t * const pxStreamBuffer,
+                          const StreamBufferSegment_t * const pxSegments,
+                          const UBaseType_t uxSegmentCount,
+                          size_t xBufferLengthBytes,
+                          TickType_t xTicksToWait )
+{
+    size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+    /* Broadcast stream buffers are read with xStreamBufferReceiveBroadcast(). */
+    sbASSERT_NOT_BROADCAST( pxStreamBuffer );
+
+    /* This receive function is used by both message buffers, which store
+     * discrete messages, and stream buffers, which store a continuous stream of
+     * bytes.  Discrete messages include an additional
+     * sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH or more bytes that hold the length of the
+     * message. */
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbMIN_MESSAGE_HEADER_BYTES( pxStreamBuffer );
+    }
+    else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* Force task to block if the batching buffer contains less bytes than
+         * the trigger level. */
+        xBytesToStoreMessageLength = pxStreamBuffer->xTriggerLevelBytes;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+    {
+        /* With a maximum latency the wait can end before the trigger level is
+         * reached, after which the available bytes are read without blocking
+         * again. */
+        if( ( pxStreamBuffer->xMaxLatencyTicks != ( TickType_t ) 0 ) && ( prvBytesInBuffer( pxStreamBuffer ) <= xBytesToStoreMessageLength ) )
+        {
+            xBytesToStoreMessageLength = prvWaitForMaxLatency( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+            xTicksToWait = ( TickType_t ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+
+    xBytesAvailable = prvWaitToReceive( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+
     /* Whether receiving a discrete message (where xBytesToStoreMessageLength
      * holds the number of bytes used to store the message length) or a stream of
      * bytes (where xBytesToStoreMessageLength is zero), the number of bytes
@@ -1141,13 +2842,15 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
      * read bytes from the buffer. */
     if( xBytesAvailable > xBytesToStoreMessageLength )
     {
-        xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable );
+        xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pxSegments, uxSegmentCount, xBufferLengthBytes, xBytesAvailable, pdFALSE );
 
         /* Was a task waiting for space in the buffer? */
         if( xReceivedLength != ( size_t ) 0 )
         {
-            traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
-            prvRECEIVE_COMPLETED( xStreamBuffer );
+            traceSTREAM_BUFFER_RECEIVE( pxStreamBuffer, xReceivedLength );
+            sbSTATS_RECEIVED( pxStreamBuffer, xReceivedLength );
+            prvCHECK_WATERMARKS( pxStreamBuffer );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
         }
         else
         {
@@ -1156,10 +2859,32 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
     }
     else
     {
-        traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+        traceSTREAM_BUFFER_RECEIVE_FAILED( pxStreamBuffer );
         mtCOVERAGE_TEST_MARKER();
     }
 
+    return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
+                             void * pvRxData,
+                             size_t xBufferLengthBytes,
+                             TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    StreamBufferSegment_t xSegment;
+    size_t xReceivedLength;
+
+    traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait );
+
+    configASSERT( pvRxData );
+    configASSERT( pxStreamBuffer );
+
+    xSegment.pvData = pvRxData;
+    xSegment.xLengthBytes = xBufferLengthBytes;
+    xReceivedLength = prvReceive( pxStreamBuffer, &xSegment, ( UBaseType_t ) 1U, xBufferLengthBytes, xTicksToWait );
+
     traceRETURN_xStreamBufferReceive( xReceivedLength );
 
     return xReceivedLength;
@@ -1170,7 +2895,6 @@ size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
     size_t xReturn, xBytesAvailable;
-    configMESSAGE_BUFFER_LENGTH_TYPE xTempReturn;
 
     traceENTER_xStreamBufferNextMessageLengthBytes( xStreamBuffer );
 
@@ -1181,20 +2905,19 @@ size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
     {
         xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
 
-        if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+        if( xBytesAvailable > sbMIN_MESSAGE_HEADER_BYTES( pxStreamBuffer ) )
         {
             /* The number of bytes available is greater than the number of bytes
              * required to hold the length of the next message, so another message
              * is available. */
-            ( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
-            xReturn = ( size_t ) xTempReturn;
+            ( void ) prvReadMessageLength( pxStreamBuffer, &xReturn, pxStreamBuffer->xTail );
         }
         else
         {
             /* The minimum amount of bytes in a message buffer is
-             * ( sbBYTES_TO_STORE_MESSAGE_LENGTH + 1 ), so if xBytesAvailable is
-             * less than sbBYTES_TO_STORE_MESSAGE_LENGTH the only other valid
-             * value is 0. */
+             * ( sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH + 1 ), so if xBytesAvailable
+             * is less than sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH the only other
+             * valid value is 0. */
             configASSERT( xBytesAvailable == 0 );
             xReturn = 0;
         }
@@ -1210,27 +2933,25 @@ size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
 }
 /*-----------------------------------------------------------*/
 
-size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
-                                    void * pvRxData,
-                                    size_t xBufferLengthBytes,
-                                    BaseType_t * const pxHigherPriorityTaskWoken )
+static size_t prvReceiveFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                 const StreamBufferSegment_t * const pxSegments,
+                                 const UBaseType_t uxSegmentCount,
+                                 size_t xBufferLengthBytes,
+                                 BaseType_t * const pxHigherPriorityTaskWoken )
 {
-    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
     size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 
-    traceENTER_xStreamBufferReceiveFromISR( xStreamBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken );
-
-    configASSERT( pvRxData );
-    configASSERT( pxStreamBuffer );
+    /* Broadcast stream buffers are read with xStreamBufferReceiveBroadcast(). */
+    sbASSERT_NOT_BROADCAST( pxStreamBuffer );
 
     /* This receive function is used by both message buffers, which store
      * discrete messages, and stream buffers, which store a continuous stream of
      * bytes.  Discrete messages include an additional
-     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the
+     * sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH or more bytes that hold the length of the
      * message. */
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
     {
-        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        xBytesToStoreMessageLength = sbMIN_MESSAGE_HEADER_BYTES( pxStreamBuffer );
     }
     else
     {
@@ -1246,11 +2967,13 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
      * read bytes from the buffer. */
     if( xBytesAvailable > xBytesToStoreMessageLength )
     {
-        xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable );
+        xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pxSegments, uxSegmentCount, xBufferLengthBytes, xBytesAvailable, pdTRUE );
 
         /* Was a task waiting for space in the buffer? */
         if( xReceivedLength != ( size_t ) 0 )
         {
+            prvCHECK_WATERMARKS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
             /* MISRA Ref 4.7.1 [Return value shall be checked] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
             /* coverity[misra_c_2012_directive_4_7_violation] */
@@ -1266,32 +2989,260 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength );
-    traceRETURN_xStreamBufferReceiveFromISR( xReceivedLength );
+    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( pxStreamBuffer, xReceivedLength );
+    sbSTATS_RECEIVED( pxStreamBuffer, xReceivedLength );
 
     return xReceivedLength;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
-                                        void * pvRxData,
-                                        size_t xBufferLengthBytes,
-                                        size_t xBytesAvailable )
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                    void * pvRxData,
+                                    size_t xBufferLengthBytes,
+                                    BaseType_t * const pxHigherPriorityTaskWoken )
 {
-    size_t xCount, xNextMessageLength;
-    configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
-    size_t xNextTail = pxStreamBuffer->xTail;
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    StreamBufferSegment_t xSegment;
+    size_t xReceivedLength;
 
-    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
-    {
-        /* A discrete message is being received.  First receive the length
-         * of the message. */
-        xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
-        xNextMessageLength = ( size_t ) xTempNextMessageLength;
+    traceENTER_xStreamBufferReceiveFromISR( xStreamBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken );
 
-        /* Reduce the number of bytes available by the number of bytes just
+    configASSERT( pvRxData );
+    configASSERT( pxStreamBuffer );
+
+    xSegment.pvData = pvRxData;
+    xSegment.xLengthBytes = xBufferLengthBytes;
+    xReceivedLength = prvReceiveFromISR( pxStreamBuffer, &xSegment, ( UBaseType_t ) 1U, xBufferLengthBytes, pxHigherPriorityTaskWoken );
+
+    traceRETURN_xStreamBufferReceiveFromISR( xReceivedLength );
+
+    return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_SEGMENTS == 1 )
+
+    size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+                               const StreamBufferSegment_t * const pxSegments,
+                               UBaseType_t uxSegmentCount,
+                               TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferSendV( xStreamBuffer, pxSegments, uxSegmentCount, xTicksToWait );
+
+        configASSERT( pxSegments );
+        configASSERT( pxStreamBuffer );
+
+        xReturn = sbSEND( pxStreamBuffer, pxSegments, uxSegmentCount, prvSegmentsLength( pxSegments, uxSegmentCount ), xTicksToWait );
+
+        traceRETURN_xStreamBufferSendV( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_SEGMENTS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_SEGMENTS == 1 )
+
+    size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                      const StreamBufferSegment_t * const pxSegments,
+                                      UBaseType_t uxSegmentCount,
+                                      BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferSendVFromISR( xStreamBuffer, pxSegments, uxSegmentCount, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxSegments );
+        configASSERT( pxStreamBuffer );
+
+        xReturn = sbSEND_FROM_ISR( pxStreamBuffer, pxSegments, uxSegmentCount, prvSegmentsLength( pxSegments, uxSegmentCount ), pxHigherPriorityTaskWoken );
+
+        traceRETURN_xStreamBufferSendVFromISR( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_SEGMENTS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_SEGMENTS == 1 )
+
+    size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+                                  const StreamBufferSegment_t * const pxSegments,
+                                  UBaseType_t uxSegmentCount,
+                                  TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferReceiveV( xStreamBuffer, pxSegments, uxSegmentCount, xTicksToWait );
+
+        configASSERT( pxSegments );
+        configASSERT( pxStreamBuffer );
+
+        xReturn = prvReceive( pxStreamBuffer, pxSegments, uxSegmentCount, prvSegmentsLength( pxSegments, uxSegmentCount ), xTicksToWait );
+
+        traceRETURN_xStreamBufferReceiveV( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_SEGMENTS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_SEGMENTS == 1 )
+
+    size_t xStreamBufferReceiveVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                         const StreamBufferSegment_t * const pxSegments,
+                                         UBaseType_t uxSegmentCount,
+                                         BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferReceiveVFromISR( xStreamBuffer, pxSegments, uxSegmentCount, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxSegments );
+        configASSERT( pxStreamBuffer );
+
+        xReturn = prvReceiveFromISR( pxStreamBuffer, pxSegments, uxSegmentCount, prvSegmentsLength( pxSegments, uxSegmentCount ), pxHigherPriorityTaskWoken );
+
+        traceRETURN_xStreamBufferReceiveVFromISR( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_SEGMENTS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_MESSAGE_BUFFER_BATCH_RECEIVE == 1 )
+
+    size_t xStreamBufferReceiveBatch( StreamBufferHandle_t xStreamBuffer,
+                                      void * pvRxData,
+                                      size_t xBufferLengthBytes,
+                                      size_t * const pxMessageOffsets,
+                                      size_t xMaxMessages,
+                                      size_t * const pxMessageCount,
+                                      TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        uint8_t * const pucRxData = ( uint8_t * ) pvRxData;
+        StreamBufferSegment_t xSegment;
+        size_t xBytesAvailable, xMessageLength, xReceivedLength = 0, xMessages = 0;
+
+        traceENTER_xStreamBufferReceiveBatch( xStreamBuffer, pvRxData, xBufferLengthBytes, pxMessageOffsets, xMaxMessages, pxMessageCount, xTicksToWait );
+
+        configASSERT( pvRxData );
+        configASSERT( pxMessageOffsets );
+        configASSERT( pxMessageCount );
+        configASSERT( pxStreamBuffer );
+
+        /* Only message buffers hold discrete messages to batch. */
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
+        sbASSERT_NOT_BROADCAST( pxStreamBuffer );
+
+        /* Block for the first message only.  Messages that arrive while the
+         * batch is being read are included if they fit. */
+        xBytesAvailable = prvWaitToReceive( pxStreamBuffer, sbMIN_MESSAGE_HEADER_BYTES( pxStreamBuffer ), xTicksToWait );
+
+        while( ( xMessages < xMaxMessages ) && ( xBytesAvailable > sbMIN_MESSAGE_HEADER_BYTES( pxStreamBuffer ) ) )
+        {
+            /* prvReadMessageFromBuffer() leaves a message that does not fit in
+             * the remaining space in the buffer, which ends the batch. */
+            xSegment.pvData = &( pucRxData[ xReceivedLength ] );
+            xSegment.xLengthBytes = xBufferLengthBytes - xReceivedLength;
+            xMessageLength = prvReadMessageFromBuffer( pxStreamBuffer, &xSegment, ( UBaseType_t ) 1U, xSegment.xLengthBytes, xBytesAvailable, pdFALSE );
+
+            if( xMessageLength != ( size_t ) 0 )
+            {
+                traceSTREAM_BUFFER_RECEIVE( pxStreamBuffer, xMessageLength );
+                sbSTATS_RECEIVED( pxStreamBuffer, xMessageLength );
+
+                pxMessageOffsets[ xMessages ] = xReceivedLength;
+                xReceivedLength += xMessageLength;
+                xMessages++;
+                xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+            }
+            else
+            {
+                xBytesAvailable = 0;
+            }
+        }
+
+        /* The space freed by the whole batch is reported to a waiting writer
+         * with a single notification. */
+        if( xMessages != ( size_t ) 0 )
+        {
+            prvCHECK_WATERMARKS( pxStreamBuffer );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            traceSTREAM_BUFFER_RECEIVE_FAILED( pxStreamBuffer );
+        }
+
+        *pxMessageCount = xMessages;
+
+        traceRETURN_xStreamBufferReceiveBatch( xReceivedLength );
+
+        return xReceivedLength;
+    }
+
+    #endif /* configUSE_MESSAGE_BUFFER_BATCH_RECEIVE */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_SEGMENTS == 1 )
+
+    static size_t prvSegmentsLength( const StreamBufferSegment_t * const pxSegments,
+                                     const UBaseType_t uxSegmentCount )
+    {
+        UBaseType_t uxSegment;
+        size_t xLength = 0;
+
+        for( uxSegment = ( UBaseType_t ) 0U; uxSegment < uxSegmentCount; uxSegment++ )
+        {
+            /* Check for addition overflow. */
+            configASSERT( ( SIZE_MAX - xLength ) >= pxSegments[ uxSegment ].xLengthBytes );
+            xLength += pxSegments[ uxSegment ].xLengthBytes;
+        }
+
+        return xLength;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_SEGMENTS */
+/*-----------------------------------------------------------*/
+
+static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                        const StreamBufferSegment_t * const pxSegments,
+                                        const UBaseType_t uxSegmentCount,
+                                        size_t xBufferLengthBytes,
+                                        size_t xBytesAvailable,
+                                        BaseType_t xFromISR )
+{
+    size_t xCount, xNextMessageLength;
+    size_t xNextTail = pxStreamBuffer->xTail;
+
+    /* xFromISR is only used to record the latency of tagged messages. */
+    ( void ) xFromISR;
+
+    /* The bytes counted as available must not be read before the head that
+     * published them. */
+    sbINTERPROCESSOR_BARRIER();
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* A discrete message is being received.  First receive the length
+         * of the message. */
+        xNextTail = prvReadMessageLength( pxStreamBuffer, &xNextMessageLength, xNextTail );
+
+        /* Reduce the number of bytes available by the number of bytes just
          * read out. */
-        xBytesAvailable -= sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        xBytesAvailable -= sbMESSAGE_HEADER_BYTES( pxStreamBuffer, xNextMessageLength );
 
         /* Check there is enough space in the buffer provided by the
          * user. */
@@ -1318,10 +3269,24 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
     if( xCount != ( size_t ) 0 )
     {
         /* Read the actual data and update the tail to mark the data as officially consumed. */
-        /* MISRA Ref 11.5.5 [Void pointer assignment] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-        /* coverity[misra_c_2012_rule_11_5_violation] */
-        pxStreamBuffer->xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, xNextTail );
+        xNextTail = prvReadSegmentsFromBuffer( pxStreamBuffer, pxSegments, uxSegmentCount, xCount, xNextTail );
+
+        #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+        {
+            /* Step over the padding that follows the data of an aligned
+             * message. */
+            xNextTail = prvSkipPadding( pxStreamBuffer, xNextTail, sbPADDED_LENGTH( pxStreamBuffer, xCount ) - xCount );
+        }
+        #endif
+
+        #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+        {
+            prvReceiveMessageTag( pxStreamBuffer, xNextTail, xFromISR );
+        }
+        #endif
+
+        sbINTERPROCESSOR_BARRIER();
+        pxStreamBuffer->xTail = xNextTail;
     }
 
     return xCount;
@@ -1341,7 +3306,7 @@ BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
     /* True if no bytes are available. */
     xTail = pxStreamBuffer->xTail;
 
-    if( pxStreamBuffer->xHead == xTail )
+    if( sbREADABLE_HEAD( pxStreamBuffer ) == xTail )
     {
         xReturn = pdTRUE;
     }
@@ -1369,10 +3334,11 @@ BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
     /* This generic version of the receive function is used by both message
      * buffers, which store discrete messages, and stream buffers, which store a
      * continuous stream of bytes.  Discrete messages include an additional
-     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
+     * sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH or more bytes that hold the length of
+     * the message. */
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
     {
-        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+        xBytesToStoreMessageLength = sbMIN_MESSAGE_HEADER_BYTES( pxStreamBuffer );
     }
     else
     {
@@ -1409,7 +3375,7 @@ BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
     {
         if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
         {
@@ -1423,165 +3389,2009 @@ BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer
         }
         else
         {
-            xReturn = pdFALSE;
+            xReturn = pdFALSE;
+        }
+    }
+    sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
+
+    traceRETURN_xStreamBufferSendCompletedFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                 BaseType_t * pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    traceENTER_xStreamBufferReceiveCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxStreamBuffer );
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
+    {
+        if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )
+        {
+            ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,
+                                                ( pxStreamBuffer )->uxNotificationIndex,
+                                                ( uint32_t ) 0,
+                                                eNoAction,
+                                                pxHigherPriorityTaskWoken );
+            ( pxStreamBuffer )->xTaskWaitingToSend = NULL;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+    }
+    sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
+
+    traceRETURN_xStreamBufferReceiveCompletedFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferGetWriteRegion( StreamBufferHandle_t xStreamBuffer,
+                                        uint8_t ** ppucRegion,
+                                        TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferGetWriteRegion( xStreamBuffer, ppucRegion, xTicksToWait );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ppucRegion );
+
+        /* The length of each message must be written in front of it, so a
+         * message buffer cannot be written in place.  Nor can a multi-producer
+         * stream buffer, as the region is not reserved. */
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+        sbASSERT_NOT_MULTI_PRODUCER( pxStreamBuffer );
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            prvWaitForRegion( pxStreamBuffer, pdTRUE, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        *ppucRegion = &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xHead ] );
+        xReturn = prvContiguousSpaceAtHead( pxStreamBuffer );
+
+        traceRETURN_xStreamBufferGetWriteRegion( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBytesWritten )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferCommitWrite( xStreamBuffer, xBytesWritten );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+        xReturn = prvCommitBytesAtHead( pxStreamBuffer, xBytesWritten );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+            sbSTATS_SENT( pxStreamBuffer, xReturn );
+            prvSTART_LATENCY_PERIOD( pxStreamBuffer, xReturn );
+            prvCHECK_WATERMARKS( pxStreamBuffer );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                prvSEND_COMPLETED( pxStreamBuffer );
+                prvBROADCAST_SEND_COMPLETED( pxStreamBuffer );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvPIPELINE_SEND_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferCommitWrite( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xBytesWritten,
+                                            BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferCommitWriteFromISR( xStreamBuffer, xBytesWritten, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+        xReturn = prvCommitBytesAtHead( pxStreamBuffer, xBytesWritten );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            prvSTART_LATENCY_PERIOD_FROM_ISR( pxStreamBuffer, xReturn, pxHigherPriorityTaskWoken );
+            prvCHECK_WATERMARKS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+            {
+                /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                /* coverity[misra_c_2012_directive_4_7_violation] */
+                prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+                prvBROADCAST_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvPIPELINE_SEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+        sbSTATS_SENT( pxStreamBuffer, xReturn );
+        traceRETURN_xStreamBufferCommitWriteFromISR( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferGetReadRegion( StreamBufferHandle_t xStreamBuffer,
+                                       uint8_t ** ppucRegion,
+                                       TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferGetReadRegion( xStreamBuffer, ppucRegion, xTicksToWait );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ppucRegion );
+
+        /* The bytes of a message buffer must be read one whole message at a
+         * time. */
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+        sbASSERT_NOT_BROADCAST( pxStreamBuffer );
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            prvWaitForRegion( pxStreamBuffer, pdFALSE, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        *ppucRegion = &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xTail ] );
+        xReturn = prvContiguousBytesAtTail( pxStreamBuffer );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            sbINVALIDATE_STORAGE( *ppucRegion, xReturn );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferGetReadRegion( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferConsume( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xBytesRead )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferConsume( xStreamBuffer, xBytesRead );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+        sbASSERT_NOT_BROADCAST( pxStreamBuffer );
+
+        xReturn = prvConsumeBytesAtTail( pxStreamBuffer, xBytesRead );
+
+        /* Was a task waiting for space in the buffer? */
+        if( xReturn > ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReturn );
+            sbSTATS_RECEIVED( pxStreamBuffer, xReturn );
+            prvCHECK_WATERMARKS( pxStreamBuffer );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferConsume( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xBytesRead,
+                                        BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferConsumeFromISR( xStreamBuffer, xBytesRead, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+        sbASSERT_NOT_BROADCAST( pxStreamBuffer );
+
+        xReturn = prvConsumeBytesAtTail( pxStreamBuffer, xBytesRead );
+
+        /* Was a task waiting for space in the buffer? */
+        if( xReturn > ( size_t ) 0 )
+        {
+            prvCHECK_WATERMARKS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReturn );
+        sbSTATS_RECEIVED( pxStreamBuffer, xReturn );
+        traceRETURN_xStreamBufferConsumeFromISR( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferReceiveBroadcast( StreamBufferHandle_t xStreamBuffer,
+                                          UBaseType_t uxReader,
+                                          void * pvRxData,
+                                          size_t xBufferLengthBytes,
+                                          TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        StreamBufferReader_t * pxReader;
+        size_t xReceivedLength = 0, xBytesAvailable, xNextTail;
+
+        traceENTER_xStreamBufferReceiveBroadcast( xStreamBuffer, uxReader, pvRxData, xBufferLengthBytes, xTicksToWait );
+
+        configASSERT( pvRxData );
+        configASSERT( pxStreamBuffer );
+        configASSERT( uxReader < pxStreamBuffer->uxReaderCount );
+
+        pxReader = &( pxStreamBuffer->pxReaders[ uxReader ] );
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                /* Clearing the notification state enters the kernel critical
+                 * section so cannot be done while holding the stream buffer lock.
+                 * A notification sent after this point is not lost. */
+                if( prvBytesAfterTail( pxStreamBuffer, pxReader->xTail ) == ( size_t ) 0 )
+                {
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                }
+            }
+            #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+            /* Checking if there is data and clearing the notification state must
+             * be performed atomically. */
+            sbENTER_CRITICAL( pxStreamBuffer );
+            {
+                xBytesAvailable = prvBytesAfterTail( pxStreamBuffer, pxReader->xTail );
+
+                if( xBytesAvailable == ( size_t ) 0 )
+                {
+                    #if ( configUSE_GRANULAR_LOCKS == 0 )
+                    {
+                        /* Clear notification state as going to wait for data. */
+                        ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                    }
+                    #endif
+
+                    /* Should only be one task reading through each reader. */
+                    configASSERT( pxReader->xTaskWaitingToReceive == NULL );
+                    pxReader->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            sbEXIT_CRITICAL( pxStreamBuffer );
+
+            if( xBytesAvailable == ( size_t ) 0 )
+            {
+                /* Wait for data to be available. */
+                traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+                sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToWait );
+                pxReader->xTaskWaitingToReceive = NULL;
+
+                /* Recheck the data available after blocking. */
+                xBytesAvailable = prvBytesAfterTail( pxStreamBuffer, pxReader->xTail );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xBytesAvailable = prvBytesAfterTail( pxStreamBuffer, pxReader->xTail );
+        }
+
+        xReceivedLength = configMIN( xBufferLengthBytes, xBytesAvailable );
+
+        if( xReceivedLength != ( size_t ) 0 )
+        {
+            /* The writer cannot reuse the space until the stream buffer's own
+             * tail has moved past it, so the data can be copied out before this
+             * reader's tail is moved. */
+            /* MISRA Ref 11.5.5 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xReceivedLength, pxReader->xTail );
+
+            sbENTER_CRITICAL( pxStreamBuffer );
+            {
+                prvAdvanceReaderTail( pxStreamBuffer, pxReader, xNextTail );
+                sbSTATS_RECEIVED( pxStreamBuffer, xReceivedLength );
+            }
+            sbEXIT_CRITICAL( pxStreamBuffer );
+
+            /* Was a task waiting for space in the buffer? */
+            traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
+            prvCHECK_WATERMARKS( pxStreamBuffer );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferReceiveBroadcast( xReceivedLength );
+
+        return xReceivedLength;
+    }
+
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferReceiveBroadcastFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                 UBaseType_t uxReader,
+                                                 void * pvRxData,
+                                                 size_t xBufferLengthBytes,
+                                                 BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        StreamBufferReader_t * pxReader;
+        size_t xReceivedLength, xNextTail;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_xStreamBufferReceiveBroadcastFromISR( xStreamBuffer, uxReader, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken );
+
+        configASSERT( pvRxData );
+        configASSERT( pxStreamBuffer );
+        configASSERT( uxReader < pxStreamBuffer->uxReaderCount );
+
+        pxReader = &( pxStreamBuffer->pxReaders[ uxReader ] );
+        xReceivedLength = configMIN( xBufferLengthBytes, prvBytesAfterTail( pxStreamBuffer, pxReader->xTail ) );
+
+        if( xReceivedLength != ( size_t ) 0 )
+        {
+            /* MISRA Ref 11.5.5 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xReceivedLength, pxReader->xTail );
+
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
+            {
+                prvAdvanceReaderTail( pxStreamBuffer, pxReader, xNextTail );
+                sbSTATS_RECEIVED( pxStreamBuffer, xReceivedLength );
+            }
+            sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
+
+            prvCHECK_WATERMARKS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength );
+        traceRETURN_xStreamBufferReceiveBroadcastFromISR( xReceivedLength );
+
+        return xReceivedLength;
+    }
+
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+    size_t xStreamBufferBroadcastBytesAvailable( StreamBufferHandle_t xStreamBuffer,
+                                                 UBaseType_t uxReader )
+    {
+        const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferBroadcastBytesAvailable( xStreamBuffer, uxReader );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( uxReader < pxStreamBuffer->uxReaderCount );
+
+        xReturn = prvBytesAfterTail( pxStreamBuffer, pxStreamBuffer->pxReaders[ uxReader ].xTail );
+
+        traceRETURN_xStreamBufferBroadcastBytesAvailable( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+
+    size_t xStreamBufferGetStageRegion( StreamBufferHandle_t xStreamBuffer,
+                                        UBaseType_t uxStage,
+                                        uint8_t ** ppucRegion,
+                                        TickType_t xTicksToWait )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        StreamBufferStage_t * pxStage;
+        size_t xBytesAvailable;
+
+        traceENTER_xStreamBufferGetStageRegion( xStreamBuffer, uxStage, ppucRegion, xTicksToWait );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( ppucRegion );
+        configASSERT( uxStage < pxStreamBuffer->uxStageCount );
+
+        pxStage = &( pxStreamBuffer->pxStages[ uxStage ] );
+
+        if( xTicksToWait != ( TickType_t ) 0 )
+        {
+            #if ( configUSE_GRANULAR_LOCKS == 1 )
+            {
+                /* Clearing the notification state enters the kernel critical
+                 * section so cannot be done while holding the stream buffer lock.
+                 * A notification sent after this point is not lost. */
+                if( prvBytesForStage( pxStreamBuffer, uxStage ) < pxStage->xTriggerLevelBytes )
+                {
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                }
+            }
+            #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+            /* Checking the bytes waiting for the stage and clearing the
+             * notification state must be performed atomically. */
+            sbENTER_CRITICAL( pxStreamBuffer );
+            {
+                xBytesAvailable = prvBytesForStage( pxStreamBuffer, uxStage );
+
+                if( xBytesAvailable < pxStage->xTriggerLevelBytes )
+                {
+                    #if ( configUSE_GRANULAR_LOCKS == 0 )
+                    {
+                        /* Clear notification state as going to wait for data. */
+                        ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                    }
+                    #endif
+
+                    /* Should only be one task processing each stage. */
+                    configASSERT( pxStage->xTaskWaitingToReceive == NULL );
+                    pxStage->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            sbEXIT_CRITICAL( pxStreamBuffer );
+
+            if( xBytesAvailable < pxStage->xTriggerLevelBytes )
+            {
+                /* Wait for the stage's trigger level to be reached. */
+                traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+                sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToWait );
+                pxStage->xTaskWaitingToReceive = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Only this stage moves its own head, so the region can only grow
+         * while the stage is using it. */
+        *ppucRegion = &( pxStreamBuffer->pucBuffer[ pxStage->xHead ] );
+        xBytesAvailable = configMIN( prvBytesForStage( pxStreamBuffer, uxStage ), pxStreamBuffer->xLength - pxStage->xHead );
+
+        if( xBytesAvailable > ( size_t ) 0 )
+        {
+            sbINVALIDATE_STORAGE( *ppucRegion, xBytesAvailable );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferGetStageRegion( xBytesAvailable );
+
+        return xBytesAvailable;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+
+    size_t xStreamBufferCommitStage( StreamBufferHandle_t xStreamBuffer,
+                                     UBaseType_t uxStage,
+                                     size_t xBytesProcessed )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferCommitStage( xStreamBuffer, uxStage, xBytesProcessed );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( uxStage < pxStreamBuffer->uxStageCount );
+
+        xReturn = prvCommitStage( pxStreamBuffer, uxStage, xBytesProcessed );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            if( ( uxStage + ( UBaseType_t ) 1U ) < pxStreamBuffer->uxStageCount )
+            {
+                prvNotifyStage( pxStreamBuffer, uxStage + ( UBaseType_t ) 1U );
+            }
+            else
+            {
+                /* The last stage is the writer as far as the reader is
+                 * concerned. */
+                prvSTART_LATENCY_PERIOD( pxStreamBuffer, xReturn );
+
+                if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+                {
+                    prvSEND_COMPLETED( pxStreamBuffer );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferCommitStage( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+
+    size_t xStreamBufferCommitStageFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            UBaseType_t uxStage,
+                                            size_t xBytesProcessed,
+                                            BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xReturn;
+
+        traceENTER_xStreamBufferCommitStageFromISR( xStreamBuffer, uxStage, xBytesProcessed, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( uxStage < pxStreamBuffer->uxStageCount );
+
+        xReturn = prvCommitStage( pxStreamBuffer, uxStage, xBytesProcessed );
+
+        if( xReturn > ( size_t ) 0 )
+        {
+            if( ( uxStage + ( UBaseType_t ) 1U ) < pxStreamBuffer->uxStageCount )
+            {
+                prvNotifyStageFromISR( pxStreamBuffer, uxStage + ( UBaseType_t ) 1U, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                prvSTART_LATENCY_PERIOD_FROM_ISR( pxStreamBuffer, xReturn, pxHigherPriorityTaskWoken );
+
+                if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+                {
+                    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                    /* coverity[misra_c_2012_directive_4_7_violation] */
+                    prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xStreamBufferCommitStageFromISR( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+
+    BaseType_t xStreamBufferSetStageTriggerLevel( StreamBufferHandle_t xStreamBuffer,
+                                                  UBaseType_t uxStage,
+                                                  size_t xTriggerLevel )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+
+        traceENTER_xStreamBufferSetStageTriggerLevel( xStreamBuffer, uxStage, xTriggerLevel );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( uxStage < pxStreamBuffer->uxStageCount );
+
+        /* It is not valid for the trigger level to be 0. */
+        if( xTriggerLevel == ( size_t ) 0 )
+        {
+            xTriggerLevel = ( size_t ) 1;
+        }
+
+        /* The trigger level is the number of bytes that must be waiting for the
+         * stage before a task that is blocked on it is unblocked. */
+        if( xTriggerLevel < pxStreamBuffer->xLength )
+        {
+            pxStreamBuffer->pxStages[ uxStage ].xTriggerLevelBytes = xTriggerLevel;
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        traceRETURN_xStreamBufferSetStageTriggerLevel( xReturn );
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                     const uint8_t * pucData,
+                                     size_t xCount,
+                                     size_t xHead )
+{
+    size_t xFirstLength;
+
+    configASSERT( xCount > ( size_t ) 0 );
+
+    /* Calculate the number of bytes that can be added in the first write -
+     * which may be less than the total number of bytes that need to be added if
+     * the buffer will wrap back to the beginning. */
+    xFirstLength = configMIN( pxStreamBuffer->xLength - xHead, xCount );
+
+    /* Write as many bytes as can be written in the first write. */
+    configASSERT( ( xHead + xFirstLength ) <= pxStreamBuffer->xLength );
+    ( void ) memcpy( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength );
+    sbCLEAN_STORAGE( &( pxStreamBuffer->pucBuffer[ xHead ] ), xFirstLength );
+
+    /* If the number of bytes written was less than the number that could be
+     * written in the first write... */
+    if( xCount > xFirstLength )
+    {
+        /* ...then write the remaining bytes to the start of the buffer. */
+        configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
+        ( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
+        sbCLEAN_STORAGE( pxStreamBuffer->pucBuffer, xCount - xFirstLength );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    xHead += xCount;
+
+    if( xHead >= pxStreamBuffer->xLength )
+    {
+        xHead -= pxStreamBuffer->xLength;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteMessageLength( StreamBuffer_t * const pxStreamBuffer,
+                                     size_t xMessageLength,
+                                     size_t xHead )
+{
+    #if ( configUSE_MESSAGE_BUFFER_VARINT_LENGTHS == 1 )
+        uint8_t ucHeader[ sbMAX_BYTES_TO_STORE_MESSAGE_LENGTH ];
+        size_t xHeaderBytes = 0;
+
+        do
+        {
+            ucHeader[ xHeaderBytes ] = ( uint8_t ) ( xMessageLength & ( size_t ) 0x7FU );
+            xMessageLength >>= 7;
+
+            if( xMessageLength != ( size_t ) 0U )
+            {
+                ucHeader[ xHeaderBytes ] |= ( uint8_t ) 0x80U;
+            }
+
+            xHeaderBytes++;
+        } while( xMessageLength != ( size_t ) 0U );
+    #else
+        const configMESSAGE_BUFFER_LENGTH_TYPE xHeader = ( configMESSAGE_BUFFER_LENGTH_TYPE ) xMessageLength;
+        const uint8_t * const ucHeader = ( const uint8_t * ) &xHeader;
+        const size_t xHeaderBytes = sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH;
+    #endif /* configUSE_MESSAGE_BUFFER_VARINT_LENGTHS */
+
+    xHead = prvWriteBytesToBuffer( pxStreamBuffer, ucHeader, xHeaderBytes, xHead );
+
+    #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+    {
+        /* Start the data of an aligned message on a word boundary. */
+        xHead = prvSkipPadding( pxStreamBuffer, xHead, sbPADDED_LENGTH( pxStreamBuffer, xHeaderBytes ) - xHeaderBytes );
+    }
+    #endif
+
+    return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadMessageLength( StreamBuffer_t * const pxStreamBuffer,
+                                    size_t * const pxMessageLength,
+                                    size_t xTail )
+{
+    #if ( configUSE_MESSAGE_BUFFER_VARINT_LENGTHS == 1 )
+        uint8_t ucByte;
+        size_t xHeaderBytes = 0;
+        size_t xMessageLength = 0;
+
+        /* A message's header is written along with its data, so the whole
+         * header is in the buffer if any of it is. */
+        do
+        {
+            xTail = prvReadBytesFromBuffer( pxStreamBuffer, &ucByte, ( size_t ) 1U, xTail );
+            xMessageLength |= ( ( size_t ) ( ucByte & ( uint8_t ) 0x7FU ) ) << ( xHeaderBytes * ( size_t ) 7U );
+            xHeaderBytes++;
+        } while( ( ( ucByte & ( uint8_t ) 0x80U ) != ( uint8_t ) 0U ) && ( xHeaderBytes < sbMAX_BYTES_TO_STORE_MESSAGE_LENGTH ) );
+    #else
+        configMESSAGE_BUFFER_LENGTH_TYPE xHeader;
+        const size_t xHeaderBytes = sbMIN_BYTES_TO_STORE_MESSAGE_LENGTH;
+        size_t xMessageLength;
+
+        xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xHeader, xHeaderBytes, xTail );
+        xMessageLength = ( size_t ) xHeader;
+    #endif /* configUSE_MESSAGE_BUFFER_VARINT_LENGTHS */
+
+    #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+    {
+        /* Step over the padding that follows the length of an aligned
+         * message. */
+        xTail = prvSkipPadding( pxStreamBuffer, xTail, sbPADDED_LENGTH( pxStreamBuffer, xHeaderBytes ) - xHeaderBytes );
+    }
+    #endif
+
+    *pxMessageLength = xMessageLength;
+
+    return xTail;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MESSAGE_BUFFER_VARINT_LENGTHS == 1 )
+
+    static size_t prvVarintLength( size_t xLength )
+    {
+        size_t xBytes = 1;
+
+        while( xLength > ( size_t ) 0x7FU )
+        {
+            xLength >>= 7;
+            xBytes++;
+        }
+
+        return xBytes;
+    }
+
+#endif /* configUSE_MESSAGE_BUFFER_VARINT_LENGTHS */
+/*-----------------------------------------------------------*/
+
+static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                      uint8_t * pucData,
+                                      size_t xCount,
+                                      size_t xTail )
+{
+    size_t xFirstLength;
+
+    configASSERT( xCount != ( size_t ) 0 );
+
+    /* Calculate the number of bytes that can be read - which may be
+     * less than the number wanted if the data wraps around to the start of
+     * the buffer. */
+    xFirstLength = configMIN( pxStreamBuffer->xLength - xTail, xCount );
+
+    /* Obtain the number of bytes it is possible to obtain in the first
+     * read.  Asserts check bounds of read and write. */
+    configASSERT( xFirstLength <= xCount );
+    configASSERT( ( xTail + xFirstLength ) <= pxStreamBuffer->xLength );
+    sbINVALIDATE_STORAGE( &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
+    ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
+
+    /* If the total number of wanted bytes is greater than the number
+     * that could be read in the first read... */
+    if( xCount > xFirstLength )
+    {
+        /* ...then read the remaining bytes from the start of the buffer. */
+        sbINVALIDATE_STORAGE( pxStreamBuffer->pucBuffer, xCount - xFirstLength );
+        ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* Move the tail pointer to effectively remove the data read from the buffer. */
+    xTail += xCount;
+
+    if( xTail >= pxStreamBuffer->xLength )
+    {
+        xTail -= pxStreamBuffer->xLength;
+    }
+
+    return xTail;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteSegmentsToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                        const StreamBufferSegment_t * const pxSegments,
+                                        const UBaseType_t uxSegmentCount,
+                                        size_t xCount,
+                                        size_t xHead )
+{
+    UBaseType_t uxSegment;
+    size_t xBytesToWrite;
+
+    for( uxSegment = ( UBaseType_t ) 0U; ( uxSegment < uxSegmentCount ) && ( xCount > ( size_t ) 0 ); uxSegment++ )
+    {
+        xBytesToWrite = configMIN( pxSegments[ uxSegment ].xLengthBytes, xCount );
+
+        if( xBytesToWrite > ( size_t ) 0 )
+        {
+            /* MISRA Ref 11.5.5 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pxSegments[ uxSegment ].pvData, xBytesToWrite, xHead );
+            xCount -= xBytesToWrite;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadSegmentsFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                         const StreamBufferSegment_t * const pxSegments,
+                                         const UBaseType_t uxSegmentCount,
+                                         size_t xCount,
+                                         size_t xTail )
+{
+    UBaseType_t uxSegment;
+    size_t xBytesToRead;
+
+    for( uxSegment = ( UBaseType_t ) 0U; ( uxSegment < uxSegmentCount ) && ( xCount > ( size_t ) 0 ); uxSegment++ )
+    {
+        xBytesToRead = configMIN( pxSegments[ uxSegment ].xLengthBytes, xCount );
+
+        if( xBytesToRead > ( size_t ) 0 )
+        {
+            /* MISRA Ref 11.5.5 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pxSegments[ uxSegment ].pvData, xBytesToRead, xTail );
+            xCount -= xBytesToRead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return xTail;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+    /* Returns the distance between xTail and the readable head, which is
+     * xHead unless the stream buffer is a pipeline. */
+    size_t xCount;
+
+    xCount = pxStreamBuffer->xLength + sbREADABLE_HEAD( pxStreamBuffer );
+    xCount -= pxStreamBuffer->xTail;
+
+    if( xCount >= pxStreamBuffer->xLength )
+    {
+        xCount -= pxStreamBuffer->xLength;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xCount;
+}
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+
+    static void prvWaitForNotification( StreamBuffer_t * const pxStreamBuffer,
+                                        TickType_t xTicksToWait )
+    {
+        const TickType_t xBlockStartTime = xTaskGetTickCount();
+        TickType_t xBlockedTime;
+        BaseType_t xNotified;
+
+        xNotified = xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+        xBlockedTime = xTaskGetTickCount() - xBlockStartTime;
+
+        sbENTER_CRITICAL( pxStreamBuffer );
+        {
+            pxStreamBuffer->xStatistics.ulBlocks++;
+            pxStreamBuffer->xStatistics.xTotalBlockedTime += xBlockedTime;
+
+            if( xNotified == pdFALSE )
+            {
+                pxStreamBuffer->xStatistics.ulTimeouts++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        sbEXIT_CRITICAL( pxStreamBuffer );
+    }
+
+    #endif /* configUSE_IPC_STATISTICS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+
+    static void prvStartLatencyPeriod( StreamBuffer_t * const pxStreamBuffer,
+                                       size_t xBytesWritten )
+    {
+        size_t xBytesInBuffer;
+
+        if( pxStreamBuffer->xMaxLatencyTicks != ( TickType_t ) 0 )
+        {
+            xBytesInBuffer = prvBytesInBuffer( pxStreamBuffer );
+
+            if( xBytesInBuffer <= xBytesWritten )
+            {
+                pxStreamBuffer->xFirstByteTime = xTaskGetTickCount();
+
+                /* A reader waiting for the trigger level is notified by the
+                 * caller, otherwise wake it to start timing the latency. */
+                if( xBytesInBuffer < pxStreamBuffer->xTriggerLevelBytes )
+                {
+                    prvSEND_COMPLETED( pxStreamBuffer );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+
+    static void prvStartLatencyPeriodFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                              size_t xBytesWritten,
+                                              BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        size_t xBytesInBuffer;
+
+        if( pxStreamBuffer->xMaxLatencyTicks != ( TickType_t ) 0 )
+        {
+            xBytesInBuffer = prvBytesInBuffer( pxStreamBuffer );
+
+            if( xBytesInBuffer <= xBytesWritten )
+            {
+                pxStreamBuffer->xFirstByteTime = xTaskGetTickCountFromISR();
+
+                /* A reader waiting for the trigger level is notified by the
+                 * caller, otherwise wake it to start timing the latency. */
+                if( xBytesInBuffer < pxStreamBuffer->xTriggerLevelBytes )
+                {
+                    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                    /* coverity[misra_c_2012_directive_4_7_violation] */
+                    prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_MAX_LATENCY == 1 )
+
+    static size_t prvWaitForMaxLatency( StreamBuffer_t * const pxStreamBuffer,
+                                        size_t xBytesToStoreMessageLength,
+                                        TickType_t xTicksToWait )
+    {
+        TimeOut_t xTimeOut;
+        TickType_t xTicksSinceFirstByte, xTicksToBlock;
+        size_t xBytesAvailable;
+        BaseType_t xMustWait = pdTRUE;
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        while( xMustWait != pdFALSE )
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+            xTicksSinceFirstByte = xTaskGetTickCount() - pxStreamBuffer->xFirstByteTime;
+
+            if( ( xBytesAvailable > xBytesToStoreMessageLength ) && ( xBytesAvailable >= pxStreamBuffer->xTriggerLevelBytes ) )
+            {
+                /* The trigger level has been reached. */
+                xMustWait = pdFALSE;
+            }
+            else if( ( xBytesAvailable != ( size_t ) 0 ) && ( xTicksSinceFirstByte >= pxStreamBuffer->xMaxLatencyTicks ) )
+            {
+                /* The maximum latency has expired, so read whatever is in the
+                 * buffer. */
+                xBytesToStoreMessageLength = 0;
+                xMustWait = pdFALSE;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                /* The reader's own block time has expired. */
+                xMustWait = pdFALSE;
+            }
+            else
+            {
+                /* Wait for the trigger level, or for no longer than the rest of
+                 * the latency once the first byte has arrived. */
+                xTicksToBlock = xTicksToWait;
+
+                if( xBytesAvailable != ( size_t ) 0 )
+                {
+                    xTicksToBlock = configMIN( xTicksToBlock, pxStreamBuffer->xMaxLatencyTicks - xTicksSinceFirstByte );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                #if ( configUSE_GRANULAR_LOCKS == 1 )
+                {
+                    /* Clearing the notification state enters the kernel
+                     * critical section so cannot be done while holding the
+                     * stream buffer lock.  A notification sent after this point
+                     * is not lost. */
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                }
+                #endif
+
+                /* Only block if no bytes have arrived since they were counted,
+                 * otherwise check again. */
+                sbENTER_CRITICAL( pxStreamBuffer );
+                {
+                    if( prvBytesInBuffer( pxStreamBuffer ) == xBytesAvailable )
+                    {
+                        #if ( configUSE_GRANULAR_LOCKS == 0 )
+                        {
+                            ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                        }
+                        #endif
+
+                        /* Should only be one reader. */
+                        configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                        pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                    }
+                    else
+                    {
+                        xTicksToBlock = 0;
+                    }
+                }
+                sbEXIT_CRITICAL( pxStreamBuffer );
+
+                if( xTicksToBlock != ( TickType_t ) 0 )
+                {
+                    traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+                    sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToBlock );
+                    pxStreamBuffer->xTaskWaitingToReceive = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+        return xBytesToStoreMessageLength;
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_MAX_LATENCY */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+
+    static void prvCheckWatermarks( StreamBuffer_t * const pxStreamBuffer,
+                                    BaseType_t xIsInsideISR,
+                                    BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* Don't enter a critical section on every write and read of a stream
+         * buffer that has no watermarks. */
+        if( pxStreamBuffer->pxWatermarkCallback != NULL )
+        {
+            if( xIsInsideISR != pdFALSE )
+            {
+                /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                /* coverity[misra_c_2012_directive_4_7_violation] */
+                uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
+                {
+                    prvCrossWatermarks( pxStreamBuffer, pdTRUE, pxHigherPriorityTaskWoken );
+                }
+                sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
+            }
+            else
+            {
+                sbENTER_CRITICAL( pxStreamBuffer );
+                {
+                    prvCrossWatermarks( pxStreamBuffer, pdFALSE, NULL );
+                }
+                sbEXIT_CRITICAL( pxStreamBuffer );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_WATERMARKS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_WATERMARKS == 1 )
+
+    static void prvCrossWatermarks( StreamBuffer_t * const pxStreamBuffer,
+                                    BaseType_t xIsInsideISR,
+                                    BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        size_t xBytesHeld;
+
+        if( pxStreamBuffer->pxWatermarkCallback != NULL )
+        {
+            /* Space is held from xTail, which is the slowest reader of a
+             * broadcast stream buffer, to xHead, which includes the bytes not
+             * yet passed on by the stages of a pipeline. */
+            xBytesHeld = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
+            xBytesHeld -= pxStreamBuffer->xTail;
+
+            if( xBytesHeld >= pxStreamBuffer->xLength )
+            {
+                xBytesHeld -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The callback is only called on crossing a watermark, not while
+             * the number of bytes held stays between them. */
+            if( ( pxStreamBuffer->xAboveHighWatermark == pdFALSE ) && ( xBytesHeld >= pxStreamBuffer->xHighWatermarkBytes ) )
+            {
+                pxStreamBuffer->xAboveHighWatermark = pdTRUE;
+                pxStreamBuffer->pxWatermarkCallback( pxStreamBuffer, pdTRUE, xIsInsideISR, pxHigherPriorityTaskWoken );
+            }
+            else if( ( pxStreamBuffer->xAboveHighWatermark != pdFALSE ) && ( xBytesHeld <= pxStreamBuffer->xLowWatermarkBytes ) )
+            {
+                pxStreamBuffer->xAboveHighWatermark = pdFALSE;
+                pxStreamBuffer->pxWatermarkCallback( pxStreamBuffer, pdFALSE, xIsInsideISR, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    #endif /* configUSE_STREAM_BUFFER_WATERMARKS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ALIGNED_STREAM_BUFFERS == 1 )
+
+    static size_t prvSkipPadding( const StreamBuffer_t * const pxStreamBuffer,
+                                  size_t xIndex,
+                                  size_t xCount )
+    {
+        xIndex += xCount;
+
+        if( xIndex >= pxStreamBuffer->xLength )
+        {
+            xIndex -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xIndex;
+    }
+
+    #endif /* configUSE_ALIGNED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    static size_t prvContiguousSpaceAtHead( StreamBuffer_t * const pxStreamBuffer )
+    {
+        /* Only the writer moves xHead, so the space can only grow while the
+         * writer is using the region. */
+        return configMIN( xStreamBufferSpacesAvailable( pxStreamBuffer ), pxStreamBuffer->xLength - pxStreamBuffer->xHead );
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    static size_t prvContiguousBytesAtTail( const StreamBuffer_t * const pxStreamBuffer )
+    {
+        /* Only the reader moves xTail, so the data can only grow while the
+         * reader is using the region. */
+        return configMIN( prvBytesInBuffer( pxStreamBuffer ), pxStreamBuffer->xLength - pxStreamBuffer->xTail );
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    static size_t prvCommitBytesAtHead( StreamBuffer_t * const pxStreamBuffer,
+                                        size_t xCount )
+    {
+        size_t xReturn = ( size_t ) 0;
+        size_t xNextHead;
+
+        /* Bytes can only be committed within the region the writer was
+         * given. */
+        configASSERT( xCount <= prvContiguousSpaceAtHead( pxStreamBuffer ) );
+
+        if( ( xCount > ( size_t ) 0 ) && ( xCount <= prvContiguousSpaceAtHead( pxStreamBuffer ) ) )
+        {
+            /* The bytes were written in place by the application. */
+            sbCLEAN_STORAGE( &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xHead ] ), xCount );
+
+            xNextHead = pxStreamBuffer->xHead + xCount;
+
+            if( xNextHead >= pxStreamBuffer->xLength )
+            {
+                xNextHead -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xHead = xNextHead;
+            xReturn = xCount;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    static size_t prvConsumeBytesAtTail( StreamBuffer_t * const pxStreamBuffer,
+                                         size_t xCount )
+    {
+        size_t xReturn = ( size_t ) 0;
+        size_t xNextTail;
+
+        /* Bytes can only be consumed within the region the reader was
+         * given. */
+        configASSERT( xCount <= prvContiguousBytesAtTail( pxStreamBuffer ) );
+
+        if( ( xCount > ( size_t ) 0 ) && ( xCount <= prvContiguousBytesAtTail( pxStreamBuffer ) ) )
+        {
+            xNextTail = pxStreamBuffer->xTail + xCount;
+
+            if( xNextTail >= pxStreamBuffer->xLength )
+            {
+                xNextTail -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xTail = xNextTail;
+            xReturn = xCount;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    static BaseType_t prvRegionIsEmpty( StreamBuffer_t * const pxStreamBuffer,
+                                        const BaseType_t xIsWriter )
+    {
+        BaseType_t xReturn;
+        size_t xBytesRequired = 0;
+
+        if( xIsWriter != pdFALSE )
+        {
+            xReturn = ( xStreamBufferSpacesAvailable( pxStreamBuffer ) == ( size_t ) 0 ) ? pdTRUE : pdFALSE;
+        }
+        else
+        {
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
+            {
+                xBytesRequired = pxStreamBuffer->xTriggerLevelBytes;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = ( prvBytesInBuffer( pxStreamBuffer ) <= xBytesRequired ) ? pdTRUE : pdFALSE;
+        }
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_ZERO_COPY_STREAM_BUFFERS == 1 )
+
+    static void prvWaitForRegion( StreamBuffer_t * const pxStreamBuffer,
+                                  const BaseType_t xIsWriter,
+                                  TickType_t xTicksToWait )
+    {
+        BaseType_t xMustWait;
+
+        #if ( configUSE_GRANULAR_LOCKS == 1 )
+        {
+            /* Clearing the notification state enters the kernel critical
+             * section so cannot be done while holding the stream buffer lock.
+             * A notification sent after this point is not lost. */
+            if( prvRegionIsEmpty( pxStreamBuffer, xIsWriter ) != pdFALSE )
+            {
+                ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+            }
+        }
+        #endif /* #if ( configUSE_GRANULAR_LOCKS == 1 ) */
+
+        /* Checking the region and clearing the notification state must be
+         * performed atomically. */
+        sbENTER_CRITICAL( pxStreamBuffer );
+        {
+            xMustWait = prvRegionIsEmpty( pxStreamBuffer, xIsWriter );
+
+            if( xMustWait != pdFALSE )
+            {
+                #if ( configUSE_GRANULAR_LOCKS == 0 )
+                {
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                }
+                #endif
+
+                if( xIsWriter != pdFALSE )
+                {
+                    /* Should only be one writer. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+                    pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    /* Should only be one reader. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                    pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        sbEXIT_CRITICAL( pxStreamBuffer );
+
+        if( xMustWait != pdFALSE )
+        {
+            if( xIsWriter != pdFALSE )
+            {
+                traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+                sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToWait );
+                pxStreamBuffer->xTaskWaitingToSend = NULL;
+            }
+            else
+            {
+                traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+                sbWAIT_FOR_NOTIFICATION( pxStreamBuffer, xTicksToWait );
+                pxStreamBuffer->xTaskWaitingToReceive = NULL;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    #endif /* configUSE_ZERO_COPY_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+    static size_t prvBytesAfterTail( const StreamBuffer_t * const pxStreamBuffer,
+                                     size_t xTail )
+    {
+        size_t xCount;
+
+        xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
+        xCount -= xTail;
+
+        if( xCount >= pxStreamBuffer->xLength )
+        {
+            xCount -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xCount;
+    }
+
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+    static void prvAdvanceReaderTail( StreamBuffer_t * const pxStreamBuffer,
+                                      StreamBufferReader_t * const pxReader,
+                                      size_t xNextTail )
+    {
+        UBaseType_t uxReader;
+        size_t xDistance, xShortestDistance = pxStreamBuffer->xLength;
+        size_t xTail;
+
+        pxReader->xTail = xNextTail;
+
+        /* Every reader is between the stream buffer's own tail and the head, so
+         * the slowest reader is the one the shortest distance past the tail.
+         * Measuring from the tail rather than the head gives the same answer
+         * even if the writer moves the head during the search. */
+        for( uxReader = ( UBaseType_t ) 0U; uxReader < pxStreamBuffer->uxReaderCount; uxReader++ )
+        {
+            xDistance = pxStreamBuffer->xLength + pxStreamBuffer->pxReaders[ uxReader ].xTail;
+            xDistance -= pxStreamBuffer->xTail;
+
+            if( xDistance >= pxStreamBuffer->xLength )
+            {
+                xDistance -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xDistance < xShortestDistance )
+            {
+                xShortestDistance = xDistance;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        xTail = pxStreamBuffer->xTail + xShortestDistance;
+
+        if( xTail >= pxStreamBuffer->xLength )
+        {
+            xTail -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxStreamBuffer->xTail = xTail;
+    }
+
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+    static void prvNotifyBroadcastReaders( StreamBuffer_t * const pxStreamBuffer )
+    {
+        UBaseType_t uxReader;
+        StreamBufferReader_t * pxReader;
+        TaskHandle_t xTaskToNotify;
+
+        for( uxReader = ( UBaseType_t ) 0U; uxReader < pxStreamBuffer->uxReaderCount; uxReader++ )
+        {
+            pxReader = &( pxStreamBuffer->pxReaders[ uxReader ] );
+
+            /* The waiting task is notified after the critical section is
+             * exited, as with granular locks sending a notification enters the
+             * kernel critical section. */
+            sbENTER_CRITICAL( pxStreamBuffer );
+            {
+                xTaskToNotify = pxReader->xTaskWaitingToReceive;
+
+                if( ( xTaskToNotify != NULL ) && ( prvBytesAfterTail( pxStreamBuffer, pxReader->xTail ) >= pxStreamBuffer->xTriggerLevelBytes ) )
+                {
+                    pxReader->xTaskWaitingToReceive = NULL;
+                }
+                else
+                {
+                    xTaskToNotify = NULL;
+                }
+            }
+            sbEXIT_CRITICAL( pxStreamBuffer );
+
+            if( xTaskToNotify != NULL )
+            {
+                ( void ) xTaskNotifyIndexed( xTaskToNotify, pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, eNoAction );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+    static void prvNotifyBroadcastReadersFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                                  BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxReader;
+        StreamBufferReader_t * pxReader;
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
+        {
+            for( uxReader = ( UBaseType_t ) 0U; uxReader < pxStreamBuffer->uxReaderCount; uxReader++ )
+            {
+                pxReader = &( pxStreamBuffer->pxReaders[ uxReader ] );
+
+                if( ( pxReader->xTaskWaitingToReceive != NULL ) && ( prvBytesAfterTail( pxStreamBuffer, pxReader->xTail ) >= pxStreamBuffer->xTriggerLevelBytes ) )
+                {
+                    ( void ) xTaskNotifyIndexedFromISR( pxReader->xTaskWaitingToReceive,
+                                                        pxStreamBuffer->uxNotificationIndex,
+                                                        ( uint32_t ) 0,
+                                                        eNoAction,
+                                                        pxHigherPriorityTaskWoken );
+                    pxReader->xTaskWaitingToReceive = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
+    }
+
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_BROADCAST_STREAM_BUFFERS == 1 )
+
+    static BaseType_t prvBroadcastReaderIsWaiting( const StreamBuffer_t * const pxStreamBuffer )
+    {
+        UBaseType_t uxReader;
+        BaseType_t xReturn = pdFALSE;
+
+        for( uxReader = ( UBaseType_t ) 0U; uxReader < pxStreamBuffer->uxReaderCount; uxReader++ )
+        {
+            if( pxStreamBuffer->pxReaders[ uxReader ].xTaskWaitingToReceive != NULL )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+
+    #endif /* configUSE_BROADCAST_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+
+    static size_t prvBytesForStage( const StreamBuffer_t * const pxStreamBuffer,
+                                    UBaseType_t uxStage )
+    {
+        size_t xCount;
+
+        /* Stage 0 processes the bytes the writer has written, and every other
+         * stage the bytes the stage before it has committed. */
+        if( uxStage == ( UBaseType_t ) 0U )
+        {
+            xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
+        }
+        else
+        {
+            xCount = pxStreamBuffer->xLength + pxStreamBuffer->pxStages[ uxStage - ( UBaseType_t ) 1U ].xHead;
+        }
+
+        xCount -= pxStreamBuffer->pxStages[ uxStage ].xHead;
+
+        if( xCount >= pxStreamBuffer->xLength )
+        {
+            xCount -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-    }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-    traceRETURN_xStreamBufferSendCompletedFromISR( xReturn );
+        return xCount;
+    }
 
-    return xReturn;
-}
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
-                                                 BaseType_t * pxHigherPriorityTaskWoken )
-{
-    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
 
-    traceENTER_xStreamBufferReceiveCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
+    static size_t prvCommitStage( StreamBuffer_t * const pxStreamBuffer,
+                                  UBaseType_t uxStage,
+                                  size_t xCount )
+    {
+        StreamBufferStage_t * const pxStage = &( pxStreamBuffer->pxStages[ uxStage ] );
+        size_t xReturn = ( size_t ) 0;
+        size_t xRegionLength, xNextHead;
 
-    configASSERT( pxStreamBuffer );
+        /* Bytes can only be committed within the region the stage was
+         * given. */
+        xRegionLength = configMIN( prvBytesForStage( pxStreamBuffer, uxStage ), pxStreamBuffer->xLength - pxStage->xHead );
+        configASSERT( xCount <= xRegionLength );
 
-    /* MISRA Ref 4.7.1 [Return value shall be checked] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
-    {
-        if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )
+        if( ( xCount > ( size_t ) 0 ) && ( xCount <= xRegionLength ) )
         {
-            ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,
-                                                ( pxStreamBuffer )->uxNotificationIndex,
-                                                ( uint32_t ) 0,
-                                                eNoAction,
-                                                pxHigherPriorityTaskWoken );
-            ( pxStreamBuffer )->xTaskWaitingToSend = NULL;
-            xReturn = pdTRUE;
+            /* The bytes may have been modified in place by the stage. */
+            sbCLEAN_STORAGE( &( pxStreamBuffer->pucBuffer[ pxStage->xHead ] ), xCount );
+
+            xNextHead = pxStage->xHead + xCount;
+
+            if( xNextHead >= pxStreamBuffer->xLength )
+            {
+                xNextHead -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStage->xHead = xNextHead;
+            xReturn = xCount;
         }
         else
         {
-            xReturn = pdFALSE;
+            mtCOVERAGE_TEST_MARKER();
         }
-    }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-    traceRETURN_xStreamBufferReceiveCompletedFromISR( xReturn );
+        return xReturn;
+    }
 
-    return xReturn;
-}
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
-                                     const uint8_t * pucData,
-                                     size_t xCount,
-                                     size_t xHead )
-{
-    size_t xFirstLength;
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
 
-    configASSERT( xCount > ( size_t ) 0 );
+    static void prvNotifyStage( StreamBuffer_t * const pxStreamBuffer,
+                                UBaseType_t uxStage )
+    {
+        StreamBufferStage_t * const pxStage = &( pxStreamBuffer->pxStages[ uxStage ] );
+        TaskHandle_t xTaskToNotify;
 
-    /* Calculate the number of bytes that can be added in the first write -
-     * which may be less than the total number of bytes that need to be added if
-     * the buffer will wrap back to the beginning. */
-    xFirstLength = configMIN( pxStreamBuffer->xLength - xHead, xCount );
+        /* The waiting task is notified after the critical section is exited,
+         * as with granular locks sending a notification enters the kernel
+         * critical section. */
+        sbENTER_CRITICAL( pxStreamBuffer );
+        {
+            xTaskToNotify = pxStage->xTaskWaitingToReceive;
 
-    /* Write as many bytes as can be written in the first write. */
-    configASSERT( ( xHead + xFirstLength ) <= pxStreamBuffer->xLength );
-    ( void ) memcpy( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength );
+            if( ( xTaskToNotify != NULL ) && ( prvBytesForStage( pxStreamBuffer, uxStage ) >= pxStage->xTriggerLevelBytes ) )
+            {
+                pxStage->xTaskWaitingToReceive = NULL;
+            }
+            else
+            {
+                xTaskToNotify = NULL;
+            }
+        }
+        sbEXIT_CRITICAL( pxStreamBuffer );
 
-    /* If the number of bytes written was less than the number that could be
-     * written in the first write... */
-    if( xCount > xFirstLength )
-    {
-        /* ...then write the remaining bytes to the start of the buffer. */
-        configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
-        ( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
+        if( xTaskToNotify != NULL )
+        {
+            ( void ) xTaskNotifyIndexed( xTaskToNotify, pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, eNoAction );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
 
-    xHead += xCount;
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
+/*-----------------------------------------------------------*/
 
-    if( xHead >= pxStreamBuffer->xLength )
-    {
-        xHead -= pxStreamBuffer->xLength;
-    }
-    else
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
+
+    static void prvNotifyStageFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                       UBaseType_t uxStage,
+                                       BaseType_t * const pxHigherPriorityTaskWoken )
     {
-        mtCOVERAGE_TEST_MARKER();
+        StreamBufferStage_t * const pxStage = &( pxStreamBuffer->pxStages[ uxStage ] );
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = sbENTER_CRITICAL_FROM_ISR( pxStreamBuffer );
+        {
+            if( ( pxStage->xTaskWaitingToReceive != NULL ) && ( prvBytesForStage( pxStreamBuffer, uxStage ) >= pxStage->xTriggerLevelBytes ) )
+            {
+                ( void ) xTaskNotifyIndexedFromISR( pxStage->xTaskWaitingToReceive,
+                                                    pxStreamBuffer->uxNotificationIndex,
+                                                    ( uint32_t ) 0,
+                                                    eNoAction,
+                                                    pxHigherPriorityTaskWoken );
+                pxStage->xTaskWaitingToReceive = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        sbEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus, pxStreamBuffer );
     }
 
-    return xHead;
-}
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
 /*-----------------------------------------------------------*/
 
-static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
-                                      uint8_t * pucData,
-                                      size_t xCount,
-                                      size_t xTail )
-{
-    size_t xFirstLength;
-
-    configASSERT( xCount != ( size_t ) 0 );
+    #if ( configUSE_STREAM_BUFFER_PIPELINES == 1 )
 
-    /* Calculate the number of bytes that can be read - which may be
-     * less than the number wanted if the data wraps around to the start of
-     * the buffer. */
-    xFirstLength = configMIN( pxStreamBuffer->xLength - xTail, xCount );
+    static BaseType_t prvStageIsWaiting( const StreamBuffer_t * const pxStreamBuffer )
+    {
+        UBaseType_t uxStage;
+        BaseType_t xReturn = pdFALSE;
 
-    /* Obtain the number of bytes it is possible to obtain in the first
-     * read.  Asserts check bounds of read and write. */
-    configASSERT( xFirstLength <= xCount );
-    configASSERT( ( xTail + xFirstLength ) <= pxStreamBuffer->xLength );
-    ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
+        for( uxStage = ( UBaseType_t ) 0U; uxStage < pxStreamBuffer->uxStageCount; uxStage++ )
+        {
+            if( pxStreamBuffer->pxStages[ uxStage ].xTaskWaitingToReceive != NULL )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
 
-    /* If the total number of wanted bytes is greater than the number
-     * that could be read in the first read... */
-    if( xCount > xFirstLength )
-    {
-        /* ...then read the remaining bytes from the start of the buffer. */
-        ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength );
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
+        return xReturn;
     }
 
-    /* Move the tail pointer to effectively remove the data read from the buffer. */
-    xTail += xCount;
+    #endif /* configUSE_STREAM_BUFFER_PIPELINES */
+/*-----------------------------------------------------------*/
 
-    if( xTail >= pxStreamBuffer->xLength )
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) )
+
+    static BaseType_t prvSpinForData( const StreamBuffer_t * const pxStreamBuffer,
+                                      size_t xBytesHeld )
     {
-        xTail -= pxStreamBuffer->xLength;
+        UBaseType_t uxIteration;
+        BaseType_t xReturn = pdFALSE;
+
+        for( uxIteration = 0U; uxIteration < ( UBaseType_t ) configSTREAM_BUFFER_SPIN_ITERATIONS; uxIteration++ )
+        {
+            if( prvBytesInBuffer( pxStreamBuffer ) > xBytesHeld )
+            {
+                xReturn = pdTRUE;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
     }
 
-    return xTail;
-}
+    #endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) ) */
 /*-----------------------------------------------------------*/
 
-static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
-{
-    /* Returns the distance between xTail and xHead. */
-    size_t xCount;
-
-    xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
-    xCount -= pxStreamBuffer->xTail;
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) )
 
-    if( xCount >= pxStreamBuffer->xLength )
-    {
-        xCount -= pxStreamBuffer->xLength;
-    }
-    else
+    static BaseType_t prvSpinForSpace( StreamBuffer_t * const pxStreamBuffer,
+                                       size_t xRequiredSpace )
     {
-        mtCOVERAGE_TEST_MARKER();
+        UBaseType_t uxIteration;
+        BaseType_t xReturn = pdFALSE;
+
+        for( uxIteration = 0U; uxIteration < ( UBaseType_t ) configSTREAM_BUFFER_SPIN_ITERATIONS; uxIteration++ )
+        {
+            if( xStreamBufferSpacesAvailable( pxStreamBuffer ) >= xRequiredSpace )
+            {
+                xReturn = pdTRUE;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
     }
 
-    return xCount;
-}
+    #endif /* if ( ( configNUMBER_OF_CORES > 1 ) && ( configSTREAM_BUFFER_SPIN_ITERATIONS > 0 ) ) */
 /*-----------------------------------------------------------*/
 
 static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
@@ -1605,7 +5415,27 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
     }
     #endif
 
-    ( void ) memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) );
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+    {
+        /* The lock may be held by the caller so must not be cleared.  It is
+         * initialised separately when the stream buffer is created. */
+        ( void ) memset( ( void * ) pxStreamBuffer, 0x00, offsetof( StreamBuffer_t, xStreamBufferLock ) );
+    }
+    #else
+    {
+        ( void ) memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) );
+    }
+    #endif
+
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+    {
+        /* The reservation head of a multi-producer stream buffer must fit in
+         * the low bits of ulProducerState. */
+        configASSERT( ( ( ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) == ( uint8_t ) 0 ) ||
+                      ( ( xBufferSizeBytes - ( size_t ) 1U ) <= ( size_t ) sbPRODUCER_HEAD_MASK ) );
+    }
+    #endif
+
     pxStreamBuffer->pucBuffer = pucBuffer;
     pxStreamBuffer->xLength = xBufferSizeBytes;
     pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
@@ -1711,6 +5541,111 @@ void vStreamBufferSetStreamBufferNotificationIndex( StreamBufferHandle_t xStream
     #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_IPC_STATISTICS == 1 )
+
+    void vStreamBufferGetStatistics( StreamBufferHandle_t xStreamBuffer,
+                                     IPCStatistics_t * pxStatistics )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        traceENTER_vStreamBufferGetStatistics( xStreamBuffer, pxStatistics );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxStatistics );
+
+        sbENTER_CRITICAL( pxStreamBuffer );
+        {
+            *pxStatistics = pxStreamBuffer->xStatistics;
+        }
+        sbEXIT_CRITICAL( pxStreamBuffer );
+
+        traceRETURN_vStreamBufferGetStatistics();
+    }
+
+    #endif /* configUSE_IPC_STATISTICS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_IPC_LATENCY_TRACING == 1 )
+
+    void vStreamBufferGetLatencyHistogram( StreamBufferHandle_t xStreamBuffer,
+                                           IPCLatencyHistogram_t * pxHistogram )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        traceENTER_vStreamBufferGetLatencyHistogram( xStreamBuffer, pxHistogram );
+
+        configASSERT( pxStreamBuffer );
+        configASSERT( pxHistogram );
+
+        /* The reader updates the histogram without a critical section, so a
+         * histogram read while a message is received on another core may
+         * not include that message consistently. */
+        sbENTER_CRITICAL( pxStreamBuffer );
+        {
+            *pxHistogram = pxStreamBuffer->xLatencyHistogram;
+        }
+        sbEXIT_CRITICAL( pxStreamBuffer );
+
+        traceRETURN_vStreamBufferGetLatencyHistogram();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvStampMessageTag( StreamBuffer_t * const pxStreamBuffer,
+                                    size_t xNextHead,
+                                    BaseType_t xFromISR )
+    {
+        const UBaseType_t uxWritten = pxStreamBuffer->uxMessageTagsWritten;
+        UBaseType_t uxIndex;
+
+        if( sbCARRIES_TAGS( pxStreamBuffer ) &&
+            ( ( UBaseType_t ) ( uxWritten - pxStreamBuffer->uxMessageTagsRead ) < ( UBaseType_t ) configIPC_LATENCY_MESSAGE_BUFFER_TAGS ) )
+        {
+            uxIndex = uxWritten % ( UBaseType_t ) configIPC_LATENCY_MESSAGE_BUFFER_TAGS;
+
+            vTaskStampMessageTag( &( pxStreamBuffer->xMessageTags[ uxIndex ] ), xFromISR );
+            pxStreamBuffer->xMessageTagEnds[ uxIndex ] = xNextHead;
+            pxStreamBuffer->uxMessageTagsWritten = ( UBaseType_t ) ( uxWritten + ( UBaseType_t ) 1U );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvReceiveMessageTag( StreamBuffer_t * const pxStreamBuffer,
+                                      size_t xNextTail,
+                                      BaseType_t xFromISR )
+    {
+        const UBaseType_t uxRead = pxStreamBuffer->uxMessageTagsRead;
+        UBaseType_t uxIndex;
+
+        /* The tags are in the order the messages were written, and no two
+         * unread messages end at the same index, so the message read is
+         * tagged only if it is where the oldest tag says it ends. */
+        if( sbCARRIES_TAGS( pxStreamBuffer ) && ( pxStreamBuffer->uxMessageTagsWritten != uxRead ) )
+        {
+            uxIndex = uxRead % ( UBaseType_t ) configIPC_LATENCY_MESSAGE_BUFFER_TAGS;
+
+            if( pxStreamBuffer->xMessageTagEnds[ uxIndex ] == xNextTail )
+            {
+                vTaskReceiveMessageTag( &( pxStreamBuffer->xMessageTags[ uxIndex ] ), &( pxStreamBuffer->xLatencyHistogram ), xFromISR );
+                pxStreamBuffer->uxMessageTagsRead = ( UBaseType_t ) ( uxRead + ( UBaseType_t ) 1U );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    #endif /* configUSE_IPC_LATENCY_TRACING */
+/*-----------------------------------------------------------*/
+
 /* This entire source file will be skipped if the application is not configured
  * to include stream buffer functionality. This #if is closed at the very bottom
  * of this file. If you want to include stream buffers then ensure
@@ -0,0 +1,752 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_pool.h"
+#include "semphr.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include task pool functionality. This #if is closed at the very bottom of
+ * this file. If you want to include task pools then ensure configUSE_TASK_POOLS
+ * is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_TASK_POOLS == 1 )
+
+/* A job waiting in the pool's ring of jobs. */
+    typedef struct TaskPoolJob
+    {
+        TaskPoolFunction_t pxFunction;
+        void * pvParameter;
+        TickType_t xSubmitTime;
+    } TaskPoolJob_t;
+
+/*
+ * The definition of the task pool used by the public API functions.  The ring
+ * of jobs and the stack of idle workers are allocated in the same block as the
+ * structure, after it.  They are only accessed from short critical sections,
+ * as the kernel's atomic operations are also built on critical sections on
+ * most ports.
+ */
+    typedef struct TaskPoolDef_t
+    {
+        TaskPoolJob_t * pxJobs;          /**< The ring of jobs waiting to start. */
+        UBaseType_t uxMaxPendingJobs;    /**< The number of jobs the ring can hold. */
+        UBaseType_t uxNextJob;           /**< The ring index of the next job to start. */
+        TaskHandle_t * pxWorkers;        /**< The handles of all the workers. */
+        UBaseType_t uxWorkerCount;       /**< The number of workers. */
+        TaskHandle_t * pxIdleWorkers;    /**< A stack of the workers waiting for a job. */
+        TaskPoolStats_t xStats;          /**< Includes the number of jobs in the ring and of idle workers. */
+    } TaskPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The worker task.  Starts the jobs submitted to its pool, waiting for a
+ * notification whenever there are none.
+ */
+    static portTASK_FUNCTION_PROTO( prvWorkerTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds a job to the ring, and returns the idle worker that should be woken to
+ * run it, if any.  Sets *pxReturn to pdPASS if the job was added.  Must be
+ * called from a critical section.
+ */
+    static TaskHandle_t prvAddJob( TaskPool_t * const pxPool,
+                                   TaskPoolFunction_t pxFunction,
+                                   void * pvParameter,
+                                   TickType_t xTimeNow,
+                                   BaseType_t * const pxReturn ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    TaskPoolHandle_t xTaskPoolCreate( const char * const pcName,
+                                      UBaseType_t uxWorkerCount,
+                                      UBaseType_t uxMaxPendingJobs,
+                                      configSTACK_DEPTH_TYPE uxStackDepth,
+                                      UBaseType_t uxPriority )
+    {
+        TaskPool_t * pxNewPool = NULL;
+        UBaseType_t uxWorker;
+        BaseType_t xWorkersCreated = pdTRUE;
+        const size_t xStructSize = ( sizeof( TaskPool_t ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+        const size_t xRingSize = ( size_t ) uxMaxPendingJobs * sizeof( TaskPoolJob_t );
+        const size_t xJobsSize = ( xRingSize + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+        const size_t xWorkersSize = ( size_t ) uxWorkerCount * 2U * sizeof( TaskHandle_t );
+
+        traceENTER_xTaskPoolCreate( pcName, uxWorkerCount, uxMaxPendingJobs, uxStackDepth, uxPriority );
+
+        configASSERT( uxWorkerCount > ( UBaseType_t ) 0 );
+        configASSERT( uxMaxPendingJobs > ( UBaseType_t ) 0 );
+        configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        if( ( uxWorkerCount > ( UBaseType_t ) 0 ) &&
+            ( uxMaxPendingJobs > ( UBaseType_t ) 0 ) &&
+            ( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES ) &&
+            /* Check for multiplication overflow, and for the rounding up or
+             * the total overflowing. */
+            ( ( xRingSize / sizeof( TaskPoolJob_t ) ) == ( size_t ) uxMaxPendingJobs ) &&
+            ( ( xWorkersSize / ( 2U * sizeof( TaskHandle_t ) ) ) == ( size_t ) uxWorkerCount ) &&
+            ( xJobsSize >= xRingSize ) &&
+            ( ( SIZE_MAX - xStructSize ) >= xJobsSize ) &&
+            ( ( SIZE_MAX - xStructSize - xJobsSize ) >= xWorkersSize ) )
+        {
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxNewPool = ( TaskPool_t * ) pvPortMalloc( xStructSize + xJobsSize + xWorkersSize );
+
+            if( pxNewPool != NULL )
+            {
+                ( void ) memset( ( void * ) pxNewPool, 0x00, sizeof( TaskPool_t ) );
+
+                /* MISRA Ref 11.3.1 [Misaligned access] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                /* coverity[misra_c_2012_rule_11_3_violation] */
+                pxNewPool->pxJobs = ( TaskPoolJob_t * ) ( ( ( uint8_t * ) pxNewPool ) + xStructSize );
+                pxNewPool->uxMaxPendingJobs = uxMaxPendingJobs;
+
+                /* MISRA Ref 11.3.1 [Misaligned access] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                /* coverity[misra_c_2012_rule_11_3_violation] */
+                pxNewPool->pxWorkers = ( TaskHandle_t * ) ( ( ( uint8_t * ) pxNewPool ) + xStructSize + xJobsSize );
+                pxNewPool->pxIdleWorkers = &( pxNewPool->pxWorkers[ uxWorkerCount ] );
+
+                /* Workers that have been created cannot run until they have
+                 * all been created, so they can be deleted again if one cannot
+                 * be created. */
+                vTaskSuspendAll();
+                {
+                    for( uxWorker = 0U; uxWorker < uxWorkerCount; uxWorker++ )
+                    {
+                        if( xTaskCreate( prvWorkerTask, pcName, uxStackDepth, ( void * ) pxNewPool, uxPriority, &( pxNewPool->pxWorkers[ uxWorker ] ) ) != pdPASS )
+                        {
+                            xWorkersCreated = pdFALSE;
+                            break;
+                        }
+                        else
+                        {
+                            pxNewPool->uxWorkerCount++;
+                        }
+                    }
+
+                    if( xWorkersCreated == pdFALSE )
+                    {
+                        for( uxWorker = 0U; uxWorker < pxNewPool->uxWorkerCount; uxWorker++ )
+                        {
+                            vTaskDelete( pxNewPool->pxWorkers[ uxWorker ] );
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                ( void ) xTaskResumeAll();
+
+                if( xWorkersCreated == pdFALSE )
+                {
+                    vPortFree( pxNewPool );
+                    pxNewPool = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskPoolCreate( pxNewPool );
+
+        return pxNewPool;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskPoolSubmit( TaskPoolHandle_t xPool,
+                                TaskPoolFunction_t pxFunction,
+                                void * pvParameter )
+    {
+        TaskPool_t * const pxPool = xPool;
+        BaseType_t xReturn = pdFAIL;
+        TaskHandle_t xWorkerToWake;
+
+        traceENTER_xTaskPoolSubmit( xPool, pxFunction, pvParameter );
+
+        configASSERT( pxPool );
+        configASSERT( pxFunction );
+
+        taskENTER_CRITICAL();
+        {
+            xWorkerToWake = prvAddJob( pxPool, pxFunction, pvParameter, xTaskGetTickCount(), &xReturn );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xWorkerToWake != NULL )
+        {
+            ( void ) xTaskNotifyGive( xWorkerToWake );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskPoolSubmit( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskPoolSubmitFromISR( TaskPoolHandle_t xPool,
+                                       TaskPoolFunction_t pxFunction,
+                                       void * pvParameter,
+                                       BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        TaskPool_t * const pxPool = xPool;
+        BaseType_t xReturn = pdFAIL;
+        TaskHandle_t xWorkerToWake;
+        UBaseType_t uxSavedInterruptStatus;
+        const TickType_t xTimeNow = xTaskGetTickCountFromISR();
+
+        traceENTER_xTaskPoolSubmitFromISR( xPool, pxFunction, pvParameter, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxPool );
+        configASSERT( pxFunction );
+
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            xWorkerToWake = prvAddJob( pxPool, pxFunction, pvParameter, xTimeNow, &xReturn );
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        if( xWorkerToWake != NULL )
+        {
+            vTaskNotifyGiveFromISR( xWorkerToWake, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskPoolSubmitFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskPoolGetStats( TaskPoolHandle_t xPool,
+                            TaskPoolStats_t * pxStats )
+    {
+        TaskPool_t * const pxPool = xPool;
+
+        traceENTER_vTaskPoolGetStats( xPool, pxStats );
+
+        configASSERT( pxPool );
+        configASSERT( pxStats );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = pxPool->xStats;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskPoolGetStats();
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+
+        void vTaskPoolCoreAffinitySet( TaskPoolHandle_t xPool,
+                                       UBaseType_t uxCoreAffinityMask )
+        {
+            TaskPool_t * const pxPool = xPool;
+            UBaseType_t uxWorker;
+
+            traceENTER_vTaskPoolCoreAffinitySet( xPool, uxCoreAffinityMask );
+
+            configASSERT( pxPool );
+
+            for( uxWorker = 0U; uxWorker < pxPool->uxWorkerCount; uxWorker++ )
+            {
+                vTaskCoreAffinitySet( pxPool->pxWorkers[ uxWorker ], uxCoreAffinityMask );
+            }
+
+            traceRETURN_vTaskPoolCoreAffinitySet();
+        }
+
+    #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+    static TaskHandle_t prvAddJob( TaskPool_t * const pxPool,
+                                   TaskPoolFunction_t pxFunction,
+                                   void * pvParameter,
+                                   TickType_t xTimeNow,
+                                   BaseType_t * const pxReturn )
+    {
+        TaskHandle_t xWorkerToWake = NULL;
+        UBaseType_t uxIndex;
+
+        if( pxPool->xStats.uxPendingJobs < pxPool->uxMaxPendingJobs )
+        {
+            uxIndex = pxPool->uxNextJob + pxPool->xStats.uxPendingJobs;
+
+            if( uxIndex >= pxPool->uxMaxPendingJobs )
+            {
+                uxIndex -= pxPool->uxMaxPendingJobs;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxPool->pxJobs[ uxIndex ].pxFunction = pxFunction;
+            pxPool->pxJobs[ uxIndex ].pvParameter = pvParameter;
+            pxPool->pxJobs[ uxIndex ].xSubmitTime = xTimeNow;
+            ( pxPool->xStats.uxPendingJobs )++;
+
+            if( pxPool->xStats.uxPendingJobs > pxPool->xStats.uxMaxPendingJobs )
+            {
+                pxPool->xStats.uxMaxPendingJobs = pxPool->xStats.uxPendingJobs;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Only wake a worker if one is idle.  Otherwise the job is started
+             * by the first worker to finish its current job. */
+            if( pxPool->xStats.uxIdleWorkers > ( UBaseType_t ) 0U )
+            {
+                ( pxPool->xStats.uxIdleWorkers )--;
+                xWorkerToWake = pxPool->pxIdleWorkers[ pxPool->xStats.uxIdleWorkers ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            *pxReturn = pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xWorkerToWake;
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvWorkerTask, pvParameters )
+    {
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        TaskPool_t * const pxPool = ( TaskPool_t * ) pvParameters;
+        TaskPoolJob_t xJob;
+        TickType_t xLatency;
+        BaseType_t xJobTaken;
+
+        for( ; ; )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( pxPool->xStats.uxPendingJobs > ( UBaseType_t ) 0U )
+                {
+                    xJob = pxPool->pxJobs[ pxPool->uxNextJob ];
+                    ( pxPool->uxNextJob )++;
+
+                    if( pxPool->uxNextJob >= pxPool->uxMaxPendingJobs )
+                    {
+                        pxPool->uxNextJob = ( UBaseType_t ) 0U;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    ( pxPool->xStats.uxPendingJobs )--;
+                    ( pxPool->xStats.ulJobsStarted )++;
+
+                    xLatency = xTaskGetTickCount() - xJob.xSubmitTime;
+                    pxPool->xStats.xTotalLatency += xLatency;
+
+                    if( xLatency > pxPool->xStats.xMaxLatency )
+                    {
+                        pxPool->xStats.xMaxLatency = xLatency;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xJobTaken = pdTRUE;
+                }
+                else
+                {
+                    /* No jobs are waiting, so record that this worker is idle
+                     * before waiting, so the next job submitted wakes it.  The
+                     * notification is counted if it is sent before the wait
+                     * starts. */
+                    pxPool->pxIdleWorkers[ pxPool->xStats.uxIdleWorkers ] = xTaskGetCurrentTaskHandle();
+                    ( pxPool->xStats.uxIdleWorkers )++;
+                    xJobTaken = pdFALSE;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xJobTaken != pdFALSE )
+            {
+                traceTASK_POOL_JOB_START( pxPool, xJob.pxFunction );
+
+                xJob.pxFunction( xJob.pvParameter );
+            }
+            else
+            {
+                ( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_PARALLEL_FOR == 1 )
+
+/* A parallel-for call in progress.  Lives on the stack of the task that called
+ * vTaskParallelFor(), which does not return until no helper is using it. */
+        typedef struct TaskParallelFor
+        {
+            TaskParallelForFunction_t pxFunction;
+            void * pvContext;
+            size_t xRange;
+            size_t xChunkSize;
+            size_t xNextStart;          /**< The first item of the next chunk to be taken. */
+            UBaseType_t uxActiveTasks;  /**< The calling task and the helpers still processing chunks. */
+        } TaskParallelFor_t;
+
+/* The pool of helpers, the mutex that makes concurrent parallel-for calls run
+ * one after the other, and the semaphore that the calling task waits on for
+ * the helpers to finish. */
+        #if ( configNUMBER_OF_CORES > 1 )
+            PRIVILEGED_DATA static TaskPoolHandle_t xParallelForPool = NULL;
+            PRIVILEGED_DATA static SemaphoreHandle_t xParallelForMutex = NULL;
+            PRIVILEGED_DATA static SemaphoreHandle_t xParallelForDone = NULL;
+        #endif
+
+/*
+ * Repeatedly takes the next chunk of a parallel-for call and processes it,
+ * until there are no chunks left.
+ */
+        static void prvParallelForRunChunks( TaskParallelFor_t * const pxParallelFor ) PRIVILEGED_FUNCTION;
+
+        #if ( configNUMBER_OF_CORES > 1 )
+
+/*
+ * The job each helper runs for a parallel-for call.
+ */
+            static void prvParallelForHelperJob( void * pvParameter ) PRIVILEGED_FUNCTION;
+        #endif
+
+/*-----------------------------------------------------------*/
+
+        BaseType_t xTaskParallelForInit( configSTACK_DEPTH_TYPE uxStackDepth,
+                                         UBaseType_t uxPriority )
+        {
+            BaseType_t xReturn = pdPASS;
+
+            traceENTER_xTaskParallelForInit( uxStackDepth, uxPriority );
+
+            #if ( configNUMBER_OF_CORES > 1 )
+            {
+                configASSERT( xParallelForPool == NULL );
+
+                xParallelForMutex = xSemaphoreCreateMutex();
+                xParallelForDone = xSemaphoreCreateBinary();
+
+                if( ( xParallelForMutex != NULL ) && ( xParallelForDone != NULL ) )
+                {
+                    xParallelForPool = xTaskPoolCreate( "PFor", ( UBaseType_t ) ( configNUMBER_OF_CORES - 1 ), ( UBaseType_t ) ( configNUMBER_OF_CORES - 1 ), uxStackDepth, uxPriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xParallelForPool == NULL )
+                {
+                    if( xParallelForMutex != NULL )
+                    {
+                        vSemaphoreDelete( xParallelForMutex );
+                        xParallelForMutex = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    if( xParallelForDone != NULL )
+                    {
+                        vSemaphoreDelete( xParallelForDone );
+                        xParallelForDone = NULL;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xReturn = pdFAIL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else /* if ( configNUMBER_OF_CORES > 1 ) */
+            {
+                /* The calling task processes every chunk itself. */
+                ( void ) uxStackDepth;
+                ( void ) uxPriority;
+            }
+            #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
+            traceRETURN_xTaskParallelForInit( xReturn );
+
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        void vTaskParallelFor( size_t xRange,
+                               size_t xChunkSize,
+                               TaskParallelForFunction_t pxFunction,
+                               void * pvContext )
+        {
+            TaskParallelFor_t xParallelFor;
+
+            #if ( configNUMBER_OF_CORES > 1 )
+                UBaseType_t uxHelper;
+                UBaseType_t uxHelpersToStart;
+                size_t xChunks;
+                BaseType_t xHelpersStillActive;
+            #endif
+
+            traceENTER_vTaskParallelFor( xRange, xChunkSize, pxFunction, pvContext );
+
+            configASSERT( pxFunction );
+            configASSERT( xChunkSize > ( size_t ) 0 );
+
+            xParallelFor.pxFunction = pxFunction;
+            xParallelFor.pvContext = pvContext;
+            xParallelFor.xRange = xRange;
+            xParallelFor.xChunkSize = xChunkSize;
+            xParallelFor.xNextStart = ( size_t ) 0;
+
+            /* The calling task counts as active until it has finished taking
+             * chunks, so the helpers only signal completion once it is waiting
+             * for them. */
+            xParallelFor.uxActiveTasks = ( UBaseType_t ) 1U;
+
+            #if ( configNUMBER_OF_CORES > 1 )
+            {
+                configASSERT( xParallelForPool );
+
+                ( void ) xSemaphoreTake( xParallelForMutex, portMAX_DELAY );
+
+                /* Only start as many helpers as there are chunks, beyond the
+                 * first, to share between them. */
+                xChunks = ( xRange / xChunkSize ) + ( ( ( xRange % xChunkSize ) != ( size_t ) 0 ) ? ( size_t ) 1 : ( size_t ) 0 );
+
+                if( xChunks > ( size_t ) configNUMBER_OF_CORES )
+                {
+                    uxHelpersToStart = ( UBaseType_t ) ( configNUMBER_OF_CORES - 1 );
+                }
+                else if( xChunks > ( size_t ) 0 )
+                {
+                    uxHelpersToStart = ( UBaseType_t ) ( xChunks - ( size_t ) 1 );
+                }
+                else
+                {
+                    uxHelpersToStart = ( UBaseType_t ) 0U;
+                }
+
+                for( uxHelper = 0U; uxHelper < uxHelpersToStart; uxHelper++ )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        ( xParallelFor.uxActiveTasks )++;
+                    }
+                    taskEXIT_CRITICAL();
+
+                    if( xTaskPoolSubmit( xParallelForPool, prvParallelForHelperJob, ( void * ) &xParallelFor ) == pdFAIL )
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            ( xParallelFor.uxActiveTasks )--;
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+            #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
+            prvParallelForRunChunks( &xParallelFor );
+
+            #if ( configNUMBER_OF_CORES > 1 )
+            {
+                taskENTER_CRITICAL();
+                {
+                    ( xParallelFor.uxActiveTasks )--;
+                    xHelpersStillActive = ( xParallelFor.uxActiveTasks > ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+                }
+                taskEXIT_CRITICAL();
+
+                /* The single completion barrier.  If any helper is still
+                 * processing its last chunk, the last one to finish gives the
+                 * semaphore. */
+                if( xHelpersStillActive != pdFALSE )
+                {
+                    ( void ) xSemaphoreTake( xParallelForDone, portMAX_DELAY );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                ( void ) xSemaphoreGive( xParallelForMutex );
+            }
+            #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+
+            traceRETURN_vTaskParallelFor();
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvParallelForRunChunks( TaskParallelFor_t * const pxParallelFor )
+        {
+            size_t xStart;
+            size_t xEnd;
+
+            for( ; ; )
+            {
+                /* Claim the next chunk.  Whichever task is free first takes
+                 * it. */
+                taskENTER_CRITICAL();
+                {
+                    xStart = pxParallelFor->xNextStart;
+
+                    if( ( pxParallelFor->xRange - xStart ) > pxParallelFor->xChunkSize )
+                    {
+                        xEnd = xStart + pxParallelFor->xChunkSize;
+                    }
+                    else
+                    {
+                        xEnd = pxParallelFor->xRange;
+                    }
+
+                    pxParallelFor->xNextStart = xEnd;
+                }
+                taskEXIT_CRITICAL();
+
+                if( xStart >= xEnd )
+                {
+                    break;
+                }
+
+                pxParallelFor->pxFunction( pxParallelFor->pvContext, xStart, xEnd );
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        #if ( configNUMBER_OF_CORES > 1 )
+
+            static void prvParallelForHelperJob( void * pvParameter )
+            {
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                TaskParallelFor_t * const pxParallelFor = ( TaskParallelFor_t * ) pvParameter;
+                BaseType_t xLastToFinish = pdFALSE;
+
+                prvParallelForRunChunks( pxParallelFor );
+
+                taskENTER_CRITICAL();
+                {
+                    ( pxParallelFor->uxActiveTasks )--;
+
+                    /* The calling task may return as soon as the count reaches
+                     * zero, so pxParallelFor must not be used after this. */
+                    if( pxParallelFor->uxActiveTasks == ( UBaseType_t ) 0U )
+                    {
+                        xLastToFinish = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( xLastToFinish != pdFALSE )
+                {
+                    ( void ) xSemaphoreGive( xParallelForDone );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+        #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+/*-----------------------------------------------------------*/
+
+    #endif /* configUSE_PARALLEL_FOR */
+
+/* This entire source file will be skipped if the application is not configured
+ * to include task pool functionality. If you want to include task pools then
+ * ensure configUSE_TASK_POOLS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TASK_POOLS == 1 */
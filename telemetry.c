@@ -0,0 +1,463 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+#include "telemetry.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the telemetry serialiser. This #if is closed at the very bottom of
+ * this file. If you want to include the telemetry serialiser then ensure
+ * configUSE_TELEMETRY is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_TELEMETRY == 1 )
+
+/* The space reserved for a record's payload length while the payload is
+ * written.  Two varint bytes allow payloads of up to 16383 bytes, far more than
+ * any record needs. */
+    #define telemetryLENGTH_RESERVED_BYTES    ( ( size_t ) 2U )
+    #define telemetryMAX_PAYLOAD_LENGTH       ( ( size_t ) 0x3FFFU )
+
+/* The offset of the flags byte within the header. */
+    #define telemetryFLAGS_OFFSET             ( ( size_t ) 5U )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Append one byte to the snapshot.  Bytes beyond the end of the buffer are
+ * counted but not stored, so prvEndRecord() can tell the record overflowed.
+ */
+    static void prvWriteByte( TelemetryBuffer_t * pxTelemetry,
+                              uint8_t ucByte ) PRIVILEGED_FUNCTION;
+
+/*
+ * Append an unsigned LEB128 varint - seven bits per byte, least significant
+ * first, with the top bit set on every byte but the last.
+ */
+    static void prvWriteValue( TelemetryBuffer_t * pxTelemetry,
+                               uint64_t ullValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Append a name as its length then its characters.  A NULL name is written as
+ * an empty name, and names are truncated to configMAX_TASK_NAME_LEN
+ * characters.
+ */
+    static void prvWriteName( TelemetryBuffer_t * pxTelemetry,
+                              const char * pcName ) PRIVILEGED_FUNCTION;
+
+/*
+ * Write a record's type, and reserve space for its payload length.  Returns
+ * the offset of the record so prvEndRecord() can complete or discard it.
+ */
+    static size_t prvBeginRecord( TelemetryBuffer_t * pxTelemetry,
+                                  uint8_t ucRecordType ) PRIVILEGED_FUNCTION;
+
+/*
+ * Fill in the payload length of the record started at xRecordStart, closing
+ * up any reserved length bytes that were not needed.  If the record did not fit
+ * it is removed and the snapshot is marked as truncated.
+ */
+    static BaseType_t prvEndRecord( TelemetryBuffer_t * pxTelemetry,
+                                    size_t xRecordStart ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+
+/*
+ * Append the members of an IPCStatistics_t in the order they are declared.
+ */
+        static void prvWriteIPCStatistics( TelemetryBuffer_t * pxTelemetry,
+                                           const IPCStatistics_t * pxStatistics ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*-----------------------------------------------------------*/
+
+    static void prvWriteByte( TelemetryBuffer_t * pxTelemetry,
+                              uint8_t ucByte )
+    {
+        if( pxTelemetry->xBytesWritten < pxTelemetry->xBufferLength )
+        {
+            pxTelemetry->pucBuffer[ pxTelemetry->xBytesWritten ] = ucByte;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxTelemetry->xBytesWritten++;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWriteValue( TelemetryBuffer_t * pxTelemetry,
+                               uint64_t ullValue )
+    {
+        while( ullValue >= ( uint64_t ) 0x80U )
+        {
+            prvWriteByte( pxTelemetry, ( uint8_t ) ( ( ullValue & ( uint64_t ) 0x7FU ) | ( uint64_t ) 0x80U ) );
+            ullValue >>= 7U;
+        }
+
+        prvWriteByte( pxTelemetry, ( uint8_t ) ullValue );
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWriteName( TelemetryBuffer_t * pxTelemetry,
+                              const char * pcName )
+    {
+        size_t xLength = 0U;
+        size_t x;
+
+        if( pcName != NULL )
+        {
+            while( ( xLength < ( size_t ) configMAX_TASK_NAME_LEN ) && ( pcName[ xLength ] != ( char ) 0x00 ) )
+            {
+                xLength++;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        prvWriteValue( pxTelemetry, ( uint64_t ) xLength );
+
+        for( x = 0U; x < xLength; x++ )
+        {
+            prvWriteByte( pxTelemetry, ( uint8_t ) pcName[ x ] );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvBeginRecord( TelemetryBuffer_t * pxTelemetry,
+                                  uint8_t ucRecordType )
+    {
+        size_t xRecordStart = pxTelemetry->xBytesWritten;
+        size_t x;
+
+        prvWriteByte( pxTelemetry, ucRecordType );
+
+        for( x = 0U; x < telemetryLENGTH_RESERVED_BYTES; x++ )
+        {
+            prvWriteByte( pxTelemetry, 0U );
+        }
+
+        return xRecordStart;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEndRecord( TelemetryBuffer_t * pxTelemetry,
+                                    size_t xRecordStart )
+    {
+        BaseType_t xReturn;
+        const size_t xPayloadStart = xRecordStart + ( size_t ) 1U + telemetryLENGTH_RESERVED_BYTES;
+        const size_t xPayloadLength = pxTelemetry->xBytesWritten - xPayloadStart;
+        uint8_t * pucLength;
+
+        /* The payloads are a handful of bounded fields, so can never approach
+         * the limit of the reserved length bytes. */
+        configASSERT( xPayloadLength <= telemetryMAX_PAYLOAD_LENGTH );
+
+        if( pxTelemetry->xBytesWritten <= pxTelemetry->xBufferLength )
+        {
+            pucLength = &( pxTelemetry->pucBuffer[ xRecordStart + ( size_t ) 1U ] );
+
+            if( xPayloadLength < ( size_t ) 0x80U )
+            {
+                /* One length byte is enough, so move the payload down over the
+                 * unused reserved byte. */
+                pucLength[ 0 ] = ( uint8_t ) xPayloadLength;
+                ( void ) memmove( &( pucLength[ 1 ] ), &( pxTelemetry->pucBuffer[ xPayloadStart ] ), xPayloadLength );
+                pxTelemetry->xBytesWritten--;
+            }
+            else
+            {
+                pucLength[ 0 ] = ( uint8_t ) ( ( xPayloadLength & ( size_t ) 0x7FU ) | ( size_t ) 0x80U );
+                pucLength[ 1 ] = ( uint8_t ) ( xPayloadLength >> 7U );
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            /* Leave out the whole record rather than send part of one. */
+            pxTelemetry->xBytesWritten = xRecordStart;
+            pxTelemetry->xTruncated = pdTRUE;
+            xReturn = pdFAIL;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+
+        static void prvWriteIPCStatistics( TelemetryBuffer_t * pxTelemetry,
+                                           const IPCStatistics_t * pxStatistics )
+        {
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->ulSends );
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->ulReceives );
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->ulBlocks );
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->ulTimeouts );
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->xMaxDepth );
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->xTotalBlockedTime );
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->xTotalHeldTime );
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->xMaxHeldTime );
+            prvWriteValue( pxTelemetry, ( uint64_t ) pxStatistics->ulPriorityInheritances );
+        }
+
+    #endif /* configUSE_IPC_STATISTICS */
+/*-----------------------------------------------------------*/
+
+    void vTelemetryBegin( TelemetryBuffer_t * pxTelemetry,
+                          uint8_t * pucBuffer,
+                          size_t xBufferLength )
+    {
+        traceENTER_vTelemetryBegin( pxTelemetry, pucBuffer, xBufferLength );
+
+        configASSERT( pxTelemetry );
+        configASSERT( pucBuffer );
+        configASSERT( xBufferLength >= telemetryHEADER_LENGTH );
+
+        pxTelemetry->pucBuffer = pucBuffer;
+        pxTelemetry->xBufferLength = xBufferLength;
+        pxTelemetry->xBytesWritten = telemetryHEADER_LENGTH;
+        pxTelemetry->xTruncated = pdFALSE;
+
+        ( void ) memcpy( pucBuffer, telemetryMAGIC, ( size_t ) 4U );
+        pucBuffer[ 4 ] = telemetrySCHEMA_VERSION;
+        pucBuffer[ telemetryFLAGS_OFFSET ] = 0U;
+
+        traceRETURN_vTelemetryBegin();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTelemetryAddTask( TelemetryBuffer_t * pxTelemetry,
+                                  const TaskStatus_t * pxTaskStatus )
+    {
+        BaseType_t xReturn;
+        size_t xRecordStart;
+
+        traceENTER_xTelemetryAddTask( pxTelemetry, pxTaskStatus );
+
+        configASSERT( pxTelemetry );
+        configASSERT( pxTaskStatus );
+
+        xRecordStart = prvBeginRecord( pxTelemetry, telemetryRECORD_TASK );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxTaskStatus->xTaskNumber );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxTaskStatus->eCurrentState );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxTaskStatus->uxCurrentPriority );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxTaskStatus->uxBasePriority );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxTaskStatus->ulRunTimeCounter );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxTaskStatus->usStackHighWaterMark );
+        prvWriteName( pxTelemetry, pxTaskStatus->pcTaskName );
+        xReturn = prvEndRecord( pxTelemetry, xRecordStart );
+
+        traceRETURN_xTelemetryAddTask( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTelemetryAddSystemState( TelemetryBuffer_t * pxTelemetry,
+                                           TaskStatus_t * pxTaskStatusArray,
+                                           UBaseType_t uxArraySize )
+    {
+        UBaseType_t uxTasks, x;
+        UBaseType_t uxTasksAdded = 0U;
+        configRUN_TIME_COUNTER_TYPE ulTotalRunTime = 0U;
+        size_t xRecordStart;
+
+        traceENTER_uxTelemetryAddSystemState( pxTelemetry, pxTaskStatusArray, uxArraySize );
+
+        configASSERT( pxTelemetry );
+        configASSERT( pxTaskStatusArray );
+
+        uxTasks = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalRunTime );
+
+        xRecordStart = prvBeginRecord( pxTelemetry, telemetryRECORD_SYSTEM );
+        prvWriteValue( pxTelemetry, ( uint64_t ) xTaskGetTickCount() );
+        prvWriteValue( pxTelemetry, ( uint64_t ) ulTotalRunTime );
+        prvWriteValue( pxTelemetry, ( uint64_t ) uxTaskGetNumberOfTasks() );
+        prvWriteValue( pxTelemetry, ( uint64_t ) configNUMBER_OF_CORES );
+
+        if( prvEndRecord( pxTelemetry, xRecordStart ) == pdPASS )
+        {
+            for( x = 0U; x < uxTasks; x++ )
+            {
+                if( xTelemetryAddTask( pxTelemetry, &( pxTaskStatusArray[ x ] ) ) == pdPASS )
+                {
+                    uxTasksAdded++;
+                }
+                else
+                {
+                    /* Later tasks will not fit either. */
+                    break;
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_uxTelemetryAddSystemState( uxTasksAdded );
+
+        return uxTasksAdded;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTelemetryAddHeapStats( TelemetryBuffer_t * pxTelemetry,
+                                       const HeapStats_t * pxHeapStats )
+    {
+        BaseType_t xReturn;
+        size_t xRecordStart;
+
+        traceENTER_xTelemetryAddHeapStats( pxTelemetry, pxHeapStats );
+
+        configASSERT( pxTelemetry );
+        configASSERT( pxHeapStats );
+
+        xRecordStart = prvBeginRecord( pxTelemetry, telemetryRECORD_HEAP );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxHeapStats->xAvailableHeapSpaceInBytes );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxHeapStats->xSizeOfLargestFreeBlockInBytes );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxHeapStats->xSizeOfSmallestFreeBlockInBytes );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxHeapStats->xNumberOfFreeBlocks );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxHeapStats->xMinimumEverFreeBytesRemaining );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxHeapStats->xNumberOfSuccessfulAllocations );
+        prvWriteValue( pxTelemetry, ( uint64_t ) pxHeapStats->xNumberOfSuccessfulFrees );
+        xReturn = prvEndRecord( pxTelemetry, xRecordStart );
+
+        traceRETURN_xTelemetryAddHeapStats( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_IPC_STATISTICS == 1 )
+
+        BaseType_t xTelemetryAddQueue( TelemetryBuffer_t * pxTelemetry,
+                                       QueueHandle_t xQueue )
+        {
+            BaseType_t xReturn;
+            size_t xRecordStart;
+            IPCStatistics_t xStatistics;
+            const char * pcName = NULL;
+
+            traceENTER_xTelemetryAddQueue( pxTelemetry, xQueue );
+
+            configASSERT( pxTelemetry );
+            configASSERT( xQueue );
+
+            vQueueGetStatistics( xQueue, &xStatistics );
+
+            #if ( configQUEUE_REGISTRY_SIZE > 0 )
+            {
+                pcName = pcQueueGetName( xQueue );
+            }
+            #endif
+
+            xRecordStart = prvBeginRecord( pxTelemetry, telemetryRECORD_QUEUE );
+            prvWriteValue( pxTelemetry, ( uint64_t ) uxQueueGetQueueNumber( xQueue ) );
+            prvWriteValue( pxTelemetry, ( uint64_t ) ucQueueGetQueueType( xQueue ) );
+            prvWriteName( pxTelemetry, pcName );
+            prvWriteIPCStatistics( pxTelemetry, &xStatistics );
+            xReturn = prvEndRecord( pxTelemetry, xRecordStart );
+
+            traceRETURN_xTelemetryAddQueue( xReturn );
+
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        BaseType_t xTelemetryAddStreamBuffer( TelemetryBuffer_t * pxTelemetry,
+                                              StreamBufferHandle_t xStreamBuffer )
+        {
+            BaseType_t xReturn;
+            size_t xRecordStart;
+            IPCStatistics_t xStatistics;
+
+            traceENTER_xTelemetryAddStreamBuffer( pxTelemetry, xStreamBuffer );
+
+            configASSERT( pxTelemetry );
+            configASSERT( xStreamBuffer );
+
+            vStreamBufferGetStatistics( xStreamBuffer, &xStatistics );
+
+            xRecordStart = prvBeginRecord( pxTelemetry, telemetryRECORD_STREAM_BUFFER );
+            prvWriteValue( pxTelemetry, ( uint64_t ) uxStreamBufferGetStreamBufferNumber( xStreamBuffer ) );
+            prvWriteValue( pxTelemetry, ( uint64_t ) ucStreamBufferGetStreamBufferType( xStreamBuffer ) );
+            prvWriteIPCStatistics( pxTelemetry, &xStatistics );
+            xReturn = prvEndRecord( pxTelemetry, xRecordStart );
+
+            traceRETURN_xTelemetryAddStreamBuffer( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_IPC_STATISTICS */
+/*-----------------------------------------------------------*/
+
+    size_t xTelemetryEnd( TelemetryBuffer_t * pxTelemetry )
+    {
+        traceENTER_xTelemetryEnd( pxTelemetry );
+
+        configASSERT( pxTelemetry );
+
+        if( pxTelemetry->xTruncated != pdFALSE )
+        {
+            pxTelemetry->pucBuffer[ telemetryFLAGS_OFFSET ] |= telemetryFLAG_TRUNCATED;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTelemetryEnd( pxTelemetry->xBytesWritten );
+
+        return pxTelemetry->xBytesWritten;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the telemetry serialiser. If you want to include the telemetry
+ * serialiser then ensure configUSE_TELEMETRY is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TELEMETRY == 1 */
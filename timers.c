@@ -39,6 +39,10 @@
 #include "queue.h"
 #include "timers.h"
 
+#if ( configKERNEL_OBJECT_POOLS == 1 )
+    #include "object_pool.h"
+#endif
+
 #if ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 0 )
     #error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
 #endif
@@ -78,6 +82,7 @@
     #define tmrSTATUS_IS_ACTIVE                  ( 0x01U )
     #define tmrSTATUS_IS_STATICALLY_ALLOCATED    ( 0x02U )
     #define tmrSTATUS_IS_AUTORELOAD              ( 0x04U )
+    #define tmrSTATUS_IS_HARD                    ( 0x08U )
 
 /* The definition of the timers themselves. */
     typedef struct tmrTimerControl                                               /* The old naming convention is used to prevent breaking kernel aware debuggers. */
@@ -91,6 +96,16 @@
             UBaseType_t uxTimerNumber;                                           /**< An ID assigned by trace tools such as FreeRTOS+Trace */
         #endif
         uint8_t ucStatus;                                                        /**< Holds bits to say if the timer was statically allocated or not, and if it is active or not. */
+        #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+            TickType_t xDirectResetTime;                                         /**< The time of the last xTimerResetDirect() call not yet applied by the timer service task. */
+            uint8_t ucDirectResetPending;                                        /**< Set to pdTRUE while xDirectResetTime is waiting to be applied. */
+        #endif
+        #if ( configUSE_TIMER_SLACK == 1 )
+            TickType_t xTimerSlackInTicks;                                       /**< How late the timer is allowed to expire so it can be processed with other timers. */
+        #endif
+        #if ( configTIMER_SERVICE_TASKS > 1 )
+            UBaseType_t uxServiceTask;                                           /**< The index of the timer service task that processes the timer. */
+        #endif
     } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -109,6 +124,14 @@
     } TimerParameter_t;
 
 
+    #if ( configUSE_TIMER_GROUPS == 1 )
+        typedef struct tmrTimerGroupParameters
+        {
+            TickType_t xMessageValue;      /**< The command time, or the new period when changing the period of the timers. */
+            const TimerGroup_t * pxGroup;  /**< The group of timers to which the command will be applied. */
+        } TimerGroupParameter_t;
+    #endif /* configUSE_TIMER_GROUPS */
+
     typedef struct tmrCallbackParameters
     {
         portTIMER_CALLBACK_ATTRIBUTE
@@ -126,6 +149,10 @@
         {
             TimerParameter_t xTimerParameters;
 
+            #if ( configUSE_TIMER_GROUPS == 1 )
+                TimerGroupParameter_t xGroupParameters;
+            #endif
+
             /* Don't include xCallbackParameters if it is not going to be used as
              * it makes the structure (and therefore the timer queue) larger. */
             #if ( INCLUDE_xTimerPendFunctionCall == 1 )
@@ -134,20 +161,114 @@
         } u;
     } DaemonTaskMessage_t;
 
-/* The list in which active timers are stored.  Timers are referenced in expire
- * time order, with the nearest expiry time at the front of the list.  Only the
- * timer service task is allowed to access these lists.
- * xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
- * breaks some kernel aware debuggers, and debuggers that reply on removing the
- * static qualifier. */
-    PRIVILEGED_DATA static List_t xActiveTimerList1;
-    PRIVILEGED_DATA static List_t xActiveTimerList2;
-    PRIVILEGED_DATA static List_t * pxCurrentTimerList;
-    PRIVILEGED_DATA static List_t * pxOverflowTimerList;
-
-/* A queue that is used to send commands to the timer service task. */
-    PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
-    PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
+    #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+        #define tmrWHEEL_SLOTS              ( ( TickType_t ) configTIMER_WHEEL_SLOTS )
+        #define tmrWHEEL_INDEX( xTime )     ( ( TickType_t ) ( xTime ) & ( tmrWHEEL_SLOTS - ( TickType_t ) 1U ) )
+    #endif
+
+/* The state of one timer service task.  There are configTIMER_SERVICE_TASKS
+ * timer service tasks, each of which processes the commands sent to its own
+ * queue and calls the callbacks of the timers assigned to it, so a slow
+ * callback only delays the timers that share its service task. */
+    typedef struct tmrTimerServiceTask
+    {
+        /* The lists in which the active timers are stored.  Timers are
+         * referenced in expire time order, with the nearest expiry time at
+         * the front of the list.  Only the timer service task is allowed to
+         * access these lists. */
+        List_t xActiveTimerList1;
+        List_t xActiveTimerList2;
+        List_t * pxCurrentTimerList;
+        List_t * pxOverflowTimerList;
+
+        #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+
+            /* Active timers whose expiry time has not overflowed are held in a
+             * hashed timing wheel rather than in pxCurrentTimerList.  Each list
+             * holds, in expiry time order, the timers whose expiry time maps to
+             * it.  xTimerWheelTime is at or before the earliest expiry time held
+             * in the wheel, and is where searches for the next timer to expire
+             * start. */
+            List_t xTimerWheelLists[ configTIMER_WHEEL_SLOTS ];
+            TickType_t xTimerWheelTime;
+        #endif
+
+        QueueHandle_t xTimerQueue;   /**< The queue used to send commands to the timer service task. */
+        TaskHandle_t xTimerTaskHandle;
+        TickType_t xLastTime;        /**< The tick count when the timer service task last sampled it. */
+    } TimerServiceTask_t;
+
+    PRIVILEGED_DATA static TimerServiceTask_t xTimerServiceTasks[ configTIMER_SERVICE_TASKS ];
+
+/* The service task that pended function calls are sent to, and that the
+ * timers are assigned to unless vTimerSetServiceTask() is used. */
+    #define tmrDEFAULT_SERVICE_TASK    ( &( xTimerServiceTasks[ 0 ] ) )
+
+    #if ( configTIMER_SERVICE_TASKS > 1 )
+        #define tmrGET_SERVICE_TASK( pxTimer )    ( &( xTimerServiceTasks[ ( pxTimer )->uxServiceTask ] ) )
+
+        #ifdef configTIMER_SERVICE_TASK_PRIORITIES
+            static const UBaseType_t uxTimerServiceTaskPriorities[ configTIMER_SERVICE_TASKS ] = configTIMER_SERVICE_TASK_PRIORITIES;
+            #define tmrSERVICE_TASK_PRIORITY( uxServiceTask )    ( uxTimerServiceTaskPriorities[ uxServiceTask ] )
+        #endif
+
+        #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+            #ifdef configTIMER_SERVICE_TASK_CORE_AFFINITIES
+                static const UBaseType_t uxTimerServiceTaskCoreAffinities[ configTIMER_SERVICE_TASKS ] = configTIMER_SERVICE_TASK_CORE_AFFINITIES;
+                #define tmrSERVICE_TASK_CORE_AFFINITY( uxServiceTask )    ( uxTimerServiceTaskCoreAffinities[ uxServiceTask ] )
+            #elif ( configTIMER_SERVICE_TASK_PER_CORE == 1 )
+                #define tmrSERVICE_TASK_CORE_AFFINITY( uxServiceTask )    ( ( UBaseType_t ) 1U << ( ( uxServiceTask ) % ( UBaseType_t ) configNUMBER_OF_CORES ) )
+            #endif
+        #endif
+    #else /* if ( configTIMER_SERVICE_TASKS > 1 ) */
+        #define tmrGET_SERVICE_TASK( pxTimer )    tmrDEFAULT_SERVICE_TASK
+    #endif /* if ( configTIMER_SERVICE_TASKS > 1 ) */
+
+    #ifndef tmrSERVICE_TASK_PRIORITY
+        #define tmrSERVICE_TASK_PRIORITY( uxServiceTask )    ( ( UBaseType_t ) configTIMER_TASK_PRIORITY )
+    #endif
+
+    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+        #ifndef tmrSERVICE_TASK_CORE_AFFINITY
+            #define tmrSERVICE_TASK_CORE_AFFINITY( uxServiceTask )    ( ( UBaseType_t ) configTIMER_SERVICE_TASK_CORE_AFFINITY )
+        #endif
+    #endif
+
+    #if ( configKERNEL_OBJECT_POOLS == 1 )
+
+/* The pool dynamically allocated timers are drawn from.  It is created when
+ * the first such timer is created. */
+        PRIVILEGED_DATA static PoolHandle_t xTimerPool = NULL;
+
+        #define tmrALLOCATE_TIMER()         pvPoolAllocateKernelObject( &xTimerPool, sizeof( Timer_t ), configKERNEL_TIMER_POOL_LENGTH )
+        #define tmrFREE_TIMER( pxTimer )    vPoolFreeKernelObject( xTimerPool, ( pxTimer ) )
+    #else
+        #define tmrALLOCATE_TIMER()         pvPortMalloc( sizeof( Timer_t ) )
+        #define tmrFREE_TIMER( pxTimer )    vPortFree( pxTimer )
+    #endif
+
+    #if ( configUSE_HARD_TIMERS == 1 )
+
+/* The lists in which active hard timers are stored, in expiry time order.
+ * Hard timers are processed in the tick interrupt, so these lists are only
+ * accessed from within critical sections. */
+        PRIVILEGED_DATA static List_t xHardTimerList1;
+        PRIVILEGED_DATA static List_t xHardTimerList2;
+        PRIVILEGED_DATA static List_t * pxCurrentHardTimerList = NULL;
+        PRIVILEGED_DATA static List_t * pxOverflowHardTimerList = NULL;
+    #endif
+
+    #if ( configUSE_GRANULAR_LOCKS == 1 )
+
+/* Protects the members of the timers that can be updated outside the timer
+ * service task, in place of the kernel critical section. */
+        PRIVILEGED_DATA static portSPINLOCK_TYPE xTimerLock;
+    #endif
+
+/* Macros to mark the start and end of a critical section that accesses the
+ * members of a timer. */
+    #define tmrENTER_CRITICAL()    taskDATA_GROUP_ENTER_CRITICAL( &xTimerLock )
+    #define tmrEXIT_CRITICAL()     taskDATA_GROUP_EXIT_CRITICAL( &xTimerLock )
 
 /*-----------------------------------------------------------*/
 
@@ -160,7 +281,7 @@
 /*
  * The timer service task (daemon).  Timer functionality is controlled by this
  * task.  Other tasks communicate with the timer service task using the
- * xTimerQueue queue.
+ * xTimerQueue queue of the TimerServiceTask_t passed in pvParameters.
  */
     static portTASK_FUNCTION_PROTO( prvTimerTask, pvParameters ) PRIVILEGED_FUNCTION;
 
@@ -168,23 +289,121 @@
  * Called by the timer service task to interpret and process a command it
  * received on the timer queue.
  */
-    static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
+    static void prvProcessReceivedCommands( TimerServiceTask_t * const pxServiceTask ) PRIVILEGED_FUNCTION;
+
+    #if ( INCLUDE_xTimerPendFunctionCall == 1 )
+
+/*
+ * Post a request to execute xFunctionToPend to the queue of the given timer
+ * service task.
+ */
+        static BaseType_t prvPendFunctionCall( TimerServiceTask_t * const pxServiceTask,
+                                               PendedFunction_t xFunctionToPend,
+                                               void * pvParameter1,
+                                               uint32_t ulParameter2,
+                                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+        static BaseType_t prvPendFunctionCallFromISR( TimerServiceTask_t * const pxServiceTask,
+                                                      PendedFunction_t xFunctionToPend,
+                                                      void * pvParameter1,
+                                                      uint32_t ulParameter2,
+                                                      BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+    #endif /* INCLUDE_xTimerPendFunctionCall */
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow.  If
+ * pxMergeList is not NULL, a timer that belongs in the current timer list is
+ * inserted in pxMergeList instead, to be merged into the current timer list
+ * with the other timers of a group.
  */
-    static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer,
+    static BaseType_t prvInsertTimerInActiveList( TimerServiceTask_t * const pxServiceTask,
+                                                  Timer_t * const pxTimer,
                                                   const TickType_t xNextExpiryTime,
                                                   const TickType_t xTimeNow,
-                                                  const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+                                                  const TickType_t xCommandTime,
+                                                  List_t * const pxMergeList ) PRIVILEGED_FUNCTION;
+
+/*
+ * Make the timer active and insert it in the active list to expire one period
+ * after xCommandTime, as for a start or reset command, calling its callback
+ * now if that time has already passed.
+ */
+    static void prvStartTimer( TimerServiceTask_t * const pxServiceTask,
+                               Timer_t * const pxTimer,
+                               const TickType_t xCommandTime,
+                               const TickType_t xTimeNow,
+                               List_t * const pxMergeList ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_TIMER_GROUPS == 1 )
+
+/*
+ * Apply a group command to each timer in the group, then merge the timers that
+ * are to be inserted into the current timer list into it in a single pass.
+ */
+        static void prvProcessGroupCommand( TimerServiceTask_t * const pxServiceTask,
+                                            const DaemonTaskMessage_t * const pxMessage ) PRIVILEGED_FUNCTION;
+    #endif
+
+    #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+
+/*
+ * Insert the timer, whose expiry time has not overflowed, into the timing
+ * wheel.
+ */
+        static void prvInsertTimerInWheel( TimerServiceTask_t * const pxServiceTask,
+                                           Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the list item of the active timer that will expire first out of the
+ * timing wheel and pxCurrentTimerList, or NULL if both are empty.
+ */
+        static ListItem_t * prvGetFirstActiveTimerListItem( TimerServiceTask_t * const pxServiceTask ) PRIVILEGED_FUNCTION;
+
+    #endif /* configTIMER_LIST_IMPLEMENTATION */
+
+    #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+
+/*
+ * Called when an active timer reaches its expiry time.  If xTimerResetDirect()
+ * has been called since the timer was last inserted in the active list, move
+ * the timer to the expiry time relative to that reset and return pdTRUE.
+ * Otherwise return pdFALSE, with *pxExpiredTime updated if the reset expiry
+ * time has already passed too.
+ */
+        static BaseType_t prvApplyDirectReset( TimerServiceTask_t * const pxServiceTask,
+                                               Timer_t * const pxTimer,
+                                               TickType_t * const pxExpiredTime,
+                                               const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_TIMER_DIRECT_RESET */
+
+    #if ( configUSE_TIMER_SLACK == 1 )
+
+/*
+ * Return the latest time at which every timer that has expired by then is
+ * still within its slack, given that pxFirstListItem is the active timer that
+ * will expire first.
+ */
+        static TickType_t prvGetCoalescedExpireTime( TimerServiceTask_t * const pxServiceTask,
+                                                     const ListItem_t * const pxFirstListItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Walk pxList, which is in expiry time order, lowering xCoalescedTime to the
+ * slack limit of each timer that expires at or before it.
+ */
+        static TickType_t prvCoalesceTimerList( const List_t * const pxList,
+                                                TickType_t xCoalescedTime ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_TIMER_SLACK */
 
 /*
  * Reload the specified auto-reload timer.  If the reloading is backlogged,
  * clear the backlog, calling the callback for each additional reload.  When
  * this function returns, the next expiry time is after xTimeNow.
  */
-    static void prvReloadTimer( Timer_t * const pxTimer,
+    static void prvReloadTimer( TimerServiceTask_t * const pxServiceTask,
+                                Timer_t * const pxTimer,
                                 TickType_t xExpiredTime,
                                 const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
@@ -192,20 +411,22 @@
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto-reload timer, then call its callback.
  */
-    static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
+    static void prvProcessExpiredTimer( TimerServiceTask_t * const pxServiceTask,
+                                        const TickType_t xNextExpireTime,
                                         const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
 /*
  * The tick count has overflowed.  Switch the timer lists after ensuring the
  * current timer list does not still reference some timers.
  */
-    static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+    static void prvSwitchTimerLists( TimerServiceTask_t * const pxServiceTask ) PRIVILEGED_FUNCTION;
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
  * if a tick count overflow occurred since prvSampleTimeNow() was last called.
  */
-    static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
+    static TickType_t prvSampleTimeNow( TimerServiceTask_t * const pxServiceTask,
+                                        BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
 
 /*
  * If the timer list contains any active timers then return the expire time of
@@ -213,15 +434,45 @@
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
  * to pdTRUE.
  */
-    static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
+    static TickType_t prvGetNextExpireTime( TimerServiceTask_t * const pxServiceTask,
+                                            BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*
  * If a timer has expired, process it.  Otherwise, block the timer service task
  * until either a timer does expire or a command is received.
  */
-    static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
+    static void prvProcessTimerOrBlockTask( TimerServiceTask_t * const pxServiceTask,
+                                            const TickType_t xNextExpireTime,
                                             BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
+    #if ( configUSE_HARD_TIMERS == 1 )
+
+/*
+ * Insert the hard timer into the current or overflow hard timer list,
+ * depending on whether xNextExpiryTime has overflowed relative to
+ * xReferenceTime.  Must be called from within a critical section.
+ */
+        static void prvInsertHardTimer( Timer_t * const pxTimer,
+                                        const TickType_t xNextExpiryTime,
+                                        const TickType_t xReferenceTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Execute a command sent to a hard timer immediately, instead of sending it
+ * to a timer service task.  Must be called from within a critical section.
+ */
+        static void prvExecuteHardTimerCommand( Timer_t * const pxTimer,
+                                                const BaseType_t xCommandID,
+                                                const TickType_t xOptionalValue,
+                                                const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * The hard timer at the head of the current hard timer list has expired.
+ * Reload it if it is an auto-reload timer, then call its callback.
+ */
+        static void prvProcessExpiredHardTimer( void ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_HARD_TIMERS */
+
 /*
  * Called after a Timer_t structure has been allocated either statically or
  * dynamically to fill in the structure's members.
@@ -237,6 +488,8 @@
     BaseType_t xTimerCreateTimerTask( void )
     {
         BaseType_t xReturn = pdFAIL;
+        UBaseType_t uxServiceTask;
+        TimerServiceTask_t * pxServiceTask;
 
         traceENTER_xTimerCreateTimerTask();
 
@@ -246,9 +499,12 @@
          * been created then the initialisation will already have been performed. */
         prvCheckForValidListAndQueue();
 
-        if( xTimerQueue != NULL )
+        for( uxServiceTask = ( UBaseType_t ) 0U; uxServiceTask < ( UBaseType_t ) configTIMER_SERVICE_TASKS; uxServiceTask++ )
         {
-            #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+            pxServiceTask = &( xTimerServiceTasks[ uxServiceTask ] );
+            xReturn = pdFAIL;
+
+            if( pxServiceTask->xTimerQueue != NULL )
             {
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
@@ -256,71 +512,79 @@
                     StackType_t * pxTimerTaskStackBuffer = NULL;
                     configSTACK_DEPTH_TYPE uxTimerTaskStackSize;
 
-                    vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &uxTimerTaskStackSize );
-                    xTimerTaskHandle = xTaskCreateStaticAffinitySet( prvTimerTask,
-                                                                     configTIMER_SERVICE_TASK_NAME,
-                                                                     uxTimerTaskStackSize,
-                                                                     NULL,
-                                                                     ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-                                                                     pxTimerTaskStackBuffer,
-                                                                     pxTimerTaskTCBBuffer,
-                                                                     configTIMER_SERVICE_TASK_CORE_AFFINITY );
-
-                    if( xTimerTaskHandle != NULL )
+                    #if ( configTIMER_SERVICE_TASKS > 1 )
+                        if( uxServiceTask > ( UBaseType_t ) 0U )
+                        {
+                            vApplicationGetTimerServiceTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &uxTimerTaskStackSize, uxServiceTask );
+                        }
+                        else
+                    #endif
                     {
-                        xReturn = pdPASS;
+                        vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &uxTimerTaskStackSize );
                     }
-                }
-                #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
-                {
-                    xReturn = xTaskCreateAffinitySet( prvTimerTask,
-                                                      configTIMER_SERVICE_TASK_NAME,
-                                                      configTIMER_TASK_STACK_DEPTH,
-                                                      NULL,
-                                                      ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-                                                      configTIMER_SERVICE_TASK_CORE_AFFINITY,
-                                                      &xTimerTaskHandle );
-                }
-                #endif /* configSUPPORT_STATIC_ALLOCATION */
-            }
-            #else /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) ) */
-            {
-                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
-                {
-                    StaticTask_t * pxTimerTaskTCBBuffer = NULL;
-                    StackType_t * pxTimerTaskStackBuffer = NULL;
-                    configSTACK_DEPTH_TYPE uxTimerTaskStackSize;
 
-                    vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &uxTimerTaskStackSize );
-                    xTimerTaskHandle = xTaskCreateStatic( prvTimerTask,
-                                                          configTIMER_SERVICE_TASK_NAME,
-                                                          uxTimerTaskStackSize,
-                                                          NULL,
-                                                          ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-                                                          pxTimerTaskStackBuffer,
-                                                          pxTimerTaskTCBBuffer );
+                    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+                    {
+                        pxServiceTask->xTimerTaskHandle = xTaskCreateStaticAffinitySet( prvTimerTask,
+                                                                                        configTIMER_SERVICE_TASK_NAME,
+                                                                                        uxTimerTaskStackSize,
+                                                                                        ( void * ) pxServiceTask,
+                                                                                        tmrSERVICE_TASK_PRIORITY( uxServiceTask ) | portPRIVILEGE_BIT,
+                                                                                        pxTimerTaskStackBuffer,
+                                                                                        pxTimerTaskTCBBuffer,
+                                                                                        tmrSERVICE_TASK_CORE_AFFINITY( uxServiceTask ) );
+                    }
+                    #else
+                    {
+                        pxServiceTask->xTimerTaskHandle = xTaskCreateStatic( prvTimerTask,
+                                                                             configTIMER_SERVICE_TASK_NAME,
+                                                                             uxTimerTaskStackSize,
+                                                                             ( void * ) pxServiceTask,
+                                                                             tmrSERVICE_TASK_PRIORITY( uxServiceTask ) | portPRIVILEGE_BIT,
+                                                                             pxTimerTaskStackBuffer,
+                                                                             pxTimerTaskTCBBuffer );
+                    }
+                    #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) ) */
 
-                    if( xTimerTaskHandle != NULL )
+                    if( pxServiceTask->xTimerTaskHandle != NULL )
                     {
                         xReturn = pdPASS;
                     }
                 }
                 #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
                 {
-                    xReturn = xTaskCreate( prvTimerTask,
-                                           configTIMER_SERVICE_TASK_NAME,
-                                           configTIMER_TASK_STACK_DEPTH,
-                                           NULL,
-                                           ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-                                           &xTimerTaskHandle );
+                    #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+                    {
+                        xReturn = xTaskCreateAffinitySet( prvTimerTask,
+                                                          configTIMER_SERVICE_TASK_NAME,
+                                                          configTIMER_TASK_STACK_DEPTH,
+                                                          ( void * ) pxServiceTask,
+                                                          tmrSERVICE_TASK_PRIORITY( uxServiceTask ) | portPRIVILEGE_BIT,
+                                                          tmrSERVICE_TASK_CORE_AFFINITY( uxServiceTask ),
+                                                          &( pxServiceTask->xTimerTaskHandle ) );
+                    }
+                    #else
+                    {
+                        xReturn = xTaskCreate( prvTimerTask,
+                                               configTIMER_SERVICE_TASK_NAME,
+                                               configTIMER_TASK_STACK_DEPTH,
+                                               ( void * ) pxServiceTask,
+                                               tmrSERVICE_TASK_PRIORITY( uxServiceTask ) | portPRIVILEGE_BIT,
+                                               &( pxServiceTask->xTimerTaskHandle ) );
+                    }
+                    #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) ) */
                 }
                 #endif /* configSUPPORT_STATIC_ALLOCATION */
             }
-            #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) ) */
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xReturn == pdFAIL )
+            {
+                break;
+            }
         }
 
         configASSERT( xReturn );
@@ -346,7 +610,7 @@
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
+            pxNewTimer = ( Timer_t * ) tmrALLOCATE_TIMER();
 
             if( pxNewTimer != NULL )
             {
@@ -436,6 +700,34 @@
         pxNewTimer->pxCallbackFunction = pxCallbackFunction;
         vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
 
+        #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+        {
+            pxNewTimer->ucDirectResetPending = ( uint8_t ) pdFALSE;
+        }
+        #endif
+
+        #if ( configUSE_TIMER_SLACK == 1 )
+        {
+            pxNewTimer->xTimerSlackInTicks = ( TickType_t ) 0U;
+        }
+        #endif
+
+        #if ( configTIMER_SERVICE_TASKS > 1 )
+        {
+            #if ( ( configTIMER_SERVICE_TASK_PER_CORE == 1 ) && ( configNUMBER_OF_CORES > 1 ) )
+            {
+                /* Timers are processed by the service task of the core that
+                 * created them. */
+                pxNewTimer->uxServiceTask = ( ( UBaseType_t ) portGET_CORE_ID() ) % ( UBaseType_t ) configTIMER_SERVICE_TASKS;
+            }
+            #else
+            {
+                pxNewTimer->uxServiceTask = ( UBaseType_t ) 0U;
+            }
+            #endif
+        }
+        #endif
+
         if( xAutoReload != pdFALSE )
         {
             pxNewTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_AUTORELOAD;
@@ -453,6 +745,7 @@
     {
         BaseType_t xReturn = pdFAIL;
         DaemonTaskMessage_t xMessage;
+        QueueHandle_t xTimerQueue;
 
         ( void ) pxHigherPriorityTaskWoken;
 
@@ -460,6 +753,43 @@
 
         configASSERT( xTimer );
 
+        xTimerQueue = tmrGET_SERVICE_TASK( ( Timer_t * ) xTimer )->xTimerQueue;
+
+        #if ( configUSE_HARD_TIMERS == 1 )
+            if( ( ( ( Timer_t * ) xTimer )->ucStatus & tmrSTATUS_IS_HARD ) != 0U )
+            {
+                Timer_t * const pxTimer = xTimer;
+
+                /* Hard timers are not processed by a timer service task, so
+                 * execute the command now. */
+                configASSERT( xCommandID < tmrFIRST_FROM_ISR_COMMAND );
+
+                taskENTER_CRITICAL();
+                {
+                    prvExecuteHardTimerCommand( pxTimer, xCommandID, xOptionalValue, xTaskGetTickCount() );
+                }
+                taskEXIT_CRITICAL();
+
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    if( ( xCommandID == tmrCOMMAND_DELETE ) && ( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == 0U ) )
+                    {
+                        tmrFREE_TIMER( pxTimer );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+                xReturn = pdPASS;
+
+                traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+            }
+            else
+        #endif /* configUSE_HARD_TIMERS */
+
         /* Send a message to the timer service task to perform a particular action
          * on a particular timer definition. */
         if( xTimerQueue != NULL )
@@ -504,6 +834,7 @@
     {
         BaseType_t xReturn = pdFAIL;
         DaemonTaskMessage_t xMessage;
+        QueueHandle_t xTimerQueue;
 
         ( void ) xTicksToWait;
 
@@ -511,6 +842,30 @@
 
         configASSERT( xTimer );
 
+        xTimerQueue = tmrGET_SERVICE_TASK( ( Timer_t * ) xTimer )->xTimerQueue;
+
+        #if ( configUSE_HARD_TIMERS == 1 )
+            if( ( ( ( Timer_t * ) xTimer )->ucStatus & tmrSTATUS_IS_HARD ) != 0U )
+            {
+                UBaseType_t uxSavedInterruptStatus;
+
+                /* Hard timers are not processed by a timer service task, so
+                 * execute the command now. */
+                configASSERT( xCommandID >= tmrFIRST_FROM_ISR_COMMAND );
+
+                uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+                {
+                    prvExecuteHardTimerCommand( xTimer, xCommandID, xOptionalValue, xTaskGetTickCountFromISR() );
+                }
+                taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+                xReturn = pdPASS;
+
+                traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+            }
+            else
+        #endif /* configUSE_HARD_TIMERS */
+
         /* Send a message to the timer service task to perform a particular action
          * on a particular timer definition. */
         if( xTimerQueue != NULL )
@@ -540,76 +895,242 @@
     }
 /*-----------------------------------------------------------*/
 
-    TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
-    {
-        traceENTER_xTimerGetTimerDaemonTaskHandle();
+    #if ( configUSE_TIMER_GROUPS == 1 )
 
-        /* If xTimerGetTimerDaemonTaskHandle() is called before the scheduler has been
-         * started, then xTimerTaskHandle will be NULL. */
-        configASSERT( ( xTimerTaskHandle != NULL ) );
+        BaseType_t xTimerGroupGenericCommand( const TimerGroup_t * const pxGroup,
+                                              const BaseType_t xCommandID,
+                                              const TickType_t xOptionalValue,
+                                              const TickType_t xTicksToWait )
+        {
+            BaseType_t xReturn = pdFAIL;
+            DaemonTaskMessage_t xMessage;
+            QueueHandle_t xTimerQueue;
 
-        traceRETURN_xTimerGetTimerDaemonTaskHandle( xTimerTaskHandle );
+            traceENTER_xTimerGroupGenericCommand( pxGroup, xCommandID, xOptionalValue, xTicksToWait );
 
-        return xTimerTaskHandle;
-    }
-/*-----------------------------------------------------------*/
+            configASSERT( pxGroup );
+            configASSERT( pxGroup->uxTimerCount > ( UBaseType_t ) 0U );
+            configASSERT( xCommandID >= tmrFIRST_GROUP_COMMAND );
 
-    TickType_t xTimerGetPeriod( TimerHandle_t xTimer )
-    {
-        Timer_t * pxTimer = xTimer;
+            /* Every timer in the group is processed by the same service task,
+             * so the command is sent to the first timer's. */
+            xTimerQueue = tmrGET_SERVICE_TASK( ( Timer_t * ) pxGroup->pxTimers[ 0 ] )->xTimerQueue;
 
-        traceENTER_xTimerGetPeriod( xTimer );
+            if( xTimerQueue != NULL )
+            {
+                xMessage.xMessageID = xCommandID;
+                xMessage.u.xGroupParameters.xMessageValue = xOptionalValue;
+                xMessage.u.xGroupParameters.pxGroup = pxGroup;
 
-        configASSERT( xTimer );
+                if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+                {
+                    xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+                }
+                else
+                {
+                    xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-        traceRETURN_xTimerGetPeriod( pxTimer->xTimerPeriodInTicks );
+            traceRETURN_xTimerGroupGenericCommand( xReturn );
 
-        return pxTimer->xTimerPeriodInTicks;
-    }
-/*-----------------------------------------------------------*/
+            return xReturn;
+        }
 
-    void vTimerSetReloadMode( TimerHandle_t xTimer,
-                              const BaseType_t xAutoReload )
-    {
-        Timer_t * pxTimer = xTimer;
+    #endif /* configUSE_TIMER_GROUPS */
+/*-----------------------------------------------------------*/
 
-        traceENTER_vTimerSetReloadMode( xTimer, xAutoReload );
+    #if ( configUSE_TIMER_DIRECT_RESET == 1 )
 
-        configASSERT( xTimer );
-        taskENTER_CRITICAL();
+        BaseType_t xTimerResetDirect( TimerHandle_t xTimer,
+                                      TickType_t xTicksToWait )
         {
-            if( xAutoReload != pdFALSE )
+            Timer_t * const pxTimer = xTimer;
+            BaseType_t xReturn = pdFAIL;
+            QueueHandle_t xTimerQueue;
+
+            traceENTER_xTimerResetDirect( xTimer, xTicksToWait );
+
+            configASSERT( xTimer );
+
+            xTimerQueue = tmrGET_SERVICE_TASK( pxTimer )->xTimerQueue;
+
+            tmrENTER_CRITICAL();
             {
-                pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_AUTORELOAD;
+                /* Only an active timer can be reset in place, and only when no
+                 * earlier command is queued that the reset must follow. */
+                if( ( ( pxTimer->ucStatus & tmrSTATUS_IS_ACTIVE ) != 0U ) &&
+                    ( ( pxTimer->ucStatus & tmrSTATUS_IS_HARD ) == 0U ) &&
+                    ( xTimerQueue != NULL ) &&
+                    ( uxQueueMessagesWaiting( xTimerQueue ) == ( UBaseType_t ) 0U ) )
+                {
+                    pxTimer->xDirectResetTime = xTaskGetTickCount();
+                    pxTimer->ucDirectResetPending = ( uint8_t ) pdTRUE;
+                    xReturn = pdPASS;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            tmrEXIT_CRITICAL();
+
+            if( xReturn == pdFAIL )
+            {
+                xReturn = xTimerReset( xTimer, xTicksToWait );
             }
             else
             {
-                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_AUTORELOAD );
+                mtCOVERAGE_TEST_MARKER();
             }
+
+            traceRETURN_xTimerResetDirect( xReturn );
+
+            return xReturn;
         }
-        taskEXIT_CRITICAL();
 
-        traceRETURN_vTimerSetReloadMode();
-    }
+    #endif /* configUSE_TIMER_DIRECT_RESET */
 /*-----------------------------------------------------------*/
 
-    BaseType_t xTimerGetReloadMode( TimerHandle_t xTimer )
+    TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
     {
-        Timer_t * pxTimer = xTimer;
-        BaseType_t xReturn;
+        traceENTER_xTimerGetTimerDaemonTaskHandle();
 
-        traceENTER_xTimerGetReloadMode( xTimer );
+        /* If xTimerGetTimerDaemonTaskHandle() is called before the scheduler has been
+         * started, then xTimerTaskHandle will be NULL. */
+        configASSERT( ( tmrDEFAULT_SERVICE_TASK->xTimerTaskHandle != NULL ) );
 
-        configASSERT( xTimer );
-        portBASE_TYPE_ENTER_CRITICAL();
+        traceRETURN_xTimerGetTimerDaemonTaskHandle( tmrDEFAULT_SERVICE_TASK->xTimerTaskHandle );
+
+        return tmrDEFAULT_SERVICE_TASK->xTimerTaskHandle;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configTIMER_SERVICE_TASKS > 1 )
+
+        TaskHandle_t xTimerGetServiceTaskHandle( UBaseType_t uxServiceTask )
         {
-            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) == 0U )
-            {
-                /* Not an auto-reload timer. */
-                xReturn = pdFALSE;
-            }
-            else
-            {
+            traceENTER_xTimerGetServiceTaskHandle( uxServiceTask );
+
+            configASSERT( uxServiceTask < ( UBaseType_t ) configTIMER_SERVICE_TASKS );
+
+            /* The timer service tasks are created when the scheduler is
+             * started. */
+            configASSERT( ( xTimerServiceTasks[ uxServiceTask ].xTimerTaskHandle != NULL ) );
+
+            traceRETURN_xTimerGetServiceTaskHandle( xTimerServiceTasks[ uxServiceTask ].xTimerTaskHandle );
+
+            return xTimerServiceTasks[ uxServiceTask ].xTimerTaskHandle;
+        }
+/*-----------------------------------------------------------*/
+
+        void vTimerSetServiceTask( TimerHandle_t xTimer,
+                                   UBaseType_t uxServiceTask )
+        {
+            Timer_t * const pxTimer = xTimer;
+
+            traceENTER_vTimerSetServiceTask( xTimer, uxServiceTask );
+
+            configASSERT( xTimer );
+            configASSERT( uxServiceTask < ( UBaseType_t ) configTIMER_SERVICE_TASKS );
+
+            tmrENTER_CRITICAL();
+            {
+                /* An active timer is held in the lists of its current service
+                 * task, so can only be moved while it is dormant. */
+                configASSERT( ( pxTimer->ucStatus & tmrSTATUS_IS_ACTIVE ) == 0U );
+
+                pxTimer->uxServiceTask = uxServiceTask;
+            }
+            tmrEXIT_CRITICAL();
+
+            traceRETURN_vTimerSetServiceTask();
+        }
+/*-----------------------------------------------------------*/
+
+        UBaseType_t uxTimerGetServiceTask( TimerHandle_t xTimer )
+        {
+            Timer_t * const pxTimer = xTimer;
+            UBaseType_t uxReturn;
+
+            traceENTER_uxTimerGetServiceTask( xTimer );
+
+            configASSERT( xTimer );
+
+            tmrENTER_CRITICAL();
+            {
+                uxReturn = pxTimer->uxServiceTask;
+            }
+            tmrEXIT_CRITICAL();
+
+            traceRETURN_uxTimerGetServiceTask( uxReturn );
+
+            return uxReturn;
+        }
+
+    #endif /* configTIMER_SERVICE_TASKS */
+/*-----------------------------------------------------------*/
+
+    TickType_t xTimerGetPeriod( TimerHandle_t xTimer )
+    {
+        Timer_t * pxTimer = xTimer;
+
+        traceENTER_xTimerGetPeriod( xTimer );
+
+        configASSERT( xTimer );
+
+        traceRETURN_xTimerGetPeriod( pxTimer->xTimerPeriodInTicks );
+
+        return pxTimer->xTimerPeriodInTicks;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTimerSetReloadMode( TimerHandle_t xTimer,
+                              const BaseType_t xAutoReload )
+    {
+        Timer_t * pxTimer = xTimer;
+
+        traceENTER_vTimerSetReloadMode( xTimer, xAutoReload );
+
+        configASSERT( xTimer );
+        tmrENTER_CRITICAL();
+        {
+            if( xAutoReload != pdFALSE )
+            {
+                pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_AUTORELOAD;
+            }
+            else
+            {
+                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_AUTORELOAD );
+            }
+        }
+        tmrEXIT_CRITICAL();
+
+        traceRETURN_vTimerSetReloadMode();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTimerGetReloadMode( TimerHandle_t xTimer )
+    {
+        Timer_t * pxTimer = xTimer;
+        BaseType_t xReturn;
+
+        traceENTER_xTimerGetReloadMode( xTimer );
+
+        configASSERT( xTimer );
+        portBASE_TYPE_ENTER_CRITICAL();
+        {
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) == 0U )
+            {
+                /* Not an auto-reload timer. */
+                xReturn = pdFALSE;
+            }
+            else
+            {
                 /* Is an auto-reload timer. */
                 xReturn = pdTRUE;
             }
@@ -635,6 +1156,250 @@
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_HARD_TIMERS == 1 )
+
+        void vTimerSetHardMode( TimerHandle_t xTimer,
+                                const BaseType_t xHard )
+        {
+            Timer_t * pxTimer = xTimer;
+
+            traceENTER_vTimerSetHardMode( xTimer, xHard );
+
+            configASSERT( xTimer );
+            tmrENTER_CRITICAL();
+            {
+                /* The lists the timer is held in while active depend on the
+                 * mode, so the mode can only be changed while it is dormant. */
+                configASSERT( ( pxTimer->ucStatus & tmrSTATUS_IS_ACTIVE ) == 0U );
+
+                if( xHard != pdFALSE )
+                {
+                    pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_HARD;
+                }
+                else
+                {
+                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_HARD );
+                }
+            }
+            tmrEXIT_CRITICAL();
+
+            traceRETURN_vTimerSetHardMode();
+        }
+/*-----------------------------------------------------------*/
+
+        BaseType_t xTimerGetHardMode( TimerHandle_t xTimer )
+        {
+            Timer_t * pxTimer = xTimer;
+            BaseType_t xReturn;
+
+            traceENTER_xTimerGetHardMode( xTimer );
+
+            configASSERT( xTimer );
+            portBASE_TYPE_ENTER_CRITICAL();
+            {
+                if( ( pxTimer->ucStatus & tmrSTATUS_IS_HARD ) == 0U )
+                {
+                    xReturn = pdFALSE;
+                }
+                else
+                {
+                    xReturn = pdTRUE;
+                }
+            }
+            portBASE_TYPE_EXIT_CRITICAL();
+
+            traceRETURN_xTimerGetHardMode( xReturn );
+
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvInsertHardTimer( Timer_t * const pxTimer,
+                                        const TickType_t xNextExpiryTime,
+                                        const TickType_t xReferenceTime )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+            listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+            if( xNextExpiryTime < xReferenceTime )
+            {
+                /* The expiry time overflowed. */
+                vListInsert( pxOverflowHardTimerList, &( pxTimer->xTimerListItem ) );
+            }
+            else
+            {
+                vListInsert( pxCurrentHardTimerList, &( pxTimer->xTimerListItem ) );
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvExecuteHardTimerCommand( Timer_t * const pxTimer,
+                                                const BaseType_t xCommandID,
+                                                const TickType_t xOptionalValue,
+                                                const TickType_t xTimeNow )
+        {
+            if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+            {
+                ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceTIMER_COMMAND_RECEIVED( pxTimer, xCommandID, xOptionalValue );
+
+            switch( xCommandID )
+            {
+                case tmrCOMMAND_START:
+                case tmrCOMMAND_START_FROM_ISR:
+                case tmrCOMMAND_RESET:
+                case tmrCOMMAND_RESET_FROM_ISR:
+
+                    /* The command is executed when it is sent, so the period
+                     * is measured from now. */
+                    pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+                    prvInsertHardTimer( pxTimer, xTimeNow + pxTimer->xTimerPeriodInTicks, xTimeNow );
+                    break;
+
+                case tmrCOMMAND_CHANGE_PERIOD:
+                case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
+                    pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+                    pxTimer->xTimerPeriodInTicks = xOptionalValue;
+                    configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+                    prvInsertHardTimer( pxTimer, xTimeNow + pxTimer->xTimerPeriodInTicks, xTimeNow );
+                    break;
+
+                case tmrCOMMAND_STOP:
+                case tmrCOMMAND_STOP_FROM_ISR:
+                case tmrCOMMAND_DELETE:
+                    /* The timer has already been removed from the active list.
+                     * The caller frees a deleted timer. */
+                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                    break;
+
+                default:
+                    /* Don't expect to get here. */
+                    break;
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvProcessExpiredHardTimer( void )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentHardTimerList );
+            const TickType_t xExpiredTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+
+            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+            {
+                /* Measure the next period from the expiry time rather than
+                 * from now so the timer does not drift.  If the next expiry
+                 * time has passed too, the timer is processed again before
+                 * the tick interrupt returns. */
+                prvInsertHardTimer( pxTimer, xExpiredTime + pxTimer->xTimerPeriodInTicks, xExpiredTime );
+            }
+            else
+            {
+                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+            }
+
+            traceTIMER_EXPIRED( pxTimer );
+            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+        }
+/*-----------------------------------------------------------*/
+
+        void vTimerProcessHardTimers( const TickType_t xTickCount )
+        {
+            List_t * pxTemp;
+            UBaseType_t uxSavedInterruptStatus;
+
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                /* The lists are created with the first timer. */
+                if( pxCurrentHardTimerList != NULL )
+                {
+                    if( xTickCount == ( TickType_t ) 0U )
+                    {
+                        /* The tick count has overflowed, so any timers still
+                         * referenced from the current list have expired.
+                         * Process them, then switch the lists. */
+                        while( listLIST_IS_EMPTY( pxCurrentHardTimerList ) == pdFALSE )
+                        {
+                            prvProcessExpiredHardTimer();
+                        }
+
+                        pxTemp = pxCurrentHardTimerList;
+                        pxCurrentHardTimerList = pxOverflowHardTimerList;
+                        pxOverflowHardTimerList = pxTemp;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    while( ( listLIST_IS_EMPTY( pxCurrentHardTimerList ) == pdFALSE ) &&
+                           ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentHardTimerList ) <= xTickCount ) )
+                    {
+                        prvProcessExpiredHardTimer();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+/*-----------------------------------------------------------*/
+
+        TickType_t xTimerGetTicksToNextHardTimer( const TickType_t xTickCount )
+        {
+            TickType_t xReturn = portMAX_DELAY;
+
+            taskENTER_CRITICAL();
+            {
+                if( pxCurrentHardTimerList != NULL )
+                {
+                    if( listLIST_IS_EMPTY( pxCurrentHardTimerList ) == pdFALSE )
+                    {
+                        if( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentHardTimerList ) > xTickCount )
+                        {
+                            xReturn = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentHardTimerList ) - xTickCount;
+                        }
+                        else
+                        {
+                            xReturn = ( TickType_t ) 0U;
+                        }
+                    }
+                    else if( listLIST_IS_EMPTY( pxOverflowHardTimerList ) == pdFALSE )
+                    {
+                        /* The subtraction wraps to the number of ticks until
+                         * the overflowed expiry time. */
+                        xReturn = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxOverflowHardTimerList ) - xTickCount;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_HARD_TIMERS */
+/*-----------------------------------------------------------*/
+
     TickType_t xTimerGetExpiryTime( TimerHandle_t xTimer )
     {
         Timer_t * pxTimer = xTimer;
@@ -645,6 +1410,23 @@
         configASSERT( xTimer );
         xReturn = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
 
+        #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+        {
+            tmrENTER_CRITICAL();
+            {
+                if( pxTimer->ucDirectResetPending != ( uint8_t ) pdFALSE )
+                {
+                    xReturn = pxTimer->xDirectResetTime + pxTimer->xTimerPeriodInTicks;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            tmrEXIT_CRITICAL();
+        }
+        #endif
+
         traceRETURN_xTimerGetExpiryTime( xReturn );
 
         return xReturn;
@@ -696,14 +1478,15 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvReloadTimer( Timer_t * const pxTimer,
+    static void prvReloadTimer( TimerServiceTask_t * const pxServiceTask,
+                                Timer_t * const pxTimer,
                                 TickType_t xExpiredTime,
                                 const TickType_t xTimeNow )
     {
         /* Insert the timer into the appropriate list for the next expiry time.
          * If the next expiry time has already passed, advance the expiry time,
          * call the callback function, and try again. */
-        while( prvInsertTimerInActiveList( pxTimer, ( xExpiredTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xExpiredTime ) != pdFALSE )
+        while( prvInsertTimerInActiveList( pxServiceTask, pxTimer, ( xExpiredTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xExpiredTime, NULL ) != pdFALSE )
         {
             /* Advance the expiry time. */
             xExpiredTime += pxTimer->xTimerPeriodInTicks;
@@ -715,34 +1498,92 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
+    static void prvProcessExpiredTimer( TimerServiceTask_t * const pxServiceTask,
+                                        const TickType_t xNextExpireTime,
                                         const TickType_t xTimeNow )
     {
-        /* MISRA Ref 11.5.3 [Void pointer assignment] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-        /* coverity[misra_c_2012_rule_11_5_violation] */
-        Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+        #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            Timer_t * const pxTimer = ( Timer_t * ) listGET_LIST_ITEM_OWNER( prvGetFirstActiveTimerListItem( pxServiceTask ) );
+        #else
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxServiceTask->pxCurrentTimerList );
+        #endif
+
+        TickType_t xExpiredTime = xNextExpireTime;
 
         /* Remove the timer from the list of active timers.  A check has already
          * been performed to ensure the list is not empty. */
 
         ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
 
-        /* If the timer is an auto-reload timer then calculate the next
-         * expiry time and re-insert the timer in the list of active timers. */
-        if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+        #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+            if( prvApplyDirectReset( pxServiceTask, pxTimer, &xExpiredTime, xTimeNow ) == pdFALSE )
+        #endif
         {
-            prvReloadTimer( pxTimer, xNextExpireTime, xTimeNow );
+            /* If the timer is an auto-reload timer then calculate the next
+             * expiry time and re-insert the timer in the list of active timers. */
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+            {
+                prvReloadTimer( pxServiceTask, pxTimer, xExpiredTime, xTimeNow );
+            }
+            else
+            {
+                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+            }
+
+            /* Call the timer callback. */
+            traceTIMER_EXPIRED( pxTimer );
+            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
         }
-        else
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+
+        static BaseType_t prvApplyDirectReset( TimerServiceTask_t * const pxServiceTask,
+                                               Timer_t * const pxTimer,
+                                               TickType_t * const pxExpiredTime,
+                                               const TickType_t xTimeNow )
         {
-            pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+            BaseType_t xReinserted = pdFALSE;
+            BaseType_t xResetPending;
+            TickType_t xResetTime;
+
+            tmrENTER_CRITICAL();
+            {
+                xResetPending = ( BaseType_t ) pxTimer->ucDirectResetPending;
+                xResetTime = pxTimer->xDirectResetTime;
+                pxTimer->ucDirectResetPending = ( uint8_t ) pdFALSE;
+            }
+            tmrEXIT_CRITICAL();
+
+            if( xResetPending != pdFALSE )
+            {
+                if( prvInsertTimerInActiveList( pxServiceTask, pxTimer, xResetTime + pxTimer->xTimerPeriodInTicks, xTimeNow, xResetTime, NULL ) == pdFALSE )
+                {
+                    xReinserted = pdTRUE;
+                }
+                else
+                {
+                    /* The reset expiry time has passed as well, so the timer
+                     * expires relative to the reset. */
+                    *pxExpiredTime = xResetTime + pxTimer->xTimerPeriodInTicks;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return xReinserted;
         }
 
-        /* Call the timer callback. */
-        traceTIMER_EXPIRED( pxTimer );
-        pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-    }
+    #endif /* configUSE_TIMER_DIRECT_RESET */
 /*-----------------------------------------------------------*/
 
     static portTASK_FUNCTION( prvTimerTask, pvParameters )
@@ -750,16 +1591,27 @@
         TickType_t xNextExpireTime;
         BaseType_t xListWasEmpty;
 
-        /* Just to avoid compiler warnings. */
-        ( void ) pvParameters;
+        /* The parameter is the state of the timer service task being run. */
+        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        TimerServiceTask_t * const pxServiceTask = ( TimerServiceTask_t * ) pvParameters;
 
         #if ( configUSE_DAEMON_TASK_STARTUP_HOOK == 1 )
         {
             /* Allow the application writer to execute some code in the context of
              * this task at the point the task starts executing.  This is useful if the
              * application includes initialisation code that would benefit from
-             * executing after the scheduler has been started. */
-            vApplicationDaemonTaskStartupHook();
+             * executing after the scheduler has been started.  The hook is only
+             * called by the first timer service task. */
+            if( pxServiceTask == tmrDEFAULT_SERVICE_TASK )
+            {
+                vApplicationDaemonTaskStartupHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
         #endif /* configUSE_DAEMON_TASK_STARTUP_HOOK */
 
@@ -767,19 +1619,20 @@
         {
             /* Query the timers list to see if it contains any timers, and if so,
              * obtain the time at which the next timer will expire. */
-            xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
+            xNextExpireTime = prvGetNextExpireTime( pxServiceTask, &xListWasEmpty );
 
             /* If a timer has expired, process it.  Otherwise, block this task
              * until either a timer does expire, or a command is received. */
-            prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+            prvProcessTimerOrBlockTask( pxServiceTask, xNextExpireTime, xListWasEmpty );
 
             /* Empty the command queue. */
-            prvProcessReceivedCommands();
+            prvProcessReceivedCommands( pxServiceTask );
         }
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
+    static void prvProcessTimerOrBlockTask( TimerServiceTask_t * const pxServiceTask,
+                                            const TickType_t xNextExpireTime,
                                             BaseType_t xListWasEmpty )
     {
         TickType_t xTimeNow;
@@ -792,7 +1645,7 @@
              * then don't process this timer as any timers that remained in the list
              * when the lists were switched will have been processed within the
              * prvSampleTimeNow() function. */
-            xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+            xTimeNow = prvSampleTimeNow( pxServiceTask, &xTimerListsWereSwitched );
 
             if( xTimerListsWereSwitched == pdFALSE )
             {
@@ -800,7 +1653,35 @@
                 if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
                 {
                     ( void ) xTaskResumeAll();
-                    prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+
+                    #if ( configUSE_TIMER_SLACK == 1 )
+                    {
+                        const ListItem_t * pxFirstListItem;
+
+                        /* xNextExpireTime may be later than the expiry time of
+                         * the first timer, so process every timer that has
+                         * expired by now in one batch. */
+                        for( ; ; )
+                        {
+                            #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+                                pxFirstListItem = prvGetFirstActiveTimerListItem( pxServiceTask );
+                            #else
+                                pxFirstListItem = ( listLIST_IS_EMPTY( pxServiceTask->pxCurrentTimerList ) == pdFALSE ) ? listGET_HEAD_ENTRY( pxServiceTask->pxCurrentTimerList ) : NULL;
+                            #endif
+
+                            if( ( pxFirstListItem == NULL ) || ( listGET_LIST_ITEM_VALUE( pxFirstListItem ) > xTimeNow ) )
+                            {
+                                break;
+                            }
+
+                            prvProcessExpiredTimer( pxServiceTask, listGET_LIST_ITEM_VALUE( pxFirstListItem ), xTimeNow );
+                        }
+                    }
+                    #else /* if ( configUSE_TIMER_SLACK == 1 ) */
+                    {
+                        prvProcessExpiredTimer( pxServiceTask, xNextExpireTime, xTimeNow );
+                    }
+                    #endif /* if ( configUSE_TIMER_SLACK == 1 ) */
                 }
                 else
                 {
@@ -814,10 +1695,10 @@
                     {
                         /* The current timer list is empty - is the overflow list
                          * also empty? */
-                        xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        xListWasEmpty = listLIST_IS_EMPTY( pxServiceTask->pxOverflowTimerList );
                     }
 
-                    vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+                    vQueueWaitForMessageRestricted( pxServiceTask->xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
 
                     if( xTaskResumeAll() == pdFALSE )
                     {
@@ -841,7 +1722,8 @@
     }
 /*-----------------------------------------------------------*/
 
-    static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+    static TickType_t prvGetNextExpireTime( TimerServiceTask_t * const pxServiceTask,
+                                            BaseType_t * const pxListWasEmpty )
     {
         TickType_t xNextExpireTime;
 
@@ -852,32 +1734,232 @@
          * this task to unblock when the tick count overflows, at which point the
          * timer lists will be switched and the next expiry time can be
          * re-assessed.  */
-        *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-
-        if( *pxListWasEmpty == pdFALSE )
+        #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            const ListItem_t * const pxFirstListItem = prvGetFirstActiveTimerListItem( pxServiceTask );
+
+            *pxListWasEmpty = ( pxFirstListItem == NULL ) ? pdTRUE : pdFALSE;
+
+            if( *pxListWasEmpty == pdFALSE )
+            {
+                #if ( configUSE_TIMER_SLACK == 1 )
+                    xNextExpireTime = prvGetCoalescedExpireTime( pxServiceTask, pxFirstListItem );
+                #else
+                    xNextExpireTime = listGET_LIST_ITEM_VALUE( pxFirstListItem );
+                #endif
+            }
+            else
+            {
+                /* Ensure the task unblocks when the tick count rolls over. */
+                xNextExpireTime = ( TickType_t ) 0U;
+            }
         }
-        else
+        #else /* if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL ) */
         {
-            /* Ensure the task unblocks when the tick count rolls over. */
-            xNextExpireTime = ( TickType_t ) 0U;
+            *pxListWasEmpty = listLIST_IS_EMPTY( pxServiceTask->pxCurrentTimerList );
+
+            if( *pxListWasEmpty == pdFALSE )
+            {
+                #if ( configUSE_TIMER_SLACK == 1 )
+                    xNextExpireTime = prvGetCoalescedExpireTime( pxServiceTask, listGET_HEAD_ENTRY( pxServiceTask->pxCurrentTimerList ) );
+                #else
+                    xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxServiceTask->pxCurrentTimerList );
+                #endif
+            }
+            else
+            {
+                /* Ensure the task unblocks when the tick count rolls over. */
+                xNextExpireTime = ( TickType_t ) 0U;
+            }
         }
+        #endif /* if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL ) */
 
         return xNextExpireTime;
     }
 /*-----------------------------------------------------------*/
 
-    static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+    #if ( configUSE_TIMER_SLACK == 1 )
+
+        static TickType_t prvGetCoalescedExpireTime( TimerServiceTask_t * const pxServiceTask,
+                                                     const ListItem_t * const pxFirstListItem )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            const Timer_t * const pxFirstTimer = ( const Timer_t * ) listGET_LIST_ITEM_OWNER( pxFirstListItem );
+            const TickType_t xFirstExpireTime = listGET_LIST_ITEM_VALUE( pxFirstListItem );
+            TickType_t xCoalescedTime = xFirstExpireTime + pxFirstTimer->xTimerSlackInTicks;
+
+            if( xCoalescedTime < xFirstExpireTime )
+            {
+                /* The slack goes past the tick count overflow, at which point
+                 * all the timers in the current list are processed anyway. */
+                xCoalescedTime = tmrMAX_TIME_BEFORE_OVERFLOW;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xCoalescedTime = prvCoalesceTimerList( pxServiceTask->pxCurrentTimerList, xCoalescedTime );
+
+            #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+            {
+                TickType_t xOffset;
+
+                for( xOffset = ( TickType_t ) 0U; xOffset < tmrWHEEL_SLOTS; xOffset++ )
+                {
+                    xCoalescedTime = prvCoalesceTimerList( &( pxServiceTask->xTimerWheelLists[ tmrWHEEL_INDEX( pxServiceTask->xTimerWheelTime + xOffset ) ] ), xCoalescedTime );
+                }
+            }
+            #endif
+
+            return xCoalescedTime;
+        }
+/*-----------------------------------------------------------*/
+
+        static TickType_t prvCoalesceTimerList( const List_t * const pxList,
+                                                TickType_t xCoalescedTime )
+        {
+            const ListItem_t * pxIterator;
+            const ListItem_t * const pxEndMarker = listGET_END_MARKER( pxList );
+            const Timer_t * pxTimer;
+            TickType_t xExpireTime;
+            TickType_t xSlackLimit;
+
+            for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+            {
+                xExpireTime = listGET_LIST_ITEM_VALUE( pxIterator );
+
+                if( xExpireTime > xCoalescedTime )
+                {
+                    break;
+                }
+
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxTimer = ( const Timer_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+                xSlackLimit = xExpireTime + pxTimer->xTimerSlackInTicks;
+
+                if( ( xSlackLimit >= xExpireTime ) && ( xSlackLimit < xCoalescedTime ) )
+                {
+                    xCoalescedTime = xSlackLimit;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            return xCoalescedTime;
+        }
+
+    #endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+    #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+
+        static void prvInsertTimerInWheel( TimerServiceTask_t * const pxServiceTask,
+                                           Timer_t * const pxTimer )
+        {
+            const TickType_t xNextExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+            List_t * const pxList = &( pxServiceTask->xTimerWheelLists[ tmrWHEEL_INDEX( xNextExpiryTime ) ] );
+
+            if( xNextExpiryTime < pxServiceTask->xTimerWheelTime )
+            {
+                pxServiceTask->xTimerWheelTime = xNextExpiryTime;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Timers that are started together with the same period share an
+             * expiry time, so avoid walking the list when the new timer goes
+             * at its end. */
+            if( ( listLIST_IS_EMPTY( pxList ) != pdFALSE ) || ( xNextExpiryTime >= pxList->xListEnd.pxPrevious->xItemValue ) )
+            {
+                listINSERT_END( pxList, &( pxTimer->xTimerListItem ) );
+            }
+            else
+            {
+                vListInsert( pxList, &( pxTimer->xTimerListItem ) );
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        static ListItem_t * prvGetFirstActiveTimerListItem( TimerServiceTask_t * const pxServiceTask )
+        {
+            ListItem_t * pxReturn = NULL;
+            const List_t * pxList;
+            TickType_t xOffset;
+            TickType_t xTicks;
+            TickType_t xTicksToExpire = ( TickType_t ) 0U;
+
+            /* A timer in the list xOffset slots after xTimerWheelTime expires at
+             * least xOffset ticks after xTimerWheelTime, so the search can stop
+             * once xOffset reaches the earliest expiry found so far. */
+            for( xOffset = ( TickType_t ) 0U; xOffset < tmrWHEEL_SLOTS; xOffset++ )
+            {
+                if( ( pxReturn != NULL ) && ( xOffset >= xTicksToExpire ) )
+                {
+                    break;
+                }
+
+                pxList = &( pxServiceTask->xTimerWheelLists[ tmrWHEEL_INDEX( pxServiceTask->xTimerWheelTime + xOffset ) ] );
+
+                if( listLIST_IS_EMPTY( pxList ) == pdFALSE )
+                {
+                    xTicks = ( TickType_t ) ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxList ) - pxServiceTask->xTimerWheelTime );
+
+                    if( ( pxReturn == NULL ) || ( xTicks < xTicksToExpire ) )
+                    {
+                        pxReturn = listGET_HEAD_ENTRY( pxList );
+                        xTicksToExpire = xTicks;
+                    }
+                }
+            }
+
+            if( pxReturn != NULL )
+            {
+                /* Nothing in the wheel expires before the timer found, so start
+                 * the next search from its expiry time. */
+                pxServiceTask->xTimerWheelTime = listGET_LIST_ITEM_VALUE( pxReturn );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Timers whose expiry time overflowed before the timer lists were
+             * last switched are still held in pxCurrentTimerList. */
+            if( ( listLIST_IS_EMPTY( pxServiceTask->pxCurrentTimerList ) == pdFALSE ) &&
+                ( ( pxReturn == NULL ) || ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxServiceTask->pxCurrentTimerList ) <= listGET_LIST_ITEM_VALUE( pxReturn ) ) ) )
+            {
+                pxReturn = listGET_HEAD_ENTRY( pxServiceTask->pxCurrentTimerList );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            return pxReturn;
+        }
+
+    #endif /* configTIMER_LIST_IMPLEMENTATION */
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvSampleTimeNow( TimerServiceTask_t * const pxServiceTask,
+                                        BaseType_t * const pxTimerListsWereSwitched )
     {
         TickType_t xTimeNow;
-        PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U;
 
         xTimeNow = xTaskGetTickCount();
 
-        if( xTimeNow < xLastTime )
+        if( xTimeNow < pxServiceTask->xLastTime )
         {
-            prvSwitchTimerLists();
+            prvSwitchTimerLists( pxServiceTask );
             *pxTimerListsWereSwitched = pdTRUE;
         }
         else
@@ -885,16 +1967,18 @@
             *pxTimerListsWereSwitched = pdFALSE;
         }
 
-        xLastTime = xTimeNow;
+        pxServiceTask->xLastTime = xTimeNow;
 
         return xTimeNow;
     }
 /*-----------------------------------------------------------*/
 
-    static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer,
+    static BaseType_t prvInsertTimerInActiveList( TimerServiceTask_t * const pxServiceTask,
+                                                  Timer_t * const pxTimer,
                                                   const TickType_t xNextExpiryTime,
                                                   const TickType_t xTimeNow,
-                                                  const TickType_t xCommandTime )
+                                                  const TickType_t xCommandTime,
+                                                  List_t * const pxMergeList )
     {
         BaseType_t xProcessTimerNow = pdFALSE;
 
@@ -903,46 +1987,191 @@
 
         if( xNextExpiryTime <= xTimeNow )
         {
-            /* Has the expiry time elapsed between the command to start/reset a
-             * timer was issued, and the time the command was processed? */
-            if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks )
+            /* Has the expiry time elapsed between the command to start/reset a
+             * timer was issued, and the time the command was processed? */
+            if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks )
+            {
+                /* The time between a command being issued and the command being
+                 * processed actually exceeds the timers period.  */
+                xProcessTimerNow = pdTRUE;
+            }
+            else
+            {
+                vListInsert( pxServiceTask->pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+            }
+        }
+        else
+        {
+            if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+            {
+                /* If, since the command was issued, the tick count has overflowed
+                 * but the expiry time has not, then the timer must have already passed
+                 * its expiry time and should be processed immediately. */
+                xProcessTimerNow = pdTRUE;
+            }
+            else
+            {
+                #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+                {
+                    /* Inserting in the wheel only searches one slot, so there
+                     * is nothing to gain from merging. */
+                    ( void ) pxMergeList;
+                    prvInsertTimerInWheel( pxServiceTask, pxTimer );
+                }
+                #else
+                {
+                    if( pxMergeList != NULL )
+                    {
+                        vListInsert( pxMergeList, &( pxTimer->xTimerListItem ) );
+                    }
+                    else
+                    {
+                        vListInsert( pxServiceTask->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                    }
+                }
+                #endif
+            }
+        }
+
+        return xProcessTimerNow;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvStartTimer( TimerServiceTask_t * const pxServiceTask,
+                               Timer_t * const pxTimer,
+                               const TickType_t xCommandTime,
+                               const TickType_t xTimeNow,
+                               List_t * const pxMergeList )
+    {
+        pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+
+        if( prvInsertTimerInActiveList( pxServiceTask, pxTimer, xCommandTime + pxTimer->xTimerPeriodInTicks, xTimeNow, xCommandTime, pxMergeList ) != pdFALSE )
+        {
+            /* The timer expired before it was added to the active
+             * timer list.  Process it now. */
+            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
             {
-                /* The time between a command being issued and the command being
-                 * processed actually exceeds the timers period.  */
-                xProcessTimerNow = pdTRUE;
+                prvReloadTimer( pxServiceTask, pxTimer, xCommandTime + pxTimer->xTimerPeriodInTicks, xTimeNow );
             }
             else
             {
-                vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
             }
+
+            /* Call the timer callback. */
+            traceTIMER_EXPIRED( pxTimer );
+            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
         }
         else
         {
-            if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
-            {
-                /* If, since the command was issued, the tick count has overflowed
-                 * but the expiry time has not, then the timer must have already passed
-                 * its expiry time and should be processed immediately. */
-                xProcessTimerNow = pdTRUE;
-            }
-            else
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TIMER_GROUPS == 1 )
+
+        static void prvProcessGroupCommand( TimerServiceTask_t * const pxServiceTask,
+                                            const DaemonTaskMessage_t * const pxMessage )
+        {
+            const TimerGroup_t * const pxGroup = pxMessage->u.xGroupParameters.pxGroup;
+            const TickType_t xMessageValue = pxMessage->u.xGroupParameters.xMessageValue;
+            List_t xMergeList;
+            Timer_t * pxTimer;
+            UBaseType_t uxTimer;
+            BaseType_t xTimerListsWereSwitched;
+            TickType_t xTimeNow;
+
+            configASSERT( pxGroup );
+
+            /* The timers to be inserted in the current timer list are first
+             * sorted into xMergeList, which only holds the group's timers, so
+             * the much longer current timer list is walked once for the whole
+             * group rather than once for each timer. */
+            vListInitialise( &xMergeList );
+
+            /* As in prvProcessReceivedCommands(), the time is sampled after the
+             * message has been received. */
+            xTimeNow = prvSampleTimeNow( pxServiceTask, &xTimerListsWereSwitched );
+
+            for( uxTimer = ( UBaseType_t ) 0U; uxTimer < pxGroup->uxTimerCount; uxTimer++ )
             {
-                vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                pxTimer = pxGroup->pxTimers[ uxTimer ];
+
+                configASSERT( pxTimer );
+                configASSERT( tmrGET_SERVICE_TASK( pxTimer ) == pxServiceTask );
+
+                #if ( configUSE_HARD_TIMERS == 1 )
+                {
+                    configASSERT( ( pxTimer->ucStatus & tmrSTATUS_IS_HARD ) == 0U );
+                }
+                #endif
+
+                if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+                {
+                    /* The timer is in a list, remove it. */
+                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+                {
+                    /* A command replaces any direct reset that has not been
+                     * applied yet. */
+                    tmrENTER_CRITICAL();
+                    {
+                        pxTimer->ucDirectResetPending = ( uint8_t ) pdFALSE;
+                    }
+                    tmrEXIT_CRITICAL();
+                }
+                #endif
+
+                traceTIMER_COMMAND_RECEIVED( pxTimer, pxMessage->xMessageID, xMessageValue );
+
+                switch( pxMessage->xMessageID )
+                {
+                    case tmrCOMMAND_GROUP_START:
+                        prvStartTimer( pxServiceTask, pxTimer, xMessageValue, xTimeNow, &xMergeList );
+                        break;
+
+                    case tmrCOMMAND_GROUP_STOP:
+                        /* The timer has already been removed from the active list. */
+                        pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                        break;
+
+                    case tmrCOMMAND_GROUP_CHANGE_PERIOD:
+                        pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+                        pxTimer->xTimerPeriodInTicks = xMessageValue;
+                        configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+                        /* As for tmrCOMMAND_CHANGE_PERIOD, the next expiry time
+                         * can only be in the future. */
+                        ( void ) prvInsertTimerInActiveList( pxServiceTask, pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow, &xMergeList );
+                        break;
+
+                    default:
+                        /* Don't expect to get here. */
+                        break;
+                }
             }
+
+            vListMerge( pxServiceTask->pxCurrentTimerList, &xMergeList );
         }
 
-        return xProcessTimerNow;
-    }
+    #endif /* configUSE_TIMER_GROUPS */
 /*-----------------------------------------------------------*/
 
-    static void prvProcessReceivedCommands( void )
+    static void prvProcessReceivedCommands( TimerServiceTask_t * const pxServiceTask )
     {
         DaemonTaskMessage_t xMessage = { 0 };
         Timer_t * pxTimer;
         BaseType_t xTimerListsWereSwitched;
         TickType_t xTimeNow;
 
-        while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL )
+        while( xQueueReceive( pxServiceTask->xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL )
         {
             #if ( INCLUDE_xTimerPendFunctionCall == 1 )
             {
@@ -966,9 +2195,23 @@
             }
             #endif /* INCLUDE_xTimerPendFunctionCall */
 
+            #if ( configUSE_TIMER_GROUPS == 1 )
+            {
+                /* Group commands act on every timer in a group. */
+                if( xMessage.xMessageID >= tmrFIRST_GROUP_COMMAND )
+                {
+                    prvProcessGroupCommand( pxServiceTask, &xMessage );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_TIMER_GROUPS */
+
             /* Commands that are positive are timer commands rather than pended
              * function calls. */
-            if( xMessage.xMessageID >= ( BaseType_t ) 0 )
+            if( ( xMessage.xMessageID >= ( BaseType_t ) 0 ) && ( xMessage.xMessageID < tmrFIRST_GROUP_COMMAND ) )
             {
                 /* The messages uses the xTimerParameters member to work on a
                  * software timer. */
@@ -984,6 +2227,18 @@
                     mtCOVERAGE_TEST_MARKER();
                 }
 
+                #if ( configUSE_TIMER_DIRECT_RESET == 1 )
+                {
+                    /* A command replaces any direct reset that has not been
+                     * applied yet. */
+                    tmrENTER_CRITICAL();
+                    {
+                        pxTimer->ucDirectResetPending = ( uint8_t ) pdFALSE;
+                    }
+                    tmrEXIT_CRITICAL();
+                }
+                #endif
+
                 traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
 
                 /* In this case the xTimerListsWereSwitched parameter is not used, but
@@ -992,7 +2247,7 @@
                  *  possibility of a higher priority task adding a message to the message
                  *  queue with a time that is ahead of the timer daemon task (because it
                  *  pre-empted the timer daemon task after the xTimeNow value was set). */
-                xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+                xTimeNow = prvSampleTimeNow( pxServiceTask, &xTimerListsWereSwitched );
 
                 switch( xMessage.xMessageID )
                 {
@@ -1001,30 +2256,7 @@
                     case tmrCOMMAND_RESET:
                     case tmrCOMMAND_RESET_FROM_ISR:
                         /* Start or restart a timer. */
-                        pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
-
-                        if( prvInsertTimerInActiveList( pxTimer, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
-                        {
-                            /* The timer expired before it was added to the active
-                             * timer list.  Process it now. */
-                            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
-                            {
-                                prvReloadTimer( pxTimer, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow );
-                            }
-                            else
-                            {
-                                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                            }
-
-                            /* Call the timer callback. */
-                            traceTIMER_EXPIRED( pxTimer );
-                            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-                        }
-                        else
-                        {
-                            mtCOVERAGE_TEST_MARKER();
-                        }
-
+                        prvStartTimer( pxServiceTask, pxTimer, xMessage.u.xTimerParameters.xMessageValue, xTimeNow, NULL );
                         break;
 
                     case tmrCOMMAND_STOP:
@@ -1045,7 +2277,7 @@
                          * be zero the next expiry time can only be in the future,
                          * meaning (unlike for the xTimerStart() case above) there is
                          * no fail case that needs to be handled here. */
-                        ( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+                        ( void ) prvInsertTimerInActiveList( pxServiceTask, pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow, NULL );
                         break;
 
                     case tmrCOMMAND_DELETE:
@@ -1056,7 +2288,7 @@
                              * allocated. */
                             if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
                             {
-                                vPortFree( pxTimer );
+                                tmrFREE_TIMER( pxTimer );
                             }
                             else
                             {
@@ -1083,7 +2315,7 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvSwitchTimerLists( void )
+    static void prvSwitchTimerLists( TimerServiceTask_t * const pxServiceTask )
     {
         TickType_t xNextExpireTime;
         List_t * pxTemp;
@@ -1092,63 +2324,119 @@
          * If there are any timers still referenced from the current timer list
          * then they must have expired and should be processed before the lists
          * are switched. */
-        while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+        #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+            while( prvGetFirstActiveTimerListItem( pxServiceTask ) != NULL )
+        #else
+            while( listLIST_IS_EMPTY( pxServiceTask->pxCurrentTimerList ) == pdFALSE )
+        #endif
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+                xNextExpireTime = listGET_LIST_ITEM_VALUE( prvGetFirstActiveTimerListItem( pxServiceTask ) );
+            #else
+                xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxServiceTask->pxCurrentTimerList );
+            #endif
 
             /* Process the expired timer.  For auto-reload timers, be careful to
              * process only expirations that occur on the current list.  Further
              * expirations must wait until after the lists are switched. */
-            prvProcessExpiredTimer( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
+            prvProcessExpiredTimer( pxServiceTask, xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
         }
 
-        pxTemp = pxCurrentTimerList;
-        pxCurrentTimerList = pxOverflowTimerList;
-        pxOverflowTimerList = pxTemp;
+        pxTemp = pxServiceTask->pxCurrentTimerList;
+        pxServiceTask->pxCurrentTimerList = pxServiceTask->pxOverflowTimerList;
+        pxServiceTask->pxOverflowTimerList = pxTemp;
     }
 /*-----------------------------------------------------------*/
 
     static void prvCheckForValidListAndQueue( void )
     {
+        UBaseType_t uxServiceTask;
+        TimerServiceTask_t * pxServiceTask;
+
         /* Check that the list from which active timers are referenced, and the
          * queue used to communicate with the timer service, have been
          * initialised. */
         taskENTER_CRITICAL();
         {
-            if( xTimerQueue == NULL )
+            if( tmrDEFAULT_SERVICE_TASK->xTimerQueue == NULL )
             {
-                vListInitialise( &xActiveTimerList1 );
-                vListInitialise( &xActiveTimerList2 );
-                pxCurrentTimerList = &xActiveTimerList1;
-                pxOverflowTimerList = &xActiveTimerList2;
-
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
-                {
-                    /* The timer queue is allocated statically in case
+                    /* The timer queues are allocated statically in case
                      * configSUPPORT_DYNAMIC_ALLOCATION is 0. */
-                    PRIVILEGED_DATA static StaticQueue_t xStaticTimerQueue;
-                    PRIVILEGED_DATA static uint8_t ucStaticTimerQueueStorage[ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+                    PRIVILEGED_DATA static StaticQueue_t xStaticTimerQueues[ configTIMER_SERVICE_TASKS ];
+                    PRIVILEGED_DATA static uint8_t ucStaticTimerQueueStorage[ configTIMER_SERVICE_TASKS ][ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+                #endif
 
-                    xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ 0 ] ), &xStaticTimerQueue );
-                }
-                #else
+                for( uxServiceTask = ( UBaseType_t ) 0U; uxServiceTask < ( UBaseType_t ) configTIMER_SERVICE_TASKS; uxServiceTask++ )
                 {
-                    xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ) );
-                }
-                #endif /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+                    pxServiceTask = &( xTimerServiceTasks[ uxServiceTask ] );
 
-                #if ( configQUEUE_REGISTRY_SIZE > 0 )
-                {
-                    if( xTimerQueue != NULL )
+                    #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_SKIP_LIST )
                     {
-                        vQueueAddToRegistry( xTimerQueue, "TmrQ" );
+                        vListInitialiseSkipList( &( pxServiceTask->xActiveTimerList1 ) );
+                        vListInitialiseSkipList( &( pxServiceTask->xActiveTimerList2 ) );
                     }
-                    else
+                    #else
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        vListInitialise( &( pxServiceTask->xActiveTimerList1 ) );
+                        vListInitialise( &( pxServiceTask->xActiveTimerList2 ) );
+                    }
+                    #endif
+                    pxServiceTask->pxCurrentTimerList = &( pxServiceTask->xActiveTimerList1 );
+                    pxServiceTask->pxOverflowTimerList = &( pxServiceTask->xActiveTimerList2 );
+
+                    #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+                    {
+                        UBaseType_t uxList;
+
+                        for( uxList = ( UBaseType_t ) 0U; uxList < ( UBaseType_t ) configTIMER_WHEEL_SLOTS; uxList++ )
+                        {
+                            vListInitialise( &( pxServiceTask->xTimerWheelLists[ uxList ] ) );
+                        }
+                    }
+                    #endif
+
+                    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                    {
+                        pxServiceTask->xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ uxServiceTask ][ 0 ] ), &( xStaticTimerQueues[ uxServiceTask ] ) );
+                    }
+                    #else
+                    {
+                        pxServiceTask->xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ) );
+                    }
+                    #endif /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+
+                    #if ( configQUEUE_REGISTRY_SIZE > 0 )
+                    {
+                        if( pxServiceTask->xTimerQueue != NULL )
+                        {
+                            vQueueAddToRegistry( pxServiceTask->xTimerQueue, "TmrQ" );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
+                    #endif /* configQUEUE_REGISTRY_SIZE */
+                }
+
+                #if ( configUSE_HARD_TIMERS == 1 )
+                {
+                    vListInitialise( &xHardTimerList1 );
+                    vListInitialise( &xHardTimerList2 );
+                    pxOverflowHardTimerList = &xHardTimerList2;
+
+                    /* Set last, as the tick interrupt uses it to tell whether
+                     * the lists have been initialised. */
+                    pxCurrentHardTimerList = &xHardTimerList1;
+                }
+                #endif
+
+                #if ( configUSE_GRANULAR_LOCKS == 1 )
+                {
+                    portINIT_SPINLOCK( &xTimerLock );
                 }
-                #endif /* configQUEUE_REGISTRY_SIZE */
+                #endif
             }
             else
             {
@@ -1197,11 +2485,11 @@
 
         configASSERT( xTimer );
 
-        taskENTER_CRITICAL();
+        tmrENTER_CRITICAL();
         {
             pvReturn = pxTimer->pvTimerID;
         }
-        taskEXIT_CRITICAL();
+        tmrEXIT_CRITICAL();
 
         traceRETURN_pvTimerGetTimerID( pvReturn );
 
@@ -1218,62 +2506,93 @@
 
         configASSERT( xTimer );
 
-        taskENTER_CRITICAL();
+        tmrENTER_CRITICAL();
         {
             pxTimer->pvTimerID = pvNewID;
         }
-        taskEXIT_CRITICAL();
+        tmrEXIT_CRITICAL();
 
         traceRETURN_vTimerSetTimerID();
     }
 /*-----------------------------------------------------------*/
 
-    #if ( INCLUDE_xTimerPendFunctionCall == 1 )
+    #if ( configUSE_TIMER_SLACK == 1 )
 
-        BaseType_t xTimerPendFunctionCallFromISR( PendedFunction_t xFunctionToPend,
-                                                  void * pvParameter1,
-                                                  uint32_t ulParameter2,
-                                                  BaseType_t * pxHigherPriorityTaskWoken )
+        void vTimerSetSlack( TimerHandle_t xTimer,
+                             TickType_t xSlackInTicks )
         {
-            DaemonTaskMessage_t xMessage;
-            BaseType_t xReturn;
+            Timer_t * const pxTimer = xTimer;
 
-            traceENTER_xTimerPendFunctionCallFromISR( xFunctionToPend, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken );
+            traceENTER_vTimerSetSlack( xTimer, xSlackInTicks );
 
-            /* Complete the message with the function parameters and post it to the
-             * daemon task. */
-            xMessage.xMessageID = tmrCOMMAND_EXECUTE_CALLBACK_FROM_ISR;
-            xMessage.u.xCallbackParameters.pxCallbackFunction = xFunctionToPend;
-            xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
-            xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
+            configASSERT( xTimer );
+
+            tmrENTER_CRITICAL();
+            {
+                pxTimer->xTimerSlackInTicks = xSlackInTicks;
+            }
+            tmrEXIT_CRITICAL();
 
-            xReturn = xQueueSendFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+            traceRETURN_vTimerSetSlack();
+        }
+/*-----------------------------------------------------------*/
 
-            tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
-            traceRETURN_xTimerPendFunctionCallFromISR( xReturn );
+        TickType_t xTimerGetSlack( TimerHandle_t xTimer )
+        {
+            Timer_t * const pxTimer = xTimer;
+            TickType_t xReturn;
+
+            traceENTER_xTimerGetSlack( xTimer );
+
+            configASSERT( xTimer );
+
+            tmrENTER_CRITICAL();
+            {
+                xReturn = pxTimer->xTimerSlackInTicks;
+            }
+            tmrEXIT_CRITICAL();
+
+            traceRETURN_xTimerGetSlack( xReturn );
 
             return xReturn;
         }
 
-    #endif /* INCLUDE_xTimerPendFunctionCall */
+    #endif /* configUSE_TIMER_SLACK */
 /*-----------------------------------------------------------*/
 
     #if ( INCLUDE_xTimerPendFunctionCall == 1 )
 
-        BaseType_t xTimerPendFunctionCall( PendedFunction_t xFunctionToPend,
-                                           void * pvParameter1,
-                                           uint32_t ulParameter2,
-                                           TickType_t xTicksToWait )
+        static BaseType_t prvPendFunctionCallFromISR( TimerServiceTask_t * const pxServiceTask,
+                                                      PendedFunction_t xFunctionToPend,
+                                                      void * pvParameter1,
+                                                      uint32_t ulParameter2,
+                                                      BaseType_t * pxHigherPriorityTaskWoken )
         {
             DaemonTaskMessage_t xMessage;
-            BaseType_t xReturn;
 
-            traceENTER_xTimerPendFunctionCall( xFunctionToPend, pvParameter1, ulParameter2, xTicksToWait );
+            /* Complete the message with the function parameters and post it to the
+             * daemon task. */
+            xMessage.xMessageID = tmrCOMMAND_EXECUTE_CALLBACK_FROM_ISR;
+            xMessage.u.xCallbackParameters.pxCallbackFunction = xFunctionToPend;
+            xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
+            xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
+
+            return xQueueSendFromISR( pxServiceTask->xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+        }
+/*-----------------------------------------------------------*/
+
+        static BaseType_t prvPendFunctionCall( TimerServiceTask_t * const pxServiceTask,
+                                               PendedFunction_t xFunctionToPend,
+                                               void * pvParameter1,
+                                               uint32_t ulParameter2,
+                                               TickType_t xTicksToWait )
+        {
+            DaemonTaskMessage_t xMessage;
 
             /* This function can only be called after a timer has been created or
              * after the scheduler has been started because, until then, the timer
              * queue does not exist. */
-            configASSERT( xTimerQueue );
+            configASSERT( pxServiceTask->xTimerQueue );
 
             /* Complete the message with the function parameters and post it to the
              * daemon task. */
@@ -1282,13 +2601,90 @@
             xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
             xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-            xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+            return xQueueSendToBack( pxServiceTask->xTimerQueue, &xMessage, xTicksToWait );
+        }
+/*-----------------------------------------------------------*/
+
+        BaseType_t xTimerPendFunctionCallFromISR( PendedFunction_t xFunctionToPend,
+                                                  void * pvParameter1,
+                                                  uint32_t ulParameter2,
+                                                  BaseType_t * pxHigherPriorityTaskWoken )
+        {
+            BaseType_t xReturn;
+
+            traceENTER_xTimerPendFunctionCallFromISR( xFunctionToPend, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken );
+
+            xReturn = prvPendFunctionCallFromISR( tmrDEFAULT_SERVICE_TASK, xFunctionToPend, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken );
+
+            tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
+            traceRETURN_xTimerPendFunctionCallFromISR( xReturn );
+
+            return xReturn;
+        }
+/*-----------------------------------------------------------*/
+
+        BaseType_t xTimerPendFunctionCall( PendedFunction_t xFunctionToPend,
+                                           void * pvParameter1,
+                                           uint32_t ulParameter2,
+                                           TickType_t xTicksToWait )
+        {
+            BaseType_t xReturn;
+
+            traceENTER_xTimerPendFunctionCall( xFunctionToPend, pvParameter1, ulParameter2, xTicksToWait );
+
+            xReturn = prvPendFunctionCall( tmrDEFAULT_SERVICE_TASK, xFunctionToPend, pvParameter1, ulParameter2, xTicksToWait );
 
             tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
             traceRETURN_xTimerPendFunctionCall( xReturn );
 
             return xReturn;
         }
+/*-----------------------------------------------------------*/
+
+        #if ( configTIMER_SERVICE_TASKS > 1 )
+
+            BaseType_t xTimerPendFunctionCallToServiceTaskFromISR( UBaseType_t uxServiceTask,
+                                                                   PendedFunction_t xFunctionToPend,
+                                                                   void * pvParameter1,
+                                                                   uint32_t ulParameter2,
+                                                                   BaseType_t * pxHigherPriorityTaskWoken )
+            {
+                BaseType_t xReturn;
+
+                traceENTER_xTimerPendFunctionCallToServiceTaskFromISR( uxServiceTask, xFunctionToPend, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken );
+
+                configASSERT( uxServiceTask < ( UBaseType_t ) configTIMER_SERVICE_TASKS );
+
+                xReturn = prvPendFunctionCallFromISR( &( xTimerServiceTasks[ uxServiceTask ] ), xFunctionToPend, pvParameter1, ulParameter2, pxHigherPriorityTaskWoken );
+
+                tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
+                traceRETURN_xTimerPendFunctionCallToServiceTaskFromISR( xReturn );
+
+                return xReturn;
+            }
+/*-----------------------------------------------------------*/
+
+            BaseType_t xTimerPendFunctionCallToServiceTask( UBaseType_t uxServiceTask,
+                                                            PendedFunction_t xFunctionToPend,
+                                                            void * pvParameter1,
+                                                            uint32_t ulParameter2,
+                                                            TickType_t xTicksToWait )
+            {
+                BaseType_t xReturn;
+
+                traceENTER_xTimerPendFunctionCallToServiceTask( uxServiceTask, xFunctionToPend, pvParameter1, ulParameter2, xTicksToWait );
+
+                configASSERT( uxServiceTask < ( UBaseType_t ) configTIMER_SERVICE_TASKS );
+
+                xReturn = prvPendFunctionCall( &( xTimerServiceTasks[ uxServiceTask ] ), xFunctionToPend, pvParameter1, ulParameter2, xTicksToWait );
+
+                tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
+                traceRETURN_xTimerPendFunctionCallToServiceTask( xReturn );
+
+                return xReturn;
+            }
+
+        #endif /* configTIMER_SERVICE_TASKS */
 
     #endif /* INCLUDE_xTimerPendFunctionCall */
 /*-----------------------------------------------------------*/
@@ -1329,11 +2725,61 @@
  */
     void vTimerResetState( void )
     {
-        xTimerQueue = NULL;
-        xTimerTaskHandle = NULL;
+        UBaseType_t uxServiceTask;
+
+        for( uxServiceTask = ( UBaseType_t ) 0U; uxServiceTask < ( UBaseType_t ) configTIMER_SERVICE_TASKS; uxServiceTask++ )
+        {
+            xTimerServiceTasks[ uxServiceTask ].xTimerQueue = NULL;
+            xTimerServiceTasks[ uxServiceTask ].xTimerTaskHandle = NULL;
+            xTimerServiceTasks[ uxServiceTask ].xLastTime = ( TickType_t ) 0U;
+
+            #if ( configTIMER_LIST_IMPLEMENTATION == TIMER_LIST_TIMING_WHEEL )
+            {
+                xTimerServiceTasks[ uxServiceTask ].xTimerWheelTime = ( TickType_t ) 0U;
+            }
+            #endif
+        }
+
+        #if ( configKERNEL_OBJECT_POOLS == 1 )
+        {
+            xTimerPool = NULL;
+        }
+        #endif
+
+        #if ( configUSE_HARD_TIMERS == 1 )
+        {
+            pxCurrentHardTimerList = NULL;
+            pxOverflowHardTimerList = NULL;
+        }
+        #endif
     }
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_WARM_BOOT == 1 )
+
+        size_t xTimerCopyWarmBootState( uint8_t * pucState,
+                                        size_t xOffset,
+                                        BaseType_t xSave )
+        {
+            /* The timer service tasks resume blocked on their queues, with
+             * the timers they are processing held in their lists. */
+            xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) xTimerServiceTasks, sizeof( xTimerServiceTasks ), xSave );
+
+            #if ( configUSE_HARD_TIMERS == 1 )
+            {
+                xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) &xHardTimerList1, sizeof( xHardTimerList1 ), xSave );
+                xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) &xHardTimerList2, sizeof( xHardTimerList2 ), xSave );
+                xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) &pxCurrentHardTimerList, sizeof( pxCurrentHardTimerList ), xSave );
+                xOffset = xTaskWarmBootCopy( pucState, xOffset, ( void * ) &pxOverflowHardTimerList, sizeof( pxOverflowHardTimerList ), xSave );
+            }
+            #endif
+
+            return xOffset;
+        }
+
+    #endif /* configUSE_WARM_BOOT */
+/*-----------------------------------------------------------*/
+
 /* This entire source file will be skipped if the application is not configured
  * to include software timer functionality.  If you want to include software timer
  * functionality then ensure configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
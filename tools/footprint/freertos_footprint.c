@@ -0,0 +1,60 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Built by the freertos_kernel_footprint target.  Each array below is the size
+ * of a kernel object for the FreeRTOSConfig.h in use, so the sizes can be read
+ * back from the symbol table of the object file without running any code on
+ * the target.  The Static*_t structures are guaranteed to match the size of
+ * the structures used internally by the kernel.
+ */
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+#include "object_pool.h"
+#include "light_mutex.h"
+#include "rw_lock.h"
+
+const uint8_t ucFootprintTask[ sizeof( StaticTask_t ) ] = { 0U };
+const uint8_t ucFootprintQueue[ sizeof( StaticQueue_t ) ] = { 0U };
+const uint8_t ucFootprintEventGroup[ sizeof( StaticEventGroup_t ) ] = { 0U };
+const uint8_t ucFootprintTimer[ sizeof( StaticTimer_t ) ] = { 0U };
+const uint8_t ucFootprintStreamBuffer[ sizeof( StaticStreamBuffer_t ) ] = { 0U };
+const uint8_t ucFootprintPool[ sizeof( StaticPool_t ) ] = { 0U };
+const uint8_t ucFootprintLightMutex[ sizeof( LightMutex_t ) ] = { 0U };
+const uint8_t ucFootprintRWLock[ sizeof( RWLock_t ) ] = { 0U };
+const uint8_t ucFootprintListItem[ sizeof( ListItem_t ) ] = { 0U };
+
+/* The least RAM each task needs: its TCB and a stack of configMINIMAL_STACK_SIZE
+ * words. */
+const uint8_t ucFootprintTaskOverhead[ sizeof( StaticTask_t ) + ( ( size_t ) configMINIMAL_STACK_SIZE * sizeof( StackType_t ) ) ] = { 0U };
@@ -0,0 +1,88 @@
+# FreeRTOS internal cmake file. Do not use it in user top-level project
+#
+# Run in script mode by the freertos_kernel_footprint target to report the RAM
+# used by the kernel for the FreeRTOSConfig.h in use.  Expects:
+#   FREERTOS_NM                - the nm of the toolchain used to build the kernel.
+#   FREERTOS_FOOTPRINT_OBJECT  - the object built from freertos_footprint.c.
+#   FREERTOS_KERNEL_LIBRARY    - the freertos_kernel archive.
+#   FREERTOS_FOOTPRINT_REPORT  - the file the report is written to.
+
+function(freertos_footprint_line label value)
+    string(LENGTH "${label}" label_length)
+    math(EXPR padding "52 - ${label_length}")
+    if(padding LESS 1)
+        set(padding 1)
+    endif()
+    string(REPEAT " " ${padding} spaces)
+    set(report "${report}  ${label}${spaces}${value}\n" PARENT_SCOPE)
+endfunction()
+
+function(freertos_footprint_nm file output)
+    execute_process(
+        COMMAND ${FREERTOS_NM} -S --defined-only ${file}
+        OUTPUT_VARIABLE nm_output
+        RESULT_VARIABLE nm_result
+        ERROR_QUIET
+    )
+    if(NOT nm_result EQUAL 0)
+        message(FATAL_ERROR " ${FREERTOS_NM} could not read the symbols of ${file}.")
+    endif()
+    string(REPLACE "\n" ";" nm_output "${nm_output}")
+    set(${output} "${nm_output}" PARENT_SCOPE)
+endfunction()
+
+# The size of each kernel object is the size of the matching ucFootprint array.
+freertos_footprint_nm(${FREERTOS_FOOTPRINT_OBJECT} size_lines)
+
+foreach(line IN LISTS size_lines)
+    if(line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [A-Za-z] _?ucFootprint([A-Za-z]+)$")
+        math(EXPR size_${CMAKE_MATCH_2} "0x${CMAKE_MATCH_1}")
+    endif()
+endforeach()
+
+set(report "FreeRTOS kernel footprint\n\nObject sizes (bytes):\n")
+freertos_footprint_line("Task (StaticTask_t)" "${size_Task}")
+freertos_footprint_line("Queue, semaphore or mutex (StaticQueue_t)" "${size_Queue}")
+freertos_footprint_line("Event group (StaticEventGroup_t)" "${size_EventGroup}")
+freertos_footprint_line("Software timer (StaticTimer_t)" "${size_Timer}")
+freertos_footprint_line("Stream or message buffer (StaticStreamBuffer_t)" "${size_StreamBuffer}")
+freertos_footprint_line("Object pool (StaticPool_t)" "${size_Pool}")
+freertos_footprint_line("Light mutex (LightMutex_t)" "${size_LightMutex}")
+freertos_footprint_line("Reader-writer lock (RWLock_t)" "${size_RWLock}")
+freertos_footprint_line("List item (ListItem_t)" "${size_ListItem}")
+
+set(report "${report}\nPer task overhead (bytes):\n")
+freertos_footprint_line("TCB and configMINIMAL_STACK_SIZE stack" "${size_TaskOverhead}")
+
+# The static RAM of each module is the total size of its data and bss symbols.
+freertos_footprint_nm(${FREERTOS_KERNEL_LIBRARY} kernel_lines)
+
+set(modules "")
+set(module "")
+
+foreach(line IN LISTS kernel_lines)
+    if(line MATCHES "^(.+):$")
+        get_filename_component(module "${CMAKE_MATCH_1}" NAME)
+        string(REGEX REPLACE "\\.(o|obj)$" "" module "${module}")
+        string(MAKE_C_IDENTIFIER "${module}" module_id)
+        list(APPEND modules "${module}")
+        set(ram_${module_id} 0)
+    elseif((NOT module STREQUAL "") AND (line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [bBdDsSgG] "))
+        math(EXPR ram_${module_id} "${ram_${module_id}} + 0x${CMAKE_MATCH_1}")
+    endif()
+endforeach()
+
+set(report "${report}\nStatic RAM per module (bytes, data and bss):\n")
+set(total 0)
+
+foreach(module IN LISTS modules)
+    string(MAKE_C_IDENTIFIER "${module}" module_id)
+    freertos_footprint_line("${module}" "${ram_${module_id}}")
+    math(EXPR total "${total} + ${ram_${module_id}}")
+endforeach()
+
+freertos_footprint_line("Total" "${total}")
+
+file(WRITE ${FREERTOS_FOOTPRINT_REPORT} "${report}")
+message("${report}")
+message(STATUS "Footprint report written to ${FREERTOS_FOOTPRINT_REPORT}")
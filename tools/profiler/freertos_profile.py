@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+#/*
+# * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+# * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# *
+# * SPDX-License-Identifier: MIT
+# *
+# * Permission is hereby granted, free of charge, to any person obtaining a copy of
+# * this software and associated documentation files (the "Software"), to deal in
+# * the Software without restriction, including without limitation the rights to
+# * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# * the Software, and to permit persons to whom the Software is furnished to do so,
+# * subject to the following conditions:
+# *
+# * The above copyright notice and this permission notice shall be included in all
+# * copies or substantial portions of the Software.
+# *
+# * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+# *
+# * https://www.FreeRTOS.org
+# * https://github.com/FreeRTOS
+# *
+# */
+
+"""
+Aggregates the program counter samples recorded when configUSE_PC_SAMPLING is
+set to 1 and prints, for all tasks together and for each task in turn, the
+functions the samples fell in and the percentage of samples each received.
+
+The input is text with one sample per line, as printed by the example in the
+documentation of uxTaskGetPCSamples(): the task name followed by the program
+counter in hexadecimal.  The program counter is the last field on the line so
+task names may contain spaces.  Blank lines and lines starting with '#' are
+ignored.  Program counters are symbolised with the symbol table of the ELF file
+the firmware was built from, read with nm.
+"""
+
+import argparse
+import bisect
+import collections
+import subprocess
+import sys
+
+#--------------------------------------------------------------------------------------------------
+#                                            CONFIG
+#--------------------------------------------------------------------------------------------------
+# The nm symbol types that mark code.
+CODE_SYMBOL_TYPES = 'TtWw'
+
+UNKNOWN_FUNCTION = '<unknown>'
+
+#--------------------------------------------------------------------------------------------------
+#                                            SYMBOLS
+#--------------------------------------------------------------------------------------------------
+class ProfileError(Exception):
+    pass
+
+
+def read_symbols(nm, elf, thumb):
+    """Returns a list of (address, size, name) for the code symbols in elf, sorted by address."""
+    try:
+        output = subprocess.run([nm, '-n', '-S', '--defined-only', elf], check=True, capture_output=True,
+                                text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as error:
+        raise ProfileError('cannot read the symbols of {}: {}'.format(elf, error))
+
+    symbols = []
+    for line in output.splitlines():
+        fields = line.split()
+        # Symbols without a size have three fields, symbols with a size four.
+        if len(fields) == 4:
+            address, size, kind, name = int(fields[0], 16), int(fields[1], 16), fields[2], fields[3]
+        elif len(fields) == 3:
+            address, size, kind, name = int(fields[0], 16), None, fields[1], fields[2]
+        else:
+            continue
+
+        if kind not in CODE_SYMBOL_TYPES:
+            continue
+
+        if thumb:
+            # Thumb function symbols have bit 0 set.
+            address &= ~1
+
+        symbols.append((address, size, name))
+
+    symbols.sort()
+    return symbols
+
+
+def find_function(symbols, addresses, pc):
+    """Returns the name of the function containing pc, or UNKNOWN_FUNCTION."""
+    index = bisect.bisect_right(addresses, pc) - 1
+    if index < 0:
+        return UNKNOWN_FUNCTION
+
+    address, size, name = symbols[index]
+    if size is not None and pc >= address + size:
+        return UNKNOWN_FUNCTION
+
+    return name
+
+#--------------------------------------------------------------------------------------------------
+#                                            SAMPLES
+#--------------------------------------------------------------------------------------------------
+def read_samples(lines):
+    """Returns a list of (task, pc) read from lines of text."""
+    samples = []
+    for number, line in enumerate(lines, 1):
+        line = line.strip()
+        if not line or line.startswith('#'):
+            continue
+
+        fields = line.rsplit(None, 1)
+        if len(fields) != 2:
+            raise ProfileError('line {}: expected a task name and a program counter'.format(number))
+
+        try:
+            pc = int(fields[1], 16)
+        except ValueError:
+            raise ProfileError('line {}: {} is not a hexadecimal program counter'.format(number, fields[1]))
+
+        samples.append((fields[0], pc))
+
+    return samples
+
+
+def aggregate(samples, symbols):
+    """Returns the sample counts by function, and by function for each task."""
+    addresses = [address for (address, size, name) in symbols]
+    functions = collections.Counter()
+    tasks = collections.defaultdict(collections.Counter)
+
+    for task, pc in samples:
+        function = find_function(symbols, addresses, pc) if symbols else '0x{:x}'.format(pc)
+        functions[function] += 1
+        tasks[task][function] += 1
+
+    return functions, tasks
+
+#--------------------------------------------------------------------------------------------------
+#                                            OUTPUT
+#--------------------------------------------------------------------------------------------------
+def print_counts(title, counts, total, top, output):
+    task_total = sum(counts.values())
+    print('{} - {} samples, {:.1f}%'.format(title, task_total, task_total * 100.0 / total), file=output)
+    for function, count in counts.most_common(top):
+        print('    {:>7.2f}%  {:>8}  {}'.format(count * 100.0 / task_total, count, function), file=output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Aggregate FreeRTOS program counter samples.')
+    parser.add_argument('input', nargs='?', help='the samples, one "task pc" per line (default stdin)')
+    parser.add_argument('--elf', help='the ELF file of the firmware, used to name the functions sampled')
+    parser.add_argument('--nm', default='nm', help='the nm to read the ELF file with, such as arm-none-eabi-nm')
+    parser.add_argument('--thumb', action='store_true', help='clear bit 0 of symbol addresses, for Arm Thumb code')
+    parser.add_argument('--top', type=int, default=10, help='the number of functions to list for each task')
+    args = parser.parse_args()
+
+    try:
+        if args.input is None:
+            samples = read_samples(sys.stdin)
+        else:
+            with open(args.input) as f:
+                samples = read_samples(f)
+
+        symbols = read_symbols(args.nm, args.elf, args.thumb) if args.elf is not None else []
+    except (OSError, ProfileError) as error:
+        print('error: {}'.format(error), file=sys.stderr)
+        return 1
+
+    if not samples:
+        print('error: no samples', file=sys.stderr)
+        return 1
+
+    functions, tasks = aggregate(samples, symbols)
+    total = len(samples)
+
+    print_counts('All tasks', functions, total, args.top, sys.stdout)
+    for task, counts in sorted(tasks.items(), key=lambda item: -sum(item[1].values())):
+        print(file=sys.stdout)
+        print_counts(task, counts, total, args.top, sys.stdout)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+#/*
+# * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+# * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# *
+# * SPDX-License-Identifier: MIT
+# *
+# * Permission is hereby granted, free of charge, to any person obtaining a copy of
+# * this software and associated documentation files (the "Software"), to deal in
+# * the Software without restriction, including without limitation the rights to
+# * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# * the Software, and to permit persons to whom the Software is furnished to do so,
+# * subject to the following conditions:
+# *
+# * The above copyright notice and this permission notice shall be included in all
+# * copies or substantial portions of the Software.
+# *
+# * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+# *
+# * https://www.FreeRTOS.org
+# * https://github.com/FreeRTOS
+# *
+# */
+
+"""
+Decodes a snapshot written by the telemetry serialiser in telemetry.c, which is
+included when configUSE_TELEMETRY is set to 1, and prints it as JSON or as
+tables in the manner of vTaskListTasks().
+
+The layout is described in include/telemetry.h.  In brief: the four bytes
+"FRTM", a schema version byte and a flags byte, followed by records that each
+hold a type byte, a varint payload length and a payload of varints.  Record
+types and trailing fields that this decoder does not know are skipped, so it
+can read snapshots from newer kernels with the same schema version.
+"""
+
+import argparse
+import json
+import sys
+
+#--------------------------------------------------------------------------------------------------
+#                                            CONFIG
+#--------------------------------------------------------------------------------------------------
+TELEMETRY_MAGIC = b'FRTM'
+TELEMETRY_VERSION = 1
+HEADER_LENGTH = 6
+
+FLAG_TRUNCATED = 0x01
+
+# Each record type, with the names of the fields of its payload in order.  A
+# field name starting with '$' is a name rather than an integer.
+RECORD_TYPES = {
+    1: ('system', ['tick_count', 'total_run_time', 'number_of_tasks', 'number_of_cores']),
+    2: ('task', ['number', 'state', 'current_priority', 'base_priority', 'run_time',
+                 'stack_high_water_mark', '$name']),
+    3: ('heap', ['available_bytes', 'largest_free_block', 'smallest_free_block', 'free_blocks',
+                 'minimum_ever_free_bytes', 'successful_allocations', 'successful_frees']),
+    4: ('queue', ['number', 'type', '$name', 'sends', 'receives', 'blocks', 'timeouts', 'max_depth',
+                  'total_blocked_time', 'total_held_time', 'max_held_time', 'priority_inheritances']),
+    5: ('stream_buffer', ['number', 'type', 'sends', 'receives', 'blocks', 'timeouts', 'max_depth',
+                          'total_blocked_time', 'total_held_time', 'max_held_time',
+                          'priority_inheritances']),
+}
+
+# eTaskState, and the characters vTaskListTasks() prints for each state.
+TASK_STATES = {
+    0: ('running', 'X'),
+    1: ('ready', 'R'),
+    2: ('blocked', 'B'),
+    3: ('suspended', 'S'),
+    4: ('deleted', 'D'),
+    5: ('invalid', '?'),
+}
+
+#--------------------------------------------------------------------------------------------------
+#                                            DECODING
+#--------------------------------------------------------------------------------------------------
+class TelemetryError(Exception):
+    pass
+
+
+def read_varint(data, offset, end):
+    value = 0
+    shift = 0
+    while True:
+        if offset >= end:
+            raise TelemetryError('a varint runs past the end of its record')
+        byte = data[offset]
+        offset += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if (byte & 0x80) == 0:
+            return value, offset
+
+
+def decode_payload(fields, data, offset, end):
+    record = {}
+    for field in fields:
+        if offset >= end:
+            # Fields are only ever appended, so an older kernel may not have
+            # written the last few.
+            break
+        if field.startswith('$'):
+            length, offset = read_varint(data, offset, end)
+            if offset + length > end:
+                raise TelemetryError('a name runs past the end of its record')
+            record[field[1:]] = data[offset:offset + length].decode('utf-8', errors='replace')
+            offset += length
+        else:
+            record[field], offset = read_varint(data, offset, end)
+    return record
+
+
+def decode(data):
+    if len(data) < HEADER_LENGTH or data[0:4] != TELEMETRY_MAGIC:
+        raise TelemetryError('the input does not start with a telemetry header')
+
+    version = data[4]
+    if version != TELEMETRY_VERSION:
+        raise TelemetryError('telemetry schema version {} is not supported'.format(version))
+
+    snapshot = {
+        'version': version,
+        'truncated': (data[5] & FLAG_TRUNCATED) != 0,
+        'system': None,
+        'tasks': [],
+        'heap': None,
+        'queues': [],
+        'stream_buffers': [],
+    }
+
+    offset = HEADER_LENGTH
+    while offset < len(data):
+        record_type = data[offset]
+        length, offset = read_varint(data, offset + 1, len(data))
+        end = offset + length
+        if end > len(data):
+            raise TelemetryError('record type {} runs past the end of the input'.format(record_type))
+
+        if record_type in RECORD_TYPES:
+            name, fields = RECORD_TYPES[record_type]
+            record = decode_payload(fields, data, offset, end)
+            if name == 'task':
+                record['state'] = TASK_STATES.get(record.get('state'), ('unknown', '?'))[0]
+                snapshot['tasks'].append(record)
+            elif name in ('queue', 'stream_buffer'):
+                snapshot[name + 's'].append(record)
+            else:
+                snapshot[name] = record
+
+        offset = end
+
+    return snapshot
+
+#--------------------------------------------------------------------------------------------------
+#                                            OUTPUT
+#--------------------------------------------------------------------------------------------------
+def print_tables(snapshot, output):
+    system = snapshot['system']
+    if system is not None:
+        print('Tick {tick_count}, {number_of_tasks} tasks, {number_of_cores} core(s)'.format(**system), file=output)
+
+    if snapshot['tasks']:
+        total = system.get('total_run_time', 0) if system is not None else 0
+        print('{:<16}{:<6}{:<6}{:<8}{:<12}{:<12}{}'.format('Name', 'State', 'Prio', 'Stack', 'Number',
+                                                            'Run time', 'Percent'), file=output)
+        for task in snapshot['tasks']:
+            state = [c for (s, c) in TASK_STATES.values() if s == task.get('state')]
+            percent = '{}%'.format(task.get('run_time', 0) * 100 // total) if total > 0 else '-'
+            print('{:<16}{:<6}{:<6}{:<8}{:<12}{:<12}{}'.format(task.get('name', ''), state[0] if state else '?',
+                                                                task.get('current_priority', ''),
+                                                                task.get('stack_high_water_mark', ''),
+                                                                task.get('number', ''), task.get('run_time', ''),
+                                                                percent), file=output)
+
+    if snapshot['heap'] is not None:
+        print('Heap: ' + ', '.join('{} {}'.format(k, v) for k, v in snapshot['heap'].items()), file=output)
+
+    for kind in ('queues', 'stream_buffers'):
+        for record in snapshot[kind]:
+            label = record.get('name') or '{} {}'.format(kind[:-1].replace('_', ' '), record.get('number'))
+            stats = ', '.join('{} {}'.format(k, v) for k, v in record.items() if k not in ('name', 'number'))
+            print('{}: {}'.format(label, stats), file=output)
+
+    if snapshot['truncated']:
+        print('warning: the snapshot was truncated because the buffer was full', file=output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a FreeRTOS telemetry snapshot.')
+    parser.add_argument('input', help='the snapshot, as written by xTelemetryEnd()')
+    parser.add_argument('--json', action='store_true', help='print the snapshot as JSON instead of tables')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+
+    try:
+        snapshot = decode(data)
+    except TelemetryError as error:
+        print('error: {}'.format(error), file=sys.stderr)
+        return 1
+
+    if args.json:
+        json.dump(snapshot, sys.stdout, indent=2)
+        print()
+    else:
+        print_tables(snapshot, sys.stdout)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
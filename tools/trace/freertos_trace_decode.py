@@ -0,0 +1,313 @@
+#!/usr/bin/env python3
+#/*
+# * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+# * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# *
+# * SPDX-License-Identifier: MIT
+# *
+# * Permission is hereby granted, free of charge, to any person obtaining a copy of
+# * this software and associated documentation files (the "Software"), to deal in
+# * the Software without restriction, including without limitation the rights to
+# * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# * the Software, and to permit persons to whom the Software is furnished to do so,
+# * subject to the following conditions:
+# *
+# * The above copyright notice and this permission notice shall be included in all
+# * copies or substantial portions of the Software.
+# *
+# * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+# *
+# * https://www.FreeRTOS.org
+# * https://github.com/FreeRTOS
+# *
+# */
+
+"""
+Converts a trace recorded with configUSE_TRACE_RECORDER set to 1 into the
+Chrome trace event JSON format, which can be opened in Perfetto
+(https://ui.perfetto.dev) or chrome://tracing.
+
+The input is either the memory holding xTraceRecorder, saved by a debugger,
+or, with --stream, the bytes written to configTRACE_RECORDER_WRITE() from the
+call to vTraceRecorderStartStreaming() onwards.  The layout is described by
+the structures in include/trace_recorder.h.
+
+Each core is shown as a thread, with a slice for each time a task ran and for
+each interrupt recorded with traceISR_ENTER() and traceISR_EXIT().  Other
+events are shown as instants on the core on which they occurred.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+#--------------------------------------------------------------------------------------------------
+#                                            CONFIG
+#--------------------------------------------------------------------------------------------------
+TRACE_MAGIC = b'FRTR'
+TRACE_VERSION = 1
+
+HEADER_FORMAT = 'IHBBIII'
+EVENT_FORMAT = 'IHBB'
+
+EVENT_TASK_SWITCHED_IN = 1
+EVENT_ISR_ENTER = 16
+EVENT_ISR_EXIT = 17
+EVENT_TICK = 18
+EVENT_TASK_NAME = 32
+EVENT_QUEUE_NAME = 33
+
+TASK_EVENTS = {
+    2: 'Ready',
+    3: 'Create',
+    4: 'Delete',
+    5: 'Delay',
+    6: 'Suspend',
+    7: 'Resume',
+    8: 'Notify',
+    9: 'Wait for notification',
+}
+
+QUEUE_EVENTS = {
+    10: 'Create',
+    11: 'Delete',
+    12: 'Send',
+    13: 'Receive',
+    14: 'Block on send',
+    15: 'Block on receive',
+}
+
+EVENT_USER = 19
+
+#--------------------------------------------------------------------------------------------------
+#                                            DECODING
+#--------------------------------------------------------------------------------------------------
+class TraceError(Exception):
+    pass
+
+
+class Trace:
+    def __init__(self):
+        self.timestamp_hz = 1
+        self.number_of_cores = 1
+        self.names = {}
+        # One list of ( time, event id, object index ) per core, in time order.
+        self.events = []
+
+    def object_name(self, object_type, index):
+        name = self.names.get((object_type, index))
+        if name is None:
+            name = '{} {}'.format('Task' if object_type == EVENT_TASK_NAME else 'Queue', index)
+        return name
+
+
+def read_header(data):
+    if len(data) < struct.calcsize('<' + HEADER_FORMAT):
+        raise TraceError('the input is too short to hold a trace recorder header')
+
+    if data[0:4] == TRACE_MAGIC:
+        endian = '<'
+    elif data[0:4] == TRACE_MAGIC[::-1]:
+        endian = '>'
+    else:
+        raise TraceError('the input does not start with a trace recorder header')
+
+    header = struct.unpack_from(endian + HEADER_FORMAT, data, 0)
+    _, version, cores, name_length, timestamp_hz, events_per_core, name_table_length = header
+
+    if version != TRACE_VERSION:
+        raise TraceError('trace recorder version {} is not supported'.format(version))
+
+    return endian, cores, name_length, timestamp_hz, events_per_core, name_table_length
+
+
+def decode_name(raw):
+    return raw.split(b'\0', 1)[0].decode('utf-8', errors='replace')
+
+
+def decode_buffer(data):
+    endian, cores, name_length, timestamp_hz, events_per_core, name_table_length = read_header(data)
+
+    if events_per_core == 0:
+        raise TraceError('the input was recorded in streaming mode - use --stream')
+
+    trace = Trace()
+    trace.timestamp_hz = timestamp_hz
+    trace.number_of_cores = cores
+
+    offset = struct.calcsize(endian + HEADER_FORMAT)
+    names_written, = struct.unpack_from(endian + 'I', data, offset)
+    offset += 4
+
+    name_size = 4 + name_length
+    for i in range(min(names_written, name_table_length)):
+        index, object_type, _ = struct.unpack_from(endian + 'HBB', data, offset + i * name_size)
+        start = offset + i * name_size + 4
+        trace.names[(object_type, index)] = decode_name(data[start:start + name_length])
+    offset += name_table_length * name_size
+
+    if names_written > name_table_length:
+        print('warning: {} names did not fit in the name table'.format(names_written - name_table_length),
+              file=sys.stderr)
+
+    event_size = struct.calcsize(endian + EVENT_FORMAT)
+    core_size = 8 + events_per_core * event_size
+
+    if len(data) < offset + cores * core_size:
+        raise TraceError('the input is too short to hold the ring buffer of every core')
+
+    last_timestamps = []
+    for core in range(cores):
+        base = offset + core * core_size
+        last_timestamp, events_written = struct.unpack_from(endian + 'II', data, base)
+        count = min(events_written, events_per_core)
+        first = events_written - count
+
+        raw = []
+        for i in range(count):
+            position = (first + i) % events_per_core
+            raw.append(struct.unpack_from(endian + EVENT_FORMAT, data, base + 8 + position * event_size))
+
+        # Only the timestamp of the newest event is known, so work backwards
+        # from it.  The oldest delta is relative to an event that has been
+        # overwritten, so is not needed.
+        times = [0] * count
+        if count > 0:
+            times[-1] = last_timestamp
+            for i in range(count - 1, 0, -1):
+                times[i - 1] = times[i] - raw[i][0]
+
+        trace.events.append([(times[i], raw[i][2], raw[i][1]) for i in range(count)])
+        last_timestamps.append(last_timestamp)
+
+    # Every core reads the same timer, so align each core to the first using the
+    # wrapped difference between the timestamps of their newest events.
+    for core in range(1, cores):
+        difference = (last_timestamps[core] - last_timestamps[0]) & 0xFFFFFFFF
+        if difference >= 0x80000000:
+            difference -= 0x100000000
+        shift = last_timestamps[0] + difference - last_timestamps[core]
+        trace.events[core] = [(t + shift, e, i) for (t, e, i) in trace.events[core]]
+
+    return trace
+
+
+def decode_stream(data):
+    endian, cores, name_length, timestamp_hz, _, _ = read_header(data)
+
+    trace = Trace()
+    trace.timestamp_hz = timestamp_hz
+    trace.number_of_cores = cores
+    trace.events = [[] for _ in range(cores)]
+
+    times = [0] * cores
+    offset = struct.calcsize(endian + HEADER_FORMAT)
+    event_size = struct.calcsize(endian + EVENT_FORMAT)
+
+    while offset + event_size <= len(data):
+        delta, index, event_id, core = struct.unpack_from(endian + EVENT_FORMAT, data, offset)
+        offset += event_size
+
+        if event_id in (EVENT_TASK_NAME, EVENT_QUEUE_NAME):
+            if offset + name_length > len(data):
+                break
+            trace.names[(event_id, index)] = decode_name(data[offset:offset + name_length])
+            offset += name_length
+        elif core < cores:
+            times[core] += delta
+            trace.events[core].append((times[core], event_id, index))
+        else:
+            raise TraceError('event recorded on core {} of {}'.format(core, cores))
+
+    return trace
+
+#--------------------------------------------------------------------------------------------------
+#                                            OUTPUT
+#--------------------------------------------------------------------------------------------------
+def to_chrome_json(trace, include_ticks):
+    output = [{'name': 'process_name', 'ph': 'M', 'pid': 0, 'args': {'name': 'FreeRTOS'}}]
+
+    start = min((events[0][0] for events in trace.events if events), default=0)
+
+    def microseconds(timestamp):
+        return (timestamp - start) * 1000000.0 / trace.timestamp_hz
+
+    for core, events in enumerate(trace.events):
+        output.append({'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': core,
+                       'args': {'name': 'Core {}'.format(core)}})
+
+        running = None
+        interrupts = []
+
+        for timestamp, event_id, index in events:
+            ts = microseconds(timestamp)
+
+            if event_id == EVENT_TASK_SWITCHED_IN:
+                if running is not None:
+                    output.append({'name': running[1], 'ph': 'X', 'pid': 0, 'tid': core,
+                                   'ts': running[0], 'dur': ts - running[0]})
+                running = (ts, trace.object_name(EVENT_TASK_NAME, index))
+            elif event_id == EVENT_ISR_ENTER:
+                interrupts.append(ts)
+            elif event_id == EVENT_ISR_EXIT:
+                if interrupts:
+                    entered = interrupts.pop()
+                    output.append({'name': 'ISR', 'ph': 'X', 'pid': 0, 'tid': core,
+                                   'ts': entered, 'dur': ts - entered})
+            elif event_id == EVENT_TICK:
+                if include_ticks:
+                    output.append({'name': 'Tick', 'ph': 'i', 's': 't', 'pid': 0, 'tid': core, 'ts': ts,
+                                   'args': {'tick': index}})
+            elif event_id in TASK_EVENTS:
+                output.append({'name': '{} {}'.format(TASK_EVENTS[event_id], trace.object_name(EVENT_TASK_NAME, index)),
+                               'ph': 'i', 's': 't', 'pid': 0, 'tid': core, 'ts': ts})
+            elif event_id in QUEUE_EVENTS:
+                output.append({'name': '{} {}'.format(QUEUE_EVENTS[event_id], trace.object_name(EVENT_QUEUE_NAME, index)),
+                               'ph': 'i', 's': 't', 'pid': 0, 'tid': core, 'ts': ts})
+            elif event_id == EVENT_USER:
+                output.append({'name': 'User event {}'.format(index), 'ph': 'i', 's': 't', 'pid': 0, 'tid': core,
+                               'ts': ts})
+            else:
+                output.append({'name': 'Unknown event {}'.format(event_id), 'ph': 'i', 's': 't', 'pid': 0,
+                               'tid': core, 'ts': ts, 'args': {'index': index}})
+
+        # Close the slice of the task still running at the end of the trace.
+        if running is not None and events:
+            end = microseconds(events[-1][0])
+            output.append({'name': running[1], 'ph': 'X', 'pid': 0, 'tid': core,
+                           'ts': running[0], 'dur': end - running[0]})
+
+    return {'traceEvents': output, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a FreeRTOS trace recorder trace to Chrome trace JSON.')
+    parser.add_argument('input', help='the saved xTraceRecorder memory, or the captured stream')
+    parser.add_argument('output', help='the JSON file to write')
+    parser.add_argument('--stream', action='store_true', help='the input was captured in streaming mode')
+    parser.add_argument('--no-ticks', action='store_true', help='omit tick events from the output')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as f:
+        data = f.read()
+
+    try:
+        trace = decode_stream(data) if args.stream else decode_buffer(data)
+    except TraceError as error:
+        print('error: {}'.format(error), file=sys.stderr)
+        return 1
+
+    with open(args.output, 'w') as f:
+        json.dump(to_chrome_json(trace, not args.no_ticks), f)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,318 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes.  FreeRTOS.h includes trace_recorder.h. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the trace recorder. This #if is closed at the very bottom of this
+ * file. If you want to include the trace recorder then ensure
+ * configUSE_TRACE_RECORDER is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+/*
+ * Add a name to the name table, and write it to the stream if streaming has
+ * started.  Must be called with interrupts masked.
+ */
+    static void prvRecordName( uint8_t ucObjectType,
+                               UBaseType_t uxObjectIndex,
+                               const char * pcName ) PRIVILEGED_FUNCTION;
+
+    #if ( configTRACE_RECORDER_STREAMING == 1 )
+
+/*
+ * Write a name record, followed by the name, to the stream.
+ */
+        static void prvStreamName( const TraceObjectName_t * pxName ) PRIVILEGED_FUNCTION;
+    #endif
+
+/*-----------------------------------------------------------*/
+
+/* Not static, so the recorder can be found in the symbol table and saved by a
+ * debugger. */
+    PRIVILEGED_DATA TraceRecorder_t xTraceRecorder =
+    {
+        {
+            traceRECORDER_MAGIC,
+            traceRECORDER_VERSION,
+            ( uint8_t ) configNUMBER_OF_CORES,
+            ( uint8_t ) configTRACE_RECORDER_NAME_LENGTH,
+            ( uint32_t ) configTRACE_RECORDER_TIMESTAMP_HZ,
+            #if ( configTRACE_RECORDER_STREAMING == 0 )
+                ( uint32_t ) configTRACE_RECORDER_BUFFER_LENGTH,
+            #else
+                0U,
+            #endif
+            ( uint32_t ) configTRACE_RECORDER_NAME_TABLE_LENGTH
+        },
+        0U,
+        { { 0U } },
+        { { 0U } }
+    };
+
+/* The number assigned to the most recently created queue. */
+    PRIVILEGED_DATA static UBaseType_t uxLastQueueNumber = 0U;
+
+    #if ( configTRACE_RECORDER_STREAMING == 1 )
+        PRIVILEGED_DATA static volatile BaseType_t xStreaming = pdFALSE;
+    #endif
+
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderEvent( uint8_t ucEventId,
+                              UBaseType_t uxObjectIndex )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        TraceRecorderCore_t * pxCore;
+        TraceEvent_t * pxEvent;
+        uint32_t ulTimestamp;
+        BaseType_t xCoreID;
+
+        #if ( configTRACE_RECORDER_STREAMING == 1 )
+            TraceEvent_t xEvent;
+        #endif
+
+        /* Each core only writes to its own ring buffer, so masking interrupts on
+         * the calling core is enough to make the write safe - no lock is shared
+         * between cores.  Masking interrupts is safe from both tasks and
+         * interrupts, and nests within critical sections. */
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xCoreID = ( BaseType_t ) portGET_CORE_ID();
+            pxCore = &( xTraceRecorder.xCores[ xCoreID ] );
+
+            #if ( configTRACE_RECORDER_STREAMING == 1 )
+            {
+                pxEvent = &xEvent;
+            }
+            #else
+            {
+                pxEvent = &( pxCore->xEvents[ pxCore->ulEventsWritten & ( ( uint32_t ) configTRACE_RECORDER_BUFFER_LENGTH - 1U ) ] );
+            }
+            #endif
+
+            ulTimestamp = ( uint32_t ) configTRACE_RECORDER_TIMESTAMP();
+            pxEvent->ulTimestampDelta = ulTimestamp - pxCore->ulLastTimestamp;
+            pxEvent->usObjectIndex = ( uint16_t ) uxObjectIndex;
+            pxEvent->ucEventId = ucEventId;
+            pxEvent->ucCore = ( uint8_t ) xCoreID;
+
+            #if ( configTRACE_RECORDER_STREAMING == 1 )
+            {
+                if( xStreaming != pdFALSE )
+                {
+                    configTRACE_RECORDER_WRITE( pxEvent, sizeof( TraceEvent_t ) );
+                    pxCore->ulLastTimestamp = ulTimestamp;
+                    ( pxCore->ulEventsWritten )++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else
+            {
+                pxCore->ulLastTimestamp = ulTimestamp;
+                ( pxCore->ulEventsWritten )++;
+            }
+            #endif
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderNamedEvent( uint8_t ucEventId,
+                                   uint8_t ucObjectType,
+                                   UBaseType_t uxObjectIndex,
+                                   const char * pcName )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            prvRecordName( ucObjectType, uxObjectIndex, pcName );
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        if( ucEventId != 0U )
+        {
+            vTraceRecorderEvent( ucEventId, uxObjectIndex );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTraceRecorderQueueCreate( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        UBaseType_t uxQueueNumber;
+
+        /* Queue numbers start at 1, so 0 identifies a queue created before
+         * its number was assigned. */
+        uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            uxLastQueueNumber++;
+            uxQueueNumber = uxLastQueueNumber;
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        vTraceRecorderEvent( traceEVENT_QUEUE_CREATE, uxQueueNumber );
+
+        return uxQueueNumber;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTraceRecorderUserEvent( uint16_t usValue )
+    {
+        vTraceRecorderEvent( traceEVENT_USER, ( UBaseType_t ) usValue );
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configTRACE_RECORDER_STREAMING == 1 )
+
+        void vTraceRecorderStartStreaming( void )
+        {
+            UBaseType_t uxSavedInterruptStatus;
+            uint32_t ulTimestamp;
+            uint32_t ulName;
+            BaseType_t xCore;
+
+            uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+            {
+                configTRACE_RECORDER_WRITE( &( xTraceRecorder.xHeader ), sizeof( TraceRecorderHeader_t ) );
+
+                for( ulName = 0U; ( ulName < xTraceRecorder.ulNamesWritten ) && ( ulName < ( uint32_t ) configTRACE_RECORDER_NAME_TABLE_LENGTH ); ulName++ )
+                {
+                    prvStreamName( &( xTraceRecorder.xNames[ ulName ] ) );
+                }
+
+                /* The first event streamed from each core is timed from when
+                 * streaming started. */
+                ulTimestamp = ( uint32_t ) configTRACE_RECORDER_TIMESTAMP();
+
+                for( xCore = 0; xCore < ( BaseType_t ) configNUMBER_OF_CORES; xCore++ )
+                {
+                    xTraceRecorder.xCores[ xCore ].ulLastTimestamp = ulTimestamp;
+                }
+
+                xStreaming = pdTRUE;
+            }
+            portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+        }
+
+    #endif /* configTRACE_RECORDER_STREAMING */
+/*-----------------------------------------------------------*/
+
+    static void prvRecordName( uint8_t ucObjectType,
+                               UBaseType_t uxObjectIndex,
+                               const char * pcName )
+    {
+        TraceObjectName_t xName;
+        size_t x;
+
+        xName.usObjectIndex = ( uint16_t ) uxObjectIndex;
+        xName.ucObjectType = ucObjectType;
+        xName.ucReserved = 0U;
+
+        /* Copy up to the end of the name, padding with NULLs. */
+        for( x = 0U; x < ( size_t ) configTRACE_RECORDER_NAME_LENGTH; x++ )
+        {
+            if( ( pcName != NULL ) && ( ( x == 0U ) || ( xName.cName[ x - 1U ] != ( char ) 0x00 ) ) )
+            {
+                xName.cName[ x ] = pcName[ x ];
+            }
+            else
+            {
+                xName.cName[ x ] = ( char ) 0x00;
+            }
+        }
+
+        if( xTraceRecorder.ulNamesWritten < ( uint32_t ) configTRACE_RECORDER_NAME_TABLE_LENGTH )
+        {
+            ( void ) memcpy( &( xTraceRecorder.xNames[ xTraceRecorder.ulNamesWritten ] ), &xName, sizeof( TraceObjectName_t ) );
+        }
+        else
+        {
+            /* The table is full.  Names that do not fit are still streamed, and
+             * ulNamesWritten records how many were lost. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( xTraceRecorder.ulNamesWritten )++;
+
+        #if ( configTRACE_RECORDER_STREAMING == 1 )
+        {
+            if( xStreaming != pdFALSE )
+            {
+                prvStreamName( &xName );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configTRACE_RECORDER_STREAMING == 1 )
+
+        static void prvStreamName( const TraceObjectName_t * pxName )
+        {
+            TraceEvent_t xEvent;
+
+            xEvent.ulTimestampDelta = 0U;
+            xEvent.usObjectIndex = pxName->usObjectIndex;
+            xEvent.ucEventId = pxName->ucObjectType;
+            xEvent.ucCore = 0U;
+
+            configTRACE_RECORDER_WRITE( &xEvent, sizeof( TraceEvent_t ) );
+            configTRACE_RECORDER_WRITE( pxName->cName, sizeof( pxName->cName ) );
+        }
+
+    #endif /* configTRACE_RECORDER_STREAMING */
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TRACE_RECORDER */